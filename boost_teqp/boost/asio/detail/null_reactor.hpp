@@ -0,0 +1,85 @@
+//
+// detail/null_reactor.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_NULL_REACTOR_HPP
+#define BOOST_ASIO_DETAIL_NULL_REACTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_IOCP) \
+  || defined(BOOST_ASIO_WINDOWS_RUNTIME) \
+  || defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
+#include <boost/asio/detail/scheduler_operation.hpp>
+#include <boost/asio/detail/scheduler_task.hpp>
+#include <boost/asio/execution_context.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+class null_reactor
+  : public execution_context_service_base<null_reactor>,
+    public scheduler_task
+{
+public:
+  struct per_descriptor_data
+  {
+  };
+
+  // Constructor.
+  null_reactor(boost::asio::execution_context& ctx)
+    : execution_context_service_base<null_reactor>(ctx)
+  {
+  }
+
+  // Destructor.
+  ~null_reactor()
+  {
+  }
+
+  // Initialise the task.
+  void init_task()
+  {
+  }
+
+  // Destroy all user-defined handler objects owned by the service.
+  void shutdown()
+  {
+  }
+
+  // No-op because should never be called.
+  void run(long /*usec*/, op_queue<scheduler_operation>& /*ops*/)
+  {
+  }
+
+  // No-op.
+  void interrupt()
+  {
+  }
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_IOCP)
+       //   || defined(BOOST_ASIO_WINDOWS_RUNTIME)
+       //   || defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
+#endif // BOOST_ASIO_DETAIL_NULL_REACTOR_HPP
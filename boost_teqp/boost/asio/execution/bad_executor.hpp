@@ -0,0 +1,49 @@
+//
+// execution/bad_executor.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_EXECUTION_BAD_EXECUTOR_HPP
+#define BOOST_ASIO_EXECUTION_BAD_EXECUTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <exception>
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace execution {
+
+/// Exception thrown when trying to access an empty polymorphic executor.
+class bad_executor
+  : public std::exception
+{
+public:
+  /// Constructor.
+  BOOST_ASIO_DECL bad_executor() BOOST_ASIO_NOEXCEPT;
+
+  /// Obtain message associated with exception.
+  BOOST_ASIO_DECL virtual const char* what() const
+    BOOST_ASIO_NOEXCEPT_OR_NOTHROW;
+};
+
+} // namespace execution
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#if defined(BOOST_ASIO_HEADER_ONLY)
+# include <boost/asio/execution/impl/bad_executor.ipp>
+#endif // defined(BOOST_ASIO_HEADER_ONLY)
+
+#endif // BOOST_ASIO_EXECUTION_BAD_EXECUTOR_HPP
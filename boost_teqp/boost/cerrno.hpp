@@ -0,0 +1,15 @@
+//  Boost cerrno.hpp header  -------------------------------------------------//
+
+//  Copyright Beman Dawes 2005.
+//  Use, modification, and distribution is subject to the Boost Software
+//  License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+//  See library home page at http://www.boost.org/libs/system
+
+#ifndef BOOST_CERRNO_HPP_INCLUDED
+#define BOOST_CERRNO_HPP_INCLUDED
+
+#include <boost/system/detail/cerrno.hpp>
+
+#endif // #ifndef BOOST_CERRNO_HPP_INCLUDED
@@ -0,0 +1,22 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    This is an auto-generated file. Do not edit!
+==============================================================================*/
+
+#if FUSION_MAX_DEQUE_SIZE <= 10
+#include <boost/fusion/container/deque/detail/cpp03/preprocessed/deque10_fwd.hpp>
+#elif FUSION_MAX_DEQUE_SIZE <= 20
+#include <boost/fusion/container/deque/detail/cpp03/preprocessed/deque20_fwd.hpp>
+#elif FUSION_MAX_DEQUE_SIZE <= 30
+#include <boost/fusion/container/deque/detail/cpp03/preprocessed/deque30_fwd.hpp>
+#elif FUSION_MAX_DEQUE_SIZE <= 40
+#include <boost/fusion/container/deque/detail/cpp03/preprocessed/deque40_fwd.hpp>
+#elif FUSION_MAX_DEQUE_SIZE <= 50
+#include <boost/fusion/container/deque/detail/cpp03/preprocessed/deque50_fwd.hpp>
+#else
+#error "FUSION_MAX_DEQUE_SIZE out of bounds for preprocessed headers"
+#endif
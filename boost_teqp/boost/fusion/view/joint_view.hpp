@@ -0,0 +1,14 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying 
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(FUSION_SEQUENCE_VIEW_JOINT_VIEW_10022005_0610)
+#define FUSION_SEQUENCE_VIEW_JOINT_VIEW_10022005_0610
+
+#include <boost/fusion/support/config.hpp>
+#include <boost/fusion/view/joint_view/joint_view.hpp>
+#include <boost/fusion/view/joint_view/joint_view_iterator.hpp>
+
+#endif
@@ -0,0 +1,15 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2006 Dan Marsden
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying 
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(FUSION_ZIP_VIEW_23012006_0811)
+#define FUSION_ZIP_VIEW_23012006_0811
+
+#include <boost/fusion/support/config.hpp>
+#include <boost/fusion/view/zip_view/zip_view.hpp>
+#include <boost/fusion/view/zip_view/zip_view_iterator.hpp>
+
+#endif
@@ -0,0 +1,396 @@
+//  (C) Copyright John Maddock 2007.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  This file is machine generated, do not edit by hand
+
+// Polynomial evaluation using second order Horners rule
+#ifndef BOOST_MATH_TOOLS_RAT_EVAL_10_HPP
+#define BOOST_MATH_TOOLS_RAT_EVAL_10_HPP
+
+namespace boost{ namespace math{ namespace tools{ namespace detail{
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T*, const U*, const V&, const std::integral_constant<int, 0>*) BOOST_MATH_NOEXCEPT(V)
+{
+   return static_cast<V>(0);
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V&, const std::integral_constant<int, 1>*) BOOST_MATH_NOEXCEPT(V)
+{
+   return static_cast<V>(a[0]) / static_cast<V>(b[0]);
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 2>*) BOOST_MATH_NOEXCEPT(V)
+{
+   return static_cast<V>((a[1] * x + a[0]) / (b[1] * x + b[0]));
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 3>*) BOOST_MATH_NOEXCEPT(V)
+{
+   return static_cast<V>(((a[2] * x + a[1]) * x + a[0]) / ((b[2] * x + b[1]) * x + b[0]));
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 4>*) BOOST_MATH_NOEXCEPT(V)
+{
+   return static_cast<V>((((a[3] * x + a[2]) * x + a[1]) * x + a[0]) / (((b[3] * x + b[2]) * x + b[1]) * x + b[0]));
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 5>*) BOOST_MATH_NOEXCEPT(V)
+{
+   if(x <= 1)
+   {
+      V x2 = x * x;
+      V t[4];
+      t[0] = a[4] * x2 + a[2];
+      t[1] = a[3] * x2 + a[1];
+      t[2] = b[4] * x2 + b[2];
+      t[3] = b[3] * x2 + b[1];
+      t[0] *= x2;
+      t[2] *= x2;
+      t[0] += static_cast<V>(a[0]);
+      t[2] += static_cast<V>(b[0]);
+      t[1] *= x;
+      t[3] *= x;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+   else
+   {
+      V z = 1 / x;
+      V z2 = 1 / (x * x);
+      V t[4];
+      t[0] = a[0] * z2 + a[2];
+      t[1] = a[1] * z2 + a[3];
+      t[2] = b[0] * z2 + b[2];
+      t[3] = b[1] * z2 + b[3];
+      t[0] *= z2;
+      t[2] *= z2;
+      t[0] += static_cast<V>(a[4]);
+      t[2] += static_cast<V>(b[4]);
+      t[1] *= z;
+      t[3] *= z;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 6>*) BOOST_MATH_NOEXCEPT(V)
+{
+   if(x <= 1)
+   {
+      V x2 = x * x;
+      V t[4];
+      t[0] = a[5] * x2 + a[3];
+      t[1] = a[4] * x2 + a[2];
+      t[2] = b[5] * x2 + b[3];
+      t[3] = b[4] * x2 + b[2];
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[1]);
+      t[1] += static_cast<V>(a[0]);
+      t[2] += static_cast<V>(b[1]);
+      t[3] += static_cast<V>(b[0]);
+      t[0] *= x;
+      t[2] *= x;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+   else
+   {
+      V z = 1 / x;
+      V z2 = 1 / (x * x);
+      V t[4];
+      t[0] = a[0] * z2 + a[2];
+      t[1] = a[1] * z2 + a[3];
+      t[2] = b[0] * z2 + b[2];
+      t[3] = b[1] * z2 + b[3];
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[4]);
+      t[1] += static_cast<V>(a[5]);
+      t[2] += static_cast<V>(b[4]);
+      t[3] += static_cast<V>(b[5]);
+      t[0] *= z;
+      t[2] *= z;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 7>*) BOOST_MATH_NOEXCEPT(V)
+{
+   if(x <= 1)
+   {
+      V x2 = x * x;
+      V t[4];
+      t[0] = a[6] * x2 + a[4];
+      t[1] = a[5] * x2 + a[3];
+      t[2] = b[6] * x2 + b[4];
+      t[3] = b[5] * x2 + b[3];
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[2]);
+      t[1] += static_cast<V>(a[1]);
+      t[2] += static_cast<V>(b[2]);
+      t[3] += static_cast<V>(b[1]);
+      t[0] *= x2;
+      t[2] *= x2;
+      t[0] += static_cast<V>(a[0]);
+      t[2] += static_cast<V>(b[0]);
+      t[1] *= x;
+      t[3] *= x;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+   else
+   {
+      V z = 1 / x;
+      V z2 = 1 / (x * x);
+      V t[4];
+      t[0] = a[0] * z2 + a[2];
+      t[1] = a[1] * z2 + a[3];
+      t[2] = b[0] * z2 + b[2];
+      t[3] = b[1] * z2 + b[3];
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[4]);
+      t[1] += static_cast<V>(a[5]);
+      t[2] += static_cast<V>(b[4]);
+      t[3] += static_cast<V>(b[5]);
+      t[0] *= z2;
+      t[2] *= z2;
+      t[0] += static_cast<V>(a[6]);
+      t[2] += static_cast<V>(b[6]);
+      t[1] *= z;
+      t[3] *= z;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 8>*) BOOST_MATH_NOEXCEPT(V)
+{
+   if(x <= 1)
+   {
+      V x2 = x * x;
+      V t[4];
+      t[0] = a[7] * x2 + a[5];
+      t[1] = a[6] * x2 + a[4];
+      t[2] = b[7] * x2 + b[5];
+      t[3] = b[6] * x2 + b[4];
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[3]);
+      t[1] += static_cast<V>(a[2]);
+      t[2] += static_cast<V>(b[3]);
+      t[3] += static_cast<V>(b[2]);
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[1]);
+      t[1] += static_cast<V>(a[0]);
+      t[2] += static_cast<V>(b[1]);
+      t[3] += static_cast<V>(b[0]);
+      t[0] *= x;
+      t[2] *= x;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+   else
+   {
+      V z = 1 / x;
+      V z2 = 1 / (x * x);
+      V t[4];
+      t[0] = a[0] * z2 + a[2];
+      t[1] = a[1] * z2 + a[3];
+      t[2] = b[0] * z2 + b[2];
+      t[3] = b[1] * z2 + b[3];
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[4]);
+      t[1] += static_cast<V>(a[5]);
+      t[2] += static_cast<V>(b[4]);
+      t[3] += static_cast<V>(b[5]);
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[6]);
+      t[1] += static_cast<V>(a[7]);
+      t[2] += static_cast<V>(b[6]);
+      t[3] += static_cast<V>(b[7]);
+      t[0] *= z;
+      t[2] *= z;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 9>*) BOOST_MATH_NOEXCEPT(V)
+{
+   if(x <= 1)
+   {
+      V x2 = x * x;
+      V t[4];
+      t[0] = a[8] * x2 + a[6];
+      t[1] = a[7] * x2 + a[5];
+      t[2] = b[8] * x2 + b[6];
+      t[3] = b[7] * x2 + b[5];
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[4]);
+      t[1] += static_cast<V>(a[3]);
+      t[2] += static_cast<V>(b[4]);
+      t[3] += static_cast<V>(b[3]);
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[2]);
+      t[1] += static_cast<V>(a[1]);
+      t[2] += static_cast<V>(b[2]);
+      t[3] += static_cast<V>(b[1]);
+      t[0] *= x2;
+      t[2] *= x2;
+      t[0] += static_cast<V>(a[0]);
+      t[2] += static_cast<V>(b[0]);
+      t[1] *= x;
+      t[3] *= x;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+   else
+   {
+      V z = 1 / x;
+      V z2 = 1 / (x * x);
+      V t[4];
+      t[0] = a[0] * z2 + a[2];
+      t[1] = a[1] * z2 + a[3];
+      t[2] = b[0] * z2 + b[2];
+      t[3] = b[1] * z2 + b[3];
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[4]);
+      t[1] += static_cast<V>(a[5]);
+      t[2] += static_cast<V>(b[4]);
+      t[3] += static_cast<V>(b[5]);
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[6]);
+      t[1] += static_cast<V>(a[7]);
+      t[2] += static_cast<V>(b[6]);
+      t[3] += static_cast<V>(b[7]);
+      t[0] *= z2;
+      t[2] *= z2;
+      t[0] += static_cast<V>(a[8]);
+      t[2] += static_cast<V>(b[8]);
+      t[1] *= z;
+      t[3] *= z;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+}
+
+template <class T, class U, class V>
+inline V evaluate_rational_c_imp(const T* a, const U* b, const V& x, const std::integral_constant<int, 10>*) BOOST_MATH_NOEXCEPT(V)
+{
+   if(x <= 1)
+   {
+      V x2 = x * x;
+      V t[4];
+      t[0] = a[9] * x2 + a[7];
+      t[1] = a[8] * x2 + a[6];
+      t[2] = b[9] * x2 + b[7];
+      t[3] = b[8] * x2 + b[6];
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[5]);
+      t[1] += static_cast<V>(a[4]);
+      t[2] += static_cast<V>(b[5]);
+      t[3] += static_cast<V>(b[4]);
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[3]);
+      t[1] += static_cast<V>(a[2]);
+      t[2] += static_cast<V>(b[3]);
+      t[3] += static_cast<V>(b[2]);
+      t[0] *= x2;
+      t[1] *= x2;
+      t[2] *= x2;
+      t[3] *= x2;
+      t[0] += static_cast<V>(a[1]);
+      t[1] += static_cast<V>(a[0]);
+      t[2] += static_cast<V>(b[1]);
+      t[3] += static_cast<V>(b[0]);
+      t[0] *= x;
+      t[2] *= x;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+   else
+   {
+      V z = 1 / x;
+      V z2 = 1 / (x * x);
+      V t[4];
+      t[0] = a[0] * z2 + a[2];
+      t[1] = a[1] * z2 + a[3];
+      t[2] = b[0] * z2 + b[2];
+      t[3] = b[1] * z2 + b[3];
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[4]);
+      t[1] += static_cast<V>(a[5]);
+      t[2] += static_cast<V>(b[4]);
+      t[3] += static_cast<V>(b[5]);
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[6]);
+      t[1] += static_cast<V>(a[7]);
+      t[2] += static_cast<V>(b[6]);
+      t[3] += static_cast<V>(b[7]);
+      t[0] *= z2;
+      t[1] *= z2;
+      t[2] *= z2;
+      t[3] *= z2;
+      t[0] += static_cast<V>(a[8]);
+      t[1] += static_cast<V>(a[9]);
+      t[2] += static_cast<V>(b[8]);
+      t[3] += static_cast<V>(b[9]);
+      t[0] *= z;
+      t[2] *= z;
+      return (t[0] + t[1]) / (t[2] + t[3]);
+   }
+}
+
+
+}}}} // namespaces
+
+#endif // include guard
+
@@ -0,0 +1,12 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2018 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MP_CPP_COMPLEX_HPP
+#define BOOST_MP_CPP_COMPLEX_HPP
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/complex_adaptor.hpp>
+
+#endif
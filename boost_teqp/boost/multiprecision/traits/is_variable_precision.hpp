@@ -0,0 +1,25 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2018 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MP_IS_VARIABLE_PRECISION_HPP
+#define BOOST_MP_IS_VARIABLE_PRECISION_HPP
+
+#include <boost/multiprecision/detail/number_base.hpp>
+
+namespace boost { namespace multiprecision { namespace detail {
+
+template <class Backend>
+struct is_variable_precision : public std::integral_constant<bool, false>
+{};
+
+template <class Backend, expression_template_option ExpressionTemplates>
+struct is_variable_precision<number<Backend, ExpressionTemplates> > : public is_variable_precision<Backend>
+{};
+
+}
+}
+} // namespace boost::multiprecision::detail
+
+#endif // BOOST_MP_IS_BACKEND_HPP
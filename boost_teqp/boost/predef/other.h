@@ -0,0 +1,17 @@
+/*
+Copyright Rene Ferdinand Rivera Morell 2013-2020
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE_1_0.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#if !defined(BOOST_PREDEF_OTHER_H) || defined(BOOST_PREDEF_INTERNAL_GENERATE_TESTS)
+#ifndef BOOST_PREDEF_OTHER_H
+#define BOOST_PREDEF_OTHER_H
+#endif
+
+#include <boost/predef/other/endian.h>
+#include <boost/predef/other/wordsize.h>
+#include <boost/predef/other/workaround.h>
+
+#endif
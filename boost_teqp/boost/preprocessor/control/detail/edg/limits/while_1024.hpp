@@ -0,0 +1,1044 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002) */
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_CONTROL_DETAIL_EDG_WHILE_1024_HPP
+# define BOOST_PREPROCESSOR_CONTROL_DETAIL_EDG_WHILE_1024_HPP
+#
+# define BOOST_PP_WHILE_513(p, o, s) BOOST_PP_WHILE_513_I(p, o, s)
+# define BOOST_PP_WHILE_514(p, o, s) BOOST_PP_WHILE_514_I(p, o, s)
+# define BOOST_PP_WHILE_515(p, o, s) BOOST_PP_WHILE_515_I(p, o, s)
+# define BOOST_PP_WHILE_516(p, o, s) BOOST_PP_WHILE_516_I(p, o, s)
+# define BOOST_PP_WHILE_517(p, o, s) BOOST_PP_WHILE_517_I(p, o, s)
+# define BOOST_PP_WHILE_518(p, o, s) BOOST_PP_WHILE_518_I(p, o, s)
+# define BOOST_PP_WHILE_519(p, o, s) BOOST_PP_WHILE_519_I(p, o, s)
+# define BOOST_PP_WHILE_520(p, o, s) BOOST_PP_WHILE_520_I(p, o, s)
+# define BOOST_PP_WHILE_521(p, o, s) BOOST_PP_WHILE_521_I(p, o, s)
+# define BOOST_PP_WHILE_522(p, o, s) BOOST_PP_WHILE_522_I(p, o, s)
+# define BOOST_PP_WHILE_523(p, o, s) BOOST_PP_WHILE_523_I(p, o, s)
+# define BOOST_PP_WHILE_524(p, o, s) BOOST_PP_WHILE_524_I(p, o, s)
+# define BOOST_PP_WHILE_525(p, o, s) BOOST_PP_WHILE_525_I(p, o, s)
+# define BOOST_PP_WHILE_526(p, o, s) BOOST_PP_WHILE_526_I(p, o, s)
+# define BOOST_PP_WHILE_527(p, o, s) BOOST_PP_WHILE_527_I(p, o, s)
+# define BOOST_PP_WHILE_528(p, o, s) BOOST_PP_WHILE_528_I(p, o, s)
+# define BOOST_PP_WHILE_529(p, o, s) BOOST_PP_WHILE_529_I(p, o, s)
+# define BOOST_PP_WHILE_530(p, o, s) BOOST_PP_WHILE_530_I(p, o, s)
+# define BOOST_PP_WHILE_531(p, o, s) BOOST_PP_WHILE_531_I(p, o, s)
+# define BOOST_PP_WHILE_532(p, o, s) BOOST_PP_WHILE_532_I(p, o, s)
+# define BOOST_PP_WHILE_533(p, o, s) BOOST_PP_WHILE_533_I(p, o, s)
+# define BOOST_PP_WHILE_534(p, o, s) BOOST_PP_WHILE_534_I(p, o, s)
+# define BOOST_PP_WHILE_535(p, o, s) BOOST_PP_WHILE_535_I(p, o, s)
+# define BOOST_PP_WHILE_536(p, o, s) BOOST_PP_WHILE_536_I(p, o, s)
+# define BOOST_PP_WHILE_537(p, o, s) BOOST_PP_WHILE_537_I(p, o, s)
+# define BOOST_PP_WHILE_538(p, o, s) BOOST_PP_WHILE_538_I(p, o, s)
+# define BOOST_PP_WHILE_539(p, o, s) BOOST_PP_WHILE_539_I(p, o, s)
+# define BOOST_PP_WHILE_540(p, o, s) BOOST_PP_WHILE_540_I(p, o, s)
+# define BOOST_PP_WHILE_541(p, o, s) BOOST_PP_WHILE_541_I(p, o, s)
+# define BOOST_PP_WHILE_542(p, o, s) BOOST_PP_WHILE_542_I(p, o, s)
+# define BOOST_PP_WHILE_543(p, o, s) BOOST_PP_WHILE_543_I(p, o, s)
+# define BOOST_PP_WHILE_544(p, o, s) BOOST_PP_WHILE_544_I(p, o, s)
+# define BOOST_PP_WHILE_545(p, o, s) BOOST_PP_WHILE_545_I(p, o, s)
+# define BOOST_PP_WHILE_546(p, o, s) BOOST_PP_WHILE_546_I(p, o, s)
+# define BOOST_PP_WHILE_547(p, o, s) BOOST_PP_WHILE_547_I(p, o, s)
+# define BOOST_PP_WHILE_548(p, o, s) BOOST_PP_WHILE_548_I(p, o, s)
+# define BOOST_PP_WHILE_549(p, o, s) BOOST_PP_WHILE_549_I(p, o, s)
+# define BOOST_PP_WHILE_550(p, o, s) BOOST_PP_WHILE_550_I(p, o, s)
+# define BOOST_PP_WHILE_551(p, o, s) BOOST_PP_WHILE_551_I(p, o, s)
+# define BOOST_PP_WHILE_552(p, o, s) BOOST_PP_WHILE_552_I(p, o, s)
+# define BOOST_PP_WHILE_553(p, o, s) BOOST_PP_WHILE_553_I(p, o, s)
+# define BOOST_PP_WHILE_554(p, o, s) BOOST_PP_WHILE_554_I(p, o, s)
+# define BOOST_PP_WHILE_555(p, o, s) BOOST_PP_WHILE_555_I(p, o, s)
+# define BOOST_PP_WHILE_556(p, o, s) BOOST_PP_WHILE_556_I(p, o, s)
+# define BOOST_PP_WHILE_557(p, o, s) BOOST_PP_WHILE_557_I(p, o, s)
+# define BOOST_PP_WHILE_558(p, o, s) BOOST_PP_WHILE_558_I(p, o, s)
+# define BOOST_PP_WHILE_559(p, o, s) BOOST_PP_WHILE_559_I(p, o, s)
+# define BOOST_PP_WHILE_560(p, o, s) BOOST_PP_WHILE_560_I(p, o, s)
+# define BOOST_PP_WHILE_561(p, o, s) BOOST_PP_WHILE_561_I(p, o, s)
+# define BOOST_PP_WHILE_562(p, o, s) BOOST_PP_WHILE_562_I(p, o, s)
+# define BOOST_PP_WHILE_563(p, o, s) BOOST_PP_WHILE_563_I(p, o, s)
+# define BOOST_PP_WHILE_564(p, o, s) BOOST_PP_WHILE_564_I(p, o, s)
+# define BOOST_PP_WHILE_565(p, o, s) BOOST_PP_WHILE_565_I(p, o, s)
+# define BOOST_PP_WHILE_566(p, o, s) BOOST_PP_WHILE_566_I(p, o, s)
+# define BOOST_PP_WHILE_567(p, o, s) BOOST_PP_WHILE_567_I(p, o, s)
+# define BOOST_PP_WHILE_568(p, o, s) BOOST_PP_WHILE_568_I(p, o, s)
+# define BOOST_PP_WHILE_569(p, o, s) BOOST_PP_WHILE_569_I(p, o, s)
+# define BOOST_PP_WHILE_570(p, o, s) BOOST_PP_WHILE_570_I(p, o, s)
+# define BOOST_PP_WHILE_571(p, o, s) BOOST_PP_WHILE_571_I(p, o, s)
+# define BOOST_PP_WHILE_572(p, o, s) BOOST_PP_WHILE_572_I(p, o, s)
+# define BOOST_PP_WHILE_573(p, o, s) BOOST_PP_WHILE_573_I(p, o, s)
+# define BOOST_PP_WHILE_574(p, o, s) BOOST_PP_WHILE_574_I(p, o, s)
+# define BOOST_PP_WHILE_575(p, o, s) BOOST_PP_WHILE_575_I(p, o, s)
+# define BOOST_PP_WHILE_576(p, o, s) BOOST_PP_WHILE_576_I(p, o, s)
+# define BOOST_PP_WHILE_577(p, o, s) BOOST_PP_WHILE_577_I(p, o, s)
+# define BOOST_PP_WHILE_578(p, o, s) BOOST_PP_WHILE_578_I(p, o, s)
+# define BOOST_PP_WHILE_579(p, o, s) BOOST_PP_WHILE_579_I(p, o, s)
+# define BOOST_PP_WHILE_580(p, o, s) BOOST_PP_WHILE_580_I(p, o, s)
+# define BOOST_PP_WHILE_581(p, o, s) BOOST_PP_WHILE_581_I(p, o, s)
+# define BOOST_PP_WHILE_582(p, o, s) BOOST_PP_WHILE_582_I(p, o, s)
+# define BOOST_PP_WHILE_583(p, o, s) BOOST_PP_WHILE_583_I(p, o, s)
+# define BOOST_PP_WHILE_584(p, o, s) BOOST_PP_WHILE_584_I(p, o, s)
+# define BOOST_PP_WHILE_585(p, o, s) BOOST_PP_WHILE_585_I(p, o, s)
+# define BOOST_PP_WHILE_586(p, o, s) BOOST_PP_WHILE_586_I(p, o, s)
+# define BOOST_PP_WHILE_587(p, o, s) BOOST_PP_WHILE_587_I(p, o, s)
+# define BOOST_PP_WHILE_588(p, o, s) BOOST_PP_WHILE_588_I(p, o, s)
+# define BOOST_PP_WHILE_589(p, o, s) BOOST_PP_WHILE_589_I(p, o, s)
+# define BOOST_PP_WHILE_590(p, o, s) BOOST_PP_WHILE_590_I(p, o, s)
+# define BOOST_PP_WHILE_591(p, o, s) BOOST_PP_WHILE_591_I(p, o, s)
+# define BOOST_PP_WHILE_592(p, o, s) BOOST_PP_WHILE_592_I(p, o, s)
+# define BOOST_PP_WHILE_593(p, o, s) BOOST_PP_WHILE_593_I(p, o, s)
+# define BOOST_PP_WHILE_594(p, o, s) BOOST_PP_WHILE_594_I(p, o, s)
+# define BOOST_PP_WHILE_595(p, o, s) BOOST_PP_WHILE_595_I(p, o, s)
+# define BOOST_PP_WHILE_596(p, o, s) BOOST_PP_WHILE_596_I(p, o, s)
+# define BOOST_PP_WHILE_597(p, o, s) BOOST_PP_WHILE_597_I(p, o, s)
+# define BOOST_PP_WHILE_598(p, o, s) BOOST_PP_WHILE_598_I(p, o, s)
+# define BOOST_PP_WHILE_599(p, o, s) BOOST_PP_WHILE_599_I(p, o, s)
+# define BOOST_PP_WHILE_600(p, o, s) BOOST_PP_WHILE_600_I(p, o, s)
+# define BOOST_PP_WHILE_601(p, o, s) BOOST_PP_WHILE_601_I(p, o, s)
+# define BOOST_PP_WHILE_602(p, o, s) BOOST_PP_WHILE_602_I(p, o, s)
+# define BOOST_PP_WHILE_603(p, o, s) BOOST_PP_WHILE_603_I(p, o, s)
+# define BOOST_PP_WHILE_604(p, o, s) BOOST_PP_WHILE_604_I(p, o, s)
+# define BOOST_PP_WHILE_605(p, o, s) BOOST_PP_WHILE_605_I(p, o, s)
+# define BOOST_PP_WHILE_606(p, o, s) BOOST_PP_WHILE_606_I(p, o, s)
+# define BOOST_PP_WHILE_607(p, o, s) BOOST_PP_WHILE_607_I(p, o, s)
+# define BOOST_PP_WHILE_608(p, o, s) BOOST_PP_WHILE_608_I(p, o, s)
+# define BOOST_PP_WHILE_609(p, o, s) BOOST_PP_WHILE_609_I(p, o, s)
+# define BOOST_PP_WHILE_610(p, o, s) BOOST_PP_WHILE_610_I(p, o, s)
+# define BOOST_PP_WHILE_611(p, o, s) BOOST_PP_WHILE_611_I(p, o, s)
+# define BOOST_PP_WHILE_612(p, o, s) BOOST_PP_WHILE_612_I(p, o, s)
+# define BOOST_PP_WHILE_613(p, o, s) BOOST_PP_WHILE_613_I(p, o, s)
+# define BOOST_PP_WHILE_614(p, o, s) BOOST_PP_WHILE_614_I(p, o, s)
+# define BOOST_PP_WHILE_615(p, o, s) BOOST_PP_WHILE_615_I(p, o, s)
+# define BOOST_PP_WHILE_616(p, o, s) BOOST_PP_WHILE_616_I(p, o, s)
+# define BOOST_PP_WHILE_617(p, o, s) BOOST_PP_WHILE_617_I(p, o, s)
+# define BOOST_PP_WHILE_618(p, o, s) BOOST_PP_WHILE_618_I(p, o, s)
+# define BOOST_PP_WHILE_619(p, o, s) BOOST_PP_WHILE_619_I(p, o, s)
+# define BOOST_PP_WHILE_620(p, o, s) BOOST_PP_WHILE_620_I(p, o, s)
+# define BOOST_PP_WHILE_621(p, o, s) BOOST_PP_WHILE_621_I(p, o, s)
+# define BOOST_PP_WHILE_622(p, o, s) BOOST_PP_WHILE_622_I(p, o, s)
+# define BOOST_PP_WHILE_623(p, o, s) BOOST_PP_WHILE_623_I(p, o, s)
+# define BOOST_PP_WHILE_624(p, o, s) BOOST_PP_WHILE_624_I(p, o, s)
+# define BOOST_PP_WHILE_625(p, o, s) BOOST_PP_WHILE_625_I(p, o, s)
+# define BOOST_PP_WHILE_626(p, o, s) BOOST_PP_WHILE_626_I(p, o, s)
+# define BOOST_PP_WHILE_627(p, o, s) BOOST_PP_WHILE_627_I(p, o, s)
+# define BOOST_PP_WHILE_628(p, o, s) BOOST_PP_WHILE_628_I(p, o, s)
+# define BOOST_PP_WHILE_629(p, o, s) BOOST_PP_WHILE_629_I(p, o, s)
+# define BOOST_PP_WHILE_630(p, o, s) BOOST_PP_WHILE_630_I(p, o, s)
+# define BOOST_PP_WHILE_631(p, o, s) BOOST_PP_WHILE_631_I(p, o, s)
+# define BOOST_PP_WHILE_632(p, o, s) BOOST_PP_WHILE_632_I(p, o, s)
+# define BOOST_PP_WHILE_633(p, o, s) BOOST_PP_WHILE_633_I(p, o, s)
+# define BOOST_PP_WHILE_634(p, o, s) BOOST_PP_WHILE_634_I(p, o, s)
+# define BOOST_PP_WHILE_635(p, o, s) BOOST_PP_WHILE_635_I(p, o, s)
+# define BOOST_PP_WHILE_636(p, o, s) BOOST_PP_WHILE_636_I(p, o, s)
+# define BOOST_PP_WHILE_637(p, o, s) BOOST_PP_WHILE_637_I(p, o, s)
+# define BOOST_PP_WHILE_638(p, o, s) BOOST_PP_WHILE_638_I(p, o, s)
+# define BOOST_PP_WHILE_639(p, o, s) BOOST_PP_WHILE_639_I(p, o, s)
+# define BOOST_PP_WHILE_640(p, o, s) BOOST_PP_WHILE_640_I(p, o, s)
+# define BOOST_PP_WHILE_641(p, o, s) BOOST_PP_WHILE_641_I(p, o, s)
+# define BOOST_PP_WHILE_642(p, o, s) BOOST_PP_WHILE_642_I(p, o, s)
+# define BOOST_PP_WHILE_643(p, o, s) BOOST_PP_WHILE_643_I(p, o, s)
+# define BOOST_PP_WHILE_644(p, o, s) BOOST_PP_WHILE_644_I(p, o, s)
+# define BOOST_PP_WHILE_645(p, o, s) BOOST_PP_WHILE_645_I(p, o, s)
+# define BOOST_PP_WHILE_646(p, o, s) BOOST_PP_WHILE_646_I(p, o, s)
+# define BOOST_PP_WHILE_647(p, o, s) BOOST_PP_WHILE_647_I(p, o, s)
+# define BOOST_PP_WHILE_648(p, o, s) BOOST_PP_WHILE_648_I(p, o, s)
+# define BOOST_PP_WHILE_649(p, o, s) BOOST_PP_WHILE_649_I(p, o, s)
+# define BOOST_PP_WHILE_650(p, o, s) BOOST_PP_WHILE_650_I(p, o, s)
+# define BOOST_PP_WHILE_651(p, o, s) BOOST_PP_WHILE_651_I(p, o, s)
+# define BOOST_PP_WHILE_652(p, o, s) BOOST_PP_WHILE_652_I(p, o, s)
+# define BOOST_PP_WHILE_653(p, o, s) BOOST_PP_WHILE_653_I(p, o, s)
+# define BOOST_PP_WHILE_654(p, o, s) BOOST_PP_WHILE_654_I(p, o, s)
+# define BOOST_PP_WHILE_655(p, o, s) BOOST_PP_WHILE_655_I(p, o, s)
+# define BOOST_PP_WHILE_656(p, o, s) BOOST_PP_WHILE_656_I(p, o, s)
+# define BOOST_PP_WHILE_657(p, o, s) BOOST_PP_WHILE_657_I(p, o, s)
+# define BOOST_PP_WHILE_658(p, o, s) BOOST_PP_WHILE_658_I(p, o, s)
+# define BOOST_PP_WHILE_659(p, o, s) BOOST_PP_WHILE_659_I(p, o, s)
+# define BOOST_PP_WHILE_660(p, o, s) BOOST_PP_WHILE_660_I(p, o, s)
+# define BOOST_PP_WHILE_661(p, o, s) BOOST_PP_WHILE_661_I(p, o, s)
+# define BOOST_PP_WHILE_662(p, o, s) BOOST_PP_WHILE_662_I(p, o, s)
+# define BOOST_PP_WHILE_663(p, o, s) BOOST_PP_WHILE_663_I(p, o, s)
+# define BOOST_PP_WHILE_664(p, o, s) BOOST_PP_WHILE_664_I(p, o, s)
+# define BOOST_PP_WHILE_665(p, o, s) BOOST_PP_WHILE_665_I(p, o, s)
+# define BOOST_PP_WHILE_666(p, o, s) BOOST_PP_WHILE_666_I(p, o, s)
+# define BOOST_PP_WHILE_667(p, o, s) BOOST_PP_WHILE_667_I(p, o, s)
+# define BOOST_PP_WHILE_668(p, o, s) BOOST_PP_WHILE_668_I(p, o, s)
+# define BOOST_PP_WHILE_669(p, o, s) BOOST_PP_WHILE_669_I(p, o, s)
+# define BOOST_PP_WHILE_670(p, o, s) BOOST_PP_WHILE_670_I(p, o, s)
+# define BOOST_PP_WHILE_671(p, o, s) BOOST_PP_WHILE_671_I(p, o, s)
+# define BOOST_PP_WHILE_672(p, o, s) BOOST_PP_WHILE_672_I(p, o, s)
+# define BOOST_PP_WHILE_673(p, o, s) BOOST_PP_WHILE_673_I(p, o, s)
+# define BOOST_PP_WHILE_674(p, o, s) BOOST_PP_WHILE_674_I(p, o, s)
+# define BOOST_PP_WHILE_675(p, o, s) BOOST_PP_WHILE_675_I(p, o, s)
+# define BOOST_PP_WHILE_676(p, o, s) BOOST_PP_WHILE_676_I(p, o, s)
+# define BOOST_PP_WHILE_677(p, o, s) BOOST_PP_WHILE_677_I(p, o, s)
+# define BOOST_PP_WHILE_678(p, o, s) BOOST_PP_WHILE_678_I(p, o, s)
+# define BOOST_PP_WHILE_679(p, o, s) BOOST_PP_WHILE_679_I(p, o, s)
+# define BOOST_PP_WHILE_680(p, o, s) BOOST_PP_WHILE_680_I(p, o, s)
+# define BOOST_PP_WHILE_681(p, o, s) BOOST_PP_WHILE_681_I(p, o, s)
+# define BOOST_PP_WHILE_682(p, o, s) BOOST_PP_WHILE_682_I(p, o, s)
+# define BOOST_PP_WHILE_683(p, o, s) BOOST_PP_WHILE_683_I(p, o, s)
+# define BOOST_PP_WHILE_684(p, o, s) BOOST_PP_WHILE_684_I(p, o, s)
+# define BOOST_PP_WHILE_685(p, o, s) BOOST_PP_WHILE_685_I(p, o, s)
+# define BOOST_PP_WHILE_686(p, o, s) BOOST_PP_WHILE_686_I(p, o, s)
+# define BOOST_PP_WHILE_687(p, o, s) BOOST_PP_WHILE_687_I(p, o, s)
+# define BOOST_PP_WHILE_688(p, o, s) BOOST_PP_WHILE_688_I(p, o, s)
+# define BOOST_PP_WHILE_689(p, o, s) BOOST_PP_WHILE_689_I(p, o, s)
+# define BOOST_PP_WHILE_690(p, o, s) BOOST_PP_WHILE_690_I(p, o, s)
+# define BOOST_PP_WHILE_691(p, o, s) BOOST_PP_WHILE_691_I(p, o, s)
+# define BOOST_PP_WHILE_692(p, o, s) BOOST_PP_WHILE_692_I(p, o, s)
+# define BOOST_PP_WHILE_693(p, o, s) BOOST_PP_WHILE_693_I(p, o, s)
+# define BOOST_PP_WHILE_694(p, o, s) BOOST_PP_WHILE_694_I(p, o, s)
+# define BOOST_PP_WHILE_695(p, o, s) BOOST_PP_WHILE_695_I(p, o, s)
+# define BOOST_PP_WHILE_696(p, o, s) BOOST_PP_WHILE_696_I(p, o, s)
+# define BOOST_PP_WHILE_697(p, o, s) BOOST_PP_WHILE_697_I(p, o, s)
+# define BOOST_PP_WHILE_698(p, o, s) BOOST_PP_WHILE_698_I(p, o, s)
+# define BOOST_PP_WHILE_699(p, o, s) BOOST_PP_WHILE_699_I(p, o, s)
+# define BOOST_PP_WHILE_700(p, o, s) BOOST_PP_WHILE_700_I(p, o, s)
+# define BOOST_PP_WHILE_701(p, o, s) BOOST_PP_WHILE_701_I(p, o, s)
+# define BOOST_PP_WHILE_702(p, o, s) BOOST_PP_WHILE_702_I(p, o, s)
+# define BOOST_PP_WHILE_703(p, o, s) BOOST_PP_WHILE_703_I(p, o, s)
+# define BOOST_PP_WHILE_704(p, o, s) BOOST_PP_WHILE_704_I(p, o, s)
+# define BOOST_PP_WHILE_705(p, o, s) BOOST_PP_WHILE_705_I(p, o, s)
+# define BOOST_PP_WHILE_706(p, o, s) BOOST_PP_WHILE_706_I(p, o, s)
+# define BOOST_PP_WHILE_707(p, o, s) BOOST_PP_WHILE_707_I(p, o, s)
+# define BOOST_PP_WHILE_708(p, o, s) BOOST_PP_WHILE_708_I(p, o, s)
+# define BOOST_PP_WHILE_709(p, o, s) BOOST_PP_WHILE_709_I(p, o, s)
+# define BOOST_PP_WHILE_710(p, o, s) BOOST_PP_WHILE_710_I(p, o, s)
+# define BOOST_PP_WHILE_711(p, o, s) BOOST_PP_WHILE_711_I(p, o, s)
+# define BOOST_PP_WHILE_712(p, o, s) BOOST_PP_WHILE_712_I(p, o, s)
+# define BOOST_PP_WHILE_713(p, o, s) BOOST_PP_WHILE_713_I(p, o, s)
+# define BOOST_PP_WHILE_714(p, o, s) BOOST_PP_WHILE_714_I(p, o, s)
+# define BOOST_PP_WHILE_715(p, o, s) BOOST_PP_WHILE_715_I(p, o, s)
+# define BOOST_PP_WHILE_716(p, o, s) BOOST_PP_WHILE_716_I(p, o, s)
+# define BOOST_PP_WHILE_717(p, o, s) BOOST_PP_WHILE_717_I(p, o, s)
+# define BOOST_PP_WHILE_718(p, o, s) BOOST_PP_WHILE_718_I(p, o, s)
+# define BOOST_PP_WHILE_719(p, o, s) BOOST_PP_WHILE_719_I(p, o, s)
+# define BOOST_PP_WHILE_720(p, o, s) BOOST_PP_WHILE_720_I(p, o, s)
+# define BOOST_PP_WHILE_721(p, o, s) BOOST_PP_WHILE_721_I(p, o, s)
+# define BOOST_PP_WHILE_722(p, o, s) BOOST_PP_WHILE_722_I(p, o, s)
+# define BOOST_PP_WHILE_723(p, o, s) BOOST_PP_WHILE_723_I(p, o, s)
+# define BOOST_PP_WHILE_724(p, o, s) BOOST_PP_WHILE_724_I(p, o, s)
+# define BOOST_PP_WHILE_725(p, o, s) BOOST_PP_WHILE_725_I(p, o, s)
+# define BOOST_PP_WHILE_726(p, o, s) BOOST_PP_WHILE_726_I(p, o, s)
+# define BOOST_PP_WHILE_727(p, o, s) BOOST_PP_WHILE_727_I(p, o, s)
+# define BOOST_PP_WHILE_728(p, o, s) BOOST_PP_WHILE_728_I(p, o, s)
+# define BOOST_PP_WHILE_729(p, o, s) BOOST_PP_WHILE_729_I(p, o, s)
+# define BOOST_PP_WHILE_730(p, o, s) BOOST_PP_WHILE_730_I(p, o, s)
+# define BOOST_PP_WHILE_731(p, o, s) BOOST_PP_WHILE_731_I(p, o, s)
+# define BOOST_PP_WHILE_732(p, o, s) BOOST_PP_WHILE_732_I(p, o, s)
+# define BOOST_PP_WHILE_733(p, o, s) BOOST_PP_WHILE_733_I(p, o, s)
+# define BOOST_PP_WHILE_734(p, o, s) BOOST_PP_WHILE_734_I(p, o, s)
+# define BOOST_PP_WHILE_735(p, o, s) BOOST_PP_WHILE_735_I(p, o, s)
+# define BOOST_PP_WHILE_736(p, o, s) BOOST_PP_WHILE_736_I(p, o, s)
+# define BOOST_PP_WHILE_737(p, o, s) BOOST_PP_WHILE_737_I(p, o, s)
+# define BOOST_PP_WHILE_738(p, o, s) BOOST_PP_WHILE_738_I(p, o, s)
+# define BOOST_PP_WHILE_739(p, o, s) BOOST_PP_WHILE_739_I(p, o, s)
+# define BOOST_PP_WHILE_740(p, o, s) BOOST_PP_WHILE_740_I(p, o, s)
+# define BOOST_PP_WHILE_741(p, o, s) BOOST_PP_WHILE_741_I(p, o, s)
+# define BOOST_PP_WHILE_742(p, o, s) BOOST_PP_WHILE_742_I(p, o, s)
+# define BOOST_PP_WHILE_743(p, o, s) BOOST_PP_WHILE_743_I(p, o, s)
+# define BOOST_PP_WHILE_744(p, o, s) BOOST_PP_WHILE_744_I(p, o, s)
+# define BOOST_PP_WHILE_745(p, o, s) BOOST_PP_WHILE_745_I(p, o, s)
+# define BOOST_PP_WHILE_746(p, o, s) BOOST_PP_WHILE_746_I(p, o, s)
+# define BOOST_PP_WHILE_747(p, o, s) BOOST_PP_WHILE_747_I(p, o, s)
+# define BOOST_PP_WHILE_748(p, o, s) BOOST_PP_WHILE_748_I(p, o, s)
+# define BOOST_PP_WHILE_749(p, o, s) BOOST_PP_WHILE_749_I(p, o, s)
+# define BOOST_PP_WHILE_750(p, o, s) BOOST_PP_WHILE_750_I(p, o, s)
+# define BOOST_PP_WHILE_751(p, o, s) BOOST_PP_WHILE_751_I(p, o, s)
+# define BOOST_PP_WHILE_752(p, o, s) BOOST_PP_WHILE_752_I(p, o, s)
+# define BOOST_PP_WHILE_753(p, o, s) BOOST_PP_WHILE_753_I(p, o, s)
+# define BOOST_PP_WHILE_754(p, o, s) BOOST_PP_WHILE_754_I(p, o, s)
+# define BOOST_PP_WHILE_755(p, o, s) BOOST_PP_WHILE_755_I(p, o, s)
+# define BOOST_PP_WHILE_756(p, o, s) BOOST_PP_WHILE_756_I(p, o, s)
+# define BOOST_PP_WHILE_757(p, o, s) BOOST_PP_WHILE_757_I(p, o, s)
+# define BOOST_PP_WHILE_758(p, o, s) BOOST_PP_WHILE_758_I(p, o, s)
+# define BOOST_PP_WHILE_759(p, o, s) BOOST_PP_WHILE_759_I(p, o, s)
+# define BOOST_PP_WHILE_760(p, o, s) BOOST_PP_WHILE_760_I(p, o, s)
+# define BOOST_PP_WHILE_761(p, o, s) BOOST_PP_WHILE_761_I(p, o, s)
+# define BOOST_PP_WHILE_762(p, o, s) BOOST_PP_WHILE_762_I(p, o, s)
+# define BOOST_PP_WHILE_763(p, o, s) BOOST_PP_WHILE_763_I(p, o, s)
+# define BOOST_PP_WHILE_764(p, o, s) BOOST_PP_WHILE_764_I(p, o, s)
+# define BOOST_PP_WHILE_765(p, o, s) BOOST_PP_WHILE_765_I(p, o, s)
+# define BOOST_PP_WHILE_766(p, o, s) BOOST_PP_WHILE_766_I(p, o, s)
+# define BOOST_PP_WHILE_767(p, o, s) BOOST_PP_WHILE_767_I(p, o, s)
+# define BOOST_PP_WHILE_768(p, o, s) BOOST_PP_WHILE_768_I(p, o, s)
+# define BOOST_PP_WHILE_769(p, o, s) BOOST_PP_WHILE_769_I(p, o, s)
+# define BOOST_PP_WHILE_770(p, o, s) BOOST_PP_WHILE_770_I(p, o, s)
+# define BOOST_PP_WHILE_771(p, o, s) BOOST_PP_WHILE_771_I(p, o, s)
+# define BOOST_PP_WHILE_772(p, o, s) BOOST_PP_WHILE_772_I(p, o, s)
+# define BOOST_PP_WHILE_773(p, o, s) BOOST_PP_WHILE_773_I(p, o, s)
+# define BOOST_PP_WHILE_774(p, o, s) BOOST_PP_WHILE_774_I(p, o, s)
+# define BOOST_PP_WHILE_775(p, o, s) BOOST_PP_WHILE_775_I(p, o, s)
+# define BOOST_PP_WHILE_776(p, o, s) BOOST_PP_WHILE_776_I(p, o, s)
+# define BOOST_PP_WHILE_777(p, o, s) BOOST_PP_WHILE_777_I(p, o, s)
+# define BOOST_PP_WHILE_778(p, o, s) BOOST_PP_WHILE_778_I(p, o, s)
+# define BOOST_PP_WHILE_779(p, o, s) BOOST_PP_WHILE_779_I(p, o, s)
+# define BOOST_PP_WHILE_780(p, o, s) BOOST_PP_WHILE_780_I(p, o, s)
+# define BOOST_PP_WHILE_781(p, o, s) BOOST_PP_WHILE_781_I(p, o, s)
+# define BOOST_PP_WHILE_782(p, o, s) BOOST_PP_WHILE_782_I(p, o, s)
+# define BOOST_PP_WHILE_783(p, o, s) BOOST_PP_WHILE_783_I(p, o, s)
+# define BOOST_PP_WHILE_784(p, o, s) BOOST_PP_WHILE_784_I(p, o, s)
+# define BOOST_PP_WHILE_785(p, o, s) BOOST_PP_WHILE_785_I(p, o, s)
+# define BOOST_PP_WHILE_786(p, o, s) BOOST_PP_WHILE_786_I(p, o, s)
+# define BOOST_PP_WHILE_787(p, o, s) BOOST_PP_WHILE_787_I(p, o, s)
+# define BOOST_PP_WHILE_788(p, o, s) BOOST_PP_WHILE_788_I(p, o, s)
+# define BOOST_PP_WHILE_789(p, o, s) BOOST_PP_WHILE_789_I(p, o, s)
+# define BOOST_PP_WHILE_790(p, o, s) BOOST_PP_WHILE_790_I(p, o, s)
+# define BOOST_PP_WHILE_791(p, o, s) BOOST_PP_WHILE_791_I(p, o, s)
+# define BOOST_PP_WHILE_792(p, o, s) BOOST_PP_WHILE_792_I(p, o, s)
+# define BOOST_PP_WHILE_793(p, o, s) BOOST_PP_WHILE_793_I(p, o, s)
+# define BOOST_PP_WHILE_794(p, o, s) BOOST_PP_WHILE_794_I(p, o, s)
+# define BOOST_PP_WHILE_795(p, o, s) BOOST_PP_WHILE_795_I(p, o, s)
+# define BOOST_PP_WHILE_796(p, o, s) BOOST_PP_WHILE_796_I(p, o, s)
+# define BOOST_PP_WHILE_797(p, o, s) BOOST_PP_WHILE_797_I(p, o, s)
+# define BOOST_PP_WHILE_798(p, o, s) BOOST_PP_WHILE_798_I(p, o, s)
+# define BOOST_PP_WHILE_799(p, o, s) BOOST_PP_WHILE_799_I(p, o, s)
+# define BOOST_PP_WHILE_800(p, o, s) BOOST_PP_WHILE_800_I(p, o, s)
+# define BOOST_PP_WHILE_801(p, o, s) BOOST_PP_WHILE_801_I(p, o, s)
+# define BOOST_PP_WHILE_802(p, o, s) BOOST_PP_WHILE_802_I(p, o, s)
+# define BOOST_PP_WHILE_803(p, o, s) BOOST_PP_WHILE_803_I(p, o, s)
+# define BOOST_PP_WHILE_804(p, o, s) BOOST_PP_WHILE_804_I(p, o, s)
+# define BOOST_PP_WHILE_805(p, o, s) BOOST_PP_WHILE_805_I(p, o, s)
+# define BOOST_PP_WHILE_806(p, o, s) BOOST_PP_WHILE_806_I(p, o, s)
+# define BOOST_PP_WHILE_807(p, o, s) BOOST_PP_WHILE_807_I(p, o, s)
+# define BOOST_PP_WHILE_808(p, o, s) BOOST_PP_WHILE_808_I(p, o, s)
+# define BOOST_PP_WHILE_809(p, o, s) BOOST_PP_WHILE_809_I(p, o, s)
+# define BOOST_PP_WHILE_810(p, o, s) BOOST_PP_WHILE_810_I(p, o, s)
+# define BOOST_PP_WHILE_811(p, o, s) BOOST_PP_WHILE_811_I(p, o, s)
+# define BOOST_PP_WHILE_812(p, o, s) BOOST_PP_WHILE_812_I(p, o, s)
+# define BOOST_PP_WHILE_813(p, o, s) BOOST_PP_WHILE_813_I(p, o, s)
+# define BOOST_PP_WHILE_814(p, o, s) BOOST_PP_WHILE_814_I(p, o, s)
+# define BOOST_PP_WHILE_815(p, o, s) BOOST_PP_WHILE_815_I(p, o, s)
+# define BOOST_PP_WHILE_816(p, o, s) BOOST_PP_WHILE_816_I(p, o, s)
+# define BOOST_PP_WHILE_817(p, o, s) BOOST_PP_WHILE_817_I(p, o, s)
+# define BOOST_PP_WHILE_818(p, o, s) BOOST_PP_WHILE_818_I(p, o, s)
+# define BOOST_PP_WHILE_819(p, o, s) BOOST_PP_WHILE_819_I(p, o, s)
+# define BOOST_PP_WHILE_820(p, o, s) BOOST_PP_WHILE_820_I(p, o, s)
+# define BOOST_PP_WHILE_821(p, o, s) BOOST_PP_WHILE_821_I(p, o, s)
+# define BOOST_PP_WHILE_822(p, o, s) BOOST_PP_WHILE_822_I(p, o, s)
+# define BOOST_PP_WHILE_823(p, o, s) BOOST_PP_WHILE_823_I(p, o, s)
+# define BOOST_PP_WHILE_824(p, o, s) BOOST_PP_WHILE_824_I(p, o, s)
+# define BOOST_PP_WHILE_825(p, o, s) BOOST_PP_WHILE_825_I(p, o, s)
+# define BOOST_PP_WHILE_826(p, o, s) BOOST_PP_WHILE_826_I(p, o, s)
+# define BOOST_PP_WHILE_827(p, o, s) BOOST_PP_WHILE_827_I(p, o, s)
+# define BOOST_PP_WHILE_828(p, o, s) BOOST_PP_WHILE_828_I(p, o, s)
+# define BOOST_PP_WHILE_829(p, o, s) BOOST_PP_WHILE_829_I(p, o, s)
+# define BOOST_PP_WHILE_830(p, o, s) BOOST_PP_WHILE_830_I(p, o, s)
+# define BOOST_PP_WHILE_831(p, o, s) BOOST_PP_WHILE_831_I(p, o, s)
+# define BOOST_PP_WHILE_832(p, o, s) BOOST_PP_WHILE_832_I(p, o, s)
+# define BOOST_PP_WHILE_833(p, o, s) BOOST_PP_WHILE_833_I(p, o, s)
+# define BOOST_PP_WHILE_834(p, o, s) BOOST_PP_WHILE_834_I(p, o, s)
+# define BOOST_PP_WHILE_835(p, o, s) BOOST_PP_WHILE_835_I(p, o, s)
+# define BOOST_PP_WHILE_836(p, o, s) BOOST_PP_WHILE_836_I(p, o, s)
+# define BOOST_PP_WHILE_837(p, o, s) BOOST_PP_WHILE_837_I(p, o, s)
+# define BOOST_PP_WHILE_838(p, o, s) BOOST_PP_WHILE_838_I(p, o, s)
+# define BOOST_PP_WHILE_839(p, o, s) BOOST_PP_WHILE_839_I(p, o, s)
+# define BOOST_PP_WHILE_840(p, o, s) BOOST_PP_WHILE_840_I(p, o, s)
+# define BOOST_PP_WHILE_841(p, o, s) BOOST_PP_WHILE_841_I(p, o, s)
+# define BOOST_PP_WHILE_842(p, o, s) BOOST_PP_WHILE_842_I(p, o, s)
+# define BOOST_PP_WHILE_843(p, o, s) BOOST_PP_WHILE_843_I(p, o, s)
+# define BOOST_PP_WHILE_844(p, o, s) BOOST_PP_WHILE_844_I(p, o, s)
+# define BOOST_PP_WHILE_845(p, o, s) BOOST_PP_WHILE_845_I(p, o, s)
+# define BOOST_PP_WHILE_846(p, o, s) BOOST_PP_WHILE_846_I(p, o, s)
+# define BOOST_PP_WHILE_847(p, o, s) BOOST_PP_WHILE_847_I(p, o, s)
+# define BOOST_PP_WHILE_848(p, o, s) BOOST_PP_WHILE_848_I(p, o, s)
+# define BOOST_PP_WHILE_849(p, o, s) BOOST_PP_WHILE_849_I(p, o, s)
+# define BOOST_PP_WHILE_850(p, o, s) BOOST_PP_WHILE_850_I(p, o, s)
+# define BOOST_PP_WHILE_851(p, o, s) BOOST_PP_WHILE_851_I(p, o, s)
+# define BOOST_PP_WHILE_852(p, o, s) BOOST_PP_WHILE_852_I(p, o, s)
+# define BOOST_PP_WHILE_853(p, o, s) BOOST_PP_WHILE_853_I(p, o, s)
+# define BOOST_PP_WHILE_854(p, o, s) BOOST_PP_WHILE_854_I(p, o, s)
+# define BOOST_PP_WHILE_855(p, o, s) BOOST_PP_WHILE_855_I(p, o, s)
+# define BOOST_PP_WHILE_856(p, o, s) BOOST_PP_WHILE_856_I(p, o, s)
+# define BOOST_PP_WHILE_857(p, o, s) BOOST_PP_WHILE_857_I(p, o, s)
+# define BOOST_PP_WHILE_858(p, o, s) BOOST_PP_WHILE_858_I(p, o, s)
+# define BOOST_PP_WHILE_859(p, o, s) BOOST_PP_WHILE_859_I(p, o, s)
+# define BOOST_PP_WHILE_860(p, o, s) BOOST_PP_WHILE_860_I(p, o, s)
+# define BOOST_PP_WHILE_861(p, o, s) BOOST_PP_WHILE_861_I(p, o, s)
+# define BOOST_PP_WHILE_862(p, o, s) BOOST_PP_WHILE_862_I(p, o, s)
+# define BOOST_PP_WHILE_863(p, o, s) BOOST_PP_WHILE_863_I(p, o, s)
+# define BOOST_PP_WHILE_864(p, o, s) BOOST_PP_WHILE_864_I(p, o, s)
+# define BOOST_PP_WHILE_865(p, o, s) BOOST_PP_WHILE_865_I(p, o, s)
+# define BOOST_PP_WHILE_866(p, o, s) BOOST_PP_WHILE_866_I(p, o, s)
+# define BOOST_PP_WHILE_867(p, o, s) BOOST_PP_WHILE_867_I(p, o, s)
+# define BOOST_PP_WHILE_868(p, o, s) BOOST_PP_WHILE_868_I(p, o, s)
+# define BOOST_PP_WHILE_869(p, o, s) BOOST_PP_WHILE_869_I(p, o, s)
+# define BOOST_PP_WHILE_870(p, o, s) BOOST_PP_WHILE_870_I(p, o, s)
+# define BOOST_PP_WHILE_871(p, o, s) BOOST_PP_WHILE_871_I(p, o, s)
+# define BOOST_PP_WHILE_872(p, o, s) BOOST_PP_WHILE_872_I(p, o, s)
+# define BOOST_PP_WHILE_873(p, o, s) BOOST_PP_WHILE_873_I(p, o, s)
+# define BOOST_PP_WHILE_874(p, o, s) BOOST_PP_WHILE_874_I(p, o, s)
+# define BOOST_PP_WHILE_875(p, o, s) BOOST_PP_WHILE_875_I(p, o, s)
+# define BOOST_PP_WHILE_876(p, o, s) BOOST_PP_WHILE_876_I(p, o, s)
+# define BOOST_PP_WHILE_877(p, o, s) BOOST_PP_WHILE_877_I(p, o, s)
+# define BOOST_PP_WHILE_878(p, o, s) BOOST_PP_WHILE_878_I(p, o, s)
+# define BOOST_PP_WHILE_879(p, o, s) BOOST_PP_WHILE_879_I(p, o, s)
+# define BOOST_PP_WHILE_880(p, o, s) BOOST_PP_WHILE_880_I(p, o, s)
+# define BOOST_PP_WHILE_881(p, o, s) BOOST_PP_WHILE_881_I(p, o, s)
+# define BOOST_PP_WHILE_882(p, o, s) BOOST_PP_WHILE_882_I(p, o, s)
+# define BOOST_PP_WHILE_883(p, o, s) BOOST_PP_WHILE_883_I(p, o, s)
+# define BOOST_PP_WHILE_884(p, o, s) BOOST_PP_WHILE_884_I(p, o, s)
+# define BOOST_PP_WHILE_885(p, o, s) BOOST_PP_WHILE_885_I(p, o, s)
+# define BOOST_PP_WHILE_886(p, o, s) BOOST_PP_WHILE_886_I(p, o, s)
+# define BOOST_PP_WHILE_887(p, o, s) BOOST_PP_WHILE_887_I(p, o, s)
+# define BOOST_PP_WHILE_888(p, o, s) BOOST_PP_WHILE_888_I(p, o, s)
+# define BOOST_PP_WHILE_889(p, o, s) BOOST_PP_WHILE_889_I(p, o, s)
+# define BOOST_PP_WHILE_890(p, o, s) BOOST_PP_WHILE_890_I(p, o, s)
+# define BOOST_PP_WHILE_891(p, o, s) BOOST_PP_WHILE_891_I(p, o, s)
+# define BOOST_PP_WHILE_892(p, o, s) BOOST_PP_WHILE_892_I(p, o, s)
+# define BOOST_PP_WHILE_893(p, o, s) BOOST_PP_WHILE_893_I(p, o, s)
+# define BOOST_PP_WHILE_894(p, o, s) BOOST_PP_WHILE_894_I(p, o, s)
+# define BOOST_PP_WHILE_895(p, o, s) BOOST_PP_WHILE_895_I(p, o, s)
+# define BOOST_PP_WHILE_896(p, o, s) BOOST_PP_WHILE_896_I(p, o, s)
+# define BOOST_PP_WHILE_897(p, o, s) BOOST_PP_WHILE_897_I(p, o, s)
+# define BOOST_PP_WHILE_898(p, o, s) BOOST_PP_WHILE_898_I(p, o, s)
+# define BOOST_PP_WHILE_899(p, o, s) BOOST_PP_WHILE_899_I(p, o, s)
+# define BOOST_PP_WHILE_900(p, o, s) BOOST_PP_WHILE_900_I(p, o, s)
+# define BOOST_PP_WHILE_901(p, o, s) BOOST_PP_WHILE_901_I(p, o, s)
+# define BOOST_PP_WHILE_902(p, o, s) BOOST_PP_WHILE_902_I(p, o, s)
+# define BOOST_PP_WHILE_903(p, o, s) BOOST_PP_WHILE_903_I(p, o, s)
+# define BOOST_PP_WHILE_904(p, o, s) BOOST_PP_WHILE_904_I(p, o, s)
+# define BOOST_PP_WHILE_905(p, o, s) BOOST_PP_WHILE_905_I(p, o, s)
+# define BOOST_PP_WHILE_906(p, o, s) BOOST_PP_WHILE_906_I(p, o, s)
+# define BOOST_PP_WHILE_907(p, o, s) BOOST_PP_WHILE_907_I(p, o, s)
+# define BOOST_PP_WHILE_908(p, o, s) BOOST_PP_WHILE_908_I(p, o, s)
+# define BOOST_PP_WHILE_909(p, o, s) BOOST_PP_WHILE_909_I(p, o, s)
+# define BOOST_PP_WHILE_910(p, o, s) BOOST_PP_WHILE_910_I(p, o, s)
+# define BOOST_PP_WHILE_911(p, o, s) BOOST_PP_WHILE_911_I(p, o, s)
+# define BOOST_PP_WHILE_912(p, o, s) BOOST_PP_WHILE_912_I(p, o, s)
+# define BOOST_PP_WHILE_913(p, o, s) BOOST_PP_WHILE_913_I(p, o, s)
+# define BOOST_PP_WHILE_914(p, o, s) BOOST_PP_WHILE_914_I(p, o, s)
+# define BOOST_PP_WHILE_915(p, o, s) BOOST_PP_WHILE_915_I(p, o, s)
+# define BOOST_PP_WHILE_916(p, o, s) BOOST_PP_WHILE_916_I(p, o, s)
+# define BOOST_PP_WHILE_917(p, o, s) BOOST_PP_WHILE_917_I(p, o, s)
+# define BOOST_PP_WHILE_918(p, o, s) BOOST_PP_WHILE_918_I(p, o, s)
+# define BOOST_PP_WHILE_919(p, o, s) BOOST_PP_WHILE_919_I(p, o, s)
+# define BOOST_PP_WHILE_920(p, o, s) BOOST_PP_WHILE_920_I(p, o, s)
+# define BOOST_PP_WHILE_921(p, o, s) BOOST_PP_WHILE_921_I(p, o, s)
+# define BOOST_PP_WHILE_922(p, o, s) BOOST_PP_WHILE_922_I(p, o, s)
+# define BOOST_PP_WHILE_923(p, o, s) BOOST_PP_WHILE_923_I(p, o, s)
+# define BOOST_PP_WHILE_924(p, o, s) BOOST_PP_WHILE_924_I(p, o, s)
+# define BOOST_PP_WHILE_925(p, o, s) BOOST_PP_WHILE_925_I(p, o, s)
+# define BOOST_PP_WHILE_926(p, o, s) BOOST_PP_WHILE_926_I(p, o, s)
+# define BOOST_PP_WHILE_927(p, o, s) BOOST_PP_WHILE_927_I(p, o, s)
+# define BOOST_PP_WHILE_928(p, o, s) BOOST_PP_WHILE_928_I(p, o, s)
+# define BOOST_PP_WHILE_929(p, o, s) BOOST_PP_WHILE_929_I(p, o, s)
+# define BOOST_PP_WHILE_930(p, o, s) BOOST_PP_WHILE_930_I(p, o, s)
+# define BOOST_PP_WHILE_931(p, o, s) BOOST_PP_WHILE_931_I(p, o, s)
+# define BOOST_PP_WHILE_932(p, o, s) BOOST_PP_WHILE_932_I(p, o, s)
+# define BOOST_PP_WHILE_933(p, o, s) BOOST_PP_WHILE_933_I(p, o, s)
+# define BOOST_PP_WHILE_934(p, o, s) BOOST_PP_WHILE_934_I(p, o, s)
+# define BOOST_PP_WHILE_935(p, o, s) BOOST_PP_WHILE_935_I(p, o, s)
+# define BOOST_PP_WHILE_936(p, o, s) BOOST_PP_WHILE_936_I(p, o, s)
+# define BOOST_PP_WHILE_937(p, o, s) BOOST_PP_WHILE_937_I(p, o, s)
+# define BOOST_PP_WHILE_938(p, o, s) BOOST_PP_WHILE_938_I(p, o, s)
+# define BOOST_PP_WHILE_939(p, o, s) BOOST_PP_WHILE_939_I(p, o, s)
+# define BOOST_PP_WHILE_940(p, o, s) BOOST_PP_WHILE_940_I(p, o, s)
+# define BOOST_PP_WHILE_941(p, o, s) BOOST_PP_WHILE_941_I(p, o, s)
+# define BOOST_PP_WHILE_942(p, o, s) BOOST_PP_WHILE_942_I(p, o, s)
+# define BOOST_PP_WHILE_943(p, o, s) BOOST_PP_WHILE_943_I(p, o, s)
+# define BOOST_PP_WHILE_944(p, o, s) BOOST_PP_WHILE_944_I(p, o, s)
+# define BOOST_PP_WHILE_945(p, o, s) BOOST_PP_WHILE_945_I(p, o, s)
+# define BOOST_PP_WHILE_946(p, o, s) BOOST_PP_WHILE_946_I(p, o, s)
+# define BOOST_PP_WHILE_947(p, o, s) BOOST_PP_WHILE_947_I(p, o, s)
+# define BOOST_PP_WHILE_948(p, o, s) BOOST_PP_WHILE_948_I(p, o, s)
+# define BOOST_PP_WHILE_949(p, o, s) BOOST_PP_WHILE_949_I(p, o, s)
+# define BOOST_PP_WHILE_950(p, o, s) BOOST_PP_WHILE_950_I(p, o, s)
+# define BOOST_PP_WHILE_951(p, o, s) BOOST_PP_WHILE_951_I(p, o, s)
+# define BOOST_PP_WHILE_952(p, o, s) BOOST_PP_WHILE_952_I(p, o, s)
+# define BOOST_PP_WHILE_953(p, o, s) BOOST_PP_WHILE_953_I(p, o, s)
+# define BOOST_PP_WHILE_954(p, o, s) BOOST_PP_WHILE_954_I(p, o, s)
+# define BOOST_PP_WHILE_955(p, o, s) BOOST_PP_WHILE_955_I(p, o, s)
+# define BOOST_PP_WHILE_956(p, o, s) BOOST_PP_WHILE_956_I(p, o, s)
+# define BOOST_PP_WHILE_957(p, o, s) BOOST_PP_WHILE_957_I(p, o, s)
+# define BOOST_PP_WHILE_958(p, o, s) BOOST_PP_WHILE_958_I(p, o, s)
+# define BOOST_PP_WHILE_959(p, o, s) BOOST_PP_WHILE_959_I(p, o, s)
+# define BOOST_PP_WHILE_960(p, o, s) BOOST_PP_WHILE_960_I(p, o, s)
+# define BOOST_PP_WHILE_961(p, o, s) BOOST_PP_WHILE_961_I(p, o, s)
+# define BOOST_PP_WHILE_962(p, o, s) BOOST_PP_WHILE_962_I(p, o, s)
+# define BOOST_PP_WHILE_963(p, o, s) BOOST_PP_WHILE_963_I(p, o, s)
+# define BOOST_PP_WHILE_964(p, o, s) BOOST_PP_WHILE_964_I(p, o, s)
+# define BOOST_PP_WHILE_965(p, o, s) BOOST_PP_WHILE_965_I(p, o, s)
+# define BOOST_PP_WHILE_966(p, o, s) BOOST_PP_WHILE_966_I(p, o, s)
+# define BOOST_PP_WHILE_967(p, o, s) BOOST_PP_WHILE_967_I(p, o, s)
+# define BOOST_PP_WHILE_968(p, o, s) BOOST_PP_WHILE_968_I(p, o, s)
+# define BOOST_PP_WHILE_969(p, o, s) BOOST_PP_WHILE_969_I(p, o, s)
+# define BOOST_PP_WHILE_970(p, o, s) BOOST_PP_WHILE_970_I(p, o, s)
+# define BOOST_PP_WHILE_971(p, o, s) BOOST_PP_WHILE_971_I(p, o, s)
+# define BOOST_PP_WHILE_972(p, o, s) BOOST_PP_WHILE_972_I(p, o, s)
+# define BOOST_PP_WHILE_973(p, o, s) BOOST_PP_WHILE_973_I(p, o, s)
+# define BOOST_PP_WHILE_974(p, o, s) BOOST_PP_WHILE_974_I(p, o, s)
+# define BOOST_PP_WHILE_975(p, o, s) BOOST_PP_WHILE_975_I(p, o, s)
+# define BOOST_PP_WHILE_976(p, o, s) BOOST_PP_WHILE_976_I(p, o, s)
+# define BOOST_PP_WHILE_977(p, o, s) BOOST_PP_WHILE_977_I(p, o, s)
+# define BOOST_PP_WHILE_978(p, o, s) BOOST_PP_WHILE_978_I(p, o, s)
+# define BOOST_PP_WHILE_979(p, o, s) BOOST_PP_WHILE_979_I(p, o, s)
+# define BOOST_PP_WHILE_980(p, o, s) BOOST_PP_WHILE_980_I(p, o, s)
+# define BOOST_PP_WHILE_981(p, o, s) BOOST_PP_WHILE_981_I(p, o, s)
+# define BOOST_PP_WHILE_982(p, o, s) BOOST_PP_WHILE_982_I(p, o, s)
+# define BOOST_PP_WHILE_983(p, o, s) BOOST_PP_WHILE_983_I(p, o, s)
+# define BOOST_PP_WHILE_984(p, o, s) BOOST_PP_WHILE_984_I(p, o, s)
+# define BOOST_PP_WHILE_985(p, o, s) BOOST_PP_WHILE_985_I(p, o, s)
+# define BOOST_PP_WHILE_986(p, o, s) BOOST_PP_WHILE_986_I(p, o, s)
+# define BOOST_PP_WHILE_987(p, o, s) BOOST_PP_WHILE_987_I(p, o, s)
+# define BOOST_PP_WHILE_988(p, o, s) BOOST_PP_WHILE_988_I(p, o, s)
+# define BOOST_PP_WHILE_989(p, o, s) BOOST_PP_WHILE_989_I(p, o, s)
+# define BOOST_PP_WHILE_990(p, o, s) BOOST_PP_WHILE_990_I(p, o, s)
+# define BOOST_PP_WHILE_991(p, o, s) BOOST_PP_WHILE_991_I(p, o, s)
+# define BOOST_PP_WHILE_992(p, o, s) BOOST_PP_WHILE_992_I(p, o, s)
+# define BOOST_PP_WHILE_993(p, o, s) BOOST_PP_WHILE_993_I(p, o, s)
+# define BOOST_PP_WHILE_994(p, o, s) BOOST_PP_WHILE_994_I(p, o, s)
+# define BOOST_PP_WHILE_995(p, o, s) BOOST_PP_WHILE_995_I(p, o, s)
+# define BOOST_PP_WHILE_996(p, o, s) BOOST_PP_WHILE_996_I(p, o, s)
+# define BOOST_PP_WHILE_997(p, o, s) BOOST_PP_WHILE_997_I(p, o, s)
+# define BOOST_PP_WHILE_998(p, o, s) BOOST_PP_WHILE_998_I(p, o, s)
+# define BOOST_PP_WHILE_999(p, o, s) BOOST_PP_WHILE_999_I(p, o, s)
+# define BOOST_PP_WHILE_1000(p, o, s) BOOST_PP_WHILE_1000_I(p, o, s)
+# define BOOST_PP_WHILE_1001(p, o, s) BOOST_PP_WHILE_1001_I(p, o, s)
+# define BOOST_PP_WHILE_1002(p, o, s) BOOST_PP_WHILE_1002_I(p, o, s)
+# define BOOST_PP_WHILE_1003(p, o, s) BOOST_PP_WHILE_1003_I(p, o, s)
+# define BOOST_PP_WHILE_1004(p, o, s) BOOST_PP_WHILE_1004_I(p, o, s)
+# define BOOST_PP_WHILE_1005(p, o, s) BOOST_PP_WHILE_1005_I(p, o, s)
+# define BOOST_PP_WHILE_1006(p, o, s) BOOST_PP_WHILE_1006_I(p, o, s)
+# define BOOST_PP_WHILE_1007(p, o, s) BOOST_PP_WHILE_1007_I(p, o, s)
+# define BOOST_PP_WHILE_1008(p, o, s) BOOST_PP_WHILE_1008_I(p, o, s)
+# define BOOST_PP_WHILE_1009(p, o, s) BOOST_PP_WHILE_1009_I(p, o, s)
+# define BOOST_PP_WHILE_1010(p, o, s) BOOST_PP_WHILE_1010_I(p, o, s)
+# define BOOST_PP_WHILE_1011(p, o, s) BOOST_PP_WHILE_1011_I(p, o, s)
+# define BOOST_PP_WHILE_1012(p, o, s) BOOST_PP_WHILE_1012_I(p, o, s)
+# define BOOST_PP_WHILE_1013(p, o, s) BOOST_PP_WHILE_1013_I(p, o, s)
+# define BOOST_PP_WHILE_1014(p, o, s) BOOST_PP_WHILE_1014_I(p, o, s)
+# define BOOST_PP_WHILE_1015(p, o, s) BOOST_PP_WHILE_1015_I(p, o, s)
+# define BOOST_PP_WHILE_1016(p, o, s) BOOST_PP_WHILE_1016_I(p, o, s)
+# define BOOST_PP_WHILE_1017(p, o, s) BOOST_PP_WHILE_1017_I(p, o, s)
+# define BOOST_PP_WHILE_1018(p, o, s) BOOST_PP_WHILE_1018_I(p, o, s)
+# define BOOST_PP_WHILE_1019(p, o, s) BOOST_PP_WHILE_1019_I(p, o, s)
+# define BOOST_PP_WHILE_1020(p, o, s) BOOST_PP_WHILE_1020_I(p, o, s)
+# define BOOST_PP_WHILE_1021(p, o, s) BOOST_PP_WHILE_1021_I(p, o, s)
+# define BOOST_PP_WHILE_1022(p, o, s) BOOST_PP_WHILE_1022_I(p, o, s)
+# define BOOST_PP_WHILE_1023(p, o, s) BOOST_PP_WHILE_1023_I(p, o, s)
+# define BOOST_PP_WHILE_1024(p, o, s) BOOST_PP_WHILE_1024_I(p, o, s)
+#
+# define BOOST_PP_WHILE_513_I(p, o, s) BOOST_PP_IF(p(514, s), BOOST_PP_WHILE_514, s BOOST_PP_TUPLE_EAT_3)(p, o, o(514, s))
+# define BOOST_PP_WHILE_514_I(p, o, s) BOOST_PP_IF(p(515, s), BOOST_PP_WHILE_515, s BOOST_PP_TUPLE_EAT_3)(p, o, o(515, s))
+# define BOOST_PP_WHILE_515_I(p, o, s) BOOST_PP_IF(p(516, s), BOOST_PP_WHILE_516, s BOOST_PP_TUPLE_EAT_3)(p, o, o(516, s))
+# define BOOST_PP_WHILE_516_I(p, o, s) BOOST_PP_IF(p(517, s), BOOST_PP_WHILE_517, s BOOST_PP_TUPLE_EAT_3)(p, o, o(517, s))
+# define BOOST_PP_WHILE_517_I(p, o, s) BOOST_PP_IF(p(518, s), BOOST_PP_WHILE_518, s BOOST_PP_TUPLE_EAT_3)(p, o, o(518, s))
+# define BOOST_PP_WHILE_518_I(p, o, s) BOOST_PP_IF(p(519, s), BOOST_PP_WHILE_519, s BOOST_PP_TUPLE_EAT_3)(p, o, o(519, s))
+# define BOOST_PP_WHILE_519_I(p, o, s) BOOST_PP_IF(p(520, s), BOOST_PP_WHILE_520, s BOOST_PP_TUPLE_EAT_3)(p, o, o(520, s))
+# define BOOST_PP_WHILE_520_I(p, o, s) BOOST_PP_IF(p(521, s), BOOST_PP_WHILE_521, s BOOST_PP_TUPLE_EAT_3)(p, o, o(521, s))
+# define BOOST_PP_WHILE_521_I(p, o, s) BOOST_PP_IF(p(522, s), BOOST_PP_WHILE_522, s BOOST_PP_TUPLE_EAT_3)(p, o, o(522, s))
+# define BOOST_PP_WHILE_522_I(p, o, s) BOOST_PP_IF(p(523, s), BOOST_PP_WHILE_523, s BOOST_PP_TUPLE_EAT_3)(p, o, o(523, s))
+# define BOOST_PP_WHILE_523_I(p, o, s) BOOST_PP_IF(p(524, s), BOOST_PP_WHILE_524, s BOOST_PP_TUPLE_EAT_3)(p, o, o(524, s))
+# define BOOST_PP_WHILE_524_I(p, o, s) BOOST_PP_IF(p(525, s), BOOST_PP_WHILE_525, s BOOST_PP_TUPLE_EAT_3)(p, o, o(525, s))
+# define BOOST_PP_WHILE_525_I(p, o, s) BOOST_PP_IF(p(526, s), BOOST_PP_WHILE_526, s BOOST_PP_TUPLE_EAT_3)(p, o, o(526, s))
+# define BOOST_PP_WHILE_526_I(p, o, s) BOOST_PP_IF(p(527, s), BOOST_PP_WHILE_527, s BOOST_PP_TUPLE_EAT_3)(p, o, o(527, s))
+# define BOOST_PP_WHILE_527_I(p, o, s) BOOST_PP_IF(p(528, s), BOOST_PP_WHILE_528, s BOOST_PP_TUPLE_EAT_3)(p, o, o(528, s))
+# define BOOST_PP_WHILE_528_I(p, o, s) BOOST_PP_IF(p(529, s), BOOST_PP_WHILE_529, s BOOST_PP_TUPLE_EAT_3)(p, o, o(529, s))
+# define BOOST_PP_WHILE_529_I(p, o, s) BOOST_PP_IF(p(530, s), BOOST_PP_WHILE_530, s BOOST_PP_TUPLE_EAT_3)(p, o, o(530, s))
+# define BOOST_PP_WHILE_530_I(p, o, s) BOOST_PP_IF(p(531, s), BOOST_PP_WHILE_531, s BOOST_PP_TUPLE_EAT_3)(p, o, o(531, s))
+# define BOOST_PP_WHILE_531_I(p, o, s) BOOST_PP_IF(p(532, s), BOOST_PP_WHILE_532, s BOOST_PP_TUPLE_EAT_3)(p, o, o(532, s))
+# define BOOST_PP_WHILE_532_I(p, o, s) BOOST_PP_IF(p(533, s), BOOST_PP_WHILE_533, s BOOST_PP_TUPLE_EAT_3)(p, o, o(533, s))
+# define BOOST_PP_WHILE_533_I(p, o, s) BOOST_PP_IF(p(534, s), BOOST_PP_WHILE_534, s BOOST_PP_TUPLE_EAT_3)(p, o, o(534, s))
+# define BOOST_PP_WHILE_534_I(p, o, s) BOOST_PP_IF(p(535, s), BOOST_PP_WHILE_535, s BOOST_PP_TUPLE_EAT_3)(p, o, o(535, s))
+# define BOOST_PP_WHILE_535_I(p, o, s) BOOST_PP_IF(p(536, s), BOOST_PP_WHILE_536, s BOOST_PP_TUPLE_EAT_3)(p, o, o(536, s))
+# define BOOST_PP_WHILE_536_I(p, o, s) BOOST_PP_IF(p(537, s), BOOST_PP_WHILE_537, s BOOST_PP_TUPLE_EAT_3)(p, o, o(537, s))
+# define BOOST_PP_WHILE_537_I(p, o, s) BOOST_PP_IF(p(538, s), BOOST_PP_WHILE_538, s BOOST_PP_TUPLE_EAT_3)(p, o, o(538, s))
+# define BOOST_PP_WHILE_538_I(p, o, s) BOOST_PP_IF(p(539, s), BOOST_PP_WHILE_539, s BOOST_PP_TUPLE_EAT_3)(p, o, o(539, s))
+# define BOOST_PP_WHILE_539_I(p, o, s) BOOST_PP_IF(p(540, s), BOOST_PP_WHILE_540, s BOOST_PP_TUPLE_EAT_3)(p, o, o(540, s))
+# define BOOST_PP_WHILE_540_I(p, o, s) BOOST_PP_IF(p(541, s), BOOST_PP_WHILE_541, s BOOST_PP_TUPLE_EAT_3)(p, o, o(541, s))
+# define BOOST_PP_WHILE_541_I(p, o, s) BOOST_PP_IF(p(542, s), BOOST_PP_WHILE_542, s BOOST_PP_TUPLE_EAT_3)(p, o, o(542, s))
+# define BOOST_PP_WHILE_542_I(p, o, s) BOOST_PP_IF(p(543, s), BOOST_PP_WHILE_543, s BOOST_PP_TUPLE_EAT_3)(p, o, o(543, s))
+# define BOOST_PP_WHILE_543_I(p, o, s) BOOST_PP_IF(p(544, s), BOOST_PP_WHILE_544, s BOOST_PP_TUPLE_EAT_3)(p, o, o(544, s))
+# define BOOST_PP_WHILE_544_I(p, o, s) BOOST_PP_IF(p(545, s), BOOST_PP_WHILE_545, s BOOST_PP_TUPLE_EAT_3)(p, o, o(545, s))
+# define BOOST_PP_WHILE_545_I(p, o, s) BOOST_PP_IF(p(546, s), BOOST_PP_WHILE_546, s BOOST_PP_TUPLE_EAT_3)(p, o, o(546, s))
+# define BOOST_PP_WHILE_546_I(p, o, s) BOOST_PP_IF(p(547, s), BOOST_PP_WHILE_547, s BOOST_PP_TUPLE_EAT_3)(p, o, o(547, s))
+# define BOOST_PP_WHILE_547_I(p, o, s) BOOST_PP_IF(p(548, s), BOOST_PP_WHILE_548, s BOOST_PP_TUPLE_EAT_3)(p, o, o(548, s))
+# define BOOST_PP_WHILE_548_I(p, o, s) BOOST_PP_IF(p(549, s), BOOST_PP_WHILE_549, s BOOST_PP_TUPLE_EAT_3)(p, o, o(549, s))
+# define BOOST_PP_WHILE_549_I(p, o, s) BOOST_PP_IF(p(550, s), BOOST_PP_WHILE_550, s BOOST_PP_TUPLE_EAT_3)(p, o, o(550, s))
+# define BOOST_PP_WHILE_550_I(p, o, s) BOOST_PP_IF(p(551, s), BOOST_PP_WHILE_551, s BOOST_PP_TUPLE_EAT_3)(p, o, o(551, s))
+# define BOOST_PP_WHILE_551_I(p, o, s) BOOST_PP_IF(p(552, s), BOOST_PP_WHILE_552, s BOOST_PP_TUPLE_EAT_3)(p, o, o(552, s))
+# define BOOST_PP_WHILE_552_I(p, o, s) BOOST_PP_IF(p(553, s), BOOST_PP_WHILE_553, s BOOST_PP_TUPLE_EAT_3)(p, o, o(553, s))
+# define BOOST_PP_WHILE_553_I(p, o, s) BOOST_PP_IF(p(554, s), BOOST_PP_WHILE_554, s BOOST_PP_TUPLE_EAT_3)(p, o, o(554, s))
+# define BOOST_PP_WHILE_554_I(p, o, s) BOOST_PP_IF(p(555, s), BOOST_PP_WHILE_555, s BOOST_PP_TUPLE_EAT_3)(p, o, o(555, s))
+# define BOOST_PP_WHILE_555_I(p, o, s) BOOST_PP_IF(p(556, s), BOOST_PP_WHILE_556, s BOOST_PP_TUPLE_EAT_3)(p, o, o(556, s))
+# define BOOST_PP_WHILE_556_I(p, o, s) BOOST_PP_IF(p(557, s), BOOST_PP_WHILE_557, s BOOST_PP_TUPLE_EAT_3)(p, o, o(557, s))
+# define BOOST_PP_WHILE_557_I(p, o, s) BOOST_PP_IF(p(558, s), BOOST_PP_WHILE_558, s BOOST_PP_TUPLE_EAT_3)(p, o, o(558, s))
+# define BOOST_PP_WHILE_558_I(p, o, s) BOOST_PP_IF(p(559, s), BOOST_PP_WHILE_559, s BOOST_PP_TUPLE_EAT_3)(p, o, o(559, s))
+# define BOOST_PP_WHILE_559_I(p, o, s) BOOST_PP_IF(p(560, s), BOOST_PP_WHILE_560, s BOOST_PP_TUPLE_EAT_3)(p, o, o(560, s))
+# define BOOST_PP_WHILE_560_I(p, o, s) BOOST_PP_IF(p(561, s), BOOST_PP_WHILE_561, s BOOST_PP_TUPLE_EAT_3)(p, o, o(561, s))
+# define BOOST_PP_WHILE_561_I(p, o, s) BOOST_PP_IF(p(562, s), BOOST_PP_WHILE_562, s BOOST_PP_TUPLE_EAT_3)(p, o, o(562, s))
+# define BOOST_PP_WHILE_562_I(p, o, s) BOOST_PP_IF(p(563, s), BOOST_PP_WHILE_563, s BOOST_PP_TUPLE_EAT_3)(p, o, o(563, s))
+# define BOOST_PP_WHILE_563_I(p, o, s) BOOST_PP_IF(p(564, s), BOOST_PP_WHILE_564, s BOOST_PP_TUPLE_EAT_3)(p, o, o(564, s))
+# define BOOST_PP_WHILE_564_I(p, o, s) BOOST_PP_IF(p(565, s), BOOST_PP_WHILE_565, s BOOST_PP_TUPLE_EAT_3)(p, o, o(565, s))
+# define BOOST_PP_WHILE_565_I(p, o, s) BOOST_PP_IF(p(566, s), BOOST_PP_WHILE_566, s BOOST_PP_TUPLE_EAT_3)(p, o, o(566, s))
+# define BOOST_PP_WHILE_566_I(p, o, s) BOOST_PP_IF(p(567, s), BOOST_PP_WHILE_567, s BOOST_PP_TUPLE_EAT_3)(p, o, o(567, s))
+# define BOOST_PP_WHILE_567_I(p, o, s) BOOST_PP_IF(p(568, s), BOOST_PP_WHILE_568, s BOOST_PP_TUPLE_EAT_3)(p, o, o(568, s))
+# define BOOST_PP_WHILE_568_I(p, o, s) BOOST_PP_IF(p(569, s), BOOST_PP_WHILE_569, s BOOST_PP_TUPLE_EAT_3)(p, o, o(569, s))
+# define BOOST_PP_WHILE_569_I(p, o, s) BOOST_PP_IF(p(570, s), BOOST_PP_WHILE_570, s BOOST_PP_TUPLE_EAT_3)(p, o, o(570, s))
+# define BOOST_PP_WHILE_570_I(p, o, s) BOOST_PP_IF(p(571, s), BOOST_PP_WHILE_571, s BOOST_PP_TUPLE_EAT_3)(p, o, o(571, s))
+# define BOOST_PP_WHILE_571_I(p, o, s) BOOST_PP_IF(p(572, s), BOOST_PP_WHILE_572, s BOOST_PP_TUPLE_EAT_3)(p, o, o(572, s))
+# define BOOST_PP_WHILE_572_I(p, o, s) BOOST_PP_IF(p(573, s), BOOST_PP_WHILE_573, s BOOST_PP_TUPLE_EAT_3)(p, o, o(573, s))
+# define BOOST_PP_WHILE_573_I(p, o, s) BOOST_PP_IF(p(574, s), BOOST_PP_WHILE_574, s BOOST_PP_TUPLE_EAT_3)(p, o, o(574, s))
+# define BOOST_PP_WHILE_574_I(p, o, s) BOOST_PP_IF(p(575, s), BOOST_PP_WHILE_575, s BOOST_PP_TUPLE_EAT_3)(p, o, o(575, s))
+# define BOOST_PP_WHILE_575_I(p, o, s) BOOST_PP_IF(p(576, s), BOOST_PP_WHILE_576, s BOOST_PP_TUPLE_EAT_3)(p, o, o(576, s))
+# define BOOST_PP_WHILE_576_I(p, o, s) BOOST_PP_IF(p(577, s), BOOST_PP_WHILE_577, s BOOST_PP_TUPLE_EAT_3)(p, o, o(577, s))
+# define BOOST_PP_WHILE_577_I(p, o, s) BOOST_PP_IF(p(578, s), BOOST_PP_WHILE_578, s BOOST_PP_TUPLE_EAT_3)(p, o, o(578, s))
+# define BOOST_PP_WHILE_578_I(p, o, s) BOOST_PP_IF(p(579, s), BOOST_PP_WHILE_579, s BOOST_PP_TUPLE_EAT_3)(p, o, o(579, s))
+# define BOOST_PP_WHILE_579_I(p, o, s) BOOST_PP_IF(p(580, s), BOOST_PP_WHILE_580, s BOOST_PP_TUPLE_EAT_3)(p, o, o(580, s))
+# define BOOST_PP_WHILE_580_I(p, o, s) BOOST_PP_IF(p(581, s), BOOST_PP_WHILE_581, s BOOST_PP_TUPLE_EAT_3)(p, o, o(581, s))
+# define BOOST_PP_WHILE_581_I(p, o, s) BOOST_PP_IF(p(582, s), BOOST_PP_WHILE_582, s BOOST_PP_TUPLE_EAT_3)(p, o, o(582, s))
+# define BOOST_PP_WHILE_582_I(p, o, s) BOOST_PP_IF(p(583, s), BOOST_PP_WHILE_583, s BOOST_PP_TUPLE_EAT_3)(p, o, o(583, s))
+# define BOOST_PP_WHILE_583_I(p, o, s) BOOST_PP_IF(p(584, s), BOOST_PP_WHILE_584, s BOOST_PP_TUPLE_EAT_3)(p, o, o(584, s))
+# define BOOST_PP_WHILE_584_I(p, o, s) BOOST_PP_IF(p(585, s), BOOST_PP_WHILE_585, s BOOST_PP_TUPLE_EAT_3)(p, o, o(585, s))
+# define BOOST_PP_WHILE_585_I(p, o, s) BOOST_PP_IF(p(586, s), BOOST_PP_WHILE_586, s BOOST_PP_TUPLE_EAT_3)(p, o, o(586, s))
+# define BOOST_PP_WHILE_586_I(p, o, s) BOOST_PP_IF(p(587, s), BOOST_PP_WHILE_587, s BOOST_PP_TUPLE_EAT_3)(p, o, o(587, s))
+# define BOOST_PP_WHILE_587_I(p, o, s) BOOST_PP_IF(p(588, s), BOOST_PP_WHILE_588, s BOOST_PP_TUPLE_EAT_3)(p, o, o(588, s))
+# define BOOST_PP_WHILE_588_I(p, o, s) BOOST_PP_IF(p(589, s), BOOST_PP_WHILE_589, s BOOST_PP_TUPLE_EAT_3)(p, o, o(589, s))
+# define BOOST_PP_WHILE_589_I(p, o, s) BOOST_PP_IF(p(590, s), BOOST_PP_WHILE_590, s BOOST_PP_TUPLE_EAT_3)(p, o, o(590, s))
+# define BOOST_PP_WHILE_590_I(p, o, s) BOOST_PP_IF(p(591, s), BOOST_PP_WHILE_591, s BOOST_PP_TUPLE_EAT_3)(p, o, o(591, s))
+# define BOOST_PP_WHILE_591_I(p, o, s) BOOST_PP_IF(p(592, s), BOOST_PP_WHILE_592, s BOOST_PP_TUPLE_EAT_3)(p, o, o(592, s))
+# define BOOST_PP_WHILE_592_I(p, o, s) BOOST_PP_IF(p(593, s), BOOST_PP_WHILE_593, s BOOST_PP_TUPLE_EAT_3)(p, o, o(593, s))
+# define BOOST_PP_WHILE_593_I(p, o, s) BOOST_PP_IF(p(594, s), BOOST_PP_WHILE_594, s BOOST_PP_TUPLE_EAT_3)(p, o, o(594, s))
+# define BOOST_PP_WHILE_594_I(p, o, s) BOOST_PP_IF(p(595, s), BOOST_PP_WHILE_595, s BOOST_PP_TUPLE_EAT_3)(p, o, o(595, s))
+# define BOOST_PP_WHILE_595_I(p, o, s) BOOST_PP_IF(p(596, s), BOOST_PP_WHILE_596, s BOOST_PP_TUPLE_EAT_3)(p, o, o(596, s))
+# define BOOST_PP_WHILE_596_I(p, o, s) BOOST_PP_IF(p(597, s), BOOST_PP_WHILE_597, s BOOST_PP_TUPLE_EAT_3)(p, o, o(597, s))
+# define BOOST_PP_WHILE_597_I(p, o, s) BOOST_PP_IF(p(598, s), BOOST_PP_WHILE_598, s BOOST_PP_TUPLE_EAT_3)(p, o, o(598, s))
+# define BOOST_PP_WHILE_598_I(p, o, s) BOOST_PP_IF(p(599, s), BOOST_PP_WHILE_599, s BOOST_PP_TUPLE_EAT_3)(p, o, o(599, s))
+# define BOOST_PP_WHILE_599_I(p, o, s) BOOST_PP_IF(p(600, s), BOOST_PP_WHILE_600, s BOOST_PP_TUPLE_EAT_3)(p, o, o(600, s))
+# define BOOST_PP_WHILE_600_I(p, o, s) BOOST_PP_IF(p(601, s), BOOST_PP_WHILE_601, s BOOST_PP_TUPLE_EAT_3)(p, o, o(601, s))
+# define BOOST_PP_WHILE_601_I(p, o, s) BOOST_PP_IF(p(602, s), BOOST_PP_WHILE_602, s BOOST_PP_TUPLE_EAT_3)(p, o, o(602, s))
+# define BOOST_PP_WHILE_602_I(p, o, s) BOOST_PP_IF(p(603, s), BOOST_PP_WHILE_603, s BOOST_PP_TUPLE_EAT_3)(p, o, o(603, s))
+# define BOOST_PP_WHILE_603_I(p, o, s) BOOST_PP_IF(p(604, s), BOOST_PP_WHILE_604, s BOOST_PP_TUPLE_EAT_3)(p, o, o(604, s))
+# define BOOST_PP_WHILE_604_I(p, o, s) BOOST_PP_IF(p(605, s), BOOST_PP_WHILE_605, s BOOST_PP_TUPLE_EAT_3)(p, o, o(605, s))
+# define BOOST_PP_WHILE_605_I(p, o, s) BOOST_PP_IF(p(606, s), BOOST_PP_WHILE_606, s BOOST_PP_TUPLE_EAT_3)(p, o, o(606, s))
+# define BOOST_PP_WHILE_606_I(p, o, s) BOOST_PP_IF(p(607, s), BOOST_PP_WHILE_607, s BOOST_PP_TUPLE_EAT_3)(p, o, o(607, s))
+# define BOOST_PP_WHILE_607_I(p, o, s) BOOST_PP_IF(p(608, s), BOOST_PP_WHILE_608, s BOOST_PP_TUPLE_EAT_3)(p, o, o(608, s))
+# define BOOST_PP_WHILE_608_I(p, o, s) BOOST_PP_IF(p(609, s), BOOST_PP_WHILE_609, s BOOST_PP_TUPLE_EAT_3)(p, o, o(609, s))
+# define BOOST_PP_WHILE_609_I(p, o, s) BOOST_PP_IF(p(610, s), BOOST_PP_WHILE_610, s BOOST_PP_TUPLE_EAT_3)(p, o, o(610, s))
+# define BOOST_PP_WHILE_610_I(p, o, s) BOOST_PP_IF(p(611, s), BOOST_PP_WHILE_611, s BOOST_PP_TUPLE_EAT_3)(p, o, o(611, s))
+# define BOOST_PP_WHILE_611_I(p, o, s) BOOST_PP_IF(p(612, s), BOOST_PP_WHILE_612, s BOOST_PP_TUPLE_EAT_3)(p, o, o(612, s))
+# define BOOST_PP_WHILE_612_I(p, o, s) BOOST_PP_IF(p(613, s), BOOST_PP_WHILE_613, s BOOST_PP_TUPLE_EAT_3)(p, o, o(613, s))
+# define BOOST_PP_WHILE_613_I(p, o, s) BOOST_PP_IF(p(614, s), BOOST_PP_WHILE_614, s BOOST_PP_TUPLE_EAT_3)(p, o, o(614, s))
+# define BOOST_PP_WHILE_614_I(p, o, s) BOOST_PP_IF(p(615, s), BOOST_PP_WHILE_615, s BOOST_PP_TUPLE_EAT_3)(p, o, o(615, s))
+# define BOOST_PP_WHILE_615_I(p, o, s) BOOST_PP_IF(p(616, s), BOOST_PP_WHILE_616, s BOOST_PP_TUPLE_EAT_3)(p, o, o(616, s))
+# define BOOST_PP_WHILE_616_I(p, o, s) BOOST_PP_IF(p(617, s), BOOST_PP_WHILE_617, s BOOST_PP_TUPLE_EAT_3)(p, o, o(617, s))
+# define BOOST_PP_WHILE_617_I(p, o, s) BOOST_PP_IF(p(618, s), BOOST_PP_WHILE_618, s BOOST_PP_TUPLE_EAT_3)(p, o, o(618, s))
+# define BOOST_PP_WHILE_618_I(p, o, s) BOOST_PP_IF(p(619, s), BOOST_PP_WHILE_619, s BOOST_PP_TUPLE_EAT_3)(p, o, o(619, s))
+# define BOOST_PP_WHILE_619_I(p, o, s) BOOST_PP_IF(p(620, s), BOOST_PP_WHILE_620, s BOOST_PP_TUPLE_EAT_3)(p, o, o(620, s))
+# define BOOST_PP_WHILE_620_I(p, o, s) BOOST_PP_IF(p(621, s), BOOST_PP_WHILE_621, s BOOST_PP_TUPLE_EAT_3)(p, o, o(621, s))
+# define BOOST_PP_WHILE_621_I(p, o, s) BOOST_PP_IF(p(622, s), BOOST_PP_WHILE_622, s BOOST_PP_TUPLE_EAT_3)(p, o, o(622, s))
+# define BOOST_PP_WHILE_622_I(p, o, s) BOOST_PP_IF(p(623, s), BOOST_PP_WHILE_623, s BOOST_PP_TUPLE_EAT_3)(p, o, o(623, s))
+# define BOOST_PP_WHILE_623_I(p, o, s) BOOST_PP_IF(p(624, s), BOOST_PP_WHILE_624, s BOOST_PP_TUPLE_EAT_3)(p, o, o(624, s))
+# define BOOST_PP_WHILE_624_I(p, o, s) BOOST_PP_IF(p(625, s), BOOST_PP_WHILE_625, s BOOST_PP_TUPLE_EAT_3)(p, o, o(625, s))
+# define BOOST_PP_WHILE_625_I(p, o, s) BOOST_PP_IF(p(626, s), BOOST_PP_WHILE_626, s BOOST_PP_TUPLE_EAT_3)(p, o, o(626, s))
+# define BOOST_PP_WHILE_626_I(p, o, s) BOOST_PP_IF(p(627, s), BOOST_PP_WHILE_627, s BOOST_PP_TUPLE_EAT_3)(p, o, o(627, s))
+# define BOOST_PP_WHILE_627_I(p, o, s) BOOST_PP_IF(p(628, s), BOOST_PP_WHILE_628, s BOOST_PP_TUPLE_EAT_3)(p, o, o(628, s))
+# define BOOST_PP_WHILE_628_I(p, o, s) BOOST_PP_IF(p(629, s), BOOST_PP_WHILE_629, s BOOST_PP_TUPLE_EAT_3)(p, o, o(629, s))
+# define BOOST_PP_WHILE_629_I(p, o, s) BOOST_PP_IF(p(630, s), BOOST_PP_WHILE_630, s BOOST_PP_TUPLE_EAT_3)(p, o, o(630, s))
+# define BOOST_PP_WHILE_630_I(p, o, s) BOOST_PP_IF(p(631, s), BOOST_PP_WHILE_631, s BOOST_PP_TUPLE_EAT_3)(p, o, o(631, s))
+# define BOOST_PP_WHILE_631_I(p, o, s) BOOST_PP_IF(p(632, s), BOOST_PP_WHILE_632, s BOOST_PP_TUPLE_EAT_3)(p, o, o(632, s))
+# define BOOST_PP_WHILE_632_I(p, o, s) BOOST_PP_IF(p(633, s), BOOST_PP_WHILE_633, s BOOST_PP_TUPLE_EAT_3)(p, o, o(633, s))
+# define BOOST_PP_WHILE_633_I(p, o, s) BOOST_PP_IF(p(634, s), BOOST_PP_WHILE_634, s BOOST_PP_TUPLE_EAT_3)(p, o, o(634, s))
+# define BOOST_PP_WHILE_634_I(p, o, s) BOOST_PP_IF(p(635, s), BOOST_PP_WHILE_635, s BOOST_PP_TUPLE_EAT_3)(p, o, o(635, s))
+# define BOOST_PP_WHILE_635_I(p, o, s) BOOST_PP_IF(p(636, s), BOOST_PP_WHILE_636, s BOOST_PP_TUPLE_EAT_3)(p, o, o(636, s))
+# define BOOST_PP_WHILE_636_I(p, o, s) BOOST_PP_IF(p(637, s), BOOST_PP_WHILE_637, s BOOST_PP_TUPLE_EAT_3)(p, o, o(637, s))
+# define BOOST_PP_WHILE_637_I(p, o, s) BOOST_PP_IF(p(638, s), BOOST_PP_WHILE_638, s BOOST_PP_TUPLE_EAT_3)(p, o, o(638, s))
+# define BOOST_PP_WHILE_638_I(p, o, s) BOOST_PP_IF(p(639, s), BOOST_PP_WHILE_639, s BOOST_PP_TUPLE_EAT_3)(p, o, o(639, s))
+# define BOOST_PP_WHILE_639_I(p, o, s) BOOST_PP_IF(p(640, s), BOOST_PP_WHILE_640, s BOOST_PP_TUPLE_EAT_3)(p, o, o(640, s))
+# define BOOST_PP_WHILE_640_I(p, o, s) BOOST_PP_IF(p(641, s), BOOST_PP_WHILE_641, s BOOST_PP_TUPLE_EAT_3)(p, o, o(641, s))
+# define BOOST_PP_WHILE_641_I(p, o, s) BOOST_PP_IF(p(642, s), BOOST_PP_WHILE_642, s BOOST_PP_TUPLE_EAT_3)(p, o, o(642, s))
+# define BOOST_PP_WHILE_642_I(p, o, s) BOOST_PP_IF(p(643, s), BOOST_PP_WHILE_643, s BOOST_PP_TUPLE_EAT_3)(p, o, o(643, s))
+# define BOOST_PP_WHILE_643_I(p, o, s) BOOST_PP_IF(p(644, s), BOOST_PP_WHILE_644, s BOOST_PP_TUPLE_EAT_3)(p, o, o(644, s))
+# define BOOST_PP_WHILE_644_I(p, o, s) BOOST_PP_IF(p(645, s), BOOST_PP_WHILE_645, s BOOST_PP_TUPLE_EAT_3)(p, o, o(645, s))
+# define BOOST_PP_WHILE_645_I(p, o, s) BOOST_PP_IF(p(646, s), BOOST_PP_WHILE_646, s BOOST_PP_TUPLE_EAT_3)(p, o, o(646, s))
+# define BOOST_PP_WHILE_646_I(p, o, s) BOOST_PP_IF(p(647, s), BOOST_PP_WHILE_647, s BOOST_PP_TUPLE_EAT_3)(p, o, o(647, s))
+# define BOOST_PP_WHILE_647_I(p, o, s) BOOST_PP_IF(p(648, s), BOOST_PP_WHILE_648, s BOOST_PP_TUPLE_EAT_3)(p, o, o(648, s))
+# define BOOST_PP_WHILE_648_I(p, o, s) BOOST_PP_IF(p(649, s), BOOST_PP_WHILE_649, s BOOST_PP_TUPLE_EAT_3)(p, o, o(649, s))
+# define BOOST_PP_WHILE_649_I(p, o, s) BOOST_PP_IF(p(650, s), BOOST_PP_WHILE_650, s BOOST_PP_TUPLE_EAT_3)(p, o, o(650, s))
+# define BOOST_PP_WHILE_650_I(p, o, s) BOOST_PP_IF(p(651, s), BOOST_PP_WHILE_651, s BOOST_PP_TUPLE_EAT_3)(p, o, o(651, s))
+# define BOOST_PP_WHILE_651_I(p, o, s) BOOST_PP_IF(p(652, s), BOOST_PP_WHILE_652, s BOOST_PP_TUPLE_EAT_3)(p, o, o(652, s))
+# define BOOST_PP_WHILE_652_I(p, o, s) BOOST_PP_IF(p(653, s), BOOST_PP_WHILE_653, s BOOST_PP_TUPLE_EAT_3)(p, o, o(653, s))
+# define BOOST_PP_WHILE_653_I(p, o, s) BOOST_PP_IF(p(654, s), BOOST_PP_WHILE_654, s BOOST_PP_TUPLE_EAT_3)(p, o, o(654, s))
+# define BOOST_PP_WHILE_654_I(p, o, s) BOOST_PP_IF(p(655, s), BOOST_PP_WHILE_655, s BOOST_PP_TUPLE_EAT_3)(p, o, o(655, s))
+# define BOOST_PP_WHILE_655_I(p, o, s) BOOST_PP_IF(p(656, s), BOOST_PP_WHILE_656, s BOOST_PP_TUPLE_EAT_3)(p, o, o(656, s))
+# define BOOST_PP_WHILE_656_I(p, o, s) BOOST_PP_IF(p(657, s), BOOST_PP_WHILE_657, s BOOST_PP_TUPLE_EAT_3)(p, o, o(657, s))
+# define BOOST_PP_WHILE_657_I(p, o, s) BOOST_PP_IF(p(658, s), BOOST_PP_WHILE_658, s BOOST_PP_TUPLE_EAT_3)(p, o, o(658, s))
+# define BOOST_PP_WHILE_658_I(p, o, s) BOOST_PP_IF(p(659, s), BOOST_PP_WHILE_659, s BOOST_PP_TUPLE_EAT_3)(p, o, o(659, s))
+# define BOOST_PP_WHILE_659_I(p, o, s) BOOST_PP_IF(p(660, s), BOOST_PP_WHILE_660, s BOOST_PP_TUPLE_EAT_3)(p, o, o(660, s))
+# define BOOST_PP_WHILE_660_I(p, o, s) BOOST_PP_IF(p(661, s), BOOST_PP_WHILE_661, s BOOST_PP_TUPLE_EAT_3)(p, o, o(661, s))
+# define BOOST_PP_WHILE_661_I(p, o, s) BOOST_PP_IF(p(662, s), BOOST_PP_WHILE_662, s BOOST_PP_TUPLE_EAT_3)(p, o, o(662, s))
+# define BOOST_PP_WHILE_662_I(p, o, s) BOOST_PP_IF(p(663, s), BOOST_PP_WHILE_663, s BOOST_PP_TUPLE_EAT_3)(p, o, o(663, s))
+# define BOOST_PP_WHILE_663_I(p, o, s) BOOST_PP_IF(p(664, s), BOOST_PP_WHILE_664, s BOOST_PP_TUPLE_EAT_3)(p, o, o(664, s))
+# define BOOST_PP_WHILE_664_I(p, o, s) BOOST_PP_IF(p(665, s), BOOST_PP_WHILE_665, s BOOST_PP_TUPLE_EAT_3)(p, o, o(665, s))
+# define BOOST_PP_WHILE_665_I(p, o, s) BOOST_PP_IF(p(666, s), BOOST_PP_WHILE_666, s BOOST_PP_TUPLE_EAT_3)(p, o, o(666, s))
+# define BOOST_PP_WHILE_666_I(p, o, s) BOOST_PP_IF(p(667, s), BOOST_PP_WHILE_667, s BOOST_PP_TUPLE_EAT_3)(p, o, o(667, s))
+# define BOOST_PP_WHILE_667_I(p, o, s) BOOST_PP_IF(p(668, s), BOOST_PP_WHILE_668, s BOOST_PP_TUPLE_EAT_3)(p, o, o(668, s))
+# define BOOST_PP_WHILE_668_I(p, o, s) BOOST_PP_IF(p(669, s), BOOST_PP_WHILE_669, s BOOST_PP_TUPLE_EAT_3)(p, o, o(669, s))
+# define BOOST_PP_WHILE_669_I(p, o, s) BOOST_PP_IF(p(670, s), BOOST_PP_WHILE_670, s BOOST_PP_TUPLE_EAT_3)(p, o, o(670, s))
+# define BOOST_PP_WHILE_670_I(p, o, s) BOOST_PP_IF(p(671, s), BOOST_PP_WHILE_671, s BOOST_PP_TUPLE_EAT_3)(p, o, o(671, s))
+# define BOOST_PP_WHILE_671_I(p, o, s) BOOST_PP_IF(p(672, s), BOOST_PP_WHILE_672, s BOOST_PP_TUPLE_EAT_3)(p, o, o(672, s))
+# define BOOST_PP_WHILE_672_I(p, o, s) BOOST_PP_IF(p(673, s), BOOST_PP_WHILE_673, s BOOST_PP_TUPLE_EAT_3)(p, o, o(673, s))
+# define BOOST_PP_WHILE_673_I(p, o, s) BOOST_PP_IF(p(674, s), BOOST_PP_WHILE_674, s BOOST_PP_TUPLE_EAT_3)(p, o, o(674, s))
+# define BOOST_PP_WHILE_674_I(p, o, s) BOOST_PP_IF(p(675, s), BOOST_PP_WHILE_675, s BOOST_PP_TUPLE_EAT_3)(p, o, o(675, s))
+# define BOOST_PP_WHILE_675_I(p, o, s) BOOST_PP_IF(p(676, s), BOOST_PP_WHILE_676, s BOOST_PP_TUPLE_EAT_3)(p, o, o(676, s))
+# define BOOST_PP_WHILE_676_I(p, o, s) BOOST_PP_IF(p(677, s), BOOST_PP_WHILE_677, s BOOST_PP_TUPLE_EAT_3)(p, o, o(677, s))
+# define BOOST_PP_WHILE_677_I(p, o, s) BOOST_PP_IF(p(678, s), BOOST_PP_WHILE_678, s BOOST_PP_TUPLE_EAT_3)(p, o, o(678, s))
+# define BOOST_PP_WHILE_678_I(p, o, s) BOOST_PP_IF(p(679, s), BOOST_PP_WHILE_679, s BOOST_PP_TUPLE_EAT_3)(p, o, o(679, s))
+# define BOOST_PP_WHILE_679_I(p, o, s) BOOST_PP_IF(p(680, s), BOOST_PP_WHILE_680, s BOOST_PP_TUPLE_EAT_3)(p, o, o(680, s))
+# define BOOST_PP_WHILE_680_I(p, o, s) BOOST_PP_IF(p(681, s), BOOST_PP_WHILE_681, s BOOST_PP_TUPLE_EAT_3)(p, o, o(681, s))
+# define BOOST_PP_WHILE_681_I(p, o, s) BOOST_PP_IF(p(682, s), BOOST_PP_WHILE_682, s BOOST_PP_TUPLE_EAT_3)(p, o, o(682, s))
+# define BOOST_PP_WHILE_682_I(p, o, s) BOOST_PP_IF(p(683, s), BOOST_PP_WHILE_683, s BOOST_PP_TUPLE_EAT_3)(p, o, o(683, s))
+# define BOOST_PP_WHILE_683_I(p, o, s) BOOST_PP_IF(p(684, s), BOOST_PP_WHILE_684, s BOOST_PP_TUPLE_EAT_3)(p, o, o(684, s))
+# define BOOST_PP_WHILE_684_I(p, o, s) BOOST_PP_IF(p(685, s), BOOST_PP_WHILE_685, s BOOST_PP_TUPLE_EAT_3)(p, o, o(685, s))
+# define BOOST_PP_WHILE_685_I(p, o, s) BOOST_PP_IF(p(686, s), BOOST_PP_WHILE_686, s BOOST_PP_TUPLE_EAT_3)(p, o, o(686, s))
+# define BOOST_PP_WHILE_686_I(p, o, s) BOOST_PP_IF(p(687, s), BOOST_PP_WHILE_687, s BOOST_PP_TUPLE_EAT_3)(p, o, o(687, s))
+# define BOOST_PP_WHILE_687_I(p, o, s) BOOST_PP_IF(p(688, s), BOOST_PP_WHILE_688, s BOOST_PP_TUPLE_EAT_3)(p, o, o(688, s))
+# define BOOST_PP_WHILE_688_I(p, o, s) BOOST_PP_IF(p(689, s), BOOST_PP_WHILE_689, s BOOST_PP_TUPLE_EAT_3)(p, o, o(689, s))
+# define BOOST_PP_WHILE_689_I(p, o, s) BOOST_PP_IF(p(690, s), BOOST_PP_WHILE_690, s BOOST_PP_TUPLE_EAT_3)(p, o, o(690, s))
+# define BOOST_PP_WHILE_690_I(p, o, s) BOOST_PP_IF(p(691, s), BOOST_PP_WHILE_691, s BOOST_PP_TUPLE_EAT_3)(p, o, o(691, s))
+# define BOOST_PP_WHILE_691_I(p, o, s) BOOST_PP_IF(p(692, s), BOOST_PP_WHILE_692, s BOOST_PP_TUPLE_EAT_3)(p, o, o(692, s))
+# define BOOST_PP_WHILE_692_I(p, o, s) BOOST_PP_IF(p(693, s), BOOST_PP_WHILE_693, s BOOST_PP_TUPLE_EAT_3)(p, o, o(693, s))
+# define BOOST_PP_WHILE_693_I(p, o, s) BOOST_PP_IF(p(694, s), BOOST_PP_WHILE_694, s BOOST_PP_TUPLE_EAT_3)(p, o, o(694, s))
+# define BOOST_PP_WHILE_694_I(p, o, s) BOOST_PP_IF(p(695, s), BOOST_PP_WHILE_695, s BOOST_PP_TUPLE_EAT_3)(p, o, o(695, s))
+# define BOOST_PP_WHILE_695_I(p, o, s) BOOST_PP_IF(p(696, s), BOOST_PP_WHILE_696, s BOOST_PP_TUPLE_EAT_3)(p, o, o(696, s))
+# define BOOST_PP_WHILE_696_I(p, o, s) BOOST_PP_IF(p(697, s), BOOST_PP_WHILE_697, s BOOST_PP_TUPLE_EAT_3)(p, o, o(697, s))
+# define BOOST_PP_WHILE_697_I(p, o, s) BOOST_PP_IF(p(698, s), BOOST_PP_WHILE_698, s BOOST_PP_TUPLE_EAT_3)(p, o, o(698, s))
+# define BOOST_PP_WHILE_698_I(p, o, s) BOOST_PP_IF(p(699, s), BOOST_PP_WHILE_699, s BOOST_PP_TUPLE_EAT_3)(p, o, o(699, s))
+# define BOOST_PP_WHILE_699_I(p, o, s) BOOST_PP_IF(p(700, s), BOOST_PP_WHILE_700, s BOOST_PP_TUPLE_EAT_3)(p, o, o(700, s))
+# define BOOST_PP_WHILE_700_I(p, o, s) BOOST_PP_IF(p(701, s), BOOST_PP_WHILE_701, s BOOST_PP_TUPLE_EAT_3)(p, o, o(701, s))
+# define BOOST_PP_WHILE_701_I(p, o, s) BOOST_PP_IF(p(702, s), BOOST_PP_WHILE_702, s BOOST_PP_TUPLE_EAT_3)(p, o, o(702, s))
+# define BOOST_PP_WHILE_702_I(p, o, s) BOOST_PP_IF(p(703, s), BOOST_PP_WHILE_703, s BOOST_PP_TUPLE_EAT_3)(p, o, o(703, s))
+# define BOOST_PP_WHILE_703_I(p, o, s) BOOST_PP_IF(p(704, s), BOOST_PP_WHILE_704, s BOOST_PP_TUPLE_EAT_3)(p, o, o(704, s))
+# define BOOST_PP_WHILE_704_I(p, o, s) BOOST_PP_IF(p(705, s), BOOST_PP_WHILE_705, s BOOST_PP_TUPLE_EAT_3)(p, o, o(705, s))
+# define BOOST_PP_WHILE_705_I(p, o, s) BOOST_PP_IF(p(706, s), BOOST_PP_WHILE_706, s BOOST_PP_TUPLE_EAT_3)(p, o, o(706, s))
+# define BOOST_PP_WHILE_706_I(p, o, s) BOOST_PP_IF(p(707, s), BOOST_PP_WHILE_707, s BOOST_PP_TUPLE_EAT_3)(p, o, o(707, s))
+# define BOOST_PP_WHILE_707_I(p, o, s) BOOST_PP_IF(p(708, s), BOOST_PP_WHILE_708, s BOOST_PP_TUPLE_EAT_3)(p, o, o(708, s))
+# define BOOST_PP_WHILE_708_I(p, o, s) BOOST_PP_IF(p(709, s), BOOST_PP_WHILE_709, s BOOST_PP_TUPLE_EAT_3)(p, o, o(709, s))
+# define BOOST_PP_WHILE_709_I(p, o, s) BOOST_PP_IF(p(710, s), BOOST_PP_WHILE_710, s BOOST_PP_TUPLE_EAT_3)(p, o, o(710, s))
+# define BOOST_PP_WHILE_710_I(p, o, s) BOOST_PP_IF(p(711, s), BOOST_PP_WHILE_711, s BOOST_PP_TUPLE_EAT_3)(p, o, o(711, s))
+# define BOOST_PP_WHILE_711_I(p, o, s) BOOST_PP_IF(p(712, s), BOOST_PP_WHILE_712, s BOOST_PP_TUPLE_EAT_3)(p, o, o(712, s))
+# define BOOST_PP_WHILE_712_I(p, o, s) BOOST_PP_IF(p(713, s), BOOST_PP_WHILE_713, s BOOST_PP_TUPLE_EAT_3)(p, o, o(713, s))
+# define BOOST_PP_WHILE_713_I(p, o, s) BOOST_PP_IF(p(714, s), BOOST_PP_WHILE_714, s BOOST_PP_TUPLE_EAT_3)(p, o, o(714, s))
+# define BOOST_PP_WHILE_714_I(p, o, s) BOOST_PP_IF(p(715, s), BOOST_PP_WHILE_715, s BOOST_PP_TUPLE_EAT_3)(p, o, o(715, s))
+# define BOOST_PP_WHILE_715_I(p, o, s) BOOST_PP_IF(p(716, s), BOOST_PP_WHILE_716, s BOOST_PP_TUPLE_EAT_3)(p, o, o(716, s))
+# define BOOST_PP_WHILE_716_I(p, o, s) BOOST_PP_IF(p(717, s), BOOST_PP_WHILE_717, s BOOST_PP_TUPLE_EAT_3)(p, o, o(717, s))
+# define BOOST_PP_WHILE_717_I(p, o, s) BOOST_PP_IF(p(718, s), BOOST_PP_WHILE_718, s BOOST_PP_TUPLE_EAT_3)(p, o, o(718, s))
+# define BOOST_PP_WHILE_718_I(p, o, s) BOOST_PP_IF(p(719, s), BOOST_PP_WHILE_719, s BOOST_PP_TUPLE_EAT_3)(p, o, o(719, s))
+# define BOOST_PP_WHILE_719_I(p, o, s) BOOST_PP_IF(p(720, s), BOOST_PP_WHILE_720, s BOOST_PP_TUPLE_EAT_3)(p, o, o(720, s))
+# define BOOST_PP_WHILE_720_I(p, o, s) BOOST_PP_IF(p(721, s), BOOST_PP_WHILE_721, s BOOST_PP_TUPLE_EAT_3)(p, o, o(721, s))
+# define BOOST_PP_WHILE_721_I(p, o, s) BOOST_PP_IF(p(722, s), BOOST_PP_WHILE_722, s BOOST_PP_TUPLE_EAT_3)(p, o, o(722, s))
+# define BOOST_PP_WHILE_722_I(p, o, s) BOOST_PP_IF(p(723, s), BOOST_PP_WHILE_723, s BOOST_PP_TUPLE_EAT_3)(p, o, o(723, s))
+# define BOOST_PP_WHILE_723_I(p, o, s) BOOST_PP_IF(p(724, s), BOOST_PP_WHILE_724, s BOOST_PP_TUPLE_EAT_3)(p, o, o(724, s))
+# define BOOST_PP_WHILE_724_I(p, o, s) BOOST_PP_IF(p(725, s), BOOST_PP_WHILE_725, s BOOST_PP_TUPLE_EAT_3)(p, o, o(725, s))
+# define BOOST_PP_WHILE_725_I(p, o, s) BOOST_PP_IF(p(726, s), BOOST_PP_WHILE_726, s BOOST_PP_TUPLE_EAT_3)(p, o, o(726, s))
+# define BOOST_PP_WHILE_726_I(p, o, s) BOOST_PP_IF(p(727, s), BOOST_PP_WHILE_727, s BOOST_PP_TUPLE_EAT_3)(p, o, o(727, s))
+# define BOOST_PP_WHILE_727_I(p, o, s) BOOST_PP_IF(p(728, s), BOOST_PP_WHILE_728, s BOOST_PP_TUPLE_EAT_3)(p, o, o(728, s))
+# define BOOST_PP_WHILE_728_I(p, o, s) BOOST_PP_IF(p(729, s), BOOST_PP_WHILE_729, s BOOST_PP_TUPLE_EAT_3)(p, o, o(729, s))
+# define BOOST_PP_WHILE_729_I(p, o, s) BOOST_PP_IF(p(730, s), BOOST_PP_WHILE_730, s BOOST_PP_TUPLE_EAT_3)(p, o, o(730, s))
+# define BOOST_PP_WHILE_730_I(p, o, s) BOOST_PP_IF(p(731, s), BOOST_PP_WHILE_731, s BOOST_PP_TUPLE_EAT_3)(p, o, o(731, s))
+# define BOOST_PP_WHILE_731_I(p, o, s) BOOST_PP_IF(p(732, s), BOOST_PP_WHILE_732, s BOOST_PP_TUPLE_EAT_3)(p, o, o(732, s))
+# define BOOST_PP_WHILE_732_I(p, o, s) BOOST_PP_IF(p(733, s), BOOST_PP_WHILE_733, s BOOST_PP_TUPLE_EAT_3)(p, o, o(733, s))
+# define BOOST_PP_WHILE_733_I(p, o, s) BOOST_PP_IF(p(734, s), BOOST_PP_WHILE_734, s BOOST_PP_TUPLE_EAT_3)(p, o, o(734, s))
+# define BOOST_PP_WHILE_734_I(p, o, s) BOOST_PP_IF(p(735, s), BOOST_PP_WHILE_735, s BOOST_PP_TUPLE_EAT_3)(p, o, o(735, s))
+# define BOOST_PP_WHILE_735_I(p, o, s) BOOST_PP_IF(p(736, s), BOOST_PP_WHILE_736, s BOOST_PP_TUPLE_EAT_3)(p, o, o(736, s))
+# define BOOST_PP_WHILE_736_I(p, o, s) BOOST_PP_IF(p(737, s), BOOST_PP_WHILE_737, s BOOST_PP_TUPLE_EAT_3)(p, o, o(737, s))
+# define BOOST_PP_WHILE_737_I(p, o, s) BOOST_PP_IF(p(738, s), BOOST_PP_WHILE_738, s BOOST_PP_TUPLE_EAT_3)(p, o, o(738, s))
+# define BOOST_PP_WHILE_738_I(p, o, s) BOOST_PP_IF(p(739, s), BOOST_PP_WHILE_739, s BOOST_PP_TUPLE_EAT_3)(p, o, o(739, s))
+# define BOOST_PP_WHILE_739_I(p, o, s) BOOST_PP_IF(p(740, s), BOOST_PP_WHILE_740, s BOOST_PP_TUPLE_EAT_3)(p, o, o(740, s))
+# define BOOST_PP_WHILE_740_I(p, o, s) BOOST_PP_IF(p(741, s), BOOST_PP_WHILE_741, s BOOST_PP_TUPLE_EAT_3)(p, o, o(741, s))
+# define BOOST_PP_WHILE_741_I(p, o, s) BOOST_PP_IF(p(742, s), BOOST_PP_WHILE_742, s BOOST_PP_TUPLE_EAT_3)(p, o, o(742, s))
+# define BOOST_PP_WHILE_742_I(p, o, s) BOOST_PP_IF(p(743, s), BOOST_PP_WHILE_743, s BOOST_PP_TUPLE_EAT_3)(p, o, o(743, s))
+# define BOOST_PP_WHILE_743_I(p, o, s) BOOST_PP_IF(p(744, s), BOOST_PP_WHILE_744, s BOOST_PP_TUPLE_EAT_3)(p, o, o(744, s))
+# define BOOST_PP_WHILE_744_I(p, o, s) BOOST_PP_IF(p(745, s), BOOST_PP_WHILE_745, s BOOST_PP_TUPLE_EAT_3)(p, o, o(745, s))
+# define BOOST_PP_WHILE_745_I(p, o, s) BOOST_PP_IF(p(746, s), BOOST_PP_WHILE_746, s BOOST_PP_TUPLE_EAT_3)(p, o, o(746, s))
+# define BOOST_PP_WHILE_746_I(p, o, s) BOOST_PP_IF(p(747, s), BOOST_PP_WHILE_747, s BOOST_PP_TUPLE_EAT_3)(p, o, o(747, s))
+# define BOOST_PP_WHILE_747_I(p, o, s) BOOST_PP_IF(p(748, s), BOOST_PP_WHILE_748, s BOOST_PP_TUPLE_EAT_3)(p, o, o(748, s))
+# define BOOST_PP_WHILE_748_I(p, o, s) BOOST_PP_IF(p(749, s), BOOST_PP_WHILE_749, s BOOST_PP_TUPLE_EAT_3)(p, o, o(749, s))
+# define BOOST_PP_WHILE_749_I(p, o, s) BOOST_PP_IF(p(750, s), BOOST_PP_WHILE_750, s BOOST_PP_TUPLE_EAT_3)(p, o, o(750, s))
+# define BOOST_PP_WHILE_750_I(p, o, s) BOOST_PP_IF(p(751, s), BOOST_PP_WHILE_751, s BOOST_PP_TUPLE_EAT_3)(p, o, o(751, s))
+# define BOOST_PP_WHILE_751_I(p, o, s) BOOST_PP_IF(p(752, s), BOOST_PP_WHILE_752, s BOOST_PP_TUPLE_EAT_3)(p, o, o(752, s))
+# define BOOST_PP_WHILE_752_I(p, o, s) BOOST_PP_IF(p(753, s), BOOST_PP_WHILE_753, s BOOST_PP_TUPLE_EAT_3)(p, o, o(753, s))
+# define BOOST_PP_WHILE_753_I(p, o, s) BOOST_PP_IF(p(754, s), BOOST_PP_WHILE_754, s BOOST_PP_TUPLE_EAT_3)(p, o, o(754, s))
+# define BOOST_PP_WHILE_754_I(p, o, s) BOOST_PP_IF(p(755, s), BOOST_PP_WHILE_755, s BOOST_PP_TUPLE_EAT_3)(p, o, o(755, s))
+# define BOOST_PP_WHILE_755_I(p, o, s) BOOST_PP_IF(p(756, s), BOOST_PP_WHILE_756, s BOOST_PP_TUPLE_EAT_3)(p, o, o(756, s))
+# define BOOST_PP_WHILE_756_I(p, o, s) BOOST_PP_IF(p(757, s), BOOST_PP_WHILE_757, s BOOST_PP_TUPLE_EAT_3)(p, o, o(757, s))
+# define BOOST_PP_WHILE_757_I(p, o, s) BOOST_PP_IF(p(758, s), BOOST_PP_WHILE_758, s BOOST_PP_TUPLE_EAT_3)(p, o, o(758, s))
+# define BOOST_PP_WHILE_758_I(p, o, s) BOOST_PP_IF(p(759, s), BOOST_PP_WHILE_759, s BOOST_PP_TUPLE_EAT_3)(p, o, o(759, s))
+# define BOOST_PP_WHILE_759_I(p, o, s) BOOST_PP_IF(p(760, s), BOOST_PP_WHILE_760, s BOOST_PP_TUPLE_EAT_3)(p, o, o(760, s))
+# define BOOST_PP_WHILE_760_I(p, o, s) BOOST_PP_IF(p(761, s), BOOST_PP_WHILE_761, s BOOST_PP_TUPLE_EAT_3)(p, o, o(761, s))
+# define BOOST_PP_WHILE_761_I(p, o, s) BOOST_PP_IF(p(762, s), BOOST_PP_WHILE_762, s BOOST_PP_TUPLE_EAT_3)(p, o, o(762, s))
+# define BOOST_PP_WHILE_762_I(p, o, s) BOOST_PP_IF(p(763, s), BOOST_PP_WHILE_763, s BOOST_PP_TUPLE_EAT_3)(p, o, o(763, s))
+# define BOOST_PP_WHILE_763_I(p, o, s) BOOST_PP_IF(p(764, s), BOOST_PP_WHILE_764, s BOOST_PP_TUPLE_EAT_3)(p, o, o(764, s))
+# define BOOST_PP_WHILE_764_I(p, o, s) BOOST_PP_IF(p(765, s), BOOST_PP_WHILE_765, s BOOST_PP_TUPLE_EAT_3)(p, o, o(765, s))
+# define BOOST_PP_WHILE_765_I(p, o, s) BOOST_PP_IF(p(766, s), BOOST_PP_WHILE_766, s BOOST_PP_TUPLE_EAT_3)(p, o, o(766, s))
+# define BOOST_PP_WHILE_766_I(p, o, s) BOOST_PP_IF(p(767, s), BOOST_PP_WHILE_767, s BOOST_PP_TUPLE_EAT_3)(p, o, o(767, s))
+# define BOOST_PP_WHILE_767_I(p, o, s) BOOST_PP_IF(p(768, s), BOOST_PP_WHILE_768, s BOOST_PP_TUPLE_EAT_3)(p, o, o(768, s))
+# define BOOST_PP_WHILE_768_I(p, o, s) BOOST_PP_IF(p(769, s), BOOST_PP_WHILE_769, s BOOST_PP_TUPLE_EAT_3)(p, o, o(769, s))
+# define BOOST_PP_WHILE_769_I(p, o, s) BOOST_PP_IF(p(770, s), BOOST_PP_WHILE_770, s BOOST_PP_TUPLE_EAT_3)(p, o, o(770, s))
+# define BOOST_PP_WHILE_770_I(p, o, s) BOOST_PP_IF(p(771, s), BOOST_PP_WHILE_771, s BOOST_PP_TUPLE_EAT_3)(p, o, o(771, s))
+# define BOOST_PP_WHILE_771_I(p, o, s) BOOST_PP_IF(p(772, s), BOOST_PP_WHILE_772, s BOOST_PP_TUPLE_EAT_3)(p, o, o(772, s))
+# define BOOST_PP_WHILE_772_I(p, o, s) BOOST_PP_IF(p(773, s), BOOST_PP_WHILE_773, s BOOST_PP_TUPLE_EAT_3)(p, o, o(773, s))
+# define BOOST_PP_WHILE_773_I(p, o, s) BOOST_PP_IF(p(774, s), BOOST_PP_WHILE_774, s BOOST_PP_TUPLE_EAT_3)(p, o, o(774, s))
+# define BOOST_PP_WHILE_774_I(p, o, s) BOOST_PP_IF(p(775, s), BOOST_PP_WHILE_775, s BOOST_PP_TUPLE_EAT_3)(p, o, o(775, s))
+# define BOOST_PP_WHILE_775_I(p, o, s) BOOST_PP_IF(p(776, s), BOOST_PP_WHILE_776, s BOOST_PP_TUPLE_EAT_3)(p, o, o(776, s))
+# define BOOST_PP_WHILE_776_I(p, o, s) BOOST_PP_IF(p(777, s), BOOST_PP_WHILE_777, s BOOST_PP_TUPLE_EAT_3)(p, o, o(777, s))
+# define BOOST_PP_WHILE_777_I(p, o, s) BOOST_PP_IF(p(778, s), BOOST_PP_WHILE_778, s BOOST_PP_TUPLE_EAT_3)(p, o, o(778, s))
+# define BOOST_PP_WHILE_778_I(p, o, s) BOOST_PP_IF(p(779, s), BOOST_PP_WHILE_779, s BOOST_PP_TUPLE_EAT_3)(p, o, o(779, s))
+# define BOOST_PP_WHILE_779_I(p, o, s) BOOST_PP_IF(p(780, s), BOOST_PP_WHILE_780, s BOOST_PP_TUPLE_EAT_3)(p, o, o(780, s))
+# define BOOST_PP_WHILE_780_I(p, o, s) BOOST_PP_IF(p(781, s), BOOST_PP_WHILE_781, s BOOST_PP_TUPLE_EAT_3)(p, o, o(781, s))
+# define BOOST_PP_WHILE_781_I(p, o, s) BOOST_PP_IF(p(782, s), BOOST_PP_WHILE_782, s BOOST_PP_TUPLE_EAT_3)(p, o, o(782, s))
+# define BOOST_PP_WHILE_782_I(p, o, s) BOOST_PP_IF(p(783, s), BOOST_PP_WHILE_783, s BOOST_PP_TUPLE_EAT_3)(p, o, o(783, s))
+# define BOOST_PP_WHILE_783_I(p, o, s) BOOST_PP_IF(p(784, s), BOOST_PP_WHILE_784, s BOOST_PP_TUPLE_EAT_3)(p, o, o(784, s))
+# define BOOST_PP_WHILE_784_I(p, o, s) BOOST_PP_IF(p(785, s), BOOST_PP_WHILE_785, s BOOST_PP_TUPLE_EAT_3)(p, o, o(785, s))
+# define BOOST_PP_WHILE_785_I(p, o, s) BOOST_PP_IF(p(786, s), BOOST_PP_WHILE_786, s BOOST_PP_TUPLE_EAT_3)(p, o, o(786, s))
+# define BOOST_PP_WHILE_786_I(p, o, s) BOOST_PP_IF(p(787, s), BOOST_PP_WHILE_787, s BOOST_PP_TUPLE_EAT_3)(p, o, o(787, s))
+# define BOOST_PP_WHILE_787_I(p, o, s) BOOST_PP_IF(p(788, s), BOOST_PP_WHILE_788, s BOOST_PP_TUPLE_EAT_3)(p, o, o(788, s))
+# define BOOST_PP_WHILE_788_I(p, o, s) BOOST_PP_IF(p(789, s), BOOST_PP_WHILE_789, s BOOST_PP_TUPLE_EAT_3)(p, o, o(789, s))
+# define BOOST_PP_WHILE_789_I(p, o, s) BOOST_PP_IF(p(790, s), BOOST_PP_WHILE_790, s BOOST_PP_TUPLE_EAT_3)(p, o, o(790, s))
+# define BOOST_PP_WHILE_790_I(p, o, s) BOOST_PP_IF(p(791, s), BOOST_PP_WHILE_791, s BOOST_PP_TUPLE_EAT_3)(p, o, o(791, s))
+# define BOOST_PP_WHILE_791_I(p, o, s) BOOST_PP_IF(p(792, s), BOOST_PP_WHILE_792, s BOOST_PP_TUPLE_EAT_3)(p, o, o(792, s))
+# define BOOST_PP_WHILE_792_I(p, o, s) BOOST_PP_IF(p(793, s), BOOST_PP_WHILE_793, s BOOST_PP_TUPLE_EAT_3)(p, o, o(793, s))
+# define BOOST_PP_WHILE_793_I(p, o, s) BOOST_PP_IF(p(794, s), BOOST_PP_WHILE_794, s BOOST_PP_TUPLE_EAT_3)(p, o, o(794, s))
+# define BOOST_PP_WHILE_794_I(p, o, s) BOOST_PP_IF(p(795, s), BOOST_PP_WHILE_795, s BOOST_PP_TUPLE_EAT_3)(p, o, o(795, s))
+# define BOOST_PP_WHILE_795_I(p, o, s) BOOST_PP_IF(p(796, s), BOOST_PP_WHILE_796, s BOOST_PP_TUPLE_EAT_3)(p, o, o(796, s))
+# define BOOST_PP_WHILE_796_I(p, o, s) BOOST_PP_IF(p(797, s), BOOST_PP_WHILE_797, s BOOST_PP_TUPLE_EAT_3)(p, o, o(797, s))
+# define BOOST_PP_WHILE_797_I(p, o, s) BOOST_PP_IF(p(798, s), BOOST_PP_WHILE_798, s BOOST_PP_TUPLE_EAT_3)(p, o, o(798, s))
+# define BOOST_PP_WHILE_798_I(p, o, s) BOOST_PP_IF(p(799, s), BOOST_PP_WHILE_799, s BOOST_PP_TUPLE_EAT_3)(p, o, o(799, s))
+# define BOOST_PP_WHILE_799_I(p, o, s) BOOST_PP_IF(p(800, s), BOOST_PP_WHILE_800, s BOOST_PP_TUPLE_EAT_3)(p, o, o(800, s))
+# define BOOST_PP_WHILE_800_I(p, o, s) BOOST_PP_IF(p(801, s), BOOST_PP_WHILE_801, s BOOST_PP_TUPLE_EAT_3)(p, o, o(801, s))
+# define BOOST_PP_WHILE_801_I(p, o, s) BOOST_PP_IF(p(802, s), BOOST_PP_WHILE_802, s BOOST_PP_TUPLE_EAT_3)(p, o, o(802, s))
+# define BOOST_PP_WHILE_802_I(p, o, s) BOOST_PP_IF(p(803, s), BOOST_PP_WHILE_803, s BOOST_PP_TUPLE_EAT_3)(p, o, o(803, s))
+# define BOOST_PP_WHILE_803_I(p, o, s) BOOST_PP_IF(p(804, s), BOOST_PP_WHILE_804, s BOOST_PP_TUPLE_EAT_3)(p, o, o(804, s))
+# define BOOST_PP_WHILE_804_I(p, o, s) BOOST_PP_IF(p(805, s), BOOST_PP_WHILE_805, s BOOST_PP_TUPLE_EAT_3)(p, o, o(805, s))
+# define BOOST_PP_WHILE_805_I(p, o, s) BOOST_PP_IF(p(806, s), BOOST_PP_WHILE_806, s BOOST_PP_TUPLE_EAT_3)(p, o, o(806, s))
+# define BOOST_PP_WHILE_806_I(p, o, s) BOOST_PP_IF(p(807, s), BOOST_PP_WHILE_807, s BOOST_PP_TUPLE_EAT_3)(p, o, o(807, s))
+# define BOOST_PP_WHILE_807_I(p, o, s) BOOST_PP_IF(p(808, s), BOOST_PP_WHILE_808, s BOOST_PP_TUPLE_EAT_3)(p, o, o(808, s))
+# define BOOST_PP_WHILE_808_I(p, o, s) BOOST_PP_IF(p(809, s), BOOST_PP_WHILE_809, s BOOST_PP_TUPLE_EAT_3)(p, o, o(809, s))
+# define BOOST_PP_WHILE_809_I(p, o, s) BOOST_PP_IF(p(810, s), BOOST_PP_WHILE_810, s BOOST_PP_TUPLE_EAT_3)(p, o, o(810, s))
+# define BOOST_PP_WHILE_810_I(p, o, s) BOOST_PP_IF(p(811, s), BOOST_PP_WHILE_811, s BOOST_PP_TUPLE_EAT_3)(p, o, o(811, s))
+# define BOOST_PP_WHILE_811_I(p, o, s) BOOST_PP_IF(p(812, s), BOOST_PP_WHILE_812, s BOOST_PP_TUPLE_EAT_3)(p, o, o(812, s))
+# define BOOST_PP_WHILE_812_I(p, o, s) BOOST_PP_IF(p(813, s), BOOST_PP_WHILE_813, s BOOST_PP_TUPLE_EAT_3)(p, o, o(813, s))
+# define BOOST_PP_WHILE_813_I(p, o, s) BOOST_PP_IF(p(814, s), BOOST_PP_WHILE_814, s BOOST_PP_TUPLE_EAT_3)(p, o, o(814, s))
+# define BOOST_PP_WHILE_814_I(p, o, s) BOOST_PP_IF(p(815, s), BOOST_PP_WHILE_815, s BOOST_PP_TUPLE_EAT_3)(p, o, o(815, s))
+# define BOOST_PP_WHILE_815_I(p, o, s) BOOST_PP_IF(p(816, s), BOOST_PP_WHILE_816, s BOOST_PP_TUPLE_EAT_3)(p, o, o(816, s))
+# define BOOST_PP_WHILE_816_I(p, o, s) BOOST_PP_IF(p(817, s), BOOST_PP_WHILE_817, s BOOST_PP_TUPLE_EAT_3)(p, o, o(817, s))
+# define BOOST_PP_WHILE_817_I(p, o, s) BOOST_PP_IF(p(818, s), BOOST_PP_WHILE_818, s BOOST_PP_TUPLE_EAT_3)(p, o, o(818, s))
+# define BOOST_PP_WHILE_818_I(p, o, s) BOOST_PP_IF(p(819, s), BOOST_PP_WHILE_819, s BOOST_PP_TUPLE_EAT_3)(p, o, o(819, s))
+# define BOOST_PP_WHILE_819_I(p, o, s) BOOST_PP_IF(p(820, s), BOOST_PP_WHILE_820, s BOOST_PP_TUPLE_EAT_3)(p, o, o(820, s))
+# define BOOST_PP_WHILE_820_I(p, o, s) BOOST_PP_IF(p(821, s), BOOST_PP_WHILE_821, s BOOST_PP_TUPLE_EAT_3)(p, o, o(821, s))
+# define BOOST_PP_WHILE_821_I(p, o, s) BOOST_PP_IF(p(822, s), BOOST_PP_WHILE_822, s BOOST_PP_TUPLE_EAT_3)(p, o, o(822, s))
+# define BOOST_PP_WHILE_822_I(p, o, s) BOOST_PP_IF(p(823, s), BOOST_PP_WHILE_823, s BOOST_PP_TUPLE_EAT_3)(p, o, o(823, s))
+# define BOOST_PP_WHILE_823_I(p, o, s) BOOST_PP_IF(p(824, s), BOOST_PP_WHILE_824, s BOOST_PP_TUPLE_EAT_3)(p, o, o(824, s))
+# define BOOST_PP_WHILE_824_I(p, o, s) BOOST_PP_IF(p(825, s), BOOST_PP_WHILE_825, s BOOST_PP_TUPLE_EAT_3)(p, o, o(825, s))
+# define BOOST_PP_WHILE_825_I(p, o, s) BOOST_PP_IF(p(826, s), BOOST_PP_WHILE_826, s BOOST_PP_TUPLE_EAT_3)(p, o, o(826, s))
+# define BOOST_PP_WHILE_826_I(p, o, s) BOOST_PP_IF(p(827, s), BOOST_PP_WHILE_827, s BOOST_PP_TUPLE_EAT_3)(p, o, o(827, s))
+# define BOOST_PP_WHILE_827_I(p, o, s) BOOST_PP_IF(p(828, s), BOOST_PP_WHILE_828, s BOOST_PP_TUPLE_EAT_3)(p, o, o(828, s))
+# define BOOST_PP_WHILE_828_I(p, o, s) BOOST_PP_IF(p(829, s), BOOST_PP_WHILE_829, s BOOST_PP_TUPLE_EAT_3)(p, o, o(829, s))
+# define BOOST_PP_WHILE_829_I(p, o, s) BOOST_PP_IF(p(830, s), BOOST_PP_WHILE_830, s BOOST_PP_TUPLE_EAT_3)(p, o, o(830, s))
+# define BOOST_PP_WHILE_830_I(p, o, s) BOOST_PP_IF(p(831, s), BOOST_PP_WHILE_831, s BOOST_PP_TUPLE_EAT_3)(p, o, o(831, s))
+# define BOOST_PP_WHILE_831_I(p, o, s) BOOST_PP_IF(p(832, s), BOOST_PP_WHILE_832, s BOOST_PP_TUPLE_EAT_3)(p, o, o(832, s))
+# define BOOST_PP_WHILE_832_I(p, o, s) BOOST_PP_IF(p(833, s), BOOST_PP_WHILE_833, s BOOST_PP_TUPLE_EAT_3)(p, o, o(833, s))
+# define BOOST_PP_WHILE_833_I(p, o, s) BOOST_PP_IF(p(834, s), BOOST_PP_WHILE_834, s BOOST_PP_TUPLE_EAT_3)(p, o, o(834, s))
+# define BOOST_PP_WHILE_834_I(p, o, s) BOOST_PP_IF(p(835, s), BOOST_PP_WHILE_835, s BOOST_PP_TUPLE_EAT_3)(p, o, o(835, s))
+# define BOOST_PP_WHILE_835_I(p, o, s) BOOST_PP_IF(p(836, s), BOOST_PP_WHILE_836, s BOOST_PP_TUPLE_EAT_3)(p, o, o(836, s))
+# define BOOST_PP_WHILE_836_I(p, o, s) BOOST_PP_IF(p(837, s), BOOST_PP_WHILE_837, s BOOST_PP_TUPLE_EAT_3)(p, o, o(837, s))
+# define BOOST_PP_WHILE_837_I(p, o, s) BOOST_PP_IF(p(838, s), BOOST_PP_WHILE_838, s BOOST_PP_TUPLE_EAT_3)(p, o, o(838, s))
+# define BOOST_PP_WHILE_838_I(p, o, s) BOOST_PP_IF(p(839, s), BOOST_PP_WHILE_839, s BOOST_PP_TUPLE_EAT_3)(p, o, o(839, s))
+# define BOOST_PP_WHILE_839_I(p, o, s) BOOST_PP_IF(p(840, s), BOOST_PP_WHILE_840, s BOOST_PP_TUPLE_EAT_3)(p, o, o(840, s))
+# define BOOST_PP_WHILE_840_I(p, o, s) BOOST_PP_IF(p(841, s), BOOST_PP_WHILE_841, s BOOST_PP_TUPLE_EAT_3)(p, o, o(841, s))
+# define BOOST_PP_WHILE_841_I(p, o, s) BOOST_PP_IF(p(842, s), BOOST_PP_WHILE_842, s BOOST_PP_TUPLE_EAT_3)(p, o, o(842, s))
+# define BOOST_PP_WHILE_842_I(p, o, s) BOOST_PP_IF(p(843, s), BOOST_PP_WHILE_843, s BOOST_PP_TUPLE_EAT_3)(p, o, o(843, s))
+# define BOOST_PP_WHILE_843_I(p, o, s) BOOST_PP_IF(p(844, s), BOOST_PP_WHILE_844, s BOOST_PP_TUPLE_EAT_3)(p, o, o(844, s))
+# define BOOST_PP_WHILE_844_I(p, o, s) BOOST_PP_IF(p(845, s), BOOST_PP_WHILE_845, s BOOST_PP_TUPLE_EAT_3)(p, o, o(845, s))
+# define BOOST_PP_WHILE_845_I(p, o, s) BOOST_PP_IF(p(846, s), BOOST_PP_WHILE_846, s BOOST_PP_TUPLE_EAT_3)(p, o, o(846, s))
+# define BOOST_PP_WHILE_846_I(p, o, s) BOOST_PP_IF(p(847, s), BOOST_PP_WHILE_847, s BOOST_PP_TUPLE_EAT_3)(p, o, o(847, s))
+# define BOOST_PP_WHILE_847_I(p, o, s) BOOST_PP_IF(p(848, s), BOOST_PP_WHILE_848, s BOOST_PP_TUPLE_EAT_3)(p, o, o(848, s))
+# define BOOST_PP_WHILE_848_I(p, o, s) BOOST_PP_IF(p(849, s), BOOST_PP_WHILE_849, s BOOST_PP_TUPLE_EAT_3)(p, o, o(849, s))
+# define BOOST_PP_WHILE_849_I(p, o, s) BOOST_PP_IF(p(850, s), BOOST_PP_WHILE_850, s BOOST_PP_TUPLE_EAT_3)(p, o, o(850, s))
+# define BOOST_PP_WHILE_850_I(p, o, s) BOOST_PP_IF(p(851, s), BOOST_PP_WHILE_851, s BOOST_PP_TUPLE_EAT_3)(p, o, o(851, s))
+# define BOOST_PP_WHILE_851_I(p, o, s) BOOST_PP_IF(p(852, s), BOOST_PP_WHILE_852, s BOOST_PP_TUPLE_EAT_3)(p, o, o(852, s))
+# define BOOST_PP_WHILE_852_I(p, o, s) BOOST_PP_IF(p(853, s), BOOST_PP_WHILE_853, s BOOST_PP_TUPLE_EAT_3)(p, o, o(853, s))
+# define BOOST_PP_WHILE_853_I(p, o, s) BOOST_PP_IF(p(854, s), BOOST_PP_WHILE_854, s BOOST_PP_TUPLE_EAT_3)(p, o, o(854, s))
+# define BOOST_PP_WHILE_854_I(p, o, s) BOOST_PP_IF(p(855, s), BOOST_PP_WHILE_855, s BOOST_PP_TUPLE_EAT_3)(p, o, o(855, s))
+# define BOOST_PP_WHILE_855_I(p, o, s) BOOST_PP_IF(p(856, s), BOOST_PP_WHILE_856, s BOOST_PP_TUPLE_EAT_3)(p, o, o(856, s))
+# define BOOST_PP_WHILE_856_I(p, o, s) BOOST_PP_IF(p(857, s), BOOST_PP_WHILE_857, s BOOST_PP_TUPLE_EAT_3)(p, o, o(857, s))
+# define BOOST_PP_WHILE_857_I(p, o, s) BOOST_PP_IF(p(858, s), BOOST_PP_WHILE_858, s BOOST_PP_TUPLE_EAT_3)(p, o, o(858, s))
+# define BOOST_PP_WHILE_858_I(p, o, s) BOOST_PP_IF(p(859, s), BOOST_PP_WHILE_859, s BOOST_PP_TUPLE_EAT_3)(p, o, o(859, s))
+# define BOOST_PP_WHILE_859_I(p, o, s) BOOST_PP_IF(p(860, s), BOOST_PP_WHILE_860, s BOOST_PP_TUPLE_EAT_3)(p, o, o(860, s))
+# define BOOST_PP_WHILE_860_I(p, o, s) BOOST_PP_IF(p(861, s), BOOST_PP_WHILE_861, s BOOST_PP_TUPLE_EAT_3)(p, o, o(861, s))
+# define BOOST_PP_WHILE_861_I(p, o, s) BOOST_PP_IF(p(862, s), BOOST_PP_WHILE_862, s BOOST_PP_TUPLE_EAT_3)(p, o, o(862, s))
+# define BOOST_PP_WHILE_862_I(p, o, s) BOOST_PP_IF(p(863, s), BOOST_PP_WHILE_863, s BOOST_PP_TUPLE_EAT_3)(p, o, o(863, s))
+# define BOOST_PP_WHILE_863_I(p, o, s) BOOST_PP_IF(p(864, s), BOOST_PP_WHILE_864, s BOOST_PP_TUPLE_EAT_3)(p, o, o(864, s))
+# define BOOST_PP_WHILE_864_I(p, o, s) BOOST_PP_IF(p(865, s), BOOST_PP_WHILE_865, s BOOST_PP_TUPLE_EAT_3)(p, o, o(865, s))
+# define BOOST_PP_WHILE_865_I(p, o, s) BOOST_PP_IF(p(866, s), BOOST_PP_WHILE_866, s BOOST_PP_TUPLE_EAT_3)(p, o, o(866, s))
+# define BOOST_PP_WHILE_866_I(p, o, s) BOOST_PP_IF(p(867, s), BOOST_PP_WHILE_867, s BOOST_PP_TUPLE_EAT_3)(p, o, o(867, s))
+# define BOOST_PP_WHILE_867_I(p, o, s) BOOST_PP_IF(p(868, s), BOOST_PP_WHILE_868, s BOOST_PP_TUPLE_EAT_3)(p, o, o(868, s))
+# define BOOST_PP_WHILE_868_I(p, o, s) BOOST_PP_IF(p(869, s), BOOST_PP_WHILE_869, s BOOST_PP_TUPLE_EAT_3)(p, o, o(869, s))
+# define BOOST_PP_WHILE_869_I(p, o, s) BOOST_PP_IF(p(870, s), BOOST_PP_WHILE_870, s BOOST_PP_TUPLE_EAT_3)(p, o, o(870, s))
+# define BOOST_PP_WHILE_870_I(p, o, s) BOOST_PP_IF(p(871, s), BOOST_PP_WHILE_871, s BOOST_PP_TUPLE_EAT_3)(p, o, o(871, s))
+# define BOOST_PP_WHILE_871_I(p, o, s) BOOST_PP_IF(p(872, s), BOOST_PP_WHILE_872, s BOOST_PP_TUPLE_EAT_3)(p, o, o(872, s))
+# define BOOST_PP_WHILE_872_I(p, o, s) BOOST_PP_IF(p(873, s), BOOST_PP_WHILE_873, s BOOST_PP_TUPLE_EAT_3)(p, o, o(873, s))
+# define BOOST_PP_WHILE_873_I(p, o, s) BOOST_PP_IF(p(874, s), BOOST_PP_WHILE_874, s BOOST_PP_TUPLE_EAT_3)(p, o, o(874, s))
+# define BOOST_PP_WHILE_874_I(p, o, s) BOOST_PP_IF(p(875, s), BOOST_PP_WHILE_875, s BOOST_PP_TUPLE_EAT_3)(p, o, o(875, s))
+# define BOOST_PP_WHILE_875_I(p, o, s) BOOST_PP_IF(p(876, s), BOOST_PP_WHILE_876, s BOOST_PP_TUPLE_EAT_3)(p, o, o(876, s))
+# define BOOST_PP_WHILE_876_I(p, o, s) BOOST_PP_IF(p(877, s), BOOST_PP_WHILE_877, s BOOST_PP_TUPLE_EAT_3)(p, o, o(877, s))
+# define BOOST_PP_WHILE_877_I(p, o, s) BOOST_PP_IF(p(878, s), BOOST_PP_WHILE_878, s BOOST_PP_TUPLE_EAT_3)(p, o, o(878, s))
+# define BOOST_PP_WHILE_878_I(p, o, s) BOOST_PP_IF(p(879, s), BOOST_PP_WHILE_879, s BOOST_PP_TUPLE_EAT_3)(p, o, o(879, s))
+# define BOOST_PP_WHILE_879_I(p, o, s) BOOST_PP_IF(p(880, s), BOOST_PP_WHILE_880, s BOOST_PP_TUPLE_EAT_3)(p, o, o(880, s))
+# define BOOST_PP_WHILE_880_I(p, o, s) BOOST_PP_IF(p(881, s), BOOST_PP_WHILE_881, s BOOST_PP_TUPLE_EAT_3)(p, o, o(881, s))
+# define BOOST_PP_WHILE_881_I(p, o, s) BOOST_PP_IF(p(882, s), BOOST_PP_WHILE_882, s BOOST_PP_TUPLE_EAT_3)(p, o, o(882, s))
+# define BOOST_PP_WHILE_882_I(p, o, s) BOOST_PP_IF(p(883, s), BOOST_PP_WHILE_883, s BOOST_PP_TUPLE_EAT_3)(p, o, o(883, s))
+# define BOOST_PP_WHILE_883_I(p, o, s) BOOST_PP_IF(p(884, s), BOOST_PP_WHILE_884, s BOOST_PP_TUPLE_EAT_3)(p, o, o(884, s))
+# define BOOST_PP_WHILE_884_I(p, o, s) BOOST_PP_IF(p(885, s), BOOST_PP_WHILE_885, s BOOST_PP_TUPLE_EAT_3)(p, o, o(885, s))
+# define BOOST_PP_WHILE_885_I(p, o, s) BOOST_PP_IF(p(886, s), BOOST_PP_WHILE_886, s BOOST_PP_TUPLE_EAT_3)(p, o, o(886, s))
+# define BOOST_PP_WHILE_886_I(p, o, s) BOOST_PP_IF(p(887, s), BOOST_PP_WHILE_887, s BOOST_PP_TUPLE_EAT_3)(p, o, o(887, s))
+# define BOOST_PP_WHILE_887_I(p, o, s) BOOST_PP_IF(p(888, s), BOOST_PP_WHILE_888, s BOOST_PP_TUPLE_EAT_3)(p, o, o(888, s))
+# define BOOST_PP_WHILE_888_I(p, o, s) BOOST_PP_IF(p(889, s), BOOST_PP_WHILE_889, s BOOST_PP_TUPLE_EAT_3)(p, o, o(889, s))
+# define BOOST_PP_WHILE_889_I(p, o, s) BOOST_PP_IF(p(890, s), BOOST_PP_WHILE_890, s BOOST_PP_TUPLE_EAT_3)(p, o, o(890, s))
+# define BOOST_PP_WHILE_890_I(p, o, s) BOOST_PP_IF(p(891, s), BOOST_PP_WHILE_891, s BOOST_PP_TUPLE_EAT_3)(p, o, o(891, s))
+# define BOOST_PP_WHILE_891_I(p, o, s) BOOST_PP_IF(p(892, s), BOOST_PP_WHILE_892, s BOOST_PP_TUPLE_EAT_3)(p, o, o(892, s))
+# define BOOST_PP_WHILE_892_I(p, o, s) BOOST_PP_IF(p(893, s), BOOST_PP_WHILE_893, s BOOST_PP_TUPLE_EAT_3)(p, o, o(893, s))
+# define BOOST_PP_WHILE_893_I(p, o, s) BOOST_PP_IF(p(894, s), BOOST_PP_WHILE_894, s BOOST_PP_TUPLE_EAT_3)(p, o, o(894, s))
+# define BOOST_PP_WHILE_894_I(p, o, s) BOOST_PP_IF(p(895, s), BOOST_PP_WHILE_895, s BOOST_PP_TUPLE_EAT_3)(p, o, o(895, s))
+# define BOOST_PP_WHILE_895_I(p, o, s) BOOST_PP_IF(p(896, s), BOOST_PP_WHILE_896, s BOOST_PP_TUPLE_EAT_3)(p, o, o(896, s))
+# define BOOST_PP_WHILE_896_I(p, o, s) BOOST_PP_IF(p(897, s), BOOST_PP_WHILE_897, s BOOST_PP_TUPLE_EAT_3)(p, o, o(897, s))
+# define BOOST_PP_WHILE_897_I(p, o, s) BOOST_PP_IF(p(898, s), BOOST_PP_WHILE_898, s BOOST_PP_TUPLE_EAT_3)(p, o, o(898, s))
+# define BOOST_PP_WHILE_898_I(p, o, s) BOOST_PP_IF(p(899, s), BOOST_PP_WHILE_899, s BOOST_PP_TUPLE_EAT_3)(p, o, o(899, s))
+# define BOOST_PP_WHILE_899_I(p, o, s) BOOST_PP_IF(p(900, s), BOOST_PP_WHILE_900, s BOOST_PP_TUPLE_EAT_3)(p, o, o(900, s))
+# define BOOST_PP_WHILE_900_I(p, o, s) BOOST_PP_IF(p(901, s), BOOST_PP_WHILE_901, s BOOST_PP_TUPLE_EAT_3)(p, o, o(901, s))
+# define BOOST_PP_WHILE_901_I(p, o, s) BOOST_PP_IF(p(902, s), BOOST_PP_WHILE_902, s BOOST_PP_TUPLE_EAT_3)(p, o, o(902, s))
+# define BOOST_PP_WHILE_902_I(p, o, s) BOOST_PP_IF(p(903, s), BOOST_PP_WHILE_903, s BOOST_PP_TUPLE_EAT_3)(p, o, o(903, s))
+# define BOOST_PP_WHILE_903_I(p, o, s) BOOST_PP_IF(p(904, s), BOOST_PP_WHILE_904, s BOOST_PP_TUPLE_EAT_3)(p, o, o(904, s))
+# define BOOST_PP_WHILE_904_I(p, o, s) BOOST_PP_IF(p(905, s), BOOST_PP_WHILE_905, s BOOST_PP_TUPLE_EAT_3)(p, o, o(905, s))
+# define BOOST_PP_WHILE_905_I(p, o, s) BOOST_PP_IF(p(906, s), BOOST_PP_WHILE_906, s BOOST_PP_TUPLE_EAT_3)(p, o, o(906, s))
+# define BOOST_PP_WHILE_906_I(p, o, s) BOOST_PP_IF(p(907, s), BOOST_PP_WHILE_907, s BOOST_PP_TUPLE_EAT_3)(p, o, o(907, s))
+# define BOOST_PP_WHILE_907_I(p, o, s) BOOST_PP_IF(p(908, s), BOOST_PP_WHILE_908, s BOOST_PP_TUPLE_EAT_3)(p, o, o(908, s))
+# define BOOST_PP_WHILE_908_I(p, o, s) BOOST_PP_IF(p(909, s), BOOST_PP_WHILE_909, s BOOST_PP_TUPLE_EAT_3)(p, o, o(909, s))
+# define BOOST_PP_WHILE_909_I(p, o, s) BOOST_PP_IF(p(910, s), BOOST_PP_WHILE_910, s BOOST_PP_TUPLE_EAT_3)(p, o, o(910, s))
+# define BOOST_PP_WHILE_910_I(p, o, s) BOOST_PP_IF(p(911, s), BOOST_PP_WHILE_911, s BOOST_PP_TUPLE_EAT_3)(p, o, o(911, s))
+# define BOOST_PP_WHILE_911_I(p, o, s) BOOST_PP_IF(p(912, s), BOOST_PP_WHILE_912, s BOOST_PP_TUPLE_EAT_3)(p, o, o(912, s))
+# define BOOST_PP_WHILE_912_I(p, o, s) BOOST_PP_IF(p(913, s), BOOST_PP_WHILE_913, s BOOST_PP_TUPLE_EAT_3)(p, o, o(913, s))
+# define BOOST_PP_WHILE_913_I(p, o, s) BOOST_PP_IF(p(914, s), BOOST_PP_WHILE_914, s BOOST_PP_TUPLE_EAT_3)(p, o, o(914, s))
+# define BOOST_PP_WHILE_914_I(p, o, s) BOOST_PP_IF(p(915, s), BOOST_PP_WHILE_915, s BOOST_PP_TUPLE_EAT_3)(p, o, o(915, s))
+# define BOOST_PP_WHILE_915_I(p, o, s) BOOST_PP_IF(p(916, s), BOOST_PP_WHILE_916, s BOOST_PP_TUPLE_EAT_3)(p, o, o(916, s))
+# define BOOST_PP_WHILE_916_I(p, o, s) BOOST_PP_IF(p(917, s), BOOST_PP_WHILE_917, s BOOST_PP_TUPLE_EAT_3)(p, o, o(917, s))
+# define BOOST_PP_WHILE_917_I(p, o, s) BOOST_PP_IF(p(918, s), BOOST_PP_WHILE_918, s BOOST_PP_TUPLE_EAT_3)(p, o, o(918, s))
+# define BOOST_PP_WHILE_918_I(p, o, s) BOOST_PP_IF(p(919, s), BOOST_PP_WHILE_919, s BOOST_PP_TUPLE_EAT_3)(p, o, o(919, s))
+# define BOOST_PP_WHILE_919_I(p, o, s) BOOST_PP_IF(p(920, s), BOOST_PP_WHILE_920, s BOOST_PP_TUPLE_EAT_3)(p, o, o(920, s))
+# define BOOST_PP_WHILE_920_I(p, o, s) BOOST_PP_IF(p(921, s), BOOST_PP_WHILE_921, s BOOST_PP_TUPLE_EAT_3)(p, o, o(921, s))
+# define BOOST_PP_WHILE_921_I(p, o, s) BOOST_PP_IF(p(922, s), BOOST_PP_WHILE_922, s BOOST_PP_TUPLE_EAT_3)(p, o, o(922, s))
+# define BOOST_PP_WHILE_922_I(p, o, s) BOOST_PP_IF(p(923, s), BOOST_PP_WHILE_923, s BOOST_PP_TUPLE_EAT_3)(p, o, o(923, s))
+# define BOOST_PP_WHILE_923_I(p, o, s) BOOST_PP_IF(p(924, s), BOOST_PP_WHILE_924, s BOOST_PP_TUPLE_EAT_3)(p, o, o(924, s))
+# define BOOST_PP_WHILE_924_I(p, o, s) BOOST_PP_IF(p(925, s), BOOST_PP_WHILE_925, s BOOST_PP_TUPLE_EAT_3)(p, o, o(925, s))
+# define BOOST_PP_WHILE_925_I(p, o, s) BOOST_PP_IF(p(926, s), BOOST_PP_WHILE_926, s BOOST_PP_TUPLE_EAT_3)(p, o, o(926, s))
+# define BOOST_PP_WHILE_926_I(p, o, s) BOOST_PP_IF(p(927, s), BOOST_PP_WHILE_927, s BOOST_PP_TUPLE_EAT_3)(p, o, o(927, s))
+# define BOOST_PP_WHILE_927_I(p, o, s) BOOST_PP_IF(p(928, s), BOOST_PP_WHILE_928, s BOOST_PP_TUPLE_EAT_3)(p, o, o(928, s))
+# define BOOST_PP_WHILE_928_I(p, o, s) BOOST_PP_IF(p(929, s), BOOST_PP_WHILE_929, s BOOST_PP_TUPLE_EAT_3)(p, o, o(929, s))
+# define BOOST_PP_WHILE_929_I(p, o, s) BOOST_PP_IF(p(930, s), BOOST_PP_WHILE_930, s BOOST_PP_TUPLE_EAT_3)(p, o, o(930, s))
+# define BOOST_PP_WHILE_930_I(p, o, s) BOOST_PP_IF(p(931, s), BOOST_PP_WHILE_931, s BOOST_PP_TUPLE_EAT_3)(p, o, o(931, s))
+# define BOOST_PP_WHILE_931_I(p, o, s) BOOST_PP_IF(p(932, s), BOOST_PP_WHILE_932, s BOOST_PP_TUPLE_EAT_3)(p, o, o(932, s))
+# define BOOST_PP_WHILE_932_I(p, o, s) BOOST_PP_IF(p(933, s), BOOST_PP_WHILE_933, s BOOST_PP_TUPLE_EAT_3)(p, o, o(933, s))
+# define BOOST_PP_WHILE_933_I(p, o, s) BOOST_PP_IF(p(934, s), BOOST_PP_WHILE_934, s BOOST_PP_TUPLE_EAT_3)(p, o, o(934, s))
+# define BOOST_PP_WHILE_934_I(p, o, s) BOOST_PP_IF(p(935, s), BOOST_PP_WHILE_935, s BOOST_PP_TUPLE_EAT_3)(p, o, o(935, s))
+# define BOOST_PP_WHILE_935_I(p, o, s) BOOST_PP_IF(p(936, s), BOOST_PP_WHILE_936, s BOOST_PP_TUPLE_EAT_3)(p, o, o(936, s))
+# define BOOST_PP_WHILE_936_I(p, o, s) BOOST_PP_IF(p(937, s), BOOST_PP_WHILE_937, s BOOST_PP_TUPLE_EAT_3)(p, o, o(937, s))
+# define BOOST_PP_WHILE_937_I(p, o, s) BOOST_PP_IF(p(938, s), BOOST_PP_WHILE_938, s BOOST_PP_TUPLE_EAT_3)(p, o, o(938, s))
+# define BOOST_PP_WHILE_938_I(p, o, s) BOOST_PP_IF(p(939, s), BOOST_PP_WHILE_939, s BOOST_PP_TUPLE_EAT_3)(p, o, o(939, s))
+# define BOOST_PP_WHILE_939_I(p, o, s) BOOST_PP_IF(p(940, s), BOOST_PP_WHILE_940, s BOOST_PP_TUPLE_EAT_3)(p, o, o(940, s))
+# define BOOST_PP_WHILE_940_I(p, o, s) BOOST_PP_IF(p(941, s), BOOST_PP_WHILE_941, s BOOST_PP_TUPLE_EAT_3)(p, o, o(941, s))
+# define BOOST_PP_WHILE_941_I(p, o, s) BOOST_PP_IF(p(942, s), BOOST_PP_WHILE_942, s BOOST_PP_TUPLE_EAT_3)(p, o, o(942, s))
+# define BOOST_PP_WHILE_942_I(p, o, s) BOOST_PP_IF(p(943, s), BOOST_PP_WHILE_943, s BOOST_PP_TUPLE_EAT_3)(p, o, o(943, s))
+# define BOOST_PP_WHILE_943_I(p, o, s) BOOST_PP_IF(p(944, s), BOOST_PP_WHILE_944, s BOOST_PP_TUPLE_EAT_3)(p, o, o(944, s))
+# define BOOST_PP_WHILE_944_I(p, o, s) BOOST_PP_IF(p(945, s), BOOST_PP_WHILE_945, s BOOST_PP_TUPLE_EAT_3)(p, o, o(945, s))
+# define BOOST_PP_WHILE_945_I(p, o, s) BOOST_PP_IF(p(946, s), BOOST_PP_WHILE_946, s BOOST_PP_TUPLE_EAT_3)(p, o, o(946, s))
+# define BOOST_PP_WHILE_946_I(p, o, s) BOOST_PP_IF(p(947, s), BOOST_PP_WHILE_947, s BOOST_PP_TUPLE_EAT_3)(p, o, o(947, s))
+# define BOOST_PP_WHILE_947_I(p, o, s) BOOST_PP_IF(p(948, s), BOOST_PP_WHILE_948, s BOOST_PP_TUPLE_EAT_3)(p, o, o(948, s))
+# define BOOST_PP_WHILE_948_I(p, o, s) BOOST_PP_IF(p(949, s), BOOST_PP_WHILE_949, s BOOST_PP_TUPLE_EAT_3)(p, o, o(949, s))
+# define BOOST_PP_WHILE_949_I(p, o, s) BOOST_PP_IF(p(950, s), BOOST_PP_WHILE_950, s BOOST_PP_TUPLE_EAT_3)(p, o, o(950, s))
+# define BOOST_PP_WHILE_950_I(p, o, s) BOOST_PP_IF(p(951, s), BOOST_PP_WHILE_951, s BOOST_PP_TUPLE_EAT_3)(p, o, o(951, s))
+# define BOOST_PP_WHILE_951_I(p, o, s) BOOST_PP_IF(p(952, s), BOOST_PP_WHILE_952, s BOOST_PP_TUPLE_EAT_3)(p, o, o(952, s))
+# define BOOST_PP_WHILE_952_I(p, o, s) BOOST_PP_IF(p(953, s), BOOST_PP_WHILE_953, s BOOST_PP_TUPLE_EAT_3)(p, o, o(953, s))
+# define BOOST_PP_WHILE_953_I(p, o, s) BOOST_PP_IF(p(954, s), BOOST_PP_WHILE_954, s BOOST_PP_TUPLE_EAT_3)(p, o, o(954, s))
+# define BOOST_PP_WHILE_954_I(p, o, s) BOOST_PP_IF(p(955, s), BOOST_PP_WHILE_955, s BOOST_PP_TUPLE_EAT_3)(p, o, o(955, s))
+# define BOOST_PP_WHILE_955_I(p, o, s) BOOST_PP_IF(p(956, s), BOOST_PP_WHILE_956, s BOOST_PP_TUPLE_EAT_3)(p, o, o(956, s))
+# define BOOST_PP_WHILE_956_I(p, o, s) BOOST_PP_IF(p(957, s), BOOST_PP_WHILE_957, s BOOST_PP_TUPLE_EAT_3)(p, o, o(957, s))
+# define BOOST_PP_WHILE_957_I(p, o, s) BOOST_PP_IF(p(958, s), BOOST_PP_WHILE_958, s BOOST_PP_TUPLE_EAT_3)(p, o, o(958, s))
+# define BOOST_PP_WHILE_958_I(p, o, s) BOOST_PP_IF(p(959, s), BOOST_PP_WHILE_959, s BOOST_PP_TUPLE_EAT_3)(p, o, o(959, s))
+# define BOOST_PP_WHILE_959_I(p, o, s) BOOST_PP_IF(p(960, s), BOOST_PP_WHILE_960, s BOOST_PP_TUPLE_EAT_3)(p, o, o(960, s))
+# define BOOST_PP_WHILE_960_I(p, o, s) BOOST_PP_IF(p(961, s), BOOST_PP_WHILE_961, s BOOST_PP_TUPLE_EAT_3)(p, o, o(961, s))
+# define BOOST_PP_WHILE_961_I(p, o, s) BOOST_PP_IF(p(962, s), BOOST_PP_WHILE_962, s BOOST_PP_TUPLE_EAT_3)(p, o, o(962, s))
+# define BOOST_PP_WHILE_962_I(p, o, s) BOOST_PP_IF(p(963, s), BOOST_PP_WHILE_963, s BOOST_PP_TUPLE_EAT_3)(p, o, o(963, s))
+# define BOOST_PP_WHILE_963_I(p, o, s) BOOST_PP_IF(p(964, s), BOOST_PP_WHILE_964, s BOOST_PP_TUPLE_EAT_3)(p, o, o(964, s))
+# define BOOST_PP_WHILE_964_I(p, o, s) BOOST_PP_IF(p(965, s), BOOST_PP_WHILE_965, s BOOST_PP_TUPLE_EAT_3)(p, o, o(965, s))
+# define BOOST_PP_WHILE_965_I(p, o, s) BOOST_PP_IF(p(966, s), BOOST_PP_WHILE_966, s BOOST_PP_TUPLE_EAT_3)(p, o, o(966, s))
+# define BOOST_PP_WHILE_966_I(p, o, s) BOOST_PP_IF(p(967, s), BOOST_PP_WHILE_967, s BOOST_PP_TUPLE_EAT_3)(p, o, o(967, s))
+# define BOOST_PP_WHILE_967_I(p, o, s) BOOST_PP_IF(p(968, s), BOOST_PP_WHILE_968, s BOOST_PP_TUPLE_EAT_3)(p, o, o(968, s))
+# define BOOST_PP_WHILE_968_I(p, o, s) BOOST_PP_IF(p(969, s), BOOST_PP_WHILE_969, s BOOST_PP_TUPLE_EAT_3)(p, o, o(969, s))
+# define BOOST_PP_WHILE_969_I(p, o, s) BOOST_PP_IF(p(970, s), BOOST_PP_WHILE_970, s BOOST_PP_TUPLE_EAT_3)(p, o, o(970, s))
+# define BOOST_PP_WHILE_970_I(p, o, s) BOOST_PP_IF(p(971, s), BOOST_PP_WHILE_971, s BOOST_PP_TUPLE_EAT_3)(p, o, o(971, s))
+# define BOOST_PP_WHILE_971_I(p, o, s) BOOST_PP_IF(p(972, s), BOOST_PP_WHILE_972, s BOOST_PP_TUPLE_EAT_3)(p, o, o(972, s))
+# define BOOST_PP_WHILE_972_I(p, o, s) BOOST_PP_IF(p(973, s), BOOST_PP_WHILE_973, s BOOST_PP_TUPLE_EAT_3)(p, o, o(973, s))
+# define BOOST_PP_WHILE_973_I(p, o, s) BOOST_PP_IF(p(974, s), BOOST_PP_WHILE_974, s BOOST_PP_TUPLE_EAT_3)(p, o, o(974, s))
+# define BOOST_PP_WHILE_974_I(p, o, s) BOOST_PP_IF(p(975, s), BOOST_PP_WHILE_975, s BOOST_PP_TUPLE_EAT_3)(p, o, o(975, s))
+# define BOOST_PP_WHILE_975_I(p, o, s) BOOST_PP_IF(p(976, s), BOOST_PP_WHILE_976, s BOOST_PP_TUPLE_EAT_3)(p, o, o(976, s))
+# define BOOST_PP_WHILE_976_I(p, o, s) BOOST_PP_IF(p(977, s), BOOST_PP_WHILE_977, s BOOST_PP_TUPLE_EAT_3)(p, o, o(977, s))
+# define BOOST_PP_WHILE_977_I(p, o, s) BOOST_PP_IF(p(978, s), BOOST_PP_WHILE_978, s BOOST_PP_TUPLE_EAT_3)(p, o, o(978, s))
+# define BOOST_PP_WHILE_978_I(p, o, s) BOOST_PP_IF(p(979, s), BOOST_PP_WHILE_979, s BOOST_PP_TUPLE_EAT_3)(p, o, o(979, s))
+# define BOOST_PP_WHILE_979_I(p, o, s) BOOST_PP_IF(p(980, s), BOOST_PP_WHILE_980, s BOOST_PP_TUPLE_EAT_3)(p, o, o(980, s))
+# define BOOST_PP_WHILE_980_I(p, o, s) BOOST_PP_IF(p(981, s), BOOST_PP_WHILE_981, s BOOST_PP_TUPLE_EAT_3)(p, o, o(981, s))
+# define BOOST_PP_WHILE_981_I(p, o, s) BOOST_PP_IF(p(982, s), BOOST_PP_WHILE_982, s BOOST_PP_TUPLE_EAT_3)(p, o, o(982, s))
+# define BOOST_PP_WHILE_982_I(p, o, s) BOOST_PP_IF(p(983, s), BOOST_PP_WHILE_983, s BOOST_PP_TUPLE_EAT_3)(p, o, o(983, s))
+# define BOOST_PP_WHILE_983_I(p, o, s) BOOST_PP_IF(p(984, s), BOOST_PP_WHILE_984, s BOOST_PP_TUPLE_EAT_3)(p, o, o(984, s))
+# define BOOST_PP_WHILE_984_I(p, o, s) BOOST_PP_IF(p(985, s), BOOST_PP_WHILE_985, s BOOST_PP_TUPLE_EAT_3)(p, o, o(985, s))
+# define BOOST_PP_WHILE_985_I(p, o, s) BOOST_PP_IF(p(986, s), BOOST_PP_WHILE_986, s BOOST_PP_TUPLE_EAT_3)(p, o, o(986, s))
+# define BOOST_PP_WHILE_986_I(p, o, s) BOOST_PP_IF(p(987, s), BOOST_PP_WHILE_987, s BOOST_PP_TUPLE_EAT_3)(p, o, o(987, s))
+# define BOOST_PP_WHILE_987_I(p, o, s) BOOST_PP_IF(p(988, s), BOOST_PP_WHILE_988, s BOOST_PP_TUPLE_EAT_3)(p, o, o(988, s))
+# define BOOST_PP_WHILE_988_I(p, o, s) BOOST_PP_IF(p(989, s), BOOST_PP_WHILE_989, s BOOST_PP_TUPLE_EAT_3)(p, o, o(989, s))
+# define BOOST_PP_WHILE_989_I(p, o, s) BOOST_PP_IF(p(990, s), BOOST_PP_WHILE_990, s BOOST_PP_TUPLE_EAT_3)(p, o, o(990, s))
+# define BOOST_PP_WHILE_990_I(p, o, s) BOOST_PP_IF(p(991, s), BOOST_PP_WHILE_991, s BOOST_PP_TUPLE_EAT_3)(p, o, o(991, s))
+# define BOOST_PP_WHILE_991_I(p, o, s) BOOST_PP_IF(p(992, s), BOOST_PP_WHILE_992, s BOOST_PP_TUPLE_EAT_3)(p, o, o(992, s))
+# define BOOST_PP_WHILE_992_I(p, o, s) BOOST_PP_IF(p(993, s), BOOST_PP_WHILE_993, s BOOST_PP_TUPLE_EAT_3)(p, o, o(993, s))
+# define BOOST_PP_WHILE_993_I(p, o, s) BOOST_PP_IF(p(994, s), BOOST_PP_WHILE_994, s BOOST_PP_TUPLE_EAT_3)(p, o, o(994, s))
+# define BOOST_PP_WHILE_994_I(p, o, s) BOOST_PP_IF(p(995, s), BOOST_PP_WHILE_995, s BOOST_PP_TUPLE_EAT_3)(p, o, o(995, s))
+# define BOOST_PP_WHILE_995_I(p, o, s) BOOST_PP_IF(p(996, s), BOOST_PP_WHILE_996, s BOOST_PP_TUPLE_EAT_3)(p, o, o(996, s))
+# define BOOST_PP_WHILE_996_I(p, o, s) BOOST_PP_IF(p(997, s), BOOST_PP_WHILE_997, s BOOST_PP_TUPLE_EAT_3)(p, o, o(997, s))
+# define BOOST_PP_WHILE_997_I(p, o, s) BOOST_PP_IF(p(998, s), BOOST_PP_WHILE_998, s BOOST_PP_TUPLE_EAT_3)(p, o, o(998, s))
+# define BOOST_PP_WHILE_998_I(p, o, s) BOOST_PP_IF(p(999, s), BOOST_PP_WHILE_999, s BOOST_PP_TUPLE_EAT_3)(p, o, o(999, s))
+# define BOOST_PP_WHILE_999_I(p, o, s) BOOST_PP_IF(p(1000, s), BOOST_PP_WHILE_1000, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1000, s))
+# define BOOST_PP_WHILE_1000_I(p, o, s) BOOST_PP_IF(p(1001, s), BOOST_PP_WHILE_1001, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1001, s))
+# define BOOST_PP_WHILE_1001_I(p, o, s) BOOST_PP_IF(p(1002, s), BOOST_PP_WHILE_1002, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1002, s))
+# define BOOST_PP_WHILE_1002_I(p, o, s) BOOST_PP_IF(p(1003, s), BOOST_PP_WHILE_1003, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1003, s))
+# define BOOST_PP_WHILE_1003_I(p, o, s) BOOST_PP_IF(p(1004, s), BOOST_PP_WHILE_1004, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1004, s))
+# define BOOST_PP_WHILE_1004_I(p, o, s) BOOST_PP_IF(p(1005, s), BOOST_PP_WHILE_1005, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1005, s))
+# define BOOST_PP_WHILE_1005_I(p, o, s) BOOST_PP_IF(p(1006, s), BOOST_PP_WHILE_1006, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1006, s))
+# define BOOST_PP_WHILE_1006_I(p, o, s) BOOST_PP_IF(p(1007, s), BOOST_PP_WHILE_1007, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1007, s))
+# define BOOST_PP_WHILE_1007_I(p, o, s) BOOST_PP_IF(p(1008, s), BOOST_PP_WHILE_1008, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1008, s))
+# define BOOST_PP_WHILE_1008_I(p, o, s) BOOST_PP_IF(p(1009, s), BOOST_PP_WHILE_1009, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1009, s))
+# define BOOST_PP_WHILE_1009_I(p, o, s) BOOST_PP_IF(p(1010, s), BOOST_PP_WHILE_1010, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1010, s))
+# define BOOST_PP_WHILE_1010_I(p, o, s) BOOST_PP_IF(p(1011, s), BOOST_PP_WHILE_1011, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1011, s))
+# define BOOST_PP_WHILE_1011_I(p, o, s) BOOST_PP_IF(p(1012, s), BOOST_PP_WHILE_1012, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1012, s))
+# define BOOST_PP_WHILE_1012_I(p, o, s) BOOST_PP_IF(p(1013, s), BOOST_PP_WHILE_1013, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1013, s))
+# define BOOST_PP_WHILE_1013_I(p, o, s) BOOST_PP_IF(p(1014, s), BOOST_PP_WHILE_1014, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1014, s))
+# define BOOST_PP_WHILE_1014_I(p, o, s) BOOST_PP_IF(p(1015, s), BOOST_PP_WHILE_1015, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1015, s))
+# define BOOST_PP_WHILE_1015_I(p, o, s) BOOST_PP_IF(p(1016, s), BOOST_PP_WHILE_1016, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1016, s))
+# define BOOST_PP_WHILE_1016_I(p, o, s) BOOST_PP_IF(p(1017, s), BOOST_PP_WHILE_1017, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1017, s))
+# define BOOST_PP_WHILE_1017_I(p, o, s) BOOST_PP_IF(p(1018, s), BOOST_PP_WHILE_1018, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1018, s))
+# define BOOST_PP_WHILE_1018_I(p, o, s) BOOST_PP_IF(p(1019, s), BOOST_PP_WHILE_1019, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1019, s))
+# define BOOST_PP_WHILE_1019_I(p, o, s) BOOST_PP_IF(p(1020, s), BOOST_PP_WHILE_1020, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1020, s))
+# define BOOST_PP_WHILE_1020_I(p, o, s) BOOST_PP_IF(p(1021, s), BOOST_PP_WHILE_1021, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1021, s))
+# define BOOST_PP_WHILE_1021_I(p, o, s) BOOST_PP_IF(p(1022, s), BOOST_PP_WHILE_1022, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1022, s))
+# define BOOST_PP_WHILE_1022_I(p, o, s) BOOST_PP_IF(p(1023, s), BOOST_PP_WHILE_1023, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1023, s))
+# define BOOST_PP_WHILE_1023_I(p, o, s) BOOST_PP_IF(p(1024, s), BOOST_PP_WHILE_1024, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1024, s))
+# define BOOST_PP_WHILE_1024_I(p, o, s) BOOST_PP_IF(p(1025, s), BOOST_PP_WHILE_1025, s BOOST_PP_TUPLE_EAT_3)(p, o, o(1025, s))
+#
+# endif
@@ -0,0 +1,276 @@
+# /* **************************************************************************
+#  *                                                                          *
+#  *     (C) Copyright Paul Mensonides 2002.
+#  *     Distributed under the Boost Software License, Version 1.0. (See
+#  *     accompanying file LICENSE_1_0.txt or copy at
+#  *     http://www.boost.org/LICENSE_1_0.txt)
+#  *                                                                          *
+#  ************************************************************************** */
+#
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_DETAIL_AUTO_REC_512_HPP
+# define BOOST_PREPROCESSOR_DETAIL_AUTO_REC_512_HPP
+#
+# define BOOST_PP_NODE_ENTRY_512(p) BOOST_PP_NODE_256(p)(p)(p)(p)(p)(p)(p)(p)(p)
+#
+# define BOOST_PP_NODE_256(p) BOOST_PP_IIF(p(256), BOOST_PP_NODE_128, BOOST_PP_NODE_384)
+#     define BOOST_PP_NODE_384(p) BOOST_PP_IIF(p(384), BOOST_PP_NODE_320, BOOST_PP_NODE_448)
+#         define BOOST_PP_NODE_320(p) BOOST_PP_IIF(p(320), BOOST_PP_NODE_288, BOOST_PP_NODE_352)
+#             define BOOST_PP_NODE_288(p) BOOST_PP_IIF(p(288), BOOST_PP_NODE_272, BOOST_PP_NODE_304)
+#                 define BOOST_PP_NODE_272(p) BOOST_PP_IIF(p(272), BOOST_PP_NODE_264, BOOST_PP_NODE_280)
+#                     define BOOST_PP_NODE_264(p) BOOST_PP_IIF(p(264), BOOST_PP_NODE_260, BOOST_PP_NODE_268)
+#                         define BOOST_PP_NODE_260(p) BOOST_PP_IIF(p(260), BOOST_PP_NODE_258, BOOST_PP_NODE_262)
+#                             define BOOST_PP_NODE_258(p) BOOST_PP_IIF(p(258), BOOST_PP_NODE_257, BOOST_PP_NODE_259)
+#                                 define BOOST_PP_NODE_257(p) BOOST_PP_IIF(p(257), 257, 258)
+#                                 define BOOST_PP_NODE_259(p) BOOST_PP_IIF(p(259), 259, 260)
+#                             define BOOST_PP_NODE_262(p) BOOST_PP_IIF(p(262), BOOST_PP_NODE_261, BOOST_PP_NODE_263)
+#                                 define BOOST_PP_NODE_261(p) BOOST_PP_IIF(p(261), 261, 262)
+#                                 define BOOST_PP_NODE_263(p) BOOST_PP_IIF(p(263), 263, 264)
+#                         define BOOST_PP_NODE_268(p) BOOST_PP_IIF(p(268), BOOST_PP_NODE_266, BOOST_PP_NODE_270)
+#                             define BOOST_PP_NODE_266(p) BOOST_PP_IIF(p(266), BOOST_PP_NODE_265, BOOST_PP_NODE_267)
+#                                 define BOOST_PP_NODE_265(p) BOOST_PP_IIF(p(265), 265, 266)
+#                                 define BOOST_PP_NODE_267(p) BOOST_PP_IIF(p(267), 267, 268)
+#                             define BOOST_PP_NODE_270(p) BOOST_PP_IIF(p(270), BOOST_PP_NODE_269, BOOST_PP_NODE_271)
+#                                 define BOOST_PP_NODE_269(p) BOOST_PP_IIF(p(269), 269, 270)
+#                                 define BOOST_PP_NODE_271(p) BOOST_PP_IIF(p(271), 271, 272)
+#                     define BOOST_PP_NODE_280(p) BOOST_PP_IIF(p(280), BOOST_PP_NODE_276, BOOST_PP_NODE_284)
+#                         define BOOST_PP_NODE_276(p) BOOST_PP_IIF(p(276), BOOST_PP_NODE_274, BOOST_PP_NODE_278)
+#                             define BOOST_PP_NODE_274(p) BOOST_PP_IIF(p(274), BOOST_PP_NODE_273, BOOST_PP_NODE_275)
+#                                 define BOOST_PP_NODE_273(p) BOOST_PP_IIF(p(273), 273, 274)
+#                                 define BOOST_PP_NODE_275(p) BOOST_PP_IIF(p(275), 275, 276)
+#                             define BOOST_PP_NODE_278(p) BOOST_PP_IIF(p(278), BOOST_PP_NODE_277, BOOST_PP_NODE_279)
+#                                 define BOOST_PP_NODE_277(p) BOOST_PP_IIF(p(277), 277, 278)
+#                                 define BOOST_PP_NODE_279(p) BOOST_PP_IIF(p(279), 279, 280)
+#                         define BOOST_PP_NODE_284(p) BOOST_PP_IIF(p(284), BOOST_PP_NODE_282, BOOST_PP_NODE_286)
+#                             define BOOST_PP_NODE_282(p) BOOST_PP_IIF(p(282), BOOST_PP_NODE_281, BOOST_PP_NODE_283)
+#                                 define BOOST_PP_NODE_281(p) BOOST_PP_IIF(p(281), 281, 282)
+#                                 define BOOST_PP_NODE_283(p) BOOST_PP_IIF(p(283), 283, 284)
+#                             define BOOST_PP_NODE_286(p) BOOST_PP_IIF(p(286), BOOST_PP_NODE_285, BOOST_PP_NODE_287)
+#                                 define BOOST_PP_NODE_285(p) BOOST_PP_IIF(p(285), 285, 286)
+#                                 define BOOST_PP_NODE_287(p) BOOST_PP_IIF(p(287), 287, 288)
+#                 define BOOST_PP_NODE_304(p) BOOST_PP_IIF(p(304), BOOST_PP_NODE_296, BOOST_PP_NODE_312)
+#                     define BOOST_PP_NODE_296(p) BOOST_PP_IIF(p(296), BOOST_PP_NODE_292, BOOST_PP_NODE_300)
+#                         define BOOST_PP_NODE_292(p) BOOST_PP_IIF(p(292), BOOST_PP_NODE_290, BOOST_PP_NODE_294)
+#                             define BOOST_PP_NODE_290(p) BOOST_PP_IIF(p(290), BOOST_PP_NODE_289, BOOST_PP_NODE_291)
+#                                 define BOOST_PP_NODE_289(p) BOOST_PP_IIF(p(289), 289, 290)
+#                                 define BOOST_PP_NODE_291(p) BOOST_PP_IIF(p(291), 291, 292)
+#                             define BOOST_PP_NODE_294(p) BOOST_PP_IIF(p(294), BOOST_PP_NODE_293, BOOST_PP_NODE_295)
+#                                 define BOOST_PP_NODE_293(p) BOOST_PP_IIF(p(293), 293, 294)
+#                                 define BOOST_PP_NODE_295(p) BOOST_PP_IIF(p(295), 295, 296)
+#                         define BOOST_PP_NODE_300(p) BOOST_PP_IIF(p(300), BOOST_PP_NODE_298, BOOST_PP_NODE_302)
+#                             define BOOST_PP_NODE_298(p) BOOST_PP_IIF(p(298), BOOST_PP_NODE_297, BOOST_PP_NODE_299)
+#                                 define BOOST_PP_NODE_297(p) BOOST_PP_IIF(p(297), 297, 298)
+#                                 define BOOST_PP_NODE_299(p) BOOST_PP_IIF(p(299), 299, 300)
+#                             define BOOST_PP_NODE_302(p) BOOST_PP_IIF(p(302), BOOST_PP_NODE_301, BOOST_PP_NODE_303)
+#                                 define BOOST_PP_NODE_301(p) BOOST_PP_IIF(p(301), 301, 302)
+#                                 define BOOST_PP_NODE_303(p) BOOST_PP_IIF(p(303), 303, 304)
+#                     define BOOST_PP_NODE_312(p) BOOST_PP_IIF(p(312), BOOST_PP_NODE_308, BOOST_PP_NODE_316)
+#                         define BOOST_PP_NODE_308(p) BOOST_PP_IIF(p(308), BOOST_PP_NODE_306, BOOST_PP_NODE_310)
+#                             define BOOST_PP_NODE_306(p) BOOST_PP_IIF(p(306), BOOST_PP_NODE_305, BOOST_PP_NODE_307)
+#                                 define BOOST_PP_NODE_305(p) BOOST_PP_IIF(p(305), 305, 306)
+#                                 define BOOST_PP_NODE_307(p) BOOST_PP_IIF(p(307), 307, 308)
+#                             define BOOST_PP_NODE_310(p) BOOST_PP_IIF(p(310), BOOST_PP_NODE_309, BOOST_PP_NODE_311)
+#                                 define BOOST_PP_NODE_309(p) BOOST_PP_IIF(p(309), 309, 310)
+#                                 define BOOST_PP_NODE_311(p) BOOST_PP_IIF(p(311), 311, 312)
+#                         define BOOST_PP_NODE_316(p) BOOST_PP_IIF(p(316), BOOST_PP_NODE_314, BOOST_PP_NODE_318)
+#                             define BOOST_PP_NODE_314(p) BOOST_PP_IIF(p(314), BOOST_PP_NODE_313, BOOST_PP_NODE_315)
+#                                 define BOOST_PP_NODE_313(p) BOOST_PP_IIF(p(313), 313, 314)
+#                                 define BOOST_PP_NODE_315(p) BOOST_PP_IIF(p(315), 315, 316)
+#                             define BOOST_PP_NODE_318(p) BOOST_PP_IIF(p(318), BOOST_PP_NODE_317, BOOST_PP_NODE_319)
+#                                 define BOOST_PP_NODE_317(p) BOOST_PP_IIF(p(317), 317, 318)
+#                                 define BOOST_PP_NODE_319(p) BOOST_PP_IIF(p(319), 319, 320)
+#             define BOOST_PP_NODE_352(p) BOOST_PP_IIF(p(352), BOOST_PP_NODE_336, BOOST_PP_NODE_368)
+#                 define BOOST_PP_NODE_336(p) BOOST_PP_IIF(p(336), BOOST_PP_NODE_328, BOOST_PP_NODE_344)
+#                     define BOOST_PP_NODE_328(p) BOOST_PP_IIF(p(328), BOOST_PP_NODE_324, BOOST_PP_NODE_332)
+#                         define BOOST_PP_NODE_324(p) BOOST_PP_IIF(p(324), BOOST_PP_NODE_322, BOOST_PP_NODE_326)
+#                             define BOOST_PP_NODE_322(p) BOOST_PP_IIF(p(322), BOOST_PP_NODE_321, BOOST_PP_NODE_323)
+#                                 define BOOST_PP_NODE_321(p) BOOST_PP_IIF(p(321), 321, 322)
+#                                 define BOOST_PP_NODE_323(p) BOOST_PP_IIF(p(323), 323, 324)
+#                             define BOOST_PP_NODE_326(p) BOOST_PP_IIF(p(326), BOOST_PP_NODE_325, BOOST_PP_NODE_327)
+#                                 define BOOST_PP_NODE_325(p) BOOST_PP_IIF(p(325), 325, 326)
+#                                 define BOOST_PP_NODE_327(p) BOOST_PP_IIF(p(327), 327, 328)
+#                         define BOOST_PP_NODE_332(p) BOOST_PP_IIF(p(332), BOOST_PP_NODE_330, BOOST_PP_NODE_334)
+#                             define BOOST_PP_NODE_330(p) BOOST_PP_IIF(p(330), BOOST_PP_NODE_329, BOOST_PP_NODE_331)
+#                                 define BOOST_PP_NODE_329(p) BOOST_PP_IIF(p(329), 329, 330)
+#                                 define BOOST_PP_NODE_331(p) BOOST_PP_IIF(p(331), 331, 332)
+#                             define BOOST_PP_NODE_334(p) BOOST_PP_IIF(p(334), BOOST_PP_NODE_333, BOOST_PP_NODE_335)
+#                                 define BOOST_PP_NODE_333(p) BOOST_PP_IIF(p(333), 333, 334)
+#                                 define BOOST_PP_NODE_335(p) BOOST_PP_IIF(p(335), 335, 336)
+#                     define BOOST_PP_NODE_344(p) BOOST_PP_IIF(p(344), BOOST_PP_NODE_340, BOOST_PP_NODE_348)
+#                         define BOOST_PP_NODE_340(p) BOOST_PP_IIF(p(340), BOOST_PP_NODE_338, BOOST_PP_NODE_342)
+#                             define BOOST_PP_NODE_338(p) BOOST_PP_IIF(p(338), BOOST_PP_NODE_337, BOOST_PP_NODE_339)
+#                                 define BOOST_PP_NODE_337(p) BOOST_PP_IIF(p(337), 337, 338)
+#                                 define BOOST_PP_NODE_339(p) BOOST_PP_IIF(p(339), 339, 340)
+#                             define BOOST_PP_NODE_342(p) BOOST_PP_IIF(p(342), BOOST_PP_NODE_341, BOOST_PP_NODE_343)
+#                                 define BOOST_PP_NODE_341(p) BOOST_PP_IIF(p(341), 341, 342)
+#                                 define BOOST_PP_NODE_343(p) BOOST_PP_IIF(p(343), 343, 344)
+#                         define BOOST_PP_NODE_348(p) BOOST_PP_IIF(p(348), BOOST_PP_NODE_346, BOOST_PP_NODE_350)
+#                             define BOOST_PP_NODE_346(p) BOOST_PP_IIF(p(346), BOOST_PP_NODE_345, BOOST_PP_NODE_347)
+#                                 define BOOST_PP_NODE_345(p) BOOST_PP_IIF(p(345), 345, 346)
+#                                 define BOOST_PP_NODE_347(p) BOOST_PP_IIF(p(347), 347, 348)
+#                             define BOOST_PP_NODE_350(p) BOOST_PP_IIF(p(350), BOOST_PP_NODE_349, BOOST_PP_NODE_351)
+#                                 define BOOST_PP_NODE_349(p) BOOST_PP_IIF(p(349), 349, 350)
+#                                 define BOOST_PP_NODE_351(p) BOOST_PP_IIF(p(351), 351, 352)
+#                 define BOOST_PP_NODE_368(p) BOOST_PP_IIF(p(368), BOOST_PP_NODE_360, BOOST_PP_NODE_376)
+#                     define BOOST_PP_NODE_360(p) BOOST_PP_IIF(p(360), BOOST_PP_NODE_356, BOOST_PP_NODE_364)
+#                         define BOOST_PP_NODE_356(p) BOOST_PP_IIF(p(356), BOOST_PP_NODE_354, BOOST_PP_NODE_358)
+#                             define BOOST_PP_NODE_354(p) BOOST_PP_IIF(p(354), BOOST_PP_NODE_353, BOOST_PP_NODE_355)
+#                                 define BOOST_PP_NODE_353(p) BOOST_PP_IIF(p(353), 353, 354)
+#                                 define BOOST_PP_NODE_355(p) BOOST_PP_IIF(p(355), 355, 356)
+#                             define BOOST_PP_NODE_358(p) BOOST_PP_IIF(p(358), BOOST_PP_NODE_357, BOOST_PP_NODE_359)
+#                                 define BOOST_PP_NODE_357(p) BOOST_PP_IIF(p(357), 357, 358)
+#                                 define BOOST_PP_NODE_359(p) BOOST_PP_IIF(p(359), 359, 360)
+#                         define BOOST_PP_NODE_364(p) BOOST_PP_IIF(p(364), BOOST_PP_NODE_362, BOOST_PP_NODE_366)
+#                             define BOOST_PP_NODE_362(p) BOOST_PP_IIF(p(362), BOOST_PP_NODE_361, BOOST_PP_NODE_363)
+#                                 define BOOST_PP_NODE_361(p) BOOST_PP_IIF(p(361), 361, 362)
+#                                 define BOOST_PP_NODE_363(p) BOOST_PP_IIF(p(363), 363, 364)
+#                             define BOOST_PP_NODE_366(p) BOOST_PP_IIF(p(366), BOOST_PP_NODE_365, BOOST_PP_NODE_367)
+#                                 define BOOST_PP_NODE_365(p) BOOST_PP_IIF(p(365), 365, 366)
+#                                 define BOOST_PP_NODE_367(p) BOOST_PP_IIF(p(367), 367, 368)
+#                     define BOOST_PP_NODE_376(p) BOOST_PP_IIF(p(376), BOOST_PP_NODE_372, BOOST_PP_NODE_380)
+#                         define BOOST_PP_NODE_372(p) BOOST_PP_IIF(p(372), BOOST_PP_NODE_370, BOOST_PP_NODE_374)
+#                             define BOOST_PP_NODE_370(p) BOOST_PP_IIF(p(370), BOOST_PP_NODE_369, BOOST_PP_NODE_371)
+#                                 define BOOST_PP_NODE_369(p) BOOST_PP_IIF(p(369), 369, 370)
+#                                 define BOOST_PP_NODE_371(p) BOOST_PP_IIF(p(371), 371, 372)
+#                             define BOOST_PP_NODE_374(p) BOOST_PP_IIF(p(374), BOOST_PP_NODE_373, BOOST_PP_NODE_375)
+#                                 define BOOST_PP_NODE_373(p) BOOST_PP_IIF(p(373), 373, 374)
+#                                 define BOOST_PP_NODE_375(p) BOOST_PP_IIF(p(375), 375, 376)
+#                         define BOOST_PP_NODE_380(p) BOOST_PP_IIF(p(380), BOOST_PP_NODE_378, BOOST_PP_NODE_382)
+#                             define BOOST_PP_NODE_378(p) BOOST_PP_IIF(p(378), BOOST_PP_NODE_377, BOOST_PP_NODE_379)
+#                                 define BOOST_PP_NODE_377(p) BOOST_PP_IIF(p(377), 377, 378)
+#                                 define BOOST_PP_NODE_379(p) BOOST_PP_IIF(p(379), 379, 380)
+#                             define BOOST_PP_NODE_382(p) BOOST_PP_IIF(p(382), BOOST_PP_NODE_381, BOOST_PP_NODE_383)
+#                                 define BOOST_PP_NODE_381(p) BOOST_PP_IIF(p(381), 381, 382)
+#                                 define BOOST_PP_NODE_383(p) BOOST_PP_IIF(p(383), 383, 384)
+#         define BOOST_PP_NODE_448(p) BOOST_PP_IIF(p(448), BOOST_PP_NODE_416, BOOST_PP_NODE_480)
+#             define BOOST_PP_NODE_416(p) BOOST_PP_IIF(p(416), BOOST_PP_NODE_400, BOOST_PP_NODE_432)
+#                 define BOOST_PP_NODE_400(p) BOOST_PP_IIF(p(400), BOOST_PP_NODE_392, BOOST_PP_NODE_408)
+#                     define BOOST_PP_NODE_392(p) BOOST_PP_IIF(p(392), BOOST_PP_NODE_388, BOOST_PP_NODE_396)
+#                         define BOOST_PP_NODE_388(p) BOOST_PP_IIF(p(388), BOOST_PP_NODE_386, BOOST_PP_NODE_390)
+#                             define BOOST_PP_NODE_386(p) BOOST_PP_IIF(p(386), BOOST_PP_NODE_385, BOOST_PP_NODE_387)
+#                                 define BOOST_PP_NODE_385(p) BOOST_PP_IIF(p(385), 385, 386)
+#                                 define BOOST_PP_NODE_387(p) BOOST_PP_IIF(p(387), 387, 388)
+#                             define BOOST_PP_NODE_390(p) BOOST_PP_IIF(p(390), BOOST_PP_NODE_389, BOOST_PP_NODE_391)
+#                                 define BOOST_PP_NODE_389(p) BOOST_PP_IIF(p(389), 389, 390)
+#                                 define BOOST_PP_NODE_391(p) BOOST_PP_IIF(p(391), 391, 392)
+#                         define BOOST_PP_NODE_396(p) BOOST_PP_IIF(p(396), BOOST_PP_NODE_394, BOOST_PP_NODE_398)
+#                             define BOOST_PP_NODE_394(p) BOOST_PP_IIF(p(394), BOOST_PP_NODE_393, BOOST_PP_NODE_395)
+#                                 define BOOST_PP_NODE_393(p) BOOST_PP_IIF(p(393), 393, 394)
+#                                 define BOOST_PP_NODE_395(p) BOOST_PP_IIF(p(395), 395, 396)
+#                             define BOOST_PP_NODE_398(p) BOOST_PP_IIF(p(398), BOOST_PP_NODE_397, BOOST_PP_NODE_399)
+#                                 define BOOST_PP_NODE_397(p) BOOST_PP_IIF(p(397), 397, 398)
+#                                 define BOOST_PP_NODE_399(p) BOOST_PP_IIF(p(399), 399, 400)
+#                     define BOOST_PP_NODE_408(p) BOOST_PP_IIF(p(408), BOOST_PP_NODE_404, BOOST_PP_NODE_412)
+#                         define BOOST_PP_NODE_404(p) BOOST_PP_IIF(p(404), BOOST_PP_NODE_402, BOOST_PP_NODE_406)
+#                             define BOOST_PP_NODE_402(p) BOOST_PP_IIF(p(402), BOOST_PP_NODE_401, BOOST_PP_NODE_403)
+#                                 define BOOST_PP_NODE_401(p) BOOST_PP_IIF(p(401), 401, 402)
+#                                 define BOOST_PP_NODE_403(p) BOOST_PP_IIF(p(403), 403, 404)
+#                             define BOOST_PP_NODE_406(p) BOOST_PP_IIF(p(406), BOOST_PP_NODE_405, BOOST_PP_NODE_407)
+#                                 define BOOST_PP_NODE_405(p) BOOST_PP_IIF(p(405), 405, 406)
+#                                 define BOOST_PP_NODE_407(p) BOOST_PP_IIF(p(407), 407, 408)
+#                         define BOOST_PP_NODE_412(p) BOOST_PP_IIF(p(412), BOOST_PP_NODE_410, BOOST_PP_NODE_414)
+#                             define BOOST_PP_NODE_410(p) BOOST_PP_IIF(p(410), BOOST_PP_NODE_409, BOOST_PP_NODE_411)
+#                                 define BOOST_PP_NODE_409(p) BOOST_PP_IIF(p(409), 409, 410)
+#                                 define BOOST_PP_NODE_411(p) BOOST_PP_IIF(p(411), 411, 412)
+#                             define BOOST_PP_NODE_414(p) BOOST_PP_IIF(p(414), BOOST_PP_NODE_413, BOOST_PP_NODE_415)
+#                                 define BOOST_PP_NODE_413(p) BOOST_PP_IIF(p(413), 413, 414)
+#                                 define BOOST_PP_NODE_415(p) BOOST_PP_IIF(p(415), 415, 416)
+#                 define BOOST_PP_NODE_432(p) BOOST_PP_IIF(p(432), BOOST_PP_NODE_424, BOOST_PP_NODE_440)
+#                     define BOOST_PP_NODE_424(p) BOOST_PP_IIF(p(424), BOOST_PP_NODE_420, BOOST_PP_NODE_428)
+#                         define BOOST_PP_NODE_420(p) BOOST_PP_IIF(p(420), BOOST_PP_NODE_418, BOOST_PP_NODE_422)
+#                             define BOOST_PP_NODE_418(p) BOOST_PP_IIF(p(418), BOOST_PP_NODE_417, BOOST_PP_NODE_419)
+#                                 define BOOST_PP_NODE_417(p) BOOST_PP_IIF(p(417), 417, 418)
+#                                 define BOOST_PP_NODE_419(p) BOOST_PP_IIF(p(419), 419, 420)
+#                             define BOOST_PP_NODE_422(p) BOOST_PP_IIF(p(422), BOOST_PP_NODE_421, BOOST_PP_NODE_423)
+#                                 define BOOST_PP_NODE_421(p) BOOST_PP_IIF(p(421), 421, 422)
+#                                 define BOOST_PP_NODE_423(p) BOOST_PP_IIF(p(423), 423, 424)
+#                         define BOOST_PP_NODE_428(p) BOOST_PP_IIF(p(428), BOOST_PP_NODE_426, BOOST_PP_NODE_430)
+#                             define BOOST_PP_NODE_426(p) BOOST_PP_IIF(p(426), BOOST_PP_NODE_425, BOOST_PP_NODE_427)
+#                                 define BOOST_PP_NODE_425(p) BOOST_PP_IIF(p(425), 425, 426)
+#                                 define BOOST_PP_NODE_427(p) BOOST_PP_IIF(p(427), 427, 428)
+#                             define BOOST_PP_NODE_430(p) BOOST_PP_IIF(p(430), BOOST_PP_NODE_429, BOOST_PP_NODE_431)
+#                                 define BOOST_PP_NODE_429(p) BOOST_PP_IIF(p(429), 429, 430)
+#                                 define BOOST_PP_NODE_431(p) BOOST_PP_IIF(p(431), 431, 432)
+#                     define BOOST_PP_NODE_440(p) BOOST_PP_IIF(p(440), BOOST_PP_NODE_436, BOOST_PP_NODE_444)
+#                         define BOOST_PP_NODE_436(p) BOOST_PP_IIF(p(436), BOOST_PP_NODE_434, BOOST_PP_NODE_438)
+#                             define BOOST_PP_NODE_434(p) BOOST_PP_IIF(p(434), BOOST_PP_NODE_433, BOOST_PP_NODE_435)
+#                                 define BOOST_PP_NODE_433(p) BOOST_PP_IIF(p(433), 433, 434)
+#                                 define BOOST_PP_NODE_435(p) BOOST_PP_IIF(p(435), 435, 436)
+#                             define BOOST_PP_NODE_438(p) BOOST_PP_IIF(p(438), BOOST_PP_NODE_437, BOOST_PP_NODE_439)
+#                                 define BOOST_PP_NODE_437(p) BOOST_PP_IIF(p(437), 437, 438)
+#                                 define BOOST_PP_NODE_439(p) BOOST_PP_IIF(p(439), 439, 440)
+#                         define BOOST_PP_NODE_444(p) BOOST_PP_IIF(p(444), BOOST_PP_NODE_442, BOOST_PP_NODE_446)
+#                             define BOOST_PP_NODE_442(p) BOOST_PP_IIF(p(442), BOOST_PP_NODE_441, BOOST_PP_NODE_443)
+#                                 define BOOST_PP_NODE_441(p) BOOST_PP_IIF(p(441), 441, 442)
+#                                 define BOOST_PP_NODE_443(p) BOOST_PP_IIF(p(443), 443, 444)
+#                             define BOOST_PP_NODE_446(p) BOOST_PP_IIF(p(446), BOOST_PP_NODE_445, BOOST_PP_NODE_447)
+#                                 define BOOST_PP_NODE_445(p) BOOST_PP_IIF(p(445), 445, 446)
+#                                 define BOOST_PP_NODE_447(p) BOOST_PP_IIF(p(447), 447, 448)
+#             define BOOST_PP_NODE_480(p) BOOST_PP_IIF(p(480), BOOST_PP_NODE_464, BOOST_PP_NODE_496)
+#                 define BOOST_PP_NODE_464(p) BOOST_PP_IIF(p(464), BOOST_PP_NODE_456, BOOST_PP_NODE_472)
+#                     define BOOST_PP_NODE_456(p) BOOST_PP_IIF(p(456), BOOST_PP_NODE_452, BOOST_PP_NODE_460)
+#                         define BOOST_PP_NODE_452(p) BOOST_PP_IIF(p(452), BOOST_PP_NODE_450, BOOST_PP_NODE_454)
+#                             define BOOST_PP_NODE_450(p) BOOST_PP_IIF(p(450), BOOST_PP_NODE_449, BOOST_PP_NODE_451)
+#                                 define BOOST_PP_NODE_449(p) BOOST_PP_IIF(p(449), 449, 450)
+#                                 define BOOST_PP_NODE_451(p) BOOST_PP_IIF(p(451), 451, 452)
+#                             define BOOST_PP_NODE_454(p) BOOST_PP_IIF(p(454), BOOST_PP_NODE_453, BOOST_PP_NODE_455)
+#                                 define BOOST_PP_NODE_453(p) BOOST_PP_IIF(p(453), 453, 454)
+#                                 define BOOST_PP_NODE_455(p) BOOST_PP_IIF(p(455), 455, 456)
+#                         define BOOST_PP_NODE_460(p) BOOST_PP_IIF(p(460), BOOST_PP_NODE_458, BOOST_PP_NODE_462)
+#                             define BOOST_PP_NODE_458(p) BOOST_PP_IIF(p(458), BOOST_PP_NODE_457, BOOST_PP_NODE_459)
+#                                 define BOOST_PP_NODE_457(p) BOOST_PP_IIF(p(457), 457, 458)
+#                                 define BOOST_PP_NODE_459(p) BOOST_PP_IIF(p(459), 459, 460)
+#                             define BOOST_PP_NODE_462(p) BOOST_PP_IIF(p(462), BOOST_PP_NODE_461, BOOST_PP_NODE_463)
+#                                 define BOOST_PP_NODE_461(p) BOOST_PP_IIF(p(461), 461, 462)
+#                                 define BOOST_PP_NODE_463(p) BOOST_PP_IIF(p(463), 463, 464)
+#                     define BOOST_PP_NODE_472(p) BOOST_PP_IIF(p(472), BOOST_PP_NODE_468, BOOST_PP_NODE_476)
+#                         define BOOST_PP_NODE_468(p) BOOST_PP_IIF(p(468), BOOST_PP_NODE_466, BOOST_PP_NODE_470)
+#                             define BOOST_PP_NODE_466(p) BOOST_PP_IIF(p(466), BOOST_PP_NODE_465, BOOST_PP_NODE_467)
+#                                 define BOOST_PP_NODE_465(p) BOOST_PP_IIF(p(465), 465, 466)
+#                                 define BOOST_PP_NODE_467(p) BOOST_PP_IIF(p(467), 467, 468)
+#                             define BOOST_PP_NODE_470(p) BOOST_PP_IIF(p(470), BOOST_PP_NODE_469, BOOST_PP_NODE_471)
+#                                 define BOOST_PP_NODE_469(p) BOOST_PP_IIF(p(469), 469, 470)
+#                                 define BOOST_PP_NODE_471(p) BOOST_PP_IIF(p(471), 471, 472)
+#                         define BOOST_PP_NODE_476(p) BOOST_PP_IIF(p(476), BOOST_PP_NODE_474, BOOST_PP_NODE_478)
+#                             define BOOST_PP_NODE_474(p) BOOST_PP_IIF(p(474), BOOST_PP_NODE_473, BOOST_PP_NODE_475)
+#                                 define BOOST_PP_NODE_473(p) BOOST_PP_IIF(p(473), 473, 474)
+#                                 define BOOST_PP_NODE_475(p) BOOST_PP_IIF(p(475), 475, 476)
+#                             define BOOST_PP_NODE_478(p) BOOST_PP_IIF(p(478), BOOST_PP_NODE_477, BOOST_PP_NODE_479)
+#                                 define BOOST_PP_NODE_477(p) BOOST_PP_IIF(p(477), 477, 478)
+#                                 define BOOST_PP_NODE_479(p) BOOST_PP_IIF(p(479), 479, 480)
+#                 define BOOST_PP_NODE_496(p) BOOST_PP_IIF(p(496), BOOST_PP_NODE_488, BOOST_PP_NODE_504)
+#                     define BOOST_PP_NODE_488(p) BOOST_PP_IIF(p(488), BOOST_PP_NODE_484, BOOST_PP_NODE_492)
+#                         define BOOST_PP_NODE_484(p) BOOST_PP_IIF(p(484), BOOST_PP_NODE_482, BOOST_PP_NODE_486)
+#                             define BOOST_PP_NODE_482(p) BOOST_PP_IIF(p(482), BOOST_PP_NODE_481, BOOST_PP_NODE_483)
+#                                 define BOOST_PP_NODE_481(p) BOOST_PP_IIF(p(481), 481, 482)
+#                                 define BOOST_PP_NODE_483(p) BOOST_PP_IIF(p(483), 483, 484)
+#                             define BOOST_PP_NODE_486(p) BOOST_PP_IIF(p(486), BOOST_PP_NODE_485, BOOST_PP_NODE_487)
+#                                 define BOOST_PP_NODE_485(p) BOOST_PP_IIF(p(485), 485, 486)
+#                                 define BOOST_PP_NODE_487(p) BOOST_PP_IIF(p(487), 487, 488)
+#                         define BOOST_PP_NODE_492(p) BOOST_PP_IIF(p(492), BOOST_PP_NODE_490, BOOST_PP_NODE_494)
+#                             define BOOST_PP_NODE_490(p) BOOST_PP_IIF(p(490), BOOST_PP_NODE_489, BOOST_PP_NODE_491)
+#                                 define BOOST_PP_NODE_489(p) BOOST_PP_IIF(p(489), 489, 490)
+#                                 define BOOST_PP_NODE_491(p) BOOST_PP_IIF(p(491), 491, 492)
+#                             define BOOST_PP_NODE_494(p) BOOST_PP_IIF(p(494), BOOST_PP_NODE_493, BOOST_PP_NODE_495)
+#                                 define BOOST_PP_NODE_493(p) BOOST_PP_IIF(p(493), 493, 494)
+#                                 define BOOST_PP_NODE_495(p) BOOST_PP_IIF(p(495), 495, 496)
+#                     define BOOST_PP_NODE_504(p) BOOST_PP_IIF(p(504), BOOST_PP_NODE_500, BOOST_PP_NODE_508)
+#                         define BOOST_PP_NODE_500(p) BOOST_PP_IIF(p(500), BOOST_PP_NODE_498, BOOST_PP_NODE_502)
+#                             define BOOST_PP_NODE_498(p) BOOST_PP_IIF(p(498), BOOST_PP_NODE_497, BOOST_PP_NODE_499)
+#                                 define BOOST_PP_NODE_497(p) BOOST_PP_IIF(p(497), 497, 498)
+#                                 define BOOST_PP_NODE_499(p) BOOST_PP_IIF(p(499), 499, 500)
+#                             define BOOST_PP_NODE_502(p) BOOST_PP_IIF(p(502), BOOST_PP_NODE_501, BOOST_PP_NODE_503)
+#                                 define BOOST_PP_NODE_501(p) BOOST_PP_IIF(p(501), 501, 502)
+#                                 define BOOST_PP_NODE_503(p) BOOST_PP_IIF(p(503), 503, 504)
+#                         define BOOST_PP_NODE_508(p) BOOST_PP_IIF(p(508), BOOST_PP_NODE_506, BOOST_PP_NODE_510)
+#                             define BOOST_PP_NODE_506(p) BOOST_PP_IIF(p(506), BOOST_PP_NODE_505, BOOST_PP_NODE_507)
+#                                 define BOOST_PP_NODE_505(p) BOOST_PP_IIF(p(505), 505, 506)
+#                                 define BOOST_PP_NODE_507(p) BOOST_PP_IIF(p(507), 507, 508)
+#                             define BOOST_PP_NODE_510(p) BOOST_PP_IIF(p(510), BOOST_PP_NODE_509, BOOST_PP_NODE_511)
+#                                 define BOOST_PP_NODE_509(p) BOOST_PP_IIF(p(509), 509, 510)
+#                                 define BOOST_PP_NODE_511(p) BOOST_PP_IIF(p(511), 511, 512)
+#
+# endif
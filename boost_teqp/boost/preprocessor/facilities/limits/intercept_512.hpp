@@ -0,0 +1,274 @@
+# /* **************************************************************************
+#  *                                                                          *
+#  *     (C) Copyright Paul Mensonides 2002.
+#  *     Distributed under the Boost Software License, Version 1.0. (See
+#  *     accompanying file LICENSE_1_0.txt or copy at
+#  *     http://www.boost.org/LICENSE_1_0.txt)
+#  *                                                                          *
+#  ************************************************************************** */
+#
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_FACILITIES_INTERCEPT_512_HPP
+# define BOOST_PREPROCESSOR_FACILITIES_INTERCEPT_512_HPP
+#
+# define BOOST_PP_INTERCEPT_257
+# define BOOST_PP_INTERCEPT_258
+# define BOOST_PP_INTERCEPT_259
+# define BOOST_PP_INTERCEPT_260
+# define BOOST_PP_INTERCEPT_261
+# define BOOST_PP_INTERCEPT_262
+# define BOOST_PP_INTERCEPT_263
+# define BOOST_PP_INTERCEPT_264
+# define BOOST_PP_INTERCEPT_265
+# define BOOST_PP_INTERCEPT_266
+# define BOOST_PP_INTERCEPT_267
+# define BOOST_PP_INTERCEPT_268
+# define BOOST_PP_INTERCEPT_269
+# define BOOST_PP_INTERCEPT_270
+# define BOOST_PP_INTERCEPT_271
+# define BOOST_PP_INTERCEPT_272
+# define BOOST_PP_INTERCEPT_273
+# define BOOST_PP_INTERCEPT_274
+# define BOOST_PP_INTERCEPT_275
+# define BOOST_PP_INTERCEPT_276
+# define BOOST_PP_INTERCEPT_277
+# define BOOST_PP_INTERCEPT_278
+# define BOOST_PP_INTERCEPT_279
+# define BOOST_PP_INTERCEPT_280
+# define BOOST_PP_INTERCEPT_281
+# define BOOST_PP_INTERCEPT_282
+# define BOOST_PP_INTERCEPT_283
+# define BOOST_PP_INTERCEPT_284
+# define BOOST_PP_INTERCEPT_285
+# define BOOST_PP_INTERCEPT_286
+# define BOOST_PP_INTERCEPT_287
+# define BOOST_PP_INTERCEPT_288
+# define BOOST_PP_INTERCEPT_289
+# define BOOST_PP_INTERCEPT_290
+# define BOOST_PP_INTERCEPT_291
+# define BOOST_PP_INTERCEPT_292
+# define BOOST_PP_INTERCEPT_293
+# define BOOST_PP_INTERCEPT_294
+# define BOOST_PP_INTERCEPT_295
+# define BOOST_PP_INTERCEPT_296
+# define BOOST_PP_INTERCEPT_297
+# define BOOST_PP_INTERCEPT_298
+# define BOOST_PP_INTERCEPT_299
+# define BOOST_PP_INTERCEPT_300
+# define BOOST_PP_INTERCEPT_301
+# define BOOST_PP_INTERCEPT_302
+# define BOOST_PP_INTERCEPT_303
+# define BOOST_PP_INTERCEPT_304
+# define BOOST_PP_INTERCEPT_305
+# define BOOST_PP_INTERCEPT_306
+# define BOOST_PP_INTERCEPT_307
+# define BOOST_PP_INTERCEPT_308
+# define BOOST_PP_INTERCEPT_309
+# define BOOST_PP_INTERCEPT_310
+# define BOOST_PP_INTERCEPT_311
+# define BOOST_PP_INTERCEPT_312
+# define BOOST_PP_INTERCEPT_313
+# define BOOST_PP_INTERCEPT_314
+# define BOOST_PP_INTERCEPT_315
+# define BOOST_PP_INTERCEPT_316
+# define BOOST_PP_INTERCEPT_317
+# define BOOST_PP_INTERCEPT_318
+# define BOOST_PP_INTERCEPT_319
+# define BOOST_PP_INTERCEPT_320
+# define BOOST_PP_INTERCEPT_321
+# define BOOST_PP_INTERCEPT_322
+# define BOOST_PP_INTERCEPT_323
+# define BOOST_PP_INTERCEPT_324
+# define BOOST_PP_INTERCEPT_325
+# define BOOST_PP_INTERCEPT_326
+# define BOOST_PP_INTERCEPT_327
+# define BOOST_PP_INTERCEPT_328
+# define BOOST_PP_INTERCEPT_329
+# define BOOST_PP_INTERCEPT_330
+# define BOOST_PP_INTERCEPT_331
+# define BOOST_PP_INTERCEPT_332
+# define BOOST_PP_INTERCEPT_333
+# define BOOST_PP_INTERCEPT_334
+# define BOOST_PP_INTERCEPT_335
+# define BOOST_PP_INTERCEPT_336
+# define BOOST_PP_INTERCEPT_337
+# define BOOST_PP_INTERCEPT_338
+# define BOOST_PP_INTERCEPT_339
+# define BOOST_PP_INTERCEPT_340
+# define BOOST_PP_INTERCEPT_341
+# define BOOST_PP_INTERCEPT_342
+# define BOOST_PP_INTERCEPT_343
+# define BOOST_PP_INTERCEPT_344
+# define BOOST_PP_INTERCEPT_345
+# define BOOST_PP_INTERCEPT_346
+# define BOOST_PP_INTERCEPT_347
+# define BOOST_PP_INTERCEPT_348
+# define BOOST_PP_INTERCEPT_349
+# define BOOST_PP_INTERCEPT_350
+# define BOOST_PP_INTERCEPT_351
+# define BOOST_PP_INTERCEPT_352
+# define BOOST_PP_INTERCEPT_353
+# define BOOST_PP_INTERCEPT_354
+# define BOOST_PP_INTERCEPT_355
+# define BOOST_PP_INTERCEPT_356
+# define BOOST_PP_INTERCEPT_357
+# define BOOST_PP_INTERCEPT_358
+# define BOOST_PP_INTERCEPT_359
+# define BOOST_PP_INTERCEPT_360
+# define BOOST_PP_INTERCEPT_361
+# define BOOST_PP_INTERCEPT_362
+# define BOOST_PP_INTERCEPT_363
+# define BOOST_PP_INTERCEPT_364
+# define BOOST_PP_INTERCEPT_365
+# define BOOST_PP_INTERCEPT_366
+# define BOOST_PP_INTERCEPT_367
+# define BOOST_PP_INTERCEPT_368
+# define BOOST_PP_INTERCEPT_369
+# define BOOST_PP_INTERCEPT_370
+# define BOOST_PP_INTERCEPT_371
+# define BOOST_PP_INTERCEPT_372
+# define BOOST_PP_INTERCEPT_373
+# define BOOST_PP_INTERCEPT_374
+# define BOOST_PP_INTERCEPT_375
+# define BOOST_PP_INTERCEPT_376
+# define BOOST_PP_INTERCEPT_377
+# define BOOST_PP_INTERCEPT_378
+# define BOOST_PP_INTERCEPT_379
+# define BOOST_PP_INTERCEPT_380
+# define BOOST_PP_INTERCEPT_381
+# define BOOST_PP_INTERCEPT_382
+# define BOOST_PP_INTERCEPT_383
+# define BOOST_PP_INTERCEPT_384
+# define BOOST_PP_INTERCEPT_385
+# define BOOST_PP_INTERCEPT_386
+# define BOOST_PP_INTERCEPT_387
+# define BOOST_PP_INTERCEPT_388
+# define BOOST_PP_INTERCEPT_389
+# define BOOST_PP_INTERCEPT_390
+# define BOOST_PP_INTERCEPT_391
+# define BOOST_PP_INTERCEPT_392
+# define BOOST_PP_INTERCEPT_393
+# define BOOST_PP_INTERCEPT_394
+# define BOOST_PP_INTERCEPT_395
+# define BOOST_PP_INTERCEPT_396
+# define BOOST_PP_INTERCEPT_397
+# define BOOST_PP_INTERCEPT_398
+# define BOOST_PP_INTERCEPT_399
+# define BOOST_PP_INTERCEPT_400
+# define BOOST_PP_INTERCEPT_401
+# define BOOST_PP_INTERCEPT_402
+# define BOOST_PP_INTERCEPT_403
+# define BOOST_PP_INTERCEPT_404
+# define BOOST_PP_INTERCEPT_405
+# define BOOST_PP_INTERCEPT_406
+# define BOOST_PP_INTERCEPT_407
+# define BOOST_PP_INTERCEPT_408
+# define BOOST_PP_INTERCEPT_409
+# define BOOST_PP_INTERCEPT_410
+# define BOOST_PP_INTERCEPT_411
+# define BOOST_PP_INTERCEPT_412
+# define BOOST_PP_INTERCEPT_413
+# define BOOST_PP_INTERCEPT_414
+# define BOOST_PP_INTERCEPT_415
+# define BOOST_PP_INTERCEPT_416
+# define BOOST_PP_INTERCEPT_417
+# define BOOST_PP_INTERCEPT_418
+# define BOOST_PP_INTERCEPT_419
+# define BOOST_PP_INTERCEPT_420
+# define BOOST_PP_INTERCEPT_421
+# define BOOST_PP_INTERCEPT_422
+# define BOOST_PP_INTERCEPT_423
+# define BOOST_PP_INTERCEPT_424
+# define BOOST_PP_INTERCEPT_425
+# define BOOST_PP_INTERCEPT_426
+# define BOOST_PP_INTERCEPT_427
+# define BOOST_PP_INTERCEPT_428
+# define BOOST_PP_INTERCEPT_429
+# define BOOST_PP_INTERCEPT_430
+# define BOOST_PP_INTERCEPT_431
+# define BOOST_PP_INTERCEPT_432
+# define BOOST_PP_INTERCEPT_433
+# define BOOST_PP_INTERCEPT_434
+# define BOOST_PP_INTERCEPT_435
+# define BOOST_PP_INTERCEPT_436
+# define BOOST_PP_INTERCEPT_437
+# define BOOST_PP_INTERCEPT_438
+# define BOOST_PP_INTERCEPT_439
+# define BOOST_PP_INTERCEPT_440
+# define BOOST_PP_INTERCEPT_441
+# define BOOST_PP_INTERCEPT_442
+# define BOOST_PP_INTERCEPT_443
+# define BOOST_PP_INTERCEPT_444
+# define BOOST_PP_INTERCEPT_445
+# define BOOST_PP_INTERCEPT_446
+# define BOOST_PP_INTERCEPT_447
+# define BOOST_PP_INTERCEPT_448
+# define BOOST_PP_INTERCEPT_449
+# define BOOST_PP_INTERCEPT_450
+# define BOOST_PP_INTERCEPT_451
+# define BOOST_PP_INTERCEPT_452
+# define BOOST_PP_INTERCEPT_453
+# define BOOST_PP_INTERCEPT_454
+# define BOOST_PP_INTERCEPT_455
+# define BOOST_PP_INTERCEPT_456
+# define BOOST_PP_INTERCEPT_457
+# define BOOST_PP_INTERCEPT_458
+# define BOOST_PP_INTERCEPT_459
+# define BOOST_PP_INTERCEPT_460
+# define BOOST_PP_INTERCEPT_461
+# define BOOST_PP_INTERCEPT_462
+# define BOOST_PP_INTERCEPT_463
+# define BOOST_PP_INTERCEPT_464
+# define BOOST_PP_INTERCEPT_465
+# define BOOST_PP_INTERCEPT_466
+# define BOOST_PP_INTERCEPT_467
+# define BOOST_PP_INTERCEPT_468
+# define BOOST_PP_INTERCEPT_469
+# define BOOST_PP_INTERCEPT_470
+# define BOOST_PP_INTERCEPT_471
+# define BOOST_PP_INTERCEPT_472
+# define BOOST_PP_INTERCEPT_473
+# define BOOST_PP_INTERCEPT_474
+# define BOOST_PP_INTERCEPT_475
+# define BOOST_PP_INTERCEPT_476
+# define BOOST_PP_INTERCEPT_477
+# define BOOST_PP_INTERCEPT_478
+# define BOOST_PP_INTERCEPT_479
+# define BOOST_PP_INTERCEPT_480
+# define BOOST_PP_INTERCEPT_481
+# define BOOST_PP_INTERCEPT_482
+# define BOOST_PP_INTERCEPT_483
+# define BOOST_PP_INTERCEPT_484
+# define BOOST_PP_INTERCEPT_485
+# define BOOST_PP_INTERCEPT_486
+# define BOOST_PP_INTERCEPT_487
+# define BOOST_PP_INTERCEPT_488
+# define BOOST_PP_INTERCEPT_489
+# define BOOST_PP_INTERCEPT_490
+# define BOOST_PP_INTERCEPT_491
+# define BOOST_PP_INTERCEPT_492
+# define BOOST_PP_INTERCEPT_493
+# define BOOST_PP_INTERCEPT_494
+# define BOOST_PP_INTERCEPT_495
+# define BOOST_PP_INTERCEPT_496
+# define BOOST_PP_INTERCEPT_497
+# define BOOST_PP_INTERCEPT_498
+# define BOOST_PP_INTERCEPT_499
+# define BOOST_PP_INTERCEPT_500
+# define BOOST_PP_INTERCEPT_501
+# define BOOST_PP_INTERCEPT_502
+# define BOOST_PP_INTERCEPT_503
+# define BOOST_PP_INTERCEPT_504
+# define BOOST_PP_INTERCEPT_505
+# define BOOST_PP_INTERCEPT_506
+# define BOOST_PP_INTERCEPT_507
+# define BOOST_PP_INTERCEPT_508
+# define BOOST_PP_INTERCEPT_509
+# define BOOST_PP_INTERCEPT_510
+# define BOOST_PP_INTERCEPT_511
+# define BOOST_PP_INTERCEPT_512
+#
+# endif
@@ -0,0 +1,781 @@
+# /* **************************************************************************
+#  *                                                                          *
+#  *     (C) Copyright Paul Mensonides 2002.
+#  *     Distributed under the Boost Software License, Version 1.0. (See
+#  *     accompanying file LICENSE_1_0.txt or copy at
+#  *     http://www.boost.org/LICENSE_1_0.txt)
+#  *                                                                          *
+#  ************************************************************************** */
+#
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# if BOOST_PP_LOCAL_R(512)
+    BOOST_PP_LOCAL_MACRO(512)
+# endif
+# if BOOST_PP_LOCAL_R(511)
+    BOOST_PP_LOCAL_MACRO(511)
+# endif
+# if BOOST_PP_LOCAL_R(510)
+    BOOST_PP_LOCAL_MACRO(510)
+# endif
+# if BOOST_PP_LOCAL_R(509)
+    BOOST_PP_LOCAL_MACRO(509)
+# endif
+# if BOOST_PP_LOCAL_R(508)
+    BOOST_PP_LOCAL_MACRO(508)
+# endif
+# if BOOST_PP_LOCAL_R(507)
+    BOOST_PP_LOCAL_MACRO(507)
+# endif
+# if BOOST_PP_LOCAL_R(506)
+    BOOST_PP_LOCAL_MACRO(506)
+# endif
+# if BOOST_PP_LOCAL_R(505)
+    BOOST_PP_LOCAL_MACRO(505)
+# endif
+# if BOOST_PP_LOCAL_R(504)
+    BOOST_PP_LOCAL_MACRO(504)
+# endif
+# if BOOST_PP_LOCAL_R(503)
+    BOOST_PP_LOCAL_MACRO(503)
+# endif
+# if BOOST_PP_LOCAL_R(502)
+    BOOST_PP_LOCAL_MACRO(502)
+# endif
+# if BOOST_PP_LOCAL_R(501)
+    BOOST_PP_LOCAL_MACRO(501)
+# endif
+# if BOOST_PP_LOCAL_R(500)
+    BOOST_PP_LOCAL_MACRO(500)
+# endif
+# if BOOST_PP_LOCAL_R(499)
+    BOOST_PP_LOCAL_MACRO(499)
+# endif
+# if BOOST_PP_LOCAL_R(498)
+    BOOST_PP_LOCAL_MACRO(498)
+# endif
+# if BOOST_PP_LOCAL_R(497)
+    BOOST_PP_LOCAL_MACRO(497)
+# endif
+# if BOOST_PP_LOCAL_R(496)
+    BOOST_PP_LOCAL_MACRO(496)
+# endif
+# if BOOST_PP_LOCAL_R(495)
+    BOOST_PP_LOCAL_MACRO(495)
+# endif
+# if BOOST_PP_LOCAL_R(494)
+    BOOST_PP_LOCAL_MACRO(494)
+# endif
+# if BOOST_PP_LOCAL_R(493)
+    BOOST_PP_LOCAL_MACRO(493)
+# endif
+# if BOOST_PP_LOCAL_R(492)
+    BOOST_PP_LOCAL_MACRO(492)
+# endif
+# if BOOST_PP_LOCAL_R(491)
+    BOOST_PP_LOCAL_MACRO(491)
+# endif
+# if BOOST_PP_LOCAL_R(490)
+    BOOST_PP_LOCAL_MACRO(490)
+# endif
+# if BOOST_PP_LOCAL_R(489)
+    BOOST_PP_LOCAL_MACRO(489)
+# endif
+# if BOOST_PP_LOCAL_R(488)
+    BOOST_PP_LOCAL_MACRO(488)
+# endif
+# if BOOST_PP_LOCAL_R(487)
+    BOOST_PP_LOCAL_MACRO(487)
+# endif
+# if BOOST_PP_LOCAL_R(486)
+    BOOST_PP_LOCAL_MACRO(486)
+# endif
+# if BOOST_PP_LOCAL_R(485)
+    BOOST_PP_LOCAL_MACRO(485)
+# endif
+# if BOOST_PP_LOCAL_R(484)
+    BOOST_PP_LOCAL_MACRO(484)
+# endif
+# if BOOST_PP_LOCAL_R(483)
+    BOOST_PP_LOCAL_MACRO(483)
+# endif
+# if BOOST_PP_LOCAL_R(482)
+    BOOST_PP_LOCAL_MACRO(482)
+# endif
+# if BOOST_PP_LOCAL_R(481)
+    BOOST_PP_LOCAL_MACRO(481)
+# endif
+# if BOOST_PP_LOCAL_R(480)
+    BOOST_PP_LOCAL_MACRO(480)
+# endif
+# if BOOST_PP_LOCAL_R(479)
+    BOOST_PP_LOCAL_MACRO(479)
+# endif
+# if BOOST_PP_LOCAL_R(478)
+    BOOST_PP_LOCAL_MACRO(478)
+# endif
+# if BOOST_PP_LOCAL_R(477)
+    BOOST_PP_LOCAL_MACRO(477)
+# endif
+# if BOOST_PP_LOCAL_R(476)
+    BOOST_PP_LOCAL_MACRO(476)
+# endif
+# if BOOST_PP_LOCAL_R(475)
+    BOOST_PP_LOCAL_MACRO(475)
+# endif
+# if BOOST_PP_LOCAL_R(474)
+    BOOST_PP_LOCAL_MACRO(474)
+# endif
+# if BOOST_PP_LOCAL_R(473)
+    BOOST_PP_LOCAL_MACRO(473)
+# endif
+# if BOOST_PP_LOCAL_R(472)
+    BOOST_PP_LOCAL_MACRO(472)
+# endif
+# if BOOST_PP_LOCAL_R(471)
+    BOOST_PP_LOCAL_MACRO(471)
+# endif
+# if BOOST_PP_LOCAL_R(470)
+    BOOST_PP_LOCAL_MACRO(470)
+# endif
+# if BOOST_PP_LOCAL_R(469)
+    BOOST_PP_LOCAL_MACRO(469)
+# endif
+# if BOOST_PP_LOCAL_R(468)
+    BOOST_PP_LOCAL_MACRO(468)
+# endif
+# if BOOST_PP_LOCAL_R(467)
+    BOOST_PP_LOCAL_MACRO(467)
+# endif
+# if BOOST_PP_LOCAL_R(466)
+    BOOST_PP_LOCAL_MACRO(466)
+# endif
+# if BOOST_PP_LOCAL_R(465)
+    BOOST_PP_LOCAL_MACRO(465)
+# endif
+# if BOOST_PP_LOCAL_R(464)
+    BOOST_PP_LOCAL_MACRO(464)
+# endif
+# if BOOST_PP_LOCAL_R(463)
+    BOOST_PP_LOCAL_MACRO(463)
+# endif
+# if BOOST_PP_LOCAL_R(462)
+    BOOST_PP_LOCAL_MACRO(462)
+# endif
+# if BOOST_PP_LOCAL_R(461)
+    BOOST_PP_LOCAL_MACRO(461)
+# endif
+# if BOOST_PP_LOCAL_R(460)
+    BOOST_PP_LOCAL_MACRO(460)
+# endif
+# if BOOST_PP_LOCAL_R(459)
+    BOOST_PP_LOCAL_MACRO(459)
+# endif
+# if BOOST_PP_LOCAL_R(458)
+    BOOST_PP_LOCAL_MACRO(458)
+# endif
+# if BOOST_PP_LOCAL_R(457)
+    BOOST_PP_LOCAL_MACRO(457)
+# endif
+# if BOOST_PP_LOCAL_R(456)
+    BOOST_PP_LOCAL_MACRO(456)
+# endif
+# if BOOST_PP_LOCAL_R(455)
+    BOOST_PP_LOCAL_MACRO(455)
+# endif
+# if BOOST_PP_LOCAL_R(454)
+    BOOST_PP_LOCAL_MACRO(454)
+# endif
+# if BOOST_PP_LOCAL_R(453)
+    BOOST_PP_LOCAL_MACRO(453)
+# endif
+# if BOOST_PP_LOCAL_R(452)
+    BOOST_PP_LOCAL_MACRO(452)
+# endif
+# if BOOST_PP_LOCAL_R(451)
+    BOOST_PP_LOCAL_MACRO(451)
+# endif
+# if BOOST_PP_LOCAL_R(450)
+    BOOST_PP_LOCAL_MACRO(450)
+# endif
+# if BOOST_PP_LOCAL_R(449)
+    BOOST_PP_LOCAL_MACRO(449)
+# endif
+# if BOOST_PP_LOCAL_R(448)
+    BOOST_PP_LOCAL_MACRO(448)
+# endif
+# if BOOST_PP_LOCAL_R(447)
+    BOOST_PP_LOCAL_MACRO(447)
+# endif
+# if BOOST_PP_LOCAL_R(446)
+    BOOST_PP_LOCAL_MACRO(446)
+# endif
+# if BOOST_PP_LOCAL_R(445)
+    BOOST_PP_LOCAL_MACRO(445)
+# endif
+# if BOOST_PP_LOCAL_R(444)
+    BOOST_PP_LOCAL_MACRO(444)
+# endif
+# if BOOST_PP_LOCAL_R(443)
+    BOOST_PP_LOCAL_MACRO(443)
+# endif
+# if BOOST_PP_LOCAL_R(442)
+    BOOST_PP_LOCAL_MACRO(442)
+# endif
+# if BOOST_PP_LOCAL_R(441)
+    BOOST_PP_LOCAL_MACRO(441)
+# endif
+# if BOOST_PP_LOCAL_R(440)
+    BOOST_PP_LOCAL_MACRO(440)
+# endif
+# if BOOST_PP_LOCAL_R(439)
+    BOOST_PP_LOCAL_MACRO(439)
+# endif
+# if BOOST_PP_LOCAL_R(438)
+    BOOST_PP_LOCAL_MACRO(438)
+# endif
+# if BOOST_PP_LOCAL_R(437)
+    BOOST_PP_LOCAL_MACRO(437)
+# endif
+# if BOOST_PP_LOCAL_R(436)
+    BOOST_PP_LOCAL_MACRO(436)
+# endif
+# if BOOST_PP_LOCAL_R(435)
+    BOOST_PP_LOCAL_MACRO(435)
+# endif
+# if BOOST_PP_LOCAL_R(434)
+    BOOST_PP_LOCAL_MACRO(434)
+# endif
+# if BOOST_PP_LOCAL_R(433)
+    BOOST_PP_LOCAL_MACRO(433)
+# endif
+# if BOOST_PP_LOCAL_R(432)
+    BOOST_PP_LOCAL_MACRO(432)
+# endif
+# if BOOST_PP_LOCAL_R(431)
+    BOOST_PP_LOCAL_MACRO(431)
+# endif
+# if BOOST_PP_LOCAL_R(430)
+    BOOST_PP_LOCAL_MACRO(430)
+# endif
+# if BOOST_PP_LOCAL_R(429)
+    BOOST_PP_LOCAL_MACRO(429)
+# endif
+# if BOOST_PP_LOCAL_R(428)
+    BOOST_PP_LOCAL_MACRO(428)
+# endif
+# if BOOST_PP_LOCAL_R(427)
+    BOOST_PP_LOCAL_MACRO(427)
+# endif
+# if BOOST_PP_LOCAL_R(426)
+    BOOST_PP_LOCAL_MACRO(426)
+# endif
+# if BOOST_PP_LOCAL_R(425)
+    BOOST_PP_LOCAL_MACRO(425)
+# endif
+# if BOOST_PP_LOCAL_R(424)
+    BOOST_PP_LOCAL_MACRO(424)
+# endif
+# if BOOST_PP_LOCAL_R(423)
+    BOOST_PP_LOCAL_MACRO(423)
+# endif
+# if BOOST_PP_LOCAL_R(422)
+    BOOST_PP_LOCAL_MACRO(422)
+# endif
+# if BOOST_PP_LOCAL_R(421)
+    BOOST_PP_LOCAL_MACRO(421)
+# endif
+# if BOOST_PP_LOCAL_R(420)
+    BOOST_PP_LOCAL_MACRO(420)
+# endif
+# if BOOST_PP_LOCAL_R(419)
+    BOOST_PP_LOCAL_MACRO(419)
+# endif
+# if BOOST_PP_LOCAL_R(418)
+    BOOST_PP_LOCAL_MACRO(418)
+# endif
+# if BOOST_PP_LOCAL_R(417)
+    BOOST_PP_LOCAL_MACRO(417)
+# endif
+# if BOOST_PP_LOCAL_R(416)
+    BOOST_PP_LOCAL_MACRO(416)
+# endif
+# if BOOST_PP_LOCAL_R(415)
+    BOOST_PP_LOCAL_MACRO(415)
+# endif
+# if BOOST_PP_LOCAL_R(414)
+    BOOST_PP_LOCAL_MACRO(414)
+# endif
+# if BOOST_PP_LOCAL_R(413)
+    BOOST_PP_LOCAL_MACRO(413)
+# endif
+# if BOOST_PP_LOCAL_R(412)
+    BOOST_PP_LOCAL_MACRO(412)
+# endif
+# if BOOST_PP_LOCAL_R(411)
+    BOOST_PP_LOCAL_MACRO(411)
+# endif
+# if BOOST_PP_LOCAL_R(410)
+    BOOST_PP_LOCAL_MACRO(410)
+# endif
+# if BOOST_PP_LOCAL_R(409)
+    BOOST_PP_LOCAL_MACRO(409)
+# endif
+# if BOOST_PP_LOCAL_R(408)
+    BOOST_PP_LOCAL_MACRO(408)
+# endif
+# if BOOST_PP_LOCAL_R(407)
+    BOOST_PP_LOCAL_MACRO(407)
+# endif
+# if BOOST_PP_LOCAL_R(406)
+    BOOST_PP_LOCAL_MACRO(406)
+# endif
+# if BOOST_PP_LOCAL_R(405)
+    BOOST_PP_LOCAL_MACRO(405)
+# endif
+# if BOOST_PP_LOCAL_R(404)
+    BOOST_PP_LOCAL_MACRO(404)
+# endif
+# if BOOST_PP_LOCAL_R(403)
+    BOOST_PP_LOCAL_MACRO(403)
+# endif
+# if BOOST_PP_LOCAL_R(402)
+    BOOST_PP_LOCAL_MACRO(402)
+# endif
+# if BOOST_PP_LOCAL_R(401)
+    BOOST_PP_LOCAL_MACRO(401)
+# endif
+# if BOOST_PP_LOCAL_R(400)
+    BOOST_PP_LOCAL_MACRO(400)
+# endif
+# if BOOST_PP_LOCAL_R(399)
+    BOOST_PP_LOCAL_MACRO(399)
+# endif
+# if BOOST_PP_LOCAL_R(398)
+    BOOST_PP_LOCAL_MACRO(398)
+# endif
+# if BOOST_PP_LOCAL_R(397)
+    BOOST_PP_LOCAL_MACRO(397)
+# endif
+# if BOOST_PP_LOCAL_R(396)
+    BOOST_PP_LOCAL_MACRO(396)
+# endif
+# if BOOST_PP_LOCAL_R(395)
+    BOOST_PP_LOCAL_MACRO(395)
+# endif
+# if BOOST_PP_LOCAL_R(394)
+    BOOST_PP_LOCAL_MACRO(394)
+# endif
+# if BOOST_PP_LOCAL_R(393)
+    BOOST_PP_LOCAL_MACRO(393)
+# endif
+# if BOOST_PP_LOCAL_R(392)
+    BOOST_PP_LOCAL_MACRO(392)
+# endif
+# if BOOST_PP_LOCAL_R(391)
+    BOOST_PP_LOCAL_MACRO(391)
+# endif
+# if BOOST_PP_LOCAL_R(390)
+    BOOST_PP_LOCAL_MACRO(390)
+# endif
+# if BOOST_PP_LOCAL_R(389)
+    BOOST_PP_LOCAL_MACRO(389)
+# endif
+# if BOOST_PP_LOCAL_R(388)
+    BOOST_PP_LOCAL_MACRO(388)
+# endif
+# if BOOST_PP_LOCAL_R(387)
+    BOOST_PP_LOCAL_MACRO(387)
+# endif
+# if BOOST_PP_LOCAL_R(386)
+    BOOST_PP_LOCAL_MACRO(386)
+# endif
+# if BOOST_PP_LOCAL_R(385)
+    BOOST_PP_LOCAL_MACRO(385)
+# endif
+# if BOOST_PP_LOCAL_R(384)
+    BOOST_PP_LOCAL_MACRO(384)
+# endif
+# if BOOST_PP_LOCAL_R(383)
+    BOOST_PP_LOCAL_MACRO(383)
+# endif
+# if BOOST_PP_LOCAL_R(382)
+    BOOST_PP_LOCAL_MACRO(382)
+# endif
+# if BOOST_PP_LOCAL_R(381)
+    BOOST_PP_LOCAL_MACRO(381)
+# endif
+# if BOOST_PP_LOCAL_R(380)
+    BOOST_PP_LOCAL_MACRO(380)
+# endif
+# if BOOST_PP_LOCAL_R(379)
+    BOOST_PP_LOCAL_MACRO(379)
+# endif
+# if BOOST_PP_LOCAL_R(378)
+    BOOST_PP_LOCAL_MACRO(378)
+# endif
+# if BOOST_PP_LOCAL_R(377)
+    BOOST_PP_LOCAL_MACRO(377)
+# endif
+# if BOOST_PP_LOCAL_R(376)
+    BOOST_PP_LOCAL_MACRO(376)
+# endif
+# if BOOST_PP_LOCAL_R(375)
+    BOOST_PP_LOCAL_MACRO(375)
+# endif
+# if BOOST_PP_LOCAL_R(374)
+    BOOST_PP_LOCAL_MACRO(374)
+# endif
+# if BOOST_PP_LOCAL_R(373)
+    BOOST_PP_LOCAL_MACRO(373)
+# endif
+# if BOOST_PP_LOCAL_R(372)
+    BOOST_PP_LOCAL_MACRO(372)
+# endif
+# if BOOST_PP_LOCAL_R(371)
+    BOOST_PP_LOCAL_MACRO(371)
+# endif
+# if BOOST_PP_LOCAL_R(370)
+    BOOST_PP_LOCAL_MACRO(370)
+# endif
+# if BOOST_PP_LOCAL_R(369)
+    BOOST_PP_LOCAL_MACRO(369)
+# endif
+# if BOOST_PP_LOCAL_R(368)
+    BOOST_PP_LOCAL_MACRO(368)
+# endif
+# if BOOST_PP_LOCAL_R(367)
+    BOOST_PP_LOCAL_MACRO(367)
+# endif
+# if BOOST_PP_LOCAL_R(366)
+    BOOST_PP_LOCAL_MACRO(366)
+# endif
+# if BOOST_PP_LOCAL_R(365)
+    BOOST_PP_LOCAL_MACRO(365)
+# endif
+# if BOOST_PP_LOCAL_R(364)
+    BOOST_PP_LOCAL_MACRO(364)
+# endif
+# if BOOST_PP_LOCAL_R(363)
+    BOOST_PP_LOCAL_MACRO(363)
+# endif
+# if BOOST_PP_LOCAL_R(362)
+    BOOST_PP_LOCAL_MACRO(362)
+# endif
+# if BOOST_PP_LOCAL_R(361)
+    BOOST_PP_LOCAL_MACRO(361)
+# endif
+# if BOOST_PP_LOCAL_R(360)
+    BOOST_PP_LOCAL_MACRO(360)
+# endif
+# if BOOST_PP_LOCAL_R(359)
+    BOOST_PP_LOCAL_MACRO(359)
+# endif
+# if BOOST_PP_LOCAL_R(358)
+    BOOST_PP_LOCAL_MACRO(358)
+# endif
+# if BOOST_PP_LOCAL_R(357)
+    BOOST_PP_LOCAL_MACRO(357)
+# endif
+# if BOOST_PP_LOCAL_R(356)
+    BOOST_PP_LOCAL_MACRO(356)
+# endif
+# if BOOST_PP_LOCAL_R(355)
+    BOOST_PP_LOCAL_MACRO(355)
+# endif
+# if BOOST_PP_LOCAL_R(354)
+    BOOST_PP_LOCAL_MACRO(354)
+# endif
+# if BOOST_PP_LOCAL_R(353)
+    BOOST_PP_LOCAL_MACRO(353)
+# endif
+# if BOOST_PP_LOCAL_R(352)
+    BOOST_PP_LOCAL_MACRO(352)
+# endif
+# if BOOST_PP_LOCAL_R(351)
+    BOOST_PP_LOCAL_MACRO(351)
+# endif
+# if BOOST_PP_LOCAL_R(350)
+    BOOST_PP_LOCAL_MACRO(350)
+# endif
+# if BOOST_PP_LOCAL_R(349)
+    BOOST_PP_LOCAL_MACRO(349)
+# endif
+# if BOOST_PP_LOCAL_R(348)
+    BOOST_PP_LOCAL_MACRO(348)
+# endif
+# if BOOST_PP_LOCAL_R(347)
+    BOOST_PP_LOCAL_MACRO(347)
+# endif
+# if BOOST_PP_LOCAL_R(346)
+    BOOST_PP_LOCAL_MACRO(346)
+# endif
+# if BOOST_PP_LOCAL_R(345)
+    BOOST_PP_LOCAL_MACRO(345)
+# endif
+# if BOOST_PP_LOCAL_R(344)
+    BOOST_PP_LOCAL_MACRO(344)
+# endif
+# if BOOST_PP_LOCAL_R(343)
+    BOOST_PP_LOCAL_MACRO(343)
+# endif
+# if BOOST_PP_LOCAL_R(342)
+    BOOST_PP_LOCAL_MACRO(342)
+# endif
+# if BOOST_PP_LOCAL_R(341)
+    BOOST_PP_LOCAL_MACRO(341)
+# endif
+# if BOOST_PP_LOCAL_R(340)
+    BOOST_PP_LOCAL_MACRO(340)
+# endif
+# if BOOST_PP_LOCAL_R(339)
+    BOOST_PP_LOCAL_MACRO(339)
+# endif
+# if BOOST_PP_LOCAL_R(338)
+    BOOST_PP_LOCAL_MACRO(338)
+# endif
+# if BOOST_PP_LOCAL_R(337)
+    BOOST_PP_LOCAL_MACRO(337)
+# endif
+# if BOOST_PP_LOCAL_R(336)
+    BOOST_PP_LOCAL_MACRO(336)
+# endif
+# if BOOST_PP_LOCAL_R(335)
+    BOOST_PP_LOCAL_MACRO(335)
+# endif
+# if BOOST_PP_LOCAL_R(334)
+    BOOST_PP_LOCAL_MACRO(334)
+# endif
+# if BOOST_PP_LOCAL_R(333)
+    BOOST_PP_LOCAL_MACRO(333)
+# endif
+# if BOOST_PP_LOCAL_R(332)
+    BOOST_PP_LOCAL_MACRO(332)
+# endif
+# if BOOST_PP_LOCAL_R(331)
+    BOOST_PP_LOCAL_MACRO(331)
+# endif
+# if BOOST_PP_LOCAL_R(330)
+    BOOST_PP_LOCAL_MACRO(330)
+# endif
+# if BOOST_PP_LOCAL_R(329)
+    BOOST_PP_LOCAL_MACRO(329)
+# endif
+# if BOOST_PP_LOCAL_R(328)
+    BOOST_PP_LOCAL_MACRO(328)
+# endif
+# if BOOST_PP_LOCAL_R(327)
+    BOOST_PP_LOCAL_MACRO(327)
+# endif
+# if BOOST_PP_LOCAL_R(326)
+    BOOST_PP_LOCAL_MACRO(326)
+# endif
+# if BOOST_PP_LOCAL_R(325)
+    BOOST_PP_LOCAL_MACRO(325)
+# endif
+# if BOOST_PP_LOCAL_R(324)
+    BOOST_PP_LOCAL_MACRO(324)
+# endif
+# if BOOST_PP_LOCAL_R(323)
+    BOOST_PP_LOCAL_MACRO(323)
+# endif
+# if BOOST_PP_LOCAL_R(322)
+    BOOST_PP_LOCAL_MACRO(322)
+# endif
+# if BOOST_PP_LOCAL_R(321)
+    BOOST_PP_LOCAL_MACRO(321)
+# endif
+# if BOOST_PP_LOCAL_R(320)
+    BOOST_PP_LOCAL_MACRO(320)
+# endif
+# if BOOST_PP_LOCAL_R(319)
+    BOOST_PP_LOCAL_MACRO(319)
+# endif
+# if BOOST_PP_LOCAL_R(318)
+    BOOST_PP_LOCAL_MACRO(318)
+# endif
+# if BOOST_PP_LOCAL_R(317)
+    BOOST_PP_LOCAL_MACRO(317)
+# endif
+# if BOOST_PP_LOCAL_R(316)
+    BOOST_PP_LOCAL_MACRO(316)
+# endif
+# if BOOST_PP_LOCAL_R(315)
+    BOOST_PP_LOCAL_MACRO(315)
+# endif
+# if BOOST_PP_LOCAL_R(314)
+    BOOST_PP_LOCAL_MACRO(314)
+# endif
+# if BOOST_PP_LOCAL_R(313)
+    BOOST_PP_LOCAL_MACRO(313)
+# endif
+# if BOOST_PP_LOCAL_R(312)
+    BOOST_PP_LOCAL_MACRO(312)
+# endif
+# if BOOST_PP_LOCAL_R(311)
+    BOOST_PP_LOCAL_MACRO(311)
+# endif
+# if BOOST_PP_LOCAL_R(310)
+    BOOST_PP_LOCAL_MACRO(310)
+# endif
+# if BOOST_PP_LOCAL_R(309)
+    BOOST_PP_LOCAL_MACRO(309)
+# endif
+# if BOOST_PP_LOCAL_R(308)
+    BOOST_PP_LOCAL_MACRO(308)
+# endif
+# if BOOST_PP_LOCAL_R(307)
+    BOOST_PP_LOCAL_MACRO(307)
+# endif
+# if BOOST_PP_LOCAL_R(306)
+    BOOST_PP_LOCAL_MACRO(306)
+# endif
+# if BOOST_PP_LOCAL_R(305)
+    BOOST_PP_LOCAL_MACRO(305)
+# endif
+# if BOOST_PP_LOCAL_R(304)
+    BOOST_PP_LOCAL_MACRO(304)
+# endif
+# if BOOST_PP_LOCAL_R(303)
+    BOOST_PP_LOCAL_MACRO(303)
+# endif
+# if BOOST_PP_LOCAL_R(302)
+    BOOST_PP_LOCAL_MACRO(302)
+# endif
+# if BOOST_PP_LOCAL_R(301)
+    BOOST_PP_LOCAL_MACRO(301)
+# endif
+# if BOOST_PP_LOCAL_R(300)
+    BOOST_PP_LOCAL_MACRO(300)
+# endif
+# if BOOST_PP_LOCAL_R(299)
+    BOOST_PP_LOCAL_MACRO(299)
+# endif
+# if BOOST_PP_LOCAL_R(298)
+    BOOST_PP_LOCAL_MACRO(298)
+# endif
+# if BOOST_PP_LOCAL_R(297)
+    BOOST_PP_LOCAL_MACRO(297)
+# endif
+# if BOOST_PP_LOCAL_R(296)
+    BOOST_PP_LOCAL_MACRO(296)
+# endif
+# if BOOST_PP_LOCAL_R(295)
+    BOOST_PP_LOCAL_MACRO(295)
+# endif
+# if BOOST_PP_LOCAL_R(294)
+    BOOST_PP_LOCAL_MACRO(294)
+# endif
+# if BOOST_PP_LOCAL_R(293)
+    BOOST_PP_LOCAL_MACRO(293)
+# endif
+# if BOOST_PP_LOCAL_R(292)
+    BOOST_PP_LOCAL_MACRO(292)
+# endif
+# if BOOST_PP_LOCAL_R(291)
+    BOOST_PP_LOCAL_MACRO(291)
+# endif
+# if BOOST_PP_LOCAL_R(290)
+    BOOST_PP_LOCAL_MACRO(290)
+# endif
+# if BOOST_PP_LOCAL_R(289)
+    BOOST_PP_LOCAL_MACRO(289)
+# endif
+# if BOOST_PP_LOCAL_R(288)
+    BOOST_PP_LOCAL_MACRO(288)
+# endif
+# if BOOST_PP_LOCAL_R(287)
+    BOOST_PP_LOCAL_MACRO(287)
+# endif
+# if BOOST_PP_LOCAL_R(286)
+    BOOST_PP_LOCAL_MACRO(286)
+# endif
+# if BOOST_PP_LOCAL_R(285)
+    BOOST_PP_LOCAL_MACRO(285)
+# endif
+# if BOOST_PP_LOCAL_R(284)
+    BOOST_PP_LOCAL_MACRO(284)
+# endif
+# if BOOST_PP_LOCAL_R(283)
+    BOOST_PP_LOCAL_MACRO(283)
+# endif
+# if BOOST_PP_LOCAL_R(282)
+    BOOST_PP_LOCAL_MACRO(282)
+# endif
+# if BOOST_PP_LOCAL_R(281)
+    BOOST_PP_LOCAL_MACRO(281)
+# endif
+# if BOOST_PP_LOCAL_R(280)
+    BOOST_PP_LOCAL_MACRO(280)
+# endif
+# if BOOST_PP_LOCAL_R(279)
+    BOOST_PP_LOCAL_MACRO(279)
+# endif
+# if BOOST_PP_LOCAL_R(278)
+    BOOST_PP_LOCAL_MACRO(278)
+# endif
+# if BOOST_PP_LOCAL_R(277)
+    BOOST_PP_LOCAL_MACRO(277)
+# endif
+# if BOOST_PP_LOCAL_R(276)
+    BOOST_PP_LOCAL_MACRO(276)
+# endif
+# if BOOST_PP_LOCAL_R(275)
+    BOOST_PP_LOCAL_MACRO(275)
+# endif
+# if BOOST_PP_LOCAL_R(274)
+    BOOST_PP_LOCAL_MACRO(274)
+# endif
+# if BOOST_PP_LOCAL_R(273)
+    BOOST_PP_LOCAL_MACRO(273)
+# endif
+# if BOOST_PP_LOCAL_R(272)
+    BOOST_PP_LOCAL_MACRO(272)
+# endif
+# if BOOST_PP_LOCAL_R(271)
+    BOOST_PP_LOCAL_MACRO(271)
+# endif
+# if BOOST_PP_LOCAL_R(270)
+    BOOST_PP_LOCAL_MACRO(270)
+# endif
+# if BOOST_PP_LOCAL_R(269)
+    BOOST_PP_LOCAL_MACRO(269)
+# endif
+# if BOOST_PP_LOCAL_R(268)
+    BOOST_PP_LOCAL_MACRO(268)
+# endif
+# if BOOST_PP_LOCAL_R(267)
+    BOOST_PP_LOCAL_MACRO(267)
+# endif
+# if BOOST_PP_LOCAL_R(266)
+    BOOST_PP_LOCAL_MACRO(266)
+# endif
+# if BOOST_PP_LOCAL_R(265)
+    BOOST_PP_LOCAL_MACRO(265)
+# endif
+# if BOOST_PP_LOCAL_R(264)
+    BOOST_PP_LOCAL_MACRO(264)
+# endif
+# if BOOST_PP_LOCAL_R(263)
+    BOOST_PP_LOCAL_MACRO(263)
+# endif
+# if BOOST_PP_LOCAL_R(262)
+    BOOST_PP_LOCAL_MACRO(262)
+# endif
+# if BOOST_PP_LOCAL_R(261)
+    BOOST_PP_LOCAL_MACRO(261)
+# endif
+# if BOOST_PP_LOCAL_R(260)
+    BOOST_PP_LOCAL_MACRO(260)
+# endif
+# if BOOST_PP_LOCAL_R(259)
+    BOOST_PP_LOCAL_MACRO(259)
+# endif
+# if BOOST_PP_LOCAL_R(258)
+    BOOST_PP_LOCAL_MACRO(258)
+# endif
+# if BOOST_PP_LOCAL_R(257)
+    BOOST_PP_LOCAL_MACRO(257)
+# endif
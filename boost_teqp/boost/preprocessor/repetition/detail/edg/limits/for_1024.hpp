@@ -0,0 +1,1044 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002) */
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_REPETITION_DETAIL_EDG_FOR_1024_HPP
+# define BOOST_PREPROCESSOR_REPETITION_DETAIL_EDG_FOR_1024_HPP
+#
+# define BOOST_PP_FOR_513(s, p, o, m) BOOST_PP_FOR_513_I(s, p, o, m)
+# define BOOST_PP_FOR_514(s, p, o, m) BOOST_PP_FOR_514_I(s, p, o, m)
+# define BOOST_PP_FOR_515(s, p, o, m) BOOST_PP_FOR_515_I(s, p, o, m)
+# define BOOST_PP_FOR_516(s, p, o, m) BOOST_PP_FOR_516_I(s, p, o, m)
+# define BOOST_PP_FOR_517(s, p, o, m) BOOST_PP_FOR_517_I(s, p, o, m)
+# define BOOST_PP_FOR_518(s, p, o, m) BOOST_PP_FOR_518_I(s, p, o, m)
+# define BOOST_PP_FOR_519(s, p, o, m) BOOST_PP_FOR_519_I(s, p, o, m)
+# define BOOST_PP_FOR_520(s, p, o, m) BOOST_PP_FOR_520_I(s, p, o, m)
+# define BOOST_PP_FOR_521(s, p, o, m) BOOST_PP_FOR_521_I(s, p, o, m)
+# define BOOST_PP_FOR_522(s, p, o, m) BOOST_PP_FOR_522_I(s, p, o, m)
+# define BOOST_PP_FOR_523(s, p, o, m) BOOST_PP_FOR_523_I(s, p, o, m)
+# define BOOST_PP_FOR_524(s, p, o, m) BOOST_PP_FOR_524_I(s, p, o, m)
+# define BOOST_PP_FOR_525(s, p, o, m) BOOST_PP_FOR_525_I(s, p, o, m)
+# define BOOST_PP_FOR_526(s, p, o, m) BOOST_PP_FOR_526_I(s, p, o, m)
+# define BOOST_PP_FOR_527(s, p, o, m) BOOST_PP_FOR_527_I(s, p, o, m)
+# define BOOST_PP_FOR_528(s, p, o, m) BOOST_PP_FOR_528_I(s, p, o, m)
+# define BOOST_PP_FOR_529(s, p, o, m) BOOST_PP_FOR_529_I(s, p, o, m)
+# define BOOST_PP_FOR_530(s, p, o, m) BOOST_PP_FOR_530_I(s, p, o, m)
+# define BOOST_PP_FOR_531(s, p, o, m) BOOST_PP_FOR_531_I(s, p, o, m)
+# define BOOST_PP_FOR_532(s, p, o, m) BOOST_PP_FOR_532_I(s, p, o, m)
+# define BOOST_PP_FOR_533(s, p, o, m) BOOST_PP_FOR_533_I(s, p, o, m)
+# define BOOST_PP_FOR_534(s, p, o, m) BOOST_PP_FOR_534_I(s, p, o, m)
+# define BOOST_PP_FOR_535(s, p, o, m) BOOST_PP_FOR_535_I(s, p, o, m)
+# define BOOST_PP_FOR_536(s, p, o, m) BOOST_PP_FOR_536_I(s, p, o, m)
+# define BOOST_PP_FOR_537(s, p, o, m) BOOST_PP_FOR_537_I(s, p, o, m)
+# define BOOST_PP_FOR_538(s, p, o, m) BOOST_PP_FOR_538_I(s, p, o, m)
+# define BOOST_PP_FOR_539(s, p, o, m) BOOST_PP_FOR_539_I(s, p, o, m)
+# define BOOST_PP_FOR_540(s, p, o, m) BOOST_PP_FOR_540_I(s, p, o, m)
+# define BOOST_PP_FOR_541(s, p, o, m) BOOST_PP_FOR_541_I(s, p, o, m)
+# define BOOST_PP_FOR_542(s, p, o, m) BOOST_PP_FOR_542_I(s, p, o, m)
+# define BOOST_PP_FOR_543(s, p, o, m) BOOST_PP_FOR_543_I(s, p, o, m)
+# define BOOST_PP_FOR_544(s, p, o, m) BOOST_PP_FOR_544_I(s, p, o, m)
+# define BOOST_PP_FOR_545(s, p, o, m) BOOST_PP_FOR_545_I(s, p, o, m)
+# define BOOST_PP_FOR_546(s, p, o, m) BOOST_PP_FOR_546_I(s, p, o, m)
+# define BOOST_PP_FOR_547(s, p, o, m) BOOST_PP_FOR_547_I(s, p, o, m)
+# define BOOST_PP_FOR_548(s, p, o, m) BOOST_PP_FOR_548_I(s, p, o, m)
+# define BOOST_PP_FOR_549(s, p, o, m) BOOST_PP_FOR_549_I(s, p, o, m)
+# define BOOST_PP_FOR_550(s, p, o, m) BOOST_PP_FOR_550_I(s, p, o, m)
+# define BOOST_PP_FOR_551(s, p, o, m) BOOST_PP_FOR_551_I(s, p, o, m)
+# define BOOST_PP_FOR_552(s, p, o, m) BOOST_PP_FOR_552_I(s, p, o, m)
+# define BOOST_PP_FOR_553(s, p, o, m) BOOST_PP_FOR_553_I(s, p, o, m)
+# define BOOST_PP_FOR_554(s, p, o, m) BOOST_PP_FOR_554_I(s, p, o, m)
+# define BOOST_PP_FOR_555(s, p, o, m) BOOST_PP_FOR_555_I(s, p, o, m)
+# define BOOST_PP_FOR_556(s, p, o, m) BOOST_PP_FOR_556_I(s, p, o, m)
+# define BOOST_PP_FOR_557(s, p, o, m) BOOST_PP_FOR_557_I(s, p, o, m)
+# define BOOST_PP_FOR_558(s, p, o, m) BOOST_PP_FOR_558_I(s, p, o, m)
+# define BOOST_PP_FOR_559(s, p, o, m) BOOST_PP_FOR_559_I(s, p, o, m)
+# define BOOST_PP_FOR_560(s, p, o, m) BOOST_PP_FOR_560_I(s, p, o, m)
+# define BOOST_PP_FOR_561(s, p, o, m) BOOST_PP_FOR_561_I(s, p, o, m)
+# define BOOST_PP_FOR_562(s, p, o, m) BOOST_PP_FOR_562_I(s, p, o, m)
+# define BOOST_PP_FOR_563(s, p, o, m) BOOST_PP_FOR_563_I(s, p, o, m)
+# define BOOST_PP_FOR_564(s, p, o, m) BOOST_PP_FOR_564_I(s, p, o, m)
+# define BOOST_PP_FOR_565(s, p, o, m) BOOST_PP_FOR_565_I(s, p, o, m)
+# define BOOST_PP_FOR_566(s, p, o, m) BOOST_PP_FOR_566_I(s, p, o, m)
+# define BOOST_PP_FOR_567(s, p, o, m) BOOST_PP_FOR_567_I(s, p, o, m)
+# define BOOST_PP_FOR_568(s, p, o, m) BOOST_PP_FOR_568_I(s, p, o, m)
+# define BOOST_PP_FOR_569(s, p, o, m) BOOST_PP_FOR_569_I(s, p, o, m)
+# define BOOST_PP_FOR_570(s, p, o, m) BOOST_PP_FOR_570_I(s, p, o, m)
+# define BOOST_PP_FOR_571(s, p, o, m) BOOST_PP_FOR_571_I(s, p, o, m)
+# define BOOST_PP_FOR_572(s, p, o, m) BOOST_PP_FOR_572_I(s, p, o, m)
+# define BOOST_PP_FOR_573(s, p, o, m) BOOST_PP_FOR_573_I(s, p, o, m)
+# define BOOST_PP_FOR_574(s, p, o, m) BOOST_PP_FOR_574_I(s, p, o, m)
+# define BOOST_PP_FOR_575(s, p, o, m) BOOST_PP_FOR_575_I(s, p, o, m)
+# define BOOST_PP_FOR_576(s, p, o, m) BOOST_PP_FOR_576_I(s, p, o, m)
+# define BOOST_PP_FOR_577(s, p, o, m) BOOST_PP_FOR_577_I(s, p, o, m)
+# define BOOST_PP_FOR_578(s, p, o, m) BOOST_PP_FOR_578_I(s, p, o, m)
+# define BOOST_PP_FOR_579(s, p, o, m) BOOST_PP_FOR_579_I(s, p, o, m)
+# define BOOST_PP_FOR_580(s, p, o, m) BOOST_PP_FOR_580_I(s, p, o, m)
+# define BOOST_PP_FOR_581(s, p, o, m) BOOST_PP_FOR_581_I(s, p, o, m)
+# define BOOST_PP_FOR_582(s, p, o, m) BOOST_PP_FOR_582_I(s, p, o, m)
+# define BOOST_PP_FOR_583(s, p, o, m) BOOST_PP_FOR_583_I(s, p, o, m)
+# define BOOST_PP_FOR_584(s, p, o, m) BOOST_PP_FOR_584_I(s, p, o, m)
+# define BOOST_PP_FOR_585(s, p, o, m) BOOST_PP_FOR_585_I(s, p, o, m)
+# define BOOST_PP_FOR_586(s, p, o, m) BOOST_PP_FOR_586_I(s, p, o, m)
+# define BOOST_PP_FOR_587(s, p, o, m) BOOST_PP_FOR_587_I(s, p, o, m)
+# define BOOST_PP_FOR_588(s, p, o, m) BOOST_PP_FOR_588_I(s, p, o, m)
+# define BOOST_PP_FOR_589(s, p, o, m) BOOST_PP_FOR_589_I(s, p, o, m)
+# define BOOST_PP_FOR_590(s, p, o, m) BOOST_PP_FOR_590_I(s, p, o, m)
+# define BOOST_PP_FOR_591(s, p, o, m) BOOST_PP_FOR_591_I(s, p, o, m)
+# define BOOST_PP_FOR_592(s, p, o, m) BOOST_PP_FOR_592_I(s, p, o, m)
+# define BOOST_PP_FOR_593(s, p, o, m) BOOST_PP_FOR_593_I(s, p, o, m)
+# define BOOST_PP_FOR_594(s, p, o, m) BOOST_PP_FOR_594_I(s, p, o, m)
+# define BOOST_PP_FOR_595(s, p, o, m) BOOST_PP_FOR_595_I(s, p, o, m)
+# define BOOST_PP_FOR_596(s, p, o, m) BOOST_PP_FOR_596_I(s, p, o, m)
+# define BOOST_PP_FOR_597(s, p, o, m) BOOST_PP_FOR_597_I(s, p, o, m)
+# define BOOST_PP_FOR_598(s, p, o, m) BOOST_PP_FOR_598_I(s, p, o, m)
+# define BOOST_PP_FOR_599(s, p, o, m) BOOST_PP_FOR_599_I(s, p, o, m)
+# define BOOST_PP_FOR_600(s, p, o, m) BOOST_PP_FOR_600_I(s, p, o, m)
+# define BOOST_PP_FOR_601(s, p, o, m) BOOST_PP_FOR_601_I(s, p, o, m)
+# define BOOST_PP_FOR_602(s, p, o, m) BOOST_PP_FOR_602_I(s, p, o, m)
+# define BOOST_PP_FOR_603(s, p, o, m) BOOST_PP_FOR_603_I(s, p, o, m)
+# define BOOST_PP_FOR_604(s, p, o, m) BOOST_PP_FOR_604_I(s, p, o, m)
+# define BOOST_PP_FOR_605(s, p, o, m) BOOST_PP_FOR_605_I(s, p, o, m)
+# define BOOST_PP_FOR_606(s, p, o, m) BOOST_PP_FOR_606_I(s, p, o, m)
+# define BOOST_PP_FOR_607(s, p, o, m) BOOST_PP_FOR_607_I(s, p, o, m)
+# define BOOST_PP_FOR_608(s, p, o, m) BOOST_PP_FOR_608_I(s, p, o, m)
+# define BOOST_PP_FOR_609(s, p, o, m) BOOST_PP_FOR_609_I(s, p, o, m)
+# define BOOST_PP_FOR_610(s, p, o, m) BOOST_PP_FOR_610_I(s, p, o, m)
+# define BOOST_PP_FOR_611(s, p, o, m) BOOST_PP_FOR_611_I(s, p, o, m)
+# define BOOST_PP_FOR_612(s, p, o, m) BOOST_PP_FOR_612_I(s, p, o, m)
+# define BOOST_PP_FOR_613(s, p, o, m) BOOST_PP_FOR_613_I(s, p, o, m)
+# define BOOST_PP_FOR_614(s, p, o, m) BOOST_PP_FOR_614_I(s, p, o, m)
+# define BOOST_PP_FOR_615(s, p, o, m) BOOST_PP_FOR_615_I(s, p, o, m)
+# define BOOST_PP_FOR_616(s, p, o, m) BOOST_PP_FOR_616_I(s, p, o, m)
+# define BOOST_PP_FOR_617(s, p, o, m) BOOST_PP_FOR_617_I(s, p, o, m)
+# define BOOST_PP_FOR_618(s, p, o, m) BOOST_PP_FOR_618_I(s, p, o, m)
+# define BOOST_PP_FOR_619(s, p, o, m) BOOST_PP_FOR_619_I(s, p, o, m)
+# define BOOST_PP_FOR_620(s, p, o, m) BOOST_PP_FOR_620_I(s, p, o, m)
+# define BOOST_PP_FOR_621(s, p, o, m) BOOST_PP_FOR_621_I(s, p, o, m)
+# define BOOST_PP_FOR_622(s, p, o, m) BOOST_PP_FOR_622_I(s, p, o, m)
+# define BOOST_PP_FOR_623(s, p, o, m) BOOST_PP_FOR_623_I(s, p, o, m)
+# define BOOST_PP_FOR_624(s, p, o, m) BOOST_PP_FOR_624_I(s, p, o, m)
+# define BOOST_PP_FOR_625(s, p, o, m) BOOST_PP_FOR_625_I(s, p, o, m)
+# define BOOST_PP_FOR_626(s, p, o, m) BOOST_PP_FOR_626_I(s, p, o, m)
+# define BOOST_PP_FOR_627(s, p, o, m) BOOST_PP_FOR_627_I(s, p, o, m)
+# define BOOST_PP_FOR_628(s, p, o, m) BOOST_PP_FOR_628_I(s, p, o, m)
+# define BOOST_PP_FOR_629(s, p, o, m) BOOST_PP_FOR_629_I(s, p, o, m)
+# define BOOST_PP_FOR_630(s, p, o, m) BOOST_PP_FOR_630_I(s, p, o, m)
+# define BOOST_PP_FOR_631(s, p, o, m) BOOST_PP_FOR_631_I(s, p, o, m)
+# define BOOST_PP_FOR_632(s, p, o, m) BOOST_PP_FOR_632_I(s, p, o, m)
+# define BOOST_PP_FOR_633(s, p, o, m) BOOST_PP_FOR_633_I(s, p, o, m)
+# define BOOST_PP_FOR_634(s, p, o, m) BOOST_PP_FOR_634_I(s, p, o, m)
+# define BOOST_PP_FOR_635(s, p, o, m) BOOST_PP_FOR_635_I(s, p, o, m)
+# define BOOST_PP_FOR_636(s, p, o, m) BOOST_PP_FOR_636_I(s, p, o, m)
+# define BOOST_PP_FOR_637(s, p, o, m) BOOST_PP_FOR_637_I(s, p, o, m)
+# define BOOST_PP_FOR_638(s, p, o, m) BOOST_PP_FOR_638_I(s, p, o, m)
+# define BOOST_PP_FOR_639(s, p, o, m) BOOST_PP_FOR_639_I(s, p, o, m)
+# define BOOST_PP_FOR_640(s, p, o, m) BOOST_PP_FOR_640_I(s, p, o, m)
+# define BOOST_PP_FOR_641(s, p, o, m) BOOST_PP_FOR_641_I(s, p, o, m)
+# define BOOST_PP_FOR_642(s, p, o, m) BOOST_PP_FOR_642_I(s, p, o, m)
+# define BOOST_PP_FOR_643(s, p, o, m) BOOST_PP_FOR_643_I(s, p, o, m)
+# define BOOST_PP_FOR_644(s, p, o, m) BOOST_PP_FOR_644_I(s, p, o, m)
+# define BOOST_PP_FOR_645(s, p, o, m) BOOST_PP_FOR_645_I(s, p, o, m)
+# define BOOST_PP_FOR_646(s, p, o, m) BOOST_PP_FOR_646_I(s, p, o, m)
+# define BOOST_PP_FOR_647(s, p, o, m) BOOST_PP_FOR_647_I(s, p, o, m)
+# define BOOST_PP_FOR_648(s, p, o, m) BOOST_PP_FOR_648_I(s, p, o, m)
+# define BOOST_PP_FOR_649(s, p, o, m) BOOST_PP_FOR_649_I(s, p, o, m)
+# define BOOST_PP_FOR_650(s, p, o, m) BOOST_PP_FOR_650_I(s, p, o, m)
+# define BOOST_PP_FOR_651(s, p, o, m) BOOST_PP_FOR_651_I(s, p, o, m)
+# define BOOST_PP_FOR_652(s, p, o, m) BOOST_PP_FOR_652_I(s, p, o, m)
+# define BOOST_PP_FOR_653(s, p, o, m) BOOST_PP_FOR_653_I(s, p, o, m)
+# define BOOST_PP_FOR_654(s, p, o, m) BOOST_PP_FOR_654_I(s, p, o, m)
+# define BOOST_PP_FOR_655(s, p, o, m) BOOST_PP_FOR_655_I(s, p, o, m)
+# define BOOST_PP_FOR_656(s, p, o, m) BOOST_PP_FOR_656_I(s, p, o, m)
+# define BOOST_PP_FOR_657(s, p, o, m) BOOST_PP_FOR_657_I(s, p, o, m)
+# define BOOST_PP_FOR_658(s, p, o, m) BOOST_PP_FOR_658_I(s, p, o, m)
+# define BOOST_PP_FOR_659(s, p, o, m) BOOST_PP_FOR_659_I(s, p, o, m)
+# define BOOST_PP_FOR_660(s, p, o, m) BOOST_PP_FOR_660_I(s, p, o, m)
+# define BOOST_PP_FOR_661(s, p, o, m) BOOST_PP_FOR_661_I(s, p, o, m)
+# define BOOST_PP_FOR_662(s, p, o, m) BOOST_PP_FOR_662_I(s, p, o, m)
+# define BOOST_PP_FOR_663(s, p, o, m) BOOST_PP_FOR_663_I(s, p, o, m)
+# define BOOST_PP_FOR_664(s, p, o, m) BOOST_PP_FOR_664_I(s, p, o, m)
+# define BOOST_PP_FOR_665(s, p, o, m) BOOST_PP_FOR_665_I(s, p, o, m)
+# define BOOST_PP_FOR_666(s, p, o, m) BOOST_PP_FOR_666_I(s, p, o, m)
+# define BOOST_PP_FOR_667(s, p, o, m) BOOST_PP_FOR_667_I(s, p, o, m)
+# define BOOST_PP_FOR_668(s, p, o, m) BOOST_PP_FOR_668_I(s, p, o, m)
+# define BOOST_PP_FOR_669(s, p, o, m) BOOST_PP_FOR_669_I(s, p, o, m)
+# define BOOST_PP_FOR_670(s, p, o, m) BOOST_PP_FOR_670_I(s, p, o, m)
+# define BOOST_PP_FOR_671(s, p, o, m) BOOST_PP_FOR_671_I(s, p, o, m)
+# define BOOST_PP_FOR_672(s, p, o, m) BOOST_PP_FOR_672_I(s, p, o, m)
+# define BOOST_PP_FOR_673(s, p, o, m) BOOST_PP_FOR_673_I(s, p, o, m)
+# define BOOST_PP_FOR_674(s, p, o, m) BOOST_PP_FOR_674_I(s, p, o, m)
+# define BOOST_PP_FOR_675(s, p, o, m) BOOST_PP_FOR_675_I(s, p, o, m)
+# define BOOST_PP_FOR_676(s, p, o, m) BOOST_PP_FOR_676_I(s, p, o, m)
+# define BOOST_PP_FOR_677(s, p, o, m) BOOST_PP_FOR_677_I(s, p, o, m)
+# define BOOST_PP_FOR_678(s, p, o, m) BOOST_PP_FOR_678_I(s, p, o, m)
+# define BOOST_PP_FOR_679(s, p, o, m) BOOST_PP_FOR_679_I(s, p, o, m)
+# define BOOST_PP_FOR_680(s, p, o, m) BOOST_PP_FOR_680_I(s, p, o, m)
+# define BOOST_PP_FOR_681(s, p, o, m) BOOST_PP_FOR_681_I(s, p, o, m)
+# define BOOST_PP_FOR_682(s, p, o, m) BOOST_PP_FOR_682_I(s, p, o, m)
+# define BOOST_PP_FOR_683(s, p, o, m) BOOST_PP_FOR_683_I(s, p, o, m)
+# define BOOST_PP_FOR_684(s, p, o, m) BOOST_PP_FOR_684_I(s, p, o, m)
+# define BOOST_PP_FOR_685(s, p, o, m) BOOST_PP_FOR_685_I(s, p, o, m)
+# define BOOST_PP_FOR_686(s, p, o, m) BOOST_PP_FOR_686_I(s, p, o, m)
+# define BOOST_PP_FOR_687(s, p, o, m) BOOST_PP_FOR_687_I(s, p, o, m)
+# define BOOST_PP_FOR_688(s, p, o, m) BOOST_PP_FOR_688_I(s, p, o, m)
+# define BOOST_PP_FOR_689(s, p, o, m) BOOST_PP_FOR_689_I(s, p, o, m)
+# define BOOST_PP_FOR_690(s, p, o, m) BOOST_PP_FOR_690_I(s, p, o, m)
+# define BOOST_PP_FOR_691(s, p, o, m) BOOST_PP_FOR_691_I(s, p, o, m)
+# define BOOST_PP_FOR_692(s, p, o, m) BOOST_PP_FOR_692_I(s, p, o, m)
+# define BOOST_PP_FOR_693(s, p, o, m) BOOST_PP_FOR_693_I(s, p, o, m)
+# define BOOST_PP_FOR_694(s, p, o, m) BOOST_PP_FOR_694_I(s, p, o, m)
+# define BOOST_PP_FOR_695(s, p, o, m) BOOST_PP_FOR_695_I(s, p, o, m)
+# define BOOST_PP_FOR_696(s, p, o, m) BOOST_PP_FOR_696_I(s, p, o, m)
+# define BOOST_PP_FOR_697(s, p, o, m) BOOST_PP_FOR_697_I(s, p, o, m)
+# define BOOST_PP_FOR_698(s, p, o, m) BOOST_PP_FOR_698_I(s, p, o, m)
+# define BOOST_PP_FOR_699(s, p, o, m) BOOST_PP_FOR_699_I(s, p, o, m)
+# define BOOST_PP_FOR_700(s, p, o, m) BOOST_PP_FOR_700_I(s, p, o, m)
+# define BOOST_PP_FOR_701(s, p, o, m) BOOST_PP_FOR_701_I(s, p, o, m)
+# define BOOST_PP_FOR_702(s, p, o, m) BOOST_PP_FOR_702_I(s, p, o, m)
+# define BOOST_PP_FOR_703(s, p, o, m) BOOST_PP_FOR_703_I(s, p, o, m)
+# define BOOST_PP_FOR_704(s, p, o, m) BOOST_PP_FOR_704_I(s, p, o, m)
+# define BOOST_PP_FOR_705(s, p, o, m) BOOST_PP_FOR_705_I(s, p, o, m)
+# define BOOST_PP_FOR_706(s, p, o, m) BOOST_PP_FOR_706_I(s, p, o, m)
+# define BOOST_PP_FOR_707(s, p, o, m) BOOST_PP_FOR_707_I(s, p, o, m)
+# define BOOST_PP_FOR_708(s, p, o, m) BOOST_PP_FOR_708_I(s, p, o, m)
+# define BOOST_PP_FOR_709(s, p, o, m) BOOST_PP_FOR_709_I(s, p, o, m)
+# define BOOST_PP_FOR_710(s, p, o, m) BOOST_PP_FOR_710_I(s, p, o, m)
+# define BOOST_PP_FOR_711(s, p, o, m) BOOST_PP_FOR_711_I(s, p, o, m)
+# define BOOST_PP_FOR_712(s, p, o, m) BOOST_PP_FOR_712_I(s, p, o, m)
+# define BOOST_PP_FOR_713(s, p, o, m) BOOST_PP_FOR_713_I(s, p, o, m)
+# define BOOST_PP_FOR_714(s, p, o, m) BOOST_PP_FOR_714_I(s, p, o, m)
+# define BOOST_PP_FOR_715(s, p, o, m) BOOST_PP_FOR_715_I(s, p, o, m)
+# define BOOST_PP_FOR_716(s, p, o, m) BOOST_PP_FOR_716_I(s, p, o, m)
+# define BOOST_PP_FOR_717(s, p, o, m) BOOST_PP_FOR_717_I(s, p, o, m)
+# define BOOST_PP_FOR_718(s, p, o, m) BOOST_PP_FOR_718_I(s, p, o, m)
+# define BOOST_PP_FOR_719(s, p, o, m) BOOST_PP_FOR_719_I(s, p, o, m)
+# define BOOST_PP_FOR_720(s, p, o, m) BOOST_PP_FOR_720_I(s, p, o, m)
+# define BOOST_PP_FOR_721(s, p, o, m) BOOST_PP_FOR_721_I(s, p, o, m)
+# define BOOST_PP_FOR_722(s, p, o, m) BOOST_PP_FOR_722_I(s, p, o, m)
+# define BOOST_PP_FOR_723(s, p, o, m) BOOST_PP_FOR_723_I(s, p, o, m)
+# define BOOST_PP_FOR_724(s, p, o, m) BOOST_PP_FOR_724_I(s, p, o, m)
+# define BOOST_PP_FOR_725(s, p, o, m) BOOST_PP_FOR_725_I(s, p, o, m)
+# define BOOST_PP_FOR_726(s, p, o, m) BOOST_PP_FOR_726_I(s, p, o, m)
+# define BOOST_PP_FOR_727(s, p, o, m) BOOST_PP_FOR_727_I(s, p, o, m)
+# define BOOST_PP_FOR_728(s, p, o, m) BOOST_PP_FOR_728_I(s, p, o, m)
+# define BOOST_PP_FOR_729(s, p, o, m) BOOST_PP_FOR_729_I(s, p, o, m)
+# define BOOST_PP_FOR_730(s, p, o, m) BOOST_PP_FOR_730_I(s, p, o, m)
+# define BOOST_PP_FOR_731(s, p, o, m) BOOST_PP_FOR_731_I(s, p, o, m)
+# define BOOST_PP_FOR_732(s, p, o, m) BOOST_PP_FOR_732_I(s, p, o, m)
+# define BOOST_PP_FOR_733(s, p, o, m) BOOST_PP_FOR_733_I(s, p, o, m)
+# define BOOST_PP_FOR_734(s, p, o, m) BOOST_PP_FOR_734_I(s, p, o, m)
+# define BOOST_PP_FOR_735(s, p, o, m) BOOST_PP_FOR_735_I(s, p, o, m)
+# define BOOST_PP_FOR_736(s, p, o, m) BOOST_PP_FOR_736_I(s, p, o, m)
+# define BOOST_PP_FOR_737(s, p, o, m) BOOST_PP_FOR_737_I(s, p, o, m)
+# define BOOST_PP_FOR_738(s, p, o, m) BOOST_PP_FOR_738_I(s, p, o, m)
+# define BOOST_PP_FOR_739(s, p, o, m) BOOST_PP_FOR_739_I(s, p, o, m)
+# define BOOST_PP_FOR_740(s, p, o, m) BOOST_PP_FOR_740_I(s, p, o, m)
+# define BOOST_PP_FOR_741(s, p, o, m) BOOST_PP_FOR_741_I(s, p, o, m)
+# define BOOST_PP_FOR_742(s, p, o, m) BOOST_PP_FOR_742_I(s, p, o, m)
+# define BOOST_PP_FOR_743(s, p, o, m) BOOST_PP_FOR_743_I(s, p, o, m)
+# define BOOST_PP_FOR_744(s, p, o, m) BOOST_PP_FOR_744_I(s, p, o, m)
+# define BOOST_PP_FOR_745(s, p, o, m) BOOST_PP_FOR_745_I(s, p, o, m)
+# define BOOST_PP_FOR_746(s, p, o, m) BOOST_PP_FOR_746_I(s, p, o, m)
+# define BOOST_PP_FOR_747(s, p, o, m) BOOST_PP_FOR_747_I(s, p, o, m)
+# define BOOST_PP_FOR_748(s, p, o, m) BOOST_PP_FOR_748_I(s, p, o, m)
+# define BOOST_PP_FOR_749(s, p, o, m) BOOST_PP_FOR_749_I(s, p, o, m)
+# define BOOST_PP_FOR_750(s, p, o, m) BOOST_PP_FOR_750_I(s, p, o, m)
+# define BOOST_PP_FOR_751(s, p, o, m) BOOST_PP_FOR_751_I(s, p, o, m)
+# define BOOST_PP_FOR_752(s, p, o, m) BOOST_PP_FOR_752_I(s, p, o, m)
+# define BOOST_PP_FOR_753(s, p, o, m) BOOST_PP_FOR_753_I(s, p, o, m)
+# define BOOST_PP_FOR_754(s, p, o, m) BOOST_PP_FOR_754_I(s, p, o, m)
+# define BOOST_PP_FOR_755(s, p, o, m) BOOST_PP_FOR_755_I(s, p, o, m)
+# define BOOST_PP_FOR_756(s, p, o, m) BOOST_PP_FOR_756_I(s, p, o, m)
+# define BOOST_PP_FOR_757(s, p, o, m) BOOST_PP_FOR_757_I(s, p, o, m)
+# define BOOST_PP_FOR_758(s, p, o, m) BOOST_PP_FOR_758_I(s, p, o, m)
+# define BOOST_PP_FOR_759(s, p, o, m) BOOST_PP_FOR_759_I(s, p, o, m)
+# define BOOST_PP_FOR_760(s, p, o, m) BOOST_PP_FOR_760_I(s, p, o, m)
+# define BOOST_PP_FOR_761(s, p, o, m) BOOST_PP_FOR_761_I(s, p, o, m)
+# define BOOST_PP_FOR_762(s, p, o, m) BOOST_PP_FOR_762_I(s, p, o, m)
+# define BOOST_PP_FOR_763(s, p, o, m) BOOST_PP_FOR_763_I(s, p, o, m)
+# define BOOST_PP_FOR_764(s, p, o, m) BOOST_PP_FOR_764_I(s, p, o, m)
+# define BOOST_PP_FOR_765(s, p, o, m) BOOST_PP_FOR_765_I(s, p, o, m)
+# define BOOST_PP_FOR_766(s, p, o, m) BOOST_PP_FOR_766_I(s, p, o, m)
+# define BOOST_PP_FOR_767(s, p, o, m) BOOST_PP_FOR_767_I(s, p, o, m)
+# define BOOST_PP_FOR_768(s, p, o, m) BOOST_PP_FOR_768_I(s, p, o, m)
+# define BOOST_PP_FOR_769(s, p, o, m) BOOST_PP_FOR_769_I(s, p, o, m)
+# define BOOST_PP_FOR_770(s, p, o, m) BOOST_PP_FOR_770_I(s, p, o, m)
+# define BOOST_PP_FOR_771(s, p, o, m) BOOST_PP_FOR_771_I(s, p, o, m)
+# define BOOST_PP_FOR_772(s, p, o, m) BOOST_PP_FOR_772_I(s, p, o, m)
+# define BOOST_PP_FOR_773(s, p, o, m) BOOST_PP_FOR_773_I(s, p, o, m)
+# define BOOST_PP_FOR_774(s, p, o, m) BOOST_PP_FOR_774_I(s, p, o, m)
+# define BOOST_PP_FOR_775(s, p, o, m) BOOST_PP_FOR_775_I(s, p, o, m)
+# define BOOST_PP_FOR_776(s, p, o, m) BOOST_PP_FOR_776_I(s, p, o, m)
+# define BOOST_PP_FOR_777(s, p, o, m) BOOST_PP_FOR_777_I(s, p, o, m)
+# define BOOST_PP_FOR_778(s, p, o, m) BOOST_PP_FOR_778_I(s, p, o, m)
+# define BOOST_PP_FOR_779(s, p, o, m) BOOST_PP_FOR_779_I(s, p, o, m)
+# define BOOST_PP_FOR_780(s, p, o, m) BOOST_PP_FOR_780_I(s, p, o, m)
+# define BOOST_PP_FOR_781(s, p, o, m) BOOST_PP_FOR_781_I(s, p, o, m)
+# define BOOST_PP_FOR_782(s, p, o, m) BOOST_PP_FOR_782_I(s, p, o, m)
+# define BOOST_PP_FOR_783(s, p, o, m) BOOST_PP_FOR_783_I(s, p, o, m)
+# define BOOST_PP_FOR_784(s, p, o, m) BOOST_PP_FOR_784_I(s, p, o, m)
+# define BOOST_PP_FOR_785(s, p, o, m) BOOST_PP_FOR_785_I(s, p, o, m)
+# define BOOST_PP_FOR_786(s, p, o, m) BOOST_PP_FOR_786_I(s, p, o, m)
+# define BOOST_PP_FOR_787(s, p, o, m) BOOST_PP_FOR_787_I(s, p, o, m)
+# define BOOST_PP_FOR_788(s, p, o, m) BOOST_PP_FOR_788_I(s, p, o, m)
+# define BOOST_PP_FOR_789(s, p, o, m) BOOST_PP_FOR_789_I(s, p, o, m)
+# define BOOST_PP_FOR_790(s, p, o, m) BOOST_PP_FOR_790_I(s, p, o, m)
+# define BOOST_PP_FOR_791(s, p, o, m) BOOST_PP_FOR_791_I(s, p, o, m)
+# define BOOST_PP_FOR_792(s, p, o, m) BOOST_PP_FOR_792_I(s, p, o, m)
+# define BOOST_PP_FOR_793(s, p, o, m) BOOST_PP_FOR_793_I(s, p, o, m)
+# define BOOST_PP_FOR_794(s, p, o, m) BOOST_PP_FOR_794_I(s, p, o, m)
+# define BOOST_PP_FOR_795(s, p, o, m) BOOST_PP_FOR_795_I(s, p, o, m)
+# define BOOST_PP_FOR_796(s, p, o, m) BOOST_PP_FOR_796_I(s, p, o, m)
+# define BOOST_PP_FOR_797(s, p, o, m) BOOST_PP_FOR_797_I(s, p, o, m)
+# define BOOST_PP_FOR_798(s, p, o, m) BOOST_PP_FOR_798_I(s, p, o, m)
+# define BOOST_PP_FOR_799(s, p, o, m) BOOST_PP_FOR_799_I(s, p, o, m)
+# define BOOST_PP_FOR_800(s, p, o, m) BOOST_PP_FOR_800_I(s, p, o, m)
+# define BOOST_PP_FOR_801(s, p, o, m) BOOST_PP_FOR_801_I(s, p, o, m)
+# define BOOST_PP_FOR_802(s, p, o, m) BOOST_PP_FOR_802_I(s, p, o, m)
+# define BOOST_PP_FOR_803(s, p, o, m) BOOST_PP_FOR_803_I(s, p, o, m)
+# define BOOST_PP_FOR_804(s, p, o, m) BOOST_PP_FOR_804_I(s, p, o, m)
+# define BOOST_PP_FOR_805(s, p, o, m) BOOST_PP_FOR_805_I(s, p, o, m)
+# define BOOST_PP_FOR_806(s, p, o, m) BOOST_PP_FOR_806_I(s, p, o, m)
+# define BOOST_PP_FOR_807(s, p, o, m) BOOST_PP_FOR_807_I(s, p, o, m)
+# define BOOST_PP_FOR_808(s, p, o, m) BOOST_PP_FOR_808_I(s, p, o, m)
+# define BOOST_PP_FOR_809(s, p, o, m) BOOST_PP_FOR_809_I(s, p, o, m)
+# define BOOST_PP_FOR_810(s, p, o, m) BOOST_PP_FOR_810_I(s, p, o, m)
+# define BOOST_PP_FOR_811(s, p, o, m) BOOST_PP_FOR_811_I(s, p, o, m)
+# define BOOST_PP_FOR_812(s, p, o, m) BOOST_PP_FOR_812_I(s, p, o, m)
+# define BOOST_PP_FOR_813(s, p, o, m) BOOST_PP_FOR_813_I(s, p, o, m)
+# define BOOST_PP_FOR_814(s, p, o, m) BOOST_PP_FOR_814_I(s, p, o, m)
+# define BOOST_PP_FOR_815(s, p, o, m) BOOST_PP_FOR_815_I(s, p, o, m)
+# define BOOST_PP_FOR_816(s, p, o, m) BOOST_PP_FOR_816_I(s, p, o, m)
+# define BOOST_PP_FOR_817(s, p, o, m) BOOST_PP_FOR_817_I(s, p, o, m)
+# define BOOST_PP_FOR_818(s, p, o, m) BOOST_PP_FOR_818_I(s, p, o, m)
+# define BOOST_PP_FOR_819(s, p, o, m) BOOST_PP_FOR_819_I(s, p, o, m)
+# define BOOST_PP_FOR_820(s, p, o, m) BOOST_PP_FOR_820_I(s, p, o, m)
+# define BOOST_PP_FOR_821(s, p, o, m) BOOST_PP_FOR_821_I(s, p, o, m)
+# define BOOST_PP_FOR_822(s, p, o, m) BOOST_PP_FOR_822_I(s, p, o, m)
+# define BOOST_PP_FOR_823(s, p, o, m) BOOST_PP_FOR_823_I(s, p, o, m)
+# define BOOST_PP_FOR_824(s, p, o, m) BOOST_PP_FOR_824_I(s, p, o, m)
+# define BOOST_PP_FOR_825(s, p, o, m) BOOST_PP_FOR_825_I(s, p, o, m)
+# define BOOST_PP_FOR_826(s, p, o, m) BOOST_PP_FOR_826_I(s, p, o, m)
+# define BOOST_PP_FOR_827(s, p, o, m) BOOST_PP_FOR_827_I(s, p, o, m)
+# define BOOST_PP_FOR_828(s, p, o, m) BOOST_PP_FOR_828_I(s, p, o, m)
+# define BOOST_PP_FOR_829(s, p, o, m) BOOST_PP_FOR_829_I(s, p, o, m)
+# define BOOST_PP_FOR_830(s, p, o, m) BOOST_PP_FOR_830_I(s, p, o, m)
+# define BOOST_PP_FOR_831(s, p, o, m) BOOST_PP_FOR_831_I(s, p, o, m)
+# define BOOST_PP_FOR_832(s, p, o, m) BOOST_PP_FOR_832_I(s, p, o, m)
+# define BOOST_PP_FOR_833(s, p, o, m) BOOST_PP_FOR_833_I(s, p, o, m)
+# define BOOST_PP_FOR_834(s, p, o, m) BOOST_PP_FOR_834_I(s, p, o, m)
+# define BOOST_PP_FOR_835(s, p, o, m) BOOST_PP_FOR_835_I(s, p, o, m)
+# define BOOST_PP_FOR_836(s, p, o, m) BOOST_PP_FOR_836_I(s, p, o, m)
+# define BOOST_PP_FOR_837(s, p, o, m) BOOST_PP_FOR_837_I(s, p, o, m)
+# define BOOST_PP_FOR_838(s, p, o, m) BOOST_PP_FOR_838_I(s, p, o, m)
+# define BOOST_PP_FOR_839(s, p, o, m) BOOST_PP_FOR_839_I(s, p, o, m)
+# define BOOST_PP_FOR_840(s, p, o, m) BOOST_PP_FOR_840_I(s, p, o, m)
+# define BOOST_PP_FOR_841(s, p, o, m) BOOST_PP_FOR_841_I(s, p, o, m)
+# define BOOST_PP_FOR_842(s, p, o, m) BOOST_PP_FOR_842_I(s, p, o, m)
+# define BOOST_PP_FOR_843(s, p, o, m) BOOST_PP_FOR_843_I(s, p, o, m)
+# define BOOST_PP_FOR_844(s, p, o, m) BOOST_PP_FOR_844_I(s, p, o, m)
+# define BOOST_PP_FOR_845(s, p, o, m) BOOST_PP_FOR_845_I(s, p, o, m)
+# define BOOST_PP_FOR_846(s, p, o, m) BOOST_PP_FOR_846_I(s, p, o, m)
+# define BOOST_PP_FOR_847(s, p, o, m) BOOST_PP_FOR_847_I(s, p, o, m)
+# define BOOST_PP_FOR_848(s, p, o, m) BOOST_PP_FOR_848_I(s, p, o, m)
+# define BOOST_PP_FOR_849(s, p, o, m) BOOST_PP_FOR_849_I(s, p, o, m)
+# define BOOST_PP_FOR_850(s, p, o, m) BOOST_PP_FOR_850_I(s, p, o, m)
+# define BOOST_PP_FOR_851(s, p, o, m) BOOST_PP_FOR_851_I(s, p, o, m)
+# define BOOST_PP_FOR_852(s, p, o, m) BOOST_PP_FOR_852_I(s, p, o, m)
+# define BOOST_PP_FOR_853(s, p, o, m) BOOST_PP_FOR_853_I(s, p, o, m)
+# define BOOST_PP_FOR_854(s, p, o, m) BOOST_PP_FOR_854_I(s, p, o, m)
+# define BOOST_PP_FOR_855(s, p, o, m) BOOST_PP_FOR_855_I(s, p, o, m)
+# define BOOST_PP_FOR_856(s, p, o, m) BOOST_PP_FOR_856_I(s, p, o, m)
+# define BOOST_PP_FOR_857(s, p, o, m) BOOST_PP_FOR_857_I(s, p, o, m)
+# define BOOST_PP_FOR_858(s, p, o, m) BOOST_PP_FOR_858_I(s, p, o, m)
+# define BOOST_PP_FOR_859(s, p, o, m) BOOST_PP_FOR_859_I(s, p, o, m)
+# define BOOST_PP_FOR_860(s, p, o, m) BOOST_PP_FOR_860_I(s, p, o, m)
+# define BOOST_PP_FOR_861(s, p, o, m) BOOST_PP_FOR_861_I(s, p, o, m)
+# define BOOST_PP_FOR_862(s, p, o, m) BOOST_PP_FOR_862_I(s, p, o, m)
+# define BOOST_PP_FOR_863(s, p, o, m) BOOST_PP_FOR_863_I(s, p, o, m)
+# define BOOST_PP_FOR_864(s, p, o, m) BOOST_PP_FOR_864_I(s, p, o, m)
+# define BOOST_PP_FOR_865(s, p, o, m) BOOST_PP_FOR_865_I(s, p, o, m)
+# define BOOST_PP_FOR_866(s, p, o, m) BOOST_PP_FOR_866_I(s, p, o, m)
+# define BOOST_PP_FOR_867(s, p, o, m) BOOST_PP_FOR_867_I(s, p, o, m)
+# define BOOST_PP_FOR_868(s, p, o, m) BOOST_PP_FOR_868_I(s, p, o, m)
+# define BOOST_PP_FOR_869(s, p, o, m) BOOST_PP_FOR_869_I(s, p, o, m)
+# define BOOST_PP_FOR_870(s, p, o, m) BOOST_PP_FOR_870_I(s, p, o, m)
+# define BOOST_PP_FOR_871(s, p, o, m) BOOST_PP_FOR_871_I(s, p, o, m)
+# define BOOST_PP_FOR_872(s, p, o, m) BOOST_PP_FOR_872_I(s, p, o, m)
+# define BOOST_PP_FOR_873(s, p, o, m) BOOST_PP_FOR_873_I(s, p, o, m)
+# define BOOST_PP_FOR_874(s, p, o, m) BOOST_PP_FOR_874_I(s, p, o, m)
+# define BOOST_PP_FOR_875(s, p, o, m) BOOST_PP_FOR_875_I(s, p, o, m)
+# define BOOST_PP_FOR_876(s, p, o, m) BOOST_PP_FOR_876_I(s, p, o, m)
+# define BOOST_PP_FOR_877(s, p, o, m) BOOST_PP_FOR_877_I(s, p, o, m)
+# define BOOST_PP_FOR_878(s, p, o, m) BOOST_PP_FOR_878_I(s, p, o, m)
+# define BOOST_PP_FOR_879(s, p, o, m) BOOST_PP_FOR_879_I(s, p, o, m)
+# define BOOST_PP_FOR_880(s, p, o, m) BOOST_PP_FOR_880_I(s, p, o, m)
+# define BOOST_PP_FOR_881(s, p, o, m) BOOST_PP_FOR_881_I(s, p, o, m)
+# define BOOST_PP_FOR_882(s, p, o, m) BOOST_PP_FOR_882_I(s, p, o, m)
+# define BOOST_PP_FOR_883(s, p, o, m) BOOST_PP_FOR_883_I(s, p, o, m)
+# define BOOST_PP_FOR_884(s, p, o, m) BOOST_PP_FOR_884_I(s, p, o, m)
+# define BOOST_PP_FOR_885(s, p, o, m) BOOST_PP_FOR_885_I(s, p, o, m)
+# define BOOST_PP_FOR_886(s, p, o, m) BOOST_PP_FOR_886_I(s, p, o, m)
+# define BOOST_PP_FOR_887(s, p, o, m) BOOST_PP_FOR_887_I(s, p, o, m)
+# define BOOST_PP_FOR_888(s, p, o, m) BOOST_PP_FOR_888_I(s, p, o, m)
+# define BOOST_PP_FOR_889(s, p, o, m) BOOST_PP_FOR_889_I(s, p, o, m)
+# define BOOST_PP_FOR_890(s, p, o, m) BOOST_PP_FOR_890_I(s, p, o, m)
+# define BOOST_PP_FOR_891(s, p, o, m) BOOST_PP_FOR_891_I(s, p, o, m)
+# define BOOST_PP_FOR_892(s, p, o, m) BOOST_PP_FOR_892_I(s, p, o, m)
+# define BOOST_PP_FOR_893(s, p, o, m) BOOST_PP_FOR_893_I(s, p, o, m)
+# define BOOST_PP_FOR_894(s, p, o, m) BOOST_PP_FOR_894_I(s, p, o, m)
+# define BOOST_PP_FOR_895(s, p, o, m) BOOST_PP_FOR_895_I(s, p, o, m)
+# define BOOST_PP_FOR_896(s, p, o, m) BOOST_PP_FOR_896_I(s, p, o, m)
+# define BOOST_PP_FOR_897(s, p, o, m) BOOST_PP_FOR_897_I(s, p, o, m)
+# define BOOST_PP_FOR_898(s, p, o, m) BOOST_PP_FOR_898_I(s, p, o, m)
+# define BOOST_PP_FOR_899(s, p, o, m) BOOST_PP_FOR_899_I(s, p, o, m)
+# define BOOST_PP_FOR_900(s, p, o, m) BOOST_PP_FOR_900_I(s, p, o, m)
+# define BOOST_PP_FOR_901(s, p, o, m) BOOST_PP_FOR_901_I(s, p, o, m)
+# define BOOST_PP_FOR_902(s, p, o, m) BOOST_PP_FOR_902_I(s, p, o, m)
+# define BOOST_PP_FOR_903(s, p, o, m) BOOST_PP_FOR_903_I(s, p, o, m)
+# define BOOST_PP_FOR_904(s, p, o, m) BOOST_PP_FOR_904_I(s, p, o, m)
+# define BOOST_PP_FOR_905(s, p, o, m) BOOST_PP_FOR_905_I(s, p, o, m)
+# define BOOST_PP_FOR_906(s, p, o, m) BOOST_PP_FOR_906_I(s, p, o, m)
+# define BOOST_PP_FOR_907(s, p, o, m) BOOST_PP_FOR_907_I(s, p, o, m)
+# define BOOST_PP_FOR_908(s, p, o, m) BOOST_PP_FOR_908_I(s, p, o, m)
+# define BOOST_PP_FOR_909(s, p, o, m) BOOST_PP_FOR_909_I(s, p, o, m)
+# define BOOST_PP_FOR_910(s, p, o, m) BOOST_PP_FOR_910_I(s, p, o, m)
+# define BOOST_PP_FOR_911(s, p, o, m) BOOST_PP_FOR_911_I(s, p, o, m)
+# define BOOST_PP_FOR_912(s, p, o, m) BOOST_PP_FOR_912_I(s, p, o, m)
+# define BOOST_PP_FOR_913(s, p, o, m) BOOST_PP_FOR_913_I(s, p, o, m)
+# define BOOST_PP_FOR_914(s, p, o, m) BOOST_PP_FOR_914_I(s, p, o, m)
+# define BOOST_PP_FOR_915(s, p, o, m) BOOST_PP_FOR_915_I(s, p, o, m)
+# define BOOST_PP_FOR_916(s, p, o, m) BOOST_PP_FOR_916_I(s, p, o, m)
+# define BOOST_PP_FOR_917(s, p, o, m) BOOST_PP_FOR_917_I(s, p, o, m)
+# define BOOST_PP_FOR_918(s, p, o, m) BOOST_PP_FOR_918_I(s, p, o, m)
+# define BOOST_PP_FOR_919(s, p, o, m) BOOST_PP_FOR_919_I(s, p, o, m)
+# define BOOST_PP_FOR_920(s, p, o, m) BOOST_PP_FOR_920_I(s, p, o, m)
+# define BOOST_PP_FOR_921(s, p, o, m) BOOST_PP_FOR_921_I(s, p, o, m)
+# define BOOST_PP_FOR_922(s, p, o, m) BOOST_PP_FOR_922_I(s, p, o, m)
+# define BOOST_PP_FOR_923(s, p, o, m) BOOST_PP_FOR_923_I(s, p, o, m)
+# define BOOST_PP_FOR_924(s, p, o, m) BOOST_PP_FOR_924_I(s, p, o, m)
+# define BOOST_PP_FOR_925(s, p, o, m) BOOST_PP_FOR_925_I(s, p, o, m)
+# define BOOST_PP_FOR_926(s, p, o, m) BOOST_PP_FOR_926_I(s, p, o, m)
+# define BOOST_PP_FOR_927(s, p, o, m) BOOST_PP_FOR_927_I(s, p, o, m)
+# define BOOST_PP_FOR_928(s, p, o, m) BOOST_PP_FOR_928_I(s, p, o, m)
+# define BOOST_PP_FOR_929(s, p, o, m) BOOST_PP_FOR_929_I(s, p, o, m)
+# define BOOST_PP_FOR_930(s, p, o, m) BOOST_PP_FOR_930_I(s, p, o, m)
+# define BOOST_PP_FOR_931(s, p, o, m) BOOST_PP_FOR_931_I(s, p, o, m)
+# define BOOST_PP_FOR_932(s, p, o, m) BOOST_PP_FOR_932_I(s, p, o, m)
+# define BOOST_PP_FOR_933(s, p, o, m) BOOST_PP_FOR_933_I(s, p, o, m)
+# define BOOST_PP_FOR_934(s, p, o, m) BOOST_PP_FOR_934_I(s, p, o, m)
+# define BOOST_PP_FOR_935(s, p, o, m) BOOST_PP_FOR_935_I(s, p, o, m)
+# define BOOST_PP_FOR_936(s, p, o, m) BOOST_PP_FOR_936_I(s, p, o, m)
+# define BOOST_PP_FOR_937(s, p, o, m) BOOST_PP_FOR_937_I(s, p, o, m)
+# define BOOST_PP_FOR_938(s, p, o, m) BOOST_PP_FOR_938_I(s, p, o, m)
+# define BOOST_PP_FOR_939(s, p, o, m) BOOST_PP_FOR_939_I(s, p, o, m)
+# define BOOST_PP_FOR_940(s, p, o, m) BOOST_PP_FOR_940_I(s, p, o, m)
+# define BOOST_PP_FOR_941(s, p, o, m) BOOST_PP_FOR_941_I(s, p, o, m)
+# define BOOST_PP_FOR_942(s, p, o, m) BOOST_PP_FOR_942_I(s, p, o, m)
+# define BOOST_PP_FOR_943(s, p, o, m) BOOST_PP_FOR_943_I(s, p, o, m)
+# define BOOST_PP_FOR_944(s, p, o, m) BOOST_PP_FOR_944_I(s, p, o, m)
+# define BOOST_PP_FOR_945(s, p, o, m) BOOST_PP_FOR_945_I(s, p, o, m)
+# define BOOST_PP_FOR_946(s, p, o, m) BOOST_PP_FOR_946_I(s, p, o, m)
+# define BOOST_PP_FOR_947(s, p, o, m) BOOST_PP_FOR_947_I(s, p, o, m)
+# define BOOST_PP_FOR_948(s, p, o, m) BOOST_PP_FOR_948_I(s, p, o, m)
+# define BOOST_PP_FOR_949(s, p, o, m) BOOST_PP_FOR_949_I(s, p, o, m)
+# define BOOST_PP_FOR_950(s, p, o, m) BOOST_PP_FOR_950_I(s, p, o, m)
+# define BOOST_PP_FOR_951(s, p, o, m) BOOST_PP_FOR_951_I(s, p, o, m)
+# define BOOST_PP_FOR_952(s, p, o, m) BOOST_PP_FOR_952_I(s, p, o, m)
+# define BOOST_PP_FOR_953(s, p, o, m) BOOST_PP_FOR_953_I(s, p, o, m)
+# define BOOST_PP_FOR_954(s, p, o, m) BOOST_PP_FOR_954_I(s, p, o, m)
+# define BOOST_PP_FOR_955(s, p, o, m) BOOST_PP_FOR_955_I(s, p, o, m)
+# define BOOST_PP_FOR_956(s, p, o, m) BOOST_PP_FOR_956_I(s, p, o, m)
+# define BOOST_PP_FOR_957(s, p, o, m) BOOST_PP_FOR_957_I(s, p, o, m)
+# define BOOST_PP_FOR_958(s, p, o, m) BOOST_PP_FOR_958_I(s, p, o, m)
+# define BOOST_PP_FOR_959(s, p, o, m) BOOST_PP_FOR_959_I(s, p, o, m)
+# define BOOST_PP_FOR_960(s, p, o, m) BOOST_PP_FOR_960_I(s, p, o, m)
+# define BOOST_PP_FOR_961(s, p, o, m) BOOST_PP_FOR_961_I(s, p, o, m)
+# define BOOST_PP_FOR_962(s, p, o, m) BOOST_PP_FOR_962_I(s, p, o, m)
+# define BOOST_PP_FOR_963(s, p, o, m) BOOST_PP_FOR_963_I(s, p, o, m)
+# define BOOST_PP_FOR_964(s, p, o, m) BOOST_PP_FOR_964_I(s, p, o, m)
+# define BOOST_PP_FOR_965(s, p, o, m) BOOST_PP_FOR_965_I(s, p, o, m)
+# define BOOST_PP_FOR_966(s, p, o, m) BOOST_PP_FOR_966_I(s, p, o, m)
+# define BOOST_PP_FOR_967(s, p, o, m) BOOST_PP_FOR_967_I(s, p, o, m)
+# define BOOST_PP_FOR_968(s, p, o, m) BOOST_PP_FOR_968_I(s, p, o, m)
+# define BOOST_PP_FOR_969(s, p, o, m) BOOST_PP_FOR_969_I(s, p, o, m)
+# define BOOST_PP_FOR_970(s, p, o, m) BOOST_PP_FOR_970_I(s, p, o, m)
+# define BOOST_PP_FOR_971(s, p, o, m) BOOST_PP_FOR_971_I(s, p, o, m)
+# define BOOST_PP_FOR_972(s, p, o, m) BOOST_PP_FOR_972_I(s, p, o, m)
+# define BOOST_PP_FOR_973(s, p, o, m) BOOST_PP_FOR_973_I(s, p, o, m)
+# define BOOST_PP_FOR_974(s, p, o, m) BOOST_PP_FOR_974_I(s, p, o, m)
+# define BOOST_PP_FOR_975(s, p, o, m) BOOST_PP_FOR_975_I(s, p, o, m)
+# define BOOST_PP_FOR_976(s, p, o, m) BOOST_PP_FOR_976_I(s, p, o, m)
+# define BOOST_PP_FOR_977(s, p, o, m) BOOST_PP_FOR_977_I(s, p, o, m)
+# define BOOST_PP_FOR_978(s, p, o, m) BOOST_PP_FOR_978_I(s, p, o, m)
+# define BOOST_PP_FOR_979(s, p, o, m) BOOST_PP_FOR_979_I(s, p, o, m)
+# define BOOST_PP_FOR_980(s, p, o, m) BOOST_PP_FOR_980_I(s, p, o, m)
+# define BOOST_PP_FOR_981(s, p, o, m) BOOST_PP_FOR_981_I(s, p, o, m)
+# define BOOST_PP_FOR_982(s, p, o, m) BOOST_PP_FOR_982_I(s, p, o, m)
+# define BOOST_PP_FOR_983(s, p, o, m) BOOST_PP_FOR_983_I(s, p, o, m)
+# define BOOST_PP_FOR_984(s, p, o, m) BOOST_PP_FOR_984_I(s, p, o, m)
+# define BOOST_PP_FOR_985(s, p, o, m) BOOST_PP_FOR_985_I(s, p, o, m)
+# define BOOST_PP_FOR_986(s, p, o, m) BOOST_PP_FOR_986_I(s, p, o, m)
+# define BOOST_PP_FOR_987(s, p, o, m) BOOST_PP_FOR_987_I(s, p, o, m)
+# define BOOST_PP_FOR_988(s, p, o, m) BOOST_PP_FOR_988_I(s, p, o, m)
+# define BOOST_PP_FOR_989(s, p, o, m) BOOST_PP_FOR_989_I(s, p, o, m)
+# define BOOST_PP_FOR_990(s, p, o, m) BOOST_PP_FOR_990_I(s, p, o, m)
+# define BOOST_PP_FOR_991(s, p, o, m) BOOST_PP_FOR_991_I(s, p, o, m)
+# define BOOST_PP_FOR_992(s, p, o, m) BOOST_PP_FOR_992_I(s, p, o, m)
+# define BOOST_PP_FOR_993(s, p, o, m) BOOST_PP_FOR_993_I(s, p, o, m)
+# define BOOST_PP_FOR_994(s, p, o, m) BOOST_PP_FOR_994_I(s, p, o, m)
+# define BOOST_PP_FOR_995(s, p, o, m) BOOST_PP_FOR_995_I(s, p, o, m)
+# define BOOST_PP_FOR_996(s, p, o, m) BOOST_PP_FOR_996_I(s, p, o, m)
+# define BOOST_PP_FOR_997(s, p, o, m) BOOST_PP_FOR_997_I(s, p, o, m)
+# define BOOST_PP_FOR_998(s, p, o, m) BOOST_PP_FOR_998_I(s, p, o, m)
+# define BOOST_PP_FOR_999(s, p, o, m) BOOST_PP_FOR_999_I(s, p, o, m)
+# define BOOST_PP_FOR_1000(s, p, o, m) BOOST_PP_FOR_1000_I(s, p, o, m)
+# define BOOST_PP_FOR_1001(s, p, o, m) BOOST_PP_FOR_1001_I(s, p, o, m)
+# define BOOST_PP_FOR_1002(s, p, o, m) BOOST_PP_FOR_1002_I(s, p, o, m)
+# define BOOST_PP_FOR_1003(s, p, o, m) BOOST_PP_FOR_1003_I(s, p, o, m)
+# define BOOST_PP_FOR_1004(s, p, o, m) BOOST_PP_FOR_1004_I(s, p, o, m)
+# define BOOST_PP_FOR_1005(s, p, o, m) BOOST_PP_FOR_1005_I(s, p, o, m)
+# define BOOST_PP_FOR_1006(s, p, o, m) BOOST_PP_FOR_1006_I(s, p, o, m)
+# define BOOST_PP_FOR_1007(s, p, o, m) BOOST_PP_FOR_1007_I(s, p, o, m)
+# define BOOST_PP_FOR_1008(s, p, o, m) BOOST_PP_FOR_1008_I(s, p, o, m)
+# define BOOST_PP_FOR_1009(s, p, o, m) BOOST_PP_FOR_1009_I(s, p, o, m)
+# define BOOST_PP_FOR_1010(s, p, o, m) BOOST_PP_FOR_1010_I(s, p, o, m)
+# define BOOST_PP_FOR_1011(s, p, o, m) BOOST_PP_FOR_1011_I(s, p, o, m)
+# define BOOST_PP_FOR_1012(s, p, o, m) BOOST_PP_FOR_1012_I(s, p, o, m)
+# define BOOST_PP_FOR_1013(s, p, o, m) BOOST_PP_FOR_1013_I(s, p, o, m)
+# define BOOST_PP_FOR_1014(s, p, o, m) BOOST_PP_FOR_1014_I(s, p, o, m)
+# define BOOST_PP_FOR_1015(s, p, o, m) BOOST_PP_FOR_1015_I(s, p, o, m)
+# define BOOST_PP_FOR_1016(s, p, o, m) BOOST_PP_FOR_1016_I(s, p, o, m)
+# define BOOST_PP_FOR_1017(s, p, o, m) BOOST_PP_FOR_1017_I(s, p, o, m)
+# define BOOST_PP_FOR_1018(s, p, o, m) BOOST_PP_FOR_1018_I(s, p, o, m)
+# define BOOST_PP_FOR_1019(s, p, o, m) BOOST_PP_FOR_1019_I(s, p, o, m)
+# define BOOST_PP_FOR_1020(s, p, o, m) BOOST_PP_FOR_1020_I(s, p, o, m)
+# define BOOST_PP_FOR_1021(s, p, o, m) BOOST_PP_FOR_1021_I(s, p, o, m)
+# define BOOST_PP_FOR_1022(s, p, o, m) BOOST_PP_FOR_1022_I(s, p, o, m)
+# define BOOST_PP_FOR_1023(s, p, o, m) BOOST_PP_FOR_1023_I(s, p, o, m)
+# define BOOST_PP_FOR_1024(s, p, o, m) BOOST_PP_FOR_1024_I(s, p, o, m)
+#
+# define BOOST_PP_FOR_513_I(s, p, o, m) BOOST_PP_IF(p(514, s), m, BOOST_PP_TUPLE_EAT_2)(514, s) BOOST_PP_IF(p(514, s), BOOST_PP_FOR_514, BOOST_PP_TUPLE_EAT_4)(o(514, s), p, o, m)
+# define BOOST_PP_FOR_514_I(s, p, o, m) BOOST_PP_IF(p(515, s), m, BOOST_PP_TUPLE_EAT_2)(515, s) BOOST_PP_IF(p(515, s), BOOST_PP_FOR_515, BOOST_PP_TUPLE_EAT_4)(o(515, s), p, o, m)
+# define BOOST_PP_FOR_515_I(s, p, o, m) BOOST_PP_IF(p(516, s), m, BOOST_PP_TUPLE_EAT_2)(516, s) BOOST_PP_IF(p(516, s), BOOST_PP_FOR_516, BOOST_PP_TUPLE_EAT_4)(o(516, s), p, o, m)
+# define BOOST_PP_FOR_516_I(s, p, o, m) BOOST_PP_IF(p(517, s), m, BOOST_PP_TUPLE_EAT_2)(517, s) BOOST_PP_IF(p(517, s), BOOST_PP_FOR_517, BOOST_PP_TUPLE_EAT_4)(o(517, s), p, o, m)
+# define BOOST_PP_FOR_517_I(s, p, o, m) BOOST_PP_IF(p(518, s), m, BOOST_PP_TUPLE_EAT_2)(518, s) BOOST_PP_IF(p(518, s), BOOST_PP_FOR_518, BOOST_PP_TUPLE_EAT_4)(o(518, s), p, o, m)
+# define BOOST_PP_FOR_518_I(s, p, o, m) BOOST_PP_IF(p(519, s), m, BOOST_PP_TUPLE_EAT_2)(519, s) BOOST_PP_IF(p(519, s), BOOST_PP_FOR_519, BOOST_PP_TUPLE_EAT_4)(o(519, s), p, o, m)
+# define BOOST_PP_FOR_519_I(s, p, o, m) BOOST_PP_IF(p(520, s), m, BOOST_PP_TUPLE_EAT_2)(520, s) BOOST_PP_IF(p(520, s), BOOST_PP_FOR_520, BOOST_PP_TUPLE_EAT_4)(o(520, s), p, o, m)
+# define BOOST_PP_FOR_520_I(s, p, o, m) BOOST_PP_IF(p(521, s), m, BOOST_PP_TUPLE_EAT_2)(521, s) BOOST_PP_IF(p(521, s), BOOST_PP_FOR_521, BOOST_PP_TUPLE_EAT_4)(o(521, s), p, o, m)
+# define BOOST_PP_FOR_521_I(s, p, o, m) BOOST_PP_IF(p(522, s), m, BOOST_PP_TUPLE_EAT_2)(522, s) BOOST_PP_IF(p(522, s), BOOST_PP_FOR_522, BOOST_PP_TUPLE_EAT_4)(o(522, s), p, o, m)
+# define BOOST_PP_FOR_522_I(s, p, o, m) BOOST_PP_IF(p(523, s), m, BOOST_PP_TUPLE_EAT_2)(523, s) BOOST_PP_IF(p(523, s), BOOST_PP_FOR_523, BOOST_PP_TUPLE_EAT_4)(o(523, s), p, o, m)
+# define BOOST_PP_FOR_523_I(s, p, o, m) BOOST_PP_IF(p(524, s), m, BOOST_PP_TUPLE_EAT_2)(524, s) BOOST_PP_IF(p(524, s), BOOST_PP_FOR_524, BOOST_PP_TUPLE_EAT_4)(o(524, s), p, o, m)
+# define BOOST_PP_FOR_524_I(s, p, o, m) BOOST_PP_IF(p(525, s), m, BOOST_PP_TUPLE_EAT_2)(525, s) BOOST_PP_IF(p(525, s), BOOST_PP_FOR_525, BOOST_PP_TUPLE_EAT_4)(o(525, s), p, o, m)
+# define BOOST_PP_FOR_525_I(s, p, o, m) BOOST_PP_IF(p(526, s), m, BOOST_PP_TUPLE_EAT_2)(526, s) BOOST_PP_IF(p(526, s), BOOST_PP_FOR_526, BOOST_PP_TUPLE_EAT_4)(o(526, s), p, o, m)
+# define BOOST_PP_FOR_526_I(s, p, o, m) BOOST_PP_IF(p(527, s), m, BOOST_PP_TUPLE_EAT_2)(527, s) BOOST_PP_IF(p(527, s), BOOST_PP_FOR_527, BOOST_PP_TUPLE_EAT_4)(o(527, s), p, o, m)
+# define BOOST_PP_FOR_527_I(s, p, o, m) BOOST_PP_IF(p(528, s), m, BOOST_PP_TUPLE_EAT_2)(528, s) BOOST_PP_IF(p(528, s), BOOST_PP_FOR_528, BOOST_PP_TUPLE_EAT_4)(o(528, s), p, o, m)
+# define BOOST_PP_FOR_528_I(s, p, o, m) BOOST_PP_IF(p(529, s), m, BOOST_PP_TUPLE_EAT_2)(529, s) BOOST_PP_IF(p(529, s), BOOST_PP_FOR_529, BOOST_PP_TUPLE_EAT_4)(o(529, s), p, o, m)
+# define BOOST_PP_FOR_529_I(s, p, o, m) BOOST_PP_IF(p(530, s), m, BOOST_PP_TUPLE_EAT_2)(530, s) BOOST_PP_IF(p(530, s), BOOST_PP_FOR_530, BOOST_PP_TUPLE_EAT_4)(o(530, s), p, o, m)
+# define BOOST_PP_FOR_530_I(s, p, o, m) BOOST_PP_IF(p(531, s), m, BOOST_PP_TUPLE_EAT_2)(531, s) BOOST_PP_IF(p(531, s), BOOST_PP_FOR_531, BOOST_PP_TUPLE_EAT_4)(o(531, s), p, o, m)
+# define BOOST_PP_FOR_531_I(s, p, o, m) BOOST_PP_IF(p(532, s), m, BOOST_PP_TUPLE_EAT_2)(532, s) BOOST_PP_IF(p(532, s), BOOST_PP_FOR_532, BOOST_PP_TUPLE_EAT_4)(o(532, s), p, o, m)
+# define BOOST_PP_FOR_532_I(s, p, o, m) BOOST_PP_IF(p(533, s), m, BOOST_PP_TUPLE_EAT_2)(533, s) BOOST_PP_IF(p(533, s), BOOST_PP_FOR_533, BOOST_PP_TUPLE_EAT_4)(o(533, s), p, o, m)
+# define BOOST_PP_FOR_533_I(s, p, o, m) BOOST_PP_IF(p(534, s), m, BOOST_PP_TUPLE_EAT_2)(534, s) BOOST_PP_IF(p(534, s), BOOST_PP_FOR_534, BOOST_PP_TUPLE_EAT_4)(o(534, s), p, o, m)
+# define BOOST_PP_FOR_534_I(s, p, o, m) BOOST_PP_IF(p(535, s), m, BOOST_PP_TUPLE_EAT_2)(535, s) BOOST_PP_IF(p(535, s), BOOST_PP_FOR_535, BOOST_PP_TUPLE_EAT_4)(o(535, s), p, o, m)
+# define BOOST_PP_FOR_535_I(s, p, o, m) BOOST_PP_IF(p(536, s), m, BOOST_PP_TUPLE_EAT_2)(536, s) BOOST_PP_IF(p(536, s), BOOST_PP_FOR_536, BOOST_PP_TUPLE_EAT_4)(o(536, s), p, o, m)
+# define BOOST_PP_FOR_536_I(s, p, o, m) BOOST_PP_IF(p(537, s), m, BOOST_PP_TUPLE_EAT_2)(537, s) BOOST_PP_IF(p(537, s), BOOST_PP_FOR_537, BOOST_PP_TUPLE_EAT_4)(o(537, s), p, o, m)
+# define BOOST_PP_FOR_537_I(s, p, o, m) BOOST_PP_IF(p(538, s), m, BOOST_PP_TUPLE_EAT_2)(538, s) BOOST_PP_IF(p(538, s), BOOST_PP_FOR_538, BOOST_PP_TUPLE_EAT_4)(o(538, s), p, o, m)
+# define BOOST_PP_FOR_538_I(s, p, o, m) BOOST_PP_IF(p(539, s), m, BOOST_PP_TUPLE_EAT_2)(539, s) BOOST_PP_IF(p(539, s), BOOST_PP_FOR_539, BOOST_PP_TUPLE_EAT_4)(o(539, s), p, o, m)
+# define BOOST_PP_FOR_539_I(s, p, o, m) BOOST_PP_IF(p(540, s), m, BOOST_PP_TUPLE_EAT_2)(540, s) BOOST_PP_IF(p(540, s), BOOST_PP_FOR_540, BOOST_PP_TUPLE_EAT_4)(o(540, s), p, o, m)
+# define BOOST_PP_FOR_540_I(s, p, o, m) BOOST_PP_IF(p(541, s), m, BOOST_PP_TUPLE_EAT_2)(541, s) BOOST_PP_IF(p(541, s), BOOST_PP_FOR_541, BOOST_PP_TUPLE_EAT_4)(o(541, s), p, o, m)
+# define BOOST_PP_FOR_541_I(s, p, o, m) BOOST_PP_IF(p(542, s), m, BOOST_PP_TUPLE_EAT_2)(542, s) BOOST_PP_IF(p(542, s), BOOST_PP_FOR_542, BOOST_PP_TUPLE_EAT_4)(o(542, s), p, o, m)
+# define BOOST_PP_FOR_542_I(s, p, o, m) BOOST_PP_IF(p(543, s), m, BOOST_PP_TUPLE_EAT_2)(543, s) BOOST_PP_IF(p(543, s), BOOST_PP_FOR_543, BOOST_PP_TUPLE_EAT_4)(o(543, s), p, o, m)
+# define BOOST_PP_FOR_543_I(s, p, o, m) BOOST_PP_IF(p(544, s), m, BOOST_PP_TUPLE_EAT_2)(544, s) BOOST_PP_IF(p(544, s), BOOST_PP_FOR_544, BOOST_PP_TUPLE_EAT_4)(o(544, s), p, o, m)
+# define BOOST_PP_FOR_544_I(s, p, o, m) BOOST_PP_IF(p(545, s), m, BOOST_PP_TUPLE_EAT_2)(545, s) BOOST_PP_IF(p(545, s), BOOST_PP_FOR_545, BOOST_PP_TUPLE_EAT_4)(o(545, s), p, o, m)
+# define BOOST_PP_FOR_545_I(s, p, o, m) BOOST_PP_IF(p(546, s), m, BOOST_PP_TUPLE_EAT_2)(546, s) BOOST_PP_IF(p(546, s), BOOST_PP_FOR_546, BOOST_PP_TUPLE_EAT_4)(o(546, s), p, o, m)
+# define BOOST_PP_FOR_546_I(s, p, o, m) BOOST_PP_IF(p(547, s), m, BOOST_PP_TUPLE_EAT_2)(547, s) BOOST_PP_IF(p(547, s), BOOST_PP_FOR_547, BOOST_PP_TUPLE_EAT_4)(o(547, s), p, o, m)
+# define BOOST_PP_FOR_547_I(s, p, o, m) BOOST_PP_IF(p(548, s), m, BOOST_PP_TUPLE_EAT_2)(548, s) BOOST_PP_IF(p(548, s), BOOST_PP_FOR_548, BOOST_PP_TUPLE_EAT_4)(o(548, s), p, o, m)
+# define BOOST_PP_FOR_548_I(s, p, o, m) BOOST_PP_IF(p(549, s), m, BOOST_PP_TUPLE_EAT_2)(549, s) BOOST_PP_IF(p(549, s), BOOST_PP_FOR_549, BOOST_PP_TUPLE_EAT_4)(o(549, s), p, o, m)
+# define BOOST_PP_FOR_549_I(s, p, o, m) BOOST_PP_IF(p(550, s), m, BOOST_PP_TUPLE_EAT_2)(550, s) BOOST_PP_IF(p(550, s), BOOST_PP_FOR_550, BOOST_PP_TUPLE_EAT_4)(o(550, s), p, o, m)
+# define BOOST_PP_FOR_550_I(s, p, o, m) BOOST_PP_IF(p(551, s), m, BOOST_PP_TUPLE_EAT_2)(551, s) BOOST_PP_IF(p(551, s), BOOST_PP_FOR_551, BOOST_PP_TUPLE_EAT_4)(o(551, s), p, o, m)
+# define BOOST_PP_FOR_551_I(s, p, o, m) BOOST_PP_IF(p(552, s), m, BOOST_PP_TUPLE_EAT_2)(552, s) BOOST_PP_IF(p(552, s), BOOST_PP_FOR_552, BOOST_PP_TUPLE_EAT_4)(o(552, s), p, o, m)
+# define BOOST_PP_FOR_552_I(s, p, o, m) BOOST_PP_IF(p(553, s), m, BOOST_PP_TUPLE_EAT_2)(553, s) BOOST_PP_IF(p(553, s), BOOST_PP_FOR_553, BOOST_PP_TUPLE_EAT_4)(o(553, s), p, o, m)
+# define BOOST_PP_FOR_553_I(s, p, o, m) BOOST_PP_IF(p(554, s), m, BOOST_PP_TUPLE_EAT_2)(554, s) BOOST_PP_IF(p(554, s), BOOST_PP_FOR_554, BOOST_PP_TUPLE_EAT_4)(o(554, s), p, o, m)
+# define BOOST_PP_FOR_554_I(s, p, o, m) BOOST_PP_IF(p(555, s), m, BOOST_PP_TUPLE_EAT_2)(555, s) BOOST_PP_IF(p(555, s), BOOST_PP_FOR_555, BOOST_PP_TUPLE_EAT_4)(o(555, s), p, o, m)
+# define BOOST_PP_FOR_555_I(s, p, o, m) BOOST_PP_IF(p(556, s), m, BOOST_PP_TUPLE_EAT_2)(556, s) BOOST_PP_IF(p(556, s), BOOST_PP_FOR_556, BOOST_PP_TUPLE_EAT_4)(o(556, s), p, o, m)
+# define BOOST_PP_FOR_556_I(s, p, o, m) BOOST_PP_IF(p(557, s), m, BOOST_PP_TUPLE_EAT_2)(557, s) BOOST_PP_IF(p(557, s), BOOST_PP_FOR_557, BOOST_PP_TUPLE_EAT_4)(o(557, s), p, o, m)
+# define BOOST_PP_FOR_557_I(s, p, o, m) BOOST_PP_IF(p(558, s), m, BOOST_PP_TUPLE_EAT_2)(558, s) BOOST_PP_IF(p(558, s), BOOST_PP_FOR_558, BOOST_PP_TUPLE_EAT_4)(o(558, s), p, o, m)
+# define BOOST_PP_FOR_558_I(s, p, o, m) BOOST_PP_IF(p(559, s), m, BOOST_PP_TUPLE_EAT_2)(559, s) BOOST_PP_IF(p(559, s), BOOST_PP_FOR_559, BOOST_PP_TUPLE_EAT_4)(o(559, s), p, o, m)
+# define BOOST_PP_FOR_559_I(s, p, o, m) BOOST_PP_IF(p(560, s), m, BOOST_PP_TUPLE_EAT_2)(560, s) BOOST_PP_IF(p(560, s), BOOST_PP_FOR_560, BOOST_PP_TUPLE_EAT_4)(o(560, s), p, o, m)
+# define BOOST_PP_FOR_560_I(s, p, o, m) BOOST_PP_IF(p(561, s), m, BOOST_PP_TUPLE_EAT_2)(561, s) BOOST_PP_IF(p(561, s), BOOST_PP_FOR_561, BOOST_PP_TUPLE_EAT_4)(o(561, s), p, o, m)
+# define BOOST_PP_FOR_561_I(s, p, o, m) BOOST_PP_IF(p(562, s), m, BOOST_PP_TUPLE_EAT_2)(562, s) BOOST_PP_IF(p(562, s), BOOST_PP_FOR_562, BOOST_PP_TUPLE_EAT_4)(o(562, s), p, o, m)
+# define BOOST_PP_FOR_562_I(s, p, o, m) BOOST_PP_IF(p(563, s), m, BOOST_PP_TUPLE_EAT_2)(563, s) BOOST_PP_IF(p(563, s), BOOST_PP_FOR_563, BOOST_PP_TUPLE_EAT_4)(o(563, s), p, o, m)
+# define BOOST_PP_FOR_563_I(s, p, o, m) BOOST_PP_IF(p(564, s), m, BOOST_PP_TUPLE_EAT_2)(564, s) BOOST_PP_IF(p(564, s), BOOST_PP_FOR_564, BOOST_PP_TUPLE_EAT_4)(o(564, s), p, o, m)
+# define BOOST_PP_FOR_564_I(s, p, o, m) BOOST_PP_IF(p(565, s), m, BOOST_PP_TUPLE_EAT_2)(565, s) BOOST_PP_IF(p(565, s), BOOST_PP_FOR_565, BOOST_PP_TUPLE_EAT_4)(o(565, s), p, o, m)
+# define BOOST_PP_FOR_565_I(s, p, o, m) BOOST_PP_IF(p(566, s), m, BOOST_PP_TUPLE_EAT_2)(566, s) BOOST_PP_IF(p(566, s), BOOST_PP_FOR_566, BOOST_PP_TUPLE_EAT_4)(o(566, s), p, o, m)
+# define BOOST_PP_FOR_566_I(s, p, o, m) BOOST_PP_IF(p(567, s), m, BOOST_PP_TUPLE_EAT_2)(567, s) BOOST_PP_IF(p(567, s), BOOST_PP_FOR_567, BOOST_PP_TUPLE_EAT_4)(o(567, s), p, o, m)
+# define BOOST_PP_FOR_567_I(s, p, o, m) BOOST_PP_IF(p(568, s), m, BOOST_PP_TUPLE_EAT_2)(568, s) BOOST_PP_IF(p(568, s), BOOST_PP_FOR_568, BOOST_PP_TUPLE_EAT_4)(o(568, s), p, o, m)
+# define BOOST_PP_FOR_568_I(s, p, o, m) BOOST_PP_IF(p(569, s), m, BOOST_PP_TUPLE_EAT_2)(569, s) BOOST_PP_IF(p(569, s), BOOST_PP_FOR_569, BOOST_PP_TUPLE_EAT_4)(o(569, s), p, o, m)
+# define BOOST_PP_FOR_569_I(s, p, o, m) BOOST_PP_IF(p(570, s), m, BOOST_PP_TUPLE_EAT_2)(570, s) BOOST_PP_IF(p(570, s), BOOST_PP_FOR_570, BOOST_PP_TUPLE_EAT_4)(o(570, s), p, o, m)
+# define BOOST_PP_FOR_570_I(s, p, o, m) BOOST_PP_IF(p(571, s), m, BOOST_PP_TUPLE_EAT_2)(571, s) BOOST_PP_IF(p(571, s), BOOST_PP_FOR_571, BOOST_PP_TUPLE_EAT_4)(o(571, s), p, o, m)
+# define BOOST_PP_FOR_571_I(s, p, o, m) BOOST_PP_IF(p(572, s), m, BOOST_PP_TUPLE_EAT_2)(572, s) BOOST_PP_IF(p(572, s), BOOST_PP_FOR_572, BOOST_PP_TUPLE_EAT_4)(o(572, s), p, o, m)
+# define BOOST_PP_FOR_572_I(s, p, o, m) BOOST_PP_IF(p(573, s), m, BOOST_PP_TUPLE_EAT_2)(573, s) BOOST_PP_IF(p(573, s), BOOST_PP_FOR_573, BOOST_PP_TUPLE_EAT_4)(o(573, s), p, o, m)
+# define BOOST_PP_FOR_573_I(s, p, o, m) BOOST_PP_IF(p(574, s), m, BOOST_PP_TUPLE_EAT_2)(574, s) BOOST_PP_IF(p(574, s), BOOST_PP_FOR_574, BOOST_PP_TUPLE_EAT_4)(o(574, s), p, o, m)
+# define BOOST_PP_FOR_574_I(s, p, o, m) BOOST_PP_IF(p(575, s), m, BOOST_PP_TUPLE_EAT_2)(575, s) BOOST_PP_IF(p(575, s), BOOST_PP_FOR_575, BOOST_PP_TUPLE_EAT_4)(o(575, s), p, o, m)
+# define BOOST_PP_FOR_575_I(s, p, o, m) BOOST_PP_IF(p(576, s), m, BOOST_PP_TUPLE_EAT_2)(576, s) BOOST_PP_IF(p(576, s), BOOST_PP_FOR_576, BOOST_PP_TUPLE_EAT_4)(o(576, s), p, o, m)
+# define BOOST_PP_FOR_576_I(s, p, o, m) BOOST_PP_IF(p(577, s), m, BOOST_PP_TUPLE_EAT_2)(577, s) BOOST_PP_IF(p(577, s), BOOST_PP_FOR_577, BOOST_PP_TUPLE_EAT_4)(o(577, s), p, o, m)
+# define BOOST_PP_FOR_577_I(s, p, o, m) BOOST_PP_IF(p(578, s), m, BOOST_PP_TUPLE_EAT_2)(578, s) BOOST_PP_IF(p(578, s), BOOST_PP_FOR_578, BOOST_PP_TUPLE_EAT_4)(o(578, s), p, o, m)
+# define BOOST_PP_FOR_578_I(s, p, o, m) BOOST_PP_IF(p(579, s), m, BOOST_PP_TUPLE_EAT_2)(579, s) BOOST_PP_IF(p(579, s), BOOST_PP_FOR_579, BOOST_PP_TUPLE_EAT_4)(o(579, s), p, o, m)
+# define BOOST_PP_FOR_579_I(s, p, o, m) BOOST_PP_IF(p(580, s), m, BOOST_PP_TUPLE_EAT_2)(580, s) BOOST_PP_IF(p(580, s), BOOST_PP_FOR_580, BOOST_PP_TUPLE_EAT_4)(o(580, s), p, o, m)
+# define BOOST_PP_FOR_580_I(s, p, o, m) BOOST_PP_IF(p(581, s), m, BOOST_PP_TUPLE_EAT_2)(581, s) BOOST_PP_IF(p(581, s), BOOST_PP_FOR_581, BOOST_PP_TUPLE_EAT_4)(o(581, s), p, o, m)
+# define BOOST_PP_FOR_581_I(s, p, o, m) BOOST_PP_IF(p(582, s), m, BOOST_PP_TUPLE_EAT_2)(582, s) BOOST_PP_IF(p(582, s), BOOST_PP_FOR_582, BOOST_PP_TUPLE_EAT_4)(o(582, s), p, o, m)
+# define BOOST_PP_FOR_582_I(s, p, o, m) BOOST_PP_IF(p(583, s), m, BOOST_PP_TUPLE_EAT_2)(583, s) BOOST_PP_IF(p(583, s), BOOST_PP_FOR_583, BOOST_PP_TUPLE_EAT_4)(o(583, s), p, o, m)
+# define BOOST_PP_FOR_583_I(s, p, o, m) BOOST_PP_IF(p(584, s), m, BOOST_PP_TUPLE_EAT_2)(584, s) BOOST_PP_IF(p(584, s), BOOST_PP_FOR_584, BOOST_PP_TUPLE_EAT_4)(o(584, s), p, o, m)
+# define BOOST_PP_FOR_584_I(s, p, o, m) BOOST_PP_IF(p(585, s), m, BOOST_PP_TUPLE_EAT_2)(585, s) BOOST_PP_IF(p(585, s), BOOST_PP_FOR_585, BOOST_PP_TUPLE_EAT_4)(o(585, s), p, o, m)
+# define BOOST_PP_FOR_585_I(s, p, o, m) BOOST_PP_IF(p(586, s), m, BOOST_PP_TUPLE_EAT_2)(586, s) BOOST_PP_IF(p(586, s), BOOST_PP_FOR_586, BOOST_PP_TUPLE_EAT_4)(o(586, s), p, o, m)
+# define BOOST_PP_FOR_586_I(s, p, o, m) BOOST_PP_IF(p(587, s), m, BOOST_PP_TUPLE_EAT_2)(587, s) BOOST_PP_IF(p(587, s), BOOST_PP_FOR_587, BOOST_PP_TUPLE_EAT_4)(o(587, s), p, o, m)
+# define BOOST_PP_FOR_587_I(s, p, o, m) BOOST_PP_IF(p(588, s), m, BOOST_PP_TUPLE_EAT_2)(588, s) BOOST_PP_IF(p(588, s), BOOST_PP_FOR_588, BOOST_PP_TUPLE_EAT_4)(o(588, s), p, o, m)
+# define BOOST_PP_FOR_588_I(s, p, o, m) BOOST_PP_IF(p(589, s), m, BOOST_PP_TUPLE_EAT_2)(589, s) BOOST_PP_IF(p(589, s), BOOST_PP_FOR_589, BOOST_PP_TUPLE_EAT_4)(o(589, s), p, o, m)
+# define BOOST_PP_FOR_589_I(s, p, o, m) BOOST_PP_IF(p(590, s), m, BOOST_PP_TUPLE_EAT_2)(590, s) BOOST_PP_IF(p(590, s), BOOST_PP_FOR_590, BOOST_PP_TUPLE_EAT_4)(o(590, s), p, o, m)
+# define BOOST_PP_FOR_590_I(s, p, o, m) BOOST_PP_IF(p(591, s), m, BOOST_PP_TUPLE_EAT_2)(591, s) BOOST_PP_IF(p(591, s), BOOST_PP_FOR_591, BOOST_PP_TUPLE_EAT_4)(o(591, s), p, o, m)
+# define BOOST_PP_FOR_591_I(s, p, o, m) BOOST_PP_IF(p(592, s), m, BOOST_PP_TUPLE_EAT_2)(592, s) BOOST_PP_IF(p(592, s), BOOST_PP_FOR_592, BOOST_PP_TUPLE_EAT_4)(o(592, s), p, o, m)
+# define BOOST_PP_FOR_592_I(s, p, o, m) BOOST_PP_IF(p(593, s), m, BOOST_PP_TUPLE_EAT_2)(593, s) BOOST_PP_IF(p(593, s), BOOST_PP_FOR_593, BOOST_PP_TUPLE_EAT_4)(o(593, s), p, o, m)
+# define BOOST_PP_FOR_593_I(s, p, o, m) BOOST_PP_IF(p(594, s), m, BOOST_PP_TUPLE_EAT_2)(594, s) BOOST_PP_IF(p(594, s), BOOST_PP_FOR_594, BOOST_PP_TUPLE_EAT_4)(o(594, s), p, o, m)
+# define BOOST_PP_FOR_594_I(s, p, o, m) BOOST_PP_IF(p(595, s), m, BOOST_PP_TUPLE_EAT_2)(595, s) BOOST_PP_IF(p(595, s), BOOST_PP_FOR_595, BOOST_PP_TUPLE_EAT_4)(o(595, s), p, o, m)
+# define BOOST_PP_FOR_595_I(s, p, o, m) BOOST_PP_IF(p(596, s), m, BOOST_PP_TUPLE_EAT_2)(596, s) BOOST_PP_IF(p(596, s), BOOST_PP_FOR_596, BOOST_PP_TUPLE_EAT_4)(o(596, s), p, o, m)
+# define BOOST_PP_FOR_596_I(s, p, o, m) BOOST_PP_IF(p(597, s), m, BOOST_PP_TUPLE_EAT_2)(597, s) BOOST_PP_IF(p(597, s), BOOST_PP_FOR_597, BOOST_PP_TUPLE_EAT_4)(o(597, s), p, o, m)
+# define BOOST_PP_FOR_597_I(s, p, o, m) BOOST_PP_IF(p(598, s), m, BOOST_PP_TUPLE_EAT_2)(598, s) BOOST_PP_IF(p(598, s), BOOST_PP_FOR_598, BOOST_PP_TUPLE_EAT_4)(o(598, s), p, o, m)
+# define BOOST_PP_FOR_598_I(s, p, o, m) BOOST_PP_IF(p(599, s), m, BOOST_PP_TUPLE_EAT_2)(599, s) BOOST_PP_IF(p(599, s), BOOST_PP_FOR_599, BOOST_PP_TUPLE_EAT_4)(o(599, s), p, o, m)
+# define BOOST_PP_FOR_599_I(s, p, o, m) BOOST_PP_IF(p(600, s), m, BOOST_PP_TUPLE_EAT_2)(600, s) BOOST_PP_IF(p(600, s), BOOST_PP_FOR_600, BOOST_PP_TUPLE_EAT_4)(o(600, s), p, o, m)
+# define BOOST_PP_FOR_600_I(s, p, o, m) BOOST_PP_IF(p(601, s), m, BOOST_PP_TUPLE_EAT_2)(601, s) BOOST_PP_IF(p(601, s), BOOST_PP_FOR_601, BOOST_PP_TUPLE_EAT_4)(o(601, s), p, o, m)
+# define BOOST_PP_FOR_601_I(s, p, o, m) BOOST_PP_IF(p(602, s), m, BOOST_PP_TUPLE_EAT_2)(602, s) BOOST_PP_IF(p(602, s), BOOST_PP_FOR_602, BOOST_PP_TUPLE_EAT_4)(o(602, s), p, o, m)
+# define BOOST_PP_FOR_602_I(s, p, o, m) BOOST_PP_IF(p(603, s), m, BOOST_PP_TUPLE_EAT_2)(603, s) BOOST_PP_IF(p(603, s), BOOST_PP_FOR_603, BOOST_PP_TUPLE_EAT_4)(o(603, s), p, o, m)
+# define BOOST_PP_FOR_603_I(s, p, o, m) BOOST_PP_IF(p(604, s), m, BOOST_PP_TUPLE_EAT_2)(604, s) BOOST_PP_IF(p(604, s), BOOST_PP_FOR_604, BOOST_PP_TUPLE_EAT_4)(o(604, s), p, o, m)
+# define BOOST_PP_FOR_604_I(s, p, o, m) BOOST_PP_IF(p(605, s), m, BOOST_PP_TUPLE_EAT_2)(605, s) BOOST_PP_IF(p(605, s), BOOST_PP_FOR_605, BOOST_PP_TUPLE_EAT_4)(o(605, s), p, o, m)
+# define BOOST_PP_FOR_605_I(s, p, o, m) BOOST_PP_IF(p(606, s), m, BOOST_PP_TUPLE_EAT_2)(606, s) BOOST_PP_IF(p(606, s), BOOST_PP_FOR_606, BOOST_PP_TUPLE_EAT_4)(o(606, s), p, o, m)
+# define BOOST_PP_FOR_606_I(s, p, o, m) BOOST_PP_IF(p(607, s), m, BOOST_PP_TUPLE_EAT_2)(607, s) BOOST_PP_IF(p(607, s), BOOST_PP_FOR_607, BOOST_PP_TUPLE_EAT_4)(o(607, s), p, o, m)
+# define BOOST_PP_FOR_607_I(s, p, o, m) BOOST_PP_IF(p(608, s), m, BOOST_PP_TUPLE_EAT_2)(608, s) BOOST_PP_IF(p(608, s), BOOST_PP_FOR_608, BOOST_PP_TUPLE_EAT_4)(o(608, s), p, o, m)
+# define BOOST_PP_FOR_608_I(s, p, o, m) BOOST_PP_IF(p(609, s), m, BOOST_PP_TUPLE_EAT_2)(609, s) BOOST_PP_IF(p(609, s), BOOST_PP_FOR_609, BOOST_PP_TUPLE_EAT_4)(o(609, s), p, o, m)
+# define BOOST_PP_FOR_609_I(s, p, o, m) BOOST_PP_IF(p(610, s), m, BOOST_PP_TUPLE_EAT_2)(610, s) BOOST_PP_IF(p(610, s), BOOST_PP_FOR_610, BOOST_PP_TUPLE_EAT_4)(o(610, s), p, o, m)
+# define BOOST_PP_FOR_610_I(s, p, o, m) BOOST_PP_IF(p(611, s), m, BOOST_PP_TUPLE_EAT_2)(611, s) BOOST_PP_IF(p(611, s), BOOST_PP_FOR_611, BOOST_PP_TUPLE_EAT_4)(o(611, s), p, o, m)
+# define BOOST_PP_FOR_611_I(s, p, o, m) BOOST_PP_IF(p(612, s), m, BOOST_PP_TUPLE_EAT_2)(612, s) BOOST_PP_IF(p(612, s), BOOST_PP_FOR_612, BOOST_PP_TUPLE_EAT_4)(o(612, s), p, o, m)
+# define BOOST_PP_FOR_612_I(s, p, o, m) BOOST_PP_IF(p(613, s), m, BOOST_PP_TUPLE_EAT_2)(613, s) BOOST_PP_IF(p(613, s), BOOST_PP_FOR_613, BOOST_PP_TUPLE_EAT_4)(o(613, s), p, o, m)
+# define BOOST_PP_FOR_613_I(s, p, o, m) BOOST_PP_IF(p(614, s), m, BOOST_PP_TUPLE_EAT_2)(614, s) BOOST_PP_IF(p(614, s), BOOST_PP_FOR_614, BOOST_PP_TUPLE_EAT_4)(o(614, s), p, o, m)
+# define BOOST_PP_FOR_614_I(s, p, o, m) BOOST_PP_IF(p(615, s), m, BOOST_PP_TUPLE_EAT_2)(615, s) BOOST_PP_IF(p(615, s), BOOST_PP_FOR_615, BOOST_PP_TUPLE_EAT_4)(o(615, s), p, o, m)
+# define BOOST_PP_FOR_615_I(s, p, o, m) BOOST_PP_IF(p(616, s), m, BOOST_PP_TUPLE_EAT_2)(616, s) BOOST_PP_IF(p(616, s), BOOST_PP_FOR_616, BOOST_PP_TUPLE_EAT_4)(o(616, s), p, o, m)
+# define BOOST_PP_FOR_616_I(s, p, o, m) BOOST_PP_IF(p(617, s), m, BOOST_PP_TUPLE_EAT_2)(617, s) BOOST_PP_IF(p(617, s), BOOST_PP_FOR_617, BOOST_PP_TUPLE_EAT_4)(o(617, s), p, o, m)
+# define BOOST_PP_FOR_617_I(s, p, o, m) BOOST_PP_IF(p(618, s), m, BOOST_PP_TUPLE_EAT_2)(618, s) BOOST_PP_IF(p(618, s), BOOST_PP_FOR_618, BOOST_PP_TUPLE_EAT_4)(o(618, s), p, o, m)
+# define BOOST_PP_FOR_618_I(s, p, o, m) BOOST_PP_IF(p(619, s), m, BOOST_PP_TUPLE_EAT_2)(619, s) BOOST_PP_IF(p(619, s), BOOST_PP_FOR_619, BOOST_PP_TUPLE_EAT_4)(o(619, s), p, o, m)
+# define BOOST_PP_FOR_619_I(s, p, o, m) BOOST_PP_IF(p(620, s), m, BOOST_PP_TUPLE_EAT_2)(620, s) BOOST_PP_IF(p(620, s), BOOST_PP_FOR_620, BOOST_PP_TUPLE_EAT_4)(o(620, s), p, o, m)
+# define BOOST_PP_FOR_620_I(s, p, o, m) BOOST_PP_IF(p(621, s), m, BOOST_PP_TUPLE_EAT_2)(621, s) BOOST_PP_IF(p(621, s), BOOST_PP_FOR_621, BOOST_PP_TUPLE_EAT_4)(o(621, s), p, o, m)
+# define BOOST_PP_FOR_621_I(s, p, o, m) BOOST_PP_IF(p(622, s), m, BOOST_PP_TUPLE_EAT_2)(622, s) BOOST_PP_IF(p(622, s), BOOST_PP_FOR_622, BOOST_PP_TUPLE_EAT_4)(o(622, s), p, o, m)
+# define BOOST_PP_FOR_622_I(s, p, o, m) BOOST_PP_IF(p(623, s), m, BOOST_PP_TUPLE_EAT_2)(623, s) BOOST_PP_IF(p(623, s), BOOST_PP_FOR_623, BOOST_PP_TUPLE_EAT_4)(o(623, s), p, o, m)
+# define BOOST_PP_FOR_623_I(s, p, o, m) BOOST_PP_IF(p(624, s), m, BOOST_PP_TUPLE_EAT_2)(624, s) BOOST_PP_IF(p(624, s), BOOST_PP_FOR_624, BOOST_PP_TUPLE_EAT_4)(o(624, s), p, o, m)
+# define BOOST_PP_FOR_624_I(s, p, o, m) BOOST_PP_IF(p(625, s), m, BOOST_PP_TUPLE_EAT_2)(625, s) BOOST_PP_IF(p(625, s), BOOST_PP_FOR_625, BOOST_PP_TUPLE_EAT_4)(o(625, s), p, o, m)
+# define BOOST_PP_FOR_625_I(s, p, o, m) BOOST_PP_IF(p(626, s), m, BOOST_PP_TUPLE_EAT_2)(626, s) BOOST_PP_IF(p(626, s), BOOST_PP_FOR_626, BOOST_PP_TUPLE_EAT_4)(o(626, s), p, o, m)
+# define BOOST_PP_FOR_626_I(s, p, o, m) BOOST_PP_IF(p(627, s), m, BOOST_PP_TUPLE_EAT_2)(627, s) BOOST_PP_IF(p(627, s), BOOST_PP_FOR_627, BOOST_PP_TUPLE_EAT_4)(o(627, s), p, o, m)
+# define BOOST_PP_FOR_627_I(s, p, o, m) BOOST_PP_IF(p(628, s), m, BOOST_PP_TUPLE_EAT_2)(628, s) BOOST_PP_IF(p(628, s), BOOST_PP_FOR_628, BOOST_PP_TUPLE_EAT_4)(o(628, s), p, o, m)
+# define BOOST_PP_FOR_628_I(s, p, o, m) BOOST_PP_IF(p(629, s), m, BOOST_PP_TUPLE_EAT_2)(629, s) BOOST_PP_IF(p(629, s), BOOST_PP_FOR_629, BOOST_PP_TUPLE_EAT_4)(o(629, s), p, o, m)
+# define BOOST_PP_FOR_629_I(s, p, o, m) BOOST_PP_IF(p(630, s), m, BOOST_PP_TUPLE_EAT_2)(630, s) BOOST_PP_IF(p(630, s), BOOST_PP_FOR_630, BOOST_PP_TUPLE_EAT_4)(o(630, s), p, o, m)
+# define BOOST_PP_FOR_630_I(s, p, o, m) BOOST_PP_IF(p(631, s), m, BOOST_PP_TUPLE_EAT_2)(631, s) BOOST_PP_IF(p(631, s), BOOST_PP_FOR_631, BOOST_PP_TUPLE_EAT_4)(o(631, s), p, o, m)
+# define BOOST_PP_FOR_631_I(s, p, o, m) BOOST_PP_IF(p(632, s), m, BOOST_PP_TUPLE_EAT_2)(632, s) BOOST_PP_IF(p(632, s), BOOST_PP_FOR_632, BOOST_PP_TUPLE_EAT_4)(o(632, s), p, o, m)
+# define BOOST_PP_FOR_632_I(s, p, o, m) BOOST_PP_IF(p(633, s), m, BOOST_PP_TUPLE_EAT_2)(633, s) BOOST_PP_IF(p(633, s), BOOST_PP_FOR_633, BOOST_PP_TUPLE_EAT_4)(o(633, s), p, o, m)
+# define BOOST_PP_FOR_633_I(s, p, o, m) BOOST_PP_IF(p(634, s), m, BOOST_PP_TUPLE_EAT_2)(634, s) BOOST_PP_IF(p(634, s), BOOST_PP_FOR_634, BOOST_PP_TUPLE_EAT_4)(o(634, s), p, o, m)
+# define BOOST_PP_FOR_634_I(s, p, o, m) BOOST_PP_IF(p(635, s), m, BOOST_PP_TUPLE_EAT_2)(635, s) BOOST_PP_IF(p(635, s), BOOST_PP_FOR_635, BOOST_PP_TUPLE_EAT_4)(o(635, s), p, o, m)
+# define BOOST_PP_FOR_635_I(s, p, o, m) BOOST_PP_IF(p(636, s), m, BOOST_PP_TUPLE_EAT_2)(636, s) BOOST_PP_IF(p(636, s), BOOST_PP_FOR_636, BOOST_PP_TUPLE_EAT_4)(o(636, s), p, o, m)
+# define BOOST_PP_FOR_636_I(s, p, o, m) BOOST_PP_IF(p(637, s), m, BOOST_PP_TUPLE_EAT_2)(637, s) BOOST_PP_IF(p(637, s), BOOST_PP_FOR_637, BOOST_PP_TUPLE_EAT_4)(o(637, s), p, o, m)
+# define BOOST_PP_FOR_637_I(s, p, o, m) BOOST_PP_IF(p(638, s), m, BOOST_PP_TUPLE_EAT_2)(638, s) BOOST_PP_IF(p(638, s), BOOST_PP_FOR_638, BOOST_PP_TUPLE_EAT_4)(o(638, s), p, o, m)
+# define BOOST_PP_FOR_638_I(s, p, o, m) BOOST_PP_IF(p(639, s), m, BOOST_PP_TUPLE_EAT_2)(639, s) BOOST_PP_IF(p(639, s), BOOST_PP_FOR_639, BOOST_PP_TUPLE_EAT_4)(o(639, s), p, o, m)
+# define BOOST_PP_FOR_639_I(s, p, o, m) BOOST_PP_IF(p(640, s), m, BOOST_PP_TUPLE_EAT_2)(640, s) BOOST_PP_IF(p(640, s), BOOST_PP_FOR_640, BOOST_PP_TUPLE_EAT_4)(o(640, s), p, o, m)
+# define BOOST_PP_FOR_640_I(s, p, o, m) BOOST_PP_IF(p(641, s), m, BOOST_PP_TUPLE_EAT_2)(641, s) BOOST_PP_IF(p(641, s), BOOST_PP_FOR_641, BOOST_PP_TUPLE_EAT_4)(o(641, s), p, o, m)
+# define BOOST_PP_FOR_641_I(s, p, o, m) BOOST_PP_IF(p(642, s), m, BOOST_PP_TUPLE_EAT_2)(642, s) BOOST_PP_IF(p(642, s), BOOST_PP_FOR_642, BOOST_PP_TUPLE_EAT_4)(o(642, s), p, o, m)
+# define BOOST_PP_FOR_642_I(s, p, o, m) BOOST_PP_IF(p(643, s), m, BOOST_PP_TUPLE_EAT_2)(643, s) BOOST_PP_IF(p(643, s), BOOST_PP_FOR_643, BOOST_PP_TUPLE_EAT_4)(o(643, s), p, o, m)
+# define BOOST_PP_FOR_643_I(s, p, o, m) BOOST_PP_IF(p(644, s), m, BOOST_PP_TUPLE_EAT_2)(644, s) BOOST_PP_IF(p(644, s), BOOST_PP_FOR_644, BOOST_PP_TUPLE_EAT_4)(o(644, s), p, o, m)
+# define BOOST_PP_FOR_644_I(s, p, o, m) BOOST_PP_IF(p(645, s), m, BOOST_PP_TUPLE_EAT_2)(645, s) BOOST_PP_IF(p(645, s), BOOST_PP_FOR_645, BOOST_PP_TUPLE_EAT_4)(o(645, s), p, o, m)
+# define BOOST_PP_FOR_645_I(s, p, o, m) BOOST_PP_IF(p(646, s), m, BOOST_PP_TUPLE_EAT_2)(646, s) BOOST_PP_IF(p(646, s), BOOST_PP_FOR_646, BOOST_PP_TUPLE_EAT_4)(o(646, s), p, o, m)
+# define BOOST_PP_FOR_646_I(s, p, o, m) BOOST_PP_IF(p(647, s), m, BOOST_PP_TUPLE_EAT_2)(647, s) BOOST_PP_IF(p(647, s), BOOST_PP_FOR_647, BOOST_PP_TUPLE_EAT_4)(o(647, s), p, o, m)
+# define BOOST_PP_FOR_647_I(s, p, o, m) BOOST_PP_IF(p(648, s), m, BOOST_PP_TUPLE_EAT_2)(648, s) BOOST_PP_IF(p(648, s), BOOST_PP_FOR_648, BOOST_PP_TUPLE_EAT_4)(o(648, s), p, o, m)
+# define BOOST_PP_FOR_648_I(s, p, o, m) BOOST_PP_IF(p(649, s), m, BOOST_PP_TUPLE_EAT_2)(649, s) BOOST_PP_IF(p(649, s), BOOST_PP_FOR_649, BOOST_PP_TUPLE_EAT_4)(o(649, s), p, o, m)
+# define BOOST_PP_FOR_649_I(s, p, o, m) BOOST_PP_IF(p(650, s), m, BOOST_PP_TUPLE_EAT_2)(650, s) BOOST_PP_IF(p(650, s), BOOST_PP_FOR_650, BOOST_PP_TUPLE_EAT_4)(o(650, s), p, o, m)
+# define BOOST_PP_FOR_650_I(s, p, o, m) BOOST_PP_IF(p(651, s), m, BOOST_PP_TUPLE_EAT_2)(651, s) BOOST_PP_IF(p(651, s), BOOST_PP_FOR_651, BOOST_PP_TUPLE_EAT_4)(o(651, s), p, o, m)
+# define BOOST_PP_FOR_651_I(s, p, o, m) BOOST_PP_IF(p(652, s), m, BOOST_PP_TUPLE_EAT_2)(652, s) BOOST_PP_IF(p(652, s), BOOST_PP_FOR_652, BOOST_PP_TUPLE_EAT_4)(o(652, s), p, o, m)
+# define BOOST_PP_FOR_652_I(s, p, o, m) BOOST_PP_IF(p(653, s), m, BOOST_PP_TUPLE_EAT_2)(653, s) BOOST_PP_IF(p(653, s), BOOST_PP_FOR_653, BOOST_PP_TUPLE_EAT_4)(o(653, s), p, o, m)
+# define BOOST_PP_FOR_653_I(s, p, o, m) BOOST_PP_IF(p(654, s), m, BOOST_PP_TUPLE_EAT_2)(654, s) BOOST_PP_IF(p(654, s), BOOST_PP_FOR_654, BOOST_PP_TUPLE_EAT_4)(o(654, s), p, o, m)
+# define BOOST_PP_FOR_654_I(s, p, o, m) BOOST_PP_IF(p(655, s), m, BOOST_PP_TUPLE_EAT_2)(655, s) BOOST_PP_IF(p(655, s), BOOST_PP_FOR_655, BOOST_PP_TUPLE_EAT_4)(o(655, s), p, o, m)
+# define BOOST_PP_FOR_655_I(s, p, o, m) BOOST_PP_IF(p(656, s), m, BOOST_PP_TUPLE_EAT_2)(656, s) BOOST_PP_IF(p(656, s), BOOST_PP_FOR_656, BOOST_PP_TUPLE_EAT_4)(o(656, s), p, o, m)
+# define BOOST_PP_FOR_656_I(s, p, o, m) BOOST_PP_IF(p(657, s), m, BOOST_PP_TUPLE_EAT_2)(657, s) BOOST_PP_IF(p(657, s), BOOST_PP_FOR_657, BOOST_PP_TUPLE_EAT_4)(o(657, s), p, o, m)
+# define BOOST_PP_FOR_657_I(s, p, o, m) BOOST_PP_IF(p(658, s), m, BOOST_PP_TUPLE_EAT_2)(658, s) BOOST_PP_IF(p(658, s), BOOST_PP_FOR_658, BOOST_PP_TUPLE_EAT_4)(o(658, s), p, o, m)
+# define BOOST_PP_FOR_658_I(s, p, o, m) BOOST_PP_IF(p(659, s), m, BOOST_PP_TUPLE_EAT_2)(659, s) BOOST_PP_IF(p(659, s), BOOST_PP_FOR_659, BOOST_PP_TUPLE_EAT_4)(o(659, s), p, o, m)
+# define BOOST_PP_FOR_659_I(s, p, o, m) BOOST_PP_IF(p(660, s), m, BOOST_PP_TUPLE_EAT_2)(660, s) BOOST_PP_IF(p(660, s), BOOST_PP_FOR_660, BOOST_PP_TUPLE_EAT_4)(o(660, s), p, o, m)
+# define BOOST_PP_FOR_660_I(s, p, o, m) BOOST_PP_IF(p(661, s), m, BOOST_PP_TUPLE_EAT_2)(661, s) BOOST_PP_IF(p(661, s), BOOST_PP_FOR_661, BOOST_PP_TUPLE_EAT_4)(o(661, s), p, o, m)
+# define BOOST_PP_FOR_661_I(s, p, o, m) BOOST_PP_IF(p(662, s), m, BOOST_PP_TUPLE_EAT_2)(662, s) BOOST_PP_IF(p(662, s), BOOST_PP_FOR_662, BOOST_PP_TUPLE_EAT_4)(o(662, s), p, o, m)
+# define BOOST_PP_FOR_662_I(s, p, o, m) BOOST_PP_IF(p(663, s), m, BOOST_PP_TUPLE_EAT_2)(663, s) BOOST_PP_IF(p(663, s), BOOST_PP_FOR_663, BOOST_PP_TUPLE_EAT_4)(o(663, s), p, o, m)
+# define BOOST_PP_FOR_663_I(s, p, o, m) BOOST_PP_IF(p(664, s), m, BOOST_PP_TUPLE_EAT_2)(664, s) BOOST_PP_IF(p(664, s), BOOST_PP_FOR_664, BOOST_PP_TUPLE_EAT_4)(o(664, s), p, o, m)
+# define BOOST_PP_FOR_664_I(s, p, o, m) BOOST_PP_IF(p(665, s), m, BOOST_PP_TUPLE_EAT_2)(665, s) BOOST_PP_IF(p(665, s), BOOST_PP_FOR_665, BOOST_PP_TUPLE_EAT_4)(o(665, s), p, o, m)
+# define BOOST_PP_FOR_665_I(s, p, o, m) BOOST_PP_IF(p(666, s), m, BOOST_PP_TUPLE_EAT_2)(666, s) BOOST_PP_IF(p(666, s), BOOST_PP_FOR_666, BOOST_PP_TUPLE_EAT_4)(o(666, s), p, o, m)
+# define BOOST_PP_FOR_666_I(s, p, o, m) BOOST_PP_IF(p(667, s), m, BOOST_PP_TUPLE_EAT_2)(667, s) BOOST_PP_IF(p(667, s), BOOST_PP_FOR_667, BOOST_PP_TUPLE_EAT_4)(o(667, s), p, o, m)
+# define BOOST_PP_FOR_667_I(s, p, o, m) BOOST_PP_IF(p(668, s), m, BOOST_PP_TUPLE_EAT_2)(668, s) BOOST_PP_IF(p(668, s), BOOST_PP_FOR_668, BOOST_PP_TUPLE_EAT_4)(o(668, s), p, o, m)
+# define BOOST_PP_FOR_668_I(s, p, o, m) BOOST_PP_IF(p(669, s), m, BOOST_PP_TUPLE_EAT_2)(669, s) BOOST_PP_IF(p(669, s), BOOST_PP_FOR_669, BOOST_PP_TUPLE_EAT_4)(o(669, s), p, o, m)
+# define BOOST_PP_FOR_669_I(s, p, o, m) BOOST_PP_IF(p(670, s), m, BOOST_PP_TUPLE_EAT_2)(670, s) BOOST_PP_IF(p(670, s), BOOST_PP_FOR_670, BOOST_PP_TUPLE_EAT_4)(o(670, s), p, o, m)
+# define BOOST_PP_FOR_670_I(s, p, o, m) BOOST_PP_IF(p(671, s), m, BOOST_PP_TUPLE_EAT_2)(671, s) BOOST_PP_IF(p(671, s), BOOST_PP_FOR_671, BOOST_PP_TUPLE_EAT_4)(o(671, s), p, o, m)
+# define BOOST_PP_FOR_671_I(s, p, o, m) BOOST_PP_IF(p(672, s), m, BOOST_PP_TUPLE_EAT_2)(672, s) BOOST_PP_IF(p(672, s), BOOST_PP_FOR_672, BOOST_PP_TUPLE_EAT_4)(o(672, s), p, o, m)
+# define BOOST_PP_FOR_672_I(s, p, o, m) BOOST_PP_IF(p(673, s), m, BOOST_PP_TUPLE_EAT_2)(673, s) BOOST_PP_IF(p(673, s), BOOST_PP_FOR_673, BOOST_PP_TUPLE_EAT_4)(o(673, s), p, o, m)
+# define BOOST_PP_FOR_673_I(s, p, o, m) BOOST_PP_IF(p(674, s), m, BOOST_PP_TUPLE_EAT_2)(674, s) BOOST_PP_IF(p(674, s), BOOST_PP_FOR_674, BOOST_PP_TUPLE_EAT_4)(o(674, s), p, o, m)
+# define BOOST_PP_FOR_674_I(s, p, o, m) BOOST_PP_IF(p(675, s), m, BOOST_PP_TUPLE_EAT_2)(675, s) BOOST_PP_IF(p(675, s), BOOST_PP_FOR_675, BOOST_PP_TUPLE_EAT_4)(o(675, s), p, o, m)
+# define BOOST_PP_FOR_675_I(s, p, o, m) BOOST_PP_IF(p(676, s), m, BOOST_PP_TUPLE_EAT_2)(676, s) BOOST_PP_IF(p(676, s), BOOST_PP_FOR_676, BOOST_PP_TUPLE_EAT_4)(o(676, s), p, o, m)
+# define BOOST_PP_FOR_676_I(s, p, o, m) BOOST_PP_IF(p(677, s), m, BOOST_PP_TUPLE_EAT_2)(677, s) BOOST_PP_IF(p(677, s), BOOST_PP_FOR_677, BOOST_PP_TUPLE_EAT_4)(o(677, s), p, o, m)
+# define BOOST_PP_FOR_677_I(s, p, o, m) BOOST_PP_IF(p(678, s), m, BOOST_PP_TUPLE_EAT_2)(678, s) BOOST_PP_IF(p(678, s), BOOST_PP_FOR_678, BOOST_PP_TUPLE_EAT_4)(o(678, s), p, o, m)
+# define BOOST_PP_FOR_678_I(s, p, o, m) BOOST_PP_IF(p(679, s), m, BOOST_PP_TUPLE_EAT_2)(679, s) BOOST_PP_IF(p(679, s), BOOST_PP_FOR_679, BOOST_PP_TUPLE_EAT_4)(o(679, s), p, o, m)
+# define BOOST_PP_FOR_679_I(s, p, o, m) BOOST_PP_IF(p(680, s), m, BOOST_PP_TUPLE_EAT_2)(680, s) BOOST_PP_IF(p(680, s), BOOST_PP_FOR_680, BOOST_PP_TUPLE_EAT_4)(o(680, s), p, o, m)
+# define BOOST_PP_FOR_680_I(s, p, o, m) BOOST_PP_IF(p(681, s), m, BOOST_PP_TUPLE_EAT_2)(681, s) BOOST_PP_IF(p(681, s), BOOST_PP_FOR_681, BOOST_PP_TUPLE_EAT_4)(o(681, s), p, o, m)
+# define BOOST_PP_FOR_681_I(s, p, o, m) BOOST_PP_IF(p(682, s), m, BOOST_PP_TUPLE_EAT_2)(682, s) BOOST_PP_IF(p(682, s), BOOST_PP_FOR_682, BOOST_PP_TUPLE_EAT_4)(o(682, s), p, o, m)
+# define BOOST_PP_FOR_682_I(s, p, o, m) BOOST_PP_IF(p(683, s), m, BOOST_PP_TUPLE_EAT_2)(683, s) BOOST_PP_IF(p(683, s), BOOST_PP_FOR_683, BOOST_PP_TUPLE_EAT_4)(o(683, s), p, o, m)
+# define BOOST_PP_FOR_683_I(s, p, o, m) BOOST_PP_IF(p(684, s), m, BOOST_PP_TUPLE_EAT_2)(684, s) BOOST_PP_IF(p(684, s), BOOST_PP_FOR_684, BOOST_PP_TUPLE_EAT_4)(o(684, s), p, o, m)
+# define BOOST_PP_FOR_684_I(s, p, o, m) BOOST_PP_IF(p(685, s), m, BOOST_PP_TUPLE_EAT_2)(685, s) BOOST_PP_IF(p(685, s), BOOST_PP_FOR_685, BOOST_PP_TUPLE_EAT_4)(o(685, s), p, o, m)
+# define BOOST_PP_FOR_685_I(s, p, o, m) BOOST_PP_IF(p(686, s), m, BOOST_PP_TUPLE_EAT_2)(686, s) BOOST_PP_IF(p(686, s), BOOST_PP_FOR_686, BOOST_PP_TUPLE_EAT_4)(o(686, s), p, o, m)
+# define BOOST_PP_FOR_686_I(s, p, o, m) BOOST_PP_IF(p(687, s), m, BOOST_PP_TUPLE_EAT_2)(687, s) BOOST_PP_IF(p(687, s), BOOST_PP_FOR_687, BOOST_PP_TUPLE_EAT_4)(o(687, s), p, o, m)
+# define BOOST_PP_FOR_687_I(s, p, o, m) BOOST_PP_IF(p(688, s), m, BOOST_PP_TUPLE_EAT_2)(688, s) BOOST_PP_IF(p(688, s), BOOST_PP_FOR_688, BOOST_PP_TUPLE_EAT_4)(o(688, s), p, o, m)
+# define BOOST_PP_FOR_688_I(s, p, o, m) BOOST_PP_IF(p(689, s), m, BOOST_PP_TUPLE_EAT_2)(689, s) BOOST_PP_IF(p(689, s), BOOST_PP_FOR_689, BOOST_PP_TUPLE_EAT_4)(o(689, s), p, o, m)
+# define BOOST_PP_FOR_689_I(s, p, o, m) BOOST_PP_IF(p(690, s), m, BOOST_PP_TUPLE_EAT_2)(690, s) BOOST_PP_IF(p(690, s), BOOST_PP_FOR_690, BOOST_PP_TUPLE_EAT_4)(o(690, s), p, o, m)
+# define BOOST_PP_FOR_690_I(s, p, o, m) BOOST_PP_IF(p(691, s), m, BOOST_PP_TUPLE_EAT_2)(691, s) BOOST_PP_IF(p(691, s), BOOST_PP_FOR_691, BOOST_PP_TUPLE_EAT_4)(o(691, s), p, o, m)
+# define BOOST_PP_FOR_691_I(s, p, o, m) BOOST_PP_IF(p(692, s), m, BOOST_PP_TUPLE_EAT_2)(692, s) BOOST_PP_IF(p(692, s), BOOST_PP_FOR_692, BOOST_PP_TUPLE_EAT_4)(o(692, s), p, o, m)
+# define BOOST_PP_FOR_692_I(s, p, o, m) BOOST_PP_IF(p(693, s), m, BOOST_PP_TUPLE_EAT_2)(693, s) BOOST_PP_IF(p(693, s), BOOST_PP_FOR_693, BOOST_PP_TUPLE_EAT_4)(o(693, s), p, o, m)
+# define BOOST_PP_FOR_693_I(s, p, o, m) BOOST_PP_IF(p(694, s), m, BOOST_PP_TUPLE_EAT_2)(694, s) BOOST_PP_IF(p(694, s), BOOST_PP_FOR_694, BOOST_PP_TUPLE_EAT_4)(o(694, s), p, o, m)
+# define BOOST_PP_FOR_694_I(s, p, o, m) BOOST_PP_IF(p(695, s), m, BOOST_PP_TUPLE_EAT_2)(695, s) BOOST_PP_IF(p(695, s), BOOST_PP_FOR_695, BOOST_PP_TUPLE_EAT_4)(o(695, s), p, o, m)
+# define BOOST_PP_FOR_695_I(s, p, o, m) BOOST_PP_IF(p(696, s), m, BOOST_PP_TUPLE_EAT_2)(696, s) BOOST_PP_IF(p(696, s), BOOST_PP_FOR_696, BOOST_PP_TUPLE_EAT_4)(o(696, s), p, o, m)
+# define BOOST_PP_FOR_696_I(s, p, o, m) BOOST_PP_IF(p(697, s), m, BOOST_PP_TUPLE_EAT_2)(697, s) BOOST_PP_IF(p(697, s), BOOST_PP_FOR_697, BOOST_PP_TUPLE_EAT_4)(o(697, s), p, o, m)
+# define BOOST_PP_FOR_697_I(s, p, o, m) BOOST_PP_IF(p(698, s), m, BOOST_PP_TUPLE_EAT_2)(698, s) BOOST_PP_IF(p(698, s), BOOST_PP_FOR_698, BOOST_PP_TUPLE_EAT_4)(o(698, s), p, o, m)
+# define BOOST_PP_FOR_698_I(s, p, o, m) BOOST_PP_IF(p(699, s), m, BOOST_PP_TUPLE_EAT_2)(699, s) BOOST_PP_IF(p(699, s), BOOST_PP_FOR_699, BOOST_PP_TUPLE_EAT_4)(o(699, s), p, o, m)
+# define BOOST_PP_FOR_699_I(s, p, o, m) BOOST_PP_IF(p(700, s), m, BOOST_PP_TUPLE_EAT_2)(700, s) BOOST_PP_IF(p(700, s), BOOST_PP_FOR_700, BOOST_PP_TUPLE_EAT_4)(o(700, s), p, o, m)
+# define BOOST_PP_FOR_700_I(s, p, o, m) BOOST_PP_IF(p(701, s), m, BOOST_PP_TUPLE_EAT_2)(701, s) BOOST_PP_IF(p(701, s), BOOST_PP_FOR_701, BOOST_PP_TUPLE_EAT_4)(o(701, s), p, o, m)
+# define BOOST_PP_FOR_701_I(s, p, o, m) BOOST_PP_IF(p(702, s), m, BOOST_PP_TUPLE_EAT_2)(702, s) BOOST_PP_IF(p(702, s), BOOST_PP_FOR_702, BOOST_PP_TUPLE_EAT_4)(o(702, s), p, o, m)
+# define BOOST_PP_FOR_702_I(s, p, o, m) BOOST_PP_IF(p(703, s), m, BOOST_PP_TUPLE_EAT_2)(703, s) BOOST_PP_IF(p(703, s), BOOST_PP_FOR_703, BOOST_PP_TUPLE_EAT_4)(o(703, s), p, o, m)
+# define BOOST_PP_FOR_703_I(s, p, o, m) BOOST_PP_IF(p(704, s), m, BOOST_PP_TUPLE_EAT_2)(704, s) BOOST_PP_IF(p(704, s), BOOST_PP_FOR_704, BOOST_PP_TUPLE_EAT_4)(o(704, s), p, o, m)
+# define BOOST_PP_FOR_704_I(s, p, o, m) BOOST_PP_IF(p(705, s), m, BOOST_PP_TUPLE_EAT_2)(705, s) BOOST_PP_IF(p(705, s), BOOST_PP_FOR_705, BOOST_PP_TUPLE_EAT_4)(o(705, s), p, o, m)
+# define BOOST_PP_FOR_705_I(s, p, o, m) BOOST_PP_IF(p(706, s), m, BOOST_PP_TUPLE_EAT_2)(706, s) BOOST_PP_IF(p(706, s), BOOST_PP_FOR_706, BOOST_PP_TUPLE_EAT_4)(o(706, s), p, o, m)
+# define BOOST_PP_FOR_706_I(s, p, o, m) BOOST_PP_IF(p(707, s), m, BOOST_PP_TUPLE_EAT_2)(707, s) BOOST_PP_IF(p(707, s), BOOST_PP_FOR_707, BOOST_PP_TUPLE_EAT_4)(o(707, s), p, o, m)
+# define BOOST_PP_FOR_707_I(s, p, o, m) BOOST_PP_IF(p(708, s), m, BOOST_PP_TUPLE_EAT_2)(708, s) BOOST_PP_IF(p(708, s), BOOST_PP_FOR_708, BOOST_PP_TUPLE_EAT_4)(o(708, s), p, o, m)
+# define BOOST_PP_FOR_708_I(s, p, o, m) BOOST_PP_IF(p(709, s), m, BOOST_PP_TUPLE_EAT_2)(709, s) BOOST_PP_IF(p(709, s), BOOST_PP_FOR_709, BOOST_PP_TUPLE_EAT_4)(o(709, s), p, o, m)
+# define BOOST_PP_FOR_709_I(s, p, o, m) BOOST_PP_IF(p(710, s), m, BOOST_PP_TUPLE_EAT_2)(710, s) BOOST_PP_IF(p(710, s), BOOST_PP_FOR_710, BOOST_PP_TUPLE_EAT_4)(o(710, s), p, o, m)
+# define BOOST_PP_FOR_710_I(s, p, o, m) BOOST_PP_IF(p(711, s), m, BOOST_PP_TUPLE_EAT_2)(711, s) BOOST_PP_IF(p(711, s), BOOST_PP_FOR_711, BOOST_PP_TUPLE_EAT_4)(o(711, s), p, o, m)
+# define BOOST_PP_FOR_711_I(s, p, o, m) BOOST_PP_IF(p(712, s), m, BOOST_PP_TUPLE_EAT_2)(712, s) BOOST_PP_IF(p(712, s), BOOST_PP_FOR_712, BOOST_PP_TUPLE_EAT_4)(o(712, s), p, o, m)
+# define BOOST_PP_FOR_712_I(s, p, o, m) BOOST_PP_IF(p(713, s), m, BOOST_PP_TUPLE_EAT_2)(713, s) BOOST_PP_IF(p(713, s), BOOST_PP_FOR_713, BOOST_PP_TUPLE_EAT_4)(o(713, s), p, o, m)
+# define BOOST_PP_FOR_713_I(s, p, o, m) BOOST_PP_IF(p(714, s), m, BOOST_PP_TUPLE_EAT_2)(714, s) BOOST_PP_IF(p(714, s), BOOST_PP_FOR_714, BOOST_PP_TUPLE_EAT_4)(o(714, s), p, o, m)
+# define BOOST_PP_FOR_714_I(s, p, o, m) BOOST_PP_IF(p(715, s), m, BOOST_PP_TUPLE_EAT_2)(715, s) BOOST_PP_IF(p(715, s), BOOST_PP_FOR_715, BOOST_PP_TUPLE_EAT_4)(o(715, s), p, o, m)
+# define BOOST_PP_FOR_715_I(s, p, o, m) BOOST_PP_IF(p(716, s), m, BOOST_PP_TUPLE_EAT_2)(716, s) BOOST_PP_IF(p(716, s), BOOST_PP_FOR_716, BOOST_PP_TUPLE_EAT_4)(o(716, s), p, o, m)
+# define BOOST_PP_FOR_716_I(s, p, o, m) BOOST_PP_IF(p(717, s), m, BOOST_PP_TUPLE_EAT_2)(717, s) BOOST_PP_IF(p(717, s), BOOST_PP_FOR_717, BOOST_PP_TUPLE_EAT_4)(o(717, s), p, o, m)
+# define BOOST_PP_FOR_717_I(s, p, o, m) BOOST_PP_IF(p(718, s), m, BOOST_PP_TUPLE_EAT_2)(718, s) BOOST_PP_IF(p(718, s), BOOST_PP_FOR_718, BOOST_PP_TUPLE_EAT_4)(o(718, s), p, o, m)
+# define BOOST_PP_FOR_718_I(s, p, o, m) BOOST_PP_IF(p(719, s), m, BOOST_PP_TUPLE_EAT_2)(719, s) BOOST_PP_IF(p(719, s), BOOST_PP_FOR_719, BOOST_PP_TUPLE_EAT_4)(o(719, s), p, o, m)
+# define BOOST_PP_FOR_719_I(s, p, o, m) BOOST_PP_IF(p(720, s), m, BOOST_PP_TUPLE_EAT_2)(720, s) BOOST_PP_IF(p(720, s), BOOST_PP_FOR_720, BOOST_PP_TUPLE_EAT_4)(o(720, s), p, o, m)
+# define BOOST_PP_FOR_720_I(s, p, o, m) BOOST_PP_IF(p(721, s), m, BOOST_PP_TUPLE_EAT_2)(721, s) BOOST_PP_IF(p(721, s), BOOST_PP_FOR_721, BOOST_PP_TUPLE_EAT_4)(o(721, s), p, o, m)
+# define BOOST_PP_FOR_721_I(s, p, o, m) BOOST_PP_IF(p(722, s), m, BOOST_PP_TUPLE_EAT_2)(722, s) BOOST_PP_IF(p(722, s), BOOST_PP_FOR_722, BOOST_PP_TUPLE_EAT_4)(o(722, s), p, o, m)
+# define BOOST_PP_FOR_722_I(s, p, o, m) BOOST_PP_IF(p(723, s), m, BOOST_PP_TUPLE_EAT_2)(723, s) BOOST_PP_IF(p(723, s), BOOST_PP_FOR_723, BOOST_PP_TUPLE_EAT_4)(o(723, s), p, o, m)
+# define BOOST_PP_FOR_723_I(s, p, o, m) BOOST_PP_IF(p(724, s), m, BOOST_PP_TUPLE_EAT_2)(724, s) BOOST_PP_IF(p(724, s), BOOST_PP_FOR_724, BOOST_PP_TUPLE_EAT_4)(o(724, s), p, o, m)
+# define BOOST_PP_FOR_724_I(s, p, o, m) BOOST_PP_IF(p(725, s), m, BOOST_PP_TUPLE_EAT_2)(725, s) BOOST_PP_IF(p(725, s), BOOST_PP_FOR_725, BOOST_PP_TUPLE_EAT_4)(o(725, s), p, o, m)
+# define BOOST_PP_FOR_725_I(s, p, o, m) BOOST_PP_IF(p(726, s), m, BOOST_PP_TUPLE_EAT_2)(726, s) BOOST_PP_IF(p(726, s), BOOST_PP_FOR_726, BOOST_PP_TUPLE_EAT_4)(o(726, s), p, o, m)
+# define BOOST_PP_FOR_726_I(s, p, o, m) BOOST_PP_IF(p(727, s), m, BOOST_PP_TUPLE_EAT_2)(727, s) BOOST_PP_IF(p(727, s), BOOST_PP_FOR_727, BOOST_PP_TUPLE_EAT_4)(o(727, s), p, o, m)
+# define BOOST_PP_FOR_727_I(s, p, o, m) BOOST_PP_IF(p(728, s), m, BOOST_PP_TUPLE_EAT_2)(728, s) BOOST_PP_IF(p(728, s), BOOST_PP_FOR_728, BOOST_PP_TUPLE_EAT_4)(o(728, s), p, o, m)
+# define BOOST_PP_FOR_728_I(s, p, o, m) BOOST_PP_IF(p(729, s), m, BOOST_PP_TUPLE_EAT_2)(729, s) BOOST_PP_IF(p(729, s), BOOST_PP_FOR_729, BOOST_PP_TUPLE_EAT_4)(o(729, s), p, o, m)
+# define BOOST_PP_FOR_729_I(s, p, o, m) BOOST_PP_IF(p(730, s), m, BOOST_PP_TUPLE_EAT_2)(730, s) BOOST_PP_IF(p(730, s), BOOST_PP_FOR_730, BOOST_PP_TUPLE_EAT_4)(o(730, s), p, o, m)
+# define BOOST_PP_FOR_730_I(s, p, o, m) BOOST_PP_IF(p(731, s), m, BOOST_PP_TUPLE_EAT_2)(731, s) BOOST_PP_IF(p(731, s), BOOST_PP_FOR_731, BOOST_PP_TUPLE_EAT_4)(o(731, s), p, o, m)
+# define BOOST_PP_FOR_731_I(s, p, o, m) BOOST_PP_IF(p(732, s), m, BOOST_PP_TUPLE_EAT_2)(732, s) BOOST_PP_IF(p(732, s), BOOST_PP_FOR_732, BOOST_PP_TUPLE_EAT_4)(o(732, s), p, o, m)
+# define BOOST_PP_FOR_732_I(s, p, o, m) BOOST_PP_IF(p(733, s), m, BOOST_PP_TUPLE_EAT_2)(733, s) BOOST_PP_IF(p(733, s), BOOST_PP_FOR_733, BOOST_PP_TUPLE_EAT_4)(o(733, s), p, o, m)
+# define BOOST_PP_FOR_733_I(s, p, o, m) BOOST_PP_IF(p(734, s), m, BOOST_PP_TUPLE_EAT_2)(734, s) BOOST_PP_IF(p(734, s), BOOST_PP_FOR_734, BOOST_PP_TUPLE_EAT_4)(o(734, s), p, o, m)
+# define BOOST_PP_FOR_734_I(s, p, o, m) BOOST_PP_IF(p(735, s), m, BOOST_PP_TUPLE_EAT_2)(735, s) BOOST_PP_IF(p(735, s), BOOST_PP_FOR_735, BOOST_PP_TUPLE_EAT_4)(o(735, s), p, o, m)
+# define BOOST_PP_FOR_735_I(s, p, o, m) BOOST_PP_IF(p(736, s), m, BOOST_PP_TUPLE_EAT_2)(736, s) BOOST_PP_IF(p(736, s), BOOST_PP_FOR_736, BOOST_PP_TUPLE_EAT_4)(o(736, s), p, o, m)
+# define BOOST_PP_FOR_736_I(s, p, o, m) BOOST_PP_IF(p(737, s), m, BOOST_PP_TUPLE_EAT_2)(737, s) BOOST_PP_IF(p(737, s), BOOST_PP_FOR_737, BOOST_PP_TUPLE_EAT_4)(o(737, s), p, o, m)
+# define BOOST_PP_FOR_737_I(s, p, o, m) BOOST_PP_IF(p(738, s), m, BOOST_PP_TUPLE_EAT_2)(738, s) BOOST_PP_IF(p(738, s), BOOST_PP_FOR_738, BOOST_PP_TUPLE_EAT_4)(o(738, s), p, o, m)
+# define BOOST_PP_FOR_738_I(s, p, o, m) BOOST_PP_IF(p(739, s), m, BOOST_PP_TUPLE_EAT_2)(739, s) BOOST_PP_IF(p(739, s), BOOST_PP_FOR_739, BOOST_PP_TUPLE_EAT_4)(o(739, s), p, o, m)
+# define BOOST_PP_FOR_739_I(s, p, o, m) BOOST_PP_IF(p(740, s), m, BOOST_PP_TUPLE_EAT_2)(740, s) BOOST_PP_IF(p(740, s), BOOST_PP_FOR_740, BOOST_PP_TUPLE_EAT_4)(o(740, s), p, o, m)
+# define BOOST_PP_FOR_740_I(s, p, o, m) BOOST_PP_IF(p(741, s), m, BOOST_PP_TUPLE_EAT_2)(741, s) BOOST_PP_IF(p(741, s), BOOST_PP_FOR_741, BOOST_PP_TUPLE_EAT_4)(o(741, s), p, o, m)
+# define BOOST_PP_FOR_741_I(s, p, o, m) BOOST_PP_IF(p(742, s), m, BOOST_PP_TUPLE_EAT_2)(742, s) BOOST_PP_IF(p(742, s), BOOST_PP_FOR_742, BOOST_PP_TUPLE_EAT_4)(o(742, s), p, o, m)
+# define BOOST_PP_FOR_742_I(s, p, o, m) BOOST_PP_IF(p(743, s), m, BOOST_PP_TUPLE_EAT_2)(743, s) BOOST_PP_IF(p(743, s), BOOST_PP_FOR_743, BOOST_PP_TUPLE_EAT_4)(o(743, s), p, o, m)
+# define BOOST_PP_FOR_743_I(s, p, o, m) BOOST_PP_IF(p(744, s), m, BOOST_PP_TUPLE_EAT_2)(744, s) BOOST_PP_IF(p(744, s), BOOST_PP_FOR_744, BOOST_PP_TUPLE_EAT_4)(o(744, s), p, o, m)
+# define BOOST_PP_FOR_744_I(s, p, o, m) BOOST_PP_IF(p(745, s), m, BOOST_PP_TUPLE_EAT_2)(745, s) BOOST_PP_IF(p(745, s), BOOST_PP_FOR_745, BOOST_PP_TUPLE_EAT_4)(o(745, s), p, o, m)
+# define BOOST_PP_FOR_745_I(s, p, o, m) BOOST_PP_IF(p(746, s), m, BOOST_PP_TUPLE_EAT_2)(746, s) BOOST_PP_IF(p(746, s), BOOST_PP_FOR_746, BOOST_PP_TUPLE_EAT_4)(o(746, s), p, o, m)
+# define BOOST_PP_FOR_746_I(s, p, o, m) BOOST_PP_IF(p(747, s), m, BOOST_PP_TUPLE_EAT_2)(747, s) BOOST_PP_IF(p(747, s), BOOST_PP_FOR_747, BOOST_PP_TUPLE_EAT_4)(o(747, s), p, o, m)
+# define BOOST_PP_FOR_747_I(s, p, o, m) BOOST_PP_IF(p(748, s), m, BOOST_PP_TUPLE_EAT_2)(748, s) BOOST_PP_IF(p(748, s), BOOST_PP_FOR_748, BOOST_PP_TUPLE_EAT_4)(o(748, s), p, o, m)
+# define BOOST_PP_FOR_748_I(s, p, o, m) BOOST_PP_IF(p(749, s), m, BOOST_PP_TUPLE_EAT_2)(749, s) BOOST_PP_IF(p(749, s), BOOST_PP_FOR_749, BOOST_PP_TUPLE_EAT_4)(o(749, s), p, o, m)
+# define BOOST_PP_FOR_749_I(s, p, o, m) BOOST_PP_IF(p(750, s), m, BOOST_PP_TUPLE_EAT_2)(750, s) BOOST_PP_IF(p(750, s), BOOST_PP_FOR_750, BOOST_PP_TUPLE_EAT_4)(o(750, s), p, o, m)
+# define BOOST_PP_FOR_750_I(s, p, o, m) BOOST_PP_IF(p(751, s), m, BOOST_PP_TUPLE_EAT_2)(751, s) BOOST_PP_IF(p(751, s), BOOST_PP_FOR_751, BOOST_PP_TUPLE_EAT_4)(o(751, s), p, o, m)
+# define BOOST_PP_FOR_751_I(s, p, o, m) BOOST_PP_IF(p(752, s), m, BOOST_PP_TUPLE_EAT_2)(752, s) BOOST_PP_IF(p(752, s), BOOST_PP_FOR_752, BOOST_PP_TUPLE_EAT_4)(o(752, s), p, o, m)
+# define BOOST_PP_FOR_752_I(s, p, o, m) BOOST_PP_IF(p(753, s), m, BOOST_PP_TUPLE_EAT_2)(753, s) BOOST_PP_IF(p(753, s), BOOST_PP_FOR_753, BOOST_PP_TUPLE_EAT_4)(o(753, s), p, o, m)
+# define BOOST_PP_FOR_753_I(s, p, o, m) BOOST_PP_IF(p(754, s), m, BOOST_PP_TUPLE_EAT_2)(754, s) BOOST_PP_IF(p(754, s), BOOST_PP_FOR_754, BOOST_PP_TUPLE_EAT_4)(o(754, s), p, o, m)
+# define BOOST_PP_FOR_754_I(s, p, o, m) BOOST_PP_IF(p(755, s), m, BOOST_PP_TUPLE_EAT_2)(755, s) BOOST_PP_IF(p(755, s), BOOST_PP_FOR_755, BOOST_PP_TUPLE_EAT_4)(o(755, s), p, o, m)
+# define BOOST_PP_FOR_755_I(s, p, o, m) BOOST_PP_IF(p(756, s), m, BOOST_PP_TUPLE_EAT_2)(756, s) BOOST_PP_IF(p(756, s), BOOST_PP_FOR_756, BOOST_PP_TUPLE_EAT_4)(o(756, s), p, o, m)
+# define BOOST_PP_FOR_756_I(s, p, o, m) BOOST_PP_IF(p(757, s), m, BOOST_PP_TUPLE_EAT_2)(757, s) BOOST_PP_IF(p(757, s), BOOST_PP_FOR_757, BOOST_PP_TUPLE_EAT_4)(o(757, s), p, o, m)
+# define BOOST_PP_FOR_757_I(s, p, o, m) BOOST_PP_IF(p(758, s), m, BOOST_PP_TUPLE_EAT_2)(758, s) BOOST_PP_IF(p(758, s), BOOST_PP_FOR_758, BOOST_PP_TUPLE_EAT_4)(o(758, s), p, o, m)
+# define BOOST_PP_FOR_758_I(s, p, o, m) BOOST_PP_IF(p(759, s), m, BOOST_PP_TUPLE_EAT_2)(759, s) BOOST_PP_IF(p(759, s), BOOST_PP_FOR_759, BOOST_PP_TUPLE_EAT_4)(o(759, s), p, o, m)
+# define BOOST_PP_FOR_759_I(s, p, o, m) BOOST_PP_IF(p(760, s), m, BOOST_PP_TUPLE_EAT_2)(760, s) BOOST_PP_IF(p(760, s), BOOST_PP_FOR_760, BOOST_PP_TUPLE_EAT_4)(o(760, s), p, o, m)
+# define BOOST_PP_FOR_760_I(s, p, o, m) BOOST_PP_IF(p(761, s), m, BOOST_PP_TUPLE_EAT_2)(761, s) BOOST_PP_IF(p(761, s), BOOST_PP_FOR_761, BOOST_PP_TUPLE_EAT_4)(o(761, s), p, o, m)
+# define BOOST_PP_FOR_761_I(s, p, o, m) BOOST_PP_IF(p(762, s), m, BOOST_PP_TUPLE_EAT_2)(762, s) BOOST_PP_IF(p(762, s), BOOST_PP_FOR_762, BOOST_PP_TUPLE_EAT_4)(o(762, s), p, o, m)
+# define BOOST_PP_FOR_762_I(s, p, o, m) BOOST_PP_IF(p(763, s), m, BOOST_PP_TUPLE_EAT_2)(763, s) BOOST_PP_IF(p(763, s), BOOST_PP_FOR_763, BOOST_PP_TUPLE_EAT_4)(o(763, s), p, o, m)
+# define BOOST_PP_FOR_763_I(s, p, o, m) BOOST_PP_IF(p(764, s), m, BOOST_PP_TUPLE_EAT_2)(764, s) BOOST_PP_IF(p(764, s), BOOST_PP_FOR_764, BOOST_PP_TUPLE_EAT_4)(o(764, s), p, o, m)
+# define BOOST_PP_FOR_764_I(s, p, o, m) BOOST_PP_IF(p(765, s), m, BOOST_PP_TUPLE_EAT_2)(765, s) BOOST_PP_IF(p(765, s), BOOST_PP_FOR_765, BOOST_PP_TUPLE_EAT_4)(o(765, s), p, o, m)
+# define BOOST_PP_FOR_765_I(s, p, o, m) BOOST_PP_IF(p(766, s), m, BOOST_PP_TUPLE_EAT_2)(766, s) BOOST_PP_IF(p(766, s), BOOST_PP_FOR_766, BOOST_PP_TUPLE_EAT_4)(o(766, s), p, o, m)
+# define BOOST_PP_FOR_766_I(s, p, o, m) BOOST_PP_IF(p(767, s), m, BOOST_PP_TUPLE_EAT_2)(767, s) BOOST_PP_IF(p(767, s), BOOST_PP_FOR_767, BOOST_PP_TUPLE_EAT_4)(o(767, s), p, o, m)
+# define BOOST_PP_FOR_767_I(s, p, o, m) BOOST_PP_IF(p(768, s), m, BOOST_PP_TUPLE_EAT_2)(768, s) BOOST_PP_IF(p(768, s), BOOST_PP_FOR_768, BOOST_PP_TUPLE_EAT_4)(o(768, s), p, o, m)
+# define BOOST_PP_FOR_768_I(s, p, o, m) BOOST_PP_IF(p(769, s), m, BOOST_PP_TUPLE_EAT_2)(769, s) BOOST_PP_IF(p(769, s), BOOST_PP_FOR_769, BOOST_PP_TUPLE_EAT_4)(o(769, s), p, o, m)
+# define BOOST_PP_FOR_769_I(s, p, o, m) BOOST_PP_IF(p(770, s), m, BOOST_PP_TUPLE_EAT_2)(770, s) BOOST_PP_IF(p(770, s), BOOST_PP_FOR_770, BOOST_PP_TUPLE_EAT_4)(o(770, s), p, o, m)
+# define BOOST_PP_FOR_770_I(s, p, o, m) BOOST_PP_IF(p(771, s), m, BOOST_PP_TUPLE_EAT_2)(771, s) BOOST_PP_IF(p(771, s), BOOST_PP_FOR_771, BOOST_PP_TUPLE_EAT_4)(o(771, s), p, o, m)
+# define BOOST_PP_FOR_771_I(s, p, o, m) BOOST_PP_IF(p(772, s), m, BOOST_PP_TUPLE_EAT_2)(772, s) BOOST_PP_IF(p(772, s), BOOST_PP_FOR_772, BOOST_PP_TUPLE_EAT_4)(o(772, s), p, o, m)
+# define BOOST_PP_FOR_772_I(s, p, o, m) BOOST_PP_IF(p(773, s), m, BOOST_PP_TUPLE_EAT_2)(773, s) BOOST_PP_IF(p(773, s), BOOST_PP_FOR_773, BOOST_PP_TUPLE_EAT_4)(o(773, s), p, o, m)
+# define BOOST_PP_FOR_773_I(s, p, o, m) BOOST_PP_IF(p(774, s), m, BOOST_PP_TUPLE_EAT_2)(774, s) BOOST_PP_IF(p(774, s), BOOST_PP_FOR_774, BOOST_PP_TUPLE_EAT_4)(o(774, s), p, o, m)
+# define BOOST_PP_FOR_774_I(s, p, o, m) BOOST_PP_IF(p(775, s), m, BOOST_PP_TUPLE_EAT_2)(775, s) BOOST_PP_IF(p(775, s), BOOST_PP_FOR_775, BOOST_PP_TUPLE_EAT_4)(o(775, s), p, o, m)
+# define BOOST_PP_FOR_775_I(s, p, o, m) BOOST_PP_IF(p(776, s), m, BOOST_PP_TUPLE_EAT_2)(776, s) BOOST_PP_IF(p(776, s), BOOST_PP_FOR_776, BOOST_PP_TUPLE_EAT_4)(o(776, s), p, o, m)
+# define BOOST_PP_FOR_776_I(s, p, o, m) BOOST_PP_IF(p(777, s), m, BOOST_PP_TUPLE_EAT_2)(777, s) BOOST_PP_IF(p(777, s), BOOST_PP_FOR_777, BOOST_PP_TUPLE_EAT_4)(o(777, s), p, o, m)
+# define BOOST_PP_FOR_777_I(s, p, o, m) BOOST_PP_IF(p(778, s), m, BOOST_PP_TUPLE_EAT_2)(778, s) BOOST_PP_IF(p(778, s), BOOST_PP_FOR_778, BOOST_PP_TUPLE_EAT_4)(o(778, s), p, o, m)
+# define BOOST_PP_FOR_778_I(s, p, o, m) BOOST_PP_IF(p(779, s), m, BOOST_PP_TUPLE_EAT_2)(779, s) BOOST_PP_IF(p(779, s), BOOST_PP_FOR_779, BOOST_PP_TUPLE_EAT_4)(o(779, s), p, o, m)
+# define BOOST_PP_FOR_779_I(s, p, o, m) BOOST_PP_IF(p(780, s), m, BOOST_PP_TUPLE_EAT_2)(780, s) BOOST_PP_IF(p(780, s), BOOST_PP_FOR_780, BOOST_PP_TUPLE_EAT_4)(o(780, s), p, o, m)
+# define BOOST_PP_FOR_780_I(s, p, o, m) BOOST_PP_IF(p(781, s), m, BOOST_PP_TUPLE_EAT_2)(781, s) BOOST_PP_IF(p(781, s), BOOST_PP_FOR_781, BOOST_PP_TUPLE_EAT_4)(o(781, s), p, o, m)
+# define BOOST_PP_FOR_781_I(s, p, o, m) BOOST_PP_IF(p(782, s), m, BOOST_PP_TUPLE_EAT_2)(782, s) BOOST_PP_IF(p(782, s), BOOST_PP_FOR_782, BOOST_PP_TUPLE_EAT_4)(o(782, s), p, o, m)
+# define BOOST_PP_FOR_782_I(s, p, o, m) BOOST_PP_IF(p(783, s), m, BOOST_PP_TUPLE_EAT_2)(783, s) BOOST_PP_IF(p(783, s), BOOST_PP_FOR_783, BOOST_PP_TUPLE_EAT_4)(o(783, s), p, o, m)
+# define BOOST_PP_FOR_783_I(s, p, o, m) BOOST_PP_IF(p(784, s), m, BOOST_PP_TUPLE_EAT_2)(784, s) BOOST_PP_IF(p(784, s), BOOST_PP_FOR_784, BOOST_PP_TUPLE_EAT_4)(o(784, s), p, o, m)
+# define BOOST_PP_FOR_784_I(s, p, o, m) BOOST_PP_IF(p(785, s), m, BOOST_PP_TUPLE_EAT_2)(785, s) BOOST_PP_IF(p(785, s), BOOST_PP_FOR_785, BOOST_PP_TUPLE_EAT_4)(o(785, s), p, o, m)
+# define BOOST_PP_FOR_785_I(s, p, o, m) BOOST_PP_IF(p(786, s), m, BOOST_PP_TUPLE_EAT_2)(786, s) BOOST_PP_IF(p(786, s), BOOST_PP_FOR_786, BOOST_PP_TUPLE_EAT_4)(o(786, s), p, o, m)
+# define BOOST_PP_FOR_786_I(s, p, o, m) BOOST_PP_IF(p(787, s), m, BOOST_PP_TUPLE_EAT_2)(787, s) BOOST_PP_IF(p(787, s), BOOST_PP_FOR_787, BOOST_PP_TUPLE_EAT_4)(o(787, s), p, o, m)
+# define BOOST_PP_FOR_787_I(s, p, o, m) BOOST_PP_IF(p(788, s), m, BOOST_PP_TUPLE_EAT_2)(788, s) BOOST_PP_IF(p(788, s), BOOST_PP_FOR_788, BOOST_PP_TUPLE_EAT_4)(o(788, s), p, o, m)
+# define BOOST_PP_FOR_788_I(s, p, o, m) BOOST_PP_IF(p(789, s), m, BOOST_PP_TUPLE_EAT_2)(789, s) BOOST_PP_IF(p(789, s), BOOST_PP_FOR_789, BOOST_PP_TUPLE_EAT_4)(o(789, s), p, o, m)
+# define BOOST_PP_FOR_789_I(s, p, o, m) BOOST_PP_IF(p(790, s), m, BOOST_PP_TUPLE_EAT_2)(790, s) BOOST_PP_IF(p(790, s), BOOST_PP_FOR_790, BOOST_PP_TUPLE_EAT_4)(o(790, s), p, o, m)
+# define BOOST_PP_FOR_790_I(s, p, o, m) BOOST_PP_IF(p(791, s), m, BOOST_PP_TUPLE_EAT_2)(791, s) BOOST_PP_IF(p(791, s), BOOST_PP_FOR_791, BOOST_PP_TUPLE_EAT_4)(o(791, s), p, o, m)
+# define BOOST_PP_FOR_791_I(s, p, o, m) BOOST_PP_IF(p(792, s), m, BOOST_PP_TUPLE_EAT_2)(792, s) BOOST_PP_IF(p(792, s), BOOST_PP_FOR_792, BOOST_PP_TUPLE_EAT_4)(o(792, s), p, o, m)
+# define BOOST_PP_FOR_792_I(s, p, o, m) BOOST_PP_IF(p(793, s), m, BOOST_PP_TUPLE_EAT_2)(793, s) BOOST_PP_IF(p(793, s), BOOST_PP_FOR_793, BOOST_PP_TUPLE_EAT_4)(o(793, s), p, o, m)
+# define BOOST_PP_FOR_793_I(s, p, o, m) BOOST_PP_IF(p(794, s), m, BOOST_PP_TUPLE_EAT_2)(794, s) BOOST_PP_IF(p(794, s), BOOST_PP_FOR_794, BOOST_PP_TUPLE_EAT_4)(o(794, s), p, o, m)
+# define BOOST_PP_FOR_794_I(s, p, o, m) BOOST_PP_IF(p(795, s), m, BOOST_PP_TUPLE_EAT_2)(795, s) BOOST_PP_IF(p(795, s), BOOST_PP_FOR_795, BOOST_PP_TUPLE_EAT_4)(o(795, s), p, o, m)
+# define BOOST_PP_FOR_795_I(s, p, o, m) BOOST_PP_IF(p(796, s), m, BOOST_PP_TUPLE_EAT_2)(796, s) BOOST_PP_IF(p(796, s), BOOST_PP_FOR_796, BOOST_PP_TUPLE_EAT_4)(o(796, s), p, o, m)
+# define BOOST_PP_FOR_796_I(s, p, o, m) BOOST_PP_IF(p(797, s), m, BOOST_PP_TUPLE_EAT_2)(797, s) BOOST_PP_IF(p(797, s), BOOST_PP_FOR_797, BOOST_PP_TUPLE_EAT_4)(o(797, s), p, o, m)
+# define BOOST_PP_FOR_797_I(s, p, o, m) BOOST_PP_IF(p(798, s), m, BOOST_PP_TUPLE_EAT_2)(798, s) BOOST_PP_IF(p(798, s), BOOST_PP_FOR_798, BOOST_PP_TUPLE_EAT_4)(o(798, s), p, o, m)
+# define BOOST_PP_FOR_798_I(s, p, o, m) BOOST_PP_IF(p(799, s), m, BOOST_PP_TUPLE_EAT_2)(799, s) BOOST_PP_IF(p(799, s), BOOST_PP_FOR_799, BOOST_PP_TUPLE_EAT_4)(o(799, s), p, o, m)
+# define BOOST_PP_FOR_799_I(s, p, o, m) BOOST_PP_IF(p(800, s), m, BOOST_PP_TUPLE_EAT_2)(800, s) BOOST_PP_IF(p(800, s), BOOST_PP_FOR_800, BOOST_PP_TUPLE_EAT_4)(o(800, s), p, o, m)
+# define BOOST_PP_FOR_800_I(s, p, o, m) BOOST_PP_IF(p(801, s), m, BOOST_PP_TUPLE_EAT_2)(801, s) BOOST_PP_IF(p(801, s), BOOST_PP_FOR_801, BOOST_PP_TUPLE_EAT_4)(o(801, s), p, o, m)
+# define BOOST_PP_FOR_801_I(s, p, o, m) BOOST_PP_IF(p(802, s), m, BOOST_PP_TUPLE_EAT_2)(802, s) BOOST_PP_IF(p(802, s), BOOST_PP_FOR_802, BOOST_PP_TUPLE_EAT_4)(o(802, s), p, o, m)
+# define BOOST_PP_FOR_802_I(s, p, o, m) BOOST_PP_IF(p(803, s), m, BOOST_PP_TUPLE_EAT_2)(803, s) BOOST_PP_IF(p(803, s), BOOST_PP_FOR_803, BOOST_PP_TUPLE_EAT_4)(o(803, s), p, o, m)
+# define BOOST_PP_FOR_803_I(s, p, o, m) BOOST_PP_IF(p(804, s), m, BOOST_PP_TUPLE_EAT_2)(804, s) BOOST_PP_IF(p(804, s), BOOST_PP_FOR_804, BOOST_PP_TUPLE_EAT_4)(o(804, s), p, o, m)
+# define BOOST_PP_FOR_804_I(s, p, o, m) BOOST_PP_IF(p(805, s), m, BOOST_PP_TUPLE_EAT_2)(805, s) BOOST_PP_IF(p(805, s), BOOST_PP_FOR_805, BOOST_PP_TUPLE_EAT_4)(o(805, s), p, o, m)
+# define BOOST_PP_FOR_805_I(s, p, o, m) BOOST_PP_IF(p(806, s), m, BOOST_PP_TUPLE_EAT_2)(806, s) BOOST_PP_IF(p(806, s), BOOST_PP_FOR_806, BOOST_PP_TUPLE_EAT_4)(o(806, s), p, o, m)
+# define BOOST_PP_FOR_806_I(s, p, o, m) BOOST_PP_IF(p(807, s), m, BOOST_PP_TUPLE_EAT_2)(807, s) BOOST_PP_IF(p(807, s), BOOST_PP_FOR_807, BOOST_PP_TUPLE_EAT_4)(o(807, s), p, o, m)
+# define BOOST_PP_FOR_807_I(s, p, o, m) BOOST_PP_IF(p(808, s), m, BOOST_PP_TUPLE_EAT_2)(808, s) BOOST_PP_IF(p(808, s), BOOST_PP_FOR_808, BOOST_PP_TUPLE_EAT_4)(o(808, s), p, o, m)
+# define BOOST_PP_FOR_808_I(s, p, o, m) BOOST_PP_IF(p(809, s), m, BOOST_PP_TUPLE_EAT_2)(809, s) BOOST_PP_IF(p(809, s), BOOST_PP_FOR_809, BOOST_PP_TUPLE_EAT_4)(o(809, s), p, o, m)
+# define BOOST_PP_FOR_809_I(s, p, o, m) BOOST_PP_IF(p(810, s), m, BOOST_PP_TUPLE_EAT_2)(810, s) BOOST_PP_IF(p(810, s), BOOST_PP_FOR_810, BOOST_PP_TUPLE_EAT_4)(o(810, s), p, o, m)
+# define BOOST_PP_FOR_810_I(s, p, o, m) BOOST_PP_IF(p(811, s), m, BOOST_PP_TUPLE_EAT_2)(811, s) BOOST_PP_IF(p(811, s), BOOST_PP_FOR_811, BOOST_PP_TUPLE_EAT_4)(o(811, s), p, o, m)
+# define BOOST_PP_FOR_811_I(s, p, o, m) BOOST_PP_IF(p(812, s), m, BOOST_PP_TUPLE_EAT_2)(812, s) BOOST_PP_IF(p(812, s), BOOST_PP_FOR_812, BOOST_PP_TUPLE_EAT_4)(o(812, s), p, o, m)
+# define BOOST_PP_FOR_812_I(s, p, o, m) BOOST_PP_IF(p(813, s), m, BOOST_PP_TUPLE_EAT_2)(813, s) BOOST_PP_IF(p(813, s), BOOST_PP_FOR_813, BOOST_PP_TUPLE_EAT_4)(o(813, s), p, o, m)
+# define BOOST_PP_FOR_813_I(s, p, o, m) BOOST_PP_IF(p(814, s), m, BOOST_PP_TUPLE_EAT_2)(814, s) BOOST_PP_IF(p(814, s), BOOST_PP_FOR_814, BOOST_PP_TUPLE_EAT_4)(o(814, s), p, o, m)
+# define BOOST_PP_FOR_814_I(s, p, o, m) BOOST_PP_IF(p(815, s), m, BOOST_PP_TUPLE_EAT_2)(815, s) BOOST_PP_IF(p(815, s), BOOST_PP_FOR_815, BOOST_PP_TUPLE_EAT_4)(o(815, s), p, o, m)
+# define BOOST_PP_FOR_815_I(s, p, o, m) BOOST_PP_IF(p(816, s), m, BOOST_PP_TUPLE_EAT_2)(816, s) BOOST_PP_IF(p(816, s), BOOST_PP_FOR_816, BOOST_PP_TUPLE_EAT_4)(o(816, s), p, o, m)
+# define BOOST_PP_FOR_816_I(s, p, o, m) BOOST_PP_IF(p(817, s), m, BOOST_PP_TUPLE_EAT_2)(817, s) BOOST_PP_IF(p(817, s), BOOST_PP_FOR_817, BOOST_PP_TUPLE_EAT_4)(o(817, s), p, o, m)
+# define BOOST_PP_FOR_817_I(s, p, o, m) BOOST_PP_IF(p(818, s), m, BOOST_PP_TUPLE_EAT_2)(818, s) BOOST_PP_IF(p(818, s), BOOST_PP_FOR_818, BOOST_PP_TUPLE_EAT_4)(o(818, s), p, o, m)
+# define BOOST_PP_FOR_818_I(s, p, o, m) BOOST_PP_IF(p(819, s), m, BOOST_PP_TUPLE_EAT_2)(819, s) BOOST_PP_IF(p(819, s), BOOST_PP_FOR_819, BOOST_PP_TUPLE_EAT_4)(o(819, s), p, o, m)
+# define BOOST_PP_FOR_819_I(s, p, o, m) BOOST_PP_IF(p(820, s), m, BOOST_PP_TUPLE_EAT_2)(820, s) BOOST_PP_IF(p(820, s), BOOST_PP_FOR_820, BOOST_PP_TUPLE_EAT_4)(o(820, s), p, o, m)
+# define BOOST_PP_FOR_820_I(s, p, o, m) BOOST_PP_IF(p(821, s), m, BOOST_PP_TUPLE_EAT_2)(821, s) BOOST_PP_IF(p(821, s), BOOST_PP_FOR_821, BOOST_PP_TUPLE_EAT_4)(o(821, s), p, o, m)
+# define BOOST_PP_FOR_821_I(s, p, o, m) BOOST_PP_IF(p(822, s), m, BOOST_PP_TUPLE_EAT_2)(822, s) BOOST_PP_IF(p(822, s), BOOST_PP_FOR_822, BOOST_PP_TUPLE_EAT_4)(o(822, s), p, o, m)
+# define BOOST_PP_FOR_822_I(s, p, o, m) BOOST_PP_IF(p(823, s), m, BOOST_PP_TUPLE_EAT_2)(823, s) BOOST_PP_IF(p(823, s), BOOST_PP_FOR_823, BOOST_PP_TUPLE_EAT_4)(o(823, s), p, o, m)
+# define BOOST_PP_FOR_823_I(s, p, o, m) BOOST_PP_IF(p(824, s), m, BOOST_PP_TUPLE_EAT_2)(824, s) BOOST_PP_IF(p(824, s), BOOST_PP_FOR_824, BOOST_PP_TUPLE_EAT_4)(o(824, s), p, o, m)
+# define BOOST_PP_FOR_824_I(s, p, o, m) BOOST_PP_IF(p(825, s), m, BOOST_PP_TUPLE_EAT_2)(825, s) BOOST_PP_IF(p(825, s), BOOST_PP_FOR_825, BOOST_PP_TUPLE_EAT_4)(o(825, s), p, o, m)
+# define BOOST_PP_FOR_825_I(s, p, o, m) BOOST_PP_IF(p(826, s), m, BOOST_PP_TUPLE_EAT_2)(826, s) BOOST_PP_IF(p(826, s), BOOST_PP_FOR_826, BOOST_PP_TUPLE_EAT_4)(o(826, s), p, o, m)
+# define BOOST_PP_FOR_826_I(s, p, o, m) BOOST_PP_IF(p(827, s), m, BOOST_PP_TUPLE_EAT_2)(827, s) BOOST_PP_IF(p(827, s), BOOST_PP_FOR_827, BOOST_PP_TUPLE_EAT_4)(o(827, s), p, o, m)
+# define BOOST_PP_FOR_827_I(s, p, o, m) BOOST_PP_IF(p(828, s), m, BOOST_PP_TUPLE_EAT_2)(828, s) BOOST_PP_IF(p(828, s), BOOST_PP_FOR_828, BOOST_PP_TUPLE_EAT_4)(o(828, s), p, o, m)
+# define BOOST_PP_FOR_828_I(s, p, o, m) BOOST_PP_IF(p(829, s), m, BOOST_PP_TUPLE_EAT_2)(829, s) BOOST_PP_IF(p(829, s), BOOST_PP_FOR_829, BOOST_PP_TUPLE_EAT_4)(o(829, s), p, o, m)
+# define BOOST_PP_FOR_829_I(s, p, o, m) BOOST_PP_IF(p(830, s), m, BOOST_PP_TUPLE_EAT_2)(830, s) BOOST_PP_IF(p(830, s), BOOST_PP_FOR_830, BOOST_PP_TUPLE_EAT_4)(o(830, s), p, o, m)
+# define BOOST_PP_FOR_830_I(s, p, o, m) BOOST_PP_IF(p(831, s), m, BOOST_PP_TUPLE_EAT_2)(831, s) BOOST_PP_IF(p(831, s), BOOST_PP_FOR_831, BOOST_PP_TUPLE_EAT_4)(o(831, s), p, o, m)
+# define BOOST_PP_FOR_831_I(s, p, o, m) BOOST_PP_IF(p(832, s), m, BOOST_PP_TUPLE_EAT_2)(832, s) BOOST_PP_IF(p(832, s), BOOST_PP_FOR_832, BOOST_PP_TUPLE_EAT_4)(o(832, s), p, o, m)
+# define BOOST_PP_FOR_832_I(s, p, o, m) BOOST_PP_IF(p(833, s), m, BOOST_PP_TUPLE_EAT_2)(833, s) BOOST_PP_IF(p(833, s), BOOST_PP_FOR_833, BOOST_PP_TUPLE_EAT_4)(o(833, s), p, o, m)
+# define BOOST_PP_FOR_833_I(s, p, o, m) BOOST_PP_IF(p(834, s), m, BOOST_PP_TUPLE_EAT_2)(834, s) BOOST_PP_IF(p(834, s), BOOST_PP_FOR_834, BOOST_PP_TUPLE_EAT_4)(o(834, s), p, o, m)
+# define BOOST_PP_FOR_834_I(s, p, o, m) BOOST_PP_IF(p(835, s), m, BOOST_PP_TUPLE_EAT_2)(835, s) BOOST_PP_IF(p(835, s), BOOST_PP_FOR_835, BOOST_PP_TUPLE_EAT_4)(o(835, s), p, o, m)
+# define BOOST_PP_FOR_835_I(s, p, o, m) BOOST_PP_IF(p(836, s), m, BOOST_PP_TUPLE_EAT_2)(836, s) BOOST_PP_IF(p(836, s), BOOST_PP_FOR_836, BOOST_PP_TUPLE_EAT_4)(o(836, s), p, o, m)
+# define BOOST_PP_FOR_836_I(s, p, o, m) BOOST_PP_IF(p(837, s), m, BOOST_PP_TUPLE_EAT_2)(837, s) BOOST_PP_IF(p(837, s), BOOST_PP_FOR_837, BOOST_PP_TUPLE_EAT_4)(o(837, s), p, o, m)
+# define BOOST_PP_FOR_837_I(s, p, o, m) BOOST_PP_IF(p(838, s), m, BOOST_PP_TUPLE_EAT_2)(838, s) BOOST_PP_IF(p(838, s), BOOST_PP_FOR_838, BOOST_PP_TUPLE_EAT_4)(o(838, s), p, o, m)
+# define BOOST_PP_FOR_838_I(s, p, o, m) BOOST_PP_IF(p(839, s), m, BOOST_PP_TUPLE_EAT_2)(839, s) BOOST_PP_IF(p(839, s), BOOST_PP_FOR_839, BOOST_PP_TUPLE_EAT_4)(o(839, s), p, o, m)
+# define BOOST_PP_FOR_839_I(s, p, o, m) BOOST_PP_IF(p(840, s), m, BOOST_PP_TUPLE_EAT_2)(840, s) BOOST_PP_IF(p(840, s), BOOST_PP_FOR_840, BOOST_PP_TUPLE_EAT_4)(o(840, s), p, o, m)
+# define BOOST_PP_FOR_840_I(s, p, o, m) BOOST_PP_IF(p(841, s), m, BOOST_PP_TUPLE_EAT_2)(841, s) BOOST_PP_IF(p(841, s), BOOST_PP_FOR_841, BOOST_PP_TUPLE_EAT_4)(o(841, s), p, o, m)
+# define BOOST_PP_FOR_841_I(s, p, o, m) BOOST_PP_IF(p(842, s), m, BOOST_PP_TUPLE_EAT_2)(842, s) BOOST_PP_IF(p(842, s), BOOST_PP_FOR_842, BOOST_PP_TUPLE_EAT_4)(o(842, s), p, o, m)
+# define BOOST_PP_FOR_842_I(s, p, o, m) BOOST_PP_IF(p(843, s), m, BOOST_PP_TUPLE_EAT_2)(843, s) BOOST_PP_IF(p(843, s), BOOST_PP_FOR_843, BOOST_PP_TUPLE_EAT_4)(o(843, s), p, o, m)
+# define BOOST_PP_FOR_843_I(s, p, o, m) BOOST_PP_IF(p(844, s), m, BOOST_PP_TUPLE_EAT_2)(844, s) BOOST_PP_IF(p(844, s), BOOST_PP_FOR_844, BOOST_PP_TUPLE_EAT_4)(o(844, s), p, o, m)
+# define BOOST_PP_FOR_844_I(s, p, o, m) BOOST_PP_IF(p(845, s), m, BOOST_PP_TUPLE_EAT_2)(845, s) BOOST_PP_IF(p(845, s), BOOST_PP_FOR_845, BOOST_PP_TUPLE_EAT_4)(o(845, s), p, o, m)
+# define BOOST_PP_FOR_845_I(s, p, o, m) BOOST_PP_IF(p(846, s), m, BOOST_PP_TUPLE_EAT_2)(846, s) BOOST_PP_IF(p(846, s), BOOST_PP_FOR_846, BOOST_PP_TUPLE_EAT_4)(o(846, s), p, o, m)
+# define BOOST_PP_FOR_846_I(s, p, o, m) BOOST_PP_IF(p(847, s), m, BOOST_PP_TUPLE_EAT_2)(847, s) BOOST_PP_IF(p(847, s), BOOST_PP_FOR_847, BOOST_PP_TUPLE_EAT_4)(o(847, s), p, o, m)
+# define BOOST_PP_FOR_847_I(s, p, o, m) BOOST_PP_IF(p(848, s), m, BOOST_PP_TUPLE_EAT_2)(848, s) BOOST_PP_IF(p(848, s), BOOST_PP_FOR_848, BOOST_PP_TUPLE_EAT_4)(o(848, s), p, o, m)
+# define BOOST_PP_FOR_848_I(s, p, o, m) BOOST_PP_IF(p(849, s), m, BOOST_PP_TUPLE_EAT_2)(849, s) BOOST_PP_IF(p(849, s), BOOST_PP_FOR_849, BOOST_PP_TUPLE_EAT_4)(o(849, s), p, o, m)
+# define BOOST_PP_FOR_849_I(s, p, o, m) BOOST_PP_IF(p(850, s), m, BOOST_PP_TUPLE_EAT_2)(850, s) BOOST_PP_IF(p(850, s), BOOST_PP_FOR_850, BOOST_PP_TUPLE_EAT_4)(o(850, s), p, o, m)
+# define BOOST_PP_FOR_850_I(s, p, o, m) BOOST_PP_IF(p(851, s), m, BOOST_PP_TUPLE_EAT_2)(851, s) BOOST_PP_IF(p(851, s), BOOST_PP_FOR_851, BOOST_PP_TUPLE_EAT_4)(o(851, s), p, o, m)
+# define BOOST_PP_FOR_851_I(s, p, o, m) BOOST_PP_IF(p(852, s), m, BOOST_PP_TUPLE_EAT_2)(852, s) BOOST_PP_IF(p(852, s), BOOST_PP_FOR_852, BOOST_PP_TUPLE_EAT_4)(o(852, s), p, o, m)
+# define BOOST_PP_FOR_852_I(s, p, o, m) BOOST_PP_IF(p(853, s), m, BOOST_PP_TUPLE_EAT_2)(853, s) BOOST_PP_IF(p(853, s), BOOST_PP_FOR_853, BOOST_PP_TUPLE_EAT_4)(o(853, s), p, o, m)
+# define BOOST_PP_FOR_853_I(s, p, o, m) BOOST_PP_IF(p(854, s), m, BOOST_PP_TUPLE_EAT_2)(854, s) BOOST_PP_IF(p(854, s), BOOST_PP_FOR_854, BOOST_PP_TUPLE_EAT_4)(o(854, s), p, o, m)
+# define BOOST_PP_FOR_854_I(s, p, o, m) BOOST_PP_IF(p(855, s), m, BOOST_PP_TUPLE_EAT_2)(855, s) BOOST_PP_IF(p(855, s), BOOST_PP_FOR_855, BOOST_PP_TUPLE_EAT_4)(o(855, s), p, o, m)
+# define BOOST_PP_FOR_855_I(s, p, o, m) BOOST_PP_IF(p(856, s), m, BOOST_PP_TUPLE_EAT_2)(856, s) BOOST_PP_IF(p(856, s), BOOST_PP_FOR_856, BOOST_PP_TUPLE_EAT_4)(o(856, s), p, o, m)
+# define BOOST_PP_FOR_856_I(s, p, o, m) BOOST_PP_IF(p(857, s), m, BOOST_PP_TUPLE_EAT_2)(857, s) BOOST_PP_IF(p(857, s), BOOST_PP_FOR_857, BOOST_PP_TUPLE_EAT_4)(o(857, s), p, o, m)
+# define BOOST_PP_FOR_857_I(s, p, o, m) BOOST_PP_IF(p(858, s), m, BOOST_PP_TUPLE_EAT_2)(858, s) BOOST_PP_IF(p(858, s), BOOST_PP_FOR_858, BOOST_PP_TUPLE_EAT_4)(o(858, s), p, o, m)
+# define BOOST_PP_FOR_858_I(s, p, o, m) BOOST_PP_IF(p(859, s), m, BOOST_PP_TUPLE_EAT_2)(859, s) BOOST_PP_IF(p(859, s), BOOST_PP_FOR_859, BOOST_PP_TUPLE_EAT_4)(o(859, s), p, o, m)
+# define BOOST_PP_FOR_859_I(s, p, o, m) BOOST_PP_IF(p(860, s), m, BOOST_PP_TUPLE_EAT_2)(860, s) BOOST_PP_IF(p(860, s), BOOST_PP_FOR_860, BOOST_PP_TUPLE_EAT_4)(o(860, s), p, o, m)
+# define BOOST_PP_FOR_860_I(s, p, o, m) BOOST_PP_IF(p(861, s), m, BOOST_PP_TUPLE_EAT_2)(861, s) BOOST_PP_IF(p(861, s), BOOST_PP_FOR_861, BOOST_PP_TUPLE_EAT_4)(o(861, s), p, o, m)
+# define BOOST_PP_FOR_861_I(s, p, o, m) BOOST_PP_IF(p(862, s), m, BOOST_PP_TUPLE_EAT_2)(862, s) BOOST_PP_IF(p(862, s), BOOST_PP_FOR_862, BOOST_PP_TUPLE_EAT_4)(o(862, s), p, o, m)
+# define BOOST_PP_FOR_862_I(s, p, o, m) BOOST_PP_IF(p(863, s), m, BOOST_PP_TUPLE_EAT_2)(863, s) BOOST_PP_IF(p(863, s), BOOST_PP_FOR_863, BOOST_PP_TUPLE_EAT_4)(o(863, s), p, o, m)
+# define BOOST_PP_FOR_863_I(s, p, o, m) BOOST_PP_IF(p(864, s), m, BOOST_PP_TUPLE_EAT_2)(864, s) BOOST_PP_IF(p(864, s), BOOST_PP_FOR_864, BOOST_PP_TUPLE_EAT_4)(o(864, s), p, o, m)
+# define BOOST_PP_FOR_864_I(s, p, o, m) BOOST_PP_IF(p(865, s), m, BOOST_PP_TUPLE_EAT_2)(865, s) BOOST_PP_IF(p(865, s), BOOST_PP_FOR_865, BOOST_PP_TUPLE_EAT_4)(o(865, s), p, o, m)
+# define BOOST_PP_FOR_865_I(s, p, o, m) BOOST_PP_IF(p(866, s), m, BOOST_PP_TUPLE_EAT_2)(866, s) BOOST_PP_IF(p(866, s), BOOST_PP_FOR_866, BOOST_PP_TUPLE_EAT_4)(o(866, s), p, o, m)
+# define BOOST_PP_FOR_866_I(s, p, o, m) BOOST_PP_IF(p(867, s), m, BOOST_PP_TUPLE_EAT_2)(867, s) BOOST_PP_IF(p(867, s), BOOST_PP_FOR_867, BOOST_PP_TUPLE_EAT_4)(o(867, s), p, o, m)
+# define BOOST_PP_FOR_867_I(s, p, o, m) BOOST_PP_IF(p(868, s), m, BOOST_PP_TUPLE_EAT_2)(868, s) BOOST_PP_IF(p(868, s), BOOST_PP_FOR_868, BOOST_PP_TUPLE_EAT_4)(o(868, s), p, o, m)
+# define BOOST_PP_FOR_868_I(s, p, o, m) BOOST_PP_IF(p(869, s), m, BOOST_PP_TUPLE_EAT_2)(869, s) BOOST_PP_IF(p(869, s), BOOST_PP_FOR_869, BOOST_PP_TUPLE_EAT_4)(o(869, s), p, o, m)
+# define BOOST_PP_FOR_869_I(s, p, o, m) BOOST_PP_IF(p(870, s), m, BOOST_PP_TUPLE_EAT_2)(870, s) BOOST_PP_IF(p(870, s), BOOST_PP_FOR_870, BOOST_PP_TUPLE_EAT_4)(o(870, s), p, o, m)
+# define BOOST_PP_FOR_870_I(s, p, o, m) BOOST_PP_IF(p(871, s), m, BOOST_PP_TUPLE_EAT_2)(871, s) BOOST_PP_IF(p(871, s), BOOST_PP_FOR_871, BOOST_PP_TUPLE_EAT_4)(o(871, s), p, o, m)
+# define BOOST_PP_FOR_871_I(s, p, o, m) BOOST_PP_IF(p(872, s), m, BOOST_PP_TUPLE_EAT_2)(872, s) BOOST_PP_IF(p(872, s), BOOST_PP_FOR_872, BOOST_PP_TUPLE_EAT_4)(o(872, s), p, o, m)
+# define BOOST_PP_FOR_872_I(s, p, o, m) BOOST_PP_IF(p(873, s), m, BOOST_PP_TUPLE_EAT_2)(873, s) BOOST_PP_IF(p(873, s), BOOST_PP_FOR_873, BOOST_PP_TUPLE_EAT_4)(o(873, s), p, o, m)
+# define BOOST_PP_FOR_873_I(s, p, o, m) BOOST_PP_IF(p(874, s), m, BOOST_PP_TUPLE_EAT_2)(874, s) BOOST_PP_IF(p(874, s), BOOST_PP_FOR_874, BOOST_PP_TUPLE_EAT_4)(o(874, s), p, o, m)
+# define BOOST_PP_FOR_874_I(s, p, o, m) BOOST_PP_IF(p(875, s), m, BOOST_PP_TUPLE_EAT_2)(875, s) BOOST_PP_IF(p(875, s), BOOST_PP_FOR_875, BOOST_PP_TUPLE_EAT_4)(o(875, s), p, o, m)
+# define BOOST_PP_FOR_875_I(s, p, o, m) BOOST_PP_IF(p(876, s), m, BOOST_PP_TUPLE_EAT_2)(876, s) BOOST_PP_IF(p(876, s), BOOST_PP_FOR_876, BOOST_PP_TUPLE_EAT_4)(o(876, s), p, o, m)
+# define BOOST_PP_FOR_876_I(s, p, o, m) BOOST_PP_IF(p(877, s), m, BOOST_PP_TUPLE_EAT_2)(877, s) BOOST_PP_IF(p(877, s), BOOST_PP_FOR_877, BOOST_PP_TUPLE_EAT_4)(o(877, s), p, o, m)
+# define BOOST_PP_FOR_877_I(s, p, o, m) BOOST_PP_IF(p(878, s), m, BOOST_PP_TUPLE_EAT_2)(878, s) BOOST_PP_IF(p(878, s), BOOST_PP_FOR_878, BOOST_PP_TUPLE_EAT_4)(o(878, s), p, o, m)
+# define BOOST_PP_FOR_878_I(s, p, o, m) BOOST_PP_IF(p(879, s), m, BOOST_PP_TUPLE_EAT_2)(879, s) BOOST_PP_IF(p(879, s), BOOST_PP_FOR_879, BOOST_PP_TUPLE_EAT_4)(o(879, s), p, o, m)
+# define BOOST_PP_FOR_879_I(s, p, o, m) BOOST_PP_IF(p(880, s), m, BOOST_PP_TUPLE_EAT_2)(880, s) BOOST_PP_IF(p(880, s), BOOST_PP_FOR_880, BOOST_PP_TUPLE_EAT_4)(o(880, s), p, o, m)
+# define BOOST_PP_FOR_880_I(s, p, o, m) BOOST_PP_IF(p(881, s), m, BOOST_PP_TUPLE_EAT_2)(881, s) BOOST_PP_IF(p(881, s), BOOST_PP_FOR_881, BOOST_PP_TUPLE_EAT_4)(o(881, s), p, o, m)
+# define BOOST_PP_FOR_881_I(s, p, o, m) BOOST_PP_IF(p(882, s), m, BOOST_PP_TUPLE_EAT_2)(882, s) BOOST_PP_IF(p(882, s), BOOST_PP_FOR_882, BOOST_PP_TUPLE_EAT_4)(o(882, s), p, o, m)
+# define BOOST_PP_FOR_882_I(s, p, o, m) BOOST_PP_IF(p(883, s), m, BOOST_PP_TUPLE_EAT_2)(883, s) BOOST_PP_IF(p(883, s), BOOST_PP_FOR_883, BOOST_PP_TUPLE_EAT_4)(o(883, s), p, o, m)
+# define BOOST_PP_FOR_883_I(s, p, o, m) BOOST_PP_IF(p(884, s), m, BOOST_PP_TUPLE_EAT_2)(884, s) BOOST_PP_IF(p(884, s), BOOST_PP_FOR_884, BOOST_PP_TUPLE_EAT_4)(o(884, s), p, o, m)
+# define BOOST_PP_FOR_884_I(s, p, o, m) BOOST_PP_IF(p(885, s), m, BOOST_PP_TUPLE_EAT_2)(885, s) BOOST_PP_IF(p(885, s), BOOST_PP_FOR_885, BOOST_PP_TUPLE_EAT_4)(o(885, s), p, o, m)
+# define BOOST_PP_FOR_885_I(s, p, o, m) BOOST_PP_IF(p(886, s), m, BOOST_PP_TUPLE_EAT_2)(886, s) BOOST_PP_IF(p(886, s), BOOST_PP_FOR_886, BOOST_PP_TUPLE_EAT_4)(o(886, s), p, o, m)
+# define BOOST_PP_FOR_886_I(s, p, o, m) BOOST_PP_IF(p(887, s), m, BOOST_PP_TUPLE_EAT_2)(887, s) BOOST_PP_IF(p(887, s), BOOST_PP_FOR_887, BOOST_PP_TUPLE_EAT_4)(o(887, s), p, o, m)
+# define BOOST_PP_FOR_887_I(s, p, o, m) BOOST_PP_IF(p(888, s), m, BOOST_PP_TUPLE_EAT_2)(888, s) BOOST_PP_IF(p(888, s), BOOST_PP_FOR_888, BOOST_PP_TUPLE_EAT_4)(o(888, s), p, o, m)
+# define BOOST_PP_FOR_888_I(s, p, o, m) BOOST_PP_IF(p(889, s), m, BOOST_PP_TUPLE_EAT_2)(889, s) BOOST_PP_IF(p(889, s), BOOST_PP_FOR_889, BOOST_PP_TUPLE_EAT_4)(o(889, s), p, o, m)
+# define BOOST_PP_FOR_889_I(s, p, o, m) BOOST_PP_IF(p(890, s), m, BOOST_PP_TUPLE_EAT_2)(890, s) BOOST_PP_IF(p(890, s), BOOST_PP_FOR_890, BOOST_PP_TUPLE_EAT_4)(o(890, s), p, o, m)
+# define BOOST_PP_FOR_890_I(s, p, o, m) BOOST_PP_IF(p(891, s), m, BOOST_PP_TUPLE_EAT_2)(891, s) BOOST_PP_IF(p(891, s), BOOST_PP_FOR_891, BOOST_PP_TUPLE_EAT_4)(o(891, s), p, o, m)
+# define BOOST_PP_FOR_891_I(s, p, o, m) BOOST_PP_IF(p(892, s), m, BOOST_PP_TUPLE_EAT_2)(892, s) BOOST_PP_IF(p(892, s), BOOST_PP_FOR_892, BOOST_PP_TUPLE_EAT_4)(o(892, s), p, o, m)
+# define BOOST_PP_FOR_892_I(s, p, o, m) BOOST_PP_IF(p(893, s), m, BOOST_PP_TUPLE_EAT_2)(893, s) BOOST_PP_IF(p(893, s), BOOST_PP_FOR_893, BOOST_PP_TUPLE_EAT_4)(o(893, s), p, o, m)
+# define BOOST_PP_FOR_893_I(s, p, o, m) BOOST_PP_IF(p(894, s), m, BOOST_PP_TUPLE_EAT_2)(894, s) BOOST_PP_IF(p(894, s), BOOST_PP_FOR_894, BOOST_PP_TUPLE_EAT_4)(o(894, s), p, o, m)
+# define BOOST_PP_FOR_894_I(s, p, o, m) BOOST_PP_IF(p(895, s), m, BOOST_PP_TUPLE_EAT_2)(895, s) BOOST_PP_IF(p(895, s), BOOST_PP_FOR_895, BOOST_PP_TUPLE_EAT_4)(o(895, s), p, o, m)
+# define BOOST_PP_FOR_895_I(s, p, o, m) BOOST_PP_IF(p(896, s), m, BOOST_PP_TUPLE_EAT_2)(896, s) BOOST_PP_IF(p(896, s), BOOST_PP_FOR_896, BOOST_PP_TUPLE_EAT_4)(o(896, s), p, o, m)
+# define BOOST_PP_FOR_896_I(s, p, o, m) BOOST_PP_IF(p(897, s), m, BOOST_PP_TUPLE_EAT_2)(897, s) BOOST_PP_IF(p(897, s), BOOST_PP_FOR_897, BOOST_PP_TUPLE_EAT_4)(o(897, s), p, o, m)
+# define BOOST_PP_FOR_897_I(s, p, o, m) BOOST_PP_IF(p(898, s), m, BOOST_PP_TUPLE_EAT_2)(898, s) BOOST_PP_IF(p(898, s), BOOST_PP_FOR_898, BOOST_PP_TUPLE_EAT_4)(o(898, s), p, o, m)
+# define BOOST_PP_FOR_898_I(s, p, o, m) BOOST_PP_IF(p(899, s), m, BOOST_PP_TUPLE_EAT_2)(899, s) BOOST_PP_IF(p(899, s), BOOST_PP_FOR_899, BOOST_PP_TUPLE_EAT_4)(o(899, s), p, o, m)
+# define BOOST_PP_FOR_899_I(s, p, o, m) BOOST_PP_IF(p(900, s), m, BOOST_PP_TUPLE_EAT_2)(900, s) BOOST_PP_IF(p(900, s), BOOST_PP_FOR_900, BOOST_PP_TUPLE_EAT_4)(o(900, s), p, o, m)
+# define BOOST_PP_FOR_900_I(s, p, o, m) BOOST_PP_IF(p(901, s), m, BOOST_PP_TUPLE_EAT_2)(901, s) BOOST_PP_IF(p(901, s), BOOST_PP_FOR_901, BOOST_PP_TUPLE_EAT_4)(o(901, s), p, o, m)
+# define BOOST_PP_FOR_901_I(s, p, o, m) BOOST_PP_IF(p(902, s), m, BOOST_PP_TUPLE_EAT_2)(902, s) BOOST_PP_IF(p(902, s), BOOST_PP_FOR_902, BOOST_PP_TUPLE_EAT_4)(o(902, s), p, o, m)
+# define BOOST_PP_FOR_902_I(s, p, o, m) BOOST_PP_IF(p(903, s), m, BOOST_PP_TUPLE_EAT_2)(903, s) BOOST_PP_IF(p(903, s), BOOST_PP_FOR_903, BOOST_PP_TUPLE_EAT_4)(o(903, s), p, o, m)
+# define BOOST_PP_FOR_903_I(s, p, o, m) BOOST_PP_IF(p(904, s), m, BOOST_PP_TUPLE_EAT_2)(904, s) BOOST_PP_IF(p(904, s), BOOST_PP_FOR_904, BOOST_PP_TUPLE_EAT_4)(o(904, s), p, o, m)
+# define BOOST_PP_FOR_904_I(s, p, o, m) BOOST_PP_IF(p(905, s), m, BOOST_PP_TUPLE_EAT_2)(905, s) BOOST_PP_IF(p(905, s), BOOST_PP_FOR_905, BOOST_PP_TUPLE_EAT_4)(o(905, s), p, o, m)
+# define BOOST_PP_FOR_905_I(s, p, o, m) BOOST_PP_IF(p(906, s), m, BOOST_PP_TUPLE_EAT_2)(906, s) BOOST_PP_IF(p(906, s), BOOST_PP_FOR_906, BOOST_PP_TUPLE_EAT_4)(o(906, s), p, o, m)
+# define BOOST_PP_FOR_906_I(s, p, o, m) BOOST_PP_IF(p(907, s), m, BOOST_PP_TUPLE_EAT_2)(907, s) BOOST_PP_IF(p(907, s), BOOST_PP_FOR_907, BOOST_PP_TUPLE_EAT_4)(o(907, s), p, o, m)
+# define BOOST_PP_FOR_907_I(s, p, o, m) BOOST_PP_IF(p(908, s), m, BOOST_PP_TUPLE_EAT_2)(908, s) BOOST_PP_IF(p(908, s), BOOST_PP_FOR_908, BOOST_PP_TUPLE_EAT_4)(o(908, s), p, o, m)
+# define BOOST_PP_FOR_908_I(s, p, o, m) BOOST_PP_IF(p(909, s), m, BOOST_PP_TUPLE_EAT_2)(909, s) BOOST_PP_IF(p(909, s), BOOST_PP_FOR_909, BOOST_PP_TUPLE_EAT_4)(o(909, s), p, o, m)
+# define BOOST_PP_FOR_909_I(s, p, o, m) BOOST_PP_IF(p(910, s), m, BOOST_PP_TUPLE_EAT_2)(910, s) BOOST_PP_IF(p(910, s), BOOST_PP_FOR_910, BOOST_PP_TUPLE_EAT_4)(o(910, s), p, o, m)
+# define BOOST_PP_FOR_910_I(s, p, o, m) BOOST_PP_IF(p(911, s), m, BOOST_PP_TUPLE_EAT_2)(911, s) BOOST_PP_IF(p(911, s), BOOST_PP_FOR_911, BOOST_PP_TUPLE_EAT_4)(o(911, s), p, o, m)
+# define BOOST_PP_FOR_911_I(s, p, o, m) BOOST_PP_IF(p(912, s), m, BOOST_PP_TUPLE_EAT_2)(912, s) BOOST_PP_IF(p(912, s), BOOST_PP_FOR_912, BOOST_PP_TUPLE_EAT_4)(o(912, s), p, o, m)
+# define BOOST_PP_FOR_912_I(s, p, o, m) BOOST_PP_IF(p(913, s), m, BOOST_PP_TUPLE_EAT_2)(913, s) BOOST_PP_IF(p(913, s), BOOST_PP_FOR_913, BOOST_PP_TUPLE_EAT_4)(o(913, s), p, o, m)
+# define BOOST_PP_FOR_913_I(s, p, o, m) BOOST_PP_IF(p(914, s), m, BOOST_PP_TUPLE_EAT_2)(914, s) BOOST_PP_IF(p(914, s), BOOST_PP_FOR_914, BOOST_PP_TUPLE_EAT_4)(o(914, s), p, o, m)
+# define BOOST_PP_FOR_914_I(s, p, o, m) BOOST_PP_IF(p(915, s), m, BOOST_PP_TUPLE_EAT_2)(915, s) BOOST_PP_IF(p(915, s), BOOST_PP_FOR_915, BOOST_PP_TUPLE_EAT_4)(o(915, s), p, o, m)
+# define BOOST_PP_FOR_915_I(s, p, o, m) BOOST_PP_IF(p(916, s), m, BOOST_PP_TUPLE_EAT_2)(916, s) BOOST_PP_IF(p(916, s), BOOST_PP_FOR_916, BOOST_PP_TUPLE_EAT_4)(o(916, s), p, o, m)
+# define BOOST_PP_FOR_916_I(s, p, o, m) BOOST_PP_IF(p(917, s), m, BOOST_PP_TUPLE_EAT_2)(917, s) BOOST_PP_IF(p(917, s), BOOST_PP_FOR_917, BOOST_PP_TUPLE_EAT_4)(o(917, s), p, o, m)
+# define BOOST_PP_FOR_917_I(s, p, o, m) BOOST_PP_IF(p(918, s), m, BOOST_PP_TUPLE_EAT_2)(918, s) BOOST_PP_IF(p(918, s), BOOST_PP_FOR_918, BOOST_PP_TUPLE_EAT_4)(o(918, s), p, o, m)
+# define BOOST_PP_FOR_918_I(s, p, o, m) BOOST_PP_IF(p(919, s), m, BOOST_PP_TUPLE_EAT_2)(919, s) BOOST_PP_IF(p(919, s), BOOST_PP_FOR_919, BOOST_PP_TUPLE_EAT_4)(o(919, s), p, o, m)
+# define BOOST_PP_FOR_919_I(s, p, o, m) BOOST_PP_IF(p(920, s), m, BOOST_PP_TUPLE_EAT_2)(920, s) BOOST_PP_IF(p(920, s), BOOST_PP_FOR_920, BOOST_PP_TUPLE_EAT_4)(o(920, s), p, o, m)
+# define BOOST_PP_FOR_920_I(s, p, o, m) BOOST_PP_IF(p(921, s), m, BOOST_PP_TUPLE_EAT_2)(921, s) BOOST_PP_IF(p(921, s), BOOST_PP_FOR_921, BOOST_PP_TUPLE_EAT_4)(o(921, s), p, o, m)
+# define BOOST_PP_FOR_921_I(s, p, o, m) BOOST_PP_IF(p(922, s), m, BOOST_PP_TUPLE_EAT_2)(922, s) BOOST_PP_IF(p(922, s), BOOST_PP_FOR_922, BOOST_PP_TUPLE_EAT_4)(o(922, s), p, o, m)
+# define BOOST_PP_FOR_922_I(s, p, o, m) BOOST_PP_IF(p(923, s), m, BOOST_PP_TUPLE_EAT_2)(923, s) BOOST_PP_IF(p(923, s), BOOST_PP_FOR_923, BOOST_PP_TUPLE_EAT_4)(o(923, s), p, o, m)
+# define BOOST_PP_FOR_923_I(s, p, o, m) BOOST_PP_IF(p(924, s), m, BOOST_PP_TUPLE_EAT_2)(924, s) BOOST_PP_IF(p(924, s), BOOST_PP_FOR_924, BOOST_PP_TUPLE_EAT_4)(o(924, s), p, o, m)
+# define BOOST_PP_FOR_924_I(s, p, o, m) BOOST_PP_IF(p(925, s), m, BOOST_PP_TUPLE_EAT_2)(925, s) BOOST_PP_IF(p(925, s), BOOST_PP_FOR_925, BOOST_PP_TUPLE_EAT_4)(o(925, s), p, o, m)
+# define BOOST_PP_FOR_925_I(s, p, o, m) BOOST_PP_IF(p(926, s), m, BOOST_PP_TUPLE_EAT_2)(926, s) BOOST_PP_IF(p(926, s), BOOST_PP_FOR_926, BOOST_PP_TUPLE_EAT_4)(o(926, s), p, o, m)
+# define BOOST_PP_FOR_926_I(s, p, o, m) BOOST_PP_IF(p(927, s), m, BOOST_PP_TUPLE_EAT_2)(927, s) BOOST_PP_IF(p(927, s), BOOST_PP_FOR_927, BOOST_PP_TUPLE_EAT_4)(o(927, s), p, o, m)
+# define BOOST_PP_FOR_927_I(s, p, o, m) BOOST_PP_IF(p(928, s), m, BOOST_PP_TUPLE_EAT_2)(928, s) BOOST_PP_IF(p(928, s), BOOST_PP_FOR_928, BOOST_PP_TUPLE_EAT_4)(o(928, s), p, o, m)
+# define BOOST_PP_FOR_928_I(s, p, o, m) BOOST_PP_IF(p(929, s), m, BOOST_PP_TUPLE_EAT_2)(929, s) BOOST_PP_IF(p(929, s), BOOST_PP_FOR_929, BOOST_PP_TUPLE_EAT_4)(o(929, s), p, o, m)
+# define BOOST_PP_FOR_929_I(s, p, o, m) BOOST_PP_IF(p(930, s), m, BOOST_PP_TUPLE_EAT_2)(930, s) BOOST_PP_IF(p(930, s), BOOST_PP_FOR_930, BOOST_PP_TUPLE_EAT_4)(o(930, s), p, o, m)
+# define BOOST_PP_FOR_930_I(s, p, o, m) BOOST_PP_IF(p(931, s), m, BOOST_PP_TUPLE_EAT_2)(931, s) BOOST_PP_IF(p(931, s), BOOST_PP_FOR_931, BOOST_PP_TUPLE_EAT_4)(o(931, s), p, o, m)
+# define BOOST_PP_FOR_931_I(s, p, o, m) BOOST_PP_IF(p(932, s), m, BOOST_PP_TUPLE_EAT_2)(932, s) BOOST_PP_IF(p(932, s), BOOST_PP_FOR_932, BOOST_PP_TUPLE_EAT_4)(o(932, s), p, o, m)
+# define BOOST_PP_FOR_932_I(s, p, o, m) BOOST_PP_IF(p(933, s), m, BOOST_PP_TUPLE_EAT_2)(933, s) BOOST_PP_IF(p(933, s), BOOST_PP_FOR_933, BOOST_PP_TUPLE_EAT_4)(o(933, s), p, o, m)
+# define BOOST_PP_FOR_933_I(s, p, o, m) BOOST_PP_IF(p(934, s), m, BOOST_PP_TUPLE_EAT_2)(934, s) BOOST_PP_IF(p(934, s), BOOST_PP_FOR_934, BOOST_PP_TUPLE_EAT_4)(o(934, s), p, o, m)
+# define BOOST_PP_FOR_934_I(s, p, o, m) BOOST_PP_IF(p(935, s), m, BOOST_PP_TUPLE_EAT_2)(935, s) BOOST_PP_IF(p(935, s), BOOST_PP_FOR_935, BOOST_PP_TUPLE_EAT_4)(o(935, s), p, o, m)
+# define BOOST_PP_FOR_935_I(s, p, o, m) BOOST_PP_IF(p(936, s), m, BOOST_PP_TUPLE_EAT_2)(936, s) BOOST_PP_IF(p(936, s), BOOST_PP_FOR_936, BOOST_PP_TUPLE_EAT_4)(o(936, s), p, o, m)
+# define BOOST_PP_FOR_936_I(s, p, o, m) BOOST_PP_IF(p(937, s), m, BOOST_PP_TUPLE_EAT_2)(937, s) BOOST_PP_IF(p(937, s), BOOST_PP_FOR_937, BOOST_PP_TUPLE_EAT_4)(o(937, s), p, o, m)
+# define BOOST_PP_FOR_937_I(s, p, o, m) BOOST_PP_IF(p(938, s), m, BOOST_PP_TUPLE_EAT_2)(938, s) BOOST_PP_IF(p(938, s), BOOST_PP_FOR_938, BOOST_PP_TUPLE_EAT_4)(o(938, s), p, o, m)
+# define BOOST_PP_FOR_938_I(s, p, o, m) BOOST_PP_IF(p(939, s), m, BOOST_PP_TUPLE_EAT_2)(939, s) BOOST_PP_IF(p(939, s), BOOST_PP_FOR_939, BOOST_PP_TUPLE_EAT_4)(o(939, s), p, o, m)
+# define BOOST_PP_FOR_939_I(s, p, o, m) BOOST_PP_IF(p(940, s), m, BOOST_PP_TUPLE_EAT_2)(940, s) BOOST_PP_IF(p(940, s), BOOST_PP_FOR_940, BOOST_PP_TUPLE_EAT_4)(o(940, s), p, o, m)
+# define BOOST_PP_FOR_940_I(s, p, o, m) BOOST_PP_IF(p(941, s), m, BOOST_PP_TUPLE_EAT_2)(941, s) BOOST_PP_IF(p(941, s), BOOST_PP_FOR_941, BOOST_PP_TUPLE_EAT_4)(o(941, s), p, o, m)
+# define BOOST_PP_FOR_941_I(s, p, o, m) BOOST_PP_IF(p(942, s), m, BOOST_PP_TUPLE_EAT_2)(942, s) BOOST_PP_IF(p(942, s), BOOST_PP_FOR_942, BOOST_PP_TUPLE_EAT_4)(o(942, s), p, o, m)
+# define BOOST_PP_FOR_942_I(s, p, o, m) BOOST_PP_IF(p(943, s), m, BOOST_PP_TUPLE_EAT_2)(943, s) BOOST_PP_IF(p(943, s), BOOST_PP_FOR_943, BOOST_PP_TUPLE_EAT_4)(o(943, s), p, o, m)
+# define BOOST_PP_FOR_943_I(s, p, o, m) BOOST_PP_IF(p(944, s), m, BOOST_PP_TUPLE_EAT_2)(944, s) BOOST_PP_IF(p(944, s), BOOST_PP_FOR_944, BOOST_PP_TUPLE_EAT_4)(o(944, s), p, o, m)
+# define BOOST_PP_FOR_944_I(s, p, o, m) BOOST_PP_IF(p(945, s), m, BOOST_PP_TUPLE_EAT_2)(945, s) BOOST_PP_IF(p(945, s), BOOST_PP_FOR_945, BOOST_PP_TUPLE_EAT_4)(o(945, s), p, o, m)
+# define BOOST_PP_FOR_945_I(s, p, o, m) BOOST_PP_IF(p(946, s), m, BOOST_PP_TUPLE_EAT_2)(946, s) BOOST_PP_IF(p(946, s), BOOST_PP_FOR_946, BOOST_PP_TUPLE_EAT_4)(o(946, s), p, o, m)
+# define BOOST_PP_FOR_946_I(s, p, o, m) BOOST_PP_IF(p(947, s), m, BOOST_PP_TUPLE_EAT_2)(947, s) BOOST_PP_IF(p(947, s), BOOST_PP_FOR_947, BOOST_PP_TUPLE_EAT_4)(o(947, s), p, o, m)
+# define BOOST_PP_FOR_947_I(s, p, o, m) BOOST_PP_IF(p(948, s), m, BOOST_PP_TUPLE_EAT_2)(948, s) BOOST_PP_IF(p(948, s), BOOST_PP_FOR_948, BOOST_PP_TUPLE_EAT_4)(o(948, s), p, o, m)
+# define BOOST_PP_FOR_948_I(s, p, o, m) BOOST_PP_IF(p(949, s), m, BOOST_PP_TUPLE_EAT_2)(949, s) BOOST_PP_IF(p(949, s), BOOST_PP_FOR_949, BOOST_PP_TUPLE_EAT_4)(o(949, s), p, o, m)
+# define BOOST_PP_FOR_949_I(s, p, o, m) BOOST_PP_IF(p(950, s), m, BOOST_PP_TUPLE_EAT_2)(950, s) BOOST_PP_IF(p(950, s), BOOST_PP_FOR_950, BOOST_PP_TUPLE_EAT_4)(o(950, s), p, o, m)
+# define BOOST_PP_FOR_950_I(s, p, o, m) BOOST_PP_IF(p(951, s), m, BOOST_PP_TUPLE_EAT_2)(951, s) BOOST_PP_IF(p(951, s), BOOST_PP_FOR_951, BOOST_PP_TUPLE_EAT_4)(o(951, s), p, o, m)
+# define BOOST_PP_FOR_951_I(s, p, o, m) BOOST_PP_IF(p(952, s), m, BOOST_PP_TUPLE_EAT_2)(952, s) BOOST_PP_IF(p(952, s), BOOST_PP_FOR_952, BOOST_PP_TUPLE_EAT_4)(o(952, s), p, o, m)
+# define BOOST_PP_FOR_952_I(s, p, o, m) BOOST_PP_IF(p(953, s), m, BOOST_PP_TUPLE_EAT_2)(953, s) BOOST_PP_IF(p(953, s), BOOST_PP_FOR_953, BOOST_PP_TUPLE_EAT_4)(o(953, s), p, o, m)
+# define BOOST_PP_FOR_953_I(s, p, o, m) BOOST_PP_IF(p(954, s), m, BOOST_PP_TUPLE_EAT_2)(954, s) BOOST_PP_IF(p(954, s), BOOST_PP_FOR_954, BOOST_PP_TUPLE_EAT_4)(o(954, s), p, o, m)
+# define BOOST_PP_FOR_954_I(s, p, o, m) BOOST_PP_IF(p(955, s), m, BOOST_PP_TUPLE_EAT_2)(955, s) BOOST_PP_IF(p(955, s), BOOST_PP_FOR_955, BOOST_PP_TUPLE_EAT_4)(o(955, s), p, o, m)
+# define BOOST_PP_FOR_955_I(s, p, o, m) BOOST_PP_IF(p(956, s), m, BOOST_PP_TUPLE_EAT_2)(956, s) BOOST_PP_IF(p(956, s), BOOST_PP_FOR_956, BOOST_PP_TUPLE_EAT_4)(o(956, s), p, o, m)
+# define BOOST_PP_FOR_956_I(s, p, o, m) BOOST_PP_IF(p(957, s), m, BOOST_PP_TUPLE_EAT_2)(957, s) BOOST_PP_IF(p(957, s), BOOST_PP_FOR_957, BOOST_PP_TUPLE_EAT_4)(o(957, s), p, o, m)
+# define BOOST_PP_FOR_957_I(s, p, o, m) BOOST_PP_IF(p(958, s), m, BOOST_PP_TUPLE_EAT_2)(958, s) BOOST_PP_IF(p(958, s), BOOST_PP_FOR_958, BOOST_PP_TUPLE_EAT_4)(o(958, s), p, o, m)
+# define BOOST_PP_FOR_958_I(s, p, o, m) BOOST_PP_IF(p(959, s), m, BOOST_PP_TUPLE_EAT_2)(959, s) BOOST_PP_IF(p(959, s), BOOST_PP_FOR_959, BOOST_PP_TUPLE_EAT_4)(o(959, s), p, o, m)
+# define BOOST_PP_FOR_959_I(s, p, o, m) BOOST_PP_IF(p(960, s), m, BOOST_PP_TUPLE_EAT_2)(960, s) BOOST_PP_IF(p(960, s), BOOST_PP_FOR_960, BOOST_PP_TUPLE_EAT_4)(o(960, s), p, o, m)
+# define BOOST_PP_FOR_960_I(s, p, o, m) BOOST_PP_IF(p(961, s), m, BOOST_PP_TUPLE_EAT_2)(961, s) BOOST_PP_IF(p(961, s), BOOST_PP_FOR_961, BOOST_PP_TUPLE_EAT_4)(o(961, s), p, o, m)
+# define BOOST_PP_FOR_961_I(s, p, o, m) BOOST_PP_IF(p(962, s), m, BOOST_PP_TUPLE_EAT_2)(962, s) BOOST_PP_IF(p(962, s), BOOST_PP_FOR_962, BOOST_PP_TUPLE_EAT_4)(o(962, s), p, o, m)
+# define BOOST_PP_FOR_962_I(s, p, o, m) BOOST_PP_IF(p(963, s), m, BOOST_PP_TUPLE_EAT_2)(963, s) BOOST_PP_IF(p(963, s), BOOST_PP_FOR_963, BOOST_PP_TUPLE_EAT_4)(o(963, s), p, o, m)
+# define BOOST_PP_FOR_963_I(s, p, o, m) BOOST_PP_IF(p(964, s), m, BOOST_PP_TUPLE_EAT_2)(964, s) BOOST_PP_IF(p(964, s), BOOST_PP_FOR_964, BOOST_PP_TUPLE_EAT_4)(o(964, s), p, o, m)
+# define BOOST_PP_FOR_964_I(s, p, o, m) BOOST_PP_IF(p(965, s), m, BOOST_PP_TUPLE_EAT_2)(965, s) BOOST_PP_IF(p(965, s), BOOST_PP_FOR_965, BOOST_PP_TUPLE_EAT_4)(o(965, s), p, o, m)
+# define BOOST_PP_FOR_965_I(s, p, o, m) BOOST_PP_IF(p(966, s), m, BOOST_PP_TUPLE_EAT_2)(966, s) BOOST_PP_IF(p(966, s), BOOST_PP_FOR_966, BOOST_PP_TUPLE_EAT_4)(o(966, s), p, o, m)
+# define BOOST_PP_FOR_966_I(s, p, o, m) BOOST_PP_IF(p(967, s), m, BOOST_PP_TUPLE_EAT_2)(967, s) BOOST_PP_IF(p(967, s), BOOST_PP_FOR_967, BOOST_PP_TUPLE_EAT_4)(o(967, s), p, o, m)
+# define BOOST_PP_FOR_967_I(s, p, o, m) BOOST_PP_IF(p(968, s), m, BOOST_PP_TUPLE_EAT_2)(968, s) BOOST_PP_IF(p(968, s), BOOST_PP_FOR_968, BOOST_PP_TUPLE_EAT_4)(o(968, s), p, o, m)
+# define BOOST_PP_FOR_968_I(s, p, o, m) BOOST_PP_IF(p(969, s), m, BOOST_PP_TUPLE_EAT_2)(969, s) BOOST_PP_IF(p(969, s), BOOST_PP_FOR_969, BOOST_PP_TUPLE_EAT_4)(o(969, s), p, o, m)
+# define BOOST_PP_FOR_969_I(s, p, o, m) BOOST_PP_IF(p(970, s), m, BOOST_PP_TUPLE_EAT_2)(970, s) BOOST_PP_IF(p(970, s), BOOST_PP_FOR_970, BOOST_PP_TUPLE_EAT_4)(o(970, s), p, o, m)
+# define BOOST_PP_FOR_970_I(s, p, o, m) BOOST_PP_IF(p(971, s), m, BOOST_PP_TUPLE_EAT_2)(971, s) BOOST_PP_IF(p(971, s), BOOST_PP_FOR_971, BOOST_PP_TUPLE_EAT_4)(o(971, s), p, o, m)
+# define BOOST_PP_FOR_971_I(s, p, o, m) BOOST_PP_IF(p(972, s), m, BOOST_PP_TUPLE_EAT_2)(972, s) BOOST_PP_IF(p(972, s), BOOST_PP_FOR_972, BOOST_PP_TUPLE_EAT_4)(o(972, s), p, o, m)
+# define BOOST_PP_FOR_972_I(s, p, o, m) BOOST_PP_IF(p(973, s), m, BOOST_PP_TUPLE_EAT_2)(973, s) BOOST_PP_IF(p(973, s), BOOST_PP_FOR_973, BOOST_PP_TUPLE_EAT_4)(o(973, s), p, o, m)
+# define BOOST_PP_FOR_973_I(s, p, o, m) BOOST_PP_IF(p(974, s), m, BOOST_PP_TUPLE_EAT_2)(974, s) BOOST_PP_IF(p(974, s), BOOST_PP_FOR_974, BOOST_PP_TUPLE_EAT_4)(o(974, s), p, o, m)
+# define BOOST_PP_FOR_974_I(s, p, o, m) BOOST_PP_IF(p(975, s), m, BOOST_PP_TUPLE_EAT_2)(975, s) BOOST_PP_IF(p(975, s), BOOST_PP_FOR_975, BOOST_PP_TUPLE_EAT_4)(o(975, s), p, o, m)
+# define BOOST_PP_FOR_975_I(s, p, o, m) BOOST_PP_IF(p(976, s), m, BOOST_PP_TUPLE_EAT_2)(976, s) BOOST_PP_IF(p(976, s), BOOST_PP_FOR_976, BOOST_PP_TUPLE_EAT_4)(o(976, s), p, o, m)
+# define BOOST_PP_FOR_976_I(s, p, o, m) BOOST_PP_IF(p(977, s), m, BOOST_PP_TUPLE_EAT_2)(977, s) BOOST_PP_IF(p(977, s), BOOST_PP_FOR_977, BOOST_PP_TUPLE_EAT_4)(o(977, s), p, o, m)
+# define BOOST_PP_FOR_977_I(s, p, o, m) BOOST_PP_IF(p(978, s), m, BOOST_PP_TUPLE_EAT_2)(978, s) BOOST_PP_IF(p(978, s), BOOST_PP_FOR_978, BOOST_PP_TUPLE_EAT_4)(o(978, s), p, o, m)
+# define BOOST_PP_FOR_978_I(s, p, o, m) BOOST_PP_IF(p(979, s), m, BOOST_PP_TUPLE_EAT_2)(979, s) BOOST_PP_IF(p(979, s), BOOST_PP_FOR_979, BOOST_PP_TUPLE_EAT_4)(o(979, s), p, o, m)
+# define BOOST_PP_FOR_979_I(s, p, o, m) BOOST_PP_IF(p(980, s), m, BOOST_PP_TUPLE_EAT_2)(980, s) BOOST_PP_IF(p(980, s), BOOST_PP_FOR_980, BOOST_PP_TUPLE_EAT_4)(o(980, s), p, o, m)
+# define BOOST_PP_FOR_980_I(s, p, o, m) BOOST_PP_IF(p(981, s), m, BOOST_PP_TUPLE_EAT_2)(981, s) BOOST_PP_IF(p(981, s), BOOST_PP_FOR_981, BOOST_PP_TUPLE_EAT_4)(o(981, s), p, o, m)
+# define BOOST_PP_FOR_981_I(s, p, o, m) BOOST_PP_IF(p(982, s), m, BOOST_PP_TUPLE_EAT_2)(982, s) BOOST_PP_IF(p(982, s), BOOST_PP_FOR_982, BOOST_PP_TUPLE_EAT_4)(o(982, s), p, o, m)
+# define BOOST_PP_FOR_982_I(s, p, o, m) BOOST_PP_IF(p(983, s), m, BOOST_PP_TUPLE_EAT_2)(983, s) BOOST_PP_IF(p(983, s), BOOST_PP_FOR_983, BOOST_PP_TUPLE_EAT_4)(o(983, s), p, o, m)
+# define BOOST_PP_FOR_983_I(s, p, o, m) BOOST_PP_IF(p(984, s), m, BOOST_PP_TUPLE_EAT_2)(984, s) BOOST_PP_IF(p(984, s), BOOST_PP_FOR_984, BOOST_PP_TUPLE_EAT_4)(o(984, s), p, o, m)
+# define BOOST_PP_FOR_984_I(s, p, o, m) BOOST_PP_IF(p(985, s), m, BOOST_PP_TUPLE_EAT_2)(985, s) BOOST_PP_IF(p(985, s), BOOST_PP_FOR_985, BOOST_PP_TUPLE_EAT_4)(o(985, s), p, o, m)
+# define BOOST_PP_FOR_985_I(s, p, o, m) BOOST_PP_IF(p(986, s), m, BOOST_PP_TUPLE_EAT_2)(986, s) BOOST_PP_IF(p(986, s), BOOST_PP_FOR_986, BOOST_PP_TUPLE_EAT_4)(o(986, s), p, o, m)
+# define BOOST_PP_FOR_986_I(s, p, o, m) BOOST_PP_IF(p(987, s), m, BOOST_PP_TUPLE_EAT_2)(987, s) BOOST_PP_IF(p(987, s), BOOST_PP_FOR_987, BOOST_PP_TUPLE_EAT_4)(o(987, s), p, o, m)
+# define BOOST_PP_FOR_987_I(s, p, o, m) BOOST_PP_IF(p(988, s), m, BOOST_PP_TUPLE_EAT_2)(988, s) BOOST_PP_IF(p(988, s), BOOST_PP_FOR_988, BOOST_PP_TUPLE_EAT_4)(o(988, s), p, o, m)
+# define BOOST_PP_FOR_988_I(s, p, o, m) BOOST_PP_IF(p(989, s), m, BOOST_PP_TUPLE_EAT_2)(989, s) BOOST_PP_IF(p(989, s), BOOST_PP_FOR_989, BOOST_PP_TUPLE_EAT_4)(o(989, s), p, o, m)
+# define BOOST_PP_FOR_989_I(s, p, o, m) BOOST_PP_IF(p(990, s), m, BOOST_PP_TUPLE_EAT_2)(990, s) BOOST_PP_IF(p(990, s), BOOST_PP_FOR_990, BOOST_PP_TUPLE_EAT_4)(o(990, s), p, o, m)
+# define BOOST_PP_FOR_990_I(s, p, o, m) BOOST_PP_IF(p(991, s), m, BOOST_PP_TUPLE_EAT_2)(991, s) BOOST_PP_IF(p(991, s), BOOST_PP_FOR_991, BOOST_PP_TUPLE_EAT_4)(o(991, s), p, o, m)
+# define BOOST_PP_FOR_991_I(s, p, o, m) BOOST_PP_IF(p(992, s), m, BOOST_PP_TUPLE_EAT_2)(992, s) BOOST_PP_IF(p(992, s), BOOST_PP_FOR_992, BOOST_PP_TUPLE_EAT_4)(o(992, s), p, o, m)
+# define BOOST_PP_FOR_992_I(s, p, o, m) BOOST_PP_IF(p(993, s), m, BOOST_PP_TUPLE_EAT_2)(993, s) BOOST_PP_IF(p(993, s), BOOST_PP_FOR_993, BOOST_PP_TUPLE_EAT_4)(o(993, s), p, o, m)
+# define BOOST_PP_FOR_993_I(s, p, o, m) BOOST_PP_IF(p(994, s), m, BOOST_PP_TUPLE_EAT_2)(994, s) BOOST_PP_IF(p(994, s), BOOST_PP_FOR_994, BOOST_PP_TUPLE_EAT_4)(o(994, s), p, o, m)
+# define BOOST_PP_FOR_994_I(s, p, o, m) BOOST_PP_IF(p(995, s), m, BOOST_PP_TUPLE_EAT_2)(995, s) BOOST_PP_IF(p(995, s), BOOST_PP_FOR_995, BOOST_PP_TUPLE_EAT_4)(o(995, s), p, o, m)
+# define BOOST_PP_FOR_995_I(s, p, o, m) BOOST_PP_IF(p(996, s), m, BOOST_PP_TUPLE_EAT_2)(996, s) BOOST_PP_IF(p(996, s), BOOST_PP_FOR_996, BOOST_PP_TUPLE_EAT_4)(o(996, s), p, o, m)
+# define BOOST_PP_FOR_996_I(s, p, o, m) BOOST_PP_IF(p(997, s), m, BOOST_PP_TUPLE_EAT_2)(997, s) BOOST_PP_IF(p(997, s), BOOST_PP_FOR_997, BOOST_PP_TUPLE_EAT_4)(o(997, s), p, o, m)
+# define BOOST_PP_FOR_997_I(s, p, o, m) BOOST_PP_IF(p(998, s), m, BOOST_PP_TUPLE_EAT_2)(998, s) BOOST_PP_IF(p(998, s), BOOST_PP_FOR_998, BOOST_PP_TUPLE_EAT_4)(o(998, s), p, o, m)
+# define BOOST_PP_FOR_998_I(s, p, o, m) BOOST_PP_IF(p(999, s), m, BOOST_PP_TUPLE_EAT_2)(999, s) BOOST_PP_IF(p(999, s), BOOST_PP_FOR_999, BOOST_PP_TUPLE_EAT_4)(o(999, s), p, o, m)
+# define BOOST_PP_FOR_999_I(s, p, o, m) BOOST_PP_IF(p(1000, s), m, BOOST_PP_TUPLE_EAT_2)(1000, s) BOOST_PP_IF(p(1000, s), BOOST_PP_FOR_1000, BOOST_PP_TUPLE_EAT_4)(o(1000, s), p, o, m)
+# define BOOST_PP_FOR_1000_I(s, p, o, m) BOOST_PP_IF(p(1001, s), m, BOOST_PP_TUPLE_EAT_2)(1001, s) BOOST_PP_IF(p(1001, s), BOOST_PP_FOR_1001, BOOST_PP_TUPLE_EAT_4)(o(1001, s), p, o, m)
+# define BOOST_PP_FOR_1001_I(s, p, o, m) BOOST_PP_IF(p(1002, s), m, BOOST_PP_TUPLE_EAT_2)(1002, s) BOOST_PP_IF(p(1002, s), BOOST_PP_FOR_1002, BOOST_PP_TUPLE_EAT_4)(o(1002, s), p, o, m)
+# define BOOST_PP_FOR_1002_I(s, p, o, m) BOOST_PP_IF(p(1003, s), m, BOOST_PP_TUPLE_EAT_2)(1003, s) BOOST_PP_IF(p(1003, s), BOOST_PP_FOR_1003, BOOST_PP_TUPLE_EAT_4)(o(1003, s), p, o, m)
+# define BOOST_PP_FOR_1003_I(s, p, o, m) BOOST_PP_IF(p(1004, s), m, BOOST_PP_TUPLE_EAT_2)(1004, s) BOOST_PP_IF(p(1004, s), BOOST_PP_FOR_1004, BOOST_PP_TUPLE_EAT_4)(o(1004, s), p, o, m)
+# define BOOST_PP_FOR_1004_I(s, p, o, m) BOOST_PP_IF(p(1005, s), m, BOOST_PP_TUPLE_EAT_2)(1005, s) BOOST_PP_IF(p(1005, s), BOOST_PP_FOR_1005, BOOST_PP_TUPLE_EAT_4)(o(1005, s), p, o, m)
+# define BOOST_PP_FOR_1005_I(s, p, o, m) BOOST_PP_IF(p(1006, s), m, BOOST_PP_TUPLE_EAT_2)(1006, s) BOOST_PP_IF(p(1006, s), BOOST_PP_FOR_1006, BOOST_PP_TUPLE_EAT_4)(o(1006, s), p, o, m)
+# define BOOST_PP_FOR_1006_I(s, p, o, m) BOOST_PP_IF(p(1007, s), m, BOOST_PP_TUPLE_EAT_2)(1007, s) BOOST_PP_IF(p(1007, s), BOOST_PP_FOR_1007, BOOST_PP_TUPLE_EAT_4)(o(1007, s), p, o, m)
+# define BOOST_PP_FOR_1007_I(s, p, o, m) BOOST_PP_IF(p(1008, s), m, BOOST_PP_TUPLE_EAT_2)(1008, s) BOOST_PP_IF(p(1008, s), BOOST_PP_FOR_1008, BOOST_PP_TUPLE_EAT_4)(o(1008, s), p, o, m)
+# define BOOST_PP_FOR_1008_I(s, p, o, m) BOOST_PP_IF(p(1009, s), m, BOOST_PP_TUPLE_EAT_2)(1009, s) BOOST_PP_IF(p(1009, s), BOOST_PP_FOR_1009, BOOST_PP_TUPLE_EAT_4)(o(1009, s), p, o, m)
+# define BOOST_PP_FOR_1009_I(s, p, o, m) BOOST_PP_IF(p(1010, s), m, BOOST_PP_TUPLE_EAT_2)(1010, s) BOOST_PP_IF(p(1010, s), BOOST_PP_FOR_1010, BOOST_PP_TUPLE_EAT_4)(o(1010, s), p, o, m)
+# define BOOST_PP_FOR_1010_I(s, p, o, m) BOOST_PP_IF(p(1011, s), m, BOOST_PP_TUPLE_EAT_2)(1011, s) BOOST_PP_IF(p(1011, s), BOOST_PP_FOR_1011, BOOST_PP_TUPLE_EAT_4)(o(1011, s), p, o, m)
+# define BOOST_PP_FOR_1011_I(s, p, o, m) BOOST_PP_IF(p(1012, s), m, BOOST_PP_TUPLE_EAT_2)(1012, s) BOOST_PP_IF(p(1012, s), BOOST_PP_FOR_1012, BOOST_PP_TUPLE_EAT_4)(o(1012, s), p, o, m)
+# define BOOST_PP_FOR_1012_I(s, p, o, m) BOOST_PP_IF(p(1013, s), m, BOOST_PP_TUPLE_EAT_2)(1013, s) BOOST_PP_IF(p(1013, s), BOOST_PP_FOR_1013, BOOST_PP_TUPLE_EAT_4)(o(1013, s), p, o, m)
+# define BOOST_PP_FOR_1013_I(s, p, o, m) BOOST_PP_IF(p(1014, s), m, BOOST_PP_TUPLE_EAT_2)(1014, s) BOOST_PP_IF(p(1014, s), BOOST_PP_FOR_1014, BOOST_PP_TUPLE_EAT_4)(o(1014, s), p, o, m)
+# define BOOST_PP_FOR_1014_I(s, p, o, m) BOOST_PP_IF(p(1015, s), m, BOOST_PP_TUPLE_EAT_2)(1015, s) BOOST_PP_IF(p(1015, s), BOOST_PP_FOR_1015, BOOST_PP_TUPLE_EAT_4)(o(1015, s), p, o, m)
+# define BOOST_PP_FOR_1015_I(s, p, o, m) BOOST_PP_IF(p(1016, s), m, BOOST_PP_TUPLE_EAT_2)(1016, s) BOOST_PP_IF(p(1016, s), BOOST_PP_FOR_1016, BOOST_PP_TUPLE_EAT_4)(o(1016, s), p, o, m)
+# define BOOST_PP_FOR_1016_I(s, p, o, m) BOOST_PP_IF(p(1017, s), m, BOOST_PP_TUPLE_EAT_2)(1017, s) BOOST_PP_IF(p(1017, s), BOOST_PP_FOR_1017, BOOST_PP_TUPLE_EAT_4)(o(1017, s), p, o, m)
+# define BOOST_PP_FOR_1017_I(s, p, o, m) BOOST_PP_IF(p(1018, s), m, BOOST_PP_TUPLE_EAT_2)(1018, s) BOOST_PP_IF(p(1018, s), BOOST_PP_FOR_1018, BOOST_PP_TUPLE_EAT_4)(o(1018, s), p, o, m)
+# define BOOST_PP_FOR_1018_I(s, p, o, m) BOOST_PP_IF(p(1019, s), m, BOOST_PP_TUPLE_EAT_2)(1019, s) BOOST_PP_IF(p(1019, s), BOOST_PP_FOR_1019, BOOST_PP_TUPLE_EAT_4)(o(1019, s), p, o, m)
+# define BOOST_PP_FOR_1019_I(s, p, o, m) BOOST_PP_IF(p(1020, s), m, BOOST_PP_TUPLE_EAT_2)(1020, s) BOOST_PP_IF(p(1020, s), BOOST_PP_FOR_1020, BOOST_PP_TUPLE_EAT_4)(o(1020, s), p, o, m)
+# define BOOST_PP_FOR_1020_I(s, p, o, m) BOOST_PP_IF(p(1021, s), m, BOOST_PP_TUPLE_EAT_2)(1021, s) BOOST_PP_IF(p(1021, s), BOOST_PP_FOR_1021, BOOST_PP_TUPLE_EAT_4)(o(1021, s), p, o, m)
+# define BOOST_PP_FOR_1021_I(s, p, o, m) BOOST_PP_IF(p(1022, s), m, BOOST_PP_TUPLE_EAT_2)(1022, s) BOOST_PP_IF(p(1022, s), BOOST_PP_FOR_1022, BOOST_PP_TUPLE_EAT_4)(o(1022, s), p, o, m)
+# define BOOST_PP_FOR_1022_I(s, p, o, m) BOOST_PP_IF(p(1023, s), m, BOOST_PP_TUPLE_EAT_2)(1023, s) BOOST_PP_IF(p(1023, s), BOOST_PP_FOR_1023, BOOST_PP_TUPLE_EAT_4)(o(1023, s), p, o, m)
+# define BOOST_PP_FOR_1023_I(s, p, o, m) BOOST_PP_IF(p(1024, s), m, BOOST_PP_TUPLE_EAT_2)(1024, s) BOOST_PP_IF(p(1024, s), BOOST_PP_FOR_1024, BOOST_PP_TUPLE_EAT_4)(o(1024, s), p, o, m)
+# define BOOST_PP_FOR_1024_I(s, p, o, m) BOOST_PP_IF(p(1025, s), m, BOOST_PP_TUPLE_EAT_2)(1025, s) BOOST_PP_IF(p(1025, s), BOOST_PP_FOR_1025, BOOST_PP_TUPLE_EAT_4)(o(1025, s), p, o, m)
+#
+# endif
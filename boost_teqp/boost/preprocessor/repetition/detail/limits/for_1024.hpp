@@ -0,0 +1,1044 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002) */
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_REPETITION_DETAIL_FOR_1024_HPP
+# define BOOST_PREPROCESSOR_REPETITION_DETAIL_FOR_1024_HPP
+#
+# define BOOST_PP_FOR_513(s, p, o, m) BOOST_PP_FOR_513_C(BOOST_PP_BOOL(p(514, s)), s, p, o, m)
+# define BOOST_PP_FOR_514(s, p, o, m) BOOST_PP_FOR_514_C(BOOST_PP_BOOL(p(515, s)), s, p, o, m)
+# define BOOST_PP_FOR_515(s, p, o, m) BOOST_PP_FOR_515_C(BOOST_PP_BOOL(p(516, s)), s, p, o, m)
+# define BOOST_PP_FOR_516(s, p, o, m) BOOST_PP_FOR_516_C(BOOST_PP_BOOL(p(517, s)), s, p, o, m)
+# define BOOST_PP_FOR_517(s, p, o, m) BOOST_PP_FOR_517_C(BOOST_PP_BOOL(p(518, s)), s, p, o, m)
+# define BOOST_PP_FOR_518(s, p, o, m) BOOST_PP_FOR_518_C(BOOST_PP_BOOL(p(519, s)), s, p, o, m)
+# define BOOST_PP_FOR_519(s, p, o, m) BOOST_PP_FOR_519_C(BOOST_PP_BOOL(p(520, s)), s, p, o, m)
+# define BOOST_PP_FOR_520(s, p, o, m) BOOST_PP_FOR_520_C(BOOST_PP_BOOL(p(521, s)), s, p, o, m)
+# define BOOST_PP_FOR_521(s, p, o, m) BOOST_PP_FOR_521_C(BOOST_PP_BOOL(p(522, s)), s, p, o, m)
+# define BOOST_PP_FOR_522(s, p, o, m) BOOST_PP_FOR_522_C(BOOST_PP_BOOL(p(523, s)), s, p, o, m)
+# define BOOST_PP_FOR_523(s, p, o, m) BOOST_PP_FOR_523_C(BOOST_PP_BOOL(p(524, s)), s, p, o, m)
+# define BOOST_PP_FOR_524(s, p, o, m) BOOST_PP_FOR_524_C(BOOST_PP_BOOL(p(525, s)), s, p, o, m)
+# define BOOST_PP_FOR_525(s, p, o, m) BOOST_PP_FOR_525_C(BOOST_PP_BOOL(p(526, s)), s, p, o, m)
+# define BOOST_PP_FOR_526(s, p, o, m) BOOST_PP_FOR_526_C(BOOST_PP_BOOL(p(527, s)), s, p, o, m)
+# define BOOST_PP_FOR_527(s, p, o, m) BOOST_PP_FOR_527_C(BOOST_PP_BOOL(p(528, s)), s, p, o, m)
+# define BOOST_PP_FOR_528(s, p, o, m) BOOST_PP_FOR_528_C(BOOST_PP_BOOL(p(529, s)), s, p, o, m)
+# define BOOST_PP_FOR_529(s, p, o, m) BOOST_PP_FOR_529_C(BOOST_PP_BOOL(p(530, s)), s, p, o, m)
+# define BOOST_PP_FOR_530(s, p, o, m) BOOST_PP_FOR_530_C(BOOST_PP_BOOL(p(531, s)), s, p, o, m)
+# define BOOST_PP_FOR_531(s, p, o, m) BOOST_PP_FOR_531_C(BOOST_PP_BOOL(p(532, s)), s, p, o, m)
+# define BOOST_PP_FOR_532(s, p, o, m) BOOST_PP_FOR_532_C(BOOST_PP_BOOL(p(533, s)), s, p, o, m)
+# define BOOST_PP_FOR_533(s, p, o, m) BOOST_PP_FOR_533_C(BOOST_PP_BOOL(p(534, s)), s, p, o, m)
+# define BOOST_PP_FOR_534(s, p, o, m) BOOST_PP_FOR_534_C(BOOST_PP_BOOL(p(535, s)), s, p, o, m)
+# define BOOST_PP_FOR_535(s, p, o, m) BOOST_PP_FOR_535_C(BOOST_PP_BOOL(p(536, s)), s, p, o, m)
+# define BOOST_PP_FOR_536(s, p, o, m) BOOST_PP_FOR_536_C(BOOST_PP_BOOL(p(537, s)), s, p, o, m)
+# define BOOST_PP_FOR_537(s, p, o, m) BOOST_PP_FOR_537_C(BOOST_PP_BOOL(p(538, s)), s, p, o, m)
+# define BOOST_PP_FOR_538(s, p, o, m) BOOST_PP_FOR_538_C(BOOST_PP_BOOL(p(539, s)), s, p, o, m)
+# define BOOST_PP_FOR_539(s, p, o, m) BOOST_PP_FOR_539_C(BOOST_PP_BOOL(p(540, s)), s, p, o, m)
+# define BOOST_PP_FOR_540(s, p, o, m) BOOST_PP_FOR_540_C(BOOST_PP_BOOL(p(541, s)), s, p, o, m)
+# define BOOST_PP_FOR_541(s, p, o, m) BOOST_PP_FOR_541_C(BOOST_PP_BOOL(p(542, s)), s, p, o, m)
+# define BOOST_PP_FOR_542(s, p, o, m) BOOST_PP_FOR_542_C(BOOST_PP_BOOL(p(543, s)), s, p, o, m)
+# define BOOST_PP_FOR_543(s, p, o, m) BOOST_PP_FOR_543_C(BOOST_PP_BOOL(p(544, s)), s, p, o, m)
+# define BOOST_PP_FOR_544(s, p, o, m) BOOST_PP_FOR_544_C(BOOST_PP_BOOL(p(545, s)), s, p, o, m)
+# define BOOST_PP_FOR_545(s, p, o, m) BOOST_PP_FOR_545_C(BOOST_PP_BOOL(p(546, s)), s, p, o, m)
+# define BOOST_PP_FOR_546(s, p, o, m) BOOST_PP_FOR_546_C(BOOST_PP_BOOL(p(547, s)), s, p, o, m)
+# define BOOST_PP_FOR_547(s, p, o, m) BOOST_PP_FOR_547_C(BOOST_PP_BOOL(p(548, s)), s, p, o, m)
+# define BOOST_PP_FOR_548(s, p, o, m) BOOST_PP_FOR_548_C(BOOST_PP_BOOL(p(549, s)), s, p, o, m)
+# define BOOST_PP_FOR_549(s, p, o, m) BOOST_PP_FOR_549_C(BOOST_PP_BOOL(p(550, s)), s, p, o, m)
+# define BOOST_PP_FOR_550(s, p, o, m) BOOST_PP_FOR_550_C(BOOST_PP_BOOL(p(551, s)), s, p, o, m)
+# define BOOST_PP_FOR_551(s, p, o, m) BOOST_PP_FOR_551_C(BOOST_PP_BOOL(p(552, s)), s, p, o, m)
+# define BOOST_PP_FOR_552(s, p, o, m) BOOST_PP_FOR_552_C(BOOST_PP_BOOL(p(553, s)), s, p, o, m)
+# define BOOST_PP_FOR_553(s, p, o, m) BOOST_PP_FOR_553_C(BOOST_PP_BOOL(p(554, s)), s, p, o, m)
+# define BOOST_PP_FOR_554(s, p, o, m) BOOST_PP_FOR_554_C(BOOST_PP_BOOL(p(555, s)), s, p, o, m)
+# define BOOST_PP_FOR_555(s, p, o, m) BOOST_PP_FOR_555_C(BOOST_PP_BOOL(p(556, s)), s, p, o, m)
+# define BOOST_PP_FOR_556(s, p, o, m) BOOST_PP_FOR_556_C(BOOST_PP_BOOL(p(557, s)), s, p, o, m)
+# define BOOST_PP_FOR_557(s, p, o, m) BOOST_PP_FOR_557_C(BOOST_PP_BOOL(p(558, s)), s, p, o, m)
+# define BOOST_PP_FOR_558(s, p, o, m) BOOST_PP_FOR_558_C(BOOST_PP_BOOL(p(559, s)), s, p, o, m)
+# define BOOST_PP_FOR_559(s, p, o, m) BOOST_PP_FOR_559_C(BOOST_PP_BOOL(p(560, s)), s, p, o, m)
+# define BOOST_PP_FOR_560(s, p, o, m) BOOST_PP_FOR_560_C(BOOST_PP_BOOL(p(561, s)), s, p, o, m)
+# define BOOST_PP_FOR_561(s, p, o, m) BOOST_PP_FOR_561_C(BOOST_PP_BOOL(p(562, s)), s, p, o, m)
+# define BOOST_PP_FOR_562(s, p, o, m) BOOST_PP_FOR_562_C(BOOST_PP_BOOL(p(563, s)), s, p, o, m)
+# define BOOST_PP_FOR_563(s, p, o, m) BOOST_PP_FOR_563_C(BOOST_PP_BOOL(p(564, s)), s, p, o, m)
+# define BOOST_PP_FOR_564(s, p, o, m) BOOST_PP_FOR_564_C(BOOST_PP_BOOL(p(565, s)), s, p, o, m)
+# define BOOST_PP_FOR_565(s, p, o, m) BOOST_PP_FOR_565_C(BOOST_PP_BOOL(p(566, s)), s, p, o, m)
+# define BOOST_PP_FOR_566(s, p, o, m) BOOST_PP_FOR_566_C(BOOST_PP_BOOL(p(567, s)), s, p, o, m)
+# define BOOST_PP_FOR_567(s, p, o, m) BOOST_PP_FOR_567_C(BOOST_PP_BOOL(p(568, s)), s, p, o, m)
+# define BOOST_PP_FOR_568(s, p, o, m) BOOST_PP_FOR_568_C(BOOST_PP_BOOL(p(569, s)), s, p, o, m)
+# define BOOST_PP_FOR_569(s, p, o, m) BOOST_PP_FOR_569_C(BOOST_PP_BOOL(p(570, s)), s, p, o, m)
+# define BOOST_PP_FOR_570(s, p, o, m) BOOST_PP_FOR_570_C(BOOST_PP_BOOL(p(571, s)), s, p, o, m)
+# define BOOST_PP_FOR_571(s, p, o, m) BOOST_PP_FOR_571_C(BOOST_PP_BOOL(p(572, s)), s, p, o, m)
+# define BOOST_PP_FOR_572(s, p, o, m) BOOST_PP_FOR_572_C(BOOST_PP_BOOL(p(573, s)), s, p, o, m)
+# define BOOST_PP_FOR_573(s, p, o, m) BOOST_PP_FOR_573_C(BOOST_PP_BOOL(p(574, s)), s, p, o, m)
+# define BOOST_PP_FOR_574(s, p, o, m) BOOST_PP_FOR_574_C(BOOST_PP_BOOL(p(575, s)), s, p, o, m)
+# define BOOST_PP_FOR_575(s, p, o, m) BOOST_PP_FOR_575_C(BOOST_PP_BOOL(p(576, s)), s, p, o, m)
+# define BOOST_PP_FOR_576(s, p, o, m) BOOST_PP_FOR_576_C(BOOST_PP_BOOL(p(577, s)), s, p, o, m)
+# define BOOST_PP_FOR_577(s, p, o, m) BOOST_PP_FOR_577_C(BOOST_PP_BOOL(p(578, s)), s, p, o, m)
+# define BOOST_PP_FOR_578(s, p, o, m) BOOST_PP_FOR_578_C(BOOST_PP_BOOL(p(579, s)), s, p, o, m)
+# define BOOST_PP_FOR_579(s, p, o, m) BOOST_PP_FOR_579_C(BOOST_PP_BOOL(p(580, s)), s, p, o, m)
+# define BOOST_PP_FOR_580(s, p, o, m) BOOST_PP_FOR_580_C(BOOST_PP_BOOL(p(581, s)), s, p, o, m)
+# define BOOST_PP_FOR_581(s, p, o, m) BOOST_PP_FOR_581_C(BOOST_PP_BOOL(p(582, s)), s, p, o, m)
+# define BOOST_PP_FOR_582(s, p, o, m) BOOST_PP_FOR_582_C(BOOST_PP_BOOL(p(583, s)), s, p, o, m)
+# define BOOST_PP_FOR_583(s, p, o, m) BOOST_PP_FOR_583_C(BOOST_PP_BOOL(p(584, s)), s, p, o, m)
+# define BOOST_PP_FOR_584(s, p, o, m) BOOST_PP_FOR_584_C(BOOST_PP_BOOL(p(585, s)), s, p, o, m)
+# define BOOST_PP_FOR_585(s, p, o, m) BOOST_PP_FOR_585_C(BOOST_PP_BOOL(p(586, s)), s, p, o, m)
+# define BOOST_PP_FOR_586(s, p, o, m) BOOST_PP_FOR_586_C(BOOST_PP_BOOL(p(587, s)), s, p, o, m)
+# define BOOST_PP_FOR_587(s, p, o, m) BOOST_PP_FOR_587_C(BOOST_PP_BOOL(p(588, s)), s, p, o, m)
+# define BOOST_PP_FOR_588(s, p, o, m) BOOST_PP_FOR_588_C(BOOST_PP_BOOL(p(589, s)), s, p, o, m)
+# define BOOST_PP_FOR_589(s, p, o, m) BOOST_PP_FOR_589_C(BOOST_PP_BOOL(p(590, s)), s, p, o, m)
+# define BOOST_PP_FOR_590(s, p, o, m) BOOST_PP_FOR_590_C(BOOST_PP_BOOL(p(591, s)), s, p, o, m)
+# define BOOST_PP_FOR_591(s, p, o, m) BOOST_PP_FOR_591_C(BOOST_PP_BOOL(p(592, s)), s, p, o, m)
+# define BOOST_PP_FOR_592(s, p, o, m) BOOST_PP_FOR_592_C(BOOST_PP_BOOL(p(593, s)), s, p, o, m)
+# define BOOST_PP_FOR_593(s, p, o, m) BOOST_PP_FOR_593_C(BOOST_PP_BOOL(p(594, s)), s, p, o, m)
+# define BOOST_PP_FOR_594(s, p, o, m) BOOST_PP_FOR_594_C(BOOST_PP_BOOL(p(595, s)), s, p, o, m)
+# define BOOST_PP_FOR_595(s, p, o, m) BOOST_PP_FOR_595_C(BOOST_PP_BOOL(p(596, s)), s, p, o, m)
+# define BOOST_PP_FOR_596(s, p, o, m) BOOST_PP_FOR_596_C(BOOST_PP_BOOL(p(597, s)), s, p, o, m)
+# define BOOST_PP_FOR_597(s, p, o, m) BOOST_PP_FOR_597_C(BOOST_PP_BOOL(p(598, s)), s, p, o, m)
+# define BOOST_PP_FOR_598(s, p, o, m) BOOST_PP_FOR_598_C(BOOST_PP_BOOL(p(599, s)), s, p, o, m)
+# define BOOST_PP_FOR_599(s, p, o, m) BOOST_PP_FOR_599_C(BOOST_PP_BOOL(p(600, s)), s, p, o, m)
+# define BOOST_PP_FOR_600(s, p, o, m) BOOST_PP_FOR_600_C(BOOST_PP_BOOL(p(601, s)), s, p, o, m)
+# define BOOST_PP_FOR_601(s, p, o, m) BOOST_PP_FOR_601_C(BOOST_PP_BOOL(p(602, s)), s, p, o, m)
+# define BOOST_PP_FOR_602(s, p, o, m) BOOST_PP_FOR_602_C(BOOST_PP_BOOL(p(603, s)), s, p, o, m)
+# define BOOST_PP_FOR_603(s, p, o, m) BOOST_PP_FOR_603_C(BOOST_PP_BOOL(p(604, s)), s, p, o, m)
+# define BOOST_PP_FOR_604(s, p, o, m) BOOST_PP_FOR_604_C(BOOST_PP_BOOL(p(605, s)), s, p, o, m)
+# define BOOST_PP_FOR_605(s, p, o, m) BOOST_PP_FOR_605_C(BOOST_PP_BOOL(p(606, s)), s, p, o, m)
+# define BOOST_PP_FOR_606(s, p, o, m) BOOST_PP_FOR_606_C(BOOST_PP_BOOL(p(607, s)), s, p, o, m)
+# define BOOST_PP_FOR_607(s, p, o, m) BOOST_PP_FOR_607_C(BOOST_PP_BOOL(p(608, s)), s, p, o, m)
+# define BOOST_PP_FOR_608(s, p, o, m) BOOST_PP_FOR_608_C(BOOST_PP_BOOL(p(609, s)), s, p, o, m)
+# define BOOST_PP_FOR_609(s, p, o, m) BOOST_PP_FOR_609_C(BOOST_PP_BOOL(p(610, s)), s, p, o, m)
+# define BOOST_PP_FOR_610(s, p, o, m) BOOST_PP_FOR_610_C(BOOST_PP_BOOL(p(611, s)), s, p, o, m)
+# define BOOST_PP_FOR_611(s, p, o, m) BOOST_PP_FOR_611_C(BOOST_PP_BOOL(p(612, s)), s, p, o, m)
+# define BOOST_PP_FOR_612(s, p, o, m) BOOST_PP_FOR_612_C(BOOST_PP_BOOL(p(613, s)), s, p, o, m)
+# define BOOST_PP_FOR_613(s, p, o, m) BOOST_PP_FOR_613_C(BOOST_PP_BOOL(p(614, s)), s, p, o, m)
+# define BOOST_PP_FOR_614(s, p, o, m) BOOST_PP_FOR_614_C(BOOST_PP_BOOL(p(615, s)), s, p, o, m)
+# define BOOST_PP_FOR_615(s, p, o, m) BOOST_PP_FOR_615_C(BOOST_PP_BOOL(p(616, s)), s, p, o, m)
+# define BOOST_PP_FOR_616(s, p, o, m) BOOST_PP_FOR_616_C(BOOST_PP_BOOL(p(617, s)), s, p, o, m)
+# define BOOST_PP_FOR_617(s, p, o, m) BOOST_PP_FOR_617_C(BOOST_PP_BOOL(p(618, s)), s, p, o, m)
+# define BOOST_PP_FOR_618(s, p, o, m) BOOST_PP_FOR_618_C(BOOST_PP_BOOL(p(619, s)), s, p, o, m)
+# define BOOST_PP_FOR_619(s, p, o, m) BOOST_PP_FOR_619_C(BOOST_PP_BOOL(p(620, s)), s, p, o, m)
+# define BOOST_PP_FOR_620(s, p, o, m) BOOST_PP_FOR_620_C(BOOST_PP_BOOL(p(621, s)), s, p, o, m)
+# define BOOST_PP_FOR_621(s, p, o, m) BOOST_PP_FOR_621_C(BOOST_PP_BOOL(p(622, s)), s, p, o, m)
+# define BOOST_PP_FOR_622(s, p, o, m) BOOST_PP_FOR_622_C(BOOST_PP_BOOL(p(623, s)), s, p, o, m)
+# define BOOST_PP_FOR_623(s, p, o, m) BOOST_PP_FOR_623_C(BOOST_PP_BOOL(p(624, s)), s, p, o, m)
+# define BOOST_PP_FOR_624(s, p, o, m) BOOST_PP_FOR_624_C(BOOST_PP_BOOL(p(625, s)), s, p, o, m)
+# define BOOST_PP_FOR_625(s, p, o, m) BOOST_PP_FOR_625_C(BOOST_PP_BOOL(p(626, s)), s, p, o, m)
+# define BOOST_PP_FOR_626(s, p, o, m) BOOST_PP_FOR_626_C(BOOST_PP_BOOL(p(627, s)), s, p, o, m)
+# define BOOST_PP_FOR_627(s, p, o, m) BOOST_PP_FOR_627_C(BOOST_PP_BOOL(p(628, s)), s, p, o, m)
+# define BOOST_PP_FOR_628(s, p, o, m) BOOST_PP_FOR_628_C(BOOST_PP_BOOL(p(629, s)), s, p, o, m)
+# define BOOST_PP_FOR_629(s, p, o, m) BOOST_PP_FOR_629_C(BOOST_PP_BOOL(p(630, s)), s, p, o, m)
+# define BOOST_PP_FOR_630(s, p, o, m) BOOST_PP_FOR_630_C(BOOST_PP_BOOL(p(631, s)), s, p, o, m)
+# define BOOST_PP_FOR_631(s, p, o, m) BOOST_PP_FOR_631_C(BOOST_PP_BOOL(p(632, s)), s, p, o, m)
+# define BOOST_PP_FOR_632(s, p, o, m) BOOST_PP_FOR_632_C(BOOST_PP_BOOL(p(633, s)), s, p, o, m)
+# define BOOST_PP_FOR_633(s, p, o, m) BOOST_PP_FOR_633_C(BOOST_PP_BOOL(p(634, s)), s, p, o, m)
+# define BOOST_PP_FOR_634(s, p, o, m) BOOST_PP_FOR_634_C(BOOST_PP_BOOL(p(635, s)), s, p, o, m)
+# define BOOST_PP_FOR_635(s, p, o, m) BOOST_PP_FOR_635_C(BOOST_PP_BOOL(p(636, s)), s, p, o, m)
+# define BOOST_PP_FOR_636(s, p, o, m) BOOST_PP_FOR_636_C(BOOST_PP_BOOL(p(637, s)), s, p, o, m)
+# define BOOST_PP_FOR_637(s, p, o, m) BOOST_PP_FOR_637_C(BOOST_PP_BOOL(p(638, s)), s, p, o, m)
+# define BOOST_PP_FOR_638(s, p, o, m) BOOST_PP_FOR_638_C(BOOST_PP_BOOL(p(639, s)), s, p, o, m)
+# define BOOST_PP_FOR_639(s, p, o, m) BOOST_PP_FOR_639_C(BOOST_PP_BOOL(p(640, s)), s, p, o, m)
+# define BOOST_PP_FOR_640(s, p, o, m) BOOST_PP_FOR_640_C(BOOST_PP_BOOL(p(641, s)), s, p, o, m)
+# define BOOST_PP_FOR_641(s, p, o, m) BOOST_PP_FOR_641_C(BOOST_PP_BOOL(p(642, s)), s, p, o, m)
+# define BOOST_PP_FOR_642(s, p, o, m) BOOST_PP_FOR_642_C(BOOST_PP_BOOL(p(643, s)), s, p, o, m)
+# define BOOST_PP_FOR_643(s, p, o, m) BOOST_PP_FOR_643_C(BOOST_PP_BOOL(p(644, s)), s, p, o, m)
+# define BOOST_PP_FOR_644(s, p, o, m) BOOST_PP_FOR_644_C(BOOST_PP_BOOL(p(645, s)), s, p, o, m)
+# define BOOST_PP_FOR_645(s, p, o, m) BOOST_PP_FOR_645_C(BOOST_PP_BOOL(p(646, s)), s, p, o, m)
+# define BOOST_PP_FOR_646(s, p, o, m) BOOST_PP_FOR_646_C(BOOST_PP_BOOL(p(647, s)), s, p, o, m)
+# define BOOST_PP_FOR_647(s, p, o, m) BOOST_PP_FOR_647_C(BOOST_PP_BOOL(p(648, s)), s, p, o, m)
+# define BOOST_PP_FOR_648(s, p, o, m) BOOST_PP_FOR_648_C(BOOST_PP_BOOL(p(649, s)), s, p, o, m)
+# define BOOST_PP_FOR_649(s, p, o, m) BOOST_PP_FOR_649_C(BOOST_PP_BOOL(p(650, s)), s, p, o, m)
+# define BOOST_PP_FOR_650(s, p, o, m) BOOST_PP_FOR_650_C(BOOST_PP_BOOL(p(651, s)), s, p, o, m)
+# define BOOST_PP_FOR_651(s, p, o, m) BOOST_PP_FOR_651_C(BOOST_PP_BOOL(p(652, s)), s, p, o, m)
+# define BOOST_PP_FOR_652(s, p, o, m) BOOST_PP_FOR_652_C(BOOST_PP_BOOL(p(653, s)), s, p, o, m)
+# define BOOST_PP_FOR_653(s, p, o, m) BOOST_PP_FOR_653_C(BOOST_PP_BOOL(p(654, s)), s, p, o, m)
+# define BOOST_PP_FOR_654(s, p, o, m) BOOST_PP_FOR_654_C(BOOST_PP_BOOL(p(655, s)), s, p, o, m)
+# define BOOST_PP_FOR_655(s, p, o, m) BOOST_PP_FOR_655_C(BOOST_PP_BOOL(p(656, s)), s, p, o, m)
+# define BOOST_PP_FOR_656(s, p, o, m) BOOST_PP_FOR_656_C(BOOST_PP_BOOL(p(657, s)), s, p, o, m)
+# define BOOST_PP_FOR_657(s, p, o, m) BOOST_PP_FOR_657_C(BOOST_PP_BOOL(p(658, s)), s, p, o, m)
+# define BOOST_PP_FOR_658(s, p, o, m) BOOST_PP_FOR_658_C(BOOST_PP_BOOL(p(659, s)), s, p, o, m)
+# define BOOST_PP_FOR_659(s, p, o, m) BOOST_PP_FOR_659_C(BOOST_PP_BOOL(p(660, s)), s, p, o, m)
+# define BOOST_PP_FOR_660(s, p, o, m) BOOST_PP_FOR_660_C(BOOST_PP_BOOL(p(661, s)), s, p, o, m)
+# define BOOST_PP_FOR_661(s, p, o, m) BOOST_PP_FOR_661_C(BOOST_PP_BOOL(p(662, s)), s, p, o, m)
+# define BOOST_PP_FOR_662(s, p, o, m) BOOST_PP_FOR_662_C(BOOST_PP_BOOL(p(663, s)), s, p, o, m)
+# define BOOST_PP_FOR_663(s, p, o, m) BOOST_PP_FOR_663_C(BOOST_PP_BOOL(p(664, s)), s, p, o, m)
+# define BOOST_PP_FOR_664(s, p, o, m) BOOST_PP_FOR_664_C(BOOST_PP_BOOL(p(665, s)), s, p, o, m)
+# define BOOST_PP_FOR_665(s, p, o, m) BOOST_PP_FOR_665_C(BOOST_PP_BOOL(p(666, s)), s, p, o, m)
+# define BOOST_PP_FOR_666(s, p, o, m) BOOST_PP_FOR_666_C(BOOST_PP_BOOL(p(667, s)), s, p, o, m)
+# define BOOST_PP_FOR_667(s, p, o, m) BOOST_PP_FOR_667_C(BOOST_PP_BOOL(p(668, s)), s, p, o, m)
+# define BOOST_PP_FOR_668(s, p, o, m) BOOST_PP_FOR_668_C(BOOST_PP_BOOL(p(669, s)), s, p, o, m)
+# define BOOST_PP_FOR_669(s, p, o, m) BOOST_PP_FOR_669_C(BOOST_PP_BOOL(p(670, s)), s, p, o, m)
+# define BOOST_PP_FOR_670(s, p, o, m) BOOST_PP_FOR_670_C(BOOST_PP_BOOL(p(671, s)), s, p, o, m)
+# define BOOST_PP_FOR_671(s, p, o, m) BOOST_PP_FOR_671_C(BOOST_PP_BOOL(p(672, s)), s, p, o, m)
+# define BOOST_PP_FOR_672(s, p, o, m) BOOST_PP_FOR_672_C(BOOST_PP_BOOL(p(673, s)), s, p, o, m)
+# define BOOST_PP_FOR_673(s, p, o, m) BOOST_PP_FOR_673_C(BOOST_PP_BOOL(p(674, s)), s, p, o, m)
+# define BOOST_PP_FOR_674(s, p, o, m) BOOST_PP_FOR_674_C(BOOST_PP_BOOL(p(675, s)), s, p, o, m)
+# define BOOST_PP_FOR_675(s, p, o, m) BOOST_PP_FOR_675_C(BOOST_PP_BOOL(p(676, s)), s, p, o, m)
+# define BOOST_PP_FOR_676(s, p, o, m) BOOST_PP_FOR_676_C(BOOST_PP_BOOL(p(677, s)), s, p, o, m)
+# define BOOST_PP_FOR_677(s, p, o, m) BOOST_PP_FOR_677_C(BOOST_PP_BOOL(p(678, s)), s, p, o, m)
+# define BOOST_PP_FOR_678(s, p, o, m) BOOST_PP_FOR_678_C(BOOST_PP_BOOL(p(679, s)), s, p, o, m)
+# define BOOST_PP_FOR_679(s, p, o, m) BOOST_PP_FOR_679_C(BOOST_PP_BOOL(p(680, s)), s, p, o, m)
+# define BOOST_PP_FOR_680(s, p, o, m) BOOST_PP_FOR_680_C(BOOST_PP_BOOL(p(681, s)), s, p, o, m)
+# define BOOST_PP_FOR_681(s, p, o, m) BOOST_PP_FOR_681_C(BOOST_PP_BOOL(p(682, s)), s, p, o, m)
+# define BOOST_PP_FOR_682(s, p, o, m) BOOST_PP_FOR_682_C(BOOST_PP_BOOL(p(683, s)), s, p, o, m)
+# define BOOST_PP_FOR_683(s, p, o, m) BOOST_PP_FOR_683_C(BOOST_PP_BOOL(p(684, s)), s, p, o, m)
+# define BOOST_PP_FOR_684(s, p, o, m) BOOST_PP_FOR_684_C(BOOST_PP_BOOL(p(685, s)), s, p, o, m)
+# define BOOST_PP_FOR_685(s, p, o, m) BOOST_PP_FOR_685_C(BOOST_PP_BOOL(p(686, s)), s, p, o, m)
+# define BOOST_PP_FOR_686(s, p, o, m) BOOST_PP_FOR_686_C(BOOST_PP_BOOL(p(687, s)), s, p, o, m)
+# define BOOST_PP_FOR_687(s, p, o, m) BOOST_PP_FOR_687_C(BOOST_PP_BOOL(p(688, s)), s, p, o, m)
+# define BOOST_PP_FOR_688(s, p, o, m) BOOST_PP_FOR_688_C(BOOST_PP_BOOL(p(689, s)), s, p, o, m)
+# define BOOST_PP_FOR_689(s, p, o, m) BOOST_PP_FOR_689_C(BOOST_PP_BOOL(p(690, s)), s, p, o, m)
+# define BOOST_PP_FOR_690(s, p, o, m) BOOST_PP_FOR_690_C(BOOST_PP_BOOL(p(691, s)), s, p, o, m)
+# define BOOST_PP_FOR_691(s, p, o, m) BOOST_PP_FOR_691_C(BOOST_PP_BOOL(p(692, s)), s, p, o, m)
+# define BOOST_PP_FOR_692(s, p, o, m) BOOST_PP_FOR_692_C(BOOST_PP_BOOL(p(693, s)), s, p, o, m)
+# define BOOST_PP_FOR_693(s, p, o, m) BOOST_PP_FOR_693_C(BOOST_PP_BOOL(p(694, s)), s, p, o, m)
+# define BOOST_PP_FOR_694(s, p, o, m) BOOST_PP_FOR_694_C(BOOST_PP_BOOL(p(695, s)), s, p, o, m)
+# define BOOST_PP_FOR_695(s, p, o, m) BOOST_PP_FOR_695_C(BOOST_PP_BOOL(p(696, s)), s, p, o, m)
+# define BOOST_PP_FOR_696(s, p, o, m) BOOST_PP_FOR_696_C(BOOST_PP_BOOL(p(697, s)), s, p, o, m)
+# define BOOST_PP_FOR_697(s, p, o, m) BOOST_PP_FOR_697_C(BOOST_PP_BOOL(p(698, s)), s, p, o, m)
+# define BOOST_PP_FOR_698(s, p, o, m) BOOST_PP_FOR_698_C(BOOST_PP_BOOL(p(699, s)), s, p, o, m)
+# define BOOST_PP_FOR_699(s, p, o, m) BOOST_PP_FOR_699_C(BOOST_PP_BOOL(p(700, s)), s, p, o, m)
+# define BOOST_PP_FOR_700(s, p, o, m) BOOST_PP_FOR_700_C(BOOST_PP_BOOL(p(701, s)), s, p, o, m)
+# define BOOST_PP_FOR_701(s, p, o, m) BOOST_PP_FOR_701_C(BOOST_PP_BOOL(p(702, s)), s, p, o, m)
+# define BOOST_PP_FOR_702(s, p, o, m) BOOST_PP_FOR_702_C(BOOST_PP_BOOL(p(703, s)), s, p, o, m)
+# define BOOST_PP_FOR_703(s, p, o, m) BOOST_PP_FOR_703_C(BOOST_PP_BOOL(p(704, s)), s, p, o, m)
+# define BOOST_PP_FOR_704(s, p, o, m) BOOST_PP_FOR_704_C(BOOST_PP_BOOL(p(705, s)), s, p, o, m)
+# define BOOST_PP_FOR_705(s, p, o, m) BOOST_PP_FOR_705_C(BOOST_PP_BOOL(p(706, s)), s, p, o, m)
+# define BOOST_PP_FOR_706(s, p, o, m) BOOST_PP_FOR_706_C(BOOST_PP_BOOL(p(707, s)), s, p, o, m)
+# define BOOST_PP_FOR_707(s, p, o, m) BOOST_PP_FOR_707_C(BOOST_PP_BOOL(p(708, s)), s, p, o, m)
+# define BOOST_PP_FOR_708(s, p, o, m) BOOST_PP_FOR_708_C(BOOST_PP_BOOL(p(709, s)), s, p, o, m)
+# define BOOST_PP_FOR_709(s, p, o, m) BOOST_PP_FOR_709_C(BOOST_PP_BOOL(p(710, s)), s, p, o, m)
+# define BOOST_PP_FOR_710(s, p, o, m) BOOST_PP_FOR_710_C(BOOST_PP_BOOL(p(711, s)), s, p, o, m)
+# define BOOST_PP_FOR_711(s, p, o, m) BOOST_PP_FOR_711_C(BOOST_PP_BOOL(p(712, s)), s, p, o, m)
+# define BOOST_PP_FOR_712(s, p, o, m) BOOST_PP_FOR_712_C(BOOST_PP_BOOL(p(713, s)), s, p, o, m)
+# define BOOST_PP_FOR_713(s, p, o, m) BOOST_PP_FOR_713_C(BOOST_PP_BOOL(p(714, s)), s, p, o, m)
+# define BOOST_PP_FOR_714(s, p, o, m) BOOST_PP_FOR_714_C(BOOST_PP_BOOL(p(715, s)), s, p, o, m)
+# define BOOST_PP_FOR_715(s, p, o, m) BOOST_PP_FOR_715_C(BOOST_PP_BOOL(p(716, s)), s, p, o, m)
+# define BOOST_PP_FOR_716(s, p, o, m) BOOST_PP_FOR_716_C(BOOST_PP_BOOL(p(717, s)), s, p, o, m)
+# define BOOST_PP_FOR_717(s, p, o, m) BOOST_PP_FOR_717_C(BOOST_PP_BOOL(p(718, s)), s, p, o, m)
+# define BOOST_PP_FOR_718(s, p, o, m) BOOST_PP_FOR_718_C(BOOST_PP_BOOL(p(719, s)), s, p, o, m)
+# define BOOST_PP_FOR_719(s, p, o, m) BOOST_PP_FOR_719_C(BOOST_PP_BOOL(p(720, s)), s, p, o, m)
+# define BOOST_PP_FOR_720(s, p, o, m) BOOST_PP_FOR_720_C(BOOST_PP_BOOL(p(721, s)), s, p, o, m)
+# define BOOST_PP_FOR_721(s, p, o, m) BOOST_PP_FOR_721_C(BOOST_PP_BOOL(p(722, s)), s, p, o, m)
+# define BOOST_PP_FOR_722(s, p, o, m) BOOST_PP_FOR_722_C(BOOST_PP_BOOL(p(723, s)), s, p, o, m)
+# define BOOST_PP_FOR_723(s, p, o, m) BOOST_PP_FOR_723_C(BOOST_PP_BOOL(p(724, s)), s, p, o, m)
+# define BOOST_PP_FOR_724(s, p, o, m) BOOST_PP_FOR_724_C(BOOST_PP_BOOL(p(725, s)), s, p, o, m)
+# define BOOST_PP_FOR_725(s, p, o, m) BOOST_PP_FOR_725_C(BOOST_PP_BOOL(p(726, s)), s, p, o, m)
+# define BOOST_PP_FOR_726(s, p, o, m) BOOST_PP_FOR_726_C(BOOST_PP_BOOL(p(727, s)), s, p, o, m)
+# define BOOST_PP_FOR_727(s, p, o, m) BOOST_PP_FOR_727_C(BOOST_PP_BOOL(p(728, s)), s, p, o, m)
+# define BOOST_PP_FOR_728(s, p, o, m) BOOST_PP_FOR_728_C(BOOST_PP_BOOL(p(729, s)), s, p, o, m)
+# define BOOST_PP_FOR_729(s, p, o, m) BOOST_PP_FOR_729_C(BOOST_PP_BOOL(p(730, s)), s, p, o, m)
+# define BOOST_PP_FOR_730(s, p, o, m) BOOST_PP_FOR_730_C(BOOST_PP_BOOL(p(731, s)), s, p, o, m)
+# define BOOST_PP_FOR_731(s, p, o, m) BOOST_PP_FOR_731_C(BOOST_PP_BOOL(p(732, s)), s, p, o, m)
+# define BOOST_PP_FOR_732(s, p, o, m) BOOST_PP_FOR_732_C(BOOST_PP_BOOL(p(733, s)), s, p, o, m)
+# define BOOST_PP_FOR_733(s, p, o, m) BOOST_PP_FOR_733_C(BOOST_PP_BOOL(p(734, s)), s, p, o, m)
+# define BOOST_PP_FOR_734(s, p, o, m) BOOST_PP_FOR_734_C(BOOST_PP_BOOL(p(735, s)), s, p, o, m)
+# define BOOST_PP_FOR_735(s, p, o, m) BOOST_PP_FOR_735_C(BOOST_PP_BOOL(p(736, s)), s, p, o, m)
+# define BOOST_PP_FOR_736(s, p, o, m) BOOST_PP_FOR_736_C(BOOST_PP_BOOL(p(737, s)), s, p, o, m)
+# define BOOST_PP_FOR_737(s, p, o, m) BOOST_PP_FOR_737_C(BOOST_PP_BOOL(p(738, s)), s, p, o, m)
+# define BOOST_PP_FOR_738(s, p, o, m) BOOST_PP_FOR_738_C(BOOST_PP_BOOL(p(739, s)), s, p, o, m)
+# define BOOST_PP_FOR_739(s, p, o, m) BOOST_PP_FOR_739_C(BOOST_PP_BOOL(p(740, s)), s, p, o, m)
+# define BOOST_PP_FOR_740(s, p, o, m) BOOST_PP_FOR_740_C(BOOST_PP_BOOL(p(741, s)), s, p, o, m)
+# define BOOST_PP_FOR_741(s, p, o, m) BOOST_PP_FOR_741_C(BOOST_PP_BOOL(p(742, s)), s, p, o, m)
+# define BOOST_PP_FOR_742(s, p, o, m) BOOST_PP_FOR_742_C(BOOST_PP_BOOL(p(743, s)), s, p, o, m)
+# define BOOST_PP_FOR_743(s, p, o, m) BOOST_PP_FOR_743_C(BOOST_PP_BOOL(p(744, s)), s, p, o, m)
+# define BOOST_PP_FOR_744(s, p, o, m) BOOST_PP_FOR_744_C(BOOST_PP_BOOL(p(745, s)), s, p, o, m)
+# define BOOST_PP_FOR_745(s, p, o, m) BOOST_PP_FOR_745_C(BOOST_PP_BOOL(p(746, s)), s, p, o, m)
+# define BOOST_PP_FOR_746(s, p, o, m) BOOST_PP_FOR_746_C(BOOST_PP_BOOL(p(747, s)), s, p, o, m)
+# define BOOST_PP_FOR_747(s, p, o, m) BOOST_PP_FOR_747_C(BOOST_PP_BOOL(p(748, s)), s, p, o, m)
+# define BOOST_PP_FOR_748(s, p, o, m) BOOST_PP_FOR_748_C(BOOST_PP_BOOL(p(749, s)), s, p, o, m)
+# define BOOST_PP_FOR_749(s, p, o, m) BOOST_PP_FOR_749_C(BOOST_PP_BOOL(p(750, s)), s, p, o, m)
+# define BOOST_PP_FOR_750(s, p, o, m) BOOST_PP_FOR_750_C(BOOST_PP_BOOL(p(751, s)), s, p, o, m)
+# define BOOST_PP_FOR_751(s, p, o, m) BOOST_PP_FOR_751_C(BOOST_PP_BOOL(p(752, s)), s, p, o, m)
+# define BOOST_PP_FOR_752(s, p, o, m) BOOST_PP_FOR_752_C(BOOST_PP_BOOL(p(753, s)), s, p, o, m)
+# define BOOST_PP_FOR_753(s, p, o, m) BOOST_PP_FOR_753_C(BOOST_PP_BOOL(p(754, s)), s, p, o, m)
+# define BOOST_PP_FOR_754(s, p, o, m) BOOST_PP_FOR_754_C(BOOST_PP_BOOL(p(755, s)), s, p, o, m)
+# define BOOST_PP_FOR_755(s, p, o, m) BOOST_PP_FOR_755_C(BOOST_PP_BOOL(p(756, s)), s, p, o, m)
+# define BOOST_PP_FOR_756(s, p, o, m) BOOST_PP_FOR_756_C(BOOST_PP_BOOL(p(757, s)), s, p, o, m)
+# define BOOST_PP_FOR_757(s, p, o, m) BOOST_PP_FOR_757_C(BOOST_PP_BOOL(p(758, s)), s, p, o, m)
+# define BOOST_PP_FOR_758(s, p, o, m) BOOST_PP_FOR_758_C(BOOST_PP_BOOL(p(759, s)), s, p, o, m)
+# define BOOST_PP_FOR_759(s, p, o, m) BOOST_PP_FOR_759_C(BOOST_PP_BOOL(p(760, s)), s, p, o, m)
+# define BOOST_PP_FOR_760(s, p, o, m) BOOST_PP_FOR_760_C(BOOST_PP_BOOL(p(761, s)), s, p, o, m)
+# define BOOST_PP_FOR_761(s, p, o, m) BOOST_PP_FOR_761_C(BOOST_PP_BOOL(p(762, s)), s, p, o, m)
+# define BOOST_PP_FOR_762(s, p, o, m) BOOST_PP_FOR_762_C(BOOST_PP_BOOL(p(763, s)), s, p, o, m)
+# define BOOST_PP_FOR_763(s, p, o, m) BOOST_PP_FOR_763_C(BOOST_PP_BOOL(p(764, s)), s, p, o, m)
+# define BOOST_PP_FOR_764(s, p, o, m) BOOST_PP_FOR_764_C(BOOST_PP_BOOL(p(765, s)), s, p, o, m)
+# define BOOST_PP_FOR_765(s, p, o, m) BOOST_PP_FOR_765_C(BOOST_PP_BOOL(p(766, s)), s, p, o, m)
+# define BOOST_PP_FOR_766(s, p, o, m) BOOST_PP_FOR_766_C(BOOST_PP_BOOL(p(767, s)), s, p, o, m)
+# define BOOST_PP_FOR_767(s, p, o, m) BOOST_PP_FOR_767_C(BOOST_PP_BOOL(p(768, s)), s, p, o, m)
+# define BOOST_PP_FOR_768(s, p, o, m) BOOST_PP_FOR_768_C(BOOST_PP_BOOL(p(769, s)), s, p, o, m)
+# define BOOST_PP_FOR_769(s, p, o, m) BOOST_PP_FOR_769_C(BOOST_PP_BOOL(p(770, s)), s, p, o, m)
+# define BOOST_PP_FOR_770(s, p, o, m) BOOST_PP_FOR_770_C(BOOST_PP_BOOL(p(771, s)), s, p, o, m)
+# define BOOST_PP_FOR_771(s, p, o, m) BOOST_PP_FOR_771_C(BOOST_PP_BOOL(p(772, s)), s, p, o, m)
+# define BOOST_PP_FOR_772(s, p, o, m) BOOST_PP_FOR_772_C(BOOST_PP_BOOL(p(773, s)), s, p, o, m)
+# define BOOST_PP_FOR_773(s, p, o, m) BOOST_PP_FOR_773_C(BOOST_PP_BOOL(p(774, s)), s, p, o, m)
+# define BOOST_PP_FOR_774(s, p, o, m) BOOST_PP_FOR_774_C(BOOST_PP_BOOL(p(775, s)), s, p, o, m)
+# define BOOST_PP_FOR_775(s, p, o, m) BOOST_PP_FOR_775_C(BOOST_PP_BOOL(p(776, s)), s, p, o, m)
+# define BOOST_PP_FOR_776(s, p, o, m) BOOST_PP_FOR_776_C(BOOST_PP_BOOL(p(777, s)), s, p, o, m)
+# define BOOST_PP_FOR_777(s, p, o, m) BOOST_PP_FOR_777_C(BOOST_PP_BOOL(p(778, s)), s, p, o, m)
+# define BOOST_PP_FOR_778(s, p, o, m) BOOST_PP_FOR_778_C(BOOST_PP_BOOL(p(779, s)), s, p, o, m)
+# define BOOST_PP_FOR_779(s, p, o, m) BOOST_PP_FOR_779_C(BOOST_PP_BOOL(p(780, s)), s, p, o, m)
+# define BOOST_PP_FOR_780(s, p, o, m) BOOST_PP_FOR_780_C(BOOST_PP_BOOL(p(781, s)), s, p, o, m)
+# define BOOST_PP_FOR_781(s, p, o, m) BOOST_PP_FOR_781_C(BOOST_PP_BOOL(p(782, s)), s, p, o, m)
+# define BOOST_PP_FOR_782(s, p, o, m) BOOST_PP_FOR_782_C(BOOST_PP_BOOL(p(783, s)), s, p, o, m)
+# define BOOST_PP_FOR_783(s, p, o, m) BOOST_PP_FOR_783_C(BOOST_PP_BOOL(p(784, s)), s, p, o, m)
+# define BOOST_PP_FOR_784(s, p, o, m) BOOST_PP_FOR_784_C(BOOST_PP_BOOL(p(785, s)), s, p, o, m)
+# define BOOST_PP_FOR_785(s, p, o, m) BOOST_PP_FOR_785_C(BOOST_PP_BOOL(p(786, s)), s, p, o, m)
+# define BOOST_PP_FOR_786(s, p, o, m) BOOST_PP_FOR_786_C(BOOST_PP_BOOL(p(787, s)), s, p, o, m)
+# define BOOST_PP_FOR_787(s, p, o, m) BOOST_PP_FOR_787_C(BOOST_PP_BOOL(p(788, s)), s, p, o, m)
+# define BOOST_PP_FOR_788(s, p, o, m) BOOST_PP_FOR_788_C(BOOST_PP_BOOL(p(789, s)), s, p, o, m)
+# define BOOST_PP_FOR_789(s, p, o, m) BOOST_PP_FOR_789_C(BOOST_PP_BOOL(p(790, s)), s, p, o, m)
+# define BOOST_PP_FOR_790(s, p, o, m) BOOST_PP_FOR_790_C(BOOST_PP_BOOL(p(791, s)), s, p, o, m)
+# define BOOST_PP_FOR_791(s, p, o, m) BOOST_PP_FOR_791_C(BOOST_PP_BOOL(p(792, s)), s, p, o, m)
+# define BOOST_PP_FOR_792(s, p, o, m) BOOST_PP_FOR_792_C(BOOST_PP_BOOL(p(793, s)), s, p, o, m)
+# define BOOST_PP_FOR_793(s, p, o, m) BOOST_PP_FOR_793_C(BOOST_PP_BOOL(p(794, s)), s, p, o, m)
+# define BOOST_PP_FOR_794(s, p, o, m) BOOST_PP_FOR_794_C(BOOST_PP_BOOL(p(795, s)), s, p, o, m)
+# define BOOST_PP_FOR_795(s, p, o, m) BOOST_PP_FOR_795_C(BOOST_PP_BOOL(p(796, s)), s, p, o, m)
+# define BOOST_PP_FOR_796(s, p, o, m) BOOST_PP_FOR_796_C(BOOST_PP_BOOL(p(797, s)), s, p, o, m)
+# define BOOST_PP_FOR_797(s, p, o, m) BOOST_PP_FOR_797_C(BOOST_PP_BOOL(p(798, s)), s, p, o, m)
+# define BOOST_PP_FOR_798(s, p, o, m) BOOST_PP_FOR_798_C(BOOST_PP_BOOL(p(799, s)), s, p, o, m)
+# define BOOST_PP_FOR_799(s, p, o, m) BOOST_PP_FOR_799_C(BOOST_PP_BOOL(p(800, s)), s, p, o, m)
+# define BOOST_PP_FOR_800(s, p, o, m) BOOST_PP_FOR_800_C(BOOST_PP_BOOL(p(801, s)), s, p, o, m)
+# define BOOST_PP_FOR_801(s, p, o, m) BOOST_PP_FOR_801_C(BOOST_PP_BOOL(p(802, s)), s, p, o, m)
+# define BOOST_PP_FOR_802(s, p, o, m) BOOST_PP_FOR_802_C(BOOST_PP_BOOL(p(803, s)), s, p, o, m)
+# define BOOST_PP_FOR_803(s, p, o, m) BOOST_PP_FOR_803_C(BOOST_PP_BOOL(p(804, s)), s, p, o, m)
+# define BOOST_PP_FOR_804(s, p, o, m) BOOST_PP_FOR_804_C(BOOST_PP_BOOL(p(805, s)), s, p, o, m)
+# define BOOST_PP_FOR_805(s, p, o, m) BOOST_PP_FOR_805_C(BOOST_PP_BOOL(p(806, s)), s, p, o, m)
+# define BOOST_PP_FOR_806(s, p, o, m) BOOST_PP_FOR_806_C(BOOST_PP_BOOL(p(807, s)), s, p, o, m)
+# define BOOST_PP_FOR_807(s, p, o, m) BOOST_PP_FOR_807_C(BOOST_PP_BOOL(p(808, s)), s, p, o, m)
+# define BOOST_PP_FOR_808(s, p, o, m) BOOST_PP_FOR_808_C(BOOST_PP_BOOL(p(809, s)), s, p, o, m)
+# define BOOST_PP_FOR_809(s, p, o, m) BOOST_PP_FOR_809_C(BOOST_PP_BOOL(p(810, s)), s, p, o, m)
+# define BOOST_PP_FOR_810(s, p, o, m) BOOST_PP_FOR_810_C(BOOST_PP_BOOL(p(811, s)), s, p, o, m)
+# define BOOST_PP_FOR_811(s, p, o, m) BOOST_PP_FOR_811_C(BOOST_PP_BOOL(p(812, s)), s, p, o, m)
+# define BOOST_PP_FOR_812(s, p, o, m) BOOST_PP_FOR_812_C(BOOST_PP_BOOL(p(813, s)), s, p, o, m)
+# define BOOST_PP_FOR_813(s, p, o, m) BOOST_PP_FOR_813_C(BOOST_PP_BOOL(p(814, s)), s, p, o, m)
+# define BOOST_PP_FOR_814(s, p, o, m) BOOST_PP_FOR_814_C(BOOST_PP_BOOL(p(815, s)), s, p, o, m)
+# define BOOST_PP_FOR_815(s, p, o, m) BOOST_PP_FOR_815_C(BOOST_PP_BOOL(p(816, s)), s, p, o, m)
+# define BOOST_PP_FOR_816(s, p, o, m) BOOST_PP_FOR_816_C(BOOST_PP_BOOL(p(817, s)), s, p, o, m)
+# define BOOST_PP_FOR_817(s, p, o, m) BOOST_PP_FOR_817_C(BOOST_PP_BOOL(p(818, s)), s, p, o, m)
+# define BOOST_PP_FOR_818(s, p, o, m) BOOST_PP_FOR_818_C(BOOST_PP_BOOL(p(819, s)), s, p, o, m)
+# define BOOST_PP_FOR_819(s, p, o, m) BOOST_PP_FOR_819_C(BOOST_PP_BOOL(p(820, s)), s, p, o, m)
+# define BOOST_PP_FOR_820(s, p, o, m) BOOST_PP_FOR_820_C(BOOST_PP_BOOL(p(821, s)), s, p, o, m)
+# define BOOST_PP_FOR_821(s, p, o, m) BOOST_PP_FOR_821_C(BOOST_PP_BOOL(p(822, s)), s, p, o, m)
+# define BOOST_PP_FOR_822(s, p, o, m) BOOST_PP_FOR_822_C(BOOST_PP_BOOL(p(823, s)), s, p, o, m)
+# define BOOST_PP_FOR_823(s, p, o, m) BOOST_PP_FOR_823_C(BOOST_PP_BOOL(p(824, s)), s, p, o, m)
+# define BOOST_PP_FOR_824(s, p, o, m) BOOST_PP_FOR_824_C(BOOST_PP_BOOL(p(825, s)), s, p, o, m)
+# define BOOST_PP_FOR_825(s, p, o, m) BOOST_PP_FOR_825_C(BOOST_PP_BOOL(p(826, s)), s, p, o, m)
+# define BOOST_PP_FOR_826(s, p, o, m) BOOST_PP_FOR_826_C(BOOST_PP_BOOL(p(827, s)), s, p, o, m)
+# define BOOST_PP_FOR_827(s, p, o, m) BOOST_PP_FOR_827_C(BOOST_PP_BOOL(p(828, s)), s, p, o, m)
+# define BOOST_PP_FOR_828(s, p, o, m) BOOST_PP_FOR_828_C(BOOST_PP_BOOL(p(829, s)), s, p, o, m)
+# define BOOST_PP_FOR_829(s, p, o, m) BOOST_PP_FOR_829_C(BOOST_PP_BOOL(p(830, s)), s, p, o, m)
+# define BOOST_PP_FOR_830(s, p, o, m) BOOST_PP_FOR_830_C(BOOST_PP_BOOL(p(831, s)), s, p, o, m)
+# define BOOST_PP_FOR_831(s, p, o, m) BOOST_PP_FOR_831_C(BOOST_PP_BOOL(p(832, s)), s, p, o, m)
+# define BOOST_PP_FOR_832(s, p, o, m) BOOST_PP_FOR_832_C(BOOST_PP_BOOL(p(833, s)), s, p, o, m)
+# define BOOST_PP_FOR_833(s, p, o, m) BOOST_PP_FOR_833_C(BOOST_PP_BOOL(p(834, s)), s, p, o, m)
+# define BOOST_PP_FOR_834(s, p, o, m) BOOST_PP_FOR_834_C(BOOST_PP_BOOL(p(835, s)), s, p, o, m)
+# define BOOST_PP_FOR_835(s, p, o, m) BOOST_PP_FOR_835_C(BOOST_PP_BOOL(p(836, s)), s, p, o, m)
+# define BOOST_PP_FOR_836(s, p, o, m) BOOST_PP_FOR_836_C(BOOST_PP_BOOL(p(837, s)), s, p, o, m)
+# define BOOST_PP_FOR_837(s, p, o, m) BOOST_PP_FOR_837_C(BOOST_PP_BOOL(p(838, s)), s, p, o, m)
+# define BOOST_PP_FOR_838(s, p, o, m) BOOST_PP_FOR_838_C(BOOST_PP_BOOL(p(839, s)), s, p, o, m)
+# define BOOST_PP_FOR_839(s, p, o, m) BOOST_PP_FOR_839_C(BOOST_PP_BOOL(p(840, s)), s, p, o, m)
+# define BOOST_PP_FOR_840(s, p, o, m) BOOST_PP_FOR_840_C(BOOST_PP_BOOL(p(841, s)), s, p, o, m)
+# define BOOST_PP_FOR_841(s, p, o, m) BOOST_PP_FOR_841_C(BOOST_PP_BOOL(p(842, s)), s, p, o, m)
+# define BOOST_PP_FOR_842(s, p, o, m) BOOST_PP_FOR_842_C(BOOST_PP_BOOL(p(843, s)), s, p, o, m)
+# define BOOST_PP_FOR_843(s, p, o, m) BOOST_PP_FOR_843_C(BOOST_PP_BOOL(p(844, s)), s, p, o, m)
+# define BOOST_PP_FOR_844(s, p, o, m) BOOST_PP_FOR_844_C(BOOST_PP_BOOL(p(845, s)), s, p, o, m)
+# define BOOST_PP_FOR_845(s, p, o, m) BOOST_PP_FOR_845_C(BOOST_PP_BOOL(p(846, s)), s, p, o, m)
+# define BOOST_PP_FOR_846(s, p, o, m) BOOST_PP_FOR_846_C(BOOST_PP_BOOL(p(847, s)), s, p, o, m)
+# define BOOST_PP_FOR_847(s, p, o, m) BOOST_PP_FOR_847_C(BOOST_PP_BOOL(p(848, s)), s, p, o, m)
+# define BOOST_PP_FOR_848(s, p, o, m) BOOST_PP_FOR_848_C(BOOST_PP_BOOL(p(849, s)), s, p, o, m)
+# define BOOST_PP_FOR_849(s, p, o, m) BOOST_PP_FOR_849_C(BOOST_PP_BOOL(p(850, s)), s, p, o, m)
+# define BOOST_PP_FOR_850(s, p, o, m) BOOST_PP_FOR_850_C(BOOST_PP_BOOL(p(851, s)), s, p, o, m)
+# define BOOST_PP_FOR_851(s, p, o, m) BOOST_PP_FOR_851_C(BOOST_PP_BOOL(p(852, s)), s, p, o, m)
+# define BOOST_PP_FOR_852(s, p, o, m) BOOST_PP_FOR_852_C(BOOST_PP_BOOL(p(853, s)), s, p, o, m)
+# define BOOST_PP_FOR_853(s, p, o, m) BOOST_PP_FOR_853_C(BOOST_PP_BOOL(p(854, s)), s, p, o, m)
+# define BOOST_PP_FOR_854(s, p, o, m) BOOST_PP_FOR_854_C(BOOST_PP_BOOL(p(855, s)), s, p, o, m)
+# define BOOST_PP_FOR_855(s, p, o, m) BOOST_PP_FOR_855_C(BOOST_PP_BOOL(p(856, s)), s, p, o, m)
+# define BOOST_PP_FOR_856(s, p, o, m) BOOST_PP_FOR_856_C(BOOST_PP_BOOL(p(857, s)), s, p, o, m)
+# define BOOST_PP_FOR_857(s, p, o, m) BOOST_PP_FOR_857_C(BOOST_PP_BOOL(p(858, s)), s, p, o, m)
+# define BOOST_PP_FOR_858(s, p, o, m) BOOST_PP_FOR_858_C(BOOST_PP_BOOL(p(859, s)), s, p, o, m)
+# define BOOST_PP_FOR_859(s, p, o, m) BOOST_PP_FOR_859_C(BOOST_PP_BOOL(p(860, s)), s, p, o, m)
+# define BOOST_PP_FOR_860(s, p, o, m) BOOST_PP_FOR_860_C(BOOST_PP_BOOL(p(861, s)), s, p, o, m)
+# define BOOST_PP_FOR_861(s, p, o, m) BOOST_PP_FOR_861_C(BOOST_PP_BOOL(p(862, s)), s, p, o, m)
+# define BOOST_PP_FOR_862(s, p, o, m) BOOST_PP_FOR_862_C(BOOST_PP_BOOL(p(863, s)), s, p, o, m)
+# define BOOST_PP_FOR_863(s, p, o, m) BOOST_PP_FOR_863_C(BOOST_PP_BOOL(p(864, s)), s, p, o, m)
+# define BOOST_PP_FOR_864(s, p, o, m) BOOST_PP_FOR_864_C(BOOST_PP_BOOL(p(865, s)), s, p, o, m)
+# define BOOST_PP_FOR_865(s, p, o, m) BOOST_PP_FOR_865_C(BOOST_PP_BOOL(p(866, s)), s, p, o, m)
+# define BOOST_PP_FOR_866(s, p, o, m) BOOST_PP_FOR_866_C(BOOST_PP_BOOL(p(867, s)), s, p, o, m)
+# define BOOST_PP_FOR_867(s, p, o, m) BOOST_PP_FOR_867_C(BOOST_PP_BOOL(p(868, s)), s, p, o, m)
+# define BOOST_PP_FOR_868(s, p, o, m) BOOST_PP_FOR_868_C(BOOST_PP_BOOL(p(869, s)), s, p, o, m)
+# define BOOST_PP_FOR_869(s, p, o, m) BOOST_PP_FOR_869_C(BOOST_PP_BOOL(p(870, s)), s, p, o, m)
+# define BOOST_PP_FOR_870(s, p, o, m) BOOST_PP_FOR_870_C(BOOST_PP_BOOL(p(871, s)), s, p, o, m)
+# define BOOST_PP_FOR_871(s, p, o, m) BOOST_PP_FOR_871_C(BOOST_PP_BOOL(p(872, s)), s, p, o, m)
+# define BOOST_PP_FOR_872(s, p, o, m) BOOST_PP_FOR_872_C(BOOST_PP_BOOL(p(873, s)), s, p, o, m)
+# define BOOST_PP_FOR_873(s, p, o, m) BOOST_PP_FOR_873_C(BOOST_PP_BOOL(p(874, s)), s, p, o, m)
+# define BOOST_PP_FOR_874(s, p, o, m) BOOST_PP_FOR_874_C(BOOST_PP_BOOL(p(875, s)), s, p, o, m)
+# define BOOST_PP_FOR_875(s, p, o, m) BOOST_PP_FOR_875_C(BOOST_PP_BOOL(p(876, s)), s, p, o, m)
+# define BOOST_PP_FOR_876(s, p, o, m) BOOST_PP_FOR_876_C(BOOST_PP_BOOL(p(877, s)), s, p, o, m)
+# define BOOST_PP_FOR_877(s, p, o, m) BOOST_PP_FOR_877_C(BOOST_PP_BOOL(p(878, s)), s, p, o, m)
+# define BOOST_PP_FOR_878(s, p, o, m) BOOST_PP_FOR_878_C(BOOST_PP_BOOL(p(879, s)), s, p, o, m)
+# define BOOST_PP_FOR_879(s, p, o, m) BOOST_PP_FOR_879_C(BOOST_PP_BOOL(p(880, s)), s, p, o, m)
+# define BOOST_PP_FOR_880(s, p, o, m) BOOST_PP_FOR_880_C(BOOST_PP_BOOL(p(881, s)), s, p, o, m)
+# define BOOST_PP_FOR_881(s, p, o, m) BOOST_PP_FOR_881_C(BOOST_PP_BOOL(p(882, s)), s, p, o, m)
+# define BOOST_PP_FOR_882(s, p, o, m) BOOST_PP_FOR_882_C(BOOST_PP_BOOL(p(883, s)), s, p, o, m)
+# define BOOST_PP_FOR_883(s, p, o, m) BOOST_PP_FOR_883_C(BOOST_PP_BOOL(p(884, s)), s, p, o, m)
+# define BOOST_PP_FOR_884(s, p, o, m) BOOST_PP_FOR_884_C(BOOST_PP_BOOL(p(885, s)), s, p, o, m)
+# define BOOST_PP_FOR_885(s, p, o, m) BOOST_PP_FOR_885_C(BOOST_PP_BOOL(p(886, s)), s, p, o, m)
+# define BOOST_PP_FOR_886(s, p, o, m) BOOST_PP_FOR_886_C(BOOST_PP_BOOL(p(887, s)), s, p, o, m)
+# define BOOST_PP_FOR_887(s, p, o, m) BOOST_PP_FOR_887_C(BOOST_PP_BOOL(p(888, s)), s, p, o, m)
+# define BOOST_PP_FOR_888(s, p, o, m) BOOST_PP_FOR_888_C(BOOST_PP_BOOL(p(889, s)), s, p, o, m)
+# define BOOST_PP_FOR_889(s, p, o, m) BOOST_PP_FOR_889_C(BOOST_PP_BOOL(p(890, s)), s, p, o, m)
+# define BOOST_PP_FOR_890(s, p, o, m) BOOST_PP_FOR_890_C(BOOST_PP_BOOL(p(891, s)), s, p, o, m)
+# define BOOST_PP_FOR_891(s, p, o, m) BOOST_PP_FOR_891_C(BOOST_PP_BOOL(p(892, s)), s, p, o, m)
+# define BOOST_PP_FOR_892(s, p, o, m) BOOST_PP_FOR_892_C(BOOST_PP_BOOL(p(893, s)), s, p, o, m)
+# define BOOST_PP_FOR_893(s, p, o, m) BOOST_PP_FOR_893_C(BOOST_PP_BOOL(p(894, s)), s, p, o, m)
+# define BOOST_PP_FOR_894(s, p, o, m) BOOST_PP_FOR_894_C(BOOST_PP_BOOL(p(895, s)), s, p, o, m)
+# define BOOST_PP_FOR_895(s, p, o, m) BOOST_PP_FOR_895_C(BOOST_PP_BOOL(p(896, s)), s, p, o, m)
+# define BOOST_PP_FOR_896(s, p, o, m) BOOST_PP_FOR_896_C(BOOST_PP_BOOL(p(897, s)), s, p, o, m)
+# define BOOST_PP_FOR_897(s, p, o, m) BOOST_PP_FOR_897_C(BOOST_PP_BOOL(p(898, s)), s, p, o, m)
+# define BOOST_PP_FOR_898(s, p, o, m) BOOST_PP_FOR_898_C(BOOST_PP_BOOL(p(899, s)), s, p, o, m)
+# define BOOST_PP_FOR_899(s, p, o, m) BOOST_PP_FOR_899_C(BOOST_PP_BOOL(p(900, s)), s, p, o, m)
+# define BOOST_PP_FOR_900(s, p, o, m) BOOST_PP_FOR_900_C(BOOST_PP_BOOL(p(901, s)), s, p, o, m)
+# define BOOST_PP_FOR_901(s, p, o, m) BOOST_PP_FOR_901_C(BOOST_PP_BOOL(p(902, s)), s, p, o, m)
+# define BOOST_PP_FOR_902(s, p, o, m) BOOST_PP_FOR_902_C(BOOST_PP_BOOL(p(903, s)), s, p, o, m)
+# define BOOST_PP_FOR_903(s, p, o, m) BOOST_PP_FOR_903_C(BOOST_PP_BOOL(p(904, s)), s, p, o, m)
+# define BOOST_PP_FOR_904(s, p, o, m) BOOST_PP_FOR_904_C(BOOST_PP_BOOL(p(905, s)), s, p, o, m)
+# define BOOST_PP_FOR_905(s, p, o, m) BOOST_PP_FOR_905_C(BOOST_PP_BOOL(p(906, s)), s, p, o, m)
+# define BOOST_PP_FOR_906(s, p, o, m) BOOST_PP_FOR_906_C(BOOST_PP_BOOL(p(907, s)), s, p, o, m)
+# define BOOST_PP_FOR_907(s, p, o, m) BOOST_PP_FOR_907_C(BOOST_PP_BOOL(p(908, s)), s, p, o, m)
+# define BOOST_PP_FOR_908(s, p, o, m) BOOST_PP_FOR_908_C(BOOST_PP_BOOL(p(909, s)), s, p, o, m)
+# define BOOST_PP_FOR_909(s, p, o, m) BOOST_PP_FOR_909_C(BOOST_PP_BOOL(p(910, s)), s, p, o, m)
+# define BOOST_PP_FOR_910(s, p, o, m) BOOST_PP_FOR_910_C(BOOST_PP_BOOL(p(911, s)), s, p, o, m)
+# define BOOST_PP_FOR_911(s, p, o, m) BOOST_PP_FOR_911_C(BOOST_PP_BOOL(p(912, s)), s, p, o, m)
+# define BOOST_PP_FOR_912(s, p, o, m) BOOST_PP_FOR_912_C(BOOST_PP_BOOL(p(913, s)), s, p, o, m)
+# define BOOST_PP_FOR_913(s, p, o, m) BOOST_PP_FOR_913_C(BOOST_PP_BOOL(p(914, s)), s, p, o, m)
+# define BOOST_PP_FOR_914(s, p, o, m) BOOST_PP_FOR_914_C(BOOST_PP_BOOL(p(915, s)), s, p, o, m)
+# define BOOST_PP_FOR_915(s, p, o, m) BOOST_PP_FOR_915_C(BOOST_PP_BOOL(p(916, s)), s, p, o, m)
+# define BOOST_PP_FOR_916(s, p, o, m) BOOST_PP_FOR_916_C(BOOST_PP_BOOL(p(917, s)), s, p, o, m)
+# define BOOST_PP_FOR_917(s, p, o, m) BOOST_PP_FOR_917_C(BOOST_PP_BOOL(p(918, s)), s, p, o, m)
+# define BOOST_PP_FOR_918(s, p, o, m) BOOST_PP_FOR_918_C(BOOST_PP_BOOL(p(919, s)), s, p, o, m)
+# define BOOST_PP_FOR_919(s, p, o, m) BOOST_PP_FOR_919_C(BOOST_PP_BOOL(p(920, s)), s, p, o, m)
+# define BOOST_PP_FOR_920(s, p, o, m) BOOST_PP_FOR_920_C(BOOST_PP_BOOL(p(921, s)), s, p, o, m)
+# define BOOST_PP_FOR_921(s, p, o, m) BOOST_PP_FOR_921_C(BOOST_PP_BOOL(p(922, s)), s, p, o, m)
+# define BOOST_PP_FOR_922(s, p, o, m) BOOST_PP_FOR_922_C(BOOST_PP_BOOL(p(923, s)), s, p, o, m)
+# define BOOST_PP_FOR_923(s, p, o, m) BOOST_PP_FOR_923_C(BOOST_PP_BOOL(p(924, s)), s, p, o, m)
+# define BOOST_PP_FOR_924(s, p, o, m) BOOST_PP_FOR_924_C(BOOST_PP_BOOL(p(925, s)), s, p, o, m)
+# define BOOST_PP_FOR_925(s, p, o, m) BOOST_PP_FOR_925_C(BOOST_PP_BOOL(p(926, s)), s, p, o, m)
+# define BOOST_PP_FOR_926(s, p, o, m) BOOST_PP_FOR_926_C(BOOST_PP_BOOL(p(927, s)), s, p, o, m)
+# define BOOST_PP_FOR_927(s, p, o, m) BOOST_PP_FOR_927_C(BOOST_PP_BOOL(p(928, s)), s, p, o, m)
+# define BOOST_PP_FOR_928(s, p, o, m) BOOST_PP_FOR_928_C(BOOST_PP_BOOL(p(929, s)), s, p, o, m)
+# define BOOST_PP_FOR_929(s, p, o, m) BOOST_PP_FOR_929_C(BOOST_PP_BOOL(p(930, s)), s, p, o, m)
+# define BOOST_PP_FOR_930(s, p, o, m) BOOST_PP_FOR_930_C(BOOST_PP_BOOL(p(931, s)), s, p, o, m)
+# define BOOST_PP_FOR_931(s, p, o, m) BOOST_PP_FOR_931_C(BOOST_PP_BOOL(p(932, s)), s, p, o, m)
+# define BOOST_PP_FOR_932(s, p, o, m) BOOST_PP_FOR_932_C(BOOST_PP_BOOL(p(933, s)), s, p, o, m)
+# define BOOST_PP_FOR_933(s, p, o, m) BOOST_PP_FOR_933_C(BOOST_PP_BOOL(p(934, s)), s, p, o, m)
+# define BOOST_PP_FOR_934(s, p, o, m) BOOST_PP_FOR_934_C(BOOST_PP_BOOL(p(935, s)), s, p, o, m)
+# define BOOST_PP_FOR_935(s, p, o, m) BOOST_PP_FOR_935_C(BOOST_PP_BOOL(p(936, s)), s, p, o, m)
+# define BOOST_PP_FOR_936(s, p, o, m) BOOST_PP_FOR_936_C(BOOST_PP_BOOL(p(937, s)), s, p, o, m)
+# define BOOST_PP_FOR_937(s, p, o, m) BOOST_PP_FOR_937_C(BOOST_PP_BOOL(p(938, s)), s, p, o, m)
+# define BOOST_PP_FOR_938(s, p, o, m) BOOST_PP_FOR_938_C(BOOST_PP_BOOL(p(939, s)), s, p, o, m)
+# define BOOST_PP_FOR_939(s, p, o, m) BOOST_PP_FOR_939_C(BOOST_PP_BOOL(p(940, s)), s, p, o, m)
+# define BOOST_PP_FOR_940(s, p, o, m) BOOST_PP_FOR_940_C(BOOST_PP_BOOL(p(941, s)), s, p, o, m)
+# define BOOST_PP_FOR_941(s, p, o, m) BOOST_PP_FOR_941_C(BOOST_PP_BOOL(p(942, s)), s, p, o, m)
+# define BOOST_PP_FOR_942(s, p, o, m) BOOST_PP_FOR_942_C(BOOST_PP_BOOL(p(943, s)), s, p, o, m)
+# define BOOST_PP_FOR_943(s, p, o, m) BOOST_PP_FOR_943_C(BOOST_PP_BOOL(p(944, s)), s, p, o, m)
+# define BOOST_PP_FOR_944(s, p, o, m) BOOST_PP_FOR_944_C(BOOST_PP_BOOL(p(945, s)), s, p, o, m)
+# define BOOST_PP_FOR_945(s, p, o, m) BOOST_PP_FOR_945_C(BOOST_PP_BOOL(p(946, s)), s, p, o, m)
+# define BOOST_PP_FOR_946(s, p, o, m) BOOST_PP_FOR_946_C(BOOST_PP_BOOL(p(947, s)), s, p, o, m)
+# define BOOST_PP_FOR_947(s, p, o, m) BOOST_PP_FOR_947_C(BOOST_PP_BOOL(p(948, s)), s, p, o, m)
+# define BOOST_PP_FOR_948(s, p, o, m) BOOST_PP_FOR_948_C(BOOST_PP_BOOL(p(949, s)), s, p, o, m)
+# define BOOST_PP_FOR_949(s, p, o, m) BOOST_PP_FOR_949_C(BOOST_PP_BOOL(p(950, s)), s, p, o, m)
+# define BOOST_PP_FOR_950(s, p, o, m) BOOST_PP_FOR_950_C(BOOST_PP_BOOL(p(951, s)), s, p, o, m)
+# define BOOST_PP_FOR_951(s, p, o, m) BOOST_PP_FOR_951_C(BOOST_PP_BOOL(p(952, s)), s, p, o, m)
+# define BOOST_PP_FOR_952(s, p, o, m) BOOST_PP_FOR_952_C(BOOST_PP_BOOL(p(953, s)), s, p, o, m)
+# define BOOST_PP_FOR_953(s, p, o, m) BOOST_PP_FOR_953_C(BOOST_PP_BOOL(p(954, s)), s, p, o, m)
+# define BOOST_PP_FOR_954(s, p, o, m) BOOST_PP_FOR_954_C(BOOST_PP_BOOL(p(955, s)), s, p, o, m)
+# define BOOST_PP_FOR_955(s, p, o, m) BOOST_PP_FOR_955_C(BOOST_PP_BOOL(p(956, s)), s, p, o, m)
+# define BOOST_PP_FOR_956(s, p, o, m) BOOST_PP_FOR_956_C(BOOST_PP_BOOL(p(957, s)), s, p, o, m)
+# define BOOST_PP_FOR_957(s, p, o, m) BOOST_PP_FOR_957_C(BOOST_PP_BOOL(p(958, s)), s, p, o, m)
+# define BOOST_PP_FOR_958(s, p, o, m) BOOST_PP_FOR_958_C(BOOST_PP_BOOL(p(959, s)), s, p, o, m)
+# define BOOST_PP_FOR_959(s, p, o, m) BOOST_PP_FOR_959_C(BOOST_PP_BOOL(p(960, s)), s, p, o, m)
+# define BOOST_PP_FOR_960(s, p, o, m) BOOST_PP_FOR_960_C(BOOST_PP_BOOL(p(961, s)), s, p, o, m)
+# define BOOST_PP_FOR_961(s, p, o, m) BOOST_PP_FOR_961_C(BOOST_PP_BOOL(p(962, s)), s, p, o, m)
+# define BOOST_PP_FOR_962(s, p, o, m) BOOST_PP_FOR_962_C(BOOST_PP_BOOL(p(963, s)), s, p, o, m)
+# define BOOST_PP_FOR_963(s, p, o, m) BOOST_PP_FOR_963_C(BOOST_PP_BOOL(p(964, s)), s, p, o, m)
+# define BOOST_PP_FOR_964(s, p, o, m) BOOST_PP_FOR_964_C(BOOST_PP_BOOL(p(965, s)), s, p, o, m)
+# define BOOST_PP_FOR_965(s, p, o, m) BOOST_PP_FOR_965_C(BOOST_PP_BOOL(p(966, s)), s, p, o, m)
+# define BOOST_PP_FOR_966(s, p, o, m) BOOST_PP_FOR_966_C(BOOST_PP_BOOL(p(967, s)), s, p, o, m)
+# define BOOST_PP_FOR_967(s, p, o, m) BOOST_PP_FOR_967_C(BOOST_PP_BOOL(p(968, s)), s, p, o, m)
+# define BOOST_PP_FOR_968(s, p, o, m) BOOST_PP_FOR_968_C(BOOST_PP_BOOL(p(969, s)), s, p, o, m)
+# define BOOST_PP_FOR_969(s, p, o, m) BOOST_PP_FOR_969_C(BOOST_PP_BOOL(p(970, s)), s, p, o, m)
+# define BOOST_PP_FOR_970(s, p, o, m) BOOST_PP_FOR_970_C(BOOST_PP_BOOL(p(971, s)), s, p, o, m)
+# define BOOST_PP_FOR_971(s, p, o, m) BOOST_PP_FOR_971_C(BOOST_PP_BOOL(p(972, s)), s, p, o, m)
+# define BOOST_PP_FOR_972(s, p, o, m) BOOST_PP_FOR_972_C(BOOST_PP_BOOL(p(973, s)), s, p, o, m)
+# define BOOST_PP_FOR_973(s, p, o, m) BOOST_PP_FOR_973_C(BOOST_PP_BOOL(p(974, s)), s, p, o, m)
+# define BOOST_PP_FOR_974(s, p, o, m) BOOST_PP_FOR_974_C(BOOST_PP_BOOL(p(975, s)), s, p, o, m)
+# define BOOST_PP_FOR_975(s, p, o, m) BOOST_PP_FOR_975_C(BOOST_PP_BOOL(p(976, s)), s, p, o, m)
+# define BOOST_PP_FOR_976(s, p, o, m) BOOST_PP_FOR_976_C(BOOST_PP_BOOL(p(977, s)), s, p, o, m)
+# define BOOST_PP_FOR_977(s, p, o, m) BOOST_PP_FOR_977_C(BOOST_PP_BOOL(p(978, s)), s, p, o, m)
+# define BOOST_PP_FOR_978(s, p, o, m) BOOST_PP_FOR_978_C(BOOST_PP_BOOL(p(979, s)), s, p, o, m)
+# define BOOST_PP_FOR_979(s, p, o, m) BOOST_PP_FOR_979_C(BOOST_PP_BOOL(p(980, s)), s, p, o, m)
+# define BOOST_PP_FOR_980(s, p, o, m) BOOST_PP_FOR_980_C(BOOST_PP_BOOL(p(981, s)), s, p, o, m)
+# define BOOST_PP_FOR_981(s, p, o, m) BOOST_PP_FOR_981_C(BOOST_PP_BOOL(p(982, s)), s, p, o, m)
+# define BOOST_PP_FOR_982(s, p, o, m) BOOST_PP_FOR_982_C(BOOST_PP_BOOL(p(983, s)), s, p, o, m)
+# define BOOST_PP_FOR_983(s, p, o, m) BOOST_PP_FOR_983_C(BOOST_PP_BOOL(p(984, s)), s, p, o, m)
+# define BOOST_PP_FOR_984(s, p, o, m) BOOST_PP_FOR_984_C(BOOST_PP_BOOL(p(985, s)), s, p, o, m)
+# define BOOST_PP_FOR_985(s, p, o, m) BOOST_PP_FOR_985_C(BOOST_PP_BOOL(p(986, s)), s, p, o, m)
+# define BOOST_PP_FOR_986(s, p, o, m) BOOST_PP_FOR_986_C(BOOST_PP_BOOL(p(987, s)), s, p, o, m)
+# define BOOST_PP_FOR_987(s, p, o, m) BOOST_PP_FOR_987_C(BOOST_PP_BOOL(p(988, s)), s, p, o, m)
+# define BOOST_PP_FOR_988(s, p, o, m) BOOST_PP_FOR_988_C(BOOST_PP_BOOL(p(989, s)), s, p, o, m)
+# define BOOST_PP_FOR_989(s, p, o, m) BOOST_PP_FOR_989_C(BOOST_PP_BOOL(p(990, s)), s, p, o, m)
+# define BOOST_PP_FOR_990(s, p, o, m) BOOST_PP_FOR_990_C(BOOST_PP_BOOL(p(991, s)), s, p, o, m)
+# define BOOST_PP_FOR_991(s, p, o, m) BOOST_PP_FOR_991_C(BOOST_PP_BOOL(p(992, s)), s, p, o, m)
+# define BOOST_PP_FOR_992(s, p, o, m) BOOST_PP_FOR_992_C(BOOST_PP_BOOL(p(993, s)), s, p, o, m)
+# define BOOST_PP_FOR_993(s, p, o, m) BOOST_PP_FOR_993_C(BOOST_PP_BOOL(p(994, s)), s, p, o, m)
+# define BOOST_PP_FOR_994(s, p, o, m) BOOST_PP_FOR_994_C(BOOST_PP_BOOL(p(995, s)), s, p, o, m)
+# define BOOST_PP_FOR_995(s, p, o, m) BOOST_PP_FOR_995_C(BOOST_PP_BOOL(p(996, s)), s, p, o, m)
+# define BOOST_PP_FOR_996(s, p, o, m) BOOST_PP_FOR_996_C(BOOST_PP_BOOL(p(997, s)), s, p, o, m)
+# define BOOST_PP_FOR_997(s, p, o, m) BOOST_PP_FOR_997_C(BOOST_PP_BOOL(p(998, s)), s, p, o, m)
+# define BOOST_PP_FOR_998(s, p, o, m) BOOST_PP_FOR_998_C(BOOST_PP_BOOL(p(999, s)), s, p, o, m)
+# define BOOST_PP_FOR_999(s, p, o, m) BOOST_PP_FOR_999_C(BOOST_PP_BOOL(p(1000, s)), s, p, o, m)
+# define BOOST_PP_FOR_1000(s, p, o, m) BOOST_PP_FOR_1000_C(BOOST_PP_BOOL(p(1001, s)), s, p, o, m)
+# define BOOST_PP_FOR_1001(s, p, o, m) BOOST_PP_FOR_1001_C(BOOST_PP_BOOL(p(1002, s)), s, p, o, m)
+# define BOOST_PP_FOR_1002(s, p, o, m) BOOST_PP_FOR_1002_C(BOOST_PP_BOOL(p(1003, s)), s, p, o, m)
+# define BOOST_PP_FOR_1003(s, p, o, m) BOOST_PP_FOR_1003_C(BOOST_PP_BOOL(p(1004, s)), s, p, o, m)
+# define BOOST_PP_FOR_1004(s, p, o, m) BOOST_PP_FOR_1004_C(BOOST_PP_BOOL(p(1005, s)), s, p, o, m)
+# define BOOST_PP_FOR_1005(s, p, o, m) BOOST_PP_FOR_1005_C(BOOST_PP_BOOL(p(1006, s)), s, p, o, m)
+# define BOOST_PP_FOR_1006(s, p, o, m) BOOST_PP_FOR_1006_C(BOOST_PP_BOOL(p(1007, s)), s, p, o, m)
+# define BOOST_PP_FOR_1007(s, p, o, m) BOOST_PP_FOR_1007_C(BOOST_PP_BOOL(p(1008, s)), s, p, o, m)
+# define BOOST_PP_FOR_1008(s, p, o, m) BOOST_PP_FOR_1008_C(BOOST_PP_BOOL(p(1009, s)), s, p, o, m)
+# define BOOST_PP_FOR_1009(s, p, o, m) BOOST_PP_FOR_1009_C(BOOST_PP_BOOL(p(1010, s)), s, p, o, m)
+# define BOOST_PP_FOR_1010(s, p, o, m) BOOST_PP_FOR_1010_C(BOOST_PP_BOOL(p(1011, s)), s, p, o, m)
+# define BOOST_PP_FOR_1011(s, p, o, m) BOOST_PP_FOR_1011_C(BOOST_PP_BOOL(p(1012, s)), s, p, o, m)
+# define BOOST_PP_FOR_1012(s, p, o, m) BOOST_PP_FOR_1012_C(BOOST_PP_BOOL(p(1013, s)), s, p, o, m)
+# define BOOST_PP_FOR_1013(s, p, o, m) BOOST_PP_FOR_1013_C(BOOST_PP_BOOL(p(1014, s)), s, p, o, m)
+# define BOOST_PP_FOR_1014(s, p, o, m) BOOST_PP_FOR_1014_C(BOOST_PP_BOOL(p(1015, s)), s, p, o, m)
+# define BOOST_PP_FOR_1015(s, p, o, m) BOOST_PP_FOR_1015_C(BOOST_PP_BOOL(p(1016, s)), s, p, o, m)
+# define BOOST_PP_FOR_1016(s, p, o, m) BOOST_PP_FOR_1016_C(BOOST_PP_BOOL(p(1017, s)), s, p, o, m)
+# define BOOST_PP_FOR_1017(s, p, o, m) BOOST_PP_FOR_1017_C(BOOST_PP_BOOL(p(1018, s)), s, p, o, m)
+# define BOOST_PP_FOR_1018(s, p, o, m) BOOST_PP_FOR_1018_C(BOOST_PP_BOOL(p(1019, s)), s, p, o, m)
+# define BOOST_PP_FOR_1019(s, p, o, m) BOOST_PP_FOR_1019_C(BOOST_PP_BOOL(p(1020, s)), s, p, o, m)
+# define BOOST_PP_FOR_1020(s, p, o, m) BOOST_PP_FOR_1020_C(BOOST_PP_BOOL(p(1021, s)), s, p, o, m)
+# define BOOST_PP_FOR_1021(s, p, o, m) BOOST_PP_FOR_1021_C(BOOST_PP_BOOL(p(1022, s)), s, p, o, m)
+# define BOOST_PP_FOR_1022(s, p, o, m) BOOST_PP_FOR_1022_C(BOOST_PP_BOOL(p(1023, s)), s, p, o, m)
+# define BOOST_PP_FOR_1023(s, p, o, m) BOOST_PP_FOR_1023_C(BOOST_PP_BOOL(p(1024, s)), s, p, o, m)
+# define BOOST_PP_FOR_1024(s, p, o, m) BOOST_PP_FOR_1024_C(BOOST_PP_BOOL(p(1025, s)), s, p, o, m)
+#
+# define BOOST_PP_FOR_513_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(514, s) BOOST_PP_IIF(c, BOOST_PP_FOR_514, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(514, s), p, o, m)
+# define BOOST_PP_FOR_514_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(515, s) BOOST_PP_IIF(c, BOOST_PP_FOR_515, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(515, s), p, o, m)
+# define BOOST_PP_FOR_515_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(516, s) BOOST_PP_IIF(c, BOOST_PP_FOR_516, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(516, s), p, o, m)
+# define BOOST_PP_FOR_516_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(517, s) BOOST_PP_IIF(c, BOOST_PP_FOR_517, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(517, s), p, o, m)
+# define BOOST_PP_FOR_517_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(518, s) BOOST_PP_IIF(c, BOOST_PP_FOR_518, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(518, s), p, o, m)
+# define BOOST_PP_FOR_518_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(519, s) BOOST_PP_IIF(c, BOOST_PP_FOR_519, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(519, s), p, o, m)
+# define BOOST_PP_FOR_519_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(520, s) BOOST_PP_IIF(c, BOOST_PP_FOR_520, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(520, s), p, o, m)
+# define BOOST_PP_FOR_520_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(521, s) BOOST_PP_IIF(c, BOOST_PP_FOR_521, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(521, s), p, o, m)
+# define BOOST_PP_FOR_521_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(522, s) BOOST_PP_IIF(c, BOOST_PP_FOR_522, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(522, s), p, o, m)
+# define BOOST_PP_FOR_522_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(523, s) BOOST_PP_IIF(c, BOOST_PP_FOR_523, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(523, s), p, o, m)
+# define BOOST_PP_FOR_523_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(524, s) BOOST_PP_IIF(c, BOOST_PP_FOR_524, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(524, s), p, o, m)
+# define BOOST_PP_FOR_524_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(525, s) BOOST_PP_IIF(c, BOOST_PP_FOR_525, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(525, s), p, o, m)
+# define BOOST_PP_FOR_525_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(526, s) BOOST_PP_IIF(c, BOOST_PP_FOR_526, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(526, s), p, o, m)
+# define BOOST_PP_FOR_526_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(527, s) BOOST_PP_IIF(c, BOOST_PP_FOR_527, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(527, s), p, o, m)
+# define BOOST_PP_FOR_527_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(528, s) BOOST_PP_IIF(c, BOOST_PP_FOR_528, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(528, s), p, o, m)
+# define BOOST_PP_FOR_528_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(529, s) BOOST_PP_IIF(c, BOOST_PP_FOR_529, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(529, s), p, o, m)
+# define BOOST_PP_FOR_529_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(530, s) BOOST_PP_IIF(c, BOOST_PP_FOR_530, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(530, s), p, o, m)
+# define BOOST_PP_FOR_530_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(531, s) BOOST_PP_IIF(c, BOOST_PP_FOR_531, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(531, s), p, o, m)
+# define BOOST_PP_FOR_531_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(532, s) BOOST_PP_IIF(c, BOOST_PP_FOR_532, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(532, s), p, o, m)
+# define BOOST_PP_FOR_532_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(533, s) BOOST_PP_IIF(c, BOOST_PP_FOR_533, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(533, s), p, o, m)
+# define BOOST_PP_FOR_533_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(534, s) BOOST_PP_IIF(c, BOOST_PP_FOR_534, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(534, s), p, o, m)
+# define BOOST_PP_FOR_534_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(535, s) BOOST_PP_IIF(c, BOOST_PP_FOR_535, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(535, s), p, o, m)
+# define BOOST_PP_FOR_535_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(536, s) BOOST_PP_IIF(c, BOOST_PP_FOR_536, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(536, s), p, o, m)
+# define BOOST_PP_FOR_536_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(537, s) BOOST_PP_IIF(c, BOOST_PP_FOR_537, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(537, s), p, o, m)
+# define BOOST_PP_FOR_537_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(538, s) BOOST_PP_IIF(c, BOOST_PP_FOR_538, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(538, s), p, o, m)
+# define BOOST_PP_FOR_538_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(539, s) BOOST_PP_IIF(c, BOOST_PP_FOR_539, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(539, s), p, o, m)
+# define BOOST_PP_FOR_539_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(540, s) BOOST_PP_IIF(c, BOOST_PP_FOR_540, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(540, s), p, o, m)
+# define BOOST_PP_FOR_540_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(541, s) BOOST_PP_IIF(c, BOOST_PP_FOR_541, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(541, s), p, o, m)
+# define BOOST_PP_FOR_541_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(542, s) BOOST_PP_IIF(c, BOOST_PP_FOR_542, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(542, s), p, o, m)
+# define BOOST_PP_FOR_542_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(543, s) BOOST_PP_IIF(c, BOOST_PP_FOR_543, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(543, s), p, o, m)
+# define BOOST_PP_FOR_543_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(544, s) BOOST_PP_IIF(c, BOOST_PP_FOR_544, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(544, s), p, o, m)
+# define BOOST_PP_FOR_544_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(545, s) BOOST_PP_IIF(c, BOOST_PP_FOR_545, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(545, s), p, o, m)
+# define BOOST_PP_FOR_545_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(546, s) BOOST_PP_IIF(c, BOOST_PP_FOR_546, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(546, s), p, o, m)
+# define BOOST_PP_FOR_546_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(547, s) BOOST_PP_IIF(c, BOOST_PP_FOR_547, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(547, s), p, o, m)
+# define BOOST_PP_FOR_547_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(548, s) BOOST_PP_IIF(c, BOOST_PP_FOR_548, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(548, s), p, o, m)
+# define BOOST_PP_FOR_548_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(549, s) BOOST_PP_IIF(c, BOOST_PP_FOR_549, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(549, s), p, o, m)
+# define BOOST_PP_FOR_549_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(550, s) BOOST_PP_IIF(c, BOOST_PP_FOR_550, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(550, s), p, o, m)
+# define BOOST_PP_FOR_550_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(551, s) BOOST_PP_IIF(c, BOOST_PP_FOR_551, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(551, s), p, o, m)
+# define BOOST_PP_FOR_551_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(552, s) BOOST_PP_IIF(c, BOOST_PP_FOR_552, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(552, s), p, o, m)
+# define BOOST_PP_FOR_552_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(553, s) BOOST_PP_IIF(c, BOOST_PP_FOR_553, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(553, s), p, o, m)
+# define BOOST_PP_FOR_553_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(554, s) BOOST_PP_IIF(c, BOOST_PP_FOR_554, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(554, s), p, o, m)
+# define BOOST_PP_FOR_554_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(555, s) BOOST_PP_IIF(c, BOOST_PP_FOR_555, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(555, s), p, o, m)
+# define BOOST_PP_FOR_555_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(556, s) BOOST_PP_IIF(c, BOOST_PP_FOR_556, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(556, s), p, o, m)
+# define BOOST_PP_FOR_556_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(557, s) BOOST_PP_IIF(c, BOOST_PP_FOR_557, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(557, s), p, o, m)
+# define BOOST_PP_FOR_557_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(558, s) BOOST_PP_IIF(c, BOOST_PP_FOR_558, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(558, s), p, o, m)
+# define BOOST_PP_FOR_558_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(559, s) BOOST_PP_IIF(c, BOOST_PP_FOR_559, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(559, s), p, o, m)
+# define BOOST_PP_FOR_559_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(560, s) BOOST_PP_IIF(c, BOOST_PP_FOR_560, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(560, s), p, o, m)
+# define BOOST_PP_FOR_560_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(561, s) BOOST_PP_IIF(c, BOOST_PP_FOR_561, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(561, s), p, o, m)
+# define BOOST_PP_FOR_561_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(562, s) BOOST_PP_IIF(c, BOOST_PP_FOR_562, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(562, s), p, o, m)
+# define BOOST_PP_FOR_562_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(563, s) BOOST_PP_IIF(c, BOOST_PP_FOR_563, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(563, s), p, o, m)
+# define BOOST_PP_FOR_563_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(564, s) BOOST_PP_IIF(c, BOOST_PP_FOR_564, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(564, s), p, o, m)
+# define BOOST_PP_FOR_564_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(565, s) BOOST_PP_IIF(c, BOOST_PP_FOR_565, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(565, s), p, o, m)
+# define BOOST_PP_FOR_565_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(566, s) BOOST_PP_IIF(c, BOOST_PP_FOR_566, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(566, s), p, o, m)
+# define BOOST_PP_FOR_566_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(567, s) BOOST_PP_IIF(c, BOOST_PP_FOR_567, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(567, s), p, o, m)
+# define BOOST_PP_FOR_567_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(568, s) BOOST_PP_IIF(c, BOOST_PP_FOR_568, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(568, s), p, o, m)
+# define BOOST_PP_FOR_568_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(569, s) BOOST_PP_IIF(c, BOOST_PP_FOR_569, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(569, s), p, o, m)
+# define BOOST_PP_FOR_569_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(570, s) BOOST_PP_IIF(c, BOOST_PP_FOR_570, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(570, s), p, o, m)
+# define BOOST_PP_FOR_570_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(571, s) BOOST_PP_IIF(c, BOOST_PP_FOR_571, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(571, s), p, o, m)
+# define BOOST_PP_FOR_571_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(572, s) BOOST_PP_IIF(c, BOOST_PP_FOR_572, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(572, s), p, o, m)
+# define BOOST_PP_FOR_572_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(573, s) BOOST_PP_IIF(c, BOOST_PP_FOR_573, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(573, s), p, o, m)
+# define BOOST_PP_FOR_573_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(574, s) BOOST_PP_IIF(c, BOOST_PP_FOR_574, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(574, s), p, o, m)
+# define BOOST_PP_FOR_574_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(575, s) BOOST_PP_IIF(c, BOOST_PP_FOR_575, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(575, s), p, o, m)
+# define BOOST_PP_FOR_575_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(576, s) BOOST_PP_IIF(c, BOOST_PP_FOR_576, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(576, s), p, o, m)
+# define BOOST_PP_FOR_576_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(577, s) BOOST_PP_IIF(c, BOOST_PP_FOR_577, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(577, s), p, o, m)
+# define BOOST_PP_FOR_577_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(578, s) BOOST_PP_IIF(c, BOOST_PP_FOR_578, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(578, s), p, o, m)
+# define BOOST_PP_FOR_578_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(579, s) BOOST_PP_IIF(c, BOOST_PP_FOR_579, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(579, s), p, o, m)
+# define BOOST_PP_FOR_579_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(580, s) BOOST_PP_IIF(c, BOOST_PP_FOR_580, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(580, s), p, o, m)
+# define BOOST_PP_FOR_580_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(581, s) BOOST_PP_IIF(c, BOOST_PP_FOR_581, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(581, s), p, o, m)
+# define BOOST_PP_FOR_581_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(582, s) BOOST_PP_IIF(c, BOOST_PP_FOR_582, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(582, s), p, o, m)
+# define BOOST_PP_FOR_582_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(583, s) BOOST_PP_IIF(c, BOOST_PP_FOR_583, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(583, s), p, o, m)
+# define BOOST_PP_FOR_583_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(584, s) BOOST_PP_IIF(c, BOOST_PP_FOR_584, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(584, s), p, o, m)
+# define BOOST_PP_FOR_584_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(585, s) BOOST_PP_IIF(c, BOOST_PP_FOR_585, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(585, s), p, o, m)
+# define BOOST_PP_FOR_585_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(586, s) BOOST_PP_IIF(c, BOOST_PP_FOR_586, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(586, s), p, o, m)
+# define BOOST_PP_FOR_586_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(587, s) BOOST_PP_IIF(c, BOOST_PP_FOR_587, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(587, s), p, o, m)
+# define BOOST_PP_FOR_587_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(588, s) BOOST_PP_IIF(c, BOOST_PP_FOR_588, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(588, s), p, o, m)
+# define BOOST_PP_FOR_588_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(589, s) BOOST_PP_IIF(c, BOOST_PP_FOR_589, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(589, s), p, o, m)
+# define BOOST_PP_FOR_589_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(590, s) BOOST_PP_IIF(c, BOOST_PP_FOR_590, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(590, s), p, o, m)
+# define BOOST_PP_FOR_590_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(591, s) BOOST_PP_IIF(c, BOOST_PP_FOR_591, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(591, s), p, o, m)
+# define BOOST_PP_FOR_591_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(592, s) BOOST_PP_IIF(c, BOOST_PP_FOR_592, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(592, s), p, o, m)
+# define BOOST_PP_FOR_592_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(593, s) BOOST_PP_IIF(c, BOOST_PP_FOR_593, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(593, s), p, o, m)
+# define BOOST_PP_FOR_593_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(594, s) BOOST_PP_IIF(c, BOOST_PP_FOR_594, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(594, s), p, o, m)
+# define BOOST_PP_FOR_594_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(595, s) BOOST_PP_IIF(c, BOOST_PP_FOR_595, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(595, s), p, o, m)
+# define BOOST_PP_FOR_595_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(596, s) BOOST_PP_IIF(c, BOOST_PP_FOR_596, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(596, s), p, o, m)
+# define BOOST_PP_FOR_596_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(597, s) BOOST_PP_IIF(c, BOOST_PP_FOR_597, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(597, s), p, o, m)
+# define BOOST_PP_FOR_597_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(598, s) BOOST_PP_IIF(c, BOOST_PP_FOR_598, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(598, s), p, o, m)
+# define BOOST_PP_FOR_598_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(599, s) BOOST_PP_IIF(c, BOOST_PP_FOR_599, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(599, s), p, o, m)
+# define BOOST_PP_FOR_599_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(600, s) BOOST_PP_IIF(c, BOOST_PP_FOR_600, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(600, s), p, o, m)
+# define BOOST_PP_FOR_600_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(601, s) BOOST_PP_IIF(c, BOOST_PP_FOR_601, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(601, s), p, o, m)
+# define BOOST_PP_FOR_601_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(602, s) BOOST_PP_IIF(c, BOOST_PP_FOR_602, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(602, s), p, o, m)
+# define BOOST_PP_FOR_602_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(603, s) BOOST_PP_IIF(c, BOOST_PP_FOR_603, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(603, s), p, o, m)
+# define BOOST_PP_FOR_603_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(604, s) BOOST_PP_IIF(c, BOOST_PP_FOR_604, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(604, s), p, o, m)
+# define BOOST_PP_FOR_604_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(605, s) BOOST_PP_IIF(c, BOOST_PP_FOR_605, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(605, s), p, o, m)
+# define BOOST_PP_FOR_605_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(606, s) BOOST_PP_IIF(c, BOOST_PP_FOR_606, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(606, s), p, o, m)
+# define BOOST_PP_FOR_606_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(607, s) BOOST_PP_IIF(c, BOOST_PP_FOR_607, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(607, s), p, o, m)
+# define BOOST_PP_FOR_607_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(608, s) BOOST_PP_IIF(c, BOOST_PP_FOR_608, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(608, s), p, o, m)
+# define BOOST_PP_FOR_608_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(609, s) BOOST_PP_IIF(c, BOOST_PP_FOR_609, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(609, s), p, o, m)
+# define BOOST_PP_FOR_609_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(610, s) BOOST_PP_IIF(c, BOOST_PP_FOR_610, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(610, s), p, o, m)
+# define BOOST_PP_FOR_610_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(611, s) BOOST_PP_IIF(c, BOOST_PP_FOR_611, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(611, s), p, o, m)
+# define BOOST_PP_FOR_611_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(612, s) BOOST_PP_IIF(c, BOOST_PP_FOR_612, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(612, s), p, o, m)
+# define BOOST_PP_FOR_612_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(613, s) BOOST_PP_IIF(c, BOOST_PP_FOR_613, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(613, s), p, o, m)
+# define BOOST_PP_FOR_613_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(614, s) BOOST_PP_IIF(c, BOOST_PP_FOR_614, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(614, s), p, o, m)
+# define BOOST_PP_FOR_614_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(615, s) BOOST_PP_IIF(c, BOOST_PP_FOR_615, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(615, s), p, o, m)
+# define BOOST_PP_FOR_615_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(616, s) BOOST_PP_IIF(c, BOOST_PP_FOR_616, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(616, s), p, o, m)
+# define BOOST_PP_FOR_616_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(617, s) BOOST_PP_IIF(c, BOOST_PP_FOR_617, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(617, s), p, o, m)
+# define BOOST_PP_FOR_617_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(618, s) BOOST_PP_IIF(c, BOOST_PP_FOR_618, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(618, s), p, o, m)
+# define BOOST_PP_FOR_618_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(619, s) BOOST_PP_IIF(c, BOOST_PP_FOR_619, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(619, s), p, o, m)
+# define BOOST_PP_FOR_619_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(620, s) BOOST_PP_IIF(c, BOOST_PP_FOR_620, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(620, s), p, o, m)
+# define BOOST_PP_FOR_620_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(621, s) BOOST_PP_IIF(c, BOOST_PP_FOR_621, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(621, s), p, o, m)
+# define BOOST_PP_FOR_621_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(622, s) BOOST_PP_IIF(c, BOOST_PP_FOR_622, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(622, s), p, o, m)
+# define BOOST_PP_FOR_622_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(623, s) BOOST_PP_IIF(c, BOOST_PP_FOR_623, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(623, s), p, o, m)
+# define BOOST_PP_FOR_623_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(624, s) BOOST_PP_IIF(c, BOOST_PP_FOR_624, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(624, s), p, o, m)
+# define BOOST_PP_FOR_624_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(625, s) BOOST_PP_IIF(c, BOOST_PP_FOR_625, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(625, s), p, o, m)
+# define BOOST_PP_FOR_625_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(626, s) BOOST_PP_IIF(c, BOOST_PP_FOR_626, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(626, s), p, o, m)
+# define BOOST_PP_FOR_626_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(627, s) BOOST_PP_IIF(c, BOOST_PP_FOR_627, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(627, s), p, o, m)
+# define BOOST_PP_FOR_627_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(628, s) BOOST_PP_IIF(c, BOOST_PP_FOR_628, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(628, s), p, o, m)
+# define BOOST_PP_FOR_628_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(629, s) BOOST_PP_IIF(c, BOOST_PP_FOR_629, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(629, s), p, o, m)
+# define BOOST_PP_FOR_629_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(630, s) BOOST_PP_IIF(c, BOOST_PP_FOR_630, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(630, s), p, o, m)
+# define BOOST_PP_FOR_630_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(631, s) BOOST_PP_IIF(c, BOOST_PP_FOR_631, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(631, s), p, o, m)
+# define BOOST_PP_FOR_631_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(632, s) BOOST_PP_IIF(c, BOOST_PP_FOR_632, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(632, s), p, o, m)
+# define BOOST_PP_FOR_632_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(633, s) BOOST_PP_IIF(c, BOOST_PP_FOR_633, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(633, s), p, o, m)
+# define BOOST_PP_FOR_633_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(634, s) BOOST_PP_IIF(c, BOOST_PP_FOR_634, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(634, s), p, o, m)
+# define BOOST_PP_FOR_634_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(635, s) BOOST_PP_IIF(c, BOOST_PP_FOR_635, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(635, s), p, o, m)
+# define BOOST_PP_FOR_635_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(636, s) BOOST_PP_IIF(c, BOOST_PP_FOR_636, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(636, s), p, o, m)
+# define BOOST_PP_FOR_636_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(637, s) BOOST_PP_IIF(c, BOOST_PP_FOR_637, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(637, s), p, o, m)
+# define BOOST_PP_FOR_637_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(638, s) BOOST_PP_IIF(c, BOOST_PP_FOR_638, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(638, s), p, o, m)
+# define BOOST_PP_FOR_638_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(639, s) BOOST_PP_IIF(c, BOOST_PP_FOR_639, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(639, s), p, o, m)
+# define BOOST_PP_FOR_639_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(640, s) BOOST_PP_IIF(c, BOOST_PP_FOR_640, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(640, s), p, o, m)
+# define BOOST_PP_FOR_640_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(641, s) BOOST_PP_IIF(c, BOOST_PP_FOR_641, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(641, s), p, o, m)
+# define BOOST_PP_FOR_641_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(642, s) BOOST_PP_IIF(c, BOOST_PP_FOR_642, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(642, s), p, o, m)
+# define BOOST_PP_FOR_642_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(643, s) BOOST_PP_IIF(c, BOOST_PP_FOR_643, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(643, s), p, o, m)
+# define BOOST_PP_FOR_643_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(644, s) BOOST_PP_IIF(c, BOOST_PP_FOR_644, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(644, s), p, o, m)
+# define BOOST_PP_FOR_644_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(645, s) BOOST_PP_IIF(c, BOOST_PP_FOR_645, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(645, s), p, o, m)
+# define BOOST_PP_FOR_645_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(646, s) BOOST_PP_IIF(c, BOOST_PP_FOR_646, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(646, s), p, o, m)
+# define BOOST_PP_FOR_646_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(647, s) BOOST_PP_IIF(c, BOOST_PP_FOR_647, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(647, s), p, o, m)
+# define BOOST_PP_FOR_647_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(648, s) BOOST_PP_IIF(c, BOOST_PP_FOR_648, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(648, s), p, o, m)
+# define BOOST_PP_FOR_648_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(649, s) BOOST_PP_IIF(c, BOOST_PP_FOR_649, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(649, s), p, o, m)
+# define BOOST_PP_FOR_649_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(650, s) BOOST_PP_IIF(c, BOOST_PP_FOR_650, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(650, s), p, o, m)
+# define BOOST_PP_FOR_650_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(651, s) BOOST_PP_IIF(c, BOOST_PP_FOR_651, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(651, s), p, o, m)
+# define BOOST_PP_FOR_651_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(652, s) BOOST_PP_IIF(c, BOOST_PP_FOR_652, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(652, s), p, o, m)
+# define BOOST_PP_FOR_652_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(653, s) BOOST_PP_IIF(c, BOOST_PP_FOR_653, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(653, s), p, o, m)
+# define BOOST_PP_FOR_653_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(654, s) BOOST_PP_IIF(c, BOOST_PP_FOR_654, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(654, s), p, o, m)
+# define BOOST_PP_FOR_654_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(655, s) BOOST_PP_IIF(c, BOOST_PP_FOR_655, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(655, s), p, o, m)
+# define BOOST_PP_FOR_655_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(656, s) BOOST_PP_IIF(c, BOOST_PP_FOR_656, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(656, s), p, o, m)
+# define BOOST_PP_FOR_656_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(657, s) BOOST_PP_IIF(c, BOOST_PP_FOR_657, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(657, s), p, o, m)
+# define BOOST_PP_FOR_657_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(658, s) BOOST_PP_IIF(c, BOOST_PP_FOR_658, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(658, s), p, o, m)
+# define BOOST_PP_FOR_658_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(659, s) BOOST_PP_IIF(c, BOOST_PP_FOR_659, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(659, s), p, o, m)
+# define BOOST_PP_FOR_659_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(660, s) BOOST_PP_IIF(c, BOOST_PP_FOR_660, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(660, s), p, o, m)
+# define BOOST_PP_FOR_660_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(661, s) BOOST_PP_IIF(c, BOOST_PP_FOR_661, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(661, s), p, o, m)
+# define BOOST_PP_FOR_661_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(662, s) BOOST_PP_IIF(c, BOOST_PP_FOR_662, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(662, s), p, o, m)
+# define BOOST_PP_FOR_662_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(663, s) BOOST_PP_IIF(c, BOOST_PP_FOR_663, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(663, s), p, o, m)
+# define BOOST_PP_FOR_663_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(664, s) BOOST_PP_IIF(c, BOOST_PP_FOR_664, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(664, s), p, o, m)
+# define BOOST_PP_FOR_664_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(665, s) BOOST_PP_IIF(c, BOOST_PP_FOR_665, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(665, s), p, o, m)
+# define BOOST_PP_FOR_665_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(666, s) BOOST_PP_IIF(c, BOOST_PP_FOR_666, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(666, s), p, o, m)
+# define BOOST_PP_FOR_666_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(667, s) BOOST_PP_IIF(c, BOOST_PP_FOR_667, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(667, s), p, o, m)
+# define BOOST_PP_FOR_667_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(668, s) BOOST_PP_IIF(c, BOOST_PP_FOR_668, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(668, s), p, o, m)
+# define BOOST_PP_FOR_668_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(669, s) BOOST_PP_IIF(c, BOOST_PP_FOR_669, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(669, s), p, o, m)
+# define BOOST_PP_FOR_669_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(670, s) BOOST_PP_IIF(c, BOOST_PP_FOR_670, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(670, s), p, o, m)
+# define BOOST_PP_FOR_670_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(671, s) BOOST_PP_IIF(c, BOOST_PP_FOR_671, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(671, s), p, o, m)
+# define BOOST_PP_FOR_671_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(672, s) BOOST_PP_IIF(c, BOOST_PP_FOR_672, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(672, s), p, o, m)
+# define BOOST_PP_FOR_672_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(673, s) BOOST_PP_IIF(c, BOOST_PP_FOR_673, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(673, s), p, o, m)
+# define BOOST_PP_FOR_673_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(674, s) BOOST_PP_IIF(c, BOOST_PP_FOR_674, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(674, s), p, o, m)
+# define BOOST_PP_FOR_674_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(675, s) BOOST_PP_IIF(c, BOOST_PP_FOR_675, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(675, s), p, o, m)
+# define BOOST_PP_FOR_675_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(676, s) BOOST_PP_IIF(c, BOOST_PP_FOR_676, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(676, s), p, o, m)
+# define BOOST_PP_FOR_676_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(677, s) BOOST_PP_IIF(c, BOOST_PP_FOR_677, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(677, s), p, o, m)
+# define BOOST_PP_FOR_677_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(678, s) BOOST_PP_IIF(c, BOOST_PP_FOR_678, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(678, s), p, o, m)
+# define BOOST_PP_FOR_678_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(679, s) BOOST_PP_IIF(c, BOOST_PP_FOR_679, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(679, s), p, o, m)
+# define BOOST_PP_FOR_679_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(680, s) BOOST_PP_IIF(c, BOOST_PP_FOR_680, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(680, s), p, o, m)
+# define BOOST_PP_FOR_680_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(681, s) BOOST_PP_IIF(c, BOOST_PP_FOR_681, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(681, s), p, o, m)
+# define BOOST_PP_FOR_681_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(682, s) BOOST_PP_IIF(c, BOOST_PP_FOR_682, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(682, s), p, o, m)
+# define BOOST_PP_FOR_682_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(683, s) BOOST_PP_IIF(c, BOOST_PP_FOR_683, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(683, s), p, o, m)
+# define BOOST_PP_FOR_683_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(684, s) BOOST_PP_IIF(c, BOOST_PP_FOR_684, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(684, s), p, o, m)
+# define BOOST_PP_FOR_684_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(685, s) BOOST_PP_IIF(c, BOOST_PP_FOR_685, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(685, s), p, o, m)
+# define BOOST_PP_FOR_685_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(686, s) BOOST_PP_IIF(c, BOOST_PP_FOR_686, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(686, s), p, o, m)
+# define BOOST_PP_FOR_686_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(687, s) BOOST_PP_IIF(c, BOOST_PP_FOR_687, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(687, s), p, o, m)
+# define BOOST_PP_FOR_687_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(688, s) BOOST_PP_IIF(c, BOOST_PP_FOR_688, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(688, s), p, o, m)
+# define BOOST_PP_FOR_688_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(689, s) BOOST_PP_IIF(c, BOOST_PP_FOR_689, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(689, s), p, o, m)
+# define BOOST_PP_FOR_689_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(690, s) BOOST_PP_IIF(c, BOOST_PP_FOR_690, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(690, s), p, o, m)
+# define BOOST_PP_FOR_690_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(691, s) BOOST_PP_IIF(c, BOOST_PP_FOR_691, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(691, s), p, o, m)
+# define BOOST_PP_FOR_691_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(692, s) BOOST_PP_IIF(c, BOOST_PP_FOR_692, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(692, s), p, o, m)
+# define BOOST_PP_FOR_692_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(693, s) BOOST_PP_IIF(c, BOOST_PP_FOR_693, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(693, s), p, o, m)
+# define BOOST_PP_FOR_693_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(694, s) BOOST_PP_IIF(c, BOOST_PP_FOR_694, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(694, s), p, o, m)
+# define BOOST_PP_FOR_694_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(695, s) BOOST_PP_IIF(c, BOOST_PP_FOR_695, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(695, s), p, o, m)
+# define BOOST_PP_FOR_695_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(696, s) BOOST_PP_IIF(c, BOOST_PP_FOR_696, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(696, s), p, o, m)
+# define BOOST_PP_FOR_696_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(697, s) BOOST_PP_IIF(c, BOOST_PP_FOR_697, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(697, s), p, o, m)
+# define BOOST_PP_FOR_697_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(698, s) BOOST_PP_IIF(c, BOOST_PP_FOR_698, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(698, s), p, o, m)
+# define BOOST_PP_FOR_698_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(699, s) BOOST_PP_IIF(c, BOOST_PP_FOR_699, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(699, s), p, o, m)
+# define BOOST_PP_FOR_699_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(700, s) BOOST_PP_IIF(c, BOOST_PP_FOR_700, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(700, s), p, o, m)
+# define BOOST_PP_FOR_700_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(701, s) BOOST_PP_IIF(c, BOOST_PP_FOR_701, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(701, s), p, o, m)
+# define BOOST_PP_FOR_701_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(702, s) BOOST_PP_IIF(c, BOOST_PP_FOR_702, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(702, s), p, o, m)
+# define BOOST_PP_FOR_702_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(703, s) BOOST_PP_IIF(c, BOOST_PP_FOR_703, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(703, s), p, o, m)
+# define BOOST_PP_FOR_703_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(704, s) BOOST_PP_IIF(c, BOOST_PP_FOR_704, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(704, s), p, o, m)
+# define BOOST_PP_FOR_704_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(705, s) BOOST_PP_IIF(c, BOOST_PP_FOR_705, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(705, s), p, o, m)
+# define BOOST_PP_FOR_705_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(706, s) BOOST_PP_IIF(c, BOOST_PP_FOR_706, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(706, s), p, o, m)
+# define BOOST_PP_FOR_706_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(707, s) BOOST_PP_IIF(c, BOOST_PP_FOR_707, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(707, s), p, o, m)
+# define BOOST_PP_FOR_707_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(708, s) BOOST_PP_IIF(c, BOOST_PP_FOR_708, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(708, s), p, o, m)
+# define BOOST_PP_FOR_708_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(709, s) BOOST_PP_IIF(c, BOOST_PP_FOR_709, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(709, s), p, o, m)
+# define BOOST_PP_FOR_709_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(710, s) BOOST_PP_IIF(c, BOOST_PP_FOR_710, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(710, s), p, o, m)
+# define BOOST_PP_FOR_710_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(711, s) BOOST_PP_IIF(c, BOOST_PP_FOR_711, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(711, s), p, o, m)
+# define BOOST_PP_FOR_711_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(712, s) BOOST_PP_IIF(c, BOOST_PP_FOR_712, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(712, s), p, o, m)
+# define BOOST_PP_FOR_712_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(713, s) BOOST_PP_IIF(c, BOOST_PP_FOR_713, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(713, s), p, o, m)
+# define BOOST_PP_FOR_713_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(714, s) BOOST_PP_IIF(c, BOOST_PP_FOR_714, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(714, s), p, o, m)
+# define BOOST_PP_FOR_714_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(715, s) BOOST_PP_IIF(c, BOOST_PP_FOR_715, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(715, s), p, o, m)
+# define BOOST_PP_FOR_715_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(716, s) BOOST_PP_IIF(c, BOOST_PP_FOR_716, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(716, s), p, o, m)
+# define BOOST_PP_FOR_716_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(717, s) BOOST_PP_IIF(c, BOOST_PP_FOR_717, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(717, s), p, o, m)
+# define BOOST_PP_FOR_717_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(718, s) BOOST_PP_IIF(c, BOOST_PP_FOR_718, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(718, s), p, o, m)
+# define BOOST_PP_FOR_718_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(719, s) BOOST_PP_IIF(c, BOOST_PP_FOR_719, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(719, s), p, o, m)
+# define BOOST_PP_FOR_719_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(720, s) BOOST_PP_IIF(c, BOOST_PP_FOR_720, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(720, s), p, o, m)
+# define BOOST_PP_FOR_720_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(721, s) BOOST_PP_IIF(c, BOOST_PP_FOR_721, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(721, s), p, o, m)
+# define BOOST_PP_FOR_721_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(722, s) BOOST_PP_IIF(c, BOOST_PP_FOR_722, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(722, s), p, o, m)
+# define BOOST_PP_FOR_722_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(723, s) BOOST_PP_IIF(c, BOOST_PP_FOR_723, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(723, s), p, o, m)
+# define BOOST_PP_FOR_723_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(724, s) BOOST_PP_IIF(c, BOOST_PP_FOR_724, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(724, s), p, o, m)
+# define BOOST_PP_FOR_724_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(725, s) BOOST_PP_IIF(c, BOOST_PP_FOR_725, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(725, s), p, o, m)
+# define BOOST_PP_FOR_725_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(726, s) BOOST_PP_IIF(c, BOOST_PP_FOR_726, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(726, s), p, o, m)
+# define BOOST_PP_FOR_726_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(727, s) BOOST_PP_IIF(c, BOOST_PP_FOR_727, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(727, s), p, o, m)
+# define BOOST_PP_FOR_727_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(728, s) BOOST_PP_IIF(c, BOOST_PP_FOR_728, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(728, s), p, o, m)
+# define BOOST_PP_FOR_728_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(729, s) BOOST_PP_IIF(c, BOOST_PP_FOR_729, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(729, s), p, o, m)
+# define BOOST_PP_FOR_729_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(730, s) BOOST_PP_IIF(c, BOOST_PP_FOR_730, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(730, s), p, o, m)
+# define BOOST_PP_FOR_730_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(731, s) BOOST_PP_IIF(c, BOOST_PP_FOR_731, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(731, s), p, o, m)
+# define BOOST_PP_FOR_731_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(732, s) BOOST_PP_IIF(c, BOOST_PP_FOR_732, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(732, s), p, o, m)
+# define BOOST_PP_FOR_732_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(733, s) BOOST_PP_IIF(c, BOOST_PP_FOR_733, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(733, s), p, o, m)
+# define BOOST_PP_FOR_733_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(734, s) BOOST_PP_IIF(c, BOOST_PP_FOR_734, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(734, s), p, o, m)
+# define BOOST_PP_FOR_734_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(735, s) BOOST_PP_IIF(c, BOOST_PP_FOR_735, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(735, s), p, o, m)
+# define BOOST_PP_FOR_735_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(736, s) BOOST_PP_IIF(c, BOOST_PP_FOR_736, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(736, s), p, o, m)
+# define BOOST_PP_FOR_736_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(737, s) BOOST_PP_IIF(c, BOOST_PP_FOR_737, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(737, s), p, o, m)
+# define BOOST_PP_FOR_737_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(738, s) BOOST_PP_IIF(c, BOOST_PP_FOR_738, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(738, s), p, o, m)
+# define BOOST_PP_FOR_738_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(739, s) BOOST_PP_IIF(c, BOOST_PP_FOR_739, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(739, s), p, o, m)
+# define BOOST_PP_FOR_739_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(740, s) BOOST_PP_IIF(c, BOOST_PP_FOR_740, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(740, s), p, o, m)
+# define BOOST_PP_FOR_740_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(741, s) BOOST_PP_IIF(c, BOOST_PP_FOR_741, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(741, s), p, o, m)
+# define BOOST_PP_FOR_741_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(742, s) BOOST_PP_IIF(c, BOOST_PP_FOR_742, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(742, s), p, o, m)
+# define BOOST_PP_FOR_742_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(743, s) BOOST_PP_IIF(c, BOOST_PP_FOR_743, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(743, s), p, o, m)
+# define BOOST_PP_FOR_743_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(744, s) BOOST_PP_IIF(c, BOOST_PP_FOR_744, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(744, s), p, o, m)
+# define BOOST_PP_FOR_744_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(745, s) BOOST_PP_IIF(c, BOOST_PP_FOR_745, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(745, s), p, o, m)
+# define BOOST_PP_FOR_745_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(746, s) BOOST_PP_IIF(c, BOOST_PP_FOR_746, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(746, s), p, o, m)
+# define BOOST_PP_FOR_746_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(747, s) BOOST_PP_IIF(c, BOOST_PP_FOR_747, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(747, s), p, o, m)
+# define BOOST_PP_FOR_747_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(748, s) BOOST_PP_IIF(c, BOOST_PP_FOR_748, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(748, s), p, o, m)
+# define BOOST_PP_FOR_748_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(749, s) BOOST_PP_IIF(c, BOOST_PP_FOR_749, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(749, s), p, o, m)
+# define BOOST_PP_FOR_749_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(750, s) BOOST_PP_IIF(c, BOOST_PP_FOR_750, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(750, s), p, o, m)
+# define BOOST_PP_FOR_750_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(751, s) BOOST_PP_IIF(c, BOOST_PP_FOR_751, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(751, s), p, o, m)
+# define BOOST_PP_FOR_751_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(752, s) BOOST_PP_IIF(c, BOOST_PP_FOR_752, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(752, s), p, o, m)
+# define BOOST_PP_FOR_752_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(753, s) BOOST_PP_IIF(c, BOOST_PP_FOR_753, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(753, s), p, o, m)
+# define BOOST_PP_FOR_753_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(754, s) BOOST_PP_IIF(c, BOOST_PP_FOR_754, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(754, s), p, o, m)
+# define BOOST_PP_FOR_754_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(755, s) BOOST_PP_IIF(c, BOOST_PP_FOR_755, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(755, s), p, o, m)
+# define BOOST_PP_FOR_755_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(756, s) BOOST_PP_IIF(c, BOOST_PP_FOR_756, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(756, s), p, o, m)
+# define BOOST_PP_FOR_756_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(757, s) BOOST_PP_IIF(c, BOOST_PP_FOR_757, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(757, s), p, o, m)
+# define BOOST_PP_FOR_757_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(758, s) BOOST_PP_IIF(c, BOOST_PP_FOR_758, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(758, s), p, o, m)
+# define BOOST_PP_FOR_758_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(759, s) BOOST_PP_IIF(c, BOOST_PP_FOR_759, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(759, s), p, o, m)
+# define BOOST_PP_FOR_759_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(760, s) BOOST_PP_IIF(c, BOOST_PP_FOR_760, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(760, s), p, o, m)
+# define BOOST_PP_FOR_760_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(761, s) BOOST_PP_IIF(c, BOOST_PP_FOR_761, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(761, s), p, o, m)
+# define BOOST_PP_FOR_761_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(762, s) BOOST_PP_IIF(c, BOOST_PP_FOR_762, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(762, s), p, o, m)
+# define BOOST_PP_FOR_762_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(763, s) BOOST_PP_IIF(c, BOOST_PP_FOR_763, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(763, s), p, o, m)
+# define BOOST_PP_FOR_763_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(764, s) BOOST_PP_IIF(c, BOOST_PP_FOR_764, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(764, s), p, o, m)
+# define BOOST_PP_FOR_764_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(765, s) BOOST_PP_IIF(c, BOOST_PP_FOR_765, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(765, s), p, o, m)
+# define BOOST_PP_FOR_765_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(766, s) BOOST_PP_IIF(c, BOOST_PP_FOR_766, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(766, s), p, o, m)
+# define BOOST_PP_FOR_766_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(767, s) BOOST_PP_IIF(c, BOOST_PP_FOR_767, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(767, s), p, o, m)
+# define BOOST_PP_FOR_767_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(768, s) BOOST_PP_IIF(c, BOOST_PP_FOR_768, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(768, s), p, o, m)
+# define BOOST_PP_FOR_768_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(769, s) BOOST_PP_IIF(c, BOOST_PP_FOR_769, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(769, s), p, o, m)
+# define BOOST_PP_FOR_769_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(770, s) BOOST_PP_IIF(c, BOOST_PP_FOR_770, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(770, s), p, o, m)
+# define BOOST_PP_FOR_770_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(771, s) BOOST_PP_IIF(c, BOOST_PP_FOR_771, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(771, s), p, o, m)
+# define BOOST_PP_FOR_771_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(772, s) BOOST_PP_IIF(c, BOOST_PP_FOR_772, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(772, s), p, o, m)
+# define BOOST_PP_FOR_772_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(773, s) BOOST_PP_IIF(c, BOOST_PP_FOR_773, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(773, s), p, o, m)
+# define BOOST_PP_FOR_773_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(774, s) BOOST_PP_IIF(c, BOOST_PP_FOR_774, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(774, s), p, o, m)
+# define BOOST_PP_FOR_774_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(775, s) BOOST_PP_IIF(c, BOOST_PP_FOR_775, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(775, s), p, o, m)
+# define BOOST_PP_FOR_775_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(776, s) BOOST_PP_IIF(c, BOOST_PP_FOR_776, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(776, s), p, o, m)
+# define BOOST_PP_FOR_776_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(777, s) BOOST_PP_IIF(c, BOOST_PP_FOR_777, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(777, s), p, o, m)
+# define BOOST_PP_FOR_777_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(778, s) BOOST_PP_IIF(c, BOOST_PP_FOR_778, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(778, s), p, o, m)
+# define BOOST_PP_FOR_778_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(779, s) BOOST_PP_IIF(c, BOOST_PP_FOR_779, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(779, s), p, o, m)
+# define BOOST_PP_FOR_779_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(780, s) BOOST_PP_IIF(c, BOOST_PP_FOR_780, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(780, s), p, o, m)
+# define BOOST_PP_FOR_780_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(781, s) BOOST_PP_IIF(c, BOOST_PP_FOR_781, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(781, s), p, o, m)
+# define BOOST_PP_FOR_781_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(782, s) BOOST_PP_IIF(c, BOOST_PP_FOR_782, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(782, s), p, o, m)
+# define BOOST_PP_FOR_782_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(783, s) BOOST_PP_IIF(c, BOOST_PP_FOR_783, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(783, s), p, o, m)
+# define BOOST_PP_FOR_783_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(784, s) BOOST_PP_IIF(c, BOOST_PP_FOR_784, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(784, s), p, o, m)
+# define BOOST_PP_FOR_784_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(785, s) BOOST_PP_IIF(c, BOOST_PP_FOR_785, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(785, s), p, o, m)
+# define BOOST_PP_FOR_785_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(786, s) BOOST_PP_IIF(c, BOOST_PP_FOR_786, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(786, s), p, o, m)
+# define BOOST_PP_FOR_786_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(787, s) BOOST_PP_IIF(c, BOOST_PP_FOR_787, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(787, s), p, o, m)
+# define BOOST_PP_FOR_787_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(788, s) BOOST_PP_IIF(c, BOOST_PP_FOR_788, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(788, s), p, o, m)
+# define BOOST_PP_FOR_788_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(789, s) BOOST_PP_IIF(c, BOOST_PP_FOR_789, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(789, s), p, o, m)
+# define BOOST_PP_FOR_789_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(790, s) BOOST_PP_IIF(c, BOOST_PP_FOR_790, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(790, s), p, o, m)
+# define BOOST_PP_FOR_790_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(791, s) BOOST_PP_IIF(c, BOOST_PP_FOR_791, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(791, s), p, o, m)
+# define BOOST_PP_FOR_791_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(792, s) BOOST_PP_IIF(c, BOOST_PP_FOR_792, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(792, s), p, o, m)
+# define BOOST_PP_FOR_792_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(793, s) BOOST_PP_IIF(c, BOOST_PP_FOR_793, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(793, s), p, o, m)
+# define BOOST_PP_FOR_793_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(794, s) BOOST_PP_IIF(c, BOOST_PP_FOR_794, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(794, s), p, o, m)
+# define BOOST_PP_FOR_794_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(795, s) BOOST_PP_IIF(c, BOOST_PP_FOR_795, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(795, s), p, o, m)
+# define BOOST_PP_FOR_795_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(796, s) BOOST_PP_IIF(c, BOOST_PP_FOR_796, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(796, s), p, o, m)
+# define BOOST_PP_FOR_796_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(797, s) BOOST_PP_IIF(c, BOOST_PP_FOR_797, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(797, s), p, o, m)
+# define BOOST_PP_FOR_797_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(798, s) BOOST_PP_IIF(c, BOOST_PP_FOR_798, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(798, s), p, o, m)
+# define BOOST_PP_FOR_798_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(799, s) BOOST_PP_IIF(c, BOOST_PP_FOR_799, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(799, s), p, o, m)
+# define BOOST_PP_FOR_799_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(800, s) BOOST_PP_IIF(c, BOOST_PP_FOR_800, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(800, s), p, o, m)
+# define BOOST_PP_FOR_800_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(801, s) BOOST_PP_IIF(c, BOOST_PP_FOR_801, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(801, s), p, o, m)
+# define BOOST_PP_FOR_801_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(802, s) BOOST_PP_IIF(c, BOOST_PP_FOR_802, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(802, s), p, o, m)
+# define BOOST_PP_FOR_802_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(803, s) BOOST_PP_IIF(c, BOOST_PP_FOR_803, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(803, s), p, o, m)
+# define BOOST_PP_FOR_803_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(804, s) BOOST_PP_IIF(c, BOOST_PP_FOR_804, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(804, s), p, o, m)
+# define BOOST_PP_FOR_804_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(805, s) BOOST_PP_IIF(c, BOOST_PP_FOR_805, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(805, s), p, o, m)
+# define BOOST_PP_FOR_805_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(806, s) BOOST_PP_IIF(c, BOOST_PP_FOR_806, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(806, s), p, o, m)
+# define BOOST_PP_FOR_806_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(807, s) BOOST_PP_IIF(c, BOOST_PP_FOR_807, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(807, s), p, o, m)
+# define BOOST_PP_FOR_807_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(808, s) BOOST_PP_IIF(c, BOOST_PP_FOR_808, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(808, s), p, o, m)
+# define BOOST_PP_FOR_808_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(809, s) BOOST_PP_IIF(c, BOOST_PP_FOR_809, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(809, s), p, o, m)
+# define BOOST_PP_FOR_809_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(810, s) BOOST_PP_IIF(c, BOOST_PP_FOR_810, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(810, s), p, o, m)
+# define BOOST_PP_FOR_810_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(811, s) BOOST_PP_IIF(c, BOOST_PP_FOR_811, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(811, s), p, o, m)
+# define BOOST_PP_FOR_811_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(812, s) BOOST_PP_IIF(c, BOOST_PP_FOR_812, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(812, s), p, o, m)
+# define BOOST_PP_FOR_812_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(813, s) BOOST_PP_IIF(c, BOOST_PP_FOR_813, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(813, s), p, o, m)
+# define BOOST_PP_FOR_813_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(814, s) BOOST_PP_IIF(c, BOOST_PP_FOR_814, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(814, s), p, o, m)
+# define BOOST_PP_FOR_814_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(815, s) BOOST_PP_IIF(c, BOOST_PP_FOR_815, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(815, s), p, o, m)
+# define BOOST_PP_FOR_815_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(816, s) BOOST_PP_IIF(c, BOOST_PP_FOR_816, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(816, s), p, o, m)
+# define BOOST_PP_FOR_816_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(817, s) BOOST_PP_IIF(c, BOOST_PP_FOR_817, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(817, s), p, o, m)
+# define BOOST_PP_FOR_817_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(818, s) BOOST_PP_IIF(c, BOOST_PP_FOR_818, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(818, s), p, o, m)
+# define BOOST_PP_FOR_818_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(819, s) BOOST_PP_IIF(c, BOOST_PP_FOR_819, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(819, s), p, o, m)
+# define BOOST_PP_FOR_819_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(820, s) BOOST_PP_IIF(c, BOOST_PP_FOR_820, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(820, s), p, o, m)
+# define BOOST_PP_FOR_820_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(821, s) BOOST_PP_IIF(c, BOOST_PP_FOR_821, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(821, s), p, o, m)
+# define BOOST_PP_FOR_821_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(822, s) BOOST_PP_IIF(c, BOOST_PP_FOR_822, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(822, s), p, o, m)
+# define BOOST_PP_FOR_822_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(823, s) BOOST_PP_IIF(c, BOOST_PP_FOR_823, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(823, s), p, o, m)
+# define BOOST_PP_FOR_823_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(824, s) BOOST_PP_IIF(c, BOOST_PP_FOR_824, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(824, s), p, o, m)
+# define BOOST_PP_FOR_824_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(825, s) BOOST_PP_IIF(c, BOOST_PP_FOR_825, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(825, s), p, o, m)
+# define BOOST_PP_FOR_825_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(826, s) BOOST_PP_IIF(c, BOOST_PP_FOR_826, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(826, s), p, o, m)
+# define BOOST_PP_FOR_826_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(827, s) BOOST_PP_IIF(c, BOOST_PP_FOR_827, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(827, s), p, o, m)
+# define BOOST_PP_FOR_827_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(828, s) BOOST_PP_IIF(c, BOOST_PP_FOR_828, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(828, s), p, o, m)
+# define BOOST_PP_FOR_828_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(829, s) BOOST_PP_IIF(c, BOOST_PP_FOR_829, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(829, s), p, o, m)
+# define BOOST_PP_FOR_829_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(830, s) BOOST_PP_IIF(c, BOOST_PP_FOR_830, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(830, s), p, o, m)
+# define BOOST_PP_FOR_830_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(831, s) BOOST_PP_IIF(c, BOOST_PP_FOR_831, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(831, s), p, o, m)
+# define BOOST_PP_FOR_831_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(832, s) BOOST_PP_IIF(c, BOOST_PP_FOR_832, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(832, s), p, o, m)
+# define BOOST_PP_FOR_832_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(833, s) BOOST_PP_IIF(c, BOOST_PP_FOR_833, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(833, s), p, o, m)
+# define BOOST_PP_FOR_833_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(834, s) BOOST_PP_IIF(c, BOOST_PP_FOR_834, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(834, s), p, o, m)
+# define BOOST_PP_FOR_834_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(835, s) BOOST_PP_IIF(c, BOOST_PP_FOR_835, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(835, s), p, o, m)
+# define BOOST_PP_FOR_835_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(836, s) BOOST_PP_IIF(c, BOOST_PP_FOR_836, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(836, s), p, o, m)
+# define BOOST_PP_FOR_836_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(837, s) BOOST_PP_IIF(c, BOOST_PP_FOR_837, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(837, s), p, o, m)
+# define BOOST_PP_FOR_837_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(838, s) BOOST_PP_IIF(c, BOOST_PP_FOR_838, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(838, s), p, o, m)
+# define BOOST_PP_FOR_838_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(839, s) BOOST_PP_IIF(c, BOOST_PP_FOR_839, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(839, s), p, o, m)
+# define BOOST_PP_FOR_839_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(840, s) BOOST_PP_IIF(c, BOOST_PP_FOR_840, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(840, s), p, o, m)
+# define BOOST_PP_FOR_840_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(841, s) BOOST_PP_IIF(c, BOOST_PP_FOR_841, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(841, s), p, o, m)
+# define BOOST_PP_FOR_841_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(842, s) BOOST_PP_IIF(c, BOOST_PP_FOR_842, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(842, s), p, o, m)
+# define BOOST_PP_FOR_842_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(843, s) BOOST_PP_IIF(c, BOOST_PP_FOR_843, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(843, s), p, o, m)
+# define BOOST_PP_FOR_843_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(844, s) BOOST_PP_IIF(c, BOOST_PP_FOR_844, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(844, s), p, o, m)
+# define BOOST_PP_FOR_844_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(845, s) BOOST_PP_IIF(c, BOOST_PP_FOR_845, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(845, s), p, o, m)
+# define BOOST_PP_FOR_845_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(846, s) BOOST_PP_IIF(c, BOOST_PP_FOR_846, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(846, s), p, o, m)
+# define BOOST_PP_FOR_846_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(847, s) BOOST_PP_IIF(c, BOOST_PP_FOR_847, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(847, s), p, o, m)
+# define BOOST_PP_FOR_847_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(848, s) BOOST_PP_IIF(c, BOOST_PP_FOR_848, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(848, s), p, o, m)
+# define BOOST_PP_FOR_848_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(849, s) BOOST_PP_IIF(c, BOOST_PP_FOR_849, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(849, s), p, o, m)
+# define BOOST_PP_FOR_849_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(850, s) BOOST_PP_IIF(c, BOOST_PP_FOR_850, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(850, s), p, o, m)
+# define BOOST_PP_FOR_850_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(851, s) BOOST_PP_IIF(c, BOOST_PP_FOR_851, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(851, s), p, o, m)
+# define BOOST_PP_FOR_851_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(852, s) BOOST_PP_IIF(c, BOOST_PP_FOR_852, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(852, s), p, o, m)
+# define BOOST_PP_FOR_852_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(853, s) BOOST_PP_IIF(c, BOOST_PP_FOR_853, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(853, s), p, o, m)
+# define BOOST_PP_FOR_853_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(854, s) BOOST_PP_IIF(c, BOOST_PP_FOR_854, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(854, s), p, o, m)
+# define BOOST_PP_FOR_854_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(855, s) BOOST_PP_IIF(c, BOOST_PP_FOR_855, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(855, s), p, o, m)
+# define BOOST_PP_FOR_855_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(856, s) BOOST_PP_IIF(c, BOOST_PP_FOR_856, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(856, s), p, o, m)
+# define BOOST_PP_FOR_856_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(857, s) BOOST_PP_IIF(c, BOOST_PP_FOR_857, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(857, s), p, o, m)
+# define BOOST_PP_FOR_857_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(858, s) BOOST_PP_IIF(c, BOOST_PP_FOR_858, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(858, s), p, o, m)
+# define BOOST_PP_FOR_858_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(859, s) BOOST_PP_IIF(c, BOOST_PP_FOR_859, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(859, s), p, o, m)
+# define BOOST_PP_FOR_859_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(860, s) BOOST_PP_IIF(c, BOOST_PP_FOR_860, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(860, s), p, o, m)
+# define BOOST_PP_FOR_860_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(861, s) BOOST_PP_IIF(c, BOOST_PP_FOR_861, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(861, s), p, o, m)
+# define BOOST_PP_FOR_861_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(862, s) BOOST_PP_IIF(c, BOOST_PP_FOR_862, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(862, s), p, o, m)
+# define BOOST_PP_FOR_862_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(863, s) BOOST_PP_IIF(c, BOOST_PP_FOR_863, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(863, s), p, o, m)
+# define BOOST_PP_FOR_863_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(864, s) BOOST_PP_IIF(c, BOOST_PP_FOR_864, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(864, s), p, o, m)
+# define BOOST_PP_FOR_864_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(865, s) BOOST_PP_IIF(c, BOOST_PP_FOR_865, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(865, s), p, o, m)
+# define BOOST_PP_FOR_865_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(866, s) BOOST_PP_IIF(c, BOOST_PP_FOR_866, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(866, s), p, o, m)
+# define BOOST_PP_FOR_866_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(867, s) BOOST_PP_IIF(c, BOOST_PP_FOR_867, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(867, s), p, o, m)
+# define BOOST_PP_FOR_867_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(868, s) BOOST_PP_IIF(c, BOOST_PP_FOR_868, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(868, s), p, o, m)
+# define BOOST_PP_FOR_868_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(869, s) BOOST_PP_IIF(c, BOOST_PP_FOR_869, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(869, s), p, o, m)
+# define BOOST_PP_FOR_869_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(870, s) BOOST_PP_IIF(c, BOOST_PP_FOR_870, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(870, s), p, o, m)
+# define BOOST_PP_FOR_870_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(871, s) BOOST_PP_IIF(c, BOOST_PP_FOR_871, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(871, s), p, o, m)
+# define BOOST_PP_FOR_871_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(872, s) BOOST_PP_IIF(c, BOOST_PP_FOR_872, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(872, s), p, o, m)
+# define BOOST_PP_FOR_872_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(873, s) BOOST_PP_IIF(c, BOOST_PP_FOR_873, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(873, s), p, o, m)
+# define BOOST_PP_FOR_873_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(874, s) BOOST_PP_IIF(c, BOOST_PP_FOR_874, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(874, s), p, o, m)
+# define BOOST_PP_FOR_874_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(875, s) BOOST_PP_IIF(c, BOOST_PP_FOR_875, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(875, s), p, o, m)
+# define BOOST_PP_FOR_875_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(876, s) BOOST_PP_IIF(c, BOOST_PP_FOR_876, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(876, s), p, o, m)
+# define BOOST_PP_FOR_876_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(877, s) BOOST_PP_IIF(c, BOOST_PP_FOR_877, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(877, s), p, o, m)
+# define BOOST_PP_FOR_877_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(878, s) BOOST_PP_IIF(c, BOOST_PP_FOR_878, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(878, s), p, o, m)
+# define BOOST_PP_FOR_878_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(879, s) BOOST_PP_IIF(c, BOOST_PP_FOR_879, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(879, s), p, o, m)
+# define BOOST_PP_FOR_879_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(880, s) BOOST_PP_IIF(c, BOOST_PP_FOR_880, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(880, s), p, o, m)
+# define BOOST_PP_FOR_880_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(881, s) BOOST_PP_IIF(c, BOOST_PP_FOR_881, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(881, s), p, o, m)
+# define BOOST_PP_FOR_881_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(882, s) BOOST_PP_IIF(c, BOOST_PP_FOR_882, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(882, s), p, o, m)
+# define BOOST_PP_FOR_882_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(883, s) BOOST_PP_IIF(c, BOOST_PP_FOR_883, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(883, s), p, o, m)
+# define BOOST_PP_FOR_883_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(884, s) BOOST_PP_IIF(c, BOOST_PP_FOR_884, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(884, s), p, o, m)
+# define BOOST_PP_FOR_884_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(885, s) BOOST_PP_IIF(c, BOOST_PP_FOR_885, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(885, s), p, o, m)
+# define BOOST_PP_FOR_885_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(886, s) BOOST_PP_IIF(c, BOOST_PP_FOR_886, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(886, s), p, o, m)
+# define BOOST_PP_FOR_886_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(887, s) BOOST_PP_IIF(c, BOOST_PP_FOR_887, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(887, s), p, o, m)
+# define BOOST_PP_FOR_887_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(888, s) BOOST_PP_IIF(c, BOOST_PP_FOR_888, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(888, s), p, o, m)
+# define BOOST_PP_FOR_888_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(889, s) BOOST_PP_IIF(c, BOOST_PP_FOR_889, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(889, s), p, o, m)
+# define BOOST_PP_FOR_889_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(890, s) BOOST_PP_IIF(c, BOOST_PP_FOR_890, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(890, s), p, o, m)
+# define BOOST_PP_FOR_890_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(891, s) BOOST_PP_IIF(c, BOOST_PP_FOR_891, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(891, s), p, o, m)
+# define BOOST_PP_FOR_891_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(892, s) BOOST_PP_IIF(c, BOOST_PP_FOR_892, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(892, s), p, o, m)
+# define BOOST_PP_FOR_892_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(893, s) BOOST_PP_IIF(c, BOOST_PP_FOR_893, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(893, s), p, o, m)
+# define BOOST_PP_FOR_893_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(894, s) BOOST_PP_IIF(c, BOOST_PP_FOR_894, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(894, s), p, o, m)
+# define BOOST_PP_FOR_894_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(895, s) BOOST_PP_IIF(c, BOOST_PP_FOR_895, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(895, s), p, o, m)
+# define BOOST_PP_FOR_895_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(896, s) BOOST_PP_IIF(c, BOOST_PP_FOR_896, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(896, s), p, o, m)
+# define BOOST_PP_FOR_896_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(897, s) BOOST_PP_IIF(c, BOOST_PP_FOR_897, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(897, s), p, o, m)
+# define BOOST_PP_FOR_897_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(898, s) BOOST_PP_IIF(c, BOOST_PP_FOR_898, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(898, s), p, o, m)
+# define BOOST_PP_FOR_898_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(899, s) BOOST_PP_IIF(c, BOOST_PP_FOR_899, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(899, s), p, o, m)
+# define BOOST_PP_FOR_899_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(900, s) BOOST_PP_IIF(c, BOOST_PP_FOR_900, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(900, s), p, o, m)
+# define BOOST_PP_FOR_900_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(901, s) BOOST_PP_IIF(c, BOOST_PP_FOR_901, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(901, s), p, o, m)
+# define BOOST_PP_FOR_901_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(902, s) BOOST_PP_IIF(c, BOOST_PP_FOR_902, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(902, s), p, o, m)
+# define BOOST_PP_FOR_902_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(903, s) BOOST_PP_IIF(c, BOOST_PP_FOR_903, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(903, s), p, o, m)
+# define BOOST_PP_FOR_903_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(904, s) BOOST_PP_IIF(c, BOOST_PP_FOR_904, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(904, s), p, o, m)
+# define BOOST_PP_FOR_904_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(905, s) BOOST_PP_IIF(c, BOOST_PP_FOR_905, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(905, s), p, o, m)
+# define BOOST_PP_FOR_905_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(906, s) BOOST_PP_IIF(c, BOOST_PP_FOR_906, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(906, s), p, o, m)
+# define BOOST_PP_FOR_906_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(907, s) BOOST_PP_IIF(c, BOOST_PP_FOR_907, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(907, s), p, o, m)
+# define BOOST_PP_FOR_907_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(908, s) BOOST_PP_IIF(c, BOOST_PP_FOR_908, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(908, s), p, o, m)
+# define BOOST_PP_FOR_908_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(909, s) BOOST_PP_IIF(c, BOOST_PP_FOR_909, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(909, s), p, o, m)
+# define BOOST_PP_FOR_909_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(910, s) BOOST_PP_IIF(c, BOOST_PP_FOR_910, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(910, s), p, o, m)
+# define BOOST_PP_FOR_910_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(911, s) BOOST_PP_IIF(c, BOOST_PP_FOR_911, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(911, s), p, o, m)
+# define BOOST_PP_FOR_911_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(912, s) BOOST_PP_IIF(c, BOOST_PP_FOR_912, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(912, s), p, o, m)
+# define BOOST_PP_FOR_912_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(913, s) BOOST_PP_IIF(c, BOOST_PP_FOR_913, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(913, s), p, o, m)
+# define BOOST_PP_FOR_913_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(914, s) BOOST_PP_IIF(c, BOOST_PP_FOR_914, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(914, s), p, o, m)
+# define BOOST_PP_FOR_914_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(915, s) BOOST_PP_IIF(c, BOOST_PP_FOR_915, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(915, s), p, o, m)
+# define BOOST_PP_FOR_915_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(916, s) BOOST_PP_IIF(c, BOOST_PP_FOR_916, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(916, s), p, o, m)
+# define BOOST_PP_FOR_916_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(917, s) BOOST_PP_IIF(c, BOOST_PP_FOR_917, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(917, s), p, o, m)
+# define BOOST_PP_FOR_917_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(918, s) BOOST_PP_IIF(c, BOOST_PP_FOR_918, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(918, s), p, o, m)
+# define BOOST_PP_FOR_918_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(919, s) BOOST_PP_IIF(c, BOOST_PP_FOR_919, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(919, s), p, o, m)
+# define BOOST_PP_FOR_919_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(920, s) BOOST_PP_IIF(c, BOOST_PP_FOR_920, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(920, s), p, o, m)
+# define BOOST_PP_FOR_920_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(921, s) BOOST_PP_IIF(c, BOOST_PP_FOR_921, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(921, s), p, o, m)
+# define BOOST_PP_FOR_921_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(922, s) BOOST_PP_IIF(c, BOOST_PP_FOR_922, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(922, s), p, o, m)
+# define BOOST_PP_FOR_922_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(923, s) BOOST_PP_IIF(c, BOOST_PP_FOR_923, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(923, s), p, o, m)
+# define BOOST_PP_FOR_923_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(924, s) BOOST_PP_IIF(c, BOOST_PP_FOR_924, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(924, s), p, o, m)
+# define BOOST_PP_FOR_924_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(925, s) BOOST_PP_IIF(c, BOOST_PP_FOR_925, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(925, s), p, o, m)
+# define BOOST_PP_FOR_925_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(926, s) BOOST_PP_IIF(c, BOOST_PP_FOR_926, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(926, s), p, o, m)
+# define BOOST_PP_FOR_926_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(927, s) BOOST_PP_IIF(c, BOOST_PP_FOR_927, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(927, s), p, o, m)
+# define BOOST_PP_FOR_927_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(928, s) BOOST_PP_IIF(c, BOOST_PP_FOR_928, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(928, s), p, o, m)
+# define BOOST_PP_FOR_928_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(929, s) BOOST_PP_IIF(c, BOOST_PP_FOR_929, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(929, s), p, o, m)
+# define BOOST_PP_FOR_929_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(930, s) BOOST_PP_IIF(c, BOOST_PP_FOR_930, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(930, s), p, o, m)
+# define BOOST_PP_FOR_930_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(931, s) BOOST_PP_IIF(c, BOOST_PP_FOR_931, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(931, s), p, o, m)
+# define BOOST_PP_FOR_931_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(932, s) BOOST_PP_IIF(c, BOOST_PP_FOR_932, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(932, s), p, o, m)
+# define BOOST_PP_FOR_932_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(933, s) BOOST_PP_IIF(c, BOOST_PP_FOR_933, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(933, s), p, o, m)
+# define BOOST_PP_FOR_933_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(934, s) BOOST_PP_IIF(c, BOOST_PP_FOR_934, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(934, s), p, o, m)
+# define BOOST_PP_FOR_934_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(935, s) BOOST_PP_IIF(c, BOOST_PP_FOR_935, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(935, s), p, o, m)
+# define BOOST_PP_FOR_935_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(936, s) BOOST_PP_IIF(c, BOOST_PP_FOR_936, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(936, s), p, o, m)
+# define BOOST_PP_FOR_936_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(937, s) BOOST_PP_IIF(c, BOOST_PP_FOR_937, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(937, s), p, o, m)
+# define BOOST_PP_FOR_937_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(938, s) BOOST_PP_IIF(c, BOOST_PP_FOR_938, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(938, s), p, o, m)
+# define BOOST_PP_FOR_938_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(939, s) BOOST_PP_IIF(c, BOOST_PP_FOR_939, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(939, s), p, o, m)
+# define BOOST_PP_FOR_939_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(940, s) BOOST_PP_IIF(c, BOOST_PP_FOR_940, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(940, s), p, o, m)
+# define BOOST_PP_FOR_940_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(941, s) BOOST_PP_IIF(c, BOOST_PP_FOR_941, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(941, s), p, o, m)
+# define BOOST_PP_FOR_941_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(942, s) BOOST_PP_IIF(c, BOOST_PP_FOR_942, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(942, s), p, o, m)
+# define BOOST_PP_FOR_942_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(943, s) BOOST_PP_IIF(c, BOOST_PP_FOR_943, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(943, s), p, o, m)
+# define BOOST_PP_FOR_943_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(944, s) BOOST_PP_IIF(c, BOOST_PP_FOR_944, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(944, s), p, o, m)
+# define BOOST_PP_FOR_944_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(945, s) BOOST_PP_IIF(c, BOOST_PP_FOR_945, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(945, s), p, o, m)
+# define BOOST_PP_FOR_945_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(946, s) BOOST_PP_IIF(c, BOOST_PP_FOR_946, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(946, s), p, o, m)
+# define BOOST_PP_FOR_946_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(947, s) BOOST_PP_IIF(c, BOOST_PP_FOR_947, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(947, s), p, o, m)
+# define BOOST_PP_FOR_947_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(948, s) BOOST_PP_IIF(c, BOOST_PP_FOR_948, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(948, s), p, o, m)
+# define BOOST_PP_FOR_948_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(949, s) BOOST_PP_IIF(c, BOOST_PP_FOR_949, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(949, s), p, o, m)
+# define BOOST_PP_FOR_949_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(950, s) BOOST_PP_IIF(c, BOOST_PP_FOR_950, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(950, s), p, o, m)
+# define BOOST_PP_FOR_950_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(951, s) BOOST_PP_IIF(c, BOOST_PP_FOR_951, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(951, s), p, o, m)
+# define BOOST_PP_FOR_951_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(952, s) BOOST_PP_IIF(c, BOOST_PP_FOR_952, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(952, s), p, o, m)
+# define BOOST_PP_FOR_952_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(953, s) BOOST_PP_IIF(c, BOOST_PP_FOR_953, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(953, s), p, o, m)
+# define BOOST_PP_FOR_953_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(954, s) BOOST_PP_IIF(c, BOOST_PP_FOR_954, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(954, s), p, o, m)
+# define BOOST_PP_FOR_954_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(955, s) BOOST_PP_IIF(c, BOOST_PP_FOR_955, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(955, s), p, o, m)
+# define BOOST_PP_FOR_955_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(956, s) BOOST_PP_IIF(c, BOOST_PP_FOR_956, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(956, s), p, o, m)
+# define BOOST_PP_FOR_956_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(957, s) BOOST_PP_IIF(c, BOOST_PP_FOR_957, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(957, s), p, o, m)
+# define BOOST_PP_FOR_957_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(958, s) BOOST_PP_IIF(c, BOOST_PP_FOR_958, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(958, s), p, o, m)
+# define BOOST_PP_FOR_958_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(959, s) BOOST_PP_IIF(c, BOOST_PP_FOR_959, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(959, s), p, o, m)
+# define BOOST_PP_FOR_959_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(960, s) BOOST_PP_IIF(c, BOOST_PP_FOR_960, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(960, s), p, o, m)
+# define BOOST_PP_FOR_960_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(961, s) BOOST_PP_IIF(c, BOOST_PP_FOR_961, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(961, s), p, o, m)
+# define BOOST_PP_FOR_961_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(962, s) BOOST_PP_IIF(c, BOOST_PP_FOR_962, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(962, s), p, o, m)
+# define BOOST_PP_FOR_962_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(963, s) BOOST_PP_IIF(c, BOOST_PP_FOR_963, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(963, s), p, o, m)
+# define BOOST_PP_FOR_963_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(964, s) BOOST_PP_IIF(c, BOOST_PP_FOR_964, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(964, s), p, o, m)
+# define BOOST_PP_FOR_964_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(965, s) BOOST_PP_IIF(c, BOOST_PP_FOR_965, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(965, s), p, o, m)
+# define BOOST_PP_FOR_965_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(966, s) BOOST_PP_IIF(c, BOOST_PP_FOR_966, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(966, s), p, o, m)
+# define BOOST_PP_FOR_966_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(967, s) BOOST_PP_IIF(c, BOOST_PP_FOR_967, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(967, s), p, o, m)
+# define BOOST_PP_FOR_967_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(968, s) BOOST_PP_IIF(c, BOOST_PP_FOR_968, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(968, s), p, o, m)
+# define BOOST_PP_FOR_968_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(969, s) BOOST_PP_IIF(c, BOOST_PP_FOR_969, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(969, s), p, o, m)
+# define BOOST_PP_FOR_969_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(970, s) BOOST_PP_IIF(c, BOOST_PP_FOR_970, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(970, s), p, o, m)
+# define BOOST_PP_FOR_970_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(971, s) BOOST_PP_IIF(c, BOOST_PP_FOR_971, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(971, s), p, o, m)
+# define BOOST_PP_FOR_971_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(972, s) BOOST_PP_IIF(c, BOOST_PP_FOR_972, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(972, s), p, o, m)
+# define BOOST_PP_FOR_972_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(973, s) BOOST_PP_IIF(c, BOOST_PP_FOR_973, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(973, s), p, o, m)
+# define BOOST_PP_FOR_973_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(974, s) BOOST_PP_IIF(c, BOOST_PP_FOR_974, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(974, s), p, o, m)
+# define BOOST_PP_FOR_974_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(975, s) BOOST_PP_IIF(c, BOOST_PP_FOR_975, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(975, s), p, o, m)
+# define BOOST_PP_FOR_975_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(976, s) BOOST_PP_IIF(c, BOOST_PP_FOR_976, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(976, s), p, o, m)
+# define BOOST_PP_FOR_976_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(977, s) BOOST_PP_IIF(c, BOOST_PP_FOR_977, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(977, s), p, o, m)
+# define BOOST_PP_FOR_977_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(978, s) BOOST_PP_IIF(c, BOOST_PP_FOR_978, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(978, s), p, o, m)
+# define BOOST_PP_FOR_978_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(979, s) BOOST_PP_IIF(c, BOOST_PP_FOR_979, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(979, s), p, o, m)
+# define BOOST_PP_FOR_979_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(980, s) BOOST_PP_IIF(c, BOOST_PP_FOR_980, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(980, s), p, o, m)
+# define BOOST_PP_FOR_980_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(981, s) BOOST_PP_IIF(c, BOOST_PP_FOR_981, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(981, s), p, o, m)
+# define BOOST_PP_FOR_981_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(982, s) BOOST_PP_IIF(c, BOOST_PP_FOR_982, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(982, s), p, o, m)
+# define BOOST_PP_FOR_982_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(983, s) BOOST_PP_IIF(c, BOOST_PP_FOR_983, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(983, s), p, o, m)
+# define BOOST_PP_FOR_983_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(984, s) BOOST_PP_IIF(c, BOOST_PP_FOR_984, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(984, s), p, o, m)
+# define BOOST_PP_FOR_984_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(985, s) BOOST_PP_IIF(c, BOOST_PP_FOR_985, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(985, s), p, o, m)
+# define BOOST_PP_FOR_985_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(986, s) BOOST_PP_IIF(c, BOOST_PP_FOR_986, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(986, s), p, o, m)
+# define BOOST_PP_FOR_986_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(987, s) BOOST_PP_IIF(c, BOOST_PP_FOR_987, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(987, s), p, o, m)
+# define BOOST_PP_FOR_987_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(988, s) BOOST_PP_IIF(c, BOOST_PP_FOR_988, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(988, s), p, o, m)
+# define BOOST_PP_FOR_988_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(989, s) BOOST_PP_IIF(c, BOOST_PP_FOR_989, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(989, s), p, o, m)
+# define BOOST_PP_FOR_989_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(990, s) BOOST_PP_IIF(c, BOOST_PP_FOR_990, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(990, s), p, o, m)
+# define BOOST_PP_FOR_990_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(991, s) BOOST_PP_IIF(c, BOOST_PP_FOR_991, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(991, s), p, o, m)
+# define BOOST_PP_FOR_991_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(992, s) BOOST_PP_IIF(c, BOOST_PP_FOR_992, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(992, s), p, o, m)
+# define BOOST_PP_FOR_992_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(993, s) BOOST_PP_IIF(c, BOOST_PP_FOR_993, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(993, s), p, o, m)
+# define BOOST_PP_FOR_993_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(994, s) BOOST_PP_IIF(c, BOOST_PP_FOR_994, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(994, s), p, o, m)
+# define BOOST_PP_FOR_994_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(995, s) BOOST_PP_IIF(c, BOOST_PP_FOR_995, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(995, s), p, o, m)
+# define BOOST_PP_FOR_995_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(996, s) BOOST_PP_IIF(c, BOOST_PP_FOR_996, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(996, s), p, o, m)
+# define BOOST_PP_FOR_996_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(997, s) BOOST_PP_IIF(c, BOOST_PP_FOR_997, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(997, s), p, o, m)
+# define BOOST_PP_FOR_997_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(998, s) BOOST_PP_IIF(c, BOOST_PP_FOR_998, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(998, s), p, o, m)
+# define BOOST_PP_FOR_998_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(999, s) BOOST_PP_IIF(c, BOOST_PP_FOR_999, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(999, s), p, o, m)
+# define BOOST_PP_FOR_999_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1000, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1000, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1000, s), p, o, m)
+# define BOOST_PP_FOR_1000_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1001, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1001, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1001, s), p, o, m)
+# define BOOST_PP_FOR_1001_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1002, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1002, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1002, s), p, o, m)
+# define BOOST_PP_FOR_1002_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1003, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1003, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1003, s), p, o, m)
+# define BOOST_PP_FOR_1003_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1004, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1004, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1004, s), p, o, m)
+# define BOOST_PP_FOR_1004_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1005, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1005, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1005, s), p, o, m)
+# define BOOST_PP_FOR_1005_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1006, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1006, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1006, s), p, o, m)
+# define BOOST_PP_FOR_1006_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1007, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1007, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1007, s), p, o, m)
+# define BOOST_PP_FOR_1007_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1008, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1008, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1008, s), p, o, m)
+# define BOOST_PP_FOR_1008_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1009, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1009, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1009, s), p, o, m)
+# define BOOST_PP_FOR_1009_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1010, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1010, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1010, s), p, o, m)
+# define BOOST_PP_FOR_1010_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1011, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1011, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1011, s), p, o, m)
+# define BOOST_PP_FOR_1011_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1012, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1012, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1012, s), p, o, m)
+# define BOOST_PP_FOR_1012_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1013, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1013, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1013, s), p, o, m)
+# define BOOST_PP_FOR_1013_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1014, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1014, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1014, s), p, o, m)
+# define BOOST_PP_FOR_1014_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1015, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1015, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1015, s), p, o, m)
+# define BOOST_PP_FOR_1015_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1016, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1016, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1016, s), p, o, m)
+# define BOOST_PP_FOR_1016_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1017, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1017, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1017, s), p, o, m)
+# define BOOST_PP_FOR_1017_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1018, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1018, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1018, s), p, o, m)
+# define BOOST_PP_FOR_1018_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1019, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1019, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1019, s), p, o, m)
+# define BOOST_PP_FOR_1019_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1020, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1020, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1020, s), p, o, m)
+# define BOOST_PP_FOR_1020_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1021, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1021, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1021, s), p, o, m)
+# define BOOST_PP_FOR_1021_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1022, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1022, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1022, s), p, o, m)
+# define BOOST_PP_FOR_1022_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1023, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1023, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1023, s), p, o, m)
+# define BOOST_PP_FOR_1023_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1024, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1024, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1024, s), p, o, m)
+# define BOOST_PP_FOR_1024_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(1025, s) BOOST_PP_IIF(c, BOOST_PP_FOR_1025, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(1025, s), p, o, m)
+#
+# endif
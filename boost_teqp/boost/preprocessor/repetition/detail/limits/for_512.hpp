@@ -0,0 +1,532 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002) */
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_REPETITION_DETAIL_FOR_512_HPP
+# define BOOST_PREPROCESSOR_REPETITION_DETAIL_FOR_512_HPP
+#
+# define BOOST_PP_FOR_257(s, p, o, m) BOOST_PP_FOR_257_C(BOOST_PP_BOOL(p(258, s)), s, p, o, m)
+# define BOOST_PP_FOR_258(s, p, o, m) BOOST_PP_FOR_258_C(BOOST_PP_BOOL(p(259, s)), s, p, o, m)
+# define BOOST_PP_FOR_259(s, p, o, m) BOOST_PP_FOR_259_C(BOOST_PP_BOOL(p(260, s)), s, p, o, m)
+# define BOOST_PP_FOR_260(s, p, o, m) BOOST_PP_FOR_260_C(BOOST_PP_BOOL(p(261, s)), s, p, o, m)
+# define BOOST_PP_FOR_261(s, p, o, m) BOOST_PP_FOR_261_C(BOOST_PP_BOOL(p(262, s)), s, p, o, m)
+# define BOOST_PP_FOR_262(s, p, o, m) BOOST_PP_FOR_262_C(BOOST_PP_BOOL(p(263, s)), s, p, o, m)
+# define BOOST_PP_FOR_263(s, p, o, m) BOOST_PP_FOR_263_C(BOOST_PP_BOOL(p(264, s)), s, p, o, m)
+# define BOOST_PP_FOR_264(s, p, o, m) BOOST_PP_FOR_264_C(BOOST_PP_BOOL(p(265, s)), s, p, o, m)
+# define BOOST_PP_FOR_265(s, p, o, m) BOOST_PP_FOR_265_C(BOOST_PP_BOOL(p(266, s)), s, p, o, m)
+# define BOOST_PP_FOR_266(s, p, o, m) BOOST_PP_FOR_266_C(BOOST_PP_BOOL(p(267, s)), s, p, o, m)
+# define BOOST_PP_FOR_267(s, p, o, m) BOOST_PP_FOR_267_C(BOOST_PP_BOOL(p(268, s)), s, p, o, m)
+# define BOOST_PP_FOR_268(s, p, o, m) BOOST_PP_FOR_268_C(BOOST_PP_BOOL(p(269, s)), s, p, o, m)
+# define BOOST_PP_FOR_269(s, p, o, m) BOOST_PP_FOR_269_C(BOOST_PP_BOOL(p(270, s)), s, p, o, m)
+# define BOOST_PP_FOR_270(s, p, o, m) BOOST_PP_FOR_270_C(BOOST_PP_BOOL(p(271, s)), s, p, o, m)
+# define BOOST_PP_FOR_271(s, p, o, m) BOOST_PP_FOR_271_C(BOOST_PP_BOOL(p(272, s)), s, p, o, m)
+# define BOOST_PP_FOR_272(s, p, o, m) BOOST_PP_FOR_272_C(BOOST_PP_BOOL(p(273, s)), s, p, o, m)
+# define BOOST_PP_FOR_273(s, p, o, m) BOOST_PP_FOR_273_C(BOOST_PP_BOOL(p(274, s)), s, p, o, m)
+# define BOOST_PP_FOR_274(s, p, o, m) BOOST_PP_FOR_274_C(BOOST_PP_BOOL(p(275, s)), s, p, o, m)
+# define BOOST_PP_FOR_275(s, p, o, m) BOOST_PP_FOR_275_C(BOOST_PP_BOOL(p(276, s)), s, p, o, m)
+# define BOOST_PP_FOR_276(s, p, o, m) BOOST_PP_FOR_276_C(BOOST_PP_BOOL(p(277, s)), s, p, o, m)
+# define BOOST_PP_FOR_277(s, p, o, m) BOOST_PP_FOR_277_C(BOOST_PP_BOOL(p(278, s)), s, p, o, m)
+# define BOOST_PP_FOR_278(s, p, o, m) BOOST_PP_FOR_278_C(BOOST_PP_BOOL(p(279, s)), s, p, o, m)
+# define BOOST_PP_FOR_279(s, p, o, m) BOOST_PP_FOR_279_C(BOOST_PP_BOOL(p(280, s)), s, p, o, m)
+# define BOOST_PP_FOR_280(s, p, o, m) BOOST_PP_FOR_280_C(BOOST_PP_BOOL(p(281, s)), s, p, o, m)
+# define BOOST_PP_FOR_281(s, p, o, m) BOOST_PP_FOR_281_C(BOOST_PP_BOOL(p(282, s)), s, p, o, m)
+# define BOOST_PP_FOR_282(s, p, o, m) BOOST_PP_FOR_282_C(BOOST_PP_BOOL(p(283, s)), s, p, o, m)
+# define BOOST_PP_FOR_283(s, p, o, m) BOOST_PP_FOR_283_C(BOOST_PP_BOOL(p(284, s)), s, p, o, m)
+# define BOOST_PP_FOR_284(s, p, o, m) BOOST_PP_FOR_284_C(BOOST_PP_BOOL(p(285, s)), s, p, o, m)
+# define BOOST_PP_FOR_285(s, p, o, m) BOOST_PP_FOR_285_C(BOOST_PP_BOOL(p(286, s)), s, p, o, m)
+# define BOOST_PP_FOR_286(s, p, o, m) BOOST_PP_FOR_286_C(BOOST_PP_BOOL(p(287, s)), s, p, o, m)
+# define BOOST_PP_FOR_287(s, p, o, m) BOOST_PP_FOR_287_C(BOOST_PP_BOOL(p(288, s)), s, p, o, m)
+# define BOOST_PP_FOR_288(s, p, o, m) BOOST_PP_FOR_288_C(BOOST_PP_BOOL(p(289, s)), s, p, o, m)
+# define BOOST_PP_FOR_289(s, p, o, m) BOOST_PP_FOR_289_C(BOOST_PP_BOOL(p(290, s)), s, p, o, m)
+# define BOOST_PP_FOR_290(s, p, o, m) BOOST_PP_FOR_290_C(BOOST_PP_BOOL(p(291, s)), s, p, o, m)
+# define BOOST_PP_FOR_291(s, p, o, m) BOOST_PP_FOR_291_C(BOOST_PP_BOOL(p(292, s)), s, p, o, m)
+# define BOOST_PP_FOR_292(s, p, o, m) BOOST_PP_FOR_292_C(BOOST_PP_BOOL(p(293, s)), s, p, o, m)
+# define BOOST_PP_FOR_293(s, p, o, m) BOOST_PP_FOR_293_C(BOOST_PP_BOOL(p(294, s)), s, p, o, m)
+# define BOOST_PP_FOR_294(s, p, o, m) BOOST_PP_FOR_294_C(BOOST_PP_BOOL(p(295, s)), s, p, o, m)
+# define BOOST_PP_FOR_295(s, p, o, m) BOOST_PP_FOR_295_C(BOOST_PP_BOOL(p(296, s)), s, p, o, m)
+# define BOOST_PP_FOR_296(s, p, o, m) BOOST_PP_FOR_296_C(BOOST_PP_BOOL(p(297, s)), s, p, o, m)
+# define BOOST_PP_FOR_297(s, p, o, m) BOOST_PP_FOR_297_C(BOOST_PP_BOOL(p(298, s)), s, p, o, m)
+# define BOOST_PP_FOR_298(s, p, o, m) BOOST_PP_FOR_298_C(BOOST_PP_BOOL(p(299, s)), s, p, o, m)
+# define BOOST_PP_FOR_299(s, p, o, m) BOOST_PP_FOR_299_C(BOOST_PP_BOOL(p(300, s)), s, p, o, m)
+# define BOOST_PP_FOR_300(s, p, o, m) BOOST_PP_FOR_300_C(BOOST_PP_BOOL(p(301, s)), s, p, o, m)
+# define BOOST_PP_FOR_301(s, p, o, m) BOOST_PP_FOR_301_C(BOOST_PP_BOOL(p(302, s)), s, p, o, m)
+# define BOOST_PP_FOR_302(s, p, o, m) BOOST_PP_FOR_302_C(BOOST_PP_BOOL(p(303, s)), s, p, o, m)
+# define BOOST_PP_FOR_303(s, p, o, m) BOOST_PP_FOR_303_C(BOOST_PP_BOOL(p(304, s)), s, p, o, m)
+# define BOOST_PP_FOR_304(s, p, o, m) BOOST_PP_FOR_304_C(BOOST_PP_BOOL(p(305, s)), s, p, o, m)
+# define BOOST_PP_FOR_305(s, p, o, m) BOOST_PP_FOR_305_C(BOOST_PP_BOOL(p(306, s)), s, p, o, m)
+# define BOOST_PP_FOR_306(s, p, o, m) BOOST_PP_FOR_306_C(BOOST_PP_BOOL(p(307, s)), s, p, o, m)
+# define BOOST_PP_FOR_307(s, p, o, m) BOOST_PP_FOR_307_C(BOOST_PP_BOOL(p(308, s)), s, p, o, m)
+# define BOOST_PP_FOR_308(s, p, o, m) BOOST_PP_FOR_308_C(BOOST_PP_BOOL(p(309, s)), s, p, o, m)
+# define BOOST_PP_FOR_309(s, p, o, m) BOOST_PP_FOR_309_C(BOOST_PP_BOOL(p(310, s)), s, p, o, m)
+# define BOOST_PP_FOR_310(s, p, o, m) BOOST_PP_FOR_310_C(BOOST_PP_BOOL(p(311, s)), s, p, o, m)
+# define BOOST_PP_FOR_311(s, p, o, m) BOOST_PP_FOR_311_C(BOOST_PP_BOOL(p(312, s)), s, p, o, m)
+# define BOOST_PP_FOR_312(s, p, o, m) BOOST_PP_FOR_312_C(BOOST_PP_BOOL(p(313, s)), s, p, o, m)
+# define BOOST_PP_FOR_313(s, p, o, m) BOOST_PP_FOR_313_C(BOOST_PP_BOOL(p(314, s)), s, p, o, m)
+# define BOOST_PP_FOR_314(s, p, o, m) BOOST_PP_FOR_314_C(BOOST_PP_BOOL(p(315, s)), s, p, o, m)
+# define BOOST_PP_FOR_315(s, p, o, m) BOOST_PP_FOR_315_C(BOOST_PP_BOOL(p(316, s)), s, p, o, m)
+# define BOOST_PP_FOR_316(s, p, o, m) BOOST_PP_FOR_316_C(BOOST_PP_BOOL(p(317, s)), s, p, o, m)
+# define BOOST_PP_FOR_317(s, p, o, m) BOOST_PP_FOR_317_C(BOOST_PP_BOOL(p(318, s)), s, p, o, m)
+# define BOOST_PP_FOR_318(s, p, o, m) BOOST_PP_FOR_318_C(BOOST_PP_BOOL(p(319, s)), s, p, o, m)
+# define BOOST_PP_FOR_319(s, p, o, m) BOOST_PP_FOR_319_C(BOOST_PP_BOOL(p(320, s)), s, p, o, m)
+# define BOOST_PP_FOR_320(s, p, o, m) BOOST_PP_FOR_320_C(BOOST_PP_BOOL(p(321, s)), s, p, o, m)
+# define BOOST_PP_FOR_321(s, p, o, m) BOOST_PP_FOR_321_C(BOOST_PP_BOOL(p(322, s)), s, p, o, m)
+# define BOOST_PP_FOR_322(s, p, o, m) BOOST_PP_FOR_322_C(BOOST_PP_BOOL(p(323, s)), s, p, o, m)
+# define BOOST_PP_FOR_323(s, p, o, m) BOOST_PP_FOR_323_C(BOOST_PP_BOOL(p(324, s)), s, p, o, m)
+# define BOOST_PP_FOR_324(s, p, o, m) BOOST_PP_FOR_324_C(BOOST_PP_BOOL(p(325, s)), s, p, o, m)
+# define BOOST_PP_FOR_325(s, p, o, m) BOOST_PP_FOR_325_C(BOOST_PP_BOOL(p(326, s)), s, p, o, m)
+# define BOOST_PP_FOR_326(s, p, o, m) BOOST_PP_FOR_326_C(BOOST_PP_BOOL(p(327, s)), s, p, o, m)
+# define BOOST_PP_FOR_327(s, p, o, m) BOOST_PP_FOR_327_C(BOOST_PP_BOOL(p(328, s)), s, p, o, m)
+# define BOOST_PP_FOR_328(s, p, o, m) BOOST_PP_FOR_328_C(BOOST_PP_BOOL(p(329, s)), s, p, o, m)
+# define BOOST_PP_FOR_329(s, p, o, m) BOOST_PP_FOR_329_C(BOOST_PP_BOOL(p(330, s)), s, p, o, m)
+# define BOOST_PP_FOR_330(s, p, o, m) BOOST_PP_FOR_330_C(BOOST_PP_BOOL(p(331, s)), s, p, o, m)
+# define BOOST_PP_FOR_331(s, p, o, m) BOOST_PP_FOR_331_C(BOOST_PP_BOOL(p(332, s)), s, p, o, m)
+# define BOOST_PP_FOR_332(s, p, o, m) BOOST_PP_FOR_332_C(BOOST_PP_BOOL(p(333, s)), s, p, o, m)
+# define BOOST_PP_FOR_333(s, p, o, m) BOOST_PP_FOR_333_C(BOOST_PP_BOOL(p(334, s)), s, p, o, m)
+# define BOOST_PP_FOR_334(s, p, o, m) BOOST_PP_FOR_334_C(BOOST_PP_BOOL(p(335, s)), s, p, o, m)
+# define BOOST_PP_FOR_335(s, p, o, m) BOOST_PP_FOR_335_C(BOOST_PP_BOOL(p(336, s)), s, p, o, m)
+# define BOOST_PP_FOR_336(s, p, o, m) BOOST_PP_FOR_336_C(BOOST_PP_BOOL(p(337, s)), s, p, o, m)
+# define BOOST_PP_FOR_337(s, p, o, m) BOOST_PP_FOR_337_C(BOOST_PP_BOOL(p(338, s)), s, p, o, m)
+# define BOOST_PP_FOR_338(s, p, o, m) BOOST_PP_FOR_338_C(BOOST_PP_BOOL(p(339, s)), s, p, o, m)
+# define BOOST_PP_FOR_339(s, p, o, m) BOOST_PP_FOR_339_C(BOOST_PP_BOOL(p(340, s)), s, p, o, m)
+# define BOOST_PP_FOR_340(s, p, o, m) BOOST_PP_FOR_340_C(BOOST_PP_BOOL(p(341, s)), s, p, o, m)
+# define BOOST_PP_FOR_341(s, p, o, m) BOOST_PP_FOR_341_C(BOOST_PP_BOOL(p(342, s)), s, p, o, m)
+# define BOOST_PP_FOR_342(s, p, o, m) BOOST_PP_FOR_342_C(BOOST_PP_BOOL(p(343, s)), s, p, o, m)
+# define BOOST_PP_FOR_343(s, p, o, m) BOOST_PP_FOR_343_C(BOOST_PP_BOOL(p(344, s)), s, p, o, m)
+# define BOOST_PP_FOR_344(s, p, o, m) BOOST_PP_FOR_344_C(BOOST_PP_BOOL(p(345, s)), s, p, o, m)
+# define BOOST_PP_FOR_345(s, p, o, m) BOOST_PP_FOR_345_C(BOOST_PP_BOOL(p(346, s)), s, p, o, m)
+# define BOOST_PP_FOR_346(s, p, o, m) BOOST_PP_FOR_346_C(BOOST_PP_BOOL(p(347, s)), s, p, o, m)
+# define BOOST_PP_FOR_347(s, p, o, m) BOOST_PP_FOR_347_C(BOOST_PP_BOOL(p(348, s)), s, p, o, m)
+# define BOOST_PP_FOR_348(s, p, o, m) BOOST_PP_FOR_348_C(BOOST_PP_BOOL(p(349, s)), s, p, o, m)
+# define BOOST_PP_FOR_349(s, p, o, m) BOOST_PP_FOR_349_C(BOOST_PP_BOOL(p(350, s)), s, p, o, m)
+# define BOOST_PP_FOR_350(s, p, o, m) BOOST_PP_FOR_350_C(BOOST_PP_BOOL(p(351, s)), s, p, o, m)
+# define BOOST_PP_FOR_351(s, p, o, m) BOOST_PP_FOR_351_C(BOOST_PP_BOOL(p(352, s)), s, p, o, m)
+# define BOOST_PP_FOR_352(s, p, o, m) BOOST_PP_FOR_352_C(BOOST_PP_BOOL(p(353, s)), s, p, o, m)
+# define BOOST_PP_FOR_353(s, p, o, m) BOOST_PP_FOR_353_C(BOOST_PP_BOOL(p(354, s)), s, p, o, m)
+# define BOOST_PP_FOR_354(s, p, o, m) BOOST_PP_FOR_354_C(BOOST_PP_BOOL(p(355, s)), s, p, o, m)
+# define BOOST_PP_FOR_355(s, p, o, m) BOOST_PP_FOR_355_C(BOOST_PP_BOOL(p(356, s)), s, p, o, m)
+# define BOOST_PP_FOR_356(s, p, o, m) BOOST_PP_FOR_356_C(BOOST_PP_BOOL(p(357, s)), s, p, o, m)
+# define BOOST_PP_FOR_357(s, p, o, m) BOOST_PP_FOR_357_C(BOOST_PP_BOOL(p(358, s)), s, p, o, m)
+# define BOOST_PP_FOR_358(s, p, o, m) BOOST_PP_FOR_358_C(BOOST_PP_BOOL(p(359, s)), s, p, o, m)
+# define BOOST_PP_FOR_359(s, p, o, m) BOOST_PP_FOR_359_C(BOOST_PP_BOOL(p(360, s)), s, p, o, m)
+# define BOOST_PP_FOR_360(s, p, o, m) BOOST_PP_FOR_360_C(BOOST_PP_BOOL(p(361, s)), s, p, o, m)
+# define BOOST_PP_FOR_361(s, p, o, m) BOOST_PP_FOR_361_C(BOOST_PP_BOOL(p(362, s)), s, p, o, m)
+# define BOOST_PP_FOR_362(s, p, o, m) BOOST_PP_FOR_362_C(BOOST_PP_BOOL(p(363, s)), s, p, o, m)
+# define BOOST_PP_FOR_363(s, p, o, m) BOOST_PP_FOR_363_C(BOOST_PP_BOOL(p(364, s)), s, p, o, m)
+# define BOOST_PP_FOR_364(s, p, o, m) BOOST_PP_FOR_364_C(BOOST_PP_BOOL(p(365, s)), s, p, o, m)
+# define BOOST_PP_FOR_365(s, p, o, m) BOOST_PP_FOR_365_C(BOOST_PP_BOOL(p(366, s)), s, p, o, m)
+# define BOOST_PP_FOR_366(s, p, o, m) BOOST_PP_FOR_366_C(BOOST_PP_BOOL(p(367, s)), s, p, o, m)
+# define BOOST_PP_FOR_367(s, p, o, m) BOOST_PP_FOR_367_C(BOOST_PP_BOOL(p(368, s)), s, p, o, m)
+# define BOOST_PP_FOR_368(s, p, o, m) BOOST_PP_FOR_368_C(BOOST_PP_BOOL(p(369, s)), s, p, o, m)
+# define BOOST_PP_FOR_369(s, p, o, m) BOOST_PP_FOR_369_C(BOOST_PP_BOOL(p(370, s)), s, p, o, m)
+# define BOOST_PP_FOR_370(s, p, o, m) BOOST_PP_FOR_370_C(BOOST_PP_BOOL(p(371, s)), s, p, o, m)
+# define BOOST_PP_FOR_371(s, p, o, m) BOOST_PP_FOR_371_C(BOOST_PP_BOOL(p(372, s)), s, p, o, m)
+# define BOOST_PP_FOR_372(s, p, o, m) BOOST_PP_FOR_372_C(BOOST_PP_BOOL(p(373, s)), s, p, o, m)
+# define BOOST_PP_FOR_373(s, p, o, m) BOOST_PP_FOR_373_C(BOOST_PP_BOOL(p(374, s)), s, p, o, m)
+# define BOOST_PP_FOR_374(s, p, o, m) BOOST_PP_FOR_374_C(BOOST_PP_BOOL(p(375, s)), s, p, o, m)
+# define BOOST_PP_FOR_375(s, p, o, m) BOOST_PP_FOR_375_C(BOOST_PP_BOOL(p(376, s)), s, p, o, m)
+# define BOOST_PP_FOR_376(s, p, o, m) BOOST_PP_FOR_376_C(BOOST_PP_BOOL(p(377, s)), s, p, o, m)
+# define BOOST_PP_FOR_377(s, p, o, m) BOOST_PP_FOR_377_C(BOOST_PP_BOOL(p(378, s)), s, p, o, m)
+# define BOOST_PP_FOR_378(s, p, o, m) BOOST_PP_FOR_378_C(BOOST_PP_BOOL(p(379, s)), s, p, o, m)
+# define BOOST_PP_FOR_379(s, p, o, m) BOOST_PP_FOR_379_C(BOOST_PP_BOOL(p(380, s)), s, p, o, m)
+# define BOOST_PP_FOR_380(s, p, o, m) BOOST_PP_FOR_380_C(BOOST_PP_BOOL(p(381, s)), s, p, o, m)
+# define BOOST_PP_FOR_381(s, p, o, m) BOOST_PP_FOR_381_C(BOOST_PP_BOOL(p(382, s)), s, p, o, m)
+# define BOOST_PP_FOR_382(s, p, o, m) BOOST_PP_FOR_382_C(BOOST_PP_BOOL(p(383, s)), s, p, o, m)
+# define BOOST_PP_FOR_383(s, p, o, m) BOOST_PP_FOR_383_C(BOOST_PP_BOOL(p(384, s)), s, p, o, m)
+# define BOOST_PP_FOR_384(s, p, o, m) BOOST_PP_FOR_384_C(BOOST_PP_BOOL(p(385, s)), s, p, o, m)
+# define BOOST_PP_FOR_385(s, p, o, m) BOOST_PP_FOR_385_C(BOOST_PP_BOOL(p(386, s)), s, p, o, m)
+# define BOOST_PP_FOR_386(s, p, o, m) BOOST_PP_FOR_386_C(BOOST_PP_BOOL(p(387, s)), s, p, o, m)
+# define BOOST_PP_FOR_387(s, p, o, m) BOOST_PP_FOR_387_C(BOOST_PP_BOOL(p(388, s)), s, p, o, m)
+# define BOOST_PP_FOR_388(s, p, o, m) BOOST_PP_FOR_388_C(BOOST_PP_BOOL(p(389, s)), s, p, o, m)
+# define BOOST_PP_FOR_389(s, p, o, m) BOOST_PP_FOR_389_C(BOOST_PP_BOOL(p(390, s)), s, p, o, m)
+# define BOOST_PP_FOR_390(s, p, o, m) BOOST_PP_FOR_390_C(BOOST_PP_BOOL(p(391, s)), s, p, o, m)
+# define BOOST_PP_FOR_391(s, p, o, m) BOOST_PP_FOR_391_C(BOOST_PP_BOOL(p(392, s)), s, p, o, m)
+# define BOOST_PP_FOR_392(s, p, o, m) BOOST_PP_FOR_392_C(BOOST_PP_BOOL(p(393, s)), s, p, o, m)
+# define BOOST_PP_FOR_393(s, p, o, m) BOOST_PP_FOR_393_C(BOOST_PP_BOOL(p(394, s)), s, p, o, m)
+# define BOOST_PP_FOR_394(s, p, o, m) BOOST_PP_FOR_394_C(BOOST_PP_BOOL(p(395, s)), s, p, o, m)
+# define BOOST_PP_FOR_395(s, p, o, m) BOOST_PP_FOR_395_C(BOOST_PP_BOOL(p(396, s)), s, p, o, m)
+# define BOOST_PP_FOR_396(s, p, o, m) BOOST_PP_FOR_396_C(BOOST_PP_BOOL(p(397, s)), s, p, o, m)
+# define BOOST_PP_FOR_397(s, p, o, m) BOOST_PP_FOR_397_C(BOOST_PP_BOOL(p(398, s)), s, p, o, m)
+# define BOOST_PP_FOR_398(s, p, o, m) BOOST_PP_FOR_398_C(BOOST_PP_BOOL(p(399, s)), s, p, o, m)
+# define BOOST_PP_FOR_399(s, p, o, m) BOOST_PP_FOR_399_C(BOOST_PP_BOOL(p(400, s)), s, p, o, m)
+# define BOOST_PP_FOR_400(s, p, o, m) BOOST_PP_FOR_400_C(BOOST_PP_BOOL(p(401, s)), s, p, o, m)
+# define BOOST_PP_FOR_401(s, p, o, m) BOOST_PP_FOR_401_C(BOOST_PP_BOOL(p(402, s)), s, p, o, m)
+# define BOOST_PP_FOR_402(s, p, o, m) BOOST_PP_FOR_402_C(BOOST_PP_BOOL(p(403, s)), s, p, o, m)
+# define BOOST_PP_FOR_403(s, p, o, m) BOOST_PP_FOR_403_C(BOOST_PP_BOOL(p(404, s)), s, p, o, m)
+# define BOOST_PP_FOR_404(s, p, o, m) BOOST_PP_FOR_404_C(BOOST_PP_BOOL(p(405, s)), s, p, o, m)
+# define BOOST_PP_FOR_405(s, p, o, m) BOOST_PP_FOR_405_C(BOOST_PP_BOOL(p(406, s)), s, p, o, m)
+# define BOOST_PP_FOR_406(s, p, o, m) BOOST_PP_FOR_406_C(BOOST_PP_BOOL(p(407, s)), s, p, o, m)
+# define BOOST_PP_FOR_407(s, p, o, m) BOOST_PP_FOR_407_C(BOOST_PP_BOOL(p(408, s)), s, p, o, m)
+# define BOOST_PP_FOR_408(s, p, o, m) BOOST_PP_FOR_408_C(BOOST_PP_BOOL(p(409, s)), s, p, o, m)
+# define BOOST_PP_FOR_409(s, p, o, m) BOOST_PP_FOR_409_C(BOOST_PP_BOOL(p(410, s)), s, p, o, m)
+# define BOOST_PP_FOR_410(s, p, o, m) BOOST_PP_FOR_410_C(BOOST_PP_BOOL(p(411, s)), s, p, o, m)
+# define BOOST_PP_FOR_411(s, p, o, m) BOOST_PP_FOR_411_C(BOOST_PP_BOOL(p(412, s)), s, p, o, m)
+# define BOOST_PP_FOR_412(s, p, o, m) BOOST_PP_FOR_412_C(BOOST_PP_BOOL(p(413, s)), s, p, o, m)
+# define BOOST_PP_FOR_413(s, p, o, m) BOOST_PP_FOR_413_C(BOOST_PP_BOOL(p(414, s)), s, p, o, m)
+# define BOOST_PP_FOR_414(s, p, o, m) BOOST_PP_FOR_414_C(BOOST_PP_BOOL(p(415, s)), s, p, o, m)
+# define BOOST_PP_FOR_415(s, p, o, m) BOOST_PP_FOR_415_C(BOOST_PP_BOOL(p(416, s)), s, p, o, m)
+# define BOOST_PP_FOR_416(s, p, o, m) BOOST_PP_FOR_416_C(BOOST_PP_BOOL(p(417, s)), s, p, o, m)
+# define BOOST_PP_FOR_417(s, p, o, m) BOOST_PP_FOR_417_C(BOOST_PP_BOOL(p(418, s)), s, p, o, m)
+# define BOOST_PP_FOR_418(s, p, o, m) BOOST_PP_FOR_418_C(BOOST_PP_BOOL(p(419, s)), s, p, o, m)
+# define BOOST_PP_FOR_419(s, p, o, m) BOOST_PP_FOR_419_C(BOOST_PP_BOOL(p(420, s)), s, p, o, m)
+# define BOOST_PP_FOR_420(s, p, o, m) BOOST_PP_FOR_420_C(BOOST_PP_BOOL(p(421, s)), s, p, o, m)
+# define BOOST_PP_FOR_421(s, p, o, m) BOOST_PP_FOR_421_C(BOOST_PP_BOOL(p(422, s)), s, p, o, m)
+# define BOOST_PP_FOR_422(s, p, o, m) BOOST_PP_FOR_422_C(BOOST_PP_BOOL(p(423, s)), s, p, o, m)
+# define BOOST_PP_FOR_423(s, p, o, m) BOOST_PP_FOR_423_C(BOOST_PP_BOOL(p(424, s)), s, p, o, m)
+# define BOOST_PP_FOR_424(s, p, o, m) BOOST_PP_FOR_424_C(BOOST_PP_BOOL(p(425, s)), s, p, o, m)
+# define BOOST_PP_FOR_425(s, p, o, m) BOOST_PP_FOR_425_C(BOOST_PP_BOOL(p(426, s)), s, p, o, m)
+# define BOOST_PP_FOR_426(s, p, o, m) BOOST_PP_FOR_426_C(BOOST_PP_BOOL(p(427, s)), s, p, o, m)
+# define BOOST_PP_FOR_427(s, p, o, m) BOOST_PP_FOR_427_C(BOOST_PP_BOOL(p(428, s)), s, p, o, m)
+# define BOOST_PP_FOR_428(s, p, o, m) BOOST_PP_FOR_428_C(BOOST_PP_BOOL(p(429, s)), s, p, o, m)
+# define BOOST_PP_FOR_429(s, p, o, m) BOOST_PP_FOR_429_C(BOOST_PP_BOOL(p(430, s)), s, p, o, m)
+# define BOOST_PP_FOR_430(s, p, o, m) BOOST_PP_FOR_430_C(BOOST_PP_BOOL(p(431, s)), s, p, o, m)
+# define BOOST_PP_FOR_431(s, p, o, m) BOOST_PP_FOR_431_C(BOOST_PP_BOOL(p(432, s)), s, p, o, m)
+# define BOOST_PP_FOR_432(s, p, o, m) BOOST_PP_FOR_432_C(BOOST_PP_BOOL(p(433, s)), s, p, o, m)
+# define BOOST_PP_FOR_433(s, p, o, m) BOOST_PP_FOR_433_C(BOOST_PP_BOOL(p(434, s)), s, p, o, m)
+# define BOOST_PP_FOR_434(s, p, o, m) BOOST_PP_FOR_434_C(BOOST_PP_BOOL(p(435, s)), s, p, o, m)
+# define BOOST_PP_FOR_435(s, p, o, m) BOOST_PP_FOR_435_C(BOOST_PP_BOOL(p(436, s)), s, p, o, m)
+# define BOOST_PP_FOR_436(s, p, o, m) BOOST_PP_FOR_436_C(BOOST_PP_BOOL(p(437, s)), s, p, o, m)
+# define BOOST_PP_FOR_437(s, p, o, m) BOOST_PP_FOR_437_C(BOOST_PP_BOOL(p(438, s)), s, p, o, m)
+# define BOOST_PP_FOR_438(s, p, o, m) BOOST_PP_FOR_438_C(BOOST_PP_BOOL(p(439, s)), s, p, o, m)
+# define BOOST_PP_FOR_439(s, p, o, m) BOOST_PP_FOR_439_C(BOOST_PP_BOOL(p(440, s)), s, p, o, m)
+# define BOOST_PP_FOR_440(s, p, o, m) BOOST_PP_FOR_440_C(BOOST_PP_BOOL(p(441, s)), s, p, o, m)
+# define BOOST_PP_FOR_441(s, p, o, m) BOOST_PP_FOR_441_C(BOOST_PP_BOOL(p(442, s)), s, p, o, m)
+# define BOOST_PP_FOR_442(s, p, o, m) BOOST_PP_FOR_442_C(BOOST_PP_BOOL(p(443, s)), s, p, o, m)
+# define BOOST_PP_FOR_443(s, p, o, m) BOOST_PP_FOR_443_C(BOOST_PP_BOOL(p(444, s)), s, p, o, m)
+# define BOOST_PP_FOR_444(s, p, o, m) BOOST_PP_FOR_444_C(BOOST_PP_BOOL(p(445, s)), s, p, o, m)
+# define BOOST_PP_FOR_445(s, p, o, m) BOOST_PP_FOR_445_C(BOOST_PP_BOOL(p(446, s)), s, p, o, m)
+# define BOOST_PP_FOR_446(s, p, o, m) BOOST_PP_FOR_446_C(BOOST_PP_BOOL(p(447, s)), s, p, o, m)
+# define BOOST_PP_FOR_447(s, p, o, m) BOOST_PP_FOR_447_C(BOOST_PP_BOOL(p(448, s)), s, p, o, m)
+# define BOOST_PP_FOR_448(s, p, o, m) BOOST_PP_FOR_448_C(BOOST_PP_BOOL(p(449, s)), s, p, o, m)
+# define BOOST_PP_FOR_449(s, p, o, m) BOOST_PP_FOR_449_C(BOOST_PP_BOOL(p(450, s)), s, p, o, m)
+# define BOOST_PP_FOR_450(s, p, o, m) BOOST_PP_FOR_450_C(BOOST_PP_BOOL(p(451, s)), s, p, o, m)
+# define BOOST_PP_FOR_451(s, p, o, m) BOOST_PP_FOR_451_C(BOOST_PP_BOOL(p(452, s)), s, p, o, m)
+# define BOOST_PP_FOR_452(s, p, o, m) BOOST_PP_FOR_452_C(BOOST_PP_BOOL(p(453, s)), s, p, o, m)
+# define BOOST_PP_FOR_453(s, p, o, m) BOOST_PP_FOR_453_C(BOOST_PP_BOOL(p(454, s)), s, p, o, m)
+# define BOOST_PP_FOR_454(s, p, o, m) BOOST_PP_FOR_454_C(BOOST_PP_BOOL(p(455, s)), s, p, o, m)
+# define BOOST_PP_FOR_455(s, p, o, m) BOOST_PP_FOR_455_C(BOOST_PP_BOOL(p(456, s)), s, p, o, m)
+# define BOOST_PP_FOR_456(s, p, o, m) BOOST_PP_FOR_456_C(BOOST_PP_BOOL(p(457, s)), s, p, o, m)
+# define BOOST_PP_FOR_457(s, p, o, m) BOOST_PP_FOR_457_C(BOOST_PP_BOOL(p(458, s)), s, p, o, m)
+# define BOOST_PP_FOR_458(s, p, o, m) BOOST_PP_FOR_458_C(BOOST_PP_BOOL(p(459, s)), s, p, o, m)
+# define BOOST_PP_FOR_459(s, p, o, m) BOOST_PP_FOR_459_C(BOOST_PP_BOOL(p(460, s)), s, p, o, m)
+# define BOOST_PP_FOR_460(s, p, o, m) BOOST_PP_FOR_460_C(BOOST_PP_BOOL(p(461, s)), s, p, o, m)
+# define BOOST_PP_FOR_461(s, p, o, m) BOOST_PP_FOR_461_C(BOOST_PP_BOOL(p(462, s)), s, p, o, m)
+# define BOOST_PP_FOR_462(s, p, o, m) BOOST_PP_FOR_462_C(BOOST_PP_BOOL(p(463, s)), s, p, o, m)
+# define BOOST_PP_FOR_463(s, p, o, m) BOOST_PP_FOR_463_C(BOOST_PP_BOOL(p(464, s)), s, p, o, m)
+# define BOOST_PP_FOR_464(s, p, o, m) BOOST_PP_FOR_464_C(BOOST_PP_BOOL(p(465, s)), s, p, o, m)
+# define BOOST_PP_FOR_465(s, p, o, m) BOOST_PP_FOR_465_C(BOOST_PP_BOOL(p(466, s)), s, p, o, m)
+# define BOOST_PP_FOR_466(s, p, o, m) BOOST_PP_FOR_466_C(BOOST_PP_BOOL(p(467, s)), s, p, o, m)
+# define BOOST_PP_FOR_467(s, p, o, m) BOOST_PP_FOR_467_C(BOOST_PP_BOOL(p(468, s)), s, p, o, m)
+# define BOOST_PP_FOR_468(s, p, o, m) BOOST_PP_FOR_468_C(BOOST_PP_BOOL(p(469, s)), s, p, o, m)
+# define BOOST_PP_FOR_469(s, p, o, m) BOOST_PP_FOR_469_C(BOOST_PP_BOOL(p(470, s)), s, p, o, m)
+# define BOOST_PP_FOR_470(s, p, o, m) BOOST_PP_FOR_470_C(BOOST_PP_BOOL(p(471, s)), s, p, o, m)
+# define BOOST_PP_FOR_471(s, p, o, m) BOOST_PP_FOR_471_C(BOOST_PP_BOOL(p(472, s)), s, p, o, m)
+# define BOOST_PP_FOR_472(s, p, o, m) BOOST_PP_FOR_472_C(BOOST_PP_BOOL(p(473, s)), s, p, o, m)
+# define BOOST_PP_FOR_473(s, p, o, m) BOOST_PP_FOR_473_C(BOOST_PP_BOOL(p(474, s)), s, p, o, m)
+# define BOOST_PP_FOR_474(s, p, o, m) BOOST_PP_FOR_474_C(BOOST_PP_BOOL(p(475, s)), s, p, o, m)
+# define BOOST_PP_FOR_475(s, p, o, m) BOOST_PP_FOR_475_C(BOOST_PP_BOOL(p(476, s)), s, p, o, m)
+# define BOOST_PP_FOR_476(s, p, o, m) BOOST_PP_FOR_476_C(BOOST_PP_BOOL(p(477, s)), s, p, o, m)
+# define BOOST_PP_FOR_477(s, p, o, m) BOOST_PP_FOR_477_C(BOOST_PP_BOOL(p(478, s)), s, p, o, m)
+# define BOOST_PP_FOR_478(s, p, o, m) BOOST_PP_FOR_478_C(BOOST_PP_BOOL(p(479, s)), s, p, o, m)
+# define BOOST_PP_FOR_479(s, p, o, m) BOOST_PP_FOR_479_C(BOOST_PP_BOOL(p(480, s)), s, p, o, m)
+# define BOOST_PP_FOR_480(s, p, o, m) BOOST_PP_FOR_480_C(BOOST_PP_BOOL(p(481, s)), s, p, o, m)
+# define BOOST_PP_FOR_481(s, p, o, m) BOOST_PP_FOR_481_C(BOOST_PP_BOOL(p(482, s)), s, p, o, m)
+# define BOOST_PP_FOR_482(s, p, o, m) BOOST_PP_FOR_482_C(BOOST_PP_BOOL(p(483, s)), s, p, o, m)
+# define BOOST_PP_FOR_483(s, p, o, m) BOOST_PP_FOR_483_C(BOOST_PP_BOOL(p(484, s)), s, p, o, m)
+# define BOOST_PP_FOR_484(s, p, o, m) BOOST_PP_FOR_484_C(BOOST_PP_BOOL(p(485, s)), s, p, o, m)
+# define BOOST_PP_FOR_485(s, p, o, m) BOOST_PP_FOR_485_C(BOOST_PP_BOOL(p(486, s)), s, p, o, m)
+# define BOOST_PP_FOR_486(s, p, o, m) BOOST_PP_FOR_486_C(BOOST_PP_BOOL(p(487, s)), s, p, o, m)
+# define BOOST_PP_FOR_487(s, p, o, m) BOOST_PP_FOR_487_C(BOOST_PP_BOOL(p(488, s)), s, p, o, m)
+# define BOOST_PP_FOR_488(s, p, o, m) BOOST_PP_FOR_488_C(BOOST_PP_BOOL(p(489, s)), s, p, o, m)
+# define BOOST_PP_FOR_489(s, p, o, m) BOOST_PP_FOR_489_C(BOOST_PP_BOOL(p(490, s)), s, p, o, m)
+# define BOOST_PP_FOR_490(s, p, o, m) BOOST_PP_FOR_490_C(BOOST_PP_BOOL(p(491, s)), s, p, o, m)
+# define BOOST_PP_FOR_491(s, p, o, m) BOOST_PP_FOR_491_C(BOOST_PP_BOOL(p(492, s)), s, p, o, m)
+# define BOOST_PP_FOR_492(s, p, o, m) BOOST_PP_FOR_492_C(BOOST_PP_BOOL(p(493, s)), s, p, o, m)
+# define BOOST_PP_FOR_493(s, p, o, m) BOOST_PP_FOR_493_C(BOOST_PP_BOOL(p(494, s)), s, p, o, m)
+# define BOOST_PP_FOR_494(s, p, o, m) BOOST_PP_FOR_494_C(BOOST_PP_BOOL(p(495, s)), s, p, o, m)
+# define BOOST_PP_FOR_495(s, p, o, m) BOOST_PP_FOR_495_C(BOOST_PP_BOOL(p(496, s)), s, p, o, m)
+# define BOOST_PP_FOR_496(s, p, o, m) BOOST_PP_FOR_496_C(BOOST_PP_BOOL(p(497, s)), s, p, o, m)
+# define BOOST_PP_FOR_497(s, p, o, m) BOOST_PP_FOR_497_C(BOOST_PP_BOOL(p(498, s)), s, p, o, m)
+# define BOOST_PP_FOR_498(s, p, o, m) BOOST_PP_FOR_498_C(BOOST_PP_BOOL(p(499, s)), s, p, o, m)
+# define BOOST_PP_FOR_499(s, p, o, m) BOOST_PP_FOR_499_C(BOOST_PP_BOOL(p(500, s)), s, p, o, m)
+# define BOOST_PP_FOR_500(s, p, o, m) BOOST_PP_FOR_500_C(BOOST_PP_BOOL(p(501, s)), s, p, o, m)
+# define BOOST_PP_FOR_501(s, p, o, m) BOOST_PP_FOR_501_C(BOOST_PP_BOOL(p(502, s)), s, p, o, m)
+# define BOOST_PP_FOR_502(s, p, o, m) BOOST_PP_FOR_502_C(BOOST_PP_BOOL(p(503, s)), s, p, o, m)
+# define BOOST_PP_FOR_503(s, p, o, m) BOOST_PP_FOR_503_C(BOOST_PP_BOOL(p(504, s)), s, p, o, m)
+# define BOOST_PP_FOR_504(s, p, o, m) BOOST_PP_FOR_504_C(BOOST_PP_BOOL(p(505, s)), s, p, o, m)
+# define BOOST_PP_FOR_505(s, p, o, m) BOOST_PP_FOR_505_C(BOOST_PP_BOOL(p(506, s)), s, p, o, m)
+# define BOOST_PP_FOR_506(s, p, o, m) BOOST_PP_FOR_506_C(BOOST_PP_BOOL(p(507, s)), s, p, o, m)
+# define BOOST_PP_FOR_507(s, p, o, m) BOOST_PP_FOR_507_C(BOOST_PP_BOOL(p(508, s)), s, p, o, m)
+# define BOOST_PP_FOR_508(s, p, o, m) BOOST_PP_FOR_508_C(BOOST_PP_BOOL(p(509, s)), s, p, o, m)
+# define BOOST_PP_FOR_509(s, p, o, m) BOOST_PP_FOR_509_C(BOOST_PP_BOOL(p(510, s)), s, p, o, m)
+# define BOOST_PP_FOR_510(s, p, o, m) BOOST_PP_FOR_510_C(BOOST_PP_BOOL(p(511, s)), s, p, o, m)
+# define BOOST_PP_FOR_511(s, p, o, m) BOOST_PP_FOR_511_C(BOOST_PP_BOOL(p(512, s)), s, p, o, m)
+# define BOOST_PP_FOR_512(s, p, o, m) BOOST_PP_FOR_512_C(BOOST_PP_BOOL(p(513, s)), s, p, o, m)
+#
+# define BOOST_PP_FOR_257_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(258, s) BOOST_PP_IIF(c, BOOST_PP_FOR_258, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(258, s), p, o, m)
+# define BOOST_PP_FOR_258_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(259, s) BOOST_PP_IIF(c, BOOST_PP_FOR_259, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(259, s), p, o, m)
+# define BOOST_PP_FOR_259_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(260, s) BOOST_PP_IIF(c, BOOST_PP_FOR_260, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(260, s), p, o, m)
+# define BOOST_PP_FOR_260_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(261, s) BOOST_PP_IIF(c, BOOST_PP_FOR_261, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(261, s), p, o, m)
+# define BOOST_PP_FOR_261_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(262, s) BOOST_PP_IIF(c, BOOST_PP_FOR_262, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(262, s), p, o, m)
+# define BOOST_PP_FOR_262_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(263, s) BOOST_PP_IIF(c, BOOST_PP_FOR_263, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(263, s), p, o, m)
+# define BOOST_PP_FOR_263_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(264, s) BOOST_PP_IIF(c, BOOST_PP_FOR_264, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(264, s), p, o, m)
+# define BOOST_PP_FOR_264_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(265, s) BOOST_PP_IIF(c, BOOST_PP_FOR_265, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(265, s), p, o, m)
+# define BOOST_PP_FOR_265_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(266, s) BOOST_PP_IIF(c, BOOST_PP_FOR_266, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(266, s), p, o, m)
+# define BOOST_PP_FOR_266_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(267, s) BOOST_PP_IIF(c, BOOST_PP_FOR_267, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(267, s), p, o, m)
+# define BOOST_PP_FOR_267_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(268, s) BOOST_PP_IIF(c, BOOST_PP_FOR_268, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(268, s), p, o, m)
+# define BOOST_PP_FOR_268_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(269, s) BOOST_PP_IIF(c, BOOST_PP_FOR_269, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(269, s), p, o, m)
+# define BOOST_PP_FOR_269_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(270, s) BOOST_PP_IIF(c, BOOST_PP_FOR_270, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(270, s), p, o, m)
+# define BOOST_PP_FOR_270_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(271, s) BOOST_PP_IIF(c, BOOST_PP_FOR_271, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(271, s), p, o, m)
+# define BOOST_PP_FOR_271_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(272, s) BOOST_PP_IIF(c, BOOST_PP_FOR_272, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(272, s), p, o, m)
+# define BOOST_PP_FOR_272_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(273, s) BOOST_PP_IIF(c, BOOST_PP_FOR_273, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(273, s), p, o, m)
+# define BOOST_PP_FOR_273_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(274, s) BOOST_PP_IIF(c, BOOST_PP_FOR_274, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(274, s), p, o, m)
+# define BOOST_PP_FOR_274_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(275, s) BOOST_PP_IIF(c, BOOST_PP_FOR_275, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(275, s), p, o, m)
+# define BOOST_PP_FOR_275_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(276, s) BOOST_PP_IIF(c, BOOST_PP_FOR_276, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(276, s), p, o, m)
+# define BOOST_PP_FOR_276_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(277, s) BOOST_PP_IIF(c, BOOST_PP_FOR_277, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(277, s), p, o, m)
+# define BOOST_PP_FOR_277_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(278, s) BOOST_PP_IIF(c, BOOST_PP_FOR_278, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(278, s), p, o, m)
+# define BOOST_PP_FOR_278_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(279, s) BOOST_PP_IIF(c, BOOST_PP_FOR_279, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(279, s), p, o, m)
+# define BOOST_PP_FOR_279_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(280, s) BOOST_PP_IIF(c, BOOST_PP_FOR_280, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(280, s), p, o, m)
+# define BOOST_PP_FOR_280_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(281, s) BOOST_PP_IIF(c, BOOST_PP_FOR_281, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(281, s), p, o, m)
+# define BOOST_PP_FOR_281_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(282, s) BOOST_PP_IIF(c, BOOST_PP_FOR_282, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(282, s), p, o, m)
+# define BOOST_PP_FOR_282_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(283, s) BOOST_PP_IIF(c, BOOST_PP_FOR_283, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(283, s), p, o, m)
+# define BOOST_PP_FOR_283_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(284, s) BOOST_PP_IIF(c, BOOST_PP_FOR_284, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(284, s), p, o, m)
+# define BOOST_PP_FOR_284_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(285, s) BOOST_PP_IIF(c, BOOST_PP_FOR_285, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(285, s), p, o, m)
+# define BOOST_PP_FOR_285_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(286, s) BOOST_PP_IIF(c, BOOST_PP_FOR_286, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(286, s), p, o, m)
+# define BOOST_PP_FOR_286_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(287, s) BOOST_PP_IIF(c, BOOST_PP_FOR_287, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(287, s), p, o, m)
+# define BOOST_PP_FOR_287_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(288, s) BOOST_PP_IIF(c, BOOST_PP_FOR_288, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(288, s), p, o, m)
+# define BOOST_PP_FOR_288_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(289, s) BOOST_PP_IIF(c, BOOST_PP_FOR_289, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(289, s), p, o, m)
+# define BOOST_PP_FOR_289_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(290, s) BOOST_PP_IIF(c, BOOST_PP_FOR_290, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(290, s), p, o, m)
+# define BOOST_PP_FOR_290_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(291, s) BOOST_PP_IIF(c, BOOST_PP_FOR_291, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(291, s), p, o, m)
+# define BOOST_PP_FOR_291_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(292, s) BOOST_PP_IIF(c, BOOST_PP_FOR_292, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(292, s), p, o, m)
+# define BOOST_PP_FOR_292_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(293, s) BOOST_PP_IIF(c, BOOST_PP_FOR_293, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(293, s), p, o, m)
+# define BOOST_PP_FOR_293_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(294, s) BOOST_PP_IIF(c, BOOST_PP_FOR_294, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(294, s), p, o, m)
+# define BOOST_PP_FOR_294_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(295, s) BOOST_PP_IIF(c, BOOST_PP_FOR_295, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(295, s), p, o, m)
+# define BOOST_PP_FOR_295_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(296, s) BOOST_PP_IIF(c, BOOST_PP_FOR_296, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(296, s), p, o, m)
+# define BOOST_PP_FOR_296_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(297, s) BOOST_PP_IIF(c, BOOST_PP_FOR_297, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(297, s), p, o, m)
+# define BOOST_PP_FOR_297_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(298, s) BOOST_PP_IIF(c, BOOST_PP_FOR_298, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(298, s), p, o, m)
+# define BOOST_PP_FOR_298_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(299, s) BOOST_PP_IIF(c, BOOST_PP_FOR_299, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(299, s), p, o, m)
+# define BOOST_PP_FOR_299_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(300, s) BOOST_PP_IIF(c, BOOST_PP_FOR_300, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(300, s), p, o, m)
+# define BOOST_PP_FOR_300_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(301, s) BOOST_PP_IIF(c, BOOST_PP_FOR_301, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(301, s), p, o, m)
+# define BOOST_PP_FOR_301_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(302, s) BOOST_PP_IIF(c, BOOST_PP_FOR_302, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(302, s), p, o, m)
+# define BOOST_PP_FOR_302_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(303, s) BOOST_PP_IIF(c, BOOST_PP_FOR_303, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(303, s), p, o, m)
+# define BOOST_PP_FOR_303_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(304, s) BOOST_PP_IIF(c, BOOST_PP_FOR_304, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(304, s), p, o, m)
+# define BOOST_PP_FOR_304_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(305, s) BOOST_PP_IIF(c, BOOST_PP_FOR_305, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(305, s), p, o, m)
+# define BOOST_PP_FOR_305_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(306, s) BOOST_PP_IIF(c, BOOST_PP_FOR_306, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(306, s), p, o, m)
+# define BOOST_PP_FOR_306_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(307, s) BOOST_PP_IIF(c, BOOST_PP_FOR_307, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(307, s), p, o, m)
+# define BOOST_PP_FOR_307_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(308, s) BOOST_PP_IIF(c, BOOST_PP_FOR_308, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(308, s), p, o, m)
+# define BOOST_PP_FOR_308_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(309, s) BOOST_PP_IIF(c, BOOST_PP_FOR_309, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(309, s), p, o, m)
+# define BOOST_PP_FOR_309_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(310, s) BOOST_PP_IIF(c, BOOST_PP_FOR_310, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(310, s), p, o, m)
+# define BOOST_PP_FOR_310_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(311, s) BOOST_PP_IIF(c, BOOST_PP_FOR_311, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(311, s), p, o, m)
+# define BOOST_PP_FOR_311_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(312, s) BOOST_PP_IIF(c, BOOST_PP_FOR_312, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(312, s), p, o, m)
+# define BOOST_PP_FOR_312_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(313, s) BOOST_PP_IIF(c, BOOST_PP_FOR_313, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(313, s), p, o, m)
+# define BOOST_PP_FOR_313_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(314, s) BOOST_PP_IIF(c, BOOST_PP_FOR_314, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(314, s), p, o, m)
+# define BOOST_PP_FOR_314_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(315, s) BOOST_PP_IIF(c, BOOST_PP_FOR_315, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(315, s), p, o, m)
+# define BOOST_PP_FOR_315_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(316, s) BOOST_PP_IIF(c, BOOST_PP_FOR_316, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(316, s), p, o, m)
+# define BOOST_PP_FOR_316_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(317, s) BOOST_PP_IIF(c, BOOST_PP_FOR_317, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(317, s), p, o, m)
+# define BOOST_PP_FOR_317_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(318, s) BOOST_PP_IIF(c, BOOST_PP_FOR_318, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(318, s), p, o, m)
+# define BOOST_PP_FOR_318_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(319, s) BOOST_PP_IIF(c, BOOST_PP_FOR_319, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(319, s), p, o, m)
+# define BOOST_PP_FOR_319_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(320, s) BOOST_PP_IIF(c, BOOST_PP_FOR_320, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(320, s), p, o, m)
+# define BOOST_PP_FOR_320_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(321, s) BOOST_PP_IIF(c, BOOST_PP_FOR_321, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(321, s), p, o, m)
+# define BOOST_PP_FOR_321_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(322, s) BOOST_PP_IIF(c, BOOST_PP_FOR_322, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(322, s), p, o, m)
+# define BOOST_PP_FOR_322_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(323, s) BOOST_PP_IIF(c, BOOST_PP_FOR_323, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(323, s), p, o, m)
+# define BOOST_PP_FOR_323_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(324, s) BOOST_PP_IIF(c, BOOST_PP_FOR_324, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(324, s), p, o, m)
+# define BOOST_PP_FOR_324_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(325, s) BOOST_PP_IIF(c, BOOST_PP_FOR_325, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(325, s), p, o, m)
+# define BOOST_PP_FOR_325_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(326, s) BOOST_PP_IIF(c, BOOST_PP_FOR_326, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(326, s), p, o, m)
+# define BOOST_PP_FOR_326_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(327, s) BOOST_PP_IIF(c, BOOST_PP_FOR_327, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(327, s), p, o, m)
+# define BOOST_PP_FOR_327_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(328, s) BOOST_PP_IIF(c, BOOST_PP_FOR_328, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(328, s), p, o, m)
+# define BOOST_PP_FOR_328_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(329, s) BOOST_PP_IIF(c, BOOST_PP_FOR_329, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(329, s), p, o, m)
+# define BOOST_PP_FOR_329_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(330, s) BOOST_PP_IIF(c, BOOST_PP_FOR_330, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(330, s), p, o, m)
+# define BOOST_PP_FOR_330_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(331, s) BOOST_PP_IIF(c, BOOST_PP_FOR_331, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(331, s), p, o, m)
+# define BOOST_PP_FOR_331_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(332, s) BOOST_PP_IIF(c, BOOST_PP_FOR_332, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(332, s), p, o, m)
+# define BOOST_PP_FOR_332_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(333, s) BOOST_PP_IIF(c, BOOST_PP_FOR_333, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(333, s), p, o, m)
+# define BOOST_PP_FOR_333_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(334, s) BOOST_PP_IIF(c, BOOST_PP_FOR_334, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(334, s), p, o, m)
+# define BOOST_PP_FOR_334_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(335, s) BOOST_PP_IIF(c, BOOST_PP_FOR_335, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(335, s), p, o, m)
+# define BOOST_PP_FOR_335_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(336, s) BOOST_PP_IIF(c, BOOST_PP_FOR_336, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(336, s), p, o, m)
+# define BOOST_PP_FOR_336_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(337, s) BOOST_PP_IIF(c, BOOST_PP_FOR_337, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(337, s), p, o, m)
+# define BOOST_PP_FOR_337_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(338, s) BOOST_PP_IIF(c, BOOST_PP_FOR_338, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(338, s), p, o, m)
+# define BOOST_PP_FOR_338_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(339, s) BOOST_PP_IIF(c, BOOST_PP_FOR_339, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(339, s), p, o, m)
+# define BOOST_PP_FOR_339_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(340, s) BOOST_PP_IIF(c, BOOST_PP_FOR_340, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(340, s), p, o, m)
+# define BOOST_PP_FOR_340_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(341, s) BOOST_PP_IIF(c, BOOST_PP_FOR_341, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(341, s), p, o, m)
+# define BOOST_PP_FOR_341_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(342, s) BOOST_PP_IIF(c, BOOST_PP_FOR_342, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(342, s), p, o, m)
+# define BOOST_PP_FOR_342_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(343, s) BOOST_PP_IIF(c, BOOST_PP_FOR_343, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(343, s), p, o, m)
+# define BOOST_PP_FOR_343_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(344, s) BOOST_PP_IIF(c, BOOST_PP_FOR_344, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(344, s), p, o, m)
+# define BOOST_PP_FOR_344_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(345, s) BOOST_PP_IIF(c, BOOST_PP_FOR_345, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(345, s), p, o, m)
+# define BOOST_PP_FOR_345_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(346, s) BOOST_PP_IIF(c, BOOST_PP_FOR_346, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(346, s), p, o, m)
+# define BOOST_PP_FOR_346_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(347, s) BOOST_PP_IIF(c, BOOST_PP_FOR_347, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(347, s), p, o, m)
+# define BOOST_PP_FOR_347_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(348, s) BOOST_PP_IIF(c, BOOST_PP_FOR_348, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(348, s), p, o, m)
+# define BOOST_PP_FOR_348_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(349, s) BOOST_PP_IIF(c, BOOST_PP_FOR_349, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(349, s), p, o, m)
+# define BOOST_PP_FOR_349_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(350, s) BOOST_PP_IIF(c, BOOST_PP_FOR_350, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(350, s), p, o, m)
+# define BOOST_PP_FOR_350_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(351, s) BOOST_PP_IIF(c, BOOST_PP_FOR_351, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(351, s), p, o, m)
+# define BOOST_PP_FOR_351_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(352, s) BOOST_PP_IIF(c, BOOST_PP_FOR_352, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(352, s), p, o, m)
+# define BOOST_PP_FOR_352_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(353, s) BOOST_PP_IIF(c, BOOST_PP_FOR_353, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(353, s), p, o, m)
+# define BOOST_PP_FOR_353_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(354, s) BOOST_PP_IIF(c, BOOST_PP_FOR_354, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(354, s), p, o, m)
+# define BOOST_PP_FOR_354_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(355, s) BOOST_PP_IIF(c, BOOST_PP_FOR_355, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(355, s), p, o, m)
+# define BOOST_PP_FOR_355_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(356, s) BOOST_PP_IIF(c, BOOST_PP_FOR_356, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(356, s), p, o, m)
+# define BOOST_PP_FOR_356_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(357, s) BOOST_PP_IIF(c, BOOST_PP_FOR_357, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(357, s), p, o, m)
+# define BOOST_PP_FOR_357_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(358, s) BOOST_PP_IIF(c, BOOST_PP_FOR_358, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(358, s), p, o, m)
+# define BOOST_PP_FOR_358_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(359, s) BOOST_PP_IIF(c, BOOST_PP_FOR_359, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(359, s), p, o, m)
+# define BOOST_PP_FOR_359_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(360, s) BOOST_PP_IIF(c, BOOST_PP_FOR_360, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(360, s), p, o, m)
+# define BOOST_PP_FOR_360_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(361, s) BOOST_PP_IIF(c, BOOST_PP_FOR_361, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(361, s), p, o, m)
+# define BOOST_PP_FOR_361_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(362, s) BOOST_PP_IIF(c, BOOST_PP_FOR_362, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(362, s), p, o, m)
+# define BOOST_PP_FOR_362_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(363, s) BOOST_PP_IIF(c, BOOST_PP_FOR_363, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(363, s), p, o, m)
+# define BOOST_PP_FOR_363_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(364, s) BOOST_PP_IIF(c, BOOST_PP_FOR_364, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(364, s), p, o, m)
+# define BOOST_PP_FOR_364_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(365, s) BOOST_PP_IIF(c, BOOST_PP_FOR_365, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(365, s), p, o, m)
+# define BOOST_PP_FOR_365_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(366, s) BOOST_PP_IIF(c, BOOST_PP_FOR_366, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(366, s), p, o, m)
+# define BOOST_PP_FOR_366_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(367, s) BOOST_PP_IIF(c, BOOST_PP_FOR_367, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(367, s), p, o, m)
+# define BOOST_PP_FOR_367_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(368, s) BOOST_PP_IIF(c, BOOST_PP_FOR_368, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(368, s), p, o, m)
+# define BOOST_PP_FOR_368_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(369, s) BOOST_PP_IIF(c, BOOST_PP_FOR_369, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(369, s), p, o, m)
+# define BOOST_PP_FOR_369_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(370, s) BOOST_PP_IIF(c, BOOST_PP_FOR_370, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(370, s), p, o, m)
+# define BOOST_PP_FOR_370_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(371, s) BOOST_PP_IIF(c, BOOST_PP_FOR_371, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(371, s), p, o, m)
+# define BOOST_PP_FOR_371_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(372, s) BOOST_PP_IIF(c, BOOST_PP_FOR_372, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(372, s), p, o, m)
+# define BOOST_PP_FOR_372_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(373, s) BOOST_PP_IIF(c, BOOST_PP_FOR_373, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(373, s), p, o, m)
+# define BOOST_PP_FOR_373_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(374, s) BOOST_PP_IIF(c, BOOST_PP_FOR_374, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(374, s), p, o, m)
+# define BOOST_PP_FOR_374_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(375, s) BOOST_PP_IIF(c, BOOST_PP_FOR_375, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(375, s), p, o, m)
+# define BOOST_PP_FOR_375_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(376, s) BOOST_PP_IIF(c, BOOST_PP_FOR_376, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(376, s), p, o, m)
+# define BOOST_PP_FOR_376_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(377, s) BOOST_PP_IIF(c, BOOST_PP_FOR_377, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(377, s), p, o, m)
+# define BOOST_PP_FOR_377_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(378, s) BOOST_PP_IIF(c, BOOST_PP_FOR_378, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(378, s), p, o, m)
+# define BOOST_PP_FOR_378_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(379, s) BOOST_PP_IIF(c, BOOST_PP_FOR_379, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(379, s), p, o, m)
+# define BOOST_PP_FOR_379_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(380, s) BOOST_PP_IIF(c, BOOST_PP_FOR_380, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(380, s), p, o, m)
+# define BOOST_PP_FOR_380_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(381, s) BOOST_PP_IIF(c, BOOST_PP_FOR_381, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(381, s), p, o, m)
+# define BOOST_PP_FOR_381_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(382, s) BOOST_PP_IIF(c, BOOST_PP_FOR_382, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(382, s), p, o, m)
+# define BOOST_PP_FOR_382_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(383, s) BOOST_PP_IIF(c, BOOST_PP_FOR_383, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(383, s), p, o, m)
+# define BOOST_PP_FOR_383_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(384, s) BOOST_PP_IIF(c, BOOST_PP_FOR_384, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(384, s), p, o, m)
+# define BOOST_PP_FOR_384_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(385, s) BOOST_PP_IIF(c, BOOST_PP_FOR_385, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(385, s), p, o, m)
+# define BOOST_PP_FOR_385_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(386, s) BOOST_PP_IIF(c, BOOST_PP_FOR_386, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(386, s), p, o, m)
+# define BOOST_PP_FOR_386_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(387, s) BOOST_PP_IIF(c, BOOST_PP_FOR_387, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(387, s), p, o, m)
+# define BOOST_PP_FOR_387_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(388, s) BOOST_PP_IIF(c, BOOST_PP_FOR_388, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(388, s), p, o, m)
+# define BOOST_PP_FOR_388_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(389, s) BOOST_PP_IIF(c, BOOST_PP_FOR_389, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(389, s), p, o, m)
+# define BOOST_PP_FOR_389_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(390, s) BOOST_PP_IIF(c, BOOST_PP_FOR_390, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(390, s), p, o, m)
+# define BOOST_PP_FOR_390_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(391, s) BOOST_PP_IIF(c, BOOST_PP_FOR_391, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(391, s), p, o, m)
+# define BOOST_PP_FOR_391_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(392, s) BOOST_PP_IIF(c, BOOST_PP_FOR_392, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(392, s), p, o, m)
+# define BOOST_PP_FOR_392_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(393, s) BOOST_PP_IIF(c, BOOST_PP_FOR_393, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(393, s), p, o, m)
+# define BOOST_PP_FOR_393_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(394, s) BOOST_PP_IIF(c, BOOST_PP_FOR_394, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(394, s), p, o, m)
+# define BOOST_PP_FOR_394_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(395, s) BOOST_PP_IIF(c, BOOST_PP_FOR_395, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(395, s), p, o, m)
+# define BOOST_PP_FOR_395_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(396, s) BOOST_PP_IIF(c, BOOST_PP_FOR_396, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(396, s), p, o, m)
+# define BOOST_PP_FOR_396_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(397, s) BOOST_PP_IIF(c, BOOST_PP_FOR_397, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(397, s), p, o, m)
+# define BOOST_PP_FOR_397_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(398, s) BOOST_PP_IIF(c, BOOST_PP_FOR_398, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(398, s), p, o, m)
+# define BOOST_PP_FOR_398_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(399, s) BOOST_PP_IIF(c, BOOST_PP_FOR_399, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(399, s), p, o, m)
+# define BOOST_PP_FOR_399_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(400, s) BOOST_PP_IIF(c, BOOST_PP_FOR_400, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(400, s), p, o, m)
+# define BOOST_PP_FOR_400_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(401, s) BOOST_PP_IIF(c, BOOST_PP_FOR_401, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(401, s), p, o, m)
+# define BOOST_PP_FOR_401_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(402, s) BOOST_PP_IIF(c, BOOST_PP_FOR_402, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(402, s), p, o, m)
+# define BOOST_PP_FOR_402_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(403, s) BOOST_PP_IIF(c, BOOST_PP_FOR_403, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(403, s), p, o, m)
+# define BOOST_PP_FOR_403_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(404, s) BOOST_PP_IIF(c, BOOST_PP_FOR_404, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(404, s), p, o, m)
+# define BOOST_PP_FOR_404_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(405, s) BOOST_PP_IIF(c, BOOST_PP_FOR_405, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(405, s), p, o, m)
+# define BOOST_PP_FOR_405_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(406, s) BOOST_PP_IIF(c, BOOST_PP_FOR_406, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(406, s), p, o, m)
+# define BOOST_PP_FOR_406_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(407, s) BOOST_PP_IIF(c, BOOST_PP_FOR_407, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(407, s), p, o, m)
+# define BOOST_PP_FOR_407_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(408, s) BOOST_PP_IIF(c, BOOST_PP_FOR_408, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(408, s), p, o, m)
+# define BOOST_PP_FOR_408_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(409, s) BOOST_PP_IIF(c, BOOST_PP_FOR_409, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(409, s), p, o, m)
+# define BOOST_PP_FOR_409_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(410, s) BOOST_PP_IIF(c, BOOST_PP_FOR_410, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(410, s), p, o, m)
+# define BOOST_PP_FOR_410_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(411, s) BOOST_PP_IIF(c, BOOST_PP_FOR_411, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(411, s), p, o, m)
+# define BOOST_PP_FOR_411_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(412, s) BOOST_PP_IIF(c, BOOST_PP_FOR_412, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(412, s), p, o, m)
+# define BOOST_PP_FOR_412_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(413, s) BOOST_PP_IIF(c, BOOST_PP_FOR_413, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(413, s), p, o, m)
+# define BOOST_PP_FOR_413_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(414, s) BOOST_PP_IIF(c, BOOST_PP_FOR_414, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(414, s), p, o, m)
+# define BOOST_PP_FOR_414_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(415, s) BOOST_PP_IIF(c, BOOST_PP_FOR_415, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(415, s), p, o, m)
+# define BOOST_PP_FOR_415_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(416, s) BOOST_PP_IIF(c, BOOST_PP_FOR_416, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(416, s), p, o, m)
+# define BOOST_PP_FOR_416_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(417, s) BOOST_PP_IIF(c, BOOST_PP_FOR_417, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(417, s), p, o, m)
+# define BOOST_PP_FOR_417_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(418, s) BOOST_PP_IIF(c, BOOST_PP_FOR_418, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(418, s), p, o, m)
+# define BOOST_PP_FOR_418_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(419, s) BOOST_PP_IIF(c, BOOST_PP_FOR_419, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(419, s), p, o, m)
+# define BOOST_PP_FOR_419_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(420, s) BOOST_PP_IIF(c, BOOST_PP_FOR_420, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(420, s), p, o, m)
+# define BOOST_PP_FOR_420_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(421, s) BOOST_PP_IIF(c, BOOST_PP_FOR_421, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(421, s), p, o, m)
+# define BOOST_PP_FOR_421_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(422, s) BOOST_PP_IIF(c, BOOST_PP_FOR_422, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(422, s), p, o, m)
+# define BOOST_PP_FOR_422_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(423, s) BOOST_PP_IIF(c, BOOST_PP_FOR_423, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(423, s), p, o, m)
+# define BOOST_PP_FOR_423_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(424, s) BOOST_PP_IIF(c, BOOST_PP_FOR_424, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(424, s), p, o, m)
+# define BOOST_PP_FOR_424_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(425, s) BOOST_PP_IIF(c, BOOST_PP_FOR_425, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(425, s), p, o, m)
+# define BOOST_PP_FOR_425_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(426, s) BOOST_PP_IIF(c, BOOST_PP_FOR_426, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(426, s), p, o, m)
+# define BOOST_PP_FOR_426_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(427, s) BOOST_PP_IIF(c, BOOST_PP_FOR_427, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(427, s), p, o, m)
+# define BOOST_PP_FOR_427_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(428, s) BOOST_PP_IIF(c, BOOST_PP_FOR_428, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(428, s), p, o, m)
+# define BOOST_PP_FOR_428_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(429, s) BOOST_PP_IIF(c, BOOST_PP_FOR_429, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(429, s), p, o, m)
+# define BOOST_PP_FOR_429_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(430, s) BOOST_PP_IIF(c, BOOST_PP_FOR_430, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(430, s), p, o, m)
+# define BOOST_PP_FOR_430_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(431, s) BOOST_PP_IIF(c, BOOST_PP_FOR_431, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(431, s), p, o, m)
+# define BOOST_PP_FOR_431_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(432, s) BOOST_PP_IIF(c, BOOST_PP_FOR_432, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(432, s), p, o, m)
+# define BOOST_PP_FOR_432_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(433, s) BOOST_PP_IIF(c, BOOST_PP_FOR_433, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(433, s), p, o, m)
+# define BOOST_PP_FOR_433_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(434, s) BOOST_PP_IIF(c, BOOST_PP_FOR_434, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(434, s), p, o, m)
+# define BOOST_PP_FOR_434_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(435, s) BOOST_PP_IIF(c, BOOST_PP_FOR_435, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(435, s), p, o, m)
+# define BOOST_PP_FOR_435_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(436, s) BOOST_PP_IIF(c, BOOST_PP_FOR_436, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(436, s), p, o, m)
+# define BOOST_PP_FOR_436_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(437, s) BOOST_PP_IIF(c, BOOST_PP_FOR_437, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(437, s), p, o, m)
+# define BOOST_PP_FOR_437_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(438, s) BOOST_PP_IIF(c, BOOST_PP_FOR_438, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(438, s), p, o, m)
+# define BOOST_PP_FOR_438_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(439, s) BOOST_PP_IIF(c, BOOST_PP_FOR_439, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(439, s), p, o, m)
+# define BOOST_PP_FOR_439_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(440, s) BOOST_PP_IIF(c, BOOST_PP_FOR_440, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(440, s), p, o, m)
+# define BOOST_PP_FOR_440_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(441, s) BOOST_PP_IIF(c, BOOST_PP_FOR_441, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(441, s), p, o, m)
+# define BOOST_PP_FOR_441_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(442, s) BOOST_PP_IIF(c, BOOST_PP_FOR_442, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(442, s), p, o, m)
+# define BOOST_PP_FOR_442_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(443, s) BOOST_PP_IIF(c, BOOST_PP_FOR_443, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(443, s), p, o, m)
+# define BOOST_PP_FOR_443_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(444, s) BOOST_PP_IIF(c, BOOST_PP_FOR_444, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(444, s), p, o, m)
+# define BOOST_PP_FOR_444_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(445, s) BOOST_PP_IIF(c, BOOST_PP_FOR_445, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(445, s), p, o, m)
+# define BOOST_PP_FOR_445_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(446, s) BOOST_PP_IIF(c, BOOST_PP_FOR_446, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(446, s), p, o, m)
+# define BOOST_PP_FOR_446_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(447, s) BOOST_PP_IIF(c, BOOST_PP_FOR_447, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(447, s), p, o, m)
+# define BOOST_PP_FOR_447_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(448, s) BOOST_PP_IIF(c, BOOST_PP_FOR_448, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(448, s), p, o, m)
+# define BOOST_PP_FOR_448_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(449, s) BOOST_PP_IIF(c, BOOST_PP_FOR_449, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(449, s), p, o, m)
+# define BOOST_PP_FOR_449_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(450, s) BOOST_PP_IIF(c, BOOST_PP_FOR_450, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(450, s), p, o, m)
+# define BOOST_PP_FOR_450_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(451, s) BOOST_PP_IIF(c, BOOST_PP_FOR_451, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(451, s), p, o, m)
+# define BOOST_PP_FOR_451_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(452, s) BOOST_PP_IIF(c, BOOST_PP_FOR_452, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(452, s), p, o, m)
+# define BOOST_PP_FOR_452_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(453, s) BOOST_PP_IIF(c, BOOST_PP_FOR_453, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(453, s), p, o, m)
+# define BOOST_PP_FOR_453_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(454, s) BOOST_PP_IIF(c, BOOST_PP_FOR_454, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(454, s), p, o, m)
+# define BOOST_PP_FOR_454_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(455, s) BOOST_PP_IIF(c, BOOST_PP_FOR_455, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(455, s), p, o, m)
+# define BOOST_PP_FOR_455_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(456, s) BOOST_PP_IIF(c, BOOST_PP_FOR_456, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(456, s), p, o, m)
+# define BOOST_PP_FOR_456_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(457, s) BOOST_PP_IIF(c, BOOST_PP_FOR_457, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(457, s), p, o, m)
+# define BOOST_PP_FOR_457_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(458, s) BOOST_PP_IIF(c, BOOST_PP_FOR_458, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(458, s), p, o, m)
+# define BOOST_PP_FOR_458_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(459, s) BOOST_PP_IIF(c, BOOST_PP_FOR_459, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(459, s), p, o, m)
+# define BOOST_PP_FOR_459_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(460, s) BOOST_PP_IIF(c, BOOST_PP_FOR_460, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(460, s), p, o, m)
+# define BOOST_PP_FOR_460_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(461, s) BOOST_PP_IIF(c, BOOST_PP_FOR_461, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(461, s), p, o, m)
+# define BOOST_PP_FOR_461_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(462, s) BOOST_PP_IIF(c, BOOST_PP_FOR_462, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(462, s), p, o, m)
+# define BOOST_PP_FOR_462_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(463, s) BOOST_PP_IIF(c, BOOST_PP_FOR_463, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(463, s), p, o, m)
+# define BOOST_PP_FOR_463_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(464, s) BOOST_PP_IIF(c, BOOST_PP_FOR_464, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(464, s), p, o, m)
+# define BOOST_PP_FOR_464_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(465, s) BOOST_PP_IIF(c, BOOST_PP_FOR_465, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(465, s), p, o, m)
+# define BOOST_PP_FOR_465_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(466, s) BOOST_PP_IIF(c, BOOST_PP_FOR_466, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(466, s), p, o, m)
+# define BOOST_PP_FOR_466_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(467, s) BOOST_PP_IIF(c, BOOST_PP_FOR_467, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(467, s), p, o, m)
+# define BOOST_PP_FOR_467_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(468, s) BOOST_PP_IIF(c, BOOST_PP_FOR_468, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(468, s), p, o, m)
+# define BOOST_PP_FOR_468_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(469, s) BOOST_PP_IIF(c, BOOST_PP_FOR_469, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(469, s), p, o, m)
+# define BOOST_PP_FOR_469_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(470, s) BOOST_PP_IIF(c, BOOST_PP_FOR_470, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(470, s), p, o, m)
+# define BOOST_PP_FOR_470_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(471, s) BOOST_PP_IIF(c, BOOST_PP_FOR_471, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(471, s), p, o, m)
+# define BOOST_PP_FOR_471_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(472, s) BOOST_PP_IIF(c, BOOST_PP_FOR_472, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(472, s), p, o, m)
+# define BOOST_PP_FOR_472_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(473, s) BOOST_PP_IIF(c, BOOST_PP_FOR_473, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(473, s), p, o, m)
+# define BOOST_PP_FOR_473_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(474, s) BOOST_PP_IIF(c, BOOST_PP_FOR_474, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(474, s), p, o, m)
+# define BOOST_PP_FOR_474_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(475, s) BOOST_PP_IIF(c, BOOST_PP_FOR_475, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(475, s), p, o, m)
+# define BOOST_PP_FOR_475_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(476, s) BOOST_PP_IIF(c, BOOST_PP_FOR_476, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(476, s), p, o, m)
+# define BOOST_PP_FOR_476_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(477, s) BOOST_PP_IIF(c, BOOST_PP_FOR_477, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(477, s), p, o, m)
+# define BOOST_PP_FOR_477_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(478, s) BOOST_PP_IIF(c, BOOST_PP_FOR_478, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(478, s), p, o, m)
+# define BOOST_PP_FOR_478_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(479, s) BOOST_PP_IIF(c, BOOST_PP_FOR_479, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(479, s), p, o, m)
+# define BOOST_PP_FOR_479_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(480, s) BOOST_PP_IIF(c, BOOST_PP_FOR_480, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(480, s), p, o, m)
+# define BOOST_PP_FOR_480_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(481, s) BOOST_PP_IIF(c, BOOST_PP_FOR_481, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(481, s), p, o, m)
+# define BOOST_PP_FOR_481_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(482, s) BOOST_PP_IIF(c, BOOST_PP_FOR_482, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(482, s), p, o, m)
+# define BOOST_PP_FOR_482_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(483, s) BOOST_PP_IIF(c, BOOST_PP_FOR_483, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(483, s), p, o, m)
+# define BOOST_PP_FOR_483_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(484, s) BOOST_PP_IIF(c, BOOST_PP_FOR_484, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(484, s), p, o, m)
+# define BOOST_PP_FOR_484_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(485, s) BOOST_PP_IIF(c, BOOST_PP_FOR_485, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(485, s), p, o, m)
+# define BOOST_PP_FOR_485_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(486, s) BOOST_PP_IIF(c, BOOST_PP_FOR_486, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(486, s), p, o, m)
+# define BOOST_PP_FOR_486_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(487, s) BOOST_PP_IIF(c, BOOST_PP_FOR_487, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(487, s), p, o, m)
+# define BOOST_PP_FOR_487_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(488, s) BOOST_PP_IIF(c, BOOST_PP_FOR_488, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(488, s), p, o, m)
+# define BOOST_PP_FOR_488_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(489, s) BOOST_PP_IIF(c, BOOST_PP_FOR_489, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(489, s), p, o, m)
+# define BOOST_PP_FOR_489_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(490, s) BOOST_PP_IIF(c, BOOST_PP_FOR_490, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(490, s), p, o, m)
+# define BOOST_PP_FOR_490_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(491, s) BOOST_PP_IIF(c, BOOST_PP_FOR_491, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(491, s), p, o, m)
+# define BOOST_PP_FOR_491_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(492, s) BOOST_PP_IIF(c, BOOST_PP_FOR_492, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(492, s), p, o, m)
+# define BOOST_PP_FOR_492_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(493, s) BOOST_PP_IIF(c, BOOST_PP_FOR_493, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(493, s), p, o, m)
+# define BOOST_PP_FOR_493_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(494, s) BOOST_PP_IIF(c, BOOST_PP_FOR_494, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(494, s), p, o, m)
+# define BOOST_PP_FOR_494_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(495, s) BOOST_PP_IIF(c, BOOST_PP_FOR_495, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(495, s), p, o, m)
+# define BOOST_PP_FOR_495_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(496, s) BOOST_PP_IIF(c, BOOST_PP_FOR_496, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(496, s), p, o, m)
+# define BOOST_PP_FOR_496_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(497, s) BOOST_PP_IIF(c, BOOST_PP_FOR_497, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(497, s), p, o, m)
+# define BOOST_PP_FOR_497_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(498, s) BOOST_PP_IIF(c, BOOST_PP_FOR_498, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(498, s), p, o, m)
+# define BOOST_PP_FOR_498_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(499, s) BOOST_PP_IIF(c, BOOST_PP_FOR_499, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(499, s), p, o, m)
+# define BOOST_PP_FOR_499_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(500, s) BOOST_PP_IIF(c, BOOST_PP_FOR_500, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(500, s), p, o, m)
+# define BOOST_PP_FOR_500_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(501, s) BOOST_PP_IIF(c, BOOST_PP_FOR_501, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(501, s), p, o, m)
+# define BOOST_PP_FOR_501_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(502, s) BOOST_PP_IIF(c, BOOST_PP_FOR_502, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(502, s), p, o, m)
+# define BOOST_PP_FOR_502_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(503, s) BOOST_PP_IIF(c, BOOST_PP_FOR_503, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(503, s), p, o, m)
+# define BOOST_PP_FOR_503_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(504, s) BOOST_PP_IIF(c, BOOST_PP_FOR_504, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(504, s), p, o, m)
+# define BOOST_PP_FOR_504_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(505, s) BOOST_PP_IIF(c, BOOST_PP_FOR_505, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(505, s), p, o, m)
+# define BOOST_PP_FOR_505_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(506, s) BOOST_PP_IIF(c, BOOST_PP_FOR_506, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(506, s), p, o, m)
+# define BOOST_PP_FOR_506_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(507, s) BOOST_PP_IIF(c, BOOST_PP_FOR_507, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(507, s), p, o, m)
+# define BOOST_PP_FOR_507_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(508, s) BOOST_PP_IIF(c, BOOST_PP_FOR_508, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(508, s), p, o, m)
+# define BOOST_PP_FOR_508_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(509, s) BOOST_PP_IIF(c, BOOST_PP_FOR_509, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(509, s), p, o, m)
+# define BOOST_PP_FOR_509_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(510, s) BOOST_PP_IIF(c, BOOST_PP_FOR_510, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(510, s), p, o, m)
+# define BOOST_PP_FOR_510_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(511, s) BOOST_PP_IIF(c, BOOST_PP_FOR_511, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(511, s), p, o, m)
+# define BOOST_PP_FOR_511_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(512, s) BOOST_PP_IIF(c, BOOST_PP_FOR_512, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(512, s), p, o, m)
+# define BOOST_PP_FOR_512_C(c, s, p, o, m) BOOST_PP_IIF(c, m, BOOST_PP_TUPLE_EAT_2)(513, s) BOOST_PP_IIF(c, BOOST_PP_FOR_513, BOOST_PP_TUPLE_EAT_4)(BOOST_PP_EXPR_IIF(c, o)(513, s), p, o, m)
+#
+# endif
@@ -0,0 +1,531 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002) */
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_REPETITION_FOR_1024_HPP
+# define BOOST_PREPROCESSOR_REPETITION_FOR_1024_HPP
+#
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_513(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_514(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_515(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_516(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_517(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_518(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_519(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_520(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_521(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_522(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_523(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_524(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_525(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_526(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_527(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_528(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_529(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_530(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_531(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_532(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_533(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_534(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_535(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_536(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_537(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_538(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_539(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_540(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_541(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_542(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_543(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_544(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_545(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_546(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_547(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_548(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_549(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_550(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_551(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_552(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_553(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_554(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_555(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_556(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_557(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_558(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_559(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_560(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_561(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_562(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_563(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_564(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_565(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_566(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_567(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_568(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_569(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_570(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_571(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_572(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_573(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_574(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_575(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_576(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_577(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_578(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_579(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_580(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_581(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_582(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_583(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_584(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_585(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_586(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_587(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_588(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_589(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_590(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_591(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_592(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_593(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_594(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_595(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_596(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_597(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_598(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_599(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_600(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_601(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_602(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_603(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_604(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_605(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_606(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_607(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_608(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_609(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_610(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_611(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_612(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_613(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_614(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_615(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_616(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_617(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_618(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_619(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_620(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_621(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_622(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_623(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_624(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_625(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_626(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_627(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_628(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_629(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_630(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_631(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_632(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_633(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_634(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_635(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_636(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_637(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_638(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_639(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_640(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_641(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_642(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_643(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_644(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_645(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_646(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_647(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_648(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_649(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_650(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_651(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_652(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_653(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_654(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_655(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_656(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_657(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_658(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_659(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_660(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_661(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_662(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_663(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_664(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_665(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_666(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_667(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_668(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_669(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_670(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_671(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_672(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_673(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_674(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_675(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_676(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_677(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_678(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_679(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_680(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_681(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_682(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_683(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_684(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_685(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_686(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_687(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_688(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_689(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_690(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_691(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_692(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_693(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_694(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_695(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_696(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_697(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_698(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_699(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_700(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_701(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_702(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_703(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_704(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_705(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_706(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_707(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_708(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_709(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_710(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_711(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_712(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_713(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_714(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_715(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_716(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_717(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_718(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_719(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_720(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_721(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_722(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_723(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_724(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_725(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_726(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_727(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_728(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_729(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_730(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_731(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_732(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_733(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_734(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_735(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_736(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_737(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_738(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_739(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_740(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_741(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_742(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_743(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_744(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_745(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_746(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_747(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_748(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_749(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_750(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_751(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_752(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_753(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_754(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_755(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_756(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_757(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_758(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_759(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_760(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_761(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_762(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_763(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_764(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_765(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_766(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_767(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_768(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_769(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_770(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_771(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_772(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_773(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_774(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_775(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_776(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_777(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_778(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_779(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_780(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_781(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_782(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_783(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_784(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_785(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_786(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_787(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_788(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_789(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_790(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_791(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_792(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_793(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_794(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_795(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_796(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_797(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_798(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_799(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_800(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_801(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_802(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_803(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_804(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_805(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_806(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_807(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_808(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_809(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_810(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_811(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_812(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_813(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_814(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_815(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_816(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_817(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_818(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_819(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_820(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_821(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_822(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_823(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_824(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_825(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_826(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_827(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_828(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_829(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_830(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_831(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_832(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_833(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_834(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_835(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_836(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_837(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_838(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_839(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_840(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_841(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_842(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_843(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_844(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_845(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_846(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_847(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_848(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_849(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_850(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_851(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_852(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_853(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_854(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_855(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_856(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_857(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_858(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_859(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_860(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_861(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_862(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_863(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_864(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_865(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_866(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_867(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_868(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_869(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_870(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_871(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_872(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_873(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_874(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_875(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_876(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_877(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_878(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_879(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_880(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_881(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_882(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_883(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_884(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_885(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_886(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_887(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_888(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_889(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_890(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_891(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_892(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_893(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_894(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_895(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_896(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_897(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_898(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_899(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_900(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_901(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_902(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_903(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_904(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_905(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_906(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_907(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_908(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_909(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_910(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_911(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_912(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_913(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_914(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_915(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_916(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_917(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_918(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_919(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_920(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_921(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_922(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_923(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_924(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_925(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_926(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_927(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_928(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_929(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_930(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_931(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_932(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_933(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_934(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_935(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_936(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_937(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_938(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_939(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_940(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_941(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_942(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_943(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_944(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_945(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_946(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_947(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_948(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_949(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_950(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_951(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_952(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_953(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_954(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_955(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_956(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_957(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_958(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_959(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_960(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_961(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_962(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_963(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_964(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_965(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_966(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_967(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_968(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_969(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_970(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_971(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_972(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_973(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_974(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_975(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_976(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_977(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_978(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_979(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_980(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_981(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_982(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_983(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_984(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_985(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_986(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_987(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_988(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_989(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_990(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_991(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_992(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_993(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_994(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_995(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_996(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_997(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_998(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_999(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1000(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1001(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1002(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1003(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1004(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1005(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1006(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1007(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1008(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1009(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1010(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1011(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1012(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1013(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1014(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1015(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1016(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1017(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1018(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1019(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1020(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1021(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1022(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1023(s, p, o, m) 0
+# define BOOST_PP_FOR_CHECK_BOOST_PP_FOR_1024(s, p, o, m) 0
+#
+# endif
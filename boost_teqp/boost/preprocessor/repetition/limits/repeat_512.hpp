@@ -0,0 +1,789 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002) */
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_REPETITION_REPEAT_512_HPP
+# define BOOST_PREPROCESSOR_REPETITION_REPEAT_512_HPP
+#
+# define BOOST_PP_REPEAT_1_257(m, d) BOOST_PP_REPEAT_1_256(m, d) m(2, 256, d)
+# define BOOST_PP_REPEAT_1_258(m, d) BOOST_PP_REPEAT_1_257(m, d) m(2, 257, d)
+# define BOOST_PP_REPEAT_1_259(m, d) BOOST_PP_REPEAT_1_258(m, d) m(2, 258, d)
+# define BOOST_PP_REPEAT_1_260(m, d) BOOST_PP_REPEAT_1_259(m, d) m(2, 259, d)
+# define BOOST_PP_REPEAT_1_261(m, d) BOOST_PP_REPEAT_1_260(m, d) m(2, 260, d)
+# define BOOST_PP_REPEAT_1_262(m, d) BOOST_PP_REPEAT_1_261(m, d) m(2, 261, d)
+# define BOOST_PP_REPEAT_1_263(m, d) BOOST_PP_REPEAT_1_262(m, d) m(2, 262, d)
+# define BOOST_PP_REPEAT_1_264(m, d) BOOST_PP_REPEAT_1_263(m, d) m(2, 263, d)
+# define BOOST_PP_REPEAT_1_265(m, d) BOOST_PP_REPEAT_1_264(m, d) m(2, 264, d)
+# define BOOST_PP_REPEAT_1_266(m, d) BOOST_PP_REPEAT_1_265(m, d) m(2, 265, d)
+# define BOOST_PP_REPEAT_1_267(m, d) BOOST_PP_REPEAT_1_266(m, d) m(2, 266, d)
+# define BOOST_PP_REPEAT_1_268(m, d) BOOST_PP_REPEAT_1_267(m, d) m(2, 267, d)
+# define BOOST_PP_REPEAT_1_269(m, d) BOOST_PP_REPEAT_1_268(m, d) m(2, 268, d)
+# define BOOST_PP_REPEAT_1_270(m, d) BOOST_PP_REPEAT_1_269(m, d) m(2, 269, d)
+# define BOOST_PP_REPEAT_1_271(m, d) BOOST_PP_REPEAT_1_270(m, d) m(2, 270, d)
+# define BOOST_PP_REPEAT_1_272(m, d) BOOST_PP_REPEAT_1_271(m, d) m(2, 271, d)
+# define BOOST_PP_REPEAT_1_273(m, d) BOOST_PP_REPEAT_1_272(m, d) m(2, 272, d)
+# define BOOST_PP_REPEAT_1_274(m, d) BOOST_PP_REPEAT_1_273(m, d) m(2, 273, d)
+# define BOOST_PP_REPEAT_1_275(m, d) BOOST_PP_REPEAT_1_274(m, d) m(2, 274, d)
+# define BOOST_PP_REPEAT_1_276(m, d) BOOST_PP_REPEAT_1_275(m, d) m(2, 275, d)
+# define BOOST_PP_REPEAT_1_277(m, d) BOOST_PP_REPEAT_1_276(m, d) m(2, 276, d)
+# define BOOST_PP_REPEAT_1_278(m, d) BOOST_PP_REPEAT_1_277(m, d) m(2, 277, d)
+# define BOOST_PP_REPEAT_1_279(m, d) BOOST_PP_REPEAT_1_278(m, d) m(2, 278, d)
+# define BOOST_PP_REPEAT_1_280(m, d) BOOST_PP_REPEAT_1_279(m, d) m(2, 279, d)
+# define BOOST_PP_REPEAT_1_281(m, d) BOOST_PP_REPEAT_1_280(m, d) m(2, 280, d)
+# define BOOST_PP_REPEAT_1_282(m, d) BOOST_PP_REPEAT_1_281(m, d) m(2, 281, d)
+# define BOOST_PP_REPEAT_1_283(m, d) BOOST_PP_REPEAT_1_282(m, d) m(2, 282, d)
+# define BOOST_PP_REPEAT_1_284(m, d) BOOST_PP_REPEAT_1_283(m, d) m(2, 283, d)
+# define BOOST_PP_REPEAT_1_285(m, d) BOOST_PP_REPEAT_1_284(m, d) m(2, 284, d)
+# define BOOST_PP_REPEAT_1_286(m, d) BOOST_PP_REPEAT_1_285(m, d) m(2, 285, d)
+# define BOOST_PP_REPEAT_1_287(m, d) BOOST_PP_REPEAT_1_286(m, d) m(2, 286, d)
+# define BOOST_PP_REPEAT_1_288(m, d) BOOST_PP_REPEAT_1_287(m, d) m(2, 287, d)
+# define BOOST_PP_REPEAT_1_289(m, d) BOOST_PP_REPEAT_1_288(m, d) m(2, 288, d)
+# define BOOST_PP_REPEAT_1_290(m, d) BOOST_PP_REPEAT_1_289(m, d) m(2, 289, d)
+# define BOOST_PP_REPEAT_1_291(m, d) BOOST_PP_REPEAT_1_290(m, d) m(2, 290, d)
+# define BOOST_PP_REPEAT_1_292(m, d) BOOST_PP_REPEAT_1_291(m, d) m(2, 291, d)
+# define BOOST_PP_REPEAT_1_293(m, d) BOOST_PP_REPEAT_1_292(m, d) m(2, 292, d)
+# define BOOST_PP_REPEAT_1_294(m, d) BOOST_PP_REPEAT_1_293(m, d) m(2, 293, d)
+# define BOOST_PP_REPEAT_1_295(m, d) BOOST_PP_REPEAT_1_294(m, d) m(2, 294, d)
+# define BOOST_PP_REPEAT_1_296(m, d) BOOST_PP_REPEAT_1_295(m, d) m(2, 295, d)
+# define BOOST_PP_REPEAT_1_297(m, d) BOOST_PP_REPEAT_1_296(m, d) m(2, 296, d)
+# define BOOST_PP_REPEAT_1_298(m, d) BOOST_PP_REPEAT_1_297(m, d) m(2, 297, d)
+# define BOOST_PP_REPEAT_1_299(m, d) BOOST_PP_REPEAT_1_298(m, d) m(2, 298, d)
+# define BOOST_PP_REPEAT_1_300(m, d) BOOST_PP_REPEAT_1_299(m, d) m(2, 299, d)
+# define BOOST_PP_REPEAT_1_301(m, d) BOOST_PP_REPEAT_1_300(m, d) m(2, 300, d)
+# define BOOST_PP_REPEAT_1_302(m, d) BOOST_PP_REPEAT_1_301(m, d) m(2, 301, d)
+# define BOOST_PP_REPEAT_1_303(m, d) BOOST_PP_REPEAT_1_302(m, d) m(2, 302, d)
+# define BOOST_PP_REPEAT_1_304(m, d) BOOST_PP_REPEAT_1_303(m, d) m(2, 303, d)
+# define BOOST_PP_REPEAT_1_305(m, d) BOOST_PP_REPEAT_1_304(m, d) m(2, 304, d)
+# define BOOST_PP_REPEAT_1_306(m, d) BOOST_PP_REPEAT_1_305(m, d) m(2, 305, d)
+# define BOOST_PP_REPEAT_1_307(m, d) BOOST_PP_REPEAT_1_306(m, d) m(2, 306, d)
+# define BOOST_PP_REPEAT_1_308(m, d) BOOST_PP_REPEAT_1_307(m, d) m(2, 307, d)
+# define BOOST_PP_REPEAT_1_309(m, d) BOOST_PP_REPEAT_1_308(m, d) m(2, 308, d)
+# define BOOST_PP_REPEAT_1_310(m, d) BOOST_PP_REPEAT_1_309(m, d) m(2, 309, d)
+# define BOOST_PP_REPEAT_1_311(m, d) BOOST_PP_REPEAT_1_310(m, d) m(2, 310, d)
+# define BOOST_PP_REPEAT_1_312(m, d) BOOST_PP_REPEAT_1_311(m, d) m(2, 311, d)
+# define BOOST_PP_REPEAT_1_313(m, d) BOOST_PP_REPEAT_1_312(m, d) m(2, 312, d)
+# define BOOST_PP_REPEAT_1_314(m, d) BOOST_PP_REPEAT_1_313(m, d) m(2, 313, d)
+# define BOOST_PP_REPEAT_1_315(m, d) BOOST_PP_REPEAT_1_314(m, d) m(2, 314, d)
+# define BOOST_PP_REPEAT_1_316(m, d) BOOST_PP_REPEAT_1_315(m, d) m(2, 315, d)
+# define BOOST_PP_REPEAT_1_317(m, d) BOOST_PP_REPEAT_1_316(m, d) m(2, 316, d)
+# define BOOST_PP_REPEAT_1_318(m, d) BOOST_PP_REPEAT_1_317(m, d) m(2, 317, d)
+# define BOOST_PP_REPEAT_1_319(m, d) BOOST_PP_REPEAT_1_318(m, d) m(2, 318, d)
+# define BOOST_PP_REPEAT_1_320(m, d) BOOST_PP_REPEAT_1_319(m, d) m(2, 319, d)
+# define BOOST_PP_REPEAT_1_321(m, d) BOOST_PP_REPEAT_1_320(m, d) m(2, 320, d)
+# define BOOST_PP_REPEAT_1_322(m, d) BOOST_PP_REPEAT_1_321(m, d) m(2, 321, d)
+# define BOOST_PP_REPEAT_1_323(m, d) BOOST_PP_REPEAT_1_322(m, d) m(2, 322, d)
+# define BOOST_PP_REPEAT_1_324(m, d) BOOST_PP_REPEAT_1_323(m, d) m(2, 323, d)
+# define BOOST_PP_REPEAT_1_325(m, d) BOOST_PP_REPEAT_1_324(m, d) m(2, 324, d)
+# define BOOST_PP_REPEAT_1_326(m, d) BOOST_PP_REPEAT_1_325(m, d) m(2, 325, d)
+# define BOOST_PP_REPEAT_1_327(m, d) BOOST_PP_REPEAT_1_326(m, d) m(2, 326, d)
+# define BOOST_PP_REPEAT_1_328(m, d) BOOST_PP_REPEAT_1_327(m, d) m(2, 327, d)
+# define BOOST_PP_REPEAT_1_329(m, d) BOOST_PP_REPEAT_1_328(m, d) m(2, 328, d)
+# define BOOST_PP_REPEAT_1_330(m, d) BOOST_PP_REPEAT_1_329(m, d) m(2, 329, d)
+# define BOOST_PP_REPEAT_1_331(m, d) BOOST_PP_REPEAT_1_330(m, d) m(2, 330, d)
+# define BOOST_PP_REPEAT_1_332(m, d) BOOST_PP_REPEAT_1_331(m, d) m(2, 331, d)
+# define BOOST_PP_REPEAT_1_333(m, d) BOOST_PP_REPEAT_1_332(m, d) m(2, 332, d)
+# define BOOST_PP_REPEAT_1_334(m, d) BOOST_PP_REPEAT_1_333(m, d) m(2, 333, d)
+# define BOOST_PP_REPEAT_1_335(m, d) BOOST_PP_REPEAT_1_334(m, d) m(2, 334, d)
+# define BOOST_PP_REPEAT_1_336(m, d) BOOST_PP_REPEAT_1_335(m, d) m(2, 335, d)
+# define BOOST_PP_REPEAT_1_337(m, d) BOOST_PP_REPEAT_1_336(m, d) m(2, 336, d)
+# define BOOST_PP_REPEAT_1_338(m, d) BOOST_PP_REPEAT_1_337(m, d) m(2, 337, d)
+# define BOOST_PP_REPEAT_1_339(m, d) BOOST_PP_REPEAT_1_338(m, d) m(2, 338, d)
+# define BOOST_PP_REPEAT_1_340(m, d) BOOST_PP_REPEAT_1_339(m, d) m(2, 339, d)
+# define BOOST_PP_REPEAT_1_341(m, d) BOOST_PP_REPEAT_1_340(m, d) m(2, 340, d)
+# define BOOST_PP_REPEAT_1_342(m, d) BOOST_PP_REPEAT_1_341(m, d) m(2, 341, d)
+# define BOOST_PP_REPEAT_1_343(m, d) BOOST_PP_REPEAT_1_342(m, d) m(2, 342, d)
+# define BOOST_PP_REPEAT_1_344(m, d) BOOST_PP_REPEAT_1_343(m, d) m(2, 343, d)
+# define BOOST_PP_REPEAT_1_345(m, d) BOOST_PP_REPEAT_1_344(m, d) m(2, 344, d)
+# define BOOST_PP_REPEAT_1_346(m, d) BOOST_PP_REPEAT_1_345(m, d) m(2, 345, d)
+# define BOOST_PP_REPEAT_1_347(m, d) BOOST_PP_REPEAT_1_346(m, d) m(2, 346, d)
+# define BOOST_PP_REPEAT_1_348(m, d) BOOST_PP_REPEAT_1_347(m, d) m(2, 347, d)
+# define BOOST_PP_REPEAT_1_349(m, d) BOOST_PP_REPEAT_1_348(m, d) m(2, 348, d)
+# define BOOST_PP_REPEAT_1_350(m, d) BOOST_PP_REPEAT_1_349(m, d) m(2, 349, d)
+# define BOOST_PP_REPEAT_1_351(m, d) BOOST_PP_REPEAT_1_350(m, d) m(2, 350, d)
+# define BOOST_PP_REPEAT_1_352(m, d) BOOST_PP_REPEAT_1_351(m, d) m(2, 351, d)
+# define BOOST_PP_REPEAT_1_353(m, d) BOOST_PP_REPEAT_1_352(m, d) m(2, 352, d)
+# define BOOST_PP_REPEAT_1_354(m, d) BOOST_PP_REPEAT_1_353(m, d) m(2, 353, d)
+# define BOOST_PP_REPEAT_1_355(m, d) BOOST_PP_REPEAT_1_354(m, d) m(2, 354, d)
+# define BOOST_PP_REPEAT_1_356(m, d) BOOST_PP_REPEAT_1_355(m, d) m(2, 355, d)
+# define BOOST_PP_REPEAT_1_357(m, d) BOOST_PP_REPEAT_1_356(m, d) m(2, 356, d)
+# define BOOST_PP_REPEAT_1_358(m, d) BOOST_PP_REPEAT_1_357(m, d) m(2, 357, d)
+# define BOOST_PP_REPEAT_1_359(m, d) BOOST_PP_REPEAT_1_358(m, d) m(2, 358, d)
+# define BOOST_PP_REPEAT_1_360(m, d) BOOST_PP_REPEAT_1_359(m, d) m(2, 359, d)
+# define BOOST_PP_REPEAT_1_361(m, d) BOOST_PP_REPEAT_1_360(m, d) m(2, 360, d)
+# define BOOST_PP_REPEAT_1_362(m, d) BOOST_PP_REPEAT_1_361(m, d) m(2, 361, d)
+# define BOOST_PP_REPEAT_1_363(m, d) BOOST_PP_REPEAT_1_362(m, d) m(2, 362, d)
+# define BOOST_PP_REPEAT_1_364(m, d) BOOST_PP_REPEAT_1_363(m, d) m(2, 363, d)
+# define BOOST_PP_REPEAT_1_365(m, d) BOOST_PP_REPEAT_1_364(m, d) m(2, 364, d)
+# define BOOST_PP_REPEAT_1_366(m, d) BOOST_PP_REPEAT_1_365(m, d) m(2, 365, d)
+# define BOOST_PP_REPEAT_1_367(m, d) BOOST_PP_REPEAT_1_366(m, d) m(2, 366, d)
+# define BOOST_PP_REPEAT_1_368(m, d) BOOST_PP_REPEAT_1_367(m, d) m(2, 367, d)
+# define BOOST_PP_REPEAT_1_369(m, d) BOOST_PP_REPEAT_1_368(m, d) m(2, 368, d)
+# define BOOST_PP_REPEAT_1_370(m, d) BOOST_PP_REPEAT_1_369(m, d) m(2, 369, d)
+# define BOOST_PP_REPEAT_1_371(m, d) BOOST_PP_REPEAT_1_370(m, d) m(2, 370, d)
+# define BOOST_PP_REPEAT_1_372(m, d) BOOST_PP_REPEAT_1_371(m, d) m(2, 371, d)
+# define BOOST_PP_REPEAT_1_373(m, d) BOOST_PP_REPEAT_1_372(m, d) m(2, 372, d)
+# define BOOST_PP_REPEAT_1_374(m, d) BOOST_PP_REPEAT_1_373(m, d) m(2, 373, d)
+# define BOOST_PP_REPEAT_1_375(m, d) BOOST_PP_REPEAT_1_374(m, d) m(2, 374, d)
+# define BOOST_PP_REPEAT_1_376(m, d) BOOST_PP_REPEAT_1_375(m, d) m(2, 375, d)
+# define BOOST_PP_REPEAT_1_377(m, d) BOOST_PP_REPEAT_1_376(m, d) m(2, 376, d)
+# define BOOST_PP_REPEAT_1_378(m, d) BOOST_PP_REPEAT_1_377(m, d) m(2, 377, d)
+# define BOOST_PP_REPEAT_1_379(m, d) BOOST_PP_REPEAT_1_378(m, d) m(2, 378, d)
+# define BOOST_PP_REPEAT_1_380(m, d) BOOST_PP_REPEAT_1_379(m, d) m(2, 379, d)
+# define BOOST_PP_REPEAT_1_381(m, d) BOOST_PP_REPEAT_1_380(m, d) m(2, 380, d)
+# define BOOST_PP_REPEAT_1_382(m, d) BOOST_PP_REPEAT_1_381(m, d) m(2, 381, d)
+# define BOOST_PP_REPEAT_1_383(m, d) BOOST_PP_REPEAT_1_382(m, d) m(2, 382, d)
+# define BOOST_PP_REPEAT_1_384(m, d) BOOST_PP_REPEAT_1_383(m, d) m(2, 383, d)
+# define BOOST_PP_REPEAT_1_385(m, d) BOOST_PP_REPEAT_1_384(m, d) m(2, 384, d)
+# define BOOST_PP_REPEAT_1_386(m, d) BOOST_PP_REPEAT_1_385(m, d) m(2, 385, d)
+# define BOOST_PP_REPEAT_1_387(m, d) BOOST_PP_REPEAT_1_386(m, d) m(2, 386, d)
+# define BOOST_PP_REPEAT_1_388(m, d) BOOST_PP_REPEAT_1_387(m, d) m(2, 387, d)
+# define BOOST_PP_REPEAT_1_389(m, d) BOOST_PP_REPEAT_1_388(m, d) m(2, 388, d)
+# define BOOST_PP_REPEAT_1_390(m, d) BOOST_PP_REPEAT_1_389(m, d) m(2, 389, d)
+# define BOOST_PP_REPEAT_1_391(m, d) BOOST_PP_REPEAT_1_390(m, d) m(2, 390, d)
+# define BOOST_PP_REPEAT_1_392(m, d) BOOST_PP_REPEAT_1_391(m, d) m(2, 391, d)
+# define BOOST_PP_REPEAT_1_393(m, d) BOOST_PP_REPEAT_1_392(m, d) m(2, 392, d)
+# define BOOST_PP_REPEAT_1_394(m, d) BOOST_PP_REPEAT_1_393(m, d) m(2, 393, d)
+# define BOOST_PP_REPEAT_1_395(m, d) BOOST_PP_REPEAT_1_394(m, d) m(2, 394, d)
+# define BOOST_PP_REPEAT_1_396(m, d) BOOST_PP_REPEAT_1_395(m, d) m(2, 395, d)
+# define BOOST_PP_REPEAT_1_397(m, d) BOOST_PP_REPEAT_1_396(m, d) m(2, 396, d)
+# define BOOST_PP_REPEAT_1_398(m, d) BOOST_PP_REPEAT_1_397(m, d) m(2, 397, d)
+# define BOOST_PP_REPEAT_1_399(m, d) BOOST_PP_REPEAT_1_398(m, d) m(2, 398, d)
+# define BOOST_PP_REPEAT_1_400(m, d) BOOST_PP_REPEAT_1_399(m, d) m(2, 399, d)
+# define BOOST_PP_REPEAT_1_401(m, d) BOOST_PP_REPEAT_1_400(m, d) m(2, 400, d)
+# define BOOST_PP_REPEAT_1_402(m, d) BOOST_PP_REPEAT_1_401(m, d) m(2, 401, d)
+# define BOOST_PP_REPEAT_1_403(m, d) BOOST_PP_REPEAT_1_402(m, d) m(2, 402, d)
+# define BOOST_PP_REPEAT_1_404(m, d) BOOST_PP_REPEAT_1_403(m, d) m(2, 403, d)
+# define BOOST_PP_REPEAT_1_405(m, d) BOOST_PP_REPEAT_1_404(m, d) m(2, 404, d)
+# define BOOST_PP_REPEAT_1_406(m, d) BOOST_PP_REPEAT_1_405(m, d) m(2, 405, d)
+# define BOOST_PP_REPEAT_1_407(m, d) BOOST_PP_REPEAT_1_406(m, d) m(2, 406, d)
+# define BOOST_PP_REPEAT_1_408(m, d) BOOST_PP_REPEAT_1_407(m, d) m(2, 407, d)
+# define BOOST_PP_REPEAT_1_409(m, d) BOOST_PP_REPEAT_1_408(m, d) m(2, 408, d)
+# define BOOST_PP_REPEAT_1_410(m, d) BOOST_PP_REPEAT_1_409(m, d) m(2, 409, d)
+# define BOOST_PP_REPEAT_1_411(m, d) BOOST_PP_REPEAT_1_410(m, d) m(2, 410, d)
+# define BOOST_PP_REPEAT_1_412(m, d) BOOST_PP_REPEAT_1_411(m, d) m(2, 411, d)
+# define BOOST_PP_REPEAT_1_413(m, d) BOOST_PP_REPEAT_1_412(m, d) m(2, 412, d)
+# define BOOST_PP_REPEAT_1_414(m, d) BOOST_PP_REPEAT_1_413(m, d) m(2, 413, d)
+# define BOOST_PP_REPEAT_1_415(m, d) BOOST_PP_REPEAT_1_414(m, d) m(2, 414, d)
+# define BOOST_PP_REPEAT_1_416(m, d) BOOST_PP_REPEAT_1_415(m, d) m(2, 415, d)
+# define BOOST_PP_REPEAT_1_417(m, d) BOOST_PP_REPEAT_1_416(m, d) m(2, 416, d)
+# define BOOST_PP_REPEAT_1_418(m, d) BOOST_PP_REPEAT_1_417(m, d) m(2, 417, d)
+# define BOOST_PP_REPEAT_1_419(m, d) BOOST_PP_REPEAT_1_418(m, d) m(2, 418, d)
+# define BOOST_PP_REPEAT_1_420(m, d) BOOST_PP_REPEAT_1_419(m, d) m(2, 419, d)
+# define BOOST_PP_REPEAT_1_421(m, d) BOOST_PP_REPEAT_1_420(m, d) m(2, 420, d)
+# define BOOST_PP_REPEAT_1_422(m, d) BOOST_PP_REPEAT_1_421(m, d) m(2, 421, d)
+# define BOOST_PP_REPEAT_1_423(m, d) BOOST_PP_REPEAT_1_422(m, d) m(2, 422, d)
+# define BOOST_PP_REPEAT_1_424(m, d) BOOST_PP_REPEAT_1_423(m, d) m(2, 423, d)
+# define BOOST_PP_REPEAT_1_425(m, d) BOOST_PP_REPEAT_1_424(m, d) m(2, 424, d)
+# define BOOST_PP_REPEAT_1_426(m, d) BOOST_PP_REPEAT_1_425(m, d) m(2, 425, d)
+# define BOOST_PP_REPEAT_1_427(m, d) BOOST_PP_REPEAT_1_426(m, d) m(2, 426, d)
+# define BOOST_PP_REPEAT_1_428(m, d) BOOST_PP_REPEAT_1_427(m, d) m(2, 427, d)
+# define BOOST_PP_REPEAT_1_429(m, d) BOOST_PP_REPEAT_1_428(m, d) m(2, 428, d)
+# define BOOST_PP_REPEAT_1_430(m, d) BOOST_PP_REPEAT_1_429(m, d) m(2, 429, d)
+# define BOOST_PP_REPEAT_1_431(m, d) BOOST_PP_REPEAT_1_430(m, d) m(2, 430, d)
+# define BOOST_PP_REPEAT_1_432(m, d) BOOST_PP_REPEAT_1_431(m, d) m(2, 431, d)
+# define BOOST_PP_REPEAT_1_433(m, d) BOOST_PP_REPEAT_1_432(m, d) m(2, 432, d)
+# define BOOST_PP_REPEAT_1_434(m, d) BOOST_PP_REPEAT_1_433(m, d) m(2, 433, d)
+# define BOOST_PP_REPEAT_1_435(m, d) BOOST_PP_REPEAT_1_434(m, d) m(2, 434, d)
+# define BOOST_PP_REPEAT_1_436(m, d) BOOST_PP_REPEAT_1_435(m, d) m(2, 435, d)
+# define BOOST_PP_REPEAT_1_437(m, d) BOOST_PP_REPEAT_1_436(m, d) m(2, 436, d)
+# define BOOST_PP_REPEAT_1_438(m, d) BOOST_PP_REPEAT_1_437(m, d) m(2, 437, d)
+# define BOOST_PP_REPEAT_1_439(m, d) BOOST_PP_REPEAT_1_438(m, d) m(2, 438, d)
+# define BOOST_PP_REPEAT_1_440(m, d) BOOST_PP_REPEAT_1_439(m, d) m(2, 439, d)
+# define BOOST_PP_REPEAT_1_441(m, d) BOOST_PP_REPEAT_1_440(m, d) m(2, 440, d)
+# define BOOST_PP_REPEAT_1_442(m, d) BOOST_PP_REPEAT_1_441(m, d) m(2, 441, d)
+# define BOOST_PP_REPEAT_1_443(m, d) BOOST_PP_REPEAT_1_442(m, d) m(2, 442, d)
+# define BOOST_PP_REPEAT_1_444(m, d) BOOST_PP_REPEAT_1_443(m, d) m(2, 443, d)
+# define BOOST_PP_REPEAT_1_445(m, d) BOOST_PP_REPEAT_1_444(m, d) m(2, 444, d)
+# define BOOST_PP_REPEAT_1_446(m, d) BOOST_PP_REPEAT_1_445(m, d) m(2, 445, d)
+# define BOOST_PP_REPEAT_1_447(m, d) BOOST_PP_REPEAT_1_446(m, d) m(2, 446, d)
+# define BOOST_PP_REPEAT_1_448(m, d) BOOST_PP_REPEAT_1_447(m, d) m(2, 447, d)
+# define BOOST_PP_REPEAT_1_449(m, d) BOOST_PP_REPEAT_1_448(m, d) m(2, 448, d)
+# define BOOST_PP_REPEAT_1_450(m, d) BOOST_PP_REPEAT_1_449(m, d) m(2, 449, d)
+# define BOOST_PP_REPEAT_1_451(m, d) BOOST_PP_REPEAT_1_450(m, d) m(2, 450, d)
+# define BOOST_PP_REPEAT_1_452(m, d) BOOST_PP_REPEAT_1_451(m, d) m(2, 451, d)
+# define BOOST_PP_REPEAT_1_453(m, d) BOOST_PP_REPEAT_1_452(m, d) m(2, 452, d)
+# define BOOST_PP_REPEAT_1_454(m, d) BOOST_PP_REPEAT_1_453(m, d) m(2, 453, d)
+# define BOOST_PP_REPEAT_1_455(m, d) BOOST_PP_REPEAT_1_454(m, d) m(2, 454, d)
+# define BOOST_PP_REPEAT_1_456(m, d) BOOST_PP_REPEAT_1_455(m, d) m(2, 455, d)
+# define BOOST_PP_REPEAT_1_457(m, d) BOOST_PP_REPEAT_1_456(m, d) m(2, 456, d)
+# define BOOST_PP_REPEAT_1_458(m, d) BOOST_PP_REPEAT_1_457(m, d) m(2, 457, d)
+# define BOOST_PP_REPEAT_1_459(m, d) BOOST_PP_REPEAT_1_458(m, d) m(2, 458, d)
+# define BOOST_PP_REPEAT_1_460(m, d) BOOST_PP_REPEAT_1_459(m, d) m(2, 459, d)
+# define BOOST_PP_REPEAT_1_461(m, d) BOOST_PP_REPEAT_1_460(m, d) m(2, 460, d)
+# define BOOST_PP_REPEAT_1_462(m, d) BOOST_PP_REPEAT_1_461(m, d) m(2, 461, d)
+# define BOOST_PP_REPEAT_1_463(m, d) BOOST_PP_REPEAT_1_462(m, d) m(2, 462, d)
+# define BOOST_PP_REPEAT_1_464(m, d) BOOST_PP_REPEAT_1_463(m, d) m(2, 463, d)
+# define BOOST_PP_REPEAT_1_465(m, d) BOOST_PP_REPEAT_1_464(m, d) m(2, 464, d)
+# define BOOST_PP_REPEAT_1_466(m, d) BOOST_PP_REPEAT_1_465(m, d) m(2, 465, d)
+# define BOOST_PP_REPEAT_1_467(m, d) BOOST_PP_REPEAT_1_466(m, d) m(2, 466, d)
+# define BOOST_PP_REPEAT_1_468(m, d) BOOST_PP_REPEAT_1_467(m, d) m(2, 467, d)
+# define BOOST_PP_REPEAT_1_469(m, d) BOOST_PP_REPEAT_1_468(m, d) m(2, 468, d)
+# define BOOST_PP_REPEAT_1_470(m, d) BOOST_PP_REPEAT_1_469(m, d) m(2, 469, d)
+# define BOOST_PP_REPEAT_1_471(m, d) BOOST_PP_REPEAT_1_470(m, d) m(2, 470, d)
+# define BOOST_PP_REPEAT_1_472(m, d) BOOST_PP_REPEAT_1_471(m, d) m(2, 471, d)
+# define BOOST_PP_REPEAT_1_473(m, d) BOOST_PP_REPEAT_1_472(m, d) m(2, 472, d)
+# define BOOST_PP_REPEAT_1_474(m, d) BOOST_PP_REPEAT_1_473(m, d) m(2, 473, d)
+# define BOOST_PP_REPEAT_1_475(m, d) BOOST_PP_REPEAT_1_474(m, d) m(2, 474, d)
+# define BOOST_PP_REPEAT_1_476(m, d) BOOST_PP_REPEAT_1_475(m, d) m(2, 475, d)
+# define BOOST_PP_REPEAT_1_477(m, d) BOOST_PP_REPEAT_1_476(m, d) m(2, 476, d)
+# define BOOST_PP_REPEAT_1_478(m, d) BOOST_PP_REPEAT_1_477(m, d) m(2, 477, d)
+# define BOOST_PP_REPEAT_1_479(m, d) BOOST_PP_REPEAT_1_478(m, d) m(2, 478, d)
+# define BOOST_PP_REPEAT_1_480(m, d) BOOST_PP_REPEAT_1_479(m, d) m(2, 479, d)
+# define BOOST_PP_REPEAT_1_481(m, d) BOOST_PP_REPEAT_1_480(m, d) m(2, 480, d)
+# define BOOST_PP_REPEAT_1_482(m, d) BOOST_PP_REPEAT_1_481(m, d) m(2, 481, d)
+# define BOOST_PP_REPEAT_1_483(m, d) BOOST_PP_REPEAT_1_482(m, d) m(2, 482, d)
+# define BOOST_PP_REPEAT_1_484(m, d) BOOST_PP_REPEAT_1_483(m, d) m(2, 483, d)
+# define BOOST_PP_REPEAT_1_485(m, d) BOOST_PP_REPEAT_1_484(m, d) m(2, 484, d)
+# define BOOST_PP_REPEAT_1_486(m, d) BOOST_PP_REPEAT_1_485(m, d) m(2, 485, d)
+# define BOOST_PP_REPEAT_1_487(m, d) BOOST_PP_REPEAT_1_486(m, d) m(2, 486, d)
+# define BOOST_PP_REPEAT_1_488(m, d) BOOST_PP_REPEAT_1_487(m, d) m(2, 487, d)
+# define BOOST_PP_REPEAT_1_489(m, d) BOOST_PP_REPEAT_1_488(m, d) m(2, 488, d)
+# define BOOST_PP_REPEAT_1_490(m, d) BOOST_PP_REPEAT_1_489(m, d) m(2, 489, d)
+# define BOOST_PP_REPEAT_1_491(m, d) BOOST_PP_REPEAT_1_490(m, d) m(2, 490, d)
+# define BOOST_PP_REPEAT_1_492(m, d) BOOST_PP_REPEAT_1_491(m, d) m(2, 491, d)
+# define BOOST_PP_REPEAT_1_493(m, d) BOOST_PP_REPEAT_1_492(m, d) m(2, 492, d)
+# define BOOST_PP_REPEAT_1_494(m, d) BOOST_PP_REPEAT_1_493(m, d) m(2, 493, d)
+# define BOOST_PP_REPEAT_1_495(m, d) BOOST_PP_REPEAT_1_494(m, d) m(2, 494, d)
+# define BOOST_PP_REPEAT_1_496(m, d) BOOST_PP_REPEAT_1_495(m, d) m(2, 495, d)
+# define BOOST_PP_REPEAT_1_497(m, d) BOOST_PP_REPEAT_1_496(m, d) m(2, 496, d)
+# define BOOST_PP_REPEAT_1_498(m, d) BOOST_PP_REPEAT_1_497(m, d) m(2, 497, d)
+# define BOOST_PP_REPEAT_1_499(m, d) BOOST_PP_REPEAT_1_498(m, d) m(2, 498, d)
+# define BOOST_PP_REPEAT_1_500(m, d) BOOST_PP_REPEAT_1_499(m, d) m(2, 499, d)
+# define BOOST_PP_REPEAT_1_501(m, d) BOOST_PP_REPEAT_1_500(m, d) m(2, 500, d)
+# define BOOST_PP_REPEAT_1_502(m, d) BOOST_PP_REPEAT_1_501(m, d) m(2, 501, d)
+# define BOOST_PP_REPEAT_1_503(m, d) BOOST_PP_REPEAT_1_502(m, d) m(2, 502, d)
+# define BOOST_PP_REPEAT_1_504(m, d) BOOST_PP_REPEAT_1_503(m, d) m(2, 503, d)
+# define BOOST_PP_REPEAT_1_505(m, d) BOOST_PP_REPEAT_1_504(m, d) m(2, 504, d)
+# define BOOST_PP_REPEAT_1_506(m, d) BOOST_PP_REPEAT_1_505(m, d) m(2, 505, d)
+# define BOOST_PP_REPEAT_1_507(m, d) BOOST_PP_REPEAT_1_506(m, d) m(2, 506, d)
+# define BOOST_PP_REPEAT_1_508(m, d) BOOST_PP_REPEAT_1_507(m, d) m(2, 507, d)
+# define BOOST_PP_REPEAT_1_509(m, d) BOOST_PP_REPEAT_1_508(m, d) m(2, 508, d)
+# define BOOST_PP_REPEAT_1_510(m, d) BOOST_PP_REPEAT_1_509(m, d) m(2, 509, d)
+# define BOOST_PP_REPEAT_1_511(m, d) BOOST_PP_REPEAT_1_510(m, d) m(2, 510, d)
+# define BOOST_PP_REPEAT_1_512(m, d) BOOST_PP_REPEAT_1_511(m, d) m(2, 511, d)
+#
+# define BOOST_PP_REPEAT_2_257(m, d) BOOST_PP_REPEAT_2_256(m, d) m(3, 256, d)
+# define BOOST_PP_REPEAT_2_258(m, d) BOOST_PP_REPEAT_2_257(m, d) m(3, 257, d)
+# define BOOST_PP_REPEAT_2_259(m, d) BOOST_PP_REPEAT_2_258(m, d) m(3, 258, d)
+# define BOOST_PP_REPEAT_2_260(m, d) BOOST_PP_REPEAT_2_259(m, d) m(3, 259, d)
+# define BOOST_PP_REPEAT_2_261(m, d) BOOST_PP_REPEAT_2_260(m, d) m(3, 260, d)
+# define BOOST_PP_REPEAT_2_262(m, d) BOOST_PP_REPEAT_2_261(m, d) m(3, 261, d)
+# define BOOST_PP_REPEAT_2_263(m, d) BOOST_PP_REPEAT_2_262(m, d) m(3, 262, d)
+# define BOOST_PP_REPEAT_2_264(m, d) BOOST_PP_REPEAT_2_263(m, d) m(3, 263, d)
+# define BOOST_PP_REPEAT_2_265(m, d) BOOST_PP_REPEAT_2_264(m, d) m(3, 264, d)
+# define BOOST_PP_REPEAT_2_266(m, d) BOOST_PP_REPEAT_2_265(m, d) m(3, 265, d)
+# define BOOST_PP_REPEAT_2_267(m, d) BOOST_PP_REPEAT_2_266(m, d) m(3, 266, d)
+# define BOOST_PP_REPEAT_2_268(m, d) BOOST_PP_REPEAT_2_267(m, d) m(3, 267, d)
+# define BOOST_PP_REPEAT_2_269(m, d) BOOST_PP_REPEAT_2_268(m, d) m(3, 268, d)
+# define BOOST_PP_REPEAT_2_270(m, d) BOOST_PP_REPEAT_2_269(m, d) m(3, 269, d)
+# define BOOST_PP_REPEAT_2_271(m, d) BOOST_PP_REPEAT_2_270(m, d) m(3, 270, d)
+# define BOOST_PP_REPEAT_2_272(m, d) BOOST_PP_REPEAT_2_271(m, d) m(3, 271, d)
+# define BOOST_PP_REPEAT_2_273(m, d) BOOST_PP_REPEAT_2_272(m, d) m(3, 272, d)
+# define BOOST_PP_REPEAT_2_274(m, d) BOOST_PP_REPEAT_2_273(m, d) m(3, 273, d)
+# define BOOST_PP_REPEAT_2_275(m, d) BOOST_PP_REPEAT_2_274(m, d) m(3, 274, d)
+# define BOOST_PP_REPEAT_2_276(m, d) BOOST_PP_REPEAT_2_275(m, d) m(3, 275, d)
+# define BOOST_PP_REPEAT_2_277(m, d) BOOST_PP_REPEAT_2_276(m, d) m(3, 276, d)
+# define BOOST_PP_REPEAT_2_278(m, d) BOOST_PP_REPEAT_2_277(m, d) m(3, 277, d)
+# define BOOST_PP_REPEAT_2_279(m, d) BOOST_PP_REPEAT_2_278(m, d) m(3, 278, d)
+# define BOOST_PP_REPEAT_2_280(m, d) BOOST_PP_REPEAT_2_279(m, d) m(3, 279, d)
+# define BOOST_PP_REPEAT_2_281(m, d) BOOST_PP_REPEAT_2_280(m, d) m(3, 280, d)
+# define BOOST_PP_REPEAT_2_282(m, d) BOOST_PP_REPEAT_2_281(m, d) m(3, 281, d)
+# define BOOST_PP_REPEAT_2_283(m, d) BOOST_PP_REPEAT_2_282(m, d) m(3, 282, d)
+# define BOOST_PP_REPEAT_2_284(m, d) BOOST_PP_REPEAT_2_283(m, d) m(3, 283, d)
+# define BOOST_PP_REPEAT_2_285(m, d) BOOST_PP_REPEAT_2_284(m, d) m(3, 284, d)
+# define BOOST_PP_REPEAT_2_286(m, d) BOOST_PP_REPEAT_2_285(m, d) m(3, 285, d)
+# define BOOST_PP_REPEAT_2_287(m, d) BOOST_PP_REPEAT_2_286(m, d) m(3, 286, d)
+# define BOOST_PP_REPEAT_2_288(m, d) BOOST_PP_REPEAT_2_287(m, d) m(3, 287, d)
+# define BOOST_PP_REPEAT_2_289(m, d) BOOST_PP_REPEAT_2_288(m, d) m(3, 288, d)
+# define BOOST_PP_REPEAT_2_290(m, d) BOOST_PP_REPEAT_2_289(m, d) m(3, 289, d)
+# define BOOST_PP_REPEAT_2_291(m, d) BOOST_PP_REPEAT_2_290(m, d) m(3, 290, d)
+# define BOOST_PP_REPEAT_2_292(m, d) BOOST_PP_REPEAT_2_291(m, d) m(3, 291, d)
+# define BOOST_PP_REPEAT_2_293(m, d) BOOST_PP_REPEAT_2_292(m, d) m(3, 292, d)
+# define BOOST_PP_REPEAT_2_294(m, d) BOOST_PP_REPEAT_2_293(m, d) m(3, 293, d)
+# define BOOST_PP_REPEAT_2_295(m, d) BOOST_PP_REPEAT_2_294(m, d) m(3, 294, d)
+# define BOOST_PP_REPEAT_2_296(m, d) BOOST_PP_REPEAT_2_295(m, d) m(3, 295, d)
+# define BOOST_PP_REPEAT_2_297(m, d) BOOST_PP_REPEAT_2_296(m, d) m(3, 296, d)
+# define BOOST_PP_REPEAT_2_298(m, d) BOOST_PP_REPEAT_2_297(m, d) m(3, 297, d)
+# define BOOST_PP_REPEAT_2_299(m, d) BOOST_PP_REPEAT_2_298(m, d) m(3, 298, d)
+# define BOOST_PP_REPEAT_2_300(m, d) BOOST_PP_REPEAT_2_299(m, d) m(3, 299, d)
+# define BOOST_PP_REPEAT_2_301(m, d) BOOST_PP_REPEAT_2_300(m, d) m(3, 300, d)
+# define BOOST_PP_REPEAT_2_302(m, d) BOOST_PP_REPEAT_2_301(m, d) m(3, 301, d)
+# define BOOST_PP_REPEAT_2_303(m, d) BOOST_PP_REPEAT_2_302(m, d) m(3, 302, d)
+# define BOOST_PP_REPEAT_2_304(m, d) BOOST_PP_REPEAT_2_303(m, d) m(3, 303, d)
+# define BOOST_PP_REPEAT_2_305(m, d) BOOST_PP_REPEAT_2_304(m, d) m(3, 304, d)
+# define BOOST_PP_REPEAT_2_306(m, d) BOOST_PP_REPEAT_2_305(m, d) m(3, 305, d)
+# define BOOST_PP_REPEAT_2_307(m, d) BOOST_PP_REPEAT_2_306(m, d) m(3, 306, d)
+# define BOOST_PP_REPEAT_2_308(m, d) BOOST_PP_REPEAT_2_307(m, d) m(3, 307, d)
+# define BOOST_PP_REPEAT_2_309(m, d) BOOST_PP_REPEAT_2_308(m, d) m(3, 308, d)
+# define BOOST_PP_REPEAT_2_310(m, d) BOOST_PP_REPEAT_2_309(m, d) m(3, 309, d)
+# define BOOST_PP_REPEAT_2_311(m, d) BOOST_PP_REPEAT_2_310(m, d) m(3, 310, d)
+# define BOOST_PP_REPEAT_2_312(m, d) BOOST_PP_REPEAT_2_311(m, d) m(3, 311, d)
+# define BOOST_PP_REPEAT_2_313(m, d) BOOST_PP_REPEAT_2_312(m, d) m(3, 312, d)
+# define BOOST_PP_REPEAT_2_314(m, d) BOOST_PP_REPEAT_2_313(m, d) m(3, 313, d)
+# define BOOST_PP_REPEAT_2_315(m, d) BOOST_PP_REPEAT_2_314(m, d) m(3, 314, d)
+# define BOOST_PP_REPEAT_2_316(m, d) BOOST_PP_REPEAT_2_315(m, d) m(3, 315, d)
+# define BOOST_PP_REPEAT_2_317(m, d) BOOST_PP_REPEAT_2_316(m, d) m(3, 316, d)
+# define BOOST_PP_REPEAT_2_318(m, d) BOOST_PP_REPEAT_2_317(m, d) m(3, 317, d)
+# define BOOST_PP_REPEAT_2_319(m, d) BOOST_PP_REPEAT_2_318(m, d) m(3, 318, d)
+# define BOOST_PP_REPEAT_2_320(m, d) BOOST_PP_REPEAT_2_319(m, d) m(3, 319, d)
+# define BOOST_PP_REPEAT_2_321(m, d) BOOST_PP_REPEAT_2_320(m, d) m(3, 320, d)
+# define BOOST_PP_REPEAT_2_322(m, d) BOOST_PP_REPEAT_2_321(m, d) m(3, 321, d)
+# define BOOST_PP_REPEAT_2_323(m, d) BOOST_PP_REPEAT_2_322(m, d) m(3, 322, d)
+# define BOOST_PP_REPEAT_2_324(m, d) BOOST_PP_REPEAT_2_323(m, d) m(3, 323, d)
+# define BOOST_PP_REPEAT_2_325(m, d) BOOST_PP_REPEAT_2_324(m, d) m(3, 324, d)
+# define BOOST_PP_REPEAT_2_326(m, d) BOOST_PP_REPEAT_2_325(m, d) m(3, 325, d)
+# define BOOST_PP_REPEAT_2_327(m, d) BOOST_PP_REPEAT_2_326(m, d) m(3, 326, d)
+# define BOOST_PP_REPEAT_2_328(m, d) BOOST_PP_REPEAT_2_327(m, d) m(3, 327, d)
+# define BOOST_PP_REPEAT_2_329(m, d) BOOST_PP_REPEAT_2_328(m, d) m(3, 328, d)
+# define BOOST_PP_REPEAT_2_330(m, d) BOOST_PP_REPEAT_2_329(m, d) m(3, 329, d)
+# define BOOST_PP_REPEAT_2_331(m, d) BOOST_PP_REPEAT_2_330(m, d) m(3, 330, d)
+# define BOOST_PP_REPEAT_2_332(m, d) BOOST_PP_REPEAT_2_331(m, d) m(3, 331, d)
+# define BOOST_PP_REPEAT_2_333(m, d) BOOST_PP_REPEAT_2_332(m, d) m(3, 332, d)
+# define BOOST_PP_REPEAT_2_334(m, d) BOOST_PP_REPEAT_2_333(m, d) m(3, 333, d)
+# define BOOST_PP_REPEAT_2_335(m, d) BOOST_PP_REPEAT_2_334(m, d) m(3, 334, d)
+# define BOOST_PP_REPEAT_2_336(m, d) BOOST_PP_REPEAT_2_335(m, d) m(3, 335, d)
+# define BOOST_PP_REPEAT_2_337(m, d) BOOST_PP_REPEAT_2_336(m, d) m(3, 336, d)
+# define BOOST_PP_REPEAT_2_338(m, d) BOOST_PP_REPEAT_2_337(m, d) m(3, 337, d)
+# define BOOST_PP_REPEAT_2_339(m, d) BOOST_PP_REPEAT_2_338(m, d) m(3, 338, d)
+# define BOOST_PP_REPEAT_2_340(m, d) BOOST_PP_REPEAT_2_339(m, d) m(3, 339, d)
+# define BOOST_PP_REPEAT_2_341(m, d) BOOST_PP_REPEAT_2_340(m, d) m(3, 340, d)
+# define BOOST_PP_REPEAT_2_342(m, d) BOOST_PP_REPEAT_2_341(m, d) m(3, 341, d)
+# define BOOST_PP_REPEAT_2_343(m, d) BOOST_PP_REPEAT_2_342(m, d) m(3, 342, d)
+# define BOOST_PP_REPEAT_2_344(m, d) BOOST_PP_REPEAT_2_343(m, d) m(3, 343, d)
+# define BOOST_PP_REPEAT_2_345(m, d) BOOST_PP_REPEAT_2_344(m, d) m(3, 344, d)
+# define BOOST_PP_REPEAT_2_346(m, d) BOOST_PP_REPEAT_2_345(m, d) m(3, 345, d)
+# define BOOST_PP_REPEAT_2_347(m, d) BOOST_PP_REPEAT_2_346(m, d) m(3, 346, d)
+# define BOOST_PP_REPEAT_2_348(m, d) BOOST_PP_REPEAT_2_347(m, d) m(3, 347, d)
+# define BOOST_PP_REPEAT_2_349(m, d) BOOST_PP_REPEAT_2_348(m, d) m(3, 348, d)
+# define BOOST_PP_REPEAT_2_350(m, d) BOOST_PP_REPEAT_2_349(m, d) m(3, 349, d)
+# define BOOST_PP_REPEAT_2_351(m, d) BOOST_PP_REPEAT_2_350(m, d) m(3, 350, d)
+# define BOOST_PP_REPEAT_2_352(m, d) BOOST_PP_REPEAT_2_351(m, d) m(3, 351, d)
+# define BOOST_PP_REPEAT_2_353(m, d) BOOST_PP_REPEAT_2_352(m, d) m(3, 352, d)
+# define BOOST_PP_REPEAT_2_354(m, d) BOOST_PP_REPEAT_2_353(m, d) m(3, 353, d)
+# define BOOST_PP_REPEAT_2_355(m, d) BOOST_PP_REPEAT_2_354(m, d) m(3, 354, d)
+# define BOOST_PP_REPEAT_2_356(m, d) BOOST_PP_REPEAT_2_355(m, d) m(3, 355, d)
+# define BOOST_PP_REPEAT_2_357(m, d) BOOST_PP_REPEAT_2_356(m, d) m(3, 356, d)
+# define BOOST_PP_REPEAT_2_358(m, d) BOOST_PP_REPEAT_2_357(m, d) m(3, 357, d)
+# define BOOST_PP_REPEAT_2_359(m, d) BOOST_PP_REPEAT_2_358(m, d) m(3, 358, d)
+# define BOOST_PP_REPEAT_2_360(m, d) BOOST_PP_REPEAT_2_359(m, d) m(3, 359, d)
+# define BOOST_PP_REPEAT_2_361(m, d) BOOST_PP_REPEAT_2_360(m, d) m(3, 360, d)
+# define BOOST_PP_REPEAT_2_362(m, d) BOOST_PP_REPEAT_2_361(m, d) m(3, 361, d)
+# define BOOST_PP_REPEAT_2_363(m, d) BOOST_PP_REPEAT_2_362(m, d) m(3, 362, d)
+# define BOOST_PP_REPEAT_2_364(m, d) BOOST_PP_REPEAT_2_363(m, d) m(3, 363, d)
+# define BOOST_PP_REPEAT_2_365(m, d) BOOST_PP_REPEAT_2_364(m, d) m(3, 364, d)
+# define BOOST_PP_REPEAT_2_366(m, d) BOOST_PP_REPEAT_2_365(m, d) m(3, 365, d)
+# define BOOST_PP_REPEAT_2_367(m, d) BOOST_PP_REPEAT_2_366(m, d) m(3, 366, d)
+# define BOOST_PP_REPEAT_2_368(m, d) BOOST_PP_REPEAT_2_367(m, d) m(3, 367, d)
+# define BOOST_PP_REPEAT_2_369(m, d) BOOST_PP_REPEAT_2_368(m, d) m(3, 368, d)
+# define BOOST_PP_REPEAT_2_370(m, d) BOOST_PP_REPEAT_2_369(m, d) m(3, 369, d)
+# define BOOST_PP_REPEAT_2_371(m, d) BOOST_PP_REPEAT_2_370(m, d) m(3, 370, d)
+# define BOOST_PP_REPEAT_2_372(m, d) BOOST_PP_REPEAT_2_371(m, d) m(3, 371, d)
+# define BOOST_PP_REPEAT_2_373(m, d) BOOST_PP_REPEAT_2_372(m, d) m(3, 372, d)
+# define BOOST_PP_REPEAT_2_374(m, d) BOOST_PP_REPEAT_2_373(m, d) m(3, 373, d)
+# define BOOST_PP_REPEAT_2_375(m, d) BOOST_PP_REPEAT_2_374(m, d) m(3, 374, d)
+# define BOOST_PP_REPEAT_2_376(m, d) BOOST_PP_REPEAT_2_375(m, d) m(3, 375, d)
+# define BOOST_PP_REPEAT_2_377(m, d) BOOST_PP_REPEAT_2_376(m, d) m(3, 376, d)
+# define BOOST_PP_REPEAT_2_378(m, d) BOOST_PP_REPEAT_2_377(m, d) m(3, 377, d)
+# define BOOST_PP_REPEAT_2_379(m, d) BOOST_PP_REPEAT_2_378(m, d) m(3, 378, d)
+# define BOOST_PP_REPEAT_2_380(m, d) BOOST_PP_REPEAT_2_379(m, d) m(3, 379, d)
+# define BOOST_PP_REPEAT_2_381(m, d) BOOST_PP_REPEAT_2_380(m, d) m(3, 380, d)
+# define BOOST_PP_REPEAT_2_382(m, d) BOOST_PP_REPEAT_2_381(m, d) m(3, 381, d)
+# define BOOST_PP_REPEAT_2_383(m, d) BOOST_PP_REPEAT_2_382(m, d) m(3, 382, d)
+# define BOOST_PP_REPEAT_2_384(m, d) BOOST_PP_REPEAT_2_383(m, d) m(3, 383, d)
+# define BOOST_PP_REPEAT_2_385(m, d) BOOST_PP_REPEAT_2_384(m, d) m(3, 384, d)
+# define BOOST_PP_REPEAT_2_386(m, d) BOOST_PP_REPEAT_2_385(m, d) m(3, 385, d)
+# define BOOST_PP_REPEAT_2_387(m, d) BOOST_PP_REPEAT_2_386(m, d) m(3, 386, d)
+# define BOOST_PP_REPEAT_2_388(m, d) BOOST_PP_REPEAT_2_387(m, d) m(3, 387, d)
+# define BOOST_PP_REPEAT_2_389(m, d) BOOST_PP_REPEAT_2_388(m, d) m(3, 388, d)
+# define BOOST_PP_REPEAT_2_390(m, d) BOOST_PP_REPEAT_2_389(m, d) m(3, 389, d)
+# define BOOST_PP_REPEAT_2_391(m, d) BOOST_PP_REPEAT_2_390(m, d) m(3, 390, d)
+# define BOOST_PP_REPEAT_2_392(m, d) BOOST_PP_REPEAT_2_391(m, d) m(3, 391, d)
+# define BOOST_PP_REPEAT_2_393(m, d) BOOST_PP_REPEAT_2_392(m, d) m(3, 392, d)
+# define BOOST_PP_REPEAT_2_394(m, d) BOOST_PP_REPEAT_2_393(m, d) m(3, 393, d)
+# define BOOST_PP_REPEAT_2_395(m, d) BOOST_PP_REPEAT_2_394(m, d) m(3, 394, d)
+# define BOOST_PP_REPEAT_2_396(m, d) BOOST_PP_REPEAT_2_395(m, d) m(3, 395, d)
+# define BOOST_PP_REPEAT_2_397(m, d) BOOST_PP_REPEAT_2_396(m, d) m(3, 396, d)
+# define BOOST_PP_REPEAT_2_398(m, d) BOOST_PP_REPEAT_2_397(m, d) m(3, 397, d)
+# define BOOST_PP_REPEAT_2_399(m, d) BOOST_PP_REPEAT_2_398(m, d) m(3, 398, d)
+# define BOOST_PP_REPEAT_2_400(m, d) BOOST_PP_REPEAT_2_399(m, d) m(3, 399, d)
+# define BOOST_PP_REPEAT_2_401(m, d) BOOST_PP_REPEAT_2_400(m, d) m(3, 400, d)
+# define BOOST_PP_REPEAT_2_402(m, d) BOOST_PP_REPEAT_2_401(m, d) m(3, 401, d)
+# define BOOST_PP_REPEAT_2_403(m, d) BOOST_PP_REPEAT_2_402(m, d) m(3, 402, d)
+# define BOOST_PP_REPEAT_2_404(m, d) BOOST_PP_REPEAT_2_403(m, d) m(3, 403, d)
+# define BOOST_PP_REPEAT_2_405(m, d) BOOST_PP_REPEAT_2_404(m, d) m(3, 404, d)
+# define BOOST_PP_REPEAT_2_406(m, d) BOOST_PP_REPEAT_2_405(m, d) m(3, 405, d)
+# define BOOST_PP_REPEAT_2_407(m, d) BOOST_PP_REPEAT_2_406(m, d) m(3, 406, d)
+# define BOOST_PP_REPEAT_2_408(m, d) BOOST_PP_REPEAT_2_407(m, d) m(3, 407, d)
+# define BOOST_PP_REPEAT_2_409(m, d) BOOST_PP_REPEAT_2_408(m, d) m(3, 408, d)
+# define BOOST_PP_REPEAT_2_410(m, d) BOOST_PP_REPEAT_2_409(m, d) m(3, 409, d)
+# define BOOST_PP_REPEAT_2_411(m, d) BOOST_PP_REPEAT_2_410(m, d) m(3, 410, d)
+# define BOOST_PP_REPEAT_2_412(m, d) BOOST_PP_REPEAT_2_411(m, d) m(3, 411, d)
+# define BOOST_PP_REPEAT_2_413(m, d) BOOST_PP_REPEAT_2_412(m, d) m(3, 412, d)
+# define BOOST_PP_REPEAT_2_414(m, d) BOOST_PP_REPEAT_2_413(m, d) m(3, 413, d)
+# define BOOST_PP_REPEAT_2_415(m, d) BOOST_PP_REPEAT_2_414(m, d) m(3, 414, d)
+# define BOOST_PP_REPEAT_2_416(m, d) BOOST_PP_REPEAT_2_415(m, d) m(3, 415, d)
+# define BOOST_PP_REPEAT_2_417(m, d) BOOST_PP_REPEAT_2_416(m, d) m(3, 416, d)
+# define BOOST_PP_REPEAT_2_418(m, d) BOOST_PP_REPEAT_2_417(m, d) m(3, 417, d)
+# define BOOST_PP_REPEAT_2_419(m, d) BOOST_PP_REPEAT_2_418(m, d) m(3, 418, d)
+# define BOOST_PP_REPEAT_2_420(m, d) BOOST_PP_REPEAT_2_419(m, d) m(3, 419, d)
+# define BOOST_PP_REPEAT_2_421(m, d) BOOST_PP_REPEAT_2_420(m, d) m(3, 420, d)
+# define BOOST_PP_REPEAT_2_422(m, d) BOOST_PP_REPEAT_2_421(m, d) m(3, 421, d)
+# define BOOST_PP_REPEAT_2_423(m, d) BOOST_PP_REPEAT_2_422(m, d) m(3, 422, d)
+# define BOOST_PP_REPEAT_2_424(m, d) BOOST_PP_REPEAT_2_423(m, d) m(3, 423, d)
+# define BOOST_PP_REPEAT_2_425(m, d) BOOST_PP_REPEAT_2_424(m, d) m(3, 424, d)
+# define BOOST_PP_REPEAT_2_426(m, d) BOOST_PP_REPEAT_2_425(m, d) m(3, 425, d)
+# define BOOST_PP_REPEAT_2_427(m, d) BOOST_PP_REPEAT_2_426(m, d) m(3, 426, d)
+# define BOOST_PP_REPEAT_2_428(m, d) BOOST_PP_REPEAT_2_427(m, d) m(3, 427, d)
+# define BOOST_PP_REPEAT_2_429(m, d) BOOST_PP_REPEAT_2_428(m, d) m(3, 428, d)
+# define BOOST_PP_REPEAT_2_430(m, d) BOOST_PP_REPEAT_2_429(m, d) m(3, 429, d)
+# define BOOST_PP_REPEAT_2_431(m, d) BOOST_PP_REPEAT_2_430(m, d) m(3, 430, d)
+# define BOOST_PP_REPEAT_2_432(m, d) BOOST_PP_REPEAT_2_431(m, d) m(3, 431, d)
+# define BOOST_PP_REPEAT_2_433(m, d) BOOST_PP_REPEAT_2_432(m, d) m(3, 432, d)
+# define BOOST_PP_REPEAT_2_434(m, d) BOOST_PP_REPEAT_2_433(m, d) m(3, 433, d)
+# define BOOST_PP_REPEAT_2_435(m, d) BOOST_PP_REPEAT_2_434(m, d) m(3, 434, d)
+# define BOOST_PP_REPEAT_2_436(m, d) BOOST_PP_REPEAT_2_435(m, d) m(3, 435, d)
+# define BOOST_PP_REPEAT_2_437(m, d) BOOST_PP_REPEAT_2_436(m, d) m(3, 436, d)
+# define BOOST_PP_REPEAT_2_438(m, d) BOOST_PP_REPEAT_2_437(m, d) m(3, 437, d)
+# define BOOST_PP_REPEAT_2_439(m, d) BOOST_PP_REPEAT_2_438(m, d) m(3, 438, d)
+# define BOOST_PP_REPEAT_2_440(m, d) BOOST_PP_REPEAT_2_439(m, d) m(3, 439, d)
+# define BOOST_PP_REPEAT_2_441(m, d) BOOST_PP_REPEAT_2_440(m, d) m(3, 440, d)
+# define BOOST_PP_REPEAT_2_442(m, d) BOOST_PP_REPEAT_2_441(m, d) m(3, 441, d)
+# define BOOST_PP_REPEAT_2_443(m, d) BOOST_PP_REPEAT_2_442(m, d) m(3, 442, d)
+# define BOOST_PP_REPEAT_2_444(m, d) BOOST_PP_REPEAT_2_443(m, d) m(3, 443, d)
+# define BOOST_PP_REPEAT_2_445(m, d) BOOST_PP_REPEAT_2_444(m, d) m(3, 444, d)
+# define BOOST_PP_REPEAT_2_446(m, d) BOOST_PP_REPEAT_2_445(m, d) m(3, 445, d)
+# define BOOST_PP_REPEAT_2_447(m, d) BOOST_PP_REPEAT_2_446(m, d) m(3, 446, d)
+# define BOOST_PP_REPEAT_2_448(m, d) BOOST_PP_REPEAT_2_447(m, d) m(3, 447, d)
+# define BOOST_PP_REPEAT_2_449(m, d) BOOST_PP_REPEAT_2_448(m, d) m(3, 448, d)
+# define BOOST_PP_REPEAT_2_450(m, d) BOOST_PP_REPEAT_2_449(m, d) m(3, 449, d)
+# define BOOST_PP_REPEAT_2_451(m, d) BOOST_PP_REPEAT_2_450(m, d) m(3, 450, d)
+# define BOOST_PP_REPEAT_2_452(m, d) BOOST_PP_REPEAT_2_451(m, d) m(3, 451, d)
+# define BOOST_PP_REPEAT_2_453(m, d) BOOST_PP_REPEAT_2_452(m, d) m(3, 452, d)
+# define BOOST_PP_REPEAT_2_454(m, d) BOOST_PP_REPEAT_2_453(m, d) m(3, 453, d)
+# define BOOST_PP_REPEAT_2_455(m, d) BOOST_PP_REPEAT_2_454(m, d) m(3, 454, d)
+# define BOOST_PP_REPEAT_2_456(m, d) BOOST_PP_REPEAT_2_455(m, d) m(3, 455, d)
+# define BOOST_PP_REPEAT_2_457(m, d) BOOST_PP_REPEAT_2_456(m, d) m(3, 456, d)
+# define BOOST_PP_REPEAT_2_458(m, d) BOOST_PP_REPEAT_2_457(m, d) m(3, 457, d)
+# define BOOST_PP_REPEAT_2_459(m, d) BOOST_PP_REPEAT_2_458(m, d) m(3, 458, d)
+# define BOOST_PP_REPEAT_2_460(m, d) BOOST_PP_REPEAT_2_459(m, d) m(3, 459, d)
+# define BOOST_PP_REPEAT_2_461(m, d) BOOST_PP_REPEAT_2_460(m, d) m(3, 460, d)
+# define BOOST_PP_REPEAT_2_462(m, d) BOOST_PP_REPEAT_2_461(m, d) m(3, 461, d)
+# define BOOST_PP_REPEAT_2_463(m, d) BOOST_PP_REPEAT_2_462(m, d) m(3, 462, d)
+# define BOOST_PP_REPEAT_2_464(m, d) BOOST_PP_REPEAT_2_463(m, d) m(3, 463, d)
+# define BOOST_PP_REPEAT_2_465(m, d) BOOST_PP_REPEAT_2_464(m, d) m(3, 464, d)
+# define BOOST_PP_REPEAT_2_466(m, d) BOOST_PP_REPEAT_2_465(m, d) m(3, 465, d)
+# define BOOST_PP_REPEAT_2_467(m, d) BOOST_PP_REPEAT_2_466(m, d) m(3, 466, d)
+# define BOOST_PP_REPEAT_2_468(m, d) BOOST_PP_REPEAT_2_467(m, d) m(3, 467, d)
+# define BOOST_PP_REPEAT_2_469(m, d) BOOST_PP_REPEAT_2_468(m, d) m(3, 468, d)
+# define BOOST_PP_REPEAT_2_470(m, d) BOOST_PP_REPEAT_2_469(m, d) m(3, 469, d)
+# define BOOST_PP_REPEAT_2_471(m, d) BOOST_PP_REPEAT_2_470(m, d) m(3, 470, d)
+# define BOOST_PP_REPEAT_2_472(m, d) BOOST_PP_REPEAT_2_471(m, d) m(3, 471, d)
+# define BOOST_PP_REPEAT_2_473(m, d) BOOST_PP_REPEAT_2_472(m, d) m(3, 472, d)
+# define BOOST_PP_REPEAT_2_474(m, d) BOOST_PP_REPEAT_2_473(m, d) m(3, 473, d)
+# define BOOST_PP_REPEAT_2_475(m, d) BOOST_PP_REPEAT_2_474(m, d) m(3, 474, d)
+# define BOOST_PP_REPEAT_2_476(m, d) BOOST_PP_REPEAT_2_475(m, d) m(3, 475, d)
+# define BOOST_PP_REPEAT_2_477(m, d) BOOST_PP_REPEAT_2_476(m, d) m(3, 476, d)
+# define BOOST_PP_REPEAT_2_478(m, d) BOOST_PP_REPEAT_2_477(m, d) m(3, 477, d)
+# define BOOST_PP_REPEAT_2_479(m, d) BOOST_PP_REPEAT_2_478(m, d) m(3, 478, d)
+# define BOOST_PP_REPEAT_2_480(m, d) BOOST_PP_REPEAT_2_479(m, d) m(3, 479, d)
+# define BOOST_PP_REPEAT_2_481(m, d) BOOST_PP_REPEAT_2_480(m, d) m(3, 480, d)
+# define BOOST_PP_REPEAT_2_482(m, d) BOOST_PP_REPEAT_2_481(m, d) m(3, 481, d)
+# define BOOST_PP_REPEAT_2_483(m, d) BOOST_PP_REPEAT_2_482(m, d) m(3, 482, d)
+# define BOOST_PP_REPEAT_2_484(m, d) BOOST_PP_REPEAT_2_483(m, d) m(3, 483, d)
+# define BOOST_PP_REPEAT_2_485(m, d) BOOST_PP_REPEAT_2_484(m, d) m(3, 484, d)
+# define BOOST_PP_REPEAT_2_486(m, d) BOOST_PP_REPEAT_2_485(m, d) m(3, 485, d)
+# define BOOST_PP_REPEAT_2_487(m, d) BOOST_PP_REPEAT_2_486(m, d) m(3, 486, d)
+# define BOOST_PP_REPEAT_2_488(m, d) BOOST_PP_REPEAT_2_487(m, d) m(3, 487, d)
+# define BOOST_PP_REPEAT_2_489(m, d) BOOST_PP_REPEAT_2_488(m, d) m(3, 488, d)
+# define BOOST_PP_REPEAT_2_490(m, d) BOOST_PP_REPEAT_2_489(m, d) m(3, 489, d)
+# define BOOST_PP_REPEAT_2_491(m, d) BOOST_PP_REPEAT_2_490(m, d) m(3, 490, d)
+# define BOOST_PP_REPEAT_2_492(m, d) BOOST_PP_REPEAT_2_491(m, d) m(3, 491, d)
+# define BOOST_PP_REPEAT_2_493(m, d) BOOST_PP_REPEAT_2_492(m, d) m(3, 492, d)
+# define BOOST_PP_REPEAT_2_494(m, d) BOOST_PP_REPEAT_2_493(m, d) m(3, 493, d)
+# define BOOST_PP_REPEAT_2_495(m, d) BOOST_PP_REPEAT_2_494(m, d) m(3, 494, d)
+# define BOOST_PP_REPEAT_2_496(m, d) BOOST_PP_REPEAT_2_495(m, d) m(3, 495, d)
+# define BOOST_PP_REPEAT_2_497(m, d) BOOST_PP_REPEAT_2_496(m, d) m(3, 496, d)
+# define BOOST_PP_REPEAT_2_498(m, d) BOOST_PP_REPEAT_2_497(m, d) m(3, 497, d)
+# define BOOST_PP_REPEAT_2_499(m, d) BOOST_PP_REPEAT_2_498(m, d) m(3, 498, d)
+# define BOOST_PP_REPEAT_2_500(m, d) BOOST_PP_REPEAT_2_499(m, d) m(3, 499, d)
+# define BOOST_PP_REPEAT_2_501(m, d) BOOST_PP_REPEAT_2_500(m, d) m(3, 500, d)
+# define BOOST_PP_REPEAT_2_502(m, d) BOOST_PP_REPEAT_2_501(m, d) m(3, 501, d)
+# define BOOST_PP_REPEAT_2_503(m, d) BOOST_PP_REPEAT_2_502(m, d) m(3, 502, d)
+# define BOOST_PP_REPEAT_2_504(m, d) BOOST_PP_REPEAT_2_503(m, d) m(3, 503, d)
+# define BOOST_PP_REPEAT_2_505(m, d) BOOST_PP_REPEAT_2_504(m, d) m(3, 504, d)
+# define BOOST_PP_REPEAT_2_506(m, d) BOOST_PP_REPEAT_2_505(m, d) m(3, 505, d)
+# define BOOST_PP_REPEAT_2_507(m, d) BOOST_PP_REPEAT_2_506(m, d) m(3, 506, d)
+# define BOOST_PP_REPEAT_2_508(m, d) BOOST_PP_REPEAT_2_507(m, d) m(3, 507, d)
+# define BOOST_PP_REPEAT_2_509(m, d) BOOST_PP_REPEAT_2_508(m, d) m(3, 508, d)
+# define BOOST_PP_REPEAT_2_510(m, d) BOOST_PP_REPEAT_2_509(m, d) m(3, 509, d)
+# define BOOST_PP_REPEAT_2_511(m, d) BOOST_PP_REPEAT_2_510(m, d) m(3, 510, d)
+# define BOOST_PP_REPEAT_2_512(m, d) BOOST_PP_REPEAT_2_511(m, d) m(3, 511, d)
+#
+# define BOOST_PP_REPEAT_3_257(m, d) BOOST_PP_REPEAT_3_256(m, d) m(4, 256, d)
+# define BOOST_PP_REPEAT_3_258(m, d) BOOST_PP_REPEAT_3_257(m, d) m(4, 257, d)
+# define BOOST_PP_REPEAT_3_259(m, d) BOOST_PP_REPEAT_3_258(m, d) m(4, 258, d)
+# define BOOST_PP_REPEAT_3_260(m, d) BOOST_PP_REPEAT_3_259(m, d) m(4, 259, d)
+# define BOOST_PP_REPEAT_3_261(m, d) BOOST_PP_REPEAT_3_260(m, d) m(4, 260, d)
+# define BOOST_PP_REPEAT_3_262(m, d) BOOST_PP_REPEAT_3_261(m, d) m(4, 261, d)
+# define BOOST_PP_REPEAT_3_263(m, d) BOOST_PP_REPEAT_3_262(m, d) m(4, 262, d)
+# define BOOST_PP_REPEAT_3_264(m, d) BOOST_PP_REPEAT_3_263(m, d) m(4, 263, d)
+# define BOOST_PP_REPEAT_3_265(m, d) BOOST_PP_REPEAT_3_264(m, d) m(4, 264, d)
+# define BOOST_PP_REPEAT_3_266(m, d) BOOST_PP_REPEAT_3_265(m, d) m(4, 265, d)
+# define BOOST_PP_REPEAT_3_267(m, d) BOOST_PP_REPEAT_3_266(m, d) m(4, 266, d)
+# define BOOST_PP_REPEAT_3_268(m, d) BOOST_PP_REPEAT_3_267(m, d) m(4, 267, d)
+# define BOOST_PP_REPEAT_3_269(m, d) BOOST_PP_REPEAT_3_268(m, d) m(4, 268, d)
+# define BOOST_PP_REPEAT_3_270(m, d) BOOST_PP_REPEAT_3_269(m, d) m(4, 269, d)
+# define BOOST_PP_REPEAT_3_271(m, d) BOOST_PP_REPEAT_3_270(m, d) m(4, 270, d)
+# define BOOST_PP_REPEAT_3_272(m, d) BOOST_PP_REPEAT_3_271(m, d) m(4, 271, d)
+# define BOOST_PP_REPEAT_3_273(m, d) BOOST_PP_REPEAT_3_272(m, d) m(4, 272, d)
+# define BOOST_PP_REPEAT_3_274(m, d) BOOST_PP_REPEAT_3_273(m, d) m(4, 273, d)
+# define BOOST_PP_REPEAT_3_275(m, d) BOOST_PP_REPEAT_3_274(m, d) m(4, 274, d)
+# define BOOST_PP_REPEAT_3_276(m, d) BOOST_PP_REPEAT_3_275(m, d) m(4, 275, d)
+# define BOOST_PP_REPEAT_3_277(m, d) BOOST_PP_REPEAT_3_276(m, d) m(4, 276, d)
+# define BOOST_PP_REPEAT_3_278(m, d) BOOST_PP_REPEAT_3_277(m, d) m(4, 277, d)
+# define BOOST_PP_REPEAT_3_279(m, d) BOOST_PP_REPEAT_3_278(m, d) m(4, 278, d)
+# define BOOST_PP_REPEAT_3_280(m, d) BOOST_PP_REPEAT_3_279(m, d) m(4, 279, d)
+# define BOOST_PP_REPEAT_3_281(m, d) BOOST_PP_REPEAT_3_280(m, d) m(4, 280, d)
+# define BOOST_PP_REPEAT_3_282(m, d) BOOST_PP_REPEAT_3_281(m, d) m(4, 281, d)
+# define BOOST_PP_REPEAT_3_283(m, d) BOOST_PP_REPEAT_3_282(m, d) m(4, 282, d)
+# define BOOST_PP_REPEAT_3_284(m, d) BOOST_PP_REPEAT_3_283(m, d) m(4, 283, d)
+# define BOOST_PP_REPEAT_3_285(m, d) BOOST_PP_REPEAT_3_284(m, d) m(4, 284, d)
+# define BOOST_PP_REPEAT_3_286(m, d) BOOST_PP_REPEAT_3_285(m, d) m(4, 285, d)
+# define BOOST_PP_REPEAT_3_287(m, d) BOOST_PP_REPEAT_3_286(m, d) m(4, 286, d)
+# define BOOST_PP_REPEAT_3_288(m, d) BOOST_PP_REPEAT_3_287(m, d) m(4, 287, d)
+# define BOOST_PP_REPEAT_3_289(m, d) BOOST_PP_REPEAT_3_288(m, d) m(4, 288, d)
+# define BOOST_PP_REPEAT_3_290(m, d) BOOST_PP_REPEAT_3_289(m, d) m(4, 289, d)
+# define BOOST_PP_REPEAT_3_291(m, d) BOOST_PP_REPEAT_3_290(m, d) m(4, 290, d)
+# define BOOST_PP_REPEAT_3_292(m, d) BOOST_PP_REPEAT_3_291(m, d) m(4, 291, d)
+# define BOOST_PP_REPEAT_3_293(m, d) BOOST_PP_REPEAT_3_292(m, d) m(4, 292, d)
+# define BOOST_PP_REPEAT_3_294(m, d) BOOST_PP_REPEAT_3_293(m, d) m(4, 293, d)
+# define BOOST_PP_REPEAT_3_295(m, d) BOOST_PP_REPEAT_3_294(m, d) m(4, 294, d)
+# define BOOST_PP_REPEAT_3_296(m, d) BOOST_PP_REPEAT_3_295(m, d) m(4, 295, d)
+# define BOOST_PP_REPEAT_3_297(m, d) BOOST_PP_REPEAT_3_296(m, d) m(4, 296, d)
+# define BOOST_PP_REPEAT_3_298(m, d) BOOST_PP_REPEAT_3_297(m, d) m(4, 297, d)
+# define BOOST_PP_REPEAT_3_299(m, d) BOOST_PP_REPEAT_3_298(m, d) m(4, 298, d)
+# define BOOST_PP_REPEAT_3_300(m, d) BOOST_PP_REPEAT_3_299(m, d) m(4, 299, d)
+# define BOOST_PP_REPEAT_3_301(m, d) BOOST_PP_REPEAT_3_300(m, d) m(4, 300, d)
+# define BOOST_PP_REPEAT_3_302(m, d) BOOST_PP_REPEAT_3_301(m, d) m(4, 301, d)
+# define BOOST_PP_REPEAT_3_303(m, d) BOOST_PP_REPEAT_3_302(m, d) m(4, 302, d)
+# define BOOST_PP_REPEAT_3_304(m, d) BOOST_PP_REPEAT_3_303(m, d) m(4, 303, d)
+# define BOOST_PP_REPEAT_3_305(m, d) BOOST_PP_REPEAT_3_304(m, d) m(4, 304, d)
+# define BOOST_PP_REPEAT_3_306(m, d) BOOST_PP_REPEAT_3_305(m, d) m(4, 305, d)
+# define BOOST_PP_REPEAT_3_307(m, d) BOOST_PP_REPEAT_3_306(m, d) m(4, 306, d)
+# define BOOST_PP_REPEAT_3_308(m, d) BOOST_PP_REPEAT_3_307(m, d) m(4, 307, d)
+# define BOOST_PP_REPEAT_3_309(m, d) BOOST_PP_REPEAT_3_308(m, d) m(4, 308, d)
+# define BOOST_PP_REPEAT_3_310(m, d) BOOST_PP_REPEAT_3_309(m, d) m(4, 309, d)
+# define BOOST_PP_REPEAT_3_311(m, d) BOOST_PP_REPEAT_3_310(m, d) m(4, 310, d)
+# define BOOST_PP_REPEAT_3_312(m, d) BOOST_PP_REPEAT_3_311(m, d) m(4, 311, d)
+# define BOOST_PP_REPEAT_3_313(m, d) BOOST_PP_REPEAT_3_312(m, d) m(4, 312, d)
+# define BOOST_PP_REPEAT_3_314(m, d) BOOST_PP_REPEAT_3_313(m, d) m(4, 313, d)
+# define BOOST_PP_REPEAT_3_315(m, d) BOOST_PP_REPEAT_3_314(m, d) m(4, 314, d)
+# define BOOST_PP_REPEAT_3_316(m, d) BOOST_PP_REPEAT_3_315(m, d) m(4, 315, d)
+# define BOOST_PP_REPEAT_3_317(m, d) BOOST_PP_REPEAT_3_316(m, d) m(4, 316, d)
+# define BOOST_PP_REPEAT_3_318(m, d) BOOST_PP_REPEAT_3_317(m, d) m(4, 317, d)
+# define BOOST_PP_REPEAT_3_319(m, d) BOOST_PP_REPEAT_3_318(m, d) m(4, 318, d)
+# define BOOST_PP_REPEAT_3_320(m, d) BOOST_PP_REPEAT_3_319(m, d) m(4, 319, d)
+# define BOOST_PP_REPEAT_3_321(m, d) BOOST_PP_REPEAT_3_320(m, d) m(4, 320, d)
+# define BOOST_PP_REPEAT_3_322(m, d) BOOST_PP_REPEAT_3_321(m, d) m(4, 321, d)
+# define BOOST_PP_REPEAT_3_323(m, d) BOOST_PP_REPEAT_3_322(m, d) m(4, 322, d)
+# define BOOST_PP_REPEAT_3_324(m, d) BOOST_PP_REPEAT_3_323(m, d) m(4, 323, d)
+# define BOOST_PP_REPEAT_3_325(m, d) BOOST_PP_REPEAT_3_324(m, d) m(4, 324, d)
+# define BOOST_PP_REPEAT_3_326(m, d) BOOST_PP_REPEAT_3_325(m, d) m(4, 325, d)
+# define BOOST_PP_REPEAT_3_327(m, d) BOOST_PP_REPEAT_3_326(m, d) m(4, 326, d)
+# define BOOST_PP_REPEAT_3_328(m, d) BOOST_PP_REPEAT_3_327(m, d) m(4, 327, d)
+# define BOOST_PP_REPEAT_3_329(m, d) BOOST_PP_REPEAT_3_328(m, d) m(4, 328, d)
+# define BOOST_PP_REPEAT_3_330(m, d) BOOST_PP_REPEAT_3_329(m, d) m(4, 329, d)
+# define BOOST_PP_REPEAT_3_331(m, d) BOOST_PP_REPEAT_3_330(m, d) m(4, 330, d)
+# define BOOST_PP_REPEAT_3_332(m, d) BOOST_PP_REPEAT_3_331(m, d) m(4, 331, d)
+# define BOOST_PP_REPEAT_3_333(m, d) BOOST_PP_REPEAT_3_332(m, d) m(4, 332, d)
+# define BOOST_PP_REPEAT_3_334(m, d) BOOST_PP_REPEAT_3_333(m, d) m(4, 333, d)
+# define BOOST_PP_REPEAT_3_335(m, d) BOOST_PP_REPEAT_3_334(m, d) m(4, 334, d)
+# define BOOST_PP_REPEAT_3_336(m, d) BOOST_PP_REPEAT_3_335(m, d) m(4, 335, d)
+# define BOOST_PP_REPEAT_3_337(m, d) BOOST_PP_REPEAT_3_336(m, d) m(4, 336, d)
+# define BOOST_PP_REPEAT_3_338(m, d) BOOST_PP_REPEAT_3_337(m, d) m(4, 337, d)
+# define BOOST_PP_REPEAT_3_339(m, d) BOOST_PP_REPEAT_3_338(m, d) m(4, 338, d)
+# define BOOST_PP_REPEAT_3_340(m, d) BOOST_PP_REPEAT_3_339(m, d) m(4, 339, d)
+# define BOOST_PP_REPEAT_3_341(m, d) BOOST_PP_REPEAT_3_340(m, d) m(4, 340, d)
+# define BOOST_PP_REPEAT_3_342(m, d) BOOST_PP_REPEAT_3_341(m, d) m(4, 341, d)
+# define BOOST_PP_REPEAT_3_343(m, d) BOOST_PP_REPEAT_3_342(m, d) m(4, 342, d)
+# define BOOST_PP_REPEAT_3_344(m, d) BOOST_PP_REPEAT_3_343(m, d) m(4, 343, d)
+# define BOOST_PP_REPEAT_3_345(m, d) BOOST_PP_REPEAT_3_344(m, d) m(4, 344, d)
+# define BOOST_PP_REPEAT_3_346(m, d) BOOST_PP_REPEAT_3_345(m, d) m(4, 345, d)
+# define BOOST_PP_REPEAT_3_347(m, d) BOOST_PP_REPEAT_3_346(m, d) m(4, 346, d)
+# define BOOST_PP_REPEAT_3_348(m, d) BOOST_PP_REPEAT_3_347(m, d) m(4, 347, d)
+# define BOOST_PP_REPEAT_3_349(m, d) BOOST_PP_REPEAT_3_348(m, d) m(4, 348, d)
+# define BOOST_PP_REPEAT_3_350(m, d) BOOST_PP_REPEAT_3_349(m, d) m(4, 349, d)
+# define BOOST_PP_REPEAT_3_351(m, d) BOOST_PP_REPEAT_3_350(m, d) m(4, 350, d)
+# define BOOST_PP_REPEAT_3_352(m, d) BOOST_PP_REPEAT_3_351(m, d) m(4, 351, d)
+# define BOOST_PP_REPEAT_3_353(m, d) BOOST_PP_REPEAT_3_352(m, d) m(4, 352, d)
+# define BOOST_PP_REPEAT_3_354(m, d) BOOST_PP_REPEAT_3_353(m, d) m(4, 353, d)
+# define BOOST_PP_REPEAT_3_355(m, d) BOOST_PP_REPEAT_3_354(m, d) m(4, 354, d)
+# define BOOST_PP_REPEAT_3_356(m, d) BOOST_PP_REPEAT_3_355(m, d) m(4, 355, d)
+# define BOOST_PP_REPEAT_3_357(m, d) BOOST_PP_REPEAT_3_356(m, d) m(4, 356, d)
+# define BOOST_PP_REPEAT_3_358(m, d) BOOST_PP_REPEAT_3_357(m, d) m(4, 357, d)
+# define BOOST_PP_REPEAT_3_359(m, d) BOOST_PP_REPEAT_3_358(m, d) m(4, 358, d)
+# define BOOST_PP_REPEAT_3_360(m, d) BOOST_PP_REPEAT_3_359(m, d) m(4, 359, d)
+# define BOOST_PP_REPEAT_3_361(m, d) BOOST_PP_REPEAT_3_360(m, d) m(4, 360, d)
+# define BOOST_PP_REPEAT_3_362(m, d) BOOST_PP_REPEAT_3_361(m, d) m(4, 361, d)
+# define BOOST_PP_REPEAT_3_363(m, d) BOOST_PP_REPEAT_3_362(m, d) m(4, 362, d)
+# define BOOST_PP_REPEAT_3_364(m, d) BOOST_PP_REPEAT_3_363(m, d) m(4, 363, d)
+# define BOOST_PP_REPEAT_3_365(m, d) BOOST_PP_REPEAT_3_364(m, d) m(4, 364, d)
+# define BOOST_PP_REPEAT_3_366(m, d) BOOST_PP_REPEAT_3_365(m, d) m(4, 365, d)
+# define BOOST_PP_REPEAT_3_367(m, d) BOOST_PP_REPEAT_3_366(m, d) m(4, 366, d)
+# define BOOST_PP_REPEAT_3_368(m, d) BOOST_PP_REPEAT_3_367(m, d) m(4, 367, d)
+# define BOOST_PP_REPEAT_3_369(m, d) BOOST_PP_REPEAT_3_368(m, d) m(4, 368, d)
+# define BOOST_PP_REPEAT_3_370(m, d) BOOST_PP_REPEAT_3_369(m, d) m(4, 369, d)
+# define BOOST_PP_REPEAT_3_371(m, d) BOOST_PP_REPEAT_3_370(m, d) m(4, 370, d)
+# define BOOST_PP_REPEAT_3_372(m, d) BOOST_PP_REPEAT_3_371(m, d) m(4, 371, d)
+# define BOOST_PP_REPEAT_3_373(m, d) BOOST_PP_REPEAT_3_372(m, d) m(4, 372, d)
+# define BOOST_PP_REPEAT_3_374(m, d) BOOST_PP_REPEAT_3_373(m, d) m(4, 373, d)
+# define BOOST_PP_REPEAT_3_375(m, d) BOOST_PP_REPEAT_3_374(m, d) m(4, 374, d)
+# define BOOST_PP_REPEAT_3_376(m, d) BOOST_PP_REPEAT_3_375(m, d) m(4, 375, d)
+# define BOOST_PP_REPEAT_3_377(m, d) BOOST_PP_REPEAT_3_376(m, d) m(4, 376, d)
+# define BOOST_PP_REPEAT_3_378(m, d) BOOST_PP_REPEAT_3_377(m, d) m(4, 377, d)
+# define BOOST_PP_REPEAT_3_379(m, d) BOOST_PP_REPEAT_3_378(m, d) m(4, 378, d)
+# define BOOST_PP_REPEAT_3_380(m, d) BOOST_PP_REPEAT_3_379(m, d) m(4, 379, d)
+# define BOOST_PP_REPEAT_3_381(m, d) BOOST_PP_REPEAT_3_380(m, d) m(4, 380, d)
+# define BOOST_PP_REPEAT_3_382(m, d) BOOST_PP_REPEAT_3_381(m, d) m(4, 381, d)
+# define BOOST_PP_REPEAT_3_383(m, d) BOOST_PP_REPEAT_3_382(m, d) m(4, 382, d)
+# define BOOST_PP_REPEAT_3_384(m, d) BOOST_PP_REPEAT_3_383(m, d) m(4, 383, d)
+# define BOOST_PP_REPEAT_3_385(m, d) BOOST_PP_REPEAT_3_384(m, d) m(4, 384, d)
+# define BOOST_PP_REPEAT_3_386(m, d) BOOST_PP_REPEAT_3_385(m, d) m(4, 385, d)
+# define BOOST_PP_REPEAT_3_387(m, d) BOOST_PP_REPEAT_3_386(m, d) m(4, 386, d)
+# define BOOST_PP_REPEAT_3_388(m, d) BOOST_PP_REPEAT_3_387(m, d) m(4, 387, d)
+# define BOOST_PP_REPEAT_3_389(m, d) BOOST_PP_REPEAT_3_388(m, d) m(4, 388, d)
+# define BOOST_PP_REPEAT_3_390(m, d) BOOST_PP_REPEAT_3_389(m, d) m(4, 389, d)
+# define BOOST_PP_REPEAT_3_391(m, d) BOOST_PP_REPEAT_3_390(m, d) m(4, 390, d)
+# define BOOST_PP_REPEAT_3_392(m, d) BOOST_PP_REPEAT_3_391(m, d) m(4, 391, d)
+# define BOOST_PP_REPEAT_3_393(m, d) BOOST_PP_REPEAT_3_392(m, d) m(4, 392, d)
+# define BOOST_PP_REPEAT_3_394(m, d) BOOST_PP_REPEAT_3_393(m, d) m(4, 393, d)
+# define BOOST_PP_REPEAT_3_395(m, d) BOOST_PP_REPEAT_3_394(m, d) m(4, 394, d)
+# define BOOST_PP_REPEAT_3_396(m, d) BOOST_PP_REPEAT_3_395(m, d) m(4, 395, d)
+# define BOOST_PP_REPEAT_3_397(m, d) BOOST_PP_REPEAT_3_396(m, d) m(4, 396, d)
+# define BOOST_PP_REPEAT_3_398(m, d) BOOST_PP_REPEAT_3_397(m, d) m(4, 397, d)
+# define BOOST_PP_REPEAT_3_399(m, d) BOOST_PP_REPEAT_3_398(m, d) m(4, 398, d)
+# define BOOST_PP_REPEAT_3_400(m, d) BOOST_PP_REPEAT_3_399(m, d) m(4, 399, d)
+# define BOOST_PP_REPEAT_3_401(m, d) BOOST_PP_REPEAT_3_400(m, d) m(4, 400, d)
+# define BOOST_PP_REPEAT_3_402(m, d) BOOST_PP_REPEAT_3_401(m, d) m(4, 401, d)
+# define BOOST_PP_REPEAT_3_403(m, d) BOOST_PP_REPEAT_3_402(m, d) m(4, 402, d)
+# define BOOST_PP_REPEAT_3_404(m, d) BOOST_PP_REPEAT_3_403(m, d) m(4, 403, d)
+# define BOOST_PP_REPEAT_3_405(m, d) BOOST_PP_REPEAT_3_404(m, d) m(4, 404, d)
+# define BOOST_PP_REPEAT_3_406(m, d) BOOST_PP_REPEAT_3_405(m, d) m(4, 405, d)
+# define BOOST_PP_REPEAT_3_407(m, d) BOOST_PP_REPEAT_3_406(m, d) m(4, 406, d)
+# define BOOST_PP_REPEAT_3_408(m, d) BOOST_PP_REPEAT_3_407(m, d) m(4, 407, d)
+# define BOOST_PP_REPEAT_3_409(m, d) BOOST_PP_REPEAT_3_408(m, d) m(4, 408, d)
+# define BOOST_PP_REPEAT_3_410(m, d) BOOST_PP_REPEAT_3_409(m, d) m(4, 409, d)
+# define BOOST_PP_REPEAT_3_411(m, d) BOOST_PP_REPEAT_3_410(m, d) m(4, 410, d)
+# define BOOST_PP_REPEAT_3_412(m, d) BOOST_PP_REPEAT_3_411(m, d) m(4, 411, d)
+# define BOOST_PP_REPEAT_3_413(m, d) BOOST_PP_REPEAT_3_412(m, d) m(4, 412, d)
+# define BOOST_PP_REPEAT_3_414(m, d) BOOST_PP_REPEAT_3_413(m, d) m(4, 413, d)
+# define BOOST_PP_REPEAT_3_415(m, d) BOOST_PP_REPEAT_3_414(m, d) m(4, 414, d)
+# define BOOST_PP_REPEAT_3_416(m, d) BOOST_PP_REPEAT_3_415(m, d) m(4, 415, d)
+# define BOOST_PP_REPEAT_3_417(m, d) BOOST_PP_REPEAT_3_416(m, d) m(4, 416, d)
+# define BOOST_PP_REPEAT_3_418(m, d) BOOST_PP_REPEAT_3_417(m, d) m(4, 417, d)
+# define BOOST_PP_REPEAT_3_419(m, d) BOOST_PP_REPEAT_3_418(m, d) m(4, 418, d)
+# define BOOST_PP_REPEAT_3_420(m, d) BOOST_PP_REPEAT_3_419(m, d) m(4, 419, d)
+# define BOOST_PP_REPEAT_3_421(m, d) BOOST_PP_REPEAT_3_420(m, d) m(4, 420, d)
+# define BOOST_PP_REPEAT_3_422(m, d) BOOST_PP_REPEAT_3_421(m, d) m(4, 421, d)
+# define BOOST_PP_REPEAT_3_423(m, d) BOOST_PP_REPEAT_3_422(m, d) m(4, 422, d)
+# define BOOST_PP_REPEAT_3_424(m, d) BOOST_PP_REPEAT_3_423(m, d) m(4, 423, d)
+# define BOOST_PP_REPEAT_3_425(m, d) BOOST_PP_REPEAT_3_424(m, d) m(4, 424, d)
+# define BOOST_PP_REPEAT_3_426(m, d) BOOST_PP_REPEAT_3_425(m, d) m(4, 425, d)
+# define BOOST_PP_REPEAT_3_427(m, d) BOOST_PP_REPEAT_3_426(m, d) m(4, 426, d)
+# define BOOST_PP_REPEAT_3_428(m, d) BOOST_PP_REPEAT_3_427(m, d) m(4, 427, d)
+# define BOOST_PP_REPEAT_3_429(m, d) BOOST_PP_REPEAT_3_428(m, d) m(4, 428, d)
+# define BOOST_PP_REPEAT_3_430(m, d) BOOST_PP_REPEAT_3_429(m, d) m(4, 429, d)
+# define BOOST_PP_REPEAT_3_431(m, d) BOOST_PP_REPEAT_3_430(m, d) m(4, 430, d)
+# define BOOST_PP_REPEAT_3_432(m, d) BOOST_PP_REPEAT_3_431(m, d) m(4, 431, d)
+# define BOOST_PP_REPEAT_3_433(m, d) BOOST_PP_REPEAT_3_432(m, d) m(4, 432, d)
+# define BOOST_PP_REPEAT_3_434(m, d) BOOST_PP_REPEAT_3_433(m, d) m(4, 433, d)
+# define BOOST_PP_REPEAT_3_435(m, d) BOOST_PP_REPEAT_3_434(m, d) m(4, 434, d)
+# define BOOST_PP_REPEAT_3_436(m, d) BOOST_PP_REPEAT_3_435(m, d) m(4, 435, d)
+# define BOOST_PP_REPEAT_3_437(m, d) BOOST_PP_REPEAT_3_436(m, d) m(4, 436, d)
+# define BOOST_PP_REPEAT_3_438(m, d) BOOST_PP_REPEAT_3_437(m, d) m(4, 437, d)
+# define BOOST_PP_REPEAT_3_439(m, d) BOOST_PP_REPEAT_3_438(m, d) m(4, 438, d)
+# define BOOST_PP_REPEAT_3_440(m, d) BOOST_PP_REPEAT_3_439(m, d) m(4, 439, d)
+# define BOOST_PP_REPEAT_3_441(m, d) BOOST_PP_REPEAT_3_440(m, d) m(4, 440, d)
+# define BOOST_PP_REPEAT_3_442(m, d) BOOST_PP_REPEAT_3_441(m, d) m(4, 441, d)
+# define BOOST_PP_REPEAT_3_443(m, d) BOOST_PP_REPEAT_3_442(m, d) m(4, 442, d)
+# define BOOST_PP_REPEAT_3_444(m, d) BOOST_PP_REPEAT_3_443(m, d) m(4, 443, d)
+# define BOOST_PP_REPEAT_3_445(m, d) BOOST_PP_REPEAT_3_444(m, d) m(4, 444, d)
+# define BOOST_PP_REPEAT_3_446(m, d) BOOST_PP_REPEAT_3_445(m, d) m(4, 445, d)
+# define BOOST_PP_REPEAT_3_447(m, d) BOOST_PP_REPEAT_3_446(m, d) m(4, 446, d)
+# define BOOST_PP_REPEAT_3_448(m, d) BOOST_PP_REPEAT_3_447(m, d) m(4, 447, d)
+# define BOOST_PP_REPEAT_3_449(m, d) BOOST_PP_REPEAT_3_448(m, d) m(4, 448, d)
+# define BOOST_PP_REPEAT_3_450(m, d) BOOST_PP_REPEAT_3_449(m, d) m(4, 449, d)
+# define BOOST_PP_REPEAT_3_451(m, d) BOOST_PP_REPEAT_3_450(m, d) m(4, 450, d)
+# define BOOST_PP_REPEAT_3_452(m, d) BOOST_PP_REPEAT_3_451(m, d) m(4, 451, d)
+# define BOOST_PP_REPEAT_3_453(m, d) BOOST_PP_REPEAT_3_452(m, d) m(4, 452, d)
+# define BOOST_PP_REPEAT_3_454(m, d) BOOST_PP_REPEAT_3_453(m, d) m(4, 453, d)
+# define BOOST_PP_REPEAT_3_455(m, d) BOOST_PP_REPEAT_3_454(m, d) m(4, 454, d)
+# define BOOST_PP_REPEAT_3_456(m, d) BOOST_PP_REPEAT_3_455(m, d) m(4, 455, d)
+# define BOOST_PP_REPEAT_3_457(m, d) BOOST_PP_REPEAT_3_456(m, d) m(4, 456, d)
+# define BOOST_PP_REPEAT_3_458(m, d) BOOST_PP_REPEAT_3_457(m, d) m(4, 457, d)
+# define BOOST_PP_REPEAT_3_459(m, d) BOOST_PP_REPEAT_3_458(m, d) m(4, 458, d)
+# define BOOST_PP_REPEAT_3_460(m, d) BOOST_PP_REPEAT_3_459(m, d) m(4, 459, d)
+# define BOOST_PP_REPEAT_3_461(m, d) BOOST_PP_REPEAT_3_460(m, d) m(4, 460, d)
+# define BOOST_PP_REPEAT_3_462(m, d) BOOST_PP_REPEAT_3_461(m, d) m(4, 461, d)
+# define BOOST_PP_REPEAT_3_463(m, d) BOOST_PP_REPEAT_3_462(m, d) m(4, 462, d)
+# define BOOST_PP_REPEAT_3_464(m, d) BOOST_PP_REPEAT_3_463(m, d) m(4, 463, d)
+# define BOOST_PP_REPEAT_3_465(m, d) BOOST_PP_REPEAT_3_464(m, d) m(4, 464, d)
+# define BOOST_PP_REPEAT_3_466(m, d) BOOST_PP_REPEAT_3_465(m, d) m(4, 465, d)
+# define BOOST_PP_REPEAT_3_467(m, d) BOOST_PP_REPEAT_3_466(m, d) m(4, 466, d)
+# define BOOST_PP_REPEAT_3_468(m, d) BOOST_PP_REPEAT_3_467(m, d) m(4, 467, d)
+# define BOOST_PP_REPEAT_3_469(m, d) BOOST_PP_REPEAT_3_468(m, d) m(4, 468, d)
+# define BOOST_PP_REPEAT_3_470(m, d) BOOST_PP_REPEAT_3_469(m, d) m(4, 469, d)
+# define BOOST_PP_REPEAT_3_471(m, d) BOOST_PP_REPEAT_3_470(m, d) m(4, 470, d)
+# define BOOST_PP_REPEAT_3_472(m, d) BOOST_PP_REPEAT_3_471(m, d) m(4, 471, d)
+# define BOOST_PP_REPEAT_3_473(m, d) BOOST_PP_REPEAT_3_472(m, d) m(4, 472, d)
+# define BOOST_PP_REPEAT_3_474(m, d) BOOST_PP_REPEAT_3_473(m, d) m(4, 473, d)
+# define BOOST_PP_REPEAT_3_475(m, d) BOOST_PP_REPEAT_3_474(m, d) m(4, 474, d)
+# define BOOST_PP_REPEAT_3_476(m, d) BOOST_PP_REPEAT_3_475(m, d) m(4, 475, d)
+# define BOOST_PP_REPEAT_3_477(m, d) BOOST_PP_REPEAT_3_476(m, d) m(4, 476, d)
+# define BOOST_PP_REPEAT_3_478(m, d) BOOST_PP_REPEAT_3_477(m, d) m(4, 477, d)
+# define BOOST_PP_REPEAT_3_479(m, d) BOOST_PP_REPEAT_3_478(m, d) m(4, 478, d)
+# define BOOST_PP_REPEAT_3_480(m, d) BOOST_PP_REPEAT_3_479(m, d) m(4, 479, d)
+# define BOOST_PP_REPEAT_3_481(m, d) BOOST_PP_REPEAT_3_480(m, d) m(4, 480, d)
+# define BOOST_PP_REPEAT_3_482(m, d) BOOST_PP_REPEAT_3_481(m, d) m(4, 481, d)
+# define BOOST_PP_REPEAT_3_483(m, d) BOOST_PP_REPEAT_3_482(m, d) m(4, 482, d)
+# define BOOST_PP_REPEAT_3_484(m, d) BOOST_PP_REPEAT_3_483(m, d) m(4, 483, d)
+# define BOOST_PP_REPEAT_3_485(m, d) BOOST_PP_REPEAT_3_484(m, d) m(4, 484, d)
+# define BOOST_PP_REPEAT_3_486(m, d) BOOST_PP_REPEAT_3_485(m, d) m(4, 485, d)
+# define BOOST_PP_REPEAT_3_487(m, d) BOOST_PP_REPEAT_3_486(m, d) m(4, 486, d)
+# define BOOST_PP_REPEAT_3_488(m, d) BOOST_PP_REPEAT_3_487(m, d) m(4, 487, d)
+# define BOOST_PP_REPEAT_3_489(m, d) BOOST_PP_REPEAT_3_488(m, d) m(4, 488, d)
+# define BOOST_PP_REPEAT_3_490(m, d) BOOST_PP_REPEAT_3_489(m, d) m(4, 489, d)
+# define BOOST_PP_REPEAT_3_491(m, d) BOOST_PP_REPEAT_3_490(m, d) m(4, 490, d)
+# define BOOST_PP_REPEAT_3_492(m, d) BOOST_PP_REPEAT_3_491(m, d) m(4, 491, d)
+# define BOOST_PP_REPEAT_3_493(m, d) BOOST_PP_REPEAT_3_492(m, d) m(4, 492, d)
+# define BOOST_PP_REPEAT_3_494(m, d) BOOST_PP_REPEAT_3_493(m, d) m(4, 493, d)
+# define BOOST_PP_REPEAT_3_495(m, d) BOOST_PP_REPEAT_3_494(m, d) m(4, 494, d)
+# define BOOST_PP_REPEAT_3_496(m, d) BOOST_PP_REPEAT_3_495(m, d) m(4, 495, d)
+# define BOOST_PP_REPEAT_3_497(m, d) BOOST_PP_REPEAT_3_496(m, d) m(4, 496, d)
+# define BOOST_PP_REPEAT_3_498(m, d) BOOST_PP_REPEAT_3_497(m, d) m(4, 497, d)
+# define BOOST_PP_REPEAT_3_499(m, d) BOOST_PP_REPEAT_3_498(m, d) m(4, 498, d)
+# define BOOST_PP_REPEAT_3_500(m, d) BOOST_PP_REPEAT_3_499(m, d) m(4, 499, d)
+# define BOOST_PP_REPEAT_3_501(m, d) BOOST_PP_REPEAT_3_500(m, d) m(4, 500, d)
+# define BOOST_PP_REPEAT_3_502(m, d) BOOST_PP_REPEAT_3_501(m, d) m(4, 501, d)
+# define BOOST_PP_REPEAT_3_503(m, d) BOOST_PP_REPEAT_3_502(m, d) m(4, 502, d)
+# define BOOST_PP_REPEAT_3_504(m, d) BOOST_PP_REPEAT_3_503(m, d) m(4, 503, d)
+# define BOOST_PP_REPEAT_3_505(m, d) BOOST_PP_REPEAT_3_504(m, d) m(4, 504, d)
+# define BOOST_PP_REPEAT_3_506(m, d) BOOST_PP_REPEAT_3_505(m, d) m(4, 505, d)
+# define BOOST_PP_REPEAT_3_507(m, d) BOOST_PP_REPEAT_3_506(m, d) m(4, 506, d)
+# define BOOST_PP_REPEAT_3_508(m, d) BOOST_PP_REPEAT_3_507(m, d) m(4, 507, d)
+# define BOOST_PP_REPEAT_3_509(m, d) BOOST_PP_REPEAT_3_508(m, d) m(4, 508, d)
+# define BOOST_PP_REPEAT_3_510(m, d) BOOST_PP_REPEAT_3_509(m, d) m(4, 509, d)
+# define BOOST_PP_REPEAT_3_511(m, d) BOOST_PP_REPEAT_3_510(m, d) m(4, 510, d)
+# define BOOST_PP_REPEAT_3_512(m, d) BOOST_PP_REPEAT_3_511(m, d) m(4, 511, d)
+#
+# endif
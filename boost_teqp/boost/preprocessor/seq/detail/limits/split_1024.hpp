@@ -0,0 +1,530 @@
+# /* **************************************************************************
+#  *                                                                          *
+#  *     (C) Copyright Paul Mensonides 2002.
+#  *     Distributed under the Boost Software License, Version 1.0. (See
+#  *     accompanying file LICENSE_1_0.txt or copy at
+#  *     http://www.boost.org/LICENSE_1_0.txt)
+#  *                                                                          *
+#  ************************************************************************** */
+#
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_SEQ_DETAIL_SPLIT_1024_HPP
+# define BOOST_PREPROCESSOR_SEQ_DETAIL_SPLIT_1024_HPP
+#
+# define BOOST_PP_SEQ_SPLIT_513(x) (x) BOOST_PP_SEQ_SPLIT_512
+# define BOOST_PP_SEQ_SPLIT_514(x) (x) BOOST_PP_SEQ_SPLIT_513
+# define BOOST_PP_SEQ_SPLIT_515(x) (x) BOOST_PP_SEQ_SPLIT_514
+# define BOOST_PP_SEQ_SPLIT_516(x) (x) BOOST_PP_SEQ_SPLIT_515
+# define BOOST_PP_SEQ_SPLIT_517(x) (x) BOOST_PP_SEQ_SPLIT_516
+# define BOOST_PP_SEQ_SPLIT_518(x) (x) BOOST_PP_SEQ_SPLIT_517
+# define BOOST_PP_SEQ_SPLIT_519(x) (x) BOOST_PP_SEQ_SPLIT_518
+# define BOOST_PP_SEQ_SPLIT_520(x) (x) BOOST_PP_SEQ_SPLIT_519
+# define BOOST_PP_SEQ_SPLIT_521(x) (x) BOOST_PP_SEQ_SPLIT_520
+# define BOOST_PP_SEQ_SPLIT_522(x) (x) BOOST_PP_SEQ_SPLIT_521
+# define BOOST_PP_SEQ_SPLIT_523(x) (x) BOOST_PP_SEQ_SPLIT_522
+# define BOOST_PP_SEQ_SPLIT_524(x) (x) BOOST_PP_SEQ_SPLIT_523
+# define BOOST_PP_SEQ_SPLIT_525(x) (x) BOOST_PP_SEQ_SPLIT_524
+# define BOOST_PP_SEQ_SPLIT_526(x) (x) BOOST_PP_SEQ_SPLIT_525
+# define BOOST_PP_SEQ_SPLIT_527(x) (x) BOOST_PP_SEQ_SPLIT_526
+# define BOOST_PP_SEQ_SPLIT_528(x) (x) BOOST_PP_SEQ_SPLIT_527
+# define BOOST_PP_SEQ_SPLIT_529(x) (x) BOOST_PP_SEQ_SPLIT_528
+# define BOOST_PP_SEQ_SPLIT_530(x) (x) BOOST_PP_SEQ_SPLIT_529
+# define BOOST_PP_SEQ_SPLIT_531(x) (x) BOOST_PP_SEQ_SPLIT_530
+# define BOOST_PP_SEQ_SPLIT_532(x) (x) BOOST_PP_SEQ_SPLIT_531
+# define BOOST_PP_SEQ_SPLIT_533(x) (x) BOOST_PP_SEQ_SPLIT_532
+# define BOOST_PP_SEQ_SPLIT_534(x) (x) BOOST_PP_SEQ_SPLIT_533
+# define BOOST_PP_SEQ_SPLIT_535(x) (x) BOOST_PP_SEQ_SPLIT_534
+# define BOOST_PP_SEQ_SPLIT_536(x) (x) BOOST_PP_SEQ_SPLIT_535
+# define BOOST_PP_SEQ_SPLIT_537(x) (x) BOOST_PP_SEQ_SPLIT_536
+# define BOOST_PP_SEQ_SPLIT_538(x) (x) BOOST_PP_SEQ_SPLIT_537
+# define BOOST_PP_SEQ_SPLIT_539(x) (x) BOOST_PP_SEQ_SPLIT_538
+# define BOOST_PP_SEQ_SPLIT_540(x) (x) BOOST_PP_SEQ_SPLIT_539
+# define BOOST_PP_SEQ_SPLIT_541(x) (x) BOOST_PP_SEQ_SPLIT_540
+# define BOOST_PP_SEQ_SPLIT_542(x) (x) BOOST_PP_SEQ_SPLIT_541
+# define BOOST_PP_SEQ_SPLIT_543(x) (x) BOOST_PP_SEQ_SPLIT_542
+# define BOOST_PP_SEQ_SPLIT_544(x) (x) BOOST_PP_SEQ_SPLIT_543
+# define BOOST_PP_SEQ_SPLIT_545(x) (x) BOOST_PP_SEQ_SPLIT_544
+# define BOOST_PP_SEQ_SPLIT_546(x) (x) BOOST_PP_SEQ_SPLIT_545
+# define BOOST_PP_SEQ_SPLIT_547(x) (x) BOOST_PP_SEQ_SPLIT_546
+# define BOOST_PP_SEQ_SPLIT_548(x) (x) BOOST_PP_SEQ_SPLIT_547
+# define BOOST_PP_SEQ_SPLIT_549(x) (x) BOOST_PP_SEQ_SPLIT_548
+# define BOOST_PP_SEQ_SPLIT_550(x) (x) BOOST_PP_SEQ_SPLIT_549
+# define BOOST_PP_SEQ_SPLIT_551(x) (x) BOOST_PP_SEQ_SPLIT_550
+# define BOOST_PP_SEQ_SPLIT_552(x) (x) BOOST_PP_SEQ_SPLIT_551
+# define BOOST_PP_SEQ_SPLIT_553(x) (x) BOOST_PP_SEQ_SPLIT_552
+# define BOOST_PP_SEQ_SPLIT_554(x) (x) BOOST_PP_SEQ_SPLIT_553
+# define BOOST_PP_SEQ_SPLIT_555(x) (x) BOOST_PP_SEQ_SPLIT_554
+# define BOOST_PP_SEQ_SPLIT_556(x) (x) BOOST_PP_SEQ_SPLIT_555
+# define BOOST_PP_SEQ_SPLIT_557(x) (x) BOOST_PP_SEQ_SPLIT_556
+# define BOOST_PP_SEQ_SPLIT_558(x) (x) BOOST_PP_SEQ_SPLIT_557
+# define BOOST_PP_SEQ_SPLIT_559(x) (x) BOOST_PP_SEQ_SPLIT_558
+# define BOOST_PP_SEQ_SPLIT_560(x) (x) BOOST_PP_SEQ_SPLIT_559
+# define BOOST_PP_SEQ_SPLIT_561(x) (x) BOOST_PP_SEQ_SPLIT_560
+# define BOOST_PP_SEQ_SPLIT_562(x) (x) BOOST_PP_SEQ_SPLIT_561
+# define BOOST_PP_SEQ_SPLIT_563(x) (x) BOOST_PP_SEQ_SPLIT_562
+# define BOOST_PP_SEQ_SPLIT_564(x) (x) BOOST_PP_SEQ_SPLIT_563
+# define BOOST_PP_SEQ_SPLIT_565(x) (x) BOOST_PP_SEQ_SPLIT_564
+# define BOOST_PP_SEQ_SPLIT_566(x) (x) BOOST_PP_SEQ_SPLIT_565
+# define BOOST_PP_SEQ_SPLIT_567(x) (x) BOOST_PP_SEQ_SPLIT_566
+# define BOOST_PP_SEQ_SPLIT_568(x) (x) BOOST_PP_SEQ_SPLIT_567
+# define BOOST_PP_SEQ_SPLIT_569(x) (x) BOOST_PP_SEQ_SPLIT_568
+# define BOOST_PP_SEQ_SPLIT_570(x) (x) BOOST_PP_SEQ_SPLIT_569
+# define BOOST_PP_SEQ_SPLIT_571(x) (x) BOOST_PP_SEQ_SPLIT_570
+# define BOOST_PP_SEQ_SPLIT_572(x) (x) BOOST_PP_SEQ_SPLIT_571
+# define BOOST_PP_SEQ_SPLIT_573(x) (x) BOOST_PP_SEQ_SPLIT_572
+# define BOOST_PP_SEQ_SPLIT_574(x) (x) BOOST_PP_SEQ_SPLIT_573
+# define BOOST_PP_SEQ_SPLIT_575(x) (x) BOOST_PP_SEQ_SPLIT_574
+# define BOOST_PP_SEQ_SPLIT_576(x) (x) BOOST_PP_SEQ_SPLIT_575
+# define BOOST_PP_SEQ_SPLIT_577(x) (x) BOOST_PP_SEQ_SPLIT_576
+# define BOOST_PP_SEQ_SPLIT_578(x) (x) BOOST_PP_SEQ_SPLIT_577
+# define BOOST_PP_SEQ_SPLIT_579(x) (x) BOOST_PP_SEQ_SPLIT_578
+# define BOOST_PP_SEQ_SPLIT_580(x) (x) BOOST_PP_SEQ_SPLIT_579
+# define BOOST_PP_SEQ_SPLIT_581(x) (x) BOOST_PP_SEQ_SPLIT_580
+# define BOOST_PP_SEQ_SPLIT_582(x) (x) BOOST_PP_SEQ_SPLIT_581
+# define BOOST_PP_SEQ_SPLIT_583(x) (x) BOOST_PP_SEQ_SPLIT_582
+# define BOOST_PP_SEQ_SPLIT_584(x) (x) BOOST_PP_SEQ_SPLIT_583
+# define BOOST_PP_SEQ_SPLIT_585(x) (x) BOOST_PP_SEQ_SPLIT_584
+# define BOOST_PP_SEQ_SPLIT_586(x) (x) BOOST_PP_SEQ_SPLIT_585
+# define BOOST_PP_SEQ_SPLIT_587(x) (x) BOOST_PP_SEQ_SPLIT_586
+# define BOOST_PP_SEQ_SPLIT_588(x) (x) BOOST_PP_SEQ_SPLIT_587
+# define BOOST_PP_SEQ_SPLIT_589(x) (x) BOOST_PP_SEQ_SPLIT_588
+# define BOOST_PP_SEQ_SPLIT_590(x) (x) BOOST_PP_SEQ_SPLIT_589
+# define BOOST_PP_SEQ_SPLIT_591(x) (x) BOOST_PP_SEQ_SPLIT_590
+# define BOOST_PP_SEQ_SPLIT_592(x) (x) BOOST_PP_SEQ_SPLIT_591
+# define BOOST_PP_SEQ_SPLIT_593(x) (x) BOOST_PP_SEQ_SPLIT_592
+# define BOOST_PP_SEQ_SPLIT_594(x) (x) BOOST_PP_SEQ_SPLIT_593
+# define BOOST_PP_SEQ_SPLIT_595(x) (x) BOOST_PP_SEQ_SPLIT_594
+# define BOOST_PP_SEQ_SPLIT_596(x) (x) BOOST_PP_SEQ_SPLIT_595
+# define BOOST_PP_SEQ_SPLIT_597(x) (x) BOOST_PP_SEQ_SPLIT_596
+# define BOOST_PP_SEQ_SPLIT_598(x) (x) BOOST_PP_SEQ_SPLIT_597
+# define BOOST_PP_SEQ_SPLIT_599(x) (x) BOOST_PP_SEQ_SPLIT_598
+# define BOOST_PP_SEQ_SPLIT_600(x) (x) BOOST_PP_SEQ_SPLIT_599
+# define BOOST_PP_SEQ_SPLIT_601(x) (x) BOOST_PP_SEQ_SPLIT_600
+# define BOOST_PP_SEQ_SPLIT_602(x) (x) BOOST_PP_SEQ_SPLIT_601
+# define BOOST_PP_SEQ_SPLIT_603(x) (x) BOOST_PP_SEQ_SPLIT_602
+# define BOOST_PP_SEQ_SPLIT_604(x) (x) BOOST_PP_SEQ_SPLIT_603
+# define BOOST_PP_SEQ_SPLIT_605(x) (x) BOOST_PP_SEQ_SPLIT_604
+# define BOOST_PP_SEQ_SPLIT_606(x) (x) BOOST_PP_SEQ_SPLIT_605
+# define BOOST_PP_SEQ_SPLIT_607(x) (x) BOOST_PP_SEQ_SPLIT_606
+# define BOOST_PP_SEQ_SPLIT_608(x) (x) BOOST_PP_SEQ_SPLIT_607
+# define BOOST_PP_SEQ_SPLIT_609(x) (x) BOOST_PP_SEQ_SPLIT_608
+# define BOOST_PP_SEQ_SPLIT_610(x) (x) BOOST_PP_SEQ_SPLIT_609
+# define BOOST_PP_SEQ_SPLIT_611(x) (x) BOOST_PP_SEQ_SPLIT_610
+# define BOOST_PP_SEQ_SPLIT_612(x) (x) BOOST_PP_SEQ_SPLIT_611
+# define BOOST_PP_SEQ_SPLIT_613(x) (x) BOOST_PP_SEQ_SPLIT_612
+# define BOOST_PP_SEQ_SPLIT_614(x) (x) BOOST_PP_SEQ_SPLIT_613
+# define BOOST_PP_SEQ_SPLIT_615(x) (x) BOOST_PP_SEQ_SPLIT_614
+# define BOOST_PP_SEQ_SPLIT_616(x) (x) BOOST_PP_SEQ_SPLIT_615
+# define BOOST_PP_SEQ_SPLIT_617(x) (x) BOOST_PP_SEQ_SPLIT_616
+# define BOOST_PP_SEQ_SPLIT_618(x) (x) BOOST_PP_SEQ_SPLIT_617
+# define BOOST_PP_SEQ_SPLIT_619(x) (x) BOOST_PP_SEQ_SPLIT_618
+# define BOOST_PP_SEQ_SPLIT_620(x) (x) BOOST_PP_SEQ_SPLIT_619
+# define BOOST_PP_SEQ_SPLIT_621(x) (x) BOOST_PP_SEQ_SPLIT_620
+# define BOOST_PP_SEQ_SPLIT_622(x) (x) BOOST_PP_SEQ_SPLIT_621
+# define BOOST_PP_SEQ_SPLIT_623(x) (x) BOOST_PP_SEQ_SPLIT_622
+# define BOOST_PP_SEQ_SPLIT_624(x) (x) BOOST_PP_SEQ_SPLIT_623
+# define BOOST_PP_SEQ_SPLIT_625(x) (x) BOOST_PP_SEQ_SPLIT_624
+# define BOOST_PP_SEQ_SPLIT_626(x) (x) BOOST_PP_SEQ_SPLIT_625
+# define BOOST_PP_SEQ_SPLIT_627(x) (x) BOOST_PP_SEQ_SPLIT_626
+# define BOOST_PP_SEQ_SPLIT_628(x) (x) BOOST_PP_SEQ_SPLIT_627
+# define BOOST_PP_SEQ_SPLIT_629(x) (x) BOOST_PP_SEQ_SPLIT_628
+# define BOOST_PP_SEQ_SPLIT_630(x) (x) BOOST_PP_SEQ_SPLIT_629
+# define BOOST_PP_SEQ_SPLIT_631(x) (x) BOOST_PP_SEQ_SPLIT_630
+# define BOOST_PP_SEQ_SPLIT_632(x) (x) BOOST_PP_SEQ_SPLIT_631
+# define BOOST_PP_SEQ_SPLIT_633(x) (x) BOOST_PP_SEQ_SPLIT_632
+# define BOOST_PP_SEQ_SPLIT_634(x) (x) BOOST_PP_SEQ_SPLIT_633
+# define BOOST_PP_SEQ_SPLIT_635(x) (x) BOOST_PP_SEQ_SPLIT_634
+# define BOOST_PP_SEQ_SPLIT_636(x) (x) BOOST_PP_SEQ_SPLIT_635
+# define BOOST_PP_SEQ_SPLIT_637(x) (x) BOOST_PP_SEQ_SPLIT_636
+# define BOOST_PP_SEQ_SPLIT_638(x) (x) BOOST_PP_SEQ_SPLIT_637
+# define BOOST_PP_SEQ_SPLIT_639(x) (x) BOOST_PP_SEQ_SPLIT_638
+# define BOOST_PP_SEQ_SPLIT_640(x) (x) BOOST_PP_SEQ_SPLIT_639
+# define BOOST_PP_SEQ_SPLIT_641(x) (x) BOOST_PP_SEQ_SPLIT_640
+# define BOOST_PP_SEQ_SPLIT_642(x) (x) BOOST_PP_SEQ_SPLIT_641
+# define BOOST_PP_SEQ_SPLIT_643(x) (x) BOOST_PP_SEQ_SPLIT_642
+# define BOOST_PP_SEQ_SPLIT_644(x) (x) BOOST_PP_SEQ_SPLIT_643
+# define BOOST_PP_SEQ_SPLIT_645(x) (x) BOOST_PP_SEQ_SPLIT_644
+# define BOOST_PP_SEQ_SPLIT_646(x) (x) BOOST_PP_SEQ_SPLIT_645
+# define BOOST_PP_SEQ_SPLIT_647(x) (x) BOOST_PP_SEQ_SPLIT_646
+# define BOOST_PP_SEQ_SPLIT_648(x) (x) BOOST_PP_SEQ_SPLIT_647
+# define BOOST_PP_SEQ_SPLIT_649(x) (x) BOOST_PP_SEQ_SPLIT_648
+# define BOOST_PP_SEQ_SPLIT_650(x) (x) BOOST_PP_SEQ_SPLIT_649
+# define BOOST_PP_SEQ_SPLIT_651(x) (x) BOOST_PP_SEQ_SPLIT_650
+# define BOOST_PP_SEQ_SPLIT_652(x) (x) BOOST_PP_SEQ_SPLIT_651
+# define BOOST_PP_SEQ_SPLIT_653(x) (x) BOOST_PP_SEQ_SPLIT_652
+# define BOOST_PP_SEQ_SPLIT_654(x) (x) BOOST_PP_SEQ_SPLIT_653
+# define BOOST_PP_SEQ_SPLIT_655(x) (x) BOOST_PP_SEQ_SPLIT_654
+# define BOOST_PP_SEQ_SPLIT_656(x) (x) BOOST_PP_SEQ_SPLIT_655
+# define BOOST_PP_SEQ_SPLIT_657(x) (x) BOOST_PP_SEQ_SPLIT_656
+# define BOOST_PP_SEQ_SPLIT_658(x) (x) BOOST_PP_SEQ_SPLIT_657
+# define BOOST_PP_SEQ_SPLIT_659(x) (x) BOOST_PP_SEQ_SPLIT_658
+# define BOOST_PP_SEQ_SPLIT_660(x) (x) BOOST_PP_SEQ_SPLIT_659
+# define BOOST_PP_SEQ_SPLIT_661(x) (x) BOOST_PP_SEQ_SPLIT_660
+# define BOOST_PP_SEQ_SPLIT_662(x) (x) BOOST_PP_SEQ_SPLIT_661
+# define BOOST_PP_SEQ_SPLIT_663(x) (x) BOOST_PP_SEQ_SPLIT_662
+# define BOOST_PP_SEQ_SPLIT_664(x) (x) BOOST_PP_SEQ_SPLIT_663
+# define BOOST_PP_SEQ_SPLIT_665(x) (x) BOOST_PP_SEQ_SPLIT_664
+# define BOOST_PP_SEQ_SPLIT_666(x) (x) BOOST_PP_SEQ_SPLIT_665
+# define BOOST_PP_SEQ_SPLIT_667(x) (x) BOOST_PP_SEQ_SPLIT_666
+# define BOOST_PP_SEQ_SPLIT_668(x) (x) BOOST_PP_SEQ_SPLIT_667
+# define BOOST_PP_SEQ_SPLIT_669(x) (x) BOOST_PP_SEQ_SPLIT_668
+# define BOOST_PP_SEQ_SPLIT_670(x) (x) BOOST_PP_SEQ_SPLIT_669
+# define BOOST_PP_SEQ_SPLIT_671(x) (x) BOOST_PP_SEQ_SPLIT_670
+# define BOOST_PP_SEQ_SPLIT_672(x) (x) BOOST_PP_SEQ_SPLIT_671
+# define BOOST_PP_SEQ_SPLIT_673(x) (x) BOOST_PP_SEQ_SPLIT_672
+# define BOOST_PP_SEQ_SPLIT_674(x) (x) BOOST_PP_SEQ_SPLIT_673
+# define BOOST_PP_SEQ_SPLIT_675(x) (x) BOOST_PP_SEQ_SPLIT_674
+# define BOOST_PP_SEQ_SPLIT_676(x) (x) BOOST_PP_SEQ_SPLIT_675
+# define BOOST_PP_SEQ_SPLIT_677(x) (x) BOOST_PP_SEQ_SPLIT_676
+# define BOOST_PP_SEQ_SPLIT_678(x) (x) BOOST_PP_SEQ_SPLIT_677
+# define BOOST_PP_SEQ_SPLIT_679(x) (x) BOOST_PP_SEQ_SPLIT_678
+# define BOOST_PP_SEQ_SPLIT_680(x) (x) BOOST_PP_SEQ_SPLIT_679
+# define BOOST_PP_SEQ_SPLIT_681(x) (x) BOOST_PP_SEQ_SPLIT_680
+# define BOOST_PP_SEQ_SPLIT_682(x) (x) BOOST_PP_SEQ_SPLIT_681
+# define BOOST_PP_SEQ_SPLIT_683(x) (x) BOOST_PP_SEQ_SPLIT_682
+# define BOOST_PP_SEQ_SPLIT_684(x) (x) BOOST_PP_SEQ_SPLIT_683
+# define BOOST_PP_SEQ_SPLIT_685(x) (x) BOOST_PP_SEQ_SPLIT_684
+# define BOOST_PP_SEQ_SPLIT_686(x) (x) BOOST_PP_SEQ_SPLIT_685
+# define BOOST_PP_SEQ_SPLIT_687(x) (x) BOOST_PP_SEQ_SPLIT_686
+# define BOOST_PP_SEQ_SPLIT_688(x) (x) BOOST_PP_SEQ_SPLIT_687
+# define BOOST_PP_SEQ_SPLIT_689(x) (x) BOOST_PP_SEQ_SPLIT_688
+# define BOOST_PP_SEQ_SPLIT_690(x) (x) BOOST_PP_SEQ_SPLIT_689
+# define BOOST_PP_SEQ_SPLIT_691(x) (x) BOOST_PP_SEQ_SPLIT_690
+# define BOOST_PP_SEQ_SPLIT_692(x) (x) BOOST_PP_SEQ_SPLIT_691
+# define BOOST_PP_SEQ_SPLIT_693(x) (x) BOOST_PP_SEQ_SPLIT_692
+# define BOOST_PP_SEQ_SPLIT_694(x) (x) BOOST_PP_SEQ_SPLIT_693
+# define BOOST_PP_SEQ_SPLIT_695(x) (x) BOOST_PP_SEQ_SPLIT_694
+# define BOOST_PP_SEQ_SPLIT_696(x) (x) BOOST_PP_SEQ_SPLIT_695
+# define BOOST_PP_SEQ_SPLIT_697(x) (x) BOOST_PP_SEQ_SPLIT_696
+# define BOOST_PP_SEQ_SPLIT_698(x) (x) BOOST_PP_SEQ_SPLIT_697
+# define BOOST_PP_SEQ_SPLIT_699(x) (x) BOOST_PP_SEQ_SPLIT_698
+# define BOOST_PP_SEQ_SPLIT_700(x) (x) BOOST_PP_SEQ_SPLIT_699
+# define BOOST_PP_SEQ_SPLIT_701(x) (x) BOOST_PP_SEQ_SPLIT_700
+# define BOOST_PP_SEQ_SPLIT_702(x) (x) BOOST_PP_SEQ_SPLIT_701
+# define BOOST_PP_SEQ_SPLIT_703(x) (x) BOOST_PP_SEQ_SPLIT_702
+# define BOOST_PP_SEQ_SPLIT_704(x) (x) BOOST_PP_SEQ_SPLIT_703
+# define BOOST_PP_SEQ_SPLIT_705(x) (x) BOOST_PP_SEQ_SPLIT_704
+# define BOOST_PP_SEQ_SPLIT_706(x) (x) BOOST_PP_SEQ_SPLIT_705
+# define BOOST_PP_SEQ_SPLIT_707(x) (x) BOOST_PP_SEQ_SPLIT_706
+# define BOOST_PP_SEQ_SPLIT_708(x) (x) BOOST_PP_SEQ_SPLIT_707
+# define BOOST_PP_SEQ_SPLIT_709(x) (x) BOOST_PP_SEQ_SPLIT_708
+# define BOOST_PP_SEQ_SPLIT_710(x) (x) BOOST_PP_SEQ_SPLIT_709
+# define BOOST_PP_SEQ_SPLIT_711(x) (x) BOOST_PP_SEQ_SPLIT_710
+# define BOOST_PP_SEQ_SPLIT_712(x) (x) BOOST_PP_SEQ_SPLIT_711
+# define BOOST_PP_SEQ_SPLIT_713(x) (x) BOOST_PP_SEQ_SPLIT_712
+# define BOOST_PP_SEQ_SPLIT_714(x) (x) BOOST_PP_SEQ_SPLIT_713
+# define BOOST_PP_SEQ_SPLIT_715(x) (x) BOOST_PP_SEQ_SPLIT_714
+# define BOOST_PP_SEQ_SPLIT_716(x) (x) BOOST_PP_SEQ_SPLIT_715
+# define BOOST_PP_SEQ_SPLIT_717(x) (x) BOOST_PP_SEQ_SPLIT_716
+# define BOOST_PP_SEQ_SPLIT_718(x) (x) BOOST_PP_SEQ_SPLIT_717
+# define BOOST_PP_SEQ_SPLIT_719(x) (x) BOOST_PP_SEQ_SPLIT_718
+# define BOOST_PP_SEQ_SPLIT_720(x) (x) BOOST_PP_SEQ_SPLIT_719
+# define BOOST_PP_SEQ_SPLIT_721(x) (x) BOOST_PP_SEQ_SPLIT_720
+# define BOOST_PP_SEQ_SPLIT_722(x) (x) BOOST_PP_SEQ_SPLIT_721
+# define BOOST_PP_SEQ_SPLIT_723(x) (x) BOOST_PP_SEQ_SPLIT_722
+# define BOOST_PP_SEQ_SPLIT_724(x) (x) BOOST_PP_SEQ_SPLIT_723
+# define BOOST_PP_SEQ_SPLIT_725(x) (x) BOOST_PP_SEQ_SPLIT_724
+# define BOOST_PP_SEQ_SPLIT_726(x) (x) BOOST_PP_SEQ_SPLIT_725
+# define BOOST_PP_SEQ_SPLIT_727(x) (x) BOOST_PP_SEQ_SPLIT_726
+# define BOOST_PP_SEQ_SPLIT_728(x) (x) BOOST_PP_SEQ_SPLIT_727
+# define BOOST_PP_SEQ_SPLIT_729(x) (x) BOOST_PP_SEQ_SPLIT_728
+# define BOOST_PP_SEQ_SPLIT_730(x) (x) BOOST_PP_SEQ_SPLIT_729
+# define BOOST_PP_SEQ_SPLIT_731(x) (x) BOOST_PP_SEQ_SPLIT_730
+# define BOOST_PP_SEQ_SPLIT_732(x) (x) BOOST_PP_SEQ_SPLIT_731
+# define BOOST_PP_SEQ_SPLIT_733(x) (x) BOOST_PP_SEQ_SPLIT_732
+# define BOOST_PP_SEQ_SPLIT_734(x) (x) BOOST_PP_SEQ_SPLIT_733
+# define BOOST_PP_SEQ_SPLIT_735(x) (x) BOOST_PP_SEQ_SPLIT_734
+# define BOOST_PP_SEQ_SPLIT_736(x) (x) BOOST_PP_SEQ_SPLIT_735
+# define BOOST_PP_SEQ_SPLIT_737(x) (x) BOOST_PP_SEQ_SPLIT_736
+# define BOOST_PP_SEQ_SPLIT_738(x) (x) BOOST_PP_SEQ_SPLIT_737
+# define BOOST_PP_SEQ_SPLIT_739(x) (x) BOOST_PP_SEQ_SPLIT_738
+# define BOOST_PP_SEQ_SPLIT_740(x) (x) BOOST_PP_SEQ_SPLIT_739
+# define BOOST_PP_SEQ_SPLIT_741(x) (x) BOOST_PP_SEQ_SPLIT_740
+# define BOOST_PP_SEQ_SPLIT_742(x) (x) BOOST_PP_SEQ_SPLIT_741
+# define BOOST_PP_SEQ_SPLIT_743(x) (x) BOOST_PP_SEQ_SPLIT_742
+# define BOOST_PP_SEQ_SPLIT_744(x) (x) BOOST_PP_SEQ_SPLIT_743
+# define BOOST_PP_SEQ_SPLIT_745(x) (x) BOOST_PP_SEQ_SPLIT_744
+# define BOOST_PP_SEQ_SPLIT_746(x) (x) BOOST_PP_SEQ_SPLIT_745
+# define BOOST_PP_SEQ_SPLIT_747(x) (x) BOOST_PP_SEQ_SPLIT_746
+# define BOOST_PP_SEQ_SPLIT_748(x) (x) BOOST_PP_SEQ_SPLIT_747
+# define BOOST_PP_SEQ_SPLIT_749(x) (x) BOOST_PP_SEQ_SPLIT_748
+# define BOOST_PP_SEQ_SPLIT_750(x) (x) BOOST_PP_SEQ_SPLIT_749
+# define BOOST_PP_SEQ_SPLIT_751(x) (x) BOOST_PP_SEQ_SPLIT_750
+# define BOOST_PP_SEQ_SPLIT_752(x) (x) BOOST_PP_SEQ_SPLIT_751
+# define BOOST_PP_SEQ_SPLIT_753(x) (x) BOOST_PP_SEQ_SPLIT_752
+# define BOOST_PP_SEQ_SPLIT_754(x) (x) BOOST_PP_SEQ_SPLIT_753
+# define BOOST_PP_SEQ_SPLIT_755(x) (x) BOOST_PP_SEQ_SPLIT_754
+# define BOOST_PP_SEQ_SPLIT_756(x) (x) BOOST_PP_SEQ_SPLIT_755
+# define BOOST_PP_SEQ_SPLIT_757(x) (x) BOOST_PP_SEQ_SPLIT_756
+# define BOOST_PP_SEQ_SPLIT_758(x) (x) BOOST_PP_SEQ_SPLIT_757
+# define BOOST_PP_SEQ_SPLIT_759(x) (x) BOOST_PP_SEQ_SPLIT_758
+# define BOOST_PP_SEQ_SPLIT_760(x) (x) BOOST_PP_SEQ_SPLIT_759
+# define BOOST_PP_SEQ_SPLIT_761(x) (x) BOOST_PP_SEQ_SPLIT_760
+# define BOOST_PP_SEQ_SPLIT_762(x) (x) BOOST_PP_SEQ_SPLIT_761
+# define BOOST_PP_SEQ_SPLIT_763(x) (x) BOOST_PP_SEQ_SPLIT_762
+# define BOOST_PP_SEQ_SPLIT_764(x) (x) BOOST_PP_SEQ_SPLIT_763
+# define BOOST_PP_SEQ_SPLIT_765(x) (x) BOOST_PP_SEQ_SPLIT_764
+# define BOOST_PP_SEQ_SPLIT_766(x) (x) BOOST_PP_SEQ_SPLIT_765
+# define BOOST_PP_SEQ_SPLIT_767(x) (x) BOOST_PP_SEQ_SPLIT_766
+# define BOOST_PP_SEQ_SPLIT_768(x) (x) BOOST_PP_SEQ_SPLIT_767
+# define BOOST_PP_SEQ_SPLIT_769(x) (x) BOOST_PP_SEQ_SPLIT_768
+# define BOOST_PP_SEQ_SPLIT_770(x) (x) BOOST_PP_SEQ_SPLIT_769
+# define BOOST_PP_SEQ_SPLIT_771(x) (x) BOOST_PP_SEQ_SPLIT_770
+# define BOOST_PP_SEQ_SPLIT_772(x) (x) BOOST_PP_SEQ_SPLIT_771
+# define BOOST_PP_SEQ_SPLIT_773(x) (x) BOOST_PP_SEQ_SPLIT_772
+# define BOOST_PP_SEQ_SPLIT_774(x) (x) BOOST_PP_SEQ_SPLIT_773
+# define BOOST_PP_SEQ_SPLIT_775(x) (x) BOOST_PP_SEQ_SPLIT_774
+# define BOOST_PP_SEQ_SPLIT_776(x) (x) BOOST_PP_SEQ_SPLIT_775
+# define BOOST_PP_SEQ_SPLIT_777(x) (x) BOOST_PP_SEQ_SPLIT_776
+# define BOOST_PP_SEQ_SPLIT_778(x) (x) BOOST_PP_SEQ_SPLIT_777
+# define BOOST_PP_SEQ_SPLIT_779(x) (x) BOOST_PP_SEQ_SPLIT_778
+# define BOOST_PP_SEQ_SPLIT_780(x) (x) BOOST_PP_SEQ_SPLIT_779
+# define BOOST_PP_SEQ_SPLIT_781(x) (x) BOOST_PP_SEQ_SPLIT_780
+# define BOOST_PP_SEQ_SPLIT_782(x) (x) BOOST_PP_SEQ_SPLIT_781
+# define BOOST_PP_SEQ_SPLIT_783(x) (x) BOOST_PP_SEQ_SPLIT_782
+# define BOOST_PP_SEQ_SPLIT_784(x) (x) BOOST_PP_SEQ_SPLIT_783
+# define BOOST_PP_SEQ_SPLIT_785(x) (x) BOOST_PP_SEQ_SPLIT_784
+# define BOOST_PP_SEQ_SPLIT_786(x) (x) BOOST_PP_SEQ_SPLIT_785
+# define BOOST_PP_SEQ_SPLIT_787(x) (x) BOOST_PP_SEQ_SPLIT_786
+# define BOOST_PP_SEQ_SPLIT_788(x) (x) BOOST_PP_SEQ_SPLIT_787
+# define BOOST_PP_SEQ_SPLIT_789(x) (x) BOOST_PP_SEQ_SPLIT_788
+# define BOOST_PP_SEQ_SPLIT_790(x) (x) BOOST_PP_SEQ_SPLIT_789
+# define BOOST_PP_SEQ_SPLIT_791(x) (x) BOOST_PP_SEQ_SPLIT_790
+# define BOOST_PP_SEQ_SPLIT_792(x) (x) BOOST_PP_SEQ_SPLIT_791
+# define BOOST_PP_SEQ_SPLIT_793(x) (x) BOOST_PP_SEQ_SPLIT_792
+# define BOOST_PP_SEQ_SPLIT_794(x) (x) BOOST_PP_SEQ_SPLIT_793
+# define BOOST_PP_SEQ_SPLIT_795(x) (x) BOOST_PP_SEQ_SPLIT_794
+# define BOOST_PP_SEQ_SPLIT_796(x) (x) BOOST_PP_SEQ_SPLIT_795
+# define BOOST_PP_SEQ_SPLIT_797(x) (x) BOOST_PP_SEQ_SPLIT_796
+# define BOOST_PP_SEQ_SPLIT_798(x) (x) BOOST_PP_SEQ_SPLIT_797
+# define BOOST_PP_SEQ_SPLIT_799(x) (x) BOOST_PP_SEQ_SPLIT_798
+# define BOOST_PP_SEQ_SPLIT_800(x) (x) BOOST_PP_SEQ_SPLIT_799
+# define BOOST_PP_SEQ_SPLIT_801(x) (x) BOOST_PP_SEQ_SPLIT_800
+# define BOOST_PP_SEQ_SPLIT_802(x) (x) BOOST_PP_SEQ_SPLIT_801
+# define BOOST_PP_SEQ_SPLIT_803(x) (x) BOOST_PP_SEQ_SPLIT_802
+# define BOOST_PP_SEQ_SPLIT_804(x) (x) BOOST_PP_SEQ_SPLIT_803
+# define BOOST_PP_SEQ_SPLIT_805(x) (x) BOOST_PP_SEQ_SPLIT_804
+# define BOOST_PP_SEQ_SPLIT_806(x) (x) BOOST_PP_SEQ_SPLIT_805
+# define BOOST_PP_SEQ_SPLIT_807(x) (x) BOOST_PP_SEQ_SPLIT_806
+# define BOOST_PP_SEQ_SPLIT_808(x) (x) BOOST_PP_SEQ_SPLIT_807
+# define BOOST_PP_SEQ_SPLIT_809(x) (x) BOOST_PP_SEQ_SPLIT_808
+# define BOOST_PP_SEQ_SPLIT_810(x) (x) BOOST_PP_SEQ_SPLIT_809
+# define BOOST_PP_SEQ_SPLIT_811(x) (x) BOOST_PP_SEQ_SPLIT_810
+# define BOOST_PP_SEQ_SPLIT_812(x) (x) BOOST_PP_SEQ_SPLIT_811
+# define BOOST_PP_SEQ_SPLIT_813(x) (x) BOOST_PP_SEQ_SPLIT_812
+# define BOOST_PP_SEQ_SPLIT_814(x) (x) BOOST_PP_SEQ_SPLIT_813
+# define BOOST_PP_SEQ_SPLIT_815(x) (x) BOOST_PP_SEQ_SPLIT_814
+# define BOOST_PP_SEQ_SPLIT_816(x) (x) BOOST_PP_SEQ_SPLIT_815
+# define BOOST_PP_SEQ_SPLIT_817(x) (x) BOOST_PP_SEQ_SPLIT_816
+# define BOOST_PP_SEQ_SPLIT_818(x) (x) BOOST_PP_SEQ_SPLIT_817
+# define BOOST_PP_SEQ_SPLIT_819(x) (x) BOOST_PP_SEQ_SPLIT_818
+# define BOOST_PP_SEQ_SPLIT_820(x) (x) BOOST_PP_SEQ_SPLIT_819
+# define BOOST_PP_SEQ_SPLIT_821(x) (x) BOOST_PP_SEQ_SPLIT_820
+# define BOOST_PP_SEQ_SPLIT_822(x) (x) BOOST_PP_SEQ_SPLIT_821
+# define BOOST_PP_SEQ_SPLIT_823(x) (x) BOOST_PP_SEQ_SPLIT_822
+# define BOOST_PP_SEQ_SPLIT_824(x) (x) BOOST_PP_SEQ_SPLIT_823
+# define BOOST_PP_SEQ_SPLIT_825(x) (x) BOOST_PP_SEQ_SPLIT_824
+# define BOOST_PP_SEQ_SPLIT_826(x) (x) BOOST_PP_SEQ_SPLIT_825
+# define BOOST_PP_SEQ_SPLIT_827(x) (x) BOOST_PP_SEQ_SPLIT_826
+# define BOOST_PP_SEQ_SPLIT_828(x) (x) BOOST_PP_SEQ_SPLIT_827
+# define BOOST_PP_SEQ_SPLIT_829(x) (x) BOOST_PP_SEQ_SPLIT_828
+# define BOOST_PP_SEQ_SPLIT_830(x) (x) BOOST_PP_SEQ_SPLIT_829
+# define BOOST_PP_SEQ_SPLIT_831(x) (x) BOOST_PP_SEQ_SPLIT_830
+# define BOOST_PP_SEQ_SPLIT_832(x) (x) BOOST_PP_SEQ_SPLIT_831
+# define BOOST_PP_SEQ_SPLIT_833(x) (x) BOOST_PP_SEQ_SPLIT_832
+# define BOOST_PP_SEQ_SPLIT_834(x) (x) BOOST_PP_SEQ_SPLIT_833
+# define BOOST_PP_SEQ_SPLIT_835(x) (x) BOOST_PP_SEQ_SPLIT_834
+# define BOOST_PP_SEQ_SPLIT_836(x) (x) BOOST_PP_SEQ_SPLIT_835
+# define BOOST_PP_SEQ_SPLIT_837(x) (x) BOOST_PP_SEQ_SPLIT_836
+# define BOOST_PP_SEQ_SPLIT_838(x) (x) BOOST_PP_SEQ_SPLIT_837
+# define BOOST_PP_SEQ_SPLIT_839(x) (x) BOOST_PP_SEQ_SPLIT_838
+# define BOOST_PP_SEQ_SPLIT_840(x) (x) BOOST_PP_SEQ_SPLIT_839
+# define BOOST_PP_SEQ_SPLIT_841(x) (x) BOOST_PP_SEQ_SPLIT_840
+# define BOOST_PP_SEQ_SPLIT_842(x) (x) BOOST_PP_SEQ_SPLIT_841
+# define BOOST_PP_SEQ_SPLIT_843(x) (x) BOOST_PP_SEQ_SPLIT_842
+# define BOOST_PP_SEQ_SPLIT_844(x) (x) BOOST_PP_SEQ_SPLIT_843
+# define BOOST_PP_SEQ_SPLIT_845(x) (x) BOOST_PP_SEQ_SPLIT_844
+# define BOOST_PP_SEQ_SPLIT_846(x) (x) BOOST_PP_SEQ_SPLIT_845
+# define BOOST_PP_SEQ_SPLIT_847(x) (x) BOOST_PP_SEQ_SPLIT_846
+# define BOOST_PP_SEQ_SPLIT_848(x) (x) BOOST_PP_SEQ_SPLIT_847
+# define BOOST_PP_SEQ_SPLIT_849(x) (x) BOOST_PP_SEQ_SPLIT_848
+# define BOOST_PP_SEQ_SPLIT_850(x) (x) BOOST_PP_SEQ_SPLIT_849
+# define BOOST_PP_SEQ_SPLIT_851(x) (x) BOOST_PP_SEQ_SPLIT_850
+# define BOOST_PP_SEQ_SPLIT_852(x) (x) BOOST_PP_SEQ_SPLIT_851
+# define BOOST_PP_SEQ_SPLIT_853(x) (x) BOOST_PP_SEQ_SPLIT_852
+# define BOOST_PP_SEQ_SPLIT_854(x) (x) BOOST_PP_SEQ_SPLIT_853
+# define BOOST_PP_SEQ_SPLIT_855(x) (x) BOOST_PP_SEQ_SPLIT_854
+# define BOOST_PP_SEQ_SPLIT_856(x) (x) BOOST_PP_SEQ_SPLIT_855
+# define BOOST_PP_SEQ_SPLIT_857(x) (x) BOOST_PP_SEQ_SPLIT_856
+# define BOOST_PP_SEQ_SPLIT_858(x) (x) BOOST_PP_SEQ_SPLIT_857
+# define BOOST_PP_SEQ_SPLIT_859(x) (x) BOOST_PP_SEQ_SPLIT_858
+# define BOOST_PP_SEQ_SPLIT_860(x) (x) BOOST_PP_SEQ_SPLIT_859
+# define BOOST_PP_SEQ_SPLIT_861(x) (x) BOOST_PP_SEQ_SPLIT_860
+# define BOOST_PP_SEQ_SPLIT_862(x) (x) BOOST_PP_SEQ_SPLIT_861
+# define BOOST_PP_SEQ_SPLIT_863(x) (x) BOOST_PP_SEQ_SPLIT_862
+# define BOOST_PP_SEQ_SPLIT_864(x) (x) BOOST_PP_SEQ_SPLIT_863
+# define BOOST_PP_SEQ_SPLIT_865(x) (x) BOOST_PP_SEQ_SPLIT_864
+# define BOOST_PP_SEQ_SPLIT_866(x) (x) BOOST_PP_SEQ_SPLIT_865
+# define BOOST_PP_SEQ_SPLIT_867(x) (x) BOOST_PP_SEQ_SPLIT_866
+# define BOOST_PP_SEQ_SPLIT_868(x) (x) BOOST_PP_SEQ_SPLIT_867
+# define BOOST_PP_SEQ_SPLIT_869(x) (x) BOOST_PP_SEQ_SPLIT_868
+# define BOOST_PP_SEQ_SPLIT_870(x) (x) BOOST_PP_SEQ_SPLIT_869
+# define BOOST_PP_SEQ_SPLIT_871(x) (x) BOOST_PP_SEQ_SPLIT_870
+# define BOOST_PP_SEQ_SPLIT_872(x) (x) BOOST_PP_SEQ_SPLIT_871
+# define BOOST_PP_SEQ_SPLIT_873(x) (x) BOOST_PP_SEQ_SPLIT_872
+# define BOOST_PP_SEQ_SPLIT_874(x) (x) BOOST_PP_SEQ_SPLIT_873
+# define BOOST_PP_SEQ_SPLIT_875(x) (x) BOOST_PP_SEQ_SPLIT_874
+# define BOOST_PP_SEQ_SPLIT_876(x) (x) BOOST_PP_SEQ_SPLIT_875
+# define BOOST_PP_SEQ_SPLIT_877(x) (x) BOOST_PP_SEQ_SPLIT_876
+# define BOOST_PP_SEQ_SPLIT_878(x) (x) BOOST_PP_SEQ_SPLIT_877
+# define BOOST_PP_SEQ_SPLIT_879(x) (x) BOOST_PP_SEQ_SPLIT_878
+# define BOOST_PP_SEQ_SPLIT_880(x) (x) BOOST_PP_SEQ_SPLIT_879
+# define BOOST_PP_SEQ_SPLIT_881(x) (x) BOOST_PP_SEQ_SPLIT_880
+# define BOOST_PP_SEQ_SPLIT_882(x) (x) BOOST_PP_SEQ_SPLIT_881
+# define BOOST_PP_SEQ_SPLIT_883(x) (x) BOOST_PP_SEQ_SPLIT_882
+# define BOOST_PP_SEQ_SPLIT_884(x) (x) BOOST_PP_SEQ_SPLIT_883
+# define BOOST_PP_SEQ_SPLIT_885(x) (x) BOOST_PP_SEQ_SPLIT_884
+# define BOOST_PP_SEQ_SPLIT_886(x) (x) BOOST_PP_SEQ_SPLIT_885
+# define BOOST_PP_SEQ_SPLIT_887(x) (x) BOOST_PP_SEQ_SPLIT_886
+# define BOOST_PP_SEQ_SPLIT_888(x) (x) BOOST_PP_SEQ_SPLIT_887
+# define BOOST_PP_SEQ_SPLIT_889(x) (x) BOOST_PP_SEQ_SPLIT_888
+# define BOOST_PP_SEQ_SPLIT_890(x) (x) BOOST_PP_SEQ_SPLIT_889
+# define BOOST_PP_SEQ_SPLIT_891(x) (x) BOOST_PP_SEQ_SPLIT_890
+# define BOOST_PP_SEQ_SPLIT_892(x) (x) BOOST_PP_SEQ_SPLIT_891
+# define BOOST_PP_SEQ_SPLIT_893(x) (x) BOOST_PP_SEQ_SPLIT_892
+# define BOOST_PP_SEQ_SPLIT_894(x) (x) BOOST_PP_SEQ_SPLIT_893
+# define BOOST_PP_SEQ_SPLIT_895(x) (x) BOOST_PP_SEQ_SPLIT_894
+# define BOOST_PP_SEQ_SPLIT_896(x) (x) BOOST_PP_SEQ_SPLIT_895
+# define BOOST_PP_SEQ_SPLIT_897(x) (x) BOOST_PP_SEQ_SPLIT_896
+# define BOOST_PP_SEQ_SPLIT_898(x) (x) BOOST_PP_SEQ_SPLIT_897
+# define BOOST_PP_SEQ_SPLIT_899(x) (x) BOOST_PP_SEQ_SPLIT_898
+# define BOOST_PP_SEQ_SPLIT_900(x) (x) BOOST_PP_SEQ_SPLIT_899
+# define BOOST_PP_SEQ_SPLIT_901(x) (x) BOOST_PP_SEQ_SPLIT_900
+# define BOOST_PP_SEQ_SPLIT_902(x) (x) BOOST_PP_SEQ_SPLIT_901
+# define BOOST_PP_SEQ_SPLIT_903(x) (x) BOOST_PP_SEQ_SPLIT_902
+# define BOOST_PP_SEQ_SPLIT_904(x) (x) BOOST_PP_SEQ_SPLIT_903
+# define BOOST_PP_SEQ_SPLIT_905(x) (x) BOOST_PP_SEQ_SPLIT_904
+# define BOOST_PP_SEQ_SPLIT_906(x) (x) BOOST_PP_SEQ_SPLIT_905
+# define BOOST_PP_SEQ_SPLIT_907(x) (x) BOOST_PP_SEQ_SPLIT_906
+# define BOOST_PP_SEQ_SPLIT_908(x) (x) BOOST_PP_SEQ_SPLIT_907
+# define BOOST_PP_SEQ_SPLIT_909(x) (x) BOOST_PP_SEQ_SPLIT_908
+# define BOOST_PP_SEQ_SPLIT_910(x) (x) BOOST_PP_SEQ_SPLIT_909
+# define BOOST_PP_SEQ_SPLIT_911(x) (x) BOOST_PP_SEQ_SPLIT_910
+# define BOOST_PP_SEQ_SPLIT_912(x) (x) BOOST_PP_SEQ_SPLIT_911
+# define BOOST_PP_SEQ_SPLIT_913(x) (x) BOOST_PP_SEQ_SPLIT_912
+# define BOOST_PP_SEQ_SPLIT_914(x) (x) BOOST_PP_SEQ_SPLIT_913
+# define BOOST_PP_SEQ_SPLIT_915(x) (x) BOOST_PP_SEQ_SPLIT_914
+# define BOOST_PP_SEQ_SPLIT_916(x) (x) BOOST_PP_SEQ_SPLIT_915
+# define BOOST_PP_SEQ_SPLIT_917(x) (x) BOOST_PP_SEQ_SPLIT_916
+# define BOOST_PP_SEQ_SPLIT_918(x) (x) BOOST_PP_SEQ_SPLIT_917
+# define BOOST_PP_SEQ_SPLIT_919(x) (x) BOOST_PP_SEQ_SPLIT_918
+# define BOOST_PP_SEQ_SPLIT_920(x) (x) BOOST_PP_SEQ_SPLIT_919
+# define BOOST_PP_SEQ_SPLIT_921(x) (x) BOOST_PP_SEQ_SPLIT_920
+# define BOOST_PP_SEQ_SPLIT_922(x) (x) BOOST_PP_SEQ_SPLIT_921
+# define BOOST_PP_SEQ_SPLIT_923(x) (x) BOOST_PP_SEQ_SPLIT_922
+# define BOOST_PP_SEQ_SPLIT_924(x) (x) BOOST_PP_SEQ_SPLIT_923
+# define BOOST_PP_SEQ_SPLIT_925(x) (x) BOOST_PP_SEQ_SPLIT_924
+# define BOOST_PP_SEQ_SPLIT_926(x) (x) BOOST_PP_SEQ_SPLIT_925
+# define BOOST_PP_SEQ_SPLIT_927(x) (x) BOOST_PP_SEQ_SPLIT_926
+# define BOOST_PP_SEQ_SPLIT_928(x) (x) BOOST_PP_SEQ_SPLIT_927
+# define BOOST_PP_SEQ_SPLIT_929(x) (x) BOOST_PP_SEQ_SPLIT_928
+# define BOOST_PP_SEQ_SPLIT_930(x) (x) BOOST_PP_SEQ_SPLIT_929
+# define BOOST_PP_SEQ_SPLIT_931(x) (x) BOOST_PP_SEQ_SPLIT_930
+# define BOOST_PP_SEQ_SPLIT_932(x) (x) BOOST_PP_SEQ_SPLIT_931
+# define BOOST_PP_SEQ_SPLIT_933(x) (x) BOOST_PP_SEQ_SPLIT_932
+# define BOOST_PP_SEQ_SPLIT_934(x) (x) BOOST_PP_SEQ_SPLIT_933
+# define BOOST_PP_SEQ_SPLIT_935(x) (x) BOOST_PP_SEQ_SPLIT_934
+# define BOOST_PP_SEQ_SPLIT_936(x) (x) BOOST_PP_SEQ_SPLIT_935
+# define BOOST_PP_SEQ_SPLIT_937(x) (x) BOOST_PP_SEQ_SPLIT_936
+# define BOOST_PP_SEQ_SPLIT_938(x) (x) BOOST_PP_SEQ_SPLIT_937
+# define BOOST_PP_SEQ_SPLIT_939(x) (x) BOOST_PP_SEQ_SPLIT_938
+# define BOOST_PP_SEQ_SPLIT_940(x) (x) BOOST_PP_SEQ_SPLIT_939
+# define BOOST_PP_SEQ_SPLIT_941(x) (x) BOOST_PP_SEQ_SPLIT_940
+# define BOOST_PP_SEQ_SPLIT_942(x) (x) BOOST_PP_SEQ_SPLIT_941
+# define BOOST_PP_SEQ_SPLIT_943(x) (x) BOOST_PP_SEQ_SPLIT_942
+# define BOOST_PP_SEQ_SPLIT_944(x) (x) BOOST_PP_SEQ_SPLIT_943
+# define BOOST_PP_SEQ_SPLIT_945(x) (x) BOOST_PP_SEQ_SPLIT_944
+# define BOOST_PP_SEQ_SPLIT_946(x) (x) BOOST_PP_SEQ_SPLIT_945
+# define BOOST_PP_SEQ_SPLIT_947(x) (x) BOOST_PP_SEQ_SPLIT_946
+# define BOOST_PP_SEQ_SPLIT_948(x) (x) BOOST_PP_SEQ_SPLIT_947
+# define BOOST_PP_SEQ_SPLIT_949(x) (x) BOOST_PP_SEQ_SPLIT_948
+# define BOOST_PP_SEQ_SPLIT_950(x) (x) BOOST_PP_SEQ_SPLIT_949
+# define BOOST_PP_SEQ_SPLIT_951(x) (x) BOOST_PP_SEQ_SPLIT_950
+# define BOOST_PP_SEQ_SPLIT_952(x) (x) BOOST_PP_SEQ_SPLIT_951
+# define BOOST_PP_SEQ_SPLIT_953(x) (x) BOOST_PP_SEQ_SPLIT_952
+# define BOOST_PP_SEQ_SPLIT_954(x) (x) BOOST_PP_SEQ_SPLIT_953
+# define BOOST_PP_SEQ_SPLIT_955(x) (x) BOOST_PP_SEQ_SPLIT_954
+# define BOOST_PP_SEQ_SPLIT_956(x) (x) BOOST_PP_SEQ_SPLIT_955
+# define BOOST_PP_SEQ_SPLIT_957(x) (x) BOOST_PP_SEQ_SPLIT_956
+# define BOOST_PP_SEQ_SPLIT_958(x) (x) BOOST_PP_SEQ_SPLIT_957
+# define BOOST_PP_SEQ_SPLIT_959(x) (x) BOOST_PP_SEQ_SPLIT_958
+# define BOOST_PP_SEQ_SPLIT_960(x) (x) BOOST_PP_SEQ_SPLIT_959
+# define BOOST_PP_SEQ_SPLIT_961(x) (x) BOOST_PP_SEQ_SPLIT_960
+# define BOOST_PP_SEQ_SPLIT_962(x) (x) BOOST_PP_SEQ_SPLIT_961
+# define BOOST_PP_SEQ_SPLIT_963(x) (x) BOOST_PP_SEQ_SPLIT_962
+# define BOOST_PP_SEQ_SPLIT_964(x) (x) BOOST_PP_SEQ_SPLIT_963
+# define BOOST_PP_SEQ_SPLIT_965(x) (x) BOOST_PP_SEQ_SPLIT_964
+# define BOOST_PP_SEQ_SPLIT_966(x) (x) BOOST_PP_SEQ_SPLIT_965
+# define BOOST_PP_SEQ_SPLIT_967(x) (x) BOOST_PP_SEQ_SPLIT_966
+# define BOOST_PP_SEQ_SPLIT_968(x) (x) BOOST_PP_SEQ_SPLIT_967
+# define BOOST_PP_SEQ_SPLIT_969(x) (x) BOOST_PP_SEQ_SPLIT_968
+# define BOOST_PP_SEQ_SPLIT_970(x) (x) BOOST_PP_SEQ_SPLIT_969
+# define BOOST_PP_SEQ_SPLIT_971(x) (x) BOOST_PP_SEQ_SPLIT_970
+# define BOOST_PP_SEQ_SPLIT_972(x) (x) BOOST_PP_SEQ_SPLIT_971
+# define BOOST_PP_SEQ_SPLIT_973(x) (x) BOOST_PP_SEQ_SPLIT_972
+# define BOOST_PP_SEQ_SPLIT_974(x) (x) BOOST_PP_SEQ_SPLIT_973
+# define BOOST_PP_SEQ_SPLIT_975(x) (x) BOOST_PP_SEQ_SPLIT_974
+# define BOOST_PP_SEQ_SPLIT_976(x) (x) BOOST_PP_SEQ_SPLIT_975
+# define BOOST_PP_SEQ_SPLIT_977(x) (x) BOOST_PP_SEQ_SPLIT_976
+# define BOOST_PP_SEQ_SPLIT_978(x) (x) BOOST_PP_SEQ_SPLIT_977
+# define BOOST_PP_SEQ_SPLIT_979(x) (x) BOOST_PP_SEQ_SPLIT_978
+# define BOOST_PP_SEQ_SPLIT_980(x) (x) BOOST_PP_SEQ_SPLIT_979
+# define BOOST_PP_SEQ_SPLIT_981(x) (x) BOOST_PP_SEQ_SPLIT_980
+# define BOOST_PP_SEQ_SPLIT_982(x) (x) BOOST_PP_SEQ_SPLIT_981
+# define BOOST_PP_SEQ_SPLIT_983(x) (x) BOOST_PP_SEQ_SPLIT_982
+# define BOOST_PP_SEQ_SPLIT_984(x) (x) BOOST_PP_SEQ_SPLIT_983
+# define BOOST_PP_SEQ_SPLIT_985(x) (x) BOOST_PP_SEQ_SPLIT_984
+# define BOOST_PP_SEQ_SPLIT_986(x) (x) BOOST_PP_SEQ_SPLIT_985
+# define BOOST_PP_SEQ_SPLIT_987(x) (x) BOOST_PP_SEQ_SPLIT_986
+# define BOOST_PP_SEQ_SPLIT_988(x) (x) BOOST_PP_SEQ_SPLIT_987
+# define BOOST_PP_SEQ_SPLIT_989(x) (x) BOOST_PP_SEQ_SPLIT_988
+# define BOOST_PP_SEQ_SPLIT_990(x) (x) BOOST_PP_SEQ_SPLIT_989
+# define BOOST_PP_SEQ_SPLIT_991(x) (x) BOOST_PP_SEQ_SPLIT_990
+# define BOOST_PP_SEQ_SPLIT_992(x) (x) BOOST_PP_SEQ_SPLIT_991
+# define BOOST_PP_SEQ_SPLIT_993(x) (x) BOOST_PP_SEQ_SPLIT_992
+# define BOOST_PP_SEQ_SPLIT_994(x) (x) BOOST_PP_SEQ_SPLIT_993
+# define BOOST_PP_SEQ_SPLIT_995(x) (x) BOOST_PP_SEQ_SPLIT_994
+# define BOOST_PP_SEQ_SPLIT_996(x) (x) BOOST_PP_SEQ_SPLIT_995
+# define BOOST_PP_SEQ_SPLIT_997(x) (x) BOOST_PP_SEQ_SPLIT_996
+# define BOOST_PP_SEQ_SPLIT_998(x) (x) BOOST_PP_SEQ_SPLIT_997
+# define BOOST_PP_SEQ_SPLIT_999(x) (x) BOOST_PP_SEQ_SPLIT_998
+# define BOOST_PP_SEQ_SPLIT_1000(x) (x) BOOST_PP_SEQ_SPLIT_999
+# define BOOST_PP_SEQ_SPLIT_1001(x) (x) BOOST_PP_SEQ_SPLIT_1000
+# define BOOST_PP_SEQ_SPLIT_1002(x) (x) BOOST_PP_SEQ_SPLIT_1001
+# define BOOST_PP_SEQ_SPLIT_1003(x) (x) BOOST_PP_SEQ_SPLIT_1002
+# define BOOST_PP_SEQ_SPLIT_1004(x) (x) BOOST_PP_SEQ_SPLIT_1003
+# define BOOST_PP_SEQ_SPLIT_1005(x) (x) BOOST_PP_SEQ_SPLIT_1004
+# define BOOST_PP_SEQ_SPLIT_1006(x) (x) BOOST_PP_SEQ_SPLIT_1005
+# define BOOST_PP_SEQ_SPLIT_1007(x) (x) BOOST_PP_SEQ_SPLIT_1006
+# define BOOST_PP_SEQ_SPLIT_1008(x) (x) BOOST_PP_SEQ_SPLIT_1007
+# define BOOST_PP_SEQ_SPLIT_1009(x) (x) BOOST_PP_SEQ_SPLIT_1008
+# define BOOST_PP_SEQ_SPLIT_1010(x) (x) BOOST_PP_SEQ_SPLIT_1009
+# define BOOST_PP_SEQ_SPLIT_1011(x) (x) BOOST_PP_SEQ_SPLIT_1010
+# define BOOST_PP_SEQ_SPLIT_1012(x) (x) BOOST_PP_SEQ_SPLIT_1011
+# define BOOST_PP_SEQ_SPLIT_1013(x) (x) BOOST_PP_SEQ_SPLIT_1012
+# define BOOST_PP_SEQ_SPLIT_1014(x) (x) BOOST_PP_SEQ_SPLIT_1013
+# define BOOST_PP_SEQ_SPLIT_1015(x) (x) BOOST_PP_SEQ_SPLIT_1014
+# define BOOST_PP_SEQ_SPLIT_1016(x) (x) BOOST_PP_SEQ_SPLIT_1015
+# define BOOST_PP_SEQ_SPLIT_1017(x) (x) BOOST_PP_SEQ_SPLIT_1016
+# define BOOST_PP_SEQ_SPLIT_1018(x) (x) BOOST_PP_SEQ_SPLIT_1017
+# define BOOST_PP_SEQ_SPLIT_1019(x) (x) BOOST_PP_SEQ_SPLIT_1018
+# define BOOST_PP_SEQ_SPLIT_1020(x) (x) BOOST_PP_SEQ_SPLIT_1019
+# define BOOST_PP_SEQ_SPLIT_1021(x) (x) BOOST_PP_SEQ_SPLIT_1020
+# define BOOST_PP_SEQ_SPLIT_1022(x) (x) BOOST_PP_SEQ_SPLIT_1021
+# define BOOST_PP_SEQ_SPLIT_1023(x) (x) BOOST_PP_SEQ_SPLIT_1022
+# define BOOST_PP_SEQ_SPLIT_1024(x) (x) BOOST_PP_SEQ_SPLIT_1023
+#
+# endif
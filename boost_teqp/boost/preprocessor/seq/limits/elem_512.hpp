@@ -0,0 +1,274 @@
+# /* **************************************************************************
+#  *                                                                          *
+#  *     (C) Copyright Paul Mensonides 2002.
+#  *     Distributed under the Boost Software License, Version 1.0. (See
+#  *     accompanying file LICENSE_1_0.txt or copy at
+#  *     http://www.boost.org/LICENSE_1_0.txt)
+#  *                                                                          *
+#  ************************************************************************** */
+#
+# /* Revised by Edward Diener (2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_SEQ_ELEM_512_HPP
+# define BOOST_PREPROCESSOR_SEQ_ELEM_512_HPP
+#
+# define BOOST_PP_SEQ_ELEM_256(_) BOOST_PP_SEQ_ELEM_255
+# define BOOST_PP_SEQ_ELEM_257(_) BOOST_PP_SEQ_ELEM_256
+# define BOOST_PP_SEQ_ELEM_258(_) BOOST_PP_SEQ_ELEM_257
+# define BOOST_PP_SEQ_ELEM_259(_) BOOST_PP_SEQ_ELEM_258
+# define BOOST_PP_SEQ_ELEM_260(_) BOOST_PP_SEQ_ELEM_259
+# define BOOST_PP_SEQ_ELEM_261(_) BOOST_PP_SEQ_ELEM_260
+# define BOOST_PP_SEQ_ELEM_262(_) BOOST_PP_SEQ_ELEM_261
+# define BOOST_PP_SEQ_ELEM_263(_) BOOST_PP_SEQ_ELEM_262
+# define BOOST_PP_SEQ_ELEM_264(_) BOOST_PP_SEQ_ELEM_263
+# define BOOST_PP_SEQ_ELEM_265(_) BOOST_PP_SEQ_ELEM_264
+# define BOOST_PP_SEQ_ELEM_266(_) BOOST_PP_SEQ_ELEM_265
+# define BOOST_PP_SEQ_ELEM_267(_) BOOST_PP_SEQ_ELEM_266
+# define BOOST_PP_SEQ_ELEM_268(_) BOOST_PP_SEQ_ELEM_267
+# define BOOST_PP_SEQ_ELEM_269(_) BOOST_PP_SEQ_ELEM_268
+# define BOOST_PP_SEQ_ELEM_270(_) BOOST_PP_SEQ_ELEM_269
+# define BOOST_PP_SEQ_ELEM_271(_) BOOST_PP_SEQ_ELEM_270
+# define BOOST_PP_SEQ_ELEM_272(_) BOOST_PP_SEQ_ELEM_271
+# define BOOST_PP_SEQ_ELEM_273(_) BOOST_PP_SEQ_ELEM_272
+# define BOOST_PP_SEQ_ELEM_274(_) BOOST_PP_SEQ_ELEM_273
+# define BOOST_PP_SEQ_ELEM_275(_) BOOST_PP_SEQ_ELEM_274
+# define BOOST_PP_SEQ_ELEM_276(_) BOOST_PP_SEQ_ELEM_275
+# define BOOST_PP_SEQ_ELEM_277(_) BOOST_PP_SEQ_ELEM_276
+# define BOOST_PP_SEQ_ELEM_278(_) BOOST_PP_SEQ_ELEM_277
+# define BOOST_PP_SEQ_ELEM_279(_) BOOST_PP_SEQ_ELEM_278
+# define BOOST_PP_SEQ_ELEM_280(_) BOOST_PP_SEQ_ELEM_279
+# define BOOST_PP_SEQ_ELEM_281(_) BOOST_PP_SEQ_ELEM_280
+# define BOOST_PP_SEQ_ELEM_282(_) BOOST_PP_SEQ_ELEM_281
+# define BOOST_PP_SEQ_ELEM_283(_) BOOST_PP_SEQ_ELEM_282
+# define BOOST_PP_SEQ_ELEM_284(_) BOOST_PP_SEQ_ELEM_283
+# define BOOST_PP_SEQ_ELEM_285(_) BOOST_PP_SEQ_ELEM_284
+# define BOOST_PP_SEQ_ELEM_286(_) BOOST_PP_SEQ_ELEM_285
+# define BOOST_PP_SEQ_ELEM_287(_) BOOST_PP_SEQ_ELEM_286
+# define BOOST_PP_SEQ_ELEM_288(_) BOOST_PP_SEQ_ELEM_287
+# define BOOST_PP_SEQ_ELEM_289(_) BOOST_PP_SEQ_ELEM_288
+# define BOOST_PP_SEQ_ELEM_290(_) BOOST_PP_SEQ_ELEM_289
+# define BOOST_PP_SEQ_ELEM_291(_) BOOST_PP_SEQ_ELEM_290
+# define BOOST_PP_SEQ_ELEM_292(_) BOOST_PP_SEQ_ELEM_291
+# define BOOST_PP_SEQ_ELEM_293(_) BOOST_PP_SEQ_ELEM_292
+# define BOOST_PP_SEQ_ELEM_294(_) BOOST_PP_SEQ_ELEM_293
+# define BOOST_PP_SEQ_ELEM_295(_) BOOST_PP_SEQ_ELEM_294
+# define BOOST_PP_SEQ_ELEM_296(_) BOOST_PP_SEQ_ELEM_295
+# define BOOST_PP_SEQ_ELEM_297(_) BOOST_PP_SEQ_ELEM_296
+# define BOOST_PP_SEQ_ELEM_298(_) BOOST_PP_SEQ_ELEM_297
+# define BOOST_PP_SEQ_ELEM_299(_) BOOST_PP_SEQ_ELEM_298
+# define BOOST_PP_SEQ_ELEM_300(_) BOOST_PP_SEQ_ELEM_299
+# define BOOST_PP_SEQ_ELEM_301(_) BOOST_PP_SEQ_ELEM_300
+# define BOOST_PP_SEQ_ELEM_302(_) BOOST_PP_SEQ_ELEM_301
+# define BOOST_PP_SEQ_ELEM_303(_) BOOST_PP_SEQ_ELEM_302
+# define BOOST_PP_SEQ_ELEM_304(_) BOOST_PP_SEQ_ELEM_303
+# define BOOST_PP_SEQ_ELEM_305(_) BOOST_PP_SEQ_ELEM_304
+# define BOOST_PP_SEQ_ELEM_306(_) BOOST_PP_SEQ_ELEM_305
+# define BOOST_PP_SEQ_ELEM_307(_) BOOST_PP_SEQ_ELEM_306
+# define BOOST_PP_SEQ_ELEM_308(_) BOOST_PP_SEQ_ELEM_307
+# define BOOST_PP_SEQ_ELEM_309(_) BOOST_PP_SEQ_ELEM_308
+# define BOOST_PP_SEQ_ELEM_310(_) BOOST_PP_SEQ_ELEM_309
+# define BOOST_PP_SEQ_ELEM_311(_) BOOST_PP_SEQ_ELEM_310
+# define BOOST_PP_SEQ_ELEM_312(_) BOOST_PP_SEQ_ELEM_311
+# define BOOST_PP_SEQ_ELEM_313(_) BOOST_PP_SEQ_ELEM_312
+# define BOOST_PP_SEQ_ELEM_314(_) BOOST_PP_SEQ_ELEM_313
+# define BOOST_PP_SEQ_ELEM_315(_) BOOST_PP_SEQ_ELEM_314
+# define BOOST_PP_SEQ_ELEM_316(_) BOOST_PP_SEQ_ELEM_315
+# define BOOST_PP_SEQ_ELEM_317(_) BOOST_PP_SEQ_ELEM_316
+# define BOOST_PP_SEQ_ELEM_318(_) BOOST_PP_SEQ_ELEM_317
+# define BOOST_PP_SEQ_ELEM_319(_) BOOST_PP_SEQ_ELEM_318
+# define BOOST_PP_SEQ_ELEM_320(_) BOOST_PP_SEQ_ELEM_319
+# define BOOST_PP_SEQ_ELEM_321(_) BOOST_PP_SEQ_ELEM_320
+# define BOOST_PP_SEQ_ELEM_322(_) BOOST_PP_SEQ_ELEM_321
+# define BOOST_PP_SEQ_ELEM_323(_) BOOST_PP_SEQ_ELEM_322
+# define BOOST_PP_SEQ_ELEM_324(_) BOOST_PP_SEQ_ELEM_323
+# define BOOST_PP_SEQ_ELEM_325(_) BOOST_PP_SEQ_ELEM_324
+# define BOOST_PP_SEQ_ELEM_326(_) BOOST_PP_SEQ_ELEM_325
+# define BOOST_PP_SEQ_ELEM_327(_) BOOST_PP_SEQ_ELEM_326
+# define BOOST_PP_SEQ_ELEM_328(_) BOOST_PP_SEQ_ELEM_327
+# define BOOST_PP_SEQ_ELEM_329(_) BOOST_PP_SEQ_ELEM_328
+# define BOOST_PP_SEQ_ELEM_330(_) BOOST_PP_SEQ_ELEM_329
+# define BOOST_PP_SEQ_ELEM_331(_) BOOST_PP_SEQ_ELEM_330
+# define BOOST_PP_SEQ_ELEM_332(_) BOOST_PP_SEQ_ELEM_331
+# define BOOST_PP_SEQ_ELEM_333(_) BOOST_PP_SEQ_ELEM_332
+# define BOOST_PP_SEQ_ELEM_334(_) BOOST_PP_SEQ_ELEM_333
+# define BOOST_PP_SEQ_ELEM_335(_) BOOST_PP_SEQ_ELEM_334
+# define BOOST_PP_SEQ_ELEM_336(_) BOOST_PP_SEQ_ELEM_335
+# define BOOST_PP_SEQ_ELEM_337(_) BOOST_PP_SEQ_ELEM_336
+# define BOOST_PP_SEQ_ELEM_338(_) BOOST_PP_SEQ_ELEM_337
+# define BOOST_PP_SEQ_ELEM_339(_) BOOST_PP_SEQ_ELEM_338
+# define BOOST_PP_SEQ_ELEM_340(_) BOOST_PP_SEQ_ELEM_339
+# define BOOST_PP_SEQ_ELEM_341(_) BOOST_PP_SEQ_ELEM_340
+# define BOOST_PP_SEQ_ELEM_342(_) BOOST_PP_SEQ_ELEM_341
+# define BOOST_PP_SEQ_ELEM_343(_) BOOST_PP_SEQ_ELEM_342
+# define BOOST_PP_SEQ_ELEM_344(_) BOOST_PP_SEQ_ELEM_343
+# define BOOST_PP_SEQ_ELEM_345(_) BOOST_PP_SEQ_ELEM_344
+# define BOOST_PP_SEQ_ELEM_346(_) BOOST_PP_SEQ_ELEM_345
+# define BOOST_PP_SEQ_ELEM_347(_) BOOST_PP_SEQ_ELEM_346
+# define BOOST_PP_SEQ_ELEM_348(_) BOOST_PP_SEQ_ELEM_347
+# define BOOST_PP_SEQ_ELEM_349(_) BOOST_PP_SEQ_ELEM_348
+# define BOOST_PP_SEQ_ELEM_350(_) BOOST_PP_SEQ_ELEM_349
+# define BOOST_PP_SEQ_ELEM_351(_) BOOST_PP_SEQ_ELEM_350
+# define BOOST_PP_SEQ_ELEM_352(_) BOOST_PP_SEQ_ELEM_351
+# define BOOST_PP_SEQ_ELEM_353(_) BOOST_PP_SEQ_ELEM_352
+# define BOOST_PP_SEQ_ELEM_354(_) BOOST_PP_SEQ_ELEM_353
+# define BOOST_PP_SEQ_ELEM_355(_) BOOST_PP_SEQ_ELEM_354
+# define BOOST_PP_SEQ_ELEM_356(_) BOOST_PP_SEQ_ELEM_355
+# define BOOST_PP_SEQ_ELEM_357(_) BOOST_PP_SEQ_ELEM_356
+# define BOOST_PP_SEQ_ELEM_358(_) BOOST_PP_SEQ_ELEM_357
+# define BOOST_PP_SEQ_ELEM_359(_) BOOST_PP_SEQ_ELEM_358
+# define BOOST_PP_SEQ_ELEM_360(_) BOOST_PP_SEQ_ELEM_359
+# define BOOST_PP_SEQ_ELEM_361(_) BOOST_PP_SEQ_ELEM_360
+# define BOOST_PP_SEQ_ELEM_362(_) BOOST_PP_SEQ_ELEM_361
+# define BOOST_PP_SEQ_ELEM_363(_) BOOST_PP_SEQ_ELEM_362
+# define BOOST_PP_SEQ_ELEM_364(_) BOOST_PP_SEQ_ELEM_363
+# define BOOST_PP_SEQ_ELEM_365(_) BOOST_PP_SEQ_ELEM_364
+# define BOOST_PP_SEQ_ELEM_366(_) BOOST_PP_SEQ_ELEM_365
+# define BOOST_PP_SEQ_ELEM_367(_) BOOST_PP_SEQ_ELEM_366
+# define BOOST_PP_SEQ_ELEM_368(_) BOOST_PP_SEQ_ELEM_367
+# define BOOST_PP_SEQ_ELEM_369(_) BOOST_PP_SEQ_ELEM_368
+# define BOOST_PP_SEQ_ELEM_370(_) BOOST_PP_SEQ_ELEM_369
+# define BOOST_PP_SEQ_ELEM_371(_) BOOST_PP_SEQ_ELEM_370
+# define BOOST_PP_SEQ_ELEM_372(_) BOOST_PP_SEQ_ELEM_371
+# define BOOST_PP_SEQ_ELEM_373(_) BOOST_PP_SEQ_ELEM_372
+# define BOOST_PP_SEQ_ELEM_374(_) BOOST_PP_SEQ_ELEM_373
+# define BOOST_PP_SEQ_ELEM_375(_) BOOST_PP_SEQ_ELEM_374
+# define BOOST_PP_SEQ_ELEM_376(_) BOOST_PP_SEQ_ELEM_375
+# define BOOST_PP_SEQ_ELEM_377(_) BOOST_PP_SEQ_ELEM_376
+# define BOOST_PP_SEQ_ELEM_378(_) BOOST_PP_SEQ_ELEM_377
+# define BOOST_PP_SEQ_ELEM_379(_) BOOST_PP_SEQ_ELEM_378
+# define BOOST_PP_SEQ_ELEM_380(_) BOOST_PP_SEQ_ELEM_379
+# define BOOST_PP_SEQ_ELEM_381(_) BOOST_PP_SEQ_ELEM_380
+# define BOOST_PP_SEQ_ELEM_382(_) BOOST_PP_SEQ_ELEM_381
+# define BOOST_PP_SEQ_ELEM_383(_) BOOST_PP_SEQ_ELEM_382
+# define BOOST_PP_SEQ_ELEM_384(_) BOOST_PP_SEQ_ELEM_383
+# define BOOST_PP_SEQ_ELEM_385(_) BOOST_PP_SEQ_ELEM_384
+# define BOOST_PP_SEQ_ELEM_386(_) BOOST_PP_SEQ_ELEM_385
+# define BOOST_PP_SEQ_ELEM_387(_) BOOST_PP_SEQ_ELEM_386
+# define BOOST_PP_SEQ_ELEM_388(_) BOOST_PP_SEQ_ELEM_387
+# define BOOST_PP_SEQ_ELEM_389(_) BOOST_PP_SEQ_ELEM_388
+# define BOOST_PP_SEQ_ELEM_390(_) BOOST_PP_SEQ_ELEM_389
+# define BOOST_PP_SEQ_ELEM_391(_) BOOST_PP_SEQ_ELEM_390
+# define BOOST_PP_SEQ_ELEM_392(_) BOOST_PP_SEQ_ELEM_391
+# define BOOST_PP_SEQ_ELEM_393(_) BOOST_PP_SEQ_ELEM_392
+# define BOOST_PP_SEQ_ELEM_394(_) BOOST_PP_SEQ_ELEM_393
+# define BOOST_PP_SEQ_ELEM_395(_) BOOST_PP_SEQ_ELEM_394
+# define BOOST_PP_SEQ_ELEM_396(_) BOOST_PP_SEQ_ELEM_395
+# define BOOST_PP_SEQ_ELEM_397(_) BOOST_PP_SEQ_ELEM_396
+# define BOOST_PP_SEQ_ELEM_398(_) BOOST_PP_SEQ_ELEM_397
+# define BOOST_PP_SEQ_ELEM_399(_) BOOST_PP_SEQ_ELEM_398
+# define BOOST_PP_SEQ_ELEM_400(_) BOOST_PP_SEQ_ELEM_399
+# define BOOST_PP_SEQ_ELEM_401(_) BOOST_PP_SEQ_ELEM_400
+# define BOOST_PP_SEQ_ELEM_402(_) BOOST_PP_SEQ_ELEM_401
+# define BOOST_PP_SEQ_ELEM_403(_) BOOST_PP_SEQ_ELEM_402
+# define BOOST_PP_SEQ_ELEM_404(_) BOOST_PP_SEQ_ELEM_403
+# define BOOST_PP_SEQ_ELEM_405(_) BOOST_PP_SEQ_ELEM_404
+# define BOOST_PP_SEQ_ELEM_406(_) BOOST_PP_SEQ_ELEM_405
+# define BOOST_PP_SEQ_ELEM_407(_) BOOST_PP_SEQ_ELEM_406
+# define BOOST_PP_SEQ_ELEM_408(_) BOOST_PP_SEQ_ELEM_407
+# define BOOST_PP_SEQ_ELEM_409(_) BOOST_PP_SEQ_ELEM_408
+# define BOOST_PP_SEQ_ELEM_410(_) BOOST_PP_SEQ_ELEM_409
+# define BOOST_PP_SEQ_ELEM_411(_) BOOST_PP_SEQ_ELEM_410
+# define BOOST_PP_SEQ_ELEM_412(_) BOOST_PP_SEQ_ELEM_411
+# define BOOST_PP_SEQ_ELEM_413(_) BOOST_PP_SEQ_ELEM_412
+# define BOOST_PP_SEQ_ELEM_414(_) BOOST_PP_SEQ_ELEM_413
+# define BOOST_PP_SEQ_ELEM_415(_) BOOST_PP_SEQ_ELEM_414
+# define BOOST_PP_SEQ_ELEM_416(_) BOOST_PP_SEQ_ELEM_415
+# define BOOST_PP_SEQ_ELEM_417(_) BOOST_PP_SEQ_ELEM_416
+# define BOOST_PP_SEQ_ELEM_418(_) BOOST_PP_SEQ_ELEM_417
+# define BOOST_PP_SEQ_ELEM_419(_) BOOST_PP_SEQ_ELEM_418
+# define BOOST_PP_SEQ_ELEM_420(_) BOOST_PP_SEQ_ELEM_419
+# define BOOST_PP_SEQ_ELEM_421(_) BOOST_PP_SEQ_ELEM_420
+# define BOOST_PP_SEQ_ELEM_422(_) BOOST_PP_SEQ_ELEM_421
+# define BOOST_PP_SEQ_ELEM_423(_) BOOST_PP_SEQ_ELEM_422
+# define BOOST_PP_SEQ_ELEM_424(_) BOOST_PP_SEQ_ELEM_423
+# define BOOST_PP_SEQ_ELEM_425(_) BOOST_PP_SEQ_ELEM_424
+# define BOOST_PP_SEQ_ELEM_426(_) BOOST_PP_SEQ_ELEM_425
+# define BOOST_PP_SEQ_ELEM_427(_) BOOST_PP_SEQ_ELEM_426
+# define BOOST_PP_SEQ_ELEM_428(_) BOOST_PP_SEQ_ELEM_427
+# define BOOST_PP_SEQ_ELEM_429(_) BOOST_PP_SEQ_ELEM_428
+# define BOOST_PP_SEQ_ELEM_430(_) BOOST_PP_SEQ_ELEM_429
+# define BOOST_PP_SEQ_ELEM_431(_) BOOST_PP_SEQ_ELEM_430
+# define BOOST_PP_SEQ_ELEM_432(_) BOOST_PP_SEQ_ELEM_431
+# define BOOST_PP_SEQ_ELEM_433(_) BOOST_PP_SEQ_ELEM_432
+# define BOOST_PP_SEQ_ELEM_434(_) BOOST_PP_SEQ_ELEM_433
+# define BOOST_PP_SEQ_ELEM_435(_) BOOST_PP_SEQ_ELEM_434
+# define BOOST_PP_SEQ_ELEM_436(_) BOOST_PP_SEQ_ELEM_435
+# define BOOST_PP_SEQ_ELEM_437(_) BOOST_PP_SEQ_ELEM_436
+# define BOOST_PP_SEQ_ELEM_438(_) BOOST_PP_SEQ_ELEM_437
+# define BOOST_PP_SEQ_ELEM_439(_) BOOST_PP_SEQ_ELEM_438
+# define BOOST_PP_SEQ_ELEM_440(_) BOOST_PP_SEQ_ELEM_439
+# define BOOST_PP_SEQ_ELEM_441(_) BOOST_PP_SEQ_ELEM_440
+# define BOOST_PP_SEQ_ELEM_442(_) BOOST_PP_SEQ_ELEM_441
+# define BOOST_PP_SEQ_ELEM_443(_) BOOST_PP_SEQ_ELEM_442
+# define BOOST_PP_SEQ_ELEM_444(_) BOOST_PP_SEQ_ELEM_443
+# define BOOST_PP_SEQ_ELEM_445(_) BOOST_PP_SEQ_ELEM_444
+# define BOOST_PP_SEQ_ELEM_446(_) BOOST_PP_SEQ_ELEM_445
+# define BOOST_PP_SEQ_ELEM_447(_) BOOST_PP_SEQ_ELEM_446
+# define BOOST_PP_SEQ_ELEM_448(_) BOOST_PP_SEQ_ELEM_447
+# define BOOST_PP_SEQ_ELEM_449(_) BOOST_PP_SEQ_ELEM_448
+# define BOOST_PP_SEQ_ELEM_450(_) BOOST_PP_SEQ_ELEM_449
+# define BOOST_PP_SEQ_ELEM_451(_) BOOST_PP_SEQ_ELEM_450
+# define BOOST_PP_SEQ_ELEM_452(_) BOOST_PP_SEQ_ELEM_451
+# define BOOST_PP_SEQ_ELEM_453(_) BOOST_PP_SEQ_ELEM_452
+# define BOOST_PP_SEQ_ELEM_454(_) BOOST_PP_SEQ_ELEM_453
+# define BOOST_PP_SEQ_ELEM_455(_) BOOST_PP_SEQ_ELEM_454
+# define BOOST_PP_SEQ_ELEM_456(_) BOOST_PP_SEQ_ELEM_455
+# define BOOST_PP_SEQ_ELEM_457(_) BOOST_PP_SEQ_ELEM_456
+# define BOOST_PP_SEQ_ELEM_458(_) BOOST_PP_SEQ_ELEM_457
+# define BOOST_PP_SEQ_ELEM_459(_) BOOST_PP_SEQ_ELEM_458
+# define BOOST_PP_SEQ_ELEM_460(_) BOOST_PP_SEQ_ELEM_459
+# define BOOST_PP_SEQ_ELEM_461(_) BOOST_PP_SEQ_ELEM_460
+# define BOOST_PP_SEQ_ELEM_462(_) BOOST_PP_SEQ_ELEM_461
+# define BOOST_PP_SEQ_ELEM_463(_) BOOST_PP_SEQ_ELEM_462
+# define BOOST_PP_SEQ_ELEM_464(_) BOOST_PP_SEQ_ELEM_463
+# define BOOST_PP_SEQ_ELEM_465(_) BOOST_PP_SEQ_ELEM_464
+# define BOOST_PP_SEQ_ELEM_466(_) BOOST_PP_SEQ_ELEM_465
+# define BOOST_PP_SEQ_ELEM_467(_) BOOST_PP_SEQ_ELEM_466
+# define BOOST_PP_SEQ_ELEM_468(_) BOOST_PP_SEQ_ELEM_467
+# define BOOST_PP_SEQ_ELEM_469(_) BOOST_PP_SEQ_ELEM_468
+# define BOOST_PP_SEQ_ELEM_470(_) BOOST_PP_SEQ_ELEM_469
+# define BOOST_PP_SEQ_ELEM_471(_) BOOST_PP_SEQ_ELEM_470
+# define BOOST_PP_SEQ_ELEM_472(_) BOOST_PP_SEQ_ELEM_471
+# define BOOST_PP_SEQ_ELEM_473(_) BOOST_PP_SEQ_ELEM_472
+# define BOOST_PP_SEQ_ELEM_474(_) BOOST_PP_SEQ_ELEM_473
+# define BOOST_PP_SEQ_ELEM_475(_) BOOST_PP_SEQ_ELEM_474
+# define BOOST_PP_SEQ_ELEM_476(_) BOOST_PP_SEQ_ELEM_475
+# define BOOST_PP_SEQ_ELEM_477(_) BOOST_PP_SEQ_ELEM_476
+# define BOOST_PP_SEQ_ELEM_478(_) BOOST_PP_SEQ_ELEM_477
+# define BOOST_PP_SEQ_ELEM_479(_) BOOST_PP_SEQ_ELEM_478
+# define BOOST_PP_SEQ_ELEM_480(_) BOOST_PP_SEQ_ELEM_479
+# define BOOST_PP_SEQ_ELEM_481(_) BOOST_PP_SEQ_ELEM_480
+# define BOOST_PP_SEQ_ELEM_482(_) BOOST_PP_SEQ_ELEM_481
+# define BOOST_PP_SEQ_ELEM_483(_) BOOST_PP_SEQ_ELEM_482
+# define BOOST_PP_SEQ_ELEM_484(_) BOOST_PP_SEQ_ELEM_483
+# define BOOST_PP_SEQ_ELEM_485(_) BOOST_PP_SEQ_ELEM_484
+# define BOOST_PP_SEQ_ELEM_486(_) BOOST_PP_SEQ_ELEM_485
+# define BOOST_PP_SEQ_ELEM_487(_) BOOST_PP_SEQ_ELEM_486
+# define BOOST_PP_SEQ_ELEM_488(_) BOOST_PP_SEQ_ELEM_487
+# define BOOST_PP_SEQ_ELEM_489(_) BOOST_PP_SEQ_ELEM_488
+# define BOOST_PP_SEQ_ELEM_490(_) BOOST_PP_SEQ_ELEM_489
+# define BOOST_PP_SEQ_ELEM_491(_) BOOST_PP_SEQ_ELEM_490
+# define BOOST_PP_SEQ_ELEM_492(_) BOOST_PP_SEQ_ELEM_491
+# define BOOST_PP_SEQ_ELEM_493(_) BOOST_PP_SEQ_ELEM_492
+# define BOOST_PP_SEQ_ELEM_494(_) BOOST_PP_SEQ_ELEM_493
+# define BOOST_PP_SEQ_ELEM_495(_) BOOST_PP_SEQ_ELEM_494
+# define BOOST_PP_SEQ_ELEM_496(_) BOOST_PP_SEQ_ELEM_495
+# define BOOST_PP_SEQ_ELEM_497(_) BOOST_PP_SEQ_ELEM_496
+# define BOOST_PP_SEQ_ELEM_498(_) BOOST_PP_SEQ_ELEM_497
+# define BOOST_PP_SEQ_ELEM_499(_) BOOST_PP_SEQ_ELEM_498
+# define BOOST_PP_SEQ_ELEM_500(_) BOOST_PP_SEQ_ELEM_499
+# define BOOST_PP_SEQ_ELEM_501(_) BOOST_PP_SEQ_ELEM_500
+# define BOOST_PP_SEQ_ELEM_502(_) BOOST_PP_SEQ_ELEM_501
+# define BOOST_PP_SEQ_ELEM_503(_) BOOST_PP_SEQ_ELEM_502
+# define BOOST_PP_SEQ_ELEM_504(_) BOOST_PP_SEQ_ELEM_503
+# define BOOST_PP_SEQ_ELEM_505(_) BOOST_PP_SEQ_ELEM_504
+# define BOOST_PP_SEQ_ELEM_506(_) BOOST_PP_SEQ_ELEM_505
+# define BOOST_PP_SEQ_ELEM_507(_) BOOST_PP_SEQ_ELEM_506
+# define BOOST_PP_SEQ_ELEM_508(_) BOOST_PP_SEQ_ELEM_507
+# define BOOST_PP_SEQ_ELEM_509(_) BOOST_PP_SEQ_ELEM_508
+# define BOOST_PP_SEQ_ELEM_510(_) BOOST_PP_SEQ_ELEM_509
+# define BOOST_PP_SEQ_ELEM_511(_) BOOST_PP_SEQ_ELEM_510
+#
+# endif
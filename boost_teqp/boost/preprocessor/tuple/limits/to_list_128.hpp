@@ -0,0 +1,595 @@
+# /* Copyright (C) 2001
+#  * Housemarque Oy
+#  * http://www.housemarque.com
+#  *
+#  * Distributed under the Boost Software License, Version 1.0. (See
+#  * accompanying file LICENSE_1_0.txt or copy at
+#  * http://www.boost.org/LICENSE_1_0.txt)
+#  */
+#
+# /* Revised by Paul Mensonides (2002-2011) */
+# /* Revised by Edward Diener (2011,2020) */
+#
+# /* See http://www.boost.org for most recent version. */
+#
+# ifndef BOOST_PREPROCESSOR_TUPLE_TO_LIST_128_HPP
+# define BOOST_PREPROCESSOR_TUPLE_TO_LIST_128_HPP
+#
+# define BOOST_PP_TUPLE_TO_LIST_65( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )
+# define BOOST_PP_TUPLE_TO_LIST_66( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))
+# define BOOST_PP_TUPLE_TO_LIST_67( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))
+# define BOOST_PP_TUPLE_TO_LIST_68( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))
+# define BOOST_PP_TUPLE_TO_LIST_69( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))
+# define BOOST_PP_TUPLE_TO_LIST_70( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))
+# define BOOST_PP_TUPLE_TO_LIST_71( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))
+# define BOOST_PP_TUPLE_TO_LIST_72( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))
+# define BOOST_PP_TUPLE_TO_LIST_73( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))
+# define BOOST_PP_TUPLE_TO_LIST_74( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_75( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_76( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_77( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_78( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_79( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_80( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_81( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_82( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_83( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_84( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_85( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_86( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_87( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_88( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_89( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_90( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_91( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_92( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_93( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_94( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_95( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_96( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_97( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_98( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_99( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_100( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_101( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_102( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_103( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_104( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_105( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_106( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_107( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_108( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_109( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_110( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_111( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_112( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_113( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_114( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_115( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_116( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_117( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_118( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_119( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_120( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_121( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_122( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_123( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_124( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_125( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_126( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_127( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BOOST_PP_TUPLE_TO_LIST_128( \
+                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
+                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127 ) \
+                                  ( \
+                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
+                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
+                                  BOOST_PP_NIL \
+                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
+                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+#
+# endif
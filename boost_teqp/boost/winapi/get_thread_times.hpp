@@ -0,0 +1,59 @@
+/*
+ * Copyright 2010 Vicente J. Botet Escriba
+ * Copyright 2015 Andrey Semashev
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef BOOST_WINAPI_GET_THREAD_TIMES_HPP_INCLUDED_
+#define BOOST_WINAPI_GET_THREAD_TIMES_HPP_INCLUDED_
+
+#include <boost/winapi/basic_types.hpp>
+#include <boost/winapi/time.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if BOOST_WINAPI_PARTITION_APP_SYSTEM
+
+#include <boost/winapi/detail/header.hpp>
+
+#if !defined( BOOST_USE_WINDOWS_H )
+extern "C" {
+BOOST_WINAPI_IMPORT_EXCEPT_WM boost::winapi::BOOL_ BOOST_WINAPI_WINAPI_CC
+GetThreadTimes(
+    boost::winapi::HANDLE_ hThread,
+    ::_FILETIME* lpCreationTime,
+    ::_FILETIME* lpExitTime,
+    ::_FILETIME* lpKernelTime,
+    ::_FILETIME* lpUserTime);
+}
+#endif
+
+namespace boost {
+namespace winapi {
+
+BOOST_FORCEINLINE BOOL_ GetThreadTimes(
+    HANDLE_ hThread,
+    LPFILETIME_ lpCreationTime,
+    LPFILETIME_ lpExitTime,
+    LPFILETIME_ lpKernelTime,
+    LPFILETIME_ lpUserTime)
+{
+    return ::GetThreadTimes(
+        hThread,
+        reinterpret_cast< ::_FILETIME* >(lpCreationTime),
+        reinterpret_cast< ::_FILETIME* >(lpExitTime),
+        reinterpret_cast< ::_FILETIME* >(lpKernelTime),
+        reinterpret_cast< ::_FILETIME* >(lpUserTime));
+}
+
+}
+}
+
+#include <boost/winapi/detail/footer.hpp>
+
+#endif // BOOST_WINAPI_PARTITION_APP_SYSTEM
+#endif // BOOST_WINAPI_GET_THREAD_TIMES_HPP_INCLUDED_
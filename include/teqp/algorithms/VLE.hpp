@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include "teqp/derivs.hpp"
 #include "teqp/exceptions.hpp"
@@ -7,6 +8,7 @@
 #include "teqp/algorithms/critical_pure.hpp"
 #include "teqp/algorithms/VLE_types.hpp"
 #include "teqp/algorithms/VLE_pure.hpp"
+#include "teqp/algorithms/continuation.hpp"
 #include <Eigen/Dense>
 
 // Imports from boost for numerical integration
@@ -57,157 +59,289 @@ auto linsolve(const A& a, const B& b) {
 }
 
 /***
-* \brief Do a vapor-liquid phase equilibrium problem for a mixture (binary only for now) with mole fractions specified in the liquid phase
-* \param model The model to operate on
-* \param T Temperature
-* \param rhovecL0 Initial values for liquid mole concentrations
-* \param rhovecV0 Initial values for vapor mole concentrations
-* \param xspec Specified mole fractions for all components
-* \param atol Absolute tolerance on function values
-* \param reltol Relative tolerance on function values
-* \param axtol Absolute tolerance on steps in independent variables
-* \param relxtol Relative tolerance on steps in independent variables
-* \param maxiter Maximum number of iterations permitted
-* 
-* Note: if a mole fraction is zero in the provided vector, the molar concentrations in 
-* this component will not be allowed to change (they will stay zero, avoiding the possibility that 
-* they go to a negative value, which can cause trouble for some EOS)
+* As linsolve, for a symmetric matrix a, which is factorized with a LDLT decomposition. Falls back to linsolve if the factorization fails
 */
-inline auto mix_VLE_Tx(const AbstractModel& model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const Eigen::ArrayXd& xspec, double atol, double reltol, double axtol, double relxtol, int maxiter) {
-    using Scalar = double;
-
-    const Eigen::Index N = rhovecL0.size();
-    auto lengths = (Eigen::ArrayX<Eigen::Index>(3) << rhovecL0.size(), rhovecV0.size(), xspec.size()).finished();
-    if (lengths.minCoeff() != lengths.maxCoeff()){
-        throw InvalidArgument("lengths of rhovecs and xspec must be the same in mix_VLE_Tx");
+template<class A, class B>
+auto linsolve_symmetric(const A& a, const B& b) {
+    auto ldlt = a.matrix().ldlt();
+    if (ldlt.info() != Eigen::Success) {
+        return linsolve(a, b);
     }
-    Eigen::MatrixXd J(2 * N, 2 * N), r(2 * N, 1), x(2 * N, 1);
-    x.col(0).array().head(N) = rhovecL0;
-    x.col(0).array().tail(N) = rhovecV0;
-
-    Eigen::Map<Eigen::ArrayXd> rhovecL(&(x(0)), N);
-    Eigen::Map<Eigen::ArrayXd> rhovecV(&(x(0 + N)), N);
-    auto RT = model.get_R(xspec) * T;
+    return ldlt.solve(b.matrix()).array().eval();
+}
 
-    VLE_return_code return_code = VLE_return_code::unset;
+namespace internal {
+    /**
+     * Solve J dx = -r for the Jacobian of a two-phase problem in the molar concentrations of the phases,
+     * \f[
+     * J = \left(\begin{array}{cc} H_L & -H_V \\ B_L & B_V \end{array}\right)
+     * \f]
+     * in which the first N rows are the equalities of the chemical potentials, and H_V is symmetric (the Hessian of Psi of
+     * the vapor, possibly without the ideal-gas terms of some components). The vapor block is factorized with a LDLT
+     * decomposition and eliminated,
+     * \f[
+     * \Delta\vec\rho_V = H_V^{-1}(H_L\Delta\vec\rho_L + \vec r_1),\quad (B_L + B_VH_V^{-1}H_L)\Delta\vec\rho_L = -\vec r_2 - B_VH_V^{-1}\vec r_1
+     * \f]
+     * where only the rows of B_V that are not zero are involved, leaving an N x N system for the liquid. If the factorization
+     * fails or the step is not finite, the full system is solved with a QR decomposition instead.
+     */
+    inline Eigen::VectorXd solve_two_phase_Jacobian(const Eigen::MatrixXd& J, const Eigen::Ref<const Eigen::VectorXd>& r) {
+        const auto N = J.rows() / 2;
+        Eigen::MatrixXd HV = -J.block(0, N, N, N);
+        auto ldlt = HV.ldlt();
+        if (ldlt.info() == Eigen::Success) {
+            const auto HL = J.block(0, 0, N, N);
+            const auto BV = J.block(N, N, N, N);
+            const auto r1 = r.head(N);
+            Eigen::MatrixXd A = J.block(N, 0, N, N);
+            Eigen::VectorXd b = -r.tail(N);
+            for (auto i = 0; i < N; ++i) {
+                if ((BV.row(i).array() != 0).any()) {
+                    Eigen::VectorXd y = ldlt.solve(BV.row(i).transpose()); // The transpose of row i of B_V H_V^{-1}
+                    A.row(i) += y.transpose() * HL;
+                    b(i) -= y.dot(r1);
+                }
+            }
+            Eigen::VectorXd dx(2 * N);
+            dx.head(N) = A.partialPivLu().solve(b);
+            dx.tail(N) = ldlt.solve(HL * dx.head(N) + r1);
+            if (dx.allFinite()) {
+                return dx;
+            }
+        }
+        return J.colPivHouseholderQr().solve(-r);
+    }
 
-    for (int iter = 0; iter < maxiter; ++iter) {
+    /// The wall time since the construction, for SolverTelemetry::elapsed_s
+    class TelemetryClock {
+    private:
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    public:
+        double elapsed_s() const { return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); }
+    };
+}
 
-        auto [PsirL, PsirgradL, hessianL] = model.build_Psir_fgradHessian_autodiff(T, rhovecL);
-        auto [PsirV, PsirgradV, hessianV] = model.build_Psir_fgradHessian_autodiff(T, rhovecV);
-        auto rhoL = rhovecL.sum();
-        auto rhoV = rhovecV.sum();
-        Scalar pL = rhoL * RT - PsirL + (rhovecL.array() * PsirgradL.array()).sum(); // The (array*array).sum is a dot product
-        Scalar pV = rhoV * RT - PsirV + (rhovecV.array() * PsirgradV.array()).sum();
+namespace internal {
+    /**
+     * The residual r and the Jacobian J of mix_VLE_Tx from the value, gradient and Hessian of Psir of each phase.  The pressures
+     * and the differences of the chemical potentials of the phases are formed in the Scalar of the arguments and only then
+     * stored in double, so that with an extended-precision Scalar they keep their accuracy where they nearly cancel, close to
+     * a critical point
+     */
+    template<typename Scalar, typename RhoVec, typename Grad, typename Hessian>
+    void build_VLE_Tx_system(const Scalar& RT, const RhoVec& rhovecL, const RhoVec& rhovecV, const Eigen::ArrayXd& xspec,
+        const Scalar& PsirL, const Grad& PsirgradL, const Hessian& hessianL, const Scalar& PsirV, const Grad& PsirgradV, const Hessian& hessianV,
+        Eigen::MatrixXd& J, Eigen::MatrixXd& r)
+    {
+        const auto N = rhovecL.size();
+        const Scalar rhoL = rhovecL.sum(), rhoV = rhovecV.sum();
+        const Scalar pL = rhoL * RT - PsirL + (rhovecL * PsirgradL).sum(); // The (array*array).sum is a dot product
+        const Scalar pV = rhoV * RT - PsirV + (rhovecV * PsirgradV).sum();
         auto dpdrhovecL = RT + (hessianL * rhovecL.matrix()).array();
         auto dpdrhovecV = RT + (hessianV * rhovecV.matrix()).array();
-        
-        bool index0nonzero = rhovecL(0) > 0 && rhovecV(0) > 0;
-        bool index1nonzero = rhovecL(1) > 0 && rhovecV(1) > 0;
 
-        if (index0nonzero) {
-            r(0) = PsirgradL(0) + RT * log(rhovecL(0)) - (PsirgradV(0) + RT * log(rhovecV(0)));
-        } else {
-            r(0) = PsirgradL(0) - PsirgradV(0);
+        // Chemical potential contributions in residual and Jacobian
+        J.setZero();
+        J.block(0, 0, N, N) = hessianL.template cast<double>();
+        J.block(0, N, N, N) = -hessianV.template cast<double>();
+        for (auto i = 0; i < N; ++i) {
+            bool indexnonzero = rhovecL(i) > 0 && rhovecV(i) > 0;
+            if (indexnonzero) {
+                const Scalar ri = PsirgradL(i) + RT * log(rhovecL(i)) - (PsirgradV(i) + RT * log(rhovecV(i)));
+                r(i) = static_cast<double>(ri);
+                J(i, i) += static_cast<double>(RT / rhovecL(i));
+                J(i, N + i) -= static_cast<double>(RT / rhovecV(i));
+            } else {
+                const Scalar ri = PsirgradL(i) - PsirgradV(i);
+                r(i) = static_cast<double>(ri);
+            }
         }
-        if (index1nonzero){
-            r(1) = PsirgradL(1) + RT * log(rhovecL(1)) - (PsirgradV(1) + RT * log(rhovecV(1)));
-        } else {
-            r(1) = PsirgradL(1) - PsirgradV(1);
+        // Pressure equality in residual and Jacobian
+        r(N) = static_cast<double>(Scalar(pL - pV));
+        J.block(N, 0, 1, N) = dpdrhovecL.matrix().transpose().template cast<double>();
+        J.block(N, N, 1, N) = -dpdrhovecV.matrix().transpose().template cast<double>();
+        // Mole fraction composition specification for the first N-1 components in residual and Jacobian
+        for (auto i = 0; i < N - 1; ++i) {
+            const Scalar ri = rhovecL(i) / rhoL - xspec(i);
+            r(N + 1 + i) = static_cast<double>(ri);
+            J.block(N + 1 + i, 0, 1, N).setConstant(static_cast<double>(Scalar(-rhovecL(i) / (rhoL * rhoL)))); // dxi/drhoj (j!=i)
+            J(N + 1 + i, i) = static_cast<double>(Scalar((rhoL - rhovecL(i)) / (rhoL * rhoL))); // dxi/drhoj (j=i)
         }
-        r(2) = pL - pV;
-        r(3) = rhovecL(0) / rhovecL.sum() - xspec(0);
+    }
 
-        // Chemical potential contributions in Jacobian
-        J(0, 0) = hessianL(0, 0) + (index0nonzero ? RT / rhovecL(0) : 0);
-        J(0, 1) = hessianL(0, 1);
-        J(1, 0) = hessianL(1, 0); // symmetric, so same as above
-        J(1, 1) = hessianL(1, 1) + (index1nonzero ? RT / rhovecL(1) : 0);
-        J(0, 2) = -(hessianV(0, 0) + (index0nonzero ? RT / rhovecV(0) : 0));
-        J(0, 3) = -(hessianV(0, 1));
-        J(1, 2) = -(hessianV(1, 0)); // symmetric, so same as above
-        J(1, 3) = -(hessianV(1, 1) + (index1nonzero ? RT / rhovecV(1) : 0));
-        // Pressure contributions in Jacobian
-        J(2, 0) = dpdrhovecL(0);
-        J(2, 1) = dpdrhovecL(1);
-        J(2, 2) = -dpdrhovecV(0);
-        J(2, 3) = -dpdrhovecV(1);
-        // Mole fraction composition specification in Jacobian
-        J.row(3).array() = 0.0;
-        J(3, 0) = (rhoL - rhovecL(0)) / (rhoL * rhoL); // dxi/drhoj (j=i)
-        J(3, 1) = -rhovecL(0) / (rhoL * rhoL); // dxi/drhoj (j!=i)
+    /**
+     * The Newton iterations of mix_VLE_Tx, in which evaluate(rhovecL, rhovecV, J, r, tel) fills the Jacobian and the residual at
+     * the concentrations of the phases and counts its work in tel; see mix_VLE_Tx for the other arguments
+     */
+    template<typename Evaluator>
+    auto mix_VLE_Tx_iterate(Evaluator&& evaluate, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const Eigen::ArrayXd& xspec, double atol, double reltol, double axtol, double relxtol, int maxiter, SolverTelemetry* telemetry) {
+        using Scalar = double;
+        TelemetryClock clock;
+        SolverTelemetry tel;
+
+        const Eigen::Index N = rhovecL0.size();
+        auto lengths = (Eigen::ArrayX<Eigen::Index>(3) << rhovecL0.size(), rhovecV0.size(), xspec.size()).finished();
+        if (lengths.minCoeff() != lengths.maxCoeff()){
+            throw InvalidArgument("lengths of rhovecs and xspec must be the same in mix_VLE_Tx");
+        }
+        Eigen::MatrixXd J(2 * N, 2 * N), r(2 * N, 1), x(2 * N, 1);
+        x.col(0).array().head(N) = rhovecL0;
+        x.col(0).array().tail(N) = rhovecV0;
 
-        // Solve for the step
-        Eigen::ArrayXd dx = J.colPivHouseholderQr().solve(-r);
+        Eigen::Map<Eigen::ArrayXd> rhovecL(&(x(0)), N);
+        Eigen::Map<Eigen::ArrayXd> rhovecV(&(x(0 + N)), N);
 
-        if ((!dx.isFinite()).all()) {
-            return_code = VLE_return_code::notfinite_step;
-            break;
-        }
+        VLE_return_code return_code = VLE_return_code::unset;
 
-        // Constrain the step to yield only positive densities
-        if ((x.array() + dx.array() < 0).any()) {
-            // The step that would take all the concentrations to zero
-            Eigen::ArrayXd dxmax = -x;
-            // Most limiting variable is the smallest allowed
-            // before going negative
-            auto f = (dx / dxmax).minCoeff();
-            dx *= f / 2; // Only allow a step half the way to most constraining molar concentrations at most
-        }
+        for (int iter = 0; iter < maxiter; ++iter) {
+
+            evaluate(rhovecL, rhovecV, J, r, tel);
+            tel.num_iter++;
 
-        // Don't allow changes to components with input zero mole fractions
-        for (auto i = 0; i < 2; ++i) {
-            if (xspec[i] == 0) {
-                dx[i] = 0;
-                dx[i+2] = 0;
+            // Solve for the step
+            Eigen::ArrayXd dx = solve_two_phase_Jacobian(J, r.col(0));
+
+            if ((!dx.isFinite()).all()) {
+                return_code = VLE_return_code::notfinite_step;
+                break;
             }
-        }
 
-        x.array() += dx;
+            // Constrain the step to yield only positive densities
+            if ((x.array() + dx.array() < 0).any()) {
+                // The step that would take all the concentrations to zero
+                Eigen::ArrayXd dxmax = -x;
+                // Most limiting variable is the smallest allowed
+                // before going negative
+                auto f = (dx / dxmax).minCoeff();
+                dx *= f / 2; // Only allow a step half the way to most constraining molar concentrations at most
+                tel.num_rejected++;
+            }
 
-        auto xtol_threshold = (axtol + relxtol * x.array().cwiseAbs()).eval();
-        if ((dx.array().cwiseAbs() < xtol_threshold).all()) {
-            return_code = VLE_return_code::xtol_satisfied;
-            break;
-        }
+            // Don't allow changes to components with input zero mole fractions
+            for (auto i = 0; i < N; ++i) {
+                if (xspec[i] == 0) {
+                    dx[i] = 0;
+                    dx[i+N] = 0;
+                }
+            }
 
-        auto error_threshold = (atol + reltol * r.array().cwiseAbs()).eval();
-        if ((r.array().cwiseAbs() < error_threshold).all()) {
-            return_code = VLE_return_code::functol_satisfied;
-            break;
-        }
+            x.array() += dx;
 
-        // If the solution has stopped improving, stop. The change in x is equal to dx in infinite precision, but 
-        // not when finite precision is involved, use the minimum non-denormal float as the determination of whether
-        // the values are done changing
-        if (((x.array() - dx.array()).cwiseAbs() < std::numeric_limits<Scalar>::min()).all()) {
-            return_code = VLE_return_code::xtol_satisfied;
-            break;
+            auto xtol_threshold = (axtol + relxtol * x.array().cwiseAbs()).eval();
+            if ((dx.array().cwiseAbs() < xtol_threshold).all()) {
+                return_code = VLE_return_code::xtol_satisfied;
+                break;
+            }
+
+            auto error_threshold = (atol + reltol * r.array().cwiseAbs()).eval();
+            if ((r.array().cwiseAbs() < error_threshold).all()) {
+                return_code = VLE_return_code::functol_satisfied;
+                break;
+            }
+
+            // If the solution has stopped improving, stop. The change in x is equal to dx in infinite precision, but 
+            // not when finite precision is involved, use the minimum non-denormal float as the determination of whether
+            // the values are done changing
+            if (((x.array() - dx.array()).cwiseAbs() < std::numeric_limits<Scalar>::min()).all()) {
+                return_code = VLE_return_code::xtol_satisfied;
+                break;
+            }
+            if (iter == maxiter - 1){
+                return_code = VLE_return_code::maxiter_met;
+            }
         }
-        if (iter == maxiter - 1){
-            return_code = VLE_return_code::maxiter_met;
+        if (telemetry != nullptr) {
+            tel.elapsed_s = clock.elapsed_s();
+            *telemetry = tel;
         }
+        Eigen::ArrayXd rhovecLfinal = rhovecL, rhovecVfinal = rhovecV;
+        return std::make_tuple(return_code, rhovecLfinal, rhovecVfinal);
     }
-    Eigen::ArrayXd rhovecLfinal = rhovecL, rhovecVfinal = rhovecV;
-    return std::make_tuple(return_code, rhovecLfinal, rhovecVfinal);
 }
 
+/***
+* \brief Do a vapor-liquid phase equilibrium problem for a mixture with mole fractions specified in the liquid phase
+* \param model The model to operate on
+* \param T Temperature
+* \param rhovecL0 Initial values for liquid mole concentrations
+* \param rhovecV0 Initial values for vapor mole concentrations
+* \param xspec Specified mole fractions for all components
+* \param atol Absolute tolerance on function values
+* \param reltol Relative tolerance on function values
+* \param axtol Absolute tolerance on steps in independent variables
+* \param relxtol Relative tolerance on steps in independent variables
+* \param maxiter Maximum number of iterations permitted
+* \param telemetry If not null, filled with the counters of the work done
+* 
+* Note: if a mole fraction is zero in the provided vector, the molar concentrations in 
+* this component will not be allowed to change (they will stay zero, avoiding the possibility that 
+* they go to a negative value, which can cause trouble for some EOS)
+*/
+inline auto mix_VLE_Tx(const AbstractModel& model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const Eigen::ArrayXd& xspec, double atol, double reltol, double axtol, double relxtol, int maxiter, SolverTelemetry* telemetry = nullptr) {
+    const Eigen::Index N = rhovecL0.size();
+    const double RT = model.get_R(xspec) * T;
+
+    // Buffers re-used in each iteration to avoid heap allocations
+    double PsirL, PsirV;
+    Eigen::ArrayXd PsirgradL(N), PsirgradV(N);
+    Eigen::MatrixXd hessianL(N, N), hessianV(N, N);
+
+    auto evaluate = [&](const auto& rhovecL, const auto& rhovecV, Eigen::MatrixXd& J, Eigen::MatrixXd& r, SolverTelemetry& tel) {
+        model.build_Psir_fgradHessian_autodiff(T, rhovecL, PsirL, PsirgradL, hessianL);
+        model.build_Psir_fgradHessian_autodiff(T, rhovecV, PsirV, PsirgradV, hessianV);
+        tel.num_Hessian += 2;
+        internal::build_VLE_Tx_system(RT, rhovecL, rhovecV, xspec, PsirL, PsirgradL, hessianL, PsirV, PsirgradV, hessianV, J, r);
+    };
+    return internal::mix_VLE_Tx_iterate(evaluate, rhovecL0, rhovecV0, xspec, atol, reltol, axtol, relxtol, maxiter, telemetry);
+}
+
+/**
+ The inverse of the Jacobian of a system of equations for the quasi-Newton modes of mix_VLE_Tp and mixture_VLE_px.  It is obtained
+ from an LU factorization of an exact Jacobian in reset, and then kept up to date with Broyden's rank-one updates, applied to the
+ inverse with the Sherman-Morrison formula, so that no factorization is needed between resets.
+ */
+class BroydenInverseJacobian {
+private:
+    Eigen::MatrixXd Jinv;
+public:
+    void reset(const Eigen::MatrixXd& J) { Jinv = J.partialPivLu().inverse(); }
+
+    /// The quasi-Newton step for the residual r
+    Eigen::VectorXd step(const Eigen::VectorXd& r) const { return -Jinv*r; }
+
+    /// Update after the step dx changed the residual by dr; returns false if the update is not possible, in which case the
+    /// Jacobian should be reset
+    bool update(const Eigen::VectorXd& dx, const Eigen::VectorXd& dr) {
+        Eigen::VectorXd Jinv_dr = Jinv*dr;
+        double denom = dx.dot(Jinv_dr);
+        if (!std::isfinite(denom) || std::abs(denom) < 1e-300) {
+            return false;
+        }
+        Jinv += ((dx - Jinv_dr)*(dx.transpose()*Jinv))/denom;
+        return true;
+    }
+};
+
 template<typename Model>
 struct hybrj_functor__mix_VLE_Tp : Functor<double>
 {
     const Model& model;
     const double T, p;
 
+    // Buffers re-used between calls to avoid heap allocations
+    double PsirL = 0, PsirV = 0;
+    Eigen::ArrayXd PsirgradL, PsirgradV;
+    Eigen::MatrixXd hessianL, hessianV;
+    int num_Hessian = 0, num_residual = 0; ///< The evaluations, for the telemetry
+
     hybrj_functor__mix_VLE_Tp(const Model& model, const double T, const double p) : Functor<double>(4, 4), model(model), T(T), p(p) {}
 
-    int operator()(const VectorXd& x, VectorXd& r)
+    /// The residual, from the values of Psir and its gradient in the buffers
+    void fill_residual(const VectorXd& x, const double RT, VectorXd& r) const
     {
         const VectorXd::Index n = x.size() / 2;
         Eigen::Map<const Eigen::ArrayXd> rhovecL(&(x(0)), n);
         Eigen::Map<const Eigen::ArrayXd> rhovecV(&(x(0 + n)), n);
-        auto RT = model.get_R((rhovecL / rhovecL.sum()).eval()) * T;
-        auto [PsirL, PsirgradL, hessianL] = model.build_Psir_fgradHessian_autodiff(T, rhovecL);
-        auto [PsirV, PsirgradV, hessianV] = model.build_Psir_fgradHessian_autodiff(T, rhovecV);
         auto rhoL = rhovecL.sum();
         auto rhoV = rhovecV.sum();
         Scalar pL = rhoL * RT - PsirL + (rhovecL.array() * PsirgradL.array()).sum(); // The (array*array).sum is a dot product
@@ -230,9 +364,10 @@ struct hybrj_functor__mix_VLE_Tp : Functor<double>
         }
         r(2) = (pV - p) / p;
         r(3) = (pL - p) / p;
-        return 0;
     }
-    int df(const VectorXd& x, MatrixXd& J)
+
+    /// The Jacobian, from the values of the Hessians in the buffers
+    void fill_jacobian(const VectorXd& x, const double RT, MatrixXd& J) const
     {
         const VectorXd::Index n = x.size() / 2;
         Eigen::Map<const Eigen::ArrayXd> rhovecL(&(x(0)), n);
@@ -240,9 +375,6 @@ struct hybrj_functor__mix_VLE_Tp : Functor<double>
         assert(J.rows() == 2*n);
         assert(J.cols() == 2*n);
 
-        auto RT = model.get_R((rhovecL / rhovecL.sum()).eval()) * T;
-        auto [PsirL, PsirgradL, hessianL] = model.build_Psir_fgradHessian_autodiff(T, rhovecL);
-        auto [PsirV, PsirgradV, hessianV] = model.build_Psir_fgradHessian_autodiff(T, rhovecV);
         auto dpdrhovecL = RT + (hessianL * rhovecL.matrix()).array();
         auto dpdrhovecV = RT + (hessianV * rhovecV.matrix()).array();
 
@@ -267,6 +399,54 @@ struct hybrj_functor__mix_VLE_Tp : Functor<double>
         J.row(3).array() = 0.0;
         J(3, 0) = dpdrhovecL(0) / p;
         J(3, 1) = dpdrhovecL(1) / p;
+    }
+
+    auto get_RT(const VectorXd& x) const {
+        const VectorXd::Index n = x.size() / 2;
+        Eigen::Map<const Eigen::ArrayXd> rhovecL(&(x(0)), n);
+        return model.get_R((rhovecL / rhovecL.sum()).eval()) * T;
+    }
+
+    int operator()(const VectorXd& x, VectorXd& r)
+    {
+        const VectorXd::Index n = x.size() / 2;
+        Eigen::Map<const Eigen::ArrayXd> rhovecL(&(x(0)), n);
+        Eigen::Map<const Eigen::ArrayXd> rhovecV(&(x(0 + n)), n);
+        model.build_Psir_fgradHessian_autodiff(T, rhovecL, PsirL, PsirgradL, hessianL);
+        model.build_Psir_fgradHessian_autodiff(T, rhovecV, PsirV, PsirgradV, hessianV);
+        num_Hessian += 2;
+        fill_residual(x, get_RT(x), r);
+        return 0;
+    }
+
+    /// The residual without the Hessians, only Psir and its gradient are evaluated
+    int residual(const VectorXd& x, VectorXd& r)
+    {
+        const VectorXd::Index n = x.size() / 2;
+        const Eigen::ArrayXd rhovecL = x.head(n).array(), rhovecV = x.segment(n, n).array();
+        auto Psir = [&](const Eigen::ArrayXd& rhovec) {
+            auto rho = rhovec.sum();
+            auto molefrac = (rhovec / rho).eval();
+            return model.get_Arxy(0, 0, T, rho, molefrac) * model.get_R(molefrac) * T * rho;
+        };
+        PsirL = Psir(rhovecL);
+        PsirV = Psir(rhovecV);
+        PsirgradL = model.build_Psir_gradient_autodiff(T, rhovecL);
+        PsirgradV = model.build_Psir_gradient_autodiff(T, rhovecV);
+        num_residual++;
+        fill_residual(x, get_RT(x), r);
+        return 0;
+    }
+
+    int df(const VectorXd& x, MatrixXd& J)
+    {
+        const VectorXd::Index n = x.size() / 2;
+        Eigen::Map<const Eigen::ArrayXd> rhovecL(&(x(0)), n);
+        Eigen::Map<const Eigen::ArrayXd> rhovecV(&(x(0 + n)), n);
+        model.build_Psir_fgradHessian_autodiff(T, rhovecL, PsirL, PsirgradL, hessianL);
+        model.build_Psir_fgradHessian_autodiff(T, rhovecV, PsirV, PsirgradV, hessianV);
+        num_Hessian += 2;
+        fill_jacobian(x, get_RT(x), J);
         return 0;
     }
 };
@@ -287,6 +467,8 @@ struct hybrj_functor__mix_VLE_Tp : Functor<double>
 inline auto mix_VLE_Tp(const AbstractModel& model, double T, double pgiven, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<MixVLETpFlags>& flags_ = std::nullopt) {
     
     auto flags = flags_.value_or(MixVLETpFlags{});
+    internal::TelemetryClock clock;
+    SolverTelemetry tel;
 
     const Eigen::Index N = rhovecL0.size();
     auto lengths = (Eigen::ArrayX<Eigen::Index>(2) << rhovecL0.size(), rhovecV0.size()).finished();
@@ -346,13 +528,65 @@ inline auto mix_VLE_Tp(const AbstractModel& model, double T, double pgiven, cons
         }
         niter = solver.iter;
         nfev = solver.nfev;
+        tel.num_iter = static_cast<int>(solver.iter);
+    }
+    else if (flags.broyden) {
+        // Quasi-Newton iteration, the Hessians are only evaluated at the start and when the progress stalls
+        BroydenInverseJacobian Jinv;
+        Eigen::VectorXd rv(2 * N), rvnew(2 * N);
+        bool refresh = true;
+        for (auto iter = 0; iter < flags.maxiter; ++iter) {
+            if (refresh) {
+                functor(x, rv);
+                functor.fill_jacobian(x, functor.get_RT(x), J);
+                Jinv.reset(J);
+                refresh = false;
+            }
+            Eigen::ArrayXd dx = Jinv.step(rv);
+            if (!dx.isFinite().all()) {
+                return_code = VLE_return_code::notfinite_step;
+                break;
+            }
+            if ((x.array() + dx.array() < 0).any()) {
+                // Only allow a step half the way to most constraining molar concentrations at most, as in Newton's method below
+                Eigen::ArrayXd dxmax = -x;
+                auto f = (dx/dxmax).minCoeff();
+                dx *= f/2;
+                tel.num_rejected++;
+            }
+            x.array() += dx.array();
+            functor.residual(x, rvnew);
+            niter = iter;
+            nfev++;
+            tel.num_iter++;
+
+            auto error_threshold = (flags.atol + flags.reltol * rvnew.array().cwiseAbs()).eval();
+            if ((rvnew.array().cwiseAbs() < error_threshold).all()) {
+                return_code = VLE_return_code::functol_satisfied;
+                success = true;
+                break;
+            }
+            auto xtol_threshold = (flags.axtol + flags.relxtol * x.array().cwiseAbs()).eval();
+            if ((dx.cwiseAbs() < xtol_threshold).all()) {
+                return_code = VLE_return_code::xtol_satisfied;
+                success = true;
+                break;
+            }
+            if (rvnew.norm() > flags.broyden_stall_ratio * rv.norm() || !Jinv.update(dx.matrix(), rvnew - rv)) {
+                refresh = true;
+            }
+            rv = rvnew;
+            if (iter == flags.maxiter - 1) {
+                return_code = VLE_return_code::maxiter_met;
+            }
+        }
     }
     else {
         for (auto iter = 0; iter < flags.maxiter; ++iter) {
             Eigen::VectorXd rv(2 * N); rv.setZero();
             functor(x, rv);
             functor.df(x, J);
-            Eigen::ArrayXd dx = J.colPivHouseholderQr().solve(-rv);
+            Eigen::ArrayXd dx = internal::solve_two_phase_Jacobian(J, rv);
             if ((x.array() + dx.array() < 0).any()) {
                 // The step that would take all the concentrations to zero
                 Eigen::ArrayXd dxmax = -x;
@@ -360,10 +594,12 @@ inline auto mix_VLE_Tp(const AbstractModel& model, double T, double pgiven, cons
                 // before going negative
                 auto f = (dx/dxmax).minCoeff();
                 dx *= f/2; // Only allow a step half the way to most constraining molar concentrations at most
+                tel.num_rejected++;
             }
             x.array() += dx.array();
             niter = iter;
             nfev = iter;
+            tel.num_iter++;
         }
     }
     Eigen::VectorXd final_r(2 * N); final_r.setZero();
@@ -382,6 +618,10 @@ inline auto mix_VLE_Tp(const AbstractModel& model, double T, double pgiven, cons
     r.rhovecL = rhovecL;
     r.rhovecV = rhovecV;
     r.T = T;
+    tel.num_Hessian = functor.num_Hessian;
+    tel.num_residual = functor.num_residual;
+    tel.elapsed_s = clock.elapsed_s();
+    r.telemetry = tel;
     return r;
 }
 
@@ -395,11 +635,14 @@ inline auto mix_VLE_Tp(const AbstractModel& model, double T, double pgiven, cons
 * \param rhovecV0 Initial values for vapor mole concentrations
 
 * \param flags Additional flags
+* \param telemetry If not null, filled with the counters of the work done
 */
-inline auto mixture_VLE_px(const AbstractModel& model, double p_spec, const Eigen::ArrayXd& xmolar_spec, double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<MixVLEpxFlags>& flags_ = std::nullopt) {
+inline auto mixture_VLE_px(const AbstractModel& model, double p_spec, const Eigen::ArrayXd& xmolar_spec, double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<MixVLEpxFlags>& flags_ = std::nullopt, SolverTelemetry* telemetry = nullptr) {
     using Scalar = double;
     
     auto flags = flags_.value_or(MixVLEpxFlags{});
+    internal::TelemetryClock clock;
+    SolverTelemetry tel;
 
     const Eigen::Index N = rhovecL0.size();
     auto lengths = (Eigen::ArrayX<Eigen::Index>(3) << rhovecL0.size(), rhovecV0.size(), xmolar_spec.size()).finished();
@@ -425,8 +668,8 @@ inline auto mixture_VLE_px(const AbstractModel& model, double p_spec, const Eige
 
     VLE_return_code return_code = VLE_return_code::unset;
 
-    for (int iter = 0; iter < flags.maxiter; ++iter) {
-
+    // The residual vector and the exact Jacobian at the current values of T and the concentrations
+    auto calc_rJ = [&]() {
         auto RL = model.get_R(xmolar_spec);
         auto RLT = RL * T;
         auto RVT = RLT; // Note: this should not be exactly the same if you use mole-fraction-weighted gas constants
@@ -434,6 +677,7 @@ inline auto mixture_VLE_px(const AbstractModel& model, double p_spec, const Eige
         // calculations from the EOS in the isochoric thermodynamics formalism
         auto [PsirL, PsirgradL, hessianL] = model.build_Psir_fgradHessian_autodiff(T, rhovecL);
         auto [PsirV, PsirgradV, hessianV] = model.build_Psir_fgradHessian_autodiff(T, rhovecV);
+        tel.num_Hessian += 2;
         auto DELTAdmu_dT_res = (model.build_d2PsirdTdrhoi_autodiff(T, rhovecL.eval())
                               - model.build_d2PsirdTdrhoi_autodiff(T, rhovecV.eval())).eval();
 
@@ -482,6 +726,82 @@ inline auto mixture_VLE_px(const AbstractModel& model, double p_spec, const Eige
         Eigen::ArrayXXd AA = rhovecL.matrix().reshaped(N, 1).replicate(1, N).array();
         Eigen::MatrixXd M = ((rhoL * Eigen::MatrixXd::Identity(N, N).array() - AA) / (rhoL * rhoL));
         J.block(N+2, 1, N-1, N) = M.block(0,0,N-1,N);
+    };
+
+    // The residual vector alone, requiring only Psir and its gradient and not the Hessians, for the quasi-Newton mode
+    auto calc_r = [&]() {
+        auto RLT = model.get_R(xmolar_spec) * T;
+        auto RVT = RLT;
+        auto PsirL = model.get_Arxy(0, 0, T, rhovecL.sum(), (rhovecL/rhovecL.sum()).eval())*RLT*rhovecL.sum();
+        auto PsirV = model.get_Arxy(0, 0, T, rhovecV.sum(), (rhovecV/rhovecV.sum()).eval())*RVT*rhovecV.sum();
+        auto PsirgradL = model.build_Psir_gradient_autodiff(T, rhovecL.eval());
+        auto PsirgradV = model.build_Psir_gradient_autodiff(T, rhovecV.eval());
+        tel.num_residual++;
+        Scalar pL = rhovecL.sum() * RLT - PsirL + (rhovecL.array() * PsirgradL.array()).sum();
+        Scalar pV = rhovecV.sum() * RVT - PsirV + (rhovecV.array() * PsirgradV.array()).sum();
+        r.head(N) = PsirgradL + RLT*log(rhovecL) - (PsirgradV + RVT*log(rhovecV));
+        r(N) = pL/p_spec - 1;
+        r(N+1) = pV/p_spec - 1;
+        r.tail(N-1) = (rhovecL/rhovecL.sum()).head(N-1) - xmolar_spec.head(N-1);
+    };
+
+    auto finish = [&]() {
+        if (telemetry != nullptr) {
+            tel.elapsed_s = clock.elapsed_s();
+            *telemetry = tel;
+        }
+        Eigen::ArrayXd rhovecLfinal = rhovecL, rhovecVfinal = rhovecV;
+        return std::make_tuple(return_code, T, rhovecLfinal, rhovecVfinal);
+    };
+
+    if (flags.broyden) {
+        // Quasi-Newton iteration, the Hessians are only evaluated at the start and when the progress stalls
+        BroydenInverseJacobian Jinv;
+        Eigen::VectorXd rold(2*N + 1);
+        bool refresh = true;
+        for (int iter = 0; iter < flags.maxiter; ++iter) {
+            if (refresh) {
+                calc_rJ();
+                Jinv.reset(J);
+                refresh = false;
+            }
+            Eigen::VectorXd dx = Jinv.step(r);
+            tel.num_iter++;
+            if (!dx.array().isFinite().all()) {
+                return_code = VLE_return_code::notfinite_step;
+                break;
+            }
+            T += dx(0);
+            x(0) = T;
+            x.tail(2*N).array() += dx.tail(2*N).array();
+
+            rold = r;
+            calc_r();
+
+            auto error_threshold = (flags.atol + flags.reltol * r.array().cwiseAbs()).eval();
+            if ((r.array().cwiseAbs() < error_threshold).all()) {
+                return_code = VLE_return_code::functol_satisfied;
+                break;
+            }
+            auto xtol_threshold = (flags.axtol + flags.relxtol * x.array().cwiseAbs()).eval();
+            if ((dx.array().cwiseAbs() < xtol_threshold).all()) {
+                return_code = VLE_return_code::xtol_satisfied;
+                break;
+            }
+            if (r.norm() > flags.broyden_stall_ratio * rold.norm() || !Jinv.update(dx, r - rold)) {
+                refresh = true;
+            }
+            if (iter == flags.maxiter - 1) {
+                return_code = VLE_return_code::maxiter_met;
+            }
+        }
+        return finish();
+    }
+
+    for (int iter = 0; iter < flags.maxiter; ++iter) {
+
+        calc_rJ();
+        tel.num_iter++;
 
         // Solve for the step
         Eigen::ArrayXd dx = J.colPivHouseholderQr().solve(-r);
@@ -517,15 +837,65 @@ inline auto mixture_VLE_px(const AbstractModel& model, double p_spec, const Eige
             return_code = VLE_return_code::maxiter_met;
         }
     }
-    Eigen::ArrayXd rhovecLfinal = rhovecL, rhovecVfinal = rhovecV;
-    return std::make_tuple(return_code, T, rhovecLfinal, rhovecVfinal);
+    return finish();
 }
 
-inline auto get_drhovecdp_Tsat(const AbstractModel& model, const double &T, const Eigen::ArrayXd& rhovecL, const Eigen::ArrayXd& rhovecV) {
+namespace internal {
+    /**
+     * The residual Helmholtz energy density and its gradient and Hessian with respect to the molar concentrations at the last
+     * state (T, rhovec) that was requested, with the Hessian of the total Helmholtz energy density, all from one call to
+     * build_Psi_fgradHessian_autodiff. Consumers that need these
+     * quantities at the same state, like the right-hand side of a tracer and the storage of the accepted point, then share one
+     * evaluation of the automatic differentiation kernels. Any change of the state leads to a new evaluation.
+     */
+    class PsirDerivativeCache {
+    private:
+        const AbstractModel& model;
+        double T = std::numeric_limits<double>::quiet_NaN();
+        Eigen::ArrayXd rhovec;
+    public:
+        double Psir = 0, RT = 0;
+        Eigen::ArrayXd gradient; ///< The residual chemical potentials
+        Eigen::MatrixXd Hessian; ///< The Hessian of the residual Helmholtz energy density
+        Eigen::MatrixXd Psi_Hessian; ///< The Hessian of the total Helmholtz energy density
+        int num_evaluations = 0; ///< The number of evaluations of the derivatives, for diagnostics
+
+        PsirDerivativeCache(const AbstractModel& model) : model(model) {};
+
+        /// Make the cached values those of the state, evaluating them only if the state differs from the cached one
+        void update(const double T, const Eigen::Ref<const Eigen::ArrayXd>& rhovec) {
+            if (T == this->T && this->rhovec.size() == rhovec.size() && (this->rhovec == rhovec).all()) {
+                return;
+            }
+            model.build_Psi_fgradHessian_autodiff(T, rhovec, Psir, gradient, Hessian, Psi_Hessian);
+            RT = model.get_R((rhovec / rhovec.sum()).eval()) * T;
+            this->T = T;
+            this->rhovec = rhovec;
+            num_evaluations++;
+        }
+        /// The Hessian of the total Helmholtz energy density, with the ideal-gas contribution RT/rho_i on the diagonal
+        const Eigen::MatrixXd& get_Psi_Hessian() const {
+            return Psi_Hessian;
+        }
+        /// The residual pressure, from \f$p^{\rm r} = -\Psi^{\rm r} + \sum_i\rho_i\mu^{\rm r}_i\f$
+        double get_pr() const {
+            return -Psir + (rhovec * gradient).sum();
+        }
+    };
+}
+
+/**
+ * \brief Derivative of molar concentration vectors w.r.t. p along an isotherm of the phase envelope for binary mixtures
+ *
+ * The derivatives of each phase are taken from (and stored in) the caches, which are updated to the states of the phases
+*/
+inline auto get_drhovecdp_Tsat(const AbstractModel& model, const double &T, const Eigen::ArrayXd& rhovecL, const Eigen::ArrayXd& rhovecV, internal::PsirDerivativeCache& cacheL, internal::PsirDerivativeCache& cacheV) {
     //tic = timeit.default_timer();
     using Scalar = double;
-    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> Hliq = model.build_Psi_Hessian_autodiff(T, rhovecL).eval();
-    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> Hvap = model.build_Psi_Hessian_autodiff(T, rhovecV).eval();
+    cacheL.update(T, rhovecL);
+    cacheV.update(T, rhovecV);
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> Hliq = cacheL.get_Psi_Hessian();
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> Hvap = cacheV.get_Psi_Hessian();
     //Hvap[~np.isfinite(Hvap)] = 1e20;
     //Hliq[~np.isfinite(Hliq)] = 1e20;
 
@@ -542,12 +912,12 @@ inline auto get_drhovecdp_Tsat(const AbstractModel& model, const double &T, cons
         A(1, 1) = Hliq.row(1).dot(rhovecL.matrix());
 
         drhodp_liq = linsolve(A, b);
-        drhodp_vap = linsolve(Hvap, Hliq*drhodp_liq);
+        drhodp_vap = linsolve_symmetric(Hvap, Hliq*drhodp_liq);
     }
     else{
         // Special treatment for infinite dilution
-        auto murL = model.build_Psir_gradient_autodiff(T, rhovecL);
-        auto murV = model.build_Psir_gradient_autodiff(T, rhovecV);
+        const auto& murL = cacheL.gradient;
+        const auto& murV = cacheV.gradient;
         auto RL = model.get_R(rhovecL / rhovecL.sum());
         auto RV = model.get_R(rhovecV / rhovecV.sum());
 
@@ -592,6 +962,11 @@ inline auto get_drhovecdp_Tsat(const AbstractModel& model, const double &T, cons
     return std::make_tuple(drhodp_liq, drhodp_vap);
 }
 
+inline auto get_drhovecdp_Tsat(const AbstractModel& model, const double &T, const Eigen::ArrayXd& rhovecL, const Eigen::ArrayXd& rhovecV) {
+    internal::PsirDerivativeCache cacheL(model), cacheV(model);
+    return get_drhovecdp_Tsat(model, T, rhovecL, rhovecV, cacheL, cacheV);
+}
+
 /**
  * Derivative of molar concentration vectors w.r.t. p along an isobar of the phase envelope for binary mixtures
 */
@@ -622,7 +997,7 @@ inline auto get_drhovecdT_psat(const AbstractModel& model, const double &T, cons
         // Calculate the derivatives of the liquid phase
         drhovecdT_liq = linsolve(A, b);
         // Calculate the derivatives of the vapor phase
-        drhovecdT_vap = linsolve(Hvap, ((Hliq*drhovecdT_liq).array() - DELTAdmu_dT.array()).eval());
+        drhovecdT_vap = linsolve_symmetric(Hvap, ((Hliq*drhovecdT_liq).array() - DELTAdmu_dT.array()).eval());
     }
     else{
         // Special treatment for infinite dilution
@@ -695,6 +1070,99 @@ inline auto get_drhovecdT_psat(const AbstractModel& model, const double &T, cons
     return std::make_tuple(drhovecdT_liq, drhovecdT_vap);
 }
 
+namespace internal {
+    /**
+     * The N-2 rows of the linear constraints on the changes of the molar concentrations that require the mole fractions of the
+     * phase to change in the direction given by xdirection. The mole fractions change by dx = (I - x 1^T) drhovec / rho, and
+     * the changes must be orthogonal to the N-2 vectors that complete the ones vector and xdirection to a basis
+     */
+    inline Eigen::MatrixXd get_composition_direction_constraints(const Eigen::ArrayXd& rhovec, const Eigen::ArrayXd& xdirection) {
+        const auto N = rhovec.size();
+        if (xdirection.size() != N) {
+            throw InvalidArgument("The composition direction must have one entry per component");
+        }
+        if ((xdirection - xdirection.mean()).matrix().norm() == 0) {
+            throw InvalidArgument("The composition direction cannot be a multiple of the ones vector");
+        }
+        Eigen::MatrixXd M(N, 2);
+        M.col(0).setOnes();
+        M.col(1) = xdirection.matrix();
+        Eigen::MatrixXd Q = M.householderQr().householderQ();
+        double rho = rhovec.sum();
+        Eigen::MatrixXd P = (Eigen::MatrixXd::Identity(N, N) - (rhovec / rho).matrix() * Eigen::RowVectorXd::Ones(N)) / rho;
+        return Q.rightCols(N - 2).transpose() * P;
+    }
+}
+
+/**
+ * \brief Derivative of molar concentration vectors w.r.t. p along an isotherm of the phase envelope for mixtures with any number of components
+ *
+ * An isotherm of the phase envelope of an N-component mixture has N-1 degrees of freedom, so the liquid mole fractions
+ * are required to change in the direction of xdirection, which removes the other N-2 of them. For binary mixtures the
+ * direction is not used and the result is the same as that of get_drhovecdp_Tsat. All the concentrations must be nonzero.
+ */
+inline auto get_drhovecdp_Tsat_multicomponent(const AbstractModel& model, const double &T, const Eigen::ArrayXd& rhovecL, const Eigen::ArrayXd& rhovecV, const Eigen::ArrayXd& xdirection, internal::PsirDerivativeCache& cacheL, internal::PsirDerivativeCache& cacheV) {
+    if (rhovecL.size() != rhovecV.size() || rhovecL.size() < 2) {
+        throw InvalidArgument("The molar concentration arrays must be of the same size, with at least two components");
+    }
+    if ((rhovecL == 0).any() || (rhovecV == 0).any()) {
+        throw InvalidArgument("Infinite dilution is not supported in get_drhovecdp_Tsat_multicomponent");
+    }
+    cacheL.update(T, rhovecL);
+    cacheV.update(T, rhovecV);
+    Eigen::MatrixXd Hliq = cacheL.get_Psi_Hessian();
+    Eigen::MatrixXd Hvap = cacheV.get_Psi_Hessian();
+
+    // The pressures of both phases change by dp = rhovec.(Hliq drhovecL), with the chemical potentials equal in both phases
+    auto N = rhovecL.size();
+    Eigen::MatrixXd A(N, N);
+    Eigen::VectorXd b = Eigen::VectorXd::Zero(N);
+    A.row(0) = (Hliq * rhovecV.matrix()).transpose(); b(0) = 1;
+    A.row(1) = (Hliq * rhovecL.matrix()).transpose(); b(1) = 1;
+    A.bottomRows(N - 2) = internal::get_composition_direction_constraints(rhovecL, xdirection);
+
+    Eigen::MatrixXd drhodp_liq = linsolve(A, b);
+    Eigen::MatrixXd drhodp_vap = linsolve_symmetric(Hvap, Hliq*drhodp_liq);
+    return std::make_tuple(drhodp_liq, drhodp_vap);
+}
+
+/// As above, with the derivatives of the phases evaluated for this call only
+inline auto get_drhovecdp_Tsat_multicomponent(const AbstractModel& model, const double &T, const Eigen::ArrayXd& rhovecL, const Eigen::ArrayXd& rhovecV, const Eigen::ArrayXd& xdirection) {
+    internal::PsirDerivativeCache cacheL(model), cacheV(model);
+    return get_drhovecdp_Tsat_multicomponent(model, T, rhovecL, rhovecV, xdirection, cacheL, cacheV);
+}
+
+/**
+ * \brief Derivative of molar concentration vectors w.r.t. T along an isobar of the phase envelope for mixtures with any number of components
+ *
+ * The liquid mole fractions are required to change in the direction of xdirection, as in get_drhovecdp_Tsat_multicomponent.
+ * For binary mixtures the result is the same as that of get_drhovecdT_psat. All the concentrations must be nonzero.
+ */
+inline auto get_drhovecdT_psat_multicomponent(const AbstractModel& model, const double &T, const Eigen::ArrayXd& rhovecL, const Eigen::ArrayXd& rhovecV, const Eigen::ArrayXd& xdirection) {
+    if (rhovecL.size() != rhovecV.size() || rhovecL.size() < 2) {
+        throw InvalidArgument("The molar concentration arrays must be of the same size, with at least two components");
+    }
+    if ((rhovecL == 0).any() || (rhovecV == 0).any()) {
+        throw InvalidArgument("Infinite dilution is not supported in get_drhovecdT_psat_multicomponent");
+    }
+    Eigen::MatrixXd Hliq = model.build_Psi_Hessian_autodiff(T, rhovecL).eval();
+    Eigen::MatrixXd Hvap = model.build_Psi_Hessian_autodiff(T, rhovecV).eval();
+
+    auto N = rhovecL.size();
+    Eigen::MatrixXd A(N, N);
+    Eigen::VectorXd b = Eigen::VectorXd::Zero(N);
+    auto DELTAdmu_dT = (model.get_dchempotdT_autodiff(T, rhovecV) - model.get_dchempotdT_autodiff(T, rhovecL)).eval();
+    A.row(0) = (Hliq * rhovecV.matrix()).transpose();
+    b(0) = DELTAdmu_dT.matrix().dot(rhovecV.matrix()) - model.get_dpdT_constrhovec(T, rhovecV);
+    A.row(1) = (Hliq * rhovecL.matrix()).transpose();
+    b(1) = -model.get_dpdT_constrhovec(T, rhovecL);
+    A.bottomRows(N - 2) = internal::get_composition_direction_constraints(rhovecL, xdirection);
+
+    Eigen::MatrixXd drhovecdT_liq = linsolve(A, b);
+    Eigen::MatrixXd drhovecdT_vap = linsolve_symmetric(Hvap, ((Hliq*drhovecdT_liq).array() - DELTAdmu_dT.array()).eval());
+    return std::make_tuple(drhovecdT_liq, drhovecdT_vap);
+}
+
 /***
 * \brief Derivative of molar concentration vectors w.r.t. T along an isopleth of the phase envelope for binary mixtures
 * 
@@ -727,7 +1195,7 @@ inline auto get_drhovecdT_xsat(const AbstractModel& model, const double& T, cons
         auto num = (deltas.matrix().dot(rhovecV.matrix()) - deltabeta); // numerator, a scalar
         auto den = (Hliq*(deltarho.matrix())).dot(molefracL.matrix()); // denominator, a scalar
         drhodT_liq = num/den*molefracL;
-        drhodT_vap = linsolve(Hvap, ((Hliq * drhodT_liq).array() - deltas.array()).eval());
+        drhodT_vap = linsolve_symmetric(Hvap, ((Hliq * drhodT_liq).array() - deltas.array()).eval());
     }
     else {
         throw std::invalid_argument("Infinite dilution not yet supported");
@@ -785,27 +1253,334 @@ auto get_dpsat_dTsat_isopleth(const Model& model, const double& T, const Eigen::
     //return der;
 }
 
+namespace internal {
+    /// The terms of the VLE conditions of a phase, and their derivatives, in the predictor-corrector mode of the tracers
+    struct VLEPhaseTerms {
+        Eigen::ArrayXd f; ///< The fugacities divided by RT, \f$\rho_i\exp((\partial\Psi^{\rm r}/\partial\rho_i)/RT)\f$, which remain defined where a concentration is zero, unlike the chemical potentials
+        double p = 0;
+        Eigen::MatrixXd dfdrho;
+        Eigen::ArrayXd dpdrho, dfdT;
+        double dpdT = 0;
+    };
+
+    /// The terms of a phase, and if jacobian is true their derivatives with respect to the molar concentrations, and if also Tderivs is true those with respect to temperature
+    inline void get_VLE_phase_terms(const AbstractModel& model, const double T, const Eigen::ArrayXd& rhovec, const bool jacobian, const bool Tderivs, VLEPhaseTerms& o) {
+        const double rhotot = rhovec.sum();
+        const Eigen::ArrayXd molefrac = rhovec / rhotot;
+        const double RT = model.get_R(molefrac) * T;
+        double Psir = 0;
+        Eigen::ArrayXd grad;
+        Eigen::MatrixXd H;
+        if (jacobian) {
+            model.build_Psir_fgradHessian_autodiff(T, rhovec, Psir, grad, H);
+        }
+        else {
+            grad = model.build_Psir_gradient_autodiff(T, rhovec);
+            Psir = model.get_Ar00(T, rhotot, molefrac) * rhotot * RT;
+        }
+        const Eigen::ArrayXd E = (grad / RT).exp();
+        o.f = rhovec * E;
+        o.p = rhotot * RT + (rhovec * grad).sum() - Psir;
+        if (jacobian) {
+            // df_i/drho_j = E_i (delta_ij + rho_i H_ij / RT), and dp/drho_j = RT + sum_i rho_i H_ij from the Gibbs-Duhem equation
+            o.dfdrho = (rhovec * E / RT).matrix().asDiagonal() * H;
+            o.dfdrho.diagonal() += E.matrix();
+            o.dpdrho = RT + (H * rhovec.matrix()).array();
+            if (Tderivs) {
+                o.dfdT = o.f * (model.build_d2PsirdTdrhoi_autodiff(T, rhovec) / RT - grad / (RT * T));
+                o.dpdT = model.get_dpdT_constrhovec(T, rhovec);
+            }
+        }
+    }
+
+    /// Whether a VLE trace in the predictor-corrector mode ends at the point: where the phases are identical (the critical point, or the trivial solution), and as trace_VLE_isotherm_binary does otherwise
+    inline bool VLE_pc_trace_ends(const AbstractModel& model, const VLETracePoint& pt, const bool calc_criticality, const double crit_termination, const double p_termination) {
+        const auto& rhovecL = pt.rhovecL, & rhovecV = pt.rhovecV;
+        if ((!rhovecL.isFinite()).any() || (!rhovecV.isFinite()).any()) {
+            return true;
+        }
+        const Eigen::ArrayXd x = rhovecL / rhovecL.sum(), y = rhovecV / rhovecV.sum();
+        if ((x < 0).any() || (x > 1).any() || (y < 0).any() || (y > 1).any()) {
+            return true;
+        }
+        if ((rhovecL - rhovecV).abs().maxCoeff() < 1e-8 * rhovecL.abs().maxCoeff()) {
+            return true;
+        }
+        if (pt.pL > p_termination) {
+            return true;
+        }
+        if (calc_criticality) {
+            auto condsL = model.get_criticality_conditions(pt.T, rhovecL);
+            auto condsV = model.get_criticality_conditions(pt.T, rhovecV);
+            if (condsL[0] < crit_termination || condsV[0] < crit_termination) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     \brief The predictor-corrector mode of trace_VLE_isotherm_binary
+
+     The curve of the conditions \f$f_L = f_V\f$ and \f$p_L = p_V\f$ in the variables [rhovecL, rhovecV] is followed with
+     teqp::continuation::PseudoArclength, so t is the arclength in the concentrations, as it is for the ODE, and drhodt is the
+     unit tangent. The corrected points are on the isotherm, so they are not polished.
+     */
+    inline std::string trace_VLE_isotherm_binary_pc(const AbstractModel& model, const double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const VLETraceCallback& callback, const TVLEOptions& opt) {
+        const Eigen::Index N = rhovecL0.size();
+        if (N != 2) {
+            throw InvalidArgument("The predictor-corrector mode of the isotherm tracer is only for two components");
+        }
+        TelemetryClock clock;
+        SolverTelemetry tel;
+        VLEPhaseTerms L, V;
+        auto residual = [&](const Eigen::VectorXd& x) -> Eigen::VectorXd {
+            get_VLE_phase_terms(model, T, x.head(N).array(), false, false, L);
+            get_VLE_phase_terms(model, T, x.tail(N).array(), false, false, V);
+            Eigen::VectorXd r(N + 1);
+            r.head(N) = (L.f - V.f).matrix();
+            r(N) = L.p - V.p;
+            return r;
+        };
+        // The terms of the phases at the last point where the Jacobian was evaluated, the accepted point, are used to store it
+        auto jacobian = [&](const Eigen::VectorXd& x) -> Eigen::MatrixXd {
+            get_VLE_phase_terms(model, T, x.head(N).array(), true, false, L);
+            get_VLE_phase_terms(model, T, x.tail(N).array(), true, false, V);
+            tel.num_Hessian += 2;
+            Eigen::MatrixXd J(N + 1, 2 * N);
+            J.topLeftCorner(N, N) = L.dfdrho;
+            J.topRightCorner(N, N) = -V.dfdrho;
+            J.bottomLeftCorner(1, N) = L.dpdrho.matrix().transpose();
+            J.bottomRightCorner(1, N) = -V.dpdrho.matrix().transpose();
+            return J;
+        };
+        continuation::PseudoArclength pc(residual, jacobian, opt.predictor_corrector.value());
+
+        double c = opt.init_c, t = 0, dt = opt.init_dt;
+        int Nsteps = 0;
+        Eigen::VectorXd x0(2 * N);
+        if (opt.resume) {
+            const auto& ckpt = opt.resume.value();
+            x0 = Eigen::Map<const Eigen::VectorXd>(ckpt.x.data(), ckpt.x.size());
+            t = ckpt.t; dt = ckpt.dt; c = ckpt.c;
+            Nsteps = ckpt.Nsteps;
+            pc.start(x0, Eigen::Map<const Eigen::VectorXd>(ckpt.drhodt.data(), ckpt.drhodt.size()));
+        }
+        else {
+            x0 << rhovecL0.matrix(), rhovecV0.matrix();
+            pc.start(x0);
+            // As for the ODE, the pressure increases along the trace if c is positive, and the direction is flipped if the first step would yield negative concentrations
+            if ((L.dpdrho.matrix().dot(pc.get_t().head(N)) < 0) != (c < 0)) {
+                pc.reverse();
+            }
+            if (((x0 + dt * pc.get_t()).array() < 0).any()) {
+                c *= -1;
+                pc.reverse();
+            }
+        }
+
+        VLETracePoint point;
+        auto store_point = [&]() {
+            const auto& x = pc.get_x();
+            point.t = t;
+            point.dt = dt;
+            point.T = T;
+            point.pL = L.p;
+            point.pV = V.p;
+            point.c = c;
+            point.rhovecL = x.head(N).array();
+            point.rhovecV = x.tail(N).array();
+            point.drhodt = pc.get_t().array();
+            if (opt.calc_criticality) {
+                point.critL = model.get_criticality_conditions(T, point.rhovecL);
+                point.critV = model.get_criticality_conditions(T, point.rhovecV);
+            }
+            tel.num_rhs = pc.num_jacobian;
+            tel.num_residual = pc.num_residual;
+            tel.num_rejected = pc.num_rejected;
+            tel.elapsed_s = clock.elapsed_s();
+            point.telemetry = tel;
+            point.checkpoint.tracer = "VLE isotherm";
+            point.checkpoint.t = t;
+            point.checkpoint.dt = dt;
+            point.checkpoint.c = c;
+            point.checkpoint.x.assign(x.data(), x.data() + x.size());
+            point.checkpoint.drhodt.assign(pc.get_t().data(), pc.get_t().data() + pc.get_t().size());
+            point.checkpoint.previous_drhodt = point.checkpoint.drhodt;
+            point.checkpoint.Nsteps = Nsteps;
+            return callback(point);
+        };
+        if (!opt.resume && !store_point()) {
+            return "Stopped by callback";
+        }
+        for (auto istep = 0; istep < opt.max_steps; ++istep) {
+            const double h = pc.step(dt, opt.max_dt);
+            if (h == 0) {
+                return "The step length fell below min_ds";
+            }
+            t += h;
+            tel.num_iter++;
+            Nsteps++;
+            point.T = T;
+            point.pL = L.p;
+            point.rhovecL = pc.get_x().head(N).array();
+            point.rhovecV = pc.get_x().tail(N).array();
+            if (VLE_pc_trace_ends(model, point, opt.calc_criticality, opt.crit_termination, opt.p_termination)) {
+                break;
+            }
+            if (!store_point()) {
+                return "Stopped by callback";
+            }
+        }
+        return "";
+    }
+
+    /**
+     \brief The predictor-corrector mode of trace_VLE_isobar_binary, as for trace_VLE_isotherm_binary_pc
+
+     The variables are [T, rhovecL, rhovecV], and the conditions are \f$f_L = f_V\f$, \f$p_L = p\f$ and \f$p_V = p\f$.
+     */
+    inline std::string trace_VLE_isobar_binary_pc(const AbstractModel& model, const double p, const double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const VLETraceCallback& callback, const PVLEOptions& opt) {
+        const Eigen::Index N = rhovecL0.size();
+        if (N != 2) {
+            throw InvalidArgument("The predictor-corrector mode of the isobar tracer is only for two components");
+        }
+        TelemetryClock clock;
+        SolverTelemetry tel;
+        VLEPhaseTerms L, V;
+        auto residual = [&](const Eigen::VectorXd& x) -> Eigen::VectorXd {
+            get_VLE_phase_terms(model, x(0), x.segment(1, N).array(), false, false, L);
+            get_VLE_phase_terms(model, x(0), x.tail(N).array(), false, false, V);
+            Eigen::VectorXd r(N + 2);
+            r.head(N) = (L.f - V.f).matrix();
+            r(N) = L.p - p;
+            r(N + 1) = V.p - p;
+            return r;
+        };
+        auto jacobian = [&](const Eigen::VectorXd& x) -> Eigen::MatrixXd {
+            get_VLE_phase_terms(model, x(0), x.segment(1, N).array(), true, true, L);
+            get_VLE_phase_terms(model, x(0), x.tail(N).array(), true, true, V);
+            tel.num_Hessian += 2;
+            Eigen::MatrixXd J = Eigen::MatrixXd::Zero(N + 2, 2 * N + 1);
+            J.block(0, 0, N, 1) = (L.dfdT - V.dfdT).matrix();
+            J.block(0, 1, N, N) = L.dfdrho;
+            J.block(0, 1 + N, N, N) = -V.dfdrho;
+            J(N, 0) = L.dpdT;
+            J.block(N, 1, 1, N) = L.dpdrho.matrix().transpose();
+            J(N + 1, 0) = V.dpdT;
+            J.block(N + 1, 1 + N, 1, N) = V.dpdrho.matrix().transpose();
+            return J;
+        };
+        continuation::PseudoArclength pc(residual, jacobian, opt.predictor_corrector.value());
+
+        double c = opt.init_c, t = 0, dt = opt.init_dt;
+        int Nsteps = 0;
+        Eigen::VectorXd x0(2 * N + 1);
+        if (opt.resume) {
+            const auto& ckpt = opt.resume.value();
+            x0 = Eigen::Map<const Eigen::VectorXd>(ckpt.x.data(), ckpt.x.size());
+            t = ckpt.t; dt = ckpt.dt; c = ckpt.c;
+            Nsteps = ckpt.Nsteps;
+            pc.start(x0, Eigen::Map<const Eigen::VectorXd>(ckpt.drhodt.data(), ckpt.drhodt.size()));
+        }
+        else {
+            x0 << T0, rhovecL0.matrix(), rhovecV0.matrix();
+            pc.start(x0);
+            // As for the ODE, the temperature increases along the trace if c is positive, and the direction is flipped if the first step would yield negative concentrations
+            if ((pc.get_t()(0) < 0) != (c < 0)) {
+                pc.reverse();
+            }
+            if (((x0 + dt * pc.get_t()).array() < 0).any()) {
+                c *= -1;
+                pc.reverse();
+            }
+        }
+
+        VLETracePoint point;
+        auto store_point = [&]() {
+            const auto& x = pc.get_x();
+            point.t = t;
+            point.dt = dt;
+            point.T = x(0);
+            point.pL = L.p;
+            point.pV = V.p;
+            point.c = c;
+            point.rhovecL = x.segment(1, N).array();
+            point.rhovecV = x.tail(N).array();
+            point.drhodt = pc.get_t().array();
+            if (opt.calc_criticality) {
+                point.critL = model.get_criticality_conditions(point.T, point.rhovecL);
+                point.critV = model.get_criticality_conditions(point.T, point.rhovecV);
+            }
+            tel.num_rhs = pc.num_jacobian;
+            tel.num_residual = pc.num_residual;
+            tel.num_rejected = pc.num_rejected;
+            tel.elapsed_s = clock.elapsed_s();
+            point.telemetry = tel;
+            point.checkpoint.tracer = "VLE isobar";
+            point.checkpoint.t = t;
+            point.checkpoint.dt = dt;
+            point.checkpoint.c = c;
+            point.checkpoint.x.assign(x.data(), x.data() + x.size());
+            point.checkpoint.drhodt.assign(pc.get_t().data(), pc.get_t().data() + pc.get_t().size());
+            point.checkpoint.previous_drhodt = point.checkpoint.drhodt;
+            point.checkpoint.Nsteps = Nsteps;
+            return callback(point);
+        };
+        if (!opt.resume && !store_point()) {
+            return "Stopped by callback";
+        }
+        for (auto istep = 0; istep < opt.max_steps; ++istep) {
+            const double h = pc.step(dt, opt.max_dt);
+            if (h == 0) {
+                return "The step length fell below min_ds";
+            }
+            t += h;
+            tel.num_iter++;
+            Nsteps++;
+            point.T = pc.get_x()(0);
+            point.pL = L.p;
+            point.rhovecL = pc.get_x().segment(1, N).array();
+            point.rhovecV = pc.get_x().tail(N).array();
+            if (VLE_pc_trace_ends(model, point, opt.calc_criticality, 1e-12, std::numeric_limits<double>::infinity())) {
+                break;
+            }
+            if (!store_point()) {
+                return "Stopped by callback";
+            }
+        }
+        return "";
+    }
+}
+
 /***
- * \brief Trace an isotherm with parametric tracing
- * \ note If options.revision is 2, the data will be returned in the "data" field, otherwise the data will be returned as root array
+ * \brief Trace an isotherm with parametric tracing, passing each point to the callback as it is produced rather than storing it
+ * With options.predictor_corrector set, the ODE is not integrated and the points are found by internal::trace_VLE_isotherm_binary_pc
+ * \returns The reason for the termination of the trace, or an empty string if the trace ran to its natural end
 */
-inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<TVLEOptions>& options = std::nullopt)
+inline std::string trace_VLE_isotherm_binary(const AbstractModel &model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const VLETraceCallback& callback, const std::optional<TVLEOptions>& options = std::nullopt)
 {
     // Get the options, or the default values if not provided
     TVLEOptions opt = options.value_or(TVLEOptions{});
     auto N = rhovecL0.size();
-    if (N != 2) {
-        throw InvalidArgument("Size must be 2");
+    if (N < 2) {
+        throw InvalidArgument("At least two components are required");
+    }
+    if (N > 2 && opt.xdirection.size() != N) {
+        throw InvalidArgument("The composition direction xdirection must be provided in the options for more than two components");
     }
     if (rhovecL0.size() != rhovecV0.size()) {
         throw InvalidArgument("Both molar concentration arrays must be of the same size");
     }
+    if (opt.resume && (opt.resume->tracer != "VLE isotherm" || opt.resume->x.size() != static_cast<std::size_t>(2*N))) {
+        throw InvalidArgument("The checkpoint to resume from is not one of a VLE isotherm trace of " + std::to_string(N) + " components");
+    }
+    if (opt.predictor_corrector) {
+        return internal::trace_VLE_isotherm_binary_pc(model, T, rhovecL0, rhovecV0, callback, opt);
+    }
 
     auto norm = [](const auto& v) { return (v * v).sum(); };
 
-    // Define datatypes and functions for tracing tools
-    auto JSONdata = nlohmann::json::array();
-
     // Typedefs for the types
     using namespace boost::numeric::odeint;
     using state_type = std::vector<double>;
@@ -832,6 +1607,14 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
     };
     set_init_state(x0);
 
+    // The derivatives of the phases at the last state that was evaluated; the right-hand side at an accepted point is shared
+    // between the storage of the point and the first stage of the next step
+    internal::PsirDerivativeCache cacheL(model), cacheV(model);
+
+    internal::TelemetryClock clock;
+    SolverTelemetry tel;
+    int num_polish_Hessian = 0;
+
     // The function to be integrated by odeint
     auto xprime = [&](const state_type& X, state_type& Xprime, double /*t*/) {
         // Memory maps into the state vector for inputs and their derivatives
@@ -841,7 +1624,8 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
         auto drhovecdtL = Eigen::Map<Eigen::ArrayXd>(&(Xprime[0]), N);
         auto drhovecdtV = Eigen::Map<Eigen::ArrayXd>(&(Xprime[0]) + N, N);
         // Get the derivatives with respect to pressure along the isotherm of the phase envelope
-        auto [drhovecdpL, drhovecdpV] = get_drhovecdp_Tsat(model, T, rhovecL, rhovecV);
+        auto [drhovecdpL, drhovecdpV] = (N == 2) ? get_drhovecdp_Tsat(model, T, rhovecL, rhovecV, cacheL, cacheV) : get_drhovecdp_Tsat_multicomponent(model, T, rhovecL, rhovecV, opt.xdirection, cacheL, cacheV);
+        tel.num_rhs++;
         // Get the derivative of p w.r.t. parameter
         auto dpdt = 1.0/sqrt(norm(drhovecdpL.array()) + norm(drhovecdpV.array()));
         // And finally the derivatives with respect to the tracing variable
@@ -862,9 +1646,18 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
         }
     };
     
-    // Figure out which direction to trace initially
+    // Figure out which direction to trace initially, unless the trace is resumed from a checkpoint
     double t = 0, dt = opt.init_dt;
-    {
+    int Nsteps = 0;
+    if (opt.resume) {
+        const auto& ckpt = opt.resume.value();
+        x0 = ckpt.x;
+        t = ckpt.t; dt = ckpt.dt; c = ckpt.c;
+        last_drhodt = ckpt.drhodt;
+        previous_drhodt = ckpt.previous_drhodt;
+        Nsteps = ckpt.Nsteps;
+    }
+    else {
         auto dxdt = x0;
         xprime(x0, dxdt, -1.0);
         const auto dXdt = Eigen::Map<const Eigen::ArrayXd>(&(dxdt[0]), dxdt.size());
@@ -881,6 +1674,7 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
     
     // Then trace...
     int retry_count = 0;
+    VLETracePoint point; // Re-used for all the points to avoid heap allocations
     for (auto istep = 0; istep < opt.max_steps; ++istep) {
 
         auto store_point = [&]() {
@@ -888,9 +1682,6 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
             auto N = x0.size() / 2;
             auto rhovecL = Eigen::Map<const Eigen::ArrayXd>(&(x0[0]), N);
             auto rhovecV = Eigen::Map<const Eigen::ArrayXd>(&(x0[0]) + N, N);
-            auto rhototL = rhovecL.sum(), rhototV = rhovecV.sum();
-            double pL = rhototL * model.get_R(rhovecL / rhovecL.sum())*T + model.get_pr(T, rhovecL);
-            double pV = rhototV * model.get_R(rhovecV / rhovecV.sum())*T + model.get_pr(T, rhovecV);
 
             // Store the derivative
             try {
@@ -900,29 +1691,41 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
                 std::cout << "Something bad happened; couldn't calculate xprime in store_point" << std::endl;
             }
 
-            // Store the data in a JSON structure
-            nlohmann::json point = {
-                {"t", t},
-                {"dt", dt},
-                {"T / K", T},
-                {"pL / Pa", pL},
-                {"pV / Pa", pV},
-                {"c", c},
-                {"rhoL / mol/m^3", rhovecL},
-                {"rhoV / mol/m^3", rhovecV},
-                {"xL_0 / mole frac.", rhovecL[0]/rhovecL.sum()},
-                {"xV_0 / mole frac.", rhovecV[0]/rhovecV.sum()},
-                {"drho/dt", last_drhodt}
-            };
+            // The pressures follow from the derivatives cached by xprime at this state
+            cacheL.update(T, rhovecL);
+            cacheV.update(T, rhovecV);
+            double pL = rhovecL.sum() * cacheL.RT + cacheL.get_pr();
+            double pV = rhovecV.sum() * cacheV.RT + cacheV.get_pr();
+
+            point.t = t;
+            point.dt = dt;
+            point.T = T;
+            point.pL = pL;
+            point.pV = pV;
+            point.c = c;
+            point.rhovecL = rhovecL;
+            point.rhovecV = rhovecV;
+            point.drhodt = Eigen::Map<const Eigen::ArrayXd>(&(last_drhodt[0]), last_drhodt.size());
             if (opt.calc_criticality) {
-                point["crit. conditions L"] = model.get_criticality_conditions(T, rhovecL);
-                point["crit. conditions V"] = model.get_criticality_conditions(T, rhovecV);
+                point.critL = model.get_criticality_conditions(T, rhovecL);
+                point.critV = model.get_criticality_conditions(T, rhovecV);
             }
-            JSONdata.push_back(point);
-            //std::cout << JSONdata.back().dump() << std::endl;
+            tel.num_Hessian = cacheL.num_evaluations + cacheV.num_evaluations + num_polish_Hessian;
+            tel.elapsed_s = clock.elapsed_s();
+            point.telemetry = tel;
+            point.checkpoint.tracer = "VLE isotherm";
+            point.checkpoint.t = t;
+            point.checkpoint.dt = dt;
+            point.checkpoint.c = c;
+            point.checkpoint.x = x0;
+            point.checkpoint.drhodt = last_drhodt;
+            point.checkpoint.previous_drhodt = previous_drhodt;
+            point.checkpoint.Nsteps = Nsteps;
+            return callback(point);
         };
-        if (istep == 0 && retry_count == 0) {
-            store_point();
+        if (istep == 0 && retry_count == 0 && !opt.resume && !store_point()) {
+            termination_reason = "Stopped by callback";
+            break;
         }
 
         //double dtold = dt;
@@ -941,6 +1744,7 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
                 // Try again, with a smaller step size
                 istep--;
                 retry_count++;
+                tel.num_rejected++;
                 continue;
             }
             else {
@@ -961,6 +1765,8 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
         else {
             throw InvalidArgument("integration order is invalid:" + std::to_string(opt.integration_order));
         }
+        tel.num_iter++;
+        Nsteps++;
         auto stop_requested = [&]() {
             //// Calculate some other parameters, for debugging
             auto N = x0.size() / 2;
@@ -995,8 +1801,14 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
         if (opt.polish) {
             auto rhovecL = Eigen::Map<const Eigen::ArrayXd>(&(x0[0]), N).eval();
             auto rhovecV = Eigen::Map<const Eigen::ArrayXd>(&(x0[0 + N]), N).eval();
-            auto x = (Eigen::ArrayXd(2) << rhovecL(0) / rhovecL.sum(), rhovecL(1) / rhovecL.sum()).finished(); // Mole fractions in the liquid phase (to be kept constant)
-            auto [return_code, rhovecLnew, rhovecVnew] = model.mix_VLE_Tx(T, rhovecL, rhovecV, x, 1e-10, 1e-8, 1e-10, 1e-8, 10);
+            Eigen::ArrayXd x = rhovecL / rhovecL.sum(); // Mole fractions in the liquid phase (to be kept constant)
+            SolverTelemetry polish_tel;
+            auto [return_code, rhovecLnew, rhovecVnew] = model.mix_VLE_Tx(T, rhovecL, rhovecV, x, 1e-10, 1e-8, 1e-10, 1e-8, 10, &polish_tel);
+            tel.num_polish++;
+            num_polish_Hessian += polish_tel.num_Hessian;
+            if (return_code != VLE_return_code::xtol_satisfied && return_code != VLE_return_code::functol_satisfied) {
+                tel.num_polish_failed++;
+            }
 
             // If the step is accepted, copy into x again ...
             auto rhovecLview = Eigen::Map<Eigen::ArrayXd>(&(x0[0]), N);
@@ -1007,9 +1819,58 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
         }
 
         std::swap(previous_drhodt, last_drhodt);
-        store_point(); // last_drhodt is updated;
-        
+        if (!store_point()) { // last_drhodt is updated;
+            termination_reason = "Stopped by callback";
+            break;
+        }
+    }
+    return termination_reason;
+}
+
+namespace internal {
+    /// The JSON representation of a point along a traced phase envelope
+    inline nlohmann::json VLE_trace_point_to_json(const VLETracePoint& pt, bool calc_criticality, bool telemetry = false, bool checkpoint = false) {
+        nlohmann::json point = {
+            {"t", pt.t},
+            {"dt", pt.dt},
+            {"T / K", pt.T},
+            {"pL / Pa", pt.pL},
+            {"pV / Pa", pt.pV},
+            {"c", pt.c},
+            {"rhoL / mol/m^3", pt.rhovecL},
+            {"rhoV / mol/m^3", pt.rhovecV},
+            {"xL_0 / mole frac.", pt.rhovecL[0] / pt.rhovecL.sum()},
+            {"xV_0 / mole frac.", pt.rhovecV[0] / pt.rhovecV.sum()},
+            {"drho/dt", pt.drhodt}
+        };
+        if (calc_criticality) {
+            point["crit. conditions L"] = pt.critL;
+            point["crit. conditions V"] = pt.critV;
+        }
+        if (telemetry) {
+            point["telemetry"] = SolverTelemetry_to_json(pt.telemetry);
+        }
+        if (checkpoint) {
+            point["checkpoint"] = pt.checkpoint.to_json();
+        }
+        return point;
     }
+}
+
+/***
+ * \brief Trace an isotherm with parametric tracing
+ * \ note If options.revision is 2, the data will be returned in the "data" field, otherwise the data will be returned as root array
+*/
+inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<TVLEOptions>& options = std::nullopt)
+{
+    TVLEOptions opt = options.value_or(TVLEOptions{});
+    auto JSONdata = nlohmann::json::array();
+    SolverTelemetry telemetry;
+    auto termination_reason = trace_VLE_isotherm_binary(model, T, rhovecL0, rhovecV0, [&](const VLETracePoint& pt) {
+        JSONdata.push_back(internal::VLE_trace_point_to_json(pt, opt.calc_criticality, opt.telemetry, opt.checkpoint));
+        telemetry = pt.telemetry;
+        return true;
+    }, opt);
     if (opt.revision == 1){
         return JSONdata;
     }
@@ -1017,6 +1878,9 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
         nlohmann::json meta{
             {"termination_reason", termination_reason}
         };
+        if (opt.telemetry) {
+            meta["telemetry"] = internal::SolverTelemetry_to_json(telemetry);
+        }
         return nlohmann::json{
             {"meta", meta},
             {"data", JSONdata}
@@ -1029,26 +1893,34 @@ inline auto trace_VLE_isotherm_binary(const AbstractModel &model, double T, cons
 }
 
 /***
-* \brief Trace an isobar with parametric tracing
+* \brief Trace an isobar with parametric tracing, passing each point to the callback as it is produced rather than storing it
+* With options.predictor_corrector set, the ODE is not integrated and the points are found by internal::trace_VLE_isobar_binary_pc
+* \returns The reason for the termination of the trace, or an empty string if the trace ran to its natural end
 */
 template<typename Model = AbstractModel>
-auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<PVLEOptions>& options = std::nullopt)
+std::string trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const VLETraceCallback& callback, const std::optional<PVLEOptions>& options = std::nullopt)
 {
     // Get the options, or the default values if not provided
     PVLEOptions opt = options.value_or(PVLEOptions{});
     auto N = rhovecL0.size();
-    if (N != 2) {
-        throw InvalidArgument("Size must be 2");
+    if (N < 2) {
+        throw InvalidArgument("At least two components are required");
+    }
+    if (N > 2 && opt.xdirection.size() != N) {
+        throw InvalidArgument("The composition direction xdirection must be provided in the options for more than two components");
     }
     if (rhovecL0.size() != rhovecV0.size()) {
         throw InvalidArgument("Both molar concentration arrays must be of the same size");
     }
+    if (opt.resume && (opt.resume->tracer != "VLE isobar" || opt.resume->x.size() != static_cast<std::size_t>(2*N + 1))) {
+        throw InvalidArgument("The checkpoint to resume from is not one of a VLE isobar trace of " + std::to_string(N) + " components");
+    }
+    if (opt.predictor_corrector) {
+        return internal::trace_VLE_isobar_binary_pc(model, p, T0, rhovecL0, rhovecV0, callback, opt);
+    }
 
     auto norm = [](const auto& v) { return (v * v).sum(); };
 
-    // Define datatypes and functions for tracing tools
-    auto JSONdata = nlohmann::json::array();
-
     // Typedefs for the types
     using namespace boost::numeric::odeint;
     using state_type = std::vector<double>;
@@ -1076,6 +1948,9 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
     };
     set_init_state(x0);
 
+    internal::TelemetryClock clock;
+    SolverTelemetry tel;
+
     // The function to be integrated by odeint
     auto xprime = [&](const state_type& X, state_type& Xprime, double /*t*/) {
         // Memory maps into the state vector for inputs and their derivatives
@@ -1087,7 +1962,9 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
         auto drhovecdtL = Eigen::Map<Eigen::ArrayXd>(&(Xprime[1]), N);
         auto drhovecdtV = Eigen::Map<Eigen::ArrayXd>(&(Xprime[1]) + N, N);
         // Get the derivatives with respect to temperature along the isobar of the phase envelope
-        auto [drhovecdTL, drhovecdTV] = get_drhovecdT_psat(model, T, rhovecL, rhovecV);
+        auto [drhovecdTL, drhovecdTV] = (N == 2) ? get_drhovecdT_psat(model, T, rhovecL, rhovecV) : get_drhovecdT_psat_multicomponent(model, T, rhovecL, rhovecV, opt.xdirection);
+        tel.num_rhs++;
+        tel.num_Hessian += 2; // One Hessian of each phase
         // Get the derivative of T w.r.t. parameter
         dTdt = 1.0 / sqrt(norm(drhovecdTL.array()) + norm(drhovecdTV.array()));
         // And finally the derivatives with respect to the tracing variable
@@ -1103,14 +1980,23 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
             return Eigen::Map<const Eigen::ArrayXd>(&(v[0]), N);
         };
         if (get_const_view(Xprime, N).matrix().dot(get_const_view(previous_drhodt, N).matrix()) < 0) {
-            auto Xprimeview = Eigen::Map<Eigen::ArrayXd>(&(Xprime[0]), 2 * N);
+            auto Xprimeview = Eigen::Map<Eigen::ArrayXd>(&(Xprime[0]), Xprime.size()); // Including the temperature
             Xprimeview *= -1;
         }
     };
 
-    // Figure out which direction to trace initially
+    // Figure out which direction to trace initially, unless the trace is resumed from a checkpoint
     double t = 0, dt = opt.init_dt;
-    {
+    int Nsteps = 0;
+    if (opt.resume) {
+        const auto& ckpt = opt.resume.value();
+        x0 = ckpt.x;
+        t = ckpt.t; dt = ckpt.dt; c = ckpt.c;
+        last_drhodt = ckpt.drhodt;
+        previous_drhodt = ckpt.previous_drhodt;
+        Nsteps = ckpt.Nsteps;
+    }
+    else {
         auto dxdt = x0;
         xprime(x0, dxdt, -1.0);
         const auto dXdt = Eigen::Map<const Eigen::ArrayXd>(&(dxdt[0]), dxdt.size());
@@ -1127,6 +2013,7 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
 
     // Then trace...
     int retry_count = 0;
+    VLETracePoint point; // Re-used for all the points to avoid heap allocations
     for (auto istep = 0; istep < opt.max_steps; ++istep) {
 
         auto store_point = [&]() {
@@ -1147,29 +2034,34 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
                 std::cout << "Something bad happened; couldn't calculate xprime in store_point" << std::endl;
             }
 
-            // Store the data in a JSON structure
-            nlohmann::json point = {
-                {"t", t},
-                {"dt", dt},
-                {"T / K", T},
-                {"pL / Pa", pL},
-                {"pV / Pa", pV},
-                {"c", c},
-                {"rhoL / mol/m^3", rhovecL},
-                {"rhoV / mol/m^3", rhovecV},
-                {"xL_0 / mole frac.", rhovecL[0] / rhovecL.sum()},
-                {"xV_0 / mole frac.", rhovecV[0] / rhovecV.sum()},
-                {"drho/dt", last_drhodt}
-            };
+            point.t = t;
+            point.dt = dt;
+            point.T = T;
+            point.pL = pL;
+            point.pV = pV;
+            point.c = c;
+            point.rhovecL = rhovecL;
+            point.rhovecV = rhovecV;
+            point.drhodt = Eigen::Map<const Eigen::ArrayXd>(&(last_drhodt[0]), last_drhodt.size());
             if (opt.calc_criticality) {
-                point["crit. conditions L"] = model.get_criticality_conditions(T, rhovecL);
-                point["crit. conditions V"] = model.get_criticality_conditions(T, rhovecV);
+                point.critL = model.get_criticality_conditions(T, rhovecL);
+                point.critV = model.get_criticality_conditions(T, rhovecV);
             }
-            JSONdata.push_back(point);
-            //std::cout << JSONdata.back().dump() << std::endl;
+            tel.elapsed_s = clock.elapsed_s();
+            point.telemetry = tel;
+            point.checkpoint.tracer = "VLE isobar";
+            point.checkpoint.t = t;
+            point.checkpoint.dt = dt;
+            point.checkpoint.c = c;
+            point.checkpoint.x = x0;
+            point.checkpoint.drhodt = last_drhodt;
+            point.checkpoint.previous_drhodt = previous_drhodt;
+            point.checkpoint.Nsteps = Nsteps;
+            return callback(point);
         };
-        if (istep == 0 && retry_count == 0) {
-            store_point();
+        if (istep == 0 && retry_count == 0 && !opt.resume && !store_point()) {
+            termination_reason = "Stopped by callback";
+            break;
         }
 
         //double dtold = dt;
@@ -1188,6 +2080,7 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
                 // Try again, with a smaller step size
                 istep--;
                 retry_count++;
+                tel.num_rejected++;
                 continue;
             }
             else {
@@ -1208,6 +2101,8 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
         else {
             throw InvalidArgument("integration order is invalid:" + std::to_string(opt.integration_order));
         }
+        tel.num_iter++;
+        Nsteps++;
         auto stop_requested = [&]() {
             //// Calculate some other parameters, for debugging
             auto N = (x0.size()-1) / 2;
@@ -1239,8 +2134,14 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
             double T = x0[0];
             auto rhovecL = Eigen::Map<const Eigen::ArrayXd>(&(x0[1]), N).eval();
             auto rhovecV = Eigen::Map<const Eigen::ArrayXd>(&(x0[1 + N]), N).eval();
-            auto x = (Eigen::ArrayXd(2) << rhovecL(0) / rhovecL.sum(), rhovecL(1) / rhovecL.sum()).finished(); // Mole fractions in the liquid phase (to be kept constant)
-            auto [return_code, Tnew, rhovecLnew, rhovecVnew] = model.mixture_VLE_px(p, x, T, rhovecL, rhovecV);
+            Eigen::ArrayXd x = rhovecL / rhovecL.sum(); // Mole fractions in the liquid phase (to be kept constant)
+            SolverTelemetry polish_tel;
+            auto [return_code, Tnew, rhovecLnew, rhovecVnew] = model.mixture_VLE_px(p, x, T, rhovecL, rhovecV, std::nullopt, &polish_tel);
+            tel.num_polish++;
+            tel.num_Hessian += polish_tel.num_Hessian;
+            if (return_code != VLE_return_code::xtol_satisfied && return_code != VLE_return_code::functol_satisfied) {
+                tel.num_polish_failed++;
+            }
 
             // If the step is accepted, copy into x again ...
             x0[0] = Tnew;
@@ -1252,19 +2153,605 @@ auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eige
         }
 
         std::swap(previous_drhodt, last_drhodt);
-        store_point(); // last_drhodt is updated;
-
+        if (!store_point()) { // last_drhodt is updated;
+            termination_reason = "Stopped by callback";
+            break;
+        }
     }
+    return termination_reason;
+}
+
+/***
+* \brief Trace an isobar with parametric tracing
+*/
+template<typename Model = AbstractModel>
+auto trace_VLE_isobar_binary(const Model& model, double p, double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const std::optional<PVLEOptions>& options = std::nullopt)
+{
+    PVLEOptions opt = options.value_or(PVLEOptions{});
+    auto JSONdata = nlohmann::json::array();
+    trace_VLE_isobar_binary(model, p, T0, rhovecL0, rhovecV0, [&](const VLETracePoint& pt) {
+        JSONdata.push_back(internal::VLE_trace_point_to_json(pt, opt.calc_criticality, opt.telemetry, opt.checkpoint));
+        return true;
+    }, opt);
     return JSONdata;
 }
 
+namespace internal {
+    /// The state vector of a point along a trace, ordered as in the tracers (with the temperature first for isobars)
+    inline Eigen::ArrayXd get_VLE_trace_state(const VLETracePoint& pt) {
+        const auto N = pt.rhovecL.size();
+        const auto offset = pt.drhodt.size() - 2 * N;
+        Eigen::ArrayXd X(pt.drhodt.size());
+        if (offset == 1) {
+            X(0) = pt.T;
+        }
+        X.segment(offset, N) = pt.rhovecL;
+        X.segment(offset + N, N) = pt.rhovecV;
+        return X;
+    }
+
+    /// Cubic Hermite interpolation of the state vector between two consecutive points a and b of a trace, from their states and
+    /// their derivatives with respect to the tracing variable; s is the fraction of the way from a to b
+    inline void interpolate_VLE_trace_point(const VLETracePoint& a, const VLETracePoint& b, const double s, VLETracePoint& out) {
+        const auto N = a.rhovecL.size();
+        const auto offset = a.drhodt.size() - 2 * N;
+        const double h = b.t - a.t, s2 = s * s, s3 = s2 * s;
+        Eigen::ArrayXd Xa = get_VLE_trace_state(a), Xb = get_VLE_trace_state(b);
+        Eigen::ArrayXd X = (2 * s3 - 3 * s2 + 1) * Xa + (s3 - 2 * s2 + s) * h * a.drhodt + (3 * s2 - 2 * s3) * Xb + (s3 - s2) * h * b.drhodt;
+        out = a;
+        out.t = a.t + s * h;
+        out.dt = h;
+        if (offset == 1) {
+            out.T = X(0);
+        }
+        out.rhovecL = X.segment(offset, N);
+        out.rhovecV = X.segment(offset + N, N);
+        out.drhodt = ((6 * s2 - 6 * s) * (Xa - Xb) / h + (3 * s2 - 4 * s + 1) * a.drhodt + (3 * s2 - 2 * s) * b.drhodt).eval();
+    }
+
+    /// For each of the values that the variable crosses between two consecutive points a and b of a trace, find the interpolated
+    /// point at which the variable takes that value with the Illinois variant of regula falsi, and pass it to emit
+    template<typename Variable, typename Emit>
+    void interpolate_VLE_trace_interval(const VLETracePoint& a, const VLETracePoint& b, const double va, const double vb, const Eigen::ArrayXd& values, const Variable& variable, const Emit& emit) {
+        if (!(std::abs(b.t - a.t) > 0)) {
+            return;
+        }
+        VLETracePoint pt;
+        for (auto value : values) {
+            if (!((va < value && value <= vb) || (vb <= value && value < va))) {
+                continue;
+            }
+            double sa = 0, sb = 1, fa = va - value, fb = vb - value;
+            int side = 0;
+            for (auto iter = 0; iter < 100; ++iter) {
+                double s = (sa * fb - sb * fa) / (fb - fa);
+                interpolate_VLE_trace_point(a, b, s, pt);
+                double f = variable(pt) - value;
+                if (std::abs(f) <= 1e-12 * std::abs(value) || sb - sa < 1e-14) {
+                    break;
+                }
+                if (f * fb > 0) {
+                    sb = s; fb = f;
+                    if (side == -1) { fa /= 2; }
+                    side = -1;
+                }
+                else {
+                    sa = s; fa = f;
+                    if (side == 1) { fb /= 2; }
+                    side = 1;
+                }
+            }
+            emit(value, pt);
+        }
+    }
+
+    /// Fill in the pressures of the phases of a point along a trace, and their criticality conditions if requested
+    inline void fill_VLE_trace_point_properties(const AbstractModel& model, VLETracePoint& pt, bool calc_criticality) {
+        pt.pL = pt.rhovecL.sum() * model.get_R((pt.rhovecL / pt.rhovecL.sum()).eval()) * pt.T + model.get_pr(pt.T, pt.rhovecL);
+        pt.pV = pt.rhovecV.sum() * model.get_R((pt.rhovecV / pt.rhovecV.sum()).eval()) * pt.T + model.get_pr(pt.T, pt.rhovecV);
+        if (calc_criticality) {
+            pt.critL = model.get_criticality_conditions(pt.T, pt.rhovecL);
+            pt.critV = model.get_criticality_conditions(pt.T, pt.rhovecV);
+        }
+    }
+
+    /// Run a streaming trace and interpolate each interval between consecutive points at the requested values
+    template<typename Trace, typename Variable, typename Emit>
+    void trace_VLE_dense(const Trace& trace, const Eigen::ArrayXd& values, const Variable& variable, const Emit& emit) {
+        VLETracePoint previous;
+        double vprevious = 0;
+        bool first = true;
+        trace([&](const VLETracePoint& pt) {
+            double v = variable(pt);
+            if (first) {
+                for (auto value : values) {
+                    if (value == v) {
+                        emit(value, pt);
+                    }
+                }
+                first = false;
+            }
+            else {
+                interpolate_VLE_trace_interval(previous, pt, vprevious, v, values, variable, emit);
+            }
+            previous = pt;
+            vprevious = v;
+            return true;
+        });
+    }
+}
+
+/***
+ * \brief Trace an isotherm and return its points at requested values of the pressure or of the liquid mole fraction of the first component
+ *
+ * The points are interpolated between the points of the trace with cubic Hermite polynomials in the tracing variable, built
+ * from the states and their derivatives at the points of the trace, so each requested value costs an interpolation rather
+ * than a phase equilibrium calculation. If dense_options.polish is set, each interpolated point is then polished with
+ * mix_VLE_Tp (at the requested pressure; binary mixtures only) or mix_VLE_Tx (at the interpolated liquid composition).
+ *
+ * \param values The requested values of the variable given in dense_options.variable, either "p" or "xL_0"
+ * \returns The interpolated points, in the order in which the trace crosses them; a value that is crossed several times gives several points
+ */
+inline std::vector<VLETracePoint> trace_VLE_isotherm_binary_dense(const AbstractModel& model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const Eigen::ArrayXd& values, const std::optional<VLEDenseOptions>& dense_options = std::nullopt, const std::optional<TVLEOptions>& options = std::nullopt)
+{
+    auto dopt = dense_options.value_or(VLEDenseOptions{});
+    TVLEOptions opt = options.value_or(TVLEOptions{});
+    std::function<double(const VLETracePoint&)> variable;
+    if (dopt.variable == "p") {
+        if (dopt.polish && rhovecL0.size() != 2) {
+            throw InvalidArgument("Polishing at the requested pressure is only available for binary mixtures");
+        }
+        variable = [&](const VLETracePoint& pt) { return pt.rhovecL.sum() * model.get_R((pt.rhovecL / pt.rhovecL.sum()).eval()) * T + model.get_pr(T, pt.rhovecL); };
+    }
+    else if (dopt.variable == "xL_0") {
+        variable = [](const VLETracePoint& pt) { return pt.rhovecL[0] / pt.rhovecL.sum(); };
+    }
+    else {
+        throw InvalidArgument("The variable for the dense output of an isotherm must be p or xL_0; it is: " + dopt.variable);
+    }
+
+    std::vector<VLETracePoint> points;
+    auto emit = [&](double value, VLETracePoint pt) {
+        if (dopt.polish) {
+            if (dopt.variable == "p") {
+                auto r = mix_VLE_Tp(model, T, value, pt.rhovecL, pt.rhovecV);
+                if (r.r.cwiseAbs().maxCoeff() < 1e-8 && (r.rhovecL > 0).all() && (r.rhovecV > 0).all()) {
+                    pt.rhovecL = r.rhovecL;
+                    pt.rhovecV = r.rhovecV;
+                }
+            }
+            else {
+                Eigen::ArrayXd x = pt.rhovecL / pt.rhovecL.sum();
+                auto [return_code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, pt.rhovecL, pt.rhovecV, x, 1e-10, 1e-8, 1e-10, 1e-8, 10);
+                if ((return_code == VLE_return_code::xtol_satisfied || return_code == VLE_return_code::functol_satisfied) && rhovecL.isFinite().all() && rhovecV.isFinite().all()) {
+                    pt.rhovecL = rhovecL;
+                    pt.rhovecV = rhovecV;
+                }
+            }
+        }
+        internal::fill_VLE_trace_point_properties(model, pt, opt.calc_criticality);
+        points.push_back(pt);
+    };
+    internal::trace_VLE_dense([&](const VLETraceCallback& callback) {
+        trace_VLE_isotherm_binary(model, T, rhovecL0, rhovecV0, callback, opt);
+    }, values, variable, emit);
+    return points;
+}
+
+/***
+ * \brief Trace an isobar and return its points at requested values of the temperature or of the liquid mole fraction of the first component
+ *
+ * As for trace_VLE_isotherm_binary_dense; the polishing is done with mix_VLE_Tp (at the requested temperature; binary mixtures
+ * only) or mixture_VLE_px (at the interpolated liquid composition).
+ *
+ * \param values The requested values of the variable given in dense_options.variable, either "T" or "xL_0"
+ */
+inline std::vector<VLETracePoint> trace_VLE_isobar_binary_dense(const AbstractModel& model, double p, double T0, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const Eigen::ArrayXd& values, const std::optional<VLEDenseOptions>& dense_options = std::nullopt, const std::optional<PVLEOptions>& options = std::nullopt)
+{
+    auto dopt = dense_options.value_or(VLEDenseOptions{});
+    PVLEOptions opt = options.value_or(PVLEOptions{});
+    std::function<double(const VLETracePoint&)> variable;
+    if (dopt.variable == "T") {
+        if (dopt.polish && rhovecL0.size() != 2) {
+            throw InvalidArgument("Polishing at the requested temperature is only available for binary mixtures");
+        }
+        variable = [](const VLETracePoint& pt) { return pt.T; };
+    }
+    else if (dopt.variable == "xL_0") {
+        variable = [](const VLETracePoint& pt) { return pt.rhovecL[0] / pt.rhovecL.sum(); };
+    }
+    else {
+        throw InvalidArgument("The variable for the dense output of an isobar must be T or xL_0; it is: " + dopt.variable);
+    }
+
+    std::vector<VLETracePoint> points;
+    auto emit = [&](double value, VLETracePoint pt) {
+        if (dopt.polish) {
+            if (dopt.variable == "T") {
+                auto r = mix_VLE_Tp(model, value, p, pt.rhovecL, pt.rhovecV);
+                if (r.r.cwiseAbs().maxCoeff() < 1e-8 && (r.rhovecL > 0).all() && (r.rhovecV > 0).all()) {
+                    pt.T = value;
+                    pt.rhovecL = r.rhovecL;
+                    pt.rhovecV = r.rhovecV;
+                }
+            }
+            else {
+                Eigen::ArrayXd x = pt.rhovecL / pt.rhovecL.sum();
+                auto [return_code, T, rhovecL, rhovecV] = mixture_VLE_px(model, p, x, pt.T, pt.rhovecL, pt.rhovecV);
+                if ((return_code == VLE_return_code::xtol_satisfied || return_code == VLE_return_code::functol_satisfied) && std::isfinite(T) && rhovecL.isFinite().all() && rhovecV.isFinite().all()) {
+                    pt.T = T;
+                    pt.rhovecL = rhovecL;
+                    pt.rhovecV = rhovecV;
+                }
+            }
+        }
+        internal::fill_VLE_trace_point_properties(model, pt, opt.calc_criticality);
+        points.push_back(pt);
+    };
+    internal::trace_VLE_dense([&](const VLETraceCallback& callback) {
+        trace_VLE_isobar_binary(model, p, T0, rhovecL0, rhovecV0, callback, opt);
+    }, values, variable, emit);
+    return points;
+}
+
+namespace internal {
+    /**
+     * The residual and its Jacobian for a point on the phase envelope of a mixture with the overall composition z, in the variables
+     * X = [ln T, ln p, ln rhovecB, ln rhovecI] of the bulk phase B (of composition z) and the incipient phase I. The 2N+1 equations
+     * are the equalities of the chemical potentials of the phases (divided by RT), the pressures of both phases equal to p, and the
+     * N-1 ratios of the concentrations of the bulk phase fixed by z. The gas constant of the bulk phase is used for both phases, as in mixture_VLE_px
+     */
+    inline void phase_envelope_rJ(const AbstractModel& model, const Eigen::ArrayXd& z, const Eigen::VectorXd& X, Eigen::VectorXd& r, Eigen::MatrixXd& J, SolverTelemetry& tel) {
+        const auto N = z.size();
+        const double T = exp(X(0)), p = exp(X(1));
+        const Eigen::ArrayXd lnrhovecB = X.segment(2, N).array(), lnrhovecI = X.tail(N).array();
+        const Eigen::ArrayXd rhovecB = lnrhovecB.exp(), rhovecI = lnrhovecI.exp();
+        const double RT = model.get_R(z) * T;
+
+        auto [PsirB, PsirgradB, hessianB] = model.build_Psir_fgradHessian_autodiff(T, rhovecB);
+        auto [PsirI, PsirgradI, hessianI] = model.build_Psir_fgradHessian_autodiff(T, rhovecI);
+        tel.num_Hessian += 2;
+        // T*d(mu^r_i)/dT at constant concentrations
+        Eigen::ArrayXd TdmudTB = T * model.build_d2PsirdTdrhoi_autodiff(T, rhovecB), TdmudTI = T * model.build_d2PsirdTdrhoi_autodiff(T, rhovecI);
+        double pB = rhovecB.sum() * RT - PsirB + (rhovecB * PsirgradB).sum();
+        double pI = rhovecI.sum() * RT - PsirI + (rhovecI * PsirgradI).sum();
+        Eigen::ArrayXd dpdrhovecB = RT + (hessianB * rhovecB.matrix()).array();
+        Eigen::ArrayXd dpdrhovecI = RT + (hessianI * rhovecI.matrix()).array();
+
+        J.setZero();
+        // Chemical potentials, with the derivatives with respect to ln(rho_j) being rho_j times those with respect to rho_j
+        r.head(N) = ((PsirgradB - PsirgradI) / RT + lnrhovecB - lnrhovecI).matrix();
+        J.block(0, 0, N, 1) = ((TdmudTB - TdmudTI - (PsirgradB - PsirgradI)) / RT).matrix();
+        J.block(0, 2, N, N) = hessianB * rhovecB.matrix().asDiagonal() / RT + Eigen::MatrixXd::Identity(N, N);
+        J.block(0, 2 + N, N, N) = -hessianI * rhovecI.matrix().asDiagonal() / RT - Eigen::MatrixXd::Identity(N, N);
+        // Pressures
+        r(N) = pB / p - 1;
+        r(N + 1) = pI / p - 1;
+        J(N, 0) = T * model.get_dpdT_constrhovec(T, rhovecB) / p;
+        J(N + 1, 0) = T * model.get_dpdT_constrhovec(T, rhovecI) / p;
+        J(N, 1) = -pB / p;
+        J(N + 1, 1) = -pI / p;
+        J.block(N, 2, 1, N) = (dpdrhovecB * rhovecB / p).matrix().transpose();
+        J.block(N + 1, 2 + N, 1, N) = (dpdrhovecI * rhovecI / p).matrix().transpose();
+        // Composition of the bulk phase, linear in the logarithms of the concentrations
+        for (auto i = 0; i < N - 1; ++i) {
+            r(N + 2 + i) = lnrhovecB(i) - lnrhovecB(N - 1) - log(z(i) / z(N - 1));
+            J(N + 2 + i, 2 + i) = 1;
+            J(N + 2 + i, 2 + N - 1) = -1;
+        }
+    }
+
+    /// Cubic Hermite interpolation of the state vector between two consecutive points of a phase envelope, from their states and unit
+    /// tangents and the length h of the chord between them; tau is the fraction of the way from a to b. If derivative is true, the
+    /// derivative with respect to tau is returned instead
+    inline Eigen::VectorXd interpolate_phase_envelope(const Eigen::VectorXd& Xa, const Eigen::VectorXd& ta, const Eigen::VectorXd& Xb, const Eigen::VectorXd& tb, const double h, const double tau, bool derivative = false) {
+        const double t2 = tau * tau, t3 = t2 * tau;
+        if (derivative) {
+            return (6 * t2 - 6 * tau) * (Xa - Xb) + (3 * t2 - 4 * tau + 1) * h * ta + (3 * t2 - 2 * tau) * h * tb;
+        }
+        return (2 * t3 - 3 * t2 + 1) * Xa + (t3 - 2 * t2 + tau) * h * ta + (3 * t2 - 2 * t3) * Xb + (t3 - t2) * h * tb;
+    }
+
+    /// The root in [0, 1] of a function with a change of sign between f(0) and f(1), with the Illinois variant of regula falsi
+    template<typename Function>
+    double find_phase_envelope_root(const Function& f, double fa, double fb) {
+        double sa = 0, sb = 1, s = 0;
+        int side = 0;
+        for (auto iter = 0; iter < 100; ++iter) {
+            s = (sa * fb - sb * fa) / (fb - fa);
+            double fs = f(s);
+            if (fs == 0 || sb - sa < 1e-14) {
+                break;
+            }
+            if (fs * fb > 0) {
+                sb = s; fb = fs;
+                if (side == -1) { fa /= 2; }
+                side = -1;
+            }
+            else {
+                sa = s; fa = fs;
+                if (side == 1) { fb /= 2; }
+                side = 1;
+            }
+        }
+        return s;
+    }
+
+    /// The JSON representation of a point along a phase envelope
+    inline nlohmann::json phase_envelope_point_to_json(const PhaseEnvelopePoint& pt, bool telemetry = false) {
+        const char* events[] = {"", "cricondenbar", "cricondentherm", "critical"};
+        nlohmann::json point = {
+            {"s", pt.s},
+            {"ds", pt.ds},
+            {"T / K", pt.T},
+            {"p / Pa", pt.p},
+            {"rhoB / mol/m^3", pt.rhovecB},
+            {"rhoI / mol/m^3", pt.rhovecI},
+            {"xI_0 / mole frac.", pt.rhovecI[0] / pt.rhovecI.sum()},
+            {"dX/ds", pt.dXds},
+            {"event", events[static_cast<int>(pt.event)]}
+        };
+        if (telemetry) {
+            point["telemetry"] = SolverTelemetry_to_json(pt.telemetry);
+        }
+        return point;
+    }
+}
+
+/***
+ * \brief Trace the phase envelope (the bubble and dew curves) of a mixture of any number of components at fixed overall composition
+ *
+ * The envelope is followed by continuation in the variables X = [ln T, ln p, ln rhovecB, ln rhovecI] of the bulk phase B, which
+ * has the overall composition, and the incipient phase I. The predictor steps along the tangent to the curve, the null vector of the
+ * Jacobian of the equilibrium conditions, which at fixed composition of the bulk phase generalizes the sensitivities of
+ * get_drhovecdT_xsat and get_dpsat_dTsat_isopleth to any number of components and remains defined where dT or dp vanish. The
+ * corrector is Newton's method with one of the variables fixed, the one that changes the most along the tangent (Michelsen,
+ * https://doi.org/10.1016/0378-3812(80)80001-X), and the step length is adapted to the number of Newton iterations.
+ *
+ * The trace starts from the point given by T0 and guesses of the concentrations of the phases, which is corrected at constant
+ * temperature, and proceeds towards increasing pressure. Starting from a bubble point at low pressure, it then follows the bubble
+ * curve through the critical point and the dew curve back to low pressure. Where the phases become nearly identical, the step
+ * fixes the logarithm of the ratio of the concentrations of the phases at the mirror of its value, so the trace jumps over the
+ * critical point rather than converging to the trivial solution with identical phases; the bulk phase then changes from liquid to
+ * vapor. The critical point, and the local maxima of the pressure (cricondenbar) and of the temperature (cricondentherm), are
+ * found by interpolation between the points of the trace and passed to the callback with their event set; the extrema are polished
+ * onto the envelope at the interpolated value of the other variable.
+ *
+ * \param rhovecB0 The molar concentrations of the bulk phase, which also set the overall composition; all must be positive
+ * \param rhovecI0 The guess of the molar concentrations of the incipient phase
+ * \returns The reason for the termination of the trace
+ */
+inline std::string trace_phase_envelope(const AbstractModel& model, const double T0, const Eigen::ArrayXd& rhovecB0, const Eigen::ArrayXd& rhovecI0, const PhaseEnvelopeCallback& callback, const std::optional<PhaseEnvelopeOptions>& options = std::nullopt)
+{
+    auto opt = options.value_or(PhaseEnvelopeOptions{});
+    internal::TelemetryClock clock;
+    const auto N = rhovecB0.size();
+    if (N < 2) {
+        throw InvalidArgument("At least two components are required");
+    }
+    if (rhovecI0.size() != N) {
+        throw InvalidArgument("Both molar concentration arrays must be of the same size");
+    }
+    if (!(rhovecB0 > 0).all() || !(rhovecI0 > 0).all()) {
+        throw InvalidArgument("All the molar concentrations must be positive in trace_phase_envelope");
+    }
+    const Eigen::ArrayXd z = rhovecB0 / rhovecB0.sum();
+    const auto M = 2 * N + 2;
+
+    SolverTelemetry tel;
+    Eigen::VectorXd r(M - 1), dX(M), b(M);
+    Eigen::MatrixXd J(M - 1, M), A(M, M);
+
+    // Newton's method for the equilibrium conditions together with c.X = target; J is left at the last iterate, for the tangent
+    auto correct = [&](Eigen::VectorXd& X, const Eigen::VectorXd& c, const double target, int& num_newton, int max_newton) {
+        for (num_newton = 1; num_newton <= max_newton; ++num_newton) {
+            internal::phase_envelope_rJ(model, z, X, r, J, tel);
+            A.topRows(M - 1) = J;
+            A.row(M - 1) = c.transpose();
+            b.head(M - 1) = -r;
+            b(M - 1) = target - c.dot(X);
+            dX = A.partialPivLu().solve(b);
+            if (!dX.allFinite()) {
+                return false;
+            }
+            // Limit the change of any variable to a factor of e, which only acts far from the solution
+            X += dX / std::max(1.0, dX.cwiseAbs().maxCoeff());
+            if (dX.cwiseAbs().maxCoeff() < opt.newton_tol) {
+                return true;
+            }
+        }
+        return false;
+    };
+    // The unit tangent from the Jacobian of the last correction, with c.t > 0
+    auto tangent = [&](const Eigen::VectorXd& c) {
+        A.topRows(M - 1) = J;
+        A.row(M - 1) = c.transpose();
+        b.setZero();
+        b(M - 1) = 1;
+        Eigen::VectorXd t = A.partialPivLu().solve(b);
+        return (t / t.norm()).eval();
+    };
+    auto lnK = [&](const Eigen::VectorXd& X) { return (X.tail(N) - X.segment(2, N)).eval(); };
+
+    // Correct the starting point at constant temperature, with more iterations allowed from the guess, and with the pressure of the less dense phase as the guess, which is less
+    // sensitive to the error of the guess of its concentrations than that of the liquid
+    Eigen::VectorXd X(M);
+    X(0) = log(T0);
+    const Eigen::ArrayXd& rhovecLighter = (rhovecB0.sum() < rhovecI0.sum()) ? rhovecB0 : rhovecI0;
+    X(1) = log(rhovecLighter.sum() * model.get_R(z) * T0 + model.get_pr(T0, rhovecLighter));
+    X.segment(2, N) = rhovecB0.log().matrix();
+    X.tail(N) = rhovecI0.log().matrix();
+    Eigen::VectorXd c = Eigen::VectorXd::Unit(M, 0);
+    int num_newton = 0;
+    if (!std::isfinite(X(1)) || !correct(X, c, X(0), num_newton, 5 * opt.max_newton) || lnK(X).cwiseAbs().maxCoeff() < opt.newton_tol) {
+        throw IterationFailure("The starting point of trace_phase_envelope could not be converged");
+    }
+    Eigen::VectorXd t = tangent(Eigen::VectorXd::Unit(M, 1));
+    const double p_min = (opt.p_min > 0) ? opt.p_min : exp(X(1)) * (1 - 1e-6);
+
+    PhaseEnvelopePoint pt;
+    auto emit = [&](const Eigen::VectorXd& Xpt, const Eigen::VectorXd& tpt, double s, double ds, PhaseEnvelopeEvent event) {
+        pt.s = s;
+        pt.ds = ds;
+        pt.T = exp(Xpt(0));
+        pt.p = exp(Xpt(1));
+        pt.rhovecB = Xpt.segment(2, N).array().exp();
+        pt.rhovecI = Xpt.tail(N).array().exp();
+        pt.dXds = tpt.array();
+        pt.event = event;
+        tel.elapsed_s = clock.elapsed_s();
+        pt.telemetry = tel;
+        return callback(pt);
+    };
+    if (!emit(X, t, 0, 0, PhaseEnvelopeEvent::none)) {
+        return "Stopped by callback";
+    }
+
+    double s = 0, ds = opt.init_ds;
+    Eigen::VectorXd Xnew(M), tnew(M);
+    for (auto step = 0; step < opt.max_steps; ++step) {
+        // Choose the specified variable and its value at the end of the step
+        Eigen::VectorXd::Index k, m;
+        t.cwiseAbs().maxCoeff(&k);
+        Eigen::VectorXd lnKs = lnK(X), dlnKds = lnK(t);
+        lnKs.cwiseAbs().maxCoeff(&m);
+        double target;
+        bool jump = std::abs(lnKs(m)) < opt.crit_lnK && lnKs(m) * dlnKds(m) < 0;
+        if (jump) {
+            // Jump over the critical point, to the mirror of the current value of the largest ln(K)
+            c = Eigen::VectorXd::Unit(M, 2 + N + m) - Eigen::VectorXd::Unit(M, 2 + m);
+            target = -lnKs(m);
+            Xnew = X + (target - lnKs(m)) / dlnKds(m) * t;
+        }
+        else {
+            c = Eigen::VectorXd::Unit(M, k);
+            Xnew = X + ds * t;
+            target = Xnew(k);
+        }
+        bool ok = correct(Xnew, c, target, num_newton, opt.max_newton);
+        tel.num_iter++;
+        // Reject the steps that did not converge, that reached the trivial solution, or that turned back along the curve
+        if (ok) {
+            tnew = tangent(c);
+            if (tnew.dot(t) < 0) {
+                tnew *= -1;
+            }
+            ok = lnK(Xnew).cwiseAbs().maxCoeff() > 1e-8 && (Xnew - X).dot(t) > 0;
+        }
+        if (!ok) {
+            tel.num_rejected++;
+            if (jump) {
+                // Approach the critical point with shorter natural steps instead
+                opt.crit_lnK /= 2;
+            }
+            else {
+                ds /= 2;
+            }
+            if (ds < opt.min_ds) {
+                return "The step length fell below min_ds";
+            }
+            continue;
+        }
+
+        // The special points crossed by the step, in order
+        const double h = (Xnew - X).norm();
+        std::vector<std::tuple<double, PhaseEnvelopeEvent>> events;
+        auto interp = [&](double tau, bool derivative) { return internal::interpolate_phase_envelope(X, t, Xnew, tnew, h, tau, derivative); };
+        for (auto [i, event] : {std::make_tuple(0, PhaseEnvelopeEvent::cricondentherm), std::make_tuple(1, PhaseEnvelopeEvent::cricondenbar)}) {
+            if (t(i) > 0 && tnew(i) <= 0) {
+                double tau = internal::find_phase_envelope_root([&](double tau_) { return interp(tau_, true)(i); }, h * t(i), h * tnew(i));
+                events.emplace_back(tau, event);
+            }
+        }
+        Eigen::VectorXd lnKnew = lnK(Xnew);
+        if (lnKs(m) * lnKnew(m) < 0) {
+            double tau = internal::find_phase_envelope_root([&](double tau_) { return lnK(interp(tau_, false))(m); }, lnKs(m), lnKnew(m));
+            events.emplace_back(tau, PhaseEnvelopeEvent::critical);
+        }
+        std::sort(events.begin(), events.end(), [](const auto& e1, const auto& e2) { return std::get<0>(e1) < std::get<0>(e2); });
+        for (auto [tau, event] : events) {
+            Eigen::VectorXd Xe = interp(tau, false), te = interp(tau, true);
+            te /= te.norm();
+            if (event != PhaseEnvelopeEvent::critical) {
+                // Polish the extremum onto the envelope, at the interpolated value of the other variable
+                Eigen::VectorXd Xpolished = Xe;
+                int i = (event == PhaseEnvelopeEvent::cricondentherm) ? 1 : 0;
+                int num_polish = 0;
+                tel.num_polish++;
+                if (correct(Xpolished, Eigen::VectorXd::Unit(M, i), Xe(i), num_polish, opt.max_newton) && lnK(Xpolished).cwiseAbs().maxCoeff() > 1e-8) {
+                    Xe = Xpolished;
+                }
+                else {
+                    tel.num_polish_failed++;
+                }
+            }
+            if (!emit(Xe, te, s + tau * h, h, event)) {
+                return "Stopped by callback";
+            }
+        }
+
+        s += h;
+        X = Xnew;
+        t = tnew;
+        if (!emit(X, t, s, h, PhaseEnvelopeEvent::none)) {
+            return "Stopped by callback";
+        }
+        const double T = exp(X(0)), p = exp(X(1));
+        if (p < p_min) {
+            return "The pressure fell below p_min";
+        }
+        if (p > opt.p_max) {
+            return "The pressure exceeded p_max";
+        }
+        if (T < opt.T_min || T > opt.T_max) {
+            return "The temperature left [T_min, T_max]";
+        }
+        // Adapt the step length to the number of Newton iterations of the corrector
+        if (!jump) {
+            ds = std::min(opt.max_ds, ds * std::clamp(static_cast<double>(opt.target_newton) / num_newton, 0.5, 2.0));
+        }
+    }
+    return "The maximum number of steps was reached";
+}
+
+/***
+ * \brief Trace the phase envelope of a mixture at fixed overall composition, see the overload with a callback
+ * \returns The JSON with the points in "data" and the termination reason (and the telemetry, if requested) in "meta"
+ */
+inline nlohmann::json trace_phase_envelope(const AbstractModel& model, const double T0, const Eigen::ArrayXd& rhovecB0, const Eigen::ArrayXd& rhovecI0, const std::optional<PhaseEnvelopeOptions>& options = std::nullopt)
+{
+    auto opt = options.value_or(PhaseEnvelopeOptions{});
+    auto JSONdata = nlohmann::json::array();
+    SolverTelemetry telemetry;
+    auto termination_reason = trace_phase_envelope(model, T0, rhovecB0, rhovecI0, [&](const PhaseEnvelopePoint& pt) {
+        JSONdata.push_back(internal::phase_envelope_point_to_json(pt, opt.telemetry));
+        telemetry = pt.telemetry;
+        return true;
+    }, opt);
+    nlohmann::json meta{
+        {"termination_reason", termination_reason}
+    };
+    if (opt.telemetry) {
+        meta["telemetry"] = internal::SolverTelemetry_to_json(telemetry);
+    }
+    return nlohmann::json{
+        {"meta", meta},
+        {"data", JSONdata}
+    };
+}
+
 #define VLE_FUNCTIONS_TO_WRAP \
     X(trace_VLE_isobar_binary) \
     X(trace_VLE_isotherm_binary) \
+    X(trace_VLE_isobar_binary_dense) \
+    X(trace_VLE_isotherm_binary_dense) \
+    X(trace_phase_envelope) \
     X(get_dpsat_dTsat_isopleth) \
     X(get_drhovecdT_xsat) \
     X(get_drhovecdT_psat) \
     X(get_drhovecdp_Tsat) \
+    X(get_drhovecdT_psat_multicomponent) \
+    X(get_drhovecdp_Tsat_multicomponent) \
     X(trace_critical_arclength_binary) \
     X(mixture_VLE_px) \
     X(mix_VLE_Tp) \
@@ -1,42 +1,177 @@
 #pragma once
 
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+#include "nlohmann/json.hpp"
+#include "teqp/algorithms/continuation_types.hpp"
+
 namespace teqp{
 
+/// Counters of the work done by a phase equilibrium solver or tracer, to find the regions that converge slowly and to tune the options from data
+struct SolverTelemetry {
+    int num_iter = 0; ///< The iterations of a solver, or the accepted steps of a tracer
+    int num_Hessian = 0; ///< The evaluations of the Hessian of the Helmholtz energy density of one phase, which also give its gradient; not counted by the critical tracer
+    int num_rhs = 0; ///< The evaluations of the right-hand side of the differential equations of a tracer, or of the Jacobian in the predictor-corrector mode
+    int num_residual = 0; ///< The evaluations of the residual without the Hessians, in the quasi-Newton modes and by the corrector of the predictor-corrector mode
+    int num_rejected = 0; ///< The steps cut back to keep the concentrations positive in a solver, or rejected by the error control of a tracer
+    int num_polish = 0, num_polish_failed = 0; ///< The polishing solutions of a tracer, and how many of them did not converge
+    int num_escalated = 0; ///< The evaluations of the residual in extended precision, in the adaptive solvers of mixed_precision.hpp
+    double elapsed_s = 0; ///< The wall time, in s
+};
+
+namespace internal {
+    inline nlohmann::json SolverTelemetry_to_json(const SolverTelemetry& tel) {
+        return {
+            {"num_iter", tel.num_iter},
+            {"num_Hessian", tel.num_Hessian},
+            {"num_rhs", tel.num_rhs},
+            {"num_residual", tel.num_residual},
+            {"num_rejected", tel.num_rejected},
+            {"num_polish", tel.num_polish},
+            {"num_polish_failed", tel.num_polish_failed},
+            {"num_escalated", tel.num_escalated},
+            {"elapsed / s", tel.elapsed_s}
+        };
+    }
+}
+
+/// The state of a tracer at one of its points, from which the trace can be resumed, to extend a trace that stopped on its maximum
+/// number of steps, or to split a long trace over several jobs.  The continued trace takes the same steps as the uninterrupted one
+struct TraceCheckpoint {
+    std::string tracer; ///< The tracer that made the checkpoint, "critical", "VLE isotherm" or "VLE isobar"; only that tracer can resume from it
+    double t = 0, dt = 0, c = 0; ///< The tracing variable, the size of the next step and the sign of the direction
+    std::vector<double> x; ///< The state vector of the integrator
+    std::vector<double> drhodt, previous_drhodt; ///< The directions of the trace at the point and at the point before it, with which the directions of the next steps are aligned
+    int Nsteps = 0; ///< The number of steps from the start of the trace to the point
+    int counter_T_converged = 0; ///< For the critical tracer, the number of consecutive steps in which the temperature did not change
+
+    nlohmann::json to_json() const {
+        return {
+            {"tracer", tracer}, {"t", t}, {"dt", dt}, {"c", c}, {"x", x},
+            {"drhodt", drhodt}, {"previous_drhodt", previous_drhodt},
+            {"Nsteps", Nsteps}, {"counter_T_converged", counter_T_converged}
+        };
+    }
+    static TraceCheckpoint from_json(const nlohmann::json& j) {
+        TraceCheckpoint ckpt;
+        ckpt.tracer = j.at("tracer");
+        ckpt.t = j.at("t");
+        ckpt.dt = j.at("dt");
+        ckpt.c = j.at("c");
+        ckpt.x = j.at("x").get<std::vector<double>>();
+        ckpt.drhodt = j.at("drhodt").get<std::vector<double>>();
+        ckpt.previous_drhodt = j.at("previous_drhodt").get<std::vector<double>>();
+        ckpt.Nsteps = j.at("Nsteps");
+        ckpt.counter_T_converged = j.at("counter_T_converged");
+        return ckpt;
+    }
+};
+
 struct TVLEOptions {
     double init_dt = 1e-5, abs_err = 1e-8, rel_err = 1e-8, max_dt = 100000, init_c = 1.0, p_termination = 1e15, crit_termination = 1e-12;
     int max_steps = 1000, integration_order = 5, revision = 1;
+    Eigen::ArrayXd xdirection; ///< The direction in which the liquid mole fractions change, required for more than two components
     bool polish = true;
     bool calc_criticality = false;
     bool terminate_unstable = false;
+    bool telemetry = false; ///< If true, the JSON output has the SolverTelemetry of the trace so far in each point, and in the "meta" of the revision 2
+    bool checkpoint = false; ///< If true, each point of the JSON output has its TraceCheckpoint as "checkpoint"
+    std::optional<TraceCheckpoint> resume; ///< If set, the trace continues after this checkpoint, and the initial state and init_c and init_dt are not used; max_steps counts the new steps only
+    std::optional<PredictorCorrectorOptions> predictor_corrector; ///< If set (for two components only), the steps are taken by teqp::continuation::PseudoArclength rather than by odeint, and integration_order, abs_err, rel_err and polish are not used
 };
 
 struct PVLEOptions {
     double init_dt = 1e-5, abs_err = 1e-8, rel_err = 1e-8, max_dt = 100000, init_c = 1.0;
     int max_steps = 1000, integration_order = 5;
+    Eigen::ArrayXd xdirection; ///< The direction in which the liquid mole fractions change, required for more than two components
     bool polish = true;
     bool calc_criticality = false;
     bool terminate_unstable = false;
+    bool telemetry = false; ///< If true, the JSON output has the SolverTelemetry of the trace so far in each point
+    bool checkpoint = false; ///< If true, each point of the JSON output has its TraceCheckpoint as "checkpoint"
+    std::optional<TraceCheckpoint> resume; ///< If set, the trace continues after this checkpoint, and the initial state and init_c and init_dt are not used; max_steps counts the new steps only
+    std::optional<PredictorCorrectorOptions> predictor_corrector; ///< If set (for two components only), the steps are taken by teqp::continuation::PseudoArclength rather than by odeint, and integration_order, abs_err, rel_err and polish are not used
 };
 
+/// In the quasi-Newton mode (broyden = true), the Jacobian from the Hessians of the model is only evaluated at the start and when
+/// the norm of the residual is not reduced below broyden_stall_ratio times its previous value; otherwise the Jacobian is
+/// updated with Broyden's rank-one updates.  More iterations are needed than with Newton's method, so maxiter should be increased.
 struct MixVLEpxFlags {
     double atol = 1e-10,
     reltol = 1e-10,
     axtol = 1e-10,
-    relxtol = 1e-10;
+    relxtol = 1e-10,
+    broyden_stall_ratio = 0.5;
     int maxiter = 10;
+    bool broyden = false;
 };
 
+/// See MixVLEpxFlags for the quasi-Newton mode
 struct MixVLETpFlags {
     double atol = 1e-10,
     reltol = 1e-10,
     axtol = 1e-10,
     relxtol = 1e-10,
-    relaxation = 1.0;
+    relaxation = 1.0,
+    broyden_stall_ratio = 0.5;
     int maxiter = 10;
+    bool broyden = false;
 };
 
 enum class VLE_return_code { unset, xtol_satisfied, functol_satisfied, maxfev_met, maxiter_met, notfinite_step };
 
+/// A point along a traced binary phase envelope, as passed to the callback of the streaming overloads of trace_VLE_isotherm_binary
+/// and trace_VLE_isobar_binary.  The same instance is re-used for all the points of a trace, so no memory is allocated per point
+struct VLETracePoint {
+    double t = 0, dt = 0, T = 0, pL = 0, pV = 0, c = 0;
+    Eigen::ArrayXd rhovecL, rhovecV;
+    Eigen::ArrayXd drhodt; ///< The derivative of the state vector with respect to the tracing variable
+    Eigen::Array2d critL, critV; ///< The criticality conditions of each phase, only evaluated if calc_criticality is set
+    SolverTelemetry telemetry; ///< The work done by the trace up to and including this point
+    TraceCheckpoint checkpoint; ///< The state of the tracer at this point, from which the trace can be resumed
+};
+
+/// The callback receives each point as it is produced, and returns false to stop the trace
+using VLETraceCallback = std::function<bool(const VLETracePoint&)>;
+
+/// Options for the dense output of the tracers, in which the traced curve is interpolated at requested values of a variable
+struct VLEDenseOptions {
+    std::string variable = "p"; ///< The variable of the requested values: "p" (isotherms only), "T" (isobars only) or "xL_0", the mole fraction of the first component in the liquid
+    bool polish = false; ///< If true, each interpolated point is polished at the requested value; the interpolated point is kept if the polishing fails
+};
+
+/// Options for trace_phase_envelope.  The step length ds is the length of the step in the space of the logarithms of the
+/// temperature, the pressure and the molar concentrations of both phases, so a step of 0.05 changes each of them by at most about 5%
+struct PhaseEnvelopeOptions {
+    double init_ds = 0.01, max_ds = 0.2, min_ds = 1e-8;
+    double newton_tol = 1e-10; ///< The corrector has converged when no logarithmic variable changes by more than this
+    double crit_lnK = 0.05; ///< Close to the critical point, when no ln(rho_I,i/rho_B,i) is larger than this in magnitude, the step jumps over the critical point
+    double p_min = 0; ///< The trace terminates below this pressure, in Pa; if zero, the pressure of the starting point is used
+    double p_max = 1e9, T_min = 0, T_max = 1e5; ///< The trace also terminates outside these bounds, in Pa and K
+    int max_steps = 1000, max_newton = 8;
+    int target_newton = 4; ///< The step grows when the corrector needs fewer iterations than this, and shrinks when it needs more
+    bool telemetry = false; ///< If true, the JSON output has the SolverTelemetry of the trace so far in each point, and in the "meta"
+};
+
+/// The kinds of points passed to the callback of trace_phase_envelope; the special points are interpolated between the points of the
+/// trace, and passed in the order in which they are crossed
+enum class PhaseEnvelopeEvent { none, cricondenbar, cricondentherm, critical };
+
+/// A point along a phase envelope of a mixture at fixed overall composition.  The bulk phase has the overall composition, the
+/// incipient phase is the first drop of the other phase, so the bulk phase is the liquid on the bubble curve and the vapor on the dew curve
+struct PhaseEnvelopePoint {
+    double s = 0, ds = 0, T = 0, p = 0;
+    Eigen::ArrayXd rhovecB, rhovecI; ///< The molar concentrations of the bulk and the incipient phases
+    Eigen::ArrayXd dXds; ///< The unit tangent to the trace in the variables [ln T, ln p, ln rhovecB, ln rhovecI]
+    PhaseEnvelopeEvent event = PhaseEnvelopeEvent::none;
+    SolverTelemetry telemetry; ///< The work done by the trace up to and including this point
+};
+
+/// The callback receives each point as it is produced, and returns false to stop the trace
+using PhaseEnvelopeCallback = std::function<bool(const PhaseEnvelopePoint&)>;
+
 struct MixVLEReturn {
     bool success = false;
     std::string message = "";
@@ -45,6 +180,7 @@ struct MixVLEReturn {
     int num_iter=-1, num_fev=-1;
     double T=-1;
     Eigen::ArrayXd r, initial_r;
+    SolverTelemetry telemetry;
 };
 
 }
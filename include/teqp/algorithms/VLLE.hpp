@@ -1,5 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
 #include "teqp/derivs.hpp"
 #include "teqp/exceptions.hpp"
 #include "teqp/algorithms/VLLE_types.hpp"
@@ -21,9 +27,12 @@ namespace VLLE {
     * \param axtol Absolute tolerance on steps in independent variables
     * \param relxtol Relative tolerance on steps in independent variables
     * \param maxiter Maximum number of iterations permitted
+    * \param telemetry If not null, filled with the counters of the work done
     */
     
-    auto mix_VLLE_T(const AbstractModel& model, double T, const EArrayd& rhovecVinit, const EArrayd& rhovecL1init, const EArrayd& rhovecL2init, double atol, double reltol, double axtol, double relxtol, int maxiter) {
+    auto mix_VLLE_T(const AbstractModel& model, double T, const EArrayd& rhovecVinit, const EArrayd& rhovecL1init, const EArrayd& rhovecL2init, double atol, double reltol, double axtol, double relxtol, int maxiter, SolverTelemetry* telemetry = nullptr) {
+        const auto start = std::chrono::steady_clock::now();
+        SolverTelemetry tel;
 
         const Eigen::Index N = rhovecVinit.size();
         Eigen::MatrixXd J(3 * N, 3 * N); J.setZero();
@@ -38,16 +47,21 @@ namespace VLLE {
         Eigen::Map<Eigen::ArrayXd> rhovecL2(&(x(0+2*N)), N);
 
         VLLE_return_code return_code = VLLE_return_code::unset;
+        
+        // Buffers re-used in each iteration to avoid heap allocations
+        double PsirV, PsirL1, PsirL2;
+        Eigen::ArrayXd PsirgradV(N), PsirgradL1(N), PsirgradL2(N);
+        Eigen::MatrixXd hessianV(N, N), hessianL1(N, N), hessianL2(N, N);
+        Eigen::MatrixXd HtotV(N, N), HtotL1(N, N), HtotL2(N, N);
 
         for (int iter = 0; iter < maxiter; ++iter) {
 
-            auto [PsirV, PsirgradV, hessianV] = model.build_Psir_fgradHessian_autodiff(T, rhovecV);
-            auto [PsirL1, PsirgradL1, hessianL1] = model.build_Psir_fgradHessian_autodiff(T, rhovecL1);
-            auto [PsirL2, PsirgradL2, hessianL2] = model.build_Psir_fgradHessian_autodiff(T, rhovecL2);
-            
-            auto HtotV = model.build_Psi_Hessian_autodiff(T, rhovecV);
-            auto HtotL1 = model.build_Psi_Hessian_autodiff(T, rhovecL1);
-            auto HtotL2 = model.build_Psi_Hessian_autodiff(T, rhovecL2);
+            // The residual and total Hessians of each phase come from one evaluation of the derivatives
+            model.build_Psi_fgradHessian_autodiff(T, rhovecV, PsirV, PsirgradV, hessianV, HtotV);
+            model.build_Psi_fgradHessian_autodiff(T, rhovecL1, PsirL1, PsirgradL1, hessianL1, HtotL1);
+            model.build_Psi_fgradHessian_autodiff(T, rhovecL2, PsirL2, PsirgradL2, hessianL2, HtotL2);
+            tel.num_iter++;
+            tel.num_Hessian += 3;
 
             auto zV = rhovecV/rhovecV.sum(), zL1 = rhovecL1 / rhovecL1.sum(), zL2 = rhovecL2 / rhovecL2.sum();
             double RTL1 = model.get_R(zL1)*T, RTL2 = model.get_R(zL2)*T, RTV = model.get_R(zV)*T;
@@ -109,32 +123,76 @@ namespace VLLE {
                 return_code = VLLE_return_code::maxiter_met;
             }
         }
+        if (telemetry != nullptr) {
+            tel.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            *telemetry = tel;
+        }
         Eigen::ArrayXd rhovecVfinal = rhovecV, rhovecL1final = rhovecL1, rhovecL2final = rhovecL2;
         return std::make_tuple(return_code, rhovecVfinal, rhovecL1final, rhovecL2final);
     }
 
+    namespace internal {
+        /**
+        Intersection of the segments (j, j+1) and (k, k+1) of the curve, appended to solns if it is strictly inside both segments.
+        Derived from https://stackoverflow.com/a/17931809
+        */
+        template<typename Iterable>
+        void intersect_segments(const Iterable& x, const Iterable& y, const std::size_t j, const std::size_t k, std::vector<SelfIntersectionSolution>& solns) {
+            Eigen::Array22d A;
+            auto p0 = (Eigen::Array2d() << x[j], y[j]).finished();
+            auto p1 = (Eigen::Array2d() << x[j + 1], y[j + 1]).finished();
+            auto q0 = (Eigen::Array2d() << x[k], y[k]).finished();
+            auto q1 = (Eigen::Array2d() << x[k + 1], y[k + 1]).finished();
+            A.col(0) = p1 - p0;
+            A.col(1) = q0 - q1;
+            Eigen::Array2d params = A.matrix().colPivHouseholderQr().solve((q0 - p0).matrix());
+            if ((params > 0).binaryExpr((params < 1), [](auto x, auto y) {return x & y; }).all()) { // Both of the params are in (0,1)
+                auto soln = p0 + params[0] * (p1 - p0);
+                solns.emplace_back(SelfIntersectionSolution{ j, k, params[0], params[1], soln[0], soln[1] });
+            }
+        }
+    }
+
     /**
-    Derived from https://stackoverflow.com/a/17931809
+    * \brief The self-intersections of the curve through the points (x, y)
+    *
+    * The segments are swept in increasing order of their smallest x, keeping the list of the segments whose x range covers the
+    * current one; only the pairs whose bounding boxes overlap are tested for intersection. For a curve that only covers each
+    * value of x a few times (a traced isotherm, for instance), the cost is that of the sorting, instead of the square of the
+    * number of points. The intersections are returned in increasing order of j, then k, with j < k.
     */
     template<typename Iterable>
-    auto get_self_intersections(Iterable& x, Iterable& y) {
-        Eigen::Array22d A;
+    auto get_self_intersections(const Iterable& x, const Iterable& y) {
         std::vector<SelfIntersectionSolution> solns;
-        for (auto j = 0; j < x.size() - 1; ++j) {
-            auto p0 = (Eigen::Array2d() << x[j], y[j]).finished();
-            auto p1 = (Eigen::Array2d() << x[j + 1], y[j + 1]).finished();
-            A.col(0) = p1 - p0;
-            for (auto k = j + 1; k < x.size() - 1; ++k) {
-                auto q0 = (Eigen::Array2d() << x[k], y[k]).finished();
-                auto q1 = (Eigen::Array2d() << x[k + 1], y[k + 1]).finished();
-                A.col(1) = q0 - q1;
-                Eigen::Array2d params = A.matrix().colPivHouseholderQr().solve((q0 - p0).matrix());
-                if ((params > 0).binaryExpr((params < 1), [](auto x, auto y) {return x & y; }).all()) { // Both of the params are in (0,1)
-                    auto soln = p0 + params[0] * (p1 - p0);
-                    solns.emplace_back(SelfIntersectionSolution{ static_cast<std::size_t>(j), static_cast<std::size_t>(k), params[0], params[1], soln[0], soln[1] });
+        if (x.size() < 3) {
+            return solns;
+        }
+        const std::size_t Nseg = x.size() - 1;
+        auto xmin = [&](std::size_t i) { return std::min(x[i], x[i + 1]); };
+        auto xmax = [&](std::size_t i) { return std::max(x[i], x[i + 1]); };
+        std::vector<std::size_t> order(Nseg);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return xmin(a) < xmin(b); });
+
+        std::vector<std::size_t> active; // The segments whose x range may still overlap with the following ones
+        for (auto i : order) {
+            const double xlo = xmin(i), ylo = std::min(y[i], y[i + 1]), yhi = std::max(y[i], y[i + 1]);
+            for (std::size_t m = 0; m < active.size();) {
+                auto a = active[m];
+                if (xmax(a) < xlo) {
+                    // Ended before this segment, so also before all the following ones
+                    active[m] = active.back();
+                    active.pop_back();
+                    continue;
+                }
+                if (!(std::max(y[a], y[a + 1]) < ylo || std::min(y[a], y[a + 1]) > yhi)) {
+                    internal::intersect_segments(x, y, std::min(a, i), std::max(a, i), solns);
                 }
+                ++m;
             }
+            active.push_back(i);
         }
+        std::sort(solns.begin(), solns.end(), [](const auto& a, const auto& b) { return std::tie(a.j, a.k) < std::tie(b.j, b.k); });
         return solns;
     }
 
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+
+#include <Eigen/Dense>
+
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/continuation_types.hpp"
+
+namespace teqp {
+namespace continuation {
+
+/**
+ \brief Pseudo-arclength continuation of a curve \f$F(x) = 0\f$, with \f$F\f$ from \f$\mathbb{R}^n\f$ to \f$\mathbb{R}^{n-1}\f$
+
+ The state is a point x of the curve, the Jacobian J of F at x, and the unit tangent t to the curve, the null vector of J oriented
+ along the direction of travel. A step of length ds predicts \f$x_p = x + ds\,t\f$, and corrects it with chord Newton iterations
+ on the bordered system \f$[F(x); t\cdot(x-x_p)] = 0\f$, whose matrix \f$[J; t^T]\f$ is factorized once per step. So a step costs
+ one Jacobian, at the corrected point where it also gives the next tangent, and one residual per iteration of the corrector.
+
+ A step is rejected, and retried with half the length, if the corrector does not converge within max_corrector iterations or stops
+ contracting, if F or its Jacobian cannot be evaluated (they throw, or are not finite), or if the corrected point is not ahead of
+ the start of the step along t. After an accepted step, the step length is scaled by target_corrector over the number of iterations
+ of the corrector, within [1/2, 2], as in trace_phase_envelope.
+
+ \tparam Residual Callable as residual(const Eigen::VectorXd& x), returning F(x) as an Eigen::VectorXd of n-1 entries
+ \tparam Jacobian Callable as jacobian(const Eigen::VectorXd& x), returning J(x) as an Eigen::MatrixXd of n-1 rows and n columns
+ */
+template<typename Residual, typename Jacobian>
+class PseudoArclength {
+private:
+    Residual residual;
+    Jacobian jacobian;
+    PredictorCorrectorOptions opt;
+    Eigen::VectorXd x, t;
+    Eigen::MatrixXd J;
+    Eigen::PartialPivLU<Eigen::MatrixXd> lu;
+
+    void factorize() {
+        Eigen::MatrixXd A(J.rows() + 1, J.cols());
+        A.topRows(J.rows()) = J;
+        A.bottomRows(1) = t.transpose();
+        lu.compute(A);
+    }
+
+public:
+    int num_jacobian = 0; ///< The evaluations of the Jacobian
+    int num_residual = 0; ///< The evaluations of the residual by the corrector
+    int num_rejected = 0; ///< The rejected steps
+    int num_corrector = 0; ///< The iterations of the corrector in the last accepted step
+
+    PseudoArclength(const Residual& residual, const Jacobian& jacobian, const PredictorCorrectorOptions& opt = {}) : residual(residual), jacobian(jacobian), opt(opt) {};
+
+    /// The unit null vector of J (of n-1 rows and n columns), with a positive projection on orientation if it is not empty
+    static Eigen::VectorXd tangent(const Eigen::MatrixXd& J, const Eigen::VectorXd& orientation) {
+        const auto n = J.cols();
+        if (orientation.size() == n) {
+            // The null vector is the solution of [J; o^T] tau = [0; 1], whose projection on o is positive
+            Eigen::MatrixXd A(n, n);
+            A.topRows(n - 1) = J;
+            A.bottomRows(1) = orientation.transpose();
+            Eigen::VectorXd tau = A.partialPivLu().solve(Eigen::VectorXd::Unit(n, n - 1));
+            if (tau.allFinite() && tau.norm() > 0) {
+                return tau / tau.norm();
+            }
+        }
+        // The last column of Q in the QR decomposition of J^T is orthogonal to the rows of J
+        Eigen::HouseholderQR<Eigen::MatrixXd> qr(J.transpose());
+        Eigen::VectorXd tau = qr.householderQ() * Eigen::VectorXd::Unit(n, n - 1);
+        if (orientation.size() == n && tau.dot(orientation) < 0) {
+            tau *= -1;
+        }
+        return tau / tau.norm();
+    }
+
+    /// Start from the point x0, which must be on the curve, with the tangent oriented along orientation, or of arbitrary sign if orientation is empty
+    void start(const Eigen::VectorXd& x0, const Eigen::VectorXd& orientation = Eigen::VectorXd()) {
+        x = x0;
+        J = jacobian(x);
+        num_jacobian++;
+        if (J.rows() != x.size() - 1 || J.cols() != x.size()) {
+            throw InvalidArgument("The Jacobian must have one row less than the number of variables, and one column per variable");
+        }
+        t = tangent(J, orientation);
+        if (!J.allFinite() || !t.allFinite()) {
+            throw IterationFailure("The tangent to the curve is not defined at the starting point");
+        }
+        factorize();
+    }
+
+    const Eigen::VectorXd& get_x() const { return x; }
+    const Eigen::VectorXd& get_t() const { return t; }
+    const Eigen::MatrixXd& get_J() const { return J; }
+
+    /// Reverse the direction of travel
+    void reverse() {
+        t *= -1;
+        factorize();
+    }
+
+    /// Try one step of length ds > 0; if it is accepted, the point, its Jacobian and its tangent are those at the end of the step
+    bool try_step(const double ds) {
+        const auto n = x.size();
+        const Eigen::VectorXd xp = x + ds * t;
+        Eigen::VectorXd xk = xp, r(n);
+        double last = std::numeric_limits<double>::infinity();
+        for (auto k = 1; k <= opt.max_corrector; ++k) {
+            try {
+                r.head(n - 1) = residual(xk);
+            }
+            catch (const std::exception&) {
+                return false;
+            }
+            num_residual++;
+            r(n - 1) = t.dot(xk - xp);
+            if (!r.allFinite()) {
+                return false;
+            }
+            const Eigen::VectorXd dx = lu.solve(-r);
+            xk += dx;
+            const double size = dx.lpNorm<Eigen::Infinity>();
+            if (!(size <= opt.max_contraction * last)) {
+                return false;
+            }
+            if (size <= opt.tol * xk.lpNorm<Eigen::Infinity>()) {
+                if ((xk - x).dot(t) <= 0) {
+                    return false;
+                }
+                Eigen::MatrixXd Jk;
+                try {
+                    Jk = jacobian(xk);
+                }
+                catch (const std::exception&) {
+                    return false;
+                }
+                num_jacobian++;
+                if (!Jk.allFinite()) {
+                    return false;
+                }
+                Eigen::VectorXd tk = tangent(Jk, t);
+                if (!tk.allFinite()) {
+                    return false;
+                }
+                x = xk; J = Jk; t = tk;
+                factorize();
+                num_corrector = k;
+                return true;
+            }
+            last = size;
+        }
+        return false;
+    }
+
+    /**
+     \brief Take a step, halving ds until the step is accepted, and then adapting ds (up to max_ds) for the next step
+     \returns The length of the step, or zero if ds fell below min_ds without an accepted step
+     */
+    double step(double& ds, const double max_ds) {
+        while (ds >= opt.min_ds) {
+            const double h = ds;
+            if (try_step(h)) {
+                ds = std::min(max_ds, h * std::clamp(static_cast<double>(opt.target_corrector) / num_corrector, 0.5, 2.0));
+                return h;
+            }
+            num_rejected++;
+            ds /= 2;
+        }
+        return 0.0;
+    }
+};
+
+}
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace teqp {
+
+/// The options of the pseudo-arclength predictor-corrector continuation of teqp::continuation::PseudoArclength
+struct PredictorCorrectorOptions {
+    double tol = 1e-10; ///< The corrector has converged when no variable changes by more than tol times the largest magnitude of the variables
+    double max_contraction = 0.5; ///< The step is rejected when an iteration of the corrector changes the variables by more than this fraction of the change of the previous one
+    double min_ds = 1e-12; ///< The trace terminates when the step length is halved below this
+    int max_corrector = 10; ///< The step is rejected when the corrector has not converged after this many iterations
+    int target_corrector = 5; ///< The step grows when the corrector needs fewer iterations than this, and shrinks when it needs more
+};
+
+}
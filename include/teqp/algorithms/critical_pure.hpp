@@ -14,6 +14,58 @@
 using namespace teqp::cppinterface;
 
 namespace teqp {
+
+    namespace internal {
+        /// The mole fractions of a pure fluid: [1], or those of the fluid alternative_pure_index alone in a mixture of alternative_length components
+        inline Eigen::ArrayXd get_pure_molefracs(const std::optional<std::size_t>& alternative_pure_index, const std::optional<std::size_t>& alternative_length) {
+            Eigen::ArrayXd z;
+            if (!alternative_pure_index) {
+                z = (Eigen::ArrayXd(1) << 1.0).finished();
+            }
+            else {
+                z = Eigen::ArrayXd(alternative_length.value()); z.setZero();
+                auto index = alternative_pure_index.value();
+                if (index >= 0 && index < z.size()){
+                    z(index) = 1.0;
+                }
+                else{
+                    throw teqp::InvalidArgument("The provided alternative index of " + std::to_string(index) + " is out of range");
+                }
+            }
+            return z;
+        }
+
+        /// The flags of solve_pure_critical, see there
+        struct PureCriticalFlags {
+            int maxsteps = 10;
+            std::optional<double> tol;
+            std::optional<std::size_t> alternative_pure_index;
+            std::optional<std::size_t> alternative_length;
+        };
+
+        inline PureCriticalFlags parse_pure_critical_flags(const std::optional<nlohmann::json>& flags) {
+            PureCriticalFlags f;
+            if (flags){
+                if (flags.value().contains("maxsteps")){
+                    f.maxsteps = flags.value().at("maxsteps");
+                }
+                if (flags.value().contains("tol")){
+                    f.tol = flags.value().at("tol").get<double>();
+                }
+                if (flags.value().contains("alternative_pure_index")){
+                    auto i = flags.value().at("alternative_pure_index").get<int>();
+                    if (i < 0){ throw teqp::InvalidArgument("alternative_pure_index cannot be less than 0"); }
+                    f.alternative_pure_index = i;
+                }
+                if (flags.value().contains("alternative_length")){
+                    auto i = flags.value().at("alternative_length").get<int>();
+                    if (i < 2){ throw teqp::InvalidArgument("alternative_length cannot be less than 2"); }
+                    f.alternative_length = i;
+                }
+            }
+            return f;
+        }
+    }
     
     /**
     * Calculate the criticality conditions for a pure fluid and its Jacobian w.r.t. the temperature and density
@@ -23,20 +75,7 @@ namespace teqp {
     inline auto get_pure_critical_conditions_Jacobian(const AbstractModel& model, const double T, const double rho,
         const std::optional<std::size_t>& alternative_pure_index = std::nullopt, const std::optional<std::size_t>& alternative_length = std::nullopt) {
 
-        Eigen::ArrayXd z;
-        if (!alternative_pure_index) {
-            z = (Eigen::ArrayXd(1) << 1.0).finished();
-        }
-        else {
-            z = Eigen::ArrayXd(alternative_length.value()); z.setZero();
-            auto index = alternative_pure_index.value();
-            if (index >= 0 && index < z.size()){
-                z(index) = 1.0;
-            }
-            else{
-                throw teqp::InvalidArgument("The provided alternative index of " + std::to_string(index) + " is out of range");
-            }
-        }
+        const Eigen::ArrayXd z = internal::get_pure_molefracs(alternative_pure_index, alternative_length);
         auto R = model.get_R(z);
 
         auto ders = model.get_Ar04n(T, rho, z);
@@ -60,10 +99,11 @@ namespace teqp {
         sy.simplify(sy.diff(sy.diff(p,rho,2),Trecip)*dTrecip_dT)
         */
 
-        // Note: these derivatives are expressed in terms of 1/T and rho as independent variables
-        auto Ar11 = model.get_Ar11(T, rho, z);
-        auto Ar12 = model.get_Ar12(T, rho, z);
-        auto Ar13 = model.get_Ar13(T, rho, z);
+        // Note: these derivatives are expressed in terms of 1/T and rho as independent variables. The mixed derivatives
+        // are all taken from the tensor of derivatives of one evaluation along a few directions in (1/T, rho), rather than
+        // from one nested dual evaluation for each of them; the residuals above keep the exact derivatives in rho
+        auto tensor = model.get_deriv_matN(4, T, rho, z);
+        auto Ar11 = tensor(1, 1), Ar12 = tensor(1, 2), Ar13 = tensor(1, 3);
 
         auto d3pdrho3 = R * T / (rho * rho) * (6 * ders[2] + 6 * ders[3] + ders[4]);
         auto d_dpdrho_dT = R * (-(Ar12 + 2 * Ar11) + ders[2] + 2 * ders[1] + 1);
@@ -89,71 +129,38 @@ namespace teqp {
         return get_pure_critical_conditions_Jacobian(*(view_), T, rho, alternative_pure_index, alternative_length);
     }
 
-    template<typename Model, typename Scalar, ADBackends backend = ADBackends::autodiff, typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, Model>::value>::type>
-    auto solve_pure_critical(const Model& model, const Scalar T0, const Scalar rho0, const std::optional<nlohmann::json>& flags = std::nullopt) {
-        auto x = (Eigen::ArrayXd(2) << T0, rho0).finished();
-        int maxsteps = 10;
-        std::optional<std::size_t> alternative_pure_index;
-        std::optional<std::size_t> alternative_length;
-        if (flags){
-            if (flags.value().contains("maxsteps")){
-                maxsteps = flags.value().at("maxsteps");
-            }
-            if (flags.value().contains("alternative_pure_index")){
-                auto i = flags.value().at("alternative_pure_index").get<int>();
-                if (i < 0){ throw teqp::InvalidArgument("alternative_pure_index cannot be less than 0"); }
-                alternative_pure_index = i;
-            }
-            if (flags.value().contains("alternative_length")){
-                auto i = flags.value().at("alternative_length").get<int>();
-                if (i < 2){ throw teqp::InvalidArgument("alternative_length cannot be less than 2"); }
-                alternative_length = i;
-            }
-        }
-        // A convenience method to make linear system solving more concise with Eigen datatypes
-        // All arguments are converted to matrices, the solve is done, and an array is returned
-        auto linsolve = [](const auto& a, const auto& b) {
-            return a.matrix().colPivHouseholderQr().solve(b.matrix()).array().eval();
-        };
+    /**
+    * Solve for the critical point of a pure fluid with Newton's method on the criticality conditions
+    *
+    * The flags are:
+    * - "maxsteps": the maximum number of Newton steps (default: 10)
+    * - "tol": if given, the iteration stops once the relative steps in T and rho are both below this value; otherwise all the steps are taken.
+    *   When the initial values come from the critical point of a nearby model, for instance in a fitting loop, only a few steps are then needed
+    * - "alternative_pure_index" and "alternative_length": the index of the fluid in a mole fraction vector of this length
+    */
+    inline auto solve_pure_critical(const AbstractModel& model, const double T0, const double rho0, const std::optional<nlohmann::json>& flags = std::nullopt) {
+        double T = T0, rho = rho0;
+        const auto [maxsteps, tol, alternative_pure_index, alternative_length] = internal::parse_pure_critical_flags(flags);
         for (auto counter = 0; counter < maxsteps; ++counter) {
-            auto [resids, Jacobian] = get_pure_critical_conditions_Jacobian(model, x[0], x[1], alternative_pure_index, alternative_length);
-            auto v = linsolve(Jacobian, -resids);
-            x += v;
+            auto [resids, J] = get_pure_critical_conditions_Jacobian(model, T, rho, alternative_pure_index, alternative_length);
+            // The 2x2 system is solved in closed form
+            auto det = J(0, 0)*J(1, 1) - J(0, 1)*J(1, 0);
+            auto dT = -(J(1, 1)*resids[0] - J(0, 1)*resids[1])/det;
+            auto drho = -(J(0, 0)*resids[1] - J(1, 0)*resids[0])/det;
+            T += dT;
+            rho += drho;
+            if (tol && std::abs(dT) < tol.value()*std::abs(T) && std::abs(drho) < tol.value()*std::abs(rho)){
+                break;
+            }
         }
-        return std::make_tuple(x[0], x[1]);
+        return std::make_tuple(T, rho);
     }
 
-    inline auto solve_pure_critical(const AbstractModel& model, const double T0, const double rho0, const std::optional<nlohmann::json>& flags = std::nullopt) {
-        auto x = (Eigen::ArrayXd(2) << T0, rho0).finished();
-        int maxsteps = 10;
-        std::optional<std::size_t> alternative_pure_index;
-        std::optional<std::size_t> alternative_length;
-        if (flags){
-            if (flags.value().contains("maxsteps")){
-                maxsteps = flags.value().at("maxsteps");
-            }
-            if (flags.value().contains("alternative_pure_index")){
-                auto i = flags.value().at("alternative_pure_index").get<int>();
-                if (i < 0){ throw teqp::InvalidArgument("alternative_pure_index cannot be less than 0"); }
-                alternative_pure_index = i;
-            }
-            if (flags.value().contains("alternative_length")){
-                auto i = flags.value().at("alternative_length").get<int>();
-                if (i < 2){ throw teqp::InvalidArgument("alternative_length cannot be less than 2"); }
-                alternative_length = i;
-            }
-        }
-        // A convenience method to make linear system solving more concise with Eigen datatypes
-        // All arguments are converted to matrices, the solve is done, and an array is returned
-        auto linsolve = [](const auto& a, const auto& b) {
-            return a.matrix().colPivHouseholderQr().solve(b.matrix()).array().eval();
-        };
-        for (auto counter = 0; counter < maxsteps; ++counter) {
-            auto [resids, Jacobian] = get_pure_critical_conditions_Jacobian(model, x[0], x[1], alternative_pure_index, alternative_length);
-            auto v = linsolve(Jacobian, -resids);
-            x += v;
-        }
-        return std::make_tuple(x[0], x[1]);
+    template<typename Model, typename Scalar, ADBackends backend = ADBackends::autodiff, typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, Model>::value>::type>
+    auto solve_pure_critical(const Model& model, const Scalar T0, const Scalar rho0, const std::optional<nlohmann::json>& flags = std::nullopt) {
+        using namespace teqp::cppinterface::adapter;
+        auto view_ = std::unique_ptr<AbstractModel>(view(model));
+        return solve_pure_critical(*(view_), T0, rho0, flags);
     }
 
     template <typename Model, typename Scalar, typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, Model>::value>::type>
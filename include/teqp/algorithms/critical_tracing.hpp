@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <fstream>
 #include <optional>
 
@@ -9,6 +10,8 @@
 #include "teqp/algorithms/rootfinding.hpp"
 #include "teqp/algorithms/critical_pure.hpp"
 #include "teqp/algorithms/critical_tracing_types.hpp"
+#include "teqp/algorithms/VLE_types.hpp"
+#include "teqp/algorithms/continuation.hpp"
 #include "teqp/exceptions.hpp"
 
 // Imports from boost
@@ -36,26 +39,28 @@ struct CriticalTracing {
         return std::make_tuple(es.eigenvalues(), es.eigenvectors());
     }
 
-    static auto eigen_problem(const AbstractModel& model, const Scalar T, const VecType& rhovec, const std::optional<VecType>& alignment_v0 = std::nullopt) {
-
-        EigenData ed;
-
+    /// The Hessian of the total Psi w.r.t. the molar concentrations; the ideal-gas terms of the components with zero concentration are omitted
+    static auto build_Psi_Hessian(const AbstractModel& model, const Scalar T, const VecType& rhovec) {
         auto N = rhovec.size();
-        Eigen::ArrayX<bool> mask = (rhovec != 0).eval();
 
         // Build the Hessian for the residual part;
-#if defined(USE_AUTODIFF)
         auto H = model.build_Psir_Hessian_autodiff(T, rhovec);
-#else
-        using id = IsochoricDerivatives<decltype(model)>;
-        auto H = id::build_Psir_Hessian_mcx(model, T, rhovec);
-#endif
         // ... and add ideal-gas terms to H
         for (auto i = 0; i < N; ++i) {
-            if (mask[i]) {
+            if (rhovec[i] != 0) {
                 H(i, i) += model.R(rhovec/rhovec.sum()) * T / rhovec[i];
             }
         }
+        return H;
+    }
+
+    static auto eigen_problem(const AbstractModel& model, const Scalar T, const VecType& rhovec, const std::optional<VecType>& alignment_v0 = std::nullopt) {
+
+        EigenData ed;
+
+        auto N = rhovec.size();
+        Eigen::ArrayX<bool> mask = (rhovec != 0).eval();
+        Eigen::MatrixXd H = build_Psi_Hessian(model, T, rhovec);
 
         Eigen::Index nonzero_count = mask.count();
         auto zero_count = N - nonzero_count;
@@ -117,6 +122,55 @@ struct CriticalTracing {
         return ed;
     }
 
+    /**
+    * \brief The eigenpair of the Hessian of Psi with the smallest eigenvalue, tracked from the eigenvector at a nearby state
+    *
+    * Instead of the complete decomposition of eigen_problem, the eigenpair is obtained with inverse iteration, shifted by the
+    * Rayleigh quotient of the seed; the shift is updated (Rayleigh quotient iteration) if the iteration is slow to converge. When
+    * the seed is the eigenvector at a nearby state, a single factorization and one or two solves are needed. Only the tracked
+    * eigenvalue and v0 are populated (eigenvectorscols holds v0 alone, and v1 is empty), with v0 aligned with the seed.
+    *
+    * The complete eigen_problem is solved instead if the seed is empty, if a concentration is zero, or if the iteration does not
+    * converge to an eigenvector that remains nearly parallel to the seed.
+    */
+    static auto eigen_problem_incremental(const AbstractModel& model, const Scalar T, const VecType& rhovec, const VecType& alignment_v0) {
+        if (alignment_v0.size() != rhovec.size() || (rhovec == 0).any()) {
+            return eigen_problem(model, T, rhovec, alignment_v0);
+        }
+        auto N = rhovec.size();
+        Eigen::MatrixXd H = build_Psi_Hessian(model, T, rhovec);
+        const double scale = H.cwiseAbs().maxCoeff();
+        const Eigen::VectorXd seed = alignment_v0.matrix().normalized();
+        Eigen::VectorXd v = seed;
+        double lambda = v.dot(H*v);
+        for (auto refactor = 0; refactor < 3; ++refactor) {
+            Eigen::LDLT<Eigen::MatrixXd> ldlt(H - lambda*Eigen::MatrixXd::Identity(N, N));
+            for (auto i = 0; i < 4; ++i) {
+                Eigen::VectorXd w = ldlt.solve(v);
+                if (!w.allFinite() || w.norm() == 0) {
+                    break; // The shift is an eigenvalue to working precision; refactor with the Rayleigh quotient
+                }
+                v = w.normalized();
+                if (v.dot(seed) < 0) {
+                    v *= -1;
+                }
+                lambda = v.dot(H*v);
+                if ((H*v - lambda*v).norm() < 1e-13*scale) {
+                    if (v.dot(seed) < 0.9) {
+                        // Converged to another eigenpair
+                        return eigen_problem(model, T, rhovec, alignment_v0);
+                    }
+                    EigenData ed;
+                    ed.eigenvalues = Eigen::ArrayXd::Constant(1, lambda);
+                    ed.eigenvectorscols = v;
+                    ed.v0 = v.array();
+                    return ed;
+                }
+            }
+        }
+        return eigen_problem(model, T, rhovec, alignment_v0);
+    }
+
     struct psi1derivs {
         Eigen::ArrayXd psir, psi0, tot;
         EigenData ei;
@@ -126,12 +180,13 @@ struct CriticalTracing {
         return eigen_problem(model, T, rhovec).eigenvalues[0];
     }
 
-    static auto get_derivs(const AbstractModel& model, const double T, const VecType& rhovec, const std::optional<VecType>& alignment_v0 = std::nullopt) {
+    /// If incremental is true and alignment_v0 is given, the eigenvector is tracked from alignment_v0 with eigen_problem_incremental, and only ei.v0 is populated
+    static auto get_derivs(const AbstractModel& model, const double T, const VecType& rhovec, const std::optional<VecType>& alignment_v0 = std::nullopt, const bool incremental = false) {
         auto molefrac = rhovec / rhovec.sum();
         auto R = model.R(molefrac);
 
-        // Solve the complete eigenvalue problem
-        auto ei = eigen_problem(model, T, rhovec, alignment_v0);
+        // Solve the complete eigenvalue problem, or track the eigenvector of the smallest eigenvalue
+        auto ei = (incremental && alignment_v0) ? eigen_problem_incremental(model, T, rhovec, alignment_v0.value()) : eigen_problem(model, T, rhovec, alignment_v0);
 
         // Ideal-gas contributions of psi0 w.r.t. sigma_1, in the same form as the residual part
         Eigen::ArrayXd psi0_derivs(5); psi0_derivs.setZero();
@@ -145,38 +200,8 @@ struct CriticalTracing {
             }
         }
 
-#if defined(USE_AUTODIFF)
+        // The first through fourth derivatives of Psi^r w.r.t. sigma_1, in Taylor mode along v0
         auto psir_derivs = model.get_Psir_sigma_derivs(T, rhovec, ei.v0);
-//        // Calculate the first through fourth derivative of Psi^r w.r.t. sigma_1
-//        ArrayXdual4th v0(ei.v0.size()); for (auto i = 0; i < ei.v0.size(); ++i) { v0[i] = ei.v0[i]; }
-//        ArrayXdual4th rhovecad(rhovec.size());  for (auto i = 0; i < rhovec.size(); ++i) { rhovecad[i] = rhovec[i]; }
-//        dual4th varsigma{ 0.0 };
-//        auto wrapper = [&rhovecad, &v0, &T, &model](const auto& sigma_1) {
-//            auto rhovecused = (rhovecad + sigma_1 * v0).eval();
-//            auto rhotot = rhovecused.sum();
-//            auto molefrac = (rhovecused / rhotot).eval();
-//            return eval(model.alphar(T, rhotot, molefrac) * model.R(molefrac) * T * rhotot);
-//        };
-//        auto psir_derivs_ = derivatives(wrapper, wrt(varsigma), at(varsigma));
-//        Eigen::ArrayXd psir_derivs; psir_derivs.resize(5);
-//        for (auto i = 0; i < 5; ++i) { psir_derivs[i] = psir_derivs_[i]; }
-
-#else
-        using namespace mcx;
-        // Calculate the first through fourth derivative of Psi^r w.r.t. sigma_1
-        Eigen::Vector<MultiComplex<double>, Eigen::Dynamic> v0(ei.v0.size()); for (auto i = 0; i < ei.v0.size(); ++i) { v0[i] = ei.v0[i]; }
-        Eigen::Vector<MultiComplex<double>, Eigen::Dynamic> rhovecmcx(rhovec.size());  for (auto i = 0; i < rhovec.size(); ++i) { rhovecmcx[i] = rhovec[i]; }
-        using fcn_t = std::function<MultiComplex<double>(const MultiComplex<double>&)>;
-        fcn_t wrapper = [&rhovecmcx, &v0, &T, &model](const MultiComplex<double>& sigma_1) {
-            Eigen::Vector<MultiComplex<double>, Eigen::Dynamic> rhovecused = rhovecmcx + sigma_1 * v0;
-            auto rhotot = rhovecused.sum();
-            auto molefrac = (rhovecused / rhotot).eval();
-            return model.alphar(T, rhotot, molefrac) * model.R(molefrac) * T * rhotot;
-        };
-        auto psir_derivs_ = diff_mcx1(wrapper, 0.0, 4, true);
-        Eigen::ArrayXd psir_derivs; psir_derivs.resize(5);
-        for (auto i = 0; i < 5; ++i) { psir_derivs[i] = psir_derivs_[i]; }
-#endif
 
         // As a sanity check, the minimum eigenvalue of the Hessian constructed based on the molar concentrations
         // must match the second derivative of psi_tot w.r.t. sigma_1. This is not always satisfied for derivatives
@@ -209,10 +234,11 @@ struct CriticalTracing {
         auto all_derivs = get_derivs(model, T, rhovec, std::nullopt);
         auto derivs = all_derivs.tot;
 
-        // The temperature derivative of total Psi w.r.t.T from a centered finite difference in T
+        // The temperature derivative of total Psi w.r.t.T from a centered finite difference in T; at the perturbed
+        // states, only the eigenvector of the smallest eigenvalue is needed, which is tracked from the one at T
         auto dT = 1e-7;
-        auto plusT = get_derivs(model, T + dT, rhovec, all_derivs.ei.v0).tot;
-        auto minusT = get_derivs(model, T - dT, rhovec, all_derivs.ei.v0).tot;
+        auto plusT = get_derivs(model, T + dT, rhovec, all_derivs.ei.v0, true).tot;
+        auto minusT = get_derivs(model, T - dT, rhovec, all_derivs.ei.v0, true).tot;
         auto derivT = (plusT - minusT) / (2.0 * dT);
 
         // Solve the eigenvalue problem for the given T & rho
@@ -227,24 +253,24 @@ struct CriticalTracing {
         auto eval = [](const auto& ex) { return ex.eval(); };
         if (all(eval(rhovec_minus > 0)) && all(eval(rhovec_plus > 0))) {
             // Conventional centered derivative
-            auto plus_sigma2 = get_derivs(model, T, rhovec_plus, ei.v0);
-            auto minus_sigma2 = get_derivs(model, T, rhovec_minus, ei.v0);
+            auto plus_sigma2 = get_derivs(model, T, rhovec_plus, ei.v0, true);
+            auto minus_sigma2 = get_derivs(model, T, rhovec_minus, ei.v0, true);
             deriv_sigma2 = (plus_sigma2.tot - minus_sigma2.tot) / (2.0 * sigma2);
             stepping_desc = "conventional centered";
         }
         else if (all(eval(rhovec_plus > 0))) {
             // Forward derivative in the direction of v1
-            auto plus_sigma2 = get_derivs(model, T, rhovec_plus, ei.v0);
+            auto plus_sigma2 = get_derivs(model, T, rhovec_plus, ei.v0, true);
             auto rhovec_2plus = (rhovec + 2 * ei.v1 * sigma2).eval();
-            auto plus2_sigma2 = get_derivs(model, T, rhovec_2plus, ei.v0);
+            auto plus2_sigma2 = get_derivs(model, T, rhovec_2plus, ei.v0, true);
             deriv_sigma2 = (-3 * derivs + 4 * plus_sigma2.tot - plus2_sigma2.tot) / (2.0 * sigma2);
             stepping_desc = "forward";
         }
         else if (all(eval(rhovec_minus > 0))) {
             // Negative derivative in the direction of v1
-            auto minus_sigma2 = get_derivs(model, T, rhovec_minus, ei.v0);
+            auto minus_sigma2 = get_derivs(model, T, rhovec_minus, ei.v0, true);
             auto rhovec_2minus = (rhovec - 2 * ei.v1 * sigma2).eval();
-            auto minus2_sigma2 = get_derivs(model, T, rhovec_2minus, ei.v0);
+            auto minus2_sigma2 = get_derivs(model, T, rhovec_2minus, ei.v0, true);
             deriv_sigma2 = (-3 * derivs + 4 * minus_sigma2.tot - minus2_sigma2.tot) / (-2.0 * sigma2);
             stepping_desc = "backwards";
         }
@@ -270,7 +296,7 @@ struct CriticalTracing {
         std::cout << "rhovec_plus: " << rhovec_plus << std::endl;
         std::cout << "all_derivs.tot:" << all_derivs.tot << std::endl;
         std::cout << "all_derivs.psir:" << all_derivs.psir << std::endl; 
-        auto plus_sigma2 = get_derivs(model, T, rhovec_plus, ei.v0);
+        auto plus_sigma2 = get_derivs(model, T, rhovec_plus, ei.v0, true);
         std::cout << "plus_sigma2.tot:" << plus_sigma2.tot << std::endl;
         std::cout << "plus_sigma2.psir:" << plus_sigma2.psir << std::endl;
         std::cout << "dot of v0: " << plus_sigma2.ei.v0 * ei.v0 << std::endl;
@@ -388,6 +414,244 @@ struct CriticalTracing {
         return x;
     }
 
+    /**
+    * \brief The predictor-corrector mode of trace_critical_arclength_binary
+    *
+    * The curve of the criticality conditions in the variables [T, rhovec] is followed with teqp::continuation::PseudoArclength, so
+    * t is the arclength in [T, rhovec] rather than in rhovec alone. The conditions are evaluated with the eigenvector tracked from
+    * the one at the start of the step, so that their signs are consistent within a step, and their Jacobian is obtained by finite
+    * differences. The conditions are not smooth at infinite dilution, so a trace that starts there takes its first step along the
+    * tangent of the ODE, polished at constant mole fraction, before the continuation takes over.
+    */
+    static auto trace_critical_arclength_binary_pc(const AbstractModel& model, const Scalar& T0, const VecType& rhovec0, const std::string& filename, const TCABOptions& options) -> nlohmann::json {
+        const Eigen::Index N = rhovec0.size();
+        if (N != 2) {
+            throw InvalidArgument("The predictor-corrector mode of the critical tracer is only for two components");
+        }
+        const auto start = std::chrono::steady_clock::now();
+        SolverTelemetry tel;
+
+        // The eigenvector of the smallest eigenvalue at the last point where the Jacobian was evaluated
+        std::optional<VecType> v0;
+        auto conditions_at = [&](const Eigen::VectorXd& x) -> Eigen::VectorXd {
+            const VecType rhovec = x.tail(N).array();
+            auto derivs = get_derivs(model, x(0), rhovec, v0, true);
+            return (Eigen::VectorXd(2) << derivs.tot[2], derivs.tot[3]).finished();
+        };
+        auto residual = [&](const Eigen::VectorXd& x) -> Eigen::VectorXd { return conditions_at(x); };
+        auto jacobian = [&](const Eigen::VectorXd& x) -> Eigen::MatrixXd {
+            v0 = eigen_problem(model, x(0), x.tail(N).array().eval(), v0).v0;
+            // Centered differences, or forward ones where a concentration would become negative
+            const Eigen::VectorXd r0 = conditions_at(x);
+            Eigen::MatrixXd J(2, N + 1);
+            for (auto k = 0; k <= N; ++k) {
+                const double h = 1e-5 * ((k == 0) ? x(0) : x.tail(N).sum());
+                Eigen::VectorXd xp = x, xm = x;
+                xp(k) += h; xm(k) -= h;
+                J.col(k) = (xm(k) < 0) ? ((conditions_at(xp) - r0) / h).eval() : ((conditions_at(xp) - conditions_at(xm)) / (2 * h)).eval();
+            }
+            return J;
+        };
+        // The unit tangent of the ODE, with the orientation given by c
+        double c = options.init_c;
+        auto ODE_tangent = [&](const Eigen::VectorXd& x) -> Eigen::VectorXd {
+            auto drhodT = get_drhovec_dT_crit(model, x(0), x.tail(N).array().eval()).eval();
+            tel.num_rhs++;
+            Eigen::VectorXd tau(N + 1);
+            tau(0) = 1;
+            tau.tail(N) = drhodT;
+            return c * tau / tau.norm();
+        };
+        continuation::PseudoArclength pc(residual, jacobian, options.predictor_corrector.value());
+
+        auto JSONdata = nlohmann::json::array();
+        std::ofstream ofs = (filename.empty()) ? std::ofstream() : std::ofstream(filename);
+
+        double t = 0, dt = options.init_dt;
+        int counter_T_converged = 0, Nsteps = 0;
+        Eigen::VectorXd x(N + 1), tan;
+        const bool resumed = options.resume.has_value();
+        if (resumed) {
+            const auto& ckpt = options.resume.value();
+            x = Eigen::Map<const Eigen::VectorXd>(ckpt.x.data(), ckpt.x.size());
+            t = ckpt.t; dt = ckpt.dt; c = ckpt.c;
+            counter_T_converged = ckpt.counter_T_converged;
+            Nsteps = ckpt.Nsteps;
+            // The checkpoint has the tangent in the concentrations only, as for the ODE, which is enough to orient the trace
+            Eigen::VectorXd orientation = Eigen::VectorXd::Zero(N + 1);
+            if (ckpt.drhodt.size() == static_cast<std::size_t>(N)) {
+                orientation.tail(N) = Eigen::Map<const Eigen::VectorXd>(ckpt.drhodt.data(), N);
+            }
+            pc.start(x, orientation);
+            tan = pc.get_t();
+        }
+        else {
+            x(0) = T0;
+            x.tail(N) = rhovec0.matrix();
+            tan = ODE_tangent(x);
+            // Flip the sign if the first step would yield any negative concentrations
+            if (((x.tail(N) + dt * tan.tail(N)).array() < 0).any()) {
+                c *= -1;
+                tan *= -1;
+            }
+        }
+
+        auto store_point = [&]() {
+            const double T = x(0);
+            const VecType rhovec = x.tail(N).array();
+            auto rhotot = rhovec.sum();
+            double p = rhotot * model.R(rhovec / rhotot) * T + model.get_pr(T, rhovec);
+            auto conditions = get_criticality_conditions(model, T, rhovec);
+            double splus = model.get_splus(T, rhovec);
+            nlohmann::json point = {
+                {"t", t},
+                {"T / K", T},
+                {"rho0 / mol/m^3", static_cast<double>(rhovec[0])},
+                {"rho1 / mol/m^3", static_cast<double>(rhovec[1])},
+                {"c", c},
+                {"s^+", splus},
+                {"p / Pa", p},
+                {"dT/dt", tan(0)},
+                {"drho0/dt", tan(1)},
+                {"drho1/dt", tan(2)},
+                {"lambda1", conditions[0]},
+                {"dirderiv(lambda1)/dalpha", conditions[1]},
+            };
+            if (options.calc_stability) {
+                point["locally stable"] = is_locally_stable(model, T, rhovec, options.stability_rel_drho);
+            }
+            if (options.telemetry) {
+                tel.num_iter = Nsteps;
+                tel.num_residual = pc.num_residual;
+                tel.num_rejected = pc.num_rejected;
+                tel.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                point["telemetry"] = internal::SolverTelemetry_to_json(tel);
+            }
+            if (options.checkpoint) {
+                TraceCheckpoint ckpt;
+                ckpt.tracer = "critical";
+                ckpt.t = t; ckpt.dt = dt; ckpt.c = c;
+                ckpt.x.assign(x.data(), x.data() + x.size());
+                ckpt.drhodt.assign(tan.data() + 1, tan.data() + tan.size());
+                ckpt.Nsteps = Nsteps;
+                ckpt.counter_T_converged = counter_T_converged;
+                point["checkpoint"] = ckpt.to_json();
+            }
+            JSONdata.push_back(point);
+            return !(options.step_callback && !options.step_callback(JSONdata.back()));
+        };
+        auto write_line = [&]() {
+            if (filename.empty()) { return; }
+            const double T = x(0);
+            const VecType rhovec = x.tail(N).array();
+            auto rhotot = rhovec.sum();
+            auto conditions = get_criticality_conditions(model, T, rhovec);
+            std::stringstream out;
+            out << rhovec[0] / rhotot << "," << rhovec[0] << "," << rhovec[1] << "," << T << "," << rhotot * model.R(rhovec / rhotot) * T + model.get_pr(T, rhovec) << "," << c << "," << dt << "," << conditions(0) << "," << conditions(1) << std::endl;
+            std::string sout(out.str());
+            std::cout << sout;
+            ofs << sout;
+        };
+        auto stop = [&](const std::string& why) {
+            if (options.verbosity > 10) {
+                std::cout << "Termination because " << why << std::endl;
+            }
+        };
+
+        ofs << "z0 / mole frac.,rho0 / mol/m^3,rho1 / mol/m^3,T / K,p / Pa,c,dt,condition(1),condition(2)" << std::endl;
+        bool stopped_by_callback = false;
+        if (!resumed) {
+            write_line();
+            if (!store_point()) {
+                return JSONdata;
+            }
+            if ((rhovec0 == 0).any()) {
+                // The first step, along the tangent of the ODE
+                const Eigen::VectorXd x1 = x + dt * tan;
+                const VecType rhovec1 = x1.tail(N).array();
+                try {
+                    auto [T1, rhovec1new] = critical_polish_fixedmolefrac(model, x1(0), rhovec1, rhovec1[0] / rhovec1.sum());
+                    tel.num_polish++;
+                    x(0) = T1;
+                    x.tail(N) = rhovec1new.matrix();
+                }
+                catch (const std::exception& e) {
+                    tel.num_polish_failed++;
+                    stop(std::string("the first step from infinite dilution failed: ") + e.what());
+                    return JSONdata;
+                }
+                t += dt;
+                pc.start(x, tan);
+                tan = pc.get_t();
+                Nsteps = 1;
+                write_line();
+                if (!store_point()) {
+                    return JSONdata;
+                }
+            }
+            else {
+                pc.start(x, tan);
+                tan = pc.get_t();
+            }
+        }
+
+        while (Nsteps < options.max_step_count) {
+            const double Tprev = x(0);
+            const double h = pc.step(dt, options.max_dt);
+            if (h == 0) {
+                stop("the step length fell below min_ds");
+                break;
+            }
+            t += h;
+            x = pc.get_x();
+            tan = pc.get_t();
+            tel.num_rhs = pc.num_jacobian;
+            const double z0 = x(1) / x.tail(N).sum();
+            if (z0 < 0 || z0 > 1) {
+                stop("z0 of " + std::to_string(z0) + " is outside [0, 1]");
+                break;
+            }
+            if (options.terminate_negative_density && x.tail(N).minCoeff() < 0) {
+                stop("a density is negative");
+                break;
+            }
+            counter_T_converged = (std::abs(x(0) - Tprev) < options.T_tol) ? counter_T_converged + 1 : 0;
+            write_line();
+            Nsteps++;
+            if (!store_point()) {
+                stop("the step callback returned false");
+                stopped_by_callback = true;
+                break;
+            }
+            if (counter_T_converged > options.small_T_count) {
+                stop("maximum number of small steps were taken");
+                break;
+            }
+        }
+        // As for the ODE, see if the end of the trace corresponds to a pure fluid, and if so, iterate to find the pure fluid endpoint
+        if (options.pure_endpoint_polish && !stopped_by_callback) {
+            VecType rhovec = x.tail(N).array();
+            const VecType drhodt = tan.tail(N).array();
+            const auto step = (rhovec + drhodt * dt).eval();
+            if ((step * rhovec > 0).any()) {
+                auto step_sizes = ((-rhovec) / drhodt).eval();
+                Eigen::Index ipure;
+                rhovec.maxCoeff(&ipure);
+                auto new_step_size = step_sizes(ipure);
+                const auto new_rhovec = (rhovec + drhodt * new_step_size).eval();
+                const double new_T = x(0) + tan(0) * new_step_size;
+                nlohmann::json flags = { {"alternative_pure_index", ipure}, {"alternative_length", 2} };
+                auto [TT, rhorho] = solve_pure_critical(model, new_T, new_rhovec.sum(), flags);
+                x(0) = TT;
+                x(1 + ipure) = rhorho;
+                x(1 + (1 - ipure)) = 0;
+                write_line();
+                store_point();
+            }
+        }
+        return JSONdata;
+    }
+
     static auto trace_critical_arclength_binary(const AbstractModel& model, const Scalar& T0, const VecType& rhovec0, const std::optional<std::string>& filename_ = std::nullopt, const std::optional<TCABOptions> &options_ = std::nullopt) -> nlohmann::json {
         std::string filename = filename_.value_or("");
         TCABOptions options = options_.value_or(TCABOptions{});
@@ -408,6 +672,16 @@ struct CriticalTracing {
         std::ofstream ofs = (filename.empty()) ? std::ofstream() : std::ofstream(filename);
         
         double c = options.init_c; 
+        const bool resumed = options.resume.has_value();
+        if (resumed && (options.resume->tracer != "critical" || options.resume->x.size() != static_cast<std::size_t>(rhovec0.size()) + 1)) {
+            throw InvalidArgument("The checkpoint to resume from is not one of a critical trace of " + std::to_string(rhovec0.size()) + " components");
+        }
+        if (options.predictor_corrector) {
+            return trace_critical_arclength_binary_pc(model, T0, rhovec0, filename, options);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        SolverTelemetry tel;
 
         // The function for the derivative in the form of odeint
         // x is [T, rhovec]
@@ -421,6 +695,7 @@ struct CriticalTracing {
             }
             
             auto drhodT = get_drhovec_dT_crit(model, T, rhovec).array().eval();
+            tel.num_rhs++;
             auto dTdt = 1.0 / norm(drhodT);
             Eigen::ArrayXd drhodt = c * (drhodT * dTdt).eval();
 
@@ -460,6 +735,15 @@ struct CriticalTracing {
         std::vector<double> x0(rhovec0.size() + 1); 
         x0[0] = T0;
         Eigen::Map<Eigen::ArrayXd>(&(x0[0]) + 1, x0.size() - 1) = rhovec0;
+        int counter_T_converged = 0, retry_count = 0, Nsteps = 0;
+        if (resumed) {
+            const auto& ckpt = options.resume.value();
+            x0 = ckpt.x;
+            t = ckpt.t; dt = ckpt.dt; c = ckpt.c;
+            last_drhodt = Eigen::Map<const Eigen::ArrayXd>(ckpt.drhodt.data(), ckpt.drhodt.size());
+            counter_T_converged = ckpt.counter_T_converged;
+            Nsteps = ckpt.Nsteps;
+        }
 
         // Make variables T and rhovec references to the contents of x0 vector
         // The views are mutable (danger!)
@@ -498,6 +782,20 @@ struct CriticalTracing {
             if (options.calc_stability) {
                 point["locally stable"] = is_locally_stable(model, T, rhovec, options.stability_rel_drho);
             }
+            if (options.telemetry) {
+                tel.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                point["telemetry"] = internal::SolverTelemetry_to_json(tel);
+            }
+            if (options.checkpoint) {
+                TraceCheckpoint ckpt;
+                ckpt.tracer = "critical";
+                ckpt.t = t; ckpt.dt = dt; ckpt.c = c;
+                ckpt.x = x0;
+                ckpt.drhodt.assign(last_drhodt.data(), last_drhodt.data() + last_drhodt.size());
+                ckpt.Nsteps = Nsteps;
+                ckpt.counter_T_converged = counter_T_converged;
+                point["checkpoint"] = ckpt.to_json();
+            }
             JSONdata.push_back(point);
         };
 
@@ -515,11 +813,11 @@ struct CriticalTracing {
             }
         };
         
-        int counter_T_converged = 0, retry_count = 0;
+        bool stopped_by_callback = false;
         ofs << "z0 / mole frac.,rho0 / mol/m^3,rho1 / mol/m^3,T / K,p / Pa,c,dt,condition(1),condition(2)" << std::endl;
         
-        // Determine the initial direction of integration
-        {
+        // Determine the initial direction of integration, unless it is that of the trace being resumed
+        if (!resumed) {
             const auto step = (rhovec + extract_drhodt(get_dxdt(x0))*dt).eval();
             Eigen::ArrayX<bool> negativestepvals = (step < 0).eval();
             // Flip the sign if the first step would yield any negative concentrations
@@ -528,18 +826,25 @@ struct CriticalTracing {
             }
         }
         //store_drhodt(x0);
-        if (!filename.empty()) {
+        if (!filename.empty() && !resumed) {
             write_line();
         }
 
-        for (auto iter = 0; iter < options.max_step_count; ++iter) {
+        // The steps are numbered from the start of the trace, also when it is resumed
+        const int iter0 = Nsteps;
+        for (auto iter = iter0; iter < iter0 + options.max_step_count; ++iter) {
             
             // Calculate the derivatives at the beginning of the step
             auto dxdt_start_step = get_dxdt(x0);
             auto x_start_step = x0;
 
-            if (iter == 0 && retry_count == 0) { 
-                store_point(); }
+            if (iter == 0 && retry_count == 0 && !resumed) { 
+                store_point();
+                if (options.step_callback && !options.step_callback(JSONdata.back())) {
+                    stopped_by_callback = true;
+                    break;
+                }
+            }
             
             if (options.integration_order == 5) {
                 auto res = controlled_step_result::fail;
@@ -557,6 +862,7 @@ struct CriticalTracing {
                     // Try again, with a smaller step size
                     iter--;
                     retry_count++;
+                    tel.num_rejected++;
                     continue;
                 }
                 else {
@@ -615,7 +921,9 @@ struct CriticalTracing {
                 },
             };
             
+            tel.num_iter++;
             if (options.polish) {
+                tel.num_polish++;
                 bool polish_ok = false;
                 for (auto &polisher : polishers){
                     try {
@@ -645,6 +953,7 @@ struct CriticalTracing {
                     }
                 }
                 if (!polish_ok){
+                    tel.num_polish_failed++;
                     if (options.polish_exception_on_fail){
                         throw IterationFailure("Polishing was not successful");
                     }
@@ -687,7 +996,15 @@ struct CriticalTracing {
             }
 
             if (!filename.empty()) { write_line(); }
+            Nsteps = iter + 1;
             store_point();
+            if (options.step_callback && !options.step_callback(JSONdata.back())) {
+                if (options.verbosity > 10){
+                    std::cout << "Termination because the step callback returned false" << std::endl;
+                }
+                stopped_by_callback = true;
+                break;
+            }
 
             if (counter_T_converged > options.small_T_count) {
                 if (options.verbosity > 10){
@@ -698,7 +1015,7 @@ struct CriticalTracing {
         }
         // If the last step crosses a zero concentration, see if it corresponds to a pure fluid
         // and if so, iterate to find the pure fluid endpoint
-        if (options.pure_endpoint_polish) {
+        if (options.pure_endpoint_polish && !stopped_by_callback) {
             // Simple Euler step t
             auto dxdt = get_dxdt(x0);
             auto drhodt = extract_drhodt(dxdt);
@@ -756,7 +1073,8 @@ struct CriticalTracing {
     X(critical_polish_fixedmolefrac)  \
     X(get_drhovec_dT_crit) \
     X(get_derivs) \
-    X(eigen_problem)
+    X(eigen_problem) \
+    X(eigen_problem_incremental)
 
 #define X(f) template <typename TemplatedModel, typename ...Params, \
 typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, TemplatedModel>::value>::type> \
@@ -1,5 +1,10 @@
 # pragma once
 
+#include <functional>
+#include <optional>
+#include "nlohmann/json.hpp"
+#include "teqp/algorithms/VLE_types.hpp"
+
 namespace teqp {
 
 struct TCABOptions {
@@ -22,6 +27,11 @@ struct TCABOptions {
     int verbosity = 0; ///< The greater the verbosity, the more output you will get, especially about polishing failures
     bool polish_exception_on_fail = false; ///< If true, when polishing fails, throw an exception, otherwise, terminate tracing
     bool pure_endpoint_polish = false; ///< If true, if the last step crossed into negative concentrations, try to interpolate to find the pure fluid endpoint hiding in the data
+    std::function<bool(const nlohmann::json&)> step_callback; ///< If set, called with each point as it is stored, between the steps of the integrator; return false to stop the tracing
+    bool telemetry = false; ///< If true, each point has the SolverTelemetry of the trace so far as "telemetry"; the Hessians are not counted
+    bool checkpoint = false; ///< If true, each point has its TraceCheckpoint as "checkpoint"
+    std::optional<TraceCheckpoint> resume; ///< If set, the trace continues after this checkpoint, and T0, rhovec0, init_c and init_dt are not used; max_step_count counts the new steps only
+    std::optional<PredictorCorrectorOptions> predictor_corrector; ///< If set, the steps are taken by teqp::continuation::PseudoArclength rather than by odeint, and integration_order, abs_err, rel_err, polish and skip_dircheck_count are not used
 };
 
 struct EigenData {
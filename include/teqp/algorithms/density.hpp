@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "teqp/derivs.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/density_types.hpp"
+
+namespace teqp{
+namespace density{
+
+namespace internal{
+
+    /// Detect whether the model gives all its densities at T and p in closed form, as do the cubic models from the roots of the cubic equation
+    template<typename T, typename = void>
+    struct has_rho_Tp_roots : std::false_type {};
+    template<typename T>
+    struct has_rho_Tp_roots<T, std::void_t<decltype(std::declval<const T&>().get_rho_Tp_roots(std::declval<double>(), std::declval<double>(), std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
+    /// Detect whether the model provides initial densities for the Newton steps, as does CPA from the roots of its cubic part
+    template<typename T, typename = void>
+    struct has_rho_Tp_seeds : std::false_type {};
+    template<typename T>
+    struct has_rho_Tp_seeds<T, std::void_t<decltype(std::declval<const T&>().get_rho_Tp_seeds(std::declval<double>(), std::declval<double>(), std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
+    /// The molar Gibbs energy divided by RT, up to a function of T; it ranks densities at the same T, p and composition
+    template<typename Model, typename VecType>
+    double get_gRT(const Model& model, const double T, const double p, const double rho, const VecType& z){
+        return model.alphar(T, rho, z) + p/(rho*model.R(z)*T) + log(rho);
+    }
+
+    /// Pick the root for the phase among the densities, in increasing order; NaN if there are none
+    template<typename Model, typename VecType>
+    double select_root(const Model& model, const double T, const double p, const VecType& z, const std::vector<double>& rhos, const RhoPhase phase){
+        if (rhos.empty()){
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        switch(phase){
+            case RhoPhase::liquid: return rhos.back();
+            case RhoPhase::vapor: return rhos.front();
+            default:{
+                double best = rhos.front(), gbest = get_gRT(model, T, p, best, z);
+                for (auto i = 1U; i < rhos.size(); ++i){
+                    double g = get_gRT(model, T, p, rhos[i], z);
+                    if (g < gbest){ best = rhos[i]; gbest = g; }
+                }
+                return best;
+            }
+        }
+    }
+}
+
+/**
+ Newton's method for the density at which the model gives the pressure p, starting from rho. The steps are limited to a
+ doubling or a halving of the density; a step that ends where the pressure does not increase with density is halved.
+ \returns The density, or NaN if the steps did not converge
+ */
+template<typename Model, typename VecType>
+double solve_rho_Tp_Newton(const Model& model, const double T, const double p, const VecType& z, double rho, const RhoTpOptions& opt = {}){
+    using tdx = TDXDerivatives<Model, double, VecType>;
+    const double RT = model.R(z)*T;
+    double step = 0;
+    for (auto iter = 0; iter < opt.maxiter; ++iter){
+        auto Ar = tdx::template get_Ar0n<2>(model, T, rho, z);
+        const double pcalc = rho*RT*(1 + Ar[1]), dpdrho = RT*(1 + 2*Ar[1] + Ar[2]);
+        if (!std::isfinite(pcalc) || !(dpdrho > 0)){
+            if (step == 0){
+                break;
+            }
+            // Go back halfway along the last step
+            step /= 2;
+            rho -= step;
+            continue;
+        }
+        step = std::clamp(-(pcalc - p)/dpdrho, -rho/2, rho);
+        rho += step;
+        if (std::abs(step) < opt.reltol*rho){
+            return rho;
+        }
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+/**
+ \brief The molar density of the model at the temperature T, the pressure p and the mole fractions z
+
+ Models that give all their densities in closed form (the cubics, from the roots of the cubic equation) have the root
+ for the phase picked among them as in the Newton path. Otherwise, Newton's method is started from
+ opt.rho_guess if it is given, else from the seeds of the model (for CPA, the roots of its cubic part), else from the
+ ideal-gas density; the last gives the vapor-like root, so liquid roots of such models need a guess, for instance from
+ a superancillary equation.
+ \returns The density, or NaN if no root was found
+ */
+template<typename Model, typename VecType>
+double solve_rho_Tp(const Model& model, const double T, const double p, const VecType& z, const RhoPhase phase, const RhoTpOptions& opt = {}){
+    if constexpr (internal::has_rho_Tp_roots<Model>::value){
+        return internal::select_root(model, T, p, z, model.get_rho_Tp_roots(T, p, z), phase);
+    }
+    else{
+        std::vector<double> seeds;
+        if (std::isfinite(opt.rho_guess)){
+            seeds.push_back(opt.rho_guess);
+        }
+        else{
+            if constexpr (internal::has_rho_Tp_seeds<Model>::value){
+                seeds = model.get_rho_Tp_seeds(T, p, z);
+            }
+            if (seeds.empty()){
+                seeds.push_back(p/(model.R(z)*T));
+            }
+        }
+        if (phase == RhoPhase::liquid){
+            seeds = {seeds.back()};
+        }
+        else if (phase == RhoPhase::vapor){
+            seeds = {seeds.front()};
+        }
+        std::vector<double> rhos;
+        for (auto rho0 : seeds){
+            double rho = solve_rho_Tp_Newton(model, T, p, z, rho0, opt);
+            if (std::isfinite(rho) && std::none_of(rhos.begin(), rhos.end(), [&](double r){ return std::abs(r - rho) < 1e-8*rho; })){
+                rhos.push_back(rho);
+            }
+        }
+        std::sort(rhos.begin(), rhos.end());
+        return internal::select_root(model, T, p, z, rhos, phase);
+    }
+}
+
+}
+}
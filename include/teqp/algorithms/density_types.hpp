@@ -0,0 +1,22 @@
+#pragma once
+
+#include <limits>
+
+namespace teqp{
+namespace density{
+
+/// Which root of p(T, rho) = p is wanted when there are several
+enum class RhoPhase {
+    liquid, ///< The largest density
+    vapor, ///< The smallest density
+    stable ///< The density with the lowest Gibbs energy
+};
+
+struct RhoTpOptions {
+    int maxiter = 50; ///< The maximum number of Newton steps from each initial density
+    double reltol = 1e-13; ///< Convergence of the Newton steps, on the relative step in density
+    double rho_guess = std::numeric_limits<double>::quiet_NaN(); ///< The initial density of the Newton steps, for instance from a superancillary equation; if not given, the model's own seeds or the ideal-gas density are used. Not used by models with closed-form roots
+};
+
+}
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/flash_types.hpp"
+#include "teqp/algorithms/VLE.hpp"
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+
+namespace teqp {
+namespace flash {
+
+    using namespace teqp::cppinterface;
+
+    namespace internal {
+
+        /// The pressure and its derivative with respect to density at constant composition
+        inline auto get_p_dpdrho(const AbstractModel& model, const double T, const double rho, const Eigen::ArrayXd& x, const double RT) {
+            auto Ar0n = model.get_Ar02n(T, rho, x);
+            return std::make_tuple(rho * RT * (1 + Ar0n[1]), RT * (1 + 2 * Ar0n[1] + Ar0n[2]));
+        }
+
+        /// Newton's method for the density at the specified pressure, from a nearby guess; the density may change by at most a factor of two per step
+        inline std::optional<double> solve_density_Newton(const AbstractModel& model, const double T, const double p, const Eigen::ArrayXd& x, const double RT, double rho) {
+            for (auto i = 0; i < 50; ++i) {
+                auto [pval, dpdrho] = get_p_dpdrho(model, T, rho, x, RT);
+                if (!std::isfinite(pval) || !(dpdrho > 0)) {
+                    return std::nullopt;
+                }
+                double drho = std::clamp(-(pval - p) / dpdrho, -rho / 2, rho);
+                rho += drho;
+                if (std::abs(drho) < 1e-13 * rho) {
+                    return rho;
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * The smallest (vapor-like) and the largest (liquid-like) densities at which the pressure equals p. The roots are bracketed
+         * by marching up in density from below the density of the ideal gas, until the compressibility factor becomes large on a
+         * mechanically stable branch, and then refined with bisection and Newton's method. NaN is returned if no root was found.
+         */
+        inline auto get_density_roots(const AbstractModel& model, const double T, const double p, const Eigen::ArrayXd& x, const double RT) {
+            std::vector<std::tuple<double, double>> brackets;
+            double rho = p / RT / 10;
+            double fprev = std::get<0>(get_p_dpdrho(model, T, rho, x, RT)) - p;
+            for (auto i = 0; i < 1000; ++i) {
+                double rhonew = rho * 1.2;
+                auto [pval, dpdrho] = get_p_dpdrho(model, T, rhonew, x, RT);
+                if (!std::isfinite(pval)) {
+                    break;
+                }
+                double f = pval - p;
+                if (fprev < 0 && f >= 0) {
+                    brackets.emplace_back(rho, rhonew);
+                }
+                if (pval / (rhonew * RT) > 100 && dpdrho > 0) {
+                    break;
+                }
+                rho = rhonew;
+                fprev = f;
+            }
+            auto refine = [&](const std::tuple<double, double>& bracket) {
+                auto [lo, hi] = bracket;
+                for (auto i = 0; i < 60 && hi - lo > 1e-8 * hi; ++i) {
+                    double mid = (lo + hi) / 2;
+                    if (std::get<0>(get_p_dpdrho(model, T, mid, x, RT)) < p) { lo = mid; } else { hi = mid; }
+                }
+                return solve_density_Newton(model, T, p, x, RT, (lo + hi) / 2).value_or((lo + hi) / 2);
+            };
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            if (brackets.empty()) {
+                return std::make_tuple(nan, nan);
+            }
+            return std::make_tuple(refine(brackets.front()), refine(brackets.back()));
+        }
+
+        /// The vapor fraction from the Rachford-Rice equation, anywhere between its asymptotes (negative flash); no value if the K-factors are all on the same side of one
+        inline std::optional<double> solve_Rachford_Rice(const Eigen::ArrayXd& z, const Eigen::ArrayXd& K) {
+            if (!(K.maxCoeff() > 1 && K.minCoeff() < 1)) {
+                return std::nullopt;
+            }
+            double lo = 1 / (1 - K.maxCoeff()), hi = 1 / (1 - K.minCoeff());
+            double beta = std::clamp(0.5, lo + 1e-10 * (hi - lo), hi - 1e-10 * (hi - lo));
+            for (auto i = 0; i < 100; ++i) {
+                Eigen::ArrayXd den = 1 + beta * (K - 1);
+                double g = (z * (K - 1) / den).sum();
+                double dgdbeta = -(z * (K - 1).square() / den.square()).sum();
+                // g is monotonically decreasing in beta
+                if (g > 0) { lo = beta; } else { hi = beta; }
+                double betanew = beta - g / dgdbeta;
+                if (!(betanew > lo && betanew < hi)) {
+                    betanew = (lo + hi) / 2;
+                }
+                if (std::abs(betanew - beta) < 1e-15 || hi - lo < 1e-15) {
+                    return betanew;
+                }
+                beta = betanew;
+            }
+            return beta;
+        }
+    }
+
+    /***
+    * \brief Isothermal-isobaric flash of a mixture into a liquid and a vapor phase
+    *
+    * The K-factors are initialized with Wilson's correlation and iterated by successive substitution, with the
+    * Rachford-Rice equation solved for the vapor fraction at each step (allowing for negative flashes), and the densities
+    * of the phases obtained at the specified pressure. Every few steps, the step is accelerated with the general dominant
+    * eigenvalue method (GDEM) of Crowe and Nishio, as recommended by Michelsen. For binary mixtures, once the K-factors are
+    * nearly converged, the phase compositions are polished with Newton's method in mix_VLE_Tp; the Newton stage is not
+    * available for more components, for which successive substitution is carried on to convergence.
+    *
+    * \param model The model to operate on
+    * \param T Temperature
+    * \param p Pressure
+    * \param z Mole fractions of the feed
+    * \param Tc Critical temperatures of the components, for Wilson's correlation
+    * \param pc Critical pressures of the components, for Wilson's correlation
+    * \param acentric Acentric factors of the components, for Wilson's correlation
+    * \param options Options for the flash
+    */
+    inline auto PT_flash(const AbstractModel& model, const double T, const double p, const Eigen::ArrayXd& z, const Eigen::ArrayXd& Tc, const Eigen::ArrayXd& pc, const Eigen::ArrayXd& acentric, const std::optional<PTFlashOptions>& options = std::nullopt) {
+        auto opt = options.value_or(PTFlashOptions{});
+        const auto N = z.size();
+        if (Tc.size() != N || pc.size() != N || acentric.size() != N) {
+            throw InvalidArgument("The critical parameters must have one entry per component");
+        }
+        if (!(p > 0)) {
+            throw InvalidArgument("The pressure must be positive in PT_flash");
+        }
+        const double RT = model.get_R(z) * T;
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+
+        PTFlashResult res;
+        Eigen::ArrayXd lnK = log(pc / p) + 5.373 * (1 + acentric) * (1 - Tc / T);
+        double rhoL = nan, rhoV = nan, beta = nan;
+        bool Newton_enabled = (N == 2 && opt.Newton_switch_tol > 0);
+        std::vector<Eigen::ArrayXd> deltas; // The last three changes in ln(K), for the acceleration
+
+        auto get_density = [&](const Eigen::ArrayXd& x, const double guess, const bool liquid) {
+            if (std::isfinite(guess)) {
+                auto rho = internal::solve_density_Newton(model, T, p, x, RT, guess);
+                if (rho) {
+                    return rho.value();
+                }
+            }
+            auto [rhoVroot, rhoLroot] = internal::get_density_roots(model, T, p, x, RT);
+            return (liquid) ? rhoLroot : rhoVroot;
+        };
+
+        for (auto iter = 0; iter < opt.max_SS_iter; ++iter) {
+            Eigen::ArrayXd K = exp(lnK);
+            auto betaRR = internal::solve_Rachford_Rice(z, K);
+            if (!betaRR) {
+                res.success = true;
+                res.message = "The K-factors are all on the same side of one; one phase";
+                return res;
+            }
+            beta = betaRR.value();
+            res.x = z / (1 + beta * (K - 1));
+            res.y = K * res.x;
+            res.x /= res.x.sum();
+            res.y /= res.y.sum();
+
+            rhoL = get_density(res.x, rhoL, true);
+            rhoV = get_density(res.y, rhoV, false);
+            if (!std::isfinite(rhoL) || !std::isfinite(rhoV)) {
+                res.message = "No density could be found for one of the phases";
+                return res;
+            }
+            res.rhovecL = res.x * rhoL;
+            res.rhovecV = res.y * rhoV;
+
+            Eigen::ArrayXd lnKnew = log(model.get_fugacity_coefficients(T, res.rhovecL)) - log(model.get_fugacity_coefficients(T, res.rhovecV));
+            Eigen::ArrayXd delta = lnKnew - lnK;
+            lnK = lnKnew;
+            res.num_SS++;
+            double err = delta.abs().maxCoeff();
+
+            if (lnK.abs().maxCoeff() < opt.trivial_tol) {
+                res.success = true;
+                res.message = "Trivial solution; one phase";
+                return res;
+            }
+            if (err < opt.lnK_tol) {
+                res.success = true;
+                break;
+            }
+
+            // Polish with Newton's method in the isochoric formalism for binary mixtures
+            if (Newton_enabled && err < opt.Newton_switch_tol && beta > 0 && beta < 1) {
+                auto r = mix_VLE_Tp(model, T, p, res.rhovecL, res.rhovecV);
+                res.num_Newton += r.num_iter + 1;
+                if (r.r.cwiseAbs().maxCoeff() < 1e-8 && (r.rhovecL > 0).all() && (r.rhovecV > 0).all()) {
+                    res.rhovecL = r.rhovecL;
+                    res.rhovecV = r.rhovecV;
+                    res.x = r.rhovecL / r.rhovecL.sum();
+                    res.y = r.rhovecV / r.rhovecV.sum();
+                    beta = (z(0) - res.x(0)) / (res.y(0) - res.x(0));
+                    res.success = true;
+                    break;
+                }
+                Newton_enabled = false;
+            }
+
+            // General dominant eigenvalue method; the changes are assumed to follow
+            // delta_n + mu1*delta_(n-1) + mu2*delta_(n-2) = 0, and the remaining changes are summed up
+            deltas.push_back(delta);
+            if (deltas.size() > 3) {
+                deltas.erase(deltas.begin());
+            }
+            if (opt.accel_every > 0 && res.num_SS % opt.accel_every == 0 && deltas.size() == 3) {
+                const auto& d0 = deltas[2], & d1 = deltas[1], & d2 = deltas[0];
+                double b01 = (d0 * d1).sum(), b02 = (d0 * d2).sum(), b11 = (d1 * d1).sum(), b12 = (d1 * d2).sum(), b22 = (d2 * d2).sum();
+                double det = b11 * b22 - b12 * b12;
+                double mu1 = (b02 * b12 - b01 * b22) / det, mu2 = (b01 * b12 - b02 * b11) / det;
+                double den = 1 + mu1 + mu2;
+                if (det > 1e-14 * b11 * b22 && std::abs(den) > 1e-10) {
+                    Eigen::ArrayXd step = -((mu1 + mu2) * d0 + mu2 * d1) / den;
+                    if (step.isFinite().all()) {
+                        lnK += step;
+                        res.num_accel++;
+                    }
+                }
+                deltas.clear();
+            }
+            if (iter == opt.max_SS_iter - 1) {
+                res.message = "Maximum number of iterations reached";
+            }
+        }
+        res.beta = beta;
+        res.two_phase = res.success && beta > 0 && beta < 1;
+        if (res.success && res.message.empty()) {
+            res.message = (res.two_phase) ? "Two phases" : "Negative flash; one phase";
+        }
+        return res;
+    }
+
+#define FLASH_FUNCTIONS_TO_WRAP \
+    X(PT_flash)
+
+#define X(f) template <typename TemplatedModel, typename ...Params, \
+typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, TemplatedModel>::value>::type> \
+inline auto f(const TemplatedModel& model, Params&&... params){ \
+    auto view = teqp::cppinterface::adapter::make_cview(model); \
+    const AbstractModel& am = *view.get(); \
+    return f(am, std::forward<Params>(params)...); \
+}
+    FLASH_FUNCTIONS_TO_WRAP
+#undef X
+#undef FLASH_FUNCTIONS_TO_WRAP
+
+}
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/flash_types.hpp"
+#include "teqp/algorithms/iteration.hpp"
+#include "teqp/algorithms/superancillary_pure.hpp"
+
+namespace teqp {
+namespace flash {
+
+    using namespace teqp::cppinterface;
+
+    /// A saturation source from generated superancillary equations; sa must outlive the source
+    inline PureSaturationSource make_saturation_source(const superancillary::PureSuperAncillary& sa) {
+        return { [&sa](double T) { auto rhos = sa.get_rhoLrhoV(T); return std::make_tuple(rhos[0], rhos[1]); }, sa.Tmin, sa.Tmax };
+    }
+
+    /// A saturation source from a lazily built cache of superancillary equations; cache must outlive the source
+    inline PureSaturationSource make_saturation_source(superancillary::PureSaturationCache& cache) {
+        auto [Tmin, Tmax] = cache.get_Trange();
+        return { [&cache](double T) { auto rhos = cache.get_rhoLrhoV(T); return std::make_tuple(rhos[0], rhos[1]); }, Tmin, Tmax };
+    }
+
+    /// A saturation source from the superancillary equations of a pure cubic model (see superanc_rhoLV); cubic must outlive the source
+    template<typename Cubic>
+    PureSaturationSource make_cubic_saturation_source(const Cubic& cubic, const double Tmin, const double Tmax) {
+        return { [&cubic](double T) { auto [rhoL, rhoV] = cubic.superanc_rhoLV(T); return std::make_tuple(static_cast<double>(rhoL), static_cast<double>(rhoV)); }, Tmin, Tmax };
+    }
+
+    namespace internal {
+
+        /// The Illinois variant of regula falsi for the root of f in [a,b], with f(a) and f(b) of opposite signs
+        template<typename Function>
+        double solve_Illinois(const Function& f, double a, double b, double fa, double fb, const double reltol, const int maxiter) {
+            double x = a, xold = b;
+            int side = 0;
+            for (auto i = 0; i < maxiter; ++i) {
+                x = (a*fb - b*fa)/(fb - fa);
+                double fx = f(x);
+                if (fx == 0 || std::abs(x - xold) < reltol*std::abs(x) || std::abs(b - a) < reltol*std::abs(x)) {
+                    return x;
+                }
+                if (fx*fb > 0) {
+                    b = x; fb = fx;
+                    if (side == -1) { fa /= 2; }
+                    side = -1;
+                }
+                else {
+                    a = x; fa = fx;
+                    if (side == +1) { fb /= 2; }
+                    side = +1;
+                }
+                xold = x;
+            }
+            return x;
+        }
+    }
+
+    /***
+    * \brief Flash of a pure fluid, from a pressure or a molar density and an enthalpy, entropy or internal energy
+    *
+    * The saturation source gives the saturated densities as a function of temperature; usually these are superancillary equations,
+    * so no phase equilibrium needs to be solved with the model. For a specified pressure, the saturation temperature is found with
+    * regula falsi in ln(p) vs. 1/T; for a specified density, the temperature at which the density is on the saturation curve bounds
+    * the two-phase states, whose temperature is obtained from the lever rule along the saturation curve. Single-phase states are
+    * solved with the Newton steps of NRIterator, starting from the saturated state on the same side of the saturation curve, which
+    * normally takes a few steps; the steps are limited so that T and rho change by at most 25% each.
+    *
+    * \param ar The residual model
+    * \param aig The ideal-gas model
+    * \param vars The two variables specified, one of 'P' or 'D' and one of 'H', 'S' or 'U', in either order
+    * \param vals The values of the variables, in the order of vars
+    * \param sat The source of the saturated densities
+    * \param options Options for the flash
+    */
+    inline auto pure_flash(const std::shared_ptr<AbstractModel>& ar, const std::shared_ptr<AbstractModel>& aig, const std::vector<char>& vars, const Eigen::Ref<const Eigen::ArrayXd>& vals, const PureSaturationSource& sat, const std::optional<PureFlashOptions>& options = std::nullopt) {
+        auto opt = options.value_or(PureFlashOptions{});
+        if (vars.size() != 2 || vals.size() != 2) {
+            throw InvalidArgument("Two variables and two values must be provided to pure_flash");
+        }
+        const int ifixed = (vars[0] == 'P' || vars[0] == 'D') ? 0 : 1, iother = 1 - ifixed;
+        const char fixed = vars[ifixed], other = vars[iother];
+        if (!(fixed == 'P' || fixed == 'D') || !(other == 'H' || other == 'S' || other == 'U')) {
+            throw InvalidArgument("The variables of pure_flash must be one of 'P' or 'D' and one of 'H', 'S' or 'U'");
+        }
+        const double fixedval = vals(ifixed), aval = vals(iother);
+        if (!(fixedval > 0)) {
+            throw InvalidArgument("The pressure or density must be positive in pure_flash");
+        }
+        const auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+        const double R = ar->get_R(z);
+        const double Tmin = sat.Tmin, Tmax = sat.Tmax;
+        const auto build_Jv = get_iteration_Jv_function({other, fixed});
+        iteration::NRIterator nr(ar, aig, vars, vals, Tmin, fixedval, z);
+
+        PureFlashResult res;
+        auto get_sat = [&](double T) { res.num_sat++; return sat.get_rhoLrhoV(T); };
+        // The energy-like variable at a state
+        auto get_a = [&](double T, double rho) { return build_Jv(ar->get_deriv_mat2(T, rho, z), aig->get_deriv_mat2(T, rho, z), R, T, rho).v(0); };
+        auto two_phase = [&](double T, double rho, double rhoL, double rhoV, double q) {
+            res.success = true; res.two_phase = true;
+            res.T = T; res.rho = rho; res.rhoL = rhoL; res.rhoV = rhoV; res.q = q;
+            res.message = "Two phases";
+            return res;
+        };
+        auto single_phase = [&](double T, double rho) {
+            for (auto iter = 0; iter < opt.maxiter; ++iter) {
+                auto [dx, im] = nr.calc_step(T, rho);
+                res.num_Newton++;
+                if (!dx.allFinite()) {
+                    res.message = "The Newton step is not finite";
+                    return res;
+                }
+                double dT = std::clamp(dx(0), -T/4, T/4), drho = std::clamp(dx(1), -rho/4, rho/4);
+                T += dT;
+                rho += drho;
+                if (std::abs(dT) < opt.reltol*T && std::abs(drho) < opt.reltol*rho) {
+                    res.success = true;
+                    res.T = T; res.rho = rho;
+                    res.message = "One phase";
+                    return res;
+                }
+            }
+            res.T = T; res.rho = rho;
+            res.message = "Maximum number of Newton steps reached";
+            return res;
+        };
+        auto guess_or = [&](double T, double rho) {
+            return (std::isfinite(opt.T_guess) && std::isfinite(opt.rho_guess)) ? single_phase(opt.T_guess, opt.rho_guess) : single_phase(T, rho);
+        };
+
+        if (fixed == 'P') {
+            const double p = fixedval;
+            auto get_psat = [&](double T) {
+                auto [rhoL, rhoV] = get_sat(T);
+                return rhoV*R*T*(1.0 + ar->get_Ar01(T, rhoV, z));
+            };
+            const double pmin = get_psat(Tmin), pmax = get_psat(Tmax);
+            if (p < pmin) {
+                return guess_or(Tmin, p/(R*Tmin));
+            }
+            if (p > pmax) {
+                // Above the end of the saturation curve; start on the vapor side of its end, or from the saturated liquid with the same energy-like variable
+                if (std::isfinite(opt.T_guess) && std::isfinite(opt.rho_guess)) {
+                    return single_phase(opt.T_guess, opt.rho_guess);
+                }
+                auto [rhoLmax, rhoVmax] = get_sat(Tmax);
+                const double aLmax = get_a(Tmax, rhoLmax);
+                if (aval >= aLmax) {
+                    return single_phase(Tmax, rhoVmax);
+                }
+                auto get_aL = [&](double T) { return get_a(T, std::get<0>(get_sat(T))); };
+                const double aLmin = get_aL(Tmin);
+                if (aval <= aLmin) {
+                    return single_phase(Tmin, std::get<0>(get_sat(Tmin)));
+                }
+                double T0 = internal::solve_Illinois([&](double T) { return get_aL(T) - aval; }, Tmin, Tmax, aLmin - aval, aLmax - aval, 1e-6, opt.max_bracket_iter);
+                return single_phase(T0, std::get<0>(get_sat(T0)));
+            }
+            // ln(p) is nearly linear in 1/T along the saturation curve
+            auto f = [&](double Trecip) { return log(get_psat(1/Trecip)/p); };
+            double Tsat = 1/internal::solve_Illinois(f, 1/Tmax, 1/Tmin, log(pmax/p), log(pmin/p), 1e-14, opt.max_bracket_iter);
+            auto [rhoL, rhoV] = get_sat(Tsat);
+            double aL = get_a(Tsat, rhoL), aV = get_a(Tsat, rhoV);
+            if (aval < aL) {
+                return single_phase(Tsat, rhoL);
+            }
+            if (aval > aV) {
+                return single_phase(Tsat, rhoV);
+            }
+            double q = (aval - aL)/(aV - aL);
+            return two_phase(Tsat, 1/(q/rhoV + (1 - q)/rhoL), rhoL, rhoV, q);
+        }
+        else {
+            const double rho = fixedval;
+            auto [rhoLmin, rhoVmin] = get_sat(Tmin);
+            auto [rhoLmax, rhoVmax] = get_sat(Tmax);
+            // The temperature at which the density is on the saturation curve
+            double Tb;
+            if (rho >= rhoVmin && rho <= rhoVmax) {
+                auto f = [&](double Trecip) { return log(std::get<1>(get_sat(1/Trecip))/rho); };
+                Tb = 1/internal::solve_Illinois(f, 1/Tmax, 1/Tmin, log(rhoVmax/rho), log(rhoVmin/rho), 1e-14, opt.max_bracket_iter);
+            }
+            else if (rho <= rhoLmin && rho >= rhoLmax) {
+                auto f = [&](double T) { return std::get<0>(get_sat(T)) - rho; };
+                Tb = internal::solve_Illinois(f, Tmin, Tmax, rhoLmin - rho, rhoLmax - rho, 1e-14, opt.max_bracket_iter);
+            }
+            else if (rho > rhoVmax && rho < rhoLmax) {
+                Tb = Tmax; // The saturation curve is reached above Tmax, close to the critical point
+            }
+            else {
+                return guess_or(Tmin, rho);
+            }
+            // Along the saturation curve, the energy-like variable of the two-phase state from the lever rule increases with T
+            auto get_amix = [&](double T) {
+                auto [rhoL, rhoV] = get_sat(T);
+                double q = (1/rho - 1/rhoL)/(1/rhoV - 1/rhoL);
+                return std::make_tuple(get_a(T, rhoL)*(1 - q) + get_a(T, rhoV)*q, rhoL, rhoV, q);
+            };
+            double fb = std::get<0>(get_amix(Tb)) - aval;
+            if (fb <= 0) {
+                return single_phase(Tb, rho);
+            }
+            double fa = std::get<0>(get_amix(Tmin)) - aval;
+            if (fa > 0) {
+                res.message = "The state is two-phase below the minimum temperature of the saturation source";
+                return res;
+            }
+            double T = internal::solve_Illinois([&](double T) { return std::get<0>(get_amix(T)) - aval; }, Tmin, Tb, fa, fb, 1e-14, opt.max_bracket_iter);
+            auto [amix, rhoL, rhoV, q] = get_amix(T);
+            return two_phase(T, rho, rhoL, rhoV, q);
+        }
+    }
+
+}
+}
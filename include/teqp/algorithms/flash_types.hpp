@@ -0,0 +1,52 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <tuple>
+
+namespace teqp{
+namespace flash{
+
+struct PTFlashOptions {
+    int max_SS_iter = 100; ///< The maximum number of successive substitution steps
+    int accel_every = 5; ///< Every this many successive substitution steps, the step is accelerated with the general dominant eigenvalue method; 0 to disable
+    double lnK_tol = 1e-10; ///< Convergence of the successive substitution, on the largest change in the logarithms of the K-factors
+    double Newton_switch_tol = 1e-4; ///< For binary mixtures, switch to Newton's method in mix_VLE_Tp once the largest change in ln(K) is below this value; 0 to disable
+    double trivial_tol = 1e-4; ///< The solution is trivial (one phase) if the logarithms of the K-factors all fall below this value in magnitude
+};
+
+struct PTFlashResult {
+    bool success = false; ///< True if the iteration converged
+    bool two_phase = false; ///< True if the state splits into a liquid and a vapor phase
+    double beta = -1; ///< The molar fraction of the vapor phase; outside of [0,1] if the (negative) flash converged to a single phase
+    Eigen::ArrayXd x, y, rhovecL, rhovecV; ///< The mole fractions and molar concentrations of the liquid and vapor phases
+    int num_SS = 0, num_accel = 0, num_Newton = 0; ///< The number of successive substitution steps, of accelerated steps among them, and of Newton iterations
+    std::string message; ///< A description of the outcome
+};
+
+/// A source of the saturated liquid and vapor densities of a pure fluid, with which the pure-fluid flashes detect two-phase states
+struct PureSaturationSource {
+    std::function<std::tuple<double, double>(double)> get_rhoLrhoV; ///< The saturated liquid and vapor densities, in mol/m^3, at the temperature
+    double Tmin, Tmax; ///< The range of temperatures over which get_rhoLrhoV may be called; Tmax should be just below the critical temperature
+};
+
+struct PureFlashOptions {
+    int maxiter = 30; ///< The maximum number of Newton steps in the single-phase region
+    double reltol = 1e-12; ///< Convergence of the Newton steps, on the relative steps in T and rho
+    int max_bracket_iter = 100; ///< The maximum number of iterations of the one-dimensional solvers along the saturation curve
+    double T_guess = std::numeric_limits<double>::quiet_NaN(), rho_guess = std::numeric_limits<double>::quiet_NaN(); ///< Initial values for single-phase states outside of the range of the saturation source; if not given, they are taken from the end of the saturation curve
+};
+
+struct PureFlashResult {
+    bool success = false; ///< True if the flash converged
+    bool two_phase = false; ///< True if the state is inside the two-phase region
+    double T = -1, rho = -1; ///< The temperature and the overall molar density
+    double q = -1; ///< The molar vapor quality of a two-phase state, -1 otherwise
+    double rhoL = -1, rhoV = -1; ///< The densities of the saturated liquid and vapor of a two-phase state
+    int num_Newton = 0, num_sat = 0; ///< The number of Newton steps, and of evaluations along the saturation curve
+    std::string message; ///< A description of the outcome
+};
+
+}
+}
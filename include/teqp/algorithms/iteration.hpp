@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+
 #include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/exceptions.hpp"
 #include "teqp/cpp/derivs.hpp"
 
 namespace teqp {
@@ -10,6 +13,7 @@ using namespace cppinterface;
 /**
  A class for doing Newton-Raphson steps to solve for two unknown thermodynamic variables
  
+ The instantiation of build_iteration_Jv for the pair of variables is selected at construction, so the steps involve neither dispatch on the variables nor dynamic allocation
  */
 class NRIterator{
 private:
@@ -18,9 +22,14 @@ private:
     const Eigen::Ref<const Eigen::ArrayXd> vals;
     double T, rho;
     const Eigen::Ref<const Eigen::ArrayXd> z;
+    const IterationJvFunction build_Jv;
     
 public:
-    NRIterator(const std::shared_ptr<AbstractModel> &ar, const std::shared_ptr<AbstractModel> &aig, const std::vector<char>& vars, const Eigen::Ref<const Eigen::ArrayXd>& vals, double T, double rho, const Eigen::Ref<const Eigen::ArrayXd>& z) : ar(ar), aig(aig), vars(vars), vals(vals), T(T), rho(rho), z(z){}
+    NRIterator(const std::shared_ptr<AbstractModel> &ar, const std::shared_ptr<AbstractModel> &aig, const std::vector<char>& vars, const Eigen::Ref<const Eigen::ArrayXd>& vals, double T, double rho, const Eigen::Ref<const Eigen::ArrayXd>& z) : ar(ar), aig(aig), vars(vars), vals(vals), T(T), rho(rho), z(z), build_Jv(get_iteration_Jv_function(vars)){
+        if (vals.size() != 2){
+            throw teqp::InvalidArgument("Two values must be provided");
+        }
+    }
     
     /// Return the variables that are being used in the iteration
     std::vector<char> get_vars() const { return vars; }
@@ -42,8 +51,10 @@ public:
         auto Ar = ar->get_deriv_mat2(T, rho, z);
         auto Aig = aig->get_deriv_mat2(T, rho, z);
         auto R = ar->get_R(z);
-        auto im = build_iteration_Jv(vars, Ar, Aig, R, T, rho, z);
-        return std::make_tuple((im.J.matrix().colPivHouseholderQr().solve((-(im.v-vals)).matrix())).eval(), im);
+        auto im = build_Jv(Ar, Aig, R, T, rho);
+        // The closed-form inverse of the 2x2 Jacobian
+        Eigen::Vector2d dx = -(im.J.matrix().inverse()*(im.v - vals).matrix());
+        return std::make_tuple(dx, im);
     }
     
     /// Take one step, return the residuals
@@ -68,5 +79,142 @@ public:
 };
 
 
+/**
+ A class for doing Newton-Raphson steps to solve for two unknown thermodynamic variables at many states at once, all with the same mole fractions
+ 
+ The states are advanced in lockstep, and the model is called once per needed derivative for all the states still being iterated through the
+ batched get_Arxy_many method of the AbstractModel, so the virtual call is amortized over the states. The 2x2 linear systems are solved in closed form.
+ A state is removed from the iteration (its lane is masked out) once the relative steps in T and rho are both below the tolerance, or when the step is not finite.
+ */
+class NRIteratorMany{
+public:
+    /// The status of each state; active states are still being iterated
+    enum class status_t { active, converged, failed };
+private:
+    const std::shared_ptr<AbstractModel> ar, aig;
+    const std::vector<char> vars;
+    const Eigen::ArrayXXd vals;
+    Eigen::ArrayXd T, rho;
+    const Eigen::ArrayXd z;
+    const double R;
+    std::vector<status_t> status;
+    Eigen::Array<bool, 3, 3> needed_r, needed_ig;
+    Eigen::ArrayXXd molefrac; ///< The mole fractions replicated for each state, for the batched calls
+    IterationJvFunction build_Jv;
+    
+public:
+    /**
+     \param ar The residual model
+     \param aig The ideal-gas model
+     \param vars The two variables specified, allowed are 'H','S','U','P','T','D'
+     \param vals The target values of the variables, one row per state and one column per variable
+     \param T The initial temperatures
+     \param rho The initial molar densities
+     \param z The mole fractions, the same for all the states
+     */
+    NRIteratorMany(const std::shared_ptr<AbstractModel> &ar, const std::shared_ptr<AbstractModel> &aig, const std::vector<char>& vars, const Eigen::Ref<const Eigen::ArrayXXd>& vals, const Eigen::Ref<const Eigen::ArrayXd>& T, const Eigen::Ref<const Eigen::ArrayXd>& rho, const Eigen::Ref<const Eigen::ArrayXd>& z) : ar(ar), aig(aig), vars(vars), vals(vals), T(T), rho(rho), z(z), R(ar->get_R(z)), status(T.size(), status_t::active){
+        if (vars.size() != 2){
+            throw teqp::InvalidArgument("Two variables must be specified");
+        }
+        if (vals.cols() != 2 || vals.rows() != T.size() || rho.size() != T.size()){
+            throw teqp::InvalidArgument("vals must have one row per state and two columns, and T and rho must have one entry per state");
+        }
+        needed_r = Eigen::Array<bool, 3, 3>::Constant(false);
+        needed_ig = Eigen::Array<bool, 3, 3>::Constant(false);
+        for (auto var : vars){
+            auto [r, ig] = get_iteration_needed_derivs(var);
+            needed_r = needed_r || r;
+            needed_ig = needed_ig || ig;
+        }
+        molefrac = z.transpose().replicate(T.size(), 1);
+        build_Jv = get_iteration_Jv_function(vars);
+    }
+    
+    /// Return the variables that are being used in the iteration
+    std::vector<char> get_vars() const { return vars; }
+    /// Return the target values to be obtained
+    Eigen::ArrayXXd get_vals() const { return vals; }
+    /// Return the current temperatures
+    const Eigen::ArrayXd& get_T() const { return T; }
+    /// Return the current molar densities
+    const Eigen::ArrayXd& get_rho() const { return rho; }
+    /// Return the mole fractions
+    Eigen::ArrayXd get_molefrac() const { return z; }
+    /// Return the status of each state
+    const std::vector<status_t>& get_status() const { return status; }
+    /// Return the number of states that are still being iterated
+    auto get_num_active() const { return static_cast<int>(std::count(status.begin(), status.end(), status_t::active)); }
+    
+    /** Take one step for all the active states, and return the number of states that are still active after the step
+     * \param reltol A state is converged once the magnitudes of the relative steps in T and rho are both below this value
+     */
+    int take_step(double reltol = 1e-13){
+        std::vector<Eigen::Index> lanes;
+        for (auto i = 0; i < static_cast<Eigen::Index>(status.size()); ++i){
+            if (status[i] == status_t::active){ lanes.push_back(i); }
+        }
+        const auto Na = static_cast<Eigen::Index>(lanes.size());
+        if (Na == 0){
+            return 0;
+        }
+        // Gather the active states
+        Eigen::ArrayXd Ta(Na), rhoa(Na);
+        for (auto k = 0; k < Na; ++k){ Ta(k) = T(lanes[k]); rhoa(k) = rho(lanes[k]); }
+        auto Z = molefrac.topRows(Na);
+        
+        // One batched call per needed derivative
+        Eigen::ArrayXXd Arall = Eigen::ArrayXXd::Zero(Na, 9), Aigall = Eigen::ArrayXXd::Zero(Na, 9);
+        for (auto i = 0; i < 3; ++i){
+            for (auto j = 0; j < 3; ++j){
+                if (needed_r(i, j)){ Arall.col(i*3+j) = ar->get_Arxy_many(i, j, Ta, rhoa, Z); }
+                if (needed_ig(i, j)){ Aigall.col(i*3+j) = aig->get_Arxy_many(i, j, Ta, rhoa, Z); }
+            }
+        }
+        
+        Eigen::Array<double, 3, 3> Ar, Aig;
+        for (auto k = 0; k < Na; ++k){
+            for (auto i = 0; i < 3; ++i){
+                for (auto j = 0; j < 3; ++j){
+                    Ar(i, j) = Arall(k, i*3+j);
+                    Aig(i, j) = Aigall(k, i*3+j);
+                }
+            }
+            auto im = build_Jv(Ar, Aig, R, Ta(k), rhoa(k));
+            const auto& J = im.J;
+            const auto ilane = lanes[k];
+            double r0 = im.v(0) - vals(ilane, 0), r1 = im.v(1) - vals(ilane, 1);
+            double det = J(0,0)*J(1,1) - J(0,1)*J(1,0);
+            double dT = -(r0*J(1,1) - r1*J(0,1))/det;
+            double drho = -(J(0,0)*r1 - J(1,0)*r0)/det;
+            if (!std::isfinite(dT) || !std::isfinite(drho)){
+                status[ilane] = status_t::failed;
+                continue;
+            }
+            T(ilane) += dT;
+            rho(ilane) += drho;
+            if (std::abs(dT/T(ilane)) < reltol && std::abs(drho/rho(ilane)) < reltol){
+                status[ilane] = status_t::converged;
+            }
+        }
+        return get_num_active();
+    }
+    
+    /** Take steps until all the states are converged (or failed), or the maximum number of steps is reached; return the number of states still active
+     * \param maxsteps The maximum number of steps to take
+     * \param reltol See take_step
+     */
+    int take_steps(int maxsteps, double reltol = 1e-13){
+        if (maxsteps <= 0){
+            throw teqp::InvalidArgument("maxsteps must be greater than 0");
+        }
+        int Nactive = get_num_active();
+        for (auto i = 0; i < maxsteps && Nactive > 0; ++i){
+            Nactive = take_step(reltol);
+        }
+        return Nactive;
+    }
+};
+
+
 }
 }
@@ -0,0 +1,216 @@
+#pragma once
+
+/*
+Adaptive-precision versions of solve_pure_critical and mix_VLE_Tx, which iterate in double and only evaluate the residual (and
+the parts of the Jacobian that come with it) in an extended-precision type once the conditioning of the problem degrades.
+
+Close to a critical point the residuals of these solvers are small differences of large terms: dp/drho = RT(1 + 2Ar01 + Ar02)
+and d2p/drho2 for the pure fluid, and the differences of the chemical potentials and of the pressures of two nearly identical
+phases for the mixture.  In double precision they cannot get below the rounding error of the terms, so the Newton iterations
+stall on the noise, take more steps, and end further from the solution than the state variables could resolve.  The state
+variables and the linear algebra stay in double here; only the evaluation of the residual is escalated, so a solve that is well
+conditioned costs the same as in double.
+
+The extended-precision derivatives are taken with autodiff::Real in the extended type, so only models whose alphar accepts
+these number types can be used, and only the concrete (not the AbstractModel) models, as the AbstractModel interface is in double.
+*/
+
+#if !defined(TEQP_MULTIPRECISION_ENABLED)
+#error "TEQP_MULTIPRECISION_ENABLED must be turned on to use mixed_precision.hpp"
+#endif
+
+#include <cmath>
+#include <limits>
+#include <optional>
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#include "teqp/derivs.hpp"
+#include "teqp/algorithms/VLE.hpp"
+#include "teqp/algorithms/critical_pure.hpp"
+
+namespace teqp {
+
+/**
+ When to escalate to extended precision; once escalated, a solve stays escalated until it ends
+ */
+struct MixedPrecisionOptions {
+    double cond_threshold = 1e10; ///< Escalate when the estimated condition number of the Jacobian in double exceeds this value
+    double stall_ratio = 0.5; ///< Escalate when the norm of the residual in double is not reduced below stall_ratio times its previous value
+};
+
+namespace internal {
+
+    /// Whether the conditioning degraded, from the Jacobian and the norm of the residual in double and the norm of the previous residual
+    template<typename Matrix>
+    bool conditioning_degraded(const Matrix& J, double norm, double previous_norm, const MixedPrecisionOptions& opt) {
+        return J.partialPivLu().rcond() * opt.cond_threshold < 1 || norm > opt.stall_ratio * previous_norm;
+    }
+
+    /**
+     The value, gradient and Hessian of Psir = ar*rho w.r.t. the molar concentrations, with the arithmetic in Scalar.  The
+     derivatives are taken along directions in the concentrations with autodiff::Real<2, Scalar>: along each unit vector for the
+     gradient and the diagonal, and along the sum of two unit vectors for the off-diagonal terms, so N(N+1)/2 evaluations of the model
+     */
+    template<typename Scalar, typename Model>
+    auto build_Psir_fgradHessian_directional(const Model& model, const Scalar& T, const Eigen::Array<Scalar, Eigen::Dynamic, 1>& rhovec) {
+        using adtype = autodiff::Real<2, Scalar>;
+        const auto N = rhovec.size();
+        auto derivatives_along = [&](Eigen::Index i, Eigen::Index j) {
+            adtype s = 0.0;
+            auto f = [&](const adtype& s_) {
+                Eigen::Array<adtype, Eigen::Dynamic, 1> rhovec_(N);
+                for (auto k = 0; k < N; ++k) { rhovec_[k] = rhovec[k]; }
+                rhovec_[i] += s_;
+                if (j != i) { rhovec_[j] += s_; }
+                adtype rhotot = rhovec_.sum();
+                Eigen::Array<adtype, Eigen::Dynamic, 1> molefrac = rhovec_ / rhotot;
+                return adtype(model.alphar(T, rhotot, molefrac) * model.R(molefrac) * T * rhotot);
+            };
+            return derivatives(f, along(1), at(s));
+        };
+        Scalar Psir = 0;
+        Eigen::Array<Scalar, Eigen::Dynamic, 1> gradient(N);
+        Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> Hessian(N, N);
+        for (auto i = 0; i < N; ++i) {
+            auto ders = derivatives_along(i, i);
+            Psir = ders[0];
+            gradient[i] = ders[1];
+            Hessian(i, i) = ders[2];
+        }
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = i + 1; j < N; ++j) {
+                // The second derivative along e_i + e_j is H_ii + 2H_ij + H_jj
+                Scalar Hij = (derivatives_along(i, j)[2] - Hessian(i, i) - Hessian(j, j)) / 2;
+                Hessian(i, j) = Hij;
+                Hessian(j, i) = Hij;
+            }
+        }
+        return std::make_tuple(Psir, gradient, Hessian);
+    }
+
+    /**
+     The criticality conditions of a pure fluid (dp/drho and d2p/drho2) and their derivatives with respect to the density,
+     with the arithmetic in ExtFloat, at a state given in double; see get_pure_critical_conditions_Jacobian
+     */
+    template<typename ExtFloat, typename Model>
+    auto get_pure_critical_conditions_extended(const Model& model, const double T, const double rho, const Eigen::ArrayXd& z) {
+        using tdx = TDXDerivatives<Model, ExtFloat, Eigen::ArrayXd>;
+        const ExtFloat T_ = T, rho_ = rho, R = model.R(z);
+        auto ders = tdx::template get_Ar0n<4>(model, T_, rho_, z);
+        const ExtFloat dpdrho = R * T_ * (1 + 2 * ders[1] + ders[2]);
+        const ExtFloat d2pdrho2 = R * T_ / rho_ * (2 * ders[1] + 4 * ders[2] + ders[3]);
+        const ExtFloat d3pdrho3 = R * T_ / (rho_ * rho_) * (6 * ders[2] + 6 * ders[3] + ders[4]);
+        Eigen::Array2d resids, dresids_drho;
+        resids << static_cast<double>(dpdrho), static_cast<double>(d2pdrho2);
+        dresids_drho << static_cast<double>(d2pdrho2), static_cast<double>(d3pdrho3);
+        return std::make_tuple(resids, dresids_drho);
+    }
+}
+
+/**
+* \brief As solve_pure_critical, escalating the evaluation of the criticality conditions to ExtFloat when the conditioning degrades
+*
+* The Newton steps are taken in double from the criticality conditions and their Jacobian in double, until the Jacobian is
+* ill-conditioned or the scaled norm of the conditions stops decreasing (see MixedPrecisionOptions).  From then on the conditions
+* and their derivatives in density are evaluated in ExtFloat; the derivatives in temperature are kept in double, which only
+* affects the rate of convergence, not the solution.  The flags are those of solve_pure_critical.
+*/
+template<typename ExtFloat = boost::multiprecision::cpp_bin_float_50, typename Model,
+         typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, Model>::value>::type>
+auto solve_pure_critical_adaptive(const Model& model, const double T0, const double rho0, const std::optional<nlohmann::json>& flags = std::nullopt,
+    const MixedPrecisionOptions& opt = {}, SolverTelemetry* telemetry = nullptr)
+{
+    internal::TelemetryClock clock;
+    SolverTelemetry tel;
+    const auto [maxsteps, tol, alternative_pure_index, alternative_length] = internal::parse_pure_critical_flags(flags);
+    const Eigen::ArrayXd z = internal::get_pure_molefracs(alternative_pure_index, alternative_length);
+    const double R = model.R(z);
+    auto view_ = teqp::cppinterface::adapter::make_cview(model);
+
+    double T = T0, rho = rho0;
+    bool escalated = false;
+    double previous_norm = std::numeric_limits<double>::infinity();
+    for (auto counter = 0; counter < maxsteps; ++counter) {
+        auto [resids, J] = get_pure_critical_conditions_Jacobian(*view_, T, rho, alternative_pure_index, alternative_length);
+        tel.num_iter++;
+        if (!escalated) {
+            // The conditions scaled to be dimensionless
+            double norm = std::hypot(resids[0] / (R * T), resids[1] * rho / (R * T));
+            escalated = internal::conditioning_degraded(J, norm, previous_norm, opt);
+            previous_norm = norm;
+        }
+        if (escalated) {
+            auto [residsx, dresids_drho] = internal::get_pure_critical_conditions_extended<ExtFloat>(model, T, rho, z);
+            resids = residsx;
+            J(0, 1) = dresids_drho[0];
+            J(1, 1) = dresids_drho[1];
+            tel.num_escalated++;
+        }
+        // The 2x2 system is solved in closed form
+        auto det = J(0, 0)*J(1, 1) - J(0, 1)*J(1, 0);
+        auto dT = -(J(1, 1)*resids[0] - J(0, 1)*resids[1])/det;
+        auto drho = -(J(0, 0)*resids[1] - J(1, 0)*resids[0])/det;
+        T += dT;
+        rho += drho;
+        if (tol && std::abs(dT) < tol.value()*std::abs(T) && std::abs(drho) < tol.value()*std::abs(rho)){
+            break;
+        }
+    }
+    if (telemetry != nullptr) {
+        tel.elapsed_s = clock.elapsed_s();
+        *telemetry = tel;
+    }
+    return std::make_tuple(T, rho);
+}
+
+/**
+* \brief As mix_VLE_Tx, escalating the evaluation of the residual to ExtFloat when the conditioning degrades
+*
+* The iterations start in double, with the Hessians of the model, and the residual and the Jacobian are evaluated in ExtFloat
+* once the Jacobian is ill-conditioned or the norm of the residual is not reduced (see MixedPrecisionOptions).  The Newton
+* step is always solved in double.  The escalated evaluations take N(N+1)/2 evaluations of the model per phase in ExtFloat,
+* and are counted in num_escalated of the telemetry.  The other arguments are those of mix_VLE_Tx.
+*/
+template<typename ExtFloat = boost::multiprecision::cpp_bin_float_50, typename Model,
+         typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, Model>::value>::type>
+auto mix_VLE_Tx_adaptive(const Model& model, double T, const Eigen::ArrayXd& rhovecL0, const Eigen::ArrayXd& rhovecV0, const Eigen::ArrayXd& xspec,
+    double atol, double reltol, double axtol, double relxtol, int maxiter, const MixedPrecisionOptions& opt = {}, SolverTelemetry* telemetry = nullptr)
+{
+    using ExtArray = Eigen::Array<ExtFloat, Eigen::Dynamic, 1>;
+    const Eigen::Index N = rhovecL0.size();
+    auto view_ = teqp::cppinterface::adapter::make_cview(model);
+    const AbstractModel& am = *view_.get();
+    const double RT = am.get_R(xspec) * T;
+    const ExtFloat T_ = T, RT_ = ExtFloat(model.R(xspec)) * T_;
+
+    // Buffers re-used in each iteration to avoid heap allocations in double
+    double PsirL, PsirV;
+    Eigen::ArrayXd PsirgradL(N), PsirgradV(N);
+    Eigen::MatrixXd hessianL(N, N), hessianV(N, N);
+
+    bool escalated = false;
+    double previous_norm = std::numeric_limits<double>::infinity();
+    auto evaluate = [&](const auto& rhovecL, const auto& rhovecV, Eigen::MatrixXd& J, Eigen::MatrixXd& r, SolverTelemetry& tel) {
+        if (!escalated) {
+            am.build_Psir_fgradHessian_autodiff(T, rhovecL, PsirL, PsirgradL, hessianL);
+            am.build_Psir_fgradHessian_autodiff(T, rhovecV, PsirV, PsirgradV, hessianV);
+            tel.num_Hessian += 2;
+            internal::build_VLE_Tx_system(RT, rhovecL, rhovecV, xspec, PsirL, PsirgradL, hessianL, PsirV, PsirgradV, hessianV, J, r);
+            double norm = r.norm();
+            escalated = internal::conditioning_degraded(J, norm, previous_norm, opt);
+            previous_norm = norm;
+            if (!escalated) {
+                return;
+            }
+        }
+        const ExtArray rhovecL_ = rhovecL.template cast<ExtFloat>(), rhovecV_ = rhovecV.template cast<ExtFloat>();
+        const auto [PsirLx, PsirgradLx, hessianLx] = internal::build_Psir_fgradHessian_directional(model, T_, rhovecL_);
+        const auto [PsirVx, PsirgradVx, hessianVx] = internal::build_Psir_fgradHessian_directional(model, T_, rhovecV_);
+        tel.num_escalated++;
+        internal::build_VLE_Tx_system(RT_, rhovecL_, rhovecV_, xspec, PsirLx, PsirgradLx, hessianLx, PsirVx, PsirgradVx, hessianVx, J, r);
+    };
+    return internal::mix_VLE_Tx_iterate(evaluate, rhovecL0, rhovecV0, xspec, atol, reltol, axtol, relxtol, maxiter, telemetry);
+}
+
+}
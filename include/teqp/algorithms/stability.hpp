@@ -0,0 +1,184 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/stability_types.hpp"
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+
+namespace teqp {
+namespace stability {
+
+    using namespace teqp::cppinterface;
+
+    /***
+    * \brief Tangent plane distance (TPD) analysis of the stability of a state with respect to splitting into two phases
+    *
+    * This is Michelsen's tangent plane analysis in the isochoric formalism, at the temperature of the state. For a trial phase
+    * with molar concentrations \f$\vec\eta\f$, the tangent plane distance of the Helmholtz energy density is
+    * \f[
+    * D(\vec\eta) = \Psi(\vec\eta) - \sum_i \mu_i^\circ\eta_i + p^\circ = \vec\eta\cdot(\vec\mu(\vec\eta)-\vec\mu^\circ) + p^\circ - p(\vec\eta)
+    * \f]
+    * and the state (denoted by \f$\circ\f$) is unstable if D is negative for any trial phase. Each trial phase is first
+    * moved towards a stationary point of D with successive substitution, \f$\eta_i \leftarrow \rho_i^\circ\exp((\mu^{\rm r\circ}_i-\mu^{\rm r}_i(\vec\eta))/RT)\f$,
+    * and then with Newton's method with the Hessian of \f$\Psi\f$. The residual chemical potentials play the role of the
+    * logarithms of the fugacity coefficients of the pressure-explicit formulation. Trial phases that approach the state
+    * itself (the trivial solution) are abandoned.
+    *
+    * \param model The model to operate on
+    * \param T Temperature
+    * \param rhovec Molar concentrations of the state to be tested
+    * \param trials Initial molar concentrations of the trial phases, for instance from get_Wilson_trials or get_pure_trials
+    * \param options Options for the analysis
+    */
+    inline auto tpd_stability(const AbstractModel& model, const double T, const Eigen::ArrayXd& rhovec, const std::vector<Eigen::ArrayXd>& trials, const std::optional<TPDOptions>& options = std::nullopt) {
+        auto opt = options.value_or(TPDOptions{});
+        const auto N = rhovec.size();
+        if ((rhovec <= 0).any()) {
+            throw InvalidArgument("The molar concentrations of the state must all be positive in tpd_stability");
+        }
+        const double rho0 = rhovec.sum();
+        const double RT = model.get_R((rhovec / rho0).eval()) * T;
+        const Eigen::ArrayXd mur0 = model.build_Psir_gradient_autodiff(T, rhovec);
+        const double p0 = rho0 * RT + model.get_pr(T, rhovec);
+
+        TPDResult result;
+        result.num_fev = 1;
+        double Dmin = 0;
+
+        for (const auto& trial : trials) {
+            if (trial.size() != N) {
+                throw InvalidArgument("The trial phases must have one molar concentration per component");
+            }
+            if ((trial <= 0).any()) {
+                continue;
+            }
+            result.num_trials++;
+            Eigen::ArrayXd eta = trial;
+            for (auto step = 0; step < opt.max_steps; ++step) {
+                Eigen::ArrayXd mur = model.build_Psir_gradient_autodiff(T, eta);
+                result.num_fev++;
+                Eigen::ArrayXd g = mur - mur0 + RT * log(eta / rhovec);
+                double p = eta.sum() * RT + model.get_pr(T, eta);
+                double D = ((eta * g).sum() + p0 - p) / (rho0 * RT);
+                if (!std::isfinite(D)) {
+                    break;
+                }
+                if (D < Dmin) {
+                    Dmin = D;
+                    result.rhovec_min = eta;
+                }
+                if (opt.early_exit && Dmin < -opt.tpd_tol) {
+                    break;
+                }
+
+                // Successive substitution, or Newton's method if the Hessian is positive definite
+                Eigen::ArrayXd etanew = rhovec * exp((mur0 - mur) / RT);
+                if (step >= opt.max_substitution_steps) {
+                    Eigen::MatrixXd H = model.build_Psi_Hessian_autodiff(T, eta);
+                    auto ldlt = H.ldlt();
+                    if (ldlt.info() == Eigen::Success && ldlt.isPositive()) {
+                        Eigen::ArrayXd deta = ldlt.solve(-g.matrix()).array();
+                        if ((eta + deta <= 0).any()) {
+                            // Most limiting variable is the smallest allowed before going negative
+                            auto f = ((deta < 0).select(-eta / deta, 1.0)).minCoeff();
+                            deta *= f / 2; // Only allow a step half the way to the most constraining molar concentration at most
+                        }
+                        if (deta.isFinite().all()) {
+                            etanew = eta + deta;
+                        }
+                    }
+                }
+                double dlneta = log(etanew / eta).abs().maxCoeff();
+                eta = etanew;
+                if (!(dlneta > opt.step_tol)) {
+                    break; // Stationary point (or not finite)
+                }
+                if ((eta / rhovec - 1).abs().maxCoeff() < opt.trivial_tol) {
+                    break; // Trivial solution
+                }
+            }
+            if (opt.early_exit && Dmin < -opt.tpd_tol) {
+                break;
+            }
+        }
+        result.tpd_min = Dmin;
+        result.stable = !(Dmin < -opt.tpd_tol);
+        return result;
+    }
+
+    /***
+    * \brief Initial trial phases from Wilson's correlation of the K-factors
+    *
+    * \f$K_i = (p_{c,i}/p)\exp(5.373(1+\omega_i)(1-T_{c,i}/T))\f$, with the pressure p of the state. The vapor-like trial phase
+    * has the mole fractions \f$z_iK_i\f$ (normalized) at the density of the ideal gas, and the liquid-like trial phase the mole
+    * fractions \f$z_i/K_i\f$ at the density given by ideal mixing of the saturated liquid densities of the pure components if
+    * rhoLsat is provided (from the superancillary equations, for instance), or otherwise at the density of the state.
+    */
+    inline auto get_Wilson_trials(const AbstractModel& model, const double T, const Eigen::ArrayXd& rhovec, const Eigen::ArrayXd& Tc, const Eigen::ArrayXd& pc, const Eigen::ArrayXd& acentric, const std::optional<Eigen::ArrayXd>& rhoLsat = std::nullopt) {
+        const auto N = rhovec.size();
+        if (Tc.size() != N || pc.size() != N || acentric.size() != N || (rhoLsat && rhoLsat.value().size() != N)) {
+            throw InvalidArgument("The critical parameters must have one entry per component");
+        }
+        const double rho = rhovec.sum();
+        const Eigen::ArrayXd z = rhovec / rho;
+        const double RT = model.get_R(z) * T;
+        const double p = rho * RT + model.get_pr(T, rhovec);
+
+        std::vector<Eigen::ArrayXd> trials;
+        Eigen::ArrayXd K = pc / p * exp(5.373 * (1 + acentric) * (1 - Tc / T));
+        if (p > 0) {
+            Eigen::ArrayXd y = z * K;
+            trials.push_back(y / y.sum() * p / RT);
+        }
+        Eigen::ArrayXd x = z / K;
+        x /= x.sum();
+        double rhoL = (rhoLsat) ? 1.0 / (x / rhoLsat.value()).sum() : rho;
+        trials.push_back(x * rhoL);
+        return trials;
+    }
+
+    /***
+    * \brief Initial trial phases that are nearly pure in each component, at the saturated densities of the pure components
+    *
+    * The densities would normally be obtained from the superancillary equations of the pure components at the temperature of
+    * the state.  For each component i, trial phases with mole fractions \f$(1-\epsilon)\delta_{ij} + \epsilon z_j\f$ are built at
+    * each of the densities given for the component.
+    */
+    inline auto get_pure_trials(const Eigen::ArrayXd& rhovec, const Eigen::ArrayXd& rhoLsat, const std::optional<Eigen::ArrayXd>& rhoVsat = std::nullopt, const double epsilon = 1e-3) {
+        const auto N = rhovec.size();
+        if (rhoLsat.size() != N || (rhoVsat && rhoVsat.value().size() != N)) {
+            throw InvalidArgument("The saturated densities must have one entry per component");
+        }
+        const Eigen::ArrayXd z = rhovec / rhovec.sum();
+        std::vector<Eigen::ArrayXd> trials;
+        for (auto i = 0; i < N; ++i) {
+            Eigen::ArrayXd x = epsilon * z;
+            x(i) += 1 - epsilon;
+            trials.push_back(x * rhoLsat(i));
+            if (rhoVsat) {
+                trials.push_back(x * rhoVsat.value()(i));
+            }
+        }
+        return trials;
+    }
+
+#define STABILITY_FUNCTIONS_TO_WRAP \
+    X(tpd_stability) \
+    X(get_Wilson_trials)
+
+#define X(f) template <typename TemplatedModel, typename ...Params, \
+typename = typename std::enable_if<not std::is_base_of<teqp::cppinterface::AbstractModel, TemplatedModel>::value>::type> \
+inline auto f(const TemplatedModel& model, Params&&... params){ \
+    auto view = teqp::cppinterface::adapter::make_cview(model); \
+    const AbstractModel& am = *view.get(); \
+    return f(am, std::forward<Params>(params)...); \
+}
+    STABILITY_FUNCTIONS_TO_WRAP
+#undef X
+#undef STABILITY_FUNCTIONS_TO_WRAP
+
+}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace teqp{
+namespace stability{
+
+struct TPDOptions {
+    int max_substitution_steps = 5; ///< The number of successive substitution steps taken for each trial phase before switching to Newton's method
+    int max_steps = 30; ///< The maximum number of steps allowed for each trial phase
+    double tpd_tol = 1e-10; ///< The state is unstable if a reduced tangent plane distance below -tpd_tol is found
+    double step_tol = 1e-10; ///< A trial phase has converged to a stationary point when the largest change in the logarithm of its molar concentrations is below step_tol
+    double trivial_tol = 1e-4; ///< A trial phase is taken to be converging to the trivial solution when its molar concentrations are all within this relative tolerance of those of the state
+    bool early_exit = true; ///< If true, stop as soon as a negative tangent plane distance has been found
+};
+
+struct TPDResult {
+    bool stable = true; ///< True if no trial phase with a negative tangent plane distance was found
+    double tpd_min = 0; ///< The smallest reduced tangent plane distance D/(rho*R*T) that was found, zero if all the trial phases went to the trivial solution
+    Eigen::ArrayXd rhovec_min; ///< The molar concentrations of the trial phase with the smallest tangent plane distance, empty if all went to the trivial solution
+    int num_trials = 0; ///< The number of trial phases that were started
+    int num_fev = 0; ///< The number of evaluations of the residual chemical potentials
+};
+
+}
+}
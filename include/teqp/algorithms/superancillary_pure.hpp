@@ -0,0 +1,387 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/filesystem.hpp"
+#include "teqp/json_tools.hpp"
+#include "teqp/algorithms/critical_pure.hpp"
+#include "teqp/algorithms/VLE_pure.hpp"
+#include "teqp/models/cubicsuperancillary.hpp"
+
+namespace teqp {
+namespace superancillary {
+
+using CubicSuperAncillary::Chebyshev;
+using CubicSuperAncillary::SuperAncillary;
+
+/**
+ \brief Superancillary equations of a pure fluid, generated from a model
+
+ Piecewise Chebyshev expansions in T of the saturated liquid and vapor densities and of the vapor pressure, between Tmin
+ and Tmax (a bit below the critical temperature). Built by build_pure_superancillary, and can be stored as JSON.
+ */
+struct PureSuperAncillary {
+    const double Tmin, Tmax, Tcrit, rhocrit;
+    const SuperAncillary rhoL, rhoV, p;
+
+    /// Saturated liquid and vapor densities, in mol/m^3, from the expansions only
+    auto get_rhoLrhoV(const double T) const {
+        return (Eigen::ArrayXd(2) << rhoL.y(T), rhoV.y(T)).finished();
+    }
+
+    /**
+     Saturated liquid and vapor densities, from the expansions followed by some Newton steps of pure_VLE_T with the model;
+     one step is normally enough to converge to the precision of the model
+     */
+    auto get_rhoLrhoV(const cppinterface::AbstractModel& model, const double T, const int Nsteps = 1) const {
+        auto rhos = get_rhoLrhoV(T);
+        return pure_VLE_T(model, T, rhos[0], rhos[1], Nsteps);
+    }
+
+    /// Vapor pressure, in Pa
+    auto get_p(const double T) const { return p.y(T); }
+};
+
+namespace internal {
+
+    /// The k-th of the N+1 Chebyshev-Lobatto nodes of [xmin,xmax]
+    inline double get_Chebyshev_node(const int k, const int N, const double xmin, const double xmax) {
+        return (xmax - xmin)/2*cos(EIGEN_PI*k/N) + (xmax + xmin)/2;
+    }
+
+    /// Coefficients of the Chebyshev expansion interpolating the values fk at the Chebyshev-Lobatto nodes
+    inline auto fit_Chebyshev_values(const Eigen::ArrayXd& fk) {
+        const auto N = static_cast<int>(fk.size()) - 1;
+        std::vector<double> c(N+1);
+        for (auto j = 0; j <= N; ++j) {
+            double s = 0;
+            for (auto k = 0; k <= N; ++k) {
+                double w = (k == 0 || k == N) ? 0.5 : 1.0;
+                s += w*fk[k]*cos(EIGEN_PI*j*k/N);
+            }
+            c[j] = 2.0/N*s;
+        }
+        c[0] /= 2; c[N] /= 2;
+        return std::make_tuple(c, fk.abs().maxCoeff());
+    }
+
+    /// Coefficients of the Chebyshev expansion of degree N interpolating f at the Chebyshev-Lobatto nodes of [xmin,xmax]
+    template<typename Function>
+    auto fit_Chebyshev(const Function& f, const int N, const double xmin, const double xmax) {
+        Eigen::ArrayXd fk(N+1);
+        for (auto k = 0; k <= N; ++k) {
+            fk[k] = f(get_Chebyshev_node(k, N, xmin, xmax));
+        }
+        return fit_Chebyshev_values(fk);
+    }
+
+    /// True if the last coefficients of the expansion are negligible
+    inline bool is_converged(const std::vector<double>& c, const double fmax, const double reltol) {
+        const auto N = c.size() - 1;
+        return std::max(std::abs(c[N-1]), std::abs(c[N])) < reltol*fmax;
+    }
+
+    /// Recursive bisection of [xmin, xmax] until the last coefficients of the expansion are negligible
+    template<typename Function>
+    void fit_adaptive(const Function& f, const int N, const double xmin, const double xmax, const double reltol, const int depth, std::vector<Chebyshev>& out) {
+        auto [c, fmax] = fit_Chebyshev(f, N, xmin, xmax);
+        bool converged = is_converged(c, fmax, reltol);
+        if (converged || depth == 0) {
+            out.push_back(Chebyshev{c, xmin, xmax});
+            return;
+        }
+        double xmid = (xmin + xmax)/2;
+        fit_adaptive(f, N, xmin, xmid, reltol, depth-1, out);
+        fit_adaptive(f, N, xmid, xmax, reltol, depth-1, out);
+    }
+
+    /// Saturation states along a path from near the critical point down to Tmin, used to supply guess values at any T
+    class SaturationPath {
+    private:
+        const cppinterface::AbstractModel& model;
+        std::vector<double> T, rhoL, rhoV; // in increasing order of T
+    public:
+        SaturationPath(const cppinterface::AbstractModel& model, const double Tmin, const double Tmax, const double Tc, const double rhoc, const int Nstep) : model(model) {
+            auto rhos = extrapolate_from_critical(model, Tc, rhoc, Tmax);
+            for (auto T_ : Eigen::ArrayXd::LinSpaced(Nstep, Tmax, Tmin)) {
+                rhos = pure_VLE_T(model, T_, rhos[0], rhos[1], 10);
+                if (!std::isfinite(rhos[0]) || !std::isfinite(rhos[1]) || rhos[0] == rhos[1]) {
+                    throw teqp::IterationError("Unable to trace the saturation curve at T=" + std::to_string(T_) + " K; try increasing Nstep");
+                }
+                T.insert(T.begin(), T_); rhoL.insert(rhoL.begin(), rhos[0]); rhoV.insert(rhoV.begin(), rhos[1]);
+            }
+        }
+        /// The saturated densities at T, polished from a linear interpolation of the stored states
+        auto solve(const double Tgiven) const {
+            auto it = std::lower_bound(T.begin(), T.end(), Tgiven);
+            std::size_t i = std::clamp<std::size_t>(std::distance(T.begin(), it), 1, T.size() - 1);
+            double w = (Tgiven - T[i-1])/(T[i] - T[i-1]);
+            double rhoL0 = rhoL[i-1] + w*(rhoL[i] - rhoL[i-1]), rhoV0 = rhoV[i-1] + w*(rhoV[i] - rhoV[i-1]);
+            return pure_VLE_T(model, Tgiven, rhoL0, rhoV0, 20);
+        }
+    };
+}
+
+/**
+ \brief Saturation curve of a pure fluid, built lazily where it is queried
+
+ The range of temperatures of build_pure_superancillary (with the same spec) is divided into panels, and the Chebyshev
+ expansions of the saturated densities and of the vapor pressure in a panel are only built at the first query in it. A
+ panel whose expansions miss the tolerance is bisected, and only the half that holds the query is built, so the refinement
+ follows the queries. The critical point and the path of guess values along the saturation curve are obtained at the first
+ query. Afterwards, a query costs the evaluation of the expansions, and a Newton step of pure_VLE_T if polishing is requested.
+
+ The model must outlive the cache. Queries may modify the cache, so it must not be shared between threads.
+ */
+class PureSaturationCache {
+private:
+    struct Panel {
+        const double Tmin, Tmax;
+        const int depth;
+        std::optional<Chebyshev> rhoL, rhoV, p;
+    };
+    const cppinterface::AbstractModel& model;
+    const nlohmann::json spec;
+    double Tcrit = -1, rhocrit = -1, Tmin = -1, Tmax = -1;
+    std::unique_ptr<internal::SaturationPath> path;
+    std::map<double, Panel> panels; // Keyed by the lower bound of the panel
+    std::size_t num_built = 0;
+
+    void initialize() {
+        std::tie(Tcrit, rhocrit) = solve_pure_critical(model, spec.at("Tcguess").get<double>(), spec.at("rhocguess").get<double>());
+        Tmin = spec.at("Tmin");
+        Tmax = spec.value("Tred", 0.999)*Tcrit;
+        if (Tmin >= Tmax) {
+            throw teqp::InvalidArgument("Tmin of " + std::to_string(Tmin) + " K must be below Tred*Tc of " + std::to_string(Tmax) + " K");
+        }
+        path = std::make_unique<internal::SaturationPath>(model, Tmin, Tmax, Tcrit, rhocrit, spec.value("Nstep", 200));
+        panels.emplace(Tmin, Panel{Tmin, Tmax, 0});
+    }
+
+    /// The panel that holds T, building (and refining) it if necessary
+    const Panel& get_panel(const double T) {
+        if (!path) {
+            initialize();
+        }
+        if (!(T >= Tmin && T <= Tmax)) {
+            throw teqp::InvalidArgument("T of " + std::to_string(T) + " K is outside of the range [" + std::to_string(Tmin) + ", " + std::to_string(Tmax) + "] K of the saturation cache");
+        }
+        const int N = spec.value("order", 12), maxdepth = spec.value("maxdepth", 12);
+        const double reltol = spec.value("reltol", 1e-12);
+        const auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+        const double R = model.get_R(z);
+        while (true) {
+            auto it = std::prev(panels.upper_bound(T));
+            Panel& panel = it->second;
+            if (panel.rhoL) {
+                return panel;
+            }
+            // The saturation states at the nodes are shared by the three expansions
+            Eigen::ArrayXd rhoL(N+1), rhoV(N+1), p(N+1);
+            for (auto k = 0; k <= N; ++k) {
+                double Tk = internal::get_Chebyshev_node(k, N, panel.Tmin, panel.Tmax);
+                auto rhos = path->solve(Tk);
+                rhoL[k] = rhos[0];
+                rhoV[k] = rhos[1];
+                p[k] = rhos[1]*R*Tk*(1.0 + model.get_Ar01(Tk, rhos[1], z));
+            }
+            auto [cL, fL] = internal::fit_Chebyshev_values(rhoL);
+            auto [cV, fV] = internal::fit_Chebyshev_values(rhoV);
+            auto [cp, fp] = internal::fit_Chebyshev_values(p);
+            bool converged = internal::is_converged(cL, fL, reltol) && internal::is_converged(cV, fV, reltol) && internal::is_converged(cp, fp, reltol);
+            if (converged || panel.depth >= maxdepth) {
+                panel.rhoL.emplace(Chebyshev{cL, panel.Tmin, panel.Tmax});
+                panel.rhoV.emplace(Chebyshev{cV, panel.Tmin, panel.Tmax});
+                panel.p.emplace(Chebyshev{cp, panel.Tmin, panel.Tmax});
+                num_built++;
+                return panel;
+            }
+            // Bisect the panel; the half that holds T is built in the next pass
+            const double Tlo = panel.Tmin, Thi = panel.Tmax, Tmid = (Tlo + Thi)/2;
+            const int depth = panel.depth + 1;
+            panels.erase(it);
+            panels.emplace(Tlo, Panel{Tlo, Tmid, depth});
+            panels.emplace(Tmid, Panel{Tmid, Thi, depth});
+        }
+    }
+
+public:
+    /// The spec is that of build_pure_superancillary; nothing is evaluated until the first query
+    PureSaturationCache(const cppinterface::AbstractModel& model, const nlohmann::json& spec) : model(model), spec(spec) {};
+
+    /// Saturated liquid and vapor densities, in mol/m^3, from the expansions only
+    auto get_rhoLrhoV(const double T) {
+        const auto& panel = get_panel(T);
+        return (Eigen::ArrayXd(2) << panel.rhoL->y(T), panel.rhoV->y(T)).finished();
+    }
+
+    /// Saturated liquid and vapor densities, from the expansions followed by Nsteps Newton steps of pure_VLE_T with the model
+    auto get_rhoLrhoV_polished(const double T, const int Nsteps = 1) {
+        auto rhos = get_rhoLrhoV(T);
+        return pure_VLE_T(model, T, rhos[0], rhos[1], Nsteps);
+    }
+
+    /// Vapor pressure, in Pa
+    double get_p(const double T) {
+        return get_panel(T).p->y(T);
+    }
+
+    /// The number of panels whose expansions have been built so far
+    auto get_num_built_panels() const { return num_built; }
+
+    /// The critical temperature of the model, in K; the cache is initialized if it was not already
+    double get_Tcrit() {
+        if (!path) {
+            initialize();
+        }
+        return Tcrit;
+    }
+
+    /// The range [Tmin, Tmax] of temperatures, in K, covered by the cache; the cache is initialized if it was not already
+    auto get_Trange() {
+        if (!path) {
+            initialize();
+        }
+        return std::make_tuple(Tmin, Tmax);
+    }
+};
+
+/**
+ \brief Generate the superancillary equations of a pure fluid from an AbstractModel
+
+ The fields in spec are:
+ * "Tcguess", "rhocguess": guess values for the critical point (required)
+ * "Tmin": the lowest temperature of the expansions (required)
+ * "Tred": the highest temperature, relative to the critical temperature (default 0.999)
+ * "Nstep": the number of steps along the saturation curve used to generate the guess values (default 200)
+ * "order": the degree of each expansion (default 12)
+ * "reltol": the relative tolerance on the last coefficients of each expansion (default 1e-12)
+ * "maxdepth": the maximum number of bisections of the temperature range (default 12)
+ */
+inline auto build_pure_superancillary(const cppinterface::AbstractModel& model, const nlohmann::json& spec) {
+    auto [Tc, rhoc] = solve_pure_critical(model, spec.at("Tcguess").get<double>(), spec.at("rhocguess").get<double>());
+    double Tmin = spec.at("Tmin"), Tmax = spec.value("Tred", 0.999)*Tc;
+    if (Tmin >= Tmax) {
+        throw teqp::InvalidArgument("Tmin of " + std::to_string(Tmin) + " K must be below Tred*Tc of " + std::to_string(Tmax) + " K");
+    }
+    int N = spec.value("order", 12), maxdepth = spec.value("maxdepth", 12);
+    double reltol = spec.value("reltol", 1e-12);
+    internal::SaturationPath path(model, Tmin, Tmax, Tc, rhoc, spec.value("Nstep", 200));
+
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    const double R = model.get_R(z);
+    std::vector<Chebyshev> rhoL, rhoV, p;
+    internal::fit_adaptive([&](double T) { return path.solve(T)[0]; }, N, Tmin, Tmax, reltol, maxdepth, rhoL);
+    internal::fit_adaptive([&](double T) { return path.solve(T)[1]; }, N, Tmin, Tmax, reltol, maxdepth, rhoV);
+    internal::fit_adaptive([&](double T) {
+        auto rhoV_ = path.solve(T)[1];
+        return rhoV_*R*T*(1.0 + model.get_Ar01(T, rhoV_, z));
+    }, N, Tmin, Tmax, reltol, maxdepth, p);
+    return PureSuperAncillary{Tmin, Tmax, Tc, rhoc, SuperAncillary{rhoL}, SuperAncillary{rhoV}, SuperAncillary{p}};
+}
+
+inline nlohmann::json to_json(const PureSuperAncillary& sa) {
+    auto expansions = [](const SuperAncillary& s) {
+        nlohmann::json j = nlohmann::json::array();
+        for (const auto& e : s.exps) {
+            j.push_back({{"xmin", e.xmin}, {"xmax", e.xmax}, {"coef", e.coeff}});
+        }
+        return j;
+    };
+    return {
+        {"Tmin / K", sa.Tmin}, {"Tmax / K", sa.Tmax}, {"Tcrit / K", sa.Tcrit}, {"rhocrit / mol/m^3", sa.rhocrit},
+        {"rhoL", expansions(sa.rhoL)}, {"rhoV", expansions(sa.rhoV)}, {"p", expansions(sa.p)}
+    };
+}
+
+inline auto pure_superancillary_from_json(const nlohmann::json& j) {
+    auto expansions = [](const nlohmann::json& jj) {
+        std::vector<Chebyshev> exps;
+        for (const auto& e : jj) {
+            exps.push_back(Chebyshev{e.at("coef").get<std::vector<double>>(), e.at("xmin").get<double>(), e.at("xmax").get<double>()});
+        }
+        return SuperAncillary{exps};
+    };
+    return PureSuperAncillary{
+        j.at("Tmin / K").get<double>(), j.at("Tmax / K").get<double>(), j.at("Tcrit / K").get<double>(), j.at("rhocrit / mol/m^3").get<double>(),
+        expansions(j.at("rhoL")), expansions(j.at("rhoV")), expansions(j.at("p"))
+    };
+}
+
+/// Load the superancillary equations from the file at path if it exists, otherwise generate them and store them in that file
+inline auto load_or_build_pure_superancillary(const cppinterface::AbstractModel& model, const nlohmann::json& spec, const std::string& path) {
+    if (std::filesystem::is_regular_file(path)) {
+        return pure_superancillary_from_json(load_a_JSON_file(path));
+    }
+    auto sa = build_pure_superancillary(model, spec);
+    std::ofstream ofs(path);
+    if (!ofs) {
+        throw teqp::InvalidArgument("Unable to write the superancillary equations to " + path);
+    }
+    ofs << to_json(sa).dump();
+    return sa;
+}
+
+/**
+ The key of the superancillary equations of a pure model in a cache: the 64-bit FNV-1a hash, in hexadecimal, of the compact
+ dump of the model's JSON and the spec. Objects in nlohmann::json are sorted by key, so the dump is canonical and the
+ key does not depend on the order in which the fields were given.
+ */
+inline std::string get_superancillary_cache_key(const nlohmann::json& model_json, const nlohmann::json& spec) {
+    const std::string s = nlohmann::json({{"model", model_json}, {"spec", spec}, {"version", 1}}).dump();
+    std::uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(h));
+    return buf;
+}
+
+/**
+ \brief The superancillary equations, including the critical point, of the pure model with the JSON definition model_json, from an on-disk cache
+
+ The equations are stored in the folder cache_dir, in a file named by get_superancillary_cache_key. If the file exists, it
+ is loaded and the model is not even constructed, so repeat runs skip the critical point and the saturation curve entirely;
+ otherwise the model is built with make_model, the equations are generated with build_pure_superancillary (see there for the
+ spec) and stored. The file is written under a temporary name and then renamed, so a concurrent run never reads a partial file.
+ Use it for each pure-fluid endpoint of the tracers of mixtures, with the model of the pure fluid.
+ */
+inline auto get_cached_pure_superancillary(const nlohmann::json& model_json, const nlohmann::json& spec, const std::string& cache_dir) {
+    const auto path = std::filesystem::path(cache_dir) / (get_superancillary_cache_key(model_json, spec) + ".json");
+    if (std::filesystem::is_regular_file(path)) {
+        return pure_superancillary_from_json(load_a_JSON_file(path.string()));
+    }
+    auto model = cppinterface::make_model(model_json);
+    auto sa = build_pure_superancillary(*model, spec);
+    std::filesystem::create_directories(cache_dir);
+    auto tmp = path;
+    tmp += ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream ofs(tmp);
+        if (!ofs) {
+            throw teqp::InvalidArgument("Unable to write the superancillary equations to " + tmp.string());
+        }
+        ofs << to_json(sa).dump();
+    }
+    std::filesystem::rename(tmp, path);
+    return sa;
+}
+
+} // namespace superancillary
+} // namespace teqp
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace teqp {
+namespace arena {
+
+/**
+ \brief A monotonic allocator for the scratch arrays of a calculation
+
+ Memory is handed out from large blocks by bumping an offset, and it is only given back all at once, by rewinding to a mark
+ (see ScopedArena).  The blocks are kept when rewinding, so once a calculation of a given size has been done, the next ones
+ draw all their scratch memory from the blocks without going to the heap.  Not thread-safe; each thread has its own, see ScopedArena.
+ */
+class Arena {
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+    std::vector<Block> blocks;
+    std::size_t iblock = 0, offset = 0; ///< The block and the offset in it of the next allocation
+    const std::size_t block_size;
+public:
+    /// A position in the arena, to rewind to
+    struct Mark {
+        std::size_t iblock, offset;
+    };
+
+    explicit Arena(std::size_t block_size = 65536) : block_size(block_size) {};
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Memory for bytes bytes aligned on alignment, which must be a power of two; valid until the arena is rewound past it
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+        for (;;) {
+            if (iblock == blocks.size()) {
+                auto size = std::max(block_size, bytes + alignment);
+                blocks.push_back(Block{ std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+            }
+            auto& block = blocks[iblock];
+            auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+            std::size_t start = ((base + offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1)) - base;
+            if (start + bytes <= block.size) {
+                offset = start + bytes;
+                return block.data.get() + start;
+            }
+            // Does not fit in the rest of this block; the following blocks are tried, and a new one is added after the last
+            ++iblock; offset = 0;
+        }
+    }
+
+    Mark mark() const { return { iblock, offset }; }
+    /// Give back everything allocated since the mark was taken
+    void rewind(const Mark& m) { iblock = m.iblock; offset = m.offset; }
+
+    /// The number of bytes handed out and not yet given back, including the ends of the blocks skipped for lack of room
+    std::size_t get_used() const {
+        std::size_t used = offset;
+        for (auto i = 0U; i < iblock && i < blocks.size(); ++i) { used += blocks[i].size; }
+        return used;
+    }
+    /// The number of bytes of the blocks, which are only freed with the arena
+    std::size_t get_capacity() const {
+        std::size_t capacity = 0;
+        for (const auto& block : blocks) { capacity += block.size; }
+        return capacity;
+    }
+};
+
+namespace detail {
+    /// The arena installed in the calling thread, if any
+    inline Arena*& current() {
+        thread_local Arena* arena = nullptr;
+        return arena;
+    }
+    /// The arena owned by the calling thread, installed by a default-constructed ScopedArena
+    inline Arena& thread_arena() {
+        thread_local Arena arena;
+        return arena;
+    }
+}
+
+/// The arena installed in the calling thread by a ScopedArena, or nullptr if none is
+inline Arena* get_current_arena() { return detail::current(); }
+
+/**
+ \brief Install an arena in the calling thread for the lifetime of the guard
+
+ While it is installed, the ArenaArray of the calling thread take their memory from the arena; at the end of the scope the
+ arena is rewound to where it was when the guard was made (which the ArenaArray have already done if they were all
+ destroyed), and the arena installed before, if any, is installed again.  The
+ guards can be nested, and must be destroyed in the thread that made them.  Wrapping a whole calculation, such as a VLE solve,
+ in a guard thus reuses the scratch memory from one call of the model to the next:
+
+     {
+         teqp::arena::ScopedArena guard;
+         auto r = mix_VLE_Tp(model, T, p, rhovecL0, rhovecV0);
+     }
+
+ Nothing allocated in the arena may outlive the guard; only scratch arrays that do not leave the function that made them are
+ put in it, so the results of the calculation are unaffected.
+ */
+class ScopedArena {
+private:
+    Arena& arena;
+    Arena* const previous;
+    const Arena::Mark start;
+public:
+    /// Install the arena owned by the calling thread
+    ScopedArena() : ScopedArena(detail::thread_arena()) {};
+    /// Install the given arena, which must outlive the guard and not be used by other threads meanwhile
+    explicit ScopedArena(Arena& arena) : arena(arena), previous(detail::current()), start(arena.mark()) {
+        detail::current() = &arena;
+    }
+    ~ScopedArena() {
+        arena.rewind(start);
+        detail::current() = previous;
+    }
+    ScopedArena(const ScopedArena&) = delete;
+    ScopedArena& operator=(const ScopedArena&) = delete;
+
+    Arena& get_arena() { return arena; }
+};
+
+namespace detail {
+    /**
+     The storage of an ArenaArray, in the installed arena or else on the heap; a base class so that it is made before the map.
+     The arena is rewound to where it was before the allocation when the storage is destroyed
+     */
+    template<typename T>
+    struct ArenaArrayStorage {
+        std::unique_ptr<T[]> owned;
+        Arena* arena = nullptr;
+        Arena::Mark mark{0, 0};
+        T* allocate(Eigen::Index n) {
+            arena = get_current_arena();
+            if (arena != nullptr) {
+                mark = arena->mark();
+                T* data = static_cast<T*>(arena->allocate(sizeof(T) * static_cast<std::size_t>(n), std::max(alignof(T), static_cast<std::size_t>(EIGEN_MAX_ALIGN_BYTES))));
+                std::uninitialized_default_construct_n(data, n);
+                return data;
+            }
+            owned.reset(new T[static_cast<std::size_t>(n)]);
+            return owned.get();
+        }
+        ~ArenaArrayStorage() {
+            if (arena != nullptr) { arena->rewind(mark); }
+        }
+    };
+}
+
+/**
+ \brief A scratch Eigen array in the arena of the calling thread, or on the heap if no arena is installed
+
+ It is an Eigen::Map, so it is used as an Eigen::Array of fixed size; it can neither be copied nor moved, nor outlive the
+ ScopedArena in force when it was made.  Its memory is given back to the arena when it is destroyed, so the ArenaArray must be
+ destroyed in the reverse order of their making, as local variables are; a long calculation in one guard thus does not
+ make the arena grow.  The elements are not destroyed, so T must be trivially destructible, as are
+ double and the autodiff types; see ScratchArray for the others.
+ */
+template<typename T, int Rows = Eigen::Dynamic, int Cols = 1>
+class ArenaArray : private detail::ArenaArrayStorage<T>, public Eigen::Map<Eigen::Array<T, Rows, Cols>> {
+    static_assert(std::is_trivially_destructible_v<T>, "The elements of an ArenaArray are never destroyed");
+    using Base = Eigen::Map<Eigen::Array<T, Rows, Cols>>;
+public:
+    /// A column of N elements
+    explicit ArenaArray(Eigen::Index N) : Base(this->allocate(N), N) {};
+    /// A rows x cols array
+    ArenaArray(Eigen::Index rows, Eigen::Index cols) : Base(this->allocate(rows * cols), rows, cols) {};
+    ArenaArray(const ArenaArray&) = delete;
+    ArenaArray(ArenaArray&&) = delete;
+
+    using Base::operator=;
+    ArenaArray& operator=(const ArenaArray& other) { Base::operator=(other); return *this; }
+};
+
+/// An ArenaArray if T can be put in the arena, otherwise an Eigen::Array (the multicomplex types own heap memory)
+template<typename T, int Rows = Eigen::Dynamic, int Cols = 1>
+using ScratchArray = std::conditional_t<std::is_trivially_destructible_v<T>, ArenaArray<T, Rows, Cols>, Eigen::Array<T, Rows, Cols>>;
+
+}
+}
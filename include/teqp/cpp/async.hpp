@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+
+namespace teqp{
+namespace async{
+
+/**
+ \brief A fixed set of worker threads that run the tasks submitted to it in the order of submission
+
+ The destructor lets the workers finish the tasks already submitted before joining them.
+ */
+class ThreadPool{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+public:
+    /// Start Nthreads workers; 0 means std::thread::hardware_concurrency()
+    explicit ThreadPool(const std::size_t Nthreads = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Queue a task; it must not throw
+    void submit(std::function<void()> task);
+    /// The number of worker threads
+    std::size_t size() const;
+};
+
+/// The pool used by the asynchronous functions when none is given, started on first use with one worker per hardware thread
+ThreadPool& default_pool();
+
+/// Called from the worker thread with the number of steps completed so far and the last point, in the format of the result of the synchronous function
+using ProgressCallback = std::function<void(std::size_t, const nlohmann::json&)>;
+
+/**
+ \brief The state shared by a job and the worker that runs it: the request for cancellation and the progress
+ */
+class JobControl{
+private:
+    std::atomic<bool> cancel_requested{false};
+    std::atomic<std::size_t> Nsteps{0};
+    ProgressCallback callback;
+public:
+    explicit JobControl(ProgressCallback callback = {}) : callback(std::move(callback)) {};
+    void cancel(){ cancel_requested = true; }
+    bool is_cancelled() const { return cancel_requested; }
+    std::size_t get_step_count() const { return Nsteps; }
+    /// Record a completed step, called by the worker between the steps of the algorithm; returns false if the job should stop
+    bool step(const nlohmann::json& point){
+        auto N = ++Nsteps;
+        if (callback){ callback(N, point); }
+        return !cancel_requested;
+    }
+};
+
+/**
+ \brief The handle of a job running on a ThreadPool
+
+ The cancellation is cooperative: it is checked by the worker between the steps of the integrator of the tracers, and the
+ job then completes with the part of the result that was obtained so far (is_cancelled() tells it apart from a complete
+ result).  If the algorithm throws, the exception is re-thrown by get().  Copies of the handle refer to the same job, and
+ the job runs to its end even if all handles are destroyed.
+ */
+template<typename Result>
+class Job{
+private:
+    std::shared_ptr<JobControl> control;
+    std::shared_future<Result> result;
+public:
+    Job(std::shared_ptr<JobControl> control, std::shared_future<Result> result) : control(std::move(control)), result(std::move(result)) {};
+
+    /// Request the cancellation of the job
+    void cancel(){ control->cancel(); }
+    bool is_cancelled() const { return control->is_cancelled(); }
+    /// The number of steps completed so far
+    std::size_t get_step_count() const { return control->get_step_count(); }
+    bool is_ready() const { return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+    void wait() const { result.wait(); }
+    template<typename Rep, typename Period>
+    std::future_status wait_for(const std::chrono::duration<Rep, Period>& timeout) const { return result.wait_for(timeout); }
+    /// Wait for the result of the job
+    const Result& get() const { return result.get(); }
+};
+
+/*
+ Asynchronous versions of the long-running methods of AbstractModel.  They return at once, and the work is done on the pool.
+ The model is shared with the job so that it stays alive until the job is done; the const methods of AbstractModel are reentrant,
+ so the same model may be used by many jobs, and by the calling thread, at the same time.
+ */
+
+/// Asynchronous version of AbstractModel::trace_critical_arclength_binary (without an output file); a step_callback of the options is called before the job's own
+Job<nlohmann::json> trace_critical_arclength_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const double T0, const EArrayd& rhovec0, const std::optional<TCABOptions>& options = std::nullopt, const ProgressCallback& progress = {}, ThreadPool& pool = default_pool());
+
+/// Asynchronous version of AbstractModel::trace_VLE_isotherm_binary; a trace that is cancelled has the termination_reason "Cancelled" with the revision 2 of the output
+Job<nlohmann::json> trace_VLE_isotherm_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const double T, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<TVLEOptions>& options = std::nullopt, const ProgressCallback& progress = {}, ThreadPool& pool = default_pool());
+
+/// Asynchronous version of AbstractModel::trace_VLE_isobar_binary
+Job<nlohmann::json> trace_VLE_isobar_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const double p, const double T0, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<PVLEOptions>& options = std::nullopt, const ProgressCallback& progress = {}, ThreadPool& pool = default_pool());
+
+/// Asynchronous version of AbstractModel::find_VLLE_T_binary; the whole search is one step (with the solutions as its point), so it can only be cancelled before it starts, and it then gives no solutions
+Job<std::vector<nlohmann::json>> find_VLLE_T_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const std::vector<nlohmann::json>& traces, const std::optional<VLLE::VLLEFinderOptions>& options = std::nullopt, const ProgressCallback& progress = {}, ThreadPool& pool = default_pool());
+
+}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/parallel.hpp"
+
+namespace teqp{
+namespace device{
+
+/// Where the batches are evaluated
+enum class Backend { host, cuda };
+
+struct BatchOptions{
+    Backend backend = Backend::host;
+    int device = 0; ///< The ordinal of the CUDA device
+    std::size_t chunk_size = 1 << 18; ///< The number of state points per transfer to the device; two chunks are in flight, so that the transfers of one overlap the kernel of the other
+    parallel::ParallelOptions host; ///< The options of the threads of the host backend
+};
+
+/// True if teqp was built with TEQP_CUDA and a CUDA device is present
+bool cuda_available();
+
+/**
+ \brief Batched evaluation of the residual derivatives \f$\Lambda^{\rm r}_{ij}\f$ of a model, on the host or on a GPU
+
+ The coefficients of the model are flattened into contiguous arrays when the evaluator is built (and uploaded to the device
+ once, for the CUDA backend), so later changes of the parameters of the model, for instance through its setters, are not seen
+ by the evaluator, which must then be rebuilt.  The model need not outlive the evaluator.  The derivatives are obtained in
+ closed form for the multifluid terms (as in ADBackends::analytic), and from truncated Taylor series in \f$1/T\f$ (forward-mode
+ duals of arbitrary order) for the alpha functions of the cubic models.  The host backend runs the same kernels as the device,
+ over the threads of parallel::parallel_for, so it is the reference for the results of the device.
+
+ Only the generic cubic models (canonical_cubic_t, with the basic or Twu alpha functions) and the multifluid model (multifluid_t,
+ with the power, exponential, double exponential, Gaussian, GERG-2004 and Lemmon2005 terms) are supported; teqp::NotImplementedError
+ is thrown for the other models and terms.
+ */
+class BatchEvaluator{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+public:
+    BatchEvaluator(const cppinterface::AbstractModel& model, const BatchOptions& options = {});
+    ~BatchEvaluator();
+    BatchEvaluator(const BatchEvaluator&) = delete;
+    BatchEvaluator& operator=(const BatchEvaluator&) = delete;
+
+    /// The number of components of the model
+    int get_Ncomponents() const;
+
+    /**
+     The derivatives \f$\Lambda^{\rm r}_{ij}\f$ with \f$i \leq\f$ NT and \f$j \leq\f$ ND at each state point, returned with the
+     shape (M, (NT+1)*(ND+1)), column i*(ND+1)+j holding \f$\Lambda^{\rm r}_{ij}\f$.  T and rho are of length M, molefrac is of
+     shape (M, N), as in AbstractModel::get_Arxy_many.  NT and ND may be at most 6.  It may be called from several threads, but the
+     calls on the CUDA backend are serialized, as they share its buffers and streams.
+     */
+    EMatrixd get_Ar_block(const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const;
+};
+
+}
+}
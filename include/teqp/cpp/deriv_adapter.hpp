@@ -1,6 +1,7 @@
 #pragma once
 
 #include "teqp/derivs.hpp"
+#include "teqp/algorithms/density.hpp"
 #include "teqp/cpp/teqpcpp.hpp"
 #include "teqp/exceptions.hpp"
 
@@ -31,8 +32,48 @@ public:
     ConstViewer(ModelType& m) : model(m), index(std::type_index(typeid(ModelType))) {};
 };
 
+template<typename TemplatedModel> std::unique_ptr<AbstractModel> make_owned(const TemplatedModel& tmodel);
+template<typename TemplatedModel> std::unique_ptr<AbstractModel> make_cview(const TemplatedModel& tmodel);
+
 namespace internal{
     template<class T>struct tag{using type=T;};
+    
+    /// Detect whether the model provides a prepare_composition method
+    template<typename T, typename = void>
+    struct has_prepare_composition : std::false_type {};
+    template<typename T>
+    struct has_prepare_composition<T, std::void_t<decltype(std::declval<const T&>().prepare_composition(std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
+    /// Detect whether the model provides its own (closed-form) get_deriv_mat2, as does the ideal-gas model
+    template<typename T, typename = void>
+    struct has_deriv_mat2 : std::false_type {};
+    template<typename T>
+    struct has_deriv_mat2<T, std::void_t<decltype(std::declval<const T&>().get_deriv_mat2(std::declval<double>(), std::declval<double>(), std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
+    /// Detect whether the model provides the closed-form get_Aig_xy of the ideal-gas model
+    template<typename T, typename = void>
+    struct has_Aig_xy : std::false_type {};
+    template<typename T>
+    struct has_Aig_xy<T, std::void_t<decltype(std::declval<const T&>().get_Aig_xy(0, 0, std::declval<double>(), std::declval<double>(), std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
+    /// Check that the arrays passed to the batched "_many" methods have consistent dimensions
+    inline void check_many_sizes(const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac){
+        if (T.size() != rho.size()){
+            throw teqp::InvalidArgument("Lengths of T ("+std::to_string(T.size())+") and rho ("+std::to_string(rho.size())+") are not the same");
+        }
+        if (molefrac.rows() != T.size()){
+            throw teqp::InvalidArgument("Number of rows in molefrac ("+std::to_string(molefrac.rows())+") does not match the length of T ("+std::to_string(T.size())+")");
+        }
+    }
+    /// For the fixed-size adapters, check that the number of columns in molefrac matches the number of components
+    template<int Ncomp>
+    void check_many_ncomp(const REMatrixd& molefrac){
+        if constexpr (Ncomp != Eigen::Dynamic){
+            if (molefrac.cols() != Ncomp){
+                throw teqp::InvalidArgument("Number of columns in molefrac ("+std::to_string(molefrac.cols())+") does not match the number of components ("+std::to_string(Ncomp)+") of this model");
+            }
+        }
+    }
 }
 
 /**
@@ -40,10 +81,33 @@ namespace internal{
  
  The exposed methods cover all the derivative methods that are obtained by derivatives of the model
  */
-template<typename ModelPack>
+template<typename ModelPack, int Ncomp = Eigen::Dynamic>
 class DerivativeAdapter : public teqp::cppinterface::AbstractModel{
 private:
     ModelPack mp;
+    
+    /// The type of the composition-like vectors passed to the model; fixed-size, and allocated on the stack, when the number of components is known at compile time
+    using VecType = std::conditional_t<Ncomp == Eigen::Dynamic, EArrayd, Eigen::Array<double, Ncomp, 1>>;
+    
+    /// Convert a composition-like argument to VecType, checking its length in the fixed-size case
+    /// (the arguments arrive as Eigen::Ref to the caller's buffer, so this is the only copy, and it is on the stack in the fixed-size case)
+    template<typename Vec>
+    static decltype(auto) asvec(const Vec& x){
+        if constexpr (Ncomp == Eigen::Dynamic){
+            if constexpr (std::is_same_v<Vec, VecType>){
+                return (x);
+            }
+            else{
+                return VecType(x);
+            }
+        }
+        else{
+            if (x.size() != Ncomp){
+                throw teqp::InvalidArgument("Length of argument ("+std::to_string(x.size())+") does not match the number of components ("+std::to_string(Ncomp)+") of this model");
+            }
+            return VecType(x);
+        }
+    }
 public:
     auto& get_ModelPack_ref(){ return mp; }
     const auto& get_ModelPack_cref() const { return mp; }
@@ -61,55 +125,173 @@ public:
 //    template<typename T>
 //    DerivativeAdapter(const ConstViewer<T>&& mp): mp(mp) {} ;
     
-    virtual double get_R(const EArrayd& molefrac) const override {
+    virtual double get_R(const REArrayd& molefrac) const override {
         return mp.get_cref().R(molefrac);
     };
     
-    virtual double get_Arxy(const int NT, const int ND, const double T, const double rhomolar, const EArrayd& molefrac) const override{
-        return TDXDerivatives<decltype(mp.get_cref()), double, EArrayd>::get_Ar(NT, ND, mp.get_cref(), T, rhomolar, molefrac);
+    /// The derivative of fixed order, in closed form for the models that provide get_Aig_xy, and otherwise by automatic differentiation
+    template<int i, int j>
+    double get_Arxy_fixed(const double T, const double rho, const REArrayd& molefrac) const {
+        using ModelType = std::decay_t<decltype(mp.get_cref())>;
+        if constexpr (internal::has_Aig_xy<ModelType>::value){
+            if (auto A = mp.get_cref().get_Aig_xy(i, j, T, rho, molefrac)){
+                return A.value();
+            }
+        }
+        return TDXDerivatives<decltype(mp.get_cref()), double, VecType>::template get_Arxy<i,j>(mp.get_cref(), T, rho, asvec(molefrac));
+    }
+    
+    virtual double get_Arxy(const int NT, const int ND, const double T, const double rhomolar, const REArrayd& molefrac) const override{
+        using ModelType = std::decay_t<decltype(mp.get_cref())>;
+        if constexpr (internal::has_Aig_xy<ModelType>::value){
+            if (auto A = mp.get_cref().get_Aig_xy(NT, ND, T, rhomolar, molefrac)){
+                return A.value();
+            }
+        }
+        return TDXDerivatives<decltype(mp.get_cref()), double, VecType>::get_Ar(NT, ND, mp.get_cref(), T, rhomolar, asvec(molefrac));
     };
     
     // Here X-Macros are used to create functions like get_Ar00, get_Ar01, ....
-#define X(i,j) virtual double get_Ar ## i ## j(const double T, const double rho, const REArrayd& molefrac) const  override { return TDXDerivatives<decltype(mp.get_cref()), double, EArrayd>::template get_Arxy<i,j>(mp.get_cref(), T, rho, molefrac); };
+#define X(i,j) virtual double get_Ar ## i ## j(const double T, const double rho, const REArrayd& molefrac) const  override { return get_Arxy_fixed<i,j>(T, rho, molefrac); };
     ARXY_args
 #undef X
     // And like get_Ar01n, get_Ar02n, ....
-#define X(i) virtual EArrayd get_Ar0 ## i ## n(const double T, const double rho, const REArrayd& molefrac) const  override { auto vals = TDXDerivatives<decltype(mp.get_cref()), double, EArrayd>::template get_Ar0n<i>(mp.get_cref(), T, rho, molefrac); return Eigen::Map<Eigen::ArrayXd>(&(vals[0]), vals.size()); };
+#define X(i) virtual EArrayd get_Ar0 ## i ## n(const double T, const double rho, const REArrayd& molefrac) const  override { auto vals = TDXDerivatives<decltype(mp.get_cref()), double, VecType>::template get_Ar0n<i>(mp.get_cref(), T, rho, asvec(molefrac)); return Eigen::Map<Eigen::ArrayXd>(&(vals[0]), vals.size()); };
     AR0N_args
 #undef X
     
+    // The batched methods loop over the state points with the concrete model type in hand, so the inner loop can be inlined
+    virtual EArrayd get_Arxy_many(const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const override {
+        internal::check_many_sizes(T, rho, molefrac);
+        using tdx = TDXDerivatives<decltype(mp.get_cref()), double, VecType>;
+        const auto& model = mp.get_cref();
+        internal::check_many_ncomp<Ncomp>(molefrac);
+        EArrayd out(T.size());
+        VecType z; z.resize(molefrac.cols());
+        for (auto i = 0; i < T.size(); ++i){
+            z = molefrac.row(i).transpose(); // Buffer is re-used, no allocation
+            out(i) = tdx::get_Ar(NT, ND, model, T(i), rho(i), z);
+        }
+        return out;
+    };
+    virtual EMatrixd get_Ar0n_many(const int Nderiv, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const override {
+        internal::check_many_sizes(T, rho, molefrac);
+        using tdx = TDXDerivatives<decltype(mp.get_cref()), double, VecType>;
+        const auto& model = mp.get_cref();
+        internal::check_many_ncomp<Ncomp>(molefrac);
+        EMatrixd out(T.size(), Nderiv+1);
+        VecType z; z.resize(molefrac.cols());
+        auto fill = [&](auto Nconst){
+            constexpr int N = decltype(Nconst)::value;
+            for (auto i = 0; i < T.size(); ++i){
+                z = molefrac.row(i).transpose();
+                auto vals = tdx::template get_Ar0n<N>(model, T(i), rho(i), z);
+                for (auto j = 0; j <= N; ++j){ out(i, j) = vals[j]; }
+            }
+        };
+        switch(Nderiv){
+            #define X(i) case i: fill(std::integral_constant<int, i>{}); break;
+                AR0N_args
+            #undef X
+            default:
+                throw teqp::InvalidArgument("Nderiv of " + std::to_string(Nderiv) + " is not supported in get_Ar0n_many");
+        }
+        return out;
+    };
+    
     // Virial derivatives
-    virtual double get_B2vir(const double T, const EArrayd& z) const override {
-        return VirialDerivatives<decltype(mp.get_cref()), double, EArrayd>::get_B2vir(mp.get_cref(), T, z);
+    virtual double get_B2vir(const double T, const REArrayd& z) const override {
+        return VirialDerivatives<decltype(mp.get_cref()), double, VecType>::get_B2vir(mp.get_cref(), T, asvec(z));
     };
-    virtual std::map<int, double> get_Bnvir(const int Nderiv, const double T, const EArrayd& z) const override {
-        return VirialDerivatives<decltype(mp.get_cref()), double, EArrayd>::get_Bnvir_runtime(Nderiv, mp.get_cref(), T, z);
+    virtual std::map<int, double> get_Bnvir(const int Nderiv, const double T, const REArrayd& z) const override {
+        return VirialDerivatives<decltype(mp.get_cref()), double, VecType>::get_Bnvir_runtime(Nderiv, mp.get_cref(), T, asvec(z));
     };
-    virtual double get_B12vir(const double T, const EArrayd& z) const override {
-        return VirialDerivatives<decltype(mp.get_cref()), double, EArrayd>::get_B12vir(mp.get_cref(), T, z);
+    virtual double get_B12vir(const double T, const REArrayd& z) const override {
+        return VirialDerivatives<decltype(mp.get_cref()), double, VecType>::get_B12vir(mp.get_cref(), T, asvec(z));
     };
-    virtual double get_dmBnvirdTm(const int Nderiv, const int NTderiv, const double T, const EArrayd& molefrac) const override {
-        return VirialDerivatives<decltype(mp.get_cref()), double, EArrayd>::get_dmBnvirdTm_runtime(Nderiv, NTderiv, mp.get_cref(), T, molefrac);
+    virtual double get_dmBnvirdTm(const int Nderiv, const int NTderiv, const double T, const REArrayd& molefrac) const override {
+        return VirialDerivatives<decltype(mp.get_cref()), double, VecType>::get_dmBnvirdTm_runtime(Nderiv, NTderiv, mp.get_cref(), T, asvec(molefrac));
+    };
+    virtual EMatrixd get_dmBnvirdTm_matrix(const int Nmax, const int NTmax, const double T, const REArrayd& molefrac) const override {
+        return VirialDerivatives<decltype(mp.get_cref()), double, VecType>::get_dmBnvirdTm_matrix_runtime(Nmax, NTmax, mp.get_cref(), T, asvec(molefrac));
     };
     
     // Derivatives from isochoric thermodynamics (all have the same signature within each block), and they differ by their output argument
-#define X(f) virtual double f(const double T, const EArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, EArrayd>::f(mp.get_cref(), T, rhovec); };
+#define X(f) virtual double f(const double T, const REArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, VecType>::f(mp.get_cref(), T, asvec(rhovec)); };
     ISOCHORIC_double_args
 #undef X
-#define X(f) virtual EArrayd f(const double T, const EArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, EArrayd>::f(mp.get_cref(), T, rhovec); };
+#define X(f) virtual EArrayd f(const double T, const REArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, VecType>::f(mp.get_cref(), T, asvec(rhovec)); };
     ISOCHORIC_array_args
 #undef X
-#define X(f) virtual EMatrixd f(const double T, const EArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, EArrayd>::f(mp.get_cref(), T, rhovec); };
+#define X(f) virtual EMatrixd f(const double T, const REArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, VecType>::f(mp.get_cref(), T, asvec(rhovec)); };
     ISOCHORIC_matrix_args
 #undef X
-#define X(f) virtual std::tuple<double, Eigen::ArrayXd, Eigen::MatrixXd> f(const double T, const EArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, EArrayd>::f(mp.get_cref(), T, rhovec); };
+#define X(f) virtual std::tuple<double, Eigen::ArrayXd, Eigen::MatrixXd> f(const double T, const REArrayd& rhovec) const override { return IsochoricDerivatives<decltype(mp.get_cref()), double, VecType>::f(mp.get_cref(), T, asvec(rhovec)); };
     ISOCHORIC_multimatrix_args
 #undef X
-    virtual Eigen::ArrayXd get_Psir_sigma_derivs(const double T, const EArrayd& rhovec, const EArrayd& v) const override{
+    virtual void build_Psir_fgradHessian_autodiff(const double T, const REArrayd& rhovec, double& Psir, Eigen::ArrayXd& gradient, Eigen::MatrixXd& Hessian) const override {
+        // One workspace per thread, so that the const methods remain reentrant
+        thread_local IsochoricWorkspace ws;
+        IsochoricDerivatives<decltype(mp.get_cref()), double, VecType>::build_Psir_fgradHessian_autodiff(mp.get_cref(), T, asvec(rhovec), ws);
+        Psir = ws.Psir;
+        gradient = ws.gradient;
+        Hessian = ws.Hessian;
+    };
+    virtual Eigen::ArrayXd get_Psir_sigma_derivs(const double T, const REArrayd& rhovec, const REArrayd& v) const override{
+        // Always dynamic, the length of the returned array depends on the number of derivatives, not the number of components
         return IsochoricDerivatives<decltype(mp.get_cref()), double, EArrayd>::get_Psir_sigma_derivs(mp.get_cref(), T, rhovec, v);
     };
     
-    virtual EArray33d get_deriv_mat2(const double T, double rho, const EArrayd& z ) const override { throw teqp::NotImplementedError("Not available"); };
+    virtual std::unique_ptr<AbstractModel> prepare_composition(const REArrayd& z) const override {
+        using ModelType = std::decay_t<decltype(mp.get_cref())>;
+        if constexpr (internal::has_prepare_composition<ModelType>::value){
+            return make_owned(mp.get_cref().prepare_composition(z));
+        }
+        else{
+            // Nothing to be cached, a view of the model is still valid at any composition
+            return make_cview(mp.get_cref());
+        }
+    };
+    
+    virtual EArray33d get_deriv_mat2(const double T, double rho, const REArrayd& z ) const override {
+        using ModelType = std::decay_t<decltype(mp.get_cref())>;
+        if constexpr (internal::has_deriv_mat2<ModelType>::value){
+            return mp.get_cref().get_deriv_mat2(T, rho, z);
+        }
+        else{
+            return DerivativeHolderSquare<2, AlphaWrapperOption::residual>(mp.get_cref(), T, rho, asvec(z)).derivs;
+        }
+    };
+    virtual double solve_rho_Tp(const double T, const double p, const REArrayd& z, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options) const override {
+        double rho = density::solve_rho_Tp(mp.get_cref(), T, p, asvec(z), phase, options.value_or(density::RhoTpOptions{}));
+        if (!std::isfinite(rho)){
+            throw teqp::IterationFailure("No density was found at T=" + std::to_string(T) + " K and p=" + std::to_string(p) + " Pa; liquid roots may need the rho_guess option");
+        }
+        return rho;
+    };
+    virtual EArrayd solve_rho_Tp_many(const REArrayd& T, const REArrayd& p, const REMatrixd& molefrac, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options) const override {
+        internal::check_many_sizes(T, p, molefrac);
+        internal::check_many_ncomp<Ncomp>(molefrac);
+        const auto& model = mp.get_cref();
+        const auto opt = options.value_or(density::RhoTpOptions{});
+        EArrayd out(T.size());
+        VecType z; z.resize(molefrac.cols());
+        for (auto i = 0; i < T.size(); ++i){
+            z = molefrac.row(i).transpose();
+            out(i) = density::solve_rho_Tp(model, T(i), p(i), z, phase, opt);
+        }
+        return out;
+    };
+    virtual EMatrixd get_deriv_matN(const int order, const double T, const double rho, const REArrayd& z) const override {
+        using tdx = TDXDerivatives<decltype(mp.get_cref()), double, VecType>;
+        switch(order){
+            #define X(i) case i: return tdx::template get_Ar_tensor<i>(mp.get_cref(), T, rho, asvec(z));
+                DERIVMATN_args
+            #undef X
+            default:
+                throw teqp::InvalidArgument("order of " + std::to_string(order) + " is not supported in get_deriv_matN");
+        }
+    };
 };
 
 template<typename TemplatedModel> auto view(const TemplatedModel& tp){
@@ -121,16 +303,37 @@ template<typename TemplatedModel> auto own(const TemplatedModel&& tp){
     return new DerivativeAdapter<decltype(o)>(internal::tag<decltype(o)>{}, std::move(o));
 }
 
-template<typename TemplatedModel> auto make_owned(const TemplatedModel& tmodel){
+template<int Ncomp, typename TemplatedModel> auto own_fixedsize(const TemplatedModel&& tp){
+    Owner o(std::move(tp));
+    return new DerivativeAdapter<decltype(o), Ncomp>(internal::tag<decltype(o)>{}, std::move(o));
+}
+
+template<typename TemplatedModel> std::unique_ptr<AbstractModel> make_owned(const TemplatedModel& tmodel){
     using namespace teqp::cppinterface;
     return std::unique_ptr<AbstractModel>(own(std::move(tmodel)));
 };
 
-template<typename TemplatedModel> auto make_cview(const TemplatedModel& tmodel){
+template<typename TemplatedModel> std::unique_ptr<AbstractModel> make_cview(const TemplatedModel& tmodel){
     using namespace teqp::cppinterface;
     return std::unique_ptr<AbstractModel>(view(tmodel));
 };
 
+/**
+ Like make_owned, but for 1, 2, or 3 components the adapter is specialized for that number of components, so that the compositions
+ and molar concentrations are passed to the model as fixed-size arrays (no heap allocation, loops that can be unrolled). For any other
+ number of components, the usual dynamically-sized adapter is returned.
+ 
+ The arguments must then always be of length Ncomp, otherwise teqp::InvalidArgument is thrown
+ */
+template<typename TemplatedModel> std::unique_ptr<AbstractModel> make_owned_fixedsize(const TemplatedModel& tmodel, const std::size_t Ncomp){
+    switch(Ncomp){
+        case 1: return std::unique_ptr<AbstractModel>(own_fixedsize<1>(std::move(tmodel)));
+        case 2: return std::unique_ptr<AbstractModel>(own_fixedsize<2>(std::move(tmodel)));
+        case 3: return std::unique_ptr<AbstractModel>(own_fixedsize<3>(std::move(tmodel)));
+        default: return make_owned(tmodel);
+    }
+};
+
 /**
  Get a const reference to the model
  
@@ -142,6 +345,9 @@ const ModelType& get_model_cref(const AbstractModel *am)
     if (am == nullptr){
         throw teqp::InvalidArgument("Argument to get_model_cref is a nullptr");
     }
+    while (const auto* decorated = am->get_decorated()){
+        am = decorated;
+    }
     const auto* mptr = dynamic_cast<const DerivativeAdapter<ConstViewer<const ModelType>>*>(am);
     const auto* mptr2 = dynamic_cast<const DerivativeAdapter<Owner<const ModelType>>*>(am);
     if (mptr != nullptr){
@@ -150,6 +356,16 @@ const ModelType& get_model_cref(const AbstractModel *am)
     else if (mptr2 != nullptr){
         return mptr2->get_ModelPack_cref().get_cref();
     }
+    // The fixed-size adapters from make_owned_fixedsize
+    else if (const auto* m1 = dynamic_cast<const DerivativeAdapter<Owner<const ModelType>, 1>*>(am); m1 != nullptr){
+        return m1->get_ModelPack_cref().get_cref();
+    }
+    else if (const auto* m2 = dynamic_cast<const DerivativeAdapter<Owner<const ModelType>, 2>*>(am); m2 != nullptr){
+        return m2->get_ModelPack_cref().get_cref();
+    }
+    else if (const auto* m3 = dynamic_cast<const DerivativeAdapter<Owner<const ModelType>, 3>*>(am); m3 != nullptr){
+        return m3->get_ModelPack_cref().get_cref();
+    }
     else{
         throw teqp::InvalidArgument("Unable to cast model to desired type");
     }
@@ -166,6 +382,10 @@ ModelType& get_model_ref(AbstractModel *am)
     if (am == nullptr){
         throw teqp::InvalidArgument("Argument to get_model_ref is a nullptr");
     }
+    while (const auto* decorated = am->get_decorated()){
+        // Decorators own the model that they wrap, so it is not actually const
+        am = const_cast<AbstractModel*>(decorated);
+    }
     auto* mptr2 = dynamic_cast<DerivativeAdapter<Owner<ModelType>>*>(am);
     if (mptr2 != nullptr){
         return mptr2->get_ModelPack_ref().get_ref();
@@ -13,23 +13,28 @@ struct IterationMatrices{
 };
 
 /**
- \brief A convenience function for calculation of Jacobian terms of the form \f$ J_{i0} = \frac{\partial y}{\partial T} \f$  and \f$ J_{i1} = \frac{\partial y}{\partial \rho} \f$ where \f$y\f$ is one of the thermodynamic variables in vars
- 
- \param vars A set of chars, allowed are 'H','S','U','P','T','D'
- \param Ar The matrix of derivatives of \f$\alpha^{\rm r}\f$, perhaps obtained from teqp::DerivativeHolderSquare, or via get_deriv_mat2 of the AbstractModel
- \param Aig The matrix of derivatives of \f$\alpha^{\rm ig}\f$, perhaps obtained from teqp::DerivativeHolderSquare, or via get_deriv_mat2 of the AbstractModel
+ The fixed-size counterpart of IterationMatrices for a pair of variables, held on the stack
+ */
+struct IterationMatrices2{
+    Eigen::Array22d J; ///< The Jacobian
+    Eigen::Array2d v; ///< The values of the two thermodynamic variables
+};
+
+/**
+ \brief The value of one thermodynamic variable and its derivatives with respect to T and rho, as used in the rows of build_iteration_Jv
+
+ \tparam var One of 'H','S','U','P','T','D'
+ \param Ar The matrix of derivatives of \f$\alpha^{\rm r}\f$; only the entries needed for var are used (see get_iteration_needed_derivs)
+ \param A The matrix of derivatives of the total \f$\alpha\f$, the sum of the residual and ideal-gas matrices
  \param R The molar gas constant
  \param T Temperature
  \param rho Molar density
- \param z Mole fractions
+ \param v The value of the variable
+ \param dvdT The derivative of the variable with respect to T at constant rho
+ \param dvdrho The derivative of the variable with respect to rho at constant T
  */
-template<typename Array>
-auto build_iteration_Jv(const std::vector<char>& vars, const Eigen::Array<double, 3, 3>& Ar, const Eigen::Array<double, 3, 3>& Aig, const double R, const double T, const double rho, const Array &z){
-    IterationMatrices im; im.J.resize(vars.size(), 2); im.v.resize(vars.size()); im.vars = vars;
-    
-    auto A = Ar + Aig;
-    Eigen::ArrayXd& v = im.v;
-    Eigen::ArrayXXd& J = im.J;
+template<char var>
+inline void get_iteration_row(const Eigen::Array<double, 3, 3>& Ar, const Eigen::Array<double, 3, 3>& A, const double R, const double T, const double rho, double& v, double& dvdT, double& dvdrho){
     auto Trecip = 1.0/T;
     auto dTrecipdT = -Trecip*Trecip;
     
@@ -46,42 +51,161 @@ auto build_iteration_Jv(const std::vector<char>& vars, const Eigen::Array<double
     auto dalphadrho = [&](){ return A(0,1)/rho; };
     auto d2alphadTrecip2 = [&](){ return A(2,0)/(Trecip*Trecip); };
     auto d2alphadTrecipdrho = [&](){ return A(1,1)/(Trecip*rho); };
-    auto d2alphadrho2 = [&](){ return A(0,2)/(rho*rho); };
     //
     // Derivatives of total Helmholtz energy a in terms of derivatives of alpha
     auto dadTrecip = [&](){ return R/(Trecip*Trecip)*(Trecip*dalphadTrecip()-alpha());};
     auto d2adTrecip2 = [&](){ return R/(Trecip*Trecip*Trecip)*(Trecip*Trecip*d2alphadTrecip2()-2*Trecip*dalphadTrecip()+2*alpha());};
-    auto dadrho = [&](){return R/Trecip*(dalphadrho());};
-    auto d2adrho2 = [&](){return R/Trecip*(d2alphadrho2());};
     auto d2adTrecipdrho = [&](){ return R/(Trecip*Trecip)*(Trecip*d2alphadTrecipdrho()-dalphadrho());};
     
+    if constexpr (var == 'T'){
+        v = T;
+        dvdT = 1.0;
+        dvdrho = 0.0;
+    }
+    else if constexpr (var == 'D'){
+        v = rho;
+        dvdT = 0.0;
+        dvdrho = 1.0;
+    }
+    else if constexpr (var == 'P'){
+        v = rho*R*T*(1 + Ar(0,1));
+        dvdT = rho*R*(1 + Ar(0,1) - Ar(1,1));
+        dvdrho = R*T*(1 + 2*Ar(0,1) + Ar(0,2));
+    }
+    else if constexpr (var == 'S'){
+        v = Trecip*Trecip*dadTrecip();
+        dvdT = (Trecip*Trecip*d2adTrecip2() + 2*Trecip*dadTrecip())*dTrecipdT;
+        dvdrho = Trecip*Trecip*d2adTrecipdrho();
+    }
+    else if constexpr (var == 'U'){
+        // u = RT*A10
+        v = R*T*A(1,0);
+        dvdT = -R*A(2,0);
+        dvdrho = R*T*A(1,1)/rho;
+    }
+    else if constexpr (var == 'H'){
+        // h = RT*(A10 + A01), the ideal-gas part of A01 being 1
+        v = R*T*(A(1,0) + A(0,1));
+        dvdT = R*(A(0,1) - A(2,0) - A(1,1));
+        dvdrho = R*T*(A(1,1) + A(0,1) + A(0,2))/rho;
+    }
+    else{
+        static_assert(var == 'T', "var must be one of 'H','S','U','P','T','D'");
+    }
+}
+
+/// The same as the templated get_iteration_row, with the variable selected at runtime
+inline void get_iteration_row(const char var, const Eigen::Array<double, 3, 3>& Ar, const Eigen::Array<double, 3, 3>& A, const double R, const double T, const double rho, double& v, double& dvdT, double& dvdrho){
+    switch(var){
+        case 'T': return get_iteration_row<'T'>(Ar, A, R, T, rho, v, dvdT, dvdrho);
+        case 'D': return get_iteration_row<'D'>(Ar, A, R, T, rho, v, dvdT, dvdrho);
+        case 'P': return get_iteration_row<'P'>(Ar, A, R, T, rho, v, dvdT, dvdrho);
+        case 'S': return get_iteration_row<'S'>(Ar, A, R, T, rho, v, dvdT, dvdrho);
+        case 'U': return get_iteration_row<'U'>(Ar, A, R, T, rho, v, dvdT, dvdrho);
+        case 'H': return get_iteration_row<'H'>(Ar, A, R, T, rho, v, dvdT, dvdrho);
+        default:
+            throw std::invalid_argument("bad var: " + std::to_string(var));
+    }
+}
+
+/**
+ \brief The entries (i,j) of the matrices of derivatives of \f$\alpha^{\rm r}\f$ and \f$\alpha^{\rm ig}\f$ that get_iteration_row needs for var
+ 
+ \returns A tuple of the 3x3 masks of the needed entries of the residual and of the ideal-gas matrices
+ */
+inline auto get_iteration_needed_derivs(const char var){
+    Eigen::Array<bool, 3, 3> r = Eigen::Array<bool, 3, 3>::Constant(false), ig = Eigen::Array<bool, 3, 3>::Constant(false);
+    auto total = [&](std::initializer_list<std::pair<int, int>> ij){
+        for (auto [i, j] : ij){ r(i, j) = true; ig(i, j) = true; }
+    };
+    switch(var){
+        case 'T': case 'D': break;
+        case 'P': r(0,1) = true; r(1,1) = true; r(0,2) = true; break;
+        case 'S': total({{0,0}, {1,0}, {0,1}, {2,0}, {1,1}}); break;
+        case 'U': total({{1,0}, {2,0}, {1,1}}); break;
+        case 'H': total({{1,0}, {0,1}, {2,0}, {1,1}, {0,2}}); break;
+        default:
+            throw std::invalid_argument("bad var: " + std::to_string(var));
+    }
+    return std::make_tuple(r, ig);
+}
+
+/**
+ \brief A convenience function for calculation of Jacobian terms of the form \f$ J_{i0} = \frac{\partial y}{\partial T} \f$  and \f$ J_{i1} = \frac{\partial y}{\partial \rho} \f$ where \f$y\f$ is one of the thermodynamic variables in vars
+ 
+ \param vars A set of chars, allowed are 'H','S','U','P','T','D'
+ \param Ar The matrix of derivatives of \f$\alpha^{\rm r}\f$, perhaps obtained from teqp::DerivativeHolderSquare, or via get_deriv_mat2 of the AbstractModel
+ \param Aig The matrix of derivatives of \f$\alpha^{\rm ig}\f$, perhaps obtained from teqp::DerivativeHolderSquare, or via get_deriv_mat2 of the AbstractModel
+ \param R The molar gas constant
+ \param T Temperature
+ \param rho Molar density
+ \param z Mole fractions
+ */
+template<typename Array>
+auto build_iteration_Jv(const std::vector<char>& vars, const Eigen::Array<double, 3, 3>& Ar, const Eigen::Array<double, 3, 3>& Aig, const double R, const double T, const double rho, const Array &z){
+    IterationMatrices im; im.J.resize(vars.size(), 2); im.v.resize(vars.size()); im.vars = vars;
+    
+    Eigen::Array<double, 3, 3> A = Ar + Aig;
     for (auto i = 0; i < vars.size(); ++i){
-        switch(vars[i]){
-            case 'T':
-                v(i) = T;
-                J(i, 0) = 1.0;
-                J(i, 1) = 0.0;
-                break;
-            case 'D':
-                v(i) = rho;
-                J(i, 0) = 0.0;
-                J(i, 1) = 1.0;
-                break;
-            case 'P':
-                v(i) = rho*R*T*(1 + Ar(0,1));
-                J(i, 0) = rho*R*(1 + Ar(0,1) - Ar(1,1));
-                J(i, 1) = R*T*(1 + 2*Ar(0,1) + Ar(0,2));
-                break;
-            case 'S':
-                v(i) = Trecip*Trecip*dadTrecip();
-                J(i, 0) = (Trecip*Trecip*d2adTrecip2() + 2*Trecip*dadTrecip())*dTrecipdT;
-                J(i, 1) = Trecip*Trecip*d2adTrecipdrho();
-                break;
+        get_iteration_row(vars[i], Ar, A, R, T, rho, im.v(i), im.J(i, 0), im.J(i, 1));
+    }
+    return im;
+}
+
+
+/**
+ \brief The fixed-size version of build_iteration_Jv, for a pair of variables known at compile time
+ 
+ \tparam var0 The variable of the first row, one of 'H','S','U','P','T','D'
+ \tparam var1 The variable of the second row, one of 'H','S','U','P','T','D'
+ */
+template<char var0, char var1>
+IterationMatrices2 build_iteration_Jv(const Eigen::Array<double, 3, 3>& Ar, const Eigen::Array<double, 3, 3>& Aig, const double R, const double T, const double rho){
+    IterationMatrices2 im;
+    Eigen::Array<double, 3, 3> A = Ar + Aig;
+    get_iteration_row<var0>(Ar, A, R, T, rho, im.v(0), im.J(0, 0), im.J(0, 1));
+    get_iteration_row<var1>(Ar, A, R, T, rho, im.v(1), im.J(1, 0), im.J(1, 1));
+    return im;
+}
+
+/// A pointer to one of the instantiations of the fixed-size build_iteration_Jv
+using IterationJvFunction = IterationMatrices2(*)(const Eigen::Array<double, 3, 3>&, const Eigen::Array<double, 3, 3>&, const double, const double, const double);
+
+namespace internal{
+    template<char var0>
+    IterationJvFunction get_iteration_Jv_function(const char var1){
+        switch(var1){
+            case 'T': return &build_iteration_Jv<var0, 'T'>;
+            case 'D': return &build_iteration_Jv<var0, 'D'>;
+            case 'P': return &build_iteration_Jv<var0, 'P'>;
+            case 'S': return &build_iteration_Jv<var0, 'S'>;
+            case 'U': return &build_iteration_Jv<var0, 'U'>;
+            case 'H': return &build_iteration_Jv<var0, 'H'>;
             default:
-                throw std::invalid_argument("bad var: " + std::to_string(vars[i]));
+                throw std::invalid_argument("bad var: " + std::to_string(var1));
         }
     }
-    return im;
+}
+
+/**
+ \brief Select the instantiation of the fixed-size build_iteration_Jv for a pair of variables given at runtime, so that the dispatch is done once rather than in each step
+ 
+ \param vars The two variables, allowed are 'H','S','U','P','T','D'
+ */
+inline IterationJvFunction get_iteration_Jv_function(const std::vector<char>& vars){
+    if (vars.size() != 2){
+        throw std::invalid_argument("Two variables must be provided; " + std::to_string(vars.size()) + " were given");
+    }
+    switch(vars[0]){
+        case 'T': return internal::get_iteration_Jv_function<'T'>(vars[1]);
+        case 'D': return internal::get_iteration_Jv_function<'D'>(vars[1]);
+        case 'P': return internal::get_iteration_Jv_function<'P'>(vars[1]);
+        case 'S': return internal::get_iteration_Jv_function<'S'>(vars[1]);
+        case 'U': return internal::get_iteration_Jv_function<'U'>(vars[1]);
+        case 'H': return internal::get_iteration_Jv_function<'H'>(vars[1]);
+        default:
+            throw std::invalid_argument("bad var: " + std::to_string(vars[0]));
+    }
 }
 
 }
@@ -0,0 +1,338 @@
+#pragma once
+
+/*
+ The kernels of the batched evaluation of the residual derivatives, see teqp/cpp/batch_device.hpp.  This header is compiled
+ both by the host compiler (for the host backend) and by nvcc (for the CUDA backend), so it uses neither the containers of
+ the standard library nor Eigen: the coefficients of a model are flattened into one array of doubles and one of ints, which
+ are uploaded once, and the kernels only do plain arithmetic on them.
+ */
+
+#include <cmath>
+
+#if defined(__CUDACC__)
+#define TEQP_HD __host__ __device__
+#else
+#define TEQP_HD
+#endif
+
+namespace teqp{
+namespace device{
+namespace kernels{
+
+constexpr int max_order = 6; ///< The largest order of the derivatives in each of T and rho
+constexpr int max_cubic_components = 32; ///< The largest number of components of a cubic model, whose alpha functions are held in local memory
+
+enum ModelKind : int { cubic = 0, multifluid = 1 };
+enum AlphaKind : int { alpha_basic = 0, alpha_Twu = 1 };
+enum ReducingKind : int { reducing_GERG = 0, reducing_invariant = 1 };
+
+/**
+ All the EOS terms of the multifluid model have the form
+ \f[
+ n\tau^t\delta^d\exp\left(-c_d\delta^{l_d} - c_t\tau^{l_t} - \eta(\delta-\epsilon)^2 - \beta_d(\delta-\gamma_d) - \beta_t(\tau-\gamma_t)^2\right)
+ \f]
+ with some of the coefficients zero, so they are held in one structure of arrays, with the coefficient c of the term k at
+ d[o_terms + c*Nterms + k].  All the states evaluate the same term at the same time, so there is no divergence on the device.
+ */
+enum TermCoeff : int { c_n = 0, c_t, c_d, c_cd, c_ld, c_ct, c_lt, c_eta, c_eps, c_bd, c_gd, c_bt, c_gt, Ntermcoeffs };
+
+/// The layout of the flattened coefficients of a model; all the o_ members are offsets in the arrays d (doubles) or i (ints)
+struct Plan{
+    int kind = cubic;
+    int N = 0; ///< The number of components
+    double R = 0; ///< The gas constant of the model
+
+    // Cubic: d holds ai, bi, kmat (N*N, row-major) and 4 coefficients of the alpha function per component (Tc, then m or c0, c1, c2); i holds the kind of each alpha function
+    double Delta1 = 0, Delta2 = 0;
+    int o_ai = 0, o_bi = 0, o_kmat = 0, o_alpha = 0, o_alphakind = 0;
+
+    // Multifluid: d holds Tc, vc, then 4 matrices (N*N, row-major) of the reducing function and the terms; i holds the ranges of the terms of the fluids and of the pairs
+    int reducing = reducing_GERG; ///< For GERG, the matrices are beta_T^2, Y_T, beta_v^2, Y_v; for the invariant form, phi_T*Y_T, lambda_T*Y_T, phi_v*Y_v, lambda_v*Y_v
+    int o_Tc = 0, o_vc = 0, o_red = 0;
+    int Nterms = 0, o_terms = 0;
+    int o_fluid_ranges = 0; ///< N+1 ints: the terms of fluid k are [r[k], r[k+1])
+    int Npairs = 0, o_pairs = 0, o_pairs_F = 0; ///< 4 ints per departure pair: i, j, first term, end of the terms; and F_ij in d
+};
+
+/// A plan with the pointers to its coefficients, either on the host or on the device
+struct PlanView{
+    Plan plan;
+    const double* d = nullptr;
+    const int* i = nullptr;
+};
+
+/// The falling factorial \f$p(p-1)\cdots(p-m+1)\f$
+TEQP_HD inline double falling(const double p, const int m){
+    double r = 1.0;
+    for (int k = 0; k < m; ++k){ r *= (p - k); }
+    return r;
+}
+
+/**
+ As analytic::scaled_derivs, with the order N given at runtime: for \f$ g(x) = x^p\exp(h(x)) \f$ and \f$a_m = x^m h^{(m)}(x)\f$
+ in a[1..N], out[k] = \f$ x^k g^{(k)}(x)/g(x) \f$ for \f$k=0,\ldots,N\f$
+ */
+TEQP_HD inline void scaled_derivs(const double p, const double* a, const int N, double* out){
+    double e[max_order + 1];
+    e[0] = 1.0;
+    for (int k = 0; k < N; ++k){
+        double s = 0.0, binom = 1.0;
+        for (int m = 0; m <= k; ++m){
+            s += binom*a[m + 1]*e[k - m];
+            binom = binom*(k - m)/(m + 1);
+        }
+        e[k + 1] = s;
+    }
+    for (int k = 0; k <= N; ++k){
+        double s = 0.0, binom = 1.0;
+        for (int m = 0; m <= k; ++m){
+            s += binom*falling(p, m)*e[k - m];
+            binom = binom*(k - m)/(m + 1);
+        }
+        out[k] = s;
+    }
+}
+
+/// Add to a[1..N] the coefficients \f$x^m h^{(m)}\f$ of \f$h = -cx^l - \eta(x-\epsilon)^2 - \beta(x-\gamma)\f$
+TEQP_HD inline void add_exponent_coeffs(const double c, const double l, const double eta, const double epsilon, const double beta, const double x, const int N, double* a){
+    if (c != 0){
+        const double xl = pow(x, l);
+        for (int m = 1; m <= N; ++m){ a[m] += -c*falling(l, m)*xl; }
+    }
+    if (N >= 1){ a[1] += x*(-2.0*eta*(x - epsilon) - beta); }
+    if (N >= 2){ a[2] += -2.0*eta*x*x; }
+}
+
+/// Add w times the block \f$\tau^i\delta^j\partial^{i+j}\alpha^r/\partial\tau^i\partial\delta^j\f$ of the terms [first, last) to block, of shape (NT+1, ND+1), row-major
+TEQP_HD inline void add_terms(const PlanView& P, const int first, const int last, const double w, const double tau, const double delta, const int NT, const int ND, double* block){
+    const int Nt = P.plan.Nterms;
+    const double* c = P.d + P.plan.o_terms;
+    const double lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+    double aT[max_order + 1], aD[max_order + 1], ST[max_order + 1], SD[max_order + 1];
+    for (int k = first; k < last; ++k){
+        const double n = c[c_n*Nt + k], t = c[c_t*Nt + k], d = c[c_d*Nt + k];
+        const double cd = c[c_cd*Nt + k], ld = c[c_ld*Nt + k], ct = c[c_ct*Nt + k], lt = c[c_lt*Nt + k];
+        const double eta = c[c_eta*Nt + k], eps = c[c_eps*Nt + k], bd = c[c_bd*Nt + k], gd = c[c_gd*Nt + k];
+        const double bt = c[c_bt*Nt + k], gt = c[c_gt*Nt + k];
+        double h = -eta*(delta - eps)*(delta - eps) - bd*(delta - gd) - bt*(tau - gt)*(tau - gt);
+        if (cd != 0){ h -= cd*pow(delta, ld); }
+        if (ct != 0){ h -= ct*pow(tau, lt); }
+        double v;
+        if (delta == 0){
+            // Only the terms with d = 0 are nonzero at zero density
+            v = (d == 0) ? n*exp(t*lntau + h) : 0.0;
+        }
+        else{
+            v = n*exp(t*lntau + d*lndelta + h);
+        }
+        if (v == 0){ continue; }
+        for (int m = 0; m <= max_order; ++m){ aT[m] = 0.0; aD[m] = 0.0; }
+        add_exponent_coeffs(ct, lt, bt, gt, 0.0, tau, NT, aT);
+        add_exponent_coeffs(cd, ld, eta, eps, bd, delta, ND, aD);
+        scaled_derivs(t, aT, NT, ST);
+        scaled_derivs(d, aD, ND, SD);
+        for (int i = 0; i <= NT; ++i){
+            for (int j = 0; j <= ND; ++j){
+                block[i*(ND + 1) + j] += w*v*ST[i]*SD[j];
+            }
+        }
+    }
+}
+
+/// The reducing function Y (the temperature, or the molar volume if which is 1) at the mole fractions x[k*ldx]
+TEQP_HD inline double reducing_Y(const PlanView& P, const int which, const double* x, const long ldx){
+    const int N = P.plan.N;
+    const double* Yc = P.d + ((which == 0) ? P.plan.o_Tc : P.plan.o_vc);
+    const double* A = P.d + P.plan.o_red + 2*which*N*N;
+    const double* B = A + N*N;
+    double Y = 0.0;
+    if (P.plan.reducing == reducing_GERG){
+        // A holds beta^2 and B holds Y_ij
+        for (int i = 0; i < N; ++i){
+            const double zi = x[i*ldx];
+            Y += zi*zi*Yc[i];
+            for (int j = i + 1; j < N; ++j){
+                const double zj = x[j*ldx], D = A[i*N + j]*zi + zj;
+                if (D == 0.0){ continue; }
+                Y += 2.0*zi*zj*(zi + zj)/D*B[i*N + j];
+            }
+        }
+    }
+    else{
+        // A holds phi*Y_ij and B holds lambda*Y_ij
+        for (int i = 0; i < N; ++i){
+            const double zi = x[i*ldx];
+            for (int j = 0; j < N; ++j){
+                const double zj = x[j*ldx];
+                Y += zi*zj*(A[i*N + j] + zj*B[i*N + j]);
+            }
+        }
+    }
+    return Y;
+}
+
+/// The block of \f$\Lambda^{\rm r}_{ij}\f$ of the multifluid model
+TEQP_HD inline void multifluid_block(const PlanView& P, const int NT, const int ND, const double T, const double rho, const double* x, const long ldx, double* block){
+    const double tau = reducing_Y(P, 0, x, ldx)/T, delta = rho*reducing_Y(P, 1, x, ldx);
+    const int* fr = P.i + P.plan.o_fluid_ranges;
+    for (int k = 0; k < P.plan.N; ++k){
+        const double xk = x[k*ldx];
+        if (xk != 0){
+            add_terms(P, fr[k], fr[k + 1], xk, tau, delta, NT, ND, block);
+        }
+    }
+    const int* pairs = P.i + P.plan.o_pairs;
+    const double* F = P.d + P.plan.o_pairs_F;
+    for (int p = 0; p < P.plan.Npairs; ++p){
+        const double w = x[pairs[4*p]*ldx]*x[pairs[4*p + 1]*ldx]*F[p];
+        if (w != 0){
+            add_terms(P, pairs[4*p + 2], pairs[4*p + 3], w, tau, delta, NT, ND, block);
+        }
+    }
+}
+
+/*
+ Truncated Taylor series in one variable (forward-mode duals of arbitrary order): c[k] = f^(k)/k! for k = 0..K
+ */
+
+/// out = a*b
+TEQP_HD inline void jet_mul(const double* a, const double* b, const int K, double* out){
+    double r[max_order + 1];
+    for (int k = 0; k <= K; ++k){
+        double s = 0.0;
+        for (int m = 0; m <= k; ++m){ s += a[m]*b[k - m]; }
+        r[k] = s;
+    }
+    for (int k = 0; k <= K; ++k){ out[k] = r[k]; }
+}
+
+/// out = a^p, for a[0] > 0
+TEQP_HD inline void jet_pow(const double* a, const double p, const int K, double* out){
+    double r[max_order + 1];
+    r[0] = pow(a[0], p);
+    for (int k = 1; k <= K; ++k){
+        double s = 0.0;
+        for (int m = 1; m <= k; ++m){ s += (p*m - (k - m))*a[m]*r[k - m]; }
+        r[k] = s/(k*a[0]);
+    }
+    for (int k = 0; k <= K; ++k){ out[k] = r[k]; }
+}
+
+/// out = exp(a)
+TEQP_HD inline void jet_exp(const double* a, const int K, double* out){
+    double r[max_order + 1];
+    r[0] = exp(a[0]);
+    for (int k = 1; k <= K; ++k){
+        double s = 0.0;
+        for (int m = 1; m <= k; ++m){ s += m*a[m]*r[k - m]; }
+        r[k] = s/k;
+    }
+    for (int k = 0; k <= K; ++k){ out[k] = r[k]; }
+}
+
+/**
+ The block of \f$\Lambda^{\rm r}_{ij}\f$ of the generic cubic model.  As in GenericCubic::get_Arxy_analytic,
+ \f$\alpha^{\rm r} = \Psi^-(\rho) - \frac{a(T)}{RT}\Psi^+(\rho)\f$, but the derivatives of \f$a(T)/(RT)\f$ in \f$u=1/T\f$ are
+ carried to any order by Taylor series in u through the alpha functions and the mixing rule.
+ */
+TEQP_HD inline void cubic_block(const PlanView& P, const int NT, const int ND, const double T, const double rho, const double* x, const long ldx, double* block){
+    const int N = P.plan.N;
+    const double* ai = P.d + P.plan.o_ai;
+    const double* bi = P.d + P.plan.o_bi;
+    const double* kmat = P.d + P.plan.o_kmat;
+    const double* alpha = P.d + P.plan.o_alpha;
+    const int* alphakind = P.i + P.plan.o_alphakind;
+    const double u = 1.0/T;
+    const int K = NT;
+
+    // q_k = sqrt(a_k alpha_k(T)) as series in u, with T/Tc = 1/(u Tc)
+    double q[max_cubic_components][max_order + 1], Tr[max_order + 1], w[max_order + 1];
+    for (int k = 0; k < N; ++k){
+        const double Tci = alpha[4*k];
+        double uk = 1.0/u; // (-1)^m u^(-m-1), the coefficients of 1/u
+        for (int m = 0; m <= K; ++m){ Tr[m] = uk/Tci; uk *= -1.0/u; }
+        if (alphakind[k] == alpha_basic){
+            // sqrt(alpha) = |1 + m(1 - sqrt(T/Tc))|
+            const double mi = alpha[4*k + 1];
+            jet_pow(Tr, 0.5, K, w);
+            for (int m = 0; m <= K; ++m){ w[m] *= -mi; }
+            w[0] += 1.0 + mi;
+            const double sign = (w[0] < 0) ? -1.0 : 1.0;
+            for (int m = 0; m <= K; ++m){ q[k][m] = sign*sqrt(ai[k])*w[m]; }
+        }
+        else{
+            // sqrt(alpha) = (T/Tc)^(c2(c1-1)/2) exp(c0(1 - (T/Tc)^(c1c2))/2)
+            const double c0 = alpha[4*k + 1], c1 = alpha[4*k + 2], c2 = alpha[4*k + 3];
+            double e[max_order + 1];
+            jet_pow(Tr, c1*c2, K, e);
+            for (int m = 0; m <= K; ++m){ e[m] *= -0.5*c0; }
+            e[0] += 0.5*c0;
+            jet_exp(e, K, e);
+            jet_pow(Tr, 0.5*c2*(c1 - 1), K, w);
+            jet_mul(w, e, K, w);
+            for (int m = 0; m <= K; ++m){ q[k][m] = sqrt(ai[k])*w[m]; }
+        }
+    }
+    // a = sum_i x_i q_i sum_j x_j (1-k_ij) q_j
+    double a[max_order + 1], s[max_order + 1];
+    for (int m = 0; m <= K; ++m){ a[m] = 0.0; }
+    for (int i = 0; i < N; ++i){
+        const double xi = x[i*ldx];
+        if (xi == 0){ continue; }
+        for (int m = 0; m <= K; ++m){ s[m] = 0.0; }
+        for (int j = 0; j < N; ++j){
+            const double wij = x[j*ldx]*(1.0 - kmat[i*N + j]);
+            for (int m = 0; m <= K; ++m){ s[m] += wij*q[j][m]; }
+        }
+        jet_mul(q[i], s, K, s);
+        for (int m = 0; m <= K; ++m){ a[m] += xi*s[m]; }
+    }
+    // A = a u/R, and its scaled derivatives u^i d^iA/du^i = i! A_i u^i
+    double A[max_order + 1];
+    for (int m = 0; m <= K; ++m){ A[m] = (u*a[m] + ((m > 0) ? a[m - 1] : 0.0))/P.plan.R; }
+    double fact = 1.0, upow = 1.0;
+    for (int m = 0; m <= K; ++m){
+        A[m] *= fact*upow;
+        fact *= (m + 1); upow *= u;
+    }
+
+    double b = 0.0;
+    for (int k = 0; k < N; ++k){ b += x[k*ldx]*bi[k]; }
+    const double X = b*rho, D1 = P.plan.Delta1, D2 = P.plan.Delta2, denom = b*(D1 - D2);
+    for (int j = 0; j <= ND; ++j){
+        double Psiminus, Psiplus;
+        if (j == 0){
+            Psiminus = -log1p(-X);
+            Psiplus = (log1p(D1*X) - log1p(D2*X))/denom;
+        }
+        else{
+            const double factorial = tgamma(static_cast<double>(j)), sign = (j % 2 == 1) ? 1.0 : -1.0;
+            Psiminus = factorial*pow(X/(1 - X), j);
+            Psiplus = sign*factorial*(pow(D1*X/(1 + D1*X), j) - pow(D2*X/(1 + D2*X), j))/denom;
+        }
+        for (int i = 0; i <= NT; ++i){
+            block[i*(ND + 1) + j] = ((i == 0) ? Psiminus : 0.0) - A[i]*Psiplus;
+        }
+    }
+}
+
+/**
+ Evaluate the block of \f$\Lambda^{\rm r}_{ij}\f$, \f$i \leq\f$ NT, \f$j \leq\f$ ND, of one state, whose mole fractions are
+ x[k*ldx]; the entry (i,j) is written to out[(i*(ND+1)+j)*ldout]
+ */
+TEQP_HD inline void evaluate_state(const PlanView& P, const int NT, const int ND, const double T, const double rho, const double* x, const long ldx, double* out, const long ldout){
+    double block[(max_order + 1)*(max_order + 1)];
+    const int Nblock = (NT + 1)*(ND + 1);
+    for (int k = 0; k < Nblock; ++k){ block[k] = 0.0; }
+    if (P.plan.kind == cubic){
+        cubic_block(P, NT, ND, T, rho, x, ldx, block);
+    }
+    else{
+        multifluid_block(P, NT, ND, T, rho, x, ldx, block);
+    }
+    for (int k = 0; k < Nblock; ++k){ out[k*ldout] = block[k]; }
+}
+
+}
+}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/parallel.hpp"
+#include "teqp/cpp/batch_device.hpp"
+#include "teqp/cpp/tables.hpp"
+#include "teqp/cpp/trace_sink.hpp"
+
+namespace teqp{
+namespace distributed{
+
+/*
+ Sweeps over many independent units of work (chunks of state points, traces, tables) that scale from one process to a
+ cluster.  All the ranks call the same sweep function with the same arguments (SPMD).  If teqp was built with TEQP_MPI and MPI
+ has been initialized by the caller, the units are distributed over the ranks of MPI_COMM_WORLD: the root rank hands out the
+ units one at a time to the ranks that ask for work, so that the traces of very different lengths are still balanced, and
+ writes the rows of the completed units to the trace sink as they arrive.  Otherwise, the units are run in this process over
+ the threads of parallel::parallel_for.  The rows of a unit are contiguous in the sink, but the units are in the order of
+ their completion; the first column, "unit", gives the index of the unit that produced the row.
+ */
+
+/// True if teqp was built with TEQP_MPI
+bool mpi_available();
+/// The rank of this process in MPI_COMM_WORLD, or 0 if MPI is not available or not initialized
+int get_rank();
+/// The number of ranks of MPI_COMM_WORLD, or 1 if MPI is not available or not initialized
+int get_size();
+
+struct SweepOptions{
+    std::string path; ///< The file of the trace sink, written by the root rank only
+    tracesink::SinkOptions sink; ///< The format of the sink
+    int root = 0; ///< The rank that hands out the units and writes the sink; with more than one rank, it does not run units itself
+    parallel::ParallelOptions threads; ///< The threads over the traces of a run in one process; chunk_size is ignored, the units are handed out one at a time.  The units of sweep_Ar_block and sweep_property_tables are run one after the other, each with the threads of its evaluator or of its table
+};
+
+struct SweepSummary{
+    std::size_t Nunits = 0; ///< The number of units of the sweep
+    std::size_t Nrows = 0; ///< The number of rows written to the sink; on the root rank only
+    int Nranks = 1; ///< The number of ranks that took part
+    std::vector<std::size_t> units_per_rank; ///< The number of units run by each rank; on the root rank only
+    std::vector<std::string> failures; ///< "unit i: message" for each unit that threw, whose rows are not written; on the root rank only
+    double elapsed_s = 0; ///< The wall time of the sweep on this rank
+};
+
+/**
+ \brief Run the units 0, ..., Nunits-1 of a sweep and write their rows to the sink
+
+ unit(i, rows) appends to rows the values of the rows of unit i, each of schema.row_width() doubles, the first of which is
+ the "unit" column.  An exception thrown by a unit is recorded in SweepSummary::failures, and the sweep goes on.  This is
+ the engine of the sweeps below, for other kinds of units.
+ */
+SweepSummary run_sweep(const std::size_t Nunits, const tracesink::Schema& schema, const std::function<void(std::size_t, std::vector<double>&)>& unit, const SweepOptions& options);
+
+/**
+ \brief The derivatives \f$\Lambda^{\rm r}_{ij}\f$ with \f$i \leq\f$ NT and \f$j \leq\f$ ND at each state point, with device::BatchEvaluator
+
+ The state points are split into units of chunk state points.  The models that the batched evaluator does not support are
+ evaluated with AbstractModel::get_Arxy_many.  The columns of the sink are "unit", "index" (of the state point) and "Ar",
+ of width (NT+1)*(ND+1), in the layout of BatchEvaluator::get_Ar_block.
+ */
+SweepSummary sweep_Ar_block(const cppinterface::AbstractModel& model, const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac, const std::size_t chunk, const SweepOptions& options, const device::BatchOptions& batch_options = {});
+
+/// One isotherm per row of the starting states, one unit per isotherm; the columns are "unit", then those of tracesink::VLE_trace_schema
+SweepSummary sweep_VLE_isotherms(const cppinterface::AbstractModel& model, const REArrayd& T, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const SweepOptions& options, const std::optional<TVLEOptions>& trace_options = std::nullopt);
+
+/// One isobar per row of the starting states, one unit per isobar; the columns are "unit", then those of tracesink::VLE_trace_schema
+SweepSummary sweep_VLE_isobars(const cppinterface::AbstractModel& model, const REArrayd& p, const REArrayd& T0, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const SweepOptions& options, const std::optional<PVLEOptions>& trace_options = std::nullopt);
+
+/// One critical locus per row of the starting states, one unit per locus; the columns are "unit", "t", "T", "rhovec" (of width 2) and "p"
+SweepSummary sweep_critical_loci(const cppinterface::AbstractModel& model, const REArrayd& T0, const REMatrixd& rhovec0, const SweepOptions& options, const std::optional<TCABOptions>& trace_options = std::nullopt);
+
+/// A table of properties of a pure fluid to be built by sweep_property_tables
+struct PropertyTableTask{
+    nlohmann::json model; ///< The residual model, for cppinterface::make_model
+    nlohmann::json aig; ///< The ideal-gas model, for cppinterface::make_model
+    nlohmann::json superancillary; ///< The spec of superancillary::build_pure_superancillary
+    tables::TableKind kind = tables::TableKind::Trho;
+    tables::PropertyTableOptions options;
+    std::string path; ///< The file to which the table is saved, by the rank that builds it
+};
+
+/// One table per task, one unit per table; the columns are "unit", "Npatches", "size_bytes" and "elapsed_s", the time to build the table
+SweepSummary sweep_property_tables(const std::vector<PropertyTableTask>& tasks, const SweepOptions& options);
+
+}
+}
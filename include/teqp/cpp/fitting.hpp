@@ -0,0 +1,95 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/async.hpp"
+
+namespace teqp{
+namespace fitting{
+
+/// The kinds of experimental data points
+enum class PointKind { density, psat, PTxy, virial };
+
+/**
+ An experimental data point for the fit.  The residuals of a point, each multiplied by its weight, are:
+
+ - density: rho/rho_exp - 1, with rho from solve_rho_Tp at T, p and the mole fractions x, in the phase given by phase
+ - psat: p/p_exp - 1, with p the saturation pressure of a pure fluid at T from pure_VLE_T
+ - PTxy: p/p_exp - 1, with p the bubble pressure at T and the liquid mole fractions x from mix_VLE_Tx, then y_i - y_exp,i
+   for the first N-1 components if y is given
+ - virial: B2 - B2_exp, in m^3/mol, so the weight of such a point is usually the reciprocal of its uncertainty
+
+ The VLE points need guesses of the molar concentrations of the phases in rhovecL0 and rhovecV0 (of length 1 for psat).
+ */
+struct DataPoint{
+    PointKind kind = PointKind::density;
+    double T = -1; ///< The temperature, in K
+    double p = -1; ///< The pressure, in Pa; specified for the density points and measured for the psat and PTxy points
+    double rho = -1; ///< The measured molar density of a density point, in mol/m^3
+    double B2 = 0; ///< The measured second virial coefficient of a virial point, in m^3/mol
+    EArrayd x; ///< The mole fractions of a density or virial point, or those of the liquid of a PTxy point
+    EArrayd y; ///< The measured mole fractions of the vapor of a PTxy point; may be empty
+    density::RhoPhase phase = density::RhoPhase::stable; ///< The phase of the root of a density point
+    EArrayd rhovecL0, rhovecV0; ///< The guesses of the molar concentrations of the phases of a VLE point
+    double weight = 1;
+};
+
+/// Build a model, once for each copy of the model used by the engine
+using ModelFactory = std::function<std::unique_ptr<cppinterface::AbstractModel>()>;
+
+/**
+ Set the parameters of a model.  The update is meant to be done in place, through cppinterface::adapter::get_model_ref and
+ the setters of the model (like set_BIP of the multifluid mutant or set_kmat of the cubic models), which is much cheaper than
+ building a new model; for the models without setters, the model may instead be replaced by a new one.
+ */
+using ParameterUpdate = std::function<void(std::unique_ptr<cppinterface::AbstractModel>& model, const EArrayd& params)>;
+
+struct ObjectiveOptions{
+    double rel_step = 1e-6; ///< The relative step of the forward differences for the Jacobian
+    double abs_step = 1e-8; ///< The smallest step of the forward differences, for the parameters that are zero
+    int maxiter = 20; ///< The maximum number of iterations of the VLE solvers
+    bool warm_start = true; ///< If true, the converged phases of each VLE point are the guesses of the next evaluation
+    double failure_residual = std::numeric_limits<double>::quiet_NaN(); ///< The value of the residuals of a point whose calculation fails
+    std::size_t chunk_size = 4; ///< The number of (point, parameter set) evaluations that a worker claims at a time
+};
+
+struct ObjectiveResult{
+    EArrayd residuals;
+    EMatrixd jacobian; ///< The derivatives of the residuals (rows) with respect to the parameters (columns), if requested
+    std::vector<bool> success; ///< False for the points whose calculation failed at the parameters (without the perturbations of the Jacobian)
+};
+
+/**
+ \brief The residuals of a fit of the parameters of a model to a set of experimental data, evaluated over a thread pool
+
+ The points are evaluated concurrently on the pool and on the calling thread, all with one copy of the model for each set of
+ parameters.  For the Jacobian, by forward differences, there is one more copy per parameter, so the evaluations at the
+ perturbed parameters run concurrently too.  The copies are built once, and then only updated in place at each call.
+
+ evaluate must not be called concurrently on the same instance.
+ */
+class FitObjective{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+public:
+    FitObjective(const std::vector<DataPoint>& points, const ModelFactory& factory, const ParameterUpdate& update, const ObjectiveOptions& options = {}, async::ThreadPool& pool = async::default_pool());
+    ~FitObjective();
+    FitObjective(const FitObjective&) = delete;
+    FitObjective& operator=(const FitObjective&) = delete;
+
+    /// The number of residuals
+    std::size_t get_Nresiduals() const;
+    /// The index of the first residual of each point
+    const std::vector<std::size_t>& get_offsets() const;
+    /// The residuals at the parameters, and the Jacobian if requested
+    ObjectiveResult evaluate(const EArrayd& params, const bool jacobian = false);
+};
+
+}
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+
+namespace teqp{
+namespace parallel{
+
+/**
+ Options for the parallel evaluators
+ */
+struct ParallelOptions{
+    std::size_t Nthreads = 0; ///< The number of threads to use, including the calling thread; 0 means std::thread::hardware_concurrency()
+    std::size_t chunk_size = 32; ///< The number of state points a worker claims at a time from the shared counter
+};
+
+/**
+ \brief Call f(istart, iend) over contiguous chunks covering [0, N), distributed over a pool of threads
+ 
+ Idle workers claim the next chunk from a shared atomic counter, so that if some state points are more expensive than
+ others, the load is still balanced.  The first exception thrown by a worker is re-thrown in the calling thread once all
+ workers have stopped.
+ 
+ parallel_for is reentrant: it shares no state between calls, as each call starts its own threads and joins them before
+ returning.  So it, and the drivers built on it, may be called from several threads at once, from inside f, or nested in
+ each other (a parallel evaluator called for each unit of an outer parallel_for, say) without deadlock.  A nested call
+ does start Nthreads threads of its own for each outer worker, so set Nthreads of the inner call to 1 to avoid
+ oversubscribing the cores.
+ */
+void parallel_for(const std::size_t N, const std::function<void(std::size_t, std::size_t)>& f, const ParallelOptions& options = {});
+
+/*
+ The evaluators below all take a const reference to an AbstractModel.  The const methods of AbstractModel are reentrant:
+ they do not modify the model, and may be called concurrently from several threads on the same instance.
+ 
+ T and rho are of length M, molefrac and rhovec are of shape (M, N), with one row per state point.
+ */
+
+/// Parallel version of AbstractModel::get_Arxy_many
+EArrayd get_Arxy_many(const cppinterface::AbstractModel& model, const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac, const ParallelOptions& options = {});
+
+/// Fugacity coefficients for each state point, returned with the shape (M, N)
+EMatrixd get_fugacity_coefficients_many(const cppinterface::AbstractModel& model, const REArrayd& T, const REMatrixd& rhovec, const ParallelOptions& options = {});
+
+/// The matrix from get_deriv_mat2 for each state point, returned with the shape (M, 9); column 3*i+j holds the (i,j) entry
+EMatrixd get_deriv_mat2_many(const cppinterface::AbstractModel& model, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac, const ParallelOptions& options = {});
+
+/// The matrix from get_dmBnvirdTm_matrix at each temperature, at the composition molefrac, for the tabulation of virial coefficients on a grid of temperatures; returned with the shape (M, (Nmax-1)*(NTmax+1)), column (n-2)*(NTmax+1)+m holds the m-th temperature derivative of B_n
+EMatrixd get_dmBnvirdTm_matrix_many(const cppinterface::AbstractModel& model, const int Nmax, const int NTmax, const REArrayd& T, const REArrayd& molefrac, const ParallelOptions& options = {});
+
+/*
+ Batch drivers for the VLE tracers, for instance to build whole phase diagrams.  Each trace is independent, and is
+ handed to a worker as a chunk of its own (the chunk_size of the options is not used).  T0 (or p) is of length M, and
+ rhovecL0 and rhovecV0 are of shape (M, 2), with one row per trace.  The traces are returned in the order of the inputs.
+ */
+
+/// Parallel version of AbstractModel::trace_VLE_isotherm_binary, one isotherm per row of the starting states
+std::vector<nlohmann::json> trace_VLE_isotherm_binary_many(const cppinterface::AbstractModel& model, const REArrayd& T0, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const std::optional<TVLEOptions>& trace_options = std::nullopt, const ParallelOptions& options = {});
+
+/// Parallel version of AbstractModel::trace_VLE_isobar_binary, one isobar per row of the starting states
+std::vector<nlohmann::json> trace_VLE_isobar_binary_many(const cppinterface::AbstractModel& model, const REArrayd& p, const REArrayd& T0, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const std::optional<PVLEOptions>& trace_options = std::nullopt, const ParallelOptions& options = {});
+
+/*
+ Batch driver for the critical tracer, for instance to screen a library of binary mixtures for the type of their critical
+ loci.  Each trace starts from a state given by a CriticalTraceStart, usually the critical point of one of the pure fluids,
+ and is run with AbstractModel::trace_critical_arclength_binary (without an output file).  The traces are distributed
+ over the workers as with the VLE tracers, and each one is handed to the callback as soon as it is complete, with a summary.
+ */
+
+/// The starting point of a critical trace
+struct CriticalTraceStart{
+    std::size_t imodel = 0; ///< The index of the model in the list of models
+    double T0 = -1; ///< The starting temperature, in K
+    EArrayd rhovec0; ///< The starting molar concentrations, in mol/m^3
+};
+
+/// Metadata of a completed critical trace, for the classification of the critical loci
+struct CriticalTraceSummary{
+    std::size_t itrace = 0, imodel = 0; ///< The index of the trace in the starting points, and the index of its model
+    bool success = false; ///< False if the tracer threw; the exception message is in message
+    std::string message;
+    std::size_t Npoints = 0; ///< The number of points of the trace
+    int ipure_start = -1; ///< The component that is pure at the start of the trace, or -1
+    int ipure_end = -1; ///< The component that is (within pure_tol) pure at the end of the trace, or -1
+    bool connects_pures = false; ///< True if the trace joins the critical points of the two pure fluids (a continuous critical locus, as in types I and II)
+    double Tmin = -1, Tmax = -1, pmax = -1; ///< The extrema of the temperature and the maximum pressure along the trace
+    double T_end = -1, p_end = -1, z0_end = -1; ///< The temperature, pressure and mole fraction of the first component at the end of the trace
+    int Nturns_T = 0; ///< The number of extrema of the temperature along the trace
+};
+
+/// The callback is called once per trace with its summary and its points, in the format of trace_critical_arclength_binary.  Calls are serialized, but come from the worker threads in the order of completion
+using CriticalTraceCallback = std::function<void(const CriticalTraceSummary&, const nlohmann::json&)>;
+
+/// Trace the critical loci from the starting points, each with its own model; the summaries are returned in the order of the starting points
+std::vector<CriticalTraceSummary> trace_critical_arclength_binary_many(const std::vector<const cppinterface::AbstractModel*>& models, const std::vector<CriticalTraceStart>& starts, const CriticalTraceCallback& callback = {}, const std::optional<TCABOptions>& trace_options = std::nullopt, const ParallelOptions& options = {}, const double pure_tol = 1e-6);
+
+/// Trace the critical loci of one model, one per row of the starting states; T0 is of length M and rhovec0 of shape (M, 2)
+std::vector<CriticalTraceSummary> trace_critical_arclength_binary_many(const cppinterface::AbstractModel& model, const REArrayd& T0, const REMatrixd& rhovec0, const CriticalTraceCallback& callback = {}, const std::optional<TCABOptions>& trace_options = std::nullopt, const ParallelOptions& options = {}, const double pure_tol = 1e-6);
+
+/*
+ Batch driver for the critical points of pure fluids, for instance to validate a library of parameterizations of a model.
+ Each critical point is solved with AbstractModel::solve_pure_critical from its own initial guess, and the chunks of the
+ options are made of models.
+ */
+
+/// The critical point of one model
+struct PureCriticalResult{
+    std::size_t imodel = 0; ///< The index of the model
+    bool success = false; ///< True if the Newton iteration converged; if the model could not be built or the solver threw, the exception message is in message
+    std::string message;
+    double Tc = -1, rhoc = -1; ///< The critical temperature, in K, and the critical molar density, in mol/m^3
+    EArrayd rhoLV; ///< The liquid and vapor densities from extrapolate_from_critical, if requested
+};
+
+/**
+ \brief Solve for the critical points of many models
+ \param models The models; any of them may be null, which is reported as a failure
+ \param T0 The initial temperatures, one per model
+ \param rho0 The initial molar densities, one per model
+ \param flags The flags passed to solve_pure_critical, the same for all models
+ \param Tr_extrapolate If given, extrapolate_from_critical is called for each converged critical point at the temperature Tr_extrapolate*Tc
+ \param options Options of the parallel evaluation
+ */
+std::vector<PureCriticalResult> solve_pure_critical_many(const std::vector<const cppinterface::AbstractModel*>& models, const REArrayd& T0, const REArrayd& rho0, const std::optional<nlohmann::json>& flags = std::nullopt, const std::optional<double>& Tr_extrapolate = std::nullopt, const ParallelOptions& options = {});
+
+/// As above, but the models are also built in parallel from their JSON specifications with cppinterface::make_model
+std::vector<PureCriticalResult> solve_pure_critical_many(const std::vector<nlohmann::json>& specs, const REArrayd& T0, const REArrayd& rho0, const std::optional<nlohmann::json>& flags = std::nullopt, const std::optional<double>& Tr_extrapolate = std::nullopt, const ParallelOptions& options = {});
+
+}
+}
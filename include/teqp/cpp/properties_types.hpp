@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace teqp{
+namespace cppinterface{
+
+namespace properties{
+/// The bits of the mask of AbstractModel::get_property_bundle, one per property; combine them with |
+enum Mask : std::uint32_t {
+    p = 1u << 0, ///< Pressure
+    h = 1u << 1, ///< Molar enthalpy
+    s = 1u << 2, ///< Molar entropy
+    u = 1u << 3, ///< Molar internal energy
+    cv = 1u << 4, ///< Isochoric molar specific heat
+    cp = 1u << 5, ///< Isobaric molar specific heat
+    M_w2 = 1u << 6, ///< Molar mass times the square of the speed of sound
+    JT = 1u << 7, ///< Joule-Thomson coefficient
+    neff = 1u << 8, ///< Effective hardness of the repulsion, see AbstractModel::get_neff
+    all = (1u << 9) - 1u
+};
+}
+
+/**
+ The properties of one state from AbstractModel::get_property_bundle, in SI units on a molar basis.  The properties that
+ were not requested in the mask are NaN.  h, s and u include the ideal-gas part, so their reference state is that of
+ the ideal-gas model.
+ */
+struct PropertyBundle{
+    std::uint32_t mask = 0; ///< The properties that were calculated, as a combination of the bits of properties::Mask
+    double p = std::numeric_limits<double>::quiet_NaN(); ///< Pressure, in Pa
+    double h = std::numeric_limits<double>::quiet_NaN(); ///< Molar enthalpy, in J/mol
+    double s = std::numeric_limits<double>::quiet_NaN(); ///< Molar entropy, in J/mol/K
+    double u = std::numeric_limits<double>::quiet_NaN(); ///< Molar internal energy, in J/mol
+    double cv = std::numeric_limits<double>::quiet_NaN(); ///< Isochoric molar specific heat, in J/mol/K
+    double cp = std::numeric_limits<double>::quiet_NaN(); ///< Isobaric molar specific heat, in J/mol/K
+    double M_w2 = std::numeric_limits<double>::quiet_NaN(); ///< \f$Mw^2\f$, in J/mol; the models do not know the molar mass M (in kg/mol), so the speed of sound is \f$w = \sqrt{Mw^2/M}\f$
+    double JT = std::numeric_limits<double>::quiet_NaN(); ///< Joule-Thomson coefficient \f$(\partial T/\partial p)_h\f$, in K/Pa
+    double neff = std::numeric_limits<double>::quiet_NaN(); ///< Effective hardness of the repulsion
+};
+
+}
+}
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/parallel.hpp"
+#include "teqp/exceptions.hpp"
+
+namespace teqp{
+
+namespace superancillary{ struct PureSuperAncillary; }
+
+namespace tables{
+
+/*
+ Tabulated surrogates of the properties of a pure fluid, for the codes (CFD, cycle simulations, ...) that evaluate the
+ same model at millions of states.  A table covers a domain of (T, rho) or of (p, h), split into bands in the first
+ coordinate, each made of one single-phase region, or of a vapor and a liquid region on both sides of the saturation
+ boundary.  Within a region, the second coordinate is mapped to eta in [0, 1] between the lower and upper bounds of the
+ region, which are either constant or piecewise Chebyshev expansions of the first coordinate (the saturation curve, for
+ instance), so that the patches of the region follow the boundary and never straddle it.  Each region is covered by a
+ tree of tensor-product Chebyshev patches: a patch whose last coefficients are not negligible is split in halves, in the
+ directions in which they are not, so that the refinement is concentrated where the properties vary quickly.
+
+ Between the liquid and vapor regions of a band, the states are two-phase, and the outputs are obtained from the
+ saturated states on both sides with the two-phase rule of each output: the lever rule in the molar volume (in (T, rho))
+ or in the molar enthalpy (in (p, h)), the common value of both phases (p or T), or NaN for the properties that are not
+ defined for a two-phase mixture (cv, cp, ...).
+
+ The whole table is held in one contiguous buffer, in the same layout as the files written by PropertyTable::save, so
+ that a table can be used directly from a memory-mapped file with PropertyTable::view, without copying or parsing.
+ */
+
+/// The inputs of a table
+enum class TableKind : std::uint32_t {
+    Trho = 0, ///< Temperature in K and molar density in mol/m^3; the coordinates are (T, ln rho)
+    ph = 1 ///< Pressure in Pa and molar enthalpy in J/mol; the coordinates are (ln p, h)
+};
+
+/// How an output is obtained for a two-phase state
+enum class TwoPhaseRule : std::uint32_t {
+    nan = 0, ///< Not defined, NaN
+    lever = 1, ///< The lever rule between the saturated states
+    saturated = 2, ///< The common value of the saturated states
+    harmonic = 3 ///< The lever rule on the inverse of the output, as for the density
+};
+
+namespace internal{
+
+    /// The maximum degree of the patches in each direction, and the maximum number of outputs of a table
+    constexpr int max_order = 15;
+    constexpr int max_outputs = 16;
+
+    // The records of the buffer; all are of a size that is a multiple of 8 bytes, so that all the sections are aligned
+
+    struct Header{
+        char magic[8]; ///< "TEQPTAB1"
+        std::uint32_t version; ///< The version of the layout
+        std::uint32_t endianness; ///< 0x01020304 as written by the machine that built the table
+        std::uint32_t kind; ///< A TableKind
+        std::uint32_t order; ///< The degree of the patches in each direction
+        std::uint32_t Noutputs, Nbands, Nregions, Ncurves, Nexpansions, Nnodes, Npatches, reserved;
+        std::uint64_t Ncurve_coeffs;
+        std::uint64_t offset_outputs, offset_bands, offset_regions, offset_curves, offset_expansions, offset_curve_coeffs, offset_nodes, offset_patches; ///< In bytes from the start of the buffer
+        std::uint64_t size; ///< The size of the buffer, in bytes
+    };
+    struct OutputRecord{
+        char name[16]; ///< Null-terminated
+        std::uint32_t twophase; ///< A TwoPhaseRule
+        std::uint32_t reserved;
+    };
+    struct BandRecord{
+        double x0, x1; ///< The range of the first coordinate
+        std::int32_t region_lo, region_hi; ///< The regions at low and high values of the second coordinate; region_hi is -1 for a single-phase band
+    };
+    struct RegionRecord{
+        double x0, x1; ///< The range of the first coordinate, that of the band
+        double ylo, yhi; ///< The bounds of the second coordinate, if they are constant
+        std::int32_t curve_lo, curve_hi; ///< The curves of the bounds of the second coordinate, or -1 if they are constant
+        std::int32_t root; ///< The root node of the tree of patches
+        std::int32_t reserved;
+    };
+    struct CurveRecord{
+        std::int32_t first, N; ///< The first of the N contiguous expansions of the curve, in increasing order of x
+    };
+    struct ExpansionRecord{
+        double xmin, xmax;
+        std::uint64_t first_coeff, Ncoeff; ///< The range of the coefficients in the curve coefficients
+    };
+    struct NodeRecord{
+        std::int32_t first_child; ///< The first of the contiguous children, -1 for a leaf
+        std::int32_t patch; ///< The patch of a leaf, or -1
+        std::uint32_t split; ///< The directions in which the node is split in halves: 1 for x, 2 for eta, 3 for both; the children are ordered with x varying fastest
+        std::uint32_t reserved;
+    };
+}
+
+/// Options of the construction of the tables
+struct PropertyTableOptions{
+    double Tmin = -1; ///< The minimum temperature, in K; not below the minimum temperature of the superancillary if it is in the two-phase range
+    double Tmax = -1; ///< The maximum temperature, in K
+    double rhomin = -1; ///< The minimum molar density of the (T, rho) tables, in mol/m^3; below the saturated vapor density at Tmin
+    double rhomax = -1; ///< The maximum molar density of the (T, rho) tables, in mol/m^3; above the saturated liquid density at Tmin
+    double pmin = -1; ///< The minimum pressure of the (p, h) tables, in Pa
+    double pmax = -1; ///< The maximum pressure of the (p, h) tables, in Pa
+    std::uint32_t mask = cppinterface::properties::all; ///< The properties to tabulate, see cppinterface::properties::Mask; in the (p, h) tables, p and h are the inputs and T and rho are always tabulated
+    int order = 6; ///< The degree of the patches in each direction, between 2 and internal::max_order
+    double reltol = 1e-8; ///< A patch is accepted when its last coefficients are below reltol times the largest magnitude of the output in the patch, for all the outputs
+    int maxdepth = 8; ///< The maximum number of splits of the patches in each direction; patches that cannot be split further are accepted even if not converged
+    std::size_t max_patches = 1000000; ///< teqp::IterationFailure is thrown if the table would have more patches than this
+    parallel::ParallelOptions parallel; ///< The state points of the patches of each level of the trees are evaluated in parallel
+};
+
+/**
+ \brief A table of properties built by build_property_table_Trho or build_property_table_ph, or loaded from a file
+
+ The lookups are const and reentrant.  States outside the domain of the table give NaN for all the outputs, as do the
+ patches at the maximum depth in which the model could not be evaluated.  The buffer is in the byte order of the machine
+ that built the table; a buffer of the other byte order is rejected.
+ */
+class PropertyTable{
+private:
+    std::shared_ptr<const std::vector<double>> owned; ///< The buffer, if the table owns it; shared by the copies of the table
+    const internal::Header* header = nullptr;
+    const internal::OutputRecord* outputs = nullptr;
+    const internal::BandRecord* bands = nullptr;
+    const internal::RegionRecord* regions = nullptr;
+    const internal::CurveRecord* curves = nullptr;
+    const internal::ExpansionRecord* expansions = nullptr;
+    const double* curve_coeffs = nullptr;
+    const internal::NodeRecord* nodes = nullptr;
+    const double* patches = nullptr;
+    int M = 0; ///< The number of coefficients of the patches in each direction
+    std::size_t patch_stride = 0; ///< The number of coefficients of a patch, for all its outputs
+
+    PropertyTable(std::shared_ptr<const std::vector<double>> owned, const void* data, const std::size_t size);
+
+    double eval_curve(const int icurve, const double x) const {
+        const auto& curve = curves[icurve];
+        const auto* exps = expansions + curve.first;
+        int iL = 0, iR = curve.N - 1;
+        while (iR > iL) {
+            int iM = (iL + iR + 1)/2;
+            if (x >= exps[iM].xmin) { iL = iM; } else { iR = iM - 1; }
+        }
+        const auto& e = exps[iL];
+        const double* c = curve_coeffs + e.first_coeff;
+        double xscaled = (2*x - (e.xmax + e.xmin))/(e.xmax - e.xmin);
+        int Norder = static_cast<int>(e.Ncoeff) - 1;
+        double u_k = 0, u_kp1 = c[Norder], u_kp2 = 0;
+        for (int k = Norder - 1; k > 0; k--) {
+            u_k = 2.0*xscaled*u_kp1 - u_kp2 + c[k];
+            u_kp2 = u_kp1; u_kp1 = u_k;
+        }
+        return c[0] + xscaled*u_kp1 - u_kp2;
+    }
+    double get_ylo(const internal::RegionRecord& r, const double x) const { return (r.curve_lo < 0) ? r.ylo : eval_curve(r.curve_lo, x); }
+    double get_yhi(const internal::RegionRecord& r, const double x) const { return (r.curve_hi < 0) ? r.yhi : eval_curve(r.curve_hi, x); }
+
+    /// All the outputs at x and eta in [0, 1] in the region
+    void eval_region(const internal::RegionRecord& r, const double x, const double eta, double* out) const {
+        double xa = r.x0, xb = r.x1, ya = 0, yb = 1;
+        const internal::NodeRecord* node = nodes + r.root;
+        while (node->first_child >= 0) {
+            int ichild = 0;
+            if (node->split & 1) {
+                double xm = (xa + xb)/2;
+                if (x >= xm) { xa = xm; ichild = 1; } else { xb = xm; }
+            }
+            if (node->split & 2) {
+                double ym = (ya + yb)/2;
+                if (eta >= ym) { ya = ym; ichild += (node->split & 1) ? 2 : 1; } else { yb = ym; }
+            }
+            node = nodes + node->first_child + ichild;
+        }
+        const auto Noutputs = header->Noutputs;
+        if (node->patch < 0) {
+            for (auto k = 0U; k < Noutputs; ++k) { out[k] = std::numeric_limits<double>::quiet_NaN(); }
+            return;
+        }
+        // The Chebyshev polynomials in both directions, from their recurrence
+        double Tx[internal::max_order + 1], Ty[internal::max_order + 1];
+        const double tx = (2*x - (xa + xb))/(xb - xa), ty = (2*eta - (ya + yb))/(yb - ya);
+        Tx[0] = 1; Tx[1] = tx; Ty[0] = 1; Ty[1] = ty;
+        for (auto i = 2; i < M; ++i) {
+            Tx[i] = 2*tx*Tx[i-1] - Tx[i-2];
+            Ty[i] = 2*ty*Ty[i-1] - Ty[i-2];
+        }
+        // The weights of the coefficients are shared by all the outputs, each of which is then a dot product, with
+        // independent partial sums so that it can be pipelined
+        double W[(internal::max_order + 1)*(internal::max_order + 1)];
+        const int MM = M*M;
+        for (auto i = 0; i < M; ++i) {
+            for (auto j = 0; j < M; ++j) {
+                W[i*M + j] = Tx[i]*Ty[j];
+            }
+        }
+        const double* c = patches + static_cast<std::size_t>(node->patch)*patch_stride;
+        for (auto k = 0U; k < Noutputs; ++k) {
+            double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+            int m = 0;
+            for (; m + 4 <= MM; m += 4) {
+                s0 += W[m]*c[m]; s1 += W[m+1]*c[m+1]; s2 += W[m+2]*c[m+2]; s3 += W[m+3]*c[m+3];
+            }
+            for (; m < MM; ++m) {
+                s0 += W[m]*c[m];
+            }
+            out[k] = (s0 + s1) + (s2 + s3);
+            c += MM;
+        }
+    }
+
+public:
+    static constexpr std::uint32_t version = 1;
+
+    /// A table that owns a copy of the buffer
+    static PropertyTable from_buffer(const void* data, const std::size_t size);
+    /// A table that views the buffer without copying it, for instance a memory-mapped file; the buffer must be aligned on 8 bytes and must outlive the table
+    static PropertyTable view(const void* data, const std::size_t size);
+    /// Load a table from a file written by save
+    static PropertyTable load(const std::string& path);
+    /// Write the buffer to a file
+    void save(const std::string& path) const;
+
+    /// The buffer, of size_bytes() bytes
+    const void* data() const { return header; }
+    std::size_t size_bytes() const { return static_cast<std::size_t>(header->size); }
+
+    TableKind get_kind() const { return static_cast<TableKind>(header->kind); }
+    int get_order() const { return static_cast<int>(header->order); }
+    std::size_t get_Npatches() const { return header->Npatches; }
+    std::size_t get_Noutputs() const { return header->Noutputs; }
+    /// The names of the outputs, in the order of the values of get_all: p, h, s, u, cv, cp, M_w2, JT, neff for the (T, rho) tables, and T, rho, s, u, cv, cp, M_w2, JT, neff for the (p, h) tables, restricted to the mask of the options
+    std::vector<std::string> get_output_names() const;
+    /// The index of the output called name; throws teqp::InvalidArgument if there is no such output
+    std::size_t get_output_index(const std::string& name) const;
+
+    /**
+     \brief All the outputs at one state
+     \param in1 T in K, or p in Pa
+     \param in2 rho in mol/m^3, or h in J/mol
+     \param out The get_Noutputs() values, NaN outside the domain of the table
+     */
+    void get_all(const double in1, const double in2, double* out) const {
+        const auto Noutputs = header->Noutputs;
+        const bool Trho = (header->kind == static_cast<std::uint32_t>(TableKind::Trho));
+        const double x = Trho ? in1 : std::log(in1), y = Trho ? std::log(in2) : in2;
+        auto fill_nan = [&](){
+            for (auto k = 0U; k < Noutputs; ++k) { out[k] = std::numeric_limits<double>::quiet_NaN(); }
+        };
+        const internal::BandRecord* band = nullptr;
+        for (auto i = 0U; i < header->Nbands; ++i) {
+            if (x >= bands[i].x0 && x <= bands[i].x1) { band = bands + i; break; }
+        }
+        if (band == nullptr || std::isnan(y)) { fill_nan(); return; }
+
+        // The outer bounds are widened by a rounding error, so that the states on them (on the isotherm Tmax, ...) are in the table
+        const bool single = (band->region_hi < 0);
+        const auto& lo = regions[band->region_lo];
+        const double lo_ylo = get_ylo(lo, x), lo_yhi = get_yhi(lo, x), lo_slack = 1e-9*(lo_yhi - lo_ylo);
+        if (y < lo_ylo - lo_slack) { fill_nan(); return; }
+        if (y <= lo_yhi + (single ? lo_slack : 0)) { eval_region(lo, x, std::clamp((y - lo_ylo)/(lo_yhi - lo_ylo), 0.0, 1.0), out); return; }
+        if (single) { fill_nan(); return; }
+        const auto& hi = regions[band->region_hi];
+        const double hi_ylo = get_ylo(hi, x), hi_yhi = get_yhi(hi, x);
+        if (y > hi_yhi + 1e-9*(hi_yhi - hi_ylo)) { fill_nan(); return; }
+        if (y >= hi_ylo) { eval_region(hi, x, std::clamp((y - hi_ylo)/(hi_yhi - hi_ylo), 0.0, 1.0), out); return; }
+
+        // Two-phase, from the saturated states at the edges of both regions; w is the fraction of the phase of the upper region
+        double sat_lo[internal::max_outputs], sat_hi[internal::max_outputs];
+        eval_region(lo, x, 1.0, sat_lo);
+        eval_region(hi, x, 0.0, sat_hi);
+        const double w = Trho ? (std::exp(-lo_yhi) - std::exp(-y))/(std::exp(-lo_yhi) - std::exp(-hi_ylo)) : (y - lo_yhi)/(hi_ylo - lo_yhi);
+        for (auto k = 0U; k < Noutputs; ++k) {
+            switch (static_cast<TwoPhaseRule>(outputs[k].twophase)) {
+                case TwoPhaseRule::lever: out[k] = (1 - w)*sat_lo[k] + w*sat_hi[k]; break;
+                case TwoPhaseRule::saturated: out[k] = sat_lo[k]; break;
+                case TwoPhaseRule::harmonic: out[k] = 1/((1 - w)/sat_lo[k] + w/sat_hi[k]); break;
+                default: out[k] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+    }
+
+    /// The output of index iout at one state, see get_all
+    double get(const std::size_t iout, const double in1, const double in2) const {
+        if (iout >= header->Noutputs) {
+            throw teqp::InvalidArgument("Index of output out of range: " + std::to_string(iout));
+        }
+        double out[internal::max_outputs];
+        get_all(in1, in2, out);
+        return out[iout];
+    }
+};
+
+/**
+ \brief Build a table in (T, rho) of the properties of a pure fluid
+
+ Below the maximum temperature of the superancillary, the band is made of a vapor region between rhomin and the saturated
+ vapor density, and a liquid region between the saturated liquid density and rhomax, the saturated densities being those
+ of the model (the superancillary polished with pure_VLE_T).  Above it, the band is a single region between rhomin and
+ rhomax; the small part of the two-phase region between the maximum temperature of the superancillary and the critical
+ point is thus evaluated as single-phase states of the model.
+
+ \param ar The residual model
+ \param aig The ideal-gas model, for h, s, u, cv, cp, M_w2 and JT
+ \param sa The superancillary of the model, see superancillary::build_pure_superancillary
+ \param options Tmin, Tmax, rhomin and rhomax must be given
+ */
+PropertyTable build_property_table_Trho(const cppinterface::AbstractModel& ar, const cppinterface::AbstractModel& aig, const superancillary::PureSuperAncillary& sa, const PropertyTableOptions& options);
+
+/**
+ \brief Build a table in (p, h) of the properties of a pure fluid
+
+ The domain is bounded by the isobars pmin and pmax, and by the isotherms Tmin and Tmax.  Between the vapor pressures at
+ Tmin and at the maximum temperature of the superancillary, the band is made of a liquid region between the isotherm Tmin
+ and the saturated liquid, and a vapor region between the saturated vapor and the isotherm Tmax.  At each node, T is
+ solved from h with Newton steps, bracketed by the bounds of the region, and rho from (T, p) with
+ AbstractModel::solve_rho_Tp.  In two-phase states, T is the saturation temperature, and rho is from the lever rule in the
+ molar volume.
+
+ \param ar The residual model
+ \param aig The ideal-gas model
+ \param sa The superancillary of the model, see superancillary::build_pure_superancillary
+ \param options Tmin, Tmax, pmin and pmax must be given
+ */
+PropertyTable build_property_table_ph(const cppinterface::AbstractModel& ar, const cppinterface::AbstractModel& aig, const superancillary::PureSuperAncillary& sa, const PropertyTableOptions& options);
+
+}
+}
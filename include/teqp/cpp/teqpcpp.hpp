@@ -1,5 +1,7 @@
 #pragma once 
 #include <memory>
+#include <vector>
+#include <cstdint>
 #include <typeindex>
 #include <optional>
 
@@ -11,6 +13,8 @@
 #include "teqp/algorithms/critical_tracing_types.hpp"
 #include "teqp/algorithms/VLE_types.hpp"
 #include "teqp/algorithms/VLLE_types.hpp"
+#include "teqp/algorithms/density_types.hpp"
+#include "teqp/cpp/properties_types.hpp"
 
 using EArray2 = Eigen::Array<double, 2, 1>;
 using EArrayd = Eigen::ArrayX<double>;
@@ -45,6 +49,15 @@ using REMatrixd = Eigen::Ref<const Eigen::Array<double, Eigen::Dynamic, Eigen::D
     X(5) \
     X(6)
 
+// The orders supported by get_deriv_matN
+#define DERIVMATN_args \
+    X(1) \
+    X(2) \
+    X(3) \
+    X(4) \
+    X(5) \
+    X(6)
+
 // Functions that return a double, take T and rhovec as arguments
 #define ISOCHORIC_double_args \
     X(get_pr) \
@@ -83,6 +96,9 @@ namespace teqp {
          
          X-Macros can be used to wrap functions that take template arguments and expand them as multiple functions
          
+         The const methods are reentrant; they do not modify the model and may be called concurrently from
+         several threads on the same instance (see teqp::parallel)
+         
         */
         class AbstractModel {
         public:
@@ -90,11 +106,16 @@ namespace teqp {
             virtual ~AbstractModel() = default;
             
             virtual const std::type_index& get_type_index() const = 0;
+            /// The model that this one wraps, if it is a decorator (as from make_profiling_model), otherwise nullptr; get_model_cref and get_model_ref look through decorators
+            virtual const AbstractModel* get_decorated() const { return nullptr; }
+            
+            /// A versioned binary (CBOR) snapshot of the model, that deserialize_model rebuilds without the fluid libraries or files; throws teqp::NotImplementedError for the kinds of models that do not support it
+            std::vector<std::uint8_t> serialize() const;
             
-            virtual double get_R(const EArrayd&) const = 0;
-            double R(const EArrayd& x) const { return get_R(x); };
+            virtual double get_R(const REArrayd&) const = 0;
+            double R(const REArrayd& x) const { return get_R(x); };
             
-            virtual double get_Arxy(const int, const int, const double, const double, const EArrayd&) const = 0;
+            virtual double get_Arxy(const int, const int, const double, const double, const REArrayd&) const = 0;
             
             // Here X-Macros are used to create functions like get_Ar00, get_Ar01, ....
             #define X(i,j) virtual double get_Ar ## i ## j(const double T, const double rho, const REArrayd& molefrac) const = 0;
@@ -104,32 +125,76 @@ namespace teqp {
             #define X(i) virtual EArrayd get_Ar0 ## i ## n(const double T, const double rho, const REArrayd& molefrac) const = 0;
                 AR0N_args
             #undef X
-            
-            
+
+            // Batched versions of get_Arxy and get_Ar0n; the virtual dispatch is paid once per batch rather than once per state point.
+            // T and rho are of length M, molefrac is of shape (M, N), with one row of mole fractions per state point
+            virtual EArrayd get_Arxy_many(const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const = 0;
+            virtual EMatrixd get_Ar0n_many(const int Nderiv, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const = 0;
+
             // Virial derivatives
-            virtual double get_B2vir(const double T, const EArrayd& z) const = 0;
-            virtual std::map<int, double> get_Bnvir(const int Nderiv, const double T, const EArrayd& z) const = 0;
-            virtual double get_B12vir(const double T, const EArrayd& z) const = 0;
-            virtual double get_dmBnvirdTm(const int Nderiv, const int NTderiv, const double T, const EArrayd& z) const = 0;
+            virtual double get_B2vir(const double T, const REArrayd& z) const = 0;
+            virtual std::map<int, double> get_Bnvir(const int Nderiv, const double T, const REArrayd& z) const = 0;
+            virtual double get_B12vir(const double T, const REArrayd& z) const = 0;
+            virtual double get_dmBnvirdTm(const int Nderiv, const int NTderiv, const double T, const REArrayd& z) const = 0;
+            /// The virial coefficients B_2 to B_Nmax (one per row) and their temperature derivatives up to the order NTmax (one per column), with one evaluation per row
+            virtual EMatrixd get_dmBnvirdTm_matrix(const int Nmax, const int NTmax, const double T, const REArrayd& z) const = 0;
             
             // Derivatives from isochoric thermodynamics (all have the same signature whithin each block)
-            #define X(f) virtual double f(const double T, const EArrayd& rhovec) const = 0;
+            #define X(f) virtual double f(const double T, const REArrayd& rhovec) const = 0;
                 ISOCHORIC_double_args
             #undef X
-            #define X(f) virtual EArrayd f(const double T, const EArrayd& rhovec) const = 0;
+            #define X(f) virtual EArrayd f(const double T, const REArrayd& rhovec) const = 0;
                 ISOCHORIC_array_args
             #undef X
-            #define X(f) virtual EMatrixd f(const double T, const EArrayd& rhovec) const = 0;
+            #define X(f) virtual EMatrixd f(const double T, const REArrayd& rhovec) const = 0;
                 ISOCHORIC_matrix_args
             #undef X
-            #define X(f) virtual std::tuple<double, Eigen::ArrayXd, Eigen::MatrixXd> f(const double T, const EArrayd& rhovec) const = 0;
+            #define X(f) virtual std::tuple<double, Eigen::ArrayXd, Eigen::MatrixXd> f(const double T, const REArrayd& rhovec) const = 0;
                 ISOCHORIC_multimatrix_args
             #undef X
-            virtual Eigen::ArrayXd get_Psir_sigma_derivs(const double T, const EArrayd& rhovec, const EArrayd& v) const = 0;
+            /// Like build_Psir_fgradHessian_autodiff, but the results are written into the provided buffers; if they are already of the right size, no heap allocation is needed
+            virtual void build_Psir_fgradHessian_autodiff(const double T, const REArrayd& rhovec, double& Psir, Eigen::ArrayXd& gradient, Eigen::MatrixXd& Hessian) const = 0;
+            /// Like the buffered build_Psir_fgradHessian_autodiff, but the Hessian of the total Helmholtz energy density is also returned, from the same evaluation of the derivatives; as in build_Psi_Hessian_autodiff, the ideal-gas terms RT/rho_i are added to the diagonal, so they are infinite for zero concentrations
+            void build_Psi_fgradHessian_autodiff(const double T, const REArrayd& rhovec, double& Psir, Eigen::ArrayXd& gradient, Eigen::MatrixXd& Hessianr, Eigen::MatrixXd& Hessian) const {
+                build_Psir_fgradHessian_autodiff(T, rhovec, Psir, gradient, Hessianr);
+                const double RT = get_R((rhovec / rhovec.sum()).eval()) * T;
+                Hessian = Hessianr;
+                for (auto i = 0; i < rhovec.size(); ++i) {
+                    Hessian(i, i) += RT / rhovec[i];
+                }
+            }
+            virtual Eigen::ArrayXd get_Psir_sigma_derivs(const double T, const REArrayd& rhovec, const REArrayd& v) const = 0;
+            
+            double get_neff(const double, const double, const REArrayd&) const;
             
-            double get_neff(const double, const double, const EArrayd&) const;
+            /**
+             The properties selected by the bits of mask (see properties::Mask) at one state, all derived from one set of derivatives:
+             only the derivatives \f$\Lambda_{ij}\f$ that the selected properties need are evaluated, one at a time if a single one is
+             needed and otherwise in one call to get_deriv_mat2, for this model and for the ideal-gas model aig.  aig may be null
+             if only p and neff are requested; otherwise teqp::InvalidArgument is thrown
+             */
+            PropertyBundle get_property_bundle(const double T, const double rho, const REArrayd& z, const std::uint32_t mask = properties::all, const AbstractModel* aig = nullptr) const;
             
-            virtual EArray33d get_deriv_mat2(const double T, double rho, const EArrayd& z ) const = 0;
+            /**
+             Return a model bound to the composition z, in which the composition-dependent parts of the model (reducing functions, mixing rules, ...)
+             are cached, so that repeated calls at this composition only depend on T and rho.  Calls at other compositions are still valid but are not accelerated.
+             The returned model holds a reference to this one, which must outlive it.  The cached parts are computed from the parameters of this
+             model at the time of the call; after the parameters are changed in place (like with set_kmat of the cubic models), the returned
+             model is stale and must be prepared again.
+             */
+            virtual std::unique_ptr<AbstractModel> prepare_composition(const REArrayd& z) const = 0;
+            
+            virtual EArray33d get_deriv_mat2(const double T, double rho, const REArrayd& z ) const = 0;
+            /// All the residual derivatives \f$\Lambda^{\rm r}_{ij}\f$ with \f$i+j \leq\f$ order in one pass, as a square matrix of size order+1 indexed by (i,j); entries with i+j > order are zero
+            virtual EMatrixd get_deriv_matN(const int order, const double T, const double rho, const REArrayd& z) const = 0;
+            
+            /**
+             The molar density at the temperature T, the pressure p and the mole fractions z, see density::solve_rho_Tp; in closed form for the cubic models,
+             otherwise from Newton steps. Throws IterationFailure if no root is found
+             */
+            virtual double solve_rho_Tp(const double T, const double p, const REArrayd& z, const density::RhoPhase phase = density::RhoPhase::stable, const std::optional<density::RhoTpOptions>& options = std::nullopt) const = 0;
+            /// Batched version of solve_rho_Tp, with the mole fractions of the i-th state in the i-th row of molefrac; NaN where no root is found
+            virtual EArrayd solve_rho_Tp_many(const REArrayd& T, const REArrayd& p, const REMatrixd& molefrac, const density::RhoPhase phase = density::RhoPhase::stable, const std::optional<density::RhoTpOptions>& options = std::nullopt) const = 0;
             
             std::tuple<double, double> solve_pure_critical(const double T, const double rho, const std::optional<nlohmann::json>& = std::nullopt) const ;
             EArray2 extrapolate_from_critical(const double Tc, const double rhoc, const double Tgiven) const;
@@ -141,16 +206,18 @@ namespace teqp {
             virtual std::tuple<EArrayd, EArrayd> get_drhovecdp_Tsat(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const;
             virtual std::tuple<EArrayd, EArrayd> get_drhovecdT_psat(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const;
             virtual double get_dpsat_dTsat_isopleth(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const;
-            virtual nlohmann::json trace_VLE_isotherm_binary(const double T0, const EArrayd& rhovec0, const EArrayd& rhovecV0, const std::optional<TVLEOptions> & = std::nullopt) const;
-            virtual nlohmann::json trace_VLE_isobar_binary(const double p, const double T0, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<PVLEOptions> & = std::nullopt) const;
-            virtual std::tuple<VLE_return_code,EArrayd,EArrayd> mix_VLE_Tx(const double T, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const REArrayd& xspec, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter) const;
+            virtual nlohmann::json trace_VLE_isotherm_binary(const double T0, const REArrayd& rhovec0, const REArrayd& rhovecV0, const std::optional<TVLEOptions> & = std::nullopt) const;
+            virtual nlohmann::json trace_VLE_isobar_binary(const double p, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<PVLEOptions> & = std::nullopt) const;
+            virtual nlohmann::json trace_phase_envelope(const double T0, const REArrayd& rhovecB0, const REArrayd& rhovecI0, const std::optional<PhaseEnvelopeOptions> & = std::nullopt) const;
+            // The solvers fill the counters of their work into telemetry if it is not null; mix_VLE_Tp returns them in MixVLEReturn::telemetry
+            virtual std::tuple<VLE_return_code,EArrayd,EArrayd> mix_VLE_Tx(const double T, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const REArrayd& xspec, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter, SolverTelemetry* telemetry = nullptr) const;
             virtual MixVLEReturn mix_VLE_Tp(const double T, const double pgiven, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLETpFlags> &flags = std::nullopt) const;
-            virtual std::tuple<VLE_return_code,double,EArrayd,EArrayd> mixture_VLE_px(const double p_spec, const REArrayd& xmolar_spec, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLEpxFlags>& flags = std::nullopt) const;
+            virtual std::tuple<VLE_return_code,double,EArrayd,EArrayd> mixture_VLE_px(const double p_spec, const REArrayd& xmolar_spec, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLEpxFlags>& flags = std::nullopt, SolverTelemetry* telemetry = nullptr) const;
             
-            std::tuple<VLLE::VLLE_return_code,EArrayd,EArrayd,EArrayd> mix_VLLE_T(const double T, const REArrayd& rhovecVinit, const REArrayd& rhovecL1init, const REArrayd& rhovecL2init, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter) const;
+            std::tuple<VLLE::VLLE_return_code,EArrayd,EArrayd,EArrayd> mix_VLLE_T(const double T, const REArrayd& rhovecVinit, const REArrayd& rhovecL1init, const REArrayd& rhovecL2init, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter, SolverTelemetry* telemetry = nullptr) const;
             std::vector<nlohmann::json> find_VLLE_T_binary(const std::vector<nlohmann::json>& traces, const std::optional<VLLE::VLLEFinderOptions> options = std::nullopt) const;
             
-            virtual nlohmann::json trace_critical_arclength_binary(const double T0, const EArrayd& rhovec0, const std::optional<std::string>& = std::nullopt, const std::optional<TCABOptions> & = std::nullopt) const;
+            virtual nlohmann::json trace_critical_arclength_binary(const double T0, const REArrayd& rhovec0, const std::optional<std::string>& = std::nullopt, const std::optional<TCABOptions> & = std::nullopt) const;
             virtual EArrayd get_drhovec_dT_crit(const double T, const REArrayd& rhovec) const;
             virtual double get_dp_dT_crit(const double T, const REArrayd& rhovec) const;
             virtual EArray2 get_criticality_conditions(const double T, const REArrayd& rhovec) const;
@@ -159,8 +226,57 @@ namespace teqp {
             
         };
         
-        // Generic JSON-based interface where the model description is encoded as JSON
+        // Generic JSON-based interface where the model description is encoded as JSON; with "virial": true (or the fields of VirialFastPathOptions)
+        // in the JSON, the model is wrapped by make_virial_model, and with "profile": true, it is then wrapped by make_profiling_model
         std::unique_ptr<AbstractModel> make_model(const nlohmann::json &);
+        /// Rebuild a model from the snapshot returned by AbstractModel::serialize
+        std::unique_ptr<AbstractModel> deserialize_model(const std::vector<std::uint8_t>&);
+    
+        /**
+         \brief Opt-in, process-wide cache of models built by make_model, keyed on the canonical (key-sorted) dump of the JSON
+         
+         The first call for a given specification builds the model; later calls return the same immutable instance, so
+         building a model again costs a dump, a hash and a reference count increment. Safe to call from several threads.
+         Files referred to by the specification (multifluid) are read only once, so clear the cache if they change.
+         */
+        std::shared_ptr<const AbstractModel> make_model_cached(const nlohmann::json &);
+        /// Remove all the models from the cache of make_model_cached; models in use by callers are kept alive by their references
+        void clear_model_cache();
+
+        /**
+         \brief Wrap a model in a decorator that forwards all the virtual methods to it and records, for each method, the number of
+         calls, the distribution of their durations, and the distribution of the orders of the derivatives that were requested
+         
+         The counters are kept per thread, so recording costs two reads of the clock and a few uncontended increments per call.
+         The models returned by prepare_composition of the decorator are decorated too, and record into the same profile.
+         */
+        std::unique_ptr<AbstractModel> make_profiling_model(std::unique_ptr<AbstractModel> model);
+        /// The profile of a model from make_profiling_model, as JSON, with one entry per method that was called; throws teqp::InvalidArgument for other models
+        nlohmann::json get_profile(const AbstractModel& model);
+        /// Zero the counters of the profile of a model from make_profiling_model; calls in flight in other threads may be partly counted
+        void reset_profile(const AbstractModel& model);
+
+        /// The options of make_virial_model
+        struct VirialFastPathOptions {
+            int Nvir = 5; ///< The series has the virial coefficients B_2 to B_Nvir, and B_(Nvir+1) estimates its truncation error, so Nvir may be from 2 to 5
+            double atol = 1e-15; ///< The largest truncation error allowed in a derivative \f$\Lambda^{\rm r}_{ij}\f$ obtained from the series, as estimated by its first omitted term
+        };
+
+        /**
+         \brief Wrap a model in a decorator that obtains the residual derivatives \f$\Lambda^{\rm r}_{ij}\f$ from the virial series at low density
+
+         Below a threshold density, which depends on the temperature, the composition and the orders of the derivatives,
+         get_Arxy, get_Ar.., get_Ar0.n, their batched versions and get_deriv_mat2 sum the virial series
+         \f$\alpha^{\rm r} = \sum_{n=2}^{N} B_n\rho^{n-1}/(n-1)\f$ instead of evaluating the model.  The coefficients (and their
+         temperature derivatives) are obtained from get_dmBnvirdTm_matrix once per temperature and composition, and cached per thread.
+         The threshold is the density at which the first omitted term reaches options.atol, so only temperature derivatives up to the
+         second order and density derivatives up to the order Nvir-1 use the series.  So that new coefficients are not computed for
+         dense states, a state is passed to the model at once if its density is above twice the largest threshold at the last
+         temperature of the same composition.  The other methods, and the algorithms, are those of the wrapped model.
+         */
+        std::unique_ptr<AbstractModel> make_virial_model(std::unique_ptr<AbstractModel> model, const VirialFastPathOptions& options = {});
+        /// The density below which a model from make_virial_model obtains \f$\Lambda^{\rm r}_{ij}\f$ from the virial series at T and z (zero if it never does); throws teqp::InvalidArgument for other models
+        double get_virial_threshold(const AbstractModel& model, const int NT, const int ND, const double T, const REArrayd& z);
 
         // Expose specialized factory functions for different models
         // Mostly these are just adapter functions that prepare some
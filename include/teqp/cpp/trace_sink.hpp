@@ -0,0 +1,109 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/algorithms/VLE_types.hpp"
+
+namespace teqp{
+namespace tracesink{
+
+/// A column of a trace: a scalar (width 1), or a vector of fixed length, like the molar concentrations of a phase
+struct Column{
+    std::string name;
+    std::size_t width = 1;
+};
+
+/// The columns of the rows written to a sink, in order; all values are stored as doubles
+struct Schema{
+    std::vector<Column> columns;
+    /// The number of doubles in a row, the sum of the widths of the columns
+    std::size_t row_width() const;
+    nlohmann::json to_json() const;
+    static Schema from_json(const nlohmann::json&);
+};
+
+/// The columns t, dt, T, pL, pV, c, rhovecL and rhovecV of a VLETracePoint with N components
+Schema VLE_trace_schema(const std::size_t N);
+/// The columns s, ds, T, p, rhovecB, rhovecI and event (the value of the PhaseEnvelopeEvent) of a PhaseEnvelopePoint with N components
+Schema phase_envelope_schema(const std::size_t N);
+/// The numbers and the arrays of numbers of a point in the JSON output of a tracer, in the order of its keys; the other entries are not written
+Schema json_schema(const nlohmann::json& point);
+
+/**
+ The formats of the files:
+
+ - columnar: a header of 32 bytes (the magic "TEQPTRC1", then as native integers the uint32 version, the uint32 number of doubles
+   per row, the uint64 number of rows written so far and the uint64 offset of the first block), followed by the schema in JSON,
+   padded with zeros to a multiple of 8 bytes (so without a terminating zero if its length is a multiple of 8).  Then blocks of rows, each one the uint64 number of its rows followed by its values
+   in column-major order, so that each column of a block is contiguous.  The doubles are in the native byte order, given by
+   "byteorder" in the schema.
+ - ndjson: the first line is the schema in JSON, and each following line one row, as a JSON object with the names of the columns as
+   keys (arrays for the columns wider than one).
+ */
+enum class Format { columnar, ndjson };
+
+struct SinkOptions{
+    Format format = Format::columnar;
+    std::size_t block_rows = 4096; ///< The number of rows in a block of the columnar format; the rows are staged in memory until their block is full
+    std::size_t initial_bytes = 1 << 20; ///< The initial size of the mapping; it is doubled whenever it is full
+};
+
+/**
+ \brief A sink of rows of doubles, written incrementally to a memory-mapped file
+
+ The file grows as needed, and it is truncated to its content when the sink is closed (also by the destructor), so until then it
+ has zeros past the end of its content.  For the columnar format, the number of rows in the header counts the rows of the blocks
+ already written, so a reader of an open file sees complete blocks only; flush() writes the staged rows as a shorter block.
+ A sink is not thread-safe; each tracer that runs concurrently needs its own.
+ */
+class TraceSink{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+public:
+    /// Create (or overwrite) the file at path
+    TraceSink(const std::string& path, const Schema& schema, const SinkOptions& options = {});
+    ~TraceSink();
+    TraceSink(const TraceSink&) = delete;
+    TraceSink& operator=(const TraceSink&) = delete;
+
+    const Schema& get_schema() const;
+    /// The number of rows appended so far
+    std::size_t get_row_count() const;
+
+    /// Append one row of row_width() doubles
+    void append(const double* row);
+    void append(const VLETracePoint& point);
+    void append(const PhaseEnvelopePoint& point);
+    /// Append a point in the JSON output of a tracer; the columns that are missing from the point, or that are not of the width of the schema, are written as NaN
+    void append(const nlohmann::json& point);
+
+    /// Write the staged rows of the columnar format, and sync the mapping with the file
+    void flush();
+    /// Write the staged rows and truncate the file to its content; the sink cannot be appended to afterwards
+    void close();
+
+    /// A callback for the streaming overloads of trace_VLE_isotherm_binary and trace_VLE_isobar_binary; the sink must outlive the trace
+    VLETraceCallback VLE_callback();
+    /// A callback for the streaming overload of trace_phase_envelope
+    PhaseEnvelopeCallback phase_envelope_callback();
+    /// A callback for TCABOptions::step_callback
+    std::function<bool(const nlohmann::json&)> json_callback();
+};
+
+/// The content of a file written by a TraceSink, in either format
+struct TraceData{
+    Schema schema;
+    EMatrixd data; ///< One row per row of the trace, and one column per double, in the order of the schema
+    /// The columns of data of a column of the schema
+    EMatrixd get(const std::string& name) const;
+};
+
+/// Read a file written by a TraceSink, closed or not
+TraceData read_trace(const std::string& path);
+
+}
+}
@@ -20,6 +20,20 @@
 
 using namespace autodiff;
 
+// The virial coefficients supported by get_Bnvir_runtime
+#define BNVIR_args \
+    X(2) \
+    X(3) \
+    X(4) \
+    X(5) \
+    X(6) \
+    X(7) \
+    X(8) \
+    X(9) \
+    X(10) \
+    X(11) \
+    X(12)
+
 namespace teqp {
 
 /***
@@ -39,10 +53,9 @@ typename ContainerType::value_type derivT(const FuncType& f, TType T, const Cont
 */
 template <typename TType, typename ContainerType, typename FuncType>
 typename ContainerType::value_type derivTmcx(const FuncType& f, TType T, const ContainerType& rho) {
-    using fcn_t = std::function<mcx::MultiComplex<double>(const mcx::MultiComplex<double>&)>;
-    fcn_t wrapper = [&rho, &f](const auto& T_) {return f(T_, rho); };
-    auto ders = diff_mcx1(wrapper, T, 1);
-    return ders[0];
+    auto wrapper = [&rho, &f](const auto& T_) {return f(T_, rho); };
+    auto ders = diff_static_mcx1<1, TType>(wrapper, T);
+    return ders[1];
 }
 #endif
 
@@ -115,13 +128,58 @@ struct AlphaCallWrapper {
     }
 };
 
+/**
+ The backends for the derivatives.  The analytic backend does not differentiate the model at all, it calls the
+ get_Arxy_analytic<iT,iD> method of the model, which is only implemented by models that have closed-form derivatives
+ (the multifluid models), and is only available for the residual derivatives in T and rho
+ */
 enum class ADBackends { autodiff
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
     ,multicomplex
 #endif
     ,complex_step
+    ,analytic
 };
 
+/// Detect whether the model provides closed-form derivatives, for ADBackends::analytic
+/**
+ Evaluate alphar of a pure-fluid model at many state points (T[i], rho[i]), for instance on a dense grid of states.  The states
+ are processed in packets of P states held in fixed-size Eigen arrays, so that Eigen vectorizes the arithmetic of the model across
+ the states.  This requires alphar to accept fixed-size Eigen arrays for T and rho, as the EOS for the model potentials do
+ (LJ126KolafaNezbeda1994, LJ126Johnson1993, squarewell::EspindolaHeredia2009, exp6::Kataoka1992).  The last packet is padded
+ with copies of the last state.
+ */
+template<int P = 8, typename Model>
+Eigen::ArrayXd get_alphar_many(const Model& model, const Eigen::ArrayXd& T, const Eigen::ArrayXd& rho) {
+    if (T.size() != rho.size()) {
+        throw InvalidArgument("T and rho must be the same length");
+    }
+    using Packet = Eigen::Array<double, P, 1>;
+    const Eigen::ArrayXd molefrac = Eigen::ArrayXd::Ones(1);
+    Eigen::ArrayXd out(T.size());
+    for (Eigen::Index i = 0; i < T.size(); i += P) {
+        const auto n = std::min<Eigen::Index>(P, T.size() - i);
+        Packet Tp = Packet::Constant(T[i + n - 1]), rhop = Packet::Constant(rho[i + n - 1]);
+        Tp.head(n) = T.segment(i, n);
+        rhop.head(n) = rho.segment(i, n);
+        const Packet a = model.alphar(Tp, rhop, molefrac);
+        out.segment(i, n) = a.head(n);
+    }
+    return out;
+}
+
+template<typename Model, typename = void>
+struct has_analytic_Arxy : std::false_type {};
+template<typename Model>
+struct has_analytic_Arxy<Model, std::void_t<decltype(std::declval<const Model&>().template get_Arxy_analytic<0, 1>(1.0, 1.0, std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
+/// Detect whether the model provides the closed-form value, gradient and Hessian of Psir in the molar concentrations, which the
+/// autodiff builders of IsochoricDerivatives then use for double arguments
+template<typename Model, typename = void>
+struct has_analytic_Psir_fgradHessian : std::false_type {};
+template<typename Model>
+struct has_analytic_Psir_fgradHessian<Model, std::void_t<decltype(std::declval<const Model&>().get_Psir_fgradHessian_analytic(1.0, std::declval<const Eigen::ArrayXd&>()))>> : std::true_type {};
+
 template<typename Model, typename Scalar = double, typename VectorType = Eigen::ArrayXd>
 struct TDXDerivatives {
 
@@ -155,9 +213,8 @@ struct TDXDerivatives {
             }
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
             else if constexpr (be == ADBackends::multicomplex) {
-                using fcn_t = std::function<mcx::MultiComplex<Scalar>(const mcx::MultiComplex<Scalar>&)>;
-                fcn_t f = [&](const auto& rhomcx) { return w.alpha(T, rhomcx, molefrac); };
-                auto ders = diff_mcx1(f, rho, iD, true /* and_val */);
+                auto f = [&](const auto& rhomcx) { return w.alpha(T, rhomcx, molefrac); };
+                auto ders = diff_static_mcx1<iD, Scalar>(f, rho);
                 return powi(rho, iD)*ders[iD];
             }
 #endif
@@ -180,9 +237,8 @@ struct TDXDerivatives {
             }
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
             else if constexpr (be == ADBackends::multicomplex) {
-                using fcn_t = std::function<mcx::MultiComplex<Scalar>(const mcx::MultiComplex<Scalar>&)>;
-                fcn_t f = [&](const auto& Trecipmcx) { return w.alpha(1.0/Trecipmcx, rho, molefrac); };
-                auto ders = diff_mcx1(f, Trecip, iT, true /* and_val */);
+                auto f = [&](const auto& Trecipmcx) { return w.alpha(1.0/Trecipmcx, rho, molefrac); };
+                auto ders = diff_static_mcx1<iT, Scalar>(f, Trecip);
                 return powi(Trecip, iT)*ders[iT];
             }
 #endif
@@ -203,14 +259,14 @@ struct TDXDerivatives {
             }
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
             else if constexpr (be == ADBackends::multicomplex) {
-                using fcn_t = std::function< mcx::MultiComplex<double>(const std::valarray<mcx::MultiComplex<double>>&)>;
-                const fcn_t func = [&w, &molefrac](const auto& zs) {
-                    auto Trecip = zs[0], rhomolar = zs[1];
+                auto func = [&w, &molefrac](const auto& zs) {
+                    const auto& Trecip = zs[0];
+                    const auto& rhomolar = zs[1];
                     return w.alpha(1.0 / Trecip, rhomolar, molefrac);
                 };
-                std::vector<double> xs = { 1.0 / T, rho};
-                std::vector<int> order = { iT, iD };
-                auto der = mcx::diff_mcxN(func, xs, order);
+                std::array<Scalar, 2> xs = { 1.0 / T, rho};
+                std::array<int, 2> order = { iT, iD };
+                auto der = diff_static_mcxN<iT + iD>(func, xs, order);
                 return powi(1.0 / T, iT)*powi(rho, iD)*der;
             }
 #endif
@@ -232,7 +288,12 @@ struct TDXDerivatives {
     template<int iT, int iD, ADBackends be = ADBackends::autodiff>
     static auto get_Arxy(const Model& model, const Scalar& T, const Scalar& rho, const VectorType& molefrac) {
         auto wrapper = AlphaCallWrapper<AlphaWrapperOption::residual, decltype(model)>(model);
-        if constexpr (iT == 0 && iD == 0) {
+        if constexpr (be == ADBackends::analytic) {
+            static_assert(has_analytic_Arxy<std::decay_t<Model>>::value, "The analytic backend requires a model implementing get_Arxy_analytic");
+            static_assert(std::is_same_v<Scalar, double>, "The analytic backend is only available for double");
+            return model.template get_Arxy_analytic<iT, iD>(T, rho, molefrac);
+        }
+        else if constexpr (iT == 0 && iD == 0) {
             return wrapper.alpha(T, rho, molefrac);
         }
         else {
@@ -324,10 +385,8 @@ struct TDXDerivatives {
         }
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
         else {
-            using fcn_t = std::function<mcx::MultiComplex<Scalar>(const mcx::MultiComplex<Scalar>&)>;
-            bool and_val = true;
-            fcn_t f = [&w, &T, &molefrac](const auto& rhomcx) { return w.alpha(T, rhomcx, molefrac); };
-            auto ders = diff_mcx1(f, rho, Nderiv, and_val);
+            auto f = [&w, &T, &molefrac](const auto& rhomcx) { return w.alpha(T, rhomcx, molefrac); };
+            auto ders = diff_static_mcx1<Nderiv, Scalar>(f, rho);
             for (auto n = 0; n <= Nderiv; ++n) {
                 o[n] = powi(rho, n) * ders[n];
             }
@@ -352,9 +411,8 @@ struct TDXDerivatives {
         }
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
         else if constexpr (be == ADBackends::multicomplex) {
-            using fcn_t = std::function<mcx::MultiComplex<Scalar>(const mcx::MultiComplex<Scalar>&)>;
-            fcn_t f = [&](const auto& Trecipmcx) { return w.alpha(1.0/Trecipmcx, rho, molefrac); };
-            auto ders = diff_mcx1(f, Trecip, Nderiv+1, true /* and_val */);
+            auto f = [&](const auto& Trecipmcx) { return w.alpha(1.0/Trecipmcx, rho, molefrac); };
+            auto ders = diff_static_mcx1<Nderiv, Scalar>(f, Trecip);
             for (auto n = 0; n <= Nderiv; ++n) {
                 o[n] = powi(Trecip, n) * ders[n];
             }
@@ -366,6 +424,67 @@ struct TDXDerivatives {
         return o;
     }
     
+    /**
+    * Calculate all the derivatives \f$\Lambda_{ij}\f$ with \f$i+j \leq N\f$ in N+1 univariate Taylor passes rather than one evaluation per derivative.
+    *
+    * Along the direction \f$(a,b)\f$, with \f$(1/T)(s) = (1/T)_0(1+as)\f$ and \f$\rho(s) = \rho_0(1+bs)\f$, the k-th derivative with respect to \f$s\f$ is
+    * \f[
+    * \frac{{\rm d}^k\alpha}{{\rm d}s^k} = \sum_{i+j=k} \binom{k}{i}a^ib^j\Lambda_{ij}
+    * \f]
+    * so the derivatives of order k are obtained by solving a small linear system built from the N+1 directions.
+    *
+    * Entries with i+j > N are set to zero
+    */
+    template<int Nderiv, ADBackends be = ADBackends::autodiff, class AlphaWrapper>
+    static auto get_Agen_tensor(const AlphaWrapper& w, const Scalar& T, const Scalar& rho, const VectorType& molefrac) {
+        static_assert(Nderiv >= 1);
+        static_assert(be == ADBackends::autodiff, "Only the autodiff backend is supported in get_Agen_tensor");
+        constexpr int Ndir = Nderiv + 1;
+        Eigen::Array<Scalar, Nderiv+1, Nderiv+1> o; o.setZero();
+        Eigen::Array<Scalar, Ndir, 1> a, b;
+        Eigen::Array<Scalar, Ndir, Nderiv+1> ders; // ders(m, k) is the k-th derivative along the m-th direction
+        const Scalar Trecip = 1.0 / T;
+        for (auto m = 0; m < Ndir; ++m) {
+            // Directions are evenly spaced on the half circle
+            Scalar theta = static_cast<double>(EIGEN_PI)*m/Ndir;
+            a[m] = cos(theta); b[m] = sin(theta);
+            autodiff::Real<Nderiv, Scalar> s_ = 0.0;
+            auto f = [&](const auto& s__) {
+                return w.alpha(forceeval(1.0/(Trecip*(1.0 + a[m]*s__))), forceeval(rho*(1.0 + b[m]*s__)), molefrac);
+            };
+            auto d = derivatives(f, along(1), at(s_));
+            for (auto k = 0; k <= Nderiv; ++k) {
+                ders(m, k) = d[k];
+            }
+        }
+        o(0, 0) = ders(0, 0);
+        for (auto k = 1; k <= Nderiv; ++k) {
+            Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> A(Ndir, k+1);
+            for (auto m = 0; m < Ndir; ++m) {
+                Scalar binom = 1.0;
+                for (auto j = 0; j <= k; ++j) {
+                    A(m, j) = binom*powi(a[m], k-j)*powi(b[m], j);
+                    binom *= static_cast<double>(k-j)/(j+1);
+                }
+            }
+            Eigen::Matrix<Scalar, Eigen::Dynamic, 1> rhs = ders.col(k).matrix();
+            Eigen::Matrix<Scalar, Eigen::Dynamic, 1> Lambda = A.colPivHouseholderQr().solve(rhs);
+            for (auto j = 0; j <= k; ++j) {
+                o(k-j, j) = Lambda[j];
+            }
+        }
+        return o;
+    }
+
+    /**
+    * Calculate the tensor of derivatives \f$\Lambda^{\rm r}_{ij}\f$ with \f$i+j \leq N\f$, see get_Agen_tensor
+    */
+    template<int Nderiv, ADBackends be = ADBackends::autodiff>
+    static auto get_Ar_tensor(const Model& model, const Scalar& T, const Scalar& rho, const VectorType& molefrac) {
+        auto wrapper = AlphaCallWrapper<AlphaWrapperOption::residual, decltype(model)>(model);
+        return get_Agen_tensor<Nderiv, be>(wrapper, T, rho, molefrac);
+    }
+
     /**
     * Calculate the derivative \f$\Lambda^{\rm r}_{x0}\f$, where
     * \f[
@@ -402,13 +521,13 @@ struct TDXDerivatives {
                 return get_Ar00(model, T, rho, molefrac);
             }
             else if (idelta == 1) {
-                return get_Ar01(model, T, rho, molefrac);
+                return get_Ar01<be>(model, T, rho, molefrac);
             }
             else if (idelta == 2) {
-                return get_Ar02(model, T, rho, molefrac);
+                return get_Ar02<be>(model, T, rho, molefrac);
             }
             else if (idelta == 3) {
-                return get_Ar03(model, T, rho, molefrac);
+                return get_Ar03<be>(model, T, rho, molefrac);
             }
             else {
                 throw std::invalid_argument("Invalid value for idelta");
@@ -416,13 +535,13 @@ struct TDXDerivatives {
         }
         else if (itau == 1){
             if (idelta == 0) {
-                return get_Ar10(model, T, rho, molefrac);
+                return get_Ar10<be>(model, T, rho, molefrac);
             }
             else if (idelta == 1) {
-                return get_Ar11(model, T, rho, molefrac);
+                return get_Ar11<be>(model, T, rho, molefrac);
             }
             else if (idelta == 2) {
-                return get_Ar12(model, T, rho, molefrac);
+                return get_Ar12<be>(model, T, rho, molefrac);
             }
             else {
                 throw std::invalid_argument("Invalid value for idelta");
@@ -430,10 +549,10 @@ struct TDXDerivatives {
         }
         else if (itau == 2) {
             if (idelta == 0) {
-                return get_Ar20(model, T, rho, molefrac);
+                return get_Ar20<be>(model, T, rho, molefrac);
             }
             else if (idelta == 1) {
-                return get_Ar21(model, T, rho, molefrac);
+                return get_Ar21<be>(model, T, rho, molefrac);
             }
             else {
                 throw std::invalid_argument("Invalid value for idelta");
@@ -441,7 +560,7 @@ struct TDXDerivatives {
         }
         else if (itau == 3) {
             if (idelta == 0) {
-                return get_Ar30(model, T, rho, molefrac);
+                return get_Ar30<be>(model, T, rho, molefrac);
             }
             else {
                 throw std::invalid_argument("Invalid value for idelta");
@@ -486,8 +605,10 @@ struct VirialDerivatives {
     {
         std::map<int, double> dnalphardrhon;
         if constexpr(be == ADBackends::autodiff){
+            // Real is a truncated Taylor polynomial, so all the derivatives come from one evaluation at a cost of O(N^2) per
+            // operation; B_Nderiv only needs the derivatives up to order Nderiv-1
             auto f = [&model, &T, &molefrac](const auto& rho_) { return model.alphar(T, rho_, molefrac); };
-            autodiff::Real<Nderiv, Scalar> rhoreal = 0.0;
+            autodiff::Real<Nderiv-1, Scalar> rhoreal = 0.0;
             auto derivs = derivatives(f, along(1), at(rhoreal));
             
             for (auto n = 1; n < Nderiv; ++n){
@@ -527,15 +648,10 @@ struct VirialDerivatives {
     template <ADBackends be = ADBackends::autodiff>
     static auto get_Bnvir_runtime(const int Nderiv, const Model& model, const Scalar &T, const VectorType& molefrac) {
         switch(Nderiv){
-            case 2: return get_Bnvir<2,be>(model, T, molefrac);
-            case 3: return get_Bnvir<3,be>(model, T, molefrac);
-            case 4: return get_Bnvir<4,be>(model, T, molefrac);
-            case 5: return get_Bnvir<5,be>(model, T, molefrac);
-            case 6: return get_Bnvir<6,be>(model, T, molefrac);
-            case 7: return get_Bnvir<7,be>(model, T, molefrac);
-            case 8: return get_Bnvir<8,be>(model, T, molefrac);
-            case 9: return get_Bnvir<9,be>(model, T, molefrac);
-            default: throw std::invalid_argument("Only Nderiv up to 9 is supported, get_Bnvir templated function allows more");
+            #define X(i) case i: return get_Bnvir<i,be>(model, T, molefrac);
+                BNVIR_args
+            #undef X
+            default: throw std::invalid_argument("Only Nderiv from 2 to 12 is supported, get_Bnvir templated function allows more");
         }
     }
 
@@ -617,6 +733,65 @@ struct VirialDerivatives {
             throw std::invalid_argument("Nderiv is invalid in get_dmBnvirdTm_runtime");
         }
     }
+
+    /**
+    * \brief All the temperature derivatives of a virial coefficient up to the order NTderiv, from one evaluation
+    *
+    * The density derivatives are taken first, and then the temperature derivatives, so that the chain of derivatives of a single
+    * nested dual evaluation passes through all of \f$\partial^m B_n/\partial T^m\f$ for m from 0 to NTderiv
+    * \tparam Nderiv The virial coefficient to return; e.g. 5: B_5
+    * \tparam NTderiv The highest number of temperature derivatives
+    * \returns An array of length NTderiv+1 whose m-th entry is \f$\partial^m B_n/\partial T^m\f$
+    */
+    template <int Nderiv, int NTderiv, ADBackends be = ADBackends::autodiff>
+    static auto get_dmBnvirdTm_all(const Model& model, const Scalar& T, const VectorType& molefrac)
+    {
+        static_assert(be == ADBackends::autodiff, "Only the autodiff backend is supported in get_dmBnvirdTm_all");
+        autodiff::HigherOrderDual<NTderiv + Nderiv-1, double> rhodual = 0.0, Tdual = T;
+        auto f = [&model, &molefrac](const auto& T_, const auto& rho_) { return model.alphar(T_, rho_, molefrac); };
+        auto wrts = std::tuple_cat(build_duplicated_tuple<Nderiv-1>(std::ref(rhodual)), build_duplicated_tuple<NTderiv>(std::ref(Tdual)));
+        auto derivs = derivatives(f, std::apply(wrt_helper(), wrts), at(Tdual, rhodual));
+        Eigen::Array<Scalar, NTderiv+1, 1> o;
+        for (auto m = 0; m <= NTderiv; ++m) {
+            o[m] = derivs[Nderiv-1+m] / tgamma(Nderiv - 1);
+        }
+        return o;
+    }
+
+    /// Fill the rows of o, from B_2 in the first row to B_Nmax, with the temperature derivatives from get_dmBnvirdTm_all
+    template <int NTderiv, ADBackends be = ADBackends::autodiff>
+    static void fill_dmBnvirdTm_matrix(const int Nmax, const Model& model, const Scalar& T, const VectorType& molefrac, Eigen::Array<Scalar, Eigen::Dynamic, Eigen::Dynamic>& o) {
+        for (auto n = 2; n <= Nmax; ++n) {
+            switch (n) {
+            case 2: o.row(0) = get_dmBnvirdTm_all<2, NTderiv, be>(model, T, molefrac).transpose(); break;
+            case 3: o.row(1) = get_dmBnvirdTm_all<3, NTderiv, be>(model, T, molefrac).transpose(); break;
+            case 4: o.row(2) = get_dmBnvirdTm_all<4, NTderiv, be>(model, T, molefrac).transpose(); break;
+            case 5: o.row(3) = get_dmBnvirdTm_all<5, NTderiv, be>(model, T, molefrac).transpose(); break;
+            case 6: o.row(4) = get_dmBnvirdTm_all<6, NTderiv, be>(model, T, molefrac).transpose(); break;
+            default: throw std::invalid_argument("Nmax is invalid in get_dmBnvirdTm_matrix_runtime");
+            }
+        }
+    }
+
+    /**
+    * \brief The matrix of the virial coefficients B_2 to B_Nmax and of their temperature derivatives up to the order NTmax
+    *
+    * Row n-2 holds \f$\partial^m B_n/\partial T^m\f$ in column m.  Each row is obtained from one evaluation with get_dmBnvirdTm_all,
+    * rather than one evaluation per entry as with get_dmBnvirdTm_runtime.  Nmax may be from 2 to 6 and NTmax from 0 to 3
+    */
+    template <ADBackends be = ADBackends::autodiff>
+    static auto get_dmBnvirdTm_matrix_runtime(const int Nmax, const int NTmax, const Model& model, const Scalar& T, const VectorType& molefrac) {
+        if (Nmax < 2 || Nmax > 6) { throw std::invalid_argument("Nmax is invalid in get_dmBnvirdTm_matrix_runtime"); }
+        Eigen::Array<Scalar, Eigen::Dynamic, Eigen::Dynamic> o(Nmax - 1, NTmax + 1);
+        switch (NTmax) {
+        case 0: fill_dmBnvirdTm_matrix<0, be>(Nmax, model, T, molefrac, o); break;
+        case 1: fill_dmBnvirdTm_matrix<1, be>(Nmax, model, T, molefrac, o); break;
+        case 2: fill_dmBnvirdTm_matrix<2, be>(Nmax, model, T, molefrac, o); break;
+        case 3: fill_dmBnvirdTm_matrix<3, be>(Nmax, model, T, molefrac, o); break;
+        default: throw std::invalid_argument("NTmax is invalid in get_dmBnvirdTm_matrix_runtime");
+        }
+        return o;
+    }
     
     /**
      * \brief Calculate the cross-virial coefficient \f$B_{12}\f$
@@ -637,6 +812,28 @@ struct VirialDerivatives {
     }
 };
 
+/**
+ \brief Re-usable buffers for the workspace overloads of IsochoricDerivatives::build_Psir_Hessian_autodiff and IsochoricDerivatives::build_Psir_fgradHessian_autodiff
+ 
+ The buffers are resized on the first call (or if the number of components changes), after which the
+ calls do not allocate on the heap. The outputs are stored in Psir, gradient, and Hessian.
+ */
+struct IsochoricWorkspace {
+    ArrayXdual2nd rhovecc; ///< The molar concentrations as autodiff variables
+    ArrayXdual2nd molefrac; ///< The mole fractions as autodiff variables
+    dual2nd u; ///< The function value as an autodiff variable
+    Eigen::VectorXd g; ///< The gradient from autodiff
+    double Psir = 0; ///< The value of \f$\Psi^{\rm r}\f$
+    Eigen::ArrayXd gradient; ///< The gradient of \f$\Psi^{\rm r}\f$ w.r.t. the molar concentrations
+    Eigen::MatrixXd Hessian; ///< The Hessian of \f$\Psi^{\rm r}\f$ w.r.t. the molar concentrations
+    
+    void resize(Eigen::Index N) {
+        if (rhovecc.size() != N) {
+            rhovecc.resize(N); molefrac.resize(N); g.resize(N); gradient.resize(N); Hessian.resize(N, N);
+        }
+    }
+};
+
 /**
  In the isochoric formalism, the fugacity coefficient array can be obtained by the gradient of the residual Helmholtz energy density (which is a scalar) and the compressibility factor \f$Z\f$  (which is also a scalar) in terms of the temperature \f$T\f$ and the molar concentration vector \f$\vec\rho\f$:
  \begin{equation}
@@ -727,6 +924,44 @@ struct VirialDerivatives {
 template<typename Model, typename Scalar = double, typename VectorType = Eigen::ArrayXd>
 struct IsochoricDerivatives{
 
+    /// True if the closed-form Psir derivatives of the model are used for concentrations of type RhoVecType
+    template<typename RhoVecType>
+    static constexpr bool use_analytic_Psir = has_analytic_Psir_fgradHessian<std::decay_t<Model>>::value && std::is_same_v<Scalar, double> && std::is_same_v<std::decay_t<decltype(std::declval<const RhoVecType&>()[0])>, double>;
+
+    /// True if the gradient and Hessian of Psir are obtained in one evaluation with VectorDual concentrations (for up to
+    /// VectorDual::max_size components) for concentrations of type RhoVecType, rather than one autodiff evaluation per direction
+    template<typename RhoVecType>
+    static constexpr bool use_vector_dual_Psir = std::is_same_v<Scalar, double> && std::is_same_v<std::decay_t<decltype(std::declval<const RhoVecType&>()[0])>, double>;
+
+    /***
+    * \brief Psir = ar*rho with the molar concentrations as the VectorDual variables, so that the result carries the gradient
+    * (and for vdual2nd the Hessian) of Psir w.r.t. the molar concentrations
+    *
+    * The arrays of the concentrations and mole fractions have a fixed capacity, so nothing is allocated here
+    */
+    template<typename VD, typename RhoVecType>
+    static VD get_Psir_vector_dual(const Model& model, const Scalar& T, const RhoVecType& rho) {
+        const auto N = static_cast<int>(rho.size());
+        Eigen::Array<VD, Eigen::Dynamic, 1, 0, VD::max_size, 1> rhovecc(N);
+        for (auto i = 0; i < N; ++i) { rhovecc[i] = VD::variable(rho[i], i, N); }
+        auto rhotot_ = rhovecc.sum();
+        auto molefrac = (rhovecc / rhotot_).eval();
+        return model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_;
+    }
+
+    /// Unpack Psir, its gradient and its Hessian from the result of get_Psir_vector_dual<vdual2nd>; g and H must have the right sizes
+    template<typename GradType, typename HessType>
+    static void unpack_vector_dual(const vdual2nd& Psir, double& f, GradType& g, HessType& H) {
+        f = Psir.val;
+        const auto N = g.size();
+        for (auto i = 0; i < N; ++i) {
+            g[i] = Psir.grad[i];
+            for (auto j = 0; j <= i; ++j) {
+                H(i, j) = H(j, i) = Psir.hessian(static_cast<int>(i), static_cast<int>(j));
+            }
+        }
+    }
+
     /***
     * \brief Calculate the residual entropy (s^+ = -sr/R) from derivatives of alphar
     */
@@ -797,21 +1032,46 @@ struct IsochoricDerivatives{
     /***
     * \brief Calculate the Hessian of Psir = ar*rho w.r.t. the molar concentrations
     *
-    * Requires the use of autodiff derivatives to calculate second partial derivatives
+    * Requires the use of autodiff derivatives to calculate second partial derivatives, unless the model provides them in closed form (see has_analytic_Psir_fgradHessian)
+    *
+    * For up to vdual2nd::max_size components, the Hessian comes from one evaluation with VectorDual concentrations (see
+    * get_Psir_vector_dual), otherwise from one autodiff evaluation per pair of components
     */
     static auto build_Psir_Hessian_autodiff(const Model& model, const Scalar& T, const VectorType& rho) {
-        // Double derivatives in each component's concentration
-        // N^N matrix (symmetric)
+        if constexpr (use_analytic_Psir<VectorType>) {
+            return std::get<2>(model.get_Psir_fgradHessian_analytic(T, rho));
+        }
+        else {
+            if constexpr (use_vector_dual_Psir<VectorType>) {
+                if (rho.size() <= vdual2nd::max_size) {
+                    double f; Eigen::ArrayXd g(rho.size()); Eigen::MatrixXd H(rho.size(), rho.size());
+                    unpack_vector_dual(get_Psir_vector_dual<vdual2nd>(model, T, rho), f, g, H);
+                    return H;
+                }
+            }
+            // Double derivatives in each component's concentration
+            // N^N matrix (symmetric)
+
+            dual2nd u; // the output scalar u = f(x), evaluated together with Hessian below
+            ArrayXdual2nd g;
+            ArrayXdual2nd rhovecc(rho.size()); for (auto i = 0; i < rho.size(); ++i) { rhovecc[i] = rho[i]; }
+            auto hfunc = [&model, &T](const ArrayXdual2nd& rho_) {
+                auto rhotot_ = rho_.sum();
+                auto molefrac = (rho_ / rhotot_).eval();
+                return eval(model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_);
+            };
+            return autodiff::hessian(hfunc, wrt(rhovecc), at(rhovecc), u, g).eval(); // evaluate the function value u, its gradient, and its Hessian matrix H
+        }
+    }
 
-        dual2nd u; // the output scalar u = f(x), evaluated together with Hessian below
-        ArrayXdual2nd g;
-        ArrayXdual2nd rhovecc(rho.size()); for (auto i = 0; i < rho.size(); ++i) { rhovecc[i] = rho[i]; }
-        auto hfunc = [&model, &T](const ArrayXdual2nd& rho_) {
-            auto rhotot_ = rho_.sum();
-            auto molefrac = (rho_ / rhotot_).eval();
-            return eval(model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_);
-        };
-        return autodiff::hessian(hfunc, wrt(rhovecc), at(rhovecc), u, g).eval(); // evaluate the function value u, its gradient, and its Hessian matrix H
+    /***
+    * \brief Calculate the Hessian of Psir = ar*rho w.r.t. the molar concentrations, storing the result in ws.Hessian
+    *
+    * Like build_Psir_Hessian_autodiff, but the autodiff buffers come from the workspace, so repeated calls with the same
+    * number of components do not allocate
+    */
+    static void build_Psir_Hessian_autodiff(const Model& model, const Scalar& T, const VectorType& rho, IsochoricWorkspace& ws) {
+        build_Psir_fgradHessian_autodiff(model, T, rho, ws);
     }
 
     /***
@@ -820,23 +1080,66 @@ struct IsochoricDerivatives{
     * Uses autodiff to calculate the derivatives
     */
     static auto build_Psir_fgradHessian_autodiff(const Model& model, const Scalar& T, const VectorType& rho) {
-        // Double derivatives in each component's concentration
-        // N^N matrix (symmetric)
+        if constexpr (use_analytic_Psir<VectorType>) {
+            return model.get_Psir_fgradHessian_analytic(T, rho);
+        }
+        else {
+            if constexpr (use_vector_dual_Psir<VectorType>) {
+                if (rho.size() <= vdual2nd::max_size) {
+                    double f; Eigen::ArrayXd g(rho.size()); Eigen::MatrixXd H(rho.size(), rho.size());
+                    unpack_vector_dual(get_Psir_vector_dual<vdual2nd>(model, T, rho), f, g, H);
+                    return std::make_tuple(f, g, H);
+                }
+            }
+            // Double derivatives in each component's concentration
+            // N^N matrix (symmetric)
+
+            dual2nd u; // the output scalar u = f(x), evaluated together with Hessian below
+            ArrayXdual g;
+            ArrayXdual2nd rhovecc(rho.size()); for (auto i = 0; i < rho.size(); ++i) { rhovecc[i] = rho[i]; }
+            auto hfunc = [&model, &T](const ArrayXdual2nd& rho_) {
+                auto rhotot_ = rho_.sum();
+                auto molefrac = (rho_ / rhotot_).eval();
+                return eval(model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_);
+            };
+            // Evaluate the function value u, its gradient, and its Hessian matrix H
+            Eigen::MatrixXd H = autodiff::hessian(hfunc, wrt(rhovecc), at(rhovecc), u, g); 
+            // Remove autodiff stuff from the numerical values
+            auto f = getbaseval(u);
+            auto gg = g.cast<double>().eval();
+            return std::make_tuple(f, gg, H);
+        }
+    }
 
-        dual2nd u; // the output scalar u = f(x), evaluated together with Hessian below
-        ArrayXdual g;
-        ArrayXdual2nd rhovecc(rho.size()); for (auto i = 0; i < rho.size(); ++i) { rhovecc[i] = rho[i]; }
-        auto hfunc = [&model, &T](const ArrayXdual2nd& rho_) {
-            auto rhotot_ = rho_.sum();
-            auto molefrac = (rho_ / rhotot_).eval();
-            return eval(model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_);
-        };
-        // Evaluate the function value u, its gradient, and its Hessian matrix H
-        Eigen::MatrixXd H = autodiff::hessian(hfunc, wrt(rhovecc), at(rhovecc), u, g); 
-        // Remove autodiff stuff from the numerical values
-        auto f = getbaseval(u);
-        auto gg = g.cast<double>().eval();
-        return std::make_tuple(f, gg, H);
+    /***
+    * \brief Calculate the function value, gradient, and Hessian of Psir = ar*rho w.r.t. the molar concentrations, storing the results in the workspace
+    *
+    * Like build_Psir_fgradHessian_autodiff, but the autodiff buffers come from the workspace, so repeated calls with the same
+    * number of components do not allocate
+    */
+    template<typename RhoVecType>
+    static void build_Psir_fgradHessian_autodiff(const Model& model, const Scalar& T, const RhoVecType& rho, IsochoricWorkspace& ws) {
+        ws.resize(rho.size());
+        if constexpr (use_analytic_Psir<RhoVecType>) {
+            std::tie(ws.Psir, ws.gradient, ws.Hessian) = model.get_Psir_fgradHessian_analytic(T, rho);
+        }
+        else {
+            if constexpr (use_vector_dual_Psir<RhoVecType>) {
+                if (rho.size() <= vdual2nd::max_size) {
+                    unpack_vector_dual(get_Psir_vector_dual<vdual2nd>(model, T, rho), ws.Psir, ws.gradient, ws.Hessian);
+                    return;
+                }
+            }
+            for (auto i = 0; i < rho.size(); ++i) { ws.rhovecc[i] = rho[i]; }
+            auto hfunc = [&model, &T, &ws](const ArrayXdual2nd& rho_) {
+                auto rhotot_ = rho_.sum();
+                ws.molefrac = rho_ / rhotot_; // Pre-sized, so no allocation
+                return eval(model.alphar(T, rhotot_, ws.molefrac) * model.R(ws.molefrac) * T * rhotot_);
+            };
+            autodiff::hessian(hfunc, wrt(ws.rhovecc), at(ws.rhovecc), ws.u, ws.g, ws.Hessian);
+            ws.Psir = getbaseval(ws.u);
+            ws.gradient = ws.g.array();
+        }
     }
 
     /***
@@ -848,7 +1151,7 @@ struct IsochoricDerivatives{
         auto rhotot_ = rho.sum();
         auto molefrac = (rho / rhotot_).eval();
         auto H = build_Psir_Hessian_autodiff(model, T, rho).eval();
-        for (auto i = 0; i < 2; ++i) {
+        for (auto i = 0; i < rho.size(); ++i) {
             H(i, i) += model.R(molefrac) * T / rho[i];
         }
         return H;
@@ -858,22 +1161,20 @@ struct IsochoricDerivatives{
     /***
     * \brief Calculate the Hessian of Psir = ar*rho w.r.t. the molar concentrations (residual contribution only)
     *
-    * Requires the use of multicomplex derivatives to calculate second partial derivatives
+    * Requires the use of multicomplex derivatives to calculate second partial derivatives; each element is obtained from
+    * one evaluation with bicomplex concentrations of static storage
     */
     static auto build_Psir_Hessian_mcx(const Model& model, const Scalar& T, const VectorType& rho) {
         // Double derivatives in each component's concentration
         // N^N matrix (symmetric)
-        using namespace mcx;
 
         // Lambda function for getting Psir with multicomplex concentrations
-        using fcn_t = std::function< MultiComplex<double>(const Eigen::ArrayX<MultiComplex<double>>&)>;
-        fcn_t func = [&model, &T](const auto& rhovec) {
+        auto func = [&model, &T](const auto& rhovec) {
             auto rhotot_ = rhovec.sum();
             auto molefrac = (rhovec / rhotot_).eval();
             return model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_;
         };
-        using mattype = Eigen::ArrayXXd;
-        auto H = get_Hessian<mattype, fcn_t, VectorType, HessianMethods::Multiple>(func, rho);
+        auto H = get_static_mcx_Hessian<Scalar>(func, rho);
         return H;
     }
 #endif
@@ -881,17 +1182,28 @@ struct IsochoricDerivatives{
     /***
     * \brief Gradient of Psir = ar*rho w.r.t. the molar concentrations
     *
-    * Uses autodiff to calculate derivatives
+    * Uses autodiff to calculate derivatives, in one evaluation with VectorDual concentrations for up to vdual::max_size components
     */
     static auto build_Psir_gradient_autodiff(const Model& model, const Scalar& T, const VectorType& rho) {
-        ArrayXdual rhovecc(rho.size()); for (auto i = 0; i < rho.size(); ++i) { rhovecc[i] = rho[i]; }
-        auto psirfunc = [&model, &T](const ArrayXdual& rho_) {
-            auto rhotot_ = rho_.sum();
-            auto molefrac = (rho_ / rhotot_).eval();
-            return eval(model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_);
-        };
-        auto val = autodiff::gradient(psirfunc, wrt(rhovecc), at(rhovecc)).eval(); // evaluate the gradient
-        return val;
+        if constexpr (use_analytic_Psir<VectorType>) {
+            return std::get<1>(model.get_Psir_fgradHessian_analytic(T, rho)).matrix().eval();
+        }
+        else {
+            if constexpr (use_vector_dual_Psir<VectorType>) {
+                if (rho.size() <= vdual::max_size) {
+                    auto Psir = get_Psir_vector_dual<vdual>(model, T, rho);
+                    return Eigen::Map<const Eigen::VectorXd>(Psir.grad.data(), rho.size()).eval();
+                }
+            }
+            ArrayXdual rhovecc(rho.size()); for (auto i = 0; i < rho.size(); ++i) { rhovecc[i] = rho[i]; }
+            auto psirfunc = [&model, &T](const ArrayXdual& rho_) {
+                auto rhotot_ = rho_.sum();
+                auto molefrac = (rho_ / rhotot_).eval();
+                return eval(model.alphar(T, rhotot_, molefrac) * model.R(molefrac) * T * rhotot_);
+            };
+            auto val = autodiff::gradient(psirfunc, wrt(rhovecc), at(rhovecc)).eval(); // evaluate the gradient
+            return val;
+        }
     }
 
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
@@ -934,7 +1246,7 @@ struct IsochoricDerivatives{
             rho_type h = 1e-100;
             rhocopy[i] = rhocopy[i] + std::complex<rho_type>(0,h);
             auto calc = psirfunc(T, rhocopy);
-            out[i] = calc.imag / static_cast<double>(h);
+            out[i] = calc.imag() / static_cast<double>(h);
         }
         return out;
     }
@@ -1173,6 +1485,70 @@ struct IsochoricDerivatives{
         return out;
     }
 
+    /***
+    * \brief Calculate the natural logarithm of the fugacity coefficients and all their first derivatives at once
+    *
+    * Returns a tuple of \f$\ln\vec\phi\f$ and of its Jacobian, of size N x (N+2), whose columns are the derivatives w.r.t.
+    * T at constant density and mole fractions, w.r.t. the molar density at constant T and mole fractions, and w.r.t.
+    * each mole fraction at constant T and density (the mole fractions being taken as independent, so only the combinations
+    * of these columns whose coefficients sum to zero are meaningful).
+    *
+    * All of them follow from \f$\Psi^r\f$ and its first and second derivatives w.r.t. T and the molar concentrations, with
+    * \f$Z = 1 + (\sum_j\rho_j\partial\Psi^r/\partial\rho_j - \Psi^r)/(\rho RT)\f$ and
+    * \f$\ln\phi_i = (\partial\Psi^r/\partial\rho_i)/(RT) - \ln Z\f$.  For up to vdual2nd::max_size-1 components, these derivatives
+    * come from one evaluation with VectorDual numbers in \f$(T, \rho_1, \ldots, \rho_N)\f$, otherwise from
+    * build_Psir_fgradHessian_autodiff and build_d2PsirdTdrhoi_autodiff
+    */
+    static auto get_ln_fugacity_coefficients_Jacobian(const Model& model, const Scalar& T, const VectorType& rhovec) {
+        const auto N = rhovec.size();
+        double Psir = 0, dPsirdT = 0;
+        Eigen::ArrayXd g(N), dgdT(N);
+        Eigen::MatrixXd H(N, N);
+        if (N + 1 <= vdual2nd::max_size) {
+            // T is the variable 0, the concentrations are the variables 1 to N
+            const auto n = static_cast<int>(N) + 1;
+            Eigen::Array<vdual2nd, Eigen::Dynamic, 1, 0, vdual2nd::max_size, 1> rhovecc(N);
+            for (auto i = 0; i < N; ++i) { rhovecc[i] = vdual2nd::variable(rhovec[i], i + 1, n); }
+            const auto Tdual = vdual2nd::variable(T, 0, n);
+            auto rhotot_ = rhovecc.sum();
+            auto molefrac = (rhovecc / rhotot_).eval();
+            const vdual2nd P = model.alphar(Tdual, rhotot_, molefrac) * model.R(molefrac) * Tdual * rhotot_;
+            Psir = P.val;
+            dPsirdT = P.grad[0];
+            for (auto i = 0; i < N; ++i) {
+                g[i] = P.grad[i + 1];
+                dgdT[i] = P.hessian(0, i + 1);
+                for (auto j = 0; j <= i; ++j) {
+                    H(i, j) = H(j, i) = P.hessian(i + 1, j + 1);
+                }
+            }
+        }
+        else {
+            std::tie(Psir, g, H) = build_Psir_fgradHessian_autodiff(model, T, rhovec);
+            dPsirdT = get_dPsirdT_constrhovec(model, T, rhovec);
+            dgdT = build_d2PsirdTdrhoi_autodiff(model, T, rhovec);
+        }
+
+        const double rhotot = rhovec.sum();
+        const Eigen::ArrayXd molefrac = (rhovec / rhotot).eval();
+        const double R = model.R(molefrac), RT = R * T;
+        const Eigen::VectorXd rhoH = H * rhovec.matrix(); // H is symmetric, so this is also rhovec^T H
+        const double Z = 1.0 + ((rhovec * g).sum() - Psir) / (rhotot * RT);
+        const double dZdT = ((rhovec * dgdT).sum() - dPsirdT) / (rhotot * RT) - (Z - 1.0) / T;
+        const Eigen::ArrayXd dZdrhovec = rhoH.array() / (rhotot * RT) - (Z - 1.0) / rhotot;
+
+        Eigen::ArrayXd lnphi = g / RT - log(Z);
+        // Derivatives w.r.t. the molar concentrations at constant T
+        Eigen::ArrayXXd J_rhovec = H.array() / RT;
+        J_rhovec.rowwise() -= (dZdrhovec / Z).transpose();
+
+        Eigen::ArrayXXd J(N, N + 2);
+        J.col(0) = dgdT / RT - g / (RT * T) - dZdT / Z;
+        J.col(1) = (J_rhovec.matrix() * molefrac.matrix()).array();
+        J.rightCols(N) = rhotot * J_rhovec;
+        return std::make_tuple(lnphi, J);
+    }
+
     /***
     * \brief Calculate the temperature derivative of the chemical potential of each component
     * \note: Some contributions to the ideal gas part are missing (reference state and cp0), but are not relevant to phase equilibria
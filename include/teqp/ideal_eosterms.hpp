@@ -1,10 +1,14 @@
 #pragma once
 #include <variant>
+#include <array>
 #include <filesystem>
+#include <limits>
+#include <optional>
 
 #include "teqp/types.hpp"
 #include "teqp/exceptions.hpp"
 #include "teqp/json_tools.hpp"
+#include "teqp/per_thread.hpp"
 
 namespace teqp {
 
@@ -21,6 +25,11 @@ namespace teqp {
             using otype = std::common_type_t <TType, RhoType>;
             return forceeval(static_cast<otype>(a));
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            return std::array<double, 4>{a, 0, 0, 0};
+        }
     };
 
     /**
@@ -42,6 +51,12 @@ namespace teqp {
             using otype = std::common_type_t <TType, RhoType>;
             return forceeval(static_cast<otype>(a * log(T)));
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            // a*ln(T) = -a*ln(u)
+            return std::array<double, 4>{-a*log(u), -a, a, -2*a};
+        }
     };
 
     /**
@@ -65,6 +80,11 @@ namespace teqp {
             using otype = std::common_type_t <TType, RhoType>;
             return forceeval(static_cast<otype>(log(rho) + a_1 + a_2 / T));
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part (without the ln(rho)), see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            return std::array<double, 4>{a_1 + a_2*u, a_2*u, 0, 0};
+        }
     };
 
     /**
@@ -83,8 +103,34 @@ namespace teqp {
             }
             return forceeval(summer);
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            // n*T^t = n*u^(-t), so u^k times the k-th derivative is n*u^(-t)*(-t)(-t-1)...(-t-k+1)
+            std::array<double, 4> A{0, 0, 0, 0};
+            for (auto i = 0U; i < n.size(); ++i) {
+                double term = n[i]*pow(u, -t[i]), falling = 1.0;
+                for (auto k = 0; k < 4; ++k) {
+                    A[k] += falling*term;
+                    falling *= (-t[i] - k);
+                }
+            }
+            return A;
+        }
     };
 
+    namespace internal {
+        /// u^k times the k-th derivative with respect to u of n*ln(c + d*exp(theta*u)), k=0..3, added to A
+        inline void add_lnc_dexp_Trecip_derivs(const double u, const double n, const double c, const double d, const double theta, std::array<double, 4>& A) {
+            double D = d*exp(theta*u), s = c + D;
+            double tu = theta*u;
+            A[0] += n*log(s);
+            A[1] += n*tu*D/s;
+            A[2] += n*tu*tu*c*D/(s*s);
+            A[3] += n*tu*tu*tu*c*D*(c - D)/(s*s*s);
+        }
+    }
+
     /**
     \f$ \alpha^{\rm ig}= \sum_k n_k\ln(1-\exp(-\theta_k/T)) \f$
     */
@@ -101,6 +147,16 @@ namespace teqp {
             }
             return forceeval(summer);
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            std::array<double, 4> A{0, 0, 0, 0};
+            for (auto i = 0U; i < n.size(); ++i) {
+                // ln(1-exp(-theta/T)) is ln(c+d*exp(theta'*u)) with c=1, d=-1, theta'=-theta
+                internal::add_lnc_dexp_Trecip_derivs(u, n[i], 1.0, -1.0, -theta[i], A);
+            }
+            return A;
+        }
     };
 
     /**
@@ -125,6 +181,15 @@ namespace teqp {
             }
             return forceeval(summer);
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            std::array<double, 4> A{0, 0, 0, 0};
+            for (auto i = 0U; i < n.size(); ++i) {
+                internal::add_lnc_dexp_Trecip_derivs(u, n[i], c[i], d[i], theta[i], A);
+            }
+            return A;
+        }
     };
 
     /**
@@ -147,6 +212,19 @@ namespace teqp {
             }
             return forceeval(summer);
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            std::array<double, 4> A{0, 0, 0, 0};
+            for (auto i = 0U; i < n.size(); ++i) {
+                double tu = theta[i]*u, th = tanh(tu);
+                A[0] += n[i]*log(std::abs(cosh(tu)));
+                A[1] += n[i]*tu*th;
+                A[2] += n[i]*tu*tu*(1 - th*th);
+                A[3] += -2*n[i]*tu*tu*tu*th*(1 - th*th);
+            }
+            return A;
+        }
     };
 
     /**
@@ -169,6 +247,19 @@ namespace teqp {
             }
             return forceeval(summer);
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            std::array<double, 4> A{0, 0, 0, 0};
+            for (auto i = 0U; i < n.size(); ++i) {
+                double tu = theta[i]*u, cth = 1/tanh(tu);
+                A[0] += n[i]*log(std::abs(sinh(tu)));
+                A[1] += n[i]*tu*cth;
+                A[2] += n[i]*tu*tu*(1 - cth*cth);
+                A[3] += -2*n[i]*tu*tu*tu*cth*(1 - cth*cth);
+            }
+            return A;
+        }
     };
 
     /**
@@ -192,6 +283,12 @@ namespace teqp {
                 c*((T-T_0)/T-log(T/T_0))
             ));
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            // c*(1 - T_0*u + ln(u) + ln(T_0))
+            return std::array<double, 4>{c*(1 - T_0*u + log(u*T_0)), c*(1 - T_0*u), -c, 2*c};
+        }
     };
 
     /**
@@ -215,6 +312,14 @@ namespace teqp {
                 c*(pow(T,t)*(1/(t+1)-1/t) - pow(T_0,t+1)/(T*(t+1)) + pow(T_0,t)/t)
             ));
         }
+
+        /// \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$ for k=0..3, with \f$u=1/T\f$, of the temperature-dependent part, see IdealHelmholtz::get_Aig_k0
+        auto get_Trecip_derivs(const double u) const {
+            // k0*u^(-t) + k1*u + constant
+            double k0 = c*(1/(t+1) - 1/t), k1 = -c*pow(T_0, t+1)/(t+1);
+            double p = k0*pow(u, -t);
+            return std::array<double, 4>{p + k1*u + c*pow(T_0, t)/t, -t*p + k1*u, -t*(-t-1)*p, -t*(-t-1)*(-t-2)*p};
+        }
     };
 
     // The collection of possible terms that could be part of the summation
@@ -290,6 +395,25 @@ namespace teqp {
             }
             return ig;
         }
+        
+        /// The sum of the closed-form \f$u^k\partial^k\alpha^{\rm ig}/\partial u^k\f$, k=0..3, with \f$u=1/T\f$, of the temperature-dependent parts of the terms
+        auto get_Aig_k0(const double T) const {
+            std::array<double, 4> A{0, 0, 0, 0};
+            for (const auto& term : contributions) {
+                auto contrib = std::visit([&](auto& t) { return t.get_Trecip_derivs(1.0/T); }, term);
+                for (auto k = 0; k < 4; ++k) { A[k] += contrib[k]; }
+            }
+            return A;
+        }
+        
+        /// The coefficient of \f$\ln\rho\f$, the only density dependence of the ideal-gas terms
+        double get_lnrho_coeff() const {
+            double c = 0;
+            for (const auto& term : contributions) {
+                c += std::holds_alternative<IdealHelmholtzLead>(term) ? 1.0 : 0.0;
+            }
+            return c;
+        }
     };
 
     /**
@@ -301,10 +425,17 @@ namespace teqp {
      * 
      */
     class IdealHelmholtz {
+    private:
+        /// The temperature-dependent parts of the pures at the last temperature of a thread
+        struct TemperatureCache {
+            double T = std::numeric_limits<double>::quiet_NaN();
+            std::vector<std::array<double, 4>> d;
+        };
+        PerThreadStore<TemperatureCache> Tcache;
         
     public:
         
-        std::vector<PureIdealHelmholtz> pures;
+        std::vector<PureIdealHelmholtz> pures; ///< If changed after construction, the cache of the temperature-dependent parts must be dropped with clear_cache()
         
         IdealHelmholtz(const nlohmann::json &jpures){
             if (!jpures.is_array()) {
@@ -334,6 +465,97 @@ namespace teqp {
             return ig;
         }
         
+        /**
+         \brief The temperature-dependent parts \f$(1/T)^k\partial^k\alpha^{\rm ig}_{oi}/\partial(1/T)^k\f$, k=0..3, of each pure
+
+         They do not depend on density or composition, so they are cached per thread for the last temperature, and the
+         iterations and sweeps at constant temperature evaluate the terms only once.  The reference is valid until the next
+         call in the same thread.
+         */
+        const std::vector<std::array<double, 4>>& get_pure_Aig_k0(const double T) const {
+            auto& c = Tcache.local();
+            if (!(c.T == T) || c.d.size() != pures.size()){
+                c.d.resize(pures.size());
+                for (auto i = 0U; i < pures.size(); ++i){
+                    c.d[i] = pures[i].get_Aig_k0(T);
+                }
+                c.T = T;
+            }
+            return c.d;
+        }
+        
+        /// Drop the cached temperature-dependent parts, in all the threads; not to be called concurrently with the evaluations
+        void clear_cache() { Tcache.reset(); }
+        
+        /**
+         \brief The derivatives \f$\Lambda^{\rm ig}_{k0}=(1/T)^k\partial^k\alpha^{\rm ig}/\partial(1/T)^k\f$ for k=0..3, in closed form
+
+         The terms only depend on temperature, apart from the ln(rho) of the lead term, so no automatic differentiation is needed
+         */
+        template<typename MoleFrac>
+        auto get_Aig_k0(const double T, const double rho, const MoleFrac& molefrac) const {
+            if (molefrac.size() != pures.size()){
+                throw teqp::InvalidArgument("molefrac and pures are not the same length");
+            }
+            Eigen::Array<double, 4, 1> A = Eigen::Array<double, 4, 1>::Zero();
+            const auto& dpures = get_pure_Aig_k0(T);
+            for (auto i = 0U; i < pures.size(); ++i){
+                const double x = getbaseval(molefrac[i]);
+                if (x != 0){
+                    const auto& d = dpures[i];
+                    A[0] += x*(d[0] + pures[i].get_lnrho_coeff()*log(rho) + log(x));
+                    for (auto k = 1; k < 4; ++k){ A[k] += x*d[k]; }
+                }
+            }
+            return A;
+        }
+
+        /**
+         \brief The matrix of derivatives \f$\Lambda^{\rm ig}_{ij}\f$ in the layout of DerivativeHolderSquare<2>, in one pass and in closed form
+
+         The density dependence is \f$\sum_i x_i c_i\ln\rho\f$, so the cross derivatives are zero
+         */
+        template<typename MoleFrac>
+        auto get_deriv_mat2(const double T, const double rho, const MoleFrac& molefrac) const {
+            auto Ak0 = get_Aig_k0(T, rho, molefrac);
+            double c = 0;
+            for (auto i = 0U; i < pures.size(); ++i){
+                c += getbaseval(molefrac[i])*pures[i].get_lnrho_coeff();
+            }
+            Eigen::Array<double, 3, 3> A = Eigen::Array<double, 3, 3>::Zero();
+            A(0, 0) = Ak0[0]; A(1, 0) = Ak0[1]; A(2, 0) = Ak0[2];
+            A(0, 1) = c; A(0, 2) = -c;
+            return A;
+        }
+        
+        /**
+         \brief \f$\Lambda^{\rm ig}_{xy}\f$ in closed form, or nothing if NT is above 3, the highest order of the closed-form temperature derivatives
+
+         Only the \f$c\ln\rho\f$ of the lead terms depends on density, so \f$\Lambda^{\rm ig}_{0y}=c(-1)^{y-1}(y-1)!\f$ for y > 0, and the cross derivatives are zero
+         */
+        template<typename MoleFrac>
+        std::optional<double> get_Aig_xy(const int NT, const int ND, const double T, const double rho, const MoleFrac& molefrac) const {
+            if (NT < 0 || ND < 0 || NT > 3){
+                return std::nullopt;
+            }
+            if (ND == 0){
+                return get_Aig_k0(T, rho, molefrac)[NT];
+            }
+            if (NT > 0){
+                return 0.0;
+            }
+            if (molefrac.size() != pures.size()){
+                throw teqp::InvalidArgument("molefrac and pures are not the same length");
+            }
+            double c = 0;
+            for (auto i = 0U; i < pures.size(); ++i){
+                c += getbaseval(molefrac[i])*pures[i].get_lnrho_coeff();
+            }
+            double factorial = 1;
+            for (auto k = 2; k < ND; ++k){ factorial *= k; }
+            return ((ND % 2 == 1) ? 1.0 : -1.0)*factorial*c;
+        }
+        
         /// This pass-through function is required to allow this model to sit in the AllowedModels variant
         /// which allows the ideal-gas Helmholtz terms to be treated just the same as the residual terms
         template<typename TType, typename RhoType, typename MoleFrac>
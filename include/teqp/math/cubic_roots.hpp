@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace teqp{
+
+/// The real roots, in increasing order, of the monic cubic polynomial \f$x^3 + c_2x^2 + c_1x + c_0\f$, each polished with Newton steps
+inline std::vector<double> get_real_cubic_roots(const double c2, const double c1, const double c0){
+    // The depressed cubic t^3 + P*t + Q = 0, with x = t - c2/3
+    const double shift = c2/3;
+    const double P = c1 - c2*shift, Q = 2*shift*shift*shift - shift*c1 + c0;
+    const double disc = Q*Q/4 + P*P*P/27;
+    std::vector<double> roots;
+    if (disc > 0){
+        // One real root, from Cardano's formula arranged to avoid cancellation
+        const double u = std::cbrt(-Q/2 - std::copysign(std::sqrt(disc), Q));
+        roots.push_back((u != 0 ? u - P/(3*u) : 0) - shift);
+    }
+    else if (P == 0){
+        roots.push_back(-shift);
+    }
+    else{
+        // Three real roots, from the trigonometric form
+        const double pi = 3.14159265358979323846;
+        const double m = 2*std::sqrt(-P/3);
+        const double theta = std::acos(std::clamp(3*Q/(P*m), -1.0, 1.0))/3;
+        for (auto k = 0; k < 3; ++k){
+            roots.push_back(m*std::cos(theta - 2*pi*k/3) - shift);
+        }
+    }
+    for (auto& x : roots){
+        for (auto iter = 0; iter < 2; ++iter){
+            const double f = ((x + c2)*x + c1)*x + c0, dfdx = (3*x + 2*c2)*x + c1;
+            if (dfdx != 0){ x -= f/dfdx; }
+        }
+    }
+    std::sort(roots.begin(), roots.end());
+    return roots;
+}
+
+/**
+ The molar densities, in increasing order, at which the cubic equation of state
+ \f[ p = \frac{RT}{v-b} - \frac{a}{(v+\Delta_1 b)(v+\Delta_2 b)} \f]
+ gives the pressure p; only the roots with \f$0 < b\rho < 1\f$ are kept. In terms of \f$A = ap/(RT)^2\f$ and \f$B = bp/(RT)\f$,
+ the compressibility factor is a root of \f$(Z-B-1)(Z+\Delta_1B)(Z+\Delta_2B) + A(Z-B) = 0\f$
+ */
+inline std::vector<double> get_cubic_EOS_rho_roots(const double a, const double b, const double Delta1, const double Delta2, const double RT, const double p){
+    const double A = a*p/(RT*RT), B = b*p/RT, c = B + 1, s = Delta1 + Delta2, q = Delta1*Delta2;
+    std::vector<double> rhos;
+    for (auto Z : get_real_cubic_roots(s*B - c, q*B*B - c*s*B + A, -(c*q*B*B + A*B))){
+        if (Z > B){
+            rhos.push_back(p/(Z*RT));
+        }
+    }
+    std::sort(rhos.begin(), rhos.end());
+    return rhos;
+}
+
+}
@@ -5,66 +5,77 @@
 
 #pragma once
 
+#include <array>
+#include <functional>
+#include <type_traits>
+
 namespace teqp{
 
 /**
- Gauss-Legendre quadrature for a function f(x) in the interval [a,b]
+ The nodes x in [-1,1] and weights w of the N-point Gauss-Legendre quadrature, as constexpr arrays. Only the
+ values of N listed here are available.
  
  More coefficients here if needed: https://pomax.github.io/bezierinfo/legendre-gauss.html
 */
-template<int N, typename T, typename Double=double>
-inline auto quad(const std::function<T(Double)>& F, const Double& a, const Double& b){
-    
-    // Locations x in [-1,1] where the function is to be evaluated, and the corresponding weight
-    static const std::map<int, std::tuple<std::vector<Double>, std::vector<Double>>> xw = {
-        {
-            3,
-            {{ 0, sqrt(3.0/5), -sqrt(3.0/5) },
-            {8.0/9.0, 5.0/9.0, 5.0/9.0}}
-        },
-        {
-            4,
-            {{sqrt(3.0/7.0-2.0/7.0*sqrt(6.0/5)), -sqrt(3.0/7.0-2.0/7.0*sqrt(6.0/5)), sqrt(3.0/7.0+2.0/7.0*sqrt(6.0/5)), -sqrt(3.0/7.0+2.0/7.0*sqrt(6.0/5))},
-            {(18.0+sqrt(30.0))/36.0, (18.0+sqrt(30.0))/36.0, (18.0-sqrt(30.0))/36.0, (18.0-sqrt(30.0))/36.0}}
-        },
-        {
-            5,
-            {{0, 1.0/3.0*sqrt(5-2*sqrt(10.0/7.0)), -1.0/3.0*sqrt(5-2*sqrt(10.0/7.0)), 1.0/3.0*sqrt(5+2*sqrt(10.0/7.0)), -1.0/3.0*sqrt(5+2*sqrt(10.0/7.0))},
-            {128/225.0, (322.0+13*sqrt(70))/900.0, (322.0+13*sqrt(70))/900.0, (322.0-13*sqrt(70))/900.0, (322.0-13*sqrt(70))/900.0}}
-        },
-        {
-            7,
-            {{0.0000000000000000,0.4058451513773972,-0.4058451513773972,-0.7415311855993945,0.7415311855993945,-0.9491079123427585,0.9491079123427585},
-            { 0.4179591836734694,0.3818300505051189,0.3818300505051189,0.2797053914892766,0.2797053914892766,0.1294849661688697,0.1294849661688697}}
-        },
-        {
-            10,
-            {{-0.1488743389816312,0.1488743389816312,-0.4333953941292472,0.4333953941292472,-0.6794095682990244,0.6794095682990244,-0.8650633666889845,0.8650633666889845,-0.9739065285171717,0.9739065285171717},
-            { 0.2955242247147529,0.2955242247147529,0.2692667193099963,0.2692667193099963,0.2190863625159820,0.2190863625159820,0.1494513491505806,0.1494513491505806,0.0666713443086881,0.0666713443086881}}
-        },
-        {
-            15,
-            {{0.0000000000000000,-0.2011940939974345,0.2011940939974345,-0.3941513470775634,0.3941513470775634,-0.5709721726085388,0.5709721726085388,-0.7244177313601701,0.7244177313601701,-0.8482065834104272,0.8482065834104272,-0.9372733924007060,0.9372733924007060,-0.9879925180204854,0.9879925180204854},
-            {0.2025782419255613,0.1984314853271116,0.1984314853271116,0.1861610000155622,0.1861610000155622,0.1662692058169939,0.1662692058169939,0.1395706779261543,0.1395706779261543,0.1071592204671719,0.1071592204671719,0.0703660474881081,0.0703660474881081,0.0307532419961173,0.0307532419961173}}
-        },
-        {
-            30,
-            {{-0.0514718425553177,0.0514718425553177,-0.1538699136085835,0.1538699136085835,-0.2546369261678899,0.2546369261678899,-0.3527047255308781,0.3527047255308781,-0.4470337695380892,0.4470337695380892,-0.5366241481420199,0.5366241481420199,-0.6205261829892429,0.6205261829892429,-0.6978504947933158,0.6978504947933158,-0.7677774321048262,0.7677774321048262,-0.8295657623827684,0.8295657623827684,-0.8825605357920527,0.8825605357920527,-0.9262000474292743,0.9262000474292743,-0.9600218649683075,0.9600218649683075,-0.9836681232797472,0.9836681232797472,-0.9968934840746495,0.9968934840746495
-            },
-            {0.1028526528935588,0.1028526528935588,0.1017623897484055,0.1017623897484055,0.0995934205867953,0.0995934205867953,0.0963687371746443,0.0963687371746443,0.0921225222377861,0.0921225222377861,0.0868997872010830,0.0868997872010830,0.0807558952294202,0.0807558952294202,0.0737559747377052,0.0737559747377052,0.0659742298821805,0.0659742298821805,0.0574931562176191,0.0574931562176191,0.0484026728305941,0.0484026728305941,0.0387991925696271,0.0387991925696271,0.0287847078833234,0.0287847078833234,0.0184664683110910,0.0184664683110910,0.0079681924961666,0.0079681924961666}}
-        }
-    };
-    
+template<int N> struct GaussLegendre;
+template<> struct GaussLegendre<3> {
+    static constexpr std::array<double, 3> x{0.7745966692414834, 0.0, -0.7745966692414834};
+    static constexpr std::array<double, 3> w{5.0/9.0, 8.0/9.0, 5.0/9.0};
+};
+template<> struct GaussLegendre<4> {
+    static constexpr std::array<double, 4> x{0.8611363115940526, 0.3399810435848563, -0.3399810435848563, -0.8611363115940526};
+    static constexpr std::array<double, 4> w{0.34785484513745374, 0.6521451548625461, 0.6521451548625461, 0.34785484513745374};
+};
+template<> struct GaussLegendre<5> {
+    static constexpr std::array<double, 5> x{0.906179845938664, 0.5384693101056831, 0.0, -0.5384693101056831, -0.906179845938664};
+    static constexpr std::array<double, 5> w{0.236926885056189, 0.47862867049936647, 0.5688888888888889, 0.47862867049936647, 0.236926885056189};
+};
+template<> struct GaussLegendre<7> {
+    static constexpr std::array<double, 7> x{0.9491079123427585, 0.7415311855993945, 0.4058451513773972, 0.0, -0.4058451513773972, -0.7415311855993945, -0.9491079123427585};
+    static constexpr std::array<double, 7> w{0.12948496616886968, 0.2797053914892767, 0.38183005050511903, 0.4179591836734694, 0.38183005050511903, 0.2797053914892767, 0.12948496616886968};
+};
+template<> struct GaussLegendre<10> {
+    static constexpr std::array<double, 10> x{0.9739065285171717, 0.8650633666889845, 0.6794095682990244, 0.43339539412924716, 0.14887433898163122, -0.14887433898163122, -0.43339539412924716, -0.6794095682990244, -0.8650633666889845, -0.9739065285171717};
+    static constexpr std::array<double, 10> w{0.06667134430868803, 0.14945134915058053, 0.21908636251598207, 0.26926671930999624, 0.2955242247147529, 0.2955242247147529, 0.26926671930999624, 0.21908636251598207, 0.14945134915058053, 0.06667134430868803};
+};
+template<> struct GaussLegendre<15> {
+    static constexpr std::array<double, 15> x{0.9879925180204854, 0.937273392400706, 0.8482065834104272, 0.7244177313601701, 0.5709721726085388, 0.3941513470775634, 0.20119409399743451, 0.0, -0.20119409399743451, -0.3941513470775634, -0.5709721726085388, -0.7244177313601701, -0.8482065834104272, -0.937273392400706, -0.9879925180204854};
+    static constexpr std::array<double, 15> w{0.030753241996117495, 0.07036604748810814, 0.10715922046717204, 0.13957067792615427, 0.16626920581699398, 0.1861610000155621, 0.19843148532711158, 0.2025782419255613, 0.19843148532711158, 0.1861610000155621, 0.16626920581699398, 0.13957067792615427, 0.10715922046717204, 0.07036604748810814, 0.030753241996117495};
+};
+template<> struct GaussLegendre<30> {
+    static constexpr std::array<double, 30> x{0.9968934840746495, 0.9836681232797472, 0.9600218649683075, 0.9262000474292743, 0.8825605357920526, 0.8295657623827684, 0.7677774321048262, 0.6978504947933157, 0.6205261829892429, 0.5366241481420199, 0.4470337695380892, 0.3527047255308781, 0.25463692616788985, 0.15386991360858354, 0.0514718425553177, -0.0514718425553177, -0.15386991360858354, -0.25463692616788985, -0.3527047255308781, -0.44703376953808915, -0.5366241481420199, -0.6205261829892429, -0.6978504947933157, -0.7677774321048262, -0.8295657623827684, -0.8825605357920526, -0.9262000474292743, -0.9600218649683075, -0.9836681232797472, -0.9968934840746495};
+    static constexpr std::array<double, 30> w{0.007968192496166643, 0.018466468311090976, 0.0287847078833234, 0.03879919256962709, 0.048402672830594066, 0.057493156217619086, 0.06597422988218049, 0.07375597473770516, 0.08075589522942012, 0.08689978720108299, 0.09212252223778611, 0.09636873717464436, 0.0995934205867952, 0.10176238974840547, 0.10285265289355892, 0.10285265289355892, 0.10176238974840547, 0.0995934205867952, 0.09636873717464436, 0.09212252223778611, 0.08689978720108299, 0.08075589522942012, 0.07375597473770516, 0.06597422988218049, 0.057493156217619086, 0.048402672830594066, 0.03879919256962709, 0.0287847078833234, 0.018466468311090976, 0.007968192496166643};
+};
+
+/**
+ Gauss-Legendre quadrature for a function f(x) in the interval [a,b], where f can be any callable (a lambda, for instance)
+ 
+ The callable is a template parameter and the nodes are compile-time constants, so the loop can be fully inlined,
+ which matters when the integrand is evaluated with autodiff types.
+*/
+template<int N, typename Function, typename Double>
+inline auto quad_inline(const Function& F, const Double& a, const Double& b){
+    using T = std::decay_t<decltype(F(a))>;
+    constexpr auto x = GaussLegendre<N>::x;
+    constexpr auto w = GaussLegendre<N>::w;
+    const Double halfwidth = (b-a)/2.0, mid = (a+b)/2.0;
     T summer = 0.0;
-    // Lookup the coefficients without making a copy or re-allocating
-    const std::tuple<std::vector<Double>, std::vector<Double>> &pair = xw.at(N);
-    const std::vector<Double> &x = std::get<0>(pair);
-    const std::vector<Double> &w = std::get<1>(pair);
     for (auto i = 0; i < N; ++i){
-        Double arg = (b-a)/2.0*x[i] + (a+b)/2.0;
+        Double arg = halfwidth*x[i] + mid;
         summer += w[i]*F(arg);
     }
-    T retval = (b-a)/2.0*summer; // Forces a flattening if T is an autodiff type
+    T retval = halfwidth*summer; // Forces a flattening if T is an autodiff type
+    return retval;
+}
+
+/**
+ Gauss-Legendre quadrature for a function f(x) in the interval [a,b]
+ 
+ This overload takes a std::function; see quad_inline for the version that takes any callable
+*/
+template<int N, typename T, typename Double=double>
+inline auto quad(const std::function<T(Double)>& F, const Double& a, const Double& b){
+    T retval = quad_inline<N>(F, a, b);
     return retval;
 }
 }
@@ -1,6 +1,15 @@
 #pragma once
 
 #include "nlohmann/json.hpp"
+#include "teqp/types.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/math/cubic_roots.hpp"
+#include "teqp/per_thread.hpp"
+#include "teqp/arena.hpp"
+
+#include <tuple>
+#include <valarray>
+#include <vector>
 
 namespace teqp {
 
@@ -22,11 +31,40 @@ inline auto get_association_classes(const std::string& s) {
     }
 }
 
+/// The kinds of association sites. Donor sites bond with acceptor sites, and a site of kind any (the single site of the 1A scheme) bonds with all sites
+enum class site_kind { any, donor, acceptor };
+
+/// Whether a site of kind a can bond with a site of kind b
+inline bool can_bond(site_kind a, site_kind b) {
+    return a == site_kind::any || b == site_kind::any || a != b;
+}
+
+/// The distinct site types of an association scheme, each with its kind and the number of identical sites of that type on the molecule
+inline std::vector<std::tuple<site_kind, int>> get_site_types(association_classes scheme) {
+    switch (scheme) {
+    case association_classes::a1A: return { {site_kind::any, 1} };
+    case association_classes::a2B: return { {site_kind::donor, 1}, {site_kind::acceptor, 1} };
+    case association_classes::a3B: return { {site_kind::donor, 2}, {site_kind::acceptor, 1} };
+    case association_classes::a4C: return { {site_kind::donor, 2}, {site_kind::acceptor, 2} };
+    case association_classes::not_associating: return {};
+    default: throw std::invalid_argument("Bad association class");
+    }
+}
+
 enum class radial_dist { CS, KG, OT };
 
-/// Function that calculates the association binding strength between site A of molecule i and site B on molecule j
-template<typename BType, typename TType, typename RhoType, typename VecType>
-inline auto get_DeltaAB_pure(radial_dist dist, double epsABi, double betaABi, BType b_cubic, TType RT, RhoType rhomolar, const VecType& molefrac) {
+inline auto get_radial_dist(const std::string& s) {
+    if (s == "CS") { return radial_dist::CS; }
+    else if (s == "KG") { return radial_dist::KG; }
+    else if (s == "OT") { return radial_dist::OT; }
+    else {
+        throw std::invalid_argument("bad radial_dist flag:" + s);
+    }
+}
+
+/// The contact value of the radial distribution function, in terms of the co-volume of the mixture
+template<typename BType, typename RhoType>
+inline auto get_radial_dist_contact(radial_dist dist, BType b_cubic, RhoType rhomolar) {
 
     using eta_type = std::common_type_t<decltype(rhomolar), decltype(b_cubic)>;
     eta_type eta;
@@ -54,6 +92,14 @@ inline auto get_DeltaAB_pure(radial_dist dist, double epsABi, double betaABi, BT
             throw std::invalid_argument("Bad radial_dist");
         }
     }
+    return g_vm_ref;
+}
+
+/// Function that calculates the association binding strength between site A of molecule i and site B on molecule j
+template<typename BType, typename TType, typename RhoType, typename VecType>
+inline auto get_DeltaAB_pure(radial_dist dist, double epsABi, double betaABi, BType b_cubic, TType RT, RhoType rhomolar, const VecType& molefrac) {
+
+    auto g_vm_ref = get_radial_dist_contact(dist, b_cubic, rhomolar);
 
     // Calculate the association strength between site Ai and Bi for a pure compent
     auto DeltaAiBj = forceeval(g_vm_ref*(exp(epsABi/RT) - 1.0)*b_cubic* betaABi);
@@ -67,7 +113,7 @@ inline auto get_DeltaAB_pure(radial_dist dist, double epsABi, double betaABi, BT
 /// 
 
 template<typename BType, typename TType, typename RhoType, typename VecType>
-inline auto XA_calc_pure(int N_sites, association_classes scheme, double epsABi, double betaABi, const BType b_cubic, const TType RT, const RhoType rhomolar, const VecType& molefrac) {
+inline auto XA_calc_pure(int N_sites, association_classes scheme, radial_dist dist, double epsABi, double betaABi, const BType b_cubic, const TType RT, const RhoType rhomolar, const VecType& molefrac) {
 
     // Matrix XA(A, j) that contains all of the fractions of sites A not bonded to other active sites for each molecule i
     // Start values for the iteration(set all sites to non - bonded, = 1)
@@ -77,7 +123,6 @@ inline auto XA_calc_pure(int N_sites, association_classes scheme, double epsABi,
     XA.setOnes();
 
     // Get the association strength between the associating sites
-    auto dist = radial_dist::KG; // TODO: pass this in
     auto DeltaAiBj = get_DeltaAB_pure(dist, epsABi, betaABi, b_cubic, RT, rhomolar, molefrac);
 
     if (scheme == association_classes::a1A) { // Acids
@@ -114,6 +159,155 @@ inline auto XA_calc_pure(int N_sites, association_classes scheme, double epsABi,
     return XA;
 };
 
+namespace internal {
+    /**
+     Solve the linear system A*x = b with Gaussian elimination and partial pivoting on the values; works for any numerical type.
+     A is overwritten by the elimination and b by the solution x, so no memory is allocated
+     */
+    template<typename AArray, typename BArray>
+    void gauss_solve_inplace(AArray& A, BArray& b) {
+        using T = typename BArray::Scalar;
+        const auto N = b.size();
+        for (auto col = 0; col < N; ++col) {
+            auto piv = col;
+            for (auto row = col + 1; row < N; ++row) {
+                if (std::abs(getbaseval(A(row, col))) > std::abs(getbaseval(A(piv, col)))) { piv = row; }
+            }
+            if (piv != col) {
+                A.row(col).swap(A.row(piv));
+                std::swap(b[col], b[piv]);
+            }
+            for (auto row = col + 1; row < N; ++row) {
+                auto f = A(row, col) / A(col, col);
+                for (auto k = col; k < N; ++k) { A(row, k) -= f * A(col, k); }
+                b[row] -= f * b[col];
+            }
+        }
+        for (auto row = N - 1; row >= 0; --row) {
+            T summer = b[row];
+            for (auto k = row + 1; k < N; ++k) { summer -= A(row, k) * b[k]; }
+            b[row] = summer / A(row, row);
+        }
+    }
+
+    /**
+     Solve the site-fraction equations of solve_site_fractions by iterating in the numerical type, which works for any numerical type;
+     X holds the starting values on entry and the solution on exit
+
+     A few steps of successive substitution bring the iterate into the basin of Newton's method, which then converges
+     quadratically. One more Newton step is taken after the values have converged so that the derivatives carried by the
+     numerical type have converged as well.  The work arrays are ScratchArray, so they are in the arena if one is installed.
+     */
+    template<typename KArray, typename RhoType, typename XArray>
+    void iterate_site_fractions(const KArray& K, const RhoType& rhomolar, XArray& X, int max_iter = 100, double tol = 1e-13) {
+        using T = typename XArray::Scalar;
+        const auto M = X.size();
+        const int N_substitution = 5;
+        bool converged = false;
+        arena::ScratchArray<T> S(M), F(M); // S = 1 + rho*sum_b K_ab*X_b, and the residual
+        arena::ScratchArray<T, Eigen::Dynamic, Eigen::Dynamic> J(M, M);
+        for (int iter = 0; iter < max_iter; ++iter) {
+            for (auto a = 0; a < M; ++a) {
+                T summer = 0.0;
+                for (auto b = 0; b < M; ++b) { summer += K(a, b) * X[b]; }
+                S[a] = 1.0 + rhomolar * summer;
+            }
+            F = X * S - 1.0;
+            double maxresid = 0;
+            for (auto a = 0; a < M; ++a) { maxresid = std::max(maxresid, std::abs(getbaseval(F[a]))); }
+            if (converged) {
+                // One last Newton step has been taken after convergence of the values
+                break;
+            }
+            if (maxresid < tol) {
+                converged = true;
+            }
+            if (iter < N_substitution && !converged) {
+                for (auto a = 0; a < M; ++a) { X[a] = 1.0 / S[a]; }
+                continue;
+            }
+            // Newton step with Jacobian J_ab = delta_ab*S_a + rho*X_a*K_ab; the step -J^{-1}*F replaces F
+            for (auto a = 0; a < M; ++a) {
+                for (auto b = 0; b < M; ++b) {
+                    J(a, b) = rhomolar * X[a] * K(a, b);
+                }
+                J(a, a) += S[a];
+            }
+            F = -F;
+            internal::gauss_solve_inplace(J, F);
+            // Keep the fractions positive by shortening the step if needed
+            double scale = 1.0;
+            for (auto a = 0; a < M; ++a) {
+                double Xnew = getbaseval(X[a]) + getbaseval(F[a]);
+                if (Xnew <= 0) { scale = std::min(scale, 0.5 * getbaseval(X[a]) / std::abs(getbaseval(F[a]))); }
+            }
+            X += scale * F;
+        }
+        if (!converged) {
+            throw teqp::IterationFailure("Site fractions of association did not converge");
+        }
+    }
+}
+
+/**
+ Solve the site-fraction equations X_a*(1 + rho*sum_b K_ab*X_b) = 1 for the fractions X_a of the sites of each site type a that are
+ not bonded, with K_ab = x_{c(b)}*n_b*Delta_ab, x_{c(b)} the mole fraction of the component carrying site type b and n_b the number of
+ sites of type b on that component; K is an Eigen array (or ArenaArray) of any numerical type
+
+ When the order n of the derivatives carried by the numerical type is known (see get_derivative_order), the equations are
+ solved in doubles, and the derivatives follow from the implicit-function theorem: n chord steps X -= J^{-1}*F(X), with the
+ Jacobian J evaluated once in doubles at the converged solution and the residual F in the numerical type,
+ each make one more order of the derivatives exact.  The cost of the derivatives thus does not grow with the number of
+ iterations.  Otherwise, the solution is iterated in the numerical type, see iterate_site_fractions.
+ */
+template<typename KArray, typename RhoType>
+auto solve_site_fractions(const KArray& K, const RhoType& rhomolar, const Eigen::Ref<const Eigen::ArrayXd>& X0, int max_iter = 100, double tol = 1e-13) {
+    using T = std::common_type_t<typename KArray::Scalar, RhoType>;
+    constexpr int order = get_derivative_order<T>();
+    const auto M = X0.size();
+    Eigen::Array<T, Eigen::Dynamic, 1> X(M);
+    if constexpr (order < 0 || std::is_same_v<T, double>) {
+        X = X0.cast<T>();
+        internal::iterate_site_fractions(K, rhomolar, X, max_iter, tol);
+    }
+    else {
+        if (M == 0) {
+            return X;
+        }
+        arena::ArenaArray<double, Eigen::Dynamic, Eigen::Dynamic> Kd(M, M);
+        for (auto a = 0; a < M; ++a) {
+            for (auto b = 0; b < M; ++b) { Kd(a, b) = getbaseval(K(a, b)); }
+        }
+        const double rhod = getbaseval(rhomolar);
+        arena::ArenaArray<double> Xd(M);
+        Xd = X0;
+        internal::iterate_site_fractions(Kd, rhod, Xd, max_iter, tol);
+
+        // Jacobian J_ab = delta_ab*(1 + rho*sum_c K_ac*X_c) + rho*X_a*K_ab at the solution; the elimination overwrites a copy of it
+        arena::ArenaArray<double, Eigen::Dynamic, Eigen::Dynamic> J(M, M), Jwork(M, M);
+        for (auto a = 0; a < M; ++a) {
+            double summer = 0;
+            for (auto c = 0; c < M; ++c) { summer += Kd(a, c) * Xd[c]; }
+            for (auto b = 0; b < M; ++b) { J(a, b) = rhod * Xd[a] * Kd(a, b); }
+            J(a, a) += 1.0 + rhod * summer;
+        }
+
+        X = Xd.cast<T>();
+        arena::ScratchArray<T> F(M);
+        for (int step = 0; step < order; ++step) {
+            for (auto a = 0; a < M; ++a) {
+                T summer = 0.0;
+                for (auto b = 0; b < M; ++b) { summer += K(a, b) * X[b]; }
+                F[a] = X[a] * (1.0 + rhomolar * summer) - 1.0;
+            }
+            Jwork = J;
+            internal::gauss_solve_inplace(Jwork, F);
+            X -= F;
+        }
+    }
+    return X;
+}
+
 enum class cubic_flag {not_set, PR, SRK};
 inline auto get_cubic_flag(const std::string& s) {
     if (s == "PR") { return cubic_flag::PR; }
@@ -124,6 +318,13 @@ inline auto get_cubic_flag(const std::string& s) {
 }
 
 
+/// The mixture parameters of the cubic part of CPA, computed once per evaluation and shared by the cubic and association terms
+template<typename AType, typename BType>
+struct CPAIntermediates {
+    AType a_cubic;
+    BType b_cubic;
+};
+
 class CPACubic {
 private:
     std::valarray<double> a0, bi, c1, Tc;
@@ -147,35 +348,88 @@ public:
     template<typename VecType>
     auto R(const VecType& molefrac) const { return R_gas; }
 
+    /// The co-volumes b_i of the pure components
+    const auto& get_bi() const { return bi; }
+
+    /// The constants delta_1 and delta_2 of the attractive term
+    auto get_deltas() const { return std::make_tuple(delta_1, delta_2); }
+
     template<typename TType>
     auto get_ai(TType T, int i) const {
         return a0[i] * POW2(1.0 + c1[i]*(1.0 - sqrt(T / Tc[i])));
     }
 
+    /// The interaction parameter k_ij
+    double get_kij(int i, int j) const { return k_ij[i][j]; }
+
+    template<typename VecType>
+    auto get_b(const VecType& molefrac) const {
+        std::decay_t<decltype(molefrac[0])> bsummer = 0.0;
+        for (auto i = 0; i < molefrac.size(); ++i) {
+            bsummer += molefrac[i] * bi[i];
+        }
+        return bsummer;
+    }
+
     template<typename TType, typename VecType>
     auto get_ab(const TType T, const VecType& molefrac) const {
         using return_type = std::common_type_t<decltype(T), decltype(molefrac[0])>;
-        return_type asummer = 0.0, bsummer = 0.0;
+        // sqrt(a_i*a_j) = sqrt(a_i)*sqrt(a_j), with one evaluation of a_i per component
+        std::vector<std::common_type_t<TType, double>> sqrtai(molefrac.size());
+        for (auto i = 0; i < molefrac.size(); ++i) {
+            sqrtai[i] = sqrt(get_ai(T, i));
+        }
+        return_type asummer = 0.0;
         for (auto i = 0; i < molefrac.size(); ++i) {
-            bsummer += molefrac[i] * bi[i];
-            auto ai = get_ai(T, i);
             for (auto j = 0; j < molefrac.size(); ++j) {
-                auto aj = get_ai(T, j);
-                auto a_ij = (1.0 - k_ij[i][j]) * sqrt(ai * aj);
-                asummer += molefrac[i] * molefrac[j] * a_ij;
+                asummer += molefrac[i] * molefrac[j] * (1.0 - k_ij[i][j]) * sqrtai[i] * sqrtai[j];
             }
         }
+        return_type bsummer = get_b(molefrac);
         return std::make_tuple(asummer, bsummer);
     }
 
-    template<typename TType, typename RhoType, typename VecType>
-    auto alphar(const TType T, const RhoType rhomolar, const VecType& molefrac) const {
-        auto [a_cubic, b_cubic] = get_ab(T, molefrac);
+    /// The residual Helmholtz energy of the cubic part from the mixture parameters a and b
+    template<typename TType, typename RhoType, typename AType, typename BType>
+    auto alphar_ab(const TType T, const RhoType rhomolar, const AType& a_cubic, const BType& b_cubic) const {
         return forceeval(
             -log(1.0 - b_cubic * rhomolar) // repulsive part
             -a_cubic/R_gas/T*log((delta_1*b_cubic*rhomolar + 1.0) / (delta_2*b_cubic*rhomolar + 1.0)) / b_cubic / (delta_1 - delta_2) // attractive part
         );
     }
+
+    template<typename TType, typename RhoType, typename VecType>
+    auto alphar(const TType T, const RhoType rhomolar, const VecType& molefrac) const {
+        auto [a_cubic, b_cubic] = get_ab(T, molefrac);
+        return alphar_ab(T, rhomolar, a_cubic, b_cubic);
+    }
+
+    /// The mixture parameters, shared with the association term when this is the core of a composite::CompositeModel
+    template<typename TType, typename RhoType, typename VecType>
+    auto get_intermediates(const TType& T, const RhoType& /*rhomolar*/, const VecType& molefrac) const {
+        auto [a_cubic, b_cubic] = get_ab(T, molefrac);
+        return CPAIntermediates<decltype(a_cubic), decltype(b_cubic)>{a_cubic, b_cubic};
+    }
+
+    /// alphar from the shared mixture parameters, see get_intermediates
+    template<typename AType, typename BType, typename TType, typename RhoType, typename VecType>
+    auto alphar(const CPAIntermediates<AType, BType>& shared, const TType& T, const RhoType& rhomolar, const VecType& /*molefrac*/) const {
+        return alphar_ab(T, rhomolar, shared.a_cubic, shared.b_cubic);
+    }
+};
+
+/**
+ The values of the site fractions of the last converged solution, used to warm-start the solution at the next state point, see
+ CPAAssociation::enable_warm_start.  Each thread has its own, so a thread follows its own sequence of states; copies start empty.
+ */
+class SiteFractionCache {
+private:
+    PerThreadStore<Eigen::ArrayXd> store;
+public:
+    /// The last solution of the calling thread
+    Eigen::ArrayXd& X() const { return store.local(); }
+    /// Forget the last solutions of all the threads
+    void clear() { store.reset(); }
 };
 
 template<typename Cubic>
@@ -186,6 +440,18 @@ private:
     const std::valarray<double> epsABi, betaABi;
     const std::vector<int> N_sites; 
     const double R_gas;
+    const radial_dist dist; ///< The radial distribution function at contact used in the association strength
+
+    /// A type of site on a component, with the number of identical sites of that type on the molecule
+    struct SiteType {
+        int component;
+        site_kind kind;
+        int multiplicity;
+    };
+    const std::vector<SiteType> site_types;
+
+    bool warm_start = false;
+    mutable SiteFractionCache Xcache;
 
     auto get_N_sites(const std::vector<association_classes> &classes) {
         std::vector<int> N_sites_out;
@@ -195,6 +461,7 @@ private:
             case association_classes::a2B: return 2;
             case association_classes::a3B: return 3;
             case association_classes::a4C: return 4;
+            case association_classes::not_associating: return 0;
             default: throw std::invalid_argument("Bad association class");
             }
         };
@@ -204,37 +471,126 @@ private:
         return N_sites_out;
     }
 
+    static auto get_site_type_list(const std::vector<association_classes>& classes) {
+        std::vector<SiteType> out;
+        for (auto i = 0; i < static_cast<int>(classes.size()); ++i) {
+            for (auto [kind, multiplicity] : get_site_types(classes[i])) {
+                out.push_back(SiteType{ i, kind, multiplicity });
+            }
+        }
+        return out;
+    }
+
 public:
-    CPAAssociation(const Cubic &&cubic, const std::vector<association_classes>& classes, const std::valarray<double> &epsABi, const std::valarray<double> &betaABi, double R_gas) 
-        : cubic(cubic), classes(classes), epsABi(epsABi), betaABi(betaABi), N_sites(get_N_sites(classes)), R_gas(R_gas) {};
+    CPAAssociation(const Cubic &&cubic, const std::vector<association_classes>& classes, const std::valarray<double> &epsABi, const std::valarray<double> &betaABi, double R_gas, radial_dist dist = radial_dist::KG) 
+        : cubic(cubic), classes(classes), epsABi(epsABi), betaABi(betaABi), N_sites(get_N_sites(classes)), R_gas(R_gas), dist(dist), site_types(get_site_type_list(classes)) {};
+
+    auto get_radial_dist() const { return dist; }
+
+    /**
+     Start the solution for the site fractions of a mixture from the values of the last converged solution rather than from
+     all sites being unbonded, which saves iterations when the model is evaluated at a sequence of nearby states, as along an isotherm
+     or in a phase-equilibrium trace.  The result does not depend on the starting values.
+     */
+    void enable_warm_start(bool enable) {
+        warm_start = enable;
+        Xcache.clear();
+    }
 
+    /**
+     The fractions of the sites of each site type not bonded to other sites, in the order of the components and of the
+     site types within the component (see get_site_types), obtained from the general solver for the site fractions.
+     Combining rules of CR-1 are used for the cross association: epsilon_ij = (epsilon_i + epsilon_j)/2, beta_ij = sqrt(beta_i*beta_j), and the
+     co-volume in the association strength is b_ij = (b_i+b_j)/2.
+     */
     template<typename TType, typename RhoType, typename VecType>
-    auto alphar(const TType& T, const RhoType& rhomolar, const VecType& molefrac) const {
-        // Calculate a and b of the mixture
-        auto [a_cubic, b_cubic] = cubic.get_ab(T, molefrac);
+    auto get_site_fractions(const TType& T, const RhoType& rhomolar, const VecType& molefrac) const {
+        return get_site_fractions(T, rhomolar, molefrac, cubic.get_b(molefrac));
+    }
 
-        // Calculate the fraction of sites not bonded with other active sites
+    /// The site fractions, with the co-volume of the mixture already known
+    template<typename TType, typename RhoType, typename VecType, typename BType>
+    auto get_site_fractions(const TType& T, const RhoType& rhomolar, const VecType& molefrac, const BType& b_cubic) const {
         auto RT = forceeval(R_gas * T); // R times T
-        auto XA = XA_calc_pure(N_sites[0], classes[0], epsABi[0], betaABi[0], b_cubic, RT, rhomolar, molefrac);
+        auto g = get_radial_dist_contact(dist, b_cubic, rhomolar);
+        const auto& bi = cubic.get_bi();
+
+        using K_type = std::common_type_t<decltype(g), decltype(RT), std::decay_t<decltype(molefrac[0])>>;
+        const auto M = static_cast<Eigen::Index>(site_types.size());
+        arena::ScratchArray<K_type, Eigen::Dynamic, Eigen::Dynamic> K(M, M);
+        for (auto a = 0; a < M; ++a) {
+            const auto& sa = site_types[a];
+            for (auto b = 0; b < M; ++b) {
+                const auto& sb = site_types[b];
+                if (!can_bond(sa.kind, sb.kind)) {
+                    K(a, b) = 0.0;
+                    continue;
+                }
+                auto i = sa.component, j = sb.component;
+                double epsAB = (epsABi[i] + epsABi[j]) / 2, betaAB = sqrt(betaABi[i] * betaABi[j]), bij = (bi[i] + bi[j]) / 2;
+                auto DeltaAB = g * (exp(epsAB / RT) - 1.0) * bij * betaAB;
+                K(a, b) = molefrac[j] * static_cast<double>(sb.multiplicity) * DeltaAB;
+            }
+        }
+
+        arena::ArenaArray<double> X0(M);
+        X0.setOnes();
+        if (warm_start) {
+            if (const auto& Xlast = Xcache.X(); Xlast.size() == M) { X0 = Xlast; }
+        }
+        auto X = solve_site_fractions(K, rhomolar, X0);
+        if (warm_start) {
+            auto& Xlast = Xcache.X();
+            Xlast.resize(M);
+            for (auto a = 0; a < M; ++a) { Xlast[a] = getbaseval(X[a]); }
+        }
+        return X;
+    }
+
+    template<typename TType, typename RhoType, typename VecType>
+    auto alphar(const TType& T, const RhoType& rhomolar, const VecType& molefrac) const {
+        return alphar_b(T, rhomolar, molefrac, cubic.get_b(molefrac));
+    }
+
+    /// alphar from the co-volume shared by the cubic part, see CPACubic::get_intermediates
+    template<typename AType, typename BType, typename TType, typename RhoType, typename VecType>
+    auto alphar(const CPAIntermediates<AType, BType>& shared, const TType& T, const RhoType& rhomolar, const VecType& molefrac) const {
+        return alphar_b(T, rhomolar, molefrac, shared.b_cubic);
+    }
 
+    /// alphar, with the co-volume of the mixture already known
+    template<typename TType, typename RhoType, typename VecType, typename BType>
+    auto alphar_b(const TType& T, const RhoType& rhomolar, const VecType& molefrac, const BType& b_cubic) const {
         using return_type = std::common_type_t<decltype(T), decltype(rhomolar), decltype(molefrac[0])>;
         return_type alpha_r_asso = 0.0;
-        auto i = 0;
-        for (auto xi : molefrac){ // loop over all components
-            auto XAi = XA.col(i);
-            alpha_r_asso += forceeval(xi * (log(XAi) - XAi / 2).sum());
-            alpha_r_asso += xi*static_cast<double>(N_sites[i])/2;
-            i++;
+
+        if (classes.size() == 1) {
+            // Explicit solution for the pure fluid
+            // Calculate the fraction of sites not bonded with other active sites
+            auto RT = forceeval(R_gas * T); // R times T
+            auto XA = XA_calc_pure(N_sites[0], classes[0], dist, epsABi[0], betaABi[0], b_cubic, RT, rhomolar, molefrac);
+            alpha_r_asso += forceeval(molefrac[0] * (log(XA.col(0)) - XA.col(0) / 2).sum());
+            alpha_r_asso += molefrac[0]*static_cast<double>(N_sites[0])/2;
+            return forceeval(alpha_r_asso);
+        }
+
+        // General multicomponent solution, summed over the site types with the multiplicity of each type
+        auto X = get_site_fractions(T, rhomolar, molefrac, b_cubic);
+        for (auto a = 0; a < static_cast<int>(site_types.size()); ++a) {
+            const auto& sa = site_types[a];
+            alpha_r_asso += forceeval(molefrac[sa.component] * static_cast<double>(sa.multiplicity) * (log(X[a]) - X[a] / 2.0 + 0.5));
         }
         return forceeval(alpha_r_asso);
     }
 };
 
+template<typename Model> class PreparedCPAEOS;
+
 template <typename Cubic, typename Assoc>
 class CPAEOS {
 public:
     const Cubic cubic;
-    const Assoc assoc;
+    Assoc assoc;
 
     template<class VecType>
     auto R(const VecType& molefrac) const {
@@ -244,21 +600,116 @@ public:
     CPAEOS(Cubic &&cubic, Assoc &&assoc) : cubic(cubic), assoc(assoc) {
     }
 
+    /// Warm-start the solution for the site fractions, see CPAAssociation::enable_warm_start
+    void enable_warm_start(bool enable) { assoc.enable_warm_start(enable); }
+
+    /// Return a view of the model bound to the composition z, see PreparedCPAEOS
+    auto prepare_composition(const Eigen::ArrayXd& z) const {
+        return PreparedCPAEOS<CPAEOS<Cubic, Assoc>>(*this, z);
+    }
+
+    /// The densities, in increasing order, at which the cubic part alone gives the pressure p, from its closed-form roots; they seed the density solver of the full model
+    template<typename VecType>
+    std::vector<double> get_rho_Tp_seeds(const double T, const double p, const VecType& molefrac) const {
+        auto [a_cubic, b_cubic] = cubic.get_ab(T, molefrac);
+        auto [delta_1, delta_2] = cubic.get_deltas();
+        return get_cubic_EOS_rho_roots(a_cubic, b_cubic, delta_1, delta_2, cubic.R(molefrac)*T, p);
+    }
+
     /// Residual dimensionless Helmholtz energy from the SRK or PR core and contribution due to association
     /// alphar = a/(R*T) where a and R are both molar quantities
     template<typename TType, typename RhoType, typename VecType>
     auto alphar(const TType& T, const RhoType& rhomolar, const VecType& molefrac) const {
 
+        // The mixture parameters of the cubic part, used by both contributions
+        const auto shared = cubic.get_intermediates(T, rhomolar, molefrac);
+
         // Calculate the contribution to alphar from the conventional cubic EOS
-        auto alpha_r_cubic = cubic.alphar(T, rhomolar, molefrac);
+        auto alpha_r_cubic = cubic.alphar(shared, T, rhomolar, molefrac);
 
         // Calculate the contribution to alphar from association
-        auto alpha_r_assoc = assoc.alphar(T, rhomolar, molefrac);
+        auto alpha_r_assoc = assoc.alphar(shared, T, rhomolar, molefrac);
 
         return forceeval(alpha_r_cubic + alpha_r_assoc);
     }
 };
 
+/**
+ \brief A view of a CPAEOS model bound to one composition
+
+ The co-volume b and the products z_i*z_j*(1-k_ij) of the cubic part are evaluated once at construction, so the attractive
+ parameter a(T) only needs one a_i(T) per component; without interaction parameters, it is the square of a dot product of
+ length N. The association part only uses b. Calls at any other composition, or with mole fractions that are not of double
+ type, are forwarded to the underlying model. The model must outlive this object.
+ */
+template<typename Model>
+class PreparedCPAEOS {
+private:
+    const Model& model;
+    const Eigen::ArrayXd z;
+    const double b;
+    Eigen::ArrayXXd Zij; ///< z_i*z_j*(1-k_ij), with the off-diagonal terms doubled in the upper triangle
+    bool no_kij = true; ///< True if all the k_ij are zero, so that a = (sum_i z_i*sqrt(a_i))^2
+public:
+    PreparedCPAEOS(const Model& model, const Eigen::ArrayXd& z) : model(model), z(z), b(model.cubic.get_b(z)) {
+        if (z.size() != static_cast<Eigen::Index>(model.cubic.get_bi().size())) {
+            throw teqp::InvalidArgument("Sizes do not match");
+        }
+        const auto N = z.size();
+        Zij.resize(N, N); Zij.setZero();
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = i; j < N; ++j) {
+                no_kij = no_kij && model.cubic.get_kij(i, j) == 0 && model.cubic.get_kij(j, i) == 0;
+                Zij(i, j) = ((i == j) ? 1.0 : 2.0)*z[i]*z[j]*(1.0 - model.cubic.get_kij(i, j));
+            }
+        }
+    }
+
+    template<class VecType>
+    auto R(const VecType& molefrac) const {
+        return model.R(molefrac);
+    }
+
+    template<typename TType>
+    auto get_a(const TType& T) const {
+        using resulttype = std::common_type_t<TType, double>;
+        const auto N = z.size();
+        std::vector<resulttype> sqrtai(N);
+        for (auto i = 0; i < N; ++i) {
+            sqrtai[i] = sqrt(model.cubic.get_ai(T, static_cast<int>(i)));
+        }
+        resulttype a_ = 0.0;
+        if (no_kij) {
+            for (auto i = 0; i < N; ++i) {
+                a_ += z[i]*sqrtai[i];
+            }
+            return forceeval(a_*a_);
+        }
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = i; j < N; ++j) {
+                a_ += Zij(i, j)*sqrtai[i]*sqrtai[j];
+            }
+        }
+        return forceeval(a_);
+    }
+
+    template<typename TType, typename RhoType, typename VecType>
+    auto alphar(const TType& T, const RhoType& rhomolar, const VecType& molefrac) const -> decltype(model.alphar(T, rhomolar, molefrac)) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(molefrac[0])>, double>) {
+            if (all_same_values(z, molefrac)) {
+                return forceeval(model.cubic.alphar_ab(T, rhomolar, get_a(T), b) + model.assoc.alphar_b(T, rhomolar, molefrac, b));
+            }
+        }
+        return model.alphar(T, rhomolar, molefrac);
+    }
+
+    /// See CPAEOS::get_rho_Tp_seeds
+    template<typename VecType>
+    std::vector<double> get_rho_Tp_seeds(const double T, const double p, const VecType& molefrac) const {
+        return model.get_rho_Tp_seeds(T, p, molefrac);
+    }
+};
+
 /// A factory function to return an instantiated CPA instance given
 /// the JSON representation of the model
 inline auto CPAfactory(const nlohmann::json &j){
@@ -286,7 +737,8 @@ inline auto CPAfactory(const nlohmann::json &j){
             classes.push_back(get_association_classes(p["class"]));
             i++;
         }
-        return CPAAssociation(std::move(cubic), classes, epsABi, betaABi, j["R_gas / J/mol/K"]);
+        auto dist = j.contains("radial_dist") ? get_radial_dist(j["radial_dist"]) : radial_dist::KG;
+        return CPAAssociation(std::move(cubic), classes, epsABi, betaABi, j["R_gas / J/mol/K"], dist);
     };
 	return CPAEOS(build_cubic(j), build_assoc(build_cubic(j), j));
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <string>
 #include <Eigen/Dense>
 #include "teqp/models/multifluid.hpp"
@@ -20,11 +21,31 @@ namespace teqp{
         const Eigen::ArrayXd e = (Eigen::ArrayXd(15) << 0,0,1,1,1,1,2,1,1,1,1,2,2,2,2).finished();
 
         const std::vector<teqp::EOSTerms> pures;
+        /// The terms of the departure function multiplied by xNH3^0, xNH3^1 and xNH3^2 inside the sum, see alphar_departure
+        const std::array<PowerEOSTerm, 3> departure_terms;
 
         const double TcNH3 = 405.40, TcH2O = 647.096, k_T = 0.9648407, alpha = 1.125455;
         const double vcNH3 = 0.01703026/225, vcH2O = 0.018015268/322, k_V = 1.2395117, beta = 0.8978069;
+        const double gamma = 0.5248379;
 
-        AmmoniaWaterTillnerRoth() : pures(get_EOSs({ ammonia_TillnerRoth, water_Wagner })) {};
+        AmmoniaWaterTillnerRoth() : pures(get_EOSs({ ammonia_TillnerRoth, water_Wagner })), departure_terms(build_departure_terms()) {};
+
+        /// The coefficients of the departure function as power terms, grouped by the power of xNH3 that multiplies them
+        std::array<PowerEOSTerm, 3> build_departure_terms() const {
+            std::array<PowerEOSTerm, 3> o;
+            auto build = [&](int ifirst, int ilast) {
+                PowerEOSTerm term;
+                auto N = ilast - ifirst + 1;
+                term.n = a.segment(ifirst, N); term.t = t.segment(ifirst, N); term.d = d.segment(ifirst, N); term.l = e.segment(ifirst, N);
+                term.c = (term.l > 0).cast<double>(); // The first term has no exponential
+                term.l_i = term.l.cast<int>();
+                return term;
+            };
+            o[0] = build(1, 6);
+            o[1] = build(7, 13);
+            o[2] = build(14, 14);
+            return o;
+        }
 
         template<typename MoleFracType>
         auto R(const MoleFracType&) const { return 8.314471; }
@@ -32,18 +53,22 @@ namespace teqp{
         template<typename TType, typename RhoType, typename MoleFracType>
         auto alphar_departure(const TType& tau, const RhoType& delta, const MoleFracType& xNH3) const
         {
-            std::common_type_t<TType, RhoType, MoleFracType> summer = a[1]*pow(tau, t[1])*pow(delta, d[1]);
-            for (auto i=2; i <= 6; ++i){ summer = summer + a[i]*pow(tau, t[i])*pow(delta, d[i])*exp(-pow(delta,e[i]));}
-            for (auto i=7; i <= 13; ++i){ summer = summer + xNH3*a[i]*pow(tau, t[i])*pow(delta, d[i])*exp(-pow(delta,e[i]));}
-            for (auto i=14; i <= 14; ++i) { summer = summer + xNH3*xNH3 * a[i] * pow(tau, t[i]) * pow(delta, d[i]) * exp(-pow(delta, e[i])); }
-            double gamma = 0.5248379;
+            return alphar_departure(ReducedStateContext<TType, RhoType>(tau, delta), xNH3);
+        }
+
+        /// The departure function, with the logarithms and powers of tau and delta taken from the shared context
+        template<typename TType, typename RhoType, typename MoleFracType>
+        auto alphar_departure(const ReducedStateContext<TType, RhoType>& ctx, const MoleFracType& xNH3) const
+        {
+            using result = std::common_type_t<TType, RhoType, MoleFracType>;
             // xNH3^gamma is not differentiable at xNH3=0, but limit when multiplied by zero is still zero
             if (getbaseval(xNH3) == 0) {
-                return static_cast<decltype(summer)>(0.0);
+                return static_cast<result>(0.0);
             }
-            return forceeval(xNH3 * (1 - pow(xNH3, gamma)) * summer);
+            result summer = departure_terms[0].alphar(ctx) + xNH3*(departure_terms[1].alphar(ctx) + xNH3*departure_terms[2].alphar(ctx));
+            return static_cast<result>(forceeval(xNH3 * (1 - pow(xNH3, gamma)) * summer));
         }
-        
+
         template<typename MoleFracType>
         auto get_Treducing(const MoleFracType& molefrac) const {
             if (molefrac.size() != 2) {
@@ -85,10 +110,47 @@ namespace teqp{
             auto rhored = get_rhoreducing(molefrac);
             auto delta = forceeval(rho / rhored);
             auto tau = forceeval(Tred / T);
-            auto val_CS = pures[0].alphar(tau, delta)*xNH3 + pures[1].alphar(tau, delta)*(1-xNH3);
-            auto val_dep = alphar_departure(tau, delta, xNH3);
+            // Shared by the two pure fluids and the departure function
+            const ReducedStateContext<decltype(tau), decltype(delta)> ctx(tau, delta);
+            auto val_CS = pures[0].alphar(ctx)*xNH3 + pures[1].alphar(ctx)*(1-xNH3);
+            auto val_dep = alphar_departure(ctx, xNH3);
             return forceeval(val_CS + val_dep);
         }
+
+        /**
+         The derivative \f$\Lambda^{\rm r}_{iT,iD}\f$ from the closed-form derivatives of the terms of the pure fluids and of the
+         departure function; used by ADBackends::analytic. As for MultiFluid::get_Arxy_analytic, the reducing functions only
+         depend on composition, so \f$\Lambda^{\rm r}_{ij} = \tau^i\delta^j\partial^{i+j}\alpha^r/\partial\tau^i\partial\delta^j\f$.
+         The non-analytic terms of water are available up to second order.
+         */
+        template<int iT, int iD, typename MoleFracType>
+        double get_Arxy_analytic(const double T, const double rho, const MoleFracType& molefrac) const {
+            const double tau = get_Treducing(molefrac) / T, delta = rho / get_rhoreducing(molefrac);
+            const double xNH3 = molefrac[0];
+            double val = pures[0].template alphar_taudeltaderiv<iT, iD>(tau, delta)*xNH3 + pures[1].template alphar_taudeltaderiv<iT, iD>(tau, delta)*(1-xNH3);
+            if (xNH3 != 0) {
+                double summer = 0.0, xpow = 1.0;
+                for (const auto& term : departure_terms) {
+                    summer += xpow*term.template alphar_taudeltaderiv<iT, iD>(tau, delta);
+                    xpow *= xNH3;
+                }
+                val += xNH3 * (1 - pow(xNH3, gamma)) * summer;
+            }
+            return val;
+        }
+
+        /// The matrix of derivatives \f$\Lambda^{\rm r}_{ij}\f$ with \f$i+j \leq 2\f$ in closed form, in the layout of DerivativeHolderSquare<2>
+        template<typename MoleFracType>
+        auto get_deriv_mat2(const double T, const double rho, const MoleFracType& molefrac) const {
+            Eigen::Array<double, 3, 3> o = Eigen::Array<double, 3, 3>::Zero();
+            o(0, 0) = get_Arxy_analytic<0, 0>(T, rho, molefrac);
+            o(0, 1) = get_Arxy_analytic<0, 1>(T, rho, molefrac);
+            o(0, 2) = get_Arxy_analytic<0, 2>(T, rho, molefrac);
+            o(1, 0) = get_Arxy_analytic<1, 0>(T, rho, molefrac);
+            o(1, 1) = get_Arxy_analytic<1, 1>(T, rho, molefrac);
+            o(2, 0) = get_Arxy_analytic<2, 0>(T, rho, molefrac);
+            return o;
+        }
     };
 
 } /* */
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "teqp/types.hpp"
+
+namespace teqp {
+namespace composite {
+
+/// Detect whether a contribution has an alphar overload that takes the shared intermediates ahead of T, rho and the mole fractions
+template<typename T, typename Shared, typename TType, typename RhoType, typename VecType, typename = void>
+struct has_shared_alphar : std::false_type {};
+template<typename T, typename Shared, typename TType, typename RhoType, typename VecType>
+struct has_shared_alphar<T, Shared, TType, RhoType, VecType, std::void_t<decltype(std::declval<const T&>().alphar(std::declval<const Shared&>(), std::declval<const TType&>(), std::declval<const RhoType&>(), std::declval<const VecType&>()))>> : std::true_type {};
+
+/// Evaluate alphar of a contribution with the shared intermediates if it supports them, or from T, rho and the mole fractions otherwise
+template<typename Contribution, typename Shared, typename TType, typename RhoType, typename VecType>
+auto alphar_with_shared(const Contribution& contrib, const Shared& shared, const TType& T, const RhoType& rho, const VecType& molefrac) {
+    if constexpr (has_shared_alphar<Contribution, Shared, TType, RhoType, VecType>::value) {
+        return contrib.alphar(shared, T, rho, molefrac);
+    }
+    else {
+        return contrib.alphar(T, rho, molefrac);
+    }
+}
+
+/**
+ \brief A model whose residual Helmholtz energy is the sum of contributions that share intermediate quantities
+
+ In each evaluation of alphar, the core computes the intermediates once, with get_intermediates(T, rho, molefrac), as a struct
+ whose type may depend on the types of the arguments (packing fractions, diameters, mixture parameters of a cubic, ...). Each
+ contribution that has an overload alphar(shared, T, rho, molefrac) takes them from there; the others are called with
+ alphar(T, rho, molefrac), so any model can be a contribution. The core is not itself a contribution, but it can be listed
+ among them. The gas constant is that of the core.
+ */
+template<typename Core, typename... Contributions>
+class CompositeModel {
+public:
+    const Core core;
+    const std::tuple<Contributions...> contributions;
+
+    CompositeModel(Core core, Contributions... contributions) : core(std::move(core)), contributions(std::move(contributions)...) {}
+
+    template<class VecType>
+    auto R(const VecType& molefrac) const {
+        return core.R(molefrac);
+    }
+
+    /// The I-th contribution
+    template<std::size_t I>
+    const auto& get_contribution() const { return std::get<I>(contributions); }
+
+    template<typename TType, typename RhoType, typename VecType>
+    auto alphar(const TType& T, const RhoType& rho, const VecType& molefrac) const {
+        const auto shared = core.get_intermediates(T, rho, molefrac);
+        return std::apply([&](const auto&... contrib) { return forceeval((alphar_with_shared(contrib, shared, T, rho, molefrac) + ...)); }, contributions);
+    }
+};
+
+template<typename Core, typename... Contributions>
+auto make_composite(Core&& core, Contributions&&... contributions) {
+    return CompositeModel<std::decay_t<Core>, std::decay_t<Contributions>...>(std::forward<Core>(core), std::forward<Contributions>(contributions)...);
+}
+
+}
+}
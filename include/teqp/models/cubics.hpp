@@ -13,6 +13,7 @@ Implementations of the canonical cubic equations of state
 #include "teqp/constants.hpp"
 #include "teqp/exceptions.hpp"
 #include "cubicsuperancillary.hpp"
+#include "teqp/math/cubic_roots.hpp"
 #include "teqp/json_tools.hpp"
 
 #include "nlohmann/json.hpp"
@@ -32,10 +33,19 @@ private:
 public:
     BasicAlphaFunction(NumType Tci, NumType mi) : Tci(Tci), mi(mi) {};
     
+    auto get_Tci() const { return Tci; }
+    auto get_mi() const { return mi; }
+    
     template<typename TType>
     auto operator () (const TType& T) const {
         return forceeval(pow2(forceeval(1.0 + mi * (1.0 - sqrt(T / Tci)))));
     }
+    
+    /// The alpha function and its first and second derivatives with respect to T, in closed form
+    Eigen::Array3d derivs2(const double T) const {
+        const double s = sqrt(T / Tci), u = 1.0 + mi * (1.0 - s);
+        return (Eigen::Array3d() << u * u, -mi * u * s / T, mi * (1.0 + mi) * s / (2.0 * T * T)).finished();
+    }
 };
 
 /**
@@ -55,16 +65,30 @@ public:
             throw teqp::InvalidArgument("coefficients c for Twu alpha function must have length 3");
         }
     };
+    auto get_Tci() const { return Tci; }
+    const auto& get_c() const { return c; }
     template<typename TType>
     auto operator () (const TType& T) const {
         return forceeval(pow(T/Tci,c[2]*(c[1]-1))*exp(c[0]*(1.0-pow(T/Tci, c[1]*c[2]))));
     }
+    
+    /// The alpha function and its first and second derivatives with respect to T, in closed form
+    Eigen::Array3d derivs2(const double T) const {
+        const double p = c[2]*(c[1]-1), q = c[1]*c[2], Trq = pow(T/Tci, q);
+        const double alpha = pow(T/Tci, p)*exp(c[0]*(1.0-Trq));
+        // Derivatives of ln(alpha)
+        const double dlnalpha = (p - c[0]*q*Trq)/T, d2lnalpha = (-p - c[0]*q*(q-1)*Trq)/(T*T);
+        return (Eigen::Array3d() << alpha, alpha*dlnalpha, alpha*(d2lnalpha + dlnalpha*dlnalpha)).finished();
+    }
 };
 
 using AlphaFunctionOptions = std::variant<BasicAlphaFunction<double>, TwuAlphaFunction<double>>;
 
+template<typename Cubic> class PreparedGenericCubic;
+
 template <typename NumType, typename AlphaFunctions>
 class GenericCubic {
+    template<typename Cubic> friend class PreparedGenericCubic;
 protected:
     std::valarray<NumType> ai, bi;
     const NumType Delta1, Delta2, OmegaA, OmegaB;
@@ -109,6 +133,20 @@ public:
     void set_meta(const nlohmann::json& j) { meta = j; }
     auto get_meta() const { return meta; }
     auto get_kmat() const { return kmat; }
+    /// The attractive parameters of the pure fluids at their critical points, without the alpha functions
+    const auto& get_ai() const { return ai; }
+    const auto& get_bi() const { return bi; }
+    auto get_Delta1() const { return Delta1; }
+    auto get_Delta2() const { return Delta2; }
+    const auto& get_alphas() const { return alphas; }
+    /// Overwrite the matrix of the binary interaction parameters in place, for instance in each step of a fit; no evaluation of the model may be in progress on another thread meanwhile.
+    /// The views from prepare_composition keep the kmat they were prepared with, so they are stale afterwards and must be prepared again
+    void set_kmat(const Eigen::ArrayXXd& kmat_) {
+        if (kmat_.rows() != kmat.rows() || kmat_.cols() != kmat.cols()) {
+            throw teqp::InvalidArgument("kmat needs to be a square matrix the same size as the number of components [" + std::to_string(kmat.cols()) + "]");
+        }
+        kmat = kmat_;
+    }
     
     /// Return a tuple of saturated liquid and vapor densities for the EOS given the temperature
     /// Uses the superancillary equations from Bell and Deiters:
@@ -135,15 +173,15 @@ public:
     template<typename TType, typename CompType>
     auto get_a(TType T, const CompType& molefracs) const {
         std::common_type_t<TType, decltype(molefracs[0])> a_ = 0.0;
-        auto ai = this->ai;
+        // Each alpha function is evaluated once; sqrt(a_i*a_j) = sqrt(a_i)*sqrt(a_j)
+        std::vector<std::common_type_t<TType, double>> sqrtai(molefracs.size());
         for (auto i = 0; i < molefracs.size(); ++i) {
             auto alphai = forceeval(std::visit([&](auto& t) { return t(T); }, alphas[i]));
-            auto ai_ = forceeval(ai[i] * alphai);
+            sqrtai[i] = forceeval(sqrt(ai[i] * alphai));
+        }
+        for (auto i = 0; i < molefracs.size(); ++i) {
             for (auto j = 0; j < molefracs.size(); ++j) {
-                auto alphaj = forceeval(std::visit([&](auto& t) { return t(T); }, alphas[j]));
-                auto aj_ = ai[j] * alphaj;
-                auto aij = forceeval((1 - kmat(i,j)) * sqrt(ai_ * aj_));
-                a_ = a_ + molefracs[i] * molefracs[j] * aij;
+                a_ = a_ + molefracs[i] * molefracs[j] * (1 - kmat(i,j)) * sqrtai[i] * sqrtai[j];
             }
         }
         return forceeval(a_);
@@ -172,6 +210,277 @@ public:
         auto val = Psiminus - get_a(T, molefrac) / (Ru * T) * Psiplus;
         return forceeval(val);
     }
+    
+    /// The real roots in density of the cubic equation at T, p and the mole fractions, in increasing order and with 0 < b*rho < 1; density::solve_rho_Tp picks among them
+    template<typename CompType>
+    std::vector<double> get_rho_Tp_roots(const double T, const double p, const CompType& molefracs) const {
+        return get_cubic_EOS_rho_roots(get_a(T, molefracs), get_b(T, molefracs), Delta1, Delta2, Ru*T, p);
+    }
+    
+    /// Return a view of the model bound to the composition z, see PreparedGenericCubic; the view does not follow later calls to set_kmat
+    auto prepare_composition(const Eigen::ArrayXd& z) const {
+        return PreparedGenericCubic<GenericCubic>(*this, z);
+    }
+    
+    /*
+     Closed-form derivatives, which bypass the automatic differentiation of alphar for double arguments.  With b independent
+     of temperature, \f$\alpha^{\rm r} = \Psi^-(\rho) - \frac{a(T)}{RT}\Psi^+(\rho)\f$, so the derivatives separate
+     into derivatives of \f$a(T)/T\f$ in \f$1/T\f$ and of \f$\Psi^\pm\f$ in \f$\rho\f$
+     */
+    
+    /// The attractive parameter of the mixture and its first and second derivatives with respect to T
+    template<typename CompType>
+    Eigen::Array3d get_a_derivs2(const double T, const CompType& molefracs) const {
+        const auto N = molefracs.size();
+        // sqrt(a_i*alpha_i) and its derivatives
+        Eigen::ArrayXd q(N), dq(N), d2q(N);
+        for (auto i = 0; i < N; ++i) {
+            Eigen::Array3d alpha = std::visit([&](auto& t) { return t.derivs2(T); }, alphas[i]);
+            q[i] = sqrt(ai[i] * alpha[0]);
+            dq[i] = ai[i] * alpha[1] / (2 * q[i]);
+            d2q[i] = ai[i] * alpha[2] / (2 * q[i]) - dq[i] * dq[i] / q[i];
+        }
+        Eigen::Array3d a = Eigen::Array3d::Zero();
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = 0; j < N; ++j) {
+                const double w = molefracs[i] * molefracs[j] * (1 - kmat(i, j));
+                a[0] += w * q[i] * q[j];
+                a[1] += w * (dq[i] * q[j] + q[i] * dq[j]);
+                a[2] += w * (d2q[i] * q[j] + 2 * dq[i] * dq[j] + q[i] * d2q[j]);
+            }
+        }
+        return a;
+    }
+    
+    /// \f$\rho^j\partial^j\Psi^-/\partial\rho^j\f$ and \f$\rho^j\partial^j\Psi^+/\partial\rho^j\f$
+    std::tuple<double, double> get_Psi_derivs(const double b, const double rho, const int j) const {
+        const double x = b * rho;
+        if (j == 0) {
+            return { -log1p(-x), (log1p(Delta1 * x) - log1p(Delta2 * x)) / (b * (Delta1 - Delta2)) };
+        }
+        const double factorial = tgamma(j), sign = (j % 2 == 1) ? 1.0 : -1.0;
+        const double Psiminus = factorial * pow(x / (1 - x), j);
+        const double Psiplus = sign * factorial * (pow(Delta1 * x / (1 + Delta1 * x), j) - pow(Delta2 * x / (1 + Delta2 * x), j)) / (b * (Delta1 - Delta2));
+        return { Psiminus, Psiplus };
+    }
+    
+    /// The derivative \f$\Lambda^{\rm r}_{iT,iD}\f$ in closed form, for iT up to 2 and any iD; used by ADBackends::analytic
+    template<int iT, int iD, typename MoleFracType>
+    double get_Arxy_analytic(const double T, const double rho, const MoleFracType& molefrac) const {
+        if constexpr (iT > 2) {
+            throw teqp::NotImplementedError("Only up to second derivatives in temperature are available in closed form for cubics");
+        }
+        else {
+            if (molefrac.size() != static_cast<Eigen::Index>(alphas.size())) {
+                throw std::invalid_argument("Sizes do not match");
+            }
+            const double b = get_b(T, molefrac);
+            auto a = get_a_derivs2(T, molefrac);
+            // (1/T)^i d^i(a/(RT))/d(1/T)^i
+            const Eigen::Array3d A = (Eigen::Array3d() << a[0] / (Ru * T), (a[0] - T * a[1]) / (Ru * T), T * a[2] / Ru).finished();
+            auto [Psiminus, Psiplus] = get_Psi_derivs(b, rho, iD);
+            return ((iT == 0) ? Psiminus : 0.0) - A[iT] * Psiplus;
+        }
+    }
+    
+    /// The matrix of derivatives \f$\Lambda^{\rm r}_{ij}\f$ with \f$i+j \leq 2\f$ in closed form, in the layout of DerivativeHolderSquare<2>
+    template<typename MoleFracType>
+    auto get_deriv_mat2(const double T, const double rho, const MoleFracType& molefrac) const {
+        if (molefrac.size() != static_cast<Eigen::Index>(alphas.size())) {
+            throw std::invalid_argument("Sizes do not match");
+        }
+        const double b = get_b(T, molefrac);
+        auto a = get_a_derivs2(T, molefrac);
+        const Eigen::Array3d A = (Eigen::Array3d() << a[0] / (Ru * T), (a[0] - T * a[1]) / (Ru * T), T * a[2] / Ru).finished();
+        Eigen::Array<double, 3, 3> o = Eigen::Array<double, 3, 3>::Zero();
+        for (auto j = 0; j <= 2; ++j) {
+            auto [Psiminus, Psiplus] = get_Psi_derivs(b, rho, j);
+            for (auto i = 0; i + j <= 2; ++i) {
+                o(i, j) = ((i == 0) ? Psiminus : 0.0) - A[i] * Psiplus;
+            }
+        }
+        return o;
+    }
+    
+    /**
+     \brief The value, gradient, and Hessian of \f$\Psi^{\rm r} = \rho RT\alpha^{\rm r}\f$ with respect to the molar concentrations, in closed form
+     
+     With \f$B = \sum_i b_i\rho_i\f$ and \f$D = \sum_i\sum_j \rho_i\rho_j a_{ij}\f$, \f$\Psi^{\rm r} = -RT\rho\ln(1-B) - DF(B)\f$, where
+     \f$F(B) = \ln[(1+\Delta_1B)/(1+\Delta_2B)]/[(\Delta_1-\Delta_2)B]\f$ is evaluated from its Taylor series at small B
+     */
+    template<typename RhoVecType>
+    auto get_Psir_fgradHessian_analytic(const double T, const RhoVecType& rhovec) const {
+        const auto N = rhovec.size();
+        if (N != static_cast<Eigen::Index>(alphas.size())) {
+            throw std::invalid_argument("Sizes do not match");
+        }
+        Eigen::ArrayXd q(N), bvec(N);
+        double rho = 0, B = 0;
+        for (auto i = 0; i < N; ++i) {
+            q[i] = sqrt(ai[i] * std::visit([&](auto& t) { return t(T); }, alphas[i]));
+            bvec[i] = bi[i];
+            rho += rhovec[i];
+            B += bi[i] * rhovec[i];
+        }
+        // The symmetric part of the attractive matrix, which gives the same D, so that the derivatives below also hold for an asymmetric kmat
+        Eigen::MatrixXd aij(N, N);
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = 0; j < N; ++j) {
+                aij(i, j) = (1 - (kmat(i, j) + kmat(j, i)) / 2) * q[i] * q[j];
+            }
+        }
+        Eigen::ArrayXd Dk(N); // dD/drho_k
+        for (auto k = 0; k < N; ++k) {
+            Dk[k] = 0;
+            for (auto j = 0; j < N; ++j) { Dk[k] += 2 * aij(k, j) * rhovec[j]; }
+        }
+        double D = 0;
+        for (auto k = 0; k < N; ++k) { D += Dk[k] * rhovec[k] / 2; }
+        
+        // F and its first two derivatives with respect to B
+        double F, dF, d2F;
+        const double c = Delta1 - Delta2;
+        if (std::abs(B) < 1e-2) {
+            // F = sum_n (-1)^n h_n B^n/(n+1), where h_n = (Delta1^(n+1)-Delta2^(n+1))/(Delta1-Delta2)
+            F = 0; dF = 0; d2F = 0;
+            double h = 1, Delta2n = 1, sign = 1;
+            double Bn = 1, Bnm1 = 0, Bnm2 = 0; // B^n, B^(n-1) and B^(n-2), the latter two only multiplied by zero while n is too small
+            for (auto n = 0; n < 16; ++n) {
+                if (n > 0) { Delta2n *= Delta2; h = Delta1 * h + Delta2n; }
+                const double e = sign * h / (n + 1);
+                F += e * Bn;
+                dF += n * e * Bnm1;
+                d2F += n * (n - 1) * e * Bnm2;
+                Bnm2 = Bnm1; Bnm1 = Bn; Bn *= B; sign = -sign;
+            }
+        }
+        else {
+            const double L = log1p(Delta1 * B) - log1p(Delta2 * B);
+            const double dL = Delta1 / (1 + Delta1 * B) - Delta2 / (1 + Delta2 * B);
+            const double d2L = -pow2(Delta1 / (1 + Delta1 * B)) + pow2(Delta2 / (1 + Delta2 * B));
+            F = L / (c * B);
+            dF = dL / (c * B) - L / (c * B * B);
+            d2F = d2L / (c * B) - 2 * dL / (c * B * B) + 2 * L / (c * B * B * B);
+        }
+        
+        const double RT = Ru * T;
+        const double Psir = -RT * rho * log1p(-B) - D * F;
+        Eigen::ArrayXd gradient = RT * (-log1p(-B) + rho * bvec / (1 - B)) - Dk * F - D * dF * bvec;
+        Eigen::MatrixXd Hessian(N, N);
+        for (auto k = 0; k < N; ++k) {
+            for (auto l = 0; l < N; ++l) {
+                Hessian(k, l) = RT * ((bvec[k] + bvec[l]) / (1 - B) + rho * bvec[k] * bvec[l] / pow2(1 - B))
+                    - 2 * aij(k, l) * F - dF * (Dk[k] * bvec[l] + Dk[l] * bvec[k]) - D * d2F * bvec[k] * bvec[l];
+            }
+        }
+        return std::make_tuple(Psir, gradient, Hessian);
+    }
+};
+
+/**
+ \brief A view of a GenericCubic model bound to one composition
+ 
+ The covolume b and the composition- and kij-dependent prefactors of the attractive parameter are evaluated once at
+ construction, so only the alpha functions (one evaluation per component rather than two per pair) remain to be
+ evaluated per call. Calls at any other composition, or with mole fractions that are not of double type, are forwarded
+ to the underlying model. The model must outlive this object, and its kmat must be symmetric.
+
+ The prefactors are a snapshot of kmat: after GenericCubic::set_kmat, the view silently keeps the old interaction
+ parameters at its composition, so it must be prepared again.
+ */
+template<typename Cubic>
+class PreparedGenericCubic {
+private:
+    const Cubic& model;
+    const Eigen::ArrayXd z;
+    const double b;
+    Eigen::ArrayXXd Aij; ///< z_i*z_j*(1-k_ij)*sqrt(a_i*a_j), with the off-diagonal terms doubled in the upper triangle
+    Eigen::ArrayXd w; ///< z_i*sqrt(a_i); without interaction parameters, a = (sum_i w_i*sqrt(alpha_i))^2
+    bool no_kij = true;
+public:
+    PreparedGenericCubic(const Cubic& model, const Eigen::ArrayXd& z) : model(model), z(z), b(model.get_b(0.0, z)) {
+        if (z.size() != static_cast<Eigen::Index>(model.alphas.size())) {
+            throw teqp::InvalidArgument("Sizes do not match");
+        }
+        if ((model.kmat != model.kmat.transpose()).any()) {
+            throw teqp::InvalidArgument("kmat must be symmetric to prepare a composition");
+        }
+        const auto N = z.size();
+        Aij.resize(N, N); Aij.setZero();
+        w.resize(N);
+        for (auto i = 0; i < N; ++i) {
+            w[i] = z[i]*sqrt(model.ai[i]);
+            for (auto j = i; j < N; ++j) {
+                no_kij = no_kij && model.kmat(i, j) == 0 && model.kmat(j, i) == 0;
+                Aij(i, j) = ((i == j) ? 1.0 : 2.0)*z[i]*z[j]*(1.0 - model.kmat(i, j))*sqrt(model.ai[i]*model.ai[j]);
+            }
+        }
+    };
+    
+    template<class VecType>
+    auto R(const VecType& molefrac) const {
+        return model.R(molefrac);
+    }
+    
+    template<typename TType>
+    auto get_a(const TType& T) const {
+        using resulttype = std::common_type_t<TType, double>;
+        const auto N = z.size();
+        std::vector<resulttype> sqrtalpha(N);
+        for (auto i = 0; i < N; ++i) {
+            sqrtalpha[i] = forceeval(sqrt(std::visit([&](auto& t) { return t(T); }, model.alphas[i])));
+        }
+        resulttype a_ = 0.0;
+        if (no_kij) {
+            for (auto i = 0; i < N; ++i) {
+                a_ = a_ + w[i]*sqrtalpha[i];
+            }
+            return forceeval(a_*a_);
+        }
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = i; j < N; ++j) {
+                a_ = a_ + Aij(i, j)*sqrtalpha[i]*sqrtalpha[j];
+            }
+        }
+        return forceeval(a_);
+    }
+    
+    template<typename TType, typename RhoType, typename MoleFracType>
+    auto alphar(const TType& T, const RhoType& rho, const MoleFracType& molefrac) const -> decltype(model.alphar(T, rho, molefrac))
+    {
+        if constexpr (std::is_same_v<std::decay_t<decltype(molefrac[0])>, double>) {
+            if (all_same_values(z, molefrac)) {
+                auto Psiminus = -log(1.0 - b * rho);
+                auto Psiplus = log((model.Delta1 * b * rho + 1.0) / (model.Delta2 * b * rho + 1.0)) / (b * (model.Delta1 - model.Delta2));
+                return forceeval(Psiminus - get_a(T) / (model.Ru * T) * Psiplus);
+            }
+        }
+        return model.alphar(T, rho, molefrac);
+    }
+    
+    /// See GenericCubic::get_Arxy_analytic
+    template<int iT, int iD, typename MoleFracType>
+    double get_Arxy_analytic(const double T, const double rho, const MoleFracType& molefrac) const {
+        return model.template get_Arxy_analytic<iT, iD>(T, rho, molefrac);
+    }
+    
+    /// See GenericCubic::get_deriv_mat2
+    template<typename MoleFracType>
+    auto get_deriv_mat2(const double T, const double rho, const MoleFracType& molefrac) const {
+        return model.get_deriv_mat2(T, rho, molefrac);
+    }
+    
+    /// See GenericCubic::get_rho_Tp_roots
+    template<typename MoleFracType>
+    std::vector<double> get_rho_Tp_roots(const double T, const double p, const MoleFracType& molefrac) const {
+        return model.get_rho_Tp_roots(T, p, molefrac);
+    }
+    
+    /// See GenericCubic::get_Psir_fgradHessian_analytic
+    template<typename RhoVecType>
+    auto get_Psir_fgradHessian_analytic(const double T, const RhoVecType& rhovec) const {
+        return model.get_Psir_fgradHessian_analytic(T, rhovec);
+    }
 };
 
 template <typename TCType, typename PCType, typename AcentricType>
@@ -0,0 +1,208 @@
+#pragma once
+
+/*
+Cubic equations of state (van der Waals, SRK, Peng-Robinson) whose fluid parameters are fixed at compile time
+*/
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "teqp/types.hpp"
+#include "teqp/exceptions.hpp"
+
+namespace teqp {
+namespace fixedcubic {
+
+enum class Family { vdW, SRK, PR };
+
+/// The constants of the family of cubic EOS; for van der Waals, Delta1 = Delta2 = 0 and the attractive term is linear in density
+template<Family F> struct FamilyConstants;
+template<> struct FamilyConstants<Family::vdW> {
+    static constexpr double Delta1 = 0, Delta2 = 0, OmegaA = 27.0 / 64.0, OmegaB = 1.0 / 8.0;
+};
+template<> struct FamilyConstants<Family::SRK> {
+    // See https://doi.org/10.1021/acs.iecr.1c00847
+    static constexpr double cbrt2 = 1.2599210498948731648;
+    static constexpr double Delta1 = 1, Delta2 = 0, OmegaA = 1.0 / (9.0 * (cbrt2 - 1)), OmegaB = (cbrt2 - 1) / 3;
+};
+template<> struct FamilyConstants<Family::PR> {
+    // See https://doi.org/10.1021/acs.iecr.1c00847
+    static constexpr double sqrt2 = 1.4142135623730950488;
+    static constexpr double Delta1 = 1 + sqrt2, Delta2 = 1 - sqrt2, OmegaA = 0.45723552892138218938, OmegaB = 0.077796073903888455972;
+};
+
+/// The square root, for use in constant expressions (std::sqrt is not constexpr); Newton steps from a guess above the root
+constexpr double sqrt_constexpr(const double x) {
+    if (!(x > 0)) {
+        return 0.0;
+    }
+    double r = (x > 1) ? x : 1.0;
+    for (auto i = 0; i < 2000; ++i) {
+        const double rnew = 0.5 * (r + x / r);
+        if (rnew >= r) {
+            break;
+        }
+        r = rnew;
+    }
+    return r;
+}
+
+/// The m parameter of the alpha function \f$\alpha_i = [1+m_i(1-\sqrt{T/T_{ci}})]^2\f$, the same as in canonical_SRK and canonical_PR; zero for van der Waals
+template<Family F>
+constexpr double get_m(const double acentric) {
+    if constexpr (F == Family::SRK) {
+        return 0.48 + 1.574 * acentric - 0.176 * acentric * acentric;
+    }
+    else if constexpr (F == Family::PR) {
+        if (acentric < 0.491) {
+            return 0.37464 + 1.54226 * acentric - 0.26992 * acentric * acentric;
+        }
+        return 0.379642 + 1.48503 * acentric - 0.164423 * acentric * acentric + 0.016666 * acentric * acentric * acentric;
+    }
+    else {
+        return 0.0;
+    }
+}
+
+/// The parameters of the N fluids of a FixedCubic model; the acentric factors are not used by van der Waals
+template<std::size_t N_>
+struct FluidSet {
+    static constexpr std::size_t N = N_;
+    std::array<double, N_> Tc_K{}, pc_Pa{}, acentric{};
+    std::array<std::array<double, N_>, N_> kmat{};
+};
+
+/// The constant parts of FixedCubic, evaluated at compile time
+namespace internal {
+    template<Family F, std::size_t N>
+    constexpr auto get_ai(const FluidSet<N>& fluids, const double Ru) {
+        std::array<double, N> o{};
+        for (std::size_t i = 0; i < N; ++i) { o[i] = FamilyConstants<F>::OmegaA * (Ru * fluids.Tc_K[i]) * (Ru * fluids.Tc_K[i]) / fluids.pc_Pa[i]; }
+        return o;
+    }
+    template<Family F, std::size_t N>
+    constexpr auto get_bi(const FluidSet<N>& fluids, const double Ru) {
+        std::array<double, N> o{};
+        for (std::size_t i = 0; i < N; ++i) { o[i] = FamilyConstants<F>::OmegaB * Ru * fluids.Tc_K[i] / fluids.pc_Pa[i]; }
+        return o;
+    }
+    template<Family F, std::size_t N>
+    constexpr auto get_mi(const FluidSet<N>& fluids) {
+        std::array<double, N> o{};
+        for (std::size_t i = 0; i < N; ++i) { o[i] = get_m<F>(fluids.acentric[i]); }
+        return o;
+    }
+    template<std::size_t N>
+    constexpr auto get_inv_sqrt_Tci(const FluidSet<N>& fluids) {
+        std::array<double, N> o{};
+        for (std::size_t i = 0; i < N; ++i) { o[i] = 1.0 / sqrt_constexpr(fluids.Tc_K[i]); }
+        return o;
+    }
+    template<std::size_t N>
+    constexpr auto get_Aij(const FluidSet<N>& fluids, const std::array<double, N>& ai) {
+        std::array<std::array<double, N>, N> o{};
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                o[i][j] = (1 - fluids.kmat[i][j]) * sqrt_constexpr(ai[i] * ai[j]);
+            }
+        }
+        return o;
+    }
+}
+
+/**
+ \brief A cubic EOS of the family F whose parameters are given by fluids, a constexpr FluidSet with static storage duration
+
+ The pure-fluid parameters a_i and b_i, the m parameters of the alpha functions, and the products
+ \f$(1-k_{ij})\sqrt{a_ia_j}\f$ are constant expressions, so the compiler folds them into the evaluation, and the loops over
+ the components have a fixed length. No memory is allocated, and the mole fractions can be any indexable type of size N
+ (std::array, Eigen arrays, ...). The results are the same as for vdWEOS, canonical_SRK and canonical_PR (up to
+ rounding), as long as \f$1+m_i(1-\sqrt{T/T_{ci}})\f$, the square root of the alpha function, is positive.
+
+ Example:
+ \code
+ constexpr teqp::fixedcubic::FluidSet<2> propane_butane{ {369.89, 425.125}, {4251200.0, 3796000.0}, {0.1521, 0.201}, {} };
+ const teqp::fixedcubic::FixedPR<propane_butane> model;
+ double ar = model.alphar(300.0, 1000.0, std::array<double, 2>{0.4, 0.6});
+ \endcode
+ */
+template<Family F, const auto& fluids>
+class FixedCubic {
+public:
+    using Constants = FamilyConstants<F>;
+    static constexpr std::size_t N = std::decay_t<decltype(fluids)>::N;
+    static constexpr double Ru = 1.380649e-23 * 6.02214076e23; ///< Exact value, given by k_B*N_A, as in get_R_gas
+
+    static constexpr std::array<double, N> ai = internal::get_ai<F>(fluids, Ru);
+    static constexpr std::array<double, N> bi = internal::get_bi<F>(fluids, Ru);
+    static constexpr std::array<double, N> mi = internal::get_mi<F>(fluids);
+    /// \f$1/\sqrt{T_{ci}}\f$, so that one square root of T serves all the alpha functions
+    static constexpr std::array<double, N> inv_sqrt_Tci = internal::get_inv_sqrt_Tci(fluids);
+    /// \f$(1-k_{ij})\sqrt{a_ia_j}\f$
+    static constexpr std::array<std::array<double, N>, N> Aij = internal::get_Aij(fluids, ai);
+
+    template<class VecType>
+    constexpr auto R(const VecType&) const { return Ru; }
+
+    template<typename TType, typename CompType>
+    auto get_a(const TType& T, const CompType& molefracs) const {
+        using result = std::common_type_t<TType, std::decay_t<decltype(molefracs[0])>>;
+        if constexpr (F == Family::vdW) {
+            result a_ = 0.0;
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    a_ = a_ + molefracs[i] * molefracs[j] * Aij[i][j];
+                }
+            }
+            return forceeval(a_);
+        }
+        else {
+            // The square roots of the alpha functions
+            const auto sqrtT = forceeval(sqrt(T));
+            std::array<std::common_type_t<TType, double>, N> u;
+            for (std::size_t i = 0; i < N; ++i) {
+                u[i] = forceeval(1.0 + mi[i] * (1.0 - sqrtT * inv_sqrt_Tci[i]));
+            }
+            result a_ = 0.0;
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    a_ = a_ + molefracs[i] * molefracs[j] * Aij[i][j] * u[i] * u[j];
+                }
+            }
+            return forceeval(a_);
+        }
+    }
+
+    template<typename CompType>
+    auto get_b(const CompType& molefracs) const {
+        std::decay_t<decltype(molefracs[0])> b_ = 0.0;
+        for (std::size_t i = 0; i < N; ++i) {
+            b_ = b_ + molefracs[i] * bi[i];
+        }
+        return forceeval(b_);
+    }
+
+    template<typename TType, typename RhoType, typename MoleFracType>
+    auto alphar(const TType& T, const RhoType& rho, const MoleFracType& molefrac) const {
+        if (static_cast<std::size_t>(molefrac.size()) != N) {
+            throw teqp::InvalidArgument("mole fractions must be of size " + std::to_string(N) + " but are of size " + std::to_string(molefrac.size()));
+        }
+        auto b = get_b(molefrac);
+        auto Psiminus = -log(1.0 - b * rho);
+        if constexpr (F == Family::vdW) {
+            return forceeval(Psiminus - get_a(T, molefrac) / (Ru * T) * rho);
+        }
+        else {
+            auto Psiplus = log((Constants::Delta1 * b * rho + 1.0) / (Constants::Delta2 * b * rho + 1.0)) / (b * (Constants::Delta1 - Constants::Delta2));
+            return forceeval(Psiminus - get_a(T, molefrac) / (Ru * T) * Psiplus);
+        }
+    }
+};
+
+template<const auto& fluids> using FixedvdW = FixedCubic<Family::vdW, fluids>;
+template<const auto& fluids> using FixedSRK = FixedCubic<Family::SRK, fluids>;
+template<const auto& fluids> using FixedPR = FixedCubic<Family::PR, fluids>;
+
+}
+}
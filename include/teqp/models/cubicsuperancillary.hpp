@@ -1,4 +1,10 @@
 #pragma once 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace teqp {
@@ -67,6 +73,130 @@ public:
     }
 };
 
+/**
+ A SuperAncillary prepared for the evaluation at many values of x at once.
+
+ The range of the expansions is divided into buckets of uniform width, each of which stores the first and the last
+ expansion it overlaps, so that the expansion containing x is found in O(1) in the buckets that fall within a single
+ expansion; elsewhere only the few expansions of the bucket are bisected. The coefficients are copied into one
+ zero-padded table so that the Clenshaw recurrences of a block of values run in lockstep and can be vectorized.
+ Values outside the range are reported in a status mask rather than with an exception.
+*/
+class SuperAncillaryTable{
+private:
+    static constexpr int W = 8; ///< The number of values whose recurrences are run together
+    std::size_t Nexp, Ncoeff;
+    std::vector<double> coeffs; ///< Nexp x Ncoeff, in row-major order, padded with zeros in the highest orders
+    std::vector<double> xsum, xwidth; ///< The sums of the limits and the widths of the expansions
+    std::vector<double> xlims; ///< The Nexp+1 limits of the expansions
+    std::vector<int> bucket_first, bucket_last;
+    double xmin, xmax, inv_dx;
+public:
+    /**
+     \param sa The SuperAncillary; its expansions must be contiguous and in increasing order of x. It is copied, so it need not outlive the table
+     \param Nbuckets The number of buckets; if not positive, the range divided by the median width of the expansions
+     */
+    explicit SuperAncillaryTable(const SuperAncillary& sa, int Nbuckets = 0) : Nexp(sa.exps.size()), Ncoeff(0) {
+        if (Nexp == 0) {
+            throw std::invalid_argument("The SuperAncillary has no expansions");
+        }
+        xmin = sa.exps.front().xmin; xmax = sa.exps.back().xmax;
+        std::vector<double> widths;
+        for (const auto& e : sa.exps) {
+            Ncoeff = std::max(Ncoeff, e.coeff.size());
+            widths.push_back(e.xmax - e.xmin);
+        }
+        coeffs.resize(Nexp*Ncoeff, 0.0);
+        for (std::size_t i = 0; i < Nexp; ++i) {
+            const auto& e = sa.exps[i];
+            std::copy(e.coeff.begin(), e.coeff.end(), coeffs.begin() + i*Ncoeff);
+            xsum.push_back(e.xmax + e.xmin);
+            xwidth.push_back(e.xmax - e.xmin);
+            xlims.push_back(e.xmin);
+        }
+        xlims.push_back(xmax);
+        if (Nbuckets <= 0) {
+            std::nth_element(widths.begin(), widths.begin() + Nexp/2, widths.end());
+            Nbuckets = static_cast<int>(std::min(std::ceil((xmax - xmin)/widths[Nexp/2]), 65536.0));
+        }
+        const double dx = (xmax - xmin)/Nbuckets;
+        inv_dx = 1/dx;
+        for (int k = 0; k < Nbuckets; ++k) {
+            bucket_first.push_back(sa.get_index(xmin + k*dx));
+            bucket_last.push_back(sa.get_index(std::min(xmin + (k + 1)*dx, xmax)));
+        }
+    }
+
+    double get_xmin() const { return xmin; }
+    double get_xmax() const { return xmax; }
+    auto get_Nbuckets() const { return bucket_first.size(); }
+
+    /// The index of the expansion containing x, which must be within [xmin, xmax]
+    int get_index(double x) const{
+        auto k = std::clamp(static_cast<int>((x - xmin)*inv_dx), 0, static_cast<int>(bucket_first.size()) - 1);
+        int iL = bucket_first[k], iR = bucket_last[k], iM;
+        while (iR - iL > 1) {
+            iM = midpoint_Knuth(iL, iR);
+            if (x >= xlims[iM]) {
+                iL = iM;
+            }
+            else {
+                iR = iM;
+            }
+        }
+        return (x < xlims[iL + 1]) ? iL : iR;
+    }
+
+    /**
+     Evaluate the SuperAncillary at N values of x
+     \param x The values of x
+     \param y The values of the SuperAncillary; NaN where x is out of range
+     \param ok The status mask; 1 where x is within [xmin, xmax], 0 otherwise (including NaN)
+     \param N The number of values
+     \returns The number of values out of range
+     */
+    std::size_t y_many(const double* x, double* y, std::uint8_t* ok, std::size_t N) const{
+        std::size_t Nbad = 0;
+        for (std::size_t i0 = 0; i0 < N; i0 += W) {
+            const std::size_t n = std::min(static_cast<std::size_t>(W), N - i0);
+            std::size_t offset[W] = {};
+            double xs[W] = {}, u1[W] = {}, u2[W] = {};
+            for (std::size_t l = 0; l < n; ++l) {
+                const double xl = x[i0 + l];
+                const bool inrange = (xl >= xmin && xl <= xmax);
+                ok[i0 + l] = inrange;
+                if (inrange) {
+                    auto i = get_index(xl);
+                    offset[l] = i*Ncoeff;
+                    xs[l] = (2*xl - xsum[i])/xwidth[i]; // As in Chebyshev::y, so that the results are the same
+                }
+                else {
+                    Nbad++;
+                }
+            }
+            // Lanes beyond n and out of range evaluate the first expansion at its center; their results are discarded
+            for (std::size_t k = Ncoeff - 1; k > 0; --k) {
+                for (int l = 0; l < W; ++l) {
+                    double u = 2.0*xs[l]*u1[l] - u2[l] + coeffs[offset[l] + k];
+                    u2[l] = u1[l]; u1[l] = u;
+                }
+            }
+            for (std::size_t l = 0; l < n; ++l) {
+                y[i0 + l] = ok[i0 + l] ? coeffs[offset[l]] + xs[l]*u1[l] - u2[l] : std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+        return Nbad;
+    }
+
+    /// Evaluate the SuperAncillary at the values of x; the status mask is resized to the size of x
+    std::vector<double> y_many(const std::vector<double>& x, std::vector<std::uint8_t>& ok) const{
+        std::vector<double> y(x.size());
+        ok.resize(x.size());
+        y_many(x.data(), y.data(), ok.data(), x.size());
+        return y;
+    }
+};
+
 const auto vdW_p = SuperAncillary{
 {
   {
@@ -3852,6 +3982,30 @@ static inline double supercubic(int EOS, int prop, double Ttilde){
 const int VDW_CODE = 0, SRK_CODE = 1, PR_CODE = 2, UNKNOWN_CODE = -1;
 const int P_CODE = 100, RHOL_CODE = 101, RHOV_CODE = 102;
 
+/// The prepared table of the superancillary of the property prop of the model EOS, built on first use; see SuperAncillaryTable
+inline const SuperAncillaryTable& get_supercubic_table(int EOS, int prop){
+    if (prop != P_CODE && prop != RHOL_CODE && prop != RHOV_CODE) {
+        throw std::invalid_argument("Unknown superancillary property code: " + std::to_string(prop));
+    }
+    const auto i = prop - P_CODE;
+    switch(EOS){
+        case VDW_CODE:{
+            static const SuperAncillaryTable tables[3] = {SuperAncillaryTable(vdW_p), SuperAncillaryTable(vdW_rhoL), SuperAncillaryTable(vdW_rhoV)};
+            return tables[i];
+        }
+        case SRK_CODE:{
+            static const SuperAncillaryTable tables[3] = {SuperAncillaryTable(SRK_p), SuperAncillaryTable(SRK_rhoL), SuperAncillaryTable(SRK_rhoV)};
+            return tables[i];
+        }
+        case PR_CODE:{
+            static const SuperAncillaryTable tables[3] = {SuperAncillaryTable(PR_p), SuperAncillaryTable(PR_rhoL), SuperAncillaryTable(PR_rhoV)};
+            return tables[i];
+        }
+        default:
+            throw std::invalid_argument("Unknown superancillary model code: " + std::to_string(EOS));
+    }
+}
+
 }; // namespace CubicSuperAncillary
 
 }; // namespace teqp
@@ -135,8 +135,9 @@ namespace teqp {
         template<typename TTYPE>
         auto get_dhBH(const TTYPE& Tstar) const {
             TTYPE summer = c_ln_dhBH*log(Tstar);
+            auto sqrtT = forceeval(sqrt(Tstar)); // All the powers of Tstar are half-integer
             for (auto [i, C_i] : c_dhBH){
-                summer += C_i*pow(Tstar, i/2.0);
+                summer += C_i*powi(sqrtT, i);
             }
             return forceeval(summer);
         }
@@ -153,9 +154,10 @@ namespace teqp {
         // Form of Eq. 29
         template<typename TTYPE>
         auto get_DeltaB2hBH(const TTYPE& Tstar) const {
-            TTYPE summer = 0.0;
+            TTYPE summer = make_constant<TTYPE>(0.0);
+            auto sqrtT = forceeval(sqrt(Tstar));
             for (auto [i, C_i] : c_Delta_B2_hBH){
-                summer += C_i*pow(Tstar, i/2.0);
+                summer += C_i*powi(sqrtT, i);
             }
             return forceeval(summer);
         }
@@ -172,7 +174,7 @@ namespace teqp {
         //  Eq. 5 from K-N
         template<typename TTYPE, typename RHOTYPE>
         auto get_ahs(const TTYPE& Tstar, const RHOTYPE& rhostar) const {
-            auto zeta = MY_PI/6.0*rhostar*pow(get_dhBH(Tstar), 3);
+            auto zeta = forceeval(MY_PI/6.0*rhostar*pow(get_dhBH(Tstar), 3));
             return forceeval(Tstar*(5.0/3.0*log(1.0-zeta) + zeta*(34.0-33.0*zeta+4.0*POW2(zeta))/(6.0*POW2(1.0-zeta))));
         }
 
@@ -186,9 +188,10 @@ namespace teqp {
         // Eq. 30 from K-N
         template<typename TTYPE, typename RHOTYPE>
         auto get_a(const TTYPE& Tstar, const RHOTYPE& rhostar) const{
-            std::common_type_t<TTYPE, RHOTYPE> summer = 0.0;
+            auto summer = make_constant<std::common_type_t<TTYPE, RHOTYPE>>(0.0);
+            auto sqrtT = forceeval(sqrt(Tstar));
             for (auto [i, j, Cij] : c_Cij){
-                summer += Cij*pow(Tstar, i/2.0)*pow(rhostar, j);
+                summer += Cij*powi(sqrtT, i)*powi(rhostar, j);
             }
             return forceeval(get_ahs(Tstar, rhostar) + exp(-gamma*POW2(rhostar))*rhostar*Tstar*get_DeltaB2hBH(Tstar)+summer);
         }
@@ -277,7 +280,7 @@ namespace teqp {
                 case 3:
                     return x[10]*Tstar + x[11] + x[12]/Tstar;
                 case 4:
-                    return x[13];
+                    return make_constant<TTYPE>(x[13]);
                 case 5:
                     return x[14]/Tstar + x[15]/POW2(Tstar);
                 case 6:
@@ -326,8 +329,8 @@ namespace teqp {
         
         template<typename TTYPE, typename RHOTYPE>
         auto get_alphar(const TTYPE& Tstar, const RHOTYPE& rhostar) const{
-            std::common_type_t<TTYPE, RHOTYPE> summer = 0.0;
-            auto F = exp(-gamma*POW2(rhostar));
+            auto summer = make_constant<std::common_type_t<TTYPE, RHOTYPE>>(0.0);
+            auto F = forceeval(exp(-gamma*POW2(rhostar)));
             for (int i = 1; i <= 8; ++i){
                 summer += get_ai(i, Tstar)*powi(rhostar, i)/static_cast<double>(i);
             }
@@ -30,7 +30,7 @@ namespace teqp {
                    {LISAL, {1.0, 0.5296092, -0.4531784, 0.4421075}}
             };
 
-            auto get_alpha_star_parameter(const std::string& model) {
+            auto get_alpha_star_parameter(const std::string& model) const {
                 return p_alpha.at(modelmap.at(model));
             };
 
@@ -39,7 +39,7 @@ namespace teqp {
                    {LISAL, {0.5256,3.2088804,-3.1499114,0.43049357}}
             };
 
-            auto get_eta_rho_parameter(const std::string& model) {
+            auto get_eta_rho_parameter(const std::string& model) const {
                 return p_eta_rho.at(modelmap.at(model));
             };
 
@@ -48,7 +48,7 @@ namespace teqp {
               {LISAL, {0.31258137,1.2240569,3.7974509,6.5490937}}
             };
 
-            auto get_rho_parameter(const std::string& model) {
+            auto get_rho_parameter(const std::string& model) const {
                 return p_rho.at(modelmap.at(model));
             };
 
@@ -58,7 +58,7 @@ namespace teqp {
               {LISAL, {34.037352,17.733741,0.53237307,12.860239}}
             };
 
-            auto get_T_parameter(const std::string& model) {
+            auto get_T_parameter(const std::string& model) const {
                 return p_t.at(modelmap.at(model));
             };
 
@@ -68,7 +68,7 @@ namespace teqp {
               {LISAL, {-0.64211055047e-1,0.17682583145e-2,-0.62963373291e0,-0.35320115512e0,0.11339264270e2,-0.33311941616e2,0.37022843830e2,-0.18683743554e2,0.34566448842e1,-0.11216048862e-5,0.69315597535e0,-0.95242644353e0,0.13303429920e-1,-0.17518819492e-4,0.30942693727e-5,0.44671277084e-1,-0.84065404026e0,0.12662354443e1,-0.43706789738e0,0.34751432401e-5,-0.52988956334e-6,0.37399304905e-1,-0.32905342462e0,0.63121341882e-1,-0.20913100716e-2,-0.26852824281e-1,0.70733527178e-1,0.58291227149e-1,-0.76337837062e-1,-0.37502524667e-1,0.19201247728e-2,-0.76922623587e-1,0.12939011597e0,-0.37539710780e-1}}
             };
 
-            auto get_c_parameter(const std::string& model) {
+            auto get_c_parameter(const std::string& model) const {
                 return c.at(modelmap.at(model));
             };
 
@@ -77,7 +77,7 @@ namespace teqp {
               {LISAL, {-1.50,-1.50,-1.00,-1.00,-1.00,-1.00,-1.00,-1.00,-1.00,-1.00,-0.50,-0.50,-0.50,-0.50,-0.50,0.00,0.00,0.00,0.00,0.00,0.00,-3.00,-2.00,-2.00,-2.00,-1.00,0.00,-4.00,-4.00,-4.00,-4.00,0.00,0.00,0.00}}
             };
 
-            auto get_m_parameter(const std::string& model) {
+            auto get_m_parameter(const std::string& model) const {
                 return m.at(modelmap.at(model));
             };
 
@@ -86,7 +86,7 @@ namespace teqp {
              {LISAL, {2.0,5.0,1.0,1.0,2.0,2.0,2.0,2.0,2.0,10.0,1.0,1.0,3.0,9.0,10.0,1.0,2.0,2.0,2.0,9.0,10.0,1.0,1.0,3.0,6.0,3.0,3.0,1.0,1.0,2.0,6.0,1.0,1.0,1.0}}
             };
 
-            auto get_n_parameter(const std::string& model) {
+            auto get_n_parameter(const std::string& model) const {
                 return n.at(modelmap.at(model));
             };
 
@@ -95,7 +95,7 @@ namespace teqp {
                    {LISAL, {-3,-2,0,1,-3,-2,-1,0,1,-3,-3,-2,-1,-3,-2,0,-3,-2,-1,0,2,-2,0,0,1,2,-1,-3,0,-3,-2,-3,1,3}}
             };
 
-            auto get_o_parameter(const std::string& model) {
+            auto get_o_parameter(const std::string& model) const {
                 return o.at(modelmap.at(model));
             };
 
@@ -104,7 +104,7 @@ namespace teqp {
                    {LISAL, {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1}}
             };
 
-            auto get_p_parameter(const std::string& model) {
+            auto get_p_parameter(const std::string& model) const {
                 return p.at(modelmap.at(model));
             };
 
@@ -113,7 +113,7 @@ namespace teqp {
                    {LISAL, {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,1.0,1.0,1.0,1.0,1.0,1.0,2.0,2.0,2.0,2.0,2.0,2.0,2}}
             };
 
-            auto get_q_parameter(const std::string& model) {
+            auto get_q_parameter(const std::string& model) const {
                 return q.at(modelmap.at(model));
             };
 
@@ -123,7 +123,7 @@ namespace teqp {
                 {LISAL, {-0.423652173318e-01,0.204459397242e-01,0.664266837321e-01,-0.324168341478e-01,-0.741263275720e-02,-0.160855507113e-01,0.435623305093e-02,-0.105933370736e-03,-0.132000046519e-05,0.838157718194e-05,0.109144074057e-01,0.257960188278e-01,-0.544140085185e-03,0.349568484468e-02,-0.421407562467e-01,-0.745992658113e-02,0.146102252152e-03,0.566611094911e-03,-0.378643890614e-02,-0.365824539450e-01,0.169287932475e-01, 0.663866480778e-02,0.294409406715e-01,-0.112110434947e-01,-0.182144939032e-05,0.758594753989e-07,-0.216942306418e-04,-0.274025042954e-05 }}
             };
 
-            auto get_dipolar_c_parameter(const std::string& model) {
+            auto get_dipolar_c_parameter(const std::string& model) const {
                 return cd.at(modelmap.at(model));
             };
 
@@ -132,7 +132,7 @@ namespace teqp {
                  {LISAL, {-5.0,-8.0,-4.0,-3.0,-10.0,-7.0,-10.0,-11.0,-15.0,-10.0,-2.0,-2.0,-1.0,-5.0,-3.0,-1.0,1.0,-9.0,-7.0,-2.0,-1.0,-5.0,-2.0,-1.0,-8.0,-5.0,1.0,-4.0}}
             };
 
-            auto get_dipolar_n_parameter(const std::string& model) {
+            auto get_dipolar_n_parameter(const std::string& model) const {
                 return nd.at(modelmap.at(model));
             };
 
@@ -141,7 +141,7 @@ namespace teqp {
                  {LISAL, {2.0,2.0,2.0,2.0,2.0,2.0,2.0,2.0,2.0,3.0,2.0,3.0,6.0,2.0,3.0,3.0,6.0,2.0,2.0,2.0,2.0,3.0,3.0,3.0,10.0,16.0,4.0,9.0 }}
             };
 
-            auto get_dipolar_m_parameter(const std::string& model) {
+            auto get_dipolar_m_parameter(const std::string& model) const {
                 return md.at(modelmap.at(model));
             };
 
@@ -150,7 +150,7 @@ namespace teqp {
                   {LISAL, {5.0,6.0,7.0,7.0,9.0,9.0,11.0,15.0,18.0,18.0,5.0,5.0,5.0,6.0,6.0,6.0,6.0,7.0,7.0,7.0,7.0,7.0,7.0,7.0,7.0,7.0,8.0,10.0}}
             };
 
-            auto get_dipolar_k_parameter(const std::string& model) {
+            auto get_dipolar_k_parameter(const std::string& model) const {
                 return kd.at(modelmap.at(model));
             };
 
@@ -159,7 +159,7 @@ namespace teqp {
                   {LISAL, {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }}
             };
 
-            auto get_dipolar_o_parameter(const std::string& model) {
+            auto get_dipolar_o_parameter(const std::string& model) const {
                 return od.at(modelmap.at(model));
             };
 
@@ -169,7 +169,7 @@ namespace teqp {
                  {LISAL, {-0.41215428089610E-2, 0.35578044173610E-2,-0.88809379838910E-3, 0.97379155960910E-4,-0.60423371932610E-7,-0.30447863314610E-4,-0.37893019633710E-3,-0.27538826735210E-1, 0.11830188842010E-1,-0.28345123056210E-2,-0.56770387482810E-4, 0.31470857321210E-2, 0.96378605256910E-3,-0.12759100242410E-2, 0.36374646323810E-3, 0.30106794309610E-4, 0.29177823112810E-6}}
             };
 
-            auto get_quadrupolar_c_parameter(const std::string& model) {
+            auto get_quadrupolar_c_parameter(const std::string& model) const {
                 return cq.at(modelmap.at(model));
             };
 
@@ -178,7 +178,7 @@ namespace teqp {
                  {LISAL, {-8.0,-6.0,-4.0,-10.0,-20.0,-8.0,-3.0,-3.0,-2.0,0.0,-5.0,-1.0,-3.0,-1.0,0.0,0.0,-10.0}}
             };
 
-            auto get_quadrupolar_n_parameter(const std::string& model) {
+            auto get_quadrupolar_n_parameter(const std::string& model) const {
                 return nq.at(modelmap.at(model));
             };
 
@@ -187,7 +187,7 @@ namespace teqp {
                  {LISAL, {2.0,2.0,2.0,2.0,2.0,2.0,8.0,2.0,2.0,2.0,8.0,2.0,5.0,5.0,5.0,8.0,7.0}}
             };
 
-            auto get_quadrupolar_m_parameter(const std::string& model) {
+            auto get_quadrupolar_m_parameter(const std::string& model) const {
                 return mq.at(modelmap.at(model));
             };
 
@@ -196,7 +196,7 @@ namespace teqp {
                   {LISAL, {11.0,12.0,13.0,16.0,19.0,20.0, 7.0, 8.0, 8.0, 8.0, 8.0, 9.0,10.0,10.0,10.0,10.0,18.0}}
             };
 
-            auto get_quadrupolar_k_parameter(const std::string& model) {
+            auto get_quadrupolar_k_parameter(const std::string& model) const {
                 return kq.at(modelmap.at(model));
             };
 
@@ -205,11 +205,17 @@ namespace teqp {
                   {LISAL, {1.0,1.0,1.0,1.0,1.0,1.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0}}
             };
 
-            auto get_quadrupolar_o_parameter(const std::string& model) {
+            auto get_quadrupolar_o_parameter(const std::string& model) const {
                 return oq.at(modelmap.at(model));
             };
         };
 
+        /// The parameters of all the model variants, built once per process and shared by all the models
+        inline const ParameterContainer& get_parameter_container() {
+            static const ParameterContainer pContainer;
+            return pContainer;
+        }
+
         // Reducing functions for density and temperature 
         class ReducingDensity {
         public:
@@ -313,26 +319,46 @@ namespace teqp {
         };
         template<typename TypePolarContribution>
         class Twocenterljf {
+        private:
+            double L;
+            double mu_sq;
+            // The reducing quantities depend only on the elongation, so they are evaluated when it is set
+            double Tred, Rred, eta_red, alpha;
+
+            void update_reducing() {
+                Tred = redT.get_T_red(L);
+                Rred = redD.get_rho_red(L);
+                eta_red = redD.get_eta_over_rho(L);
+                alpha = redD.get_alpha_star(L);
+            }
         public:
             const ReducingDensity redD;
             const ReducingTemperature redT;
             const HardSphereContribution Hard;
             const AttractiveContribution Attr;
             const TypePolarContribution Pole;
-            const double L;
-            const double mu_sq;
 
-            Twocenterljf(ReducingDensity&& redD, ReducingTemperature&& redT, HardSphereContribution&& Hard, const AttractiveContribution&& Attr, const TypePolarContribution&& Pole, const double L, const double& mu_sq) : redD(redD), redT(redT), Hard(Hard), Attr(Attr), Pole(Pole), L(L), mu_sq(mu_sq) {};
+            Twocenterljf(ReducingDensity&& redD, ReducingTemperature&& redT, HardSphereContribution&& Hard, const AttractiveContribution&& Attr, const TypePolarContribution&& Pole, const double L, const double& mu_sq) : L(L), mu_sq(mu_sq), redD(redD), redT(redT), Hard(Hard), Attr(Attr), Pole(Pole) {
+                update_reducing();
+            };
+
+            auto get_L() const { return L; }
+            auto get_mu_sq() const { return mu_sq; }
+
+            /// Change the elongation in place, which is much cheaper than building a new model in a sweep over the elongation.
+            /// No evaluation of the model may be in progress on another thread.
+            void set_L(const double L_) {
+                L = L_;
+                update_reducing();
+            }
+            /// Change the squared dipole (or quadrupole) moment in place
+            void set_mu_sq(const double mu_sq_) { mu_sq = mu_sq_; }
 
             template<typename TType, typename RhoType, typename MoleFracType>
             auto alphar(const TType& T_star,
                 const RhoType& rho_dimer_star,
                 const MoleFracType& molefrac) const
             {
-                auto Tred = forceeval(redT.get_T_red(L));
-                auto Rred = forceeval(redD.get_rho_red(L));
-                auto eta_red = forceeval(redD.get_eta_over_rho(L));
-                auto alpha = forceeval(redD.get_alpha_star(L));
                 auto delta = forceeval(rho_dimer_star / Rred);
                 auto tau = forceeval(T_star / Tred);
                 auto delta_eta = forceeval(rho_dimer_star * eta_red);
@@ -350,7 +376,7 @@ namespace teqp {
         };
 
         inline auto get_density_reducing(const std::string& name) {
-            ParameterContainer pContainer;
+            const auto& pContainer = get_parameter_container();
             ReducingDensity red_rho;
             red_rho.p_alpha = pContainer.get_alpha_star_parameter(name);
             red_rho.p_eta_rho = pContainer.get_eta_rho_parameter(name);
@@ -359,14 +385,14 @@ namespace teqp {
         };
 
         inline auto get_temperature_reducing(const std::string& name) {
-            ParameterContainer pContainer;
+            const auto& pContainer = get_parameter_container();
             ReducingTemperature red_T;
             red_T.p_t = pContainer.get_T_parameter(name);
             return red_T;
         };
 
         inline auto get_Attractive_contribution(const std::string& name) {
-            ParameterContainer pContainer;
+            const auto& pContainer = get_parameter_container();
             AttractiveContribution eos;
             eos.c = pContainer.get_c_parameter(name);
             eos.m = pContainer.get_m_parameter(name);
@@ -384,7 +410,7 @@ namespace teqp {
         }
 
         inline auto get_Dipolar_contribution(const std::string& name) {
-            ParameterContainer pContainer;
+            const auto& pContainer = get_parameter_container();
             DipolarContribution eos;
             eos.c = pContainer.get_dipolar_c_parameter(name);
             eos.n = pContainer.get_dipolar_n_parameter(name);
@@ -395,7 +421,7 @@ namespace teqp {
         }
 
         inline auto get_Quadrupolar_contribution(const std::string& name) {
-            ParameterContainer pContainer;
+            const auto& pContainer = get_parameter_container();
             DipolarContribution eos;
             eos.c = pContainer.get_quadrupolar_c_parameter(name);
             eos.n = pContainer.get_quadrupolar_n_parameter(name);
@@ -2,6 +2,8 @@
 
 #include <valarray>
 #include <map>
+#include <array>
+#include <algorithm>
 
 namespace teqp{
 namespace exp6{
@@ -97,11 +99,26 @@ private:
         {5,3.00,1.50,0.7206789},
     };
     const double alphastar;
+
+    // The powers q of 1/T^* that appear in the terms; the powers p of rho^* are 1 to 5
+    static constexpr std::array<double, 5> qvals = {0.0, 0.25, 1.0, 2.0, 3.0};
+
+    /// The coefficients of rho^p/T^q with the alpha-dependence summed out, B(p-1,k) = sum_r A_pqr*alpha^r for q = qvals[k]
+    Eigen::Array<double, 5, 5> get_B() const {
+        Eigen::Array<double, 5, 5> B = Eigen::Array<double, 5, 5>::Zero();
+        for (const auto& el : c){
+            auto p = el[0], q = el[1], r = el[2], Apqr = el[3];
+            auto k = std::distance(qvals.begin(), std::find(qvals.begin(), qvals.end(), q));
+            B(static_cast<int>(p)-1, k) += Apqr*pow(alphastar, r);
+        }
+        return B;
+    }
+    const Eigen::Array<double, 5, 5> B;
     
 public:
     /// Constructor
     /// \param alpha
-    Kataoka1992(double alpha) : alphastar((alpha-8)/10){};
+    Kataoka1992(double alpha) : alphastar((alpha-8)/10), B(get_B()){};
     
     // We are in "simulation units", so R is 1.0, and T and rho are T^* and rho^*
     template<typename MoleFracType>
@@ -122,10 +139,18 @@ public:
         const RhoType& rhostar,
         const MoleFracType& molefrac) const
     {
-        std::common_type_t<TType, RhoType> o = 0.0;
-        for (auto el : c){
-            auto p = el[0], q = el[1], r = el[2], Apqr = el[3];
-            o = o + Apqr * pow(rhostar, p) * pow(Tstar, -q) * pow(alphastar, r);
+        // The powers 1/T^q, of which only the fractional one needs a pow
+        auto invT = forceeval(1.0/Tstar);
+        auto invT2 = forceeval(invT*invT);
+        const std::array<TType, 5> invTq = {make_constant<TType>(1.0), forceeval(pow(invT, 0.25)), invT, invT2, forceeval(invT2*invT)};
+        // Horner's rule in rho^*, all the terms have at least one power of rho^*
+        auto o = make_constant<std::common_type_t<TType, RhoType>>(0.0);
+        for (auto p = 4; p >= 0; --p){
+            auto inner = make_constant<TType>(0.0);
+            for (auto k = 0; k < 5; ++k){
+                inner = inner + B(p, k)*invTq[k];
+            }
+            o = forceeval((o + inner)*rhostar);
         }
         return forceeval(o);
     }
@@ -123,12 +123,12 @@ private:
     template<typename RhoType>
     auto Ki(int i, const RhoType & rhostar, double lambda_) const{
         const auto & thetai = thetavals.at(i);
-        RhoType num = 0.0;
+        auto num = make_constant<RhoType>(0.0);
         for (auto n = 1; n < 5; ++n){
             num += thetai[n]*pow(lambda_, n);
         }
         num *= pow(rhostar, 2);
-        RhoType den = 0;
+        auto den = make_constant<RhoType>(0.0);
         for (auto n = 5; n < 8; ++n){
             den += thetai[n]*pow(lambda_, n-4);
         }
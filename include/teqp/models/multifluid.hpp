@@ -7,6 +7,17 @@
 #include <cmath>
 #include <optional>
 #include <variant>
+#include <set>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
 
 #include "teqp/types.hpp"
 #include "teqp/constants.hpp"
@@ -55,15 +66,31 @@ public:
 
     template<typename TauType, typename DeltaType, typename MoleFractions>
     auto alphar(const TauType& tau, const DeltaType& delta, const MoleFractions& molefracs) const {
-        using resulttype = std::common_type_t<decltype(tau), decltype(molefracs[0]), decltype(delta)>; // Type promotion, without the const-ness
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta), molefracs);
+    }
+
+    /// As alphar, but with the quantities of the reduced state (logarithms, powers of delta) evaluated once for all the fluids
+    template<typename TauType, typename DeltaType, typename MoleFractions>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx, const MoleFractions& molefracs) const {
+        using resulttype = std::common_type_t<TauType, decltype(molefracs[0]), DeltaType>; // Type promotion, without the const-ness
         resulttype alphar = 0.0;
         auto N = molefracs.size();
         for (auto i = 0; i < N; ++i) {
-            alphar = alphar + molefracs[i] * EOSs[i].alphar(tau, delta);
+            alphar = alphar + molefracs[i] * alphar_with_context(EOSs[i], ctx);
         }
         return forceeval(alphar);
     }
 
+    /// Closed-form \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ of the corresponding states part, see ADBackends::analytic
+    template<int iT, int iD, typename MoleFractions>
+    double alphar_taudeltaderiv(const double tau, const double delta, const MoleFractions& molefracs) const {
+        double r = 0.0;
+        for (auto i = 0; i < molefracs.size(); ++i) {
+            r += molefracs[i] * EOSs[i].template alphar_taudeltaderiv<iT, iD>(tau, delta);
+        }
+        return r;
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphari(const TauType& tau, const DeltaType& delta, std::size_t i) const {
         return EOSs[i].alphar(tau, delta);
@@ -72,30 +99,101 @@ public:
     auto get_EOS(std::size_t i) const{
         return EOSs[i];
     }
+    const auto& get_EOS_cref(std::size_t i) const{
+        return EOSs[i];
+    }
 };
 
 template<typename FCollection, typename DepartureFunctionCollection>
 class DepartureContribution {
 
 private:
-    const FCollection F;
-    const DepartureFunctionCollection funcs;
+    FCollection F;
+    DepartureFunctionCollection funcs;
+    
+    /// A binary pair i<j that has a nonzero departure contribution, with its value of F
+    struct ActivePair { int i, j; double Fij; };
+    /// The pairs with nonzero F_{ij} and a departure function that is not null; the others contribute nothing and are skipped
+    std::vector<ActivePair> active;
+    
+    /// Rebuild the list of active pairs; the capacity is reserved for all the pairs at construction so this does not allocate
+    void update_active_pairs() {
+        active.clear();
+        for (auto i = 0; i < static_cast<int>(funcs.size()); ++i) {
+            for (auto j = i+1; j < static_cast<int>(funcs.size()); ++j) {
+                if (F(i, j) != 0.0 && !funcs[i][j].is_null()) {
+                    active.push_back({i, j, F(i, j)});
+                }
+            }
+        }
+    }
+    void check_pair(const int i, const int j) const {
+        int N = static_cast<int>(funcs.size());
+        if (i < 0 || j >= N || i >= j) {
+            throw teqp::InvalidArgument("Indices must satisfy 0 <= i < j < " + std::to_string(N));
+        }
+    }
 public:
-    DepartureContribution(FCollection&& F, DepartureFunctionCollection&& funcs) : F(F), funcs(funcs) {};
+    DepartureContribution(FCollection&& F, DepartureFunctionCollection&& funcs) : F(F), funcs(funcs) {
+        active.reserve(this->funcs.size()*this->funcs.size()/2);
+        update_active_pairs();
+    };
+    
+    /// Overwrite the value of F for the pair i<j in place
+    void set_F(const int i, const int j, const double Fij) {
+        check_pair(i, j);
+        F(i, j) = Fij; F(j, i) = Fij;
+        update_active_pairs();
+    }
+    auto get_F(const int i, const int j) const { return F(i, j); }
+    
+    /**
+     Modify the departure function of the pair i<j in place; f is called with the DepartureFunctionCollection entry,
+     once for (i,j) and once for (j,i), and can overwrite the coefficients of its terms, for instance with
+     f = [](auto& terms){ terms.template get_terms<PowerEOSTerm>()[0].n[0] = 1.0; }
+     The kinds and the number of the terms must not be changed.
+     */
+    template<typename Function>
+    void modify_departure(const int i, const int j, const Function& f) {
+        check_pair(i, j);
+        f(funcs[i][j]);
+        f(funcs[j][i]);
+        update_active_pairs();
+    }
+    
+    /// The number of binary pairs for which the departure function is evaluated
+    auto get_Nactive_pairs() const { return active.size(); }
+    /// The binary pairs i<j, with their F_{ij}, for which the departure function is evaluated
+    const auto& get_active_pairs() const { return active; }
+    /// The departure function of the pair i,j
+    const auto& get_departure(const int i, const int j) const { return funcs[i][j]; }
 
     template<typename TauType, typename DeltaType, typename MoleFractions>
     auto alphar(const TauType& tau, const DeltaType& delta, const MoleFractions& molefracs) const {
-        using resulttype = std::common_type_t<decltype(tau), decltype(molefracs[0]), decltype(delta)>; // Type promotion, without the const-ness
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta), molefracs);
+    }
+
+    /// As alphar, but with the quantities of the reduced state (logarithms, powers of delta) evaluated once for all the binary pairs
+    template<typename TauType, typename DeltaType, typename MoleFractions>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx, const MoleFractions& molefracs) const {
+        using resulttype = std::common_type_t<TauType, decltype(molefracs[0]), DeltaType>; // Type promotion, without the const-ness
         resulttype alphar = 0.0;
-        auto N = molefracs.size();
-        for (auto i = 0; i < N; ++i) {
-            for (auto j = i+1; j < N; ++j) {
-                alphar = alphar + molefracs[i] * molefracs[j] * F(i, j) * funcs[i][j].alphar(tau, delta);
-            }
+        for (const auto& [i, j, Fij] : active) {
+            alphar = alphar + molefracs[i] * molefracs[j] * Fij * alphar_with_context(funcs[i][j], ctx);
         }
         return forceeval(alphar);
     }
 
+    /// Closed-form \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ of the departure part, see ADBackends::analytic
+    template<int iT, int iD, typename MoleFractions>
+    double alphar_taudeltaderiv(const double tau, const double delta, const MoleFractions& molefracs) const {
+        double r = 0.0;
+        for (const auto& [i, j, Fij] : active) {
+            r += molefracs[i] * molefracs[j] * Fij * funcs[i][j].template alphar_taudeltaderiv<iT, iD>(tau, delta);
+        }
+        return r;
+    }
+
     /// Call a single departure term at i,j 
     template<typename TauType, typename DeltaType>
     auto get_alpharij(const int i, const int j,     const TauType& tau, const DeltaType& delta) const {
@@ -110,11 +208,15 @@ public:
     }
 };
 
+template<typename Model> class PreparedMultiFluid;
+
 template<typename CorrespondingTerm, typename DepartureTerm>
 class MultiFluid {  
 
 private:
     std::string meta = ""; ///< A string that can be used to store arbitrary metadata as needed
+    bool tau_cache_enabled = false;
+    mutable TauFactorCache taucache;
 public:
     const ReducingFunctions redfunc;
     const CorrespondingTerm corr;
@@ -154,8 +256,181 @@ public:
         auto rhored = forceeval(redfunc.get_rhor(molefrac));
         auto delta = forceeval(rho / rhored);
         auto tau = forceeval(Tred / T);
-        auto val = corr.alphar(tau, delta, molefrac) + dep.alphar(tau, delta, molefrac);
-        return forceeval(val);
+        return alphar_taudelta(tau, delta, molefrac);
+    }
+    
+    /**
+     \brief Enable or disable the memo of the factors of the EOS terms that only depend on \f$\tau\f$, see TauFactorCache
+
+     Loops at fixed temperature and composition (density solves, isothermal derivatives in density) then only evaluate
+     the parts of the terms that depend on \f$\delta\f$.  The memo is only used when \f$\tau\f$ is a double; each thread
+     has its own, so concurrent evaluations neither wait for each other nor evict each other's factors.
+     Not to be called concurrently with evaluations of the model.
+     */
+    void enable_tau_cache(bool enable) {
+        tau_cache_enabled = enable;
+        taucache.clear();
+    }
+    bool is_tau_cache_enabled() const { return tau_cache_enabled; }
+    
+    /// The sum of the corresponding states and departure parts at given reduced state, with the memo of the tau factors if it is enabled
+    template<typename TauType, typename DeltaType, typename MoleFracType>
+    auto alphar_taudelta(const TauType& tau, const DeltaType& delta, const MoleFracType& molefrac) const {
+        if constexpr (std::is_same_v<TauType, double>) {
+            if (tau_cache_enabled) {
+                const ReducedStateContext<TauType, DeltaType> ctx(tau, delta, &taucache);
+                return forceeval(corr.alphar(ctx, molefrac) + dep.alphar(ctx, molefrac));
+            }
+        }
+        // Shared by the corresponding states and departure parts
+        const ReducedStateContext<TauType, DeltaType> ctx(tau, delta);
+        return forceeval(corr.alphar(ctx, molefrac) + dep.alphar(ctx, molefrac));
+    }
+    
+    /**
+     The derivative \f$\Lambda^{\rm r}_{iT,iD}\f$ evaluated from the closed-form derivatives of the EOS terms rather than
+     by automatic differentiation; used by ADBackends::analytic. As \f$\tau\f$ is proportional to \f$1/T\f$ and \f$\delta\f$
+     to \f$\rho\f$ at constant composition, \f$\Lambda^{\rm r}_{ij} = \tau^i\delta^j\partial^{i+j}\alpha^r/\partial\tau^i\partial\delta^j\f$.
+     Throws teqp::NotImplementedError if one of the terms does not implement them.
+     */
+    template<int iT, int iD, typename MoleFracType>
+    double get_Arxy_analytic(const double T, const double rho, const MoleFracType& molefrac) const {
+        if (molefrac.size() != corr.size()){
+            throw teqp::InvalidArgument("Wrong size of mole fractions; "+std::to_string(corr.size()) + " are loaded but "+std::to_string(molefrac.size()) + " were provided");
+        }
+        const double tau = redfunc.get_Tr(molefrac) / T, delta = rho / redfunc.get_rhor(molefrac);
+        return corr.template alphar_taudeltaderiv<iT, iD>(tau, delta, molefrac) + dep.template alphar_taudeltaderiv<iT, iD>(tau, delta, molefrac);
+    }
+
+    /**
+     \brief \f$\Psi^r = \alpha^r\rho RT\f$ with its gradient and Hessian w.r.t. the molar concentrations, used by the builders of IsochoricDerivatives
+
+     Rather than one dense sweep of automatic differentiation over the N concentrations, the structure of the model is used:
+     each pure fluid and each active departure pair is differentiated (with VectorDual numbers) in \f$\tau\f$ and \f$\delta\f$
+     only, the reducing functions are differentiated in closed form w.r.t. the mole fractions, and the chain rule assembles the
+     rest.  The cost is one second-order evaluation in two variables per pure fluid and per active pair, plus O(N^2) arithmetic,
+     which is what makes Hessians of mixtures of 15-21 components with mostly null departure functions affordable.
+     */
+    template<typename RhoVecType>
+    auto get_Psir_fgradHessian_analytic(const double T, const RhoVecType& rhovec) const {
+        const auto N = static_cast<Eigen::Index>(rhovec.size());
+        if (N != static_cast<Eigen::Index>(corr.size())){
+            throw teqp::InvalidArgument("Wrong size of molar concentrations; "+std::to_string(corr.size()) + " are loaded but "+std::to_string(N) + " were provided");
+        }
+        double rho = 0.0;
+        for (auto i = 0; i < N; ++i) { rho += rhovec[i]; }
+        Eigen::ArrayXd x(N);
+        for (auto i = 0; i < N; ++i) { x[i] = rhovec[i] / rho; }
+
+        // The reducing functions and their derivatives w.r.t. the mole fractions
+        double Tr = 0.0, vr = 0.0;
+        Eigen::ArrayXd Tr_x(N), vr_x(N);
+        Eigen::MatrixXd Tr_xx(N, N), vr_xx(N, N);
+        redfunc.get_Tr_gradHessian(x, Tr, Tr_x, Tr_xx);
+        redfunc.get_vr_gradHessian(x, vr, vr_x, vr_xx);
+        const double tau = Tr / T, delta = rho * vr;
+
+        // The derivatives of alphar in tau, delta and (explicitly, at constant tau and delta) in the mole fractions
+        using tddual = VectorDual<2, double, 2>;
+        const auto taud = tddual::variable(tau, 0, 2), deltad = tddual::variable(delta, 1, 2);
+        double a = 0.0, a_t = 0.0, a_d = 0.0, a_tt = 0.0, a_td = 0.0, a_dd = 0.0;
+        Eigen::ArrayXd a_x(N), a_xt(N), a_xd(N);
+        Eigen::MatrixXd a_xx = Eigen::MatrixXd::Zero(N, N);
+        auto accumulate = [&](const tddual& term, const double w) {
+            a += w * term.val; a_t += w * term.grad[0]; a_d += w * term.grad[1];
+            a_tt += w * term.hessian(0, 0); a_td += w * term.hessian(0, 1); a_dd += w * term.hessian(1, 1);
+        };
+        for (auto i = 0; i < N; ++i) {
+            const tddual ai = corr.alphari(taud, deltad, i);
+            accumulate(ai, x[i]);
+            a_x[i] = ai.val; a_xt[i] = ai.grad[0]; a_xd[i] = ai.grad[1];
+        }
+        for (const auto& [i, j, Fij] : dep.get_active_pairs()) {
+            const tddual aij = dep.get_alpharij(i, j, taud, deltad);
+            accumulate(aij, x[i] * x[j] * Fij);
+            a_x[i] += x[j] * Fij * aij.val; a_xt[i] += x[j] * Fij * aij.grad[0]; a_xd[i] += x[j] * Fij * aij.grad[1];
+            a_x[j] += x[i] * Fij * aij.val; a_xt[j] += x[i] * Fij * aij.grad[0]; a_xd[j] += x[i] * Fij * aij.grad[1];
+            a_xx(i, j) += Fij * aij.val; a_xx(j, i) += Fij * aij.val;
+        }
+
+        // Derivatives of A(rho, x) = alphar(tau(x), delta(rho, x), x)
+        const Eigen::VectorXd tau_x = (Tr_x / T).matrix(), delta_x = (rho * vr_x).matrix();
+        const double A_rho = a_d * vr, A_rhorho = a_dd * vr * vr;
+        const Eigen::VectorXd A_x = a_x.matrix() + a_t * tau_x + a_d * delta_x;
+        const Eigen::VectorXd A_xrho = vr * (a_xd.matrix() + a_td * tau_x + a_dd * delta_x) + a_d * vr_x.matrix();
+        Eigen::MatrixXd A_xx = a_xx + a_xt.matrix() * tau_x.transpose() + tau_x * a_xt.matrix().transpose()
+            + a_xd.matrix() * delta_x.transpose() + delta_x * a_xd.matrix().transpose()
+            + a_tt * tau_x * tau_x.transpose() + a_td * (tau_x * delta_x.transpose() + delta_x * tau_x.transpose())
+            + a_dd * delta_x * delta_x.transpose() + (a_t / T) * Tr_xx + (a_d * rho) * vr_xx;
+
+        // Derivatives of F(rho, x) = RT rho A
+        const double c = R(x) * T;
+        const double Psir = c * rho * a;
+        const double F_rho = c * (a + rho * A_rho), F_rhorho = c * (2.0 * A_rho + rho * A_rhorho);
+        const Eigen::VectorXd F_x = c * rho * A_x, F_xrho = c * (A_x + rho * A_xrho);
+        const Eigen::MatrixXd F_xx = c * rho * A_xx;
+
+        // Change of variables to the concentrations, with dx_i/drho_k = (delta_ik - x_i)/rho
+        const Eigen::VectorXd xv = x.matrix(), ones = Eigen::VectorXd::Ones(N);
+        const Eigen::VectorXd u = (F_x.array() - xv.dot(F_x)).matrix() / rho;
+        const Eigen::VectorXd v = (F_xrho.array() - xv.dot(F_xrho)).matrix() / rho;
+        const Eigen::VectorXd Mx = F_xx * xv;
+        const double xMx = xv.dot(Mx);
+        Eigen::ArrayXd gradient = F_rho + u.array();
+        Eigen::MatrixXd Hessian = (F_xx - Mx * ones.transpose() - ones * Mx.transpose()).array() / (rho * rho) + xMx / (rho * rho);
+        Hessian += (v - u / rho) * ones.transpose() + ones * (v - u / rho).transpose();
+        Hessian.array() += F_rhorho;
+        return std::make_tuple(Psir, gradient, Hessian);
+    }
+
+    /// Return a view of the model bound to the composition z, see PreparedMultiFluid
+    auto prepare_composition(const Eigen::ArrayXd& z) const {
+        return PreparedMultiFluid<MultiFluid>(*this, z);
+    }
+};
+
+/**
+ \brief A view of a MultiFluid model bound to one composition
+ 
+ The reducing temperature and density are evaluated once at construction, so that calls at the bound composition
+ only depend on T and rho.  Calls at any other composition, or with mole fractions that are not of double type
+ (as in composition derivatives), are forwarded to the underlying model.  The model must outlive this object.
+ */
+template<typename Model>
+class PreparedMultiFluid {
+private:
+    const Model& model;
+    const Eigen::ArrayXd z;
+    const double Tred, rhored;
+public:
+    PreparedMultiFluid(const Model& model, const Eigen::ArrayXd& z) : model(model), z(z), Tred(model.redfunc.get_Tr(z)), rhored(model.redfunc.get_rhor(z)) {};
+    
+    template<class VecType>
+    auto R(const VecType& molefrac) const {
+        return model.R(molefrac);
+    }
+    
+    template<typename TType, typename RhoType, typename MoleFracType>
+    auto alphar(const TType& T, const RhoType& rho, const MoleFracType& molefrac) const -> decltype(model.alphar(T, rho, molefrac))
+    {
+        if constexpr (std::is_same_v<std::decay_t<decltype(molefrac[0])>, double>) {
+            if (all_same_values(z, molefrac)) {
+                auto delta = forceeval(rho / rhored);
+                auto tau = forceeval(Tred / T);
+                return model.alphar_taudelta(tau, delta, z);
+            }
+        }
+        return model.alphar(T, rho, molefrac);
+    }
+    
+    /// See MultiFluid::get_Arxy_analytic
+    template<int iT, int iD, typename MoleFracType>
+    double get_Arxy_analytic(const double T, const double rho, const MoleFracType& molefrac) const {
+        if (all_same_values(z, molefrac)) {
+            const double tau = Tred / T, delta = rho / rhored;
+            return model.corr.template alphar_taudeltaderiv<iT, iD>(tau, delta, z) + model.dep.template alphar_taudeltaderiv<iT, iD>(tau, delta, z);
+        }
+        return model.template get_Arxy_analytic<iT, iD>(T, rho, molefrac);
     }
 };
 
@@ -819,6 +1094,227 @@ inline auto build_alias_map(const std::string& root) {
     return aliasmap;
 }
 
+namespace internal {
+    /// The size and modification time of each fluid file, used to decide whether a cached alias index is still valid
+    inline auto get_fluid_file_stamps(const std::string& root) {
+        nlohmann::json stamps = nlohmann::json::object();
+        for (const auto& path : get_files_in_folder(root + "/dev/fluids", ".json")) {
+            auto abspath = std::filesystem::absolute(path).string();
+            stamps[abspath] = {
+                {"size", std::filesystem::file_size(path)},
+                {"mtime", static_cast<std::int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count())}
+            };
+        }
+        return stamps;
+    }
+}
+
+using AliasMap = std::unordered_map<std::string, std::string>;
+
+/**
+ \brief The path of the alias index file that get_alias_map keeps for a root, if any
+
+ The index is only kept on disk if the environment variable TEQP_ALIAS_CACHE_DIR names a folder, in which there is one
+ file per root, named by a hash of its absolute path.  The fluid folder itself is never written to, as it might be
+ read-only or under version control.
+ */
+inline std::optional<std::string> get_alias_index_path(const std::string& root) {
+    const char* dir = std::getenv("TEQP_ALIAS_CACHE_DIR");
+    if (dir == nullptr || std::string(dir).empty()) {
+        return std::nullopt;
+    }
+    auto key = std::filesystem::absolute(root).lexically_normal().string();
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(std::hash<std::string>{}(key)));
+    return (std::filesystem::path(dir) / ("teqp_alias_index_" + std::string(buf) + ".json")).string();
+}
+
+namespace internal {
+    /// The alias map of a root, from the index file at indexpath if it is up to date, otherwise built and written there
+    inline AliasMap load_alias_index(const std::string& root, const std::optional<std::string>& indexpath) {
+        auto stamps = get_fluid_file_stamps(root);
+        if (indexpath && std::filesystem::is_regular_file(indexpath.value())) {
+            try {
+                auto index = load_a_JSON_file(indexpath.value());
+                if (index.at("version") == 1 && index.at("files") == stamps) {
+                    return index.at("aliases").get<AliasMap>();
+                }
+            }
+            catch (...) {
+                // A broken index is just rebuilt
+            }
+        }
+        auto m = build_alias_map(root);
+        if (indexpath) {
+            // Written under a temporary name and then renamed, so a concurrent process never reads a partial file
+            std::error_code ec;
+            auto path = std::filesystem::path(indexpath.value());
+            std::filesystem::create_directories(path.parent_path(), ec);
+            auto tmp = path;
+            tmp += ".tmp" + std::to_string(std::random_device{}());
+            bool ok = false;
+            {
+                std::ofstream ofs(tmp);
+                if (ofs) {
+                    nlohmann::json index = { {"version", 1}, {"files", stamps}, {"aliases", m} };
+                    ofs << index.dump();
+                    ok = static_cast<bool>(ofs);
+                }
+            }
+            if (ok) {
+                std::filesystem::rename(tmp, path, ec);
+            }
+            if (!ok || ec) {
+                std::filesystem::remove(tmp, ec);
+            }
+        }
+        return AliasMap(m.begin(), m.end());
+    }
+}
+
+/**
+ \brief The alias map of build_alias_map, but cached
+
+ The map is kept in memory for each root for the lifetime of the process, so after the first call for a root, the lookup
+ of a name is one hash lookup.  If TEQP_ALIAS_CACHE_DIR is set (see get_alias_index_path), the map is also stored in an
+ index file, which is reused by later processes as long as no fluid file was added, removed, or modified, so the fluid
+ files only need to be parsed when they change.  If the index file cannot be written, the map is only cached in memory.
+ The map in memory is never invalidated: fluid files added to, removed from, or modified in a root after the first call
+ for that root are only picked up by a new process.
+ */
+inline std::shared_ptr<const AliasMap> get_alias_map(const std::string& root) {
+    static std::mutex mtx;
+    static std::map<std::string, std::shared_ptr<const AliasMap>> cache;
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto key = std::filesystem::absolute(root).lexically_normal().string();
+    if (auto it = cache.find(key); it != cache.end()) {
+        return it->second;
+    }
+    auto aliasmap = std::make_shared<const AliasMap>(internal::load_alias_index(root, get_alias_index_path(root)));
+    cache[key] = aliasmap;
+    return aliasmap;
+}
+
+/**
+ \brief A BIP collection and a departure function collection, indexed by component pair and by name
+
+ Used to extract only the records needed for a model, rather than handing the complete collections to the builder, which
+ would search them linearly for each pair. The records are in the same order as in the collections, so the first
+ match for a pair is the same as with the complete collections.
+ */
+class IndexedMixtureCollections {
+private:
+    nlohmann::json BIPcollection, depcollection;
+    std::unordered_map<std::string, std::vector<std::size_t>> BIP_by_name, BIP_by_CAS;
+    std::unordered_map<std::string, std::size_t> dep_by_name;
+
+    static auto toupper(std::string s) {
+        std::for_each(s.begin(), s.end(), [](char& c) { c = static_cast<char>(::toupper(c)); });
+        return s;
+    }
+    static auto pairkey(const std::string& a, const std::string& b) { return a + '\x1f' + b; }
+public:
+    IndexedMixtureCollections(nlohmann::json&& BIP, nlohmann::json&& dep) : BIPcollection(std::move(BIP)), depcollection(std::move(dep)) {
+        for (auto i = 0U; i < BIPcollection.size(); ++i) {
+            const auto& el = BIPcollection[i];
+            if (el.contains("Name1") && el.contains("Name2")) {
+                std::string n1 = toupper(el.at("Name1")), n2 = toupper(el.at("Name2"));
+                BIP_by_name[pairkey(n1, n2)].push_back(i);
+                BIP_by_name[pairkey(n2, n1)].push_back(i);
+            }
+            if (el.contains("CAS1") && el.contains("CAS2")) {
+                std::string c1 = el.at("CAS1"), c2 = el.at("CAS2");
+                BIP_by_CAS[pairkey(c1, c2)].push_back(i);
+                BIP_by_CAS[pairkey(c2, c1)].push_back(i);
+            }
+        }
+        for (auto i = 0U; i < depcollection.size(); ++i) {
+            const auto& el = depcollection[i];
+            if (el.contains("Name")) {
+                dep_by_name.emplace(el.at("Name").get<std::string>(), i); // The first one wins, as in get_departure_function_matrix
+            }
+        }
+    }
+
+    /// The BIP and departure records that can be matched by any of the identifiers (name, CAS, REFPROP name) of the fluids
+    auto get_subset(const std::vector<nlohmann::json>& pureJSON) const {
+        std::set<std::size_t> iBIP, idep;
+        for (const auto& [key, identifiers] : collect_identifiers(pureJSON)) {
+            for (auto i = 0U; i < identifiers.size(); ++i) {
+                for (auto j = i + 1; j < identifiers.size(); ++j) {
+                    for (const auto* index : { &BIP_by_name, &BIP_by_CAS }) {
+                        const bool upper = (index == &BIP_by_name);
+                        auto a = upper ? toupper(identifiers[i]) : identifiers[i], b = upper ? toupper(identifiers[j]) : identifiers[j];
+                        if (auto it = index->find(pairkey(a, b)); it != index->end()) {
+                            iBIP.insert(it->second.begin(), it->second.end());
+                        }
+                    }
+                }
+            }
+        }
+        nlohmann::json BIP = nlohmann::json::array(), dep = nlohmann::json::array();
+        for (auto i : iBIP) {
+            const auto& el = BIPcollection[i];
+            BIP.push_back(el);
+            if (el.contains("function") && el.at("function").is_string()) {
+                if (auto it = dep_by_name.find(el.at("function").get<std::string>()); it != dep_by_name.end()) {
+                    idep.insert(it->second);
+                }
+            }
+        }
+        for (auto i : idep) {
+            dep.push_back(depcollection[i]);
+        }
+        return std::make_tuple(BIP, dep);
+    }
+};
+
+/**
+ \brief Get the indexed collections for the given files; each pair of files is loaded and indexed once per process
+ */
+inline std::shared_ptr<const IndexedMixtureCollections> get_indexed_mixture_collections(const std::string& BIPpath, const std::string& deppath) {
+    static std::mutex mtx;
+    static std::map<std::pair<std::string, std::string>, std::shared_ptr<const IndexedMixtureCollections>> cache;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto key = std::make_pair(std::filesystem::absolute(BIPpath).lexically_normal().string(), std::filesystem::absolute(deppath).lexically_normal().string());
+    if (auto it = cache.find(key); it != cache.end()) {
+        return it->second;
+    }
+    auto coll = std::make_shared<const IndexedMixtureCollections>(load_a_JSON_file(BIPpath), load_a_JSON_file(deppath));
+    cache[key] = coll;
+    return coll;
+}
+
+/**
+ \brief Load the BIP and departure collections to be used for the given fluids, with the same rules as multilevel_JSON_load
+
+ When both are given as paths to files (or not given, in which case the default files under the root are used), only the
+ records needed for these fluids are returned, extracted from the indexed collections. Otherwise the complete collections are returned.
+ */
+inline auto load_mixture_collections(const nlohmann::json& BIP, const nlohmann::json& departure, const std::string& root, const std::vector<nlohmann::json>& pureJSON) {
+    auto as_path = [](const nlohmann::json& j, const std::string& default_path) -> std::optional<std::string> {
+        if (j.is_null() || (j.is_array() && j.empty()) || (j.is_string() && j.get<std::string>().empty())) {
+            return default_path;
+        }
+        if (j.is_string()) {
+            try {
+                if (std::filesystem::is_regular_file(j.get<std::string>())) {
+                    return j.get<std::string>();
+                }
+            }
+            catch (...) {} // Not a valid path, probably JSON-encoded data
+        }
+        return std::nullopt;
+    };
+    auto BIPpath = as_path(BIP, root + "/dev/mixtures/mixture_binary_pairs.json");
+    auto deppath = as_path(departure, root + "/dev/mixtures/mixture_departure_functions.json");
+    if (BIPpath && deppath) {
+        return get_indexed_mixture_collections(BIPpath.value(), deppath.value())->get_subset(pureJSON);
+    }
+    return std::make_tuple(multilevel_JSON_load(BIP, root + "/dev/mixtures/mixture_binary_pairs.json"), multilevel_JSON_load(departure, root + "/dev/mixtures/mixture_departure_functions.json"));
+}
+
 /// Internal method for actually constructing the model with the provided JSON data structures
 inline auto _build_multifluid_model(const std::vector<nlohmann::json> &pureJSON, const nlohmann::json& BIPcollection, const nlohmann::json& depcollection, const nlohmann::json& flags = {}) {
 
@@ -838,6 +1334,7 @@ inline auto _build_multifluid_model(const std::vector<nlohmann::json> &pureJSON,
     nlohmann::json meta = {
         {"pures", pureJSON},
         {"mix", funcsmeta},
+        {"flags", flags},
     };
 
     auto redfunc = ReducingFunctions(std::move(MultiFluidReducingFunction(betaT, gammaT, betaV, gammaV, Tc, vc)));
@@ -919,7 +1416,7 @@ inline auto make_pure_components_JSON(const nlohmann::json& components, const st
     }
     else{
         // Lookup the absolute paths for each component
-        auto aliasmap = build_alias_map(root);
+        auto aliasmap = get_alias_map(root);
         std::vector<std::string> abspaths;
         for (auto c : components) {
             auto cstr = c.get<std::string>();
@@ -928,7 +1425,8 @@ inline auto make_pure_components_JSON(const nlohmann::json& components, const st
                 abspaths.push_back(cstr);
             }
             else {
-                abspaths.push_back(aliasmap[cstr]);
+                auto it = aliasmap->find(cstr);
+                abspaths.push_back((it != aliasmap->end()) ? it->second : "");
             }
         }
         // Backup lookup with absolute paths resolved for each component
@@ -940,15 +1438,83 @@ inline auto make_pure_components_JSON(const nlohmann::json& components, const st
 inline auto build_multifluid_model(const std::vector<std::string>& components, const std::string& root, const std::string& BIPcollectionpath = {}, const nlohmann::json& flags = {}, const std::string& departurepath = {}) {
     
     // Convert the string representations to JSON using the existing routines (a bit slower, but more convenient, more DRY)
+    auto pureJSON = make_pure_components_JSON(components, root);
     nlohmann::json BIPcollection = nlohmann::json::array();
     nlohmann::json depcollection = nlohmann::json::array();
     if (components.size() > 1){
         nlohmann::json B = BIPcollectionpath, D = departurepath;
-        BIPcollection = multilevel_JSON_load(B, root + "/dev/mixtures/mixture_binary_pairs.json");
-        depcollection = multilevel_JSON_load(D, root + "/dev/mixtures/mixture_departure_functions.json");
+        std::tie(BIPcollection, depcollection) = load_mixture_collections(B, D, root, pureJSON);
     }
     
-    return _build_multifluid_model(make_pure_components_JSON(components, root), BIPcollection, depcollection, flags);
+    return _build_multifluid_model(pureJSON, BIPcollection, depcollection, flags);
+}
+
+/**
+ \brief The data needed to rebuild a multifluid model: the pure fluid JSON, and only the BIP and departure records that are used by the model
+
+ Obtained from the metadata of the model, so this works for models built by any of the builder functions
+ */
+template<typename Model>
+inline auto get_multifluid_model_data(const Model& model) {
+    const auto meta = nlohmann::json::parse(model.get_meta());
+    nlohmann::json BIP = nlohmann::json::array(), departure = nlohmann::json::array();
+    std::set<std::string> depnames;
+    for (const auto& [istr, row] : meta.at("mix").items()) {
+        for (const auto& [jstr, pair] : row.items()) {
+            auto bip = pair.at("BIP");
+            // Estimated parameters are not records of the collection, and they are regenerated from the flags
+            if (bip.contains("Name1") && bip.contains("CAS1")) {
+                bip.erase("swap_needed");
+                BIP.push_back(bip);
+            }
+            const auto& dep = pair.at("departure");
+            if (dep.is_object() && dep.contains("Name") && depnames.count(dep.at("Name")) == 0) {
+                depnames.insert(dep.at("Name").template get<std::string>());
+                departure.push_back(dep);
+            }
+        }
+    }
+    return nlohmann::json{
+        {"format", "teqp-multifluid"}, {"version", 1},
+        {"pures", meta.at("pures")}, {"BIP", BIP}, {"departure", departure},
+        {"flags", meta.contains("flags") ? meta.at("flags") : nlohmann::json()}
+    };
+}
+
+/**
+ \brief Write a multifluid model to a compact binary (CBOR) file that can be loaded with load_multifluid_model_binary
+
+ Only the data used by the model is stored, so loading it does not require the fluid library, nor parsing the complete
+ BIP and departure function collections.  The file is the CBOR encoding of the JSON of get_multifluid_model_data, not an
+ image of the model in memory: load_multifluid_model_binary still builds the model from that JSON, so its time is
+ dominated by the construction of the model rather than by the parsing of the file.
+ */
+template<typename Model>
+inline void save_multifluid_model_binary(const Model& model, const std::string& path) {
+    const auto bytes = nlohmann::json::to_cbor(get_multifluid_model_data(model));
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs) {
+        throw teqp::InvalidArgument("Unable to open file for writing: " + path);
+    }
+    ofs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+/// Rebuild a multifluid model from the data returned by get_multifluid_model_data
+inline auto build_multifluid_model_from_data(const nlohmann::json& data) {
+    if (data.value("format", "") != "teqp-multifluid" || data.value("version", 0) != 1) {
+        throw teqp::InvalidArgument("Data are not that of a multifluid model of a known version");
+    }
+    return _build_multifluid_model(data.at("pures").get<std::vector<nlohmann::json>>(), data.at("BIP"), data.at("departure"), data.at("flags"));
+}
+
+/// Load a multifluid model that was written with save_multifluid_model_binary; the model is built in full from the decoded data, as with build_multifluid_model_from_data
+inline auto load_multifluid_model_binary(const std::string& path) {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) {
+        throw teqp::InvalidArgument("Unable to open binary model file: " + path);
+    }
+    std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    return build_multifluid_model_from_data(nlohmann::json::from_cbor(bytes));
 }
 
 /**
@@ -956,24 +1522,36 @@ inline auto build_multifluid_model(const std::vector<std::string>& components, c
 * 
 * Required fields are: components, BIP, departure
 * 
+* Alternatively, the field binary can be given, with the path to a model saved with save_multifluid_model_binary,
+* or the field data, with the JSON returned by get_multifluid_model_data
+* 
 * BIP and departure can be either the data in JSON format, or a path to file with those contents
 * components is an array, which either contains the paths to the JSON data, or the file path
 */
 inline auto multifluidfactory(const nlohmann::json& spec) {
     
+    // A model that was saved with save_multifluid_model_binary
+    if (spec.contains("binary")) {
+        return load_multifluid_model_binary(spec.at("binary"));
+    }
+    // The data of a model, as returned by get_multifluid_model_data
+    if (spec.contains("data")) {
+        return build_multifluid_model_from_data(spec.at("data"));
+    }
+    
     std::string root = (spec.contains("root")) ? spec.at("root") : "";
     
     auto components = spec.at("components");
+    auto pureJSON = make_pure_components_JSON(components, root);
     
     nlohmann::json BIPcollection = nlohmann::json::array();
     nlohmann::json depcollection = nlohmann::json::array();
     if (components.size() > 1){
-        BIPcollection = multilevel_JSON_load(spec.at("BIP"), root + "/dev/mixtures/mixture_binary_pairs.json");
-        depcollection = multilevel_JSON_load(spec.at("departure"), root + "/dev/mixtures/mixture_departure_functions.json");
+        std::tie(BIPcollection, depcollection) = load_mixture_collections(spec.at("BIP"), spec.at("departure"), root, pureJSON);
     }
     nlohmann::json flags = (spec.contains("flags")) ? spec.at("flags") : nlohmann::json();
 
-    return _build_multifluid_model(make_pure_components_JSON(components, root), BIPcollection, depcollection, flags);
+    return _build_multifluid_model(pureJSON, BIPcollection, depcollection, flags);
 }
 /// An overload of multifluidfactory that takes in a string
 inline auto multifluidfactory(const std::string& specstring) {
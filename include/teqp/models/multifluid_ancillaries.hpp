@@ -2,6 +2,7 @@
 
 #include <valarray>
 #include "nlohmann/json.hpp"
+#include "teqp/types.hpp"
 #include "teqp/exceptions.hpp"
 
 namespace teqp{
@@ -25,12 +26,13 @@ namespace teqp{
             using_tau_r(j.at("using_tau_r")),
             noexp(type == "rhoLnoexp"){};
 
-		double operator() (double T) const{
-			if (T > T_r) {
-				throw teqp::InvalidArgument("Input temperature of " + std::to_string(T) + " K is above the reducing temperature of " + std::to_string(T_r) + " K");
-			}
+		/// Evaluate the ancillary without checking the temperature; no temporaries are allocated
+		double evaluate_unchecked(double T) const{
 			auto Theta = 1-T/T_r;
-			auto RHS = (pow(Theta, t)*n).sum();
+			double RHS = 0;
+			for (auto i = 0U; i < n.size(); ++i){
+				RHS += n[i]*pow(Theta, t[i]);
+			}
 			if (using_tau_r){
 				RHS *= T_r/T;
 			}
@@ -40,7 +42,39 @@ namespace teqp{
 	        else{
 	            return exp(RHS)*reducing_value;
 	        }
+		}
+
+		/// Throw if a temperature is above the reducing temperature
+		void check_T(double T) const{
+			if (T > T_r) {
+				throw teqp::InvalidArgument("Input temperature of " + std::to_string(T) + " K is above the reducing temperature of " + std::to_string(T_r) + " K");
+			}
+		}
+
+		double operator() (double T) const{
+			check_T(T);
+			return evaluate_unchecked(T);
 		};
+
+		/// Evaluate the ancillary for each temperature in T, writing into out, which must be the same size as T
+		void eval_many(const Eigen::Ref<const Eigen::ArrayXd>& T, Eigen::Ref<Eigen::ArrayXd> out) const{
+			if (T.size() != out.size()){
+				throw teqp::InvalidArgument("T and out must be the same size");
+			}
+			if (T.size() > 0){
+				check_T(T.maxCoeff());
+			}
+			for (auto i = 0; i < T.size(); ++i){
+				out[i] = evaluate_unchecked(T[i]);
+			}
+		}
+
+		/// Evaluate the ancillary for each temperature in T
+		Eigen::ArrayXd operator() (const Eigen::ArrayXd& T) const{
+			Eigen::ArrayXd out(T.size());
+			eval_many(T, out);
+			return out;
+		}
 	};
 
 	struct MultiFluidVLEAncillaries {
@@ -50,5 +84,26 @@ namespace teqp{
 			rhoV(VLEAncillary(j.at("rhoV"))),
 			pL((j.contains("pS")) ? VLEAncillary(j.at("pS")) : VLEAncillary(j.at("pL"))),
 			pV((j.contains("pS")) ? VLEAncillary(j.at("pS")) : VLEAncillary(j.at("pV"))){}
+
+		/**
+		 \brief Evaluate the liquid and vapor densities and the pressure for each temperature in T in one pass
+
+		 The pressure comes from the pL ancillary, which is the same as pV when a single pS ancillary is given.
+		 The output arrays must be the same size as T; nothing is allocated.
+		 */
+		void eval_many(const Eigen::Ref<const Eigen::ArrayXd>& T, Eigen::Ref<Eigen::ArrayXd> rhoLout, Eigen::Ref<Eigen::ArrayXd> rhoVout, Eigen::Ref<Eigen::ArrayXd> pout) const{
+			if (T.size() != rhoLout.size() || T.size() != rhoVout.size() || T.size() != pout.size()){
+				throw teqp::InvalidArgument("T and the output arrays must be the same size");
+			}
+			if (T.size() > 0){
+				auto Tmax = T.maxCoeff();
+				rhoL.check_T(Tmax); rhoV.check_T(Tmax); pL.check_T(Tmax);
+			}
+			for (auto i = 0; i < T.size(); ++i){
+				rhoLout[i] = rhoL.evaluate_unchecked(T[i]);
+				rhoVout[i] = rhoV.evaluate_unchecked(T[i]);
+				pout[i] = pL.evaluate_unchecked(T[i]);
+			}
+		}
 	};
-}
\ No newline at end of file
+}
@@ -1,9 +1,215 @@
 #pragma once
 
+#include <array>
+#include <tuple>
+#include <vector>
+#include <limits>
+#include <unordered_map>
+
 #include "teqp/types.hpp"
+#include "teqp/per_thread.hpp"
+#include "teqp/exceptions.hpp"
 
 namespace teqp {
 
+/// Append the coefficients in b to those in a; used to merge terms of the same kind, see MergedEOSTermContainer
+template<typename ArrayType>
+void append_coeffs(ArrayType& a, const ArrayType& b) {
+    ArrayType c(a.size() + b.size());
+    c.head(a.size()) = a;
+    c.tail(b.size()) = b;
+    a = std::move(c);
+}
+
+/**
+ A memo of the factors of the EOS terms that only depend on \f$\tau\f$, for instance \f$n_i\tau^{t_i}\f$, keyed on the
+ term and the value of \f$\tau\f$, see MultiFluid::enable_tau_cache.  Only values (not derivatives) with respect
+ to \f$\tau\f$ are stored, so it is used when \f$\tau\f$ is a double, as in the density derivatives at fixed
+ temperature and composition.  Each thread has its own entries, so no locking is needed.
+ */
+class TauFactorCache {
+private:
+    struct Entry { double tau = std::numeric_limits<double>::quiet_NaN(); Eigen::ArrayXd F; };
+    /// Copies start empty, because the keys are the addresses of the terms of the model that owns the cache
+    PerThreadStore<std::unordered_map<const void*, Entry>> entries;
+public:
+    void clear() { entries.reset(); }
+
+    /// The factors of the given term at tau; fill(F) is called to (re)compute them if tau differs from the value stored by this thread
+    template<typename Function>
+    const Eigen::ArrayXd& get(const void* term, const double tau, const Function& fill) {
+        auto& e = entries.local()[term];
+        if (!(e.tau == tau)) {
+            fill(e.F);
+            e.tau = tau;
+        }
+        return e.F;
+    }
+};
+
+/**
+ The quantities that depend only on the reduced state, and are needed by many of the terms. They are evaluated once per
+ evaluation of alphar and shared by all the terms (of all the fluids in a mixture), so that the logarithms and powers
+ of what are often autodiff types are not recomputed in every term.
+ */
+template<typename TauType, typename DeltaType>
+struct ReducedStateContext {
+    static constexpr int Nlmax = 8; ///< Integer powers of delta up to this value are cached
+    const TauType tau;
+    const DeltaType delta;
+    const TauType lntau;
+    const bool delta_is_zero;
+    const DeltaType lndelta; ///< Only meaningful if delta is not zero; zero otherwise
+    TauFactorCache* const taucache; ///< If not null (only allowed for double tau), the terms take their tau factors from here
+private:
+    std::array<DeltaType, Nlmax + 1> deltal;
+public:
+    ReducedStateContext(const TauType& tau, const DeltaType& delta, TauFactorCache* taucache = nullptr)
+        : tau(tau), delta(delta), lntau(log(tau)), delta_is_zero(getbaseval(delta) == 0), lndelta(delta_is_zero ? static_cast<DeltaType>(0.0) : static_cast<DeltaType>(log(delta))), taucache(taucache)
+    {
+        if constexpr (!std::is_same_v<TauType, double>) {
+            if (taucache != nullptr) {
+                throw teqp::InvalidArgument("The cache of tau factors can only be used with double tau");
+            }
+        }
+        deltal[0] = 1.0;
+        for (auto l = 1; l <= Nlmax; ++l) {
+            deltal[l] = deltal[l - 1] * delta;
+        }
+    }
+    /// \f$\delta^l\f$, from the cache if possible
+    DeltaType powdelta(const int l) const {
+        if (l >= 0 && l <= Nlmax) {
+            return deltal[l];
+        }
+        return powi(delta, l);
+    }
+};
+
+/// Detect whether a term (or a container of terms) has an alphar overload taking a ReducedStateContext
+template<typename T, typename Ctx, typename = void>
+struct has_context_alphar : std::false_type {};
+template<typename T, typename Ctx>
+struct has_context_alphar<T, Ctx, std::void_t<decltype(std::declval<const T&>().alphar(std::declval<const Ctx&>()))>> : std::true_type {};
+
+/// Evaluate alphar of a term with the shared context if the term supports it, or from tau and delta otherwise
+template<typename Term, typename TauType, typename DeltaType>
+auto alphar_with_context(const Term& term, const ReducedStateContext<TauType, DeltaType>& ctx) {
+    if constexpr (has_context_alphar<Term, ReducedStateContext<TauType, DeltaType>>::value) {
+        return term.alphar(ctx);
+    }
+    else {
+        return term.alphar(ctx.tau, ctx.delta);
+    }
+}
+
+/**
+ Sum of \f$F_i\delta^{d_i}\exp(h_i)\f$ over the terms, where F are the memoized tau factors (see TauFactorCache) and
+ h(i) returns the part of the exponent of term i that depends on delta
+ */
+template<typename TauType, typename DeltaType, typename HFunc>
+auto sum_tau_factored(const Eigen::ArrayXd& F, const Eigen::ArrayXd& d, const ReducedStateContext<TauType, DeltaType>& ctx, const HFunc& h) {
+    using result = std::common_type_t<TauType, DeltaType>;
+    result r = 0.0;
+    if (ctx.delta_is_zero) {
+        for (auto i = 0; i < F.size(); ++i) {
+            r = r + F[i] * exp(h(i)) * powi(ctx.delta, static_cast<int>(d[i]));
+        }
+    }
+    else {
+        for (auto i = 0; i < F.size(); ++i) {
+            r = r + F[i] * exp(d[i] * ctx.lndelta + h(i));
+        }
+    }
+    return forceeval(r);
+}
+
+/// The memoized tau factors of the term if the context holds a cache (see TauFactorCache), or nullptr otherwise
+template<typename Term, typename TauType, typename DeltaType>
+const Eigen::ArrayXd* cached_tau_factors(const Term& term, const ReducedStateContext<TauType, DeltaType>& ctx) {
+    if constexpr (std::is_same_v<TauType, double>) {
+        if (ctx.taucache != nullptr) {
+            return &ctx.taucache->get(&term, ctx.tau, [&](Eigen::ArrayXd& F) { term.tau_factors(ctx.tau, ctx.lntau, F); });
+        }
+    }
+    return nullptr;
+}
+
+/// Helpers for the closed-form derivatives of the EOS terms that are used by ADBackends::analytic
+namespace analytic {
+
+    /// The falling factorial \f$p(p-1)\cdots(p-m+1)\f$
+    inline double falling(const double p, const int m) {
+        double r = 1.0;
+        for (auto k = 0; k < m; ++k) { r *= (p - k); }
+        return r;
+    }
+
+    /**
+    For a factor \f$ g(x) = x^p\exp(h(x)) \f$, return \f$ x^k g^{(k)}(x)/g(x) \f$ for \f$k=0,\ldots,N\f$.
+
+    The argument a holds \f$a_m = x^m h^{(m)}(x)\f$ for \f$m=1,\ldots,N\f$ (a[0] is not used). The derivatives of the
+    exponential follow from the Leibniz rule applied to \f$E'=h'E\f$, and those of the product from the Leibniz rule again.
+    Everything is kept scaled by powers of x, so the result remains finite at x = 0.
+    */
+    template<int N>
+    auto scaled_derivs(const double p, const std::array<double, N + 1>& a) {
+        std::array<double, N + 1> e{}, out{};
+        e[0] = 1.0;
+        for (auto k = 0; k < N; ++k) {
+            double s = 0.0, binom = 1.0;
+            for (auto m = 0; m <= k; ++m) {
+                s += binom * a[m + 1] * e[k - m];
+                binom = binom * (k - m) / (m + 1);
+            }
+            e[k + 1] = s;
+        }
+        for (auto k = 0; k <= N; ++k) {
+            double s = 0.0, binom = 1.0;
+            for (auto m = 0; m <= k; ++m) {
+                s += binom * falling(p, m) * e[k - m];
+                binom = binom * (k - m) / (m + 1);
+            }
+            out[k] = s;
+        }
+        return out;
+    }
+
+    /// Coefficients \f$a_m = x^m h^{(m)}\f$ for \f$h = -c x^l\f$
+    template<int N>
+    auto power_coeffs(const double c, const double l, const double x) {
+        std::array<double, N + 1> a{};
+        if (c != 0) {
+            double xl = pow(x, l);
+            for (auto m = 1; m <= N; ++m) { a[m] = -c * falling(l, m) * xl; }
+        }
+        return a;
+    }
+
+    /// Coefficients \f$a_m = x^m h^{(m)}\f$ for \f$h = -\eta(x-\epsilon)^2 - \beta(x-\gamma)\f$
+    template<int N>
+    auto quadratic_coeffs(const double eta, const double epsilon, const double beta, const double x) {
+        std::array<double, N + 1> a{};
+        if constexpr (N >= 1) { a[1] = x * (-2.0 * eta * (x - epsilon) - beta); }
+        if constexpr (N >= 2) { a[2] = -2.0 * eta * x * x; }
+        return a;
+    }
+
+    /// The value of \f$ n\tau^t\delta^d\exp(h) \f$, also valid at \f$\delta=0\f$
+    inline double summand(const double n, const double t, const double d, const double lntau, const double delta, const double lndelta, const double h) {
+        if (delta == 0) {
+            return n * exp(t * lntau + h) * powi(delta, static_cast<int>(d));
+        }
+        return n * exp(t * lntau + d * lndelta + h);
+    }
+
+    /// Detect whether a term provides the closed-form derivatives
+    template<typename T, typename = void>
+    struct has_alphar_taudeltaderiv : std::false_type {};
+    template<typename T>
+    struct has_alphar_taudeltaderiv<T, std::void_t<decltype(std::declval<const T&>().template alphar_taudeltaderiv<0, 0>(1.0, 1.0))>> : std::true_type {};
+}
+
 /**
 \f$ \alpha^{\rm r}=\displaystyle\sum_i n_i \delta^{d_i} \tau^{t_i}\f$
 */
@@ -11,24 +217,72 @@ class JustPowerEOSTerm {
 public:
     Eigen::ArrayXd n, t, d;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const JustPowerEOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau);
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta)).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [](auto) { return 0.0; });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
-        double base_delta = getbaseval(delta);
-        if (base_delta == 0) {
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau)*powi(delta, static_cast<int>(d[i]));
             }
         }
+        else if constexpr (std::is_same_v<result, double>) {
+            // All terms at once as array expressions, without branches, which Eigen can vectorize
+            const double lndelta = ctx.lndelta;
+            return (n * exp(t * lntau + d * lndelta)).sum();
+        }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta);
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, 0.0) * analytic::falling(t[i], iT) * analytic::falling(d[i], iD);
+        }
+        return r;
+    }
 };
 
 /**
@@ -39,26 +293,80 @@ public:
     Eigen::ArrayXd n, t, d, c, l;
     Eigen::ArrayXi l_i;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const PowerEOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(c, other.c);
+        append_coeffs(l, other.l);
+        append_coeffs(l_i, other.l_i);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau);
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - c * exp(l * lndelta))).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-c[i] * ctx.powdelta(l_i[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
         if (l_i.size() == 0 && n.size() > 0) {
             throw std::invalid_argument("l_i cannot be zero length if some terms are provided");
         }
-        if (getbaseval(delta) == 0) {
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau - c[i] * powi(delta, l_i[i])) * powi(delta, static_cast<int>(d[i]));
+                r = r + n[i] * exp(t[i] * lntau - c[i] * ctx.powdelta(l_i[i])) * powi(delta, static_cast<int>(d[i]));
             }
         }
+        else if constexpr (std::is_same_v<result, double>) {
+            // All terms at once as array expressions, without branches, which Eigen can vectorize
+            const double lndelta = ctx.lndelta;
+            return (n * exp(t * lntau + d * lndelta - c * exp(l * lndelta))).sum();
+        }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - c[i] * powi(delta, l_i[i]));
+                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - c[i] * ctx.powdelta(l_i[i]));
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            auto aD = analytic::power_coeffs<iD>(c[i], l_i[i], delta);
+            double h = -c[i] * powi(delta, l_i[i]);
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, h) * analytic::falling(t[i], iT) * analytic::scaled_derivs<iD>(d[i], aD)[iD];
+        }
+        return r;
+    }
 };
 
 /**
@@ -69,23 +377,77 @@ public:
     Eigen::ArrayXd n, t, d, g, l;
     Eigen::ArrayXi l_i;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const ExponentialEOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(g, other.g);
+        append_coeffs(l, other.l);
+        append_coeffs(l_i, other.l_i);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau);
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - g * exp(l * lndelta))).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-g[i] * ctx.powdelta(l_i[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
-        if (getbaseval(delta) == 0) {
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau  - g[i] * powi(delta, l_i[i]))*powi(delta,static_cast<int>(d[i]));
+                r = r + n[i] * exp(t[i] * lntau  - g[i] * ctx.powdelta(l_i[i]))*powi(delta,static_cast<int>(d[i]));
             }
         }
+        else if constexpr (std::is_same_v<result, double>) {
+            // All terms at once as array expressions, without branches, which Eigen can vectorize
+            const double lndelta = ctx.lndelta;
+            return (n * exp(t * lntau + d * lndelta - g * exp(l * lndelta))).sum();
+        }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - g[i] * powi(delta, l_i[i]));
+                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - g[i] * ctx.powdelta(l_i[i]));
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            auto aD = analytic::power_coeffs<iD>(g[i], l_i[i], delta);
+            double h = -g[i] * powi(delta, l_i[i]);
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, h) * analytic::falling(t[i], iT) * analytic::scaled_derivs<iD>(d[i], aD)[iD];
+        }
+        return r;
+    }
 };
 
 /**
@@ -96,26 +458,79 @@ public:
     Eigen::ArrayXd n, t, d, gd, ld, gt, lt;
     Eigen::ArrayXi ld_i;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const DoubleExponentialEOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(gd, other.gd);
+        append_coeffs(ld, other.ld);
+        append_coeffs(gt, other.gt);
+        append_coeffs(lt, other.lt);
+        append_coeffs(ld_i, other.ld_i);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau - gt * exp(lt * lntau));
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - gd * exp(ld * lndelta))).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-gd[i] * ctx.powdelta(ld_i[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& tau = ctx.tau;
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
         if (ld_i.size() == 0 && n.size() > 0) {
             throw std::invalid_argument("ld_i cannot be zero length if some terms are provided");
         }
-        if (getbaseval(delta) == 0) {
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * powi(delta, static_cast<int>(d[i])) * exp(t[i] * lntau - gd[i]*powi(delta, ld_i[i]) - gt[i]*pow(tau, lt[i]));
+                r = r + n[i] * powi(delta, static_cast<int>(d[i])) * exp(t[i] * lntau - gd[i]*ctx.powdelta(ld_i[i]) - gt[i]*pow(tau, lt[i]));
             }
         }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - gd[i]*powi(delta, ld_i[i]) - gt[i]*pow(tau, lt[i]));
+                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - gd[i]*ctx.powdelta(ld_i[i]) - gt[i]*pow(tau, lt[i]));
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            auto aT = analytic::power_coeffs<iT>(gt[i], lt[i], tau);
+            auto aD = analytic::power_coeffs<iD>(gd[i], ld_i[i], delta);
+            double h = -gd[i] * powi(delta, ld_i[i]) - gt[i] * pow(tau, lt[i]);
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, h) * analytic::scaled_derivs<iT>(t[i], aT)[iT] * analytic::scaled_derivs<iD>(d[i], aD)[iD];
+        }
+        return r;
+    }
 };
 
 /**
@@ -125,24 +540,82 @@ class GaussianEOSTerm {
 public:
     Eigen::ArrayXd n, t, d, eta, beta, gamma, epsilon;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const GaussianEOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(eta, other.eta);
+        append_coeffs(beta, other.beta);
+        append_coeffs(gamma, other.gamma);
+        append_coeffs(epsilon, other.epsilon);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau - beta * (tau - gamma).square());
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        const auto& delta = ctx.delta;
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - eta * (delta - epsilon).square())).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-eta[i] * (delta - epsilon[i]) * (delta - epsilon[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& tau = ctx.tau;
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
         auto square = [](auto x) { return x * x; };
-        if (getbaseval(delta) == 0) {
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau - eta[i] * square(delta - epsilon[i]) - beta[i] * square(tau - gamma[i]))*powi(delta, static_cast<int>(d[i]));
             }
         }
+        else if constexpr (std::is_same_v<result, double>) {
+            // All terms at once as array expressions, without branches, which Eigen can vectorize
+            const double lndelta = ctx.lndelta;
+            return (n * exp(t * lntau + d * lndelta - eta * (delta - epsilon).square() - beta * (tau - gamma).square())).sum();
+        }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - eta[i] * square(delta - epsilon[i]) - beta[i] * square(tau - gamma[i]));
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            auto aT = analytic::quadratic_coeffs<iT>(beta[i], gamma[i], 0.0, tau);
+            auto aD = analytic::quadratic_coeffs<iD>(eta[i], epsilon[i], 0.0, delta);
+            double h = -eta[i] * (delta - epsilon[i]) * (delta - epsilon[i]) - beta[i] * (tau - gamma[i]) * (tau - gamma[i]);
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, h) * analytic::scaled_derivs<iT>(t[i], aT)[iT] * analytic::scaled_derivs<iD>(d[i], aD)[iD];
+        }
+        return r;
+    }
 };
 
 /**
@@ -152,24 +625,80 @@ class GERG2004EOSTerm {
 public:
     Eigen::ArrayXd n, t, d, eta, beta, gamma, epsilon;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const GERG2004EOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(eta, other.eta);
+        append_coeffs(beta, other.beta);
+        append_coeffs(gamma, other.gamma);
+        append_coeffs(epsilon, other.epsilon);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau);
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        const auto& delta = ctx.delta;
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - eta * (delta - epsilon).square() - beta * (delta - gamma))).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-eta[i] * (delta - epsilon[i]) * (delta - epsilon[i]) - beta[i] * (delta - gamma[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
         auto square = [](auto x) { return x * x; };
-        if (getbaseval(delta) == 0) {
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau - eta[i] * square(delta - epsilon[i]) - beta[i] * (delta - gamma[i]))*powi(delta, static_cast<int>(d[i]));
             }
         }
+        else if constexpr (std::is_same_v<result, double>) {
+            // All terms at once as array expressions, without branches, which Eigen can vectorize
+            const double lndelta = ctx.lndelta;
+            return (n * exp(t * lntau + d * lndelta - eta * (delta - epsilon).square() - beta * (delta - gamma))).sum();
+        }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - eta[i] * square(delta - epsilon[i]) - beta[i] * (delta - gamma[i]));
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            auto aD = analytic::quadratic_coeffs<iD>(eta[i], epsilon[i], beta[i], delta);
+            double h = -eta[i] * (delta - epsilon[i]) * (delta - epsilon[i]) - beta[i] * (delta - gamma[i]);
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, h) * analytic::falling(t[i], iT) * analytic::scaled_derivs<iD>(d[i], aD)[iD];
+        }
+        return r;
+    }
 };
 
 
@@ -181,23 +710,74 @@ public:
     Eigen::ArrayXd n, t, d, l, m;
     Eigen::ArrayXi l_i;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const Lemmon2005EOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(l, other.l);
+        append_coeffs(m, other.m);
+        append_coeffs(l_i, other.l_i);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau - exp(m * lntau));
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - exp(l * lndelta))).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-ctx.powdelta(l_i[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& tau = ctx.tau;
+        const auto& delta = ctx.delta;
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
-        if (getbaseval(delta) == 0) {
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau - powi(delta, l_i[i]) - pow(tau, m[i]))*powi(delta, static_cast<int>(d[i]));
+                r = r + n[i] * exp(t[i] * lntau - ctx.powdelta(l_i[i]) - pow(tau, m[i]))*powi(delta, static_cast<int>(d[i]));
             }
         }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
-                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - powi(delta, l_i[i]) - pow(tau, m[i]));
+                r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - ctx.powdelta(l_i[i]) - pow(tau, m[i]));
             }
         }
         return forceeval(r);
     }
+
+    /// \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double r = 0.0, lntau = log(tau), lndelta = (delta == 0) ? 0.0 : log(delta);
+        for (auto i = 0; i < n.size(); ++i) {
+            auto aT = analytic::power_coeffs<iT>(1.0, m[i], tau);
+            auto aD = analytic::power_coeffs<iD>(1.0, l_i[i], delta);
+            double h = -powi(delta, l_i[i]) - pow(tau, m[i]);
+            r += analytic::summand(n[i], t[i], d[i], lntau, delta, lndelta, h) * analytic::scaled_derivs<iT>(t[i], aT)[iT] * analytic::scaled_derivs<iD>(d[i], aD)[iD];
+        }
+        return r;
+    }
 };
 
 /**
@@ -207,19 +787,60 @@ class GaoBEOSTerm {
 public:
     Eigen::ArrayXd n, t, d, eta, beta, gamma, epsilon, b;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const GaoBEOSTerm& other) {
+        append_coeffs(n, other.n);
+        append_coeffs(t, other.t);
+        append_coeffs(d, other.d);
+        append_coeffs(eta, other.eta);
+        append_coeffs(beta, other.beta);
+        append_coeffs(gamma, other.gamma);
+        append_coeffs(epsilon, other.epsilon);
+        append_coeffs(b, other.b);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
+        return alphar(ReducedStateContext<TauType, DeltaType>(tau, delta));
+    }
+
+    /// The factors of the terms that only depend on tau, see TauFactorCache
+    void tau_factors(const double tau, const double lntau, Eigen::ArrayXd& F) const {
+        F = n * exp(t * lntau + 1.0 / (beta * (tau - gamma).square() + b));
+    }
+
+    /// alphar from the tau factors F of tau_factors
+    template<typename TauType, typename DeltaType>
+    auto alphar_tau_factored(const Eigen::ArrayXd& F, const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        const auto& delta = ctx.delta;
+        if constexpr (std::is_same_v<std::common_type_t<TauType, DeltaType>, double>) {
+            if (!ctx.delta_is_zero) {
+                const double lndelta = ctx.lndelta;
+                return static_cast<double>((F * exp(d * lndelta - eta * (delta - epsilon).square())).sum());
+            }
+        }
+        return sum_tau_factored(F, d, ctx, [&](auto i) { return forceeval(-eta[i] * (delta - epsilon[i]) * (delta - epsilon[i])); });
+    }
+
+    template<typename TauType, typename DeltaType>
+    auto alphar(const ReducedStateContext<TauType, DeltaType>& ctx) const {
+        if (const auto* F = cached_tau_factors(*this, ctx)) {
+            return alphar_tau_factored(*F, ctx);
+        }
+        const auto& tau = ctx.tau;
+        const auto& delta = ctx.delta;
 
         using result = std::common_type_t<TauType, DeltaType>;
-        result r = 0.0, lntau = log(tau);
+        result r = 0.0;
+        const auto& lntau = ctx.lntau;
         auto square = [](auto x) { return x * x; };
-        if (getbaseval(delta) == 0) {
+        if (ctx.delta_is_zero) {
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau - eta[i] * square(delta - epsilon[i]) + 1.0 / (beta[i] * square(tau - gamma[i]) + b[i]))*powi(delta, static_cast<int>(d[i]));
             }
         }
         else {
-            result lndelta = log(delta);
+            const auto& lndelta = ctx.lndelta;
             for (auto i = 0; i < n.size(); ++i) {
                 r = r + n[i] * exp(t[i] * lntau + d[i] * lndelta - eta[i] * square(delta - epsilon[i]) + 1.0 / (beta[i] * square(tau - gamma[i]) + b[i]));
             }
@@ -258,25 +879,39 @@ public:
         int N = static_cast<int>(c.rows()) - 1;
         constexpr int Cols = MatType::ColsAtCompileTime;
         using NumType = std::common_type_t<typename MatType::Scalar, XType>;
-        static Eigen::Array<NumType, 1, Cols> u_k, u_kp1, u_kp2;
-        // Not statically sized, need to resize
-        if constexpr (Cols == Eigen::Dynamic) {
-            int M = static_cast<int>(c.rows());
-            u_k.resize(M); 
-            u_kp1.resize(M);
-            u_kp2.resize(M);
-        }
-        u_k.setZero(); u_kp1.setZero(); u_kp2.setZero();
+        using RowType = Eigen::Array<NumType, 1, Cols>;
+        // Local buffers (not static ones, which would be shared by all the threads), of the length of a row
+        RowType u_k = RowType::Zero(c.cols()), u_kp1 = RowType::Zero(c.cols()), u_kp2 = RowType::Zero(c.cols());
         
         for (int k = N; k >= 0; --k) {
             // Do the recurrent calculation
             u_k = 2.0 * ind * u_kp1 - u_kp2 + c.row(k);
             if (k > 0) {
-                // Update the values
-                u_kp2 = u_kp1; u_kp1 = u_k;
+                // Update the values, by rotation of the buffers rather than copies
+                u_kp2.swap(u_kp1); u_kp1.swap(u_k);
             }
         }
-        return (u_k - u_kp2) / 2.0;
+        return RowType((u_k - u_kp2) / 2.0);
+    }
+
+    /**
+     Clenshaw evaluation along the rows of the matrix for all the columns at once, the recurrence is carried out on whole
+     columns, which are contiguous in memory. VecType is the column vector type used for the recurrence.
+     */
+    template<typename VecType, typename MatType, typename XType>
+    static auto Clenshaw1DByColumn(const MatType& c, const XType& ind) {
+        const auto M = c.rows();
+        VecType u_k(M), u_kp1(M), u_kp2(M);
+        u_k.setZero(); u_kp1.setZero(); u_kp2.setZero();
+        for (int k = static_cast<int>(c.cols()) - 1; k >= 0; --k) {
+            // Do the recurrent calculation
+            u_k = 2.0 * ind * u_kp1 - u_kp2 + c.col(k);
+            if (k > 0) {
+                // Update the values, by rotation of the buffers rather than copies
+                u_kp2.swap(u_kp1); u_kp1.swap(u_k);
+            }
+        }
+        return VecType((u_k - u_kp2) / 2.0);
     }
 
     /** Clenshaw evaluation of the complete expansion
@@ -292,9 +927,23 @@ public:
 
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
-        TauType x = (2.0*tau - (taumax + taumin)) / (taumax - taumin);
-        DeltaType y = (2.0*delta - (deltamax + deltamin)) / (deltamax - deltamin);
-        return forceeval(Clenshaw2DEigen(a, forceeval(x), forceeval(y)));
+        // The scaling to [-1,1] is affine, only its coefficients need a division, and they are plain doubles
+        const double xslope = 2.0 / (taumax - taumin), xoffset = (taumax + taumin) / (taumax - taumin);
+        const double yslope = 2.0 / (deltamax - deltamin), yoffset = (deltamax + deltamin) / (deltamax - deltamin);
+        const auto x = forceeval(tau * xslope - xoffset);
+        const auto y = forceeval(delta * yslope - yoffset);
+        // The recurrence in tau (the columns of a) is carried out for all the rows at once, then the one in delta;
+        // the buffers are on the stack for the usual sizes of expansion
+        using NumType = std::common_type_t<double, std::decay_t<decltype(x)>>;
+        constexpr int MaxRows = 16;
+        if (a.rows() <= MaxRows) {
+            using VecType = Eigen::Array<NumType, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>;
+            return forceeval(Clenshaw1D(Clenshaw1DByColumn<VecType>(a, x), y));
+        }
+        else {
+            using VecType = Eigen::Array<NumType, Eigen::Dynamic, 1>;
+            return forceeval(Clenshaw1D(Clenshaw1DByColumn<VecType>(a, x), y));
+        }
     }
 };
 
@@ -307,12 +956,28 @@ public:
     auto alphar(const TauType& tau, const DeltaType& delta) const {
         return static_cast<std::common_type_t<TauType, DeltaType>>(0.0);
     }
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        return 0.0;
+    }
 };
 
 class NonAnalyticEOSTerm {
 public:
     Eigen::ArrayXd A, B, C, D, a, b, beta, n;
 
+    /// Append the terms of another instance, see MergedEOSTermContainer
+    void append(const NonAnalyticEOSTerm& other) {
+        append_coeffs(A, other.A);
+        append_coeffs(B, other.B);
+        append_coeffs(C, other.C);
+        append_coeffs(D, other.D);
+        append_coeffs(a, other.a);
+        append_coeffs(b, other.b);
+        append_coeffs(beta, other.beta);
+        append_coeffs(n, other.n);
+    }
+
     template<typename TauType, typename DeltaType>
     auto alphar(const TauType& tau, const DeltaType& delta) const {
         // The non-analytic term
@@ -339,6 +1004,64 @@ public:
             return static_cast<decltype(outval)>(0.0);
         }
     }
+
+    /**
+     \f$\tau^{i}\delta^{j}\partial^{i+j}\alpha^r/\partial\tau^{i}\partial\delta^{j}\f$ in closed form for \f$i+j\leq 2\f$, from the
+     derivatives of \f$\Delta^b\f$ and \f$\psi\f$ given with IAPWS-95 (Wagner and Pruss, JPCRD, 2002); zero where they are undefined, as for alphar
+     */
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        if constexpr (iT + iD > 2) {
+            throw teqp::NotImplementedError("Only up to second derivatives are available in closed form for the non-analytic terms");
+        }
+        else {
+            const double dm1 = delta - 1.0, dm1sq = dm1 * dm1, tm1 = tau - 1.0;
+            double r = 0.0;
+            for (auto i = 0; i < n.size(); ++i) {
+                const double k = 1.0 / (2.0 * beta[i]);
+                const double theta = (1.0 - tau) + A[i] * pow(dm1sq, k);
+                const double Delta = theta * theta + B[i] * pow(dm1sq, a[i]);
+                const double Psi = exp(-C[i] * dm1sq - D[i] * tm1 * tm1);
+                const double Deltab = pow(Delta, b[i]);
+                double val = 0.0;
+                if constexpr (iT == 0 && iD == 0) {
+                    val = n[i] * Deltab * delta * Psi;
+                }
+                else {
+                    const double Psi_d = -2.0 * C[i] * dm1 * Psi, Psi_t = -2.0 * D[i] * tm1 * Psi;
+                    const double Delta_d = dm1 * (A[i] * theta * 2.0 / beta[i] * pow(dm1sq, k - 1.0) + 2.0 * B[i] * a[i] * pow(dm1sq, a[i] - 1.0));
+                    const double Deltab_d = b[i] * pow(Delta, b[i] - 1.0) * Delta_d;
+                    const double Deltab_t = -2.0 * theta * b[i] * pow(Delta, b[i] - 1.0);
+                    if constexpr (iT == 0 && iD == 1) {
+                        val = n[i] * (Deltab * (Psi + delta * Psi_d) + Deltab_d * delta * Psi) * delta;
+                    }
+                    else if constexpr (iT == 1 && iD == 0) {
+                        val = n[i] * delta * (Deltab_t * Psi + Deltab * Psi_t) * tau;
+                    }
+                    else if constexpr (iT == 0 && iD == 2) {
+                        const double Psi_dd = (2.0 * C[i] * dm1sq - 1.0) * 2.0 * C[i] * Psi;
+                        const double Delta_dd = Delta_d / dm1 + dm1sq * (4.0 * B[i] * a[i] * (a[i] - 1.0) * pow(dm1sq, a[i] - 2.0) + 2.0 * A[i] * A[i] / (beta[i] * beta[i]) * pow(pow(dm1sq, k - 1.0), 2) + A[i] * theta * 4.0 / beta[i] * (k - 1.0) * pow(dm1sq, k - 2.0));
+                        const double Deltab_dd = b[i] * (pow(Delta, b[i] - 1.0) * Delta_dd + (b[i] - 1.0) * pow(Delta, b[i] - 2.0) * Delta_d * Delta_d);
+                        val = n[i] * (Deltab * (2.0 * Psi_d + delta * Psi_dd) + 2.0 * Deltab_d * (Psi + delta * Psi_d) + Deltab_dd * delta * Psi) * delta * delta;
+                    }
+                    else if constexpr (iT == 2 && iD == 0) {
+                        const double Psi_tt = (2.0 * D[i] * tm1 * tm1 - 1.0) * 2.0 * D[i] * Psi;
+                        const double Deltab_tt = 2.0 * b[i] * pow(Delta, b[i] - 1.0) + 4.0 * theta * theta * b[i] * (b[i] - 1.0) * pow(Delta, b[i] - 2.0);
+                        val = n[i] * delta * (Deltab_tt * Psi + 2.0 * Deltab_t * Psi_t + Deltab * Psi_tt) * tau * tau;
+                    }
+                    else {
+                        const double Psi_dt = 4.0 * C[i] * D[i] * dm1 * tm1 * Psi;
+                        const double Deltab_dt = -A[i] * b[i] * 2.0 / beta[i] * pow(Delta, b[i] - 1.0) * dm1 * pow(dm1sq, k - 1.0) - 2.0 * theta * b[i] * (b[i] - 1.0) * pow(Delta, b[i] - 2.0) * Delta_d;
+                        val = n[i] * (Deltab * (Psi_t + delta * Psi_dt) + delta * Deltab_d * Psi_t + Deltab_t * (Psi + delta * Psi_d) + Deltab_dt * delta * Psi) * tau * delta;
+                    }
+                }
+                if (std::isfinite(val)) {
+                    r += val;
+                }
+            }
+            return r;
+        }
+    }
 };
 
 
@@ -358,17 +1081,132 @@ public:
 
     template <class Tau, class Delta>
     auto alphar(const Tau& tau, const Delta& delta) const {
+        return alphar(ReducedStateContext<Tau, Delta>(tau, delta));
+    }
+
+    template <class Tau, class Delta>
+    auto alphar(const ReducedStateContext<Tau, Delta>& ctx) const {
         std::common_type_t <Tau, Delta> ar = 0.0;
         for (const auto& term : coll) {
-            auto contrib = std::visit([&](auto& t) { return t.alphar(tau, delta); }, term);
+            auto contrib = std::visit([&](auto& t) { return alphar_with_context(t, ctx); }, term);
             ar = ar + contrib;
         }
         return ar;
     }
+
+    /// Sum of the closed-form derivatives of the terms, see ADBackends::analytic; throws if one of the terms does not provide them
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double ar = 0.0;
+        for (const auto& term : coll) {
+            ar += std::visit([&](auto& t) -> double {
+                if constexpr (analytic::has_alphar_taudeltaderiv<std::decay_t<decltype(t)>>::value) {
+                    return t.template alphar_taudeltaderiv<iT, iD>(tau, delta);
+                }
+                else {
+                    throw teqp::NotImplementedError("Closed-form derivatives are not available for one of the EOS terms of this model");
+                }
+            }, term);
+        }
+        return ar;
+    }
+};
+
+/// Detect whether a term can absorb another term of the same kind
+template<typename T, typename = void>
+struct has_append : std::false_type {};
+template<typename T>
+struct has_append<T, std::void_t<decltype(std::declval<T&>().append(std::declval<const T&>()))>> : std::true_type {};
+
+/**
+ A structure-of-arrays alternative to EOSTermContainer
+
+ The terms of each kind are stored in their own vector, and the terms that can be merged (all those that are
+ defined by arrays of coefficients) are merged into a single instance as they are added, so that all the power terms
+ of a fluid, for instance, are evaluated in one loop over contiguous coefficient arrays. The kind of
+ each term is resolved at compile time, there is no std::visit in the evaluation.
+ */
+template<typename... Args>
+class MergedEOSTermContainer {
+private:
+    std::tuple<std::vector<Args>...> coll;
+    std::size_t Nterms = 0;
+public:
+
+    /// The number of terms that were added, before merging
+    auto size() const { return Nterms; }
+
+    /// The terms of the given kind, for modifying their coefficients in place (after merging there is at most one instance of each kind that can be merged)
+    template<typename TermType>
+    auto& get_terms() { return std::get<std::vector<TermType>>(coll); }
+    template<typename TermType>
+    const auto& get_terms() const { return std::get<std::vector<TermType>>(coll); }
+    /// Call f with the vector of the terms of each kind in turn
+    template<typename Function>
+    void for_each_kind(const Function& f) const { std::apply([&](const auto&... terms) { (f(terms), ...); }, coll); }
+
+    /// True if the container holds nothing but NullEOSTerm, in which case alphar is identically zero
+    bool is_null() const {
+        auto null_or_empty = [](const auto& terms) {
+            using TermType = typename std::decay_t<decltype(terms)>::value_type;
+            return std::is_same_v<TermType, NullEOSTerm> || terms.empty();
+        };
+        return std::apply([&](const auto&... terms) { return (null_or_empty(terms) && ...); }, coll);
+    }
+
+    template<typename Instance>
+    auto add_term(Instance&& instance) {
+        using TermType = std::decay_t<Instance>;
+        auto& terms = std::get<std::vector<TermType>>(coll);
+        Nterms++;
+        if constexpr (has_append<TermType>::value) {
+            if (!terms.empty()) {
+                terms.front().append(instance);
+                return;
+            }
+        }
+        terms.emplace_back(instance);
+    }
+
+    template <class Tau, class Delta>
+    auto alphar(const Tau& tau, const Delta& delta) const {
+        return alphar(ReducedStateContext<Tau, Delta>(tau, delta));
+    }
+
+    template <class Tau, class Delta>
+    auto alphar(const ReducedStateContext<Tau, Delta>& ctx) const {
+        std::common_type_t <Tau, Delta> ar = 0.0;
+        auto sum = [&](const auto& terms) {
+            for (const auto& term : terms) {
+                ar = ar + alphar_with_context(term, ctx);
+            }
+        };
+        std::apply([&](const auto&... terms) { (sum(terms), ...); }, coll);
+        return ar;
+    }
+
+    /// Sum of the closed-form derivatives of the terms, see ADBackends::analytic; throws if one of the terms does not provide them
+    template<int iT, int iD>
+    double alphar_taudeltaderiv(const double tau, const double delta) const {
+        double ar = 0.0;
+        auto sum = [&](const auto& terms) {
+            using TermType = typename std::decay_t<decltype(terms)>::value_type;
+            if constexpr (analytic::has_alphar_taudeltaderiv<TermType>::value) {
+                for (const auto& term : terms) {
+                    ar += term.template alphar_taudeltaderiv<iT, iD>(tau, delta);
+                }
+            }
+            else if (!terms.empty()) {
+                throw teqp::NotImplementedError("Closed-form derivatives are not available for one of the EOS terms of this model");
+            }
+        };
+        std::apply([&](const auto&... terms) { (sum(terms), ...); }, coll);
+        return ar;
+    }
 };
 
-using EOSTerms = EOSTermContainer<JustPowerEOSTerm, PowerEOSTerm, GaussianEOSTerm, NonAnalyticEOSTerm, Lemmon2005EOSTerm, GaoBEOSTerm, ExponentialEOSTerm, DoubleExponentialEOSTerm>;
+using EOSTerms = MergedEOSTermContainer<JustPowerEOSTerm, PowerEOSTerm, GaussianEOSTerm, NonAnalyticEOSTerm, Lemmon2005EOSTerm, GaoBEOSTerm, ExponentialEOSTerm, DoubleExponentialEOSTerm>;
 
-using DepartureTerms = EOSTermContainer<JustPowerEOSTerm, PowerEOSTerm, GaussianEOSTerm, GERG2004EOSTerm, NullEOSTerm, DoubleExponentialEOSTerm,Chebyshev2DEOSTerm>;
+using DepartureTerms = MergedEOSTermContainer<JustPowerEOSTerm, PowerEOSTerm, GaussianEOSTerm, GERG2004EOSTerm, NullEOSTerm, DoubleExponentialEOSTerm,Chebyshev2DEOSTerm>;
 
 }; // namespace teqp
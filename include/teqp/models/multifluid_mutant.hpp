@@ -7,6 +7,11 @@ namespace teqp {
     This class holds a lightweight reference to the core parts of the model
 
     The reducing and departure functions are moved into this class, while the donor class is used for the corresponding states portion
+
+    The parameters of the reducing and departure functions can be overwritten in place with set_BIP, set_F and
+    modify_departure, which is much cheaper than building a new mutant, for instance in each step of a fit of
+    the interaction parameters.  No evaluation of the model may be in progress on another thread while the
+    parameters are being changed.
     */
     template<typename DepartureFunction, typename BaseClass>
     class MultiFluidAdapter {
@@ -16,14 +21,22 @@ namespace teqp {
 
     public:
         const BaseClass& base;
-        const ReducingFunctions redfunc;
-        const DepartureFunction dep;
+        ReducingFunctions redfunc;
+        DepartureFunction dep;
 
         template<class VecType>
         auto R(const VecType& molefrac) const { return base.R(molefrac); }
 
         MultiFluidAdapter(const BaseClass& base, ReducingFunctions&& redfunc, DepartureFunction&& depfunc) : base(base), redfunc(redfunc), dep(depfunc) {};
 
+        /// Overwrite the four parameters of the reducing function of the pair i<j: betaT, gammaT, betaV, gammaV (or phiT, lambdaT, phiV, lambdaV for the invariant reducing function)
+        void set_BIP(const int i, const int j, const double p1, const double p2, const double p3, const double p4) { redfunc.set_BIP(i, j, p1, p2, p3, p4); }
+        /// Overwrite the value of F of the pair i<j
+        void set_F(const int i, const int j, const double Fij) { dep.set_F(i, j, Fij); }
+        /// Overwrite the coefficients of the departure function of the pair i<j, see DepartureContribution::modify_departure
+        template<typename Function>
+        void modify_departure(const int i, const int j, const Function& f) { dep.modify_departure(i, j, f); }
+
         /// Store some sort of metadata in string form (perhaps a JSON representation of the model?)
         void set_meta(const std::string& m) { meta = m; }
         /// Get the metadata stored in string form
@@ -79,7 +92,7 @@ namespace teqp {
             auto red = model.redfunc;
             auto Tc = red.Tc, vc = red.vc;
             if (deptype == "invariant") {
-                using mat = std::decay_t<decltype(MultiFluidInvariantReducingFunction::phiT)>;
+                using mat = Eigen::MatrixXd;
                 mat phiT = mat::Zero(N, N), lambdaT = mat::Zero(N, N), phiV = mat::Zero(N, N), lambdaV = mat::Zero(N, N);
 
                 for (auto i = 0; i < N; ++i) {
@@ -103,7 +116,7 @@ namespace teqp {
                 return ReducingFunctions(MultiFluidInvariantReducingFunction(phiT, lambdaT, phiV, lambdaV, Tc, vc));
             }
             else {
-                using mat = std::decay_t<decltype(MultiFluidReducingFunction::betaT)>;
+                using mat = Eigen::MatrixXd;
                 mat betaT = mat::Zero(N, N), gammaT = mat::Zero(N, N), betaV = mat::Zero(N, N), gammaV = mat::Zero(N, N);
 
                 for (auto i = 0; i < N; ++i) {
@@ -162,9 +162,16 @@ namespace teqp {
     class MultiFluidReducingFunction {
     private:
         Eigen::MatrixXd YT, Yv;
+        Eigen::MatrixXd betaT, gammaT, betaV, gammaV;
+
+        void update_Y(const Eigen::Index i, const Eigen::Index j) {
+            YT(i, j) = betaT(i, j) * gammaT(i, j) * sqrt(Tc[i] * Tc[j]);
+            YT(j, i) = betaT(j, i) * gammaT(j, i) * sqrt(Tc[i] * Tc[j]);
+            Yv(i, j) = 1.0 / 8.0 * betaV(i, j) * gammaV(i, j) * pow3(cbrt(vc[i]) + cbrt(vc[j]));
+            Yv(j, i) = 1.0 / 8.0 * betaV(j, i) * gammaV(j, i) * pow3(cbrt(vc[i]) + cbrt(vc[j]));
+        }
 
     public:
-        const Eigen::MatrixXd betaT, gammaT, betaV, gammaV;
         const Eigen::ArrayXd Tc, vc;
 
         template<typename ArrayLike>
@@ -180,14 +187,28 @@ namespace teqp {
             Yv.resize(N, N); Yv.setZero();
             for (auto i = 0; i < N; ++i) {
                 for (auto j = i + 1; j < N; ++j) {
-                    YT(i, j) = betaT(i, j) * gammaT(i, j) * sqrt(Tc[i] * Tc[j]);
-                    YT(j, i) = betaT(j, i) * gammaT(j, i) * sqrt(Tc[i] * Tc[j]);
-                    Yv(i, j) = 1.0 / 8.0 * betaV(i, j) * gammaV(i, j) * pow3(cbrt(vc[i]) + cbrt(vc[j]));
-                    Yv(j, i) = 1.0 / 8.0 * betaV(j, i) * gammaV(j, i) * pow3(cbrt(vc[i]) + cbrt(vc[j]));
+                    update_Y(i, j);
                 }
             }
         }
 
+        const auto& get_betaT() const { return betaT; }
+        const auto& get_gammaT() const { return gammaT; }
+        const auto& get_betaV() const { return betaV; }
+        const auto& get_gammaV() const { return gammaV; }
+
+        /// Overwrite the parameters of the pair i<j in place (those of j,i follow from them); no allocation takes place
+        void set_BIP(const Eigen::Index i, const Eigen::Index j, const double betaT_, const double gammaT_, const double betaV_, const double gammaV_) {
+            if (i < 0 || j >= Tc.size() || i >= j) {
+                throw teqp::InvalidArgument("Indices must satisfy 0 <= i < j < " + std::to_string(Tc.size()));
+            }
+            betaT(i, j) = betaT_; betaT(j, i) = 1.0 / betaT_;
+            betaV(i, j) = betaV_; betaV(j, i) = 1.0 / betaV_;
+            gammaT(i, j) = gammaT_; gammaT(j, i) = gammaT_;
+            gammaV(i, j) = gammaV_; gammaV(j, i) = gammaV_;
+            update_Y(i, j);
+        }
+
         template <typename MoleFractions>
         auto Y(const MoleFractions& z, const Eigen::ArrayXd& Yc, const Eigen::MatrixXd& beta, const Eigen::MatrixXd& Yij) const {
 
@@ -207,16 +228,54 @@ namespace teqp {
             return forceeval(sum1 + sum2);
         }
 
+        /**
+         Y, with its gradient g and Hessian H w.r.t. the mole fractions in closed form; g and H must be of size N and N x N.
+         Each pair term is \f$c\,u/D\f$ with \f$u = z_iz_j(z_i+z_j)\f$ and \f$D = \beta_{ij}^2z_i+z_j\f$, so that only the
+         entries (i,i), (i,j), (j,i) and (j,j) of H get a contribution from the pair i<j
+         */
+        void Y_gradHessian(const Eigen::ArrayXd& z, const Eigen::ArrayXd& Yc, const Eigen::MatrixXd& beta, const Eigen::MatrixXd& Yij, double& Y, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const {
+            auto N = z.size();
+            Y = 0.0; g.setZero(); H.setZero();
+            for (auto i = 0; i < N; ++i) {
+                Y += pow2(z[i]) * Yc[i];
+                g[i] += 2.0 * z[i] * Yc[i];
+                H(i, i) += 2.0 * Yc[i];
+            }
+            for (auto i = 0; i < N - 1; ++i) {
+                for (auto j = i + 1; j < N; ++j) {
+                    const double c = 2.0 * Yij(i, j), b = pow2(beta(i, j)), zi = z[i], zj = z[j];
+                    const double D = b * zi + zj;
+                    if (D == 0.0) { continue; } // Both mole fractions are zero, the term and its derivatives are taken to be zero
+                    const double u = zi * zj * (zi + zj), ui = 2.0 * zi * zj + zj * zj, uj = zi * zi + 2.0 * zi * zj;
+                    const double uii = 2.0 * zj, uij = 2.0 * (zi + zj), ujj = 2.0 * zi;
+                    const double D2 = D * D, D3 = D2 * D;
+                    Y += c * u / D;
+                    g[i] += c * (ui / D - u * b / D2);
+                    g[j] += c * (uj / D - u / D2);
+                    H(i, i) += c * (uii / D - 2.0 * ui * b / D2 + 2.0 * u * b * b / D3);
+                    const double Hij = c * (uij / D - (ui + uj * b) / D2 + 2.0 * u * b / D3);
+                    H(i, j) += Hij; H(j, i) += Hij;
+                    H(j, j) += c * (ujj / D - 2.0 * uj / D2 + 2.0 * u / D3);
+                }
+            }
+        }
+
         template<typename MoleFractions> auto get_Tr(const MoleFractions& molefracs) const { return Y(molefracs, Tc, betaT, YT); }
         template<typename MoleFractions> auto get_rhor(const MoleFractions& molefracs) const { return 1.0 / Y(molefracs, vc, betaV, Yv); }
+
+        /// The reducing temperature, with its gradient and Hessian w.r.t. the mole fractions
+        void get_Tr_gradHessian(const Eigen::ArrayXd& molefracs, double& Tr, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const { Y_gradHessian(molefracs, Tc, betaT, YT, Tr, g, H); }
+        /// The reducing molar volume \f$1/\rho_r\f$, with its gradient and Hessian w.r.t. the mole fractions
+        void get_vr_gradHessian(const Eigen::ArrayXd& molefracs, double& vr, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const { Y_gradHessian(molefracs, vc, betaV, Yv, vr, g, H); }
     };
 
     class MultiFluidInvariantReducingFunction {
     private:
         Eigen::MatrixXd YT, Yv;
 
+        Eigen::MatrixXd phiT, lambdaT, phiV, lambdaV;
+
     public:
-        const Eigen::MatrixXd phiT, lambdaT, phiV, lambdaV;
         const Eigen::ArrayXd Tc, vc;
 
         template<typename ArrayLike>
@@ -239,6 +298,22 @@ namespace teqp {
                 }
             }
         }
+        const auto& get_phiT() const { return phiT; }
+        const auto& get_lambdaT() const { return lambdaT; }
+        const auto& get_phiV() const { return phiV; }
+        const auto& get_lambdaV() const { return lambdaV; }
+
+        /// Overwrite the parameters of the pair i<j in place (those of j,i follow from them); no allocation takes place
+        void set_BIP(const Eigen::Index i, const Eigen::Index j, const double phiT_, const double lambdaT_, const double phiV_, const double lambdaV_) {
+            if (i < 0 || j >= Tc.size() || i >= j) {
+                throw teqp::InvalidArgument("Indices must satisfy 0 <= i < j < " + std::to_string(Tc.size()));
+            }
+            phiT(i, j) = phiT_; phiT(j, i) = phiT_;
+            lambdaT(i, j) = lambdaT_; lambdaT(j, i) = -lambdaT_;
+            phiV(i, j) = phiV_; phiV(j, i) = phiV_;
+            lambdaV(i, j) = lambdaV_; lambdaV(j, i) = -lambdaV_;
+        }
+
         template <typename MoleFractions>
         auto Y(const MoleFractions& z, const Eigen::MatrixXd& phi, const Eigen::MatrixXd& lambda, const Eigen::MatrixXd& Yij) const {
             auto N = z.size();
@@ -251,15 +326,45 @@ namespace teqp {
             }
             return sum;
         }
+
+        /**
+         Y, with its gradient g and Hessian H w.r.t. the mole fractions in closed form; g and H must be of size N and N x N.
+         With \f$P_{ij} = \phi_{ij}Y_{ij}\f$ and \f$L_{ij} = \lambda_{ij}Y_{ij}\f$, \f$Y = \sum_{ij} z_iz_jP_{ij} + \sum_{ij} z_iz_j^2L_{ij}\f$
+         */
+        void Y_gradHessian(const Eigen::ArrayXd& z, const Eigen::MatrixXd& phi, const Eigen::MatrixXd& lambda, const Eigen::MatrixXd& Yij, double& Y, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const {
+            auto N = z.size();
+            Y = 0.0; g.setZero(); H.setZero();
+            for (auto k = 0; k < N; ++k) {
+                double Lz = 0.0; // sum_i L_ik z_i
+                for (auto i = 0; i < N; ++i) {
+                    Lz += lambda(i, k) * Yij(i, k) * z[i];
+                }
+                for (auto l = 0; l < N; ++l) {
+                    const double Pkl = phi(k, l) * Yij(k, l), Plk = phi(l, k) * Yij(l, k);
+                    const double Lkl = lambda(k, l) * Yij(k, l), Llk = lambda(l, k) * Yij(l, k);
+                    Y += z[k] * z[l] * (Pkl + z[l] * Lkl);
+                    g[k] += (Pkl + Plk) * z[l] + Lkl * z[l] * z[l];
+                    H(k, l) += Pkl + Plk + 2.0 * Lkl * z[l] + 2.0 * z[k] * Llk;
+                }
+                g[k] += 2.0 * z[k] * Lz;
+                H(k, k) += 2.0 * Lz;
+            }
+        }
+
         template<typename MoleFractions> auto get_Tr(const MoleFractions& molefracs) const { return Y(molefracs, phiT, lambdaT, YT); }
         template<typename MoleFractions> auto get_rhor(const MoleFractions& molefracs) const { return 1.0 / Y(molefracs, phiV, lambdaV, Yv); }
+
+        /// The reducing temperature, with its gradient and Hessian w.r.t. the mole fractions
+        void get_Tr_gradHessian(const Eigen::ArrayXd& molefracs, double& Tr, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const { Y_gradHessian(molefracs, phiT, lambdaT, YT, Tr, g, H); }
+        /// The reducing molar volume \f$1/\rho_r\f$, with its gradient and Hessian w.r.t. the mole fractions
+        void get_vr_gradHessian(const Eigen::ArrayXd& molefracs, double& vr, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const { Y_gradHessian(molefracs, phiV, lambdaV, Yv, vr, g, H); }
     };
 
 
     template<typename... Args>
     class ReducingTermContainer {
     private:
-        const std::variant<Args...> term;
+        std::variant<Args...> term;
         auto get_Tc() const { return std::visit([](const auto& t) { return std::cref(t.Tc); }, term); }
         auto get_vc() const { return std::visit([](const auto& t) { return std::cref(t.vc); }, term); }
     public:
@@ -268,6 +373,14 @@ namespace teqp {
         template<typename Instance>
         ReducingTermContainer(const Instance& instance) : term(instance), Tc(get_Tc()), vc(get_vc()) {}
 
+        /// The reducing function that is held, as a variant
+        const auto& get_term() const { return term; }
+
+        /// Overwrite the four interaction parameters of the pair i<j of whichever reducing function is held
+        void set_BIP(const Eigen::Index i, const Eigen::Index j, const double p1, const double p2, const double p3, const double p4) {
+            std::visit([&](auto& t) { t.set_BIP(i, j, p1, p2, p3, p4); }, term);
+        }
+
         template <typename MoleFractions>
         auto get_Tr(const MoleFractions& molefracs) const {
             return std::visit([&](auto& t) { return t.get_Tr(molefracs); }, term);
@@ -277,6 +390,16 @@ namespace teqp {
         auto get_rhor(const MoleFractions& molefracs) const {
             return std::visit([&](auto& t) { return t.get_rhor(molefracs); }, term);
         }
+
+        /// The reducing temperature, with its gradient and Hessian w.r.t. the mole fractions, which must be of size N and N x N
+        void get_Tr_gradHessian(const Eigen::ArrayXd& molefracs, double& Tr, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const {
+            std::visit([&](auto& t) { t.get_Tr_gradHessian(molefracs, Tr, g, H); }, term);
+        }
+
+        /// The reducing molar volume \f$1/\rho_r\f$, with its gradient and Hessian w.r.t. the mole fractions, which must be of size N and N x N
+        void get_vr_gradHessian(const Eigen::ArrayXd& molefracs, double& vr, Eigen::ArrayXd& g, Eigen::MatrixXd& H) const {
+            std::visit([&](auto& t) { t.get_vr_gradHessian(molefracs, vr, g, H); }, term);
+        }
     };
 
     using ReducingFunctions = ReducingTermContainer<MultiFluidReducingFunction, MultiFluidInvariantReducingFunction>;
@@ -13,6 +13,7 @@
 #include "teqp/json_tools.hpp"
 #include "teqp/models/saft/polar_terms.hpp"
 #include <optional>
+#include <array>
 
 namespace teqp {
 namespace PCSAFT {
@@ -83,22 +84,61 @@ auto C2(const Eta& eta, Mbar mbar) {
         + (1.0 - mbar) * (2.0 * eta * eta * eta + 12.0 * eta * eta - 48.0 * eta + 40.0) / pow((1.0 - eta) * (2.0 - eta), 3)
         ));
 }
+namespace internal{
+    /// Universal constants of Eqn. A.18, indexed as a[k][i] for the i-th power of eta
+    constexpr std::array<std::array<double, 7>, 3> a_coeffs = {{
+        {0.9105631445, 0.6361281449, 2.6861347891, -26.547362491, 97.759208784, -159.59154087, 91.297774084},
+        {-0.3084016918, 0.1860531159, -2.5030047259, 21.419793629, -65.255885330, 83.318680481, -33.746922930},
+        {-0.0906148351, 0.4527842806, 0.5962700728, -1.7241829131, -4.1302112531, 13.776631870, -8.6728470368}
+    }};
+    /// Universal constants of Eqn. A.19, indexed as b[k][i] for the i-th power of eta
+    constexpr std::array<std::array<double, 7>, 3> b_coeffs = {{
+        {0.7240946941, 2.2382791861, -4.0025849485, -21.003576815, 26.855641363, 206.55133841, -355.60235612},
+        {-0.5755498075, 0.6995095521, 3.8925673390, -17.215471648, 192.67226447, -161.82646165, -165.20769346},
+        {0.0976883116, -0.2557574982, -9.1558561530, 20.642075974, -38.804430052, 93.626774077, -29.666905585}
+    }};
+
+    /**
+    Evaluate I = sum_i (c0_i + f1*c1_i + f2*c2_i)*eta^i and eta*dI/deta as three polynomials in eta
+    with constant coefficients, so that no array of the coefficients in mbar needs to be built
+    */
+    template <typename Eta, typename MbarType>
+    auto I_and_etadIdeta(const std::array<std::array<double, 7>, 3>& c, const Eta& eta, const MbarType& mbar) {
+        auto f1 = forceeval((mbar - 1.0) / mbar);
+        auto f2 = forceeval(f1 * (mbar - 2.0) / mbar);
+        std::array<Eta, 3> P, etadP;
+        for (std::size_t k = 0; k < 3; ++k) {
+            // Horner's method, from the highest power down
+            Eta p = c[k][6], q = 7.0*c[k][6];
+            for (int i = 5; i >= 0; --i) {
+                p = p*eta + c[k][i];
+                q = q*eta + (i + 1.0)*c[k][i];
+            }
+            P[k] = p; etadP[k] = q;
+        }
+        return std::make_tuple(forceeval(P[0] + f1*P[1] + f2*P[2]), forceeval(etadP[0] + f1*etadP[1] + f2*etadP[2]));
+    }
+}
+
 /// Eqn. A.18
 template<typename TYPE>
 auto get_a(TYPE mbar) {
-    static Eigen::ArrayXd a_0 = (Eigen::ArrayXd(7) << 0.9105631445, 0.6361281449, 2.6861347891, -26.547362491, 97.759208784, -159.59154087, 91.297774084).finished();
-    static Eigen::ArrayXd a_1 = (Eigen::ArrayXd(7) << -0.3084016918, 0.1860531159, -2.5030047259, 21.419793629, -65.255885330, 83.318680481, -33.746922930).finished();
-    static Eigen::ArrayXd a_2 = (Eigen::ArrayXd(7) << -0.0906148351, 0.4527842806, 0.5962700728, -1.7241829131, -4.1302112531, 13.776631870, -8.6728470368).finished();
-    return forceeval(a_0.cast<TYPE>().array() + ((mbar - 1.0) / mbar) * a_1.cast<TYPE>().array() + ((mbar - 1.0) / mbar * (mbar - 2.0) / mbar) * a_2.cast<TYPE>().array()).eval();
+    const auto& c = internal::a_coeffs;
+    Eigen::ArrayX<TYPE> a(7);
+    for (std::size_t i = 0; i < 7; ++i) {
+        a[i] = c[0][i] + ((mbar - 1.0) / mbar) * c[1][i] + ((mbar - 1.0) / mbar * (mbar - 2.0) / mbar) * c[2][i];
+    }
+    return a;
 }
 /// Eqn. A.19
 template<typename TYPE>
 auto get_b(TYPE mbar) {
-    // See https://stackoverflow.com/a/35170514/1360263
-    static Eigen::ArrayXd b_0 = (Eigen::ArrayXd(7) << 0.7240946941, 2.2382791861, -4.0025849485, -21.003576815, 26.855641363, 206.55133841, -355.60235612).finished();
-    static Eigen::ArrayXd b_1 = (Eigen::ArrayXd(7) << -0.5755498075, 0.6995095521, 3.8925673390, -17.215471648, 192.67226447, -161.82646165, -165.20769346).finished();
-    static Eigen::ArrayXd b_2 = (Eigen::ArrayXd(7) << 0.0976883116, -0.2557574982, -9.1558561530, 20.642075974, -38.804430052, 93.626774077, -29.666905585).finished();
-    return forceeval(b_0.cast<TYPE>().array() + (mbar - 1.0) / mbar * b_1.cast<TYPE>().array() + (mbar - 1.0) / mbar * (mbar - 2.0) / mbar * b_2.cast<TYPE>().array()).eval();
+    const auto& c = internal::b_coeffs;
+    Eigen::ArrayX<TYPE> b(7);
+    for (std::size_t i = 0; i < 7; ++i) {
+        b[i] = c[0][i] + (mbar - 1.0) / mbar * c[1][i] + (mbar - 1.0) / mbar * (mbar - 2.0) / mbar * c[2][i];
+    }
+    return b;
 }
 /// Residual contribution to alphar from hard-sphere (Eqn. A.6)
 template<typename VecType>
@@ -126,26 +166,12 @@ auto gij_HS(const zVecType& zeta, const dVecType& d,
 /// Eqn. A.16, Eqn. A.29
 template <typename Eta, typename MbarType>
 auto get_I1(const Eta& eta, MbarType mbar) {
-    auto avec = get_a(mbar);
-    Eta summer_I1 = 0.0, summer_etadI1deta = 0.0;
-    for (std::size_t i = 0; i < 7; ++i) {
-        auto increment = avec(i) * powi(eta, static_cast<int>(i));
-        summer_I1 = summer_I1 + increment;
-        summer_etadI1deta = summer_etadI1deta + increment * (i + 1.0);
-    }
-    return std::make_tuple(forceeval(summer_I1), forceeval(summer_etadI1deta));
+    return internal::I_and_etadIdeta(internal::a_coeffs, eta, mbar);
 }
 /// Eqn. A.17, Eqn. A.30
 template <typename Eta, typename MbarType>
 auto get_I2(const Eta& eta, MbarType mbar) {
-    auto bvec = get_b(mbar);
-    Eta summer_I2 = 0.0 * eta, summer_etadI2deta = 0.0 * eta;
-    for (std::size_t i = 0; i < 7; ++i) {
-        auto increment = bvec(i) * powi(eta, static_cast<int>(i));
-        summer_I2 = summer_I2 + increment;
-        summer_etadI2deta = summer_etadI2deta + increment * (i + 1.0);
-    }
-    return std::make_tuple(forceeval(summer_I2), forceeval(summer_etadI2deta));
+    return internal::I_and_etadIdeta(internal::b_coeffs, eta, mbar);
 }
 
 /**
@@ -192,10 +218,49 @@ protected:
         sigma_Angstrom, ///<
         epsilon_over_k; ///< depth of pair potential divided by Boltzman constant
     const Eigen::ArrayXXd kmat; ///< binary interaction parameter matrix
+    const Eigen::MatrixXd m2_eps_sigma3, ///< m_i*m_j*(eps_ij/k)*sigma_ij^3, the coefficients of the double sum in Eq. A.12
+        m2_eps2_sigma3; ///< m_i*m_j*(eps_ij/k)^2*sigma_ij^3, the coefficients of the double sum in Eq. A.13
+
+    /// Build the composition- and temperature-independent pair table m_i*m_j*(eps_ij/k)^power*sigma_ij^3 with the combining rules of Eq. A.5
+    static Eigen::MatrixXd build_pair_table(const Eigen::ArrayXd& m, const Eigen::ArrayXd& sigma_Angstrom, const Eigen::ArrayXd& epsilon_over_k, const Eigen::ArrayXXd& kmat, int power) {
+        auto N = m.size();
+        Eigen::MatrixXd M(N, N);
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = 0; j < N; ++j) {
+                auto sigma_ij = 0.5 * sigma_Angstrom[i] + 0.5 * sigma_Angstrom[j];
+                auto eij_over_k = sqrt(epsilon_over_k[i] * epsilon_over_k[j]) * (1.0 - kmat(i, j));
+                M(i, j) = m[i] * m[j] * powi(eij_over_k, power) * sigma_ij * sigma_ij * sigma_ij;
+            }
+        }
+        return M;
+    }
+
+    /// The quadratic form x^T*M*x, as a dense matrix-vector product for double mole fractions, and over the upper triangle otherwise
+    template<typename VecType>
+    static auto quadratic_form(const Eigen::MatrixXd& M, const VecType& x) {
+        using X = std::decay_t<decltype(x[0])>;
+        if constexpr (std::is_same_v<X, double>) {
+            const Eigen::VectorXd xv = x.matrix();
+            return xv.dot(M * xv);
+        }
+        else {
+            X summer = 0.0;
+            for (auto i = 0; i < M.rows(); ++i) {
+                X row = M(i, i) * x[i];
+                for (auto j = i + 1; j < M.cols(); ++j) {
+                    row = row + 2.0 * M(i, j) * x[j];
+                }
+                summer = summer + x[i] * row;
+            }
+            return forceeval(summer);
+        }
+    }
 
 public:
     PCSAFTHardChainContribution(const Eigen::ArrayX<double> &m, const Eigen::ArrayX<double> &mminus1, const Eigen::ArrayX<double> &sigma_Angstrom, const Eigen::ArrayX<double> &epsilon_over_k, const Eigen::ArrayXXd &kmat)
-    : m(m), mminus1(mminus1), sigma_Angstrom(sigma_Angstrom), epsilon_over_k(epsilon_over_k), kmat(kmat) {}
+    : m(m), mminus1(mminus1), sigma_Angstrom(sigma_Angstrom), epsilon_over_k(epsilon_over_k), kmat(kmat),
+      m2_eps_sigma3(build_pair_table(m, sigma_Angstrom, epsilon_over_k, kmat, 1)),
+      m2_eps2_sigma3(build_pair_table(m, sigma_Angstrom, epsilon_over_k, kmat, 2)) {}
     
     PCSAFTHardChainContribution& operator=( const PCSAFTHardChainContribution& ) = delete; // non copyable
     
@@ -211,19 +276,13 @@ public:
         using TRHOType = std::common_type_t<std::decay_t<TTYPE>, std::decay_t<RhoType>, std::decay_t<decltype(mole_fractions[0])>, std::decay_t<decltype(m[0])>>;
         
         SAFTCalc<TTYPE, TRHOType> c;
-        c.m2_epsilon_sigma3_bar = static_cast<TRHOType>(0.0);
-        c.m2_epsilon2_sigma3_bar = static_cast<TRHOType>(0.0);
         c.d.resize(N);
         for (std::size_t i = 0; i < N; ++i) {
             c.d[i] = sigma_Angstrom[i]*(1.0 - 0.12 * exp(-3.0*epsilon_over_k[i]/T)); // [A]
-            for (std::size_t j = 0; j < N; ++j) {
-                // Eq. A.5
-                auto sigma_ij = 0.5 * sigma_Angstrom[i] + 0.5 * sigma_Angstrom[j];
-                auto eij_over_k = sqrt(epsilon_over_k[i] * epsilon_over_k[j]) * (1.0 - kmat(i,j));
-                c.m2_epsilon_sigma3_bar = c.m2_epsilon_sigma3_bar + mole_fractions[i] * mole_fractions[j] * m[i] * m[j] * eij_over_k / T * pow(sigma_ij, 3);
-                c.m2_epsilon2_sigma3_bar = c.m2_epsilon2_sigma3_bar + mole_fractions[i] * mole_fractions[j] * m[i] * m[j] * pow(eij_over_k / T, 2) * pow(sigma_ij, 3);
-            }
         }
+        // Eqs. A.12 and A.13 with the pair tables of Eq. A.5; the temperature only scales the sums
+        c.m2_epsilon_sigma3_bar = forceeval(quadratic_form(m2_eps_sigma3, mole_fractions) / T);
+        c.m2_epsilon2_sigma3_bar = forceeval(quadratic_form(m2_eps2_sigma3, mole_fractions) / (T * T));
         auto mbar = (mole_fractions.template cast<TRHOType>().array()*m.template cast<TRHOType>().array()).sum();
         
         /// Convert from molar density to number density in molecules/Angstrom^3
@@ -287,6 +346,7 @@ protected:
         sigma_Angstrom, ///< 
         epsilon_over_k; ///< depth of pair potential divided by Boltzman constant
     std::vector<std::string> names;
+    std::vector<SAFTCoeffs> source_coeffs; ///< The coefficients the model was built from
     Eigen::ArrayXXd kmat; ///< binary interaction parameter matrix
     
     PCSAFTHardChainContribution hardchain;
@@ -357,7 +417,7 @@ protected:
     }
 public:
     PCSAFTMixture(const std::vector<std::string> &names, const Eigen::ArrayXXd& kmat = {}) : PCSAFTMixture(get_coeffs_from_names(names), kmat){};
-    PCSAFTMixture(const std::vector<SAFTCoeffs> &coeffs, const Eigen::ArrayXXd &kmat = {}) : kmat(kmat), hardchain(build_hardchain(coeffs)), dipolar(build_dipolar(coeffs)), quadrupolar(build_quadrupolar(coeffs)) {};
+    PCSAFTMixture(const std::vector<SAFTCoeffs> &coeffs, const Eigen::ArrayXXd &kmat = {}) : source_coeffs(coeffs), kmat(kmat), hardchain(build_hardchain(coeffs)), dipolar(build_dipolar(coeffs)), quadrupolar(build_quadrupolar(coeffs)) {};
     
 //    PCSAFTMixture( const PCSAFTMixture& ) = delete; // non construction-copyable
     PCSAFTMixture& operator=( const PCSAFTMixture& ) = delete; // non copyable
@@ -366,6 +426,8 @@ public:
     auto get_sigma_Angstrom() const { return sigma_Angstrom; }
     auto get_epsilon_over_k_K() const { return epsilon_over_k; }
     auto get_kmat() const { return kmat; }
+    /// The coefficients of the components, including the polar ones, as they were given to the constructor (or looked up in the library)
+    const auto& get_coeffs() const { return source_coeffs; }
 
     auto print_info() {
         std::string s = std::string("i m sigma / A e/kB / K \n  ++++++++++++++") + "\n";
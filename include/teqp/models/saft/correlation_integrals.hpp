@@ -49,9 +49,9 @@ public:
     auto get_J(const TType& Tstar, const RhoType& rhostar) const{
         double Z_1 = 0.3 + 0.05*n;
         double Z_2 = 1.0/n;
-        RhoType A_0 = a00 + a10*rhostar + a20*rhostar*rhostar + a30*rhostar*rhostar*rhostar;
-        RhoType A_1 = a01 + a11*rhostar + a21*rhostar*rhostar + a31*rhostar*rhostar*rhostar;
-        RhoType A_2 = a02 + a12*rhostar + a22*rhostar*rhostar + a32*rhostar*rhostar*rhostar;
+        RhoType A_0 = a00 + rhostar*(a10 + rhostar*(a20 + rhostar*a30));
+        RhoType A_1 = a01 + rhostar*(a11 + rhostar*(a21 + rhostar*a31));
+        RhoType A_2 = a02 + rhostar*(a12 + rhostar*(a22 + rhostar*a32));
         std::common_type_t<TType, RhoType> out = (A_0 + A_1*pow(Tstar, Z_1) + A_2*pow(Tstar, Z_2))*exp(1.0/(Tstar + 4.0/pow(differentiable_abs(log(forceeval(rhostar/sqrt(2.0)))), 3.0)));
         return out;
     }
@@ -80,14 +80,16 @@ public:
     
     template<typename TType, typename RhoType>
     auto get_K(const TType& Tstar, const RhoType& rhostar) const{
-        double Z_1 = 2.0;
-        double Z_2 = 3.0;
-        double Z_3 = 4.0;
-        RhoType b_0 = a00 + a10*rhostar + a20*rhostar*rhostar + a30*rhostar*rhostar*rhostar;
-        RhoType b_1 = a01 + a11*rhostar + a21*rhostar*rhostar + a31*rhostar*rhostar*rhostar;
-        RhoType b_2 = a02 + a12*rhostar + a22*rhostar*rhostar + a32*rhostar*rhostar*rhostar;
-        RhoType b_3 = a03 + a13*rhostar + a23*rhostar*rhostar + a33*rhostar*rhostar*rhostar;
-        std::common_type_t<TType, RhoType> out = b_0 + b_1*Tstar + b_2*pow(exp(pow(1.0-rhostar/sqrt(2.0),Z_3)), Z_1) + b_3*pow(exp(pow(1.0-rhostar/sqrt(2.0),Z_3)), Z_2);
+        RhoType b_0 = a00 + rhostar*(a10 + rhostar*(a20 + rhostar*a30));
+        RhoType b_1 = a01 + rhostar*(a11 + rhostar*(a21 + rhostar*a31));
+        RhoType b_2 = a02 + rhostar*(a12 + rhostar*(a22 + rhostar*a32));
+        RhoType b_3 = a03 + rhostar*(a13 + rhostar*(a23 + rhostar*a33));
+        // exp((1-rho*/sqrt(2))^Z_3) with Z_3 = 4, raised to the powers Z_1 = 2 and Z_2 = 3
+        RhoType u = 1.0-rhostar/sqrt(2.0);
+        RhoType u2 = u*u;
+        RhoType E = exp(u2*u2);
+        RhoType E2 = E*E;
+        std::common_type_t<TType, RhoType> out = b_0 + b_1*Tstar + b_2*E2 + b_3*E2*E;
         return out;
     }
 };
@@ -140,7 +142,8 @@ public:
     
     template<typename TType, typename RhoType>
     auto get_J(const TType& Tstar, const RhoType& rhostar) const{
-        std::common_type_t<TType, RhoType> out = exp(A*rhostar*rhostar*log(Tstar) + B*rhostar*rhostar + C*rhostar*log(Tstar) + D*rhostar + E*log(Tstar) + F);
+        auto lnT = log(Tstar);
+        std::common_type_t<TType, RhoType> out = exp((A*rhostar*rhostar + C*rhostar + E)*lnT + B*rhostar*rhostar + D*rhostar + F);
         return out;
     }
 };
@@ -170,7 +173,8 @@ public:
     
     template<typename TType, typename RhoType>
     auto get_K(const TType& Tstar, const RhoType& rhostar) const{
-        std::common_type_t<TType, RhoType> out = sign_term*exp(A*rhostar*rhostar*log(Tstar) + B*rhostar*rhostar + C*rhostar*log(Tstar) + D*rhostar + E*log(Tstar) + F);
+        auto lnT = log(Tstar);
+        std::common_type_t<TType, RhoType> out = sign_term*exp((A*rhostar*rhostar + C*rhostar + E)*lnT + B*rhostar*rhostar + D*rhostar + F);
         return out;
     }
 };
@@ -229,20 +233,25 @@ public:
     
     template<typename TType, typename RhoType>
     auto get_J(const TType& Tstar, const RhoType& rhostar) const{
-        std::common_type_t<TType, RhoType> summer = 0.0;
-        for (auto i = 0; i <= 4; ++i){
-            for (auto j = 0; j <= 3; ++j){
-                auto I = 4*i + j;
-                summer += ab[I]*pow(rhostar, i)*pow(Tstar, j);
+        // Both double sums are evaluated with Horner's method, first in T* for each power of rho*,
+        // and then in rho*; the exponential is common to all the terms of the second sum
+        using result_t = std::common_type_t<TType, RhoType>;
+        result_t poly = 0.0, polyexp = 0.0;
+        for (auto i = 4; i >= 0; --i){
+            TType ci = ab[4*i+3];
+            for (auto j = 2; j >= 0; --j){
+                ci = ci*Tstar + ab[4*i+j];
             }
-        }
-        for (auto i = 0; i <= 4; ++i){
-            for (auto j = 0; j <= 2; ++j){
-                auto I = 20 + 3*i + j;
-                summer += ab[I]*pow(rhostar, i)*pow(Tstar, j)*exp(1.0/Tstar);
+            poly = poly*rhostar + ci;
+            
+            TType ei = ab[20+3*i+2];
+            for (auto j = 1; j >= 0; --j){
+                ei = ei*Tstar + ab[20+3*i+j];
             }
+            polyexp = polyexp*rhostar + ei;
         }
-        return pow(summer, n-2);
+        result_t summer = poly + polyexp*exp(1.0/Tstar);
+        return powi(summer, n-2);
     }
 };
 
@@ -367,27 +376,33 @@ public:
     
     template<typename TType, typename RhoType>
     auto get_K(const TType& Tstar, const RhoType& rhostar) const{
-        std::common_type_t<TType, RhoType> summer = 0.0;
-        int N1 = 8, N2 = 8, N3 = 24;
+        using result_t = std::common_type_t<TType, RhoType>;
+        int N1 = 8, N2 = 8;
         
-        for (auto i = 0; i <= 3; ++i){
-            for (auto j = 1; j <= 2; ++j){
-                auto I = 2*i + (j-1); // 2 entries in j for each i
-                summer += abc[I]*pow(rhostar, i)*pow(exp((1.0-rhostar/3.0)/Tstar), j);
-            }
-        }
-        for (auto i = 0; i <= 3; ++i){
-            for (auto j = 1; j <= 2; ++j){
-                auto I = N1 + 2*i + (j-1); // 2 entries in j for each i
-                summer += abc[I]*pow(rhostar, i)*pow(exp((1.0-rhostar/3.0)*(1.0-rhostar/3.0)/Tstar), j);
+        // The two exponentials are evaluated once, and their squares are obtained by multiplication
+        RhoType w = 1.0-rhostar/3.0;
+        result_t E1 = exp(w/Tstar), E2 = exp(w*w/Tstar);
+        std::array<result_t, 2> E1j = {E1, E1*E1}, E2j = {E2, E2*E2};
+        
+        // The polynomials in rho* are evaluated with Horner's method
+        result_t summer = 0.0;
+        for (auto j = 1; j <= 2; ++j){
+            RhoType p1 = abc[2*3 + (j-1)], p2 = abc[N1 + 2*3 + (j-1)]; // 2 entries in j for each i
+            for (auto i = 2; i >= 0; --i){
+                p1 = p1*rhostar + abc[2*i + (j-1)];
+                p2 = p2*rhostar + abc[N1 + 2*i + (j-1)];
             }
+            summer += p1*E1j[j-1] + p2*E2j[j-1];
         }
-        for (auto i = 0; i <= 5; ++i){
-            for (auto j = 0; j <= 3; ++j){
-                auto I = N1 + N2 + 4*i + j; // 4 entries in j for each i
-                summer += abc[I]*pow(rhostar, i)*pow(Tstar, j);
+        result_t poly = 0.0;
+        for (auto i = 5; i >= 0; --i){
+            TType ci = abc[N1 + N2 + 4*i + 3]; // 4 entries in j for each i
+            for (auto j = 2; j >= 0; --j){
+                ci = ci*Tstar + abc[N1 + N2 + 4*i + j];
             }
+            poly = poly*rhostar + ci;
         }
+        summer += poly;
         return summer;
     }
 };
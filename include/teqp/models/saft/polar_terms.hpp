@@ -11,6 +11,7 @@
 #include "teqp/exceptions.hpp"
 #include "correlation_integrals.hpp"
 #include <optional>
+#include <array>
 #include <Eigen/Dense>
 #include "teqp/math/pow_templates.hpp"
 #include <variant>
@@ -39,15 +40,125 @@ auto get_JDD_2ij(const Eta& eta, const MType& mij, const TType& Tstarij) {
     return forceeval(summer);
 }
 
+namespace internal{
+    /// Coefficients c_{0,n}, c_{1,n}, c_{2,n} of Eq. 11 from Gross and Vrabec
+    constexpr std::array<std::array<double, 5>, 3> c_JDD_3 = {{
+        {-0.0646774, 0.1975882, -0.8087562, 0.6902849, 0.0},
+        {-0.9520876, 2.9924258, -2.3802636, -0.2701261, 0.0},
+        {-0.6260979, 1.2924686, 1.6542783, -3.4396744, 0.0}
+    }};
+    /// Coefficients c_{0,n}, c_{1,n}, c_{2,n} of Eq. 13 from Gross, AICHEJ
+    constexpr std::array<std::array<double, 5>, 3> c_JQQ_3 = {{
+        {0.5000437, 6.5318692, -16.014780, 14.425970, 0.0},
+        {2.0002094, -6.7838658, 20.383246, -10.895984, 0.0},
+        {3.1358271, 7.2475888, 3.0759478, 0.0, 0.0}
+    }};
+    /// Coefficients c_{0,n}, c_{1,n} of Eq. 17 from Vrabec and Gross; there is no c_{2,n}
+    constexpr std::array<std::array<double, 4>, 3> c_JDQ_3 = {{
+        {7.846431, 33.42700, 4.689111, 0},
+        {-20.72202, -58.63904, -1.764887, 0},
+        {0, 0, 0, 0}
+    }};
+    
+    /// The polynomials sum_n c_{p,n}*eta^n for p = 0, 1, 2, which are multiplied by 1, (m-1)/m and (m-1)/m*(m-2)/m in the three-body integrals
+    template<std::size_t Nn, typename Eta>
+    auto eta_polynomials(const std::array<std::array<double, Nn>, 3>& c, const Eta& eta){
+        std::array<Eta, 3> A;
+        for (std::size_t p = 0; p < 3; ++p){
+            Eta summer = c[p][Nn-1];
+            for (int n = static_cast<int>(Nn)-2; n >= 0; --n){
+                summer = summer*eta + c[p][n];
+            }
+            A[p] = summer;
+        }
+        return A;
+    }
+    
+    /**
+    The sums S_p = sum_{ijk} a_i*b_j*c_k*g(i,j,k)*f_p(m_ijk) of the three-body terms of Gross and Vrabec, with
+    f_0 = 1, f_1 = (m-1)/m, f_2 = (m-1)/m*(m-2)/m and m_ijk = min((m_i*m_j*m_k)^{1/3}, 2)
+    
+    The integral J_ijk is a polynomial in eta whose coefficients only depend on m_ijk, so the eta dependence is
+    factored out of the triple sum, and the only work per triple is done in the types of a, b, and c. If
+    a = b = c and g is symmetric, only the triples i <= j <= k are visited and weighted by their number of permutations.
+    */
+    template<typename AType, typename BType, typename CType, typename GFunc>
+    auto three_body_m_sums(const Eigen::ArrayXd& m, const AType& a, const BType& b, const CType& c, const GFunc& g, bool symmetric){
+        using R = std::common_type_t<std::decay_t<decltype(a[0])>, std::decay_t<decltype(b[0])>, std::decay_t<decltype(c[0])>>;
+        std::array<R, 3> S; S.fill(static_cast<R>(0.0));
+        const auto N = m.size();
+        for (auto i = 0; i < N; ++i){
+            for (auto j = (symmetric ? i : 0); j < N; ++j){
+                R ab = a[i]*b[j];
+                for (auto k = (symmetric ? j : 0); k < N; ++k){
+                    double mult = 1.0;
+                    if (symmetric){
+                        mult = (i == k) ? 1.0 : ((i == j || j == k) ? 3.0 : 6.0);
+                    }
+                    double mijk = std::min(pow(m[i]*m[j]*m[k], 1.0/3.0), 2.0);
+                    double f1 = (mijk-1)/mijk, f2 = f1*(mijk-2)/mijk;
+                    double gijk = mult*g(i, j, k);
+                    R abc = ab*c[k];
+                    S[0] += abc*gijk;
+                    S[1] += abc*(gijk*f1);
+                    S[2] += abc*(gijk*f2);
+                }
+            }
+        }
+        return S;
+    }
+    
+    /// Real cube root, also of negative arguments
+    template<typename T>
+    auto real_cbrt(const T& x){
+        T out;
+        if (getbaseval(x) < 0){
+            out = -pow(-x, 1.0/3.0);
+        }
+        else{
+            out = pow(x, 1.0/3.0);
+        }
+        return out;
+    }
+    
+    /**
+    The three-body sum sum_{ijk} u_i*v_j*w_k*A_ij*B_ik*C_jk, in which each factor of the summand depends on at most two of the indices
+    
+    The transcendental work (the integrals) lives in the pair tables A, B, C, which are O(N^2) to build, while the
+    triple sum only consists of multiply-adds. The product B_ik*w_k is hoisted out of the loop over j.
+    */
+    template<typename AType, typename BType, typename CType, typename UType, typename VType, typename WType>
+    auto pair_factored_three_body_sum(const AType& A, const BType& B, const CType& C, const UType& u, const VType& v, const WType& w){
+        using BWtype = std::common_type_t<typename BType::Scalar, std::decay_t<decltype(w[0])>>;
+        using R = std::common_type_t<typename AType::Scalar, BWtype, typename CType::Scalar, std::decay_t<decltype(u[0])>, std::decay_t<decltype(v[0])>>;
+        const auto N = A.rows();
+        Eigen::ArrayXX<BWtype> Bw(N, N);
+        for (auto i = 0; i < N; ++i){
+            for (auto k = 0; k < N; ++k){
+                Bw(i, k) = B(i, k)*w[k];
+            }
+        }
+        R summer = 0.0;
+        for (auto i = 0; i < N; ++i){
+            for (auto j = 0; j < N; ++j){
+                R inner = 0.0;
+                for (auto k = 0; k < N; ++k){
+                    inner += Bw(i, k)*C(j, k);
+                }
+                summer += u[i]*v[j]*A(i, j)*inner;
+            }
+        }
+        return summer;
+    }
+}
+
 /// Eq. 11 from Gross and Vrabec
 template <typename Eta, typename MType>
 auto get_JDD_3ijk(const Eta& eta, const MType& mijk) {
-    static Eigen::ArrayXd c_0 = (Eigen::ArrayXd(5) << -0.0646774, 0.1975882, -0.8087562, 0.6902849, 0.0).finished();
-    static Eigen::ArrayXd c_1 = (Eigen::ArrayXd(5) << -0.9520876, 2.9924258, -2.3802636, -0.2701261, 0.0).finished();
-    static Eigen::ArrayXd c_2 = (Eigen::ArrayXd(5) << -0.6260979, 1.2924686, 1.6542783, -3.4396744, 0.0).finished();
+    const auto& c = internal::c_JDD_3;
     std::common_type_t<Eta, MType> summer = 0.0;
     for (auto n = 0; n < 5; ++n){
-        auto cnijk = c_0[n] + (mijk-1)/mijk*c_1[n] + (mijk-1)/mijk*(mijk-2)/mijk*c_2[n]; // Eq. 14
+        auto cnijk = c[0][n] + (mijk-1)/mijk*c[1][n] + (mijk-1)/mijk*(mijk-2)/mijk*c[2][n]; // Eq. 14
         summer += cnijk*pow(eta, n);
     }
     return forceeval(summer);
@@ -76,12 +187,10 @@ auto get_JQQ_2ij(const Eta& eta, const MType& mij, const TType& Tstarij) {
 /// Eq. 13 from Gross and Vrabec, AICHEJ
 template <typename Eta, typename MType>
 auto get_JQQ_3ijk(const Eta& eta, const MType& mijk) {
-    static Eigen::ArrayXd c_0 = (Eigen::ArrayXd(5) << 0.5000437, 6.5318692, -16.014780, 14.425970, 0.0).finished();
-    static Eigen::ArrayXd c_1 = (Eigen::ArrayXd(5) << 2.0002094, -6.7838658, 20.383246, -10.895984, 0.0).finished();
-    static Eigen::ArrayXd c_2 = (Eigen::ArrayXd(5) << 3.1358271, 7.2475888, 3.0759478, 0.0, 0.0).finished();
+    const auto& c = internal::c_JQQ_3;
     std::common_type_t<Eta, MType> summer = 0.0;
     for (auto n = 0; n < 5; ++n){
-        auto cnijk = c_0[n] + (mijk-1)/mijk*c_1[n] + (mijk-1)/mijk*(mijk-2)/mijk*c_2[n]; // Eq. 14
+        auto cnijk = c[0][n] + (mijk-1)/mijk*c[1][n] + (mijk-1)/mijk*(mijk-2)/mijk*c[2][n]; // Eq. 14
         summer += cnijk*pow(eta, n);
     }
     return forceeval(summer);
@@ -112,11 +221,10 @@ auto get_JDQ_2ij(const Eta& eta, const MType& mij, const TType& Tstarij) {
 /// Eq. 17 from Vrabec and Gross, JPCB, 2008. doi: 10.1021/jp072619u
 template <typename Eta, typename MType>
 auto get_JDQ_3ijk(const Eta& eta, const MType& mijk) {
-    static Eigen::ArrayXd c_0 = (Eigen::ArrayXd(4) << 7.846431, 33.42700, 4.689111, 0).finished();
-    static Eigen::ArrayXd c_1 = (Eigen::ArrayXd(4) << -20.72202, -58.63904, -1.764887, 0).finished();
+    const auto& c = internal::c_JDQ_3;
     std::common_type_t<Eta, MType> summer = 0.0;
     for (auto n = 0; n < 4; ++n){
-        auto cnijk = c_0[n] + (mijk-1)/mijk*c_1[n]; // Eq. 20
+        auto cnijk = c[0][n] + (mijk-1)/mijk*c[1][n]; // Eq. 20
         summer += cnijk*pow(eta, n);
     }
     return forceeval(summer);
@@ -170,23 +278,22 @@ public:
         const auto& x = mole_fractions; // concision
         const auto& sigma = sigma_Angstrom; // concision
         const auto N = mole_fractions.size();
-        std::common_type_t<TTYPE, RhoType, decltype(mole_fractions[0])> summer = 0.0;
+        // The composition and the constants are summed over the triples once for each of the eta-polynomials
+        // of Eq. 11, and the factor of 1/T^3 is common to all the terms
+        Eigen::ArrayX<std::decay_t<decltype(mole_fractions[0])>> w(N);
         for (auto i = 0; i < N; ++i){
-            for (auto j = 0; j < N; ++j){
-                for (auto k = 0; k < N; ++k){
-                    auto ninjnk = nmu[i]*nmu[j]*nmu[k];
-                    if (ninjnk > 0){
-                        // Lorentz-Berthelot mixing rules for sigma
-                        auto sigmaij = (sigma[i]+sigma[j])/2;
-                        auto sigmaik = (sigma[i]+sigma[k])/2;
-                        auto sigmajk = (sigma[j]+sigma[k])/2;
-                        
-                        auto mijk = std::min(pow(m[i]*m[j]*m[k], 1.0/3.0), 2.0);
-                        summer += x[i]*x[j]*x[k]*epsilon_over_k[i]/T*epsilon_over_k[j]/T*epsilon_over_k[k]/T*POW3(sigma[i]*sigma[j]*sigma[k])/(sigmaij*sigmaik*sigmajk)*ninjnk*mustar2[i]*mustar2[j]*mustar2[k]*get_JDD_3ijk(eta, mijk);
-                    }
-                }
-            }
+            w[i] = x[i]*epsilon_over_k[i]*nmu[i]*mustar2[i];
         }
+        auto g = [&](auto i, auto j, auto k){
+            // Lorentz-Berthelot mixing rules for sigma
+            auto sigmaij = (sigma[i]+sigma[j])/2;
+            auto sigmaik = (sigma[i]+sigma[k])/2;
+            auto sigmajk = (sigma[j]+sigma[k])/2;
+            return POW3(sigma[i]*sigma[j]*sigma[k])/(sigmaij*sigmaik*sigmajk);
+        };
+        auto S = internal::three_body_m_sums(m, w, w, w, g, true);
+        auto A = internal::eta_polynomials(internal::c_JDD_3, eta);
+        std::common_type_t<TTYPE, RhoType, decltype(mole_fractions[0])> summer = (A[0]*S[0] + A[1]*S[1] + A[2]*S[2])/(T*T*T);
         return forceeval(-4.0*POW2(static_cast<double>(EIGEN_PI))/3.0*POW2(rhoN_A3)*summer);
     }
     
@@ -262,23 +369,21 @@ public:
         const auto& x = mole_fractions; // concision
         const auto& sigma = sigma_Angstrom; // concision
         const std::size_t N = mole_fractions.size();
-        std::common_type_t<TTYPE, RhoType, decltype(mole_fractions[0])> summer = 0.0;
+        // See get_alpha3DD of DipolarContributionGrossVrabec for the factoring of the triple sum
+        Eigen::ArrayX<std::decay_t<decltype(mole_fractions[0])>> w(N);
         for (std::size_t i = 0; i < N; ++i){
-            for (std::size_t j = 0; j < N; ++j){
-                for (std::size_t k = 0; k < N; ++k){
-                    auto ninjnk = nQ[i]*nQ[j]*nQ[k];
-                    if (ninjnk > 0){
-                        // Lorentz-Berthelot mixing rules for sigma
-                        auto sigmaij = (sigma[i]+sigma[j])/2;
-                        auto sigmaik = (sigma[i]+sigma[k])/2;
-                        auto sigmajk = (sigma[j]+sigma[k])/2;
-                        
-                        auto mijk = std::min(pow(m[i]*m[j]*m[k], 1.0/3.0), 2.0);
-                        summer += x[i]*x[j]*x[k]*epsilon_over_k[i]/T*epsilon_over_k[j]/T*epsilon_over_k[k]/T*POW5(sigma[i]*sigma[j]*sigma[k])/POW3(sigmaij*sigmaik*sigmajk)*ninjnk*Qstar2[i]*Qstar2[j]*Qstar2[k]*get_JDD_3ijk(eta, mijk);
-                    }
-                }
-            }
+            w[i] = x[i]*epsilon_over_k[i]*nQ[i]*Qstar2[i];
         }
+        auto g = [&](auto i, auto j, auto k){
+            // Lorentz-Berthelot mixing rules for sigma
+            auto sigmaij = (sigma[i]+sigma[j])/2;
+            auto sigmaik = (sigma[i]+sigma[k])/2;
+            auto sigmajk = (sigma[j]+sigma[k])/2;
+            return POW5(sigma[i]*sigma[j]*sigma[k])/POW3(sigmaij*sigmaik*sigmajk);
+        };
+        auto S = internal::three_body_m_sums(m, w, w, w, g, true);
+        auto A = internal::eta_polynomials(internal::c_JDD_3, eta);
+        std::common_type_t<TTYPE, RhoType, decltype(mole_fractions[0])> summer = (A[0]*S[0] + A[1]*S[1] + A[2]*S[2])/(T*T*T);
         return forceeval(-4.0*POW2(static_cast<double>(EIGEN_PI))/3.0*POW3(3.0/4.0)*POW2(rhoN_A3)*summer);
     }
     
@@ -372,26 +477,26 @@ public:
         const auto& x = mole_fractions; // concision
         const auto& sigma = sigma_Angstrom; // concision
         const std::size_t N = mole_fractions.size();
-        std::common_type_t<TTYPE, RhoType, decltype(mole_fractions[0])> summer = 0.0;
+        // See get_alpha3DD of DipolarContributionGrossVrabec for the factoring of the triple sum; here the
+        // moments are not symmetric in i, j, k so the complete sum is carried out for each of the two polar terms
+        using XType = std::decay_t<decltype(mole_fractions[0])>;
+        Eigen::ArrayX<XType> wmu(N), wQ(N);
         for (std::size_t i = 0; i < N; ++i){
-            for (std::size_t j = 0; j < N; ++j){
-                for (std::size_t k = 0; k < N; ++k){
-                    auto ninjnk1 = nmu[i]*nmu[j]*nQ[k];
-                    auto ninjnk2 = nmu[i]*nQ[j]*nQ[k];
-                    if (ninjnk1 > 0 || ninjnk2 > 0){
-                        // Lorentz-Berthelot mixing rules for sigma
-                        auto sigmaij = (sigma[i]+sigma[j])/2;
-                        auto sigmaik = (sigma[i]+sigma[k])/2;
-                        auto sigmajk = (sigma[j]+sigma[k])/2;
-                        
-                        auto mijk = std::min(pow(m[i]*m[j]*m[k], 1.0/3.0), 2.0);
-                        double alpha_GV = 1.19374; // Table 3
-                        auto polars = ninjnk1*mustar2[i]*mustar2[j]*Qstar2[k] + ninjnk2*alpha_GV*mustar2[i]*Qstar2[j]*Qstar2[k];
-                        summer += x[i]*x[j]*x[k]*epsilon_over_k[i]/T*epsilon_over_k[j]/T*epsilon_over_k[k]/T*POW4(sigma[i]*sigma[j]*sigma[k])/POW2(sigmaij*sigmaik*sigmajk)*polars*get_JDQ_3ijk(eta, mijk);
-                    }
-                }
-            }
+            wmu[i] = x[i]*epsilon_over_k[i]*nmu[i]*mustar2[i];
+            wQ[i] = x[i]*epsilon_over_k[i]*nQ[i]*Qstar2[i];
         }
+        auto g = [&](auto i, auto j, auto k){
+            // Lorentz-Berthelot mixing rules for sigma
+            auto sigmaij = (sigma[i]+sigma[j])/2;
+            auto sigmaik = (sigma[i]+sigma[k])/2;
+            auto sigmajk = (sigma[j]+sigma[k])/2;
+            return POW4(sigma[i]*sigma[j]*sigma[k])/POW2(sigmaij*sigmaik*sigmajk);
+        };
+        double alpha_GV = 1.19374; // Table 3
+        auto S1 = internal::three_body_m_sums(m, wmu, wmu, wQ, g, false);
+        auto S2 = internal::three_body_m_sums(m, wmu, wQ, wQ, g, false);
+        auto A = internal::eta_polynomials(internal::c_JDQ_3, eta);
+        std::common_type_t<TTYPE, RhoType, decltype(mole_fractions[0])> summer = (A[0]*(S1[0] + alpha_GV*S2[0]) + A[1]*(S1[1] + alpha_GV*S2[1]))/(T*T*T);
         return forceeval(-POW2(rhoN_A3)*summer);
     }
     
@@ -644,37 +749,45 @@ public:
                     summerA_224_224_224 += leading*dbl*J15.get_J(Tstarij, rhostar);
                 }
 
-                for (std::size_t k = 0; k < N; ++k){
-                    TTYPE Tstark = forceeval(T/EPSKIJ(k,k));
-                    TTYPE Tstarik = forceeval(T/EPSKIJ(i,k));
-                    TTYPE Tstarjk = forceeval(T/EPSKIJ(j,k));
-                    double sigmaik = SIGMAIJ(i,k), sigmajk = SIGMAIJ(j,k);
-
-                    // Lorentz-Berthelot mixing rules for sigma
-                    XTtype leadingijk = forceeval(x[i]*x[j]*x[k]/(Tstari*Tstarj*Tstark));
-
-                    if (std::abs(mubar2[i]*mubar2[j]*mubar2[k]) > 0){
-                        auto K222333 = get_Kijk(K222_333, rhostar, Tstarij, Tstarik, Tstarjk);
-                        double dbl = sigma_m3[i]*sigma_m3[j]*sigma_m3[k]/(sigmaij*sigmaik*sigmajk)*mubar2[i]*mubar2[j]*mubar2[k];
-                        summerB_112_112_112 += forceeval(leadingijk*dbl*K222333);
-                    }
-                    if (std::abs(mubar2[i]*mubar2[j]*Qbar2[k]) > 0){
-                        auto K233344 = get_Kijk(K233_344, rhostar, Tstarij, Tstarik, Tstarjk);
-                        double dbl = sigma_m3[i]*sigma_m3[j]*sigma_m5[k]/(sigmaij*POW2(sigmaik*sigmajk))*mubar2[i]*mubar2[j]*Qbar2[k];
-                        summerB_112_123_123 += leadingijk*dbl*K233344;
-                    }
-                    if (std::abs(mubar2[i]*Qbar2[j]*Qbar2[k]) > 0){
-                        auto K334445 = get_Kijk_334445(K334_445, rhostar, Tstarij, Tstarik, Tstarjk);
-                        double dbl = sigma_m3[i]*sigma_m5[j]*sigma_m5[k]/(POW2(sigmaij*sigmaik)*POW3(sigmajk))*mubar2[i]*Qbar2[j]*Qbar2[k];
-                        summerB_123_123_224 += leadingijk*dbl*K334445;
-                    }
-                    if (std::abs(Qbar2[i]*Qbar2[j]*Qbar2[k]) > 0){
-                        auto K444555 = get_Kijk(K444_555, rhostar, Tstarij, Tstarik, Tstarjk);
-                        double dbl = POW5(sigma_m[i]*sigma_m[j]*sigma_m[k])/(POW3(sigmaij*sigmaik*sigmajk))*Qbar2[i]*Qbar2[j]*Qbar2[k];
-                        summerB_224_224_224 += leadingijk*dbl*K444555;
-                    }
+            }
+        }
+        
+        // The three-body terms. The K integrals only depend on the pair (i,j) through T*_ij, so the real cube roots of K
+        // are tabulated once per pair and K_ijk = (K_ij*K_ik*K_jk)^{1/3} is the product of three tabulated values. Together with
+        // the Lorentz-Berthelot sigma_ij, each summand factors into terms depending on at most two indices, and the triple
+        // sums only consist of multiply-adds
+        using KType = std::common_type_t<TTYPE, RhoStarType>;
+        const bool has_dipole = (mubar2 != 0).any(), has_quadrupole = (Qbar2 != 0).any();
+        Eigen::ArrayX<XTtype> u(N), v(N); // x_i/T*_i times the moments and the powers of sigma_i
+        for (std::size_t i = 0; i < N; ++i){
+            XTtype xTi = forceeval(x[i]/forceeval(T/EPSKIJ(i,i)));
+            u[i] = xTi*sigma_m3[i]*mubar2[i];
+            v[i] = xTi*sigma_m5[i]*Qbar2[i];
+        }
+        auto build_table = [&](const KIntegral& Kint, int sigma_power){
+            Eigen::ArrayXX<KType> table(N, N);
+            for (std::size_t i = 0; i < N; ++i){
+                for (std::size_t j = i; j < N; ++j){
+                    TTYPE Tstarij = forceeval(T/EPSKIJ(i,j));
+                    table(i, j) = internal::real_cbrt(forceeval(Kint.get_K(Tstarij, rhostar)))/powi(SIGMAIJ(i,j), sigma_power);
+                    table(j, i) = table(i, j);
                 }
             }
+            return table;
+        };
+        if (has_dipole){
+            auto P = build_table(K222_333, 1);
+            summerB_112_112_112 = internal::pair_factored_three_body_sum(P, P, P, u, u, u);
+        }
+        if (has_dipole && has_quadrupole){
+            auto P = build_table(K233_344, 1), R = build_table(K233_344, 2);
+            summerB_112_123_123 = internal::pair_factored_three_body_sum(P, R, R, u, u, v);
+            auto A = build_table(K334_445, 2), B = build_table(K334_445, 3);
+            summerB_123_123_224 = internal::pair_factored_three_body_sum(A, A, B, u, v, v);
+        }
+        if (has_quadrupole){
+            auto E = build_table(K444_555, 3);
+            summerB_224_224_224 = internal::pair_factored_three_body_sum(E, E, E, v, v, v);
         }
         
         type alpha3A_112_112_224 = 8.0*PI_*rhoN/25.0*summerA_112_112_224;
@@ -847,26 +960,6 @@ public:
         
         /// Following Appendix B of Gray and Gubbins
         const double PI3 = POW3(PI_);
-        auto Immm = [&](std::size_t i, std::size_t j, std::size_t k, const auto& T, const auto& rhostar){
-            auto Tstarij = T/EPSKIJ(i,j), Tstarik = T/EPSKIJ(i,k), Tstarjk = T/EPSKIJ(j, k);
-            const double coeff = 64.0*PI3/5.0*sqrt(14*PI_/5.0)/SIGMAIJ(i,j)/SIGMAIJ(i,k)/SIGMAIJ(j,k);
-            return coeff*get_Kijk(K222_333, rhostar, Tstarij, Tstarik, Tstarjk);
-        };
-        auto ImmQ = [&](std::size_t i, std::size_t j, std::size_t k, const auto& T, const auto& rhostar){
-            auto Tstarij = T/EPSKIJ(i,j), Tstarik = T/EPSKIJ(i,k), Tstarjk = T/EPSKIJ(j, k);
-            const double coeff = 2048.0*PI3/7.0*sqrt(3.0*PI_)/SIGMAIJ(i,j)/POW2(SIGMAIJ(i,k)*SIGMAIJ(j,k));
-            return get_Kijk(K233_344, rhostar, Tstarij, Tstarik, Tstarjk);
-        };
-        auto ImQQ = [&](std::size_t i, std::size_t j, std::size_t k, const auto& T, const auto& rhostar){
-            auto Tstarij = T/EPSKIJ(i,j), Tstarik = T/EPSKIJ(i,k), Tstarjk = T/EPSKIJ(j, k);
-            const double coeff = -4096.0*PI3/9.0*sqrt(22.0*PI_/7.0)/POW2(SIGMAIJ(i,j)*SIGMAIJ(i,k))/POW3(SIGMAIJ(j,k));
-            return get_Kijk_334445(K334_445, rhostar, Tstarij, Tstarik, Tstarjk);
-        };
-        auto IQQQ = [&](std::size_t i, std::size_t j, std::size_t k, const auto& T, const auto& rhostar){
-            auto Tstarij = T/EPSKIJ(i,j), Tstarik = T/EPSKIJ(i,k), Tstarjk = T/EPSKIJ(j, k);
-            const double coeff = 8192.0*PI3/81.0*sqrt(2002.0*PI_)/POW3(SIGMAIJ(i,j)*SIGMAIJ(i,k)*SIGMAIJ(j,k));
-            return get_Kijk(K444_555, rhostar, Tstarij, Tstarik, Tstarjk);
-        };
         
         for (std::size_t i = 0; i < N; ++i){
             for (std::size_t j = 0; j < N; ++j){
@@ -879,17 +972,53 @@ public:
                              + 36.0/245.0*POW3(beta)*Q3[i]*Q3[j]*get_In(J15, 15, sigmaij, Tstarij, rhostar)
                              );
                 summer_a += x[i]*x[j]*a_ij;
-                
-                double C = 1.0;
-                for (std::size_t k = 0; k < N; ++k){
-                    auto b_ijk = (
-                      1.0/2.0*(z1[i]*z1[j]*z1[k] - z2[i]*z2[j]*z2[k])*Immm(i, j, k, T, rhostar)
-                      +C*(3.0/160.0*z1[i]*z1[j]*beta*Q2[k]*ImmQ(i, j, k, T, rhostar) + 3.0/640.0*z1[i]*POW2(beta)*Q2[j]*Q2[k]*ImQQ(i,j,k,T, rhostar))
-                      +1.0/6400.0*POW3(beta)*Q2[i]*Q2[j]*Q2[k]*IQQQ(i, j, k, T, rhostar)
-                    );
-                    summer_b += x[i]*x[j]*x[k]*b_ijk;
+            }
+        }
+        
+        // The integrals I_ijk of the three-body terms are products of pair quantities once the real cube roots of the
+        // K integrals are tabulated for each pair, so the triple sums only consist of multiply-adds. As in the
+        // pairwise evaluation of the integrals, only I_mmm carries its leading coefficient.
+        using KType = std::common_type_t<TTYPE, RhoStarType>;
+        using XTtype = std::common_type_t<TTYPE, std::decay_t<decltype(mole_fractions[0])>>;
+        Eigen::ArrayX<XTtype> xz1(N), xz2(N), xq(N);
+        for (std::size_t i = 0; i < N; ++i){
+            xz1[i] = x[i]*z1[i];
+            xz2[i] = x[i]*z2[i];
+            xq[i] = x[i]*beta*Q2[i];
+        }
+        auto build_table = [&](const KIntegral& Kint, bool divide_by_sigma){
+            Eigen::ArrayXX<KType> table(N, N);
+            for (std::size_t i = 0; i < N; ++i){
+                for (std::size_t j = i; j < N; ++j){
+                    TTYPE Tstarij = forceeval(T/EPSKIJ(i,j));
+                    table(i, j) = internal::real_cbrt(forceeval(Kint.get_K(Tstarij, rhostar)));
+                    if (divide_by_sigma){
+                        table(i, j) /= SIGMAIJ(i,j);
+                    }
+                    table(j, i) = table(i, j);
                 }
             }
+            return table;
+        };
+        const bool has_dipole = (mu != 0).any(), has_quadrupole = (Q != 0).any();
+        double C = 1.0;
+        if (has_dipole){
+            const double coeff_mmm = 64.0*PI3/5.0*sqrt(14*PI_/5.0);
+            auto P = build_table(K222_333, true);
+            summer_b += 1.0/2.0*coeff_mmm*internal::pair_factored_three_body_sum(P, P, P, xz1, xz1, xz1);
+            if ((xz2.unaryExpr([](const auto& v){ return getbaseval(v); }) != 0.0).any()){
+                summer_b += -1.0/2.0*coeff_mmm*internal::pair_factored_three_body_sum(P, P, P, xz2, xz2, xz2);
+            }
+        }
+        if (has_dipole && has_quadrupole){
+            auto KmmQ = build_table(K233_344, false);
+            summer_b += C*3.0/160.0*internal::pair_factored_three_body_sum(KmmQ, KmmQ, KmmQ, xz1, xz1, xq);
+            auto KmQQ = build_table(K334_445, false);
+            summer_b += C*3.0/640.0*internal::pair_factored_three_body_sum(KmQQ, KmQQ, KmQQ, xz1, xq, xq);
+        }
+        if (has_quadrupole){
+            auto KQQQ = build_table(K444_555, false);
+            summer_b += 1.0/6400.0*internal::pair_factored_three_body_sum(KQQQ, KQQQ, KQQQ, xq, xq, xq);
         }
 
         return forceeval((rhoN*summer_a + rhoN*rhoN*summer_b)*k_e*k_e*k_e); // The factor of k_e^3 takes us from CGS to SI units
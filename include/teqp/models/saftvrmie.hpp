@@ -15,10 +15,27 @@
 #include "teqp/models/saft/polar_terms.hpp"
 #include <optional>
 #include <variant>
+#include <array>
+#include <limits>
+#include "teqp/per_thread.hpp"
 
 namespace teqp {
 namespace SAFTVRMie {
 
+/**
+ A cache of the Taylor coefficients \f$d_{ii}^{(k)}(T)/k!\f$ of the pure-component diameters in temperature, one entry for each
+ derivative order up to Kmax, keyed on the temperature.  The entries are filled by SAFTVRMieChainContributionTerms::get_dmat.
+ Each thread has its own entries, so that threads working at different temperatures neither wait for nor evict each other;
+ copies start empty.
+ */
+struct DiameterCache {
+    static constexpr int Kmax = 6;
+    struct Entry { double T = std::numeric_limits<double>::quiet_NaN(); Eigen::ArrayXXd coeffs; };
+    PerThreadStore<std::array<Entry, Kmax + 1>> store;
+    /// The entries of the calling thread
+    auto& entries() const { return store.local(); }
+};
+
 /// Coefficients for one fluid
 struct SAFTVRMieCoeffs {
     std::string name; ///< Name of fluid
@@ -260,6 +277,12 @@ struct SAFTVRMieChainContributionTerms{
 
     const std::vector<Eigen::ArrayXXd> crnij, canij, c2rnij, c2anij, carnij;
     const std::vector<Eigen::ArrayXXd> fkij; // Matrices of parameters
+    /// The exponents lambda_a, lambda_r, 2*lambda_a, 2*lambda_r and lambda_a+lambda_r of each pair, in the order of the coefficients canij, crnij, c2anij, c2rnij and carnij
+    const std::array<Eigen::ArrayXXd, 5> lambda_k_ij;
+    
+    private:
+    mutable DiameterCache dcache;
+    public:
 
     SAFTVRMieChainContributionTerms(
             const Eigen::ArrayXd& m,
@@ -277,7 +300,8 @@ struct SAFTVRMieChainContributionTerms{
         sigma_ij(get_sigma_ij()), epsilon_ij(get_epsilon_ij()),
         crnij(get_crnij()), canij(get_canij()),
         c2rnij(get_c2rnij()), c2anij(get_c2anij()), carnij(get_carnij()),
-        fkij(get_fkij())
+        fkij(get_fkij()),
+        lambda_k_ij{lambda_a_ij, lambda_r_ij, 2.0*lambda_a_ij, 2.0*lambda_r_ij, lambda_a_ij+lambda_r_ij}
     {}
     
     /// Eq. A2 from Lafitte
@@ -355,13 +379,13 @@ struct SAFTVRMieChainContributionTerms{
     */
     template <typename TType>
     TType get_dii(std::size_t i, const TType &T) const{
-        std::function<TType(TType)> integrand = [this, i, &T](const TType& r){
-            return forceeval(1.0-exp(-this->get_uii_over_kB(i, r)/T));
+        auto integrand = [this, i, &T](const TType& r){
+            return TType(forceeval(1.0-exp(-this->get_uii_over_kB(i, r)/T)));
         };
         
         // Sum of the two integrals, one is constant, the other is from integration
-        auto rcut = forceeval(sigma_A[i]/get_j_cutoff_dii(i, T));
-        auto integral_contribution = quad<10, TType, TType>(integrand, rcut, sigma_A[i]);
+        TType rcut = forceeval(sigma_A[i]/get_j_cutoff_dii(i, T));
+        auto integral_contribution = quad_inline<10>(integrand, rcut, TType(sigma_A[i]));
         auto d = forceeval(rcut + integral_contribution);
         
         if (getbaseval(d) > sigma_A[i]){
@@ -370,12 +394,67 @@ struct SAFTVRMieChainContributionTerms{
         return d;
     }
     
+    /// The Taylor coefficients \f$d_{ii}^{(k)}(T)/k!\f$ for k=0..K, one row per component, obtained with autodiff::Real
+    template <int K>
+    Eigen::ArrayXXd calc_dii_Taylor(const double T) const{
+        Eigen::ArrayXXd coeffs(N, K+1);
+        for (auto i = 0; i < N; ++i){
+            if constexpr (K == 0){
+                coeffs(i, 0) = get_dii(i, T);
+            }
+            else{
+                autodiff::Real<K, double> Tad = T;
+                auto f = [this, i](const auto& T_){ return get_dii(i, T_); };
+                auto ders = derivatives(f, along(1), at(Tad));
+                double factorial = 1.0;
+                for (auto k = 0; k <= K; ++k){
+                    if (k > 0){ factorial *= k; }
+                    coeffs(i, k) = ders[k]/factorial;
+                }
+            }
+        }
+        return coeffs;
+    }
+    
+    /**
+     The matrix of diameters. The pure-component diameters, whose calculation involves a rootfinding and a quadrature,
+     are taken from the DiameterCache when the temperature is unchanged since the last call with the same order of derivatives.
+     As \f$T-T_0\f$ has a zero value, the Taylor polynomial evaluated with the number type of T carries the derivatives with
+     respect to T to the correct order, whatever the derivative variable. Types whose order is not known (multicomplex, for
+     instance) are not cached.
+     */
     template <typename TType>
     auto get_dmat(const TType &T) const{
         Eigen::Array<TType, Eigen::Dynamic, Eigen::Dynamic> d(N,N);
-        // For the pure components, by integration
-        for (auto i = 0; i < N; ++i){
-            d(i,i) = get_dii(i, T);
+        constexpr int K = get_derivative_order<std::decay_t<TType>>();
+        if constexpr (K >= 0 && K <= DiameterCache::Kmax){
+            const double T0 = getbaseval(T);
+            auto& entry = dcache.entries()[K];
+            if (!(entry.T == T0)){
+                entry.coeffs = calc_dii_Taylor<K>(T0);
+                entry.T = T0;
+            }
+            const Eigen::ArrayXXd& coeffs = entry.coeffs;
+            for (auto i = 0; i < N; ++i){
+                if constexpr (K == 0){
+                    d(i,i) = coeffs(i, 0);
+                }
+                else{
+                    // Horner evaluation of the Taylor polynomial in T-T0
+                    const auto dT = forceeval(T - T0);
+                    TType r = coeffs(i, K);
+                    for (auto k = K-1; k >= 0; --k){
+                        r = forceeval(r*dT + coeffs(i, k));
+                    }
+                    d(i,i) = r;
+                }
+            }
+        }
+        else{
+            // For the pure components, by integration
+            for (auto i = 0; i < N; ++i){
+                d(i,i) = get_dii(i, T);
+            }
         }
         // The cross terms, using the linear mixing rule
         for (auto i = 0; i < N; ++i){
@@ -422,9 +501,10 @@ struct SAFTVRMieChainContributionTerms{
         NumType summer_zeta_x = 0.0;
         TRHOType summer_zeta_x_bar = 0.0;
         for (auto i = 0; i < N; ++i){
-            for (auto j = 0; j < N; ++j){
-                summer_zeta_x += xs(i)*xs(j)*powi(dmat(i,j), 3)*rhos;
-                summer_zeta_x_bar += xs(i)*xs(j)*powi(sigma_ij(i,j), 3);
+            for (auto j = i; j < N; ++j){
+                double factor = (i == j) ? 1.0 : 2.0; // Off-diagonal terms contribute twice
+                summer_zeta_x += factor*xs(i)*xs(j)*powi(dmat(i,j), 3)*rhos;
+                summer_zeta_x_bar += factor*xs(i)*xs(j)*powi(sigma_ij(i,j), 3);
             }
         }
         
@@ -453,41 +533,43 @@ struct SAFTVRMieChainContributionTerms{
         NumType K_HS = get_KHS(zeta_x);
         NumType rho_dK_HS_drho = get_rhos_dK_HS_drhos(zeta_x);
         
+        // Powers of zeta_x, shared by the polynomials for the effective packing fractions of all the pairs
+        const NumType zeta_x2 = POW2(zeta_x), zeta_x3 = POW3(zeta_x), zeta_x4 = POW4(zeta_x);
+        
+        // The coefficients of Eq. A18 for each of the exponents in lambda_k_ij, in the same order
+        const std::array<const std::vector<Eigen::ArrayXXd>*, 5> c_k{&canij, &crnij, &c2anij, &c2rnij, &carnij};
+        enum { ka = 0, kr = 1, k2a = 2, k2r = 3, kar = 4 };
+        
+        // Only the pairs with i <= j are evaluated, the pair quantities are symmetric
         for (auto i = 0; i < N; ++i){
             for (auto j = i; j < N; ++j){
                 NumType x_0_ij = sigma_ij(i,j)/dmat(i, j);
+                const NumType x_0_ij3 = POW3(x_0_ij), x_0_ij4 = x_0_ij3*x_0_ij;
+                
+                // For each of the exponents lambda_a, lambda_r, 2*lambda_a, 2*lambda_r and lambda_a+lambda_r (see lambda_k_ij),
+                // the power x_0^lambda, I and J (Eqs. A14 and A15), Bhat, the effective packing fraction and its derivative,
+                // and the term x_0^lambda*(Bhat + a1Shat) that appears in a_1, a_2 and the chain contribution.
+                // Each is evaluated once per pair.
+                std::array<NumType, 5> I_k, J_k, Bhat_k, zeta_x_eff_k, dzeta_x_eff_dzetax_k, xlambda_k, one_term_k;
+                for (auto k = 0; k < 5; ++k){
+                    const double lambda_ij = lambda_k_ij[k](i,j);
+                    const auto& c = *c_k[k];
+                    xlambda_k[k] = pow(x_0_ij, lambda_ij);
+                    const NumType x3ml = x_0_ij3/xlambda_k[k], x4ml = x_0_ij4/xlambda_k[k]; // x_0^(3-lambda), x_0^(4-lambda)
+                    I_k[k] = -(x3ml-1.0)/(lambda_ij-3.0); // Eq. A14
+                    J_k[k] = -(x4ml*(lambda_ij-3.0)-x3ml*(lambda_ij-4.0)-1.0)/((lambda_ij-3.0)*(lambda_ij-4.0)); // Eq. A15
+                    Bhat_k[k] = this->get_Bhatij(zeta_x, X, I_k[k], J_k[k]);
+                    zeta_x_eff_k[k] = c[0](i,j)*zeta_x + c[1](i,j)*zeta_x2 + c[2](i,j)*zeta_x3 + c[3](i,j)*zeta_x4;
+                    dzeta_x_eff_dzetax_k[k] = c[0](i,j) + c[1](i,j)*2*zeta_x + c[2](i,j)*3*zeta_x2 + c[3](i,j)*4*zeta_x3;
+                    one_term_k[k] = xlambda_k[k]*(Bhat_k[k] + this->get_a1Shatij(zeta_x_eff_k[k], lambda_ij));
+                }
                 
                 // -----------------------
                 // Calculations for a_1/kB
                 // -----------------------
                 
-                auto I = [&x_0_ij](double lambda_ij){
-                    return forceeval(-(pow(x_0_ij, 3-lambda_ij)-1.0)/(lambda_ij-3.0)); // Eq. A14
-                };
-                auto J = [&x_0_ij](double lambda_ij){
-                    return forceeval(-(pow(x_0_ij, 4-lambda_ij)*(lambda_ij-3.0)-pow(x_0_ij, 3.0-lambda_ij)*(lambda_ij-4.0)-1.0)/((lambda_ij-3.0)*(lambda_ij-4.0))); // Eq. A15
-                };
-                auto Bhatij_a = this->get_Bhatij(zeta_x, X, I(lambda_a_ij(i,j)), J(lambda_a_ij(i,j)));
-                auto Bhatij_2a = this->get_Bhatij(zeta_x, X, I(2*lambda_a_ij(i,j)), J(2*lambda_a_ij(i,j)));
-                auto Bhatij_r = this->get_Bhatij(zeta_x, X, I(lambda_r_ij(i,j)), J(lambda_r_ij(i,j)));
-                auto Bhatij_2r = this->get_Bhatij(zeta_x, X, I(2*lambda_r_ij(i,j)), J(2*lambda_r_ij(i,j)));
-                auto Bhatij_ar = this->get_Bhatij(zeta_x, X, I(lambda_a_ij(i,j)+lambda_r_ij(i,j)), J(lambda_a_ij(i,j)+lambda_r_ij(i,j)));
-                                                 
-                auto one_term =  [this, &x_0_ij, &I, &J, &zeta_x, &X](double lambda_ij, const NumType& zeta_x_eff){
-                    return forceeval(
-                       pow(x_0_ij, lambda_ij)*(
-                         this->get_Bhatij(zeta_x, X, I(lambda_ij), J(lambda_ij))
-                       + this->get_a1Shatij(zeta_x_eff, lambda_ij)
-                       )
-                     );
-                };
-                NumType zeta_x_eff_r = crnij[0](i,j)*zeta_x + crnij[1](i,j)*POW2(zeta_x) + crnij[2](i,j)*POW3(zeta_x) + crnij[3](i,j)*POW4(zeta_x);
-                NumType zeta_x_eff_a = canij[0](i,j)*zeta_x + canij[1](i,j)*POW2(zeta_x) + canij[2](i,j)*POW3(zeta_x) + canij[3](i,j)*POW4(zeta_x);
-                NumType dzeta_x_eff_dzetax_r = crnij[0](i,j) + crnij[1](i,j)*2*zeta_x + crnij[2](i,j)*3*POW2(zeta_x) + crnij[3](i,j)*4*POW3(zeta_x);
-                NumType dzeta_x_eff_dzetax_a = canij[0](i,j) + canij[1](i,j)*2*zeta_x + canij[2](i,j)*3*POW2(zeta_x) + canij[3](i,j)*4*POW3(zeta_x);
-
                 NumType a1ij = 2.0*MY_PI*rhos*dmat3(i,j)*epsilon_ij(i,j)*C_ij(i,j)*(
-                    one_term(lambda_a_ij(i,j), zeta_x_eff_a) - one_term(lambda_r_ij(i,j), zeta_x_eff_r)
+                    one_term_k[ka] - one_term_k[kr]
                 ); // divided by k_B
                                     
                 NumType contribution = xs(i)*xs(j)*a1ij;
@@ -498,18 +580,11 @@ struct SAFTVRMieChainContributionTerms{
                 // Calculations for a_2/k_B^2
                 // --------------------------
                 
-                NumType zeta_x_eff_2r = c2rnij[0](i,j)*zeta_x + c2rnij[1](i,j)*POW2(zeta_x) + c2rnij[2](i,j)*POW3(zeta_x) + c2rnij[3](i,j)*POW4(zeta_x);
-                NumType zeta_x_eff_2a = c2anij[0](i,j)*zeta_x + c2anij[1](i,j)*POW2(zeta_x) + c2anij[2](i,j)*POW3(zeta_x) + c2anij[3](i,j)*POW4(zeta_x);
-                NumType zeta_x_eff_ar = carnij[0](i,j)*zeta_x + carnij[1](i,j)*POW2(zeta_x) + carnij[2](i,j)*POW3(zeta_x) + carnij[3](i,j)*POW4(zeta_x);
-                NumType dzeta_x_eff_dzetax_2r = c2rnij[0](i,j) + c2rnij[1](i,j)*2*zeta_x + c2rnij[2](i,j)*3*POW2(zeta_x) + c2rnij[3](i,j)*4*POW3(zeta_x);
-                NumType dzeta_x_eff_dzetax_ar = carnij[0](i,j) + carnij[1](i,j)*2*zeta_x + carnij[2](i,j)*3*POW2(zeta_x) + carnij[3](i,j)*4*POW3(zeta_x);
-                NumType dzeta_x_eff_dzetax_2a = c2anij[0](i,j) + c2anij[1](i,j)*2*zeta_x + c2anij[2](i,j)*3*POW2(zeta_x) + c2anij[3](i,j)*4*POW3(zeta_x);
-                
                 NumType chi_ij = fkij[1](i,j)*zeta_x_bar + fkij[2](i,j)*zeta_x_bar5 + fkij[3](i,j)*zeta_x_bar8;
                 auto a2ij = 0.5*K_HS*(1.0+chi_ij)*epsilon_ij(i,j)*POW2(C_ij(i,j))*(2*MY_PI*rhos*dmat3(i,j)*epsilon_ij(i,j))*(
-                     one_term(2.0*lambda_a_ij(i,j), zeta_x_eff_2a)
-                  -2.0*one_term(lambda_a_ij(i,j)+lambda_r_ij(i,j), zeta_x_eff_ar)
-                    +one_term(2.0*lambda_r_ij(i,j), zeta_x_eff_2r)
+                     one_term_k[k2a]
+                  -2.0*one_term_k[kar]
+                    +one_term_k[k2r]
                 ); // divided by k_B^2
                                     
                 NumType contributiona2 = xs(i)*xs(j)*a2ij; // Eq. A19
@@ -530,33 +605,25 @@ struct SAFTVRMieChainContributionTerms{
                     // ------------------
                     
                     // Eq. A29
-                    auto gdHSii = exp(k0 + k1*x_0_ij + k2*POW2(x_0_ij) + k3*POW3(x_0_ij));
+                    auto gdHSii = exp(k0 + k1*x_0_ij + k2*POW2(x_0_ij) + k3*x_0_ij3);
                     
                     // The g1 terms
                     // ....
                     
-                    // This is the function for the second part (not the partial) that goes in g_{1,ii},
+                    // This is the second part (not the partial) that goes in g_{1,ii},
                     // divided by 2*PI*d_ij^3*epsilon*rhos
-                    auto g1_term = [&one_term](double lambda_ij, const NumType& zeta_x_eff){
-                        return forceeval(lambda_ij*one_term(lambda_ij, zeta_x_eff));
-                    };
-                    auto g1_noderivterm = -C_ij(i,i)*(g1_term(lambda_a_ij(i,i), zeta_x_eff_a)-g1_term(lambda_r_ij(i,i), zeta_x_eff_r));
+                    auto g1_noderivterm = -C_ij(i,i)*(lambda_k_ij[ka](i,i)*one_term_k[ka] - lambda_k_ij[kr](i,i)*one_term_k[kr]);
                     
                     // Bhat = B*rho*kappa; diff(Bhat, rho) = Bhat + rho*dBhat/drho; kappa = 2*pi*eps*d^3
                     // This is the function for the partial derivative rhos*(da1ij/drhos),
                     // divided by 2*PI*d_ij^3*epsilon*rhos
-                    auto rhosda1iidrhos_term = [this, &x_0_ij, &I, &J, &zeta_x, &X](double lambda_ij, const NumType& zeta_x_eff, const NumType& dzetaxeff_dzetax, const NumType& Bhatij){
-                        auto I_ = I(lambda_ij);
-                        auto J_ = J(lambda_ij);
-                        auto rhosda1Sdrhos = this->get_rhoda1Shatijdrho(zeta_x, zeta_x_eff, dzetaxeff_dzetax, lambda_ij);
-                        auto rhosdBdrhos = this->get_rhodBijdrho(zeta_x, X, I_, J_, Bhatij);
-                        return forceeval(pow(x_0_ij, lambda_ij)*(rhosda1Sdrhos + rhosdBdrhos));
+                    auto rhosda1iidrhos_term = [&](int k){
+                        auto rhosda1Sdrhos = this->get_rhoda1Shatijdrho(zeta_x, zeta_x_eff_k[k], dzeta_x_eff_dzetax_k[k], lambda_k_ij[k](i,i));
+                        auto rhosdBdrhos = this->get_rhodBijdrho(zeta_x, X, I_k[k], J_k[k], Bhat_k[k]);
+                        return forceeval(xlambda_k[k]*(rhosda1Sdrhos + rhosdBdrhos));
                     };
                     // This is rhos*d(a_1ij)/drhos/(2*pi*d^3*eps*rhos)
-                    auto da1iidrhos_term = C_ij(i,j)*(
-                         rhosda1iidrhos_term(lambda_a_ij(i,i), zeta_x_eff_a, dzeta_x_eff_dzetax_a, Bhatij_a)
-                        -rhosda1iidrhos_term(lambda_r_ij(i,i), zeta_x_eff_r, dzeta_x_eff_dzetax_r, Bhatij_r)
-                    );
+                    auto da1iidrhos_term = C_ij(i,j)*(rhosda1iidrhos_term(ka) - rhosda1iidrhos_term(kr));
                     auto g1ii = 3.0*da1iidrhos_term + g1_noderivterm;
                     
                     // The g2 terms
@@ -565,21 +632,14 @@ struct SAFTVRMieChainContributionTerms{
                     // This is the second part (not the partial deriv.) that goes in g_{2,ii},
                     // divided by 2*PI*d_ij^3*epsilon*rhos
                     auto g2_noderivterm = -POW2(C_ij(i,i))*K_HS*(
-                       lambda_a_ij(i,j)*one_term(2*lambda_a_ij(i,j), zeta_x_eff_2a)
-                       -(lambda_a_ij(i,j)+lambda_r_ij(i,j))*one_term(lambda_a_ij(i,j)+lambda_r_ij(i,j), zeta_x_eff_ar)
-                       +lambda_r_ij(i,j)*one_term(2*lambda_r_ij(i,j), zeta_x_eff_2r)
+                       lambda_k_ij[ka](i,j)*one_term_k[k2a]
+                       -lambda_k_ij[kar](i,j)*one_term_k[kar]
+                       +lambda_k_ij[kr](i,j)*one_term_k[k2r]
                     );
                     // This is [rhos*d(a_2ij/(1+chi_ij))/drhos]/(2*pi*d^3*eps*rhos)
                     auto da2iidrhos_term = 0.5*POW2(C_ij(i,j))*(
-                        rho_dK_HS_drho*(
-                            one_term(2.0*lambda_a_ij(i,j), zeta_x_eff_2a)
-                            -2.0*one_term(lambda_a_ij(i,j)+lambda_r_ij(i,j), zeta_x_eff_ar)
-                            +one_term(2.0*lambda_r_ij(i,j), zeta_x_eff_2r))
-                        +K_HS*(
-                            rhosda1iidrhos_term(2.0*lambda_a_ij(i,i), zeta_x_eff_2a, dzeta_x_eff_dzetax_2a, Bhatij_2a)
-                            -2.0*rhosda1iidrhos_term(lambda_a_ij(i,i)+lambda_r_ij(i,i), zeta_x_eff_ar, dzeta_x_eff_dzetax_ar, Bhatij_ar)
-                            +rhosda1iidrhos_term(2.0*lambda_r_ij(i,i), zeta_x_eff_2r, dzeta_x_eff_dzetax_2r, Bhatij_2r)
-                            )
+                        rho_dK_HS_drho*(one_term_k[k2a] - 2.0*one_term_k[kar] + one_term_k[k2r])
+                        +K_HS*(rhosda1iidrhos_term(k2a) - 2.0*rhosda1iidrhos_term(kar) + rhosda1iidrhos_term(k2r))
                         );
                     auto g2MCAij = 3.0*da2iidrhos_term + g2_noderivterm;
                     
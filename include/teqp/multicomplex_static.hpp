@@ -0,0 +1,441 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+namespace teqp {
+
+// The operators and the elementary functions are in their own namespace, where they are found by argument-dependent lookup,
+// so that they do not hide those of the standard library for the unqualified calls with double arguments in namespace teqp
+namespace static_mcx {
+
+/**
+ \brief A multicomplex number of order N, with its 2^N coefficients in a fixed-size array
+
+ The number is the sum of c_s i^s over s = 0 ... 2^N-1, in which i^s is the product of the imaginary units i_{k+1} (with i_k^2 = -1)
+ of the bits k set in s; c_0 is the real part and c_{2^N-1} the coefficient of i_1 i_2 ... i_N.  As the order is fixed at compile
+ time, unlike that of mcx::MultiComplex, no operation allocates, and the loops over the coefficients have fixed bounds.
+
+ The elementary functions are evaluated from their Taylor series about the real part, truncated after the term of order N.  For
+ the numbers of the multicomplex step derivatives (see diff_static_mcx1), in which c_s is of the order of h^|s|, the error of the
+ truncation is of relative order h^2 in each coefficient, which is the accuracy of the multicomplex step derivatives themselves.
+ The comparison operators compare the real parts, as those of the autodiff types compare the values.
+ */
+template<int N, typename T = double>
+class StaticMultiComplex {
+    static_assert(N >= 0 && N <= 12, "The order of a StaticMultiComplex must be from 0 to 12");
+public:
+    static constexpr int order = N;
+    static constexpr std::size_t size = std::size_t(1) << N;
+    using value_type = T;
+
+    std::array<T, size> coef;
+
+    StaticMultiComplex() { coef.fill(T(0)); }
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U, T>>>
+    StaticMultiComplex(const U& real) { coef.fill(T(0)); coef[0] = static_cast<T>(real); }
+
+    const T& real() const { return coef[0]; }
+
+    StaticMultiComplex operator-() const {
+        StaticMultiComplex o;
+        for (std::size_t s = 0; s < size; ++s) { o.coef[s] = -coef[s]; }
+        return o;
+    }
+    StaticMultiComplex& operator+=(const StaticMultiComplex& w) {
+        for (std::size_t s = 0; s < size; ++s) { coef[s] += w.coef[s]; }
+        return *this;
+    }
+    StaticMultiComplex& operator-=(const StaticMultiComplex& w) {
+        for (std::size_t s = 0; s < size; ++s) { coef[s] -= w.coef[s]; }
+        return *this;
+    }
+    StaticMultiComplex& operator*=(const StaticMultiComplex& w) { return *this = *this * w; }
+    StaticMultiComplex& operator/=(const StaticMultiComplex& w) { return *this = *this / w; }
+};
+
+template<typename T> struct is_static_mcx_t : std::false_type {};
+template<int N, typename T> struct is_static_mcx_t<StaticMultiComplex<N, T>> : std::true_type {};
+
+namespace detail {
+    /// Whether an odd number of bits is set, i.e. whether the product of the units in common of two terms is -1
+    constexpr bool odd_parity(std::size_t s) {
+        bool odd = false;
+        for (; s != 0; s &= s - 1) { odd = !odd; }
+        return odd;
+    }
+
+    /// The scalars that combine with a StaticMultiComplex<N, T> without being converted to it first
+    template<typename S, typename T>
+    using if_scalar = std::enable_if_t<std::is_arithmetic_v<S> || std::is_same_v<S, T>, int>;
+
+    /**
+     f(z) from the Taylor coefficients c_k = f^(k)(x0)/k!, k = 0 ... N, of f about the real part x0 of z, by Horner's scheme
+     in z - x0
+     */
+    template<int N, typename T>
+    StaticMultiComplex<N, T> taylor(const StaticMultiComplex<N, T>& z, const std::array<T, N + 1>& c) {
+        StaticMultiComplex<N, T> d = z;
+        d.coef[0] = 0;
+        StaticMultiComplex<N, T> r(c[N]);
+        for (int k = N - 1; k >= 0; --k) {
+            r = r * d;
+            r.coef[0] += c[k];
+        }
+        return r;
+    }
+
+    /// The Taylor coefficients of x^p about x0, from f(x0) = x0^p (or another branch of it, as for cbrt), and c_k = c_{k-1}(p-k+1)/(k x0)
+    template<int N, typename T>
+    std::array<T, N + 1> power_coefficients(const T& x0, const T& f0, const T& p) {
+        std::array<T, N + 1> c;
+        c[0] = f0;
+        for (int k = 1; k <= N; ++k) { c[k] = c[k - 1] * (p - (k - 1)) / (k * x0); }
+        return c;
+    }
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> operator+(StaticMultiComplex<N, T> a, const StaticMultiComplex<N, T>& b) { return a += b; }
+template<int N, typename T>
+StaticMultiComplex<N, T> operator-(StaticMultiComplex<N, T> a, const StaticMultiComplex<N, T>& b) { return a -= b; }
+
+template<int N, typename T>
+StaticMultiComplex<N, T> operator*(const StaticMultiComplex<N, T>& a, const StaticMultiComplex<N, T>& b) {
+    constexpr auto size = StaticMultiComplex<N, T>::size;
+    StaticMultiComplex<N, T> c;
+    for (std::size_t s = 0; s < size; ++s) {
+        if (a.coef[s] == 0) { continue; }
+        for (std::size_t t = 0; t < size; ++t) {
+            // i^s i^t = i^(s xor t), times -1 for each unit in common
+            if (detail::odd_parity(s & t)) {
+                c.coef[s ^ t] -= a.coef[s] * b.coef[t];
+            }
+            else {
+                c.coef[s ^ t] += a.coef[s] * b.coef[t];
+            }
+        }
+    }
+    return c;
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> inv(const StaticMultiComplex<N, T>& z) {
+    const T x0 = z.real();
+    std::array<T, N + 1> c;
+    c[0] = 1 / x0;
+    for (int k = 1; k <= N; ++k) { c[k] = -c[k - 1] / x0; }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> operator/(const StaticMultiComplex<N, T>& a, const StaticMultiComplex<N, T>& b) { return a * inv(b); }
+
+// With scalars
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator+(StaticMultiComplex<N, T> a, const S& b) { a.coef[0] += b; return a; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator+(const S& a, StaticMultiComplex<N, T> b) { b.coef[0] += a; return b; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator-(StaticMultiComplex<N, T> a, const S& b) { a.coef[0] -= b; return a; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator-(const S& a, const StaticMultiComplex<N, T>& b) { auto o = -b; o.coef[0] += a; return o; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator*(StaticMultiComplex<N, T> a, const S& b) {
+    for (auto& c : a.coef) { c *= b; }
+    return a;
+}
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator*(const S& a, const StaticMultiComplex<N, T>& b) { return b * a; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator/(StaticMultiComplex<N, T> a, const S& b) {
+    for (auto& c : a.coef) { c /= b; }
+    return a;
+}
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> operator/(const S& a, const StaticMultiComplex<N, T>& b) { return inv(b) * a; }
+
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T>& operator+=(StaticMultiComplex<N, T>& a, const S& b) { a.coef[0] += b; return a; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T>& operator-=(StaticMultiComplex<N, T>& a, const S& b) { a.coef[0] -= b; return a; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T>& operator*=(StaticMultiComplex<N, T>& a, const S& b) { return a = a * b; }
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T>& operator/=(StaticMultiComplex<N, T>& a, const S& b) { return a = a / b; }
+
+// Comparisons of the real parts
+#define TEQP_STATIC_MCX_COMPARISON(OP) \
+template<int N, typename T> \
+bool operator OP(const StaticMultiComplex<N, T>& a, const StaticMultiComplex<N, T>& b) { return a.real() OP b.real(); } \
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0> \
+bool operator OP(const StaticMultiComplex<N, T>& a, const S& b) { return a.real() OP b; } \
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0> \
+bool operator OP(const S& a, const StaticMultiComplex<N, T>& b) { return a OP b.real(); }
+TEQP_STATIC_MCX_COMPARISON(<)
+TEQP_STATIC_MCX_COMPARISON(>)
+TEQP_STATIC_MCX_COMPARISON(<=)
+TEQP_STATIC_MCX_COMPARISON(>=)
+TEQP_STATIC_MCX_COMPARISON(==)
+TEQP_STATIC_MCX_COMPARISON(!=)
+#undef TEQP_STATIC_MCX_COMPARISON
+
+// The elementary functions, from their Taylor coefficients about the real part
+template<int N, typename T>
+StaticMultiComplex<N, T> exp(const StaticMultiComplex<N, T>& z) {
+    using std::exp;
+    std::array<T, N + 1> c;
+    c[0] = exp(z.real());
+    for (int k = 1; k <= N; ++k) { c[k] = c[k - 1] / k; }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> expm1(const StaticMultiComplex<N, T>& z) {
+    using std::exp; using std::expm1;
+    std::array<T, N + 1> c;
+    c[0] = exp(z.real());
+    for (int k = 1; k <= N; ++k) { c[k] = c[k - 1] / k; }
+    c[0] = expm1(z.real());
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> log(const StaticMultiComplex<N, T>& z) {
+    using std::log;
+    const T x0 = z.real();
+    std::array<T, N + 1> c;
+    c[0] = log(x0);
+    T xk = x0;
+    for (int k = 1; k <= N; ++k, xk *= x0) { c[k] = ((k % 2 == 1) ? 1 : -1) / (k * xk); }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> log1p(const StaticMultiComplex<N, T>& z) {
+    using std::log1p;
+    const T x0 = 1 + z.real();
+    std::array<T, N + 1> c;
+    c[0] = log1p(z.real());
+    T xk = x0;
+    for (int k = 1; k <= N; ++k, xk *= x0) { c[k] = ((k % 2 == 1) ? 1 : -1) / (k * xk); }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> log10(const StaticMultiComplex<N, T>& z) {
+    using std::log;
+    return log(z) / log(T(10));
+}
+
+/// Integer powers by repeated multiplication, which also works at a real part of zero
+template<int N, typename T>
+StaticMultiComplex<N, T> pow(const StaticMultiComplex<N, T>& z, int n) {
+    if (n < 0) { return inv(pow(z, -n)); }
+    StaticMultiComplex<N, T> r(T(1)), x = z;
+    for (; n > 0; n /= 2) {
+        if (n % 2 == 1) { r = r * x; }
+        if (n > 1) { x = x * x; }
+    }
+    return r;
+}
+
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> pow(const StaticMultiComplex<N, T>& z, const S& p) {
+    using std::pow; using std::floor;
+    if constexpr (std::is_integral_v<S>) {
+        return pow(z, static_cast<int>(p));
+    }
+    else {
+        const T p_ = p;
+        if (p_ >= 0 && p_ <= 64 && floor(p_) == p_) {
+            return pow(z, static_cast<int>(p_));
+        }
+        const T x0 = z.real();
+        return detail::taylor(z, detail::power_coefficients<N, T>(x0, pow(x0, p_), p_));
+    }
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> pow(const StaticMultiComplex<N, T>& z, const StaticMultiComplex<N, T>& p) { return exp(p * log(z)); }
+
+template<int N, typename T, typename S, detail::if_scalar<S, T> = 0>
+StaticMultiComplex<N, T> pow(const S& a, const StaticMultiComplex<N, T>& p) {
+    using std::log;
+    return exp(p * log(T(a)));
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> sqrt(const StaticMultiComplex<N, T>& z) {
+    using std::sqrt;
+    const T x0 = z.real();
+    return detail::taylor(z, detail::power_coefficients<N, T>(x0, sqrt(x0), T(0.5)));
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> cbrt(const StaticMultiComplex<N, T>& z) {
+    using std::cbrt;
+    const T x0 = z.real();
+    return detail::taylor(z, detail::power_coefficients<N, T>(x0, cbrt(x0), T(1) / 3));
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> sin(const StaticMultiComplex<N, T>& z) {
+    using std::sin; using std::cos;
+    const std::array<T, 4> cycle = { sin(z.real()), cos(z.real()), -sin(z.real()), -cos(z.real()) };
+    std::array<T, N + 1> c;
+    T factorial = 1;
+    for (int k = 0; k <= N; ++k) { if (k > 0) { factorial *= k; } c[k] = cycle[k % 4] / factorial; }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> cos(const StaticMultiComplex<N, T>& z) {
+    using std::sin; using std::cos;
+    const std::array<T, 4> cycle = { cos(z.real()), -sin(z.real()), -cos(z.real()), sin(z.real()) };
+    std::array<T, N + 1> c;
+    T factorial = 1;
+    for (int k = 0; k <= N; ++k) { if (k > 0) { factorial *= k; } c[k] = cycle[k % 4] / factorial; }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> tan(const StaticMultiComplex<N, T>& z) { return sin(z) / cos(z); }
+
+template<int N, typename T>
+StaticMultiComplex<N, T> sinh(const StaticMultiComplex<N, T>& z) {
+    using std::sinh; using std::cosh;
+    const std::array<T, 2> cycle = { sinh(z.real()), cosh(z.real()) };
+    std::array<T, N + 1> c;
+    T factorial = 1;
+    for (int k = 0; k <= N; ++k) { if (k > 0) { factorial *= k; } c[k] = cycle[k % 2] / factorial; }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> cosh(const StaticMultiComplex<N, T>& z) {
+    using std::sinh; using std::cosh;
+    const std::array<T, 2> cycle = { cosh(z.real()), sinh(z.real()) };
+    std::array<T, N + 1> c;
+    T factorial = 1;
+    for (int k = 0; k <= N; ++k) { if (k > 0) { factorial *= k; } c[k] = cycle[k % 2] / factorial; }
+    return detail::taylor(z, c);
+}
+
+template<int N, typename T>
+StaticMultiComplex<N, T> tanh(const StaticMultiComplex<N, T>& z) { return sinh(z) / cosh(z); }
+
+template<int N, typename T>
+StaticMultiComplex<N, T> abs(const StaticMultiComplex<N, T>& z) { return (z.real() < 0) ? -z : z; }
+
+}
+
+using static_mcx::StaticMultiComplex;
+using static_mcx::is_static_mcx_t;
+
+/// The step h of the multicomplex step derivatives of order N: 1e-100, or larger for high orders, so that h^N stays 1e100 above the
+/// smallest normal number of T
+template<int N, typename T>
+T get_static_mcx_step() {
+    using std::pow;
+    const double e = std::min(100.0, (-static_cast<double>(std::numeric_limits<T>::min_exponent10) - 100.0) / std::max(N, 1));
+    return pow(T(10), T(-e));
+}
+
+/**
+ \brief The derivatives of order 0 to N of f at x, from one evaluation of f at x + h(i_1 + ... + i_N), a StaticMultiComplex<N, T>
+
+ The derivative of order k is the coefficient of i_1 ... i_k of the result, divided by h^k.  As diff_mcx1 with and_val = true
+ */
+template<int N, typename T, typename Function>
+std::array<T, N + 1> diff_static_mcx1(const Function& f, const T& x) {
+    const T h = get_static_mcx_step<N, T>();
+    StaticMultiComplex<N, T> z(x);
+    for (int k = 0; k < N; ++k) { z.coef[std::size_t(1) << k] = h; }
+    const StaticMultiComplex<N, T> fz = f(z);
+    std::array<T, N + 1> ders;
+    T hk = 1;
+    for (int k = 0; k <= N; ++k) {
+        ders[k] = fz.coef[(std::size_t(1) << k) - 1] / hk;
+        hk *= h;
+    }
+    return ders;
+}
+
+/**
+ \brief The mixed derivative of f, of order orders[m] in xs[m], from one evaluation of f at the StaticMultiComplex<N, T> of the
+ variables, in which N is the total order
+
+ The variable m is perturbed along orders[m] imaginary units of its own.  As diff_mcxN
+ */
+template<int N, typename T, std::size_t M, typename Function>
+T diff_static_mcxN(const Function& f, const std::array<T, M>& xs, const std::array<int, M>& orders) {
+    const T h = get_static_mcx_step<N, T>();
+    std::array<StaticMultiComplex<N, T>, M> zs;
+    int unit = 0;
+    for (std::size_t m = 0; m < M; ++m) {
+        zs[m] = StaticMultiComplex<N, T>(xs[m]);
+        for (int k = 0; k < orders[m]; ++k, ++unit) {
+            if (unit == N) { throw std::invalid_argument("The orders of the derivatives add up to more than N in diff_static_mcxN"); }
+            zs[m].coef[std::size_t(1) << unit] = h;
+        }
+    }
+    if (unit != N) { throw std::invalid_argument("The orders of the derivatives add up to less than N in diff_static_mcxN"); }
+    const StaticMultiComplex<N, T> fz = f(zs);
+    T hN = 1;
+    for (int k = 0; k < N; ++k) { hN *= h; }
+    return fz.coef[StaticMultiComplex<N, T>::size - 1] / hN;
+}
+
+/**
+ \brief The Hessian of f at x, from N(N+1)/2 evaluations of f at arrays of StaticMultiComplex<2, T>, in which x_i is perturbed along
+ i_1 and x_j along i_2 for the element (i, j)
+ */
+template<typename T, typename Function, typename Vector>
+Eigen::Array<T, Eigen::Dynamic, Eigen::Dynamic> get_static_mcx_Hessian(const Function& f, const Vector& x) {
+    using mcx2 = StaticMultiComplex<2, T>;
+    const T h = get_static_mcx_step<2, T>();
+    const auto N = x.size();
+    Eigen::Array<mcx2, Eigen::Dynamic, 1> z(N);
+    Eigen::Array<T, Eigen::Dynamic, Eigen::Dynamic> H(N, N);
+    for (auto i = 0; i < N; ++i) {
+        for (auto j = i; j < N; ++j) {
+            for (auto k = 0; k < N; ++k) { z[k] = mcx2(x[k]); }
+            z[i].coef[1] = h;
+            z[j].coef[2] = h;
+            const mcx2 fz = f(z);
+            H(i, j) = fz.coef[3] / (h * h);
+            H(j, i) = H(i, j);
+        }
+    }
+    return H;
+}
+
+}
+
+// See https://eigen.tuxfamily.org/dox/TopicCustomizing_CustomScalar.html
+namespace Eigen {
+    template<int N, typename T> struct NumTraits<teqp::static_mcx::StaticMultiComplex<N, T>> : NumTraits<double>
+    {
+        using Real = teqp::StaticMultiComplex<N, T>;
+        using NonInteger = teqp::StaticMultiComplex<N, T>;
+        using Nested = teqp::StaticMultiComplex<N, T>;
+        using Literal = teqp::StaticMultiComplex<N, T>;
+        enum {
+            IsComplex = 0,
+            IsInteger = 0,
+            IsSigned = 1,
+            RequireInitialization = 1,
+            ReadCost = 1 << N,
+            AddCost = 1 << N,
+            MulCost = (1 << N) * (1 << N)
+        };
+    };
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+namespace teqp {
+
+/**
+ \brief Storage of a T that is private to each thread, for the memos and scratch buffers of models
+
+ The const methods of the models may be called concurrently from several threads on the same instance, so a memo held
+ by the model (a mutable member) would need a lock, which serializes the evaluations, and the threads would evict each
+ other's entries. Each PerThreadStore instead gives each thread its own T, default-constructed on first use in that thread,
+ without any locking.
+
+ The T of all the stores live in a thread_local map keyed on a number that is unique to each store (copies and reset() take
+ a new one), so that the entries of a destroyed store are never handed to a new store at the same address. The entries of
+ destroyed stores are not freed until the thread exits, or until more than max_stores stores were used in that thread, at
+ which point the other entries are dropped; a reference returned by local() is thus valid until the next call of local()
+ on another store in the same thread.
+ */
+template<typename T>
+class PerThreadStore {
+private:
+    std::uint64_t id;
+    static std::uint64_t next_id() {
+        static std::atomic<std::uint64_t> counter{ 0 };
+        return ++counter;
+    }
+public:
+    static constexpr std::size_t max_stores = 256;
+
+    PerThreadStore() : id(next_id()) {}
+    PerThreadStore(const PerThreadStore&) : id(next_id()) {}
+    PerThreadStore& operator=(const PerThreadStore&) { id = next_id(); return *this; }
+
+    /// Drop the contents in all the threads (the old entries are orphaned); not to be called concurrently with local()
+    void reset() { id = next_id(); }
+
+    /// The T of the calling thread
+    T& local() const {
+        thread_local std::unordered_map<std::uint64_t, T> stores;
+        auto it = stores.find(id);
+        if (it == stores.end()) {
+            if (stores.size() >= max_stores) {
+                stores.clear();
+            }
+            it = stores.emplace(id, T{}).first;
+        }
+        return it->second;
+    }
+};
+
+}
@@ -18,6 +18,8 @@ namespace teqp {
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
 #include "MultiComplex/MultiComplex.hpp"
 #endif
+#include "teqp/multicomplex_static.hpp"
+#include "teqp/vector_dual.hpp"
 
 #include <valarray>
 #include <chrono>
@@ -52,10 +54,26 @@ namespace teqp {
         else if constexpr (isDual<T> || isExpr<T>) {
             return autodiff::detail::eval(expr);
         }
+        else if constexpr (std::is_base_of_v<Eigen::EigenBase<std::decay_t<T>>, std::decay_t<T>>) {
+            // Eigen expressions hold references to their operands, which may be temporaries
+            return expr.eval();
+        }
         else {
             return expr;
         }
     }
+
+    /// The constant c in the numerical type T.  T may also be a fixed-size Eigen array, a packet of values
+    /// that are processed together (see get_alphar_many), which cannot be converted from a double
+    template<typename T>
+    T make_constant(double c) {
+        if constexpr (std::is_base_of_v<Eigen::EigenBase<T>, T>) {
+            return T::Constant(c);
+        }
+        else {
+            return static_cast<T>(c);
+        }
+    }
     
     /// A constexpr function for ensuring that an argument to a function is NOT an expr,
     /// which can have surprising behavior
@@ -78,6 +96,22 @@ namespace teqp {
     template<typename T> struct is_mcx_t<mcx::MultiComplex<T>> : public std::true_type {};
 #endif
 
+    /// The order of the derivatives carried by the numerical type: 0 for arithmetic types, the order of the autodiff
+    /// dual and real types, and -1 if it is not known (complex step and multicomplex types, for instance)
+    template<typename T>
+    constexpr int get_derivative_order() {
+        using namespace autodiff::detail;
+        if constexpr (std::is_arithmetic_v<T>) {
+            return 0;
+        }
+        else if constexpr (isDual<T> || isReal<T>) {
+            return static_cast<int>(NumberTraits<T>::Order);
+        }
+        else {
+            return -1;
+        }
+    }
+
     // Extract the underlying value from more complicated numerical types, like complex step types with
     // a tiny increment in the imaginary direction
     template<typename T>
@@ -104,6 +138,21 @@ namespace teqp {
             return expr.real();
 #endif
         }
+        else if constexpr (is_static_mcx_t<T>()) {
+#if defined(TEQP_MULTIPRECISION_ENABLED)
+            if constexpr (boost::multiprecision::is_number<typename T::value_type>()) {
+                return static_cast<double>(expr.real());
+            }
+            else {
+                return expr.real();
+            }
+#else
+            return expr.real();
+#endif
+        }
+        else if constexpr (is_vector_dual_t<T>()) {
+            return expr.val;
+        }
 #if defined(TEQP_MULTIPRECISION_ENABLED)
         else if constexpr (boost::multiprecision::is_number<T>()) {
             return static_cast<double>(expr);
@@ -128,12 +177,26 @@ namespace teqp {
         }
     };
 
+    /// True if the two containers have the same length and exactly the same values, used to check whether cached composition-dependent values can be re-used
+    template<typename A, typename B>
+    bool all_same_values(const A& a, const B& b) {
+        if (static_cast<std::size_t>(a.size()) != static_cast<std::size_t>(b.size())) {
+            return false;
+        }
+        for (auto i = 0; i < a.size(); ++i) {
+            if (a[i] != b[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /// From Ulrich Deiters
     template <typename T>                             // arbitrary integer power
     T powi(const T& x, int n) {
         switch (n) {
         case 0:
-            return static_cast<T>(1.0);                       // x^0 = 1 even for x == 0
+            return make_constant<T>(1.0);                     // x^0 = 1 even for x == 0
         case 1:
             return static_cast<T>(x);
         case 2:
@@ -150,7 +213,7 @@ namespace teqp {
                 return eval(powi(eval(1.0 / x), -n));
             }
             else {
-                return powi(static_cast<T>(1.0) / x, -n);
+                return powi(static_cast<T>(make_constant<T>(1.0) / x), -n);
             }
         }
         else {
@@ -171,8 +234,7 @@ namespace teqp {
     template<typename T>
     inline auto powIVi(const T& x, const Eigen::ArrayXi& e) {
         //return e.binaryExpr(e.cast<T>(), [&x](const auto&& a_, const auto& e_) {return static_cast<T>(powi(x, a_)); });
-        static Eigen::Array<T, Eigen::Dynamic, 1> o;
-        o.resize(e.size());
+        Eigen::Array<T, Eigen::Dynamic, 1> o(e.size());
         for (auto i = 0; i < e.size(); ++i) {
             o[i] = powi(x, e[i]);
         }
@@ -202,6 +264,22 @@ namespace teqp {
         }
         return o;
     }
+    template<int N, typename T>
+    auto pow(const StaticMultiComplex<N, T>& x, const Eigen::ArrayXd& e) {
+        Eigen::Array<StaticMultiComplex<N, T>, Eigen::Dynamic, 1> o(e.size());
+        for (auto i = 0; i < e.size(); ++i) {
+            o[i] = pow(x, e[i]);
+        }
+        return o;
+    }
+    template<int Order, typename T, int MaxN>
+    auto pow(const VectorDual<Order, T, MaxN>& x, const Eigen::ArrayXd& e) {
+        Eigen::Array<VectorDual<Order, T, MaxN>, Eigen::Dynamic, 1> o(e.size());
+        for (auto i = 0; i < e.size(); ++i) {
+            o[i] = pow(x, e[i]);
+        }
+        return o;
+    }
 #if defined(TEQP_MULTICOMPLEX_ENABLED)
     template<typename T>
     auto pow(const mcx::MultiComplex<T>& x, const Eigen::ArrayXd& e) {
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+namespace teqp {
+
+// The operators and the elementary functions are in their own namespace, where they are found by argument-dependent lookup,
+// so that they do not hide those of the standard library for the unqualified calls with double arguments in namespace teqp
+namespace vector_dual {
+
+/**
+ \brief A vector-mode forward dual number: a value with its derivatives along n directions at once, and, for Order = 2, its
+ second derivatives in each pair of directions
+
+ The derivatives are held in fixed-size arrays of capacity MaxN, so no operation allocates, and the loops over the directions are
+ plain loops over contiguous memory that the compiler vectorizes.  Where autodiff's gradient and hessian evaluate the function
+ once per direction (or pair of directions), one evaluation with VectorDual numbers gives the whole gradient, and, with Order = 2,
+ the whole Hessian.  The second derivatives are held as the lower triangle of the symmetric Hessian, packed by rows.
+
+ A number made from a scalar is a constant, with n = 0 directions; the result of an operation has the directions of its
+ arguments, which must all have the same number of directions if they are not constants.  The comparison operators compare the
+ values, as those of the autodiff types do.
+ */
+template<int Order, typename T = double, int MaxN = 8>
+class VectorDual {
+    static_assert(Order == 1 || Order == 2, "The order of a VectorDual must be 1 or 2");
+public:
+    static constexpr int order = Order;
+    static constexpr int max_size = MaxN;
+    static constexpr int hessian_size = (Order == 2) ? MaxN * (MaxN + 1) / 2 : 0;
+    using value_type = T;
+
+    T val = 0;
+    int n = 0; ///< The number of directions; the first n elements of grad (and the first n(n+1)/2 of hess) are in use
+    std::array<T, MaxN> grad;
+    std::array<T, hessian_size> hess;
+
+    VectorDual() {};
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U, T>>>
+    VectorDual(const U& v) : val(static_cast<T>(v)) {};
+
+    /// The independent variable i of n, with value v
+    static VectorDual variable(const T& v, int i, int n) {
+        if (n > MaxN) { throw std::invalid_argument("Too many directions for the capacity of the VectorDual"); }
+        VectorDual x(v);
+        x.n = n;
+        for (int k = 0; k < n; ++k) { x.grad[k] = 0; }
+        x.grad[i] = 1;
+        if constexpr (Order == 2) {
+            for (int k = 0; k < n * (n + 1) / 2; ++k) { x.hess[k] = 0; }
+        }
+        return x;
+    }
+
+    /// The second derivative in the directions i and j
+    T hessian(int i, int j) const {
+        static_assert(Order == 2, "Only the VectorDual of order 2 carry second derivatives");
+        if (n == 0) { return 0; }
+        return (i >= j) ? hess[i * (i + 1) / 2 + j] : hess[j * (j + 1) / 2 + i];
+    }
+
+    VectorDual operator-() const {
+        VectorDual o = *this;
+        o.val = -val;
+        for (int k = 0; k < n; ++k) { o.grad[k] = -grad[k]; }
+        if constexpr (Order == 2) {
+            for (int k = 0; k < n * (n + 1) / 2; ++k) { o.hess[k] = -hess[k]; }
+        }
+        return o;
+    }
+    VectorDual operator+() const { return *this; }
+
+    VectorDual& operator+=(const VectorDual& w) { return *this = *this + w; }
+    VectorDual& operator-=(const VectorDual& w) { return *this = *this - w; }
+    VectorDual& operator*=(const VectorDual& w) { return *this = *this * w; }
+    VectorDual& operator/=(const VectorDual& w) { return *this = *this / w; }
+};
+
+template<typename T> struct is_vector_dual_t : std::false_type {};
+template<int Order, typename T, int MaxN> struct is_vector_dual_t<VectorDual<Order, T, MaxN>> : std::true_type {};
+
+namespace detail {
+    /// f(x), from the value f0 and the first and second derivatives f1 and f2 of f at the value of x
+    template<int Order, typename T, int MaxN>
+    VectorDual<Order, T, MaxN> chain(const VectorDual<Order, T, MaxN>& x, const T& f0, const T& f1, const T& f2) {
+        VectorDual<Order, T, MaxN> r(f0);
+        const int n = r.n = x.n;
+        for (int i = 0; i < n; ++i) { r.grad[i] = f1 * x.grad[i]; }
+        if constexpr (Order == 2) {
+            for (int i = 0, k = 0; i < n; ++i) {
+                const T f2gi = f2 * x.grad[i];
+                for (int j = 0; j <= i; ++j, ++k) { r.hess[k] = f1 * x.hess[k] + f2gi * x.grad[j]; }
+            }
+        }
+        return r;
+    }
+
+    /// ca*a + cb*b, with the value v
+    template<int Order, typename T, int MaxN>
+    VectorDual<Order, T, MaxN> linear(const VectorDual<Order, T, MaxN>& a, const T& ca, const VectorDual<Order, T, MaxN>& b, const T& cb, const T& v) {
+        if (a.n == 0) { return chain(b, v, cb, T(0)); }
+        if (b.n == 0) { return chain(a, v, ca, T(0)); }
+        if (a.n != b.n) { throw std::invalid_argument("The VectorDual arguments have different numbers of directions"); }
+        VectorDual<Order, T, MaxN> r(v);
+        const int n = r.n = a.n;
+        for (int i = 0; i < n; ++i) { r.grad[i] = ca * a.grad[i] + cb * b.grad[i]; }
+        if constexpr (Order == 2) {
+            for (int k = 0; k < n * (n + 1) / 2; ++k) { r.hess[k] = ca * a.hess[k] + cb * b.hess[k]; }
+        }
+        return r;
+    }
+
+    /**
+     f(a, b), from the value f0, the first derivatives fa and fb, and the second derivatives faa, fab and fbb of f at the values
+     of a and b
+     */
+    template<int Order, typename T, int MaxN>
+    VectorDual<Order, T, MaxN> chain2(const VectorDual<Order, T, MaxN>& a, const VectorDual<Order, T, MaxN>& b, const T& f0, const T& fa, const T& fb, const T& faa, const T& fab, const T& fbb) {
+        if (a.n == 0) { return chain(b, f0, fb, fbb); }
+        if (b.n == 0) { return chain(a, f0, fa, faa); }
+        if (a.n != b.n) { throw std::invalid_argument("The VectorDual arguments have different numbers of directions"); }
+        VectorDual<Order, T, MaxN> r(f0);
+        const int n = r.n = a.n;
+        for (int i = 0; i < n; ++i) { r.grad[i] = fa * a.grad[i] + fb * b.grad[i]; }
+        if constexpr (Order == 2) {
+            for (int i = 0, k = 0; i < n; ++i) {
+                const T ai = faa * a.grad[i] + fab * b.grad[i], bi = fab * a.grad[i] + fbb * b.grad[i];
+                for (int j = 0; j <= i; ++j, ++k) {
+                    r.hess[k] = fa * a.hess[k] + fb * b.hess[k] + ai * a.grad[j] + bi * b.grad[j];
+                }
+            }
+        }
+        return r;
+    }
+
+    /// The scalars that combine with a VectorDual<Order, T, MaxN> without being converted to it first
+    template<typename S, typename T>
+    using if_scalar = std::enable_if_t<std::is_arithmetic_v<S> || std::is_same_v<S, T>, int>;
+}
+
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> operator+(const VectorDual<Order, T, MaxN>& a, const VectorDual<Order, T, MaxN>& b) { return detail::linear(a, T(1), b, T(1), a.val + b.val); }
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> operator-(const VectorDual<Order, T, MaxN>& a, const VectorDual<Order, T, MaxN>& b) { return detail::linear(a, T(1), b, T(-1), a.val - b.val); }
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> operator*(const VectorDual<Order, T, MaxN>& a, const VectorDual<Order, T, MaxN>& b) {
+    return detail::chain2(a, b, a.val * b.val, b.val, a.val, T(0), T(1), T(0));
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> operator/(const VectorDual<Order, T, MaxN>& a, const VectorDual<Order, T, MaxN>& b) {
+    const T binv = 1 / b.val, q = a.val * binv;
+    return detail::chain2(a, b, q, binv, -q * binv, T(0), -binv * binv, 2 * q * binv * binv);
+}
+
+// With scalars
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator+(VectorDual<Order, T, MaxN> a, const S& b) { a.val += b; return a; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator+(const S& a, VectorDual<Order, T, MaxN> b) { b.val += a; return b; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator-(VectorDual<Order, T, MaxN> a, const S& b) { a.val -= b; return a; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator-(const S& a, const VectorDual<Order, T, MaxN>& b) { auto o = -b; o.val += a; return o; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator*(const VectorDual<Order, T, MaxN>& a, const S& b) { return detail::chain(a, T(a.val * b), T(b), T(0)); }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator*(const S& a, const VectorDual<Order, T, MaxN>& b) { return detail::chain(b, T(a * b.val), T(a), T(0)); }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator/(const VectorDual<Order, T, MaxN>& a, const S& b) { const T binv = 1 / T(b); return detail::chain(a, a.val * binv, binv, T(0)); }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> operator/(const S& a, const VectorDual<Order, T, MaxN>& b) {
+    const T binv = 1 / b.val, q = a * binv;
+    return detail::chain(b, q, -q * binv, 2 * q * binv * binv);
+}
+
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN>& operator+=(VectorDual<Order, T, MaxN>& a, const S& b) { a.val += b; return a; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN>& operator-=(VectorDual<Order, T, MaxN>& a, const S& b) { a.val -= b; return a; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN>& operator*=(VectorDual<Order, T, MaxN>& a, const S& b) { return a = a * b; }
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN>& operator/=(VectorDual<Order, T, MaxN>& a, const S& b) { return a = a / b; }
+
+// Comparisons of the values
+#define TEQP_VECTOR_DUAL_COMPARISON(OP) \
+template<int Order, typename T, int MaxN> \
+bool operator OP(const VectorDual<Order, T, MaxN>& a, const VectorDual<Order, T, MaxN>& b) { return a.val OP b.val; } \
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0> \
+bool operator OP(const VectorDual<Order, T, MaxN>& a, const S& b) { return a.val OP b; } \
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0> \
+bool operator OP(const S& a, const VectorDual<Order, T, MaxN>& b) { return a OP b.val; }
+TEQP_VECTOR_DUAL_COMPARISON(<)
+TEQP_VECTOR_DUAL_COMPARISON(>)
+TEQP_VECTOR_DUAL_COMPARISON(<=)
+TEQP_VECTOR_DUAL_COMPARISON(>=)
+TEQP_VECTOR_DUAL_COMPARISON(==)
+TEQP_VECTOR_DUAL_COMPARISON(!=)
+#undef TEQP_VECTOR_DUAL_COMPARISON
+
+// The elementary functions, from their first and second derivatives
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> exp(const VectorDual<Order, T, MaxN>& x) {
+    using std::exp;
+    const T e = exp(x.val);
+    return detail::chain(x, e, e, e);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> expm1(const VectorDual<Order, T, MaxN>& x) {
+    using std::exp; using std::expm1;
+    const T e = exp(x.val);
+    return detail::chain(x, T(expm1(x.val)), e, e);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> log(const VectorDual<Order, T, MaxN>& x) {
+    using std::log;
+    const T xinv = 1 / x.val;
+    return detail::chain(x, T(log(x.val)), xinv, -xinv * xinv);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> log1p(const VectorDual<Order, T, MaxN>& x) {
+    using std::log1p;
+    const T xinv = 1 / (1 + x.val);
+    return detail::chain(x, T(log1p(x.val)), xinv, -xinv * xinv);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> log10(const VectorDual<Order, T, MaxN>& x) {
+    using std::log;
+    const T c = 1 / log(T(10)), xinv = 1 / x.val;
+    return detail::chain(x, T(log(x.val) * c), c * xinv, -c * xinv * xinv);
+}
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> pow(const VectorDual<Order, T, MaxN>& x, const S& p) {
+    using std::pow;
+    const T p_ = p;
+    if (p_ == 0) { return VectorDual<Order, T, MaxN>(T(1)); }
+    if (p_ == 1) { return x; }
+    if (p_ == 2) { return x * x; }
+    const T f = pow(x.val, p_);
+    if (x.val == 0) {
+        return detail::chain(x, f, T(p_ * pow(x.val, p_ - 1)), T(p_ * (p_ - 1) * pow(x.val, p_ - 2)));
+    }
+    const T d1 = p_ * f / x.val;
+    return detail::chain(x, f, d1, (p_ - 1) * d1 / x.val);
+}
+template<int Order, typename T, int MaxN, typename S, detail::if_scalar<S, T> = 0>
+VectorDual<Order, T, MaxN> pow(const S& a, const VectorDual<Order, T, MaxN>& p) {
+    using std::pow; using std::log;
+    const T f = pow(T(a), p.val), la = log(T(a));
+    return detail::chain(p, f, f * la, f * la * la);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> pow(const VectorDual<Order, T, MaxN>& x, const VectorDual<Order, T, MaxN>& p) {
+    if (p.n == 0) { return pow(x, p.val); }
+    using std::pow; using std::log;
+    const T f = pow(x.val, p.val), lx = log(x.val), xinv = 1 / x.val;
+    return detail::chain2(x, p, f, f * p.val * xinv, f * lx, f * p.val * (p.val - 1) * xinv * xinv, f * xinv * (1 + p.val * lx), f * lx * lx);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> sqrt(const VectorDual<Order, T, MaxN>& x) {
+    using std::sqrt;
+    const T s = sqrt(x.val), d1 = 0.5 / s;
+    return detail::chain(x, s, d1, -0.5 * d1 / x.val);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> cbrt(const VectorDual<Order, T, MaxN>& x) {
+    using std::cbrt;
+    const T c = cbrt(x.val), d1 = c / (3 * x.val);
+    return detail::chain(x, c, d1, T(-2) / 3 * d1 / x.val);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> sin(const VectorDual<Order, T, MaxN>& x) {
+    using std::sin; using std::cos;
+    const T s = sin(x.val);
+    return detail::chain(x, s, T(cos(x.val)), -s);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> cos(const VectorDual<Order, T, MaxN>& x) {
+    using std::sin; using std::cos;
+    const T c = cos(x.val);
+    return detail::chain(x, c, T(-sin(x.val)), -c);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> tan(const VectorDual<Order, T, MaxN>& x) {
+    using std::tan;
+    const T t = tan(x.val), d1 = 1 + t * t;
+    return detail::chain(x, t, d1, 2 * t * d1);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> asin(const VectorDual<Order, T, MaxN>& x) {
+    using std::asin; using std::sqrt;
+    const T r = 1 / (1 - x.val * x.val), d1 = sqrt(r);
+    return detail::chain(x, T(asin(x.val)), d1, x.val * d1 * r);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> acos(const VectorDual<Order, T, MaxN>& x) {
+    using std::acos; using std::sqrt;
+    const T r = 1 / (1 - x.val * x.val), d1 = sqrt(r);
+    return detail::chain(x, T(acos(x.val)), -d1, -x.val * d1 * r);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> atan(const VectorDual<Order, T, MaxN>& x) {
+    using std::atan;
+    const T d1 = 1 / (1 + x.val * x.val);
+    return detail::chain(x, T(atan(x.val)), d1, -2 * x.val * d1 * d1);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> sinh(const VectorDual<Order, T, MaxN>& x) {
+    using std::sinh; using std::cosh;
+    const T s = sinh(x.val);
+    return detail::chain(x, s, T(cosh(x.val)), s);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> cosh(const VectorDual<Order, T, MaxN>& x) {
+    using std::sinh; using std::cosh;
+    const T c = cosh(x.val);
+    return detail::chain(x, c, T(sinh(x.val)), c);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> tanh(const VectorDual<Order, T, MaxN>& x) {
+    using std::tanh;
+    const T t = tanh(x.val), d1 = 1 - t * t;
+    return detail::chain(x, t, d1, -2 * t * d1);
+}
+template<int Order, typename T, int MaxN>
+VectorDual<Order, T, MaxN> abs(const VectorDual<Order, T, MaxN>& x) { return (x.val < 0) ? -x : x; }
+
+}
+
+using vector_dual::VectorDual;
+using vector_dual::is_vector_dual_t;
+
+using vdual = VectorDual<1>; ///< Carries the gradient in up to 8 directions
+using vdual2nd = VectorDual<2>; ///< Carries the gradient and the Hessian in up to 8 directions
+
+}
+
+// See https://eigen.tuxfamily.org/dox/TopicCustomizing_CustomScalar.html
+namespace Eigen {
+    template<int Order, typename T, int MaxN> struct NumTraits<teqp::vector_dual::VectorDual<Order, T, MaxN>> : NumTraits<double>
+    {
+        using Real = teqp::vector_dual::VectorDual<Order, T, MaxN>;
+        using NonInteger = teqp::vector_dual::VectorDual<Order, T, MaxN>;
+        using Nested = teqp::vector_dual::VectorDual<Order, T, MaxN>;
+        using Literal = teqp::vector_dual::VectorDual<Order, T, MaxN>;
+        enum {
+            IsComplex = 0,
+            IsInteger = 0,
+            IsSigned = 1,
+            RequireInitialization = 1,
+            ReadCost = 1,
+            AddCost = MaxN,
+            MulCost = (Order == 2) ? MaxN * MaxN : MaxN
+        };
+    };
+    // The mixed operations with the scalars of the value type, as for the autodiff types
+    template<int Order, typename T, int MaxN, typename BinOp>
+    struct ScalarBinaryOpTraits<teqp::vector_dual::VectorDual<Order, T, MaxN>, T, BinOp> { using ReturnType = teqp::vector_dual::VectorDual<Order, T, MaxN>; };
+    template<int Order, typename T, int MaxN, typename BinOp>
+    struct ScalarBinaryOpTraits<T, teqp::vector_dual::VectorDual<Order, T, MaxN>, BinOp> { using ReturnType = teqp::vector_dual::VectorDual<Order, T, MaxN>; };
+}
@@ -6,6 +6,12 @@
 #include <unordered_map>
 #include <variant>
 #include <atomic>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdint>
 
 #include "teqp/cpp/teqpcpp.hpp"
 #include "teqp/exceptions.hpp"
@@ -30,11 +36,166 @@
 
 using namespace teqp;
 
-// An atomic is used here for thread safety
-// The max possible index is 18,446,744,073,709,551,615
-std::atomic<long long int> next_index{ 0 };
+/**
+ \brief The models built through the C interface, addressed by handles
 
-std::unordered_map<unsigned long long int, std::shared_ptr<teqp::cppinterface::AbstractModel>> library;
+ A handle holds the index of a slot in its low 32 bits and the generation of the slot in the high bits. Freeing a model
+ increments the generation of its slot, so handles of freed models are rejected even once the slot has been reused. The
+ generation wraps around at 2^31, so that the handles are never negative.
+
+ Looking up a model (ModelRegistry::pin) takes no lock: the reader increments one of the pin counters of the slot,
+ then checks the generation, with sequentially consistent atomics. The counters are sharded over cache lines by thread,
+ so that threads evaluating the same model do not all write to the same line. Freeing a model bumps the generation,
+ takes the model out of the slot, and waits for the pins to drain before deleting it; so free_model may wait for
+ evaluations in flight with the same model, but never for other models. Building and freeing take a mutex that
+ protects the list of free slots, and readers never take it; it is not held while freeing waits for the pins.
+
+ Slots are allocated in chunks that are never moved or released before the registry is destroyed, so a slot can be
+ found from its index without a lock.
+ */
+class ModelRegistry {
+public:
+    using Handle = long long int;
+private:
+    static constexpr std::size_t Nshards = 8, ChunkSize = 256, MaxChunks = 4096;
+    static constexpr std::uint32_t GenerationMask = 0x7FFFFFFFu;
+
+    struct alignas(64) PinCounter {
+        std::atomic<int> n{ 0 };
+    };
+    struct Slot {
+        std::array<PinCounter, Nshards> pins;
+        std::atomic<std::uint32_t> generation{ 0 };
+        std::atomic<cppinterface::AbstractModel*> model{ nullptr };
+    };
+    struct Chunk {
+        std::array<Slot, ChunkSize> slots;
+    };
+
+    std::array<std::atomic<Chunk*>, MaxChunks> chunks{};
+    std::mutex mtx; ///< Held by emplace and erase, for the free slots and the allocation of chunks
+    std::vector<std::uint32_t> free_slots;
+    std::uint32_t Nslots = 0;
+
+    static std::size_t get_shard() {
+        static std::atomic<std::size_t> next_shard{ 0 };
+        thread_local const std::size_t shard = next_shard++ % Nshards;
+        return shard;
+    }
+
+    Slot* find_slot(const std::uint32_t index) const {
+        if (index / ChunkSize >= MaxChunks) {
+            return nullptr;
+        }
+        Chunk* chunk = chunks[index / ChunkSize].load(std::memory_order_acquire);
+        return (chunk == nullptr) ? nullptr : &chunk->slots[index % ChunkSize];
+    }
+
+    static bool is_pinned(const Slot& slot) {
+        for (const auto& p : slot.pins) {
+            if (p.n.load() != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    /// Keeps a model alive (see ModelRegistry::erase) for as long as it exists
+    class Pin {
+        friend class ModelRegistry;
+        std::atomic<int>* const counter;
+        const cppinterface::AbstractModel* const model;
+        Pin(std::atomic<int>* counter, const cppinterface::AbstractModel* model) : counter(counter), model(model) {}
+    public:
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+        ~Pin() { counter->fetch_sub(1); }
+        const cppinterface::AbstractModel& operator*() const { return *model; }
+        const cppinterface::AbstractModel* operator->() const { return model; }
+    };
+
+    ModelRegistry() = default;
+    ModelRegistry(const ModelRegistry&) = delete;
+    ModelRegistry& operator=(const ModelRegistry&) = delete;
+    ~ModelRegistry() {
+        for (auto& c : chunks) {
+            Chunk* chunk = c.load();
+            if (chunk == nullptr) { continue; }
+            for (auto& slot : chunk->slots) {
+                delete slot.model.load();
+            }
+            delete chunk;
+        }
+    }
+
+    /// Take ownership of the model and return its handle
+    Handle emplace(std::unique_ptr<cppinterface::AbstractModel>&& model) {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::uint32_t index;
+        if (!free_slots.empty()) {
+            index = free_slots.back();
+            free_slots.pop_back();
+        }
+        else {
+            if (Nslots / ChunkSize >= MaxChunks) {
+                throw teqpcException(31, "Too many models are loaded at once");
+            }
+            auto& c = chunks[Nslots / ChunkSize];
+            if (c.load() == nullptr) {
+                c.store(new Chunk(), std::memory_order_release);
+            }
+            index = Nslots++;
+        }
+        Slot* slot = find_slot(index);
+        slot->model.store(model.release());
+        return static_cast<Handle>((static_cast<std::uint64_t>(slot->generation.load()) << 32) | index);
+    }
+
+    /// The model of the handle, kept alive until the returned pin is destroyed; throws if the handle is not (or no longer) valid
+    Pin pin(const Handle handle) const {
+        const auto h = static_cast<std::uint64_t>(handle);
+        Slot* slot = (handle < 0) ? nullptr : find_slot(static_cast<std::uint32_t>(h & 0xFFFFFFFFu));
+        if (slot != nullptr) {
+            auto& counter = slot->pins[get_shard()].n;
+            counter.fetch_add(1);
+            if (slot->generation.load() == static_cast<std::uint32_t>(h >> 32)) {
+                if (const auto* model = slot->model.load()) {
+                    return Pin(&counter, model);
+                }
+            }
+            counter.fetch_sub(1);
+        }
+        throw teqpcException(32, "Invalid model handle: " + std::to_string(handle));
+    }
+
+    /// Delete the model of the handle, once the evaluations in flight with it are done; throws if the handle is not valid
+    void erase(const Handle handle) {
+        const auto h = static_cast<std::uint64_t>(handle);
+        const auto index = static_cast<std::uint32_t>(h & 0xFFFFFFFFu);
+        Slot* slot = nullptr;
+        cppinterface::AbstractModel* model = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            slot = (handle < 0) ? nullptr : find_slot(index);
+            if (slot == nullptr || slot->generation.load() != static_cast<std::uint32_t>(h >> 32) || slot->model.load() == nullptr) {
+                throw teqpcException(32, "Invalid model handle: " + std::to_string(handle));
+            }
+            // New lookups fail from here on, and the ones that got through before hold pins
+            slot->generation.store((slot->generation.load() + 1) & GenerationMask);
+            model = slot->model.exchange(nullptr);
+        }
+        // The slot is not in the free list yet, so it cannot be reused while its pins drain
+        while (is_pinned(*slot)) {
+            std::this_thread::yield();
+        }
+        delete model;
+        std::lock_guard<std::mutex> lock(mtx);
+        free_slots.push_back(index);
+    }
+};
+
+ModelRegistry library;
 
 void exception_handler(int& errcode, char* message_buffer, const int buffer_length)
 {
@@ -55,14 +216,14 @@ EXPORT_CODE int CONVENTION build_model(const char* j, long long int* uuid, char*
     int errcode = 0;
     try{
         nlohmann::json json = nlohmann::json::parse(j);
-        long long int uid = next_index++;
+        std::unique_ptr<cppinterface::AbstractModel> model;
         try {
-            library.emplace(std::make_pair(uid, cppinterface::make_model(json)));
+            model = cppinterface::make_model(json);
         }
         catch (std::exception &e) {
             throw teqpcException(30, "Unable to load with error:" + std::string(e.what()));
         }
-        *uuid = uid;
+        *uuid = library.emplace(std::move(model));
     }
     catch (...) {
         exception_handler(errcode, errmsg, errmsg_length);
@@ -87,7 +248,37 @@ EXPORT_CODE int CONVENTION get_Arxy(const long long int uuid, const int NT, cons
         // Make an Eigen view of the double buffer
         Eigen::Map<const Eigen::ArrayXd> molefrac_(molefrac, Ncomp);
         // Call the function
-        *val = library.at(uuid)->get_Arxy(NT, ND, T, rho, molefrac_);
+        *val = library.pin(uuid)->get_Arxy(NT, ND, T, rho, molefrac_);
+    }
+    catch (...) {
+        exception_handler(errcode, errmsg, errmsg_length);
+    }
+    return errcode;
+}
+
+/**
+ The derivatives \f$\Lambda^{\rm r}_{NT,ND}\f$ at N state points, with the handle resolved once and the model called for all the points
+ in one virtual call (see AbstractModel::get_Arxy_many).
+ The mole fractions of point i are molefrac[i*ld], ..., molefrac[i*ld+Ncomp-1], so ld = Ncomp for packed rows (or for a Fortran array
+ z(Ncomp, N)), ld > Ncomp for rows of a larger table, and ld = 0 for the same composition at all the points; any other ld,
+ for which the rows would overlap, is rejected with error code 33.
+ T, rho and out hold N values each. Nothing is written to out if an error is returned.
+ */
+EXPORT_CODE int CONVENTION get_Arxy_batch(const long long int uuid, const int NT, const int ND, const int N, const double* T, const double* rho, const double* molefrac, const int Ncomp, const int ld, double* out, char* errmsg, int errmsg_length) {
+    int errcode = 0;
+    try {
+        if (N < 0 || Ncomp < 1 || ld < 0 || (ld > 0 && ld < Ncomp)) {
+            throw teqpcException(33, "Invalid sizes: N=" + std::to_string(N) + ", Ncomp=" + std::to_string(Ncomp) + ", ld=" + std::to_string(ld));
+        }
+        // One copy of the compositions into the layout of get_Arxy_many, for the whole batch
+        EMatrixd molefrac_(N, Ncomp);
+        for (auto i = 0; i < N; ++i) {
+            for (auto j = 0; j < Ncomp; ++j) {
+                molefrac_(i, j) = molefrac[static_cast<std::size_t>(i) * ld + j];
+            }
+        }
+        auto model = library.pin(uuid);
+        Eigen::Map<EArrayd>(out, N) = model->get_Arxy_many(NT, ND, Eigen::Map<const EArrayd>(T, N), Eigen::Map<const EArrayd>(rho, N), molefrac_);
     }
     catch (...) {
         exception_handler(errcode, errmsg, errmsg_length);
@@ -330,6 +521,108 @@ TEST_CASE("Use of C interface","[teqpc]") {
     };
     
 }
+TEST_CASE("Concurrent use of the C interface", "[teqpc]") {
+    constexpr int errmsg_length = 300;
+    char errmsg[errmsg_length] = "";
+    std::string j = R"({"kind": "PR", "model": {"Tcrit / K": [190], "pcrit / Pa": [3.5e6], "acentric": [0.11]}})";
+    long long int uuid;
+    REQUIRE(build_model(j.c_str(), &uuid, errmsg, errmsg_length) == 0);
+    double expected = -1, molefrac = 1.0;
+    REQUIRE(get_Arxy(uuid, 0, 1, 300.0, 300.0, &molefrac, 1, &expected, errmsg, errmsg_length) == 0);
+
+    // Handles of freed models are rejected, also once their slot is reused
+    long long int stale;
+    REQUIRE(build_model(j.c_str(), &stale, errmsg, errmsg_length) == 0);
+    REQUIRE(free_model(stale, errmsg, errmsg_length) == 0);
+    long long int reused;
+    REQUIRE(build_model(j.c_str(), &reused, errmsg, errmsg_length) == 0);
+    double val;
+    CHECK(get_Arxy(stale, 0, 1, 300.0, 300.0, &molefrac, 1, &val, errmsg, errmsg_length) == 32);
+    CHECK(free_model(stale, errmsg, errmsg_length) == 32);
+    CHECK(free_model(reused, errmsg, errmsg_length) == 0);
+
+    // Evaluations on several threads while other models are built and freed
+    std::atomic<bool> stop{ false };
+    std::atomic<int> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            char msg[errmsg_length] = "";
+            double v, z = 1.0;
+            while (!stop) {
+                if (get_Arxy(uuid, 0, 1, 300.0, 300.0, &z, 1, &v, msg, errmsg_length) != 0 || v != expected) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto i = 0; i < 200; ++i) {
+        long long int other;
+        CHECK(build_model(j.c_str(), &other, errmsg, errmsg_length) == 0);
+        CHECK(get_Arxy(other, 0, 1, 300.0, 300.0, &molefrac, 1, &val, errmsg, errmsg_length) == 0);
+        CHECK(free_model(other, errmsg, errmsg_length) == 0);
+    }
+    stop = true;
+    for (auto& t : threads) { t.join(); }
+    CHECK(failures == 0);
+    CHECK(free_model(uuid, errmsg, errmsg_length) == 0);
+
+    // While the freeing of a model waits for an evaluation in flight, other models are still built and freed
+    long long int held;
+    REQUIRE(build_model(j.c_str(), &held, errmsg, errmsg_length) == 0);
+    std::atomic<bool> freed{ false };
+    std::atomic<int> free_code{ -1 };
+    std::thread freeing;
+    {
+        auto pin = library.pin(held);
+        freeing = std::thread([&]() {
+            char msg[errmsg_length] = "";
+            free_code = free_model(held, msg, errmsg_length);
+            freed = true;
+        });
+        while (get_Arxy(held, 0, 1, 300.0, 300.0, &molefrac, 1, &val, errmsg, errmsg_length) != 32) {
+            std::this_thread::yield();
+        }
+        long long int other;
+        CHECK(build_model(j.c_str(), &other, errmsg, errmsg_length) == 0);
+        CHECK(free_model(other, errmsg, errmsg_length) == 0);
+        CHECK(!freed);
+        CHECK(pin->get_Arxy(0, 1, 300.0, 300.0, Eigen::ArrayXd::Ones(1)) == expected);
+    }
+    freeing.join();
+    CHECK(freed);
+    CHECK(free_code == 0);
+}
+TEST_CASE("Batch evaluation in the C interface", "[teqpc]") {
+    constexpr int errmsg_length = 300;
+    char errmsg[errmsg_length] = "";
+    std::string j = R"({"kind": "PR", "model": {"Tcrit / K": [190, 300], "pcrit / Pa": [3.5e6, 4e6], "acentric": [0.11, 0.1]}})";
+    long long int uuid;
+    REQUIRE(build_model(j.c_str(), &uuid, errmsg, errmsg_length) == 0);
+    const int N = 3, Ncomp = 2, ld = 3;
+    std::vector<double> T = { 300, 310, 320 }, rho = { 100, 200, 300 }, out(N);
+    // Rows of a table with one extra column, which is skipped
+    std::vector<double> molefrac = { 0.3, 0.7, -1, 0.5, 0.5, -1, 0.9, 0.1, -1 };
+    CHECK(get_Arxy_batch(uuid, 1, 1, N, &T[0], &rho[0], &molefrac[0], Ncomp, ld, &out[0], errmsg, errmsg_length) == 0);
+    for (auto i = 0; i < N; ++i) {
+        double val;
+        CHECK(get_Arxy(uuid, 1, 1, T[i], rho[i], &molefrac[i * ld], Ncomp, &val, errmsg, errmsg_length) == 0);
+        CHECK(out[i] == val);
+    }
+    // The same composition for all the points
+    CHECK(get_Arxy_batch(uuid, 0, 2, N, &T[0], &rho[0], &molefrac[3], Ncomp, 0, &out[0], errmsg, errmsg_length) == 0);
+    for (auto i = 0; i < N; ++i) {
+        double val;
+        CHECK(get_Arxy(uuid, 0, 2, T[i], rho[i], &molefrac[3], Ncomp, &val, errmsg, errmsg_length) == 0);
+        CHECK(out[i] == val);
+    }
+    CHECK(get_Arxy_batch(uuid, 0, 2, N, &T[0], &rho[0], &molefrac[0], Ncomp, -1, &out[0], errmsg, errmsg_length) == 33);
+    // Overlapping rows
+    std::vector<double> untouched = out;
+    CHECK(get_Arxy_batch(uuid, 0, 2, N, &T[0], &rho[0], &molefrac[0], Ncomp, 1, &out[0], errmsg, errmsg_length) == 33);
+    CHECK(out == untouched);
+    CHECK(free_model(uuid, errmsg, errmsg_length) == 0);
+}
 #else 
 int main() {
 }
@@ -7,10 +7,68 @@
 namespace teqp{
     namespace cppinterface{
     
-        double AbstractModel::get_neff(const double T, const double rho, const EArrayd& molefracs) const {
+        double AbstractModel::get_neff(const double T, const double rho, const REArrayd& molefracs) const {
             return -3.0*(this->get_Ar01(T, rho, molefracs) - this->get_Ar11(T, rho, molefracs) )/this->get_Ar20(T,rho,molefracs);
         };
 
+        PropertyBundle AbstractModel::get_property_bundle(const double T, const double rho, const REArrayd& z, const std::uint32_t mask, const AbstractModel* aig) const {
+            if ((mask & ~std::uint32_t(properties::all)) != 0){
+                throw teqp::InvalidArgument("Unknown bits in the mask of properties: " + std::to_string(mask));
+            }
+            auto wants = [&](std::uint32_t bits){ return (mask & bits) != 0; };
+            
+            // The entries (i,j) of the matrices of residual and ideal-gas derivatives that the requested properties need
+            Eigen::Array<bool, 3, 3> r = Eigen::Array<bool, 3, 3>::Constant(false), ig = Eigen::Array<bool, 3, 3>::Constant(false);
+            auto need = [](Eigen::Array<bool, 3, 3>& m, std::initializer_list<std::pair<int, int>> ij){
+                for (auto [i, j] : ij){ m(i, j) = true; }
+            };
+            if (wants(properties::p)){ need(r, {{0,1}}); }
+            if (wants(properties::h)){ need(r, {{1,0}, {0,1}}); need(ig, {{1,0}}); }
+            if (wants(properties::s)){ need(r, {{0,0}, {1,0}}); need(ig, {{0,0}, {1,0}}); }
+            if (wants(properties::u)){ need(r, {{1,0}}); need(ig, {{1,0}}); }
+            if (wants(properties::cv)){ need(r, {{2,0}}); need(ig, {{2,0}}); }
+            if (wants(properties::cp | properties::M_w2 | properties::JT)){ need(r, {{2,0}, {0,1}, {1,1}, {0,2}}); need(ig, {{2,0}}); }
+            if (wants(properties::neff)){ need(r, {{2,0}, {0,1}, {1,1}}); }
+            if (ig.any() && aig == nullptr){
+                throw teqp::InvalidArgument("The ideal-gas model is required for h, s, u, cv, cp, M_w2 and JT");
+            }
+            
+            // A single derivative is cheaper on its own, otherwise all of them come from one pass
+            auto evaluate = [&](const AbstractModel& model, const Eigen::Array<bool, 3, 3>& needed){
+                EArray33d A = EArray33d::Zero();
+                if (needed.count() == 1){
+                    Eigen::Index i = 0, j = 0;
+                    needed.maxCoeff(&i, &j);
+                    A(i, j) = model.get_Arxy(static_cast<int>(i), static_cast<int>(j), T, rho, z);
+                }
+                else if (needed.count() > 1){
+                    A = model.get_deriv_mat2(T, rho, z);
+                }
+                return A;
+            };
+            const EArray33d Ar = evaluate(*this, r);
+            const EArray33d A = (ig.any()) ? EArray33d(Ar + evaluate(*aig, ig)) : Ar;
+            
+            const double R = get_R(z);
+            PropertyBundle b;
+            b.mask = mask;
+            if (wants(properties::p)){ b.p = rho*R*T*(1.0 + Ar(0,1)); }
+            // The ideal-gas part of Lambda_01 is 1
+            if (wants(properties::h)){ b.h = R*T*(1.0 + Ar(0,1) + A(1,0)); }
+            if (wants(properties::s)){ b.s = R*(A(1,0) - A(0,0)); }
+            if (wants(properties::u)){ b.u = R*T*A(1,0); }
+            if (wants(properties::cv)){ b.cv = -R*A(2,0); }
+            if (wants(properties::cp | properties::M_w2 | properties::JT)){
+                // (dp/dT)_rho/(rho R) and (dp/drho)_T/(RT)
+                const double dpdT = 1.0 + Ar(0,1) - Ar(1,1), dpdrho = 1.0 + 2.0*Ar(0,1) + Ar(0,2);
+                if (wants(properties::cp)){ b.cp = R*(-A(2,0) + dpdT*dpdT/dpdrho); }
+                if (wants(properties::M_w2)){ b.M_w2 = R*T*(dpdrho - dpdT*dpdT/A(2,0)); }
+                if (wants(properties::JT)){ b.JT = -(Ar(0,1) + Ar(0,2) + Ar(1,1))/(dpdT*dpdT - A(2,0)*dpdrho)/(rho*R); }
+            }
+            if (wants(properties::neff)){ b.neff = -3.0*(Ar(0,1) - Ar(1,1))/Ar(2,0); }
+            return b;
+        }
+
         std::tuple<double, double> AbstractModel::solve_pure_critical(const double T, const double rho, const std::optional<nlohmann::json>& flags) const  {
             return teqp::solve_pure_critical(*this, T, rho, flags.value_or(nlohmann::json{}));
         }
@@ -29,24 +87,24 @@ namespace teqp{
             return teqp::dpsatdT_pure(*this, T, rhoL, rhoV);
         }
     
-        std::tuple<VLLE::VLLE_return_code,EArrayd,EArrayd,EArrayd> AbstractModel::mix_VLLE_T(const double T, const REArrayd& rhovecVinit, const REArrayd& rhovecL1init, const REArrayd& rhovecL2init, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter) const{
+        std::tuple<VLLE::VLLE_return_code,EArrayd,EArrayd,EArrayd> AbstractModel::mix_VLLE_T(const double T, const REArrayd& rhovecVinit, const REArrayd& rhovecL1init, const REArrayd& rhovecL2init, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter, SolverTelemetry* telemetry) const{
             
-            return VLLE::mix_VLLE_T(*this, T, rhovecVinit, rhovecL1init, rhovecL2init, atol, reltol, axtol, relxtol, maxiter);
+            return VLLE::mix_VLLE_T(*this, T, rhovecVinit, rhovecL1init, rhovecL2init, atol, reltol, axtol, relxtol, maxiter, telemetry);
         }
 
         std::vector<nlohmann::json> AbstractModel::find_VLLE_T_binary(const std::vector<nlohmann::json>& traces, const std::optional<VLLE::VLLEFinderOptions> options) const{
             return VLLE::find_VLLE_T_binary(*this, traces, options);;
         }
     
-    std::tuple<VLE_return_code,EArrayd,EArrayd> AbstractModel::mix_VLE_Tx(const double T, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const REArrayd& xspec, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter) const{
-        return teqp::mix_VLE_Tx(*this, T, rhovecL0, rhovecV0, xspec, atol, reltol, axtol, relxtol, maxiter);
+    std::tuple<VLE_return_code,EArrayd,EArrayd> AbstractModel::mix_VLE_Tx(const double T, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const REArrayd& xspec, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter, SolverTelemetry* telemetry) const{
+        return teqp::mix_VLE_Tx(*this, T, rhovecL0, rhovecV0, xspec, atol, reltol, axtol, relxtol, maxiter, telemetry);
     
     }
     MixVLEReturn AbstractModel::mix_VLE_Tp(const double T, const double pgiven, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLETpFlags> &flags) const{
         return teqp::mix_VLE_Tp(*this, T, pgiven, rhovecL0, rhovecV0, flags);
     }
-    std::tuple<VLE_return_code,double,EArrayd,EArrayd> AbstractModel::mixture_VLE_px(const double p_spec, const REArrayd& xmolar_spec, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLEpxFlags>& flags) const{
-        return teqp::mixture_VLE_px(*this, p_spec, xmolar_spec, T0, rhovecL0, rhovecV0, flags);
+    std::tuple<VLE_return_code,double,EArrayd,EArrayd> AbstractModel::mixture_VLE_px(const double p_spec, const REArrayd& xmolar_spec, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLEpxFlags>& flags, SolverTelemetry* telemetry) const{
+        return teqp::mixture_VLE_px(*this, p_spec, xmolar_spec, T0, rhovecL0, rhovecV0, flags, telemetry);
     }
     
     std::tuple<EArrayd, EArrayd> AbstractModel::get_drhovecdp_Tsat(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const {
@@ -58,15 +116,19 @@ namespace teqp{
     double AbstractModel::get_dpsat_dTsat_isopleth(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const {
         return teqp::get_dpsat_dTsat_isopleth(*this, T, rhovecL, rhovecV);
     }
-    nlohmann::json AbstractModel::trace_VLE_isotherm_binary(const double T0, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<TVLEOptions> &options) const{
+    nlohmann::json AbstractModel::trace_VLE_isotherm_binary(const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<TVLEOptions> &options) const{
         return teqp::trace_VLE_isotherm_binary(*this, T0, rhovecL0, rhovecV0, options);
     }
-    nlohmann::json AbstractModel::trace_VLE_isobar_binary(const double p, const double T0, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<PVLEOptions> &options) const{
+    nlohmann::json AbstractModel::trace_VLE_isobar_binary(const double p, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<PVLEOptions> &options) const{
         return teqp::trace_VLE_isobar_binary(*this, p, T0, rhovecL0, rhovecV0, options);
     }
+    nlohmann::json AbstractModel::trace_phase_envelope(const double T0, const REArrayd& rhovecB0, const REArrayd& rhovecI0, const std::optional<PhaseEnvelopeOptions> &options) const{
+        return teqp::trace_phase_envelope(*this, T0, rhovecB0, rhovecI0, options);
+    }
     
-    nlohmann::json AbstractModel::trace_critical_arclength_binary(const double T0, const EArrayd& rhovec0, const std::optional<std::string>& filename, const std::optional<TCABOptions> &options) const {
-        using crit = teqp::CriticalTracing<decltype(*this), double, std::decay_t<decltype(rhovec0)>>;
+    nlohmann::json AbstractModel::trace_critical_arclength_binary(const double T0, const REArrayd& rhovec0, const std::optional<std::string>& filename, const std::optional<TCABOptions> &options) const {
+        // The tracer keeps its own copies of the state, so it works with concrete arrays
+        using crit = teqp::CriticalTracing<decltype(*this), double, EArrayd>;
         return crit::trace_critical_arclength_binary(*this, T0, rhovec0, filename , options);
     }
     EArrayd AbstractModel::get_drhovec_dT_crit(const double T, const REArrayd& rhovec) const {
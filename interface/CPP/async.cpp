@@ -0,0 +1,161 @@
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "teqp/cpp/async.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/VLE.hpp"
+
+namespace teqp{
+namespace async{
+
+struct ThreadPool::Impl{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    bool stopping = false;
+    std::vector<std::thread> threads;
+
+    void work(){
+        while (true){
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this](){ return stopping || !tasks.empty(); });
+                if (tasks.empty()){ return; } // Stopping, and nothing left to do
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+ThreadPool::ThreadPool(const std::size_t Nthreads) : impl(std::make_unique<Impl>()){
+    const std::size_t N = (Nthreads == 0) ? std::max(std::thread::hardware_concurrency(), 1U) : Nthreads;
+    for (std::size_t i = 0; i < N; ++i){
+        impl->threads.emplace_back([this](){ impl->work(); });
+    }
+}
+
+ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopping = true;
+    }
+    impl->cv.notify_all();
+    for (auto& t : impl->threads){ t.join(); }
+}
+
+void ThreadPool::submit(std::function<void()> task){
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        if (impl->stopping){
+            throw teqp::InvalidArgument("Tasks cannot be submitted to a pool that is being destroyed");
+        }
+        impl->tasks.push_back(std::move(task));
+    }
+    impl->cv.notify_one();
+}
+
+std::size_t ThreadPool::size() const { return impl->threads.size(); }
+
+ThreadPool& default_pool(){
+    static ThreadPool pool;
+    return pool;
+}
+
+namespace{
+    /// Run f(control) on the pool; the exceptions of f are stored in the shared state of the job
+    template<typename Result, typename Function>
+    Job<Result> launch(ThreadPool& pool, const ProgressCallback& progress, Function&& f){
+        auto control = std::make_shared<JobControl>(progress);
+        auto task = std::make_shared<std::packaged_task<Result()>>([control, f = std::forward<Function>(f)](){ return f(*control); });
+        Job<Result> job(control, task->get_future().share());
+        pool.submit([task](){ (*task)(); });
+        return job;
+    }
+    void check_model(const std::shared_ptr<const cppinterface::AbstractModel>& model){
+        if (!model){
+            throw teqp::InvalidArgument("The model of an asynchronous job may not be null");
+        }
+    }
+}
+
+Job<nlohmann::json> trace_critical_arclength_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const double T0, const EArrayd& rhovec0, const std::optional<TCABOptions>& options, const ProgressCallback& progress, ThreadPool& pool){
+    check_model(model);
+    return launch<nlohmann::json>(pool, progress, [model, T0, rhovec0, options](JobControl& control){
+        if (control.is_cancelled()){ return nlohmann::json(nlohmann::json::array()); }
+        auto opt = options.value_or(TCABOptions{});
+        auto user_callback = opt.step_callback;
+        opt.step_callback = [&](const nlohmann::json& point){
+            if (user_callback && !user_callback(point)){ return false; }
+            return control.step(point);
+        };
+        return model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, opt);
+    });
+}
+
+Job<nlohmann::json> trace_VLE_isotherm_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const double T, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<TVLEOptions>& options, const ProgressCallback& progress, ThreadPool& pool){
+    check_model(model);
+    const auto opt = options.value_or(TVLEOptions{});
+    if (opt.revision != 1 && opt.revision != 2){
+        throw teqp::InvalidArgument("revision is not valid");
+    }
+    return launch<nlohmann::json>(pool, progress, [model, T, rhovecL0, rhovecV0, opt](JobControl& control){
+        // As in the synchronous version, built from the points passed to the callback
+        auto data = nlohmann::json::array();
+        std::string termination_reason = "Cancelled";
+        SolverTelemetry telemetry;
+        if (!control.is_cancelled()){
+            bool stopped = false;
+            termination_reason = teqp::trace_VLE_isotherm_binary(*model, T, rhovecL0, rhovecV0, [&](const VLETracePoint& pt){
+                data.push_back(internal::VLE_trace_point_to_json(pt, opt.calc_criticality, opt.telemetry, opt.checkpoint));
+                telemetry = pt.telemetry;
+                stopped = !control.step(data.back());
+                return !stopped;
+            }, opt);
+            if (stopped){ termination_reason = "Cancelled"; }
+        }
+        if (opt.revision == 1){
+            return data;
+        }
+        nlohmann::json meta{{"termination_reason", termination_reason}};
+        if (opt.telemetry){
+            meta["telemetry"] = internal::SolverTelemetry_to_json(telemetry);
+        }
+        return nlohmann::json{
+            {"meta", meta},
+            {"data", data}
+        };
+    });
+}
+
+Job<nlohmann::json> trace_VLE_isobar_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const double p, const double T0, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const std::optional<PVLEOptions>& options, const ProgressCallback& progress, ThreadPool& pool){
+    check_model(model);
+    return launch<nlohmann::json>(pool, progress, [model, p, T0, rhovecL0, rhovecV0, options](JobControl& control){
+        const auto opt = options.value_or(PVLEOptions{});
+        auto data = nlohmann::json::array();
+        if (!control.is_cancelled()){
+            teqp::trace_VLE_isobar_binary(*model, p, T0, rhovecL0, rhovecV0, [&](const VLETracePoint& pt){
+                data.push_back(internal::VLE_trace_point_to_json(pt, opt.calc_criticality, opt.telemetry, opt.checkpoint));
+                return control.step(data.back());
+            }, opt);
+        }
+        return data;
+    });
+}
+
+Job<std::vector<nlohmann::json>> find_VLLE_T_binary(std::shared_ptr<const cppinterface::AbstractModel> model, const std::vector<nlohmann::json>& traces, const std::optional<VLLE::VLLEFinderOptions>& options, const ProgressCallback& progress, ThreadPool& pool){
+    check_model(model);
+    return launch<std::vector<nlohmann::json>>(pool, progress, [model, traces, options](JobControl& control){
+        if (control.is_cancelled()){ return std::vector<nlohmann::json>{}; }
+        auto solutions = model->find_VLLE_T_binary(traces, options);
+        control.step(solutions);
+        return solutions;
+    });
+}
+
+}
+}
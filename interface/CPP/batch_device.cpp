@@ -0,0 +1,257 @@
+#include <array>
+#include <typeindex>
+#include <variant>
+
+#include "teqp/cpp/batch_device.hpp"
+#include "teqp/cpp/device_kernels.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/models/fwd.hpp"
+
+#if defined(TEQP_CUDA_ENABLED)
+#include "batch_device_cuda.hpp"
+#endif
+
+namespace teqp{
+namespace device{
+
+using cppinterface::AbstractModel;
+using namespace kernels;
+
+namespace{
+
+    /// The flattened coefficients of a model, see kernels::Plan
+    struct FlatModel{
+        Plan plan;
+        std::vector<double> d;
+        std::vector<int> i;
+
+        int append(const double* x, const std::size_t n){ auto o = static_cast<int>(d.size()); d.insert(d.end(), x, x + n); return o; }
+        int append(const std::vector<double>& x){ return append(x.data(), x.size()); }
+    };
+
+    /// The EOS terms in the common form of kernels::TermCoeff, in the order in which they are added
+    class TermCollector{
+    private:
+        std::vector<std::array<double, Ntermcoeffs>> terms;
+        void add(double n, double t, double d, double cd, double ld, double ct, double lt, double eta, double eps, double bd, double gd, double bt, double gt){
+            terms.push_back({n, t, d, cd, ld, ct, lt, eta, eps, bd, gd, bt, gt});
+        }
+        void add_term(const JustPowerEOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], 0, 0, 0, 0, 0, 0, 0, 0, 0, 0); }
+        }
+        void add_term(const PowerEOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], e.c[k], e.l_i[k], 0, 0, 0, 0, 0, 0, 0, 0); }
+        }
+        void add_term(const ExponentialEOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], e.g[k], e.l_i[k], 0, 0, 0, 0, 0, 0, 0, 0); }
+        }
+        void add_term(const DoubleExponentialEOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], e.gd[k], e.ld_i[k], e.gt[k], e.lt[k], 0, 0, 0, 0, 0, 0); }
+        }
+        void add_term(const Lemmon2005EOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], 1.0, e.l_i[k], 1.0, e.m[k], 0, 0, 0, 0, 0, 0); }
+        }
+        void add_term(const GaussianEOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], 0, 0, 0, 0, e.eta[k], e.epsilon[k], 0, 0, e.beta[k], e.gamma[k]); }
+        }
+        void add_term(const GERG2004EOSTerm& e){
+            for (auto k = 0; k < e.n.size(); ++k){ add(e.n[k], e.t[k], e.d[k], 0, 0, 0, 0, e.eta[k], e.epsilon[k], e.beta[k], e.gamma[k], 0, 0); }
+        }
+        void add_term(const NullEOSTerm&){}
+        template<typename TermType>
+        void add_term(const TermType&){
+            throw teqp::NotImplementedError("One of the EOS terms of this model is not supported by the batched device evaluation");
+        }
+    public:
+        int size() const { return static_cast<int>(terms.size()); }
+
+        /// Add the terms of a MergedEOSTermContainer
+        template<typename Container>
+        void add_container(const Container& container){
+            container.for_each_kind([&](const auto& kind){
+                for (const auto& term : kind){ add_term(term); }
+            });
+        }
+
+        /// Append the terms to d as a structure of arrays, and return the offset
+        int append_to(FlatModel& f) const {
+            auto o = static_cast<int>(f.d.size());
+            for (auto c = 0; c < Ntermcoeffs; ++c){
+                for (const auto& t : terms){ f.d.push_back(t[c]); }
+            }
+            return o;
+        }
+    };
+
+    FlatModel flatten(const canonical_cubic_t& model){
+        FlatModel f;
+        const auto& ai = model.get_ai();
+        const auto N = static_cast<int>(ai.size());
+        if (N > max_cubic_components){
+            throw teqp::NotImplementedError("The batched device evaluation of cubic models is limited to " + std::to_string(max_cubic_components) + " components");
+        }
+        f.plan.kind = cubic;
+        f.plan.N = N;
+        f.plan.R = model.Ru;
+        f.plan.Delta1 = model.get_Delta1();
+        f.plan.Delta2 = model.get_Delta2();
+        f.plan.o_ai = f.append(&ai[0], ai.size());
+        f.plan.o_bi = f.append(&model.get_bi()[0], model.get_bi().size());
+        auto kmat = model.get_kmat();
+        f.plan.o_kmat = static_cast<int>(f.d.size());
+        for (auto i = 0; i < N; ++i){
+            for (auto j = 0; j < N; ++j){ f.d.push_back(kmat(i, j)); }
+        }
+        f.plan.o_alpha = static_cast<int>(f.d.size());
+        f.plan.o_alphakind = static_cast<int>(f.i.size());
+        for (const auto& alpha : model.get_alphas()){
+            std::visit([&](const auto& a){
+                using A = std::decay_t<decltype(a)>;
+                if constexpr (std::is_same_v<A, BasicAlphaFunction<double>>){
+                    f.d.insert(f.d.end(), {a.get_Tci(), a.get_mi(), 0.0, 0.0});
+                    f.i.push_back(alpha_basic);
+                }
+                else{
+                    const auto& c = a.get_c();
+                    f.d.insert(f.d.end(), {a.get_Tci(), c[0], c[1], c[2]});
+                    f.i.push_back(alpha_Twu);
+                }
+            }, alpha);
+        }
+        return f;
+    }
+
+    FlatModel flatten(const multifluid_t& model){
+        FlatModel f;
+        const auto N = static_cast<int>(model.corr.size());
+        f.plan.kind = multifluid;
+        f.plan.N = N;
+        f.plan.R = get_R_gas<double>();
+
+        // The reducing function
+        const auto& Tc = model.redfunc.Tc, vc = model.redfunc.vc;
+        f.plan.o_Tc = f.append(Tc.data(), Tc.size());
+        f.plan.o_vc = f.append(vc.data(), vc.size());
+        f.plan.o_red = static_cast<int>(f.d.size());
+        std::vector<double> A(N*N), B(N*N), C(N*N), D(N*N);
+        std::visit([&](const auto& r){
+            using RT = std::decay_t<decltype(r)>;
+            for (auto i = 0; i < N; ++i){
+                for (auto j = 0; j < N; ++j){
+                    const double YTij = sqrt(Tc[i]*Tc[j]), Yvij = 1.0/8.0*pow3(cbrt(vc[i]) + cbrt(vc[j]));
+                    if constexpr (std::is_same_v<RT, MultiFluidReducingFunction>){
+                        f.plan.reducing = reducing_GERG;
+                        A[i*N + j] = pow2(r.get_betaT()(i, j)); B[i*N + j] = r.get_betaT()(i, j)*r.get_gammaT()(i, j)*YTij;
+                        C[i*N + j] = pow2(r.get_betaV()(i, j)); D[i*N + j] = r.get_betaV()(i, j)*r.get_gammaV()(i, j)*Yvij;
+                    }
+                    else{
+                        f.plan.reducing = reducing_invariant;
+                        A[i*N + j] = r.get_phiT()(i, j)*YTij; B[i*N + j] = r.get_lambdaT()(i, j)*YTij;
+                        C[i*N + j] = r.get_phiV()(i, j)*Yvij; D[i*N + j] = r.get_lambdaV()(i, j)*Yvij;
+                    }
+                }
+            }
+        }, model.redfunc.get_term());
+        for (const auto* M : {&A, &B, &C, &D}){ f.append(*M); }
+
+        // The terms of the pure fluids, then those of the departure functions of the active pairs
+        TermCollector terms;
+        f.plan.o_fluid_ranges = static_cast<int>(f.i.size());
+        for (auto k = 0; k < N; ++k){
+            f.i.push_back(terms.size());
+            terms.add_container(model.corr.get_EOS_cref(k));
+        }
+        f.i.push_back(terms.size());
+        const auto& pairs = model.dep.get_active_pairs();
+        f.plan.Npairs = static_cast<int>(pairs.size());
+        f.plan.o_pairs = static_cast<int>(f.i.size());
+        f.plan.o_pairs_F = static_cast<int>(f.d.size());
+        for (const auto& [i, j, Fij] : pairs){
+            const int first = terms.size();
+            terms.add_container(model.dep.get_departure(i, j));
+            f.i.insert(f.i.end(), {i, j, first, terms.size()});
+            f.d.push_back(Fij);
+        }
+        f.plan.Nterms = terms.size();
+        f.plan.o_terms = terms.append_to(f);
+        return f;
+    }
+
+    FlatModel flatten(const AbstractModel& am){
+        using cppinterface::adapter::get_model_cref;
+        const auto& index = am.get_type_index();
+        if (index == std::type_index(typeid(canonical_cubic_t))){
+            return flatten(get_model_cref<canonical_cubic_t>(&am));
+        }
+        else if (index == std::type_index(typeid(multifluid_t))){
+            return flatten(get_model_cref<multifluid_t>(&am));
+        }
+        throw teqp::NotImplementedError("The batched device evaluation is only available for the generic cubic and the multifluid models");
+    }
+}
+
+bool cuda_available(){
+#if defined(TEQP_CUDA_ENABLED)
+    return CudaBackend::available();
+#else
+    return false;
+#endif
+}
+
+struct BatchEvaluator::Impl{
+    FlatModel flat;
+    BatchOptions options;
+#if defined(TEQP_CUDA_ENABLED)
+    std::unique_ptr<CudaBackend> cuda;
+#endif
+    Impl(const AbstractModel& model, const BatchOptions& options) : flat(flatten(model)), options(options) {
+        if (options.backend == Backend::cuda){
+#if defined(TEQP_CUDA_ENABLED)
+            cuda = std::make_unique<CudaBackend>(flat.plan, flat.d, flat.i, options.device, options.chunk_size);
+#else
+            throw teqp::NotImplementedError("teqp was built without CUDA support; set TEQP_CUDA to enable it");
+#endif
+        }
+    }
+};
+
+BatchEvaluator::BatchEvaluator(const AbstractModel& model, const BatchOptions& options) : impl(std::make_unique<Impl>(model, options)) {}
+
+BatchEvaluator::~BatchEvaluator() = default;
+
+int BatchEvaluator::get_Ncomponents() const { return impl->flat.plan.N; }
+
+EMatrixd BatchEvaluator::get_Ar_block(const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const {
+    if (NT < 0 || ND < 0 || NT > max_order || ND > max_order){
+        throw teqp::InvalidArgument("NT and ND must be between 0 and " + std::to_string(max_order));
+    }
+    if (T.size() != rho.size()){
+        throw teqp::InvalidArgument("Lengths of T ("+std::to_string(T.size())+") and rho ("+std::to_string(rho.size())+") are not the same");
+    }
+    if (molefrac.rows() != T.size()){
+        throw teqp::InvalidArgument("Number of rows in molefrac ("+std::to_string(molefrac.rows())+") does not match the length of T ("+std::to_string(T.size())+")");
+    }
+    if (molefrac.cols() != impl->flat.plan.N){
+        throw teqp::InvalidArgument("Number of columns in molefrac ("+std::to_string(molefrac.cols())+") does not match the number of components ("+std::to_string(impl->flat.plan.N)+") of this model");
+    }
+    const auto M = static_cast<std::size_t>(T.size());
+    EMatrixd out(M, (NT + 1)*(ND + 1));
+#if defined(TEQP_CUDA_ENABLED)
+    if (impl->cuda){
+        impl->cuda->evaluate(NT, ND, T.data(), rho.data(), molefrac.data(), M, static_cast<std::size_t>(molefrac.outerStride()), out.data());
+        return out;
+    }
+#endif
+    const PlanView view{impl->flat.plan, impl->flat.d.data(), impl->flat.i.data()};
+    const long ldx = static_cast<long>(molefrac.outerStride()), ldout = static_cast<long>(M);
+    parallel::parallel_for(M, [&](std::size_t istart, std::size_t iend){
+        for (auto s = istart; s < iend; ++s){
+            evaluate_state(view, NT, ND, T(s), rho(s), molefrac.data() + s, ldx, out.data() + s, ldout);
+        }
+    }, impl->options.host);
+    return out;
+}
+
+}
+}
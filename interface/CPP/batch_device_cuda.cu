@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "batch_device_cuda.hpp"
+#include "teqp/exceptions.hpp"
+
+namespace teqp{
+namespace device{
+
+namespace{
+    void check(const cudaError_t err, const char* what){
+        if (err != cudaSuccess){
+            throw teqp::IterationFailure(std::string("CUDA error in ") + what + ": " + cudaGetErrorString(err));
+        }
+    }
+
+    __global__ void evaluate_kernel(const kernels::PlanView P, const int NT, const int ND, const double* T, const double* rho, const double* molefrac, const long M, double* out){
+        const long s = static_cast<long>(blockIdx.x)*blockDim.x + threadIdx.x;
+        if (s < M){
+            kernels::evaluate_state(P, NT, ND, T[s], rho[s], molefrac + s, M, out + s, M);
+        }
+    }
+
+    /// The buffers of one chunk in flight: pinned on the host, and on the device, with the stream on which the chunk is processed
+    struct Slot{
+        cudaStream_t stream = nullptr;
+        double *h_in = nullptr, *h_out = nullptr, *d_in = nullptr, *d_out = nullptr;
+        std::size_t istart = 0, M = 0; ///< The states of the chunk, if one is in flight
+        bool busy = false;
+    };
+
+    /// Wait for the chunks still in flight when an evaluation ends, also by an exception, so that the next one starts from idle slots
+    struct SlotGuard{
+        Slot (&slots)[2];
+        ~SlotGuard(){
+            for (auto& s : slots){
+                if (s.busy){ cudaStreamSynchronize(s.stream); s.busy = false; }
+            }
+        }
+    };
+}
+
+struct CudaBackend::Impl{
+    kernels::Plan plan;
+    int device = 0, N = 0;
+    std::size_t chunk = 0;
+    double* d_coeffs = nullptr;
+    int* d_ints = nullptr;
+    Slot slots[2];
+    std::mutex mutex; ///< Held for the duration of an evaluation, which uses the slots
+
+    ~Impl(){
+        cudaSetDevice(device);
+        for (auto& s : slots){
+            if (s.stream){ cudaStreamSynchronize(s.stream); cudaStreamDestroy(s.stream); }
+            cudaFreeHost(s.h_in); cudaFreeHost(s.h_out); cudaFree(s.d_in); cudaFree(s.d_out);
+        }
+        cudaFree(d_coeffs); cudaFree(d_ints);
+    }
+};
+
+CudaBackend::CudaBackend(const kernels::Plan& plan, const std::vector<double>& d, const std::vector<int>& i, const int device, const std::size_t chunk_size) : impl(std::make_unique<Impl>()) {
+    auto& I = *impl;
+    I.plan = plan;
+    I.device = device;
+    I.N = plan.N;
+    I.chunk = std::max<std::size_t>(chunk_size, 1);
+    check(cudaSetDevice(device), "cudaSetDevice");
+    // The coefficients are uploaded once
+    check(cudaMalloc(&I.d_coeffs, std::max<std::size_t>(d.size(), 1)*sizeof(double)), "cudaMalloc");
+    check(cudaMalloc(&I.d_ints, std::max<std::size_t>(i.size(), 1)*sizeof(int)), "cudaMalloc");
+    check(cudaMemcpy(I.d_coeffs, d.data(), d.size()*sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    check(cudaMemcpy(I.d_ints, i.data(), i.size()*sizeof(int), cudaMemcpyHostToDevice), "cudaMemcpy");
+    // Per chunk: T, rho and the mole fractions in, and the largest block of derivatives out
+    const std::size_t Nin = I.chunk*(2 + I.N), Nout = I.chunk*(kernels::max_order + 1)*(kernels::max_order + 1);
+    for (auto& s : I.slots){
+        check(cudaStreamCreateWithFlags(&s.stream, cudaStreamNonBlocking), "cudaStreamCreate");
+        check(cudaHostAlloc(&s.h_in, Nin*sizeof(double), cudaHostAllocDefault), "cudaHostAlloc");
+        check(cudaHostAlloc(&s.h_out, Nout*sizeof(double), cudaHostAllocDefault), "cudaHostAlloc");
+        check(cudaMalloc(&s.d_in, Nin*sizeof(double)), "cudaMalloc");
+        check(cudaMalloc(&s.d_out, Nout*sizeof(double)), "cudaMalloc");
+    }
+}
+
+CudaBackend::~CudaBackend() = default;
+
+bool CudaBackend::available(){
+    int count = 0;
+    return cudaGetDeviceCount(&count) == cudaSuccess && count > 0;
+}
+
+void CudaBackend::evaluate(const int NT, const int ND, const double* T, const double* rho, const double* molefrac, const std::size_t M, const std::size_t ldx, double* out) const {
+    auto& I = *impl;
+    std::lock_guard<std::mutex> lock(I.mutex);
+    SlotGuard guard{I.slots};
+    check(cudaSetDevice(I.device), "cudaSetDevice");
+    const kernels::PlanView view{I.plan, I.d_coeffs, I.d_ints};
+    const std::size_t Nblock = (NT + 1)*(ND + 1);
+    const int threads = 128;
+
+    // Copy the results of a chunk, once its stream is done, from the pinned buffer to the output, of leading dimension M
+    auto retire = [&](Slot& s){
+        if (!s.busy){ return; }
+        check(cudaStreamSynchronize(s.stream), "cudaStreamSynchronize");
+        for (std::size_t k = 0; k < Nblock; ++k){
+            std::copy(s.h_out + k*s.M, s.h_out + (k + 1)*s.M, out + k*M + s.istart);
+        }
+        s.busy = false;
+    };
+
+    // While the kernel of a chunk runs on one stream, the next chunk is staged and sent on the other one
+    std::size_t ichunk = 0;
+    for (std::size_t istart = 0; istart < M; istart += I.chunk, ++ichunk){
+        Slot& s = I.slots[ichunk % 2];
+        retire(s);
+        s.istart = istart;
+        s.M = std::min(I.chunk, M - istart);
+        // Stage the inputs of the chunk contiguously: T, rho, then the columns of the mole fractions
+        std::copy(T + istart, T + istart + s.M, s.h_in);
+        std::copy(rho + istart, rho + istart + s.M, s.h_in + s.M);
+        for (int k = 0; k < I.N; ++k){
+            std::copy(molefrac + k*ldx + istart, molefrac + k*ldx + istart + s.M, s.h_in + (2 + k)*s.M);
+        }
+        // Busy from the first copy on, so that the guard waits for whatever was queued if a later step throws
+        s.busy = true;
+        check(cudaMemcpyAsync(s.d_in, s.h_in, (2 + I.N)*s.M*sizeof(double), cudaMemcpyHostToDevice, s.stream), "cudaMemcpyAsync");
+        const auto blocks = static_cast<unsigned int>((s.M + threads - 1)/threads);
+        evaluate_kernel<<<blocks, threads, 0, s.stream>>>(view, NT, ND, s.d_in, s.d_in + s.M, s.d_in + 2*s.M, static_cast<long>(s.M), s.d_out);
+        check(cudaGetLastError(), "evaluate_kernel");
+        check(cudaMemcpyAsync(s.h_out, s.d_out, Nblock*s.M*sizeof(double), cudaMemcpyDeviceToHost, s.stream), "cudaMemcpyAsync");
+    }
+    retire(I.slots[0]);
+    retire(I.slots[1]);
+}
+
+}
+}
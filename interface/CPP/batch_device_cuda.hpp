@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "teqp/cpp/device_kernels.hpp"
+
+namespace teqp{
+namespace device{
+
+/**
+ The CUDA backend of BatchEvaluator, implemented in batch_device_cuda.cu, which is only compiled with TEQP_CUDA.  The coefficients
+ are uploaded at construction; each evaluation streams the state points through pinned buffers in chunks, on two streams, so
+ that the copies of a chunk to and from the device overlap the kernel of the other one.
+ */
+class CudaBackend{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+public:
+    CudaBackend(const kernels::Plan& plan, const std::vector<double>& d, const std::vector<int>& i, const int device, const std::size_t chunk_size);
+    ~CudaBackend();
+
+    /// As kernels::evaluate_state for the states [0, M); molefrac and out are column-major, with leading dimensions ldx and M.
+    /// Concurrent calls are serialized, as they share the pinned buffers and the streams
+    void evaluate(const int NT, const int ND, const double* T, const double* rho, const double* molefrac, const std::size_t M, const std::size_t ldx, double* out) const;
+
+    static bool available();
+};
+
+}
+}
@@ -0,0 +1,367 @@
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#if defined(TEQP_MPI_ENABLED)
+#include <mpi.h>
+#endif
+
+#include "teqp/cpp/distributed.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/VLE.hpp"
+#include "teqp/algorithms/superancillary_pure.hpp"
+
+namespace teqp{
+namespace distributed{
+
+using cppinterface::AbstractModel;
+
+namespace{
+
+    bool mpi_running(){
+#if defined(TEQP_MPI_ENABLED)
+        int initialized = 0, finalized = 0;
+        MPI_Initialized(&initialized);
+        MPI_Finalized(&finalized);
+        return initialized && !finalized;
+#else
+        return false;
+#endif
+    }
+
+    double seconds_since(const std::chrono::steady_clock::time_point& start){
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Run a unit, returning the message of the exception it threw, or an empty string
+    std::string run_unit(const std::function<void(std::size_t, std::vector<double>&)>& unit, const std::size_t i, std::vector<double>& rows){
+        try{
+            unit(i, rows);
+            return "";
+        }
+        catch(const std::exception& e){
+            rows.clear();
+            return (std::strlen(e.what()) > 0) ? e.what() : "unknown error";
+        }
+        catch(...){
+            rows.clear();
+            return "unknown error";
+        }
+    }
+
+    /// Write the rows of a completed unit to the sink, or record its failure
+    void collect(tracesink::TraceSink& sink, SweepSummary& s, const std::size_t i, const std::vector<double>& rows, const std::string& err){
+        const auto width = sink.get_schema().row_width();
+        if (err.empty() && rows.size() % width != 0){
+            s.failures.push_back("unit " + std::to_string(i) + ": " + std::to_string(rows.size()) + " values are not whole rows of " + std::to_string(width));
+            return;
+        }
+        if (!err.empty()){
+            s.failures.push_back("unit " + std::to_string(i) + ": " + err);
+            return;
+        }
+        for (std::size_t k = 0; k < rows.size(); k += width){
+            sink.append(rows.data() + k);
+        }
+        s.Nrows += rows.size()/width;
+    }
+
+    SweepSummary run_local(const std::size_t Nunits, const tracesink::Schema& schema, const std::function<void(std::size_t, std::vector<double>&)>& unit, const SweepOptions& options){
+        SweepSummary s;
+        s.Nunits = Nunits;
+        s.units_per_rank = {Nunits};
+        tracesink::TraceSink sink(options.path, schema, options.sink);
+        std::mutex mtx;
+        auto threads = options.threads;
+        threads.chunk_size = 1;
+        parallel::parallel_for(Nunits, [&](std::size_t istart, std::size_t iend){
+            for (auto i = istart; i < iend; ++i){
+                std::vector<double> rows;
+                auto err = run_unit(unit, i, rows);
+                std::lock_guard<std::mutex> lock(mtx);
+                collect(sink, s, i, rows, err);
+            }
+        }, threads);
+        sink.close();
+        return s;
+    }
+
+#if defined(TEQP_MPI_ENABLED)
+    enum Tag : int { tag_result = 7301, tag_assign = 7302 };
+
+    /**
+     The message of a worker to the root, with the result of its last unit, which also asks for the next one: the int64
+     index of the unit (-1 for the first message), the int64 number of doubles and the int64 length of the message of the
+     exception, followed by the doubles and the characters of the message
+     */
+    std::vector<char> pack(const long long i, const std::vector<double>& rows, const std::string& err){
+        const long long header[3] = {i, static_cast<long long>(rows.size()), static_cast<long long>(err.size())};
+        const std::size_t Nbytes = sizeof(header) + rows.size()*sizeof(double) + err.size();
+        if (Nbytes > static_cast<std::size_t>(INT_MAX)){
+            throw teqp::InvalidArgument("The rows of unit " + std::to_string(i) + " are too large for one MPI message");
+        }
+        std::vector<char> buf(Nbytes);
+        std::memcpy(buf.data(), header, sizeof(header));
+        std::memcpy(buf.data() + sizeof(header), rows.data(), rows.size()*sizeof(double));
+        std::memcpy(buf.data() + sizeof(header) + rows.size()*sizeof(double), err.data(), err.size());
+        return buf;
+    }
+
+    SweepSummary run_mpi(const std::size_t Nunits, const tracesink::Schema& schema, const std::function<void(std::size_t, std::vector<double>&)>& unit, const SweepOptions& options, const int rank, const int size){
+        SweepSummary s;
+        s.Nunits = Nunits;
+        s.Nranks = size;
+        if (rank == options.root){
+            tracesink::TraceSink sink(options.path, schema, options.sink);
+            s.units_per_rank.assign(size, 0);
+            std::size_t next = 0;
+            int active = size - 1;
+            std::vector<char> buf;
+            std::vector<double> rows;
+            while (active > 0){
+                MPI_Status status;
+                MPI_Probe(MPI_ANY_SOURCE, tag_result, MPI_COMM_WORLD, &status);
+                int count = 0;
+                MPI_Get_count(&status, MPI_BYTE, &count);
+                buf.resize(count);
+                MPI_Recv(buf.data(), count, MPI_BYTE, status.MPI_SOURCE, tag_result, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+                long long header[3];
+                std::memcpy(header, buf.data(), sizeof(header));
+                if (header[0] >= 0){
+                    rows.resize(header[1]);
+                    std::memcpy(rows.data(), buf.data() + sizeof(header), rows.size()*sizeof(double));
+                    std::string err(buf.data() + sizeof(header) + rows.size()*sizeof(double), header[2]);
+                    s.units_per_rank[status.MPI_SOURCE]++;
+                    collect(sink, s, static_cast<std::size_t>(header[0]), rows, err);
+                }
+                long long assign = -1;
+                if (next < Nunits){
+                    assign = static_cast<long long>(next++);
+                }
+                else{
+                    active--;
+                }
+                MPI_Send(&assign, 1, MPI_LONG_LONG, status.MPI_SOURCE, tag_assign, MPI_COMM_WORLD);
+            }
+            sink.close();
+        }
+        else{
+            long long current = -1;
+            std::vector<double> rows;
+            std::string err;
+            std::vector<char> buf;
+            while (true){
+                // A unit whose rows cannot be sent is reported as failed, so that the root still hears from this rank
+                try{
+                    buf = pack(current, rows, err);
+                }
+                catch(const std::exception& e){
+                    rows.clear();
+                    err = e.what();
+                    buf = pack(current, rows, err);
+                }
+                MPI_Send(buf.data(), static_cast<int>(buf.size()), MPI_BYTE, options.root, tag_result, MPI_COMM_WORLD);
+                MPI_Recv(&current, 1, MPI_LONG_LONG, options.root, tag_assign, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                if (current < 0){
+                    break;
+                }
+                rows.clear();
+                err = run_unit(unit, static_cast<std::size_t>(current), rows);
+            }
+        }
+        // So that the sink is complete on all the ranks when the sweep returns
+        MPI_Barrier(MPI_COMM_WORLD);
+        return s;
+    }
+#endif
+
+    /// The options of the sweeps whose units are run one after the other in one process
+    SweepOptions serial_units(const SweepOptions& options){
+        auto o = options;
+        o.threads.Nthreads = 1;
+        return o;
+    }
+
+    tracesink::Schema with_unit(const tracesink::Schema& schema){
+        tracesink::Schema s;
+        s.columns.push_back(tracesink::Column{"unit", 1});
+        s.columns.insert(s.columns.end(), schema.columns.begin(), schema.columns.end());
+        return s;
+    }
+
+    void append_VLE_row(std::vector<double>& rows, const std::size_t i, const VLETracePoint& pt){
+        for (double v : {static_cast<double>(i), pt.t, pt.dt, pt.T, pt.pL, pt.pV, pt.c}){
+            rows.push_back(v);
+        }
+        rows.insert(rows.end(), pt.rhovecL.data(), pt.rhovecL.data() + pt.rhovecL.size());
+        rows.insert(rows.end(), pt.rhovecV.data(), pt.rhovecV.data() + pt.rhovecV.size());
+    }
+
+    void check_rows(const Eigen::Index M, const Eigen::Index Mother, const std::string& what){
+        if (Mother != M){
+            throw teqp::InvalidArgument("The number of rows of " + what + " (" + std::to_string(Mother) + ") is not the number of units (" + std::to_string(M) + ")");
+        }
+    }
+}
+
+bool mpi_available(){
+#if defined(TEQP_MPI_ENABLED)
+    return true;
+#else
+    return false;
+#endif
+}
+
+int get_rank(){
+#if defined(TEQP_MPI_ENABLED)
+    if (mpi_running()){
+        int rank = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        return rank;
+    }
+#endif
+    return 0;
+}
+
+int get_size(){
+#if defined(TEQP_MPI_ENABLED)
+    if (mpi_running()){
+        int size = 1;
+        MPI_Comm_size(MPI_COMM_WORLD, &size);
+        return size;
+    }
+#endif
+    return 1;
+}
+
+SweepSummary run_sweep(const std::size_t Nunits, const tracesink::Schema& schema, const std::function<void(std::size_t, std::vector<double>&)>& unit, const SweepOptions& options){
+    if (schema.columns.empty() || schema.columns.front().name != "unit" || schema.columns.front().width != 1){
+        throw teqp::InvalidArgument("The first column of the schema of a sweep must be \"unit\"");
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const int size = get_size();
+    if (options.root < 0 || options.root >= size){
+        throw teqp::InvalidArgument("The root rank " + std::to_string(options.root) + " is not one of the " + std::to_string(size) + " ranks");
+    }
+    SweepSummary s;
+#if defined(TEQP_MPI_ENABLED)
+    if (size > 1){
+        s = run_mpi(Nunits, schema, unit, options, get_rank(), size);
+    }
+    else{
+        s = run_local(Nunits, schema, unit, options);
+    }
+#else
+    s = run_local(Nunits, schema, unit, options);
+#endif
+    s.elapsed_s = seconds_since(start);
+    return s;
+}
+
+SweepSummary sweep_Ar_block(const AbstractModel& model, const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac, const std::size_t chunk, const SweepOptions& options, const device::BatchOptions& batch_options){
+    const auto M = T.size();
+    check_rows(M, rho.size(), "rho");
+    check_rows(M, molefrac.rows(), "molefrac");
+    if (chunk == 0){
+        throw teqp::InvalidArgument("The number of state points of a unit must be positive");
+    }
+    std::unique_ptr<device::BatchEvaluator> batch;
+    try{
+        batch = std::make_unique<device::BatchEvaluator>(model, batch_options);
+    }
+    catch(const teqp::NotImplementedError&){
+        // Evaluated with the model instead
+    }
+    const std::size_t Nblock = static_cast<std::size_t>((NT + 1)*(ND + 1));
+    tracesink::Schema schema{{{"unit", 1}, {"index", 1}, {"Ar", Nblock}}};
+    const std::size_t Nunits = (static_cast<std::size_t>(M) + chunk - 1)/chunk;
+    auto unit = [&](std::size_t i, std::vector<double>& rows){
+        const Eigen::Index istart = static_cast<Eigen::Index>(i*chunk), n = std::min<Eigen::Index>(static_cast<Eigen::Index>(chunk), M - istart);
+        const EArrayd Ti = T.segment(istart, n), rhoi = rho.segment(istart, n);
+        const EMatrixd zi = molefrac.middleRows(istart, n);
+        EMatrixd block;
+        if (batch){
+            block = batch->get_Ar_block(NT, ND, Ti, rhoi, zi);
+        }
+        else{
+            block.resize(n, Nblock);
+            for (auto a = 0; a <= NT; ++a){
+                for (auto b = 0; b <= ND; ++b){
+                    block.col(a*(ND + 1) + b) = (a + b == 0) ? EArrayd::Zero(n) : model.get_Arxy_many(a, b, Ti, rhoi, zi);
+                }
+            }
+            // get_Arxy_many does not give the residual Helmholtz energy itself
+            for (auto k = 0; k < n; ++k){
+                block(k, 0) = model.get_Ar00(Ti(k), rhoi(k), zi.row(k).transpose().eval());
+            }
+        }
+        rows.reserve(static_cast<std::size_t>(n)*(Nblock + 2));
+        for (auto k = 0; k < n; ++k){
+            rows.push_back(static_cast<double>(i));
+            rows.push_back(static_cast<double>(istart + k));
+            for (std::size_t c = 0; c < Nblock; ++c){
+                rows.push_back(block(k, c));
+            }
+        }
+    };
+    return run_sweep(Nunits, schema, unit, serial_units(options));
+}
+
+SweepSummary sweep_VLE_isotherms(const AbstractModel& model, const REArrayd& T, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const SweepOptions& options, const std::optional<TVLEOptions>& trace_options){
+    check_rows(T.size(), rhovecL0.rows(), "rhovecL0");
+    check_rows(T.size(), rhovecV0.rows(), "rhovecV0");
+    auto unit = [&](std::size_t i, std::vector<double>& rows){
+        const Eigen::ArrayXd rhovecL = rhovecL0.row(i).transpose(), rhovecV = rhovecV0.row(i).transpose();
+        trace_VLE_isotherm_binary(model, T(i), rhovecL, rhovecV, [&](const VLETracePoint& pt){ append_VLE_row(rows, i, pt); return true; }, trace_options);
+    };
+    return run_sweep(static_cast<std::size_t>(T.size()), with_unit(tracesink::VLE_trace_schema(rhovecL0.cols())), unit, options);
+}
+
+SweepSummary sweep_VLE_isobars(const AbstractModel& model, const REArrayd& p, const REArrayd& T0, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const SweepOptions& options, const std::optional<PVLEOptions>& trace_options){
+    check_rows(p.size(), T0.size(), "T0");
+    check_rows(p.size(), rhovecL0.rows(), "rhovecL0");
+    check_rows(p.size(), rhovecV0.rows(), "rhovecV0");
+    auto unit = [&](std::size_t i, std::vector<double>& rows){
+        const Eigen::ArrayXd rhovecL = rhovecL0.row(i).transpose(), rhovecV = rhovecV0.row(i).transpose();
+        trace_VLE_isobar_binary(model, p(i), T0(i), rhovecL, rhovecV, [&](const VLETracePoint& pt){ append_VLE_row(rows, i, pt); return true; }, trace_options);
+    };
+    return run_sweep(static_cast<std::size_t>(p.size()), with_unit(tracesink::VLE_trace_schema(rhovecL0.cols())), unit, options);
+}
+
+SweepSummary sweep_critical_loci(const AbstractModel& model, const REArrayd& T0, const REMatrixd& rhovec0, const SweepOptions& options, const std::optional<TCABOptions>& trace_options){
+    check_rows(T0.size(), rhovec0.rows(), "rhovec0");
+    tracesink::Schema schema{{{"unit", 1}, {"t", 1}, {"T", 1}, {"rhovec", 2}, {"p", 1}}};
+    auto unit = [&](std::size_t i, std::vector<double>& rows){
+        const Eigen::ArrayXd rhovec = rhovec0.row(i).transpose();
+        auto trace = model.trace_critical_arclength_binary(T0(i), rhovec, std::nullopt, trace_options);
+        for (const auto& pt : trace){
+            rows.push_back(static_cast<double>(i));
+            for (const char* key : {"t", "T / K", "rho0 / mol/m^3", "rho1 / mol/m^3", "p / Pa"}){
+                rows.push_back(pt.at(key).get<double>());
+            }
+        }
+    };
+    return run_sweep(static_cast<std::size_t>(T0.size()), schema, unit, options);
+}
+
+SweepSummary sweep_property_tables(const std::vector<PropertyTableTask>& tasks, const SweepOptions& options){
+    tracesink::Schema schema{{{"unit", 1}, {"Npatches", 1}, {"size_bytes", 1}, {"elapsed_s", 1}}};
+    auto unit = [&](std::size_t i, std::vector<double>& rows){
+        const auto start = std::chrono::steady_clock::now();
+        const auto& task = tasks[i];
+        auto ar = cppinterface::make_model(task.model);
+        auto aig = cppinterface::make_model(task.aig);
+        auto sa = superancillary::build_pure_superancillary(*ar, task.superancillary);
+        auto table = (task.kind == tables::TableKind::Trho) ? tables::build_property_table_Trho(*ar, *aig, sa, task.options) : tables::build_property_table_ph(*ar, *aig, sa, task.options);
+        table.save(task.path);
+        rows = {static_cast<double>(i), static_cast<double>(table.get_Npatches()), static_cast<double>(table.size_bytes()), seconds_since(start)};
+    };
+    return run_sweep(tasks.size(), schema, unit, serial_units(options));
+}
+
+}
+}
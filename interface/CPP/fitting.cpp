@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+#include "teqp/cpp/fitting.hpp"
+#include "teqp/exceptions.hpp"
+
+namespace teqp{
+namespace fitting{
+
+using cppinterface::AbstractModel;
+
+namespace{
+    /**
+     Call f(i) for i in [0, N) over chunks claimed from a shared counter by the workers of the pool and by the calling thread,
+     and return once all the chunks are done.  The tasks that start after that find no chunk left, and never call f.  The
+     first exception thrown by f is re-thrown in the calling thread.
+     */
+    void run_on_pool(async::ThreadPool& pool, const std::size_t N, const std::size_t chunk_size, const std::function<void(std::size_t)>& f){
+        if (N == 0){ return; }
+        const std::size_t chunk = std::max<std::size_t>(chunk_size, 1);
+        const std::size_t Nchunks = (N + chunk - 1)/chunk;
+        struct State{
+            std::atomic<std::size_t> next{0};
+            std::size_t Ndone = 0;
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::exception_ptr first_exception;
+        };
+        auto state = std::make_shared<State>();
+        auto work = [state, N, chunk, Nchunks, &f](){
+            while (true){
+                auto istart = state->next.fetch_add(chunk);
+                if (istart >= N){ return; }
+                std::exception_ptr exception;
+                try{
+                    for (auto i = istart; i < std::min(istart + chunk, N); ++i){
+                        f(i);
+                    }
+                }
+                catch(...){
+                    exception = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (exception && !state->first_exception){ state->first_exception = exception; }
+                if (++state->Ndone == Nchunks){ state->cv.notify_all(); }
+            }
+        };
+        for (std::size_t i = 0; i < std::min(pool.size(), Nchunks - 1); ++i){
+            pool.submit(work);
+        }
+        work();
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [&](){ return state->Ndone == Nchunks; });
+        if (state->first_exception){
+            std::rethrow_exception(state->first_exception);
+        }
+    }
+
+    std::size_t count_residuals(const DataPoint& pt){
+        return (pt.kind == PointKind::PTxy && pt.y.size() > 0) ? static_cast<std::size_t>(pt.x.size()) : 1;
+    }
+
+    void check_point(const DataPoint& pt, const std::size_t i){
+        auto fail = [i](const std::string& msg){ throw teqp::InvalidArgument("Data point " + std::to_string(i) + ": " + msg); };
+        if (!(pt.T > 0)){ fail("T must be positive"); }
+        switch (pt.kind){
+            case PointKind::density:
+                if (!(pt.p > 0) || !(pt.rho > 0)){ fail("p and rho must be positive"); }
+                if (pt.x.size() == 0){ fail("x must be given"); }
+                break;
+            case PointKind::psat:
+                if (!(pt.p > 0)){ fail("p must be positive"); }
+                if (pt.rhovecL0.size() != 1 || pt.rhovecV0.size() != 1){ fail("rhovecL0 and rhovecV0 must be of length 1"); }
+                break;
+            case PointKind::PTxy:
+                if (!(pt.p > 0)){ fail("p must be positive"); }
+                if (pt.x.size() < 2 || pt.rhovecL0.size() != pt.x.size() || pt.rhovecV0.size() != pt.x.size()){ fail("x, rhovecL0 and rhovecV0 must be of the same length, at least 2"); }
+                if (pt.y.size() != 0 && pt.y.size() != pt.x.size()){ fail("y must be empty or of the length of x"); }
+                break;
+            case PointKind::virial:
+                if (pt.x.size() == 0){ fail("x must be given"); }
+                break;
+        }
+    }
+
+    /// The residuals of one point, written to r; if the point is a VLE point, its converged phases are stored in rhovecL and rhovecV
+    bool evaluate_point(const AbstractModel& model, const DataPoint& pt, const EArrayd& rhovecL0, const EArrayd& rhovecV0, const ObjectiveOptions& options, double* r, EArrayd& rhovecL, EArrayd& rhovecV){
+        try{
+            switch (pt.kind){
+                case PointKind::density:{
+                    double rho = model.solve_rho_Tp(pt.T, pt.p, pt.x, pt.phase);
+                    if (!std::isfinite(rho)){ return false; }
+                    r[0] = pt.weight*(rho/pt.rho - 1);
+                    return true;
+                }
+                case PointKind::psat:{
+                    auto rhos = model.pure_VLE_T(pt.T, rhovecL0[0], rhovecV0[0], options.maxiter);
+                    if (!rhos.allFinite() || (rhos <= 0).any() || std::abs(rhos[0]/rhos[1] - 1) < 1e-6){ return false; }
+                    auto z = (EArrayd(1) << 1.0).finished();
+                    double p = rhos[0]*model.get_R(z)*pt.T*(1 + model.get_Ar01(pt.T, rhos[0], z));
+                    r[0] = pt.weight*(p/pt.p - 1);
+                    rhovecL = rhos.head(1);
+                    rhovecV = rhos.tail(1);
+                    return true;
+                }
+                case PointKind::PTxy:{
+                    auto [code, L, V] = model.mix_VLE_Tx(pt.T, rhovecL0, rhovecV0, pt.x, 1e-10, 1e-10, 1e-10, 1e-10, options.maxiter);
+                    bool converged = (code == VLE_return_code::xtol_satisfied || code == VLE_return_code::functol_satisfied);
+                    if (!converged || !L.allFinite() || !V.allFinite() || (L <= 0).any() || (V <= 0).any() || std::abs(L.sum()/V.sum() - 1) < 1e-6){ return false; }
+                    double p = L.sum()*model.get_R(pt.x)*pt.T + model.get_pr(pt.T, L);
+                    r[0] = pt.weight*(p/pt.p - 1);
+                    if (pt.y.size() > 0){
+                        const auto N = pt.x.size();
+                        EArrayd y = V/V.sum();
+                        for (auto i = 0; i < N - 1; ++i){
+                            r[1 + i] = pt.weight*(y[i] - pt.y[i]);
+                        }
+                    }
+                    rhovecL = L;
+                    rhovecV = V;
+                    return true;
+                }
+                case PointKind::virial:
+                    r[0] = pt.weight*(model.get_B2vir(pt.T, pt.x) - pt.B2);
+                    return std::isfinite(r[0]);
+            }
+        }
+        catch(const std::exception&){
+        }
+        return false;
+    }
+}
+
+struct FitObjective::Impl{
+    std::vector<DataPoint> points;
+    ModelFactory factory;
+    ParameterUpdate update;
+    ObjectiveOptions options;
+    async::ThreadPool& pool;
+    std::vector<std::size_t> offsets;
+    std::size_t Nresiduals = 0;
+    std::vector<std::unique_ptr<AbstractModel>> models; ///< One copy per set of parameters: those given, then those of the forward differences
+    std::vector<EArrayd> rhovecL, rhovecV; ///< The guesses of the phases of the VLE points
+
+    Impl(const std::vector<DataPoint>& points, const ModelFactory& factory, const ParameterUpdate& update, const ObjectiveOptions& options, async::ThreadPool& pool)
+    : points(points), factory(factory), update(update), options(options), pool(pool){
+        if (!factory || !update){
+            throw teqp::InvalidArgument("The model factory and the parameter update must be given");
+        }
+        for (std::size_t i = 0; i < points.size(); ++i){
+            check_point(points[i], i);
+            offsets.push_back(Nresiduals);
+            Nresiduals += count_residuals(points[i]);
+            rhovecL.push_back(points[i].rhovecL0);
+            rhovecV.push_back(points[i].rhovecV0);
+        }
+    }
+};
+
+FitObjective::FitObjective(const std::vector<DataPoint>& points, const ModelFactory& factory, const ParameterUpdate& update, const ObjectiveOptions& options, async::ThreadPool& pool)
+: impl(std::make_unique<Impl>(points, factory, update, options, pool)) {}
+
+FitObjective::~FitObjective() = default;
+
+std::size_t FitObjective::get_Nresiduals() const { return impl->Nresiduals; }
+
+const std::vector<std::size_t>& FitObjective::get_offsets() const { return impl->offsets; }
+
+ObjectiveResult FitObjective::evaluate(const EArrayd& params, const bool jacobian){
+    auto& I = *impl;
+    const auto Nparams = static_cast<std::size_t>(params.size());
+    const std::size_t Nsets = jacobian ? Nparams + 1 : 1;
+    const std::size_t Npoints = I.points.size();
+
+    // Bring the copies of the model to their parameters
+    EArrayd steps = (I.options.rel_step*params.abs()).max(I.options.abs_step);
+    while (I.models.size() < Nsets){
+        I.models.push_back(I.factory());
+    }
+    for (std::size_t k = 0; k < Nsets; ++k){
+        EArrayd p = params;
+        if (k > 0){ p[k - 1] += steps[k - 1]; }
+        I.update(I.models[k], p);
+        if (!I.models[k]){
+            throw teqp::InvalidArgument("The parameter update left the model empty");
+        }
+    }
+
+    // All the evaluations, point-major within each set of parameters
+    EMatrixd R(I.Nresiduals, Nsets);
+    std::vector<char> success(Npoints, 0); // Not std::vector<bool>, whose elements cannot be written concurrently
+    std::vector<EArrayd> newL(Npoints), newV(Npoints);
+    run_on_pool(I.pool, Nsets*Npoints, I.options.chunk_size, [&](std::size_t k){
+        const std::size_t iset = k/Npoints, ipt = k % Npoints;
+        const auto& pt = I.points[ipt];
+        double* r = &R(I.offsets[ipt], iset);
+        EArrayd L, V;
+        bool ok = evaluate_point(*I.models[iset], pt, I.rhovecL[ipt], I.rhovecV[ipt], I.options, r, L, V);
+        if (!ok){
+            std::fill(r, r + count_residuals(pt), I.options.failure_residual);
+        }
+        if (iset == 0){
+            success[ipt] = ok;
+            newL[ipt] = std::move(L);
+            newV[ipt] = std::move(V);
+        }
+    });
+    if (I.options.warm_start){
+        for (std::size_t i = 0; i < Npoints; ++i){
+            if (success[i] && newL[i].size() > 0){
+                I.rhovecL[i] = newL[i];
+                I.rhovecV[i] = newV[i];
+            }
+        }
+    }
+
+    ObjectiveResult result;
+    result.residuals = R.col(0).array();
+    if (jacobian){
+        result.jacobian.resize(I.Nresiduals, Nparams);
+        for (std::size_t j = 0; j < Nparams; ++j){
+            result.jacobian.col(j) = (R.col(j + 1) - R.col(0))/steps[j];
+        }
+    }
+    result.success.assign(success.begin(), success.end());
+    return result;
+}
+
+}
+}
@@ -0,0 +1,13 @@
+#include "model_factories.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/CPA.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            ModelPointer make_CPA(const nlohmann::json& spec){
+                return adapter::make_owned(CPA::CPAfactory(spec));
+            }
+        }
+    }
+}
@@ -0,0 +1,13 @@
+#include "model_factories.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/ammonia_water.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            ModelPointer make_AmmoniaWaterTillnerRoth(const nlohmann::json&){
+                return adapter::make_owned(AmmoniaWaterTillnerRoth());
+            }
+        }
+    }
+}
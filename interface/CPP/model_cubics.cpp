@@ -0,0 +1,26 @@
+#include "model_factories.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/vdW.hpp"
+#include "teqp/models/cubics.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            ModelPointer make_vdW1(const nlohmann::json& spec){
+                return adapter::make_owned(vdWEOS1(spec.at("a"), spec.at("b")));
+            }
+            ModelPointer make_vdW(const nlohmann::json& spec){
+                return adapter::make_owned(vdWEOS<double>(spec.at("Tcrit / K"), spec.at("pcrit / Pa")));
+            }
+            ModelPointer make_PR(const nlohmann::json& spec){
+                return adapter::make_owned(make_canonicalPR(spec));
+            }
+            ModelPointer make_SRK(const nlohmann::json& spec){
+                return adapter::make_owned(make_canonicalSRK(spec));
+            }
+            ModelPointer make_cubic(const nlohmann::json& spec){
+                return adapter::make_owned(make_generalizedcubic(spec));
+            }
+        }
+    }
+}
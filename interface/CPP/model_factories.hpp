@@ -0,0 +1,55 @@
+#pragma once
+
+/*
+ The functions that build each kind of model of the factory.  Each family of models has its own compilation unit (the
+ interface/CPP/model_*.cpp files), in which its DerivativeAdapter is instantiated.  These are the hot code of the library:
+ they can be compiled with their own optimization options, and with profile-guided optimization (see TEQP_PGO in
+ CMakeLists.txt), separately from the cold code of the factory, of the JSON handling and of the algorithms.
+ */
+
+#include "teqp/cpp/teqpcpp.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            using ModelPointer = std::unique_ptr<AbstractModel>;
+
+            // model_cubics.cpp
+            ModelPointer make_vdW1(const nlohmann::json& spec);
+            ModelPointer make_vdW(const nlohmann::json& spec);
+            ModelPointer make_PR(const nlohmann::json& spec);
+            ModelPointer make_SRK(const nlohmann::json& spec);
+            ModelPointer make_cubic(const nlohmann::json& spec);
+
+            // model_CPA.cpp
+            ModelPointer make_CPA(const nlohmann::json& spec);
+
+            // model_PCSAFT.cpp
+            ModelPointer make_PCSAFT(const nlohmann::json& spec);
+
+            // model_SAFTVRMie.cpp
+            ModelPointer make_SAFTVRMie(const nlohmann::json& spec);
+
+            // model_multifluid.cpp
+            ModelPointer make_multifluid(const nlohmann::json& spec);
+
+            // model_potentials.cpp
+            ModelPointer make_SW_EspindolaHeredia2009(const nlohmann::json& spec);
+            ModelPointer make_EXP6_Kataoka1992(const nlohmann::json& spec);
+            ModelPointer make_2CLJF_Dipole(const nlohmann::json& spec);
+            ModelPointer make_2CLJF_Quadrupole(const nlohmann::json& spec);
+
+            // model_mie.cpp
+            ModelPointer make_LJ126_TholJPCRD2016(const nlohmann::json& spec);
+            ModelPointer make_LJ126_KolafaNezbeda1994(const nlohmann::json& spec);
+            ModelPointer make_LJ126_Johnson1993(const nlohmann::json& spec);
+            ModelPointer make_Mie_Pohl2023(const nlohmann::json& spec);
+
+            // model_ammonia_water.cpp
+            ModelPointer make_AmmoniaWaterTillnerRoth(const nlohmann::json& spec);
+
+            // model_ideal.cpp
+            ModelPointer make_IdealHelmholtz(const nlohmann::json& spec);
+        }
+    }
+}
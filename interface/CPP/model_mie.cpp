@@ -0,0 +1,23 @@
+#include "model_factories.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/mie/lennardjones.hpp"
+#include "teqp/models/mie/mie.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            ModelPointer make_LJ126_TholJPCRD2016(const nlohmann::json&){
+                return adapter::make_owned(build_LJ126_TholJPCRD2016());
+            }
+            ModelPointer make_LJ126_KolafaNezbeda1994(const nlohmann::json&){
+                return adapter::make_owned(LJ126KolafaNezbeda1994());
+            }
+            ModelPointer make_LJ126_Johnson1993(const nlohmann::json&){
+                return adapter::make_owned(LJ126Johnson1993());
+            }
+            ModelPointer make_Mie_Pohl2023(const nlohmann::json& spec){
+                return adapter::make_owned(Mie::Mie6Pohl2023(spec.at("lambda_a")));
+            }
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#include "model_factories.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/multifluid.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            ModelPointer make_multifluid(const nlohmann::json& spec){
+                return adapter::make_owned(multifluidfactory(spec));
+            }
+        }
+
+        std::unique_ptr<AbstractModel> make_multifluid_model(const std::vector<std::string>& components, const std::string& coolprop_root, const std::string& BIPcollectionpath, const nlohmann::json& flags, const std::string& departurepath) {
+            return adapter::make_owned(build_multifluid_model(components, coolprop_root, BIPcollectionpath, flags, departurepath));
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#include "model_factories.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/model_potentials/squarewell.hpp"
+#include "teqp/models/model_potentials/exp6.hpp"
+#include "teqp/models/model_potentials/2center_ljf.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+        namespace factories {
+            ModelPointer make_SW_EspindolaHeredia2009(const nlohmann::json& spec){
+                return adapter::make_owned(squarewell::EspindolaHeredia2009(spec.at("lambda")));
+            }
+            ModelPointer make_EXP6_Kataoka1992(const nlohmann::json& spec){
+                return adapter::make_owned(exp6::Kataoka1992(spec.at("alpha")));
+            }
+            ModelPointer make_2CLJF_Dipole(const nlohmann::json& spec){
+                return adapter::make_owned(twocenterljf::build_two_center_model_dipole(spec.at("author"), spec.at("L^*"), spec.at("(mu^*)^2")));
+            }
+            ModelPointer make_2CLJF_Quadrupole(const nlohmann::json& spec){
+                return adapter::make_owned(twocenterljf::build_two_center_model_quadrupole(spec.at("author"), spec.at("L^*"), spec.at("(mu^*)^2")));
+            }
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/models/fwd.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+
+        namespace {
+            const int snapshot_version = 1;
+
+            nlohmann::json PCSAFT_spec(const PCSAFT_t& model){
+                nlohmann::json coeffs = nlohmann::json::array();
+                for (const auto& c : model.get_coeffs()){
+                    coeffs.push_back({
+                        {"name", c.name}, {"m", c.m}, {"sigma_Angstrom", c.sigma_Angstrom}, {"epsilon_over_k", c.epsilon_over_k}, {"BibTeXKey", c.BibTeXKey},
+                        {"(mu^*)^2", c.mustar2}, {"nmu", c.nmu}, {"(Q^*)^2", c.Qstar2}, {"nQ", c.nQ}
+                    });
+                }
+                const Eigen::ArrayXXd kmat = model.get_kmat();
+                std::vector<std::vector<double>> k(kmat.rows(), std::vector<double>(kmat.cols()));
+                for (auto i = 0; i < kmat.rows(); ++i){
+                    for (auto j = 0; j < kmat.cols(); ++j){ k[i][j] = kmat(i, j); }
+                }
+                return {{"coeffs", coeffs}, {"kmat", k}};
+            }
+
+            nlohmann::json SAFTVRMie_spec(const SAFTVRMie_t& model){
+                // Only the parameters of the chain are kept by the model; those of the polar contribution are not
+                if (model.has_polar()){
+                    throw teqp::NotImplementedError("Snapshots of SAFT-VR-Mie models with a polar contribution are not supported");
+                }
+                const auto& terms = model.get_terms();
+                if (terms.epsilon_ij_flag != SAFTVRMie::EpsilonijFlags::kLafitte){
+                    throw teqp::NotImplementedError("Snapshots of SAFT-VR-Mie models are only supported for the default combining rule of epsilon_ij");
+                }
+                nlohmann::json coeffs = nlohmann::json::array();
+                for (auto i = 0; i < terms.m.size(); ++i){
+                    coeffs.push_back({
+                        {"name", std::to_string(i)}, {"m", terms.m[i]}, {"sigma_Angstrom", terms.sigma_A[i]}, {"epsilon_over_k", terms.epsilon_over_k[i]},
+                        {"lambda_r", terms.lambda_r[i]}, {"lambda_a", terms.lambda_a[i]}, {"BibTeXKey", ""}
+                    });
+                }
+                std::vector<std::vector<double>> k(terms.kmat.rows(), std::vector<double>(terms.kmat.cols()));
+                for (auto i = 0; i < terms.kmat.rows(); ++i){
+                    for (auto j = 0; j < terms.kmat.cols(); ++j){ k[i][j] = terms.kmat(i, j); }
+                }
+                return {{"coeffs", coeffs}, {"kmat", k}};
+            }
+
+            /// The specification for make_model that rebuilds the model without looking anything up in the fluid libraries or on disk
+            nlohmann::json get_self_contained_spec(const AbstractModel& am){
+                using namespace teqp::cppinterface::adapter;
+                const auto& index = am.get_type_index();
+                if (index == std::type_index(typeid(multifluid_t))){
+                    return {{"kind", "multifluid"}, {"model", {{"data", get_multifluid_model_data(get_model_cref<multifluid_t>(&am))}}}};
+                }
+                else if (index == std::type_index(typeid(PCSAFT_t))){
+                    return {{"kind", "PCSAFT"}, {"model", PCSAFT_spec(get_model_cref<PCSAFT_t>(&am))}};
+                }
+                else if (index == std::type_index(typeid(SAFTVRMie_t))){
+                    return {{"kind", "SAFT-VR-Mie"}, {"model", SAFTVRMie_spec(get_model_cref<SAFTVRMie_t>(&am))}};
+                }
+                else if (index == std::type_index(typeid(vdWEOS1))){
+                    const auto& model = get_model_cref<vdWEOS1>(&am);
+                    return {{"kind", "vdW1"}, {"model", {{"a", model.get_a()}, {"b", model.get_b()}}}};
+                }
+                else if (index == std::type_index(typeid(ammonia_water_TillnerRoth_t))){
+                    return {{"kind", "AmmoniaWaterTillnerRoth"}, {"model", nlohmann::json::object()}};
+                }
+                else if (index == std::type_index(typeid(LJ126KolafaNezbeda1994_t))){
+                    return {{"kind", "LJ126_KolafaNezbeda1994"}, {"model", nlohmann::json::object()}};
+                }
+                else if (index == std::type_index(typeid(LJ126Johnson1993_t))){
+                    return {{"kind", "LJ126_Johnson1993"}, {"model", nlohmann::json::object()}};
+                }
+                throw teqp::NotImplementedError(std::string("Snapshots are not supported for models of type ") + index.name());
+            }
+        }
+
+        std::vector<std::uint8_t> AbstractModel::serialize() const {
+            return nlohmann::json::to_cbor({
+                {"format", "teqp-model"}, {"version", snapshot_version}, {"spec", get_self_contained_spec(*this)}
+            });
+        }
+
+        std::unique_ptr<AbstractModel> deserialize_model(const std::vector<std::uint8_t>& bytes) {
+            const auto j = nlohmann::json::from_cbor(bytes);
+            if (j.value("format", "") != "teqp-model" || j.value("version", 0) != snapshot_version) {
+                throw teqp::InvalidArgument("Data are not a snapshot of a model of a known version");
+            }
+            return make_model(j.at("spec"));
+        }
+    }
+}
@@ -0,0 +1,293 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "teqp/cpp/parallel.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/algorithms/critical_pure.hpp"
+
+namespace teqp{
+namespace parallel{
+
+void parallel_for(const std::size_t N, const std::function<void(std::size_t, std::size_t)>& f, const ParallelOptions& options){
+    if (N == 0){ return; }
+    const std::size_t chunk = std::max<std::size_t>(options.chunk_size, 1);
+    const std::size_t Nchunks = (N + chunk - 1)/chunk;
+    std::size_t Nthreads = (options.Nthreads == 0) ? std::thread::hardware_concurrency() : options.Nthreads;
+    Nthreads = std::max<std::size_t>(std::min(Nthreads, Nchunks), 1);
+    
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> stop{false};
+    std::exception_ptr first_exception;
+    std::mutex exception_mutex;
+    
+    auto worker = [&](){
+        while (!stop){
+            auto istart = next.fetch_add(chunk);
+            if (istart >= N){ break; }
+            try{
+                f(istart, std::min(istart + chunk, N));
+            }
+            catch(...){
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!first_exception){ first_exception = std::current_exception(); }
+                stop = true;
+            }
+        }
+    };
+    
+    // The calling thread also does work
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < Nthreads; ++i){
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : threads){ t.join(); }
+    
+    if (first_exception){
+        std::rethrow_exception(first_exception);
+    }
+}
+
+namespace{
+    void check_lengths(const REArrayd& T, const Eigen::Index Nrows, const Eigen::Index Nrho){
+        if (Nrows != T.size() || Nrho != T.size()){
+            throw teqp::InvalidArgument("The number of state points in the inputs is not consistent");
+        }
+    }
+}
+
+EArrayd get_Arxy_many(const cppinterface::AbstractModel& model, const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac, const ParallelOptions& options){
+    check_lengths(T, molefrac.rows(), rho.size());
+    EArrayd out(T.size());
+    parallel_for(T.size(), [&](std::size_t istart, std::size_t iend){
+        auto n = static_cast<Eigen::Index>(iend - istart);
+        out.segment(istart, n) = model.get_Arxy_many(NT, ND, T.segment(istart, n), rho.segment(istart, n), molefrac.middleRows(istart, n));
+    }, options);
+    return out;
+}
+
+EMatrixd get_fugacity_coefficients_many(const cppinterface::AbstractModel& model, const REArrayd& T, const REMatrixd& rhovec, const ParallelOptions& options){
+    check_lengths(T, rhovec.rows(), T.size());
+    EMatrixd out(rhovec.rows(), rhovec.cols());
+    parallel_for(T.size(), [&](std::size_t istart, std::size_t iend){
+        EArrayd rhovec_i(rhovec.cols());
+        for (auto i = istart; i < iend; ++i){
+            rhovec_i = rhovec.row(i).transpose();
+            out.row(i) = model.get_fugacity_coefficients(T(i), rhovec_i).transpose();
+        }
+    }, options);
+    return out;
+}
+
+EMatrixd get_deriv_mat2_many(const cppinterface::AbstractModel& model, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac, const ParallelOptions& options){
+    check_lengths(T, molefrac.rows(), rho.size());
+    EMatrixd out(T.size(), 9);
+    parallel_for(T.size(), [&](std::size_t istart, std::size_t iend){
+        EArrayd z(molefrac.cols());
+        for (auto i = istart; i < iend; ++i){
+            z = molefrac.row(i).transpose();
+            auto mat = model.get_deriv_mat2(T(i), rho(i), z);
+            for (auto j = 0; j < 9; ++j){ out(i, j) = mat(j/3, j%3); }
+        }
+    }, options);
+    return out;
+}
+
+EMatrixd get_dmBnvirdTm_matrix_many(const cppinterface::AbstractModel& model, const int Nmax, const int NTmax, const REArrayd& T, const REArrayd& molefrac, const ParallelOptions& options){
+    const auto Ncols = (Nmax - 1)*(NTmax + 1);
+    EMatrixd out(T.size(), std::max(Ncols, 0));
+    parallel_for(T.size(), [&](std::size_t istart, std::size_t iend){
+        for (auto i = istart; i < iend; ++i){
+            auto mat = model.get_dmBnvirdTm_matrix(Nmax, NTmax, T(i), molefrac);
+            for (auto j = 0; j < Ncols; ++j){ out(i, j) = mat(j/(NTmax + 1), j%(NTmax + 1)); }
+        }
+    }, options);
+    return out;
+}
+
+std::vector<nlohmann::json> trace_VLE_isotherm_binary_many(const cppinterface::AbstractModel& model, const REArrayd& T0, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const std::optional<TVLEOptions>& trace_options, const ParallelOptions& options){
+    check_lengths(T0, rhovecL0.rows(), rhovecV0.rows());
+    std::vector<nlohmann::json> out(T0.size());
+    auto opt = options; opt.chunk_size = 1;
+    parallel_for(T0.size(), [&](std::size_t istart, std::size_t iend){
+        for (auto i = istart; i < iend; ++i){
+            EArrayd rhovecL = rhovecL0.row(i).transpose(), rhovecV = rhovecV0.row(i).transpose();
+            out[i] = model.trace_VLE_isotherm_binary(T0(i), rhovecL, rhovecV, trace_options);
+        }
+    }, opt);
+    return out;
+}
+
+std::vector<nlohmann::json> trace_VLE_isobar_binary_many(const cppinterface::AbstractModel& model, const REArrayd& p, const REArrayd& T0, const REMatrixd& rhovecL0, const REMatrixd& rhovecV0, const std::optional<PVLEOptions>& trace_options, const ParallelOptions& options){
+    check_lengths(T0, rhovecL0.rows(), rhovecV0.rows());
+    check_lengths(T0, p.size(), p.size());
+    std::vector<nlohmann::json> out(T0.size());
+    auto opt = options; opt.chunk_size = 1;
+    parallel_for(T0.size(), [&](std::size_t istart, std::size_t iend){
+        for (auto i = istart; i < iend; ++i){
+            EArrayd rhovecL = rhovecL0.row(i).transpose(), rhovecV = rhovecV0.row(i).transpose();
+            out[i] = model.trace_VLE_isobar_binary(p(i), T0(i), rhovecL, rhovecV, trace_options);
+        }
+    }, opt);
+    return out;
+}
+
+namespace{
+    /// The classification metadata of a trace, from its points
+    void summarize_critical_trace(const nlohmann::json& points, const double pure_tol, CriticalTraceSummary& summary){
+        summary.Npoints = points.size();
+        if (points.empty()){ return; }
+        auto z0 = [](const nlohmann::json& pt){
+            double rho0 = pt.at("rho0 / mol/m^3"), rho1 = pt.at("rho1 / mol/m^3");
+            return rho0/(rho0 + rho1);
+        };
+        auto ipure = [&](const double z){ return (z > 1 - pure_tol) ? 0 : ((z < pure_tol) ? 1 : -1); };
+        summary.Tmin = summary.Tmax = points.front().at("T / K");
+        summary.pmax = points.front().at("p / Pa");
+        double dTprev = 0;
+        for (std::size_t i = 0; i < points.size(); ++i){
+            double T = points[i].at("T / K"), p = points[i].at("p / Pa");
+            summary.Tmin = std::min(summary.Tmin, T);
+            summary.Tmax = std::max(summary.Tmax, T);
+            summary.pmax = std::max(summary.pmax, p);
+            if (i > 0){
+                double dT = T - points[i-1].at("T / K").get<double>();
+                if (dT*dTprev < 0){ summary.Nturns_T++; }
+                if (dT != 0){ dTprev = dT; }
+            }
+        }
+        const auto& last = points.back();
+        summary.T_end = last.at("T / K");
+        summary.p_end = last.at("p / Pa");
+        summary.z0_end = z0(last);
+        summary.ipure_start = ipure(z0(points.front()));
+        summary.ipure_end = ipure(summary.z0_end);
+        summary.connects_pures = (summary.ipure_start >= 0 && summary.ipure_end >= 0 && summary.ipure_start != summary.ipure_end);
+    }
+}
+
+std::vector<CriticalTraceSummary> trace_critical_arclength_binary_many(const std::vector<const cppinterface::AbstractModel*>& models, const std::vector<CriticalTraceStart>& starts, const CriticalTraceCallback& callback, const std::optional<TCABOptions>& trace_options, const ParallelOptions& options, const double pure_tol){
+    for (const auto& start : starts){
+        if (start.imodel >= models.size() || models[start.imodel] == nullptr){
+            throw teqp::InvalidArgument("The index of the model of a starting point is not valid");
+        }
+        if (start.rhovec0.size() != 2){
+            throw teqp::InvalidArgument("The starting molar concentrations must be of length 2");
+        }
+    }
+    std::vector<CriticalTraceSummary> out(starts.size());
+    std::mutex callback_mutex;
+    auto opt = options; opt.chunk_size = 1;
+    parallel_for(starts.size(), [&](std::size_t istart, std::size_t iend){
+        for (auto i = istart; i < iend; ++i){
+            const auto& start = starts[i];
+            auto& summary = out[i];
+            summary.itrace = i;
+            summary.imodel = start.imodel;
+            nlohmann::json points = nlohmann::json::array();
+            // A failed trace does not stop the others
+            try{
+                points = models[start.imodel]->trace_critical_arclength_binary(start.T0, start.rhovec0, std::nullopt, trace_options);
+                summary.success = true;
+            }
+            catch(std::exception& e){
+                summary.message = e.what();
+            }
+            summarize_critical_trace(points, pure_tol, summary);
+            if (callback){
+                std::lock_guard<std::mutex> lock(callback_mutex);
+                callback(summary, points);
+            }
+        }
+    }, opt);
+    return out;
+}
+
+std::vector<CriticalTraceSummary> trace_critical_arclength_binary_many(const cppinterface::AbstractModel& model, const REArrayd& T0, const REMatrixd& rhovec0, const CriticalTraceCallback& callback, const std::optional<TCABOptions>& trace_options, const ParallelOptions& options, const double pure_tol){
+    check_lengths(T0, rhovec0.rows(), rhovec0.rows());
+    std::vector<CriticalTraceStart> starts(T0.size());
+    for (auto i = 0; i < T0.size(); ++i){
+        starts[i].T0 = T0(i);
+        starts[i].rhovec0 = rhovec0.row(i).transpose();
+    }
+    return trace_critical_arclength_binary_many({&model}, starts, callback, trace_options, options, pure_tol);
+}
+
+namespace{
+    /// Solve for the critical point of one model; failures are recorded in the result rather than thrown
+    void solve_one_pure_critical(const cppinterface::AbstractModel& model, const double T0, const double rho0, const std::optional<nlohmann::json>& flags, const std::optional<double>& Tr_extrapolate, PureCriticalResult& result){
+        auto [Tc, rhoc] = model.solve_pure_critical(T0, rho0, flags);
+        result.Tc = Tc;
+        result.rhoc = rhoc;
+        if (!(std::isfinite(Tc) && std::isfinite(rhoc) && Tc > 0 && rhoc > 0)){
+            result.message = "The critical point is not finite or not positive";
+            return;
+        }
+        // The solver takes a fixed number of steps, so the convergence is checked with one more Newton step
+        std::optional<std::size_t> alternative_pure_index, alternative_length;
+        if (flags && flags.value().contains("alternative_pure_index")){
+            alternative_pure_index = flags.value().at("alternative_pure_index").get<std::size_t>();
+            alternative_length = flags.value().at("alternative_length").get<std::size_t>();
+        }
+        auto [resids, J] = get_pure_critical_conditions_Jacobian(model, Tc, rhoc, alternative_pure_index, alternative_length);
+        Eigen::Vector2d step = J.colPivHouseholderQr().solve(-resids.matrix());
+        if (!(std::abs(step[0]) < 1e-8*Tc && std::abs(step[1]) < 1e-8*rhoc)){
+            result.message = "The Newton iteration did not converge";
+            return;
+        }
+        result.success = true;
+        if (Tr_extrapolate){
+            result.rhoLV = model.extrapolate_from_critical(Tc, rhoc, Tr_extrapolate.value()*Tc);
+        }
+    }
+}
+
+std::vector<PureCriticalResult> solve_pure_critical_many(const std::vector<const cppinterface::AbstractModel*>& models, const REArrayd& T0, const REArrayd& rho0, const std::optional<nlohmann::json>& flags, const std::optional<double>& Tr_extrapolate, const ParallelOptions& options){
+    check_lengths(T0, static_cast<Eigen::Index>(models.size()), rho0.size());
+    std::vector<PureCriticalResult> out(models.size());
+    parallel_for(models.size(), [&](std::size_t istart, std::size_t iend){
+        for (auto i = istart; i < iend; ++i){
+            auto& result = out[i];
+            result.imodel = i;
+            if (models[i] == nullptr){
+                result.message = "The model is null";
+                continue;
+            }
+            // A failed solution does not stop the others
+            try{
+                solve_one_pure_critical(*models[i], T0(i), rho0(i), flags, Tr_extrapolate, result);
+            }
+            catch(std::exception& e){
+                result.message = e.what();
+            }
+        }
+    }, options);
+    return out;
+}
+
+std::vector<PureCriticalResult> solve_pure_critical_many(const std::vector<nlohmann::json>& specs, const REArrayd& T0, const REArrayd& rho0, const std::optional<nlohmann::json>& flags, const std::optional<double>& Tr_extrapolate, const ParallelOptions& options){
+    check_lengths(T0, static_cast<Eigen::Index>(specs.size()), rho0.size());
+    std::vector<PureCriticalResult> out(specs.size());
+    parallel_for(specs.size(), [&](std::size_t istart, std::size_t iend){
+        for (auto i = istart; i < iend; ++i){
+            auto& result = out[i];
+            result.imodel = i;
+            try{
+                auto model = cppinterface::make_model(specs[i]);
+                solve_one_pure_critical(*model, T0(i), rho0(i), flags, Tr_extrapolate, result);
+            }
+            catch(std::exception& e){
+                result.message = e.what();
+            }
+        }
+    }, options);
+    return out;
+}
+
+}
+}
@@ -0,0 +1,384 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/per_thread.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+
+        namespace {
+
+            // The methods of AbstractModel that are profiled, other than those of the X-macro lists
+            #define PROFILED_METHODS \
+                X(get_R) \
+                X(get_Arxy) \
+                X(get_Arxy_many) \
+                X(get_Ar0n_many) \
+                X(get_B2vir) \
+                X(get_Bnvir) \
+                X(get_B12vir) \
+                X(get_dmBnvirdTm) \
+                X(get_dmBnvirdTm_matrix) \
+                X(build_Psir_fgradHessian_autodiff_buffered) \
+                X(get_Psir_sigma_derivs) \
+                X(prepare_composition) \
+                X(get_deriv_mat2) \
+                X(get_deriv_matN) \
+                X(solve_rho_Tp) \
+                X(solve_rho_Tp_many) \
+                X(get_drhovecdp_Tsat) \
+                X(get_drhovecdT_psat) \
+                X(get_dpsat_dTsat_isopleth) \
+                X(trace_VLE_isotherm_binary) \
+                X(trace_VLE_isobar_binary) \
+                X(trace_phase_envelope) \
+                X(mix_VLE_Tx) \
+                X(mix_VLE_Tp) \
+                X(mixture_VLE_px) \
+                X(trace_critical_arclength_binary) \
+                X(get_drhovec_dT_crit) \
+                X(get_dp_dT_crit) \
+                X(get_criticality_conditions) \
+                X(eigen_problem) \
+                X(get_minimum_eigenvalue_Psi_Hessian)
+
+            enum class Method : std::size_t {
+                #define X(f) f,
+                    PROFILED_METHODS
+                    ISOCHORIC_double_args
+                    ISOCHORIC_array_args
+                    ISOCHORIC_matrix_args
+                    ISOCHORIC_multimatrix_args
+                #undef X
+                #define X(i,j) get_Ar ## i ## j,
+                    ARXY_args
+                #undef X
+                #define X(i) get_Ar0 ## i ## n,
+                    AR0N_args
+                #undef X
+                count
+            };
+            constexpr std::size_t Nmethods = static_cast<std::size_t>(Method::count);
+
+            const std::array<const char*, Nmethods> method_names = {
+                #define X(f) #f,
+                    PROFILED_METHODS
+                    ISOCHORIC_double_args
+                    ISOCHORIC_array_args
+                    ISOCHORIC_matrix_args
+                    ISOCHORIC_multimatrix_args
+                #undef X
+                #define X(i,j) "get_Ar" #i #j,
+                    ARXY_args
+                #undef X
+                #define X(i) "get_Ar0" #i "n",
+                    AR0N_args
+                #undef X
+            };
+
+            /// The orders of the derivatives are recorded as a pair (first, second), each of them clipped to [0, Norder-1]
+            constexpr int Norder = 6;
+            enum class OrderKind { none, single, pair };
+            OrderKind get_order_kind(const Method m){
+                switch (m){
+                    case Method::get_Arxy: case Method::get_Arxy_many: case Method::get_dmBnvirdTm: case Method::get_dmBnvirdTm_matrix:
+                        return OrderKind::pair;
+                    case Method::get_Ar0n_many: case Method::get_Bnvir: case Method::get_deriv_matN:
+                        return OrderKind::single;
+                    default:
+                        return OrderKind::none;
+                }
+            }
+
+            /// The durations are recorded in a histogram with 4 buckets per power of two of the duration in ns, thus within about 12 %
+            constexpr int Nsub = 4, Noctaves = 48;
+            constexpr std::size_t Nbuckets = Nsub*Noctaves;
+            std::size_t get_bucket(const std::uint64_t ns){
+                if (ns == 0){ return 0; }
+                const int e = std::ilogb(static_cast<double>(ns));
+                const int sub = static_cast<int>((std::ldexp(static_cast<double>(ns), -e) - 1.0)*Nsub);
+                return std::min(static_cast<std::size_t>(e*Nsub + sub), Nbuckets - 1);
+            }
+            /// The middle of the range of durations of a bucket, in ns
+            double get_bucket_middle(const std::size_t bucket){
+                const auto e = static_cast<int>(bucket / Nsub), sub = static_cast<int>(bucket % Nsub);
+                return std::ldexp(1.0 + (sub + 0.5)/Nsub, e);
+            }
+
+            using Counter = std::atomic<std::uint64_t>;
+            /// Counters are only written by their own thread, so a relaxed load and store is enough, and cheaper than an atomic increment
+            void add(Counter& c, const std::uint64_t n){ c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed); }
+
+            struct MethodCounters {
+                Counter calls, total_ns, max_ns;
+                std::array<Counter, Nbuckets> durations;
+                std::array<Counter, Norder*Norder> orders;
+            };
+            struct ThreadCounters {
+                std::array<MethodCounters, Nmethods> methods;
+            };
+
+            /**
+             The counters of all the threads that called a profiled model, shared by a model and the models prepared from it. Each
+             thread finds its own counters without locking; the lock is only taken the first time a thread records, and to export.
+             */
+            class Profile {
+            private:
+                PerThreadStore<std::shared_ptr<ThreadCounters>> local;
+                mutable std::mutex mutex;
+                std::vector<std::shared_ptr<ThreadCounters>> all;
+            public:
+                MethodCounters& counters(const Method m){
+                    auto& mine = local.local();
+                    if (!mine){
+                        mine = std::make_shared<ThreadCounters>();
+                        std::lock_guard<std::mutex> lock(mutex);
+                        all.push_back(mine);
+                    }
+                    return mine->methods[static_cast<std::size_t>(m)];
+                }
+
+                nlohmann::json to_json() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    nlohmann::json methods = nlohmann::json::object();
+                    for (auto im = 0U; im < Nmethods; ++im){
+                        std::uint64_t calls = 0, total_ns = 0, max_ns = 0;
+                        std::array<std::uint64_t, Nbuckets> durations{};
+                        std::array<std::uint64_t, Norder*Norder> orders{};
+                        for (const auto& t : all){
+                            const auto& c = t->methods[im];
+                            calls += c.calls.load(std::memory_order_relaxed);
+                            total_ns += c.total_ns.load(std::memory_order_relaxed);
+                            max_ns = std::max(max_ns, c.max_ns.load(std::memory_order_relaxed));
+                            for (auto i = 0U; i < Nbuckets; ++i){ durations[i] += c.durations[i].load(std::memory_order_relaxed); }
+                            for (auto i = 0U; i < orders.size(); ++i){ orders[i] += c.orders[i].load(std::memory_order_relaxed); }
+                        }
+                        if (calls == 0){ continue; }
+
+                        std::uint64_t Nrecorded = 0;
+                        for (auto n : durations){ Nrecorded += n; }
+                        auto percentile = [&](const double q){
+                            const auto target = static_cast<std::uint64_t>(std::ceil(q*Nrecorded));
+                            std::uint64_t cumulative = 0;
+                            for (auto i = 0U; i < Nbuckets; ++i){
+                                cumulative += durations[i];
+                                if (cumulative >= std::max<std::uint64_t>(target, 1)){ return std::min(get_bucket_middle(i), static_cast<double>(max_ns))*1e-9; }
+                            }
+                            return max_ns*1e-9;
+                        };
+                        nlohmann::json entry = {
+                            {"calls", calls},
+                            {"total / s", total_ns*1e-9},
+                            {"mean / s", total_ns*1e-9/calls},
+                            {"p50 / s", percentile(0.5)},
+                            {"p90 / s", percentile(0.9)},
+                            {"p99 / s", percentile(0.99)},
+                            {"max / s", max_ns*1e-9}
+                        };
+                        const auto kind = get_order_kind(static_cast<Method>(im));
+                        if (kind != OrderKind::none){
+                            nlohmann::json histogram = nlohmann::json::object();
+                            for (auto i = 0; i < Norder; ++i){
+                                for (auto j = 0; j < Norder; ++j){
+                                    if (const auto n = orders[i*Norder + j]; n > 0){
+                                        histogram[(kind == OrderKind::pair) ? std::to_string(i) + "," + std::to_string(j) : std::to_string(i)] = n;
+                                    }
+                                }
+                            }
+                            entry["orders"] = histogram;
+                        }
+                        methods[method_names[im]] = entry;
+                    }
+                    return {{"methods", methods}, {"threads", all.size()}};
+                }
+
+                void reset(){
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (auto& t : all){
+                        for (auto& c : t->methods){
+                            c.calls = 0; c.total_ns = 0; c.max_ns = 0;
+                            for (auto& d : c.durations){ d = 0; }
+                            for (auto& o : c.orders){ o = 0; }
+                        }
+                    }
+                }
+            };
+
+            /// Records one call when it goes out of scope, so calls that throw are counted as well
+            class Recorder {
+            private:
+                MethodCounters& c;
+                const std::chrono::steady_clock::time_point start;
+            public:
+                Recorder(MethodCounters& c) : c(c), start(std::chrono::steady_clock::now()) {};
+                Recorder(MethodCounters& c, const int first, const int second = 0) : Recorder(c) {
+                    auto clip = [](const int i){ return std::clamp(i, 0, Norder - 1); };
+                    add(c.orders[clip(first)*Norder + clip(second)], 1);
+                };
+                ~Recorder(){
+                    const auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+                    add(c.calls, 1);
+                    add(c.total_ns, ns);
+                    if (ns > c.max_ns.load(std::memory_order_relaxed)){ c.max_ns.store(ns, std::memory_order_relaxed); }
+                    add(c.durations[get_bucket(ns)], 1);
+                }
+            };
+
+            class ProfilingAdapter : public AbstractModel {
+            private:
+                std::unique_ptr<AbstractModel> model;
+                std::shared_ptr<Profile> profile;
+                MethodCounters& counters(const Method m) const { return profile->counters(m); }
+            public:
+                ProfilingAdapter(std::unique_ptr<AbstractModel> model, std::shared_ptr<Profile> profile) : model(std::move(model)), profile(std::move(profile)) {};
+
+                const Profile& get_profile() const { return *profile; }
+                Profile& get_profile() { return *profile; }
+
+                const std::type_index& get_type_index() const override { return model->get_type_index(); }
+                const AbstractModel* get_decorated() const override { return model.get(); }
+
+                double get_R(const REArrayd& x) const override { Recorder r(counters(Method::get_R)); return model->get_R(x); }
+                double get_Arxy(const int NT, const int ND, const double T, const double rho, const REArrayd& z) const override {
+                    Recorder r(counters(Method::get_Arxy), NT, ND); return model->get_Arxy(NT, ND, T, rho, z);
+                }
+                #define X(i,j) double get_Ar ## i ## j(const double T, const double rho, const REArrayd& z) const override { Recorder r(counters(Method::get_Ar ## i ## j)); return model->get_Ar ## i ## j(T, rho, z); }
+                    ARXY_args
+                #undef X
+                #define X(i) EArrayd get_Ar0 ## i ## n(const double T, const double rho, const REArrayd& z) const override { Recorder r(counters(Method::get_Ar0 ## i ## n)); return model->get_Ar0 ## i ## n(T, rho, z); }
+                    AR0N_args
+                #undef X
+                EArrayd get_Arxy_many(const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const override {
+                    Recorder r(counters(Method::get_Arxy_many), NT, ND); return model->get_Arxy_many(NT, ND, T, rho, molefrac);
+                }
+                EMatrixd get_Ar0n_many(const int Nderiv, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const override {
+                    Recorder r(counters(Method::get_Ar0n_many), Nderiv); return model->get_Ar0n_many(Nderiv, T, rho, molefrac);
+                }
+
+                double get_B2vir(const double T, const REArrayd& z) const override { Recorder r(counters(Method::get_B2vir)); return model->get_B2vir(T, z); }
+                std::map<int, double> get_Bnvir(const int Nderiv, const double T, const REArrayd& z) const override {
+                    Recorder r(counters(Method::get_Bnvir), Nderiv); return model->get_Bnvir(Nderiv, T, z);
+                }
+                double get_B12vir(const double T, const REArrayd& z) const override { Recorder r(counters(Method::get_B12vir)); return model->get_B12vir(T, z); }
+                double get_dmBnvirdTm(const int Nderiv, const int NTderiv, const double T, const REArrayd& z) const override {
+                    Recorder r(counters(Method::get_dmBnvirdTm), Nderiv, NTderiv); return model->get_dmBnvirdTm(Nderiv, NTderiv, T, z);
+                }
+                EMatrixd get_dmBnvirdTm_matrix(const int Nmax, const int NTmax, const double T, const REArrayd& z) const override {
+                    Recorder r(counters(Method::get_dmBnvirdTm_matrix), Nmax, NTmax); return model->get_dmBnvirdTm_matrix(Nmax, NTmax, T, z);
+                }
+
+                #define X(f) double f(const double T, const REArrayd& rhovec) const override { Recorder r(counters(Method::f)); return model->f(T, rhovec); }
+                    ISOCHORIC_double_args
+                #undef X
+                #define X(f) EArrayd f(const double T, const REArrayd& rhovec) const override { Recorder r(counters(Method::f)); return model->f(T, rhovec); }
+                    ISOCHORIC_array_args
+                #undef X
+                #define X(f) EMatrixd f(const double T, const REArrayd& rhovec) const override { Recorder r(counters(Method::f)); return model->f(T, rhovec); }
+                    ISOCHORIC_matrix_args
+                #undef X
+                #define X(f) std::tuple<double, Eigen::ArrayXd, Eigen::MatrixXd> f(const double T, const REArrayd& rhovec) const override { Recorder r(counters(Method::f)); return model->f(T, rhovec); }
+                    ISOCHORIC_multimatrix_args
+                #undef X
+                void build_Psir_fgradHessian_autodiff(const double T, const REArrayd& rhovec, double& Psir, Eigen::ArrayXd& gradient, Eigen::MatrixXd& Hessian) const override {
+                    Recorder r(counters(Method::build_Psir_fgradHessian_autodiff_buffered)); model->build_Psir_fgradHessian_autodiff(T, rhovec, Psir, gradient, Hessian);
+                }
+                Eigen::ArrayXd get_Psir_sigma_derivs(const double T, const REArrayd& rhovec, const REArrayd& v) const override {
+                    Recorder r(counters(Method::get_Psir_sigma_derivs)); return model->get_Psir_sigma_derivs(T, rhovec, v);
+                }
+
+                std::unique_ptr<AbstractModel> prepare_composition(const REArrayd& z) const override {
+                    Recorder r(counters(Method::prepare_composition));
+                    return std::make_unique<ProfilingAdapter>(model->prepare_composition(z), profile);
+                }
+
+                EArray33d get_deriv_mat2(const double T, double rho, const REArrayd& z) const override { Recorder r(counters(Method::get_deriv_mat2)); return model->get_deriv_mat2(T, rho, z); }
+                EMatrixd get_deriv_matN(const int order, const double T, const double rho, const REArrayd& z) const override {
+                    Recorder r(counters(Method::get_deriv_matN), order); return model->get_deriv_matN(order, T, rho, z);
+                }
+
+                double solve_rho_Tp(const double T, const double p, const REArrayd& z, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options) const override {
+                    Recorder r(counters(Method::solve_rho_Tp)); return model->solve_rho_Tp(T, p, z, phase, options);
+                }
+                EArrayd solve_rho_Tp_many(const REArrayd& T, const REArrayd& p, const REMatrixd& molefrac, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options) const override {
+                    Recorder r(counters(Method::solve_rho_Tp_many)); return model->solve_rho_Tp_many(T, p, molefrac, phase, options);
+                }
+
+                // The algorithms are forwarded as a whole, so that the calls that they make to the model are not counted separately
+                std::tuple<EArrayd, EArrayd> get_drhovecdp_Tsat(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const override {
+                    Recorder r(counters(Method::get_drhovecdp_Tsat)); return model->get_drhovecdp_Tsat(T, rhovecL, rhovecV);
+                }
+                std::tuple<EArrayd, EArrayd> get_drhovecdT_psat(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const override {
+                    Recorder r(counters(Method::get_drhovecdT_psat)); return model->get_drhovecdT_psat(T, rhovecL, rhovecV);
+                }
+                double get_dpsat_dTsat_isopleth(const double T, const REArrayd& rhovecL, const REArrayd& rhovecV) const override {
+                    Recorder r(counters(Method::get_dpsat_dTsat_isopleth)); return model->get_dpsat_dTsat_isopleth(T, rhovecL, rhovecV);
+                }
+                nlohmann::json trace_VLE_isotherm_binary(const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<TVLEOptions>& options) const override {
+                    Recorder r(counters(Method::trace_VLE_isotherm_binary)); return model->trace_VLE_isotherm_binary(T0, rhovecL0, rhovecV0, options);
+                }
+                nlohmann::json trace_VLE_isobar_binary(const double p, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<PVLEOptions>& options) const override {
+                    Recorder r(counters(Method::trace_VLE_isobar_binary)); return model->trace_VLE_isobar_binary(p, T0, rhovecL0, rhovecV0, options);
+                }
+                nlohmann::json trace_phase_envelope(const double T0, const REArrayd& rhovecB0, const REArrayd& rhovecI0, const std::optional<PhaseEnvelopeOptions>& options) const override {
+                    Recorder r(counters(Method::trace_phase_envelope)); return model->trace_phase_envelope(T0, rhovecB0, rhovecI0, options);
+                }
+                std::tuple<VLE_return_code, EArrayd, EArrayd> mix_VLE_Tx(const double T, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const REArrayd& xspec, const double atol, const double reltol, const double axtol, const double relxtol, const int maxiter, SolverTelemetry* telemetry) const override {
+                    Recorder r(counters(Method::mix_VLE_Tx)); return model->mix_VLE_Tx(T, rhovecL0, rhovecV0, xspec, atol, reltol, axtol, relxtol, maxiter, telemetry);
+                }
+                MixVLEReturn mix_VLE_Tp(const double T, const double pgiven, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLETpFlags>& flags) const override {
+                    Recorder r(counters(Method::mix_VLE_Tp)); return model->mix_VLE_Tp(T, pgiven, rhovecL0, rhovecV0, flags);
+                }
+                std::tuple<VLE_return_code, double, EArrayd, EArrayd> mixture_VLE_px(const double p_spec, const REArrayd& xmolar_spec, const double T0, const REArrayd& rhovecL0, const REArrayd& rhovecV0, const std::optional<MixVLEpxFlags>& flags, SolverTelemetry* telemetry) const override {
+                    Recorder r(counters(Method::mixture_VLE_px)); return model->mixture_VLE_px(p_spec, xmolar_spec, T0, rhovecL0, rhovecV0, flags, telemetry);
+                }
+                nlohmann::json trace_critical_arclength_binary(const double T0, const REArrayd& rhovec0, const std::optional<std::string>& filename, const std::optional<TCABOptions>& options) const override {
+                    Recorder r(counters(Method::trace_critical_arclength_binary)); return model->trace_critical_arclength_binary(T0, rhovec0, filename, options);
+                }
+                EArrayd get_drhovec_dT_crit(const double T, const REArrayd& rhovec) const override {
+                    Recorder r(counters(Method::get_drhovec_dT_crit)); return model->get_drhovec_dT_crit(T, rhovec);
+                }
+                double get_dp_dT_crit(const double T, const REArrayd& rhovec) const override {
+                    Recorder r(counters(Method::get_dp_dT_crit)); return model->get_dp_dT_crit(T, rhovec);
+                }
+                EArray2 get_criticality_conditions(const double T, const REArrayd& rhovec) const override {
+                    Recorder r(counters(Method::get_criticality_conditions)); return model->get_criticality_conditions(T, rhovec);
+                }
+                EigenData eigen_problem(const double T, const REArrayd& rhovec, const std::optional<REArrayd>& alignment) const override {
+                    Recorder r(counters(Method::eigen_problem)); return model->eigen_problem(T, rhovec, alignment);
+                }
+                double get_minimum_eigenvalue_Psi_Hessian(const double T, const REArrayd& rhovec) const override {
+                    Recorder r(counters(Method::get_minimum_eigenvalue_Psi_Hessian)); return model->get_minimum_eigenvalue_Psi_Hessian(T, rhovec);
+                }
+            };
+
+            const ProfilingAdapter& get_profiling_adapter(const AbstractModel& model){
+                const auto* adapter = dynamic_cast<const ProfilingAdapter*>(&model);
+                if (adapter == nullptr){
+                    throw teqp::InvalidArgument("The model is not profiled; build it with make_profiling_model, or with \"profile\": true in the JSON for make_model");
+                }
+                return *adapter;
+            }
+        }
+
+        std::unique_ptr<AbstractModel> make_profiling_model(std::unique_ptr<AbstractModel> model){
+            if (!model){
+                throw teqp::InvalidArgument("The model to be profiled may not be null");
+            }
+            return std::make_unique<ProfilingAdapter>(std::move(model), std::make_shared<Profile>());
+        }
+
+        nlohmann::json get_profile(const AbstractModel& model){
+            return get_profiling_adapter(model).get_profile().to_json();
+        }
+
+        void reset_profile(const AbstractModel& model){
+            const_cast<ProfilingAdapter&>(get_profiling_adapter(model)).get_profile().reset();
+        }
+    }
+}
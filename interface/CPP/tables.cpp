@@ -0,0 +1,573 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+
+#include "teqp/cpp/tables.hpp"
+#include "teqp/algorithms/superancillary_pure.hpp"
+
+namespace teqp{
+namespace tables{
+
+using namespace internal;
+using cppinterface::AbstractModel;
+namespace properties = cppinterface::properties;
+
+// The layout of the buffer is that of the files, so the sizes of the records must not depend on the compiler
+static_assert(sizeof(Header) == 136 && sizeof(OutputRecord) == 24 && sizeof(BandRecord) == 24 && sizeof(RegionRecord) == 48);
+static_assert(sizeof(CurveRecord) == 8 && sizeof(ExpansionRecord) == 32 && sizeof(NodeRecord) == 16);
+
+PropertyTable::PropertyTable(std::shared_ptr<const std::vector<double>> owned_, const void* data, const std::size_t size) : owned(std::move(owned_)) {
+    if (data == nullptr || reinterpret_cast<std::uintptr_t>(data) % 8 != 0) {
+        throw teqp::InvalidArgument("The buffer of a table must be aligned on 8 bytes");
+    }
+    if (size < sizeof(Header)) {
+        throw teqp::InvalidArgument("The buffer is too small to hold a table");
+    }
+    const auto* base = static_cast<const unsigned char*>(data);
+    header = reinterpret_cast<const Header*>(base);
+    if (std::memcmp(header->magic, "TEQPTAB1", 8) != 0) {
+        throw teqp::InvalidArgument("The buffer does not hold a table");
+    }
+    if (header->endianness != 0x01020304) {
+        throw teqp::InvalidArgument("The table was written on a machine with another byte order");
+    }
+    if (header->version != version) {
+        throw teqp::InvalidArgument("Unsupported version of the table: " + std::to_string(header->version));
+    }
+    if (header->size != size) {
+        throw teqp::InvalidArgument("The size of the buffer does not match the size of the table");
+    }
+    if (header->kind > static_cast<std::uint32_t>(TableKind::ph) || header->order < 2 || header->order > static_cast<std::uint32_t>(max_order) || header->Noutputs > static_cast<std::uint32_t>(max_outputs)) {
+        throw teqp::InvalidArgument("Invalid header of the table");
+    }
+    M = static_cast<int>(header->order) + 1;
+    patch_stride = static_cast<std::size_t>(header->Noutputs)*M*M;
+
+    // Locate the sections, checking that they lie within the buffer
+    auto section = [&](std::uint64_t offset, std::uint64_t count, std::size_t record_size) {
+        if (offset % 8 != 0 || offset > size || count > (size - offset)/record_size) {
+            throw teqp::InvalidArgument("A section of the table lies outside the buffer");
+        }
+        return base + offset;
+    };
+    outputs = reinterpret_cast<const OutputRecord*>(section(header->offset_outputs, header->Noutputs, sizeof(OutputRecord)));
+    bands = reinterpret_cast<const BandRecord*>(section(header->offset_bands, header->Nbands, sizeof(BandRecord)));
+    regions = reinterpret_cast<const RegionRecord*>(section(header->offset_regions, header->Nregions, sizeof(RegionRecord)));
+    curves = reinterpret_cast<const CurveRecord*>(section(header->offset_curves, header->Ncurves, sizeof(CurveRecord)));
+    expansions = reinterpret_cast<const ExpansionRecord*>(section(header->offset_expansions, header->Nexpansions, sizeof(ExpansionRecord)));
+    curve_coeffs = reinterpret_cast<const double*>(section(header->offset_curve_coeffs, header->Ncurve_coeffs, sizeof(double)));
+    nodes = reinterpret_cast<const NodeRecord*>(section(header->offset_nodes, header->Nnodes, sizeof(NodeRecord)));
+    patches = reinterpret_cast<const double*>(section(header->offset_patches, static_cast<std::uint64_t>(header->Npatches)*patch_stride, sizeof(double)));
+
+    // And that all the indices are in range, so that the lookups need no checks
+    auto in_range = [](std::int64_t i, std::uint64_t N, bool allow_none) { return (allow_none && i == -1) || (i >= 0 && static_cast<std::uint64_t>(i) < N); };
+    bool ok = true;
+    for (auto i = 0U; i < header->Noutputs; ++i) {
+        ok = ok && outputs[i].name[15] == '\0' && outputs[i].twophase <= static_cast<std::uint32_t>(TwoPhaseRule::harmonic);
+    }
+    for (auto i = 0U; i < header->Nbands; ++i) {
+        ok = ok && in_range(bands[i].region_lo, header->Nregions, false) && in_range(bands[i].region_hi, header->Nregions, true);
+    }
+    for (auto i = 0U; i < header->Nregions; ++i) {
+        ok = ok && in_range(regions[i].curve_lo, header->Ncurves, true) && in_range(regions[i].curve_hi, header->Ncurves, true) && in_range(regions[i].root, header->Nnodes, false);
+    }
+    for (auto i = 0U; i < header->Ncurves; ++i) {
+        ok = ok && curves[i].N > 0 && in_range(curves[i].first, header->Nexpansions, false) && in_range(static_cast<std::int64_t>(curves[i].first) + curves[i].N - 1, header->Nexpansions, false);
+    }
+    for (auto i = 0U; i < header->Nexpansions; ++i) {
+        ok = ok && expansions[i].Ncoeff >= 2 && expansions[i].first_coeff <= header->Ncurve_coeffs && expansions[i].Ncoeff <= header->Ncurve_coeffs - expansions[i].first_coeff;
+    }
+    for (auto i = 0U; i < header->Nnodes; ++i) {
+        // The children are always stored after their parent, so that the quadtrees have no cycles
+        const auto& node = nodes[i];
+        const int Nchildren = (node.split == 3) ? 4 : 2;
+        ok = ok && in_range(node.patch, header->Npatches, true) && (node.first_child == -1 || (node.split >= 1 && node.split <= 3 && node.first_child > static_cast<std::int64_t>(i) && in_range(static_cast<std::int64_t>(node.first_child) + Nchildren - 1, header->Nnodes, false)));
+    }
+    if (!ok) {
+        throw teqp::InvalidArgument("Invalid index in the table");
+    }
+}
+
+PropertyTable PropertyTable::from_buffer(const void* data, const std::size_t size) {
+    auto storage = std::make_shared<std::vector<double>>((size + 7)/8);
+    std::memcpy(storage->data(), data, size);
+    const void* p = storage->data();
+    return PropertyTable(std::move(storage), p, size);
+}
+
+PropertyTable PropertyTable::view(const void* data, const std::size_t size) {
+    return PropertyTable(nullptr, data, size);
+}
+
+PropertyTable PropertyTable::load(const std::string& path) {
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    if (!ifs) {
+        throw teqp::InvalidArgument("Unable to open the table file: " + path);
+    }
+    const auto size = static_cast<std::size_t>(ifs.tellg());
+    auto storage = std::make_shared<std::vector<double>>((size + 7)/8);
+    ifs.seekg(0);
+    if (!ifs.read(reinterpret_cast<char*>(storage->data()), static_cast<std::streamsize>(size))) {
+        throw teqp::InvalidArgument("Unable to read the table file: " + path);
+    }
+    const void* p = storage->data();
+    return PropertyTable(std::move(storage), p, size);
+}
+
+void PropertyTable::save(const std::string& path) const {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.write(static_cast<const char*>(data()), static_cast<std::streamsize>(size_bytes()))) {
+        throw teqp::InvalidArgument("Unable to write the table file: " + path);
+    }
+}
+
+std::vector<std::string> PropertyTable::get_output_names() const {
+    std::vector<std::string> names;
+    for (auto i = 0U; i < header->Noutputs; ++i) {
+        names.emplace_back(outputs[i].name);
+    }
+    return names;
+}
+
+std::size_t PropertyTable::get_output_index(const std::string& name) const {
+    for (auto i = 0U; i < header->Noutputs; ++i) {
+        if (name == outputs[i].name) { return i; }
+    }
+    throw teqp::InvalidArgument("No output called " + name + " in the table");
+}
+
+namespace{
+
+    using superancillary::PureSuperAncillary;
+    using superancillary::SuperAncillary;
+    using superancillary::Chebyshev;
+
+    /// The value of one state, as the outputs of a node, from its region, x and y
+    using NodeFunction = std::function<void(int, double, double, double*)>;
+
+    /// The contents of a table while it is built
+    struct TableBuilder {
+        TableKind kind;
+        std::vector<OutputRecord> outputs;
+        std::vector<BandRecord> bands;
+        std::vector<RegionRecord> regions;
+        std::vector<CurveRecord> curves;
+        std::vector<SuperAncillary> curve_fits; ///< The same curves, for the evaluation of the bounds during the construction
+        std::vector<ExpansionRecord> expansions;
+        std::vector<double> curve_coeffs;
+        std::vector<NodeRecord> nodes;
+        std::vector<double> patches;
+        std::size_t Npatches = 0;
+
+        void add_output(const std::string& name, TwoPhaseRule rule) {
+            OutputRecord r{};
+            std::strncpy(r.name, name.c_str(), sizeof(r.name) - 1);
+            r.twophase = static_cast<std::uint32_t>(rule);
+            outputs.push_back(r);
+        }
+
+        /// Fit the curve y = f(x) over [xmin, xmax] with adaptive Chebyshev expansions, and return its index
+        int add_curve(const std::function<double(double)>& f, const double xmin, const double xmax, const std::string& what) {
+            std::vector<Chebyshev> exps;
+            // The nodes at the ends can be a rounding error outside of the range, where the superancillary throws
+            auto fclamped = [&](double x) { return f(std::clamp(x, xmin, xmax)); };
+            superancillary::internal::fit_adaptive(fclamped, 12, xmin, xmax, 1e-12, 12, exps);
+            CurveRecord c{static_cast<std::int32_t>(expansions.size()), static_cast<std::int32_t>(exps.size())};
+            for (const auto& e : exps) {
+                for (auto coeff : e.coeff) {
+                    if (!std::isfinite(coeff)) {
+                        throw teqp::IterationFailure("Unable to fit the curve of the " + what);
+                    }
+                }
+                expansions.push_back(ExpansionRecord{e.xmin, e.xmax, curve_coeffs.size(), e.coeff.size()});
+                curve_coeffs.insert(curve_coeffs.end(), e.coeff.begin(), e.coeff.end());
+            }
+            curves.push_back(c);
+            curve_fits.push_back(SuperAncillary{exps});
+            return static_cast<int>(curves.size()) - 1;
+        }
+
+        /// Add a region over [x0, x1] between ylo and yhi (curves if their index is not negative, otherwise the constants), and return its index
+        int add_region(const double x0, const double x1, const int curve_lo, const double ylo, const int curve_hi, const double yhi) {
+            regions.push_back(RegionRecord{x0, x1, ylo, yhi, curve_lo, curve_hi, static_cast<std::int32_t>(nodes.size()), 0});
+            nodes.push_back(NodeRecord{-1, -1, 0, 0});
+            return static_cast<int>(regions.size()) - 1;
+        }
+
+        void add_band(const double x0, const double x1, const int region_lo, const int region_hi) {
+            bands.push_back(BandRecord{x0, x1, region_lo, region_hi});
+        }
+
+        double get_y(const RegionRecord& r, const double x, const double eta) const {
+            const double ylo = (r.curve_lo < 0) ? r.ylo : curve_fits[r.curve_lo].y(x);
+            const double yhi = (r.curve_hi < 0) ? r.yhi : curve_fits[r.curve_hi].y(x);
+            return ylo + eta*(yhi - ylo);
+        }
+
+        /**
+         Build the trees of all the regions, level by level: the nodes of the patches of a level are evaluated in
+         parallel, then the patches whose last coefficients are not negligible in x or in eta are split in halves in
+         that direction for the next level
+         */
+        void build_patches(const NodeFunction& f, const PropertyTableOptions& options) {
+            const int n = options.order, M = n + 1;
+            const auto Nout = outputs.size();
+
+            // The matrix of the one-dimensional fit, from the values at the Chebyshev-Lobatto nodes to the coefficients
+            Eigen::MatrixXd C(M, M);
+            for (auto j = 0; j < M; ++j) {
+                for (auto k = 0; k < M; ++k) {
+                    double w = (k == 0 || k == n) ? 0.5 : 1.0;
+                    C(j, k) = 2.0/n*w*cos(EIGEN_PI*j*k/n);
+                }
+            }
+            C.row(0) /= 2; C.row(n) /= 2;
+
+            struct Pending { int node, region, depth_x, depth_eta; double x0, x1, eta0, eta1; };
+            std::vector<Pending> pending;
+            for (auto i = 0U; i < regions.size(); ++i) {
+                pending.push_back(Pending{regions[i].root, static_cast<int>(i), 0, 0, regions[i].x0, regions[i].x1, 0.0, 1.0});
+            }
+            std::vector<double> values;
+            while (!pending.empty()) {
+                values.resize(pending.size()*M*M*Nout);
+                parallel::parallel_for(pending.size()*M*M, [&](std::size_t istart, std::size_t iend) {
+                    for (auto i = istart; i < iend; ++i) {
+                        const auto& p = pending[i/(M*M)];
+                        const int k = static_cast<int>((i % (M*M))/M), l = static_cast<int>(i % M);
+                        const double x = std::clamp(superancillary::internal::get_Chebyshev_node(k, n, p.x0, p.x1), p.x0, p.x1);
+                        const double eta = std::clamp(superancillary::internal::get_Chebyshev_node(l, n, p.eta0, p.eta1), p.eta0, p.eta1);
+                        double* out = &values[i*Nout];
+                        try {
+                            f(p.region, x, get_y(regions[p.region], x, eta), out);
+                        }
+                        catch (const std::exception&) {
+                            std::fill(out, out + Nout, std::numeric_limits<double>::quiet_NaN());
+                        }
+                    }
+                }, options.parallel);
+
+                std::vector<Pending> next;
+                Eigen::MatrixXd F(M, M);
+                for (auto ip = 0U; ip < pending.size(); ++ip) {
+                    const auto& p = pending[ip];
+                    std::vector<double> coeffs(Nout*M*M);
+                    // The directions in which the last coefficients are not negligible for some output
+                    std::uint32_t unconverged = 0;
+                    for (auto o = 0U; o < Nout; ++o) {
+                        for (auto k = 0; k < M; ++k) {
+                            for (auto l = 0; l < M; ++l) {
+                                F(k, l) = values[((ip*M + k)*M + l)*Nout + o];
+                            }
+                        }
+                        Eigen::MatrixXd A = C*F*C.transpose();
+                        const double tol = options.reltol*F.cwiseAbs().maxCoeff();
+                        if (!F.allFinite()) {
+                            unconverged = 3;
+                        }
+                        else {
+                            if (!(A.bottomRows(2).cwiseAbs().maxCoeff() <= tol)) { unconverged |= 1; }
+                            if (!(A.rightCols(2).cwiseAbs().maxCoeff() <= tol)) { unconverged |= 2; }
+                        }
+                        Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(&coeffs[o*M*M], M, M) = A;
+                    }
+                    std::uint32_t split = unconverged;
+                    if (p.depth_x >= options.maxdepth) { split &= ~1u; }
+                    if (p.depth_eta >= options.maxdepth) { split &= ~2u; }
+                    if (split == 0) {
+                        nodes[p.node].patch = static_cast<std::int32_t>(Npatches++);
+                        patches.insert(patches.end(), coeffs.begin(), coeffs.end());
+                        if (Npatches > options.max_patches) {
+                            throw teqp::IterationFailure("The table would have more than " + std::to_string(options.max_patches) + " patches; loosen reltol or decrease maxdepth");
+                        }
+                    }
+                    else {
+                        const auto first = static_cast<int>(nodes.size());
+                        nodes[p.node].first_child = first;
+                        nodes[p.node].split = split;
+                        const double xm = (p.x0 + p.x1)/2, etam = (p.eta0 + p.eta1)/2;
+                        const bool sx = (split & 1) != 0, seta = (split & 2) != 0;
+                        for (auto iy = 0; iy < (seta ? 2 : 1); ++iy) {
+                            for (auto ix = 0; ix < (sx ? 2 : 1); ++ix) {
+                                Pending c = p;
+                                c.node = static_cast<int>(nodes.size());
+                                if (sx) { c.depth_x++; (ix ? c.x0 : c.x1) = xm; }
+                                if (seta) { c.depth_eta++; (iy ? c.eta0 : c.eta1) = etam; }
+                                nodes.push_back(NodeRecord{-1, -1, 0, 0});
+                                next.push_back(c);
+                            }
+                        }
+                    }
+                }
+                pending = std::move(next);
+            }
+        }
+
+        /// Pack the contents into the buffer of a table
+        PropertyTable pack(const PropertyTableOptions& options) const {
+            Header h{};
+            std::memcpy(h.magic, "TEQPTAB1", 8);
+            h.version = PropertyTable::version;
+            h.endianness = 0x01020304;
+            h.kind = static_cast<std::uint32_t>(kind);
+            h.order = static_cast<std::uint32_t>(options.order);
+            h.Noutputs = static_cast<std::uint32_t>(outputs.size());
+            h.Nbands = static_cast<std::uint32_t>(bands.size());
+            h.Nregions = static_cast<std::uint32_t>(regions.size());
+            h.Ncurves = static_cast<std::uint32_t>(curves.size());
+            h.Nexpansions = static_cast<std::uint32_t>(expansions.size());
+            h.Nnodes = static_cast<std::uint32_t>(nodes.size());
+            h.Npatches = static_cast<std::uint32_t>(Npatches);
+            h.Ncurve_coeffs = curve_coeffs.size();
+
+            std::uint64_t offset = sizeof(Header);
+            auto place = [&](std::uint64_t& o, std::size_t bytes) { o = offset; offset += bytes; };
+            place(h.offset_outputs, outputs.size()*sizeof(OutputRecord));
+            place(h.offset_bands, bands.size()*sizeof(BandRecord));
+            place(h.offset_regions, regions.size()*sizeof(RegionRecord));
+            place(h.offset_curves, curves.size()*sizeof(CurveRecord));
+            place(h.offset_expansions, expansions.size()*sizeof(ExpansionRecord));
+            place(h.offset_curve_coeffs, curve_coeffs.size()*sizeof(double));
+            place(h.offset_nodes, nodes.size()*sizeof(NodeRecord));
+            place(h.offset_patches, patches.size()*sizeof(double));
+            h.size = offset;
+
+            std::vector<unsigned char> buffer(offset);
+            auto copy = [&](std::uint64_t o, const void* src, std::size_t bytes) { if (bytes > 0) { std::memcpy(buffer.data() + o, src, bytes); } };
+            copy(0, &h, sizeof(Header));
+            copy(h.offset_outputs, outputs.data(), outputs.size()*sizeof(OutputRecord));
+            copy(h.offset_bands, bands.data(), bands.size()*sizeof(BandRecord));
+            copy(h.offset_regions, regions.data(), regions.size()*sizeof(RegionRecord));
+            copy(h.offset_curves, curves.data(), curves.size()*sizeof(CurveRecord));
+            copy(h.offset_expansions, expansions.data(), expansions.size()*sizeof(ExpansionRecord));
+            copy(h.offset_curve_coeffs, curve_coeffs.data(), curve_coeffs.size()*sizeof(double));
+            copy(h.offset_nodes, nodes.data(), nodes.size()*sizeof(NodeRecord));
+            copy(h.offset_patches, patches.data(), patches.size()*sizeof(double));
+            return PropertyTable::from_buffer(buffer.data(), buffer.size());
+        }
+    };
+
+    void check_options(const PropertyTableOptions& options, const PureSuperAncillary& sa) {
+        if (options.order < 2 || options.order > max_order) {
+            throw teqp::InvalidArgument("The order of the patches must be between 2 and " + std::to_string(max_order));
+        }
+        if (!(options.Tmin > 0 && options.Tmax > options.Tmin)) {
+            throw teqp::InvalidArgument("Tmin and Tmax must be given, with 0 < Tmin < Tmax");
+        }
+        if (options.Tmin < sa.Tmax && options.Tmin < sa.Tmin) {
+            throw teqp::InvalidArgument("Tmin is below the minimum temperature of the superancillary");
+        }
+        if ((options.mask & ~std::uint32_t(properties::all)) != 0) {
+            throw teqp::InvalidArgument("Unknown bits in the mask of properties: " + std::to_string(options.mask));
+        }
+    }
+
+    using cppinterface::PropertyBundle;
+
+    /// The properties of the mask that are tabulated, other than the inputs, with their names and two-phase rules
+    struct MaskedProperty { properties::Mask bit; const char* name; TwoPhaseRule rule; double PropertyBundle::* member; };
+    const MaskedProperty masked_properties[] = {
+        {properties::p, "p", TwoPhaseRule::saturated, &PropertyBundle::p},
+        {properties::h, "h", TwoPhaseRule::lever, &PropertyBundle::h},
+        {properties::s, "s", TwoPhaseRule::lever, &PropertyBundle::s},
+        {properties::u, "u", TwoPhaseRule::lever, &PropertyBundle::u},
+        {properties::cv, "cv", TwoPhaseRule::nan, &PropertyBundle::cv},
+        {properties::cp, "cp", TwoPhaseRule::nan, &PropertyBundle::cp},
+        {properties::M_w2, "M_w2", TwoPhaseRule::nan, &PropertyBundle::M_w2},
+        {properties::JT, "JT", TwoPhaseRule::nan, &PropertyBundle::JT},
+        {properties::neff, "neff", TwoPhaseRule::nan, &PropertyBundle::neff},
+    };
+    /// Solve f(x) = 0 in [a, b], with f(a) and f(b) of opposite signs, by the Illinois variant of the regula falsi
+    template<typename Function>
+    double solve_bracketed(const Function& f, double a, double b) {
+        double fa = f(a), fb = f(b);
+        if (fa == 0) { return a; }
+        if (fb == 0) { return b; }
+        if (fa*fb > 0) {
+            throw teqp::IterationFailure("The root is not bracketed");
+        }
+        int side = 0;
+        for (auto iter = 0; iter < 200; ++iter) {
+            double c = (a*fb - b*fa)/(fb - fa), fc = f(c);
+            if (fc == 0 || std::abs(b - a) < 1e-14*std::abs(c)) { return c; }
+            if (fc*fb > 0) {
+                b = c; fb = fc;
+                if (side == -1) { fa /= 2; }
+                side = -1;
+            }
+            else {
+                a = c; fa = fc;
+                if (side == 1) { fb /= 2; }
+                side = 1;
+            }
+        }
+        return (a + b)/2;
+    }
+}
+
+PropertyTable build_property_table_Trho(const AbstractModel& ar, const AbstractModel& aig, const PureSuperAncillary& sa, const PropertyTableOptions& options) {
+    check_options(options, sa);
+    if (!(options.rhomin > 0 && options.rhomax > options.rhomin)) {
+        throw teqp::InvalidArgument("rhomin and rhomax must be given, with 0 < rhomin < rhomax");
+    }
+    const auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+
+    TableBuilder b;
+    b.kind = TableKind::Trho;
+    std::vector<const MaskedProperty*> props;
+    for (const auto& mp : masked_properties) {
+        if ((options.mask & mp.bit) != 0) {
+            props.push_back(&mp);
+            b.add_output(mp.name, mp.rule);
+        }
+    }
+    if (props.empty()) {
+        throw teqp::InvalidArgument("The mask selects no property to tabulate");
+    }
+
+    const double lnrhomin = std::log(options.rhomin), lnrhomax = std::log(options.rhomax);
+    const double Tsat_max = std::min(options.Tmax, sa.Tmax);
+    if (options.Tmin < Tsat_max) {
+        auto rhos = sa.get_rhoLrhoV(ar, options.Tmin);
+        if (!(rhos[0] < options.rhomax && rhos[1] > options.rhomin)) {
+            throw teqp::InvalidArgument("The range of density must contain the saturated densities at Tmin");
+        }
+        int iL = b.add_curve([&](double T) { return std::log(sa.get_rhoLrhoV(ar, T)[0]); }, options.Tmin, Tsat_max, "saturated liquid");
+        int iV = b.add_curve([&](double T) { return std::log(sa.get_rhoLrhoV(ar, T)[1]); }, options.Tmin, Tsat_max, "saturated vapor");
+        int vapor = b.add_region(options.Tmin, Tsat_max, -1, lnrhomin, iV, 0);
+        int liquid = b.add_region(options.Tmin, Tsat_max, iL, 0, -1, lnrhomax);
+        b.add_band(options.Tmin, Tsat_max, vapor, liquid);
+    }
+    if (options.Tmax > Tsat_max) {
+        const double T0 = std::max(options.Tmin, Tsat_max);
+        b.add_band(T0, options.Tmax, b.add_region(T0, options.Tmax, -1, lnrhomin, -1, lnrhomax), -1);
+    }
+
+    b.build_patches([&](int, double T, double lnrho, double* out) {
+        auto bundle = ar.get_property_bundle(T, std::exp(lnrho), z, options.mask, &aig);
+        for (auto k = 0U; k < props.size(); ++k) {
+            out[k] = bundle.*(props[k]->member);
+        }
+    }, options);
+    return b.pack(options);
+}
+
+PropertyTable build_property_table_ph(const AbstractModel& ar, const AbstractModel& aig, const PureSuperAncillary& sa, const PropertyTableOptions& options) {
+    check_options(options, sa);
+    if (!(options.pmin > 0 && options.pmax > options.pmin)) {
+        throw teqp::InvalidArgument("pmin and pmax must be given, with 0 < pmin < pmax");
+    }
+    const auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    const double Tmin = options.Tmin, Tmax = options.Tmax;
+
+    TableBuilder b;
+    b.kind = TableKind::ph;
+    b.add_output("T", TwoPhaseRule::saturated);
+    b.add_output("rho", TwoPhaseRule::harmonic);
+    std::vector<const MaskedProperty*> props;
+    for (const auto& mp : masked_properties) {
+        if ((options.mask & mp.bit) != 0 && mp.bit != properties::p && mp.bit != properties::h) {
+            props.push_back(&mp);
+            b.add_output(mp.name, mp.rule);
+        }
+    }
+    const std::uint32_t mask = options.mask | properties::h | properties::cp;
+
+    auto h_Tp = [&](double T, double p, density::RhoPhase phase) {
+        return ar.get_property_bundle(T, ar.solve_rho_Tp(T, p, z, phase), z, properties::h, &aig).h;
+    };
+    const double Tsat_max = std::min(Tmax, sa.Tmax);
+    // The logarithms of the vapor pressures at Tmin and at the top of the two-phase bands
+    const bool twophase = Tmin < Tsat_max;
+    const double lnpA = twophase ? std::log(sa.get_p(Tmin)) : 0, lnpB = twophase ? std::log(sa.get_p(Tsat_max)) : 0;
+    auto get_Tsat = [&](double lnp) {
+        // The nodes at the ends of the band may be a rounding error outside of it
+        if (lnp <= lnpA) { return Tmin; }
+        if (lnp >= lnpB) { return Tsat_max; }
+        return solve_bracketed([&](double T) { return std::log(sa.get_p(T)) - lnp; }, Tmin, Tsat_max);
+    };
+    auto h_sat = [&](double lnp, int iphase) {
+        const double T = get_Tsat(lnp);
+        return ar.get_property_bundle(T, sa.get_rhoLrhoV(ar, T)[iphase], z, properties::h, &aig).h;
+    };
+
+    // The bracket of temperature and the root of the density of each region
+    struct RegionKind { density::RhoPhase phase; bool Tlo_sat, Thi_sat; };
+    std::vector<RegionKind> kinds;
+    const double lnpmin = std::log(options.pmin), lnpmax = std::log(options.pmax);
+    auto add_single = [&](double x0, double x1, density::RhoPhase phase) {
+        int ilo = b.add_curve([&](double lnp) { return h_Tp(Tmin, std::exp(lnp), phase); }, x0, x1, "isotherm Tmin");
+        int ihi = b.add_curve([&](double lnp) { return h_Tp(Tmax, std::exp(lnp), phase); }, x0, x1, "isotherm Tmax");
+        b.add_band(x0, x1, b.add_region(x0, x1, ilo, 0, ihi, 0), -1);
+        kinds.push_back(RegionKind{phase, false, false});
+    };
+    if (twophase) {
+        if (lnpmin < lnpA) {
+            add_single(lnpmin, std::min(lnpA, lnpmax), density::RhoPhase::vapor);
+        }
+        const double x0 = std::max(lnpmin, lnpA), x1 = std::min(lnpmax, lnpB);
+        if (x0 < x1) {
+            int iTmin = b.add_curve([&](double lnp) { return h_Tp(Tmin, std::exp(lnp), density::RhoPhase::liquid); }, x0, x1, "isotherm Tmin");
+            int iL = b.add_curve([&](double lnp) { return h_sat(lnp, 0); }, x0, x1, "saturated liquid");
+            int iV = b.add_curve([&](double lnp) { return h_sat(lnp, 1); }, x0, x1, "saturated vapor");
+            int iTmax = b.add_curve([&](double lnp) { return h_Tp(Tmax, std::exp(lnp), density::RhoPhase::vapor); }, x0, x1, "isotherm Tmax");
+            int liquid = b.add_region(x0, x1, iTmin, 0, iL, 0);
+            kinds.push_back(RegionKind{density::RhoPhase::liquid, false, true});
+            int vapor = b.add_region(x0, x1, iV, 0, iTmax, 0);
+            kinds.push_back(RegionKind{density::RhoPhase::vapor, true, false});
+            b.add_band(x0, x1, liquid, vapor);
+        }
+        if (lnpmax > lnpB) {
+            add_single(std::max(lnpmin, lnpB), lnpmax, density::RhoPhase::stable);
+        }
+    }
+    else {
+        add_single(lnpmin, lnpmax, density::RhoPhase::stable);
+    }
+
+    b.build_patches([&](int iregion, double lnp, double h, double* out) {
+        const auto& kind = kinds[iregion];
+        const double p = std::exp(lnp);
+        const double Tsat = (kind.Tlo_sat || kind.Thi_sat) ? get_Tsat(lnp) : -1;
+        double a = kind.Tlo_sat ? Tsat : Tmin, c = kind.Thi_sat ? Tsat : Tmax;
+        auto state = [&](double T) {
+            double rho = ar.solve_rho_Tp(T, p, z, kind.phase);
+            return std::make_tuple(rho, ar.get_property_bundle(T, rho, z, mask, &aig));
+        };
+        // Newton steps in T, safeguarded by bisection within the bracket [a, c] of h
+        const double ha = std::get<1>(state(a)).h, hc = std::get<1>(state(c)).h;
+        double T;
+        if (h <= ha) { T = a; }
+        else if (h >= hc) { T = c; }
+        else {
+            T = a + (h - ha)/(hc - ha)*(c - a);
+            for (auto iter = 0; ; ++iter) {
+                if (iter == 100) {
+                    throw teqp::IterationFailure("Unable to solve for T from h");
+                }
+                auto [rho, bundle] = state(T);
+                double r = bundle.h - h;
+                if (r == 0) { break; }
+                if (r < 0) { a = T; } else { c = T; }
+                double Tnew = T - r/bundle.cp;
+                if (!(Tnew > a && Tnew < c)) { Tnew = (a + c)/2; }
+                bool done = std::abs(Tnew - T) < 1e-12*T;
+                T = Tnew;
+                if (done) { break; }
+            }
+        }
+        auto [rho, bundle] = state(T);
+        out[0] = T;
+        out[1] = rho;
+        for (auto k = 0U; k < props.size(); ++k) {
+            out[2 + k] = bundle.*(props[k]->member);
+        }
+    }, options);
+    return b.pack(options);
+}
+
+}
+}
@@ -1,39 +1,38 @@
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
 #include "teqp/cpp/teqpcpp.hpp"
-#include "teqp/json_builder.hpp"
-#include "teqp/cpp/deriv_adapter.hpp"
+#include "model_factories.hpp"
 
 namespace teqp {
     namespace cppinterface {
 
-        std::unique_ptr<teqp::cppinterface::AbstractModel> make_SAFTVRMie(const nlohmann::json &j);
-
         using makefunc = std::function<std::unique_ptr<teqp::cppinterface::AbstractModel>(const nlohmann::json &j)>;
-        using namespace teqp::cppinterface::adapter;
 
+        // The models are built (and their adapters instantiated) in the compilation units of their families, see model_factories.hpp
         static std::unordered_map<std::string, makefunc> pointer_factory = {
-            {"vdW1", [](const nlohmann::json& spec){ return make_owned(vdWEOS1(spec.at("a"), spec.at("b"))); }},
-            {"vdW", [](const nlohmann::json& spec){ return make_owned(vdWEOS<double>(spec.at("Tcrit / K"), spec.at("pcrit / Pa"))); }},
-            {"PR", [](const nlohmann::json& spec){ return make_owned(make_canonicalPR(spec));}},
-            {"SRK", [](const nlohmann::json& spec){ return make_owned(make_canonicalSRK(spec));}},
-            {"cubic", [](const nlohmann::json& spec){ return make_owned(make_generalizedcubic(spec));}},
-            
-            {"CPA", [](const nlohmann::json& spec){ return make_owned(CPA::CPAfactory(spec));}},
-            {"PCSAFT", [](const nlohmann::json& spec){ return make_owned(PCSAFT::PCSAFTfactory(spec));}},
+            {"vdW1", factories::make_vdW1},
+            {"vdW", factories::make_vdW},
+            {"PR", factories::make_PR},
+            {"SRK", factories::make_SRK},
+            {"cubic", factories::make_cubic},
             
-            {"multifluid", [](const nlohmann::json& spec){ return make_owned(multifluidfactory(spec));}},
-            {"SW_EspindolaHeredia2009",  [](const nlohmann::json& spec){ return make_owned(squarewell::EspindolaHeredia2009(spec.at("lambda")));}},
-            {"EXP6_Kataoka1992", [](const nlohmann::json& spec){ return make_owned(exp6::Kataoka1992(spec.at("alpha")));}},
-            {"AmmoniaWaterTillnerRoth", [](const nlohmann::json& spec){ return make_owned(AmmoniaWaterTillnerRoth());}},
-            {"LJ126_TholJPCRD2016", [](const nlohmann::json& spec){ return make_owned(build_LJ126_TholJPCRD2016());}},
-            {"LJ126_KolafaNezbeda1994", [](const nlohmann::json& spec){ return make_owned(LJ126KolafaNezbeda1994());}},
-            {"LJ126_Johnson1993", [](const nlohmann::json& spec){ return make_owned(LJ126Johnson1993());}},
-            {"Mie_Pohl2023", [](const nlohmann::json& spec){ return make_owned(Mie::Mie6Pohl2023(spec.at("lambda_a")));}},
-            {"2CLJF-Dipole", [](const nlohmann::json& spec){ return make_owned(twocenterljf::build_two_center_model_dipole(spec.at("author"), spec.at("L^*"), spec.at("(mu^*)^2")));}},
-            {"2CLJF-Quadrupole", [](const nlohmann::json& spec){ return make_owned(twocenterljf::build_two_center_model_quadrupole(spec.at("author"), spec.at("L^*"), spec.at("(mu^*)^2")));}},
-            {"IdealHelmholtz", [](const nlohmann::json& spec){ return make_owned(IdealHelmholtz(spec));}},
+            {"CPA", factories::make_CPA},
+            {"PCSAFT", factories::make_PCSAFT},
+            {"SAFT-VR-Mie", factories::make_SAFTVRMie},
             
-            // Implemented in its own compilation unit to help with compilation time
-            {"SAFT-VR-Mie", [](const nlohmann::json& spec){ return make_SAFTVRMie(spec); }}
+            {"multifluid", factories::make_multifluid},
+            {"SW_EspindolaHeredia2009", factories::make_SW_EspindolaHeredia2009},
+            {"EXP6_Kataoka1992", factories::make_EXP6_Kataoka1992},
+            {"AmmoniaWaterTillnerRoth", factories::make_AmmoniaWaterTillnerRoth},
+            {"LJ126_TholJPCRD2016", factories::make_LJ126_TholJPCRD2016},
+            {"LJ126_KolafaNezbeda1994", factories::make_LJ126_KolafaNezbeda1994},
+            {"LJ126_Johnson1993", factories::make_LJ126_Johnson1993},
+            {"Mie_Pohl2023", factories::make_Mie_Pohl2023},
+            {"2CLJF-Dipole", factories::make_2CLJF_Dipole},
+            {"2CLJF-Quadrupole", factories::make_2CLJF_Quadrupole},
+            {"IdealHelmholtz", factories::make_IdealHelmholtz},
         };
 
         std::unique_ptr<teqp::cppinterface::AbstractModel> build_model_ptr(const nlohmann::json& json) {
@@ -51,12 +50,47 @@ namespace teqp {
             }
         }
     
-        std::unique_ptr<AbstractModel> make_multifluid_model(const std::vector<std::string>& components, const std::string& coolprop_root, const std::string& BIPcollectionpath, const nlohmann::json& flags, const std::string& departurepath) {
-            return make_owned(build_multifluid_model(components, coolprop_root, BIPcollectionpath, flags, departurepath));
+        std::unique_ptr<AbstractModel> make_model(const nlohmann::json& j) {
+            auto model = build_model_ptr(j);
+            if (j.contains("virial") && !(j.at("virial").is_boolean() && !j.at("virial").get<bool>())){
+                VirialFastPathOptions options;
+                if (j.at("virial").is_object()){
+                    options.Nvir = j.at("virial").value("Nvir", options.Nvir);
+                    options.atol = j.at("virial").value("atol", options.atol);
+                }
+                model = make_virial_model(std::move(model), options);
+            }
+            if (j.value("profile", false)){
+                return make_profiling_model(std::move(model));
+            }
+            return model;
+        }
+    
+        namespace {
+            std::mutex model_cache_mutex;
+            std::unordered_map<std::string, std::shared_ptr<const AbstractModel>> model_cache;
         }
     
-        std::unique_ptr<AbstractModel> make_model(const nlohmann::json& j) {
-            return build_model_ptr(j);
+        std::shared_ptr<const AbstractModel> make_model_cached(const nlohmann::json& j) {
+            // Objects in nlohmann::json are sorted by key, so the compact dump is canonical
+            const std::string key = j.dump();
+            {
+                std::lock_guard<std::mutex> lock(model_cache_mutex);
+                auto itr = model_cache.find(key);
+                if (itr != model_cache.end()){
+                    return itr->second;
+                }
+            }
+            // Built without holding the lock so that other specifications are not blocked; if another thread
+            // built the same specification in the meantime, its model is the one kept
+            std::shared_ptr<const AbstractModel> model = make_model(j);
+            std::lock_guard<std::mutex> lock(model_cache_mutex);
+            return model_cache.try_emplace(key, std::move(model)).first->second;
+        }
+    
+        void clear_model_cache() {
+            std::lock_guard<std::mutex> lock(model_cache_mutex);
+            model_cache.clear();
         }
     }
 }
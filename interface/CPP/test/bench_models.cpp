@@ -0,0 +1,162 @@
+/**
+ Benchmarks of a standard set of calls through the C++ interface, for every kind of model in the factory
+
+ For each kind, and for N = 1, 2 and 5 components (when the model supports that many), the time per call of
+ a standard set of methods is measured, and all the results are written as JSON to the file given by the
+ environment variable TEQP_BENCH_JSON (bench_models.json in the working directory if not set), so that runs
+ before and after a change can be compared programmatically. Like the other tests, the multifluid models
+ are loaded from ../mycp
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <cstdlib>
+
+#include "teqpcpp.hpp"
+
+using namespace teqp::cppinterface;
+
+namespace {
+
+    /// A model specification and the state point at which it is benchmarked
+    struct BenchCase {
+        std::string kind;
+        std::size_t N;
+        nlohmann::json model;
+        double T, rho;
+    };
+
+    // Methane, ethane, propane, n-butane and nitrogen
+    const std::vector<std::string> names = {"Methane", "Ethane", "Propane", "n-Butane", "Nitrogen"};
+    const std::vector<double> Tc_K = {190.564, 305.32, 369.89, 425.125, 126.192};
+    const std::vector<double> pc_Pa = {4599200, 4872200, 4251200, 3796000, 3395800};
+    const std::vector<double> acentric = {0.011, 0.099, 0.152, 0.201, 0.0372};
+    // m, sigma / A, epsilon/k / K from Gross and Sadowski
+    const std::vector<std::vector<double>> PCSAFT_coeffs = {{1.0, 3.7039, 150.03}, {1.6069, 3.5206, 191.42}, {2.002, 3.6184, 208.11}, {2.3316, 3.7086, 222.88}, {1.2053, 3.3130, 90.96}};
+    // m, sigma / A, epsilon/k / K, lambda_r from Lafitte et al.
+    const std::vector<std::vector<double>> SAFTVRMie_coeffs = {{1.0, 3.7412, 153.36, 12.650}, {1.4373, 3.7257, 206.12, 12.400}, {1.6845, 3.9056, 239.89, 13.006}, {1.8514, 4.0887, 273.64, 13.650}, {1.4214, 3.1760, 72.438, 9.8749}};
+
+    template<typename T>
+    auto head(const std::vector<T>& v, std::size_t N){ return std::vector<T>(v.begin(), v.begin() + N); }
+
+    /// All the cases to be benchmarked; every kind of the factory appears at least once
+    std::vector<BenchCase> get_cases(){
+        std::vector<BenchCase> cases;
+        for (std::size_t N : {1, 2, 5}){
+            nlohmann::json crit = {{"Tcrit / K", head(Tc_K, N)}, {"pcrit / Pa", head(pc_Pa, N)}};
+            nlohmann::json critw = crit; critw["acentric"] = head(acentric, N);
+            cases.push_back({"vdW", N, crit, 300, 1000});
+            cases.push_back({"PR", N, critw, 300, 1000});
+            cases.push_back({"SRK", N, critw, 300, 1000});
+            nlohmann::json cubic = critw; cubic["type"] = "PR";
+            cases.push_back({"cubic", N, cubic, 300, 1000});
+
+            nlohmann::json pcsaft = nlohmann::json::array(), vrmie = nlohmann::json::array();
+            for (auto i = 0U; i < N; ++i){
+                const auto& c = PCSAFT_coeffs[i];
+                pcsaft.push_back({{"name", names[i]}, {"m", c[0]}, {"sigma_Angstrom", c[1]}, {"epsilon_over_k", c[2]}, {"BibTeXKey", "?"}});
+                const auto& v = SAFTVRMie_coeffs[i];
+                vrmie.push_back({{"name", names[i]}, {"m", v[0]}, {"sigma_Angstrom", v[1]}, {"epsilon_over_k", v[2]}, {"lambda_r", v[3]}, {"lambda_a", 6.0}, {"BibTeXKey", "?"}});
+            }
+            cases.push_back({"PCSAFT", N, {{"coeffs", pcsaft}}, 300, 1000});
+            cases.push_back({"SAFT-VR-Mie", N, {{"coeffs", vrmie}}, 300, 1000});
+            cases.push_back({"multifluid", N, {{"components", head(names, N)}, {"root", "../mycp"}, {"BIP", ""}, {"departure", ""}}, 300, 1000});
+        }
+        // Water, from the CPA test
+        nlohmann::json water = {
+            {"a0i / Pa m^6/mol^2", 0.12277}, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+            {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class", "4C"}
+        };
+        cases.push_back({"CPA", 1, {{"cubic", "SRK"}, {"pures", {water}}, {"R_gas / J/mol/K", 8.3144598}}, 400, 100});
+        cases.push_back({"AmmoniaWaterTillnerRoth", 2, nlohmann::json::object(), 500, 300});
+        nlohmann::json lead = {{"R", 8.31446261815324}, {"terms", {{{"type", "Lead"}, {"a_1", 1}, {"a_2", 2}}}}};
+        cases.push_back({"IdealHelmholtz", 1, nlohmann::json::array({lead}), 300, 1000});
+
+        // The pure fluids in SI units
+        cases.push_back({"vdW1", 1, {{"a", 0.1375}, {"b", 3.86e-5}}, 300, 1000});
+
+        // And those in reduced units
+        cases.push_back({"SW_EspindolaHeredia2009", 1, {{"lambda", 1.5}}, 1.5, 0.3});
+        cases.push_back({"EXP6_Kataoka1992", 1, {{"alpha", 12}}, 1.5, 0.3});
+        cases.push_back({"LJ126_TholJPCRD2016", 1, nlohmann::json::object(), 1.5, 0.3});
+        cases.push_back({"LJ126_KolafaNezbeda1994", 1, nlohmann::json::object(), 1.5, 0.3});
+        cases.push_back({"LJ126_Johnson1993", 1, nlohmann::json::object(), 1.5, 0.3});
+        cases.push_back({"Mie_Pohl2023", 1, {{"lambda_a", 12}}, 1.5, 0.3});
+        cases.push_back({"2CLJF-Dipole", 1, {{"author", "2CLJF_Lisal"}, {"L^*", 0.5}, {"(mu^*)^2", 0.1}}, 3.0, 0.2});
+        cases.push_back({"2CLJF-Quadrupole", 1, {{"author", "2CLJF_Lisal"}, {"L^*", 0.5}, {"(mu^*)^2", 0.1}}, 3.0, 0.2});
+        return cases;
+    }
+
+    /// Time per call in microseconds: the median of several batches, each long enough to be resolved by the clock
+    double time_per_call_us(const std::function<double()>& f){
+        using clock = std::chrono::steady_clock;
+        volatile double sink = 0; // So that the calls are not optimized away
+        sink = sink + f(); // And a warmup call
+        std::size_t Ncalls = 1;
+        // Find the size of a batch that takes at least a millisecond
+        while (true){
+            auto tic = clock::now();
+            for (auto i = 0U; i < Ncalls; ++i){ sink = sink + f(); }
+            auto elap = std::chrono::duration<double>(clock::now() - tic).count();
+            if (elap > 1e-3 || Ncalls > 1000000){ break; }
+            Ncalls *= 2;
+        }
+        std::vector<double> times;
+        for (auto batch = 0; batch < 7; ++batch){
+            auto tic = clock::now();
+            for (auto i = 0U; i < Ncalls; ++i){ sink = sink + f(); }
+            times.push_back(std::chrono::duration<double>(clock::now() - tic).count()/Ncalls*1e6);
+        }
+        std::sort(times.begin(), times.end());
+        return times[times.size()/2];
+    }
+}
+
+TEST_CASE("Benchmark every kind of model", "[bench][models]")
+{
+    nlohmann::json results = nlohmann::json::array();
+    for (const auto& c : get_cases()){
+        std::unique_ptr<AbstractModel> model;
+        try{
+            model = make_model({{"kind", c.kind}, {"model", c.model}});
+        }
+        catch(std::exception& e){
+            // Missing fluid files for instance; reported but not fatal
+            WARN("Unable to build " + c.kind + " with " + std::to_string(c.N) + " component(s): " + e.what());
+            continue;
+        }
+        Eigen::ArrayXd z = Eigen::ArrayXd::Constant(c.N, 1.0/c.N);
+        Eigen::ArrayXd rhovec = c.rho*z;
+        const double T = c.T, rho = c.rho;
+        double Psir; Eigen::ArrayXd grad(c.N); Eigen::MatrixXd H(c.N, c.N);
+
+        std::vector<std::pair<std::string, std::function<double()>>> calls = {
+            {"Ar00", [&](){ return model->get_Ar00(T, rho, z); }},
+            {"Ar01", [&](){ return model->get_Ar01(T, rho, z); }},
+            {"Ar02n", [&](){ return model->get_Ar02n(T, rho, z)[2]; }},
+            {"deriv_mat2", [&](){ return model->get_deriv_mat2(T, rho, z)(1, 1); }},
+            {"fgradHessian", [&](){ model->build_Psir_fgradHessian_autodiff(T, rhovec, Psir, grad, H); return Psir; }},
+            {"fugacity_coefficients", [&](){ return model->get_fugacity_coefficients(T, rhovec)[0]; }},
+        };
+        nlohmann::json timings = nlohmann::json::object();
+        for (const auto& [name, f] : calls){
+            try{
+                timings[name] = time_per_call_us(f);
+            }
+            catch(std::exception& e){
+                // Not all models implement all the methods (the ideal-gas model has no residual part, for instance)
+                timings[name] = nullptr;
+            }
+        }
+        results.push_back({{"kind", c.kind}, {"N", c.N}, {"T", T}, {"rho", rho}, {"time / us", timings}});
+    }
+    CHECK(results.size() > 0);
+
+    const char* path = std::getenv("TEQP_BENCH_JSON");
+    std::ofstream ofs(path ? path : "bench_models.json");
+    ofs << results.dump(1);
+}
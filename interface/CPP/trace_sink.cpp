@@ -0,0 +1,497 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "teqp/cpp/trace_sink.hpp"
+#include "teqp/exceptions.hpp"
+
+namespace teqp{
+namespace tracesink{
+
+namespace{
+
+    constexpr char magic[8] = {'T', 'E', 'Q', 'P', 'T', 'R', 'C', '1'};
+    constexpr std::uint32_t version = 1;
+
+    /// The fixed part of the header of the columnar format, followed by the schema in JSON
+    struct Header{
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t row_width;
+        std::uint64_t Nrows; ///< The number of rows in the blocks written so far
+        std::uint64_t data_offset; ///< The offset of the first block from the start of the file
+    };
+    static_assert(sizeof(Header) == 32, "The header of the columnar format must be 32 bytes");
+
+    bool little_endian(){
+        const std::uint16_t one = 1;
+        unsigned char first;
+        std::memcpy(&first, &one, 1);
+        return first == 1;
+    }
+
+    /**
+     A file written through a shared mapping, which grows by doubling; close() unmaps it and truncates the file to the bytes written
+     */
+    class MappedFile{
+    private:
+        std::string path;
+        char* base = nullptr;
+        std::size_t capacity = 0, Nbytes = 0;
+#if defined(_WIN32)
+        HANDLE file = INVALID_HANDLE_VALUE, mapping = nullptr;
+#else
+        int fd = -1;
+#endif
+        void fail(const std::string& what) const {
+            throw teqp::InvalidArgument("Unable to " + what + " the trace file: " + path);
+        }
+        void map(const std::size_t new_capacity){
+#if defined(_WIN32)
+            const auto size = static_cast<std::uint64_t>(new_capacity);
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+            if (mapping == nullptr){ fail("map"); }
+            base = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, new_capacity));
+            if (base == nullptr){ fail("map"); }
+#else
+            if (ftruncate(fd, static_cast<off_t>(new_capacity)) != 0){ fail("resize"); }
+            void* p = mmap(nullptr, new_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED){ fail("map"); }
+            base = static_cast<char*>(p);
+#endif
+            capacity = new_capacity;
+        }
+        void unmap(){
+            if (base == nullptr){ return; }
+#if defined(_WIN32)
+            UnmapViewOfFile(base);
+            CloseHandle(mapping);
+            mapping = nullptr;
+#else
+            munmap(base, capacity);
+#endif
+            base = nullptr;
+        }
+    public:
+        MappedFile(const std::string& path, const std::size_t initial_bytes) : path(path) {
+#if defined(_WIN32)
+            file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE){ fail("open"); }
+#else
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0){ fail("open"); }
+#endif
+            map(std::max<std::size_t>(initial_bytes, 4096));
+        }
+        ~MappedFile(){
+            try{ close(); } catch(...){}
+        }
+        bool is_open() const {
+#if defined(_WIN32)
+            return file != INVALID_HANDLE_VALUE;
+#else
+            return fd >= 0;
+#endif
+        }
+        std::size_t size() const { return Nbytes; }
+        char* data(){ return base; }
+        /// Make room for n more bytes, and return where they go
+        char* extend(const std::size_t n){
+            if (Nbytes + n > capacity){
+                auto new_capacity = capacity;
+                while (Nbytes + n > new_capacity){ new_capacity *= 2; }
+                unmap();
+                map(new_capacity);
+            }
+            char* p = base + Nbytes;
+            Nbytes += n;
+            return p;
+        }
+        void write(const void* src, const std::size_t n){
+            std::memcpy(extend(n), src, n);
+        }
+        void sync(){
+#if defined(_WIN32)
+            FlushViewOfFile(base, Nbytes);
+#else
+            msync(base, Nbytes, MS_ASYNC);
+#endif
+        }
+        void close(){
+            if (!is_open()){ return; }
+            unmap();
+#if defined(_WIN32)
+            LARGE_INTEGER end; end.QuadPart = static_cast<LONGLONG>(Nbytes);
+            const bool ok = SetFilePointerEx(file, end, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+            CloseHandle(file);
+            file = INVALID_HANDLE_VALUE;
+#else
+            const bool ok = ftruncate(fd, static_cast<off_t>(Nbytes)) == 0;
+            ::close(fd);
+            fd = -1;
+#endif
+            if (!ok){ fail("truncate"); }
+        }
+    };
+
+    /// Append a double to an NDJSON line, as null if it is not finite (which JSON cannot represent)
+    void append_number(std::string& line, const double x){
+        if (!std::isfinite(x)){
+            line += "null";
+            return;
+        }
+        char buf[32];
+        const int n = std::snprintf(buf, sizeof(buf), "%.17g", x);
+        line.append(buf, static_cast<std::size_t>(n));
+    }
+}
+
+std::size_t Schema::row_width() const {
+    std::size_t w = 0;
+    for (const auto& c : columns){ w += c.width; }
+    return w;
+}
+
+nlohmann::json Schema::to_json() const {
+    nlohmann::json cols = nlohmann::json::array();
+    for (const auto& c : columns){
+        cols.push_back({{"name", c.name}, {"width", c.width}});
+    }
+    return {{"format", "teqp-trace"}, {"version", version}, {"dtype", "float64"}, {"byteorder", little_endian() ? "little" : "big"}, {"columns", cols}};
+}
+
+Schema Schema::from_json(const nlohmann::json& j){
+    Schema s;
+    for (const auto& c : j.at("columns")){
+        s.columns.push_back(Column{c.at("name").get<std::string>(), c.at("width").get<std::size_t>()});
+    }
+    return s;
+}
+
+Schema VLE_trace_schema(const std::size_t N){
+    return Schema{{{"t", 1}, {"dt", 1}, {"T", 1}, {"pL", 1}, {"pV", 1}, {"c", 1}, {"rhovecL", N}, {"rhovecV", N}}};
+}
+
+Schema phase_envelope_schema(const std::size_t N){
+    return Schema{{{"s", 1}, {"ds", 1}, {"T", 1}, {"p", 1}, {"rhovecB", N}, {"rhovecI", N}, {"event", 1}}};
+}
+
+Schema json_schema(const nlohmann::json& point){
+    Schema s;
+    for (const auto& [key, value] : point.items()){
+        if (value.is_number()){
+            s.columns.push_back(Column{key, 1});
+        }
+        else if (value.is_array() && !value.empty() && std::all_of(value.begin(), value.end(), [](const auto& v){ return v.is_number(); })){
+            s.columns.push_back(Column{key, value.size()});
+        }
+    }
+    return s;
+}
+
+struct TraceSink::Impl{
+    Schema schema;
+    SinkOptions options;
+    MappedFile file;
+    std::size_t width, Nrows = 0;
+    std::vector<double> row; ///< The scratch row of the typed appends
+    std::vector<std::string> keys; ///< The quoted names of the columns with their colons, for the NDJSON format
+    std::vector<double> block; ///< The staged rows of the columnar format, column-major with block_rows rows
+    std::size_t Nstaged = 0;
+    bool closed = false;
+
+    Impl(const std::string& path, const Schema& schema, const SinkOptions& options) : schema(schema), options(options), file(path, options.initial_bytes), width(schema.row_width()), row(width) {
+        if (width == 0){
+            throw teqp::InvalidArgument("The schema of a trace sink must have at least one column");
+        }
+        const auto schema_text = schema.to_json().dump();
+        if (options.format == Format::columnar){
+            if (options.block_rows == 0){
+                throw teqp::InvalidArgument("block_rows must be positive");
+            }
+            block.resize(options.block_rows*width);
+            const std::size_t padded = (schema_text.size() + 7)/8*8;
+            Header h;
+            std::memcpy(h.magic, magic, sizeof(magic));
+            h.version = version;
+            h.row_width = static_cast<std::uint32_t>(width);
+            h.Nrows = 0;
+            h.data_offset = sizeof(Header) + padded;
+            file.write(&h, sizeof(h));
+            file.write(schema_text.data(), schema_text.size());
+            std::memset(file.extend(padded - schema_text.size()), 0, padded - schema_text.size());
+        }
+        else{
+            for (const auto& c : schema.columns){
+                keys.push_back(nlohmann::json(c.name).dump() + ":");
+            }
+            file.write(schema_text.data(), schema_text.size());
+            file.write("\n", 1);
+        }
+    }
+
+    void check_open() const {
+        if (closed){
+            throw teqp::InvalidArgument("The trace sink is closed");
+        }
+    }
+
+    void write_block(){
+        if (Nstaged == 0){ return; }
+        const std::uint64_t n = Nstaged;
+        file.write(&n, sizeof(n));
+        double* dest = reinterpret_cast<double*>(file.extend(Nstaged*width*sizeof(double)));
+        for (std::size_t k = 0; k < width; ++k){
+            std::memcpy(dest + k*Nstaged, block.data() + k*options.block_rows, Nstaged*sizeof(double));
+        }
+        // The count in the header is updated last, so that it only covers complete blocks
+        const std::uint64_t total = Nrows;
+        std::memcpy(file.data() + offsetof(Header, Nrows), &total, sizeof(total));
+        Nstaged = 0;
+    }
+
+    void append(const double* x){
+        check_open();
+        if (options.format == Format::columnar){
+            for (std::size_t k = 0; k < width; ++k){
+                block[k*options.block_rows + Nstaged] = x[k];
+            }
+            ++Nstaged; ++Nrows;
+            if (Nstaged == options.block_rows){ write_block(); }
+        }
+        else{
+            std::string line = "{";
+            std::size_t k = 0;
+            for (std::size_t ic = 0; ic < schema.columns.size(); ++ic){
+                const auto& c = schema.columns[ic];
+                if (ic > 0){ line += ','; }
+                line += keys[ic];
+                if (c.width == 1){
+                    append_number(line, x[k++]);
+                }
+                else{
+                    line += '[';
+                    for (std::size_t m = 0; m < c.width; ++m){
+                        if (m > 0){ line += ','; }
+                        append_number(line, x[k++]);
+                    }
+                    line += ']';
+                }
+            }
+            line += "}\n";
+            file.write(line.data(), line.size());
+            ++Nrows;
+        }
+    }
+
+    /// Copy the values of a column from an array of the point, or NaN if its length does not match
+    template<typename Array>
+    double* put(double* dest, const Array& a, const std::size_t w){
+        if (static_cast<std::size_t>(a.size()) == w){
+            for (std::size_t m = 0; m < w; ++m){ dest[m] = a[m]; }
+        }
+        else{
+            std::fill(dest, dest + w, std::numeric_limits<double>::quiet_NaN());
+        }
+        return dest + w;
+    }
+};
+
+TraceSink::TraceSink(const std::string& path, const Schema& schema, const SinkOptions& options) : impl(std::make_unique<Impl>(path, schema, options)) {}
+
+TraceSink::~TraceSink(){
+    try{ close(); } catch(...){}
+}
+
+const Schema& TraceSink::get_schema() const { return impl->schema; }
+
+std::size_t TraceSink::get_row_count() const { return impl->Nrows; }
+
+void TraceSink::append(const double* row){ impl->append(row); }
+
+void TraceSink::append(const VLETracePoint& pt){
+    auto& I = *impl;
+    const auto& c = I.schema.columns;
+    if (c.size() != 8){
+        throw teqp::InvalidArgument("The schema of the sink is not that of VLE_trace_schema");
+    }
+    double* r = I.row.data();
+    for (double x : {pt.t, pt.dt, pt.T, pt.pL, pt.pV, pt.c}){ *r++ = x; }
+    r = I.put(r, pt.rhovecL, c[6].width);
+    I.put(r, pt.rhovecV, c[7].width);
+    I.append(I.row.data());
+}
+
+void TraceSink::append(const PhaseEnvelopePoint& pt){
+    auto& I = *impl;
+    const auto& c = I.schema.columns;
+    if (c.size() != 7){
+        throw teqp::InvalidArgument("The schema of the sink is not that of phase_envelope_schema");
+    }
+    double* r = I.row.data();
+    for (double x : {pt.s, pt.ds, pt.T, pt.p}){ *r++ = x; }
+    r = I.put(r, pt.rhovecB, c[4].width);
+    r = I.put(r, pt.rhovecI, c[5].width);
+    *r = static_cast<double>(pt.event);
+    I.append(I.row.data());
+}
+
+void TraceSink::append(const nlohmann::json& point){
+    auto& I = *impl;
+    double* r = I.row.data();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (const auto& c : I.schema.columns){
+        auto it = point.find(c.name);
+        if (it == point.end()){
+            std::fill(r, r + c.width, nan);
+        }
+        else if (c.width == 1 && it->is_number()){
+            *r = it->get<double>();
+        }
+        else if (it->is_array() && it->size() == c.width){
+            for (std::size_t m = 0; m < c.width; ++m){
+                r[m] = (*it)[m].is_number() ? (*it)[m].get<double>() : nan;
+            }
+        }
+        else{
+            std::fill(r, r + c.width, nan);
+        }
+        r += c.width;
+    }
+    I.append(I.row.data());
+}
+
+void TraceSink::flush(){
+    impl->check_open();
+    impl->write_block();
+    impl->file.sync();
+}
+
+void TraceSink::close(){
+    if (impl->closed){ return; }
+    impl->write_block();
+    impl->closed = true;
+    impl->file.close();
+}
+
+VLETraceCallback TraceSink::VLE_callback(){
+    return [this](const VLETracePoint& pt){ append(pt); return true; };
+}
+
+PhaseEnvelopeCallback TraceSink::phase_envelope_callback(){
+    return [this](const PhaseEnvelopePoint& pt){ append(pt); return true; };
+}
+
+std::function<bool(const nlohmann::json&)> TraceSink::json_callback(){
+    return [this](const nlohmann::json& pt){ append(pt); return true; };
+}
+
+EMatrixd TraceData::get(const std::string& name) const {
+    Eigen::Index k = 0;
+    for (const auto& c : schema.columns){
+        const auto w = static_cast<Eigen::Index>(c.width);
+        if (c.name == name){
+            return data.middleCols(k, w);
+        }
+        k += w;
+    }
+    throw teqp::InvalidArgument("The trace has no column named " + name);
+}
+
+TraceData read_trace(const std::string& path){
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    if (!ifs){
+        throw teqp::InvalidArgument("Unable to open the trace file: " + path);
+    }
+    const auto size = static_cast<std::size_t>(ifs.tellg());
+    std::string buffer(size, '\0');
+    ifs.seekg(0);
+    if (!ifs.read(&buffer[0], static_cast<std::streamsize>(size))){
+        throw teqp::InvalidArgument("Unable to read the trace file: " + path);
+    }
+
+    TraceData out;
+    if (size >= sizeof(Header) && std::memcmp(buffer.data(), magic, sizeof(magic)) == 0){
+        Header h;
+        std::memcpy(&h, buffer.data(), sizeof(h));
+        if (h.version != version || h.data_offset > size || h.data_offset < sizeof(Header)){
+            throw teqp::InvalidArgument("The trace file is not of a supported version: " + path);
+        }
+        // The schema fills the bytes up to the first block, padded with zeros if its length is not a multiple of 8
+        auto schema_text = std::string(buffer.data() + sizeof(Header), h.data_offset - sizeof(Header));
+        schema_text.erase(schema_text.find_last_not_of('\0') + 1);
+        out.schema = Schema::from_json(nlohmann::json::parse(schema_text));
+        const std::size_t width = h.row_width;
+        out.data.resize(static_cast<Eigen::Index>(h.Nrows), static_cast<Eigen::Index>(width));
+        std::size_t offset = h.data_offset, row0 = 0;
+        while (row0 < h.Nrows){
+            std::uint64_t n;
+            if (offset + sizeof(n) > size){ break; }
+            std::memcpy(&n, buffer.data() + offset, sizeof(n));
+            offset += sizeof(n);
+            if (n == 0 || row0 + n > h.Nrows || offset + n*width*sizeof(double) > size){
+                throw teqp::InvalidArgument("The trace file is truncated: " + path);
+            }
+            for (std::size_t k = 0; k < width; ++k){
+                std::memcpy(&out.data(static_cast<Eigen::Index>(row0), static_cast<Eigen::Index>(k)), buffer.data() + offset + k*n*sizeof(double), n*sizeof(double));
+            }
+            offset += n*width*sizeof(double);
+            row0 += n;
+        }
+        return out;
+    }
+
+    // NDJSON; an open file ends with the zeros of the part of the mapping not yet written
+    const auto end = buffer.find('\0');
+    std::vector<nlohmann::json> rows;
+    std::size_t start = 0;
+    bool first = true;
+    while (start < std::min(end, size)){
+        auto stop = buffer.find('\n', start);
+        if (stop == std::string::npos || stop > end){ break; } // An incomplete last line
+        auto j = nlohmann::json::parse(buffer.begin() + start, buffer.begin() + stop);
+        if (first){
+            out.schema = Schema::from_json(j);
+            first = false;
+        }
+        else{
+            rows.push_back(std::move(j));
+        }
+        start = stop + 1;
+    }
+    if (first){
+        throw teqp::InvalidArgument("The trace file has no schema: " + path);
+    }
+    out.data.resize(static_cast<Eigen::Index>(rows.size()), static_cast<Eigen::Index>(out.schema.row_width()));
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t i = 0; i < rows.size(); ++i){
+        Eigen::Index k = 0;
+        for (const auto& c : out.schema.columns){
+            const auto& v = rows[i].at(c.name);
+            for (std::size_t m = 0; m < c.width; ++m){
+                const auto& x = (c.width == 1) ? v : v.at(m);
+                out.data(static_cast<Eigen::Index>(i), k++) = x.is_null() ? nan : x.get<double>();
+            }
+        }
+    }
+    return out;
+}
+
+}
+}
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/per_thread.hpp"
+
+namespace teqp {
+    namespace cppinterface {
+
+        namespace {
+
+            /// The falling factorial k(k-1)...(k-j+1), from \f$\rho^j\partial^j\rho^k/\partial\rho^j = k(k-1)...(k-j+1)\rho^k\f$
+            double falling(const int k, const int j){
+                double o = 1.0;
+                for (auto m = 0; m < j; ++m){ o *= (k - m); }
+                return o;
+            }
+
+            /**
+             The virial coefficients at one temperature and composition, with their temperature derivatives converted to those in
+             \f$\tau=1/T\f$ of \f$\Lambda^{\rm r}_{ij}\f$: C(n-2, i) is \f$\tau^i\partial^i B_n/\partial\tau^i\f$ for n from 2 to Nvir+1
+             */
+            struct Coefficients {
+                bool valid = false;
+                double T = 0;
+                Eigen::ArrayXd z;
+                int NTmax = -1;
+                Eigen::ArrayXXd C;
+                double rho_max = 0; ///< The largest threshold of the orders of the coefficients
+            };
+
+            class VirialAdapter : public AbstractModel {
+            private:
+                std::unique_ptr<AbstractModel> model;
+                const VirialFastPathOptions options;
+                PerThreadStore<Coefficients> cache;
+
+                static constexpr int NTmax_series = 2;
+
+                bool same_composition(const Coefficients& c, const REArrayd& z) const {
+                    return c.z.size() == z.size() && (c.z == z).all();
+                }
+
+                /// The coefficients at T and z, or nullptr if they are not worth obtaining for a state of density rho
+                const Coefficients* get_coefficients(const int NT, const double T, const double rho, const REArrayd& z) const {
+                    auto& c = cache.local();
+                    if (c.valid && c.T == T && c.NTmax >= NT && same_composition(c, z)){
+                        return &c;
+                    }
+                    // At a new temperature, the threshold scales about like that of the last one, so that dense states are not screened at the cost of new coefficients
+                    if (c.valid && c.T != T && same_composition(c, z) && rho > 2*c.rho_max){
+                        return nullptr;
+                    }
+                    const int NTmax = std::max(NT, (c.valid && c.T == T && same_composition(c, z)) ? c.NTmax : 0);
+                    c.valid = false;
+                    const auto B = model->get_dmBnvirdTm_matrix(options.Nvir + 1, NTmax, T, z);
+                    c.C.resize(B.rows(), NTmax + 1);
+                    c.C.col(0) = B.col(0).array();
+                    if (NTmax >= 1){ c.C.col(1) = -T*B.col(1).array(); }
+                    if (NTmax >= 2){ c.C.col(2) = T*T*B.col(2).array() + 2*T*B.col(1).array(); }
+                    c.T = T;
+                    c.z = z;
+                    c.NTmax = NTmax;
+                    c.valid = true;
+                    c.rho_max = 0;
+                    for (auto i = 0; i <= NTmax; ++i){
+                        for (auto j = 0; j < options.Nvir; ++j){
+                            c.rho_max = std::max(c.rho_max, threshold(c, i, j));
+                        }
+                    }
+                    return &c;
+                }
+
+                /// The density at which the first omitted term of \f$\Lambda^{\rm r}_{ij}\f$, \f$\tau^i\partial^i B_{N+1}/\partial\tau^i\,N^{j}_{\downarrow}\rho^N/N\f$, reaches atol
+                double threshold(const Coefficients& c, const int i, const int j) const {
+                    const int N = options.Nvir;
+                    if (i > c.NTmax || j > N - 1){ return 0.0; }
+                    const double E = std::abs(c.C(N - 1, i))/N*falling(N, j);
+                    // A first omitted term that vanishes gives no estimate of the error
+                    if (!(E > 0) || !std::isfinite(E)){ return 0.0; }
+                    return std::pow(options.atol/E, 1.0/N);
+                }
+
+                double sum_series(const Coefficients& c, const int i, const int j, const double rho) const {
+                    double o = 0.0;
+                    for (auto n = std::max(2, j + 1); n <= options.Nvir; ++n){
+                        o += c.C(n - 2, i)/(n - 1)*falling(n - 1, j)*std::pow(rho, n - 1);
+                    }
+                    return o;
+                }
+
+                bool in_range(const int NT, const int ND, const double rho) const {
+                    return NT >= 0 && NT <= NTmax_series && ND >= 0 && ND <= options.Nvir - 1 && rho >= 0 && std::isfinite(rho);
+                }
+
+                /// \f$\Lambda^{\rm r}_{ij}\f$ from the series, if the state is below its threshold
+                std::optional<double> series(const int NT, const int ND, const double T, const double rho, const REArrayd& z) const {
+                    if (!in_range(NT, ND, rho)){ return std::nullopt; }
+                    const auto* c = get_coefficients(NT, T, rho, z);
+                    if (c == nullptr || !(rho < threshold(*c, NT, ND))){ return std::nullopt; }
+                    return sum_series(*c, NT, ND, rho);
+                }
+
+                /// \f$\Lambda^{\rm r}_{0j}\f$ for j from 0 to Nderiv from the series, if the state is below the threshold of all of them
+                std::optional<EArrayd> series0n(const int Nderiv, const double T, const double rho, const REArrayd& z) const {
+                    if (!in_range(0, Nderiv, rho)){ return std::nullopt; }
+                    const auto* c = get_coefficients(0, T, rho, z);
+                    if (c == nullptr || !(rho < threshold(*c, 0, Nderiv))){ return std::nullopt; }
+                    EArrayd o(Nderiv + 1);
+                    for (auto j = 0; j <= Nderiv; ++j){ o[j] = sum_series(*c, 0, j, rho); }
+                    return o;
+                }
+
+                /// The indices of the rows for which f, which stores the value of a row obtained from the series, returns false
+                template<typename F>
+                std::vector<Eigen::Index> fill_rows(const REArrayd& T, const F& f) const {
+                    std::vector<Eigen::Index> rest;
+                    for (auto k = 0; k < T.size(); ++k){
+                        if (!f(k)){ rest.push_back(k); }
+                    }
+                    return rest;
+                }
+
+            public:
+                VirialAdapter(std::unique_ptr<AbstractModel> model, const VirialFastPathOptions& options) : model(std::move(model)), options(options) {};
+
+                double get_threshold(const int NT, const int ND, const double T, const REArrayd& z) const {
+                    if (NT < 0 || NT > NTmax_series || ND < 0 || ND > options.Nvir - 1){ return 0.0; }
+                    const auto* c = get_coefficients(NT, T, 0.0, z);
+                    return threshold(*c, NT, ND);
+                }
+
+                const std::type_index& get_type_index() const override { return model->get_type_index(); }
+                const AbstractModel* get_decorated() const override { return model.get(); }
+
+                double get_R(const REArrayd& x) const override { return model->get_R(x); }
+                double get_Arxy(const int NT, const int ND, const double T, const double rho, const REArrayd& z) const override {
+                    if (auto v = series(NT, ND, T, rho, z)){ return *v; }
+                    return model->get_Arxy(NT, ND, T, rho, z);
+                }
+                #define X(i,j) double get_Ar ## i ## j(const double T, const double rho, const REArrayd& z) const override { \
+                    if (auto v = series(i, j, T, rho, z)){ return *v; } \
+                    return model->get_Ar ## i ## j(T, rho, z); }
+                    ARXY_args
+                #undef X
+                #define X(i) EArrayd get_Ar0 ## i ## n(const double T, const double rho, const REArrayd& z) const override { \
+                    if (auto v = series0n(i, T, rho, z)){ return *v; } \
+                    return model->get_Ar0 ## i ## n(T, rho, z); }
+                    AR0N_args
+                #undef X
+                EArrayd get_Arxy_many(const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const override {
+                    if (T.size() != rho.size() || T.size() != molefrac.rows()){
+                        return model->get_Arxy_many(NT, ND, T, rho, molefrac);
+                    }
+                    EArrayd out(T.size());
+                    Eigen::ArrayXd z;
+                    const auto rest = fill_rows(T, [&](const Eigen::Index k){
+                        z = molefrac.row(k).transpose();
+                        auto v = series(NT, ND, T(k), rho(k), z);
+                        if (v){ out(k) = *v; }
+                        return v.has_value();
+                    });
+                    // The other rows are evaluated in one call to the model
+                    if (!rest.empty()){
+                        const auto Nrest = static_cast<Eigen::Index>(rest.size());
+                        Eigen::ArrayXd Tr(Nrest), rhor(Nrest);
+                        Eigen::ArrayXXd xr(Nrest, molefrac.cols());
+                        for (auto m = 0; m < Nrest; ++m){ Tr(m) = T(rest[m]); rhor(m) = rho(rest[m]); xr.row(m) = molefrac.row(rest[m]).array(); }
+                        const auto vals = model->get_Arxy_many(NT, ND, Tr, rhor, xr.matrix());
+                        for (auto m = 0; m < Nrest; ++m){ out(rest[m]) = vals(m); }
+                    }
+                    return out;
+                }
+                EMatrixd get_Ar0n_many(const int Nderiv, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac) const override {
+                    if (T.size() != rho.size() || T.size() != molefrac.rows()){
+                        return model->get_Ar0n_many(Nderiv, T, rho, molefrac);
+                    }
+                    EMatrixd out(T.size(), Nderiv + 1);
+                    Eigen::ArrayXd z;
+                    const auto rest = fill_rows(T, [&](const Eigen::Index k){
+                        z = molefrac.row(k).transpose();
+                        auto v = series0n(Nderiv, T(k), rho(k), z);
+                        if (v){ out.row(k) = v->matrix().transpose(); }
+                        return v.has_value();
+                    });
+                    if (!rest.empty()){
+                        const auto Nrest = static_cast<Eigen::Index>(rest.size());
+                        Eigen::ArrayXd Tr(Nrest), rhor(Nrest);
+                        Eigen::ArrayXXd xr(Nrest, molefrac.cols());
+                        for (auto m = 0; m < Nrest; ++m){ Tr(m) = T(rest[m]); rhor(m) = rho(rest[m]); xr.row(m) = molefrac.row(rest[m]).array(); }
+                        const auto vals = model->get_Ar0n_many(Nderiv, Tr, rhor, xr.matrix());
+                        for (auto m = 0; m < Nrest; ++m){ out.row(rest[m]) = vals.row(m); }
+                    }
+                    return out;
+                }
+
+                double get_B2vir(const double T, const REArrayd& z) const override { return model->get_B2vir(T, z); }
+                std::map<int, double> get_Bnvir(const int Nderiv, const double T, const REArrayd& z) const override { return model->get_Bnvir(Nderiv, T, z); }
+                double get_B12vir(const double T, const REArrayd& z) const override { return model->get_B12vir(T, z); }
+                double get_dmBnvirdTm(const int Nderiv, const int NTderiv, const double T, const REArrayd& z) const override { return model->get_dmBnvirdTm(Nderiv, NTderiv, T, z); }
+                EMatrixd get_dmBnvirdTm_matrix(const int Nmax, const int NTmax, const double T, const REArrayd& z) const override { return model->get_dmBnvirdTm_matrix(Nmax, NTmax, T, z); }
+
+                #define X(f) double f(const double T, const REArrayd& rhovec) const override { return model->f(T, rhovec); }
+                    ISOCHORIC_double_args
+                #undef X
+                #define X(f) EArrayd f(const double T, const REArrayd& rhovec) const override { return model->f(T, rhovec); }
+                    ISOCHORIC_array_args
+                #undef X
+                #define X(f) EMatrixd f(const double T, const REArrayd& rhovec) const override { return model->f(T, rhovec); }
+                    ISOCHORIC_matrix_args
+                #undef X
+                #define X(f) std::tuple<double, Eigen::ArrayXd, Eigen::MatrixXd> f(const double T, const REArrayd& rhovec) const override { return model->f(T, rhovec); }
+                    ISOCHORIC_multimatrix_args
+                #undef X
+                void build_Psir_fgradHessian_autodiff(const double T, const REArrayd& rhovec, double& Psir, Eigen::ArrayXd& gradient, Eigen::MatrixXd& Hessian) const override {
+                    model->build_Psir_fgradHessian_autodiff(T, rhovec, Psir, gradient, Hessian);
+                }
+                Eigen::ArrayXd get_Psir_sigma_derivs(const double T, const REArrayd& rhovec, const REArrayd& v) const override {
+                    return model->get_Psir_sigma_derivs(T, rhovec, v);
+                }
+
+                std::unique_ptr<AbstractModel> prepare_composition(const REArrayd& z) const override {
+                    return std::make_unique<VirialAdapter>(model->prepare_composition(z), options);
+                }
+
+                EArray33d get_deriv_mat2(const double T, double rho, const REArrayd& z) const override {
+                    // The entries of DerivativeHolderSquare<2>, those with i+j <= 2
+                    if (in_range(2, 2, rho)){
+                        if (const auto* c = get_coefficients(2, T, rho, z)){
+                            double rho_thr = std::numeric_limits<double>::infinity();
+                            for (auto i = 0; i <= 2; ++i){
+                                for (auto j = 0; i + j <= 2; ++j){ rho_thr = std::min(rho_thr, threshold(*c, i, j)); }
+                            }
+                            if (rho < rho_thr){
+                                EArray33d o; o.setZero();
+                                for (auto i = 0; i <= 2; ++i){
+                                    for (auto j = 0; i + j <= 2; ++j){ o(i, j) = sum_series(*c, i, j, rho); }
+                                }
+                                return o;
+                            }
+                        }
+                    }
+                    return model->get_deriv_mat2(T, rho, z);
+                }
+                EMatrixd get_deriv_matN(const int order, const double T, const double rho, const REArrayd& z) const override { return model->get_deriv_matN(order, T, rho, z); }
+
+                double solve_rho_Tp(const double T, const double p, const REArrayd& z, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options) const override {
+                    return model->solve_rho_Tp(T, p, z, phase, options);
+                }
+                EArrayd solve_rho_Tp_many(const REArrayd& T, const REArrayd& p, const REMatrixd& molefrac, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options) const override {
+                    return model->solve_rho_Tp_many(T, p, molefrac, phase, options);
+                }
+            };
+
+            /// The first decorator of the chain of decorators of a model that is a VirialAdapter
+            const VirialAdapter& get_virial_adapter(const AbstractModel& model){
+                for (const AbstractModel* am = &model; am != nullptr; am = am->get_decorated()){
+                    if (const auto* adapter = dynamic_cast<const VirialAdapter*>(am)){
+                        return *adapter;
+                    }
+                }
+                throw teqp::InvalidArgument("The model has no virial fast path; build it with make_virial_model, or with \"virial\": true in the JSON for make_model");
+            }
+        }
+
+        std::unique_ptr<AbstractModel> make_virial_model(std::unique_ptr<AbstractModel> model, const VirialFastPathOptions& options){
+            if (!model){
+                throw teqp::InvalidArgument("The model to be wrapped may not be null");
+            }
+            if (options.Nvir < 2 || options.Nvir > 5){
+                throw teqp::InvalidArgument("Nvir of " + std::to_string(options.Nvir) + " is not in [2, 5]");
+            }
+            if (!(options.atol > 0)){
+                throw teqp::InvalidArgument("atol must be positive");
+            }
+            return std::make_unique<VirialAdapter>(std::move(model), options);
+        }
+
+        double get_virial_threshold(const AbstractModel& model, const int NT, const int ND, const double T, const REArrayd& z){
+            return get_virial_adapter(model).get_threshold(NT, ND, T, z);
+        }
+    }
+}
@@ -3,6 +3,7 @@
 /// *********************************************************************************
 
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
 using namespace emscripten;
 
 #include <optional>
@@ -14,6 +15,7 @@ using namespace emscripten;
 //#include "teqp/algorithms/critical_tracing.hpp"
 #include "teqp/derivs.hpp"
 #include "teqp/algorithms/VLE.hpp"
+#include "teqp/cpp/teqpcpp.hpp"
 
 std::string VLE(const std::string &JSON_model_string, const std::string &JSON_problem_string)
 {
@@ -50,7 +52,82 @@ std::string VLE(const std::string &JSON_model_string, const std::string &JSON_pr
     return "OK";
 }
 
+/**
+ A model of the C++ interface, with batched methods that take and return Float64Array, so that a batch of state points costs one
+ crossing between javascript and WASM rather than one per point.  The arrays are copied in bulk into and out of the WASM memory.
+ The mole fractions are packed by rows: those of point i are molefrac[i*Ncomp], ..., molefrac[i*Ncomp+Ncomp-1].
+ Errors are thrown as javascript Error.
+ */
+class JSModel {
+private:
+    std::unique_ptr<teqp::cppinterface::AbstractModel> model;
+
+    /// One bulk copy of a typed array (or array) of numbers into an Eigen array
+    static Eigen::ArrayXd to_array(const val& a) {
+        Eigen::ArrayXd o(a["length"].as<int>());
+        val(typed_memory_view(o.size(), o.data())).call<void>("set", a);
+        return o;
+    }
+    /// The mole fractions of N points, in the layout of AbstractModel::get_Arxy_many
+    static Eigen::ArrayXXd to_molefrac(const val& a, const Eigen::Index N) {
+        const Eigen::ArrayXd flat = to_array(a);
+        if (N == 0 || flat.size() % N != 0) {
+            throw teqp::InvalidArgument("Length of molefrac (" + std::to_string(flat.size()) + ") is not a multiple of the number of points (" + std::to_string(N) + ")");
+        }
+        return Eigen::Map<const Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(flat.data(), N, flat.size() / N);
+    }
+    /// A new Float64Array with a copy of the values, packed by rows for a matrix
+    template<typename Derived>
+    static val to_js(const Eigen::ArrayBase<Derived>& a) {
+        const Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> packed = a;
+        return val::global("Float64Array").new_(typed_memory_view(packed.size(), packed.data()));
+    }
+    /// Call f, with the C++ exceptions rethrown as javascript Error
+    template<typename Function>
+    static val guarded(const Function& f) {
+        std::string msg;
+        try {
+            return f();
+        }
+        catch (std::exception& e) {
+            msg = e.what();
+        }
+        val::global("Error").new_(msg).throw_();
+    }
+public:
+    explicit JSModel(const std::string& JSON_model_string) {
+        guarded([&]() { model = teqp::cppinterface::make_model(nlohmann::json::parse(JSON_model_string)); return val::undefined(); });
+    }
+    /// \f$\Lambda^{\rm r}_{NT,ND}\f$ at each point, see AbstractModel::get_Arxy_many
+    val get_Arxy_many(int NT, int ND, const val& T, const val& rho, const val& molefrac) const {
+        return guarded([&]() {
+            const auto T_ = to_array(T);
+            return to_js(model->get_Arxy_many(NT, ND, T_, to_array(rho), to_molefrac(molefrac, T_.size())));
+        });
+    }
+    /// \f$\Lambda^{\rm r}_{0,0}\f$ to \f$\Lambda^{\rm r}_{0,N_{\rm deriv}}\f$ at each point, packed by rows, see AbstractModel::get_Ar0n_many
+    val get_Ar0n_many(int Nderiv, const val& T, const val& rho, const val& molefrac) const {
+        return guarded([&]() {
+            const auto T_ = to_array(T);
+            return to_js(model->get_Ar0n_many(Nderiv, T_, to_array(rho), to_molefrac(molefrac, T_.size())));
+        });
+    }
+    /// The stable density at each (T, p), see AbstractModel::solve_rho_Tp_many
+    val solve_rho_Tp_many(const val& T, const val& p, const val& molefrac) const {
+        return guarded([&]() {
+            const auto T_ = to_array(T);
+            return to_js(model->solve_rho_Tp_many(T_, to_array(p), to_molefrac(molefrac, T_.size())));
+        });
+    }
+};
+
 // Main binding code
 EMSCRIPTEN_BINDINGS(teqp) {
     function("isotherm", &VLE);
+
+    class_<JSModel>("Model")
+        .constructor<std::string>()
+        .function("get_Arxy_many", &JSModel::get_Arxy_many)
+        .function("get_Ar0n_many", &JSModel::get_Ar0n_many)
+        .function("solve_rho_Tp_many", &JSModel::solve_rho_Tp_many);
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <pybind11/stl.h>
 #include <pybind11/eigen.h>
 
+#include <algorithm>
+
 #include "teqpversion.hpp"
 #include "teqp/ideal_eosterms.hpp"
 #include "teqp/cpp/derivs.hpp"
@@ -25,7 +27,8 @@ void add_multifluid(py::module& m){
     // A single ancillary curve
     py::class_<VLEAncillary>(m, "VLEAncillary")
         .def(py::init<const nlohmann::json&>())
-        .def("__call__", &VLEAncillary::operator())
+        .def("__call__", py::overload_cast<double>(&VLEAncillary::operator(), py::const_))
+        .def("__call__", py::overload_cast<const Eigen::ArrayXd&>(&VLEAncillary::operator(), py::const_))
         .def_readonly("T_r", &VLEAncillary::T_r)
         .def_readonly("Tmax", &VLEAncillary::Tmax)
         .def_readonly("Tmin", &VLEAncillary::Tmin)
@@ -38,6 +41,11 @@ void add_multifluid(py::module& m){
         .def_readonly("rhoV", &MultiFluidVLEAncillaries::rhoV)
         .def_readonly("pL", &MultiFluidVLEAncillaries::pL)
         .def_readonly("pV", &MultiFluidVLEAncillaries::pV)
+        .def("eval_many", [](const MultiFluidVLEAncillaries& anc, const Eigen::ArrayXd& T){
+            Eigen::ArrayXd rhoL(T.size()), rhoV(T.size()), p(T.size());
+            anc.eval_many(T, rhoL, rhoV, p);
+            return std::make_tuple(rhoL, rhoV, p);
+        }, py::arg("T"))
         ;
 
     // Expose some additional functions for working with the JSON data structures and resolving aliases
@@ -215,9 +223,36 @@ void attach_model_specific_methods(py::object& obj){
     }
 };
 
+/**
+ Call one of the batched methods of AbstractModel with the GIL released, broadcasting the arguments to a common number of states:
+ the two arrays of state variables may be of length one, and molefrac may be a single row. Arguments that already have the same
+ number of states are passed through without a copy; other mismatches are left for the batched method to reject.
+ */
+template<typename Function>
+auto call_many_broadcast(const REArrayd& x, const REArrayd& y, const REMatrixd& molefrac, const Function& f){
+    py::gil_scoped_release release;
+    const Eigen::Index N = std::max({x.size(), y.size(), molefrac.rows()});
+    if (x.size() == N && y.size() == N && molefrac.rows() == N){
+        return f(x, y, molefrac);
+    }
+    auto expand = [N](const REArrayd& v) -> EArrayd { if (v.size() == 1){ return EArrayd::Constant(N, v(0)); } return v; };
+    const EMatrixd z = (molefrac.rows() == 1) ? EMatrixd(molefrac.replicate(N, 1)) : EMatrixd(molefrac);
+    return f(expand(x), expand(y), z);
+}
+
 /// Instantiate "instances" of models (really wrapped Python versions of the models), and then attach all derivative methods
 void init_teqp(py::module& m) {
 
+    // The options of the predictor-corrector continuation of the tracers
+    py::class_<PredictorCorrectorOptions>(m, "PredictorCorrectorOptions")
+        .def(py::init<>())
+        .def_readwrite("tol", &PredictorCorrectorOptions::tol)
+        .def_readwrite("max_contraction", &PredictorCorrectorOptions::max_contraction)
+        .def_readwrite("min_ds", &PredictorCorrectorOptions::min_ds)
+        .def_readwrite("max_corrector", &PredictorCorrectorOptions::max_corrector)
+        .def_readwrite("target_corrector", &PredictorCorrectorOptions::target_corrector)
+        ;
+
     // The options class for critical tracer, not tied to a particular model
     py::class_<TCABOptions>(m, "TCABOptions")
         .def(py::init<>())
@@ -239,6 +274,11 @@ void init_teqp(py::module& m) {
         .def_readwrite("polish_reltol_T", &TCABOptions::polish_reltol_T)
         .def_readwrite("pure_endpoint_polish", &TCABOptions::pure_endpoint_polish)
         .def_readwrite("polish_exception_on_fail", &TCABOptions::polish_exception_on_fail)
+        .def_readwrite("telemetry", &TCABOptions::telemetry)
+        .def_readwrite("checkpoint", &TCABOptions::checkpoint)
+        .def_readwrite("predictor_corrector", &TCABOptions::predictor_corrector)
+        .def_property("resume", [](const TCABOptions& o) -> nlohmann::json { return o.resume ? o.resume->to_json() : nlohmann::json(); },
+            [](TCABOptions& o, const nlohmann::json& j) { if (j.is_null()) { o.resume.reset(); } else { o.resume = TraceCheckpoint::from_json(j); } })
         ;
 
     // The options class for isotherm tracer, not tied to a particular model
@@ -254,8 +294,14 @@ void init_teqp(py::module& m) {
         .def_readwrite("max_steps", &TVLEOptions::max_steps)
         .def_readwrite("integration_order", &TVLEOptions::integration_order)
         .def_readwrite("polish", &TVLEOptions::polish)
+        .def_readwrite("xdirection", &TVLEOptions::xdirection)
         .def_readwrite("calc_criticality", &TVLEOptions::calc_criticality)
         .def_readwrite("terminate_unstable", &TVLEOptions::terminate_unstable)
+        .def_readwrite("telemetry", &TVLEOptions::telemetry)
+        .def_readwrite("checkpoint", &TVLEOptions::checkpoint)
+        .def_readwrite("predictor_corrector", &TVLEOptions::predictor_corrector)
+        .def_property("resume", [](const TVLEOptions& o) -> nlohmann::json { return o.resume ? o.resume->to_json() : nlohmann::json(); },
+            [](TVLEOptions& o, const nlohmann::json& j) { if (j.is_null()) { o.resume.reset(); } else { o.resume = TraceCheckpoint::from_json(j); } })
         ;
 
     // The options class for isobar tracer, not tied to a particular model
@@ -269,8 +315,32 @@ void init_teqp(py::module& m) {
         .def_readwrite("max_steps", &PVLEOptions::max_steps)
         .def_readwrite("integration_order", &PVLEOptions::integration_order)
         .def_readwrite("polish", &PVLEOptions::polish)
+        .def_readwrite("xdirection", &PVLEOptions::xdirection)
         .def_readwrite("calc_criticality", &PVLEOptions::calc_criticality)
         .def_readwrite("terminate_unstable", &PVLEOptions::terminate_unstable)
+        .def_readwrite("telemetry", &PVLEOptions::telemetry)
+        .def_readwrite("checkpoint", &PVLEOptions::checkpoint)
+        .def_readwrite("predictor_corrector", &PVLEOptions::predictor_corrector)
+        .def_property("resume", [](const PVLEOptions& o) -> nlohmann::json { return o.resume ? o.resume->to_json() : nlohmann::json(); },
+            [](PVLEOptions& o, const nlohmann::json& j) { if (j.is_null()) { o.resume.reset(); } else { o.resume = TraceCheckpoint::from_json(j); } })
+        ;
+
+    // The options class for the phase envelope tracer, not tied to a particular model
+    py::class_<PhaseEnvelopeOptions>(m, "PhaseEnvelopeOptions")
+        .def(py::init<>())
+        .def_readwrite("init_ds", &PhaseEnvelopeOptions::init_ds)
+        .def_readwrite("max_ds", &PhaseEnvelopeOptions::max_ds)
+        .def_readwrite("min_ds", &PhaseEnvelopeOptions::min_ds)
+        .def_readwrite("newton_tol", &PhaseEnvelopeOptions::newton_tol)
+        .def_readwrite("crit_lnK", &PhaseEnvelopeOptions::crit_lnK)
+        .def_readwrite("p_min", &PhaseEnvelopeOptions::p_min)
+        .def_readwrite("p_max", &PhaseEnvelopeOptions::p_max)
+        .def_readwrite("T_min", &PhaseEnvelopeOptions::T_min)
+        .def_readwrite("T_max", &PhaseEnvelopeOptions::T_max)
+        .def_readwrite("max_steps", &PhaseEnvelopeOptions::max_steps)
+        .def_readwrite("max_newton", &PhaseEnvelopeOptions::max_newton)
+        .def_readwrite("target_newton", &PhaseEnvelopeOptions::target_newton)
+        .def_readwrite("telemetry", &PhaseEnvelopeOptions::telemetry)
         ;
 
     // The options class for the finder of VLLE solutions from VLE tracing, not tied to a particular model
@@ -287,6 +357,8 @@ void init_teqp(py::module& m) {
         .def_readwrite("axtol", &MixVLETpFlags::axtol)
         .def_readwrite("relxtol", &MixVLETpFlags::relxtol)
         .def_readwrite("maxiter", &MixVLETpFlags::maxiter)
+        .def_readwrite("broyden", &MixVLETpFlags::broyden)
+        .def_readwrite("broyden_stall_ratio", &MixVLETpFlags::broyden_stall_ratio)
         ;
 
     py::class_<MixVLEpxFlags>(m, "MixVLEpxFlags")
@@ -296,6 +368,21 @@ void init_teqp(py::module& m) {
         .def_readwrite("axtol", &MixVLEpxFlags::axtol)
         .def_readwrite("relxtol", &MixVLEpxFlags::relxtol)
         .def_readwrite("maxiter", &MixVLEpxFlags::maxiter)
+        .def_readwrite("broyden", &MixVLEpxFlags::broyden)
+        .def_readwrite("broyden_stall_ratio", &MixVLEpxFlags::broyden_stall_ratio)
+        ;
+    
+    py::enum_<density::RhoPhase>(m, "RhoPhase")
+        .value("liquid", density::RhoPhase::liquid)
+        .value("vapor", density::RhoPhase::vapor)
+        .value("stable", density::RhoPhase::stable)
+        ;
+
+    py::class_<density::RhoTpOptions>(m, "RhoTpOptions")
+        .def(py::init<>())
+        .def_readwrite("maxiter", &density::RhoTpOptions::maxiter)
+        .def_readwrite("reltol", &density::RhoTpOptions::reltol)
+        .def_readwrite("rho_guess", &density::RhoTpOptions::rho_guess)
         ;
     
     using namespace teqp::cppinterface;
@@ -316,6 +403,19 @@ void init_teqp(py::module& m) {
         .value("notfinite_step", VLE_return_code::notfinite_step)
         ;
 
+    py::class_<SolverTelemetry>(m, "SolverTelemetry")
+        .def(py::init<>())
+        .def_readonly("num_iter", &SolverTelemetry::num_iter)
+        .def_readonly("num_Hessian", &SolverTelemetry::num_Hessian)
+        .def_readonly("num_rhs", &SolverTelemetry::num_rhs)
+        .def_readonly("num_residual", &SolverTelemetry::num_residual)
+        .def_readonly("num_rejected", &SolverTelemetry::num_rejected)
+        .def_readonly("num_polish", &SolverTelemetry::num_polish)
+        .def_readonly("num_polish_failed", &SolverTelemetry::num_polish_failed)
+        .def_readonly("num_escalated", &SolverTelemetry::num_escalated)
+        .def_readonly("elapsed_s", &SolverTelemetry::elapsed_s)
+        ;
+
     py::class_<MixVLEReturn>(m, "MixVLEReturn")
         .def(py::init<>())
         .def_readonly("success", &MixVLEReturn::success)
@@ -328,6 +428,34 @@ void init_teqp(py::module& m) {
         .def_readonly("num_fev", &MixVLEReturn::num_fev)
         .def_readonly("r", &MixVLEReturn::r)
         .def_readonly("initial_r", &MixVLEReturn::initial_r)
+        .def_readonly("telemetry", &MixVLEReturn::telemetry)
+        ;
+    
+    py::enum_<properties::Mask>(m, "Property", py::arithmetic())
+        .value("p", properties::p)
+        .value("h", properties::h)
+        .value("s", properties::s)
+        .value("u", properties::u)
+        .value("cv", properties::cv)
+        .value("cp", properties::cp)
+        .value("M_w2", properties::M_w2)
+        .value("JT", properties::JT)
+        .value("neff", properties::neff)
+        .value("all", properties::all)
+        ;
+    
+    py::class_<PropertyBundle>(m, "PropertyBundle")
+        .def(py::init<>())
+        .def_readonly("mask", &PropertyBundle::mask)
+        .def_readonly("p", &PropertyBundle::p)
+        .def_readonly("h", &PropertyBundle::h)
+        .def_readonly("s", &PropertyBundle::s)
+        .def_readonly("u", &PropertyBundle::u)
+        .def_readonly("cv", &PropertyBundle::cv)
+        .def_readonly("cp", &PropertyBundle::cp)
+        .def_readonly("M_w2", &PropertyBundle::M_w2)
+        .def_readonly("JT", &PropertyBundle::JT)
+        .def_readonly("neff", &PropertyBundle::neff)
         ;
     
     using namespace teqp::PCSAFT;
@@ -353,10 +481,14 @@ void init_teqp(py::module& m) {
     py::class_<AbstractModel, std::unique_ptr<AbstractModel>>(m, "AbstractModel", py::dynamic_attr())
     
         .def("get_R", &am::get_R, "molefrac"_a.noconvert())
+        .def("serialize", [](const am& model){ const auto bytes = model.serialize(); return py::bytes(reinterpret_cast<const char*>(bytes.data()), bytes.size()); })
+        .def("get_profile", [](const am& model){ return get_profile(model); })
+        .def("reset_profile", [](const am& model){ reset_profile(model); })
     
         .def("get_B2vir", &am::get_B2vir, "T"_a, "molefrac"_a.noconvert())
         .def("get_Bnvir", &am::get_Bnvir, "Nderiv"_a, "T"_a, "molefrac"_a.noconvert())
         .def("get_dmBnvirdTm", &am::get_dmBnvirdTm, "Nderiv"_a, "NTderiv"_a, "T"_a, "molefrac"_a.noconvert())
+        .def("get_dmBnvirdTm_matrix", &am::get_dmBnvirdTm_matrix, "Nmax"_a, "NTmax"_a, "T"_a, "molefrac"_a.noconvert())
         .def("get_B12vir", &am::get_B12vir, "T"_a, "molefrac"_a.noconvert())
     
         .def("get_Arxy", &am::get_Arxy, "NT"_a, "ND"_a, "T"_a, "rho"_a, "molefrac"_a.noconvert())
@@ -368,7 +500,15 @@ void init_teqp(py::module& m) {
         #define X(i) .def(stringify(get_Ar0 ## i ## n), &am::get_Ar0 ## i ## n, "T"_a, "rho"_a, "molefrac"_a.noconvert())
             AR0N_args
         #undef X
+        // The batched methods take NumPy arrays, broadcast them, and release the GIL while they loop over the states
+        .def("get_Arxy_many", [](const am& model, const int NT, const int ND, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac){
+            return call_many_broadcast(T, rho, molefrac, [&](const auto& T_, const auto& rho_, const auto& z_){ return model.get_Arxy_many(NT, ND, T_, rho_, z_); });
+        }, "NT"_a, "ND"_a, "T"_a.noconvert(), "rho"_a.noconvert(), "molefrac"_a)
+        .def("get_Ar0n_many", [](const am& model, const int Nderiv, const REArrayd& T, const REArrayd& rho, const REMatrixd& molefrac){
+            return call_many_broadcast(T, rho, molefrac, [&](const auto& T_, const auto& rho_, const auto& z_){ return model.get_Ar0n_many(Nderiv, T_, rho_, z_); });
+        }, "Nderiv"_a, "T"_a.noconvert(), "rho"_a.noconvert(), "molefrac"_a)
         .def("get_neff", &am::get_neff, "T"_a, "rho"_a, "molefrac"_a.noconvert())
+        .def("get_property_bundle", &am::get_property_bundle, "T"_a, "rho"_a, "molefrac"_a.noconvert(), "mask"_a = std::uint32_t(properties::all), py::arg_v("aig", nullptr, "None"))
     
         // Methods that come from the isochoric derivatives formalism
         .def("get_pr", &am::get_pr, "T"_a, "rhovec"_a.noconvert())
@@ -383,6 +523,12 @@ void init_teqp(py::module& m) {
         .def("get_partial_molar_volumes", &am::get_partial_molar_volumes, "T"_a, "rhovec"_a.noconvert())
     
         .def("get_deriv_mat2", &am::get_deriv_mat2, "T"_a, "rho"_a, "molefrac"_a.noconvert())
+        .def("prepare_composition", &am::prepare_composition, "z"_a.noconvert(), py::keep_alive<0, 1>())
+        .def("get_deriv_matN", &am::get_deriv_matN, "order"_a, "T"_a, "rho"_a, "molefrac"_a.noconvert())
+        .def("solve_rho_Tp", &am::solve_rho_Tp, "T"_a, "p"_a, "molefrac"_a.noconvert(), "phase"_a = density::RhoPhase::stable, py::arg_v("options", std::nullopt, "None"))
+        .def("solve_rho_Tp_many", [](const am& model, const REArrayd& T, const REArrayd& p, const REMatrixd& molefrac, const density::RhoPhase phase, const std::optional<density::RhoTpOptions>& options){
+            return call_many_broadcast(T, p, molefrac, [&](const auto& T_, const auto& p_, const auto& z_){ return model.solve_rho_Tp_many(T_, p_, z_, phase, options); });
+        }, "T"_a.noconvert(), "p"_a.noconvert(), "molefrac"_a, "phase"_a = density::RhoPhase::stable, py::arg_v("options", std::nullopt, "None"))
     
         // Routines related to pure fluid critical point calculation
         .def("get_pure_critical_conditions_Jacobian", &am::get_pure_critical_conditions_Jacobian, "T"_a, "rho"_a, py::arg_v("alternative_pure_index", std::nullopt, "None"), py::arg_v("alternative_length", std::nullopt, "None"))
@@ -390,7 +536,7 @@ void init_teqp(py::module& m) {
         .def("extrapolate_from_critical", &am::extrapolate_from_critical, "Tc"_a, "rhoc"_a, "T"_a)
     
         // Routines related to binary mixture critical curve tracing
-        .def("trace_critical_arclength_binary", &am::trace_critical_arclength_binary, "T0"_a, "rhovec0"_a, py::arg_v("path", std::nullopt, "None"), py::arg_v("options", std::nullopt, "None"))
+        .def("trace_critical_arclength_binary", &am::trace_critical_arclength_binary, "T0"_a, "rhovec0"_a, py::arg_v("path", std::nullopt, "None"), py::arg_v("options", std::nullopt, "None"), py::call_guard<py::gil_scoped_release>())
         .def("get_criticality_conditions", &am::get_criticality_conditions, "T"_a, "rhovec"_a.noconvert())
         .def("eigen_problem", &am::eigen_problem, "T"_a, "rhovec"_a, py::arg_v("alignment_v0", std::nullopt, "None"))
         .def("get_minimum_eigenvalue_Psi_Hessian", &am::get_minimum_eigenvalue_Psi_Hessian, "T"_a, "rhovec"_a.noconvert())
@@ -404,17 +550,20 @@ void init_teqp(py::module& m) {
         .def("get_drhovecdT_psat", &am::get_drhovecdT_psat, "T"_a, "rhovecL"_a.noconvert(), "rhovecV"_a.noconvert())
         .def("get_dpsat_dTsat_isopleth", &am::get_dpsat_dTsat_isopleth, "T"_a, "rhovecL"_a.noconvert(), "rhovecV"_a.noconvert())
     
-        .def("trace_VLE_isotherm_binary", &am::trace_VLE_isotherm_binary, "T"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"))
-        .def("trace_VLE_isobar_binary", &am::trace_VLE_isobar_binary, "p"_a, "T0"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"))
-        .def("mix_VLE_Tx", &am::mix_VLE_Tx, "T"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), "xspec"_a.noconvert(), "atol"_a, "reltol"_a, "axtol"_a, "relxtol"_a, "maxiter"_a)
-        .def("mix_VLE_Tp", &am::mix_VLE_Tp, "T"_a, "p_given"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"))
-        .def("mixture_VLE_px", &am::mixture_VLE_px, "p_spec"_a, "xmolar_spec"_a.noconvert(), "T0"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"))
+        // The tracers and mixture solvers can run for a long time, so they release the GIL and other Python threads can run
+        .def("trace_VLE_isotherm_binary", &am::trace_VLE_isotherm_binary, "T"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"), py::call_guard<py::gil_scoped_release>())
+        .def("trace_VLE_isobar_binary", &am::trace_VLE_isobar_binary, "p"_a, "T0"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"), py::call_guard<py::gil_scoped_release>())
+        .def("trace_phase_envelope", &am::trace_phase_envelope, "T0"_a, "rhovecB0"_a.noconvert(), "rhovecI0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"), py::call_guard<py::gil_scoped_release>())
+        .def("mix_VLE_Tx", &am::mix_VLE_Tx, "T"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), "xspec"_a.noconvert(), "atol"_a, "reltol"_a, "axtol"_a, "relxtol"_a, "maxiter"_a, "telemetry"_a = nullptr)
+        .def("mix_VLE_Tp", &am::mix_VLE_Tp, "T"_a, "p_given"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"), py::call_guard<py::gil_scoped_release>())
+        .def("mixture_VLE_px", &am::mixture_VLE_px, "p_spec"_a, "xmolar_spec"_a.noconvert(), "T0"_a, "rhovecL0"_a.noconvert(), "rhovecV0"_a.noconvert(), py::arg_v("options", std::nullopt, "None"), "telemetry"_a = nullptr, py::call_guard<py::gil_scoped_release>())
     
-        .def("mix_VLLE_T", &am::mix_VLLE_T, "T"_a, "rhovecVinit"_a.noconvert(), "rhovecL1init"_a.noconvert(), "rhovecL2init"_a.noconvert(), "atol"_a, "reltol"_a, "axtol"_a, "relxtol"_a, "maxiter"_a)
-        .def("find_VLLE_T_binary", &am::find_VLLE_T_binary, "traces"_a, py::arg_v("options", std::nullopt, "None"))
+        .def("mix_VLLE_T", &am::mix_VLLE_T, "T"_a, "rhovecVinit"_a.noconvert(), "rhovecL1init"_a.noconvert(), "rhovecL2init"_a.noconvert(), "atol"_a, "reltol"_a, "axtol"_a, "relxtol"_a, "maxiter"_a, "telemetry"_a = nullptr, py::call_guard<py::gil_scoped_release>())
+        .def("find_VLLE_T_binary", &am::find_VLLE_T_binary, "traces"_a, py::arg_v("options", std::nullopt, "None"), py::call_guard<py::gil_scoped_release>())
     ;
     
     m.def("_make_model", &teqp::cppinterface::make_model);
+    m.def("_deserialize_model", [](const py::bytes& snapshot){ const std::string s = snapshot; return teqp::cppinterface::deserialize_model(std::vector<std::uint8_t>(s.begin(), s.end())); }, "snapshot"_a);
     m.def("attach_model_specific_methods", &attach_model_specific_methods);
     
     using namespace teqp::iteration;
@@ -429,6 +578,25 @@ void init_teqp(py::module& m) {
         .def("get_rho", &NRIterator::get_rho)
         ;
     
+    py::class_<NRIteratorMany> nrmany(m, "NRIteratorMany");
+    py::enum_<NRIteratorMany::status_t>(nrmany, "status_t")
+        .value("active", NRIteratorMany::status_t::active)
+        .value("converged", NRIteratorMany::status_t::converged)
+        .value("failed", NRIteratorMany::status_t::failed)
+        ;
+    nrmany
+        .def(py::init<const std::shared_ptr<AbstractModel> &, const std::shared_ptr<AbstractModel> &, const std::vector<char>&, const Eigen::Ref<const Eigen::ArrayXXd>&, const Eigen::Ref<const Eigen::ArrayXd>&, const Eigen::Ref<const Eigen::ArrayXd>&, const Eigen::Ref<const Eigen::ArrayXd>&>())
+        .def("take_step", &NRIteratorMany::take_step, "reltol"_a = 1e-13)
+        .def("take_steps", &NRIteratorMany::take_steps, "maxsteps"_a, "reltol"_a = 1e-13)
+        .def("get_vars", &NRIteratorMany::get_vars)
+        .def("get_vals", &NRIteratorMany::get_vals)
+        .def("get_molefrac", &NRIteratorMany::get_molefrac)
+        .def("get_T", &NRIteratorMany::get_T)
+        .def("get_rho", &NRIteratorMany::get_rho)
+        .def("get_status", &NRIteratorMany::get_status)
+        .def("get_num_active", &NRIteratorMany::get_num_active)
+        ;
+    
 //    // Some functions for timing overhead of interface
 //    m.def("___mysummer", [](const double &c, const Eigen::ArrayXd &x) { return c*x.sum(); });
 //    using RAX = Eigen::Ref<const Eigen::ArrayXd>;
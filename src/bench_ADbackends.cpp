@@ -0,0 +1,279 @@
+/*
+Comparison of the backends for the derivatives of the residual Helmholtz energy: autodiff, multicomplex, complex step and,
+for the multifluid model, the closed-form derivatives of the EOS terms.  For each model, number of components, derivative
+and backend, the time per call and the largest relative error over a set of states are written to ADbackends_timings.json
+
+The reference values for the vdW, PR and PC-SAFT models are central finite differences of alphar evaluated with 50 digits of
+working precision; the steps are small enough that the references are good to at least 1e-18, well beyond the precision of
+the double-precision backends.  For the multifluid model the closed-form derivatives are the reference, so the errors of
+the analytic backend are zero by construction.
+
+Usage: bench_ADbackends [path to the fluid library, default ../mycp]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <valarray>
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#include "teqp/models/multifluid.hpp"
+#include "teqp/models/vdW.hpp"
+#include "teqp/models/cubics.hpp"
+#include "teqp/models/pcsaft.hpp"
+#include "teqp/derivs.hpp"
+
+using namespace teqp;
+using my_float = boost::multiprecision::cpp_bin_float_50;
+
+constexpr int Nrepeat = 100;
+
+/// A state point at which the derivatives are evaluated
+struct State {
+    double T, rho;
+};
+
+/// The time per call in microseconds (the median of Nrepeat passes over the states) and the values at the states
+template<typename Function>
+auto time_calls(const Function& f, const std::vector<State>& states) {
+    std::vector<double> times;
+    std::vector<Eigen::ArrayXd> values;
+    for (auto repeat = 0; repeat < Nrepeat; ++repeat) {
+        std::vector<Eigen::ArrayXd> vals;
+        auto tic = std::chrono::high_resolution_clock::now();
+        for (const auto& state : states) {
+            vals.emplace_back(f(state));
+        }
+        auto toc = std::chrono::high_resolution_clock::now();
+        times.push_back(std::chrono::duration<double>(toc - tic).count() / states.size() * 1e6);
+        values = std::move(vals);
+    }
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return std::make_tuple(times[times.size() / 2], values);
+}
+
+/// The nth derivative of f at x by a central difference with step h
+template<int n, typename Function>
+my_float central_difference(const Function& f, const my_float& x, const my_float& h) {
+    static_assert(n >= 1 && n <= 3, "Only up to third derivatives are implemented");
+    if constexpr (n == 1) {
+        return (f(x + h) - f(x - h)) / (2 * h);
+    }
+    else if constexpr (n == 2) {
+        return (f(x + h) - 2 * f(x) + f(x - h)) / (h * h);
+    }
+    else {
+        return (f(x + 2 * h) - 2 * f(x + h) + 2 * f(x - h) - f(x - 2 * h)) / (2 * h * h * h);
+    }
+}
+
+/// The reference value of \f$\Lambda^{\rm r}_{iT,iD}\f$ from central differences in \f$1/T\f$ and \f$\rho\f$ in extended precision
+template<int iT, int iD, typename Model>
+my_float reference_Arxy(const Model& model, const State& state, const Eigen::ArrayXd& z) {
+    const Eigen::ArrayX<my_float> zmp = z.cast<my_float>();
+    const my_float tau = 1 / my_float(state.T), rho = state.rho;
+    // The truncation errors are of order h^2 and the rounding errors of order 1e-50/h^(iT+iD)
+    const my_float rel = (iT + iD > 2) ? my_float("1e-10") : my_float("1e-12");
+    auto alphar = [&](const my_float& tau_, const my_float& rho_) { return my_float(model.alphar(1 / tau_, rho_, zmp)); };
+    if constexpr (iT == 0) {
+        auto f = [&](const my_float& rho_) { return alphar(tau, rho_); };
+        return pow(rho, iD) * central_difference<iD>(f, rho, rel * rho);
+    }
+    else if constexpr (iD == 0) {
+        auto f = [&](const my_float& tau_) { return alphar(tau_, rho); };
+        return pow(tau, iT) * central_difference<iT>(f, tau, rel * tau);
+    }
+    else {
+        static_assert(iT == 1 && iD == 1, "Only the mixed derivative Ar11 is implemented");
+        const my_float htau = rel * tau, hrho = rel * rho;
+        auto d = alphar(tau + htau, rho + hrho) - alphar(tau + htau, rho - hrho) - alphar(tau - htau, rho + hrho) + alphar(tau - htau, rho - hrho);
+        return tau * rho * d / (4 * htau * hrho);
+    }
+}
+
+/// The reference value of the gradient of \f$\Psi^{\rm r}\f$ from central differences in the molar concentrations in extended precision
+template<typename Model>
+Eigen::ArrayX<my_float> reference_Psir_gradient(const Model& model, const State& state, const Eigen::ArrayXd& z) {
+    const my_float T = state.T;
+    const my_float R = model.R(z);
+    auto Psir = [&](const Eigen::ArrayX<my_float>& rhovec) {
+        my_float rhotot = rhovec.sum();
+        Eigen::ArrayX<my_float> molefrac = rhovec / rhotot;
+        return my_float(model.alphar(T, rhotot, molefrac) * R * T * rhotot);
+    };
+    const Eigen::ArrayX<my_float> rhovec = (state.rho * z).cast<my_float>().eval();
+    Eigen::ArrayX<my_float> out(z.size());
+    for (auto i = 0; i < z.size(); ++i) {
+        auto f = [&](const my_float& rhoi) { auto r = rhovec; r[i] = rhoi; return Psir(r); };
+        out[i] = central_difference<1>(f, rhovec[i], my_float("1e-12") * rhovec[i]);
+    }
+    return out;
+}
+
+/// The largest relative error of the values over the states
+double max_relative_error(const std::vector<Eigen::ArrayXd>& values, const std::vector<Eigen::ArrayX<my_float>>& references) {
+    double err = 0;
+    for (auto i = 0U; i < values.size(); ++i) {
+        for (auto j = 0; j < values[i].size(); ++j) {
+            const my_float& ref = references[i][j];
+            err = std::max(err, static_cast<double>(abs((my_float(values[i][j]) - ref) / ref)));
+        }
+    }
+    return err;
+}
+
+template<ADBackends be>
+std::string backend_name() {
+    if constexpr (be == ADBackends::autodiff) { return "autodiff"; }
+#if defined(TEQP_MULTICOMPLEX_ENABLED)
+    else if constexpr (be == ADBackends::multicomplex) { return "multicomplex"; }
+#endif
+    else if constexpr (be == ADBackends::complex_step) { return "complex_step"; }
+    else { return "analytic"; }
+}
+
+/**
+ The sweep over the derivatives and backends of one model; the reference for the model is either the extended precision
+ finite differences or, if the model has them, the closed-form derivatives
+ */
+template<typename Model>
+class BackendSweep {
+private:
+    const Model& model;
+    const std::string modelname, reference;
+    const Eigen::ArrayXd z;
+    const std::vector<State>& states;
+    nlohmann::json& outputs;
+    using tdx = TDXDerivatives<Model, double, Eigen::ArrayXd>;
+    using id = IsochoricDerivatives<Model, double, Eigen::ArrayXd>;
+
+    void add(const std::string& derivative, const std::string& backend, double us_per_call, std::optional<double> err) {
+        outputs.push_back({
+            {"model", modelname}, {"Ncomp", z.size()}, {"derivative", derivative}, {"backend", backend},
+            {"time / us", us_per_call}, {"max rel. error", err ? nlohmann::json(err.value()) : nlohmann::json()}, {"reference", reference}
+        });
+        std::cout << modelname << " N=" << z.size() << " " << derivative << " " << backend << ": " << us_per_call << " us/call, max rel. error " << (err ? std::to_string(err.value()) : "n/a") << std::endl;
+    }
+
+    template<int iT, int iD, ADBackends be>
+    void one_Arxy(const std::string& derivative, const std::vector<Eigen::ArrayX<my_float>>& references) {
+        auto [us, values] = time_calls([&](const State& s) { return (Eigen::ArrayXd(1) << tdx::template get_Arxy<iT, iD, be>(model, s.T, s.rho, z)).finished(); }, states);
+        add(derivative, backend_name<be>(), us, max_relative_error(values, references));
+    }
+
+    template<ADBackends be>
+    void one_gradient(const std::vector<Eigen::ArrayX<my_float>>& references) {
+        auto [us, values] = time_calls([&](const State& s) { return id::template build_Psir_gradient<be>(model, s.T, (s.rho * z).eval()).eval(); }, states);
+        add("gradient of Psir", backend_name<be>(), us, references.empty() ? std::nullopt : std::optional<double>(max_relative_error(values, references)));
+    }
+
+public:
+    BackendSweep(const Model& model, const std::string& modelname, const Eigen::ArrayXd& z, const std::vector<State>& states, nlohmann::json& outputs)
+    : model(model), modelname(modelname), reference(has_analytic_Arxy<Model>::value ? "analytic" : "finite differences in 50 digits"), z(z), states(states), outputs(outputs) {};
+
+    template<int iT, int iD>
+    void Arxy() {
+        const std::string derivative = "Ar" + std::to_string(iT) + std::to_string(iD);
+        std::vector<Eigen::ArrayX<my_float>> references;
+        for (const auto& s : states) {
+            Eigen::ArrayX<my_float> ref(1);
+            if constexpr (has_analytic_Arxy<Model>::value) {
+                ref[0] = tdx::template get_Arxy<iT, iD, ADBackends::analytic>(model, s.T, s.rho, z);
+            }
+            else {
+                ref[0] = reference_Arxy<iT, iD>(model, s, z);
+            }
+            references.push_back(ref);
+        }
+        one_Arxy<iT, iD, ADBackends::autodiff>(derivative, references);
+#if defined(TEQP_MULTICOMPLEX_ENABLED)
+        one_Arxy<iT, iD, ADBackends::multicomplex>(derivative, references);
+#endif
+        if constexpr (iT + iD == 1) {
+            // Only first derivatives are available by complex step
+            one_Arxy<iT, iD, ADBackends::complex_step>(derivative, references);
+        }
+        if constexpr (has_analytic_Arxy<Model>::value) {
+            one_Arxy<iT, iD, ADBackends::analytic>(derivative, references);
+        }
+    }
+
+    void Psir_gradient() {
+        // The multifluid model cannot be evaluated in extended precision and has no closed-form gradient, so its errors are not given
+        std::vector<Eigen::ArrayX<my_float>> references;
+        if constexpr (!has_analytic_Arxy<Model>::value) {
+            for (const auto& s : states) {
+                references.push_back(reference_Psir_gradient(model, s, z));
+            }
+        }
+        one_gradient<ADBackends::autodiff>(references);
+#if defined(TEQP_MULTICOMPLEX_ENABLED)
+        one_gradient<ADBackends::multicomplex>(references);
+#endif
+        one_gradient<ADBackends::complex_step>(references);
+    }
+
+    void all() {
+        Arxy<0, 1>(); Arxy<0, 2>(); Arxy<0, 3>();
+        Arxy<1, 0>(); Arxy<2, 0>(); Arxy<1, 1>();
+        Psir_gradient();
+    }
+};
+
+template<typename Model>
+void sweep(const Model& model, const std::string& modelname, const Eigen::ArrayXd& z, const std::vector<State>& states, nlohmann::json& outputs) {
+    BackendSweep<Model>(model, modelname, z, states, outputs).all();
+}
+
+int main(int argc, char** argv)
+{
+    const std::string root = (argc > 1) ? argv[1] : "../mycp";
+
+    // A small set of states in the single-phase gas and liquid, the same for all the models
+    std::vector<State> states;
+    for (double T : {300.0, 350.0, 400.0}) {
+        for (double rho : {10.0, 300.0, 3000.0, 10000.0}) {
+            states.push_back({T, rho});
+        }
+    }
+
+    nlohmann::json outputs = nlohmann::json::array();
+    std::vector<std::string> component_list = { "n-Propane","Ethane","Methane","n-Butane","n-Pentane","n-Hexane" };
+    for (int Ncomp : {1, 2, 3, 4, 5, 6}) {
+        // Not quite equimolar so that the composition derivatives of the mixing rules all play a part
+        Eigen::ArrayXd z = Eigen::ArrayXd::LinSpaced(Ncomp, 1.0, 2.0); z /= z.sum();
+
+        std::valarray<double> Tc_K(Ncomp), pc_Pa(Ncomp);
+        for (int i = 0; i < Ncomp; ++i) {
+            Tc_K[i] = 100.0 + 10.0 * i;
+            pc_Pa[i] = 1e6 + 0.1e6 * i;
+        }
+        sweep(vdWEOS(Tc_K, pc_Pa), "vdW", z, states, outputs);
+
+        std::valarray<double> Tc_PR(369.89, Ncomp), pc_PR(4251200.0, Ncomp), acentric(0.1521, Ncomp);
+        sweep(canonical_PR(Tc_PR, pc_PR, acentric), "PR", z, states, outputs);
+
+        std::vector<PCSAFT::SAFTCoeffs> coeffs;
+        for (auto i = 0; i < Ncomp; ++i) {
+            PCSAFT::SAFTCoeffs c;
+            c.m = 2.0020;
+            c.sigma_Angstrom = 3.6184;
+            c.epsilon_over_k = 208.11;
+            c.name = "propane";
+            c.BibTeXKey = "Gross-IECR-2001";
+            coeffs.push_back(c);
+        }
+        sweep(PCSAFT::PCSAFTMixture(coeffs), "PCSAFT", z, states, outputs);
+
+        std::vector<std::string> fluid_set(component_list.begin(), component_list.begin() + Ncomp);
+        sweep(build_multifluid_model(fluid_set, root, root + "/dev/mixtures/mixture_binary_pairs.json"), "multifluid", z, states, outputs);
+    }
+
+    std::ofstream file("ADbackends_timings.json");
+    file << outputs.dump(1);
+    return EXIT_SUCCESS;
+}
@@ -1,5 +1,4 @@
-#include <catch2/catch_test_macros.hpp>
-#include <catch2/benchmark/catch_benchmark_all.hpp>
+#include "bench_counters.hpp"
 
 #include "teqp/cpp/teqpcpp.hpp"
 #include "teqp/cpp/derivs.hpp"
@@ -24,33 +23,33 @@ TEST_CASE("multifluid derivatives", "[mf]")
     auto z = (Eigen::ArrayXd(1) << 1.0).finished();
     auto rhovec = 300.0* z;
     
-    BENCHMARK("alphar") {
+    bench::counted_benchmark("alphar", [&] {
         return am->get_Arxy(0, 0, 300, 3.0, z);
-    };
-    BENCHMARK("Ar20") {
+    });
+    bench::counted_benchmark("Ar20", [&] {
         return am->get_Ar20(300, 3.0, z);
-    };
-    BENCHMARK("get_Ar02n") {
+    });
+    bench::counted_benchmark("get_Ar02n", [&] {
         return am->get_Ar02n(300, 3.0, z);
-    };
-    BENCHMARK("fugacity coefficients") {
+    });
+    bench::counted_benchmark("fugacity coefficients", [&] {
         return am->get_fugacity_coefficients(300.0, rhovec);
-    };
-    BENCHMARK("cvr/R") {
+    });
+    bench::counted_benchmark("cvr/R", [&] {
         return -1*am->get_Arxy(2, 0, 300, 3.0, z);
-    };
-    BENCHMARK("partial_molar_volumes") {
+    });
+    bench::counted_benchmark("partial_molar_volumes", [&] {
         return am->get_partial_molar_volumes(300.0, rhovec);
-    };
-    BENCHMARK("get_deriv_mat2") {
+    });
+    bench::counted_benchmark("get_deriv_mat2", [&] {
         return am->get_deriv_mat2(300.0, 3.0, z);
-    };
-    BENCHMARK("build_iteration_Jv") {
+    });
+    bench::counted_benchmark("build_iteration_Jv", [&] {
         auto mat = am->get_deriv_mat2(300.0, 3.0, z);
         auto mat2 = am->get_deriv_mat2(300.0, 3.0, z);
         const std::vector<char> vars = {'T','D','P','S'};
         return teqp::cppinterface::build_iteration_Jv(vars, mat, mat2, 8.3144, 300.0, 300.0, z);
-    };
+    });
 }
 
 TEST_CASE("multifluid derivatives via DerivativeAdapter", "[mf]")
@@ -71,14 +70,14 @@ TEST_CASE("multifluid derivatives via DerivativeAdapter", "[mf]")
     using namespace cppinterface;
     using vd = VirialDerivatives<decltype(model), double, decltype(z)>;
     
-    BENCHMARK("B4 natively") {
+    bench::counted_benchmark("B4 natively", [&] {
         return vd::get_Bnvir<4>(model, 300.0, z);
-    };
-    BENCHMARK("B4 via AbstractModel") {
+    });
+    bench::counted_benchmark("B4 via AbstractModel", [&] {
         return am->get_Bnvir(4, 300, z);
-    };
-    BENCHMARK("B4 via DerivativeAdapter") {
+    });
+    bench::counted_benchmark("B4 via DerivativeAdapter", [&] {
         using namespace teqp::cppinterface::adapter;
         return view(model)->get_Bnvir(4, 300, z);
-    };
+    });
 }
@@ -0,0 +1,183 @@
+/*
+Reproducible benchmark of the end-to-end algorithms, rather than of the point derivatives: mix_VLE_Tp, mixture_VLE_px,
+trace_VLE_isotherm_binary, trace_critical_arclength_binary, find_VLLE_T_binary and NRIterator, for nitrogen + ethane with the
+multifluid model of the fluid library.  The inputs are fixed, so a change of the wall time, of the number of calls into the
+model, or of the number of allocations between two builds is a regression (or an improvement) of the algorithm itself.
+
+For each algorithm the median wall time of Nrepeat runs is obtained with the plain model; the calls into the model are counted
+in one run with the model wrapped by make_profiling_model, and the allocations in one run with the plain model by the counting
+operator new of this file. The results are written to algorithm_timings.json
+
+Usage: bench_algorithms [path to the fluid library, default ../mycp] [Nrepeat, default 5]
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/fwd.hpp"
+#include "teqp/ideal_eosterms.hpp"
+#include "teqp/algorithms/iteration.hpp"
+
+using namespace teqp;
+using namespace teqp::cppinterface;
+
+namespace {
+std::atomic<std::size_t> Nallocations{0}, Nbytes_allocated{0};
+}
+
+// All the allocations of the program are counted; the array forms and the nothrow forms call these by default
+void* operator new(std::size_t size) {
+    ++Nallocations;
+    Nbytes_allocated += size;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) { return p; }
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+/// The inputs of the algorithms, all obtained from the pure fluids so that nothing but the fluid library is needed
+struct Inputs {
+    double T; ///< The temperature of the isotherms, in K
+    std::vector<Eigen::ArrayXd> rhovecL0, rhovecV0; ///< The saturated states of the pure fluids at T, as binary molar concentrations
+    Eigen::ArrayXd Tc, rhoc; ///< The critical points of the pure fluids
+};
+
+Inputs get_inputs(const std::string& root, const std::vector<std::string>& components, double T) {
+    Inputs in{T, {}, {}, Eigen::ArrayXd(components.size()), Eigen::ArrayXd(components.size())};
+    for (auto i = 0U; i < components.size(); ++i) {
+        auto pure = make_model({{"kind", "multifluid"}, {"model", {{"components", {components[i]}}, {"root", root}}}});
+        const auto& mf = adapter::get_model_cref<multifluid_t>(pure.get());
+        auto [Tc, rhoc] = pure->solve_pure_critical(mf.redfunc.Tc[0], 1.0 / mf.redfunc.vc[0]);
+        in.Tc[i] = Tc; in.rhoc[i] = rhoc;
+        auto rhoLV = pure->extrapolate_from_critical(Tc, rhoc, T);
+        rhoLV = pure->pure_VLE_T(T, rhoLV[0], rhoLV[1], 20);
+        Eigen::ArrayXd rhovecL = Eigen::ArrayXd::Zero(components.size()), rhovecV = rhovecL;
+        rhovecL[i] = rhoLV[0]; rhovecV[i] = rhoLV[1];
+        in.rhovecL0.push_back(rhovecL); in.rhovecV0.push_back(rhovecV);
+    }
+    return in;
+}
+
+/**
+ Run an algorithm Nrepeat times for the median wall time, once more for the allocations, and once with the profiled model for
+ the calls into the model.  The algorithm is called with the model to use and returns a short summary of its result, which
+ must be the same for the plain and the profiled model
+ */
+template<typename Algorithm>
+nlohmann::json run(const std::string& name, const Algorithm& algorithm, const std::shared_ptr<AbstractModel>& plain, const std::shared_ptr<AbstractModel>& profiled, int Nrepeat) {
+    std::vector<double> times;
+    nlohmann::json summary;
+    for (auto repeat = 0; repeat < Nrepeat; ++repeat) {
+        auto tic = std::chrono::steady_clock::now();
+        summary = algorithm(plain);
+        auto toc = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double>(toc - tic).count());
+    }
+    std::sort(times.begin(), times.end());
+
+    auto N0 = Nallocations.load(), bytes0 = Nbytes_allocated.load();
+    algorithm(plain);
+    auto Nalloc = Nallocations.load() - N0, bytes = Nbytes_allocated.load() - bytes0;
+
+    reset_profile(*profiled);
+    if (algorithm(profiled) != summary) {
+        throw std::runtime_error("The profiled model gave a different result for " + name);
+    }
+    auto profile = get_profile(*profiled);
+    nlohmann::json calls = nlohmann::json::object();
+    std::size_t Ncalls = 0;
+    for (auto& [method, stats] : profile.at("methods").items()) {
+        calls[method] = stats.at("calls");
+        Ncalls += stats.at("calls").template get<std::size_t>();
+    }
+
+    std::cout << name << ": " << times[times.size() / 2] << " s, " << Ncalls << " calls into the model, " << Nalloc << " allocations" << std::endl;
+    return {
+        {"algorithm", name}, {"median time / s", times[times.size() / 2]}, {"min time / s", times.front()},
+        {"calls", Ncalls}, {"calls by method", calls}, {"allocations", Nalloc}, {"allocated / bytes", bytes}, {"result", summary}
+    };
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const std::string root = (argc > 1) ? argv[1] : "../mycp";
+    const int Nrepeat = (argc > 2) ? std::atoi(argv[2]) : 5;
+    const std::vector<std::string> components = {"Nitrogen", "Ethane"};
+
+    nlohmann::json jmodel = {{"kind", "multifluid"}, {"model", {{"components", components}, {"root", root}}}};
+    std::shared_ptr<AbstractModel> plain = make_model(jmodel);
+    jmodel["profile"] = true;
+    std::shared_ptr<AbstractModel> profiled = make_model(jmodel);
+
+    nlohmann::json jig = nlohmann::json::array();
+    for (const auto& c : components) {
+        jig.push_back(convert_CoolProp_idealgas(root + "/dev/fluids/" + c + ".json", 0));
+    }
+    std::shared_ptr<AbstractModel> aig = make_model({{"kind", "IdealHelmholtz"}, {"model", jig}});
+
+    // Below the critical temperature of nitrogen, where the isotherms start from both pure fluids
+    const auto in = get_inputs(root, components, 120.0);
+    const auto isotherm = plain->trace_VLE_isotherm_binary(in.T, in.rhovecL0[1], in.rhovecV0[1]);
+    // A point in the middle of the isotherm from ethane is the starting point of the flashes
+    const auto& mid = isotherm[isotherm.size() / 2];
+    auto to_array = [](const nlohmann::json& j) { auto v = j.get<std::vector<double>>(); return Eigen::Map<Eigen::ArrayXd>(v.data(), v.size()).eval(); };
+    const Eigen::ArrayXd rhovecL = to_array(mid.at("rhoL / mol/m^3")), rhovecV = to_array(mid.at("rhoV / mol/m^3"));
+    const double p = mid.at("pL / Pa");
+    const Eigen::ArrayXd x = rhovecL / rhovecL.sum();
+
+    nlohmann::json outputs = nlohmann::json::array();
+    outputs.push_back(run("mix_VLE_Tp", [&](const auto& model) -> nlohmann::json {
+        auto r = model->mix_VLE_Tp(in.T, p * 1.05, rhovecL, rhovecV);
+        return {{"return_code", static_cast<int>(r.return_code)}, {"num_iter", r.num_iter}};
+    }, plain, profiled, Nrepeat));
+    outputs.push_back(run("mixture_VLE_px", [&](const auto& model) -> nlohmann::json {
+        auto [code, T, rhovecLnew, rhovecVnew] = model->mixture_VLE_px(p * 1.05, x, in.T, rhovecL, rhovecV);
+        return {{"return_code", static_cast<int>(code)}, {"T / K", T}};
+    }, plain, profiled, Nrepeat));
+    outputs.push_back(run("trace_VLE_isotherm_binary", [&](const auto& model) -> nlohmann::json {
+        return {{"points", model->trace_VLE_isotherm_binary(in.T, in.rhovecL0[1], in.rhovecV0[1]).size()}};
+    }, plain, profiled, Nrepeat));
+    outputs.push_back(run("trace_critical_arclength_binary", [&](const auto& model) -> nlohmann::json {
+        TCABOptions opt; opt.init_dt = 100;
+        Eigen::ArrayXd rhovec0 = Eigen::ArrayXd::Zero(2); rhovec0[1] = in.rhoc[1];
+        return {{"points", model->trace_critical_arclength_binary(in.Tc[1], rhovec0, std::nullopt, opt).size()}};
+    }, plain, profiled, Nrepeat));
+
+    // Both isotherms are traced once; the search for their intersection and its polishing is what is timed
+    const std::vector<nlohmann::json> traces = {isotherm, plain->trace_VLE_isotherm_binary(in.T, in.rhovecL0[0], in.rhovecV0[0])};
+    outputs.push_back(run("find_VLLE_T_binary", [&](const auto& model) -> nlohmann::json {
+        return {{"solutions", model->find_VLLE_T_binary(traces).size()}};
+    }, plain, profiled, Nrepeat));
+
+    // Newton-Raphson in (T, rho) for given (p, s) on a grid of supercritical states, starting 5% away from the solution
+    outputs.push_back(run("NRIterator", [&](const auto& model) -> nlohmann::json {
+        const std::vector<char> vars = {'P', 'S'};
+        const Eigen::ArrayXd z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+        double maxerr = 0;
+        for (double T : {300.0, 350.0, 400.0}) {
+            for (double rho : {100.0, 1000.0, 5000.0}) {
+                auto Ar = model->get_deriv_mat2(T, rho, z), Aig = aig->get_deriv_mat2(T, rho, z);
+                Eigen::ArrayXd vals = iteration::build_iteration_Jv(vars, Ar, Aig, model->get_R(z), T, rho, z).v;
+                iteration::NRIterator nr(model, aig, vars, vals, T * 1.05, rho * 0.95, z);
+                nr.take_steps(10);
+                maxerr = std::max(maxerr, std::abs(nr.get_T() / T - 1));
+            }
+        }
+        return {{"converged", maxerr < 1e-10}};
+    }, plain, profiled, Nrepeat));
+
+    std::ofstream file("algorithm_timings.json");
+    file << outputs.dump(1);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+/*
+Counters of the heap allocations and, if the hardware counters can be read, of the cache misses, for the benchmark snippets
+
+When the snippets are built with -DTEQP_BENCH_COUNTERS=ON (which defines TEQP_BENCH_COUNTERS), this header replaces the
+allocator of the program so that every allocation of the calling thread is counted, and counted_benchmark reports the
+allocations, the bytes allocated and the cache misses per call after the timings of Catch.  Otherwise counted_benchmark is
+just a Catch BENCHMARK.  With glibc the C allocation functions are replaced, so that the allocations of Eigen, which calls
+malloc directly, are counted too; elsewhere only the global operator new is replaced.  The cache misses are read with
+perf_event_open on Linux, and are not reported if the kernel does not allow it (see /proc/sys/kernel/perf_event_paranoid).
+
+It defines the replacement allocation functions, so it must be included in only one translation unit of the program, which
+is the case for the snippets.
+*/
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark_all.hpp>
+
+#if defined(TEQP_BENCH_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define TEQP_BENCH_PERF
+#endif
+
+namespace teqp {
+namespace bench {
+
+/// The allocations of the calling thread since it started
+struct AllocationCounts {
+    std::size_t allocations = 0, bytes = 0;
+};
+
+namespace detail {
+    // Trivial thread_local variables of the executable need no allocation to be set up, so they can be used in malloc
+    inline thread_local AllocationCounts counts;
+    inline void count(std::size_t bytes) {
+        ++counts.allocations;
+        counts.bytes += bytes;
+    }
+}
+
+/// The allocations of the calling thread so far; always zero if the counters are not enabled
+inline AllocationCounts get_allocation_counts() { return detail::counts; }
+
+/**
+ \brief The hardware counter of the cache misses of the calling thread, in user space, if the kernel allows reading it
+ */
+class CacheMissCounter {
+private:
+    int fd = -1;
+public:
+    CacheMissCounter() {
+#if defined(TEQP_BENCH_PERF)
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    ~CacheMissCounter() {
+#if defined(TEQP_BENCH_PERF)
+        if (fd >= 0) { close(fd); }
+#endif
+    }
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    /// The count since the counter was opened, or nothing if it could not be opened
+    std::optional<std::uint64_t> read() const {
+#if defined(TEQP_BENCH_PERF)
+        std::uint64_t value = 0;
+        if (fd >= 0 && ::read(fd, &value, sizeof(value)) == sizeof(value)) { return value; }
+#endif
+        return std::nullopt;
+    }
+};
+
+/// The counts per call of a function
+struct PerCall {
+    double allocations = 0, bytes = 0;
+    std::optional<double> cache_misses;
+};
+
+/// Call f Ncalls times (after one call to warm it up) and return the counts of the calling thread per call
+template<typename Function>
+PerCall count_per_call(const Function& f, std::size_t Ncalls = 100) {
+    f();
+    CacheMissCounter misses;
+    auto misses0 = misses.read();
+    auto counts0 = get_allocation_counts();
+    for (auto i = 0U; i < Ncalls; ++i) {
+        auto keep = f();
+        Catch::Benchmark::keep_memory(&keep);
+    }
+    auto counts = get_allocation_counts();
+    auto misses1 = misses.read();
+    PerCall o;
+    o.allocations = static_cast<double>(counts.allocations - counts0.allocations) / Ncalls;
+    o.bytes = static_cast<double>(counts.bytes - counts0.bytes) / Ncalls;
+    if (misses0 && misses1) { o.cache_misses = static_cast<double>(misses1.value() - misses0.value()) / Ncalls; }
+    return o;
+}
+
+/**
+ A Catch BENCHMARK of f, which must return a value as the body of a BENCHMARK does; with the counters enabled, the counts per
+ call are printed after the timings
+ */
+template<typename Function>
+void counted_benchmark(const std::string& name, const Function& f) {
+    if (Catch::Benchmark::Benchmark benchmark{ name }) {
+        benchmark = [&] { return f(); };
+    }
+#if defined(TEQP_BENCH_COUNTERS)
+    auto c = count_per_call(f);
+    std::cout << name << ": " << c.allocations << " allocations/call, " << c.bytes << " bytes/call";
+    if (c.cache_misses) { std::cout << ", " << c.cache_misses.value() << " cache misses/call"; }
+    std::cout << std::endl;
+#endif
+}
+
+}
+}
+
+#if defined(TEQP_BENCH_COUNTERS)
+#if defined(__GLIBC__)
+// The functions of glibc that its malloc and friends are aliases of
+extern "C" {
+void* __libc_malloc(std::size_t);
+void* __libc_calloc(std::size_t, std::size_t);
+void* __libc_realloc(void*, std::size_t);
+void* __libc_memalign(std::size_t, std::size_t);
+void __libc_free(void*);
+
+void* malloc(std::size_t size) noexcept { teqp::bench::detail::count(size); return __libc_malloc(size); }
+void* calloc(std::size_t n, std::size_t size) noexcept { teqp::bench::detail::count(n * size); return __libc_calloc(n, size); }
+void* realloc(void* p, std::size_t size) noexcept { teqp::bench::detail::count(size); return __libc_realloc(p, size); }
+void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept { teqp::bench::detail::count(size); return __libc_memalign(alignment, size); }
+int posix_memalign(void** p, std::size_t alignment, std::size_t size) noexcept {
+    teqp::bench::detail::count(size);
+    *p = __libc_memalign(alignment, size);
+    return (*p == nullptr) ? ENOMEM : 0;
+}
+void free(void* p) noexcept { __libc_free(p); }
+}
+#else
+// The array and nothrow forms of operator new call this one by default
+void* operator new(std::size_t size) {
+    teqp::bench::detail::count(size);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) { return p; }
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#endif
+#endif
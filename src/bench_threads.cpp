@@ -0,0 +1,122 @@
+/*
+Stress test and timing of the concurrent evaluation of one shared model from many threads
+
+All the threads evaluate the same instance through the AbstractModel interface and must obtain the values of the serial
+evaluation; build with -DTEQP_SANITIZE_THREAD=ON to have ThreadSanitizer check the memos and scratch buffers of the models.
+*/
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark_all.hpp>
+
+#include <numeric>
+#include <thread>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/models/fwd.hpp"
+
+using namespace teqp;
+using namespace teqp::cppinterface;
+
+namespace {
+
+struct Case {
+    std::string name;
+    std::shared_ptr<AbstractModel> model;
+    Eigen::ArrayXd z;
+    double Tmin, Tmax, rhomin, rhomax;
+};
+
+std::vector<Case> get_cases(){
+    std::vector<Case> cases;
+    auto z2 = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+
+    cases.push_back({"vdW", make_model({{"kind", "vdW"}, {"model", {{"Tcrit / K", {190.564, 305.32}}, {"pcrit / Pa", {4599200.0, 4872200.0}}}}}), z2, 250, 400, 1, 5000});
+    cases.push_back({"PCSAFT", make_model({{"kind", "PCSAFT"}, {"model", {{"names", {"Methane", "Ethane"}}}}}), z2, 250, 400, 1, 5000});
+    cases.push_back({"SAFT-VR-Mie", make_model({{"kind", "SAFT-VR-Mie"}, {"model", {{"names", {"Methane", "Ethane"}}}}}), z2, 250, 400, 1, 5000});
+
+    std::shared_ptr<AbstractModel> mf = make_model({{"kind", "multifluid"}, {"model", {{"components", {"Nitrogen", "Ethane"}}, {"root", "../mycp"}}}});
+    adapter::get_model_ref<multifluid_t>(mf.get()).enable_tau_cache(true);
+    cases.push_back({"multifluid with memo of tau factors", mf, z2, 250, 400, 1, 5000});
+
+    nlohmann::json water = {
+        {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+        {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class","4C"}
+    };
+    nlohmann::json methanol = {
+        {"a0i / Pa m^6/mol^2",0.40531 }, {"bi / m^3/mol", 0.0000309}, {"c1", 0.4310}, {"Tc / K", 513.0},
+        {"epsABi / J/mol", 24591.0}, {"betaABi", 0.0161}, {"class","2B"}
+    };
+    std::shared_ptr<AbstractModel> cpa = make_model({{"kind", "CPA"}, {"model", {{"cubic","SRK"}, {"pures", {water, methanol}}, {"R_gas / J/mol/K", 8.3144598}}}});
+    adapter::get_model_ref<CPA_t>(cpa.get()).enable_warm_start(true);
+    cases.push_back({"CPA with warm start", cpa, z2, 350, 500, 1, 40000});
+    return cases;
+}
+
+/// The state points, the same in all the threads but visited in an order that depends on the thread
+std::vector<std::pair<double, double>> get_states(const Case& c, std::size_t N){
+    std::vector<std::pair<double, double>> o;
+    for (auto i = 0U; i < N; ++i){
+        for (auto j = 0U; j < N; ++j){
+            o.emplace_back(c.Tmin + (c.Tmax-c.Tmin)*i/(N-1), c.rhomin + (c.rhomax-c.rhomin)*j/(N-1));
+        }
+    }
+    return o;
+}
+
+Eigen::ArrayXd evaluate(const Case& c, const std::vector<std::pair<double, double>>& states, std::size_t offset){
+    Eigen::ArrayXd o(states.size()*2);
+    for (auto k = 0U; k < states.size(); ++k){
+        auto i = (k + offset) % states.size();
+        auto [T, rho] = states[i];
+        o[2*i] = c.model->get_Arxy(0, 0, T, rho, c.z);
+        o[2*i+1] = c.model->get_Ar02n(T, rho, c.z)[2];
+    }
+    return o;
+}
+
+}
+
+TEST_CASE("Concurrent evaluation of one shared model", "[threads]")
+{
+    const auto Nthreads = std::max(4U, std::thread::hardware_concurrency());
+    for (const auto& c : get_cases()){
+        CAPTURE(c.name);
+        auto states = get_states(c, 20);
+        const Eigen::ArrayXd serial = evaluate(c, states, 0);
+
+        std::vector<Eigen::ArrayXd> results(Nthreads);
+        std::vector<std::thread> threads;
+        for (auto t = 0U; t < Nthreads; ++t){
+            threads.emplace_back([&, t](){
+                for (auto rep = 0; rep < 5; ++rep){
+                    results[t] = evaluate(c, states, 7*t + rep);
+                }
+            });
+        }
+        for (auto& th : threads){ th.join(); }
+
+        for (const auto& r : results){
+            CHECK(((r - serial).abs() <= 1e-12*(1 + serial.abs())).all());
+        }
+    }
+}
+
+TEST_CASE("Timing of concurrent evaluation", "[threads][!benchmark]")
+{
+    const auto Nthreads = std::max(4U, std::thread::hardware_concurrency());
+    for (const auto& c : get_cases()){
+        auto states = get_states(c, 20);
+        BENCHMARK(c.name + ", serial"){
+            return evaluate(c, states, 0).sum();
+        };
+        BENCHMARK(c.name + ", " + std::to_string(Nthreads) + " threads, same work in each"){
+            std::vector<double> sums(Nthreads);
+            std::vector<std::thread> threads;
+            for (auto t = 0U; t < Nthreads; ++t){
+                threads.emplace_back([&, t](){ sums[t] = evaluate(c, states, 7*t).sum(); });
+            }
+            for (auto& th : threads){ th.join(); }
+            return std::accumulate(sums.begin(), sums.end(), 0.0);
+        };
+    }
+}
@@ -141,4 +141,16 @@ TEST_CASE("Test for pressure for 2-Center Lennard-Jones Model (Lisal et al.) plu
 
     }
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("Changing the elongation in place gives the same model", "[2CLJF]")
+{
+    std::valarray<double> molefrac = { 1.0 };
+    auto model = build_two_center_model_dipole("2CLJF_Lisal", 0.1, 0.5);
+    for (double L : { 0.0, 0.3, 0.67 }) {
+        model.set_L(L);
+        const auto fresh = build_two_center_model_dipole("2CLJF_Lisal", L, 0.5);
+        using tdx = TDXDerivatives<decltype(model)>;
+        CHECK(tdx::get_Ar01(model, 2.0, 0.3, molefrac) == tdx::get_Ar01(fresh, 2.0, 0.3, molefrac));
+    }
+}
@@ -5,6 +5,8 @@ using Catch::Approx;
 #include "teqp/models/mie/lennardjones.hpp"
 #include "teqp/models/mie/mie.hpp"
 #include "teqp/models/model_potentials/LJChain.hpp"
+#include "teqp/models/model_potentials/squarewell.hpp"
+#include "teqp/models/model_potentials/exp6.hpp"
 #include "teqp/algorithms/critical_pure.hpp"
 #include "teqp/derivs.hpp"
 
@@ -98,6 +100,11 @@ TEST_CASE("Test single point values from S. Pohl", "[Mien6]")
         CHECK(Ar00rcalc == Approx(A00r).margin(1e-14));
         CHECK(Ar10rcalc == Approx(A10r).margin(1e-14));
         CHECK(Ar01rcalc == Approx(A01r).margin(1e-14));
+
+        // Changing the exponent in place gives the same model
+        Mie::Mie6Pohl2023 swept(11);
+        swept.set_lambda_a(lambda_a);
+        CHECK(TDX::get_Arxy<0,0>(swept, T, rho, z) == Ar00rcalc);
     }
 }
 
@@ -112,3 +119,22 @@ TEST_CASE("Test LJChain models", "[LJChain]"){
     auto crit3 = solve_pure_critical(m3, 1.32, 0.3);
     CHECK(std::get<0>(crit2) == Approx(1.82).margin(0.1));
 }
+
+TEST_CASE("Evaluation of model potentials on a grid of states in packets", "[LJ126][packets]")
+{
+    // An odd number of states so that the last packet is partial
+    auto T = Eigen::ArrayXd::LinSpaced(101, 0.8, 3.0).eval();
+    auto rho = Eigen::ArrayXd::LinSpaced(101, 0.01, 0.8).eval();
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    auto check = [&](const auto& model) {
+        auto a = get_alphar_many(model, T, rho);
+        for (auto i = 0; i < T.size(); ++i) {
+            CAPTURE(i);
+            CHECK(a[i] == Approx(model.alphar(T[i], rho[i], z)).epsilon(1e-10));
+        }
+    };
+    check(LJ126KolafaNezbeda1994());
+    check(LJ126Johnson1993());
+    check(squarewell::EspindolaHeredia2009(1.5));
+    check(exp6::Kataoka1992(12));
+}
@@ -355,3 +355,26 @@ TEST_CASE("Check B and its temperature derivatives", "[PCSAFT],[B]")
     auto TdBdT = Tspec*model->get_dmBnvirdTm(2, 1, Tspec, z);
     CHECK(TdBdT == Approx(TdBdTnondilute));
 }
+
+TEST_CASE("Check PCSAFT pair tables with kij against composition derivatives", "[PCSAFT]")
+{
+    std::vector<std::string> names = { "Methane", "Ethane", "Propane" };
+    Eigen::ArrayXXd kmat(3, 3); kmat.setZero();
+    kmat(0, 1) = kmat(1, 0) = 0.01;
+    kmat(1, 2) = kmat(2, 1) = -0.02;
+    auto model = PCSAFTMixture(names, kmat);
+    double T = 250, rho = 3000;
+    Eigen::ArrayXd z(3); z << 0.2, 0.3, 0.5;
+
+    // Derivative with respect to the first mole fraction with autodiff (generic path for the double sums) ...
+    Eigen::ArrayX<autodiff::dual> zad = z.cast<autodiff::dual>();
+    auto f = [&](const autodiff::dual& z0) { auto zz = zad; zz[0] = z0; return model.alphar(T, rho, zz); };
+    autodiff::dual z0 = z[0];
+    double dalphardz0_ad = autodiff::derivative(f, autodiff::wrt(z0), autodiff::at(z0));
+
+    // ... and by centered finite differences of the double path (dense matrix-vector products)
+    double h = 1e-6;
+    Eigen::ArrayXd zp = z, zm = z; zp[0] += h; zm[0] -= h;
+    double dalphardz0_fd = (model.alphar(T, rho, zp) - model.alphar(T, rho, zm)) / (2 * h);
+    CHECK(dalphardz0_ad == Approx(dalphardz0_fd).epsilon(1e-7));
+}
@@ -30,6 +30,15 @@ TEST_CASE("Check integration", "[SAFTVRMIE]"){
     auto deg5 = quad<5, double>(f, -1.0, 1.0);
     CHECK(deg4 == Approx(exact).margin(1e-12));
     CHECK(deg5 == Approx(exact).margin(1e-12));
+    
+    // Any callable, with compile-time nodes
+    auto g = [](const auto& x){ return forceeval(x*sin(x)); };
+    CHECK(quad_inline<5>(g, -1.0, 1.0) == Approx(deg5).margin(1e-15));
+    CHECK(quad_inline<30>(g, -1.0, 1.0) == Approx(exact).margin(1e-12));
+    // And with autodiff types; the derivative of the integral with respect to the upper limit b is f(b)
+    autodiff::dual b = 1.0;
+    auto dIdb = derivative([&g](const autodiff::dual& b_){ return quad_inline<10>(g, autodiff::dual(-1.0), b_); }, wrt(b), at(b));
+    CHECK(dIdb == Approx(1.0*sin(1.0)));
 }
 
 TEST_CASE("Check integration for d", "[SAFTVRMIE]"){
@@ -304,6 +313,36 @@ TEST_CASE("Test diameter calculations", "[SAFTVRMie]"){
     }
 }
 
+TEST_CASE("Check the temperature cache of the diameters", "[SAFTVRMie],[dcache]"){
+    SAFTVRMieMixture model{{"Methane", "Ethane"}};
+    const auto& terms = model.get_terms();
+    for (double T : {300.0, 300.0, 150.0}){
+        CAPTURE(T);
+        auto d = terms.get_dmat(T);
+        CHECK(d(0,0) == Approx(terms.get_dii(0, T)));
+        CHECK(d(0,1) == Approx((terms.get_dii(0, T) + terms.get_dii(1, T))/2.0));
+        
+        // Derivatives with respect to 1/T, as in TDXDerivatives
+        autodiff::Real<3, double> Trecip = 1.0/T;
+        auto fcached = [&](const auto& Trecip_){ return terms.get_dmat(forceeval(1.0/Trecip_))(1,1); };
+        auto fdirect = [&](const auto& Trecip_){ return terms.get_dii(1, forceeval(1.0/Trecip_)); };
+        auto derscached = derivatives(fcached, along(1), at(Trecip));
+        auto dersdirect = derivatives(fdirect, along(1), at(Trecip));
+        for (auto k = 0; k <= 3; ++k){
+            CHECK(derscached[k] == Approx(dersdirect[k]));
+        }
+        
+        autodiff::dual2nd Tdual = T;
+        auto gcached = [&](const auto& T_){ return terms.get_dmat(T_)(0,0); };
+        auto gdirect = [&](const auto& T_){ return terms.get_dii(0, T_); };
+        auto d2cached = derivatives(gcached, wrt(Tdual), at(Tdual));
+        auto d2direct = derivatives(gdirect, wrt(Tdual), at(Tdual));
+        for (auto k = 0; k <= 2; ++k){
+            CHECK(d2cached[k] == Approx(d2direct[k]));
+        }
+    }
+}
+
 TEST_CASE("Check B and its temperature derivatives", "[SAFTVRMie],[B]")
 {
     auto j = nlohmann::json::parse(R"({
@@ -79,6 +79,17 @@ TEST_CASE("Evaluation of K^{(n,m)}", "[checkKvals]")
 }
 
 
+TEST_CASE("Check values of Gottschalk integrals", "[checkJvals],[checkKvals]")
+{
+    // Values from direct evaluation of the double sums of Gottschalk with the tabulated coefficients
+    double Tstar = 1.5, rhostar = 0.7;
+    CHECK(GottschalkJIntegral(6).get_J(Tstar, rhostar) == Approx(0.5410740988522671).epsilon(1e-10));
+    CHECK(GottschalkJIntegral(15).get_J(Tstar, rhostar) == Approx(0.24519044714510968).epsilon(1e-10));
+    CHECK(GottschalkKIntegral(222, 333).get_K(Tstar, rhostar) == Approx(0.02893012444349063).epsilon(1e-10));
+    CHECK(GottschalkKIntegral(334, 445).get_K(Tstar, rhostar) == Approx(-0.012925588719144725).epsilon(1e-10));
+}
+
+
 using my_float_type = boost::multiprecision::number<boost::multiprecision::cpp_bin_float<100U>>;
 
 TEST_CASE("Evaluate higher derivatives of K", "[GTK]")
@@ -135,6 +146,28 @@ TEST_CASE("Evaluation of Gubbins and Twu combos ", "[GTLPolar]")
 // This test is used to make sure that replacing std::abs with a more flexible function
 // that can handle differentation types like std::complex<double> is still ok
 
+TEST_CASE("Factored three-body polar sums match the explicit triple loop", "[polar3body]")
+{
+    Eigen::ArrayXd m(3), sigma(3), epsk(3), mustar2(3), nmu(3);
+    m << 1.0, 2.1, 3.5; sigma << 3.2, 3.7, 4.1; epsk << 150, 230, 310; mustar2 << 0.5, 1.3, 0.0; nmu << 1.0, 1.0, 0.0;
+    auto dip = DipolarContributionGrossVrabec(m, sigma, epsk, mustar2, nmu);
+    double T = 300, rhoN_A3 = 0.004, eta = 0.3;
+    Eigen::ArrayXd x(3); x << 0.2, 0.5, 0.3;
+    
+    double summer = 0;
+    for (auto i = 0; i < 3; ++i){
+        for (auto j = 0; j < 3; ++j){
+            for (auto k = 0; k < 3; ++k){
+                auto sigmaij = (sigma[i]+sigma[j])/2, sigmaik = (sigma[i]+sigma[k])/2, sigmajk = (sigma[j]+sigma[k])/2;
+                auto mijk = std::min(pow(m[i]*m[j]*m[k], 1.0/3.0), 2.0);
+                summer += x[i]*x[j]*x[k]*epsk[i]/T*epsk[j]/T*epsk[k]/T*POW3(sigma[i]*sigma[j]*sigma[k])/(sigmaij*sigmaik*sigmajk)*nmu[i]*nmu[j]*nmu[k]*mustar2[i]*mustar2[j]*mustar2[k]*get_JDD_3ijk(eta, mijk);
+            }
+        }
+    }
+    double alpha3_explicit = -4.0*POW2(static_cast<double>(EIGEN_PI))/3.0*POW2(rhoN_A3)*summer;
+    CHECK(dip.get_alpha3DD(T, rhoN_A3, eta, x) == Approx(alpha3_explicit).epsilon(1e-12));
+}
+
 TEST_CASE("Check derivative of |x|", "[diffabs]")
 {
     double h = 1e-100;
@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using Catch::Approx;
+
+#include "teqp/algorithms/VLLE.hpp"
+
+using namespace teqp;
+
+TEST_CASE("Sweep for self-intersections matches the pairwise search", "[VLLE]")
+{
+    // A curve that loops back on itself several times
+    std::size_t N = 2000;
+    std::vector<double> x(N), y(N);
+    for (auto i = 0U; i < N; ++i){
+        double t = 20.0*i/N;
+        x[i] = t + 1.5*sin(3*t);
+        y[i] = cos(3*t);
+    }
+    auto solns = VLLE::get_self_intersections(x, y);
+    
+    std::vector<VLLE::SelfIntersectionSolution> expected;
+    for (auto j = 0U; j + 1 < N; ++j){
+        for (auto k = j + 1; k + 1 < N; ++k){
+            VLLE::internal::intersect_segments(x, y, j, k, expected);
+        }
+    }
+    REQUIRE(solns.size() == expected.size());
+    CHECK(solns.size() > 0);
+    for (auto i = 0U; i < solns.size(); ++i){
+        CAPTURE(i);
+        CHECK(solns[i].j == expected[i].j);
+        CHECK(solns[i].k == expected[i].k);
+        CHECK(solns[i].s == expected[i].s);
+        CHECK(solns[i].x == Approx(expected[i].x));
+    }
+    
+    // A simple crossing
+    std::vector<double> x2 = {0, 1, 1, 0.5}, y2 = {0, 0, 1, -1};
+    auto solns2 = VLLE::get_self_intersections(x2, y2);
+    REQUIRE(solns2.size() == 1);
+    CHECK(solns2[0].j == 0);
+    CHECK(solns2[0].k == 2);
+    CHECK(solns2[0].x == Approx(0.75));
+    CHECK(solns2[0].y == Approx(0.0).margin(1e-14));
+}
@@ -66,3 +66,65 @@ TEST_CASE("Ammonia derivative", "[alphaig][NH3]") {
     
     DerivativeHolderSquare<2, AlphaWrapperOption::idealgas> dhs(ih, T, rho, molefrac);
 }
+
+TEST_CASE("Closed-form ideal-gas derivatives", "[alphaig]") {
+    double T = 300, rho = 10;
+    using o = nlohmann::json::object_t;
+    std::valarray<double> n = { 2.224, 3.148, 0.9579 }, theta = { 1646, 3965, 7231 };
+    nlohmann::json j0terms = {
+          o{ {"type", "Lead"}, { "a_1", -16.1}, { "a_2", 2271.6 } },
+          o{ {"type", "LogT"}, { "a", -3 } },
+          o{ {"type", "Constant"}, { "a", 18.0 } },
+          o{ {"type", "PowerT"}, { "n", {0.1, -2.0}}, {"t", {1.5, -1.0}} },
+          o{ {"type", "PlanckEinstein"}, { "n",  n}, {"theta", theta}},
+          o{ {"type", "PlanckEinsteinGeneralized"}, { "n", {1.1}}, {"c", {1.0}}, {"d", {0.5}}, {"theta", {-800.0}}}
+    };
+    nlohmann::json j1terms = {
+          o{ {"type", "Lead"}, { "a_1", -10.0}, { "a_2", 1000.0 } },
+          o{ {"type", "GERG2004Cosh"}, { "n", {0.4}}, {"theta", {900.0}}},
+          o{ {"type", "GERG2004Sinh"}, { "n", {1.3}}, {"theta", {400.0}}},
+          o{ {"type", "Cp0Constant"}, { "c", 2.5}, {"T_0", 298.15}},
+          o{ {"type", "Cp0PowerT"}, { "c", 0.01}, {"t", 1.0}, {"T_0", 298.15}}
+    };
+    nlohmann::json j = {{ {"R", 8.31446261815324}, {"terms", j0terms} }, { {"R", 8.31446261815324}, {"terms", j1terms} }};
+    IdealHelmholtz ih(j);
+    auto molefrac = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    
+    auto expected = DerivativeHolderSquare<2, AlphaWrapperOption::idealgas>(ih, T, rho, molefrac).derivs;
+    auto closed = ih.get_deriv_mat2(T, rho, molefrac);
+    for (auto i = 0; i < 3; ++i){
+        for (auto k = 0; k < 3; ++k){
+            CAPTURE(i); CAPTURE(k);
+            CHECK(closed(i, k) == Approx(expected(i, k)).margin(1e-12));
+        }
+    }
+    using tdx = TDXDerivatives<decltype(ih), double, Eigen::ArrayXd>;
+    auto wih = AlphaCallWrapper<AlphaWrapperOption::idealgas, decltype(ih)>(ih);
+    CHECK(ih.get_Aig_k0(T, rho, molefrac)[3] == Approx(tdx::get_Agenxy<3, 0, ADBackends::autodiff>(wih, T, rho, molefrac)));
+
+    SECTION("All the derivatives of get_Aig_xy, with the temperature-dependent parts cached"){
+        for (double TT : {T, 350.0, T}){
+            for (double rhoo : {rho, 2000.0}){
+                CAPTURE(TT); CAPTURE(rhoo);
+                auto check = [&](const int NT, const int ND, const double expected){
+                    CAPTURE(NT); CAPTURE(ND);
+                    auto A = ih.get_Aig_xy(NT, ND, TT, rhoo, molefrac);
+                    REQUIRE(A.has_value());
+                    CHECK(A.value() == Approx(expected).margin(1e-12));
+                };
+                check(0, 0, ih.alphaig(TT, rhoo, molefrac));
+                check(1, 0, tdx::get_Agenxy<1, 0, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(2, 0, tdx::get_Agenxy<2, 0, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(3, 0, tdx::get_Agenxy<3, 0, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(0, 1, tdx::get_Agenxy<0, 1, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(0, 2, tdx::get_Agenxy<0, 2, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(0, 3, tdx::get_Agenxy<0, 3, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(0, 4, tdx::get_Agenxy<0, 4, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(1, 1, tdx::get_Agenxy<1, 1, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+                check(2, 1, tdx::get_Agenxy<2, 1, ADBackends::autodiff>(wih, TT, rhoo, molefrac));
+            }
+        }
+        // Beyond the closed-form temperature derivatives, left to automatic differentiation
+        CHECK(!ih.get_Aig_xy(4, 0, T, rho, molefrac).has_value());
+    }
+}
@@ -116,4 +116,23 @@ TEST_CASE("pure water derivatives ", "[NH3H2O]") {
     auto dersdu = derivatives(f, wrt(x__,x__,x__,x__), at(x__));
     //CHECK(dersdu[0] = 0); // Bug in autodiff
     //CHECK(dersdu[1] = 1);
-}
\ No newline at end of file
+}
+TEST_CASE("Closed-form derivatives of Tillner-Roth", "[NH3H2O]") {
+    auto model = AmmoniaWaterTillnerRoth();
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    using tdx = TDXDerivatives<decltype(model)>;
+    // The last state is close to the critical point of water, where the non-analytic terms matter
+    for (auto [T, rho] : std::vector<std::tuple<double, double>>{ {350, 100}, {350, 40000}, {500, 40000}, {640, 15000} }) {
+        CAPTURE(T, rho);
+        CHECK(tdx::get_Arxy<0, 0, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar00(model, T, rho, z)).epsilon(1e-12));
+        CHECK(tdx::get_Arxy<1, 0, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar10(model, T, rho, z)).epsilon(1e-12));
+        CHECK(tdx::get_Arxy<0, 1, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar01(model, T, rho, z)).epsilon(1e-12));
+        CHECK(tdx::get_Arxy<2, 0, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar20(model, T, rho, z)).epsilon(1e-12));
+        CHECK(tdx::get_Arxy<1, 1, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar11(model, T, rho, z)).epsilon(1e-12));
+        CHECK(tdx::get_Arxy<0, 2, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar02(model, T, rho, z)).epsilon(1e-12));
+
+        auto M = model.get_deriv_mat2(T, rho, z);
+        CHECK(M(1, 1) == Approx(tdx::get_Ar11(model, T, rho, z)).epsilon(1e-12));
+    }
+    CHECK_THROWS_AS(tdx::get_Arxy<2, 1, ADBackends::analytic>(model, 640, 15000, z), teqp::NotImplementedError);
+}
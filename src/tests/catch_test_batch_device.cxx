@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using Catch::Approx;
+
+#include <vector>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/exceptions.hpp"
+#include "teqp/cpp/batch_device.hpp"
+
+using namespace teqp;
+using namespace teqp::device;
+
+namespace {
+    // Methane + ethane, over the gas, the supercritical fluid and the compressed liquid
+    struct States{
+        Eigen::ArrayXd T, rho;
+        Eigen::ArrayXXd molefrac;
+        States(){
+            const int M = 24;
+            T.resize(M); rho.resize(M); molefrac.resize(M, 2);
+            for (int k = 0; k < M; ++k){
+                T(k) = 200 + 10*(k % 8);
+                rho(k) = std::vector<double>{1e-3, 50.0, 3000.0, 15000.0}[k % 4];
+                molefrac(k, 0) = 0.1 + 0.8*k/(M - 1.0);
+                molefrac(k, 1) = 1 - molefrac(k, 0);
+            }
+        }
+    };
+
+    /// Check the block of the evaluator against AbstractModel::get_Arxy_many and AbstractModel::get_Ar0n_many
+    void check_block(const cppinterface::AbstractModel& model, const BatchEvaluator& batch){
+        States s;
+        const int NT = 2, ND = 4;
+        auto block = batch.get_Ar_block(NT, ND, s.T, s.rho, s.molefrac);
+        REQUIRE(block.rows() == s.T.size());
+        REQUIRE(block.cols() == (NT + 1)*(ND + 1));
+        for (int i = 0; i <= NT; ++i){
+            for (int j = 0; j <= ND; ++j){
+                if (i + j == 0){ continue; }
+                CAPTURE(i); CAPTURE(j);
+                auto expected = model.get_Arxy_many(i, j, s.T, s.rho, s.molefrac);
+                for (auto k = 0; k < s.T.size(); ++k){
+                    CAPTURE(k);
+                    CHECK(block(k, i*(ND + 1) + j) == Approx(expected(k)).epsilon(1e-10).margin(1e-13));
+                }
+            }
+        }
+        // The residual Helmholtz energy itself, and the density derivatives up to the sixth order
+        auto block0n = batch.get_Ar_block(0, 6, s.T, s.rho, s.molefrac);
+        auto expected0n = model.get_Ar0n_many(6, s.T, s.rho, s.molefrac);
+        for (auto k = 0; k < s.T.size(); ++k){
+            CHECK(block0n(k, 0) == Approx(model.get_Ar00(s.T(k), s.rho(k), s.molefrac.row(k).transpose().eval())).epsilon(1e-10).margin(1e-13));
+            for (int j = 1; j <= 6; ++j){
+                CAPTURE(j);
+                CHECK(block0n(k, j) == Approx(expected0n(k, j)).epsilon(1e-9).margin(1e-12));
+            }
+        }
+    }
+}
+
+TEST_CASE("Batched blocks of the residual derivatives of cubic models", "[batch_device]")
+{
+    nlohmann::json PR = {{"type", "PR"}, {"Tcrit / K", {190.564, 305.32}}, {"pcrit / Pa", {4599200, 4872200}}, {"acentric", {0.011, 0.099}}, {"kmat", {{0, 0.01}, {0.01, 0}}}};
+    SECTION("PR"){
+        auto model = cppinterface::make_model({{"kind", "cubic"}, {"model", PR}});
+        BatchEvaluator batch(*model);
+        CHECK(batch.get_Ncomponents() == 2);
+        check_block(*model, batch);
+    }
+    SECTION("SRK with the Twu alpha functions"){
+        auto SRK = PR;
+        SRK["type"] = "SRK";
+        SRK["alpha"] = {{{"type", "Twu"}, {"c", {0.1, 0.9, 2.0}}}, {{"type", "Twu"}, {"c", {0.3, 0.85, 1.8}}}};
+        auto model = cppinterface::make_model({{"kind", "cubic"}, {"model", SRK}});
+        check_block(*model, BatchEvaluator(*model));
+    }
+    SECTION("One thread gives the same results"){
+        auto model = cppinterface::make_model({{"kind", "cubic"}, {"model", PR}});
+        BatchOptions serial; serial.host.Nthreads = 1;
+        States s;
+        auto a = BatchEvaluator(*model).get_Ar_block(2, 2, s.T, s.rho, s.molefrac);
+        auto b = BatchEvaluator(*model, serial).get_Ar_block(2, 2, s.T, s.rho, s.molefrac);
+        CHECK((a == b).all());
+    }
+}
+
+TEST_CASE("Batched blocks of the residual derivatives of the multifluid model", "[batch_device]")
+{
+    nlohmann::json spec = {{"components", {"Methane", "Ethane"}}, {"root", "../mycp"}, {"BIP", "../mycp/dev/mixtures/mixture_binary_pairs.json"}, {"departure", "../mycp/dev/mixtures/mixture_departure_functions.json"}};
+    auto model = cppinterface::make_model({{"kind", "multifluid"}, {"model", spec}});
+    check_block(*model, BatchEvaluator(*model));
+}
+
+TEST_CASE("Errors of the batched evaluator", "[batch_device]")
+{
+    auto model = cppinterface::make_model({{"kind", "vdW1"}, {"model", {{"a", 1.0}, {"b", 2.0}}}});
+    CHECK_THROWS_AS(BatchEvaluator(*model), teqp::NotImplementedError);
+
+    auto PR = cppinterface::make_model({{"kind", "cubic"}, {"model", {{"type", "PR"}, {"Tcrit / K", {190.564, 305.32}}, {"pcrit / Pa", {4599200, 4872200}}, {"acentric", {0.011, 0.099}}}}});
+    BatchEvaluator batch(*PR);
+    States s;
+    CHECK_THROWS_AS(batch.get_Ar_block(7, 0, s.T, s.rho, s.molefrac), teqp::InvalidArgument);
+    CHECK_THROWS_AS(batch.get_Ar_block(-1, 0, s.T, s.rho, s.molefrac), teqp::InvalidArgument);
+    Eigen::ArrayXd rho_short = s.rho.head(3);
+    CHECK_THROWS_AS(batch.get_Ar_block(1, 1, s.T, rho_short, s.molefrac), teqp::InvalidArgument);
+    Eigen::ArrayXXd x3(s.T.size(), 3); x3.setConstant(1.0/3.0);
+    CHECK_THROWS_AS(batch.get_Ar_block(1, 1, s.T, s.rho, x3), teqp::InvalidArgument);
+
+    if (!cuda_available()){
+        BatchOptions opt; opt.backend = Backend::cuda;
+        CHECK_THROWS(BatchEvaluator(*PR, opt));
+    }
+}
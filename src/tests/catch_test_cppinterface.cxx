@@ -0,0 +1,989 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <filesystem>
+
+using Catch::Approx;
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/parallel.hpp"
+#include "teqp/cpp/async.hpp"
+#include "teqp/cpp/trace_sink.hpp"
+#include "teqp/cpp/distributed.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/algorithms/iteration.hpp"
+#include "teqp/algorithms/VLE.hpp"
+#include "teqp/algorithms/continuation.hpp"
+#include "teqp/models/vdW.hpp"
+#include "teqp/models/cubics.hpp"
+
+using namespace teqp;
+
+auto make_vdW_binary(){
+    nlohmann::json j = {
+        {"kind", "vdW"},
+        {"model", {{"Tcrit / K", {150.687, 289.733}}, {"pcrit / Pa", {4863000.0, 5842000.0}}}}
+    };
+    return cppinterface::make_model(j);
+}
+
+TEST_CASE("Batched evaluation matches point-wise evaluation", "[cppinterface][many]")
+{
+    auto model = make_vdW_binary();
+    Eigen::Index M = 5;
+    Eigen::ArrayXd T = Eigen::ArrayXd::LinSpaced(M, 200, 400);
+    Eigen::ArrayXd rho = Eigen::ArrayXd::LinSpaced(M, 10, 1000);
+    EMatrixd molefrac(M, 2);
+    molefrac.col(0) = Eigen::ArrayXd::LinSpaced(M, 0.1, 0.9);
+    molefrac.col(1) = 1.0 - molefrac.col(0);
+
+    SECTION("get_Arxy_many"){
+        auto vals = model->get_Arxy_many(1, 1, T, rho, molefrac);
+        REQUIRE(vals.size() == M);
+        for (auto i = 0; i < M; ++i){
+            Eigen::ArrayXd z = molefrac.row(i).transpose();
+            CHECK(vals(i) == Approx(model->get_Ar11(T(i), rho(i), z)));
+        }
+    }
+    SECTION("get_Ar0n_many"){
+        auto vals = model->get_Ar0n_many(3, T, rho, molefrac);
+        REQUIRE(vals.rows() == M);
+        REQUIRE(vals.cols() == 4);
+        for (auto i = 0; i < M; ++i){
+            Eigen::ArrayXd z = molefrac.row(i).transpose();
+            auto pt = model->get_Ar03n(T(i), rho(i), z);
+            for (auto j = 0; j < 4; ++j){
+                CHECK(vals(i, j) == Approx(pt(j)));
+            }
+        }
+    }
+    SECTION("mismatched lengths"){
+        Eigen::ArrayXd rhoshort = rho.head(M-1);
+        CHECK_THROWS(model->get_Arxy_many(0, 1, T, rhoshort, molefrac));
+        CHECK_THROWS(model->get_Ar0n_many(99, T, rho, molefrac));
+    }
+}
+
+TEST_CASE("Derivative tensor matches individual derivatives", "[cppinterface][derivmatN]")
+{
+    auto model = make_vdW_binary();
+    double T = 300, rho = 2000;
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    auto mat = model->get_deriv_matN(3, T, rho, z);
+    REQUIRE(mat.rows() == 4);
+    REQUIRE(mat.cols() == 4);
+    for (auto i = 0; i <= 3; ++i){
+        for (auto j = 0; i + j <= 3; ++j){
+            CAPTURE(i, j);
+            CHECK(mat(i, j) == Approx(model->get_Arxy(i, j, T, rho, z)));
+        }
+    }
+    CHECK(mat(3, 3) == 0.0);
+
+    auto mat2 = model->get_deriv_mat2(T, rho, z);
+    CHECK(mat2(1, 1) == Approx(mat(1, 1)));
+    CHECK(mat2(0, 2) == Approx(mat(0, 2)));
+    CHECK_THROWS(model->get_deriv_matN(99, T, rho, z));
+}
+
+TEST_CASE("Views of foreign buffers give the same values as arrays", "[cppinterface][ref]")
+{
+    auto model = make_vdW_binary();
+    double T = 300, rho = 300;
+    // Interleaved storage, as when the compositions of several states are held in one C buffer; every other entry is the composition of interest
+    std::vector<double> buffer = {0.3, -1, 0.7, -1};
+    Eigen::Map<const EArrayd, 0, Eigen::InnerStride<2>> strided(&buffer[0], 2);
+    std::vector<double> contiguous = {0.3, 0.7};
+    Eigen::Map<const EArrayd> z(&contiguous[0], 2);
+    Eigen::ArrayXd zarr = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    
+    CHECK(model->get_R(z) == model->get_R(zarr));
+    CHECK(model->get_Arxy(1, 2, T, rho, z) == model->get_Arxy(1, 2, T, rho, zarr));
+    CHECK(model->get_Arxy(1, 2, T, rho, strided) == model->get_Arxy(1, 2, T, rho, zarr));
+    CHECK(model->get_B2vir(T, z) == model->get_B2vir(T, zarr));
+    CHECK(model->get_neff(T, rho, z) == model->get_neff(T, rho, zarr));
+    CHECK((model->get_deriv_mat2(T, rho, z) - model->get_deriv_mat2(T, rho, zarr)).abs().maxCoeff() == 0.0);
+    CHECK(model->solve_rho_Tp(T, 1e5, z) == model->solve_rho_Tp(T, 1e5, zarr));
+    Eigen::ArrayXd rhovec = rho*zarr;
+    Eigen::Map<const EArrayd> rhovec_(&rhovec[0], 2);
+    CHECK(model->get_pr(T, rhovec_) == model->get_pr(T, rhovec));
+    CHECK((model->get_fugacity_coefficients(T, rhovec_) - model->get_fugacity_coefficients(T, rhovec)).abs().maxCoeff() == 0.0);
+}
+
+TEST_CASE("Cached construction of models", "[cppinterface][cache]")
+{
+    cppinterface::clear_model_cache();
+    nlohmann::json j = {
+        {"kind", "vdW"},
+        {"model", {{"Tcrit / K", {150.687, 289.733}}, {"pcrit / Pa", {4863000.0, 5842000.0}}}}
+    };
+    // Same specification with the keys in another order
+    nlohmann::json j2 = nlohmann::json::parse(R"({"model": {"pcrit / Pa": [4863000.0, 5842000.0], "Tcrit / K": [150.687, 289.733]}, "kind": "vdW"})");
+    auto m1 = cppinterface::make_model_cached(j);
+    auto m2 = cppinterface::make_model_cached(j2);
+    CHECK(m1.get() == m2.get());
+    Eigen::ArrayXd z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    CHECK(m1->get_Ar01(300, 300, z) == make_vdW_binary()->get_Ar01(300, 300, z));
+    
+    j["model"]["Tcrit / K"][0] = 151.0;
+    auto m3 = cppinterface::make_model_cached(j);
+    CHECK(m3.get() != m1.get());
+    
+    cppinterface::clear_model_cache();
+    auto m4 = cppinterface::make_model_cached(j2);
+    CHECK(m4.get() != m1.get());
+    CHECK(m1->get_Ar01(300, 300, z) == m4->get_Ar01(300, 300, z)); // still alive after the cache was cleared
+}
+
+TEST_CASE("Snapshots of models", "[cppinterface][snapshot]")
+{
+    Eigen::ArrayXd z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    SECTION("PC-SAFT from the library"){
+        auto model = cppinterface::make_model({{"kind", "PCSAFT"}, {"model", {{"names", {"Methane", "Ethane"}}, {"kmat", {{0, 0.01}, {0.01, 0}}}}}});
+        auto restored = cppinterface::deserialize_model(model->serialize());
+        CHECK(restored->get_type_index() == model->get_type_index());
+        CHECK(restored->get_Ar01(300, 3000, z) == model->get_Ar01(300, 3000, z));
+    }
+    SECTION("SAFT-VR-Mie from the library"){
+        auto model = cppinterface::make_model({{"kind", "SAFT-VR-Mie"}, {"model", {{"names", {"Methane", "Ethane"}}}}});
+        auto restored = cppinterface::deserialize_model(model->serialize());
+        CHECK(restored->get_Ar01(300, 3000, z) == Approx(model->get_Ar01(300, 3000, z)).epsilon(1e-14));
+    }
+    SECTION("Multifluid"){
+        nlohmann::json spec = {{"components", {"Methane", "Ethane"}}, {"root", "../mycp"}, {"BIP", "../mycp/dev/mixtures/mixture_binary_pairs.json"}, {"departure", "../mycp/dev/mixtures/mixture_departure_functions.json"}};
+        auto model = cppinterface::make_model({{"kind", "multifluid"}, {"model", spec}});
+        auto restored = cppinterface::deserialize_model(model->serialize());
+        CHECK(restored->get_Ar01(300, 3000, z) == model->get_Ar01(300, 3000, z));
+    }
+    SECTION("Not supported"){
+        CHECK_THROWS_AS(make_vdW_binary()->serialize(), teqp::NotImplementedError);
+        CHECK_THROWS_AS(cppinterface::deserialize_model({0xa0}), teqp::InvalidArgument);
+    }
+}
+
+TEST_CASE("Parallel evaluation matches serial evaluation", "[cppinterface][parallel]")
+{
+    auto model = make_vdW_binary();
+    Eigen::Index M = 301;
+    Eigen::ArrayXd T = Eigen::ArrayXd::LinSpaced(M, 200, 400);
+    Eigen::ArrayXd rho = Eigen::ArrayXd::LinSpaced(M, 10, 1000);
+    EMatrixd molefrac(M, 2);
+    molefrac.col(0) = Eigen::ArrayXd::LinSpaced(M, 0.1, 0.9);
+    molefrac.col(1) = 1.0 - molefrac.col(0);
+    parallel::ParallelOptions opt; opt.Nthreads = 4; opt.chunk_size = 7;
+
+    SECTION("get_Arxy_many"){
+        auto serial = model->get_Arxy_many(0, 1, T, rho, molefrac);
+        auto par = parallel::get_Arxy_many(*model, 0, 1, T, rho, molefrac, opt);
+        CHECK((serial - par).abs().maxCoeff() == 0.0);
+    }
+    SECTION("get_fugacity_coefficients_many"){
+        EMatrixd rhovec = molefrac.colwise()*rho;
+        auto par = parallel::get_fugacity_coefficients_many(*model, T, rhovec, opt);
+        for (auto i = 0; i < M; i += 50){
+            Eigen::ArrayXd rhovec_i = rhovec.row(i).transpose();
+            auto serial = model->get_fugacity_coefficients(T(i), rhovec_i);
+            CHECK(par(i, 0) == serial(0));
+            CHECK(par(i, 1) == serial(1));
+        }
+    }
+    SECTION("get_dmBnvirdTm_matrix_many"){
+        Eigen::ArrayXd z = molefrac.row(0).transpose();
+        auto par = parallel::get_dmBnvirdTm_matrix_many(*model, 6, 3, T, z, opt);
+        REQUIRE(par.cols() == 5*4);
+        for (auto i = 0; i < M; i += 50){
+            auto Bn = model->get_Bnvir(6, T(i), z);
+            for (auto n = 2; n <= 6; ++n){
+                CHECK(par(i, (n-2)*4) == Approx(Bn[n]));
+            }
+            for (auto n = 2; n <= 4; ++n){
+                for (auto m = 1; m <= 3; ++m){
+                    CAPTURE(n); CAPTURE(m);
+                    CHECK(par(i, (n-2)*4 + m) == Approx(model->get_dmBnvirdTm(n, m, T(i), z)));
+                }
+            }
+        }
+        CHECK_THROWS(model->get_dmBnvirdTm_matrix(7, 0, 300.0, z));
+    }
+    SECTION("exceptions are propagated"){
+        CHECK_THROWS(parallel::get_Arxy_many(*model, 99, 99, T, rho, molefrac, opt));
+    }
+}
+
+TEST_CASE("Parallel tracing of isotherms matches serial tracing", "[cppinterface][parallel][traceisotherm]")
+{
+    // Methane + propane, starting from pure propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 }, pc_Pa = { 4599200, 4251200.0 }, acentric = { 0.011, 0.1521 };
+    nlohmann::json j = {
+        {"kind", "PR"},
+        {"model", {{"Tcrit / K", Tc_K}, {"pcrit / Pa", pc_Pa}, {"acentric", acentric}}}
+    };
+    auto model = cppinterface::make_model(j);
+    auto propane = canonical_PR(std::valarray<double>{Tc_K[1]}, std::valarray<double>{pc_Pa[1]}, std::valarray<double>{acentric[1]});
+
+    Eigen::ArrayXd T0 = Eigen::ArrayXd::LinSpaced(6, 220, 270);
+    EMatrixd rhovecL0 = EMatrixd::Zero(T0.size(), 2), rhovecV0 = EMatrixd::Zero(T0.size(), 2);
+    for (auto i = 0; i < T0.size(); ++i){
+        auto [rhoL, rhoV] = propane.superanc_rhoLV(T0(i));
+        rhovecL0(i, 1) = rhoL;
+        rhovecV0(i, 1) = rhoV;
+    }
+    parallel::ParallelOptions opt; opt.Nthreads = 3;
+    auto traces = parallel::trace_VLE_isotherm_binary_many(*model, T0, rhovecL0, rhovecV0, std::nullopt, opt);
+    REQUIRE(traces.size() == static_cast<std::size_t>(T0.size()));
+    for (auto i = 0; i < T0.size(); ++i){
+        Eigen::ArrayXd rhovecL = rhovecL0.row(i).transpose(), rhovecV = rhovecV0.row(i).transpose();
+        auto serial = model->trace_VLE_isotherm_binary(T0(i), rhovecL, rhovecV);
+        CHECK(traces[i] == serial);
+    }
+}
+
+TEST_CASE("Parallel tracing of critical loci matches serial tracing", "[cppinterface][parallel][crit]")
+{
+    // Argon + xenon, from the critical point of each pure fluid
+    auto model = make_vdW_binary();
+    std::valarray<double> Tc_K = { 150.687, 289.733 }, pc_Pa = { 4863000.0, 5842000.0 };
+    Eigen::ArrayXd T0(2);
+    EMatrixd rhovec0 = EMatrixd::Zero(2, 2);
+    for (auto i = 0; i < 2; ++i){
+        T0(i) = Tc_K[i];
+        rhovec0(i, i) = pc_Pa[i]/(model->get_R(Eigen::ArrayXd::Constant(2, 0.5))*Tc_K[i])/(3.0/8.0);
+    }
+    TCABOptions topt; topt.polish = true; topt.pure_endpoint_polish = true;
+    std::size_t Ncallbacks = 0;
+    std::vector<nlohmann::json> streamed(2);
+    auto callback = [&](const parallel::CriticalTraceSummary& summary, const nlohmann::json& points){
+        Ncallbacks++;
+        streamed[summary.itrace] = points;
+    };
+    parallel::ParallelOptions opt; opt.Nthreads = 2;
+    auto summaries = parallel::trace_critical_arclength_binary_many(*model, T0, rhovec0, callback, topt, opt);
+    REQUIRE(summaries.size() == 2);
+    CHECK(Ncallbacks == 2);
+    for (auto i = 0; i < 2; ++i){
+        CAPTURE(i);
+        Eigen::ArrayXd rhovec = rhovec0.row(i).transpose();
+        auto serial = model->trace_critical_arclength_binary(T0(i), rhovec, std::nullopt, topt);
+        CHECK(streamed[i] == serial);
+        const auto& s = summaries[i];
+        CHECK(s.success);
+        CHECK(s.Npoints == serial.size());
+        CHECK(s.ipure_start == i);
+        CHECK(s.ipure_end == 1 - i);
+        // The vdW critical locus of argon + xenon is continuous between the pure fluids
+        CHECK(s.connects_pures);
+        CHECK(s.T_end == Approx(Tc_K[1 - i]));
+    }
+    
+    // A starting point that refers to a missing model is rejected
+    std::vector<parallel::CriticalTraceStart> starts(1);
+    starts[0].imodel = 1; starts[0].T0 = T0(0); starts[0].rhovec0 = rhovec0.row(0).transpose();
+    CHECK_THROWS(parallel::trace_critical_arclength_binary_many({model.get()}, starts));
+}
+
+TEST_CASE("Asynchronous tracing matches synchronous tracing", "[cppinterface][async]")
+{
+    // Argon + xenon, from the critical point of argon
+    std::shared_ptr<const cppinterface::AbstractModel> model = make_vdW_binary();
+    const double T0 = 150.687;
+    Eigen::ArrayXd rhovec0 = Eigen::ArrayXd::Zero(2);
+    rhovec0(0) = 4863000.0/(model->get_R(Eigen::ArrayXd::Constant(2, 0.5))*T0)/(3.0/8.0);
+    TCABOptions topt; topt.polish = true;
+    auto serial = model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, topt);
+    
+    std::atomic<std::size_t> Nprogress{0};
+    auto job = async::trace_critical_arclength_binary(model, T0, rhovec0, topt, [&](std::size_t, const nlohmann::json&){ Nprogress++; });
+    CHECK(job.get() == serial);
+    CHECK(!job.is_cancelled());
+    CHECK(job.get_step_count() == serial.size());
+    CHECK(Nprogress == serial.size());
+    
+    // Stopped after three points by the callback of the options
+    auto topt3 = topt;
+    auto Npoints = std::make_shared<int>(0);
+    topt3.step_callback = [Npoints](const nlohmann::json&){ return ++(*Npoints) < 3; };
+    auto job3 = async::trace_critical_arclength_binary(model, T0, rhovec0, topt3);
+    REQUIRE(job3.get().size() == 3);
+    CHECK(job3.get()[2] == serial[2]);
+    
+    // A job cancelled before it starts, while the only worker of the pool is busy
+    async::ThreadPool pool(1);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    pool.submit([released](){ released.wait(); });
+    auto cancelled = async::trace_critical_arclength_binary(model, T0, rhovec0, topt, {}, pool);
+    cancelled.cancel();
+    CHECK(!cancelled.is_ready());
+    release.set_value();
+    CHECK(cancelled.get().empty());
+    CHECK(cancelled.is_cancelled());
+    CHECK(cancelled.get_step_count() == 0);
+    
+    // Isotherms, with the output of revision 2
+    auto propane = canonical_PR(std::valarray<double>{369.89}, std::valarray<double>{4251200.0}, std::valarray<double>{0.1521});
+    std::shared_ptr<const cppinterface::AbstractModel> PR = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+    auto [rhoL, rhoV] = propane.superanc_rhoLV(250.0);
+    Eigen::ArrayXd rhovecL = (Eigen::ArrayXd(2) << 0, rhoL).finished(), rhovecV = (Eigen::ArrayXd(2) << 0, rhoV).finished();
+    TVLEOptions vopt; vopt.revision = 2;
+    auto isotherm = async::trace_VLE_isotherm_binary(PR, 250.0, rhovecL, rhovecV, vopt);
+    CHECK(isotherm.get() == PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV, vopt));
+    
+    // Errors are re-thrown by get()
+    vopt.revision = 7;
+    CHECK_THROWS_AS(async::trace_VLE_isotherm_binary(PR, 250.0, rhovecL, rhovecV, vopt), teqp::InvalidArgument);
+    std::vector<nlohmann::json> malformed = {nlohmann::json::array({{{"T / K", 250.0}}})};
+    auto failing = async::find_VLLE_T_binary(PR, malformed);
+    CHECK_THROWS(failing.get());
+}
+
+TEST_CASE("Prepared composition gives the same values as the model", "[cppinterface][prepared]")
+{
+    nlohmann::json j = {
+        {"kind", "PR"},
+        {"model", {{"Tcrit / K", {190.564, 305.32}}, {"pcrit / Pa", {4599200.0, 4872200.0}}, {"acentric", {0.011, 0.099}}, {"kmat", {{0.0, 0.01}, {0.01, 0.0}}}}}
+    };
+    auto model = cppinterface::make_model(j);
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    auto prepared = model->prepare_composition(z);
+    double T = 250, rho = 3000;
+    for (auto [NT, ND] : std::vector<std::pair<int,int>>{{0,0}, {0,1}, {1,0}, {1,1}, {2,0}, {0,2}}){
+        CAPTURE(NT, ND);
+        CHECK(prepared->get_Arxy(NT, ND, T, rho, z) == Approx(model->get_Arxy(NT, ND, T, rho, z)));
+    }
+    auto z2 = (Eigen::ArrayXd(2) << 0.5, 0.5).finished();
+    CHECK(prepared->get_Ar01(T, rho, z2) == Approx(model->get_Ar01(T, rho, z2)));
+    auto rhovec = (rho*z).eval();
+    CHECK(prepared->get_fugacity_coefficients(T, rhovec)[1] == Approx(model->get_fugacity_coefficients(T, rhovec)[1]));
+    
+    // Without interaction parameters, the attractive parameter of the prepared model is the square of a dot product
+    j["model"]["kmat"] = {{0.0, 0.0}, {0.0, 0.0}};
+    auto model0 = cppinterface::make_model(j);
+    auto prepared0 = model0->prepare_composition(z);
+    for (auto [NT, ND] : std::vector<std::pair<int,int>>{{0,0}, {1,1}, {2,0}}){
+        CAPTURE(NT, ND);
+        CHECK(prepared0->get_Arxy(NT, ND, T, rho, z) == Approx(model0->get_Arxy(NT, ND, T, rho, z)).epsilon(1e-12));
+    }
+    
+    // The pairs are summed over the upper triangle, so an asymmetric kmat is rejected
+    j["model"]["kmat"] = {{0.0, 0.01}, {0.02, 0.0}};
+    auto modelasym = cppinterface::make_model(j);
+    CHECK_THROWS_AS(modelasym->prepare_composition(z), teqp::InvalidArgument);
+    
+    // CPA, with a mixture of two associating fluids
+    nlohmann::json water = {
+        {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+        {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class","4C"}
+    };
+    nlohmann::json methanol = {
+        {"a0i / Pa m^6/mol^2",0.40531 }, {"bi / m^3/mol", 0.0000309}, {"c1", 0.4310}, {"Tc / K", 513.0},
+        {"epsABi / J/mol", 24591.0}, {"betaABi", 0.0161}, {"class","2B"}
+    };
+    auto CPA = cppinterface::make_model({{"kind", "CPA"}, {"model", {{"cubic","SRK"}, {"pures", {water, methanol}}, {"R_gas / J/mol/K", 8.3144598}}}});
+    auto preparedCPA = CPA->prepare_composition(z);
+    for (auto [NT, ND] : std::vector<std::pair<int,int>>{{0,0}, {0,1}, {1,0}, {0,2}}){
+        CAPTURE(NT, ND);
+        CHECK(preparedCPA->get_Arxy(NT, ND, 400, 20000, z) == Approx(CPA->get_Arxy(NT, ND, 400, 20000, z)).epsilon(1e-12));
+    }
+    CHECK(preparedCPA->get_Ar01(400, 20000, z2) == Approx(CPA->get_Ar01(400, 20000, z2)).epsilon(1e-12));
+    
+    // Models without caching still return a valid model
+    auto vdW = make_vdW_binary();
+    auto preparedvdW = vdW->prepare_composition(z);
+    CHECK(preparedvdW->get_Ar01(T, rho, z) == Approx(vdW->get_Ar01(T, rho, z)));
+}
+
+TEST_CASE("Profiled model gives the same values and counts the calls", "[cppinterface][profile]")
+{
+    auto plain = make_vdW_binary();
+    nlohmann::json j = {
+        {"kind", "vdW"},
+        {"model", {{"Tcrit / K", {150.687, 289.733}}, {"pcrit / Pa", {4863000.0, 5842000.0}}}},
+        {"profile", true}
+    };
+    auto model = cppinterface::make_model(j);
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    double T = 250, rho = 3000;
+    for (auto i = 0; i < 10; ++i){
+        CHECK(model->get_Arxy(1, 2, T, rho, z) == plain->get_Arxy(1, 2, T, rho, z));
+    }
+    CHECK(model->get_Ar01(T, rho, z) == plain->get_Ar01(T, rho, z));
+    auto prepared = model->prepare_composition(z);
+    CHECK(prepared->get_Arxy(0, 1, T, rho, z) == Approx(plain->get_Arxy(0, 1, T, rho, z)));
+    
+    auto profile = cppinterface::get_profile(*model);
+    const auto& Arxy = profile.at("methods").at("get_Arxy");
+    CHECK(Arxy.at("calls") == 11);
+    CHECK(Arxy.at("orders").at("1,2") == 10);
+    CHECK(Arxy.at("orders").at("0,1") == 1);
+    CHECK(Arxy.at("max / s").get<double>() >= Arxy.at("p50 / s").get<double>());
+    CHECK(profile.at("methods").at("get_Ar01").at("calls") == 1);
+    CHECK(profile.at("methods").at("prepare_composition").at("calls") == 1);
+    CHECK(!profile.at("methods").contains("get_B2vir"));
+    CHECK(profile.at("threads") == 1);
+    
+    cppinterface::reset_profile(*prepared);
+    CHECK(cppinterface::get_profile(*model).at("methods").empty());
+    
+    // The model can be reached through the decorator
+    CHECK_NOTHROW(cppinterface::adapter::get_model_cref<vdWEOS<double>>(model.get()));
+    CHECK(model->get_type_index() == plain->get_type_index());
+    CHECK_THROWS_AS(cppinterface::get_profile(*plain), teqp::InvalidArgument);
+}
+
+TEST_CASE("Buffer version of build_Psir_fgradHessian_autodiff", "[cppinterface][workspace]")
+{
+    auto model = make_vdW_binary();
+    double T = 300;
+    auto rhovec = (Eigen::ArrayXd(2) << 300, 700).finished();
+    auto [Psir, grad, H] = model->build_Psir_fgradHessian_autodiff(T, rhovec);
+    
+    double Psir_; Eigen::ArrayXd grad_(2); Eigen::MatrixXd H_(2, 2);
+    for (auto repeat = 0; repeat < 2; ++repeat){
+        model->build_Psir_fgradHessian_autodiff(T, rhovec, Psir_, grad_, H_);
+        CHECK(Psir_ == Approx(Psir));
+        CHECK((grad_ - grad).abs().maxCoeff() < 1e-10*grad.abs().maxCoeff());
+        CHECK((H_ - H).array().abs().maxCoeff() < 1e-10*H.array().abs().maxCoeff());
+    }
+    
+    // The fused version also gives the Hessian of the total Helmholtz energy density
+    Eigen::MatrixXd Htot_(2, 2);
+    model->build_Psi_fgradHessian_autodiff(T, rhovec, Psir_, grad_, H_, Htot_);
+    Eigen::MatrixXd Htot = model->build_Psi_Hessian_autodiff(T, rhovec).matrix();
+    CHECK(Psir_ == Approx(Psir));
+    CHECK((H_ - H).array().abs().maxCoeff() < 1e-10*H.array().abs().maxCoeff());
+    CHECK((Htot_ - Htot).array().abs().maxCoeff() < 1e-10*Htot.array().abs().maxCoeff());
+    
+    // At infinite dilution, both give an infinite diagonal entry for the absent component, and agree elsewhere
+    auto rhovec0 = (Eigen::ArrayXd(2) << 0.0, 700).finished();
+    model->build_Psi_fgradHessian_autodiff(T, rhovec0, Psir_, grad_, H_, Htot_);
+    Htot = model->build_Psi_Hessian_autodiff(T, rhovec0).matrix();
+    CHECK(std::isinf(Htot_(0, 0)));
+    CHECK(std::isinf(Htot(0, 0)));
+    CHECK(Htot_(0, 1) == Approx(Htot(0, 1)));
+    CHECK(Htot_(1, 0) == Approx(Htot(1, 0)));
+    CHECK(Htot_(1, 1) == Approx(Htot(1, 1)));
+}
+
+TEST_CASE("Fixed-size adapters give the same values as the dynamic one", "[cppinterface][fixedsize]")
+{
+    std::valarray<double> Tc_K = {150.687, 289.733}, pc_Pa = {4863000.0, 5842000.0};
+    vdWEOS<double> vdW(Tc_K, pc_Pa);
+    auto dyn = cppinterface::adapter::make_owned(vdW);
+    auto fixed = cppinterface::adapter::make_owned_fixedsize(vdW, 2);
+    
+    double T = 300, rho = 1000;
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    auto rhovec = (rho*z).eval();
+    CHECK(fixed->get_Ar11(T, rho, z) == Approx(dyn->get_Ar11(T, rho, z)));
+    CHECK(fixed->get_B2vir(T, z) == Approx(dyn->get_B2vir(T, z)));
+    CHECK(fixed->get_pr(T, rhovec) == Approx(dyn->get_pr(T, rhovec)));
+    CHECK(fixed->get_fugacity_coefficients(T, rhovec)[0] == Approx(dyn->get_fugacity_coefficients(T, rhovec)[0]));
+    auto Hfixed = fixed->build_Psir_Hessian_autodiff(T, rhovec), Hdyn = dyn->build_Psir_Hessian_autodiff(T, rhovec);
+    CHECK((Hfixed - Hdyn).abs().maxCoeff() < 1e-10*Hdyn.abs().maxCoeff());
+    
+    // The templated model can still be recovered from the fixed-size adapter
+    CHECK_NOTHROW(cppinterface::adapter::get_model_cref<vdWEOS<double>>(fixed.get()));
+    // Arguments of the wrong length are rejected
+    auto z3 = (Eigen::ArrayXd(3) << 0.3, 0.3, 0.4).finished();
+    CHECK_THROWS_AS(fixed->get_Ar01(T, rho, z3), teqp::InvalidArgument);
+}
+
+TEST_CASE("Batched Newton-Raphson iteration matches the scalar iterator", "[cppinterface][NRIterator]")
+{
+    std::shared_ptr<cppinterface::AbstractModel> ar = make_vdW_binary();
+    nlohmann::json jpure = {{"R", 8.31446261815324}, {"terms", {
+        {{"type", "Lead"}, {"a_1", 1.0}, {"a_2", 200.0}},
+        {{"type", "LogT"}, {"a", -2.5}}
+    }}};
+    std::shared_ptr<cppinterface::AbstractModel> aig = cppinterface::make_model({{"kind", "IdealHelmholtz"}, {"model", {jpure, jpure}}});
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    
+    // Supercritical states, and the target values obtained with the scalar iterator at these states
+    Eigen::Index M = 6;
+    Eigen::ArrayXd T = Eigen::ArrayXd::LinSpaced(M, 350, 600), rho = Eigen::ArrayXd::LinSpaced(M, 100, 3000);
+    for (std::vector<char> vars : {std::vector<char>{'P','S'}, std::vector<char>{'H','P'}, std::vector<char>{'T','U'}}){
+        Eigen::ArrayXXd vals(M, 2);
+        for (auto i = 0; i < M; ++i){
+            auto Ar = ar->get_deriv_mat2(T(i), rho(i), z), Aig = aig->get_deriv_mat2(T(i), rho(i), z);
+            vals.row(i) = iteration::build_iteration_Jv(vars, Ar, Aig, ar->get_R(z), T(i), rho(i), z).v.transpose();
+        }
+        Eigen::ArrayXd T0 = T*1.05, rho0 = rho*0.95;
+        iteration::NRIteratorMany many(ar, aig, vars, vals, T0, rho0, z);
+        CHECK(many.take_steps(30) == 0);
+        for (auto i = 0; i < M; ++i){
+            CAPTURE(vars[0], vars[1], i);
+            CHECK(many.get_status()[i] == iteration::NRIteratorMany::status_t::converged);
+            CHECK(many.get_T()(i) == Approx(T(i)).epsilon(1e-10));
+            CHECK(many.get_rho()(i) == Approx(rho(i)).epsilon(1e-10));
+            
+            Eigen::ArrayXd vali = vals.row(i).transpose();
+            iteration::NRIterator scalar(ar, aig, vars, vali, T0(i), rho0(i), z);
+            scalar.take_steps(10);
+            CHECK(many.get_T()(i) == Approx(scalar.get_T()).epsilon(1e-12));
+            CHECK(many.get_rho()(i) == Approx(scalar.get_rho()).epsilon(1e-12));
+        }
+    }
+    
+    // Only two variables can be specified
+    Eigen::ArrayXXd vals3 = Eigen::ArrayXXd::Ones(M, 3);
+    CHECK_THROWS_AS(iteration::NRIteratorMany(ar, aig, {'T','D','P'}, vals3, T, rho, z), teqp::InvalidArgument);
+}
+
+TEST_CASE("Fixed-size build_iteration_Jv matches the dynamic one for all pairs of variables", "[cppinterface][NRIterator]")
+{
+    auto model = make_vdW_binary();
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    double T = 400, rho = 1000, R = model->get_R(z);
+    auto Ar = model->get_deriv_mat2(T, rho, z);
+    Eigen::Array<double, 3, 3> Aig = Eigen::Array<double, 3, 3>::Random();
+    for (char var0 : std::string("TDPSUH")){
+        for (char var1 : std::string("TDPSUH")){
+            std::vector<char> vars = {var0, var1};
+            CAPTURE(var0, var1);
+            auto im = cppinterface::build_iteration_Jv(vars, Ar, Aig, R, T, rho, z);
+            auto im2 = cppinterface::get_iteration_Jv_function(vars)(Ar, Aig, R, T, rho);
+            CHECK((im.J - im2.J).abs().maxCoeff() == 0);
+            CHECK((im.v - im2.v).abs().maxCoeff() == 0);
+        }
+    }
+    CHECK_THROWS(cppinterface::get_iteration_Jv_function({'P'}));
+    CHECK_THROWS(cppinterface::get_iteration_Jv_function({'P', 'X'}));
+}
+
+TEST_CASE("Property bundle matches the properties from the iteration Jacobian", "[cppinterface][properties]")
+{
+    auto ar = make_vdW_binary();
+    nlohmann::json jpure = {{"R", 8.31446261815324}, {"terms", {
+        {{"type", "Lead"}, {"a_1", 1.0}, {"a_2", 200.0}},
+        {{"type", "LogT"}, {"a", -2.5}}
+    }}};
+    auto aig = cppinterface::make_model({{"kind", "IdealHelmholtz"}, {"model", {jpure, jpure}}});
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    double T = 400, rho = 1000, R = ar->get_R(z);
+    
+    auto b = ar->get_property_bundle(T, rho, z, cppinterface::properties::all, aig.get());
+    auto im = cppinterface::build_iteration_Jv({'P', 'H', 'S', 'U'}, ar->get_deriv_mat2(T, rho, z), aig->get_deriv_mat2(T, rho, z), R, T, rho, z);
+    CHECK(b.p == Approx(im.v(0)));
+    CHECK(b.h == Approx(im.v(1)));
+    CHECK(b.s == Approx(im.v(2)));
+    CHECK(b.u == Approx(im.v(3)));
+    // From the derivatives of p, h and s w.r.t. T and rho
+    double dpdT = im.J(0, 0), dpdrho = im.J(0, 1), dhdT = im.J(1, 0), dhdrho = im.J(1, 1);
+    CHECK(b.cv == Approx(T*im.J(2, 0)));
+    CHECK(b.cp == Approx(dhdT - dhdrho*dpdT/dpdrho));
+    CHECK(b.M_w2 == Approx(b.cp/b.cv*dpdrho));
+    CHECK(b.JT == Approx(1.0/(dpdT - dpdrho*dhdT/dhdrho)));
+    CHECK(b.neff == Approx(ar->get_neff(T, rho, z)));
+    
+    // Only the requested properties are calculated, and the residual ones do not need the ideal-gas model
+    auto bp = ar->get_property_bundle(T, rho, z, cppinterface::properties::p | cppinterface::properties::neff);
+    CHECK(bp.p == Approx(b.p));
+    CHECK(bp.neff == Approx(b.neff));
+    CHECK(std::isnan(bp.h));
+    CHECK_THROWS_AS(ar->get_property_bundle(T, rho, z, cppinterface::properties::cp), teqp::InvalidArgument);
+    CHECK_THROWS_AS(ar->get_property_bundle(T, rho, z, 1u << 20), teqp::InvalidArgument);
+}
+
+TEST_CASE("Parallel solution of pure critical points", "[cppinterface][parallel]")
+{
+    // Critical points of the van der Waals model are known analytically
+    const double R = 8.31446261815324;
+    std::size_t M = 20;
+    std::vector<nlohmann::json> specs;
+    Eigen::ArrayXd Tc(M), pc(M), T0(M), rho0(M);
+    for (auto i = 0U; i < M; ++i){
+        Tc(i) = 150 + 20*i;
+        pc(i) = 3e6 + 1e5*i;
+        specs.push_back({{"kind", "vdW"}, {"model", {{"Tcrit / K", {Tc(i)}}, {"pcrit / Pa", {pc(i)}}}}});
+    }
+    Eigen::ArrayXd rhoc = 8*pc/(3*R*Tc);
+    T0 = 1.02*Tc;
+    rho0 = 0.95*rhoc;
+    
+    parallel::ParallelOptions opt; opt.Nthreads = 4; opt.chunk_size = 3;
+    auto results = parallel::solve_pure_critical_many(specs, T0, rho0, std::nullopt, 0.9, opt);
+    
+    std::vector<std::unique_ptr<cppinterface::AbstractModel>> owned;
+    std::vector<const cppinterface::AbstractModel*> models;
+    for (const auto& spec : specs){
+        owned.push_back(cppinterface::make_model(spec));
+        models.push_back(owned.back().get());
+    }
+    auto results2 = parallel::solve_pure_critical_many(models, T0, rho0, std::nullopt, 0.9, opt);
+    
+    REQUIRE(results.size() == M);
+    for (auto i = 0U; i < M; ++i){
+        CAPTURE(i, results[i].message);
+        CHECK(results[i].imodel == i);
+        CHECK(results[i].success);
+        CHECK(results[i].Tc == Approx(Tc(i)).epsilon(1e-6));
+        CHECK(results[i].rhoc == Approx(rhoc(i)).epsilon(1e-6));
+        CHECK(results[i].rhoLV.size() == 2);
+        CHECK(results[i].Tc == results2[i].Tc);
+        CHECK(results[i].rhoc == results2[i].rhoc);
+        auto [Tcs, rhocs] = models[i]->solve_pure_critical(T0(i), rho0(i));
+        CHECK(results[i].Tc == Tcs);
+    }
+    
+    // Failures are reported per model, without stopping the others
+    specs[1] = {{"kind", "not a model"}};
+    auto results3 = parallel::solve_pure_critical_many(specs, T0, rho0, std::nullopt, std::nullopt, opt);
+    CHECK(!results3[1].success);
+    CHECK(!results3[1].message.empty());
+    CHECK(results3[2].success);
+    CHECK(results3[2].rhoLV.size() == 0);
+    
+    CHECK_THROWS_AS(parallel::solve_pure_critical_many(specs, T0.head(3), rho0, std::nullopt, std::nullopt, opt), teqp::InvalidArgument);
+}
+
+TEST_CASE("Trace sinks store the points of the streaming tracers", "[cppinterface][tracesink]")
+{
+    auto propane = canonical_PR(std::valarray<double>{369.89}, std::valarray<double>{4251200.0}, std::valarray<double>{0.1521});
+    auto PR = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+    auto [rhoL, rhoV] = propane.superanc_rhoLV(250.0);
+    Eigen::ArrayXd rhovecL = (Eigen::ArrayXd(2) << 0, rhoL).finished(), rhovecV = (Eigen::ArrayXd(2) << 0, rhoV).finished();
+    auto J = PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV);
+    REQUIRE(J.size() > 8);
+
+    for (auto format : {tracesink::Format::columnar, tracesink::Format::ndjson}){
+        CAPTURE(static_cast<int>(format));
+        const std::string path = (std::filesystem::temp_directory_path() / ((format == tracesink::Format::columnar) ? "teqp_isoT_sink.bin" : "teqp_isoT_sink.ndjson")).string();
+        tracesink::SinkOptions opt;
+        opt.format = format;
+        opt.block_rows = 5; // Several blocks, the last one partial
+        opt.initial_bytes = 64; // And the mapping grows
+        {
+            tracesink::TraceSink sink(path, tracesink::VLE_trace_schema(2), opt);
+            auto reason = trace_VLE_isotherm_binary(*PR, 250.0, rhovecL, rhovecV, sink.VLE_callback());
+            CHECK(reason.empty());
+            CHECK(sink.get_row_count() == J.size());
+        }
+        auto data = tracesink::read_trace(path);
+        REQUIRE(static_cast<std::size_t>(data.data.rows()) == J.size());
+        auto pL = data.get("pL");
+        auto rhoLs = data.get("rhovecL");
+        for (auto i = 0U; i < J.size(); ++i){
+            CHECK(pL(i, 0) == J[i].at("pL / Pa").get<double>());
+            CHECK(rhoLs(i, 1) == J[i].at("rhoL / mol/m^3")[1].get<double>());
+        }
+        CHECK_THROWS_AS(data.get("nonexistent"), teqp::InvalidArgument);
+        std::filesystem::remove(path);
+    }
+
+    // The JSON points of the critical tracer, through the step callback
+    auto model = make_vdW_binary();
+    const double T0 = 150.687;
+    Eigen::ArrayXd rhovec0 = Eigen::ArrayXd::Zero(2);
+    rhovec0(0) = 4863000.0/(model->get_R(Eigen::ArrayXd::Constant(2, 0.5))*T0)/(3.0/8.0);
+    auto crit = model->trace_critical_arclength_binary(T0, rhovec0);
+    REQUIRE(!crit.empty());
+    auto schema = tracesink::json_schema(crit[0]);
+    REQUIRE(schema.row_width() > 0);
+    const auto crit_path = (std::filesystem::temp_directory_path() / "teqp_crit_sink.bin").string();
+    {
+        tracesink::TraceSink sink(crit_path, schema);
+        TCABOptions topt; topt.step_callback = sink.json_callback();
+        auto crit2 = model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, topt);
+        CHECK(sink.get_row_count() == crit2.size());
+        // Once flushed, the rows can be read while the sink is open
+        sink.flush();
+        CHECK(static_cast<std::size_t>(tracesink::read_trace(crit_path).data.rows()) == crit2.size());
+        sink.close();
+        CHECK_THROWS_AS(sink.append(crit2[0]), teqp::InvalidArgument);
+    }
+    auto data = tracesink::read_trace(crit_path);
+    std::filesystem::remove(crit_path);
+    REQUIRE(static_cast<std::size_t>(data.data.rows()) == crit.size());
+    CHECK(data.get("T / K")(0, 0) == crit[0].at("T / K").get<double>());
+}
+
+TEST_CASE("Columnar trace files round trip with a schema whose length is a multiple of 8", "[cppinterface][tracesink]")
+{
+    // No zero padding follows the schema, so that the first block count comes right after it
+    tracesink::Schema schema;
+    for (std::size_t k = 0; k < 8; ++k){
+        schema.columns = {{"x" + std::string(k, 'a'), 1}, {"y", 2}};
+        if (schema.to_json().dump().size() % 8 == 0){ break; }
+    }
+    REQUIRE(schema.to_json().dump().size() % 8 == 0);
+    tracesink::SinkOptions opt;
+    opt.block_rows = 2; // The last block is partial
+    const auto path = (std::filesystem::temp_directory_path() / "teqp_schema8_sink.bin").string();
+    {
+        tracesink::TraceSink sink(path, schema, opt);
+        for (auto i = 0; i < 3; ++i){
+            const double row[3] = {1.0*i, 10.0*i, 100.0*i};
+            sink.append(row);
+        }
+        // Also while open, after a flush of the partial block
+        sink.flush();
+        CHECK(tracesink::read_trace(path).data.rows() == 3);
+    }
+    auto data = tracesink::read_trace(path);
+    std::filesystem::remove(path);
+    REQUIRE(data.data.rows() == 3);
+    CHECK(data.schema.columns[0].name == schema.columns[0].name);
+    CHECK(data.get("y")(2, 1) == 200.0);
+}
+
+TEST_CASE("Traces resumed from a checkpoint continue the uninterrupted trace", "[cppinterface][checkpoint]")
+{
+    SECTION("Critical locus"){
+        auto model = make_vdW_binary();
+        const double T0 = 150.687;
+        Eigen::ArrayXd rhovec0 = Eigen::ArrayXd::Zero(2);
+        rhovec0(0) = 4863000.0/(model->get_R(Eigen::ArrayXd::Constant(2, 0.5))*T0)/(3.0/8.0);
+        TCABOptions opt; opt.checkpoint = true;
+        auto full = model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, opt);
+        REQUIRE(full.size() > 10);
+
+        auto first_opt = opt; first_opt.max_step_count = 5;
+        auto first = model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, first_opt);
+        REQUIRE(first.size() == 6);
+        CHECK(first.back().at("checkpoint").at("Nsteps") == 5);
+
+        // Through JSON, as when the trace is split across jobs
+        auto second_opt = opt; second_opt.resume = TraceCheckpoint::from_json(nlohmann::json::parse(first.back().at("checkpoint").dump()));
+        auto second = model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, second_opt);
+        REQUIRE(first.size() + second.size() == full.size());
+        for (auto i = 0U; i < second.size(); ++i){
+            CHECK(second[i].at("T / K").get<double>() == Approx(full[i + 6].at("T / K").get<double>()).epsilon(1e-12));
+            CHECK(second[i].at("t").get<double>() == Approx(full[i + 6].at("t").get<double>()).epsilon(1e-12));
+        }
+
+        // A checkpoint of another tracer is rejected
+        auto wrong = second_opt; wrong.resume->tracer = "VLE isotherm";
+        CHECK_THROWS_AS(model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, wrong), teqp::InvalidArgument);
+    }
+    SECTION("VLE isotherm"){
+        auto propane = canonical_PR(std::valarray<double>{369.89}, std::valarray<double>{4251200.0}, std::valarray<double>{0.1521});
+        auto PR = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+        auto [rhoL, rhoV] = propane.superanc_rhoLV(250.0);
+        Eigen::ArrayXd rhovecL = (Eigen::ArrayXd(2) << 0, rhoL).finished(), rhovecV = (Eigen::ArrayXd(2) << 0, rhoV).finished();
+        TVLEOptions opt; opt.checkpoint = true;
+        auto full = PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV, opt);
+        REQUIRE(full.size() > 10);
+
+        auto first_opt = opt; first_opt.max_steps = 7;
+        auto first = PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV, first_opt);
+        REQUIRE(first.size() == 8);
+
+        auto second_opt = opt; second_opt.resume = TraceCheckpoint::from_json(first.back().at("checkpoint"));
+        auto second = PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV, second_opt);
+        REQUIRE(first.size() + second.size() == full.size());
+        for (auto i = 0U; i < second.size(); ++i){
+            CHECK(second[i].at("pL / Pa").get<double>() == Approx(full[i + 8].at("pL / Pa").get<double>()).epsilon(1e-12));
+            CHECK(second[i].at("checkpoint").at("Nsteps") == full[i + 8].at("checkpoint").at("Nsteps"));
+        }
+
+        PVLEOptions popt; popt.resume = second_opt.resume;
+        CHECK_THROWS_AS(PR->trace_VLE_isobar_binary(1e6, 250.0, rhovecL, rhovecV, popt), teqp::InvalidArgument);
+    }
+}
+
+TEST_CASE("Virial fast path gives the residual derivatives of the model at low density", "[cppinterface][virial]")
+{
+    nlohmann::json PR = {{"type", "PR"}, {"Tcrit / K", {190.564, 305.32}}, {"pcrit / Pa", {4599200, 4872200}}, {"acentric", {0.011, 0.099}}};
+    auto plain = cppinterface::make_model({{"kind", "cubic"}, {"model", PR}});
+    auto model = cppinterface::make_model({{"kind", "cubic"}, {"model", PR}, {"virial", {{"Nvir", 5}, {"atol", 1e-15}}}});
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    double T = 300;
+
+    double rho_thr = cppinterface::get_virial_threshold(*model, 0, 0, T, z);
+    CHECK(rho_thr > 0);
+    CHECK(cppinterface::get_virial_threshold(*model, 2, 4, T, z) < rho_thr);
+    CHECK(cppinterface::get_virial_threshold(*model, 0, 6, T, z) == 0);
+
+    for (double rho : {1e-3, 0.5*rho_thr, 0.99*cppinterface::get_virial_threshold(*model, 2, 4, T, z)}){
+        CAPTURE(rho);
+        for (auto i = 0; i <= 2; ++i){
+            for (auto j = 0; j <= 4; ++j){
+                CAPTURE(i); CAPTURE(j);
+                CHECK(model->get_Arxy(i, j, T, rho, z) == Approx(plain->get_Arxy(i, j, T, rho, z)).margin(1e-14));
+            }
+        }
+        CHECK(model->get_Ar12(T, rho, z) == Approx(plain->get_Ar12(T, rho, z)).margin(1e-14));
+        auto Ar0n = model->get_Ar04n(T, rho, z), Ar0n_plain = plain->get_Ar04n(T, rho, z);
+        CHECK((Ar0n - Ar0n_plain).abs().maxCoeff() < 1e-14);
+        auto mat = model->get_deriv_mat2(T, rho, z), mat_plain = plain->get_deriv_mat2(T, rho, z);
+        for (auto [i, j] : std::vector<std::pair<int, int>>{{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {2, 0}}){
+            CHECK(mat(i, j) == Approx(mat_plain(i, j)).margin(1e-14));
+        }
+    }
+
+    // Dense states, and orders beyond the series, are those of the model
+    CHECK(model->get_Ar01(T, 5000, z) == plain->get_Ar01(T, 5000, z));
+    CHECK(model->get_Ar01(400, 5000, z) == plain->get_Ar01(400, 5000, z));
+    CHECK(model->get_Arxy(0, 6, T, 1.0, z) == plain->get_Arxy(0, 6, T, 1.0, z));
+
+    // Batched versions, with the states below the threshold and those above it interleaved
+    Eigen::ArrayXd Ts(4), rhos(4);
+    Ts << 300, 300, 350, 350;
+    rhos << 0.5*rho_thr, 5000, 1.0, 8000;
+    Eigen::ArrayXXd molefrac(4, 2);
+    molefrac.col(0) << 0.3, 0.3, 0.6, 0.6;
+    molefrac.col(1) = 1 - molefrac.col(0);
+    auto many = model->get_Arxy_many(1, 2, Ts, rhos, molefrac), many_plain = plain->get_Arxy_many(1, 2, Ts, rhos, molefrac);
+    auto many0n = model->get_Ar0n_many(3, Ts, rhos, molefrac), many0n_plain = plain->get_Ar0n_many(3, Ts, rhos, molefrac);
+    for (auto k = 0; k < Ts.size(); ++k){
+        CHECK(many(k) == Approx(many_plain(k)).margin(1e-14));
+        for (auto j = 0; j <= 3; ++j){
+            CHECK(many0n(k, j) == Approx(many0n_plain(k, j)).margin(1e-14));
+        }
+    }
+
+    // The prepared model keeps the fast path, and the model can be reached through the decorator
+    auto prepared = model->prepare_composition(z);
+    CHECK(prepared->get_Ar11(T, 1.0, z) == Approx(plain->get_Ar11(T, 1.0, z)).margin(1e-14));
+    CHECK(cppinterface::get_virial_threshold(*prepared, 0, 0, T, z) == Approx(rho_thr));
+    CHECK(model->get_type_index() == plain->get_type_index());
+    CHECK_THROWS_AS(cppinterface::get_virial_threshold(*plain, 0, 0, T, z), teqp::InvalidArgument);
+    CHECK_THROWS_AS(cppinterface::make_virial_model(cppinterface::make_model({{"kind", "cubic"}, {"model", PR}}), {6, 1e-15}), teqp::InvalidArgument);
+}
+
+TEST_CASE("Pseudo-arclength continuation follows a circle", "[continuation]")
+{
+    auto residual = [](const Eigen::VectorXd& x){ return (Eigen::VectorXd(1) << x.squaredNorm() - 1).finished(); };
+    auto jacobian = [](const Eigen::VectorXd& x) -> Eigen::MatrixXd { return 2*x.transpose(); };
+    continuation::PseudoArclength pc(residual, jacobian);
+    pc.start((Eigen::VectorXd(2) << 1, 0).finished(), (Eigen::VectorXd(2) << 0, 1).finished());
+    CHECK(pc.get_t()(1) == Approx(1));
+    double s = 0, ds = 0.01;
+    while (s < 3){
+        double h = pc.step(ds, 0.2);
+        REQUIRE(h > 0);
+        s += h;
+        CHECK(std::abs(pc.get_x().norm() - 1) < 1e-9);
+    }
+    // The pseudo-arclength is close to the arclength, the angle on the unit circle
+    CHECK(std::atan2(pc.get_x()(1), pc.get_x()(0)) == Approx(s).epsilon(1e-2));
+    CHECK(pc.num_rejected == 0);
+}
+
+TEST_CASE("Predictor-corrector mode of the tracers", "[cppinterface][continuation]")
+{
+    SECTION("Critical locus"){
+        auto model = make_vdW_binary();
+        const double T0 = 150.687;
+        Eigen::ArrayXd rhovec0 = Eigen::ArrayXd::Zero(2);
+        rhovec0(0) = 4863000.0/(model->get_R(Eigen::ArrayXd::Constant(2, 0.5))*T0)/(3.0/8.0);
+        TCABOptions opt; opt.predictor_corrector = PredictorCorrectorOptions{};
+        auto trace = model->trace_critical_arclength_binary(T0, rhovec0, std::nullopt, opt);
+        REQUIRE(trace.size() > 10);
+        for (auto& pt : trace){
+            Eigen::ArrayXd rhovec = (Eigen::ArrayXd(2) << pt.at("rho0 / mol/m^3").get<double>(), pt.at("rho1 / mol/m^3").get<double>()).finished();
+            // Small compared with the value of the condition off the locus
+            const double T = pt.at("T / K").get<double>();
+            CHECK(std::abs(model->get_criticality_conditions(T, rhovec)(0)) < 1e-6*std::abs(model->get_criticality_conditions(1.01*T, rhovec)(0)));
+        }
+        // The locus ends at the critical point of the other pure fluid, as with the ODE
+        CHECK(trace.back().at("T / K").get<double>() == Approx(289.733).epsilon(1e-6));
+    }
+    SECTION("VLE isotherm"){
+        auto propane = canonical_PR(std::valarray<double>{369.89}, std::valarray<double>{4251200.0}, std::valarray<double>{0.1521});
+        auto PR = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+        auto [rhoL, rhoV] = propane.superanc_rhoLV(250.0);
+        Eigen::ArrayXd rhovecL = (Eigen::ArrayXd(2) << 0, rhoL).finished(), rhovecV = (Eigen::ArrayXd(2) << 0, rhoV).finished();
+        TVLEOptions opt;
+        auto ode = PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV, opt);
+        opt.predictor_corrector = PredictorCorrectorOptions{};
+        auto pc = PR->trace_VLE_isotherm_binary(250.0, rhovecL, rhovecV, opt);
+        REQUIRE(pc.size() > 10);
+        for (auto& pt : pc){
+            CHECK(pt.at("pL / Pa").get<double>() == Approx(pt.at("pV / Pa").get<double>()).epsilon(1e-8));
+        }
+        // Both traces end close to the mixture critical point
+        CHECK(pc.back().at("pL / Pa").get<double>() == Approx(ode.back().at("pL / Pa").get<double>()).epsilon(1e-2));
+    }
+    SECTION("VLE isobar"){
+        auto propane = canonical_PR(std::valarray<double>{369.89}, std::valarray<double>{4251200.0}, std::valarray<double>{0.1521});
+        auto PR = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+        auto [rhoL, rhoV] = propane.superanc_rhoLV(300.0);
+        Eigen::ArrayXd rhovecL = (Eigen::ArrayXd(2) << 0, rhoL).finished(), rhovecV = (Eigen::ArrayXd(2) << 0, rhoV).finished();
+        const double p = PR->get_pr(300.0, rhovecV) + rhoV*PR->get_R(rhovecV/rhoV)*300.0;
+        PVLEOptions opt; opt.predictor_corrector = PredictorCorrectorOptions{};
+        auto pc = PR->trace_VLE_isobar_binary(p, 300.0, rhovecL, rhovecV, opt);
+        REQUIRE(pc.size() > 10);
+        for (auto& pt : pc){
+            CHECK(pt.at("pL / Pa").get<double>() == Approx(p).epsilon(1e-8));
+            CHECK(pt.at("pV / Pa").get<double>() == Approx(p).epsilon(1e-8));
+        }
+    }
+}
+
+TEST_CASE("Sweeps in one process write the rows of all their units", "[cppinterface][distributed]")
+{
+    REQUIRE(distributed::get_size() == 1);
+    auto propane = canonical_PR(std::valarray<double>{369.89}, std::valarray<double>{4251200.0}, std::valarray<double>{0.1521});
+    auto PR = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+
+    SECTION("VLE isotherms"){
+        Eigen::ArrayXd T(2); T << 230.0, 250.0;
+        Eigen::ArrayXXd rhovecL = Eigen::ArrayXXd::Zero(2, 2), rhovecV = Eigen::ArrayXXd::Zero(2, 2);
+        for (auto i = 0; i < 2; ++i){
+            auto [rhoL, rhoV] = propane.superanc_rhoLV(T(i));
+            rhovecL(i, 1) = rhoL; rhovecV(i, 1) = rhoV;
+        }
+        distributed::SweepOptions opt; opt.path = (std::filesystem::temp_directory_path() / "teqp_sweep_isoT.bin").string();
+        auto summary = distributed::sweep_VLE_isotherms(*PR, T, rhovecL, rhovecV, opt);
+        CHECK(summary.Nunits == 2);
+        CHECK(summary.units_per_rank == std::vector<std::size_t>{2});
+        CHECK(summary.failures.empty());
+
+        auto data = tracesink::read_trace(opt.path);
+        std::filesystem::remove(opt.path);
+        CHECK(static_cast<std::size_t>(data.data.rows()) == summary.Nrows);
+        auto unit = data.get("unit"), pL = data.get("pL");
+        for (auto i = 0; i < 2; ++i){
+            auto J = PR->trace_VLE_isotherm_binary(T(i), rhovecL.row(i).transpose().eval(), rhovecV.row(i).transpose().eval());
+            std::vector<double> pLi;
+            for (auto k = 0; k < data.data.rows(); ++k){
+                if (unit(k, 0) == i){ pLi.push_back(pL(k, 0)); }
+            }
+            REQUIRE(pLi.size() == J.size());
+            for (auto k = 0U; k < J.size(); ++k){
+                CHECK(pLi[k] == J[k].at("pL / Pa").get<double>());
+            }
+        }
+    }
+    SECTION("Blocks of residual derivatives"){
+        const int M = 10;
+        Eigen::ArrayXd T = Eigen::ArrayXd::LinSpaced(M, 250, 400), rho = Eigen::ArrayXd::LinSpaced(M, 1, 5000);
+        Eigen::ArrayXXd z(M, 2); z.col(0) = Eigen::ArrayXd::LinSpaced(M, 0.1, 0.9); z.col(1) = 1 - z.col(0);
+        distributed::SweepOptions opt; opt.path = (std::filesystem::temp_directory_path() / "teqp_sweep_Ar.ndjson").string(); opt.sink.format = tracesink::Format::ndjson;
+        auto summary = distributed::sweep_Ar_block(*PR, 1, 2, T, rho, z, 3, opt);
+        CHECK(summary.Nunits == 4);
+        CHECK(summary.failures.empty());
+        auto data = tracesink::read_trace(opt.path);
+        std::filesystem::remove(opt.path);
+        REQUIRE(data.data.rows() == M);
+        auto index = data.get("index"), Ar = data.get("Ar");
+        REQUIRE(Ar.cols() == 6);
+        for (auto k = 0; k < M; ++k){
+            auto i = static_cast<Eigen::Index>(index(k, 0));
+            CHECK(Ar(k, 1*3 + 2) == Approx(PR->get_Arxy(1, 2, T(i), rho(i), z.row(i).transpose().eval())).epsilon(1e-10));
+        }
+    }
+    SECTION("Units that fail"){
+        distributed::SweepOptions opt; opt.path = (std::filesystem::temp_directory_path() / "teqp_sweep_err.bin").string(); opt.root = 1;
+        auto unit = [](std::size_t i, std::vector<double>& rows){
+            if (i == 3){ throw teqp::IterationFailure("did not converge"); }
+            if (i == 5){ throw 5; } // Not a std::exception
+            rows = {static_cast<double>(i), 2.0*i};
+            if (i == 4){ rows.push_back(0); }
+        };
+        tracesink::Schema schema{{{"unit", 1}, {"value", 1}}};
+        CHECK_THROWS_AS(distributed::run_sweep(6, schema, unit, opt), teqp::InvalidArgument);
+        opt.root = 0;
+        CHECK_THROWS_AS(distributed::run_sweep(6, tracesink::Schema{{{"value", 1}}}, unit, opt), teqp::InvalidArgument);
+        auto summary = distributed::run_sweep(6, schema, unit, opt);
+        CHECK(summary.Nrows == 3);
+        REQUIRE(summary.failures.size() == 3);
+        std::sort(summary.failures.begin(), summary.failures.end());
+        CHECK(summary.failures[0] == "unit 3: did not converge");
+        CHECK(summary.failures[1].rfind("unit 4: ", 0) == 0);
+        CHECK(summary.failures[2] == "unit 5: unknown error");
+        CHECK(tracesink::read_trace(opt.path).data.rows() == 3);
+        std::filesystem::remove(opt.path);
+    }
+}
@@ -7,9 +7,18 @@
 using Catch::Approx;
 
 #include "teqp/models/cubics.hpp"
+#include "teqp/models/cubics_fixed.hpp"
+#include "teqp/models/vdW.hpp"
 #include "teqp/derivs.hpp"
 #include "teqp/algorithms/VLE.hpp"
+#include "teqp/algorithms/stability.hpp"
+#include "teqp/algorithms/flash.hpp"
+#include "teqp/algorithms/flash_pure.hpp"
+#include "teqp/ideal_eosterms.hpp"
 #include "teqp/cpp/teqpcpp.hpp"
+#if defined(TEQP_MULTIPRECISION_ENABLED)
+#include "teqp/algorithms/mixed_precision.hpp"
+#endif
 
 #include <boost/numeric/odeint/stepper/euler.hpp>
 #include <boost/numeric/odeint/stepper/runge_kutta_cash_karp54.hpp>
@@ -239,6 +248,53 @@ TEST_CASE("Check manual integration of subcritical VLE isotherm for binary mixtu
         double pfinal = J.back().at("pL / Pa").back();
         CHECK(std::abs(pfinal / pfinal_goal-1) < 1e-5);
     }
+    SECTION("Streaming integration of isotherm") {
+        auto X = get_start(T, 0);
+        auto N = X.size() / 2;
+        Eigen::ArrayXd rhovecL0 = Eigen::Map<const Eigen::ArrayXd>(&(X[0]), N);
+        Eigen::ArrayXd rhovecV0 = Eigen::Map<const Eigen::ArrayXd>(&(X[0]) + N, N);
+        auto J = trace_VLE_isotherm_binary(model, T, rhovecL0, rhovecV0);
+
+        // The points passed to the callback are the same as the ones stored in JSON
+        std::size_t i = 0;
+        auto reason = trace_VLE_isotherm_binary(model, T, rhovecL0, rhovecV0, [&](const VLETracePoint& pt) {
+            CHECK(pt.pL == J[i].at("pL / Pa"));
+            CHECK(pt.rhovecV[1] == J[i].at("rhoV / mol/m^3")[1]);
+            i++;
+            return true;
+        });
+        CHECK(reason.empty());
+        CHECK(i == J.size());
+
+        // And the callback can stop the trace
+        i = 0;
+        reason = trace_VLE_isotherm_binary(model, T, rhovecL0, rhovecV0, [&](const VLETracePoint&) { return ++i < 10; });
+        CHECK(!reason.empty());
+        CHECK(i == 10);
+    }
+    SECTION("Dense output of isotherm") {
+        auto X = get_start(T, 0);
+        auto N = X.size() / 2;
+        Eigen::ArrayXd rhovecL0 = Eigen::Map<const Eigen::ArrayXd>(&(X[0]), N);
+        Eigen::ArrayXd rhovecV0 = Eigen::Map<const Eigen::ArrayXd>(&(X[0]) + N, N);
+        double p0 = get_p(X), pfinal = get_p(get_start(T, 1));
+        Eigen::ArrayXd values = Eigen::ArrayXd::LinSpaced(7, p0, pfinal).segment(1, 5);
+
+        VLEDenseOptions dopt;
+        auto interpolated = trace_VLE_isotherm_binary_dense(model, T, rhovecL0, rhovecV0, values, dopt);
+        dopt.polish = true;
+        auto polished = trace_VLE_isotherm_binary_dense(model, T, rhovecL0, rhovecV0, values, dopt);
+        REQUIRE(interpolated.size() == static_cast<std::size_t>(values.size()));
+        REQUIRE(polished.size() == interpolated.size());
+        for (auto i = 0; i < values.size(); ++i) {
+            CAPTURE(values[i]);
+            CHECK(interpolated[i].pL == Approx(values[i]).epsilon(1e-10));
+            CHECK(polished[i].pL == Approx(values[i]).epsilon(1e-8));
+            CHECK(polished[i].pV == Approx(values[i]).epsilon(1e-8));
+            CHECK((interpolated[i].rhovecL / polished[i].rhovecL - 1).cwiseAbs().maxCoeff() < 1e-5);
+            CHECK((interpolated[i].rhovecV / polished[i].rhovecV - 1).cwiseAbs().maxCoeff() < 1e-5);
+        }
+    }
 }
 
 TEST_CASE("Check infinite dilution of isoline VLE derivatives", "[cubic][isochoric][infdil]")
@@ -438,6 +494,490 @@ TEST_CASE("Check manual integration of subcritical VLE isobar for binary mixture
     }
 }
 
+TEST_CASE("Check tracing of ternary isotherm along a composition direction", "[cubic][isochoric][traceisotherm][ternary]")
+{
+    // Methane + ethane + propane
+    std::valarray<double> Tc_K = { 190.564, 305.32, 369.89 },
+        pc_Pa = { 4599200, 4872200.0, 4251200.0 },
+        acentric = { 0.011, 0.099, 0.1521 };
+    auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+    double T = 230;
+
+    // Start from a point on the isotherm of methane + propane, with a bit of ethane added
+    auto binary = canonical_PR(std::valarray<double>{Tc_K[0], Tc_K[2]}, std::valarray<double>{pc_Pa[0], pc_Pa[2]}, std::valarray<double>{acentric[0], acentric[2]});
+    auto [rhoLpure, rhoVpure] = canonical_PR(std::valarray<double>{Tc_K[2]}, std::valarray<double>{pc_Pa[2]}, std::valarray<double>{acentric[2]}).superanc_rhoLV(T);
+    auto Jbinary = trace_VLE_isotherm_binary(binary, T, (Eigen::ArrayXd(2) << 0, rhoLpure).finished(), (Eigen::ArrayXd(2) << 0, rhoVpure).finished());
+    auto pt = Jbinary[Jbinary.size()/2];
+    std::vector<double> rhoL = pt.at("rhoL / mol/m^3"), rhoV = pt.at("rhoV / mol/m^3");
+    Eigen::ArrayXd rhovecL0 = (Eigen::ArrayXd(3) << rhoL[0], 0.01*(rhoL[0] + rhoL[1]), rhoL[1]).finished();
+    Eigen::ArrayXd rhovecV0 = (Eigen::ArrayXd(3) << rhoV[0], 0.01*(rhoV[0] + rhoV[1]), rhoV[1]).finished();
+    Eigen::ArrayXd x0 = rhovecL0/rhovecL0.sum();
+    auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhovecL0, rhovecV0, x0, 1e-10, 1e-10, 1e-10, 1e-10, 100);
+    REQUIRE((code == VLE_return_code::xtol_satisfied || code == VLE_return_code::functol_satisfied));
+
+    // Methane replaces propane, so the mole fraction of ethane stays the same
+    TVLEOptions opt;
+    opt.max_steps = 20;
+    opt.xdirection = (Eigen::ArrayXd(3) << 1, 0, -1).finished();
+    CHECK_THROWS(trace_VLE_isotherm_binary(model, T, rhovecL, rhovecV)); // The direction is required
+    auto J = trace_VLE_isotherm_binary(model, T, rhovecL, rhovecV, opt);
+    REQUIRE(J.size() > 2);
+    double x1 = rhovecL[1]/rhovecL.sum();
+    for (auto& point : J) {
+        std::vector<double> rL = point.at("rhoL / mol/m^3");
+        CHECK(rL[1]/(rL[0] + rL[1] + rL[2]) == Approx(x1).epsilon(1e-6));
+        CHECK(point.at("pL / Pa").get<double>() == Approx(point.at("pV / Pa").get<double>()).epsilon(1e-6));
+    }
+}
+
+TEST_CASE("Check quasi-Newton VLE solvers against Newton's method", "[cubic][VLE][broyden]")
+{
+    // Methane + propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 },
+        pc_Pa = { 4599200, 4251200.0 },
+        acentric = { 0.011, 0.1521 };
+    auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+
+    // A converged binary phase equilibrium state, obtained from the pure propane state
+    double T = 250;
+    std::valarray<double> Tc_(Tc_K[1], 1), pc_(pc_Pa[1], 1), acentric_(acentric[1], 1);
+    auto [rhoLpure, rhoVpure] = canonical_PR(Tc_, pc_, acentric_).superanc_rhoLV(T);
+    Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+    Eigen::ArrayXd xL0 = rhoL0 / rhoL0.sum();
+    auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10);
+    Eigen::ArrayXd x = rhovecL/rhovecL.sum();
+    double p = rhovecL.sum()*model.R(x)*T*(1 + TDXDerivatives<decltype(model)>::get_Ar01(model, T, rhovecL.sum(), x));
+
+    SECTION("Tp") {
+        MixVLETpFlags newton, broyden;
+        newton.maxiter = 20;
+        broyden.maxiter = 100;
+        broyden.broyden = true;
+        auto rN = mix_VLE_Tp(model, T, p*1.05, rhovecL, rhovecV, newton);
+        auto rB = mix_VLE_Tp(model, T, p*1.05, rhovecL, rhovecV, broyden);
+        CHECK(rB.success);
+        CHECK(rB.r.cwiseAbs().maxCoeff() < 1e-8);
+        CHECK((rB.rhovecL/rN.rhovecL - 1).cwiseAbs().maxCoeff() < 1e-8);
+        CHECK((rB.rhovecV/rN.rhovecV - 1).cwiseAbs().maxCoeff() < 1e-8);
+    }
+    SECTION("px") {
+        MixVLEpxFlags newton, broyden;
+        broyden.maxiter = 100;
+        broyden.broyden = true;
+        auto [codeN, TN, rhovecLN, rhovecVN] = mixture_VLE_px(model, p*1.05, x, T, rhovecL, rhovecV, newton);
+        auto [codeB, TB, rhovecLB, rhovecVB] = mixture_VLE_px(model, p*1.05, x, T, rhovecL, rhovecV, broyden);
+        CHECK((codeB == VLE_return_code::functol_satisfied || codeB == VLE_return_code::xtol_satisfied));
+        CHECK(TB == Approx(TN).epsilon(1e-8));
+        CHECK((rhovecLB/rhovecLN - 1).cwiseAbs().maxCoeff() < 1e-8);
+        CHECK((rhovecVB/rhovecVN - 1).cwiseAbs().maxCoeff() < 1e-8);
+    }
+}
+
+TEST_CASE("Check the telemetry of the VLE solvers and tracers", "[cubic][VLE][telemetry]")
+{
+    // Methane + propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 },
+        pc_Pa = { 4599200, 4251200.0 },
+        acentric = { 0.011, 0.1521 };
+    auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+    double T = 250;
+    std::valarray<double> Tc_(Tc_K[1], 1), pc_(pc_Pa[1], 1), acentric_(acentric[1], 1);
+    auto [rhoLpure, rhoVpure] = canonical_PR(Tc_, pc_, acentric_).superanc_rhoLV(T);
+    Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+    Eigen::ArrayXd xL0 = rhoL0 / rhoL0.sum();
+
+    SolverTelemetry tel;
+    auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10, &tel);
+    CHECK(tel.num_iter > 0);
+    CHECK(tel.num_Hessian == 2*tel.num_iter);
+    CHECK(tel.elapsed_s >= 0);
+
+    Eigen::ArrayXd x = rhovecL/rhovecL.sum();
+    double p = rhovecL.sum()*model.R(x)*T*(1 + TDXDerivatives<decltype(model)>::get_Ar01(model, T, rhovecL.sum(), x));
+    MixVLETpFlags broyden;
+    broyden.maxiter = 100;
+    broyden.broyden = true;
+    auto rN = mix_VLE_Tp(model, T, p*1.05, rhovecL, rhovecV);
+    auto rB = mix_VLE_Tp(model, T, p*1.05, rhovecL, rhovecV, broyden);
+    CHECK(rN.telemetry.num_iter == 10);
+    CHECK(rN.telemetry.num_residual == 0);
+    CHECK(rB.telemetry.num_residual == rB.telemetry.num_iter);
+    CHECK(rB.telemetry.num_Hessian <= 2*rB.telemetry.num_iter + 4);
+
+    SolverTelemetry telpx;
+    mixture_VLE_px(model, p*1.05, x, T, rhovecL, rhovecV, std::nullopt, &telpx);
+    CHECK(telpx.num_Hessian == 2*telpx.num_iter);
+
+    // The counters of the trace so far are in each point, and they only grow
+    TVLEOptions opt;
+    opt.max_steps = 20;
+    opt.revision = 2;
+    opt.telemetry = true;
+    auto J = trace_VLE_isotherm_binary(model, T, rhovecL, rhovecV, opt);
+    const auto& data = J.at("data");
+    REQUIRE(data.size() > 2);
+    int previous_rhs = -1;
+    for (const auto& point : data) {
+        int num_rhs = point.at("telemetry").at("num_rhs");
+        CHECK(num_rhs > previous_rhs);
+        previous_rhs = num_rhs;
+    }
+    const auto& last = J.at("meta").at("telemetry");
+    CHECK(last == data.back().at("telemetry"));
+    CHECK(last.at("num_iter") == data.size() - 1);
+    CHECK(last.at("num_polish") == data.size() - 1);
+    CHECK(last.at("num_Hessian").get<int>() > 0);
+    CHECK(!trace_VLE_isotherm_binary(model, T, rhovecL, rhovecV).at(0).contains("telemetry"));
+}
+
+#if defined(TEQP_MULTIPRECISION_ENABLED)
+TEST_CASE("Check the adaptive-precision critical point and VLE solvers", "[cubic][VLE][multiprecision]")
+{
+    // Methane + propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 },
+        pc_Pa = { 4599200, 4251200.0 },
+        acentric = { 0.011, 0.1521 };
+    auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+
+    SECTION("pure critical point") {
+        // The critical temperature of the canonical cubic is the one it was built from
+        auto pure = canonical_PR(vad{Tc_K[1]}, vad{pc_Pa[1]}, vad{acentric[1]});
+        double rhoc0 = pc_Pa[1]/(0.3*pure.R(Eigen::ArrayXd::Ones(1))*Tc_K[1]);
+        nlohmann::json flags = {{"maxsteps", 20}};
+        auto [Tdbl, rhodbl] = solve_pure_critical(pure, Tc_K[1]*1.02, rhoc0, flags);
+        SolverTelemetry tel;
+        auto [T, rho] = solve_pure_critical_adaptive(pure, Tc_K[1]*1.02, rhoc0, flags, MixedPrecisionOptions{}, &tel);
+        CHECK(tel.num_iter == 20);
+        CHECK(tel.num_escalated > 0);
+        CHECK(std::abs(T/Tc_K[1] - 1) < 1e-13);
+        CHECK(T == Approx(Tdbl).epsilon(1e-10));
+        CHECK(rho == Approx(rhodbl).epsilon(1e-8));
+    }
+    SECTION("VLE with specified liquid composition") {
+        double T = 250;
+        std::valarray<double> Tc_(Tc_K[1], 1), pc_(pc_Pa[1], 1), acentric_(acentric[1], 1);
+        auto [rhoLpure, rhoVpure] = canonical_PR(Tc_, pc_, acentric_).superanc_rhoLV(T);
+        Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+        Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+        Eigen::ArrayXd xL0 = rhoL0 / rhoL0.sum();
+        auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10);
+
+        // Escalated from the first iteration, and never escalated
+        MixedPrecisionOptions always, never;
+        always.cond_threshold = 1;
+        never.cond_threshold = 1e300; never.stall_ratio = 1e300;
+        SolverTelemetry telalways, telnever;
+        auto [codeA, rhovecLA, rhovecVA] = mix_VLE_Tx_adaptive(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10, always, &telalways);
+        auto [codeN, rhovecLN, rhovecVN] = mix_VLE_Tx_adaptive(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10, never, &telnever);
+        CHECK(telalways.num_escalated == telalways.num_iter);
+        CHECK(telnever.num_escalated == 0);
+        CHECK(codeN == code);
+        CHECK((rhovecLN - rhovecL).cwiseAbs().maxCoeff() == 0);
+        CHECK((rhovecLA/rhovecL - 1).cwiseAbs().maxCoeff() < 1e-10);
+        CHECK((rhovecVA/rhovecV - 1).cwiseAbs().maxCoeff() < 1e-10);
+    }
+}
+#endif
+
+TEST_CASE("Check tangent plane stability analysis", "[cubic][stability]")
+{
+    // Methane + propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 },
+        pc_Pa = { 4599200, 4251200.0 },
+        acentric = { 0.011, 0.1521 };
+    auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+    Eigen::ArrayXd Tc = (Eigen::ArrayXd(2) << Tc_K[0], Tc_K[1]).finished(), pc = (Eigen::ArrayXd(2) << pc_Pa[0], pc_Pa[1]).finished(), omega = (Eigen::ArrayXd(2) << acentric[0], acentric[1]).finished();
+
+    // A converged phase equilibrium state, obtained from the pure propane state
+    double T = 250;
+    std::valarray<double> Tc_(Tc_K[1], 1), pc_(pc_Pa[1], 1), acentric_(acentric[1], 1);
+    auto [rhoLpure, rhoVpure] = canonical_PR(Tc_, pc_, acentric_).superanc_rhoLV(T);
+    Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+    Eigen::ArrayXd xL0 = rhoL0 / rhoL0.sum();
+    auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10);
+
+    SECTION("Inside the two-phase region") {
+        Eigen::ArrayXd rhovec = (rhovecL + rhovecV) / 2;
+        auto trials = stability::get_Wilson_trials(model, T, rhovec, Tc, pc, omega);
+        auto res = stability::tpd_stability(model, T, rhovec, trials);
+        CHECK(!res.stable);
+        CHECK(res.tpd_min < 0);
+    }
+    SECTION("Compressed liquid") {
+        Eigen::ArrayXd rhovec = rhovecL * 1.01;
+        auto trials = stability::get_Wilson_trials(model, T, rhovec, Tc, pc, omega);
+        auto res = stability::tpd_stability(model, T, rhovec, trials);
+        CHECK(res.stable);
+        CHECK(res.num_fev < 2*30);
+    }
+    SECTION("Dilute vapor") {
+        Eigen::ArrayXd rhovec = rhovecV * 0.5;
+        auto trials = stability::get_Wilson_trials(model, T, rhovec, Tc, pc, omega);
+        auto res = stability::tpd_stability(model, T, rhovec, trials);
+        CHECK(res.stable);
+    }
+}
+
+TEST_CASE("Check PT flash against phase equilibrium", "[cubic][flash]")
+{
+    // Methane + propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 },
+        pc_Pa = { 4599200, 4251200.0 },
+        acentric = { 0.011, 0.1521 };
+    auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+    Eigen::ArrayXd Tc = (Eigen::ArrayXd(2) << Tc_K[0], Tc_K[1]).finished(), pc = (Eigen::ArrayXd(2) << pc_Pa[0], pc_Pa[1]).finished(), omega = (Eigen::ArrayXd(2) << acentric[0], acentric[1]).finished();
+
+    // A converged phase equilibrium state, obtained from the pure propane state
+    double T = 250;
+    std::valarray<double> Tc_(Tc_K[1], 1), pc_(pc_Pa[1], 1), acentric_(acentric[1], 1);
+    auto [rhoLpure, rhoVpure] = canonical_PR(Tc_, pc_, acentric_).superanc_rhoLV(T);
+    Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+    Eigen::ArrayXd xL0 = rhoL0 / rhoL0.sum();
+    auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10);
+    Eigen::ArrayXd x = rhovecL / rhovecL.sum(), y = rhovecV / rhovecV.sum();
+    double p = rhovecL.sum()*model.R(x)*T*(1 + TDXDerivatives<decltype(model)>::get_Ar01(model, T, rhovecL.sum(), x));
+
+    SECTION("Inside the two-phase region") {
+        Eigen::ArrayXd z = (x + y) / 2;
+        for (auto Newton_switch_tol : { 1e-4, 0.0 }) {
+            flash::PTFlashOptions opt;
+            opt.Newton_switch_tol = Newton_switch_tol;
+            auto res = flash::PT_flash(model, T, p, z, Tc, pc, omega, opt);
+            CAPTURE(res.message);
+            CHECK(res.success);
+            CHECK(res.two_phase);
+            CHECK(res.beta == Approx(0.5).margin(1e-6));
+            CHECK((res.rhovecL / rhovecL - 1).cwiseAbs().maxCoeff() < 1e-6);
+            CHECK((res.rhovecV / rhovecV - 1).cwiseAbs().maxCoeff() < 1e-6);
+            CHECK(res.num_SS < 100);
+        }
+    }
+    SECTION("Compressed liquid") {
+        auto res = flash::PT_flash(model, T, p * 2, x, Tc, pc, omega);
+        CAPTURE(res.message);
+        CHECK(res.success);
+        CHECK(!res.two_phase);
+    }
+}
+
+TEST_CASE("Check pure-fluid flashes with the cubic superancillaries", "[cubic][flash]")
+{
+    // Propane
+    std::valarray<double> Tc_K = { 369.89 }, pc_Pa = { 4251200.0 }, acentric = { 0.1521 };
+    auto cubic = canonical_PR(Tc_K, pc_Pa, acentric);
+    std::shared_ptr<cppinterface::AbstractModel> ar = cppinterface::adapter::make_owned(cubic);
+    nlohmann::json jpure = {{"R", 8.31446261815324}, {"terms", {
+        {{"type", "Lead"}, {"a_1", 1.0}, {"a_2", 200.0}},
+        {{"type", "LogT"}, {"a", -4.0}}
+    }}};
+    std::shared_ptr<cppinterface::AbstractModel> aig = cppinterface::adapter::make_owned(IdealHelmholtz(nlohmann::json::array({jpure})));
+    auto sat = flash::make_cubic_saturation_source(cubic, 0.6*Tc_K[0], 0.999*Tc_K[0]);
+    const auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    const double R = ar->get_R(z);
+    
+    // The values of the variables at a state, or of a two-phase state at T with quality q
+    auto get_vals = [&](const std::vector<char>& vars, double T, double rho) {
+        return cppinterface::build_iteration_Jv(vars, ar->get_deriv_mat2(T, rho, z), aig->get_deriv_mat2(T, rho, z), R, T, rho, z).v;
+    };
+    
+    for (std::vector<char> vars : { std::vector<char>{'H','P'}, std::vector<char>{'S','P'}, std::vector<char>{'P','U'}, std::vector<char>{'U','D'}, std::vector<char>{'D','S'}, std::vector<char>{'D','H'} }) {
+        CAPTURE(vars[0], vars[1]);
+        SECTION("Single phase"){
+            // Compressed liquid, superheated vapor, and supercritical states
+            for (auto [T, rho] : std::vector<std::tuple<double, double>>{ {250, 13800}, {300, 12000}, {350, 9000}, {320, 300}, {250, 50}, {450, 3000}, {380, 4000}, {600, 500} }) {
+                CAPTURE(T, rho);
+                Eigen::ArrayXd vals = get_vals(vars, T, rho);
+                auto res = flash::pure_flash(ar, aig, vars, vals, sat);
+                CAPTURE(res.message);
+                CHECK(res.success);
+                CHECK(!res.two_phase);
+                CHECK(res.T == Approx(T).epsilon(1e-9));
+                CHECK(res.rho == Approx(rho).epsilon(1e-9));
+                CHECK(res.num_Newton <= 12);
+            }
+        }
+        SECTION("Two phases"){
+            for (auto [T, q] : std::vector<std::tuple<double, double>>{ {250, 0.3}, {300, 0.9}, {360, 0.5} }) {
+                CAPTURE(T, q);
+                auto [rhoL, rhoV] = cubic.superanc_rhoLV(T);
+                double rho = 1/(q/rhoV + (1 - q)/rhoL);
+                Eigen::ArrayXd valsL = get_vals(vars, T, rhoL), valsV = get_vals(vars, T, rhoV), vals(2);
+                for (auto i = 0; i < 2; ++i) {
+                    vals(i) = (vars[i] == 'P') ? valsV(i) : (vars[i] == 'D') ? rho : (1 - q)*valsL(i) + q*valsV(i);
+                }
+                auto res = flash::pure_flash(ar, aig, vars, vals, sat);
+                CAPTURE(res.message);
+                CHECK(res.success);
+                CHECK(res.two_phase);
+                CHECK(res.T == Approx(T).epsilon(1e-9));
+                CHECK(res.q == Approx(q).epsilon(1e-8));
+                CHECK(res.rho == Approx(rho).epsilon(1e-8));
+                CHECK(res.num_Newton == 0);
+            }
+        }
+    }
+    Eigen::ArrayXd vals = (Eigen::ArrayXd(2) << 300.0, 1e5).finished();
+    CHECK_THROWS_AS(flash::pure_flash(ar, aig, {'T', 'P'}, vals, sat), teqp::InvalidArgument);
+}
+
+TEST_CASE("Check sharing of derivatives between consumers at the same state", "[cubic][isochoric]")
+{
+    // Methane + propane
+    std::valarray<double> Tc_K = { 190.564, 369.89 },
+        pc_Pa = { 4599200, 4251200.0 },
+        acentric = { 0.011, 0.1521 };
+    const auto modelptr = teqp::cppinterface::adapter::make_owned(canonical_PR(Tc_K, pc_Pa, acentric));
+    const auto& model = *modelptr;
+
+    double T = 250;
+    std::valarray<double> Tc_(Tc_K[1], 1), pc_(pc_Pa[1], 1), acentric_(acentric[1], 1);
+    auto [rhoLpure, rhoVpure] = canonical_PR(Tc_, pc_, acentric_).superanc_rhoLV(T);
+    Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+    Eigen::ArrayXd xL0 = rhoL0 / rhoL0.sum();
+    auto [code, rhovecL, rhovecV] = mix_VLE_Tx(model, T, rhoL0, rhoV0, xL0, 1e-10, 1e-10, 1e-10, 1e-10, 10);
+
+    teqp::internal::PsirDerivativeCache cacheL(model), cacheV(model);
+    auto [drhovecdpL, drhovecdpV] = get_drhovecdp_Tsat(model, T, rhovecL, rhovecV, cacheL, cacheV);
+    auto [drhovecdpL0, drhovecdpV0] = get_drhovecdp_Tsat(model, T, rhovecL, rhovecV);
+    CHECK((drhovecdpL.array() / drhovecdpL0.array() - 1).cwiseAbs().maxCoeff() < 1e-12);
+    CHECK((drhovecdpV.array() / drhovecdpV0.array() - 1).cwiseAbs().maxCoeff() < 1e-12);
+
+    // Other consumers at the same state do not evaluate the derivatives again
+    cacheL.update(T, rhovecL);
+    get_drhovecdp_Tsat(model, T, rhovecL, rhovecV, cacheL, cacheV);
+    CHECK(cacheL.num_evaluations == 1);
+    CHECK(cacheV.num_evaluations == 1);
+    CHECK(cacheL.get_pr() == Approx(model.get_pr(T, rhovecL)).epsilon(1e-12));
+    Eigen::MatrixXd H = model.build_Psi_Hessian_autodiff(T, rhovecL).matrix();
+    CHECK((cacheL.get_Psi_Hessian() - H).cwiseAbs().maxCoeff() < 1e-10 * H.cwiseAbs().maxCoeff());
+
+    // But a change of the state does
+    cacheL.update(T, rhovecL * 1.001);
+    CHECK(cacheL.num_evaluations == 2);
+}
+
+TEST_CASE("Check fused ln(phi) and its Jacobian against the separate derivatives", "[cubic][isochoric][lnphi]")
+{
+    // Methane + ethane + propane
+    std::valarray<double> Tc_K = { 190.564, 305.32, 369.89 },
+        pc_Pa = { 4599200, 4872200.0, 4251200.0 },
+        acentric = { 0.011, 0.099, 0.1521 };
+    const auto model = canonical_PR(Tc_K, pc_Pa, acentric);
+    using id = IsochoricDerivatives<decltype(model)>;
+    double T = 250;
+    auto rhovec = (Eigen::ArrayXd(3) << 1500, 900, 600).finished();
+    
+    auto [lnphi, J] = id::get_ln_fugacity_coefficients_Jacobian(model, T, rhovec);
+    CHECK(J.rows() == 3);
+    CHECK(J.cols() == 5);
+    auto close = [](const Eigen::ArrayXd& a, const Eigen::ArrayXd& b){ return (a - b).cwiseAbs().maxCoeff() < 1e-10*b.cwiseAbs().maxCoeff(); };
+    CHECK(close(lnphi, id::get_ln_fugacity_coefficients(model, T, rhovec)));
+    CHECK(close(J.col(0), id::get_d_ln_fugacity_coefficients_dT_constrhovec(model, T, rhovec)));
+    CHECK(close(J.col(1), id::get_d_ln_fugacity_coefficients_drho_constTmolefracs(model, T, rhovec)));
+    // Only changes of composition that keep the sum of the mole fractions are meaningful
+    Eigen::ArrayXd dx = (Eigen::ArrayXd(3) << 1.0, -0.25, -0.75).finished();
+    Eigen::ArrayXd Jdx = (J.rightCols(3).matrix()*dx.matrix()).array();
+    Eigen::ArrayXd Jdx0 = (id::get_d_ln_fugacity_coefficients_dmolefracs_constTrho(model, T, rhovec).matrix()*dx.matrix()).array();
+    CHECK(close(Jdx, Jdx0));
+}
+
+TEST_CASE("Check block elimination of the two-phase Jacobian", "[VLE]")
+{
+    // A Jacobian with the structure of that of mix_VLE_Tx, with symmetric positive definite phase blocks
+    const Eigen::Index N = 12;
+    Eigen::MatrixXd ML = Eigen::MatrixXd::Random(N, N), MV = Eigen::MatrixXd::Random(N, N);
+    Eigen::MatrixXd HL = ML * ML.transpose() + N * Eigen::MatrixXd::Identity(N, N), HV = MV * MV.transpose() + N * Eigen::MatrixXd::Identity(N, N);
+    Eigen::VectorXd rhovecL = Eigen::VectorXd::LinSpaced(N, 1, 2), rhovecV = Eigen::VectorXd::LinSpaced(N, 0.1, 0.2);
+    Eigen::MatrixXd J = Eigen::MatrixXd::Zero(2 * N, 2 * N);
+    J.block(0, 0, N, N) = HL;
+    J.block(0, N, N, N) = -HV;
+    J.block(N, 0, 1, N) = (HL * rhovecL).transpose();
+    J.block(N, N, 1, N) = -(HV * rhovecV).transpose();
+    double rhoL = rhovecL.sum();
+    for (auto i = 0; i < N - 1; ++i) {
+        J.block(N + 1 + i, 0, 1, N).setConstant(-rhovecL(i) / (rhoL * rhoL));
+        J(N + 1 + i, i) = (rhoL - rhovecL(i)) / (rhoL * rhoL);
+    }
+    Eigen::VectorXd r = Eigen::VectorXd::LinSpaced(2 * N, -1, 1);
+
+    Eigen::VectorXd dx = teqp::internal::solve_two_phase_Jacobian(J, r);
+    Eigen::VectorXd dxQR = J.colPivHouseholderQr().solve(-r);
+    CHECK((dx - dxQR).norm() < 1e-10 * dxQR.norm());
+
+    Eigen::ArrayXd y = linsolve_symmetric(HV, rhovecL);
+    CHECK((HV * y.matrix() - rhovecL).norm() < 1e-12 * rhovecL.norm());
+}
+
+/// Only exposes alphar and R of the model, so that its derivatives are obtained by automatic differentiation
+template<typename Model>
+struct AlpharOnly {
+    const Model& model;
+    template<typename VecType> auto R(const VecType& molefrac) const { return model.R(molefrac); }
+    template<typename TType, typename RhoType, typename MoleFracType>
+    auto alphar(const TType& T, const RhoType& rho, const MoleFracType& molefrac) const { return model.alphar(T, rho, molefrac); }
+};
+
+TEST_CASE("Check closed-form derivatives of cubics against automatic differentiation", "[cubic][analytic]")
+{
+    // Methane + ethane
+    std::valarray<double> Tc_K = { 190.564, 305.32 }, pc_Pa = { 4599200, 4872200 }, acentric = { 0.011, 0.099 };
+    Eigen::ArrayXXd kmat(2, 2); kmat << 0, 0.01, 0.01, 0;
+    auto j = nlohmann::json{{"type", "PR"}, {"Tcrit / K", {190.564, 305.32}}, {"pcrit / Pa", {4599200, 4872200}}, {"acentric", {0.011, 0.099}}, {"kmat", {{0, 0.01}, {0.01, 0}}},
+        {"alpha", {{{"type", "Twu"}, {"c", {0.1, 0.9, 2.0}}}, {{"type", "Twu"}, {"c", {0.3, 0.85, 1.8}}}}}};
+    double T = 250;
+    Eigen::ArrayXd z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+
+    auto check = [&](const auto& model) {
+        AlpharOnly<std::decay_t<decltype(model)>> ad{model};
+        using tdx = TDXDerivatives<decltype(model)>;
+        using tdxad = TDXDerivatives<decltype(ad)>;
+        for (double rho : {1e-3, 100.0, 3000.0, 12000.0}) {
+            CAPTURE(rho);
+            auto mat = model.get_deriv_mat2(T, rho, z);
+            CHECK(mat(0, 0) == Approx(tdxad::get_Ar00(ad, T, rho, z)));
+            CHECK(mat(1, 0) == Approx(tdxad::template get_Arxy<1, 0>(ad, T, rho, z)));
+            CHECK(mat(2, 0) == Approx(tdxad::template get_Arxy<2, 0>(ad, T, rho, z)));
+            CHECK(mat(0, 1) == Approx(tdxad::template get_Arxy<0, 1>(ad, T, rho, z)));
+            CHECK(mat(0, 2) == Approx(tdxad::template get_Arxy<0, 2>(ad, T, rho, z)));
+            CHECK(mat(1, 1) == Approx(tdxad::template get_Arxy<1, 1>(ad, T, rho, z)));
+            CHECK(tdx::template get_Arxy<2, 1, ADBackends::analytic>(model, T, rho, z) == Approx(tdxad::template get_Arxy<2, 1>(ad, T, rho, z)));
+            CHECK(tdx::template get_Arxy<1, 3, ADBackends::analytic>(model, T, rho, z) == Approx(tdxad::template get_Arxy<1, 3>(ad, T, rho, z)));
+            CHECK(tdx::template get_Arxy<0, 4, ADBackends::analytic>(model, T, rho, z) == Approx(tdxad::template get_Arxy<0, 4>(ad, T, rho, z)));
+
+            Eigen::ArrayXd rhovec = rho*z;
+            auto [Psir, grad, H] = IsochoricDerivatives<decltype(model)>::build_Psir_fgradHessian_autodiff(model, T, rhovec);
+            auto [Psirad, gradad, Had] = IsochoricDerivatives<decltype(ad)>::build_Psir_fgradHessian_autodiff(ad, T, rhovec);
+            CHECK(Psir == Approx(Psirad));
+            CHECK((grad - gradad).abs().maxCoeff() < 1e-10*gradad.abs().maxCoeff());
+            CHECK((H - Had).cwiseAbs().maxCoeff() < 1e-10*Had.cwiseAbs().maxCoeff());
+        }
+        // Infinite dilution of the first component
+        Eigen::ArrayXd rhovec = (Eigen::ArrayXd(2) << 0.0, 5000.0).finished();
+        auto H = IsochoricDerivatives<decltype(model)>::build_Psir_Hessian_autodiff(model, T, rhovec);
+        auto Had = IsochoricDerivatives<decltype(ad)>::build_Psir_Hessian_autodiff(ad, T, rhovec);
+        CHECK((H - Had).cwiseAbs().maxCoeff() < 1e-10*Had.cwiseAbs().maxCoeff());
+    };
+    SECTION("PR"){ check(canonical_PR(Tc_K, pc_Pa, acentric, kmat)); }
+    SECTION("SRK"){ check(canonical_SRK(Tc_K, pc_Pa, acentric, kmat)); }
+    SECTION("PR with Twu alpha"){ check(make_generalizedcubic(j)); }
+    SECTION("PR with an asymmetric kmat"){
+        Eigen::ArrayXXd kasym(2, 2); kasym << 0, 0.01, 0.05, 0;
+        check(canonical_PR(Tc_K, pc_Pa, acentric, kasym));
+    }
+    SECTION("Through the AbstractModel"){
+        auto model = canonical_PR(Tc_K, pc_Pa, acentric, kmat);
+        auto am = teqp::cppinterface::adapter::make_owned(canonical_PR(Tc_K, pc_Pa, acentric, kmat));
+        CHECK((am->get_deriv_mat2(T, 3000.0, z) - model.get_deriv_mat2(T, 3000.0, z)).abs().maxCoeff() == 0);
+        Eigen::ArrayXd rhovec = 3000.0*z;
+        CHECK((am->build_Psir_Hessian_autodiff(T, rhovec).matrix() - std::get<2>(model.get_Psir_fgradHessian_analytic(T, rhovec))).cwiseAbs().maxCoeff() == 0);
+    }
+}
+
 TEST_CASE("Bad kmat options", "[PRkmat]"){
     SECTION("null; ok"){
         auto j = nlohmann::json::parse(R"({
@@ -540,3 +1080,143 @@ TEST_CASE("Check generalized and alphas", "[PRalpha]"){
         CHECK(m2.get_meta() != m0.get_meta());
     }
 }
+
+TEST_CASE("Check closed-form densities of cubics from T and p", "[cubic][density]")
+{
+    using namespace teqp::density;
+    const auto model = teqp::cppinterface::make_model(nlohmann::json::parse(R"(
+    {"kind": "cubic", "model": {"type": "PR", "Tcrit / K": [369.89], "pcrit / Pa": [4251200.0], "acentric": [0.1521]}}
+    )"));
+    const auto& cubic = teqp::cppinterface::adapter::get_model_cref<canonical_cubic_t>(model.get());
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    auto get_p = [&](double T, double rho){ return rho*model->get_R(z)*T*(1 + model->get_Ar01(T, rho, z)); };
+    
+    SECTION("saturated states"){
+        double T = 300;
+        auto [rhoL, rhoV] = cubic.superanc_rhoLV(T);
+        double p = get_p(T, rhoL);
+        CHECK(model->solve_rho_Tp(T, p, z, RhoPhase::liquid) == Approx(rhoL).epsilon(1e-10));
+        CHECK(model->solve_rho_Tp(T, p, z, RhoPhase::vapor) == Approx(rhoV).epsilon(1e-6));
+    }
+    SECTION("stable root"){
+        // Compressed liquid, and superheated vapor at a lower pressure at which the liquid root is metastable
+        CHECK(model->solve_rho_Tp(300, get_p(300, 12000), z) == Approx(12000).epsilon(1e-10));
+        double p = get_p(300, 100);
+        CHECK(model->solve_rho_Tp(300, p, z) == Approx(100).epsilon(1e-10));
+        CHECK(model->solve_rho_Tp(300, p, z, RhoPhase::liquid) > 10000);
+    }
+    SECTION("batch"){
+        Eigen::ArrayXd T(3), rho(3), p(3);
+        T << 250, 360, 400;
+        rho << 14000, 100, 5000;
+        for (auto i = 0; i < T.size(); ++i){ p(i) = get_p(T(i), rho(i)); }
+        Eigen::ArrayXXd Z = Eigen::ArrayXXd::Ones(3, 1);
+        auto rhos = model->solve_rho_Tp_many(T, p, Z);
+        for (auto i = 0; i < T.size(); ++i){
+            CHECK(rhos(i) == Approx(rho(i)).epsilon(1e-10));
+            CHECK(rhos(i) == model->solve_rho_Tp(T(i), p(i), z));
+        }
+        Eigen::ArrayXd pshort = p.head(2);
+        CHECK_THROWS(model->solve_rho_Tp_many(T, pshort, Z));
+    }
+}
+
+namespace {
+    // Propane + n-butane, with parameters fixed at compile time
+    constexpr teqp::fixedcubic::FluidSet<2> fixed_propane_butane{ {369.89, 425.125}, {4251200.0, 3796000.0}, {0.1521, 0.201}, {{{0.0, 0.01}, {0.01, 0.0}}} };
+}
+
+TEST_CASE("Cubics with parameters fixed at compile time", "[cubic]")
+{
+    using namespace teqp::fixedcubic;
+    static_assert(FixedPR<fixed_propane_butane>::bi[1] > FixedPR<fixed_propane_butane>::bi[0], "b is a constant expression");
+    const FixedPR<fixed_propane_butane> fpr;
+    const FixedSRK<fixed_propane_butane> fsrk;
+    const FixedvdW<fixed_propane_butane> fvdw;
+
+    vad Tc_K = { 369.89, 425.125 }, pc_Pa = { 4251200.0, 3796000.0 }, acentric = { 0.1521, 0.201 };
+    Eigen::ArrayXXd kmat(2, 2); kmat << 0, 0.01, 0.01, 0;
+    auto pr = canonical_PR(Tc_K, pc_Pa, acentric, kmat);
+    auto srk = canonical_SRK(Tc_K, pc_Pa, acentric, kmat);
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    std::array<double, 2> zarr = { 0.4, 0.6 };
+
+    for (double T : {250.0, 400.0}) {
+        for (double rho : {100.0, 8000.0}) {
+            CAPTURE(T, rho);
+            CHECK(fpr.alphar(T, rho, zarr) == Approx(pr.alphar(T, rho, z)).epsilon(1e-13));
+            CHECK(fsrk.alphar(T, rho, zarr) == Approx(srk.alphar(T, rho, z)).epsilon(1e-13));
+            CHECK(TDXDerivatives<decltype(fpr)>::get_Ar11(fpr, T, rho, z) == Approx(TDXDerivatives<decltype(pr)>::get_Ar11(pr, T, rho, z)).epsilon(1e-12));
+            CHECK(TDXDerivatives<decltype(fsrk)>::get_Ar02(fsrk, T, rho, z) == Approx(TDXDerivatives<decltype(srk)>::get_Ar02(srk, T, rho, z)).epsilon(1e-12));
+        }
+    }
+    // van der Waals, against its mixing rules written out
+    constexpr double T = 300, rho = 2000;
+    const double a = 27.0/64.0*(0.4*0.4*pow2(fvdw.Ru*Tc_K[0])/pc_Pa[0] + 0.6*0.6*pow2(fvdw.Ru*Tc_K[1])/pc_Pa[1] + 2*0.4*0.6*0.99*fvdw.Ru*fvdw.Ru*Tc_K[0]*Tc_K[1]/sqrt(pc_Pa[0]*pc_Pa[1]));
+    const double b = 0.4*fvdw.bi[0] + 0.6*fvdw.bi[1];
+    CHECK(fvdw.alphar(T, rho, zarr) == Approx(-log(1 - b*rho) - a/(fvdw.Ru*T)*rho).epsilon(1e-13));
+    CHECK_THROWS_AS(fpr.alphar(T, rho, std::array<double, 3>{ 0.2, 0.3, 0.5 }), teqp::InvalidArgument);
+}
+
+TEST_CASE("Trace the phase envelope of a mixture of fixed composition", "[cubic][VLE][envelope]")
+{
+    // Methane + propane
+    auto model = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 369.89}}, {"pcrit / Pa", {4599200, 4251200.0}}, {"acentric", {0.011, 0.1521}}}}});
+    double T = 250;
+    auto [rhoLpure, rhoVpure] = canonical_PR(vad{369.89}, vad{4251200.0}, vad{0.1521}).superanc_rhoLV(T);
+    Eigen::ArrayXd rhoL0 = (Eigen::ArrayXd(2) << 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV0 = (Eigen::ArrayXd(2) << 50, rhoVpure).finished();
+    auto [code, rhovecL, rhovecV] = model->mix_VLE_Tx(T, rhoL0, rhoV0, rhoL0/rhoL0.sum(), 1e-10, 1e-10, 1e-10, 1e-10, 10);
+    Eigen::ArrayXd z = rhovecL/rhovecL.sum();
+
+    // Start from the bubble point, with the liquid as the bulk phase
+    std::vector<PhaseEnvelopePoint> points;
+    auto reason = trace_phase_envelope(*model, T, rhovecL, rhovecV, [&](const PhaseEnvelopePoint& pt) {
+        points.push_back(pt);
+        return true;
+    });
+    CHECK(reason == "The pressure fell below p_min");
+    std::map<PhaseEnvelopeEvent, std::vector<PhaseEnvelopePoint>> events;
+    for (const auto& pt : points) {
+        events[pt.event].push_back(pt);
+        CHECK((pt.rhovecB/pt.rhovecB.sum() - z).cwiseAbs().maxCoeff() < 1e-10);
+    }
+    REQUIRE(events[PhaseEnvelopeEvent::cricondenbar].size() == 1);
+    REQUIRE(events[PhaseEnvelopeEvent::cricondentherm].size() == 1);
+    REQUIRE(events[PhaseEnvelopeEvent::critical].size() == 1);
+    const auto& bar = events[PhaseEnvelopeEvent::cricondenbar][0];
+    const auto& therm = events[PhaseEnvelopeEvent::cricondentherm][0];
+    const auto& crit = events[PhaseEnvelopeEvent::critical][0];
+    for (const auto& pt : events[PhaseEnvelopeEvent::none]) {
+        CHECK(pt.p < bar.p*(1 + 1e-8));
+        CHECK(pt.T < therm.T*(1 + 1e-8));
+    }
+    // The interpolated critical point agrees with the one from the criticality conditions at the overall composition
+    auto [Tc, rhovecc] = CriticalTracing<cppinterface::AbstractModel>::critical_polish_fixedmolefrac(*model, crit.T, crit.rhovecB, z[0]);
+    CHECK(crit.T == Approx(Tc).epsilon(1e-5));
+    CHECK(crit.rhovecB.sum() == Approx(rhovecc.sum()).epsilon(1e-3));
+
+    // Past the critical point the bulk phase is the vapor of a dew point, which mixture_VLE_px reproduces
+    const auto& dew = points.back();
+    CHECK(dew.rhovecB.sum() < dew.rhovecI.sum());
+    auto [codepx, Tpx, rhovecBpx, rhovecIpx] = model->mixture_VLE_px(dew.p, z, dew.T*1.001, dew.rhovecB, dew.rhovecI);
+    CHECK(Tpx == Approx(dew.T).epsilon(1e-8));
+
+    // A ternary mixture, with the JSON output
+    auto model3 = cppinterface::make_model({{"kind", "PR"}, {"model", {{"Tcrit / K", {190.564, 305.32, 369.89}}, {"pcrit / Pa", {4599200, 4872200.0, 4251200.0}}, {"acentric", {0.011, 0.0995, 0.1521}}}}});
+    Eigen::ArrayXd rhoL03 = (Eigen::ArrayXd(3) << 500, 500, rhoLpure).finished();
+    Eigen::ArrayXd rhoV03 = (Eigen::ArrayXd(3) << 50, 50, rhoVpure).finished();
+    auto [code3, rhovecL3, rhovecV3] = model3->mix_VLE_Tx(T, rhoL03, rhoV03, rhoL03/rhoL03.sum(), 1e-10, 1e-10, 1e-10, 1e-10, 10);
+    PhaseEnvelopeOptions opt;
+    opt.telemetry = true;
+    auto J = model3->trace_phase_envelope(T, rhovecL3, rhovecV3, opt);
+    CHECK(J.at("meta").at("termination_reason") == "The pressure fell below p_min");
+    CHECK(J.at("meta").at("telemetry").at("num_iter").get<int>() > 0);
+    std::map<std::string, int> counts;
+    for (const auto& pt : J.at("data")) {
+        counts[pt.at("event")]++;
+    }
+    CHECK(counts["cricondenbar"] == 1);
+    CHECK(counts["cricondentherm"] == 1);
+    CHECK(counts["critical"] == 1);
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using Catch::Approx;
+
+#include <algorithm>
+#include <valarray>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/deriv_adapter.hpp"
+#include "teqp/cpp/fitting.hpp"
+#include "teqp/models/cubics.hpp"
+#include "teqp/models/fwd.hpp"
+
+using namespace teqp;
+using namespace teqp::fitting;
+
+namespace {
+    // Methane + propane
+    const std::valarray<double> Tc_K = {190.564, 369.89}, pc_Pa = {4599200, 4251200.0}, acentric = {0.011, 0.1521};
+
+    auto make_PR(double kij){
+        Eigen::ArrayXXd kmat(2, 2); kmat << 0, kij, kij, 0;
+        return cppinterface::adapter::make_owned(canonical_PR(Tc_K, pc_Pa, acentric, kmat));
+    }
+
+    /// Synthetic data from the model with kij = 0.05: bubble points with the vapor compositions, and liquid densities
+    std::vector<DataPoint> make_data(){
+        auto model = make_PR(0.05);
+        const double T = 250;
+        // Start from pure propane
+        auto propane = canonical_PR(std::valarray<double>{Tc_K[1]}, std::valarray<double>{pc_Pa[1]}, std::valarray<double>{acentric[1]});
+        auto [rhoL, rhoV] = propane.superanc_rhoLV(T);
+        Eigen::ArrayXd rhovecL = (Eigen::ArrayXd(2) << 1e-6*rhoL, rhoL).finished();
+        Eigen::ArrayXd rhovecV = (Eigen::ArrayXd(2) << 1e-6*rhoV, rhoV).finished();
+
+        std::vector<DataPoint> points;
+        for (double x0 : {0.05, 0.1, 0.15, 0.2, 0.25}){
+            Eigen::ArrayXd x = (Eigen::ArrayXd(2) << x0, 1 - x0).finished();
+            // March along the liquid composition, each bubble point giving the guesses of the next one
+            auto [code, L, V] = model->mix_VLE_Tx(T, rhovecL, rhovecV, x, 1e-10, 1e-10, 1e-10, 1e-10, 20);
+            REQUIRE(code == VLE_return_code::xtol_satisfied);
+            rhovecL = L; rhovecV = V;
+
+            DataPoint pt;
+            pt.kind = PointKind::PTxy;
+            pt.T = T; pt.x = x; pt.y = V/V.sum();
+            pt.p = L.sum()*model->get_R(x)*T + model->get_pr(T, L);
+            pt.rhovecL0 = L; pt.rhovecV0 = V;
+            points.push_back(pt);
+
+            DataPoint dens;
+            dens.kind = PointKind::density;
+            dens.T = T; dens.x = x; dens.p = 2*pt.p; dens.phase = density::RhoPhase::liquid;
+            dens.rho = model->solve_rho_Tp(T, dens.p, x, dens.phase);
+            points.push_back(dens);
+        }
+        return points;
+    }
+
+    void set_kij(std::unique_ptr<cppinterface::AbstractModel>& model, const EArrayd& params){
+        Eigen::ArrayXXd kmat(2, 2); kmat << 0, params[0], params[0], 0;
+        cppinterface::adapter::get_model_ref<canonical_cubic_t>(model.get()).set_kmat(kmat);
+    }
+}
+
+TEST_CASE("Fit of the kij of PR methane + propane to synthetic data", "[fitting]")
+{
+    auto points = make_data();
+    async::ThreadPool pool(3);
+    ObjectiveOptions opt;
+    opt.chunk_size = 2;
+    FitObjective obj(points, [](){ return make_PR(0.0); }, set_kij, opt, pool);
+    CHECK(obj.get_Nresiduals() == 5*2 + 5);
+    CHECK(obj.get_offsets()[1] == 2);
+
+    SECTION("Residuals vanish at the parameters of the data"){
+        auto res = obj.evaluate((EArrayd(1) << 0.05).finished());
+        CHECK(std::all_of(res.success.begin(), res.success.end(), [](bool b){ return b; }));
+        CHECK(res.residuals.abs().maxCoeff() < 1e-8);
+        auto res2 = obj.evaluate((EArrayd(1) << 0.0).finished());
+        CHECK(res2.residuals.abs().maxCoeff() > 1e-3);
+    }
+    SECTION("Jacobian from the perturbed copies matches a manual forward difference"){
+        const double kij = 0.02, h = 1e-6*kij;
+        auto res = obj.evaluate((EArrayd(1) << kij).finished(), true);
+        REQUIRE(res.jacobian.rows() == static_cast<Eigen::Index>(obj.get_Nresiduals()));
+        REQUIRE(res.jacobian.cols() == 1);
+        auto resp = obj.evaluate((EArrayd(1) << kij + h).finished());
+        EArrayd fd = (resp.residuals - res.residuals)/h;
+        for (auto i = 0; i < fd.size(); ++i){
+            CAPTURE(i);
+            CHECK(res.jacobian(i, 0) == Approx(fd[i]).margin(1e-6));
+        }
+    }
+    SECTION("Gauss-Newton steps recover kij"){
+        EArrayd params = (EArrayd(1) << 0.03).finished();
+        for (int iter = 0; iter < 6; ++iter){
+            auto res = obj.evaluate(params, true);
+            REQUIRE(res.residuals.allFinite());
+            Eigen::VectorXd r = res.residuals.matrix();
+            Eigen::MatrixXd J = res.jacobian.matrix();
+            params -= (J.transpose()*J).ldlt().solve(J.transpose()*r).array();
+        }
+        CHECK(params[0] == Approx(0.05).margin(1e-7));
+    }
+}
+
+TEST_CASE("Invalid data points of a fit", "[fitting]")
+{
+    auto factory = [](){ return make_PR(0.0); };
+    DataPoint pt;
+    pt.kind = PointKind::PTxy;
+    pt.T = 250; pt.p = 1e6; pt.x = (EArrayd(2) << 0.5, 0.5).finished();
+    CHECK_THROWS_AS(FitObjective({pt}, factory, set_kij), teqp::InvalidArgument); // no guesses of the phases
+    pt.kind = PointKind::density;
+    pt.T = -1;
+    CHECK_THROWS_AS(FitObjective({pt}, factory, set_kij), teqp::InvalidArgument);
+    CHECK_THROWS_AS(FitObjective({}, factory, nullptr), teqp::InvalidArgument);
+}
@@ -184,6 +184,26 @@ TEST_CASE("Check that all ancillaries can be instantiated and work properly", "[
     }
 }
 
+TEST_CASE("Check array evaluation of ancillaries", "[multifluid],[ancillaries]") {
+    auto model = build_multifluid_model({ "n-Propane" }, "../mycp");
+    auto jancillaries = nlohmann::json::parse(model.get_meta()).at("pures")[0].at("ANCILLARIES");
+    auto anc = teqp::MultiFluidVLEAncillaries(jancillaries);
+    Eigen::ArrayXd T = Eigen::ArrayXd::LinSpaced(20, 0.5*anc.rhoL.T_r, 0.99*anc.rhoL.T_r);
+    Eigen::ArrayXd rhoL(T.size()), rhoV(T.size()), p(T.size());
+    anc.eval_many(T, rhoL, rhoV, p);
+    auto rhoLarray = anc.rhoL(T);
+    for (auto i = 0; i < T.size(); ++i){
+        CHECK(rhoL[i] == anc.rhoL(T[i]));
+        CHECK(rhoV[i] == anc.rhoV(T[i]));
+        CHECK(p[i] == anc.pL(T[i]));
+        CHECK(rhoLarray[i] == rhoL[i]);
+    }
+    T[3] = 1.1*anc.rhoL.T_r;
+    CHECK_THROWS(anc.eval_many(T, rhoL, rhoV, p));
+    Eigen::ArrayXd tooshort(3);
+    CHECK_THROWS(anc.rhoL.eval_many(T, tooshort));
+}
+
 TEST_CASE("Check that mixtures can also do absolute paths", "[multifluid],[abspath]") {
     std::string root = "../mycp";
     SECTION("With absolute paths to json file") {
@@ -446,3 +466,247 @@ TEST_CASE("Check pure fluid throws with composition array of wrong length", "[vi
     CHECK_THROWS(vir::get_dmBnvirdTm<2,1>(model, T, z));
     CHECK_THROWS(vir::get_Bnvir<2>(model, T, z));
 }
+
+TEST_CASE("Check prepared composition for multifluid", "[multifluid][prepared]")
+{
+    std::string root = "../mycp";
+    const auto model = build_multifluid_model({ "Nitrogen", "Ethane" }, root);
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    const auto prepared = model.prepare_composition(z);
+    double T = 300, rho = 1000;
+    using tdx = TDXDerivatives<decltype(model)>;
+    using tdxp = TDXDerivatives<decltype(prepared)>;
+    CHECK(tdxp::get_Ar00(prepared, T, rho, z) == Approx(tdx::get_Ar00(model, T, rho, z)));
+    CHECK(tdxp::get_Ar11(prepared, T, rho, z) == Approx(tdx::get_Ar11(model, T, rho, z)));
+    CHECK(tdxp::get_Ar02(prepared, T, rho, z) == Approx(tdx::get_Ar02(model, T, rho, z)));
+    
+    // Other compositions are forwarded to the model
+    auto z2 = (Eigen::ArrayXd(2) << 0.1, 0.9).finished();
+    CHECK(tdxp::get_Ar01(prepared, T, rho, z2) == Approx(tdx::get_Ar01(model, T, rho, z2)));
+    
+    // As are the composition derivatives
+    using id = IsochoricDerivatives<decltype(model)>;
+    using idp = IsochoricDerivatives<decltype(prepared)>;
+    Eigen::ArrayXd rhovec = rho*z;
+    auto g = id::build_Psir_gradient_autodiff(model, T, rhovec);
+    auto gp = idp::build_Psir_gradient_autodiff(prepared, T, rhovec);
+    CHECK(gp[0] == Approx(g[0]));
+    CHECK(gp[1] == Approx(g[1]));
+}
+
+TEST_CASE("Check analytic derivatives for multifluid", "[multifluid][analytic]")
+{
+    std::string root = "../mycp";
+    const auto model = build_multifluid_model({ "Nitrogen", "Ethane" }, root);
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    double T = 300, rho = 1000;
+    using tdx = TDXDerivatives<decltype(model)>;
+    CHECK(tdx::get_Arxy<0, 0, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Ar00(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<1, 0, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<1, 0>(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<0, 1, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<0, 1>(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<1, 1, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<1, 1>(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<2, 0, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<2, 0>(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<0, 2, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<0, 2>(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<2, 1, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<2, 1>(model, T, rho, z)));
+    CHECK(tdx::get_Arxy<0, 4, ADBackends::analytic>(model, T, rho, z) == Approx(tdx::get_Arxy<0, 4>(model, T, rho, z)));
+    CHECK(tdx::get_Ar<ADBackends::analytic>(1, 2, model, T, rho, z) == Approx(tdx::get_Ar12(model, T, rho, z)));
+    
+    // Also through the prepared model
+    const auto prepared = model.prepare_composition(z);
+    using tdxp = TDXDerivatives<decltype(prepared)>;
+    CHECK(tdxp::get_Arxy<1, 1, ADBackends::analytic>(prepared, T, rho, z) == Approx(tdx::get_Arxy<1, 1>(model, T, rho, z)));
+}
+
+TEST_CASE("Check merged EOS term container against the variant one", "[multifluid][merged]")
+{
+    PowerEOSTerm p;
+    p.n = Eigen::ArrayXd::LinSpaced(4, 0.1, 0.4); p.t = Eigen::ArrayXd::LinSpaced(4, 0.5, 2); p.d = Eigen::ArrayXd::LinSpaced(4, 1, 4);
+    p.l = Eigen::ArrayXd::Constant(4, 2); p.c = Eigen::ArrayXd::Ones(4); p.l_i = p.l.cast<int>();
+    GaussianEOSTerm g;
+    g.n = p.n; g.t = p.t; g.d = p.d; g.eta = 10*p.n; g.beta = 5*p.n; g.gamma = p.n; g.epsilon = p.n;
+    
+    EOSTermContainer<PowerEOSTerm, GaussianEOSTerm> variant;
+    MergedEOSTermContainer<PowerEOSTerm, GaussianEOSTerm> merged;
+    for (auto k = 0; k < 2; ++k){
+        variant.add_term(p); variant.add_term(g);
+        merged.add_term(p); merged.add_term(g);
+    }
+    CHECK(merged.size() == variant.size());
+    double tau = 1.3, delta = 0.7;
+    CHECK(merged.alphar(tau, delta) == Approx(variant.alphar(tau, delta)));
+    CHECK(merged.alphar(tau, 0.0) == Approx(variant.alphar(tau, 0.0)));
+    autodiff::dual2nd deltaad = delta;
+    CHECK(getbaseval(merged.alphar(tau, deltaad)) == Approx(getbaseval(variant.alphar(tau, deltaad))));
+}
+
+TEST_CASE("Check binary round trip of multifluid model", "[multifluid][binary]")
+{
+    std::string root = "../mycp";
+    const auto model = build_multifluid_model({ "Nitrogen", "Ethane" }, root);
+    auto path = (std::filesystem::temp_directory_path() / "teqp_multifluid_N2_C2.cbor").string();
+    save_multifluid_model_binary(model, path);
+    const auto loaded = load_multifluid_model_binary(path);
+    
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    double T = 300, rho = 1000;
+    CHECK(loaded.alphar(T, rho, z) == model.alphar(T, rho, z));
+    
+    // And through the factory
+    auto am = cppinterface::make_model({{"kind", "multifluid"}, {"model", {{"binary", path}}}});
+    CHECK(am->get_Ar00(T, rho, z) == model.alphar(T, rho, z));
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Check cached alias map", "[multifluid][aliasmap]")
+{
+    std::string root = "../mycp";
+    auto amap = build_alias_map(root);
+    auto cached = get_alias_map(root);
+    CHECK(cached->size() == amap.size());
+    for (const auto& [k, v] : amap){
+        CHECK(cached->at(k) == v);
+    }
+    // Same instance the second time
+    CHECK(get_alias_map(root) == cached);
+    
+    // The index is written to the requested path and read back, and never into the fluid folder
+    auto indexpath = (std::filesystem::temp_directory_path() / "teqp_alias_index_test" / "index.json").string();
+    std::filesystem::remove(indexpath);
+    auto built = internal::load_alias_index(root, indexpath);
+    REQUIRE(std::filesystem::is_regular_file(indexpath));
+    auto loaded = internal::load_alias_index(root, indexpath);
+    CHECK(built == loaded);
+    CHECK(loaded.size() == amap.size());
+    CHECK(!std::filesystem::exists(root + "/dev/.teqp_alias_index.json"));
+    std::filesystem::remove_all(std::filesystem::path(indexpath).parent_path());
+}
+
+TEST_CASE("Check indexed loading of BIP and departure collections", "[multifluid][indexed]")
+{
+    std::string root = "../mycp";
+    std::vector<std::string> fluids = { "Nitrogen", "Ethane", "Methane" };
+    auto BIPpath = root + "/dev/mixtures/mixture_binary_pairs.json";
+    auto deppath = root + "/dev/mixtures/mixture_departure_functions.json";
+    // With the complete collections passed in as JSON strings, no index is used
+    const auto full = build_multifluid_model(fluids, root, load_a_JSON_file(BIPpath).dump(), {}, load_a_JSON_file(deppath).dump());
+    const auto indexed = build_multifluid_model(fluids, root, BIPpath, {}, deppath);
+    
+    auto z = (Eigen::ArrayXd(3) << 0.2, 0.3, 0.5).finished();
+    double T = 300, rho = 1000;
+    CHECK(indexed.alphar(T, rho, z) == full.alphar(T, rho, z));
+    
+    auto [BIP, dep] = get_indexed_mixture_collections(BIPpath, deppath)->get_subset(make_pure_components_JSON(fluids, root));
+    CHECK(BIP.size() >= 3);
+    CHECK(BIP.size() < load_a_JSON_file(BIPpath).size());
+    // Built once per pair of paths
+    CHECK(get_indexed_mixture_collections(BIPpath, deppath) == get_indexed_mixture_collections(BIPpath, deppath));
+}
+
+TEST_CASE("Check that only the active departure pairs are evaluated", "[multifluid][departure]")
+{
+    std::string root = "../mycp";
+    std::vector<std::string> fluids = { "Methane", "Ethane", "Nitrogen", "CarbonDioxide" };
+    const auto model = build_multifluid_model(fluids, root);
+    // Of the six pairs, only ethane + carbon dioxide has F = 0 in the GERG-2008 parameters of the BIP file
+    CHECK(model.dep.get_Nactive_pairs() == 5);
+    
+    // The sum over all pairs, with F_ij taken from the metadata
+    auto meta = nlohmann::json::parse(model.get_meta());
+    auto z = (Eigen::ArrayXd(4) << 0.7, 0.1, 0.15, 0.05).finished();
+    double T = 250, rho = 3000;
+    double tau = model.redfunc.get_Tr(z)/T, delta = rho/model.redfunc.get_rhor(z);
+    double expected = 0;
+    for (auto i = 0; i < 4; ++i){
+        for (auto j = i+1; j < 4; ++j){
+            double Fij = meta["mix"][std::to_string(i)][std::to_string(j)]["BIP"].value("F", 0.0);
+            expected += z[i]*z[j]*Fij*model.dep.get_alpharij(i, j, tau, delta);
+        }
+    }
+    CHECK(model.dep.alphar(tau, delta, z) == Approx(expected));
+}
+
+TEST_CASE("Check the Psir Hessian assembled from the pure fluids and departure pairs", "[multifluid][PsirHessian]")
+{
+    std::string root = "../mycp";
+    std::vector<std::string> fluids = { "Methane", "Nitrogen", "CarbonDioxide", "Ethane", "Propane", "n-Butane" };
+    const auto model = build_multifluid_model(fluids, root);
+    using id = IsochoricDerivatives<decltype(model)>;
+    auto rhovec = (Eigen::ArrayXd(6) << 8000, 300, 200, 600, 200, 50).finished();
+    double T = 250;
+    
+    auto [f, g, H] = model.get_Psir_fgradHessian_analytic(T, rhovec);
+    
+    // Reference from one dense evaluation with VectorDual concentrations
+    double fvd = 0; Eigen::ArrayXd gvd(6); Eigen::MatrixXd Hvd(6, 6);
+    id::unpack_vector_dual(id::get_Psir_vector_dual<vdual2nd>(model, T, rhovec), fvd, gvd, Hvd);
+    CHECK(f == Approx(fvd));
+    for (auto i = 0; i < 6; ++i) {
+        CHECK(g[i] == Approx(gvd[i]));
+        for (auto j = 0; j < 6; ++j) {
+            CHECK(H(i, j) == Approx(Hvd(i, j)));
+        }
+    }
+    // The builders of IsochoricDerivatives pick it up
+    CHECK(id::build_Psir_Hessian_autodiff(model, T, rhovec)(2, 4) == Approx(Hvd(2, 4)));
+}
+
+TEST_CASE("Check column-wise Clenshaw evaluation of Chebyshev2D term", "[multifluid][Chebyshev2D]")
+{
+    Chebyshev2DEOSTerm term;
+    term.a = (Eigen::ArrayXXd(4, 4) << 1, 2, 3, 4, 0.5, -2, 3, 1, 1, 0.2, -3, 4, 0.1, 2, 0.3, -4).finished();
+    term.taumin = 0.5; term.taumax = 3; term.deltamin = 0; term.deltamax = 4;
+    double tau = 1.3, delta = 0.7;
+    double x = (2*tau - (term.taumax + term.taumin))/(term.taumax - term.taumin);
+    double y = (2*delta - (term.deltamax + term.deltamin))/(term.deltamax - term.deltamin);
+    CHECK(term.alphar(tau, delta) == Approx(Chebyshev2DEOSTerm::Clenshaw2DEigen(term.a, x, y)));
+    
+    autodiff::dual taud = tau;
+    auto dalphardtau = autodiff::derivative([&](auto& t){ return term.alphar(t, delta); }, autodiff::wrt(taud), autodiff::at(taud));
+    double h = 1e-6;
+    CHECK(dalphardtau == Approx((term.alphar(tau + h, delta) - term.alphar(tau - h, delta))/(2*h)));
+}
+
+TEST_CASE("Check the memo of the tau factors of the multifluid terms", "[multifluid][taucache]")
+{
+    std::string root = "../mycp";
+    const auto model = build_multifluid_model({ "Nitrogen", "Ethane" }, root);
+    auto cached = model;
+    cached.enable_tau_cache(true);
+    CHECK(cached.is_tau_cache_enabled());
+    CHECK(!model.is_tau_cache_enabled());
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    using tdx = TDXDerivatives<decltype(model)>;
+    for (double T : {300.0, 300.0, 250.0}){
+        for (double rho : {0.0, 10.0, 1000.0, 10000.0}){
+            CAPTURE(T); CAPTURE(rho);
+            CHECK(tdx::get_Ar00(cached, T, rho, z) == Approx(tdx::get_Ar00(model, T, rho, z)));
+            CHECK(tdx::get_Ar02(cached, T, rho, z) == Approx(tdx::get_Ar02(model, T, rho, z)));
+            // tau is not a double here, so the memo is bypassed
+            CHECK(tdx::get_Ar11(cached, T, rho, z) == Approx(tdx::get_Ar11(model, T, rho, z)));
+        }
+    }
+    
+    SECTION("All the kinds of terms"){
+        auto lin = [](double a, double b){ return Eigen::ArrayXd::LinSpaced(3, a, b).eval(); };
+        JustPowerEOSTerm jp; jp.n = lin(0.1, 0.3); jp.t = lin(0.5, 2); jp.d = lin(1, 3);
+        PowerEOSTerm p; p.n = jp.n; p.t = jp.t; p.d = jp.d; p.l = lin(1, 3); p.c = lin(1, 1); p.l_i = p.l.cast<int>();
+        ExponentialEOSTerm e; e.n = jp.n; e.t = jp.t; e.d = jp.d; e.l = p.l; e.g = lin(0.5, 1); e.l_i = p.l_i;
+        DoubleExponentialEOSTerm de; de.n = jp.n; de.t = jp.t; de.d = jp.d; de.gd = e.g; de.ld = p.l; de.ld_i = p.l_i; de.gt = e.g; de.lt = lin(1, 2);
+        GaussianEOSTerm g; g.n = jp.n; g.t = jp.t; g.d = jp.d; g.eta = lin(1, 2); g.beta = lin(0.5, 1); g.gamma = lin(1, 1.2); g.epsilon = lin(0.5, 1);
+        GERG2004EOSTerm gg; gg.n = jp.n; gg.t = jp.t; gg.d = jp.d; gg.eta = g.eta; gg.beta = g.beta; gg.gamma = g.gamma; gg.epsilon = g.epsilon;
+        Lemmon2005EOSTerm le; le.n = jp.n; le.t = jp.t; le.d = jp.d; le.l = p.l; le.m = lin(1, 2); le.l_i = p.l_i;
+        GaoBEOSTerm gb; gb.n = jp.n; gb.t = jp.t; gb.d = jp.d; gb.eta = g.eta; gb.beta = g.beta; gb.gamma = g.gamma; gb.epsilon = g.epsilon; gb.b = lin(1, 2);
+        MergedEOSTermContainer<JustPowerEOSTerm, PowerEOSTerm, ExponentialEOSTerm, DoubleExponentialEOSTerm, GaussianEOSTerm, GERG2004EOSTerm, Lemmon2005EOSTerm, GaoBEOSTerm> terms;
+        terms.add_term(jp); terms.add_term(p); terms.add_term(e); terms.add_term(de);
+        terms.add_term(g); terms.add_term(gg); terms.add_term(le); terms.add_term(gb);
+        
+        TauFactorCache cache;
+        double tau = 1.3;
+        for (double delta : {0.0, 0.7, 1.2}){
+            CAPTURE(delta);
+            CHECK(terms.alphar(ReducedStateContext<double, double>(tau, delta, &cache)) == Approx(terms.alphar(tau, delta)));
+            autodiff::dual2nd deltaad = delta;
+            CHECK(getbaseval(terms.alphar(ReducedStateContext<double, autodiff::dual2nd>(tau, deltaad, &cache))) == Approx(terms.alphar(tau, delta)));
+        }
+    }
+}
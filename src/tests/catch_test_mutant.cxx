@@ -202,4 +202,35 @@ TEST_CASE("Mutant with Chebyshev departure function", "[mutant]") {
     auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
     using tdx = TDXDerivatives<decltype(mutant0)>;
     CHECK(tdx::get_Ar00(mutant0, T, rho, z) != tdx::get_Ar00(mutant1, T, rho, z));
-}
\ No newline at end of file
+}
+TEST_CASE("Overwrite the parameters of a mutant in place", "[mutant][inplace]")
+{
+    std::string root = "../mycp";
+    auto model = build_multifluid_model({ "R32", "R1234ZEE" }, root, root + "/dev/mixtures/mixture_binary_pairs.json", { {"estimate", "Lorentz-Berthelot"} });
+    auto get_spec = [&](double betaT, double gammaT, double betaV, double gammaV, double Fij){
+        nlohmann::json j = {{"0", {{"1", {{"BIP", {{"betaT", betaT}, {"gammaT", gammaT}, {"betaV", betaV}, {"gammaV", gammaV}, {"Fij", Fij}}}}}}}};
+        j["0"]["1"]["departure"] = get_departure_json("KWT", root);
+        return j;
+    };
+    auto mutant = build_multifluid_mutant(model, get_spec(1.0, 1.0, 1.0, 1.0, 0.0));
+    auto expected = build_multifluid_mutant(model, get_spec(0.85, 1.24, 0.76, 0.99, 1.0));
+    
+    mutant.set_BIP(0, 1, 0.85, 1.24, 0.76, 0.99);
+    mutant.set_F(0, 1, 1.0);
+    double T = 300, rho = 5000;
+    auto z = (Eigen::ArrayXd(2) << 0.4, 0.6).finished();
+    using tdx = TDXDerivatives<decltype(mutant)>;
+    CHECK(tdx::get_Ar01(mutant, T, rho, z) == Approx(tdx::get_Ar01(expected, T, rho, z)));
+    CHECK_THROWS(mutant.set_BIP(1, 0, 0.85, 1.24, 0.76, 0.99));
+    
+    // Scaling all the coefficients of the departure function by two is the same as doubling F
+    mutant.modify_departure(0, 1, [](auto& terms){
+        for (auto& t : terms.template get_terms<JustPowerEOSTerm>()){ t.n *= 2; }
+        for (auto& t : terms.template get_terms<PowerEOSTerm>()){ t.n *= 2; }
+        for (auto& t : terms.template get_terms<GaussianEOSTerm>()){ t.n *= 2; }
+        for (auto& t : terms.template get_terms<GERG2004EOSTerm>()){ t.n *= 2; }
+        for (auto& t : terms.template get_terms<DoubleExponentialEOSTerm>()){ t.n *= 2; }
+    });
+    auto expected2 = build_multifluid_mutant(model, get_spec(0.85, 1.24, 0.76, 0.99, 2.0));
+    CHECK(tdx::get_Ar01(mutant, T, rho, z) == Approx(tdx::get_Ar01(expected2, T, rho, z)));
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using Catch::Approx;
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/algorithms/superancillary_pure.hpp"
+
+using namespace teqp;
+
+TEST_CASE("Generate superancillary equations for PC-SAFT methane", "[superanc]")
+{
+    nlohmann::json coeffs = {{{"name", "Methane"}, {"m", 1.0}, {"sigma_Angstrom", 3.7039}, {"epsilon_over_k", 150.03}, {"BibTeXKey", "Gross-IECR-2001"}}};
+    auto model = cppinterface::make_model({{"kind", "PCSAFT"}, {"model", {{"coeffs", coeffs}}}});
+    nlohmann::json spec = {{"Tcguess", 190.0}, {"rhocguess", 10000.0}, {"Tmin", 100.0}};
+    auto sa = superancillary::build_pure_superancillary(*model, spec);
+    CHECK(sa.Tmax < sa.Tcrit);
+    
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    double R = model->get_R(z);
+    for (double T : {100.0, 140.0, 180.0, sa.Tmax - 0.01}){
+        CAPTURE(T);
+        auto rhos = sa.get_rhoLrhoV(T);
+        auto polished = sa.get_rhoLrhoV(*model, T);
+        CHECK(rhos[0] == Approx(polished[0]).epsilon(1e-8));
+        CHECK(rhos[1] == Approx(polished[1]).epsilon(1e-8));
+        double pV = polished[1]*R*T*(1 + model->get_Ar01(T, polished[1], z));
+        CHECK(sa.get_p(T) == Approx(pV).epsilon(1e-8));
+    }
+    CHECK_THROWS(sa.get_rhoLrhoV(sa.Tcrit));
+    
+    // And the round trip through JSON
+    auto sa2 = superancillary::pure_superancillary_from_json(superancillary::to_json(sa));
+    CHECK(sa2.get_p(150.0) == sa.get_p(150.0));
+}
+
+TEST_CASE("Lazily built saturation cache for PC-SAFT methane", "[superanc]")
+{
+    nlohmann::json coeffs = {{{"name", "Methane"}, {"m", 1.0}, {"sigma_Angstrom", 3.7039}, {"epsilon_over_k", 150.03}, {"BibTeXKey", "Gross-IECR-2001"}}};
+    auto model = cppinterface::make_model({{"kind", "PCSAFT"}, {"model", {{"coeffs", coeffs}}}});
+    nlohmann::json spec = {{"Tcguess", 190.0}, {"rhocguess", 10000.0}, {"Tmin", 100.0}};
+    superancillary::PureSaturationCache cache(*model, spec);
+    CHECK(cache.get_num_built_panels() == 0);
+    
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    double R = model->get_R(z);
+    auto rhos = cache.get_rhoLrhoV(120.0);
+    auto polished = cache.get_rhoLrhoV_polished(120.0);
+    CHECK(rhos[0] == Approx(polished[0]).epsilon(1e-8));
+    CHECK(rhos[1] == Approx(polished[1]).epsilon(1e-8));
+    double pV = polished[1]*R*120.0*(1 + model->get_Ar01(120.0, polished[1], z));
+    CHECK(cache.get_p(120.0) == Approx(pV).epsilon(1e-8));
+    
+    // Only the panel holding the query is built, and nearby queries re-use it
+    auto Nbuilt = cache.get_num_built_panels();
+    CHECK(Nbuilt == 1);
+    cache.get_rhoLrhoV(120.001);
+    CHECK(cache.get_num_built_panels() == Nbuilt);
+    
+    // Queries elsewhere build further panels, and agree with the eagerly built expansions
+    auto sa = superancillary::build_pure_superancillary(*model, spec);
+    for (double T : {100.0, 140.0, 180.0, sa.Tmax}){
+        CAPTURE(T);
+        CHECK(cache.get_rhoLrhoV(T)[0] == Approx(sa.get_rhoLrhoV(T)[0]).epsilon(1e-8));
+        CHECK(cache.get_p(T) == Approx(sa.get_p(T)).epsilon(1e-8));
+    }
+    CHECK(cache.get_num_built_panels() > Nbuilt);
+    CHECK(cache.get_Tcrit() == sa.Tcrit);
+    CHECK_THROWS(cache.get_rhoLrhoV(sa.Tcrit));
+}
+
+TEST_CASE("On-disk cache of the superancillary equations of pure fluids", "[superanc]")
+{
+    nlohmann::json coeffs = {{{"name", "Methane"}, {"m", 1.0}, {"sigma_Angstrom", 3.7039}, {"epsilon_over_k", 150.03}, {"BibTeXKey", "Gross-IECR-2001"}}};
+    nlohmann::json model_json = {{"kind", "PCSAFT"}, {"model", {{"coeffs", coeffs}}}};
+    nlohmann::json spec = {{"Tcguess", 190.0}, {"rhocguess", 10000.0}, {"Tmin", 100.0}};
+    auto dir = (std::filesystem::temp_directory_path() / "teqp_superancillary_cache_test").string();
+    std::filesystem::remove_all(dir);
+    
+    // The key depends on the contents, not on the order of the fields
+    auto key = superancillary::get_superancillary_cache_key(model_json, spec);
+    CHECK(key == superancillary::get_superancillary_cache_key(model_json, {{"Tmin", 100.0}, {"rhocguess", 10000.0}, {"Tcguess", 190.0}}));
+    CHECK(key != superancillary::get_superancillary_cache_key(model_json, {{"Tcguess", 190.0}, {"rhocguess", 10000.0}, {"Tmin", 110.0}}));
+    
+    auto sa = superancillary::get_cached_pure_superancillary(model_json, spec, dir);
+    CHECK(std::filesystem::is_regular_file(std::filesystem::path(dir) / (key + ".json")));
+    // The second time the file is loaded
+    auto sa2 = superancillary::get_cached_pure_superancillary(model_json, spec, dir);
+    CHECK(sa2.Tcrit == sa.Tcrit);
+    CHECK(sa2.rhocrit == sa.rhocrit);
+    CHECK(sa2.get_p(150.0) == sa.get_p(150.0));
+    // A model that is not in the cache is built
+    CHECK_THROWS(superancillary::get_cached_pure_superancillary({{"kind", "unknown"}}, spec, dir));
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using Catch::Approx;
+
+#include <cmath>
+#include <filesystem>
+
+#include "teqp/cpp/teqpcpp.hpp"
+#include "teqp/cpp/tables.hpp"
+#include "teqp/algorithms/superancillary_pure.hpp"
+
+using namespace teqp;
+namespace properties = cppinterface::properties;
+
+namespace {
+    auto make_methane(){
+        nlohmann::json coeffs = {{{"name", "Methane"}, {"m", 1.0}, {"sigma_Angstrom", 3.7039}, {"epsilon_over_k", 150.03}, {"BibTeXKey", "Gross-IECR-2001"}}};
+        return cppinterface::make_model({{"kind", "PCSAFT"}, {"model", {{"coeffs", coeffs}}}});
+    }
+    auto make_methane_ideal_gas(){
+        nlohmann::json jpure = {{"R", 8.31446261815324}, {"terms", {
+            {{"type", "Lead"}, {"a_1", 1.0}, {"a_2", 200.0}},
+            {{"type", "LogT"}, {"a", -3.0}}
+        }}};
+        return cppinterface::make_model({{"kind", "IdealHelmholtz"}, {"model", {jpure}}});
+    }
+}
+
+TEST_CASE("Property table in (T, rho) for PC-SAFT methane", "[tables]")
+{
+    auto model = make_methane();
+    auto aig = make_methane_ideal_gas();
+    nlohmann::json spec = {{"Tcguess", 190.0}, {"rhocguess", 10000.0}, {"Tmin", 100.0}};
+    auto sa = superancillary::build_pure_superancillary(*model, spec);
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+
+    tables::PropertyTableOptions opt;
+    opt.Tmin = 100; opt.Tmax = 300; opt.rhomin = 1; opt.rhomax = 32000;
+    opt.mask = properties::p | properties::h | properties::s | properties::cp;
+    opt.reltol = 1e-7; opt.maxdepth = 6;
+    auto table = tables::build_property_table_Trho(*model, *aig, sa, opt);
+    CHECK(table.get_output_names() == std::vector<std::string>{"p", "h", "s", "cp"});
+    const auto ip = table.get_output_index("p"), ih = table.get_output_index("h"), icp = table.get_output_index("cp");
+    CHECK_THROWS_AS(table.get_output_index("JT"), teqp::InvalidArgument);
+
+    double out[4];
+    SECTION("Single-phase states"){
+        // Compressed liquid and superheated vapor below the critical point, and supercritical states
+        std::vector<std::pair<double, double>> states{{250, 3000}, {290, 15000}};
+        for (double T : {110.0, 150.0}){
+            auto rhos = sa.get_rhoLrhoV(*model, T);
+            states.emplace_back(T, 1.03*rhos[0]);
+            states.emplace_back(T, 0.5*rhos[1]);
+        }
+        for (auto [T, rho] : states){
+            CAPTURE(T, rho);
+            auto b = model->get_property_bundle(T, rho, z, opt.mask, aig.get());
+            table.get_all(T, rho, out);
+            CHECK(out[ip] == Approx(b.p).epsilon(1e-5));
+            CHECK(out[ih] == Approx(b.h).epsilon(1e-5));
+            CHECK(out[icp] == Approx(b.cp).epsilon(1e-5));
+            CHECK(table.get(ih, T, rho) == out[ih]);
+        }
+    }
+    SECTION("Two-phase states, from the lever rule"){
+        double T = 150, q = 0.4;
+        auto rhos = sa.get_rhoLrhoV(*model, T);
+        auto bL = model->get_property_bundle(T, rhos[0], z, opt.mask, aig.get()), bV = model->get_property_bundle(T, rhos[1], z, opt.mask, aig.get());
+        table.get_all(T, 1/((1 - q)/rhos[0] + q/rhos[1]), out);
+        CHECK(out[ip] == Approx(bV.p).epsilon(1e-6));
+        CHECK(out[ih] == Approx((1 - q)*bL.h + q*bV.h).epsilon(1e-6));
+        CHECK(std::isnan(out[icp]));
+    }
+    SECTION("Outside the table"){
+        table.get_all(50, 100, out);
+        CHECK(std::isnan(out[ip]));
+        table.get_all(200, 1e5, out);
+        CHECK(std::isnan(out[ip]));
+    }
+    SECTION("Round trips through a file and a view of the buffer"){
+        auto path = (std::filesystem::temp_directory_path() / "teqp_table_methane.bin").string();
+        table.save(path);
+        auto loaded = tables::PropertyTable::load(path);
+        std::filesystem::remove(path);
+        auto viewed = tables::PropertyTable::view(table.data(), table.size_bytes());
+        CHECK(loaded.get_Npatches() == table.get_Npatches());
+        CHECK(loaded.get(ih, 250, 3000) == table.get(ih, 250, 3000));
+        CHECK(viewed.get(ih, 250, 3000) == table.get(ih, 250, 3000));
+
+        std::vector<char> truncated(static_cast<const char*>(table.data()), static_cast<const char*>(table.data()) + 100);
+        CHECK_THROWS_AS(tables::PropertyTable::from_buffer(truncated.data(), truncated.size()), teqp::InvalidArgument);
+    }
+}
+
+TEST_CASE("Property table in (p, h) for PC-SAFT methane", "[tables]")
+{
+    auto model = make_methane();
+    auto aig = make_methane_ideal_gas();
+    nlohmann::json spec = {{"Tcguess", 190.0}, {"rhocguess", 10000.0}, {"Tmin", 100.0}};
+    auto sa = superancillary::build_pure_superancillary(*model, spec);
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+
+    tables::PropertyTableOptions opt;
+    opt.Tmin = 100; opt.Tmax = 300; opt.pmin = 1e4; opt.pmax = 1e7;
+    opt.mask = properties::s | properties::cp;
+    opt.reltol = 1e-7; opt.maxdepth = 6;
+    auto table = tables::build_property_table_ph(*model, *aig, sa, opt);
+    CHECK(table.get_output_names() == std::vector<std::string>{"T", "rho", "s", "cp"});
+
+    double out[4];
+    for (auto [T, p] : std::vector<std::pair<double, double>>{{120, 5e4}, {120, 5e6}, {160, 1e6}, {250, 2e6}, {280, 9e6}}){
+        CAPTURE(T, p);
+        double rho = model->solve_rho_Tp(T, p, z);
+        auto b = model->get_property_bundle(T, rho, z, properties::h | properties::s | properties::cp, aig.get());
+        table.get_all(p, b.h, out);
+        CHECK(out[0] == Approx(T).epsilon(1e-6));
+        CHECK(out[1] == Approx(rho).epsilon(1e-5));
+        CHECK(out[2] == Approx(b.s).epsilon(1e-5));
+        CHECK(out[3] == Approx(b.cp).epsilon(1e-5));
+    }
+
+    // Two-phase, at the saturation temperature, and with the lever rule in the molar volume
+    double T = 150, q = 0.25;
+    auto rhos = sa.get_rhoLrhoV(*model, T);
+    auto bL = model->get_property_bundle(T, rhos[0], z, properties::h, aig.get()), bV = model->get_property_bundle(T, rhos[1], z, properties::h, aig.get());
+    table.get_all(sa.get_p(T), (1 - q)*bL.h + q*bV.h, out);
+    CHECK(out[0] == Approx(T).epsilon(1e-6));
+    CHECK(out[1] == Approx(1/((1 - q)/rhos[0] + q/rhos[1])).epsilon(1e-5));
+    CHECK(std::isnan(out[3]));
+}
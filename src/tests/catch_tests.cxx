@@ -6,6 +6,8 @@ using Catch::Approx;
 #include "teqp/core.hpp"
 #include "teqp/models/cubicsuperancillary.hpp"
 #include "teqp/models/CPA.hpp"
+#include "teqp/models/composite.hpp"
+#include "teqp/algorithms/density.hpp"
 #include "teqp/models/vdW.hpp"
 
 #include "teqp/algorithms/VLE.hpp"
@@ -96,6 +98,15 @@ TEST_CASE("Check virial coefficients for vdW", "[virial]")
         CAPTURE(relerr);
         CHECK(relerr < 1e-15);
     }
+
+    // The highest virial coefficients available at runtime
+    auto Bn12 = vd::get_Bnvir_runtime(12, vdW, T, molefrac);
+    auto Bnexact12 = get_vdW_exacts(12);
+    for (auto i = 2; i <= 12; ++i) {
+        CAPTURE(i);
+        CHECK(Bn12[i] == Approx(Bnexact12[i]).epsilon(1e-13));
+    }
+    CHECK_THROWS(vd::get_Bnvir_runtime(13, vdW, T, molefrac));
 }
 
 
@@ -122,6 +133,58 @@ TEST_CASE("Check Hessian of Psir", "[virial]")
     }
 }
 
+TEST_CASE("Check the gradient and Hessian of Psir with vector-mode dual numbers", "[virial]")
+{
+    auto model = build_vdW();
+    using id = IsochoricDerivatives<decltype(model)>;
+    const double T = 298.15;
+    const auto rhovec = (Eigen::ArrayXd(2) << 1000.0, 2000.0).finished();
+
+    auto Psir = id::get_Psir_vector_dual<vdual2nd>(model, T, rhovec);
+    CHECK(Psir.val == Approx(id::get_Psir(model, T, rhovec)));
+    auto gcsd = id::build_Psir_gradient_complex_step(model, T, rhovec);
+    auto g = id::build_Psir_gradient_autodiff(model, T, rhovec);
+    auto H = id::build_Psir_Hessian_autodiff(model, T, rhovec);
+    auto Hmcx = id::build_Psir_Hessian_mcx(model, T, rhovec);
+    for (auto i = 0; i < 2; ++i) {
+        CHECK(g[i] == Approx(gcsd[i]).epsilon(1e-13));
+        CHECK(Psir.grad[i] == Approx(gcsd[i]).epsilon(1e-13));
+        for (auto j = 0; j < 2; ++j) {
+            CHECK(H(i, j) == Approx(Hmcx(i, j)).epsilon(1e-12));
+        }
+    }
+}
+
+TEST_CASE("Check the derivatives with static multicomplex numbers against autodiff", "[multicomplex]")
+{
+    auto model = build_vdW();
+    using tdx = TDXDerivatives<decltype(model)>;
+    const double T = 298.15, rho = 3000.0;
+    const auto molefrac = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+
+    auto Ar0nad = tdx::get_Ar0n<6>(model, T, rho, molefrac);
+    auto Ar0nmcx = tdx::get_Ar0n<6, ADBackends::multicomplex>(model, T, rho, molefrac);
+    auto Arn0ad = tdx::get_Arn0<4>(model, T, rho, molefrac);
+    auto Arn0mcx = tdx::get_Arn0<4, ADBackends::multicomplex>(model, T, rho, molefrac);
+    for (auto n = 1; n <= 6; ++n) {
+        CAPTURE(n);
+        CHECK(Ar0nmcx[n] == Approx(Ar0nad[n]).epsilon(1e-12));
+        if (n <= 4) {
+            CHECK(Arn0mcx[n] == Approx(Arn0ad[n]).epsilon(1e-12));
+        }
+    }
+    auto Ar23ad = tdx::get_Arxy<2, 3>(model, T, rho, molefrac);
+    auto Ar23mcx = tdx::get_Arxy<2, 3, ADBackends::multicomplex>(model, T, rho, molefrac);
+    CHECK(Ar23mcx == Approx(Ar23ad).epsilon(1e-12));
+
+    // The derivatives of order 0 to N of one evaluation
+    auto ders = diff_static_mcx1<8>([](const auto& x) { return exp(x); }, 0.5);
+    for (auto n = 0; n <= 8; ++n) {
+        CAPTURE(n);
+        CHECK(ders[n] == Approx(std::exp(0.5)).epsilon(1e-14));
+    }
+}
+
 TEST_CASE("Check p four ways for vdW", "[virial][p]")
 {
     auto model = build_simple();
@@ -238,6 +301,47 @@ TEST_CASE("Test infinite dilution critical locus derivatives", "[vdWcrit]")
     }
 }
 
+TEST_CASE("Check tracking of the eigenvector of the smallest eigenvalue", "[vdW][crit]")
+{
+    std::valarray<double> Tc_K = { 150.687, 289.733, 190.564, 305.32 };
+    std::valarray<double> pc_Pa = { 4863000.0, 5842000.0, 4599200.0, 4872200.0 };
+    vdWEOS<double> vdW(Tc_K, pc_Pa);
+    using ct = CriticalTracing<decltype(vdW), double, Eigen::ArrayXd>;
+
+    double T = 200.0;
+    Eigen::ArrayXd rhovec = (Eigen::ArrayXd(4) << 3000.0, 2000.0, 2500.0, 1500.0).finished();
+    auto e = ct::eigen_problem(vdW, T, rhovec);
+    for (double rel : {1e-7, 1e-5, 1e-3}){
+        CAPTURE(rel);
+        Eigen::ArrayXd rhovec_perturbed = rhovec + rel*rhovec.sum()*e.eigenvectorscols.col(1);
+        auto full = ct::eigen_problem(vdW, T*(1 + rel), rhovec_perturbed, e.v0);
+        auto tracked = ct::eigen_problem_incremental(vdW, T*(1 + rel), rhovec_perturbed, e.v0);
+        CHECK(tracked.eigenvalues(0) == Approx(full.eigenvalues(0)).epsilon(1e-10));
+        CHECK((tracked.v0 - full.v0).abs().maxCoeff() < 1e-10);
+    }
+    // Without a seed, the complete problem is solved
+    CHECK(ct::eigen_problem_incremental(vdW, T, rhovec, Eigen::ArrayXd()).v1.size() == 4);
+}
+
+TEST_CASE("Check the directional derivatives of Psir along the eigenvector", "[vdW][crit]")
+{
+    std::valarray<double> Tc_K = { 150.687, 289.733, 190.564 };
+    std::valarray<double> pc_Pa = { 4863000.0, 5842000.0, 4599200.0 };
+    vdWEOS<double> vdW(Tc_K, pc_Pa);
+    using ct = CriticalTracing<decltype(vdW), double, Eigen::ArrayXd>;
+    using id = IsochoricDerivatives<decltype(vdW), double, Eigen::ArrayXd>;
+
+    double T = 200.0;
+    Eigen::ArrayXd rhovec = (Eigen::ArrayXd(3) << 3000.0, 2000.0, 2500.0).finished();
+    auto derivs = ct::get_derivs(vdW, T, rhovec);
+    Eigen::VectorXd v = derivs.ei.v0.matrix();
+    auto d2 = [&](const Eigen::ArrayXd& r){ return v.dot(id::build_Psir_Hessian_autodiff(vdW, T, r).matrix()*v); };
+    double h = 1e-3;
+    CHECK(derivs.psir[2] == Approx(d2(rhovec)).epsilon(1e-12));
+    CHECK(derivs.psir[3] == Approx((d2(rhovec + h*v.array()) - d2(rhovec - h*v.array()))/(2*h)).epsilon(1e-6));
+    CHECK(derivs.tot[2] == Approx(derivs.ei.eigenvalues(0)).epsilon(1e-10));
+}
+
 TEST_CASE("Trace critical locus for vdW", "[vdW][crit]")
 {
     // Argon + Xenon
@@ -299,6 +403,21 @@ TEST_CASE("Check criticality conditions for vdW", "[vdW][crit]")
     auto T0 = Tc_K[0] + 0.1;
     auto [Tfinal, rhofinal] = solve_pure_critical(vdW, T0, rhoc);
     CHECK(Tfinal == Approx(Tc_K[0]));
+
+    // The Jacobian from the tensor of derivatives matches the one from the separate mixed derivatives
+    using tdx = TDXDerivatives<decltype(vdW)>;
+    auto z = (Eigen::ArrayXd(1) << 1.0).finished();
+    double T = 1.1*Tc_K[0], rho = 0.9*rhoc, R = vdW.R(z);
+    auto [resids2, J2] = get_pure_critical_conditions_Jacobian(vdW, T, rho);
+    auto ders = tdx::get_Ar0n<4>(vdW, T, rho, z);
+    auto Ar11 = tdx::get_Ar11(vdW, T, rho, z), Ar12 = tdx::get_Ar12(vdW, T, rho, z), Ar13 = tdx::get_Arxy<1, 3>(vdW, T, rho, z);
+    CHECK(J2(0, 0) == Approx(R*(-(Ar12 + 2*Ar11) + ders[2] + 2*ders[1] + 1)));
+    CHECK(J2(1, 0) == Approx(R/rho*(-(Ar13 + 4*Ar12 + 2*Ar11) + ders[3] + 4*ders[2] + 2*ders[1])));
+
+    // Warm start from a nearby critical point, stopping once converged
+    auto [Twarm, rhowarm] = solve_pure_critical(vdW, 1.001*Tc_K[0], 1.001*rhoc, nlohmann::json{{"tol", 1e-12}, {"maxsteps", 4}});
+    CHECK(Twarm == Approx(Tc_K[0]).epsilon(1e-10));
+    CHECK(rhowarm == Approx(rhoc).epsilon(1e-10));
 }
 
 TEST_CASE("TEST B12", "") {
@@ -384,6 +503,40 @@ TEST_CASE("Test extrapolate from critical point", "[extrapolate_from_critical]")
     CHECK_NOTHROW(stepper(10.0));
 }
 
+TEST_CASE("Evaluate the cubic superancillaries at many temperatures", "[superanc]") {
+    using namespace CubicSuperAncillary;
+    for (auto EOS : {VDW_CODE, SRK_CODE, PR_CODE}) {
+        for (auto prop : {P_CODE, RHOL_CODE, RHOV_CODE}) {
+            const auto& table = get_supercubic_table(EOS, prop);
+            const double xmin = table.get_xmin(), xmax = table.get_xmax();
+            std::vector<double> x = { xmin, xmax, xmin*0.99, xmax*1.01, std::nan("") };
+            for (auto i = 0; i < 1000; ++i) {
+                x.push_back(xmin + (xmax - xmin)*i/999.0);
+            }
+            // Close to the end, where the expansions are narrowest
+            for (auto i = 0; i < 100; ++i) {
+                x.push_back(xmax*(1 - 1e-8*i));
+            }
+            std::vector<std::uint8_t> ok;
+            auto y = table.y_many(x, ok);
+            REQUIRE(ok.size() == x.size());
+            CHECK(!ok[2]);
+            CHECK(!ok[3]);
+            CHECK(!ok[4]);
+            CHECK(std::isnan(y[3]));
+            for (auto i = 0U; i < x.size(); ++i) {
+                if (i < 2 || i > 4) {
+                    CAPTURE(x[i]);
+                    CHECK(ok[i]);
+                    CHECK(y[i] == supercubic(EOS, prop, x[i]));
+                }
+            }
+        }
+    }
+    CHECK_THROWS(get_supercubic_table(VDW_CODE, 103));
+    CHECK_THROWS(get_supercubic_table(UNKNOWN_CODE, P_CODE));
+}
+
 TEST_CASE("Test pure VLE", "") {
     const auto model = build_vdW_argon();
     double T = 100.0;
@@ -475,6 +628,179 @@ TEST_CASE("Test water w/ factory", "") {
    //REQUIRE(p_withassoc == 3.14);
 }
 
+TEST_CASE("Test general CPA association solver against pure fluid", "[CPA]") {
+    using namespace CPA;
+    for (std::string cl : {"1A", "2B", "3B", "4C"}) {
+        nlohmann::json water = {
+            {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+            {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class",cl}
+        };
+        nlohmann::json jpure = { {"cubic","SRK"}, {"pures", {water}}, {"R_gas / J/mol/K", 8.3144598} };
+        nlohmann::json jmix = { {"cubic","SRK"}, {"pures", {water, water}}, {"R_gas / J/mol/K", 8.3144598} };
+        auto pure = CPAfactory(jpure);
+        auto mix = CPAfactory(jmix);
+
+        double T = 400;
+        auto z1 = (Eigen::ArrayXd(1) << 1).finished();
+        auto z2 = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+        for (double rhomolar : {100.0, 10000.0, 50000.0}) {
+            CAPTURE(cl);
+            CAPTURE(rhomolar);
+            // A mixture of two identical components is the pure fluid with its explicit solution
+            auto expected = pure.alphar(T, rhomolar, z1);
+            CHECK(mix.alphar(T, rhomolar, z2) == Approx(expected).epsilon(1e-12));
+            auto Ar01 = TDXDerivatives<decltype(mix)>::get_Ar01(mix, T, rhomolar, z2);
+            CHECK(Ar01 == Approx(TDXDerivatives<decltype(pure)>::get_Ar01(pure, T, rhomolar, z1)).epsilon(1e-10));
+            // Higher derivatives of the site fractions from the implicit-function theorem
+            auto Ar02 = TDXDerivatives<decltype(mix)>::get_Ar02(mix, T, rhomolar, z2);
+            CHECK(Ar02 == Approx(TDXDerivatives<decltype(pure)>::get_Ar02(pure, T, rhomolar, z1)).epsilon(1e-10));
+            auto Ar20 = TDXDerivatives<decltype(mix)>::get_Ar20(mix, T, rhomolar, z2);
+            CHECK(Ar20 == Approx(TDXDerivatives<decltype(pure)>::get_Ar20(pure, T, rhomolar, z1)).epsilon(1e-10));
+
+            // Warm starts give the same values
+            mix.enable_warm_start(true);
+            CHECK(mix.alphar(T, rhomolar, z2) == Approx(expected).epsilon(1e-12));
+            CHECK(mix.alphar(T, rhomolar, z2) == Approx(expected).epsilon(1e-12));
+            mix.enable_warm_start(false);
+        }
+    }
+}
+
+TEST_CASE("Test the choice of the radial distribution function of CPA", "[CPA]") {
+    using namespace CPA;
+    nlohmann::json water = {
+        {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+        {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class","4C"}
+    };
+    double T = 400, rhomolar = 30000;
+    auto z1 = (Eigen::ArrayXd(1) << 1).finished();
+    auto z2 = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    std::map<std::string, double> values;
+    for (std::string dist : {"CS", "KG", "OT"}) {
+        CAPTURE(dist);
+        nlohmann::json jpure = { {"cubic","SRK"}, {"pures", {water}}, {"R_gas / J/mol/K", 8.3144598}, {"radial_dist", dist} };
+        nlohmann::json jmix = { {"cubic","SRK"}, {"pures", {water, water}}, {"R_gas / J/mol/K", 8.3144598}, {"radial_dist", dist} };
+        auto pure = CPAfactory(jpure);
+        auto mix = CPAfactory(jmix);
+        // The explicit pure-fluid solution and the general solver use the same radial distribution function
+        values[dist] = pure.alphar(T, rhomolar, z1);
+        CHECK(mix.alphar(T, rhomolar, z2) == Approx(values[dist]).epsilon(1e-12));
+    }
+    CHECK(values["CS"] != values["KG"]);
+    // KG is the default
+    nlohmann::json jdefault = { {"cubic","SRK"}, {"pures", {water}}, {"R_gas / J/mol/K", 8.3144598} };
+    CHECK(CPAfactory(jdefault).alphar(T, rhomolar, z1) == values["KG"]);
+    nlohmann::json jbad = jdefault; jbad["radial_dist"] = "XX";
+    CHECK_THROWS(CPAfactory(jbad));
+}
+
+TEST_CASE("Test CPA site fractions with the scratch arrays in an arena", "[CPA][arena]") {
+    using namespace CPA;
+    nlohmann::json water = {
+        {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+        {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class","4C"}
+    };
+    nlohmann::json methanol = {
+        {"a0i / Pa m^6/mol^2",0.40531 }, {"bi / m^3/mol", 0.0000309}, {"c1", 0.4310}, {"Tc / K", 512.64},
+        {"epsABi / J/mol", 24591.0}, {"betaABi", 0.01610}, {"class","2B"}
+    };
+    nlohmann::json j = { {"cubic","SRK"}, {"pures", {water, methanol}}, {"R_gas / J/mol/K", 8.3144598} };
+    auto cpa = CPAfactory(j);
+    using tdx = TDXDerivatives<decltype(cpa)>;
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    double T = 400;
+    arena::Arena scratch;
+    for (double rho : {10.0, 20000.0}) {
+        CAPTURE(rho);
+        auto alphar = cpa.alphar(T, rho, z);
+        auto Ar01 = tdx::get_Ar01(cpa, T, rho, z), Ar02 = tdx::get_Ar02(cpa, T, rho, z);
+        {
+            arena::ScopedArena guard(scratch);
+            CHECK(arena::get_current_arena() == &scratch);
+            CHECK(cpa.alphar(T, rho, z) == alphar);
+            CHECK(tdx::get_Ar01(cpa, T, rho, z) == Ar01);
+            CHECK(tdx::get_Ar02(cpa, T, rho, z) == Ar02);
+            // The scratch arrays are given back as the calls return, so the arena does not grow
+            CHECK(scratch.get_used() == 0);
+        }
+        CHECK(arena::get_current_arena() == nullptr);
+    }
+    CHECK(scratch.get_capacity() == 65536);
+
+    // Without an arena the arrays are on the heap
+    arena::ArenaArray<double> onheap(3);
+    onheap.setConstant(1.0);
+    CHECK(onheap.sum() == 3.0);
+    {
+        arena::ScopedArena outer(scratch);
+        arena::ArenaArray<double> x(10);
+        auto used = scratch.get_used();
+        CHECK(used >= 10*sizeof(double));
+        {
+            arena::ScopedArena inner;
+            CHECK(arena::get_current_arena() != &scratch);
+        }
+        CHECK(arena::get_current_arena() == &scratch);
+        {
+            // Too large for the rest of the block, so another block is added
+            arena::ArenaArray<double, Eigen::Dynamic, Eigen::Dynamic> big(100, 100);
+            big.setZero();
+            CHECK(scratch.get_capacity() > 65536);
+        }
+        CHECK(scratch.get_used() == used);
+    }
+    CHECK(scratch.get_used() == 0);
+}
+
+TEST_CASE("Test CPA densities from T and p", "[CPA][density]") {
+    using namespace CPA;
+    nlohmann::json water = {
+        {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+        {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class","4C"}
+    };
+    nlohmann::json j = { {"cubic","SRK"}, {"pures", {water}}, {"R_gas / J/mol/K", 8.3144598} };
+    auto cpa = CPAfactory(j);
+    auto z = (Eigen::ArrayXd(1) << 1).finished();
+    using tdx = TDXDerivatives<decltype(cpa)>;
+    double T = 400, R = 8.3144598;
+    for (double rho : {10.0, 54000.0}) {
+        CAPTURE(rho);
+        double p = rho*R*T*(1 + tdx::get_Ar01(cpa, T, rho, z));
+        // The roots of the cubic part seed the Newton steps on the full model
+        auto phase = (rho > 1000) ? density::RhoPhase::liquid : density::RhoPhase::vapor;
+        CHECK(density::solve_rho_Tp(cpa, T, p, z, phase) == Approx(rho).epsilon(1e-10));
+        density::RhoTpOptions opt; opt.rho_guess = rho*1.1;
+        CHECK(density::solve_rho_Tp_Newton(cpa, T, p, z, opt.rho_guess, opt) == Approx(rho).epsilon(1e-10));
+    }
+}
+
+TEST_CASE("Test CPA built as a composite model", "[CPA][composite]") {
+    using namespace CPA;
+    nlohmann::json water = {
+        {"a0i / Pa m^6/mol^2",0.12277 }, {"bi / m^3/mol", 0.000014515}, {"c1", 0.67359}, {"Tc / K", 647.096},
+        {"epsABi / J/mol", 16655.0}, {"betaABi", 0.0692}, {"class","4C"}
+    };
+    nlohmann::json methanol = {
+        {"a0i / Pa m^6/mol^2",0.40531 }, {"bi / m^3/mol", 0.0000309}, {"c1", 0.4310}, {"Tc / K", 512.64},
+        {"epsABi / J/mol", 24591.0}, {"betaABi", 0.01610}, {"class","2B"}
+    };
+    nlohmann::json j = { {"cubic","SRK"}, {"pures", {water, methanol}}, {"R_gas / J/mol/K", 8.3144598} };
+    auto cpa = CPAfactory(j);
+    // The cubic part computes a and b once; the association part reuses b
+    auto comp = composite::make_composite(cpa.cubic, cpa.cubic, cpa.assoc);
+    auto z = (Eigen::ArrayXd(2) << 0.3, 0.7).finished();
+    double T = 400;
+    for (double rho : {10.0, 20000.0}) {
+        CAPTURE(rho);
+        CHECK(comp.alphar(T, rho, z) == Approx(cpa.alphar(T, rho, z)).epsilon(1e-14));
+        CHECK(TDXDerivatives<decltype(comp)>::get_Ar01(comp, T, rho, z) == Approx(TDXDerivatives<decltype(cpa)>::get_Ar01(cpa, T, rho, z)).epsilon(1e-12));
+        CHECK(TDXDerivatives<decltype(comp)>::get_Ar10(comp, T, rho, z) == Approx(TDXDerivatives<decltype(cpa)>::get_Ar10(cpa, T, rho, z)).epsilon(1e-12));
+    }
+    // A contribution without an overload for the shared intermediates is called with T, rho and the mole fractions
+    auto withvdW = composite::make_composite(cpa.cubic, cpa.cubic, cpa.assoc, vdWEOS1(3.0, 1e-4));
+    CHECK(withvdW.alphar(T, 100.0, z) == Approx(cpa.alphar(T, 100.0, z) + vdWEOS1(3.0, 1e-4).alphar(T, 100.0, z)).epsilon(1e-14));
+}
+
 TEST_CASE("Check zero(ish)","") {
     double zero = 0.0;
     REQUIRE(zero == 0.0);
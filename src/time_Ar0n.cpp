@@ -126,7 +126,9 @@ auto one_deriv(obtainablethings thing, int Ncomp, Taus& taus, Deltas& deltas, co
 
     auto timingREFPROP = some_REFPROP(thing, Ncomp, itau, idelta, taus, deltas, Ts, rhos);
     auto timingteqpad = some_teqp<itau, idelta, ADBackends::autodiff>(thing, Ncomp, taus, deltas, model, Ts, rhos);
-    //auto timingteqpmcx = some_teqp<itau, idelta, ADBackends::multicomplex>(thing, Ncomp, taus, deltas, model, Ts, rhos);
+#if defined(TEQP_MULTICOMPLEX_ENABLED)
+    auto timingteqpmcx = some_teqp<itau, idelta, ADBackends::multicomplex>(thing, Ncomp, taus, deltas, model, Ts, rhos);
+#endif
 
     std::cout << "Values:" << check_values(timingREFPROP) << ", " << check_values(timingteqpad) << std::endl;
 
@@ -135,10 +137,12 @@ auto one_deriv(obtainablethings thing, int Ncomp, Taus& taus, Deltas& deltas, co
                         valsteqpad,   valsteqpmcx,  valsREFPROP;
     for (auto i = 0; i < N; ++i) {
         timesteqpad.push_back(timingteqpad[i].sec_per_call);
-        //timesteqpmcx.push_back(timingteqpmcx[i].sec_per_call);
+#if defined(TEQP_MULTICOMPLEX_ENABLED)
+        timesteqpmcx.push_back(timingteqpmcx[i].sec_per_call);
+        valsteqpmcx.push_back(timingteqpmcx[i].value);
+#endif
         timesREFPROP.push_back(timingREFPROP[i].sec_per_call);
         valsteqpad.push_back(timingteqpad[i].value);
-        //valsteqpmcx.push_back(timingteqpmcx[i].value);
         valsREFPROP.push_back(timingREFPROP[i].value);
     }
     for (auto i = 1; i < 6; ++i) {
@@ -147,10 +151,10 @@ auto one_deriv(obtainablethings thing, int Ncomp, Taus& taus, Deltas& deltas, co
     nlohmann::json j = {
         {"timeteqp",timesteqpad},
         {"timeteqp(autodiff)",timesteqpad},
-        //{"timeteqp(multicomplex)",timesteqpmcx},
         {"timeREFPROP",timesREFPROP},
+        {"timeteqp(multicomplex)",timesteqpmcx},
+        {"valteqp(multicomplex)",valsteqpmcx},
         {"valteqp(autodiff)",valsteqpad},
-        //{"valteqp(multicomplex)",valsteqpmcx},
         {"valREFPROP",valsREFPROP},
         {"model", modelname},
         {"itau", itau},